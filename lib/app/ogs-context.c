@@ -210,6 +210,32 @@ static void app_context_prepare(void)
      */
     self.time.handover.duration = ogs_time_from_msec(300);
 
+    /*
+     * Subscriber Cache : disabled (Default)
+     *
+     * If enabled, a cached subscriber document lives for 60 seconds
+     * unless a MongoDB change stream invalidates it earlier.
+     */
+    self.db.cache.max = 0;
+    self.db.cache.ttl = ogs_time_from_sec(60);
+
+    /*
+     * DB Workers (UDR/PCF)
+     *
+     * 4 threads serve up to 256 DB requests at once.
+     * A request still waiting after 3 seconds is answered with an error.
+     */
+    self.db.worker.num = 4;
+    self.db.worker.max = 256;
+    self.db.worker.timeout = ogs_time_from_sec(3);
+
+    /*
+     * SQN Write-behind (HSS/UDR) : disabled (Default)
+     *
+     * Every SQN update is written to MongoDB immediately.
+     */
+    self.db.sqn.flush_interval = 0;
+
     /* Size of internal metrics pool (amount of ogs_metrics_spec_t) */
     self.metrics.max_specs = 512;
 
@@ -234,6 +260,15 @@ static int app_context_validation(void)
         return OGS_ERROR;
     }
 
+    if (self.db.worker.max <= 0) {
+        ogs_error("DB worker max should be greater than 0");
+        ogs_error("db:");
+        ogs_error("  worker:");
+        ogs_error("    max: %d", self.db.worker.max);
+
+        return OGS_ERROR;
+    }
+
     return OGS_OK;
 }
 
@@ -252,6 +287,68 @@ int ogs_app_context_parse_config(void)
         ogs_assert(root_key);
         if (!strcmp(root_key, "db_uri")) {
             self.db_uri = ogs_yaml_iter_value(&root_iter);
+        } else if (!strcmp(root_key, "db")) {
+            ogs_yaml_iter_t db_iter;
+            ogs_yaml_iter_recurse(&root_iter, &db_iter);
+            while (ogs_yaml_iter_next(&db_iter)) {
+                const char *db_key = ogs_yaml_iter_key(&db_iter);
+                ogs_assert(db_key);
+                if (!strcmp(db_key, "cache")) {
+                    ogs_yaml_iter_t cache_iter;
+                    ogs_yaml_iter_recurse(&db_iter, &cache_iter);
+                    while (ogs_yaml_iter_next(&cache_iter)) {
+                        const char *cache_key =
+                            ogs_yaml_iter_key(&cache_iter);
+                        ogs_assert(cache_key);
+                        if (!strcmp(cache_key, "max")) {
+                            const char *v = ogs_yaml_iter_value(&cache_iter);
+                            if (v) self.db.cache.max = atoi(v);
+                        } else if (!strcmp(cache_key, "ttl")) {
+                            const char *v = ogs_yaml_iter_value(&cache_iter);
+                            if (v) self.db.cache.ttl =
+                                    ogs_time_from_sec(atoll(v));
+                        } else if (!strcmp(cache_key, "no_watch")) {
+                            self.db.cache.no_watch =
+                                ogs_yaml_iter_bool(&cache_iter);
+                        } else
+                            ogs_warn("unknown key `%s`", cache_key);
+                    }
+                } else if (!strcmp(db_key, "worker")) {
+                    ogs_yaml_iter_t worker_iter;
+                    ogs_yaml_iter_recurse(&db_iter, &worker_iter);
+                    while (ogs_yaml_iter_next(&worker_iter)) {
+                        const char *worker_key =
+                            ogs_yaml_iter_key(&worker_iter);
+                        ogs_assert(worker_key);
+                        if (!strcmp(worker_key, "num")) {
+                            const char *v = ogs_yaml_iter_value(&worker_iter);
+                            if (v) self.db.worker.num = atoi(v);
+                        } else if (!strcmp(worker_key, "max")) {
+                            const char *v = ogs_yaml_iter_value(&worker_iter);
+                            if (v) self.db.worker.max = atoi(v);
+                        } else if (!strcmp(worker_key, "timeout")) {
+                            const char *v = ogs_yaml_iter_value(&worker_iter);
+                            if (v) self.db.worker.timeout =
+                                    ogs_time_from_msec(atoll(v));
+                        } else
+                            ogs_warn("unknown key `%s`", worker_key);
+                    }
+                } else if (!strcmp(db_key, "sqn")) {
+                    ogs_yaml_iter_t sqn_iter;
+                    ogs_yaml_iter_recurse(&db_iter, &sqn_iter);
+                    while (ogs_yaml_iter_next(&sqn_iter)) {
+                        const char *sqn_key = ogs_yaml_iter_key(&sqn_iter);
+                        ogs_assert(sqn_key);
+                        if (!strcmp(sqn_key, "flush_interval")) {
+                            const char *v = ogs_yaml_iter_value(&sqn_iter);
+                            if (v) self.db.sqn.flush_interval =
+                                    ogs_time_from_msec(atoll(v));
+                        } else
+                            ogs_warn("unknown key `%s`", sqn_key);
+                    }
+                } else
+                    ogs_warn("unknown key `%s`", db_key);
+            }
         } else if (!strcmp(root_key, "logger")) {
             ogs_yaml_iter_t logger_iter;
             ogs_yaml_iter_recurse(&root_iter, &logger_iter);
@@ -350,6 +447,9 @@ int ogs_app_context_parse_config(void)
                 } else if (!strcmp(parameter_key, "no_pfcp_rr_select")) {
                     self.parameter.no_pfcp_rr_select =
                         ogs_yaml_iter_bool(&parameter_iter);
+                } else if (!strcmp(parameter_key, "use_nghttp2_client")) {
+                    self.parameter.use_nghttp2_client =
+                        ogs_yaml_iter_bool(&parameter_iter);
                 } else
                     ogs_warn("unknown key `%s`", parameter_key);
             }
@@ -425,6 +525,9 @@ int ogs_app_context_parse_config(void)
                     const char *v = ogs_yaml_iter_value(&pool_iter);
                     if (v)
                         self.pool.defconfig.cluster_big_pool = atoi(v);
+                } else if (!strcmp(pool_key, "hugepage")) {
+                    ogs_core()->pool.hugepage =
+                        ogs_yaml_iter_bool(&pool_iter);
                 } else
                     ogs_warn("unknown key `%s`", pool_key);
             }
@@ -35,6 +35,22 @@ typedef struct ogs_app_context_s {
     void *document;
 
     const char *db_uri;
+    struct {
+        struct {
+            int max;
+            ogs_time_t ttl;
+            int no_watch;
+        } cache;
+        struct {
+            int num;
+            int max;
+            ogs_time_t timeout;
+        } worker;
+        struct {
+            ogs_time_t flush_interval;
+        } sqn;
+    } db;
+
     struct {
         const char *file;
         const char *level;
@@ -77,6 +93,9 @@ typedef struct ogs_app_context_s {
         int no_ipv4v6_local_addr_in_packet_filter;
 
         int no_pfcp_rr_select;
+
+        /* SBI */
+        int use_nghttp2_client;
     } parameter;
 
     struct {
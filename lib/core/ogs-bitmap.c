@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+
+#define WORD_BITS               64
+#define PAGE_WORDS              64
+#define PAGE_BITS               (WORD_BITS * PAGE_WORDS)
+#define FULL_WORD               (~(uint64_t)0)
+
+#define BIT(__iNDEX)            ((uint64_t)1 << ((__iNDEX) % WORD_BITS))
+#define FIRST_ZERO(__wORD)      __builtin_ctzll(~(__wORD))
+
+typedef struct ogs_bitmap_page_s {
+    uint64_t full;              /* A bit per word which is full */
+    uint32_t used;
+    uint64_t word[PAGE_WORDS];
+} ogs_bitmap_page_t;
+
+struct ogs_bitmap_s {
+    uint32_t size;
+    uint32_t used;
+
+    uint32_t num_of_page;
+    uint32_t num_of_allocated_page;
+    ogs_bitmap_page_t **page;   /* NULL until the page is first used */
+
+    uint64_t *page_full;        /* A bit per page which is full */
+    uint64_t top;               /* A bit per page_full word which is full */
+};
+
+static ogs_bitmap_page_t *page_get(ogs_bitmap_t *bitmap, uint32_t p)
+{
+    ogs_bitmap_page_t *page = bitmap->page[p];
+
+    if (!page) {
+        page = ogs_calloc(1, sizeof(*page));
+        ogs_assert(page);
+        bitmap->page[p] = page;
+        bitmap->num_of_allocated_page++;
+    }
+
+    return page;
+}
+
+static void page_mark(ogs_bitmap_t *bitmap, uint32_t index)
+{
+    uint32_t p = index / PAGE_BITS;
+    uint32_t w = (index % PAGE_BITS) / WORD_BITS;
+    ogs_bitmap_page_t *page = bitmap->page[p];
+
+    page->word[w] |= BIT(index);
+    page->used++;
+
+    if (page->word[w] != FULL_WORD)
+        return;
+    page->full |= BIT(w);
+
+    if (page->full != FULL_WORD)
+        return;
+    bitmap->page_full[p / WORD_BITS] |= BIT(p);
+
+    if (bitmap->page_full[p / WORD_BITS] != FULL_WORD)
+        return;
+    bitmap->top |= BIT(p / WORD_BITS);
+}
+
+ogs_bitmap_t *ogs_bitmap_create(uint32_t size)
+{
+    ogs_bitmap_t *bitmap = NULL;
+    uint32_t i, num_of_word;
+
+    ogs_assert(size > 0 && size <= OGS_BITMAP_MAX_SIZE);
+
+    bitmap = ogs_calloc(1, sizeof(*bitmap));
+    ogs_assert(bitmap);
+
+    bitmap->size = size;
+    bitmap->num_of_page = (size + PAGE_BITS - 1) / PAGE_BITS;
+    bitmap->page = ogs_calloc(bitmap->num_of_page, sizeof(*bitmap->page));
+    ogs_assert(bitmap->page);
+
+    num_of_word = (bitmap->num_of_page + WORD_BITS - 1) / WORD_BITS;
+    bitmap->page_full = ogs_calloc(num_of_word, sizeof(uint64_t));
+    ogs_assert(bitmap->page_full);
+
+    /* Pages and words past the end are never free */
+    for (i = bitmap->num_of_page; i < num_of_word * WORD_BITS; i++)
+        bitmap->page_full[i / WORD_BITS] |= BIT(i);
+    for (i = num_of_word; i < WORD_BITS; i++)
+        bitmap->top |= BIT(i);
+
+    if (size % PAGE_BITS) {
+        page_get(bitmap, bitmap->num_of_page - 1);
+        for (i = size; i < bitmap->num_of_page * PAGE_BITS; i++)
+            page_mark(bitmap, i);
+    }
+
+    return bitmap;
+}
+
+void ogs_bitmap_destroy(ogs_bitmap_t *bitmap)
+{
+    uint32_t i;
+
+    ogs_assert(bitmap);
+
+    for (i = 0; i < bitmap->num_of_page; i++) {
+        if (bitmap->page[i])
+            ogs_free(bitmap->page[i]);
+    }
+    ogs_free(bitmap->page);
+    ogs_free(bitmap->page_full);
+    ogs_free(bitmap);
+}
+
+int ogs_bitmap_alloc(ogs_bitmap_t *bitmap, uint32_t *index)
+{
+    ogs_bitmap_page_t *page = NULL;
+    uint32_t i, p, w;
+
+    ogs_assert(bitmap);
+    ogs_assert(index);
+
+    if (bitmap->top == FULL_WORD)
+        return OGS_ERROR;
+
+    i = FIRST_ZERO(bitmap->top);
+    p = i * WORD_BITS + FIRST_ZERO(bitmap->page_full[i]);
+
+    page = page_get(bitmap, p);
+    w = FIRST_ZERO(page->full);
+
+    *index = p * PAGE_BITS + w * WORD_BITS + FIRST_ZERO(page->word[w]);
+    ogs_assert(*index < bitmap->size);
+
+    page_mark(bitmap, *index);
+    bitmap->used++;
+
+    return OGS_OK;
+}
+
+bool ogs_bitmap_set(ogs_bitmap_t *bitmap, uint32_t index)
+{
+    ogs_bitmap_page_t *page = NULL;
+
+    ogs_assert(bitmap);
+    ogs_assert(index < bitmap->size);
+
+    page = page_get(bitmap, index / PAGE_BITS);
+    if (page->word[(index % PAGE_BITS) / WORD_BITS] & BIT(index))
+        return false;
+
+    page_mark(bitmap, index);
+    bitmap->used++;
+
+    return true;
+}
+
+void ogs_bitmap_clear(ogs_bitmap_t *bitmap, uint32_t index)
+{
+    ogs_bitmap_page_t *page = NULL;
+    uint32_t p, w;
+
+    ogs_assert(bitmap);
+    ogs_assert(index < bitmap->size);
+
+    p = index / PAGE_BITS;
+    w = (index % PAGE_BITS) / WORD_BITS;
+
+    page = bitmap->page[p];
+    if (!page || !(page->word[w] & BIT(index))) {
+        ogs_error("Index[%d] is not used", index);
+        return;
+    }
+
+    page->word[w] &= ~BIT(index);
+    page->full &= ~BIT(w);
+    bitmap->page_full[p / WORD_BITS] &= ~BIT(p);
+    bitmap->top &= ~BIT(p / WORD_BITS);
+
+    bitmap->used--;
+
+    if (--page->used == 0) {
+        ogs_free(page);
+        bitmap->page[p] = NULL;
+        bitmap->num_of_allocated_page--;
+    }
+}
+
+bool ogs_bitmap_test(ogs_bitmap_t *bitmap, uint32_t index)
+{
+    ogs_bitmap_page_t *page = NULL;
+
+    ogs_assert(bitmap);
+    ogs_assert(index < bitmap->size);
+
+    page = bitmap->page[index / PAGE_BITS];
+    if (!page)
+        return false;
+
+    return (page->word[(index % PAGE_BITS) / WORD_BITS] & BIT(index)) != 0;
+}
+
+uint32_t ogs_bitmap_size(ogs_bitmap_t *bitmap)
+{
+    ogs_assert(bitmap);
+    return bitmap->size;
+}
+
+uint32_t ogs_bitmap_used(ogs_bitmap_t *bitmap)
+{
+    ogs_assert(bitmap);
+    return bitmap->used;
+}
+
+size_t ogs_bitmap_memory(ogs_bitmap_t *bitmap)
+{
+    ogs_assert(bitmap);
+
+    return sizeof(*bitmap) +
+        bitmap->num_of_page * sizeof(*bitmap->page) +
+        ((bitmap->num_of_page + WORD_BITS - 1) / WORD_BITS) *
+            sizeof(uint64_t) +
+        bitmap->num_of_allocated_page * sizeof(ogs_bitmap_page_t);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_CORE_INSIDE) && !defined(OGS_CORE_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_BITMAP_H
+#define OGS_BITMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Hierarchical free bitmap for allocating indexes out of a large range.
+ *
+ * Four levels of 64-bit words cover OGS_BITMAP_MAX_SIZE bits, so finding
+ * the lowest free index looks at one word per level. The leaf pages
+ * (4096 bits each) are allocated on first use and released once empty,
+ * so a mostly free bitmap costs almost nothing.
+ */
+#define OGS_BITMAP_MAX_SIZE (1 << 24)
+
+typedef struct ogs_bitmap_s ogs_bitmap_t;
+
+ogs_bitmap_t *ogs_bitmap_create(uint32_t size);
+void ogs_bitmap_destroy(ogs_bitmap_t *bitmap);
+
+/* Takes the lowest free index. Returns OGS_ERROR if all are used */
+int ogs_bitmap_alloc(ogs_bitmap_t *bitmap, uint32_t *index);
+/* Takes the given index. Returns false if it is already used */
+bool ogs_bitmap_set(ogs_bitmap_t *bitmap, uint32_t index);
+void ogs_bitmap_clear(ogs_bitmap_t *bitmap, uint32_t index);
+bool ogs_bitmap_test(ogs_bitmap_t *bitmap, uint32_t index);
+
+uint32_t ogs_bitmap_size(ogs_bitmap_t *bitmap);
+uint32_t ogs_bitmap_used(ogs_bitmap_t *bitmap);
+/* Bytes currently allocated for the bitmap */
+size_t ogs_bitmap_memory(ogs_bitmap_t *bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_BITMAP_H */
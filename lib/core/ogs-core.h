@@ -60,6 +60,7 @@
 #include "core/ogs-env.h"
 #include "core/ogs-fsm.h"
 #include "core/ogs-hash.h"
+#include "core/ogs-bitmap.h"
 #include "core/ogs-misc.h"
 #include "core/ogs-getopt.h"
 
@@ -91,6 +92,10 @@ typedef struct {
         int pool;
     } tlv;
 
+    struct {
+        bool hugepage;
+    } pool;
+
 } ogs_core_context_t;
 
 void ogs_core_initialize(void);
@@ -45,18 +45,51 @@ const ogs_pollset_actions_t ogs_epoll_actions = {
     ogs_notify_pollset,
 };
 
+/*
+ * Entries are indexed by fd, so the table is as large as the highest fd
+ * seen and grows by doubling.
+ */
 struct epoll_map_s {
     ogs_poll_t *read;
     ogs_poll_t *write;
+
+    uint32_t events;            /* Registered with epoll_ctl(), 0 if none */
 };
 
 struct epoll_context_s {
     int epfd;
 
-    ogs_hash_t *map_hash;
+    struct epoll_map_s *map;
+    int num_of_map;
+
     struct epoll_event *event_list;
 };
 
+static struct epoll_map_s *map_get(
+        struct epoll_context_s *context, ogs_socket_t fd)
+{
+    struct epoll_map_s *map = NULL;
+    int num_of_map;
+
+    ogs_assert(fd >= 0);
+
+    if (fd >= context->num_of_map) {
+        num_of_map = context->num_of_map ? context->num_of_map : 64;
+        while (num_of_map <= fd)
+            num_of_map *= 2;
+
+        map = ogs_realloc(context->map, num_of_map * sizeof(*map));
+        ogs_expect_or_return_val(map, NULL);
+        memset(map + context->num_of_map, 0,
+                (num_of_map - context->num_of_map) * sizeof(*map));
+
+        context->map = map;
+        context->num_of_map = num_of_map;
+    }
+
+    return &context->map[fd];
+}
+
 static void epoll_init(ogs_pollset_t *pollset)
 {
     struct epoll_context_s *context = NULL;
@@ -70,9 +103,6 @@ static void epoll_init(ogs_pollset_t *pollset)
             pollset->capacity, sizeof(struct epoll_event));
     ogs_assert(context->event_list);
 
-    context->map_hash = ogs_hash_make();
-    ogs_assert(context->map_hash);
-
     context->epfd = epoll_create(pollset->capacity);
     ogs_assert(context->epfd >= 0);
 
@@ -90,18 +120,74 @@ static void epoll_cleanup(ogs_pollset_t *pollset)
     ogs_notify_final(pollset);
     close(context->epfd);
     ogs_free(context->event_list);
-    ogs_hash_destroy(context->map_hash);
+    if (context->map)
+        ogs_free(context->map);
 
     ogs_free(context);
 }
 
-static int epoll_add(ogs_poll_t *poll)
+/*
+ * Once edge-triggered, an fd keeps EPOLLOUT registered after its write
+ * poll is removed : no edge comes until a write fills the socket up, so
+ * adding and removing the write poll around a short write needs no
+ * epoll_ctl().
+ */
+static uint32_t map_events(struct epoll_map_s *map)
 {
+    uint32_t events = 0;
+
+    if (map->read)
+        events |= (EPOLLIN|EPOLLRDHUP);
+    if (map->write)
+        events |= EPOLLOUT;
+
+    if (map->events & EPOLLET) {
+        if (!map->read && !map->write)
+            return 0;
+        events |= (map->events & EPOLLOUT)|EPOLLET;
+    }
+
+    return events;
+}
+
+static int map_update(struct epoll_context_s *context,
+        struct epoll_map_s *map, ogs_socket_t fd, uint32_t events)
+{
+    struct epoll_event ee;
     int rv, op;
+
+    if (events == map->events)
+        return OGS_OK;
+
+    if (!map->events)
+        op = EPOLL_CTL_ADD;
+    else if (events)
+        op = EPOLL_CTL_MOD;
+    else
+        op = EPOLL_CTL_DEL;
+
+    memset(&ee, 0, sizeof ee);
+    ee.events = events;
+    ee.data.fd = fd;
+
+    map->events = events;
+
+    rv = epoll_ctl(context->epfd, op, fd, &ee);
+    if (rv < 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                "epoll_ctl[%d] failed", op);
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+static int epoll_add(ogs_poll_t *poll)
+{
     ogs_pollset_t *pollset = NULL;
     struct epoll_context_s *context = NULL;
     struct epoll_map_s *map = NULL;
-    struct epoll_event ee;
+    uint32_t events;
 
     ogs_assert(poll);
     pollset = poll->pollset;
@@ -109,48 +195,26 @@ static int epoll_add(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
-    if (!map) {
-        map = ogs_calloc(1, sizeof(*map));
-        ogs_expect_or_return_val(map, OGS_ERROR);
-
-        op = EPOLL_CTL_ADD;
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), map);
-    } else {
-        op = EPOLL_CTL_MOD;
-    }
+    map = map_get(context, poll->fd);
+    ogs_expect_or_return_val(map, OGS_ERROR);
 
     if (poll->when & OGS_POLLIN)
         map->read = poll;
     if (poll->when & OGS_POLLOUT)
         map->write = poll;
 
-    memset(&ee, 0, sizeof ee);
-
-    ee.events = 0;
-    if (map->read)
-        ee.events |= (EPOLLIN|EPOLLRDHUP);
-    if (map->write)
-        ee.events |= EPOLLOUT;
-    ee.data.fd = poll->fd;
+    events = map_events(map);
+    if (poll->when & OGS_POLLET)
+        events |= EPOLLET;
 
-    rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
-    if (rv < 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "epoll_ctl[%d] failed", op);
-        return OGS_ERROR;
-    }
-
-    return OGS_OK;
+    return map_update(context, map, poll->fd, events);
 }
 
 static int epoll_remove(ogs_poll_t *poll)
 {
-    int rv, op;
     ogs_pollset_t *pollset = NULL;
     struct epoll_context_s *context = NULL;
     struct epoll_map_s *map = NULL;
-    struct epoll_event ee;
 
     ogs_assert(poll);
     pollset = poll->pollset;
@@ -158,37 +222,16 @@ static int epoll_remove(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
-    ogs_assert(map);
+    ogs_assert(poll->fd < context->num_of_map);
+    map = &context->map[poll->fd];
 
     if (poll->when & OGS_POLLIN)
         map->read = NULL;
     if (poll->when & OGS_POLLOUT)
         map->write = NULL;
 
-    memset(&ee, 0, sizeof ee);
-
-    ee.events = 0;
-    if (map->read)
-        ee.events |= (EPOLLIN|EPOLLRDHUP);
-    if (map->write)
-        ee.events |= EPOLLOUT;
-
-    if (map->read || map->write) {
-        op = EPOLL_CTL_MOD;
-        ee.data.fd = poll->fd;
-    } else {
-        op = EPOLL_CTL_DEL;
-        ee.data.fd = INVALID_SOCKET;
-
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), NULL);
-        ogs_free(map);
-    }
-
-    rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
-    if (rv < 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "epoll_remove[%d] failed", op);
+    if (map_update(context, map, poll->fd, map_events(map)) != OGS_OK) {
+        ogs_error("epoll_remove() failed");
         return OGS_ERROR;
     }
 
@@ -209,6 +252,7 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
             pollset->capacity,
             timeout == OGS_INFINITE_TIME ? OGS_INFINITE_TIME :
                 ogs_time_to_msec(timeout));
+    ogs_update_loop_time();
     if (num_of_poll < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "epoll failed");
         return OGS_ERROR;
@@ -244,9 +288,9 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
 
         fd = context->event_list[i].data.fd;
         ogs_assert(fd != INVALID_SOCKET);
+        ogs_assert(fd < context->num_of_map);
 
-        map = ogs_hash_get(context->map_hash, &fd, sizeof(fd));
-        if (!map) continue;
+        map = &context->map[fd];
 
         if (map->read && map->write && map->read == map->write) {
             map->read->handler(when, map->read->fd, map->read->data);
@@ -255,11 +299,10 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
                 map->read->handler(when, map->read->fd, map->read->data);
 
             /*
-             * map->read->handler() can call ogs_remove_epoll()
-             * So, we need to check map instance
+             * map->read->handler() can call ogs_pollset_remove()
+             * or add another fd and move the table, so look it up again
              */
-            map = ogs_hash_get(context->map_hash, &fd, sizeof(fd));
-            if (!map) continue;
+            map = &context->map[fd];
 
             if ((when & OGS_POLLOUT) && map->write)
                 map->write->handler(when, map->write->fd, map->write->data);
@@ -65,6 +65,9 @@ void ogs_pollset_destroy(ogs_pollset_t *pollset)
 
     ogs_pool_final(&pollset->pool);
     ogs_free(pollset);
+
+    /* The thread no longer polls, so its loop time would go stale */
+    ogs_reset_loop_time();
 }
 
 ogs_poll_t *ogs_pollset_add(ogs_pollset_t *pollset, short when,
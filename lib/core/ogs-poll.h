@@ -36,6 +36,14 @@ void ogs_pollset_destroy(ogs_pollset_t *pollset);
 #define OGS_POLLIN      0x01
 #define OGS_POLLOUT     0x02
 
+/*
+ * Edge-triggered where the backend supports it (epoll), for every poll of
+ * the fd. The read handler must then read until EAGAIN or a short read,
+ * and a write poll is only reported once the socket has room again after
+ * a write that filled it up, i.e. it is added after a short write.
+ */
+#define OGS_POLLET      0x04
+
 ogs_poll_t *ogs_pollset_add(ogs_pollset_t *pollset, short when,
         ogs_socket_t fd, ogs_poll_handler_f handler, void *data);
 void ogs_pollset_remove(ogs_poll_t *poll);
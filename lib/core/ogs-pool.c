@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core-config-private.h"
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#include "ogs-core.h"
+
+#undef OGS_LOG_DOMAIN
+#define OGS_LOG_DOMAIN __ogs_mem_domain
+
+#define SLAB_SIZE               (256 * 1024)
+#define HUGEPAGE_SIZE           (2 * 1024 * 1024)
+
+/*
+ * Every node is preceded by its slot header, which gives the node's index
+ * back in O(1) and links the node into the free list.
+ */
+#define SLOT_HEADER_LEN         16
+
+typedef struct ogs_pool_slot_s {
+    struct ogs_pool_slot_s *next;
+    ogs_index_t index;
+    bool used;
+} ogs_pool_slot_t;
+
+#define SLOT_TO_NODE(__sLOT)    ((uint8_t *)(__sLOT) + SLOT_HEADER_LEN)
+#define NODE_TO_SLOT(__nODE) \
+    ((ogs_pool_slot_t *)((uint8_t *)(__nODE) - SLOT_HEADER_LEN))
+
+typedef struct ogs_pool_slab_entry_s {
+    uint8_t *base;
+    size_t len;
+    bool mapped;                /* Backed by mmap() rather than malloc() */
+} ogs_pool_slab_entry_t;
+
+struct ogs_pool_slab_s {
+    const char *name;
+
+    int size;                   /* Maximum number of nodes */
+    size_t stride;              /* Slot header + node, 16 byte aligned */
+
+    int shift;                  /* Nodes per slab is (1 << shift) */
+    int mask;
+
+    int num_of_slab;            /* Currently allocated */
+    int max_num_of_slab;
+    ogs_pool_slab_entry_t *slab;
+
+    ogs_pool_slot_t *head, *tail;   /* Free list, first freed is first used */
+
+    bool hugepage;
+};
+
+ogs_pool_slab_t *ogs_pool_slab_create(
+        const char *name, size_t node_size, int size)
+{
+    ogs_pool_slab_t *slab = NULL;
+    size_t slab_size;
+    int num_of_node;
+
+    ogs_assert(sizeof(ogs_pool_slot_t) <= SLOT_HEADER_LEN);
+    ogs_assert(node_size > 0);
+    ogs_assert(size > 0);
+
+    slab = calloc(1, sizeof(*slab));
+    ogs_assert(slab);
+
+    slab->name = name;
+    slab->size = size;
+    slab->stride = (SLOT_HEADER_LEN + node_size + 15) & ~(size_t)15;
+    slab->hugepage = ogs_core()->pool.hugepage;
+
+    /* A power of two number of nodes per slab, at least one */
+    slab_size = slab->hugepage ? HUGEPAGE_SIZE : SLAB_SIZE;
+    num_of_node = 1;
+    while ((size_t)num_of_node * 2 * slab->stride <= slab_size &&
+            num_of_node < size)
+        num_of_node *= 2;
+    while ((1 << slab->shift) < num_of_node)
+        slab->shift++;
+    slab->mask = num_of_node - 1;
+
+    slab->max_num_of_slab = (size + num_of_node - 1) >> slab->shift;
+    slab->slab = calloc(slab->max_num_of_slab, sizeof(*slab->slab));
+    ogs_assert(slab->slab);
+
+    return slab;
+}
+
+void ogs_pool_slab_destroy(ogs_pool_slab_t *slab)
+{
+    int i;
+
+    ogs_assert(slab);
+
+    for (i = 0; i < slab->num_of_slab; i++) {
+#if HAVE_SYS_MMAN_H
+        if (slab->slab[i].mapped) {
+            munmap(slab->slab[i].base, slab->slab[i].len);
+            continue;
+        }
+#endif
+        free(slab->slab[i].base);
+    }
+
+    free(slab->slab);
+    free(slab);
+}
+
+static bool slab_grow(ogs_pool_slab_t *slab)
+{
+    ogs_pool_slab_entry_t *entry = NULL;
+    ogs_pool_slot_t *slot = NULL;
+    int i, first, num_of_node;
+
+    if (slab->num_of_slab == slab->max_num_of_slab)
+        return false;
+
+    entry = &slab->slab[slab->num_of_slab];
+    first = slab->num_of_slab << slab->shift;
+    num_of_node = ogs_min(slab->mask + 1, slab->size - first);
+    entry->len = num_of_node * slab->stride;
+
+#if HAVE_SYS_MMAN_H && defined(MAP_HUGETLB)
+    if (slab->hugepage) {
+        size_t len = (entry->len + HUGEPAGE_SIZE - 1) &
+            ~(size_t)(HUGEPAGE_SIZE - 1);
+        void *base = mmap(NULL, len, PROT_READ|PROT_WRITE,
+                MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+        if (base != MAP_FAILED) {
+            entry->base = base;
+            entry->len = len;
+            entry->mapped = true;
+        } else {
+            ogs_warn("No hugepage for '%s', use normal pages [%s]",
+                    slab->name, strerror(errno));
+            slab->hugepage = false;
+        }
+    }
+#endif
+
+    if (!entry->base) {
+        entry->base = malloc(entry->len);
+        if (!entry->base) {
+            ogs_error("Cannot grow '%s[%d]' beyond %d",
+                    slab->name, slab->size, first);
+            return false;
+        }
+        entry->mapped = false;
+    }
+
+    for (i = 0; i < num_of_node; i++) {
+        slot = (ogs_pool_slot_t *)(entry->base + i * slab->stride);
+        slot->next = NULL;
+        slot->index = first + i + 1;
+        slot->used = false;
+
+        if (slab->tail)
+            slab->tail->next = slot;
+        else
+            slab->head = slot;
+        slab->tail = slot;
+    }
+
+    slab->num_of_slab++;
+
+    return true;
+}
+
+void *ogs_pool_slab_alloc(ogs_pool_slab_t *slab)
+{
+    ogs_pool_slot_t *slot = NULL;
+
+    ogs_assert(slab);
+
+    if (!slab->head && !slab_grow(slab))
+        return NULL;
+
+    slot = slab->head;
+    slab->head = slot->next;
+    if (!slab->head)
+        slab->tail = NULL;
+
+    slot->next = NULL;
+    slot->used = true;
+
+    return SLOT_TO_NODE(slot);
+}
+
+bool ogs_pool_slab_free(ogs_pool_slab_t *slab, void *node)
+{
+    ogs_pool_slot_t *slot = NULL;
+
+    ogs_assert(slab);
+    ogs_assert(node);
+
+    slot = NODE_TO_SLOT(node);
+    if (!slot->used)
+        return false;
+
+    slot->used = false;
+    if (slab->tail)
+        slab->tail->next = slot;
+    else
+        slab->head = slot;
+    slab->tail = slot;
+
+    return true;
+}
+
+ogs_index_t ogs_pool_slab_index(ogs_pool_slab_t *slab, void *node)
+{
+    ogs_assert(slab);
+
+    if (!node)
+        return 0;
+
+    return NODE_TO_SLOT(node)->index;
+}
+
+void *ogs_pool_slab_find(ogs_pool_slab_t *slab, ogs_index_t index)
+{
+    ogs_pool_slot_t *slot = NULL;
+    int n;
+
+    ogs_assert(slab);
+
+    if (index == 0 || index > (ogs_index_t)slab->size)
+        return NULL;
+
+    n = (index - 1) >> slab->shift;
+    if (n >= slab->num_of_slab)
+        return NULL;
+
+    slot = (ogs_pool_slot_t *)(slab->slab[n].base +
+            ((index - 1) & slab->mask) * slab->stride);
+    if (!slot->used)
+        return NULL;
+
+    return SLOT_TO_NODE(slot);
+}
+
+size_t ogs_pool_slab_memory(ogs_pool_slab_t *slab)
+{
+    size_t memory = 0;
+    int i;
+
+    ogs_assert(slab);
+
+    for (i = 0; i < slab->num_of_slab; i++)
+        memory += slab->slab[i].len;
+
+    return memory;
+}
@@ -30,12 +30,38 @@ extern "C" {
 
 typedef unsigned int ogs_index_t;
 
+/*
+ * A pool set up with ogs_pool_init_growable() keeps its nodes in slabs
+ * which are allocated on demand up to the configured size, instead of
+ * the whole array at ogs_pool_init(). The same ogs_pool_xxx() macros work
+ * on both, and ogs_pool_index()/ogs_pool_find() stay O(1) : the index is
+ * kept in front of every node, and a node is found from its index through
+ * the slab table. The array, free and index members are not used.
+ *
+ * With `pool.hugepage` set, slabs are backed by 2MB hugepages when the
+ * system has them reserved.
+ */
+typedef struct ogs_pool_slab_s ogs_pool_slab_t;
+
+ogs_pool_slab_t *ogs_pool_slab_create(
+        const char *name, size_t node_size, int size);
+void ogs_pool_slab_destroy(ogs_pool_slab_t *slab);
+
+void *ogs_pool_slab_alloc(ogs_pool_slab_t *slab);
+bool ogs_pool_slab_free(ogs_pool_slab_t *slab, void *node);
+ogs_index_t ogs_pool_slab_index(ogs_pool_slab_t *slab, void *node);
+void *ogs_pool_slab_find(ogs_pool_slab_t *slab, ogs_index_t index);
+
+/* Bytes currently allocated for the nodes */
+size_t ogs_pool_slab_memory(ogs_pool_slab_t *slab);
+
 #define OGS_POOL(pool, type) \
     struct { \
         const char *name; \
         int head, tail; \
         int size, avail; \
         type **free, *array, **index; \
+        ogs_pool_slab_t *slab; \
     } pool
 
 #define ogs_pool_init(pool, _size) do { \
@@ -47,6 +73,7 @@ typedef unsigned int ogs_index_t;
     ogs_assert((pool)->array); \
     (pool)->index = malloc(sizeof(*(pool)->index) * _size); \
     ogs_assert((pool)->index); \
+    (pool)->slab = NULL; \
     (pool)->size = (pool)->avail = _size; \
     (pool)->head = (pool)->tail = 0; \
     for (i = 0; i < _size; i++) { \
@@ -55,38 +82,61 @@ typedef unsigned int ogs_index_t;
     } \
 } while (0)
 
+#define ogs_pool_init_growable(pool, _size) do { \
+    (pool)->name = #pool; \
+    (pool)->free = NULL; \
+    (pool)->array = NULL; \
+    (pool)->index = NULL; \
+    (pool)->slab = ogs_pool_slab_create( \
+            #pool, sizeof(*(pool)->array), _size); \
+    (pool)->size = (pool)->avail = _size; \
+    (pool)->head = (pool)->tail = 0; \
+} while (0)
+
 #define ogs_pool_final(pool) do { \
     if (((pool)->size != (pool)->avail)) \
         ogs_error("%d in '%s[%d]' were not released.", \
                 (pool)->size - (pool)->avail, (pool)->name, (pool)->size); \
+    if ((pool)->slab) \
+        ogs_pool_slab_destroy((pool)->slab); \
     free((pool)->free); \
     free((pool)->array); \
     free((pool)->index); \
 } while (0)
 
-#define ogs_pool_index(pool, node) (((node) - (pool)->array)+1)
+#define ogs_pool_index(pool, node) \
+    ((pool)->slab ? ogs_pool_slab_index((pool)->slab, (node)) : \
+        (((node) - (pool)->array)+1))
 #define ogs_pool_find(pool, _index) \
-    (_index > 0 && _index <= (pool)->size) ? (pool)->index[_index-1] : NULL
+    ((pool)->slab ? ogs_pool_slab_find((pool)->slab, (_index)) : \
+    (_index > 0 && _index <= (pool)->size) ? (pool)->index[_index-1] : NULL)
 #define ogs_pool_cycle(pool, node) \
     ogs_pool_find((pool), ogs_pool_index((pool), (node)))
 
 #define ogs_pool_alloc(pool, node) do { \
     *(node) = NULL; \
-    if ((pool)->avail > 0) { \
+    if ((pool)->slab) { \
+        *(node) = ogs_pool_slab_alloc((pool)->slab); \
+        if (*(node)) \
+            (pool)->avail--; \
+    } else if ((pool)->avail > 0) { \
         (pool)->avail--; \
         *(node) = (void*)(pool)->free[(pool)->head]; \
         (pool)->free[(pool)->head] = NULL; \
         (pool)->head = ((pool)->head + 1) % ((pool)->size); \
-        (pool)->index[ogs_pool_index(pool, *(node))-1] = *(node); \
+        (pool)->index[*(node) - (pool)->array] = *(node); \
     } \
 } while (0)
 
 #define ogs_pool_free(pool, node) do { \
-    if ((pool)->avail < (pool)->size) { \
+    if ((pool)->slab) { \
+        if (ogs_pool_slab_free((pool)->slab, (node))) \
+            (pool)->avail++; \
+    } else if ((pool)->avail < (pool)->size) { \
         (pool)->avail++; \
         (pool)->free[(pool)->tail] = (void*)(node); \
         (pool)->tail = ((pool)->tail + 1) % ((pool)->size); \
-        (pool)->index[ogs_pool_index(pool, node)-1] = NULL; \
+        (pool)->index[(node) - (pool)->array] = NULL; \
     } \
 } while (0)
 
@@ -102,6 +152,7 @@ typedef unsigned int ogs_index_t;
     ogs_assert((pool)->array); \
     (pool)->index = ogs_malloc(sizeof(*(pool)->index) * _size); \
     ogs_assert((pool)->index); \
+    (pool)->slab = NULL; \
     (pool)->size = (pool)->avail = _size; \
     (pool)->head = (pool)->tail = 0; \
     for (i = 0; i < _size; i++) { \
@@ -183,6 +183,39 @@ int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout)
     return queue_push(queue, data, timeout);
 }
 
+/**
+ * Push up to n elements under a single lock, waking the consumers once.
+ * It never blocks. Returns the number of elements pushed, in order; the
+ * caller still owns the rest (none at all if the queue is terminated).
+ */
+unsigned int ogs_queue_trypush_bulk(
+        ogs_queue_t *queue, void **data, unsigned int n)
+{
+    unsigned int i;
+
+    if (queue->terminated) {
+        return 0;
+    }
+
+    ogs_thread_mutex_lock(&queue->one_big_mutex);
+
+    for (i = 0; i < n && !ogs_queue_full(queue); i++) {
+        queue->data[queue->in] = data[i];
+        queue->in++;
+        if (queue->in >= queue->bounds)
+            queue->in -= queue->bounds;
+        queue->nelts++;
+    }
+
+    if (i && queue->empty_waiters) {
+        ogs_trace("broadcast !empty");
+        ogs_thread_cond_broadcast(&queue->not_empty);
+    }
+
+    ogs_thread_mutex_unlock(&queue->one_big_mutex);
+    return i;
+}
+
 /**
  * not thread safe
  */
@@ -55,6 +55,8 @@ int ogs_queue_trypush(ogs_queue_t *queue, void *data);
 int ogs_queue_trypop(ogs_queue_t *queue, void **data);
 
 int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout);
+unsigned int ogs_queue_trypush_bulk(
+        ogs_queue_t *queue, void **data, unsigned int n);
 int ogs_queue_timedpop(ogs_queue_t *queue, void **data, ogs_time_t timeout);
 
 unsigned int ogs_queue_size(ogs_queue_t *queue);
@@ -174,6 +174,7 @@ static int select_process(ogs_pollset_t *pollset, ogs_time_t timeout)
 
     rc = select(context->max_fd + 1,
             &context->work_read_fd_set, &context->work_write_fd_set, NULL, tp);
+    ogs_update_loop_time();
     if (rc < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "select() failed");
         return OGS_ERROR;
@@ -44,6 +44,7 @@ typedef struct ogs_sockopt_s {
 
     bool sctp_nodelay;
     bool tcp_nodelay;
+    bool so_reuseport;
 
     struct {
         bool l_onoff;
@@ -58,6 +59,7 @@ void ogs_sockopt_init(ogs_sockopt_t *option);
 int ogs_nonblocking(ogs_socket_t fd);
 int ogs_closeonexec(ogs_socket_t fd);
 int ogs_listen_reusable(ogs_socket_t fd, int on);
+int ogs_listen_reuseport(ogs_socket_t fd, int on);
 int ogs_tcp_nodelay(ogs_socket_t fd, int on);
 int ogs_so_linger(ogs_socket_t fd, int l_linger);
 int ogs_bind_to_device(ogs_socket_t fd, const char *device);
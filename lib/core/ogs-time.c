@@ -272,6 +272,32 @@ ogs_time_t ogs_get_monotonic_time(void)
 #endif
 }
 
+static __thread ogs_time_t loop_time_now;
+static __thread ogs_time_t loop_monotonic_time;
+
+void ogs_update_loop_time(void)
+{
+    loop_time_now = ogs_time_now();
+    loop_monotonic_time = ogs_get_monotonic_time();
+}
+
+void ogs_reset_loop_time(void)
+{
+    loop_time_now = 0;
+    loop_monotonic_time = 0;
+}
+
+ogs_time_t ogs_loop_time_now(void)
+{
+    return loop_time_now ? loop_time_now : ogs_time_now();
+}
+
+ogs_time_t ogs_loop_monotonic_time(void)
+{
+    return loop_monotonic_time ?
+        loop_monotonic_time : ogs_get_monotonic_time();
+}
+
 void ogs_localtime(time_t s, struct tm *tm)
 {
     ogs_assert(tm);
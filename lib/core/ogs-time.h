@@ -109,6 +109,18 @@ ogs_time_t ogs_get_monotonic_time(void);
 /** @return the GMT offset in seconds */
 int ogs_timezone(void);
 
+/*
+ * Loop time : ogs_time_now() and ogs_get_monotonic_time() as sampled when
+ * the current thread's ogs_pollset_poll() last woke up. It only moves once
+ * per loop iteration, so use it where that granularity is good enough
+ * (timers, retransmission, usage accounting) and the real clock elsewhere.
+ * Before the thread has polled, the real clock is returned.
+ */
+void ogs_update_loop_time(void);
+void ogs_reset_loop_time(void);
+ogs_time_t ogs_loop_time_now(void);
+ogs_time_t ogs_loop_monotonic_time(void);
+
 void ogs_localtime(time_t s, struct tm *tm);
 void ogs_gmtime(time_t s, struct tm *tm);
 
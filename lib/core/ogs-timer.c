@@ -35,7 +35,7 @@ static void add_timer_node(
     ogs_assert(tree);
     ogs_assert(timer);
 
-    timer->timeout = ogs_get_monotonic_time() + duration;
+    timer->timeout = ogs_loop_monotonic_time() + duration;
 
     new = &tree->root;
     while (*new) {
@@ -160,7 +160,7 @@ void ogs_timer_mgr_expire(ogs_timer_mgr_t *manager)
     ogs_timer_t *this;
     ogs_assert(manager);
 
-    current = ogs_get_monotonic_time();
+    current = ogs_loop_monotonic_time();
 
     ogs_rbtree_for_each(&manager->tree, rbnode) {
         this = ogs_rb_entry(rbnode, ogs_timer_t, rbnode);
@@ -398,11 +398,11 @@ static ogs_tlv_desc_t* tlv_find_desc_by_type_inst(uint8_t *desc_index,
     return desc;
 }
 
-static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
+static int tlv_parse_value(void *msg, ogs_tlv_desc_t *desc,
+        uint32_t length, void *value)
 {
     ogs_assert(msg);
     ogs_assert(desc);
-    ogs_assert(tlv);
 
     switch (desc->ctype) {
     case OGS_TV_UINT8:
@@ -412,12 +412,12 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint8_t *v = (ogs_tlv_uint8_t *)msg;
 
-        if (tlv->length != 1)
+        if (length != 1)
         {
-            ogs_error("Invalid TLV length %d. It should be 1", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 1", length);
             return OGS_ERROR;
         }
-        v->u8 = *(uint8_t*)(tlv->value);
+        v->u8 = *(uint8_t*)(value);
         break;
     }
     case OGS_TV_UINT16:
@@ -427,13 +427,13 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint16_t *v = (ogs_tlv_uint16_t *)msg;
 
-        if (tlv->length != 2)
+        if (length != 2)
         {
-            ogs_error("Invalid TLV length %d. It should be 2", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 2", length);
             return OGS_ERROR;
         }
-        v->u16 = ((((uint8_t*)tlv->value)[0]<< 8)&0xff00) |
-               ((((uint8_t*)tlv->value)[1]    )&0x00ff);
+        v->u16 = ((((uint8_t*)value)[0]<< 8)&0xff00) |
+               ((((uint8_t*)value)[1]    )&0x00ff);
         break;
     }
     case OGS_TV_UINT24:
@@ -443,14 +443,14 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint24_t *v = (ogs_tlv_uint24_t *)msg;
 
-        if (tlv->length != 3)
+        if (length != 3)
         {
-            ogs_error("Invalid TLV length %d. It should be 3", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 3", length);
             return OGS_ERROR;
         }
-        v->u24 = ((((uint8_t*)tlv->value)[0]<<16)&0x00ff0000) |
-               ((((uint8_t*)tlv->value)[1]<< 8)&0x0000ff00) |
-               ((((uint8_t*)tlv->value)[2]    )&0x000000ff);
+        v->u24 = ((((uint8_t*)value)[0]<<16)&0x00ff0000) |
+               ((((uint8_t*)value)[1]<< 8)&0x0000ff00) |
+               ((((uint8_t*)value)[2]    )&0x000000ff);
         break;
     }
     case OGS_TV_UINT32:
@@ -460,15 +460,15 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint32_t *v = (ogs_tlv_uint32_t *)msg;
 
-        if (tlv->length != 4)
+        if (length != 4)
         {
-            ogs_error("Invalid TLV length %d. It should be 4", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 4", length);
             return OGS_ERROR;
         }
-        v->u32 = ((((uint8_t*)tlv->value)[0]<<24)&0xff000000) |
-               ((((uint8_t*)tlv->value)[1]<<16)&0x00ff0000) |
-               ((((uint8_t*)tlv->value)[2]<< 8)&0x0000ff00) |
-               ((((uint8_t*)tlv->value)[3]    )&0x000000ff);
+        v->u32 = ((((uint8_t*)value)[0]<<24)&0xff000000) |
+               ((((uint8_t*)value)[1]<<16)&0x00ff0000) |
+               ((((uint8_t*)value)[2]<< 8)&0x0000ff00) |
+               ((((uint8_t*)value)[3]    )&0x000000ff);
         break;
     }
     case OGS_TV_FIXED_STR:
@@ -476,30 +476,30 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        if (tlv->length != desc->length)
+        if (length != desc->length)
         {
             ogs_error("Invalid TLV length %d. It should be %d",
-                    tlv->length, desc->length);
+                    length, desc->length);
             return OGS_ERROR;
         }
 
-        v->data = tlv->value;
-        v->len = tlv->length;
+        v->data = value;
+        v->len = length;
         break;
     }
     case OGS_TLV_VAR_STR:
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        v->data = tlv->value;
-        v->len = tlv->length;
+        v->data = value;
+        v->len = length;
         break;
     }
     case OGS_TV_NULL:
     case OGS_TLV_NULL:
     {
-        if (tlv->length != 0) {
-            ogs_error("Invalid TLV length %d. It should be 0", tlv->length);
+        if (length != 0) {
+            ogs_error("Invalid TLV length %d. It should be 0", length);
             return OGS_ERROR;
         }
         break;
@@ -512,6 +512,13 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     return OGS_OK;
 }
 
+static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
+{
+    ogs_assert(tlv);
+
+    return tlv_parse_value(msg, desc, tlv->length, tlv->value);
+}
+
 /* rbtree structure used to keep track count of TLVs with given <type,instance>
  * while parsing. This is used to link it to the matching nth field in a
  * ogs_tlv_desc_t struct */
@@ -683,6 +690,122 @@ int ogs_tlv_parse_msg(void *msg, ogs_tlv_desc_t *desc, ogs_pkbuf_t *pkbuf,
     return rv;
 }
 
+void ogs_tlv_cursor_init(ogs_tlv_cursor_t *cursor,
+        void *data, uint32_t length, int mode)
+{
+    ogs_assert(cursor);
+    ogs_assert(data || length == 0);
+
+    cursor->pos = data;
+    cursor->end = cursor->pos + length;
+    cursor->mode = mode;
+}
+
+int ogs_tlv_cursor_next(ogs_tlv_cursor_t *cursor, ogs_tlv_element_t *e)
+{
+    uint8_t *pos = NULL;
+    uint32_t left, hlen = 0;
+
+    ogs_assert(cursor);
+    ogs_assert(e);
+
+    pos = cursor->pos;
+    left = cursor->end - pos;
+    if (left == 0)
+        return OGS_DONE;
+
+    switch (cursor->mode) {
+    case OGS_TLV_MODE_T1_L1:
+        hlen = 2;
+        break;
+    case OGS_TLV_MODE_T1_L2:
+        hlen = 3;
+        break;
+    case OGS_TLV_MODE_T1_L2_I1:
+    case OGS_TLV_MODE_T2_L2:
+        hlen = 4;
+        break;
+    default:
+        ogs_assert_if_reached();
+        break;
+    }
+
+    if (left < hlen) {
+        ogs_error("Truncated TLV header [%d < %d]", left, hlen);
+        return OGS_ERROR;
+    }
+
+    e->instance = 0;
+
+    switch (cursor->mode) {
+    case OGS_TLV_MODE_T1_L1:
+        e->type = pos[0];
+        e->length = pos[1];
+        break;
+    case OGS_TLV_MODE_T1_L2:
+        e->type = pos[0];
+        e->length = (pos[1] << 8) | pos[2];
+        break;
+    case OGS_TLV_MODE_T1_L2_I1:
+        e->type = pos[0];
+        e->length = (pos[1] << 8) | pos[2];
+        e->instance = pos[3] & 0x0f;
+        break;
+    case OGS_TLV_MODE_T2_L2:
+        e->type = (pos[0] << 8) | pos[1];
+        e->length = (pos[2] << 8) | pos[3];
+        break;
+    default:
+        ogs_assert_if_reached();
+        break;
+    }
+
+    if (e->length > left - hlen) {
+        ogs_error("Truncated TLV type [%d] [%d > %d]",
+                e->type, e->length, left - hlen);
+        return OGS_ERROR;
+    }
+
+    e->value = pos + hlen;
+    cursor->pos = e->value + e->length;
+
+    return OGS_OK;
+}
+
+int ogs_tlv_parse_element(
+        void *msg, ogs_tlv_desc_t *desc, ogs_tlv_element_t *e)
+{
+    int rv;
+
+    ogs_assert(e);
+
+    rv = tlv_parse_value(msg, desc, e->length, e->value);
+    if (rv != OGS_OK) {
+        ogs_error("Can't parse leaf TLV [%s]", desc->name);
+        return rv;
+    }
+
+    *(ogs_tlv_presence_t *)msg = 1;
+
+    return OGS_OK;
+}
+
+void *ogs_tlv_more_slot(void *array, uint16_t vsize, int count)
+{
+    uint8_t *p = array;
+    int i;
+
+    ogs_assert(array);
+
+    for (i = 0; i < count; i++, p += vsize) {
+        if (*(ogs_tlv_presence_t *)p == 0)
+            return p;
+    }
+
+    ogs_error("Multiple of the same type TLV need more room [%d]", count);
+    return NULL;
+}
+
 static uint16_t parse_get_element_type(uint8_t *pos, uint8_t mode)
 {
     uint16_t type;
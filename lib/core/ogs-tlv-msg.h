@@ -182,6 +182,40 @@ int ogs_tlv_parse_msg(
 int ogs_tlv_parse_msg_desc(
         void *msg, ogs_tlv_desc_t *desc, ogs_pkbuf_t *pkbuf, int msg_mode);
 
+/*
+ * Single-pass decoding used by the generated message parsers.
+ *
+ * The cursor walks the IEs of one message or grouped IE in place,
+ * no ogs_tlv_t list is built. The generated code switches on
+ * the type (and instance) of each element.
+ */
+#define OGS_TLV_KEY(__tYPE, __iNSTANCE) (((__tYPE) << 8) | (__iNSTANCE))
+
+typedef struct ogs_tlv_cursor_s {
+    uint8_t *pos;
+    uint8_t *end;
+    int mode;
+} ogs_tlv_cursor_t;
+
+typedef struct ogs_tlv_element_s {
+    uint16_t type;
+    uint8_t instance;
+    uint32_t length;
+    uint8_t *value;
+} ogs_tlv_element_t;
+
+void ogs_tlv_cursor_init(ogs_tlv_cursor_t *cursor,
+        void *data, uint32_t length, int mode);
+/* Returns OGS_OK with the next element, OGS_DONE at the end and
+ * OGS_ERROR if the element runs past the end of the block */
+int ogs_tlv_cursor_next(ogs_tlv_cursor_t *cursor, ogs_tlv_element_t *e);
+
+/* Parses a leaf IE into msg and sets its presence */
+int ogs_tlv_parse_element(
+        void *msg, ogs_tlv_desc_t *desc, ogs_tlv_element_t *e);
+/* Returns the first entry of an IE array which is not present yet */
+void *ogs_tlv_more_slot(void *array, uint16_t vsize, int count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_BACKEND_H
+#define OGS_DBI_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Storage of the subscriber documents behind ogs_dbi_*().
+ *
+ * ogs_dbi_init() selects the backend from the scheme of db_uri.
+ * - mongodb://...     : MongoDB (ogs-mongoc.c)
+ * - file:///path/name : Embedded memory-mapped store (store.c)
+ *
+ * Documents use the MongoDB 'subscribers' schema in both backends.
+ * find() and find_msisdn() return a copy that the caller must release
+ * with bson_destroy().
+ *
+ * find_record() is optional. It copies the pre-decoded subscription
+ * record, unbound. Without it, the record is decoded from find().
+ */
+typedef struct ogs_dbi_backend_s {
+    const char *name;
+
+    bson_t *(*find)(char *supi);
+    bson_t *(*find_msisdn)(char *imsi_or_msisdn_bcd);
+
+    int (*update_sqn)(char *supi, uint64_t sqn);
+    int (*increment_sqn)(char *supi);
+    int (*update_imeisv)(char *supi, char *imeisv);
+
+    int (*find_record)(char *supi, ogs_dbi_record_t *record);
+} ogs_dbi_backend_t;
+
+extern const ogs_dbi_backend_t ogs_dbi_mongoc_backend;
+extern const ogs_dbi_backend_t ogs_dbi_store_backend;
+
+const ogs_dbi_backend_t *ogs_dbi_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_BACKEND_H */
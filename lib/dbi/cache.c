@@ -0,0 +1,683 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+typedef struct ogs_dbi_cache_entry_s {
+    ogs_lnode_t lnode;          /* LRU order : head is the oldest */
+
+    char *supi;
+    bson_t *document;
+    ogs_dbi_record_t *record;   /* Built on the first record lookup */
+    ogs_time_t expires;
+} ogs_dbi_cache_entry_t;
+
+static struct {
+    bool enabled;
+    ogs_time_t ttl;
+
+    ogs_thread_mutex_t mutex;
+
+    OGS_POOL(pool, ogs_dbi_cache_entry_t);
+    ogs_list_t lru_list;
+    ogs_hash_t *supi_hash;
+
+    ogs_dbi_cache_stats_t stats;
+
+    struct {
+        ogs_thread_t *thread;
+        mongoc_client_t *client;
+        bool running;
+        bool healthy;           /* The change stream is open */
+    } watch;
+} self;
+
+static void entry_remove(ogs_dbi_cache_entry_t *entry);
+static void entry_remove_all(void);
+static int entry_count(void);
+static bool entry_is_trusted(void);
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+static void watch_main(void *data);
+#endif
+
+int ogs_dbi_cache_init(int max, ogs_time_t ttl, bool watch)
+{
+    memset(&self, 0, sizeof(self));
+
+    if (max <= 0)
+        return OGS_OK;
+
+    ogs_thread_mutex_init(&self.mutex);
+
+    ogs_pool_init(&self.pool, max);
+    ogs_list_init(&self.lru_list);
+    self.supi_hash = ogs_hash_make();
+    ogs_assert(self.supi_hash);
+
+    self.ttl = ttl;
+    self.stats.max = max;
+    self.enabled = true;
+
+    /* Only MongoDB can be changed behind our back */
+    if (ogs_dbi_backend() != &ogs_dbi_mongoc_backend)
+        watch = false;
+
+    if (watch) {
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+        /* mongoc_client_t is not thread-safe. The watcher needs its own */
+        ogs_assert(ogs_mongoc()->client);
+        self.watch.client = mongoc_client_new_from_uri(
+                mongoc_client_get_uri(ogs_mongoc()->client));
+        ogs_assert(self.watch.client);
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 4
+        mongoc_client_set_error_api(self.watch.client, 2);
+#endif
+
+        self.watch.running = true;
+        self.watch.thread = ogs_thread_create(watch_main, NULL);
+        ogs_assert(self.watch.thread);
+#else
+        if (!ttl) {
+            ogs_error("Subscriber cache with `ttl: 0` needs "
+                    "MongoDB change streams");
+            ogs_error("Not supported by this mongo-c-driver");
+            ogs_dbi_cache_final();
+            return OGS_ERROR;
+        }
+        ogs_warn("MongoDB change streams are not supported "
+                "by this mongo-c-driver");
+#endif
+    }
+
+    ogs_info("Subscriber cache [max:%d, ttl:%lld sec, watch:%s]",
+            max, (long long)ogs_time_sec(ttl), watch ? "on" : "off");
+
+    return OGS_OK;
+}
+
+void ogs_dbi_cache_final(void)
+{
+    if (!self.enabled)
+        return;
+
+    if (self.watch.thread) {
+        ogs_thread_mutex_lock(&self.mutex);
+        self.watch.running = false;
+        ogs_thread_mutex_unlock(&self.mutex);
+
+        ogs_thread_destroy(self.watch.thread);
+        self.watch.thread = NULL;
+    }
+    if (self.watch.client) {
+        mongoc_client_destroy(self.watch.client);
+        self.watch.client = NULL;
+    }
+
+    ogs_info("Subscriber cache [hit:%llu, miss:%llu, eviction:%llu]",
+            (unsigned long long)self.stats.hit,
+            (unsigned long long)self.stats.miss,
+            (unsigned long long)self.stats.eviction);
+
+    entry_remove_all();
+
+    ogs_hash_destroy(self.supi_hash);
+    ogs_pool_final(&self.pool);
+
+    ogs_thread_mutex_destroy(&self.mutex);
+
+    self.enabled = false;
+}
+
+bson_t *ogs_dbi_cache_lookup(char *supi)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+    bson_t *document = NULL;
+
+    ogs_assert(supi);
+
+    if (!self.enabled)
+        return ogs_dbi_backend()->find(supi);
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    if (!entry_is_trusted()) {
+        ogs_thread_mutex_unlock(&self.mutex);
+        return ogs_dbi_backend()->find(supi);
+    }
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry && self.ttl && ogs_get_monotonic_time() > entry->expires) {
+        entry_remove(entry);
+        entry = NULL;
+
+        self.stats.expiration++;
+    }
+
+    if (entry) {
+        /* Move to the tail, the most recently used */
+        ogs_list_remove(&self.lru_list, entry);
+        ogs_list_add(&self.lru_list, entry);
+
+        document = bson_copy(entry->document);
+        ogs_assert(document);
+
+        self.stats.hit++;
+
+        ogs_thread_mutex_unlock(&self.mutex);
+
+        return document;
+    }
+
+    self.stats.miss++;
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    document = ogs_dbi_backend()->find(supi);
+    if (!document)
+        return NULL;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    if (!entry_is_trusted()) {
+        /* The change stream went down in the meantime */
+        ogs_thread_mutex_unlock(&self.mutex);
+        return document;
+    }
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry) {
+        /* Populated by another thread in the meantime */
+        bson_destroy(entry->document);
+        if (entry->record) {
+            ogs_free(entry->record);
+            entry->record = NULL;
+        }
+    } else {
+        ogs_pool_alloc(&self.pool, &entry);
+        if (!entry) {
+            /* Full : evict the least recently used */
+            entry_remove(ogs_list_first(&self.lru_list));
+            self.stats.eviction++;
+
+            ogs_pool_alloc(&self.pool, &entry);
+            ogs_assert(entry);
+        }
+        memset(entry, 0, sizeof(*entry));
+
+        entry->supi = ogs_strdup(supi);
+        ogs_assert(entry->supi);
+
+        ogs_hash_set(self.supi_hash, entry->supi, OGS_HASH_KEY_STRING, entry);
+        ogs_list_add(&self.lru_list, entry);
+    }
+
+    entry->document = bson_copy(document);
+    ogs_assert(entry->document);
+    entry->expires = ogs_get_monotonic_time() + self.ttl;
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return document;
+}
+
+int ogs_dbi_cache_lookup_record(char *supi, ogs_dbi_record_t *record)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+    bson_t *document = NULL;
+    int rv;
+
+    ogs_assert(supi);
+    ogs_assert(record);
+
+    if (self.enabled) {
+        ogs_thread_mutex_lock(&self.mutex);
+
+        entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+        if (entry && entry->record && entry_is_trusted() &&
+            (!self.ttl || ogs_get_monotonic_time() <= entry->expires)) {
+            ogs_list_remove(&self.lru_list, entry);
+            ogs_list_add(&self.lru_list, entry);
+
+            ogs_dbi_record_copy(record, entry->record);
+
+            self.stats.hit++;
+
+            ogs_thread_mutex_unlock(&self.mutex);
+
+            ogs_dbi_record_bind(record);
+
+            return OGS_OK;
+        }
+
+        ogs_thread_mutex_unlock(&self.mutex);
+    }
+
+    /* Expired entries are reloaded by ogs_dbi_cache_lookup() */
+    document = ogs_dbi_cache_lookup(supi);
+    if (!document) {
+        ogs_error("[%s] Cannot find IMSI in DB", supi);
+        return OGS_ERROR;
+    }
+
+    rv = ogs_dbi_record_build(record, bson_get_data(document), document->len);
+    if (rv != OGS_OK) {
+        ogs_error("[%s] Invalid subscriber document", supi);
+        bson_destroy(document);
+        return rv;
+    }
+
+    if (self.enabled) {
+        ogs_thread_mutex_lock(&self.mutex);
+
+        /* Skip if the document was changed in the meantime */
+        entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+        if (entry && !entry->record &&
+            bson_equal(entry->document, document)) {
+            entry->record = ogs_memdup(record, record->length);
+            ogs_assert(entry->record);
+        }
+
+        ogs_thread_mutex_unlock(&self.mutex);
+    }
+
+    bson_destroy(document);
+
+    ogs_dbi_record_bind(record);
+
+    return OGS_OK;
+}
+
+void ogs_dbi_cache_remove(char *supi)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+
+    if (!self.enabled)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry) {
+        entry_remove(entry);
+        self.stats.invalidation++;
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+void ogs_dbi_cache_update(char *supi, const bson_t *document)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(document);
+
+    if (!self.enabled)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry) {
+        bson_destroy(entry->document);
+        entry->document = bson_copy(document);
+        ogs_assert(entry->document);
+        entry->expires = ogs_get_monotonic_time() + self.ttl;
+
+        /* Built again from the new document on the next record lookup */
+        if (entry->record) {
+            ogs_free(entry->record);
+            entry->record = NULL;
+        }
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+void ogs_dbi_cache_remove_all(void)
+{
+    if (!self.enabled)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    self.stats.invalidation += entry_count();
+    entry_remove_all();
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+/*
+ * Rebuild the document with a new 'security.sqn'.
+ * If `increment` is set, the SQN is advanced the same way
+ * as ogs_dbi_increment_sqn() does in the DB.
+ */
+static bson_t *document_with_sqn(
+        const bson_t *document, bool increment, uint64_t sqn)
+{
+    bson_t *patched = NULL;
+    bson_t security;
+    bson_iter_t iter, child_iter;
+
+    ogs_assert(document);
+
+    if (!bson_iter_init(&iter, document)) {
+        ogs_error("bson_iter_init failed in this document");
+        return NULL;
+    }
+
+    patched = bson_new();
+    ogs_assert(patched);
+
+    while (bson_iter_next(&iter)) {
+        const char *key = bson_iter_key(&iter);
+        if (!strcmp(key, "security") && BSON_ITER_HOLDS_DOCUMENT(&iter)) {
+            uint64_t current = 0;
+
+            bson_append_document_begin(patched, key, -1, &security);
+            bson_iter_recurse(&iter, &child_iter);
+            while (bson_iter_next(&child_iter)) {
+                const char *child_key = bson_iter_key(&child_iter);
+                if (!strcmp(child_key, "sqn") &&
+                    BSON_ITER_HOLDS_INT64(&child_iter)) {
+                    current = bson_iter_int64(&child_iter);
+                } else {
+                    bson_append_iter(&security, NULL, 0, &child_iter);
+                }
+            }
+
+            if (increment)
+                sqn = (current + 32) & OGS_MAX_SQN;
+            BSON_APPEND_INT64(&security, "sqn", sqn);
+
+            bson_append_document_end(patched, &security);
+        } else {
+            bson_append_iter(patched, NULL, 0, &iter);
+        }
+    }
+
+    return patched;
+}
+
+static void cache_patch_sqn(char *supi, bool increment, uint64_t sqn)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+    bson_t *patched = NULL;
+
+    ogs_assert(supi);
+
+    if (!self.enabled)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry) {
+        patched = document_with_sqn(entry->document, increment, sqn);
+        if (patched) {
+            /* The record has no 'security' and stays as it is */
+            bson_destroy(entry->document);
+            entry->document = patched;
+        } else {
+            entry_remove(entry);
+            self.stats.invalidation++;
+        }
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+void ogs_dbi_cache_update_sqn(char *supi, uint64_t sqn)
+{
+    cache_patch_sqn(supi, false, sqn);
+}
+
+void ogs_dbi_cache_increment_sqn(char *supi)
+{
+    cache_patch_sqn(supi, true, 0);
+}
+
+void ogs_dbi_cache_stats(ogs_dbi_cache_stats_t *stats)
+{
+    ogs_assert(stats);
+
+    memset(stats, 0, sizeof(*stats));
+
+    if (!self.enabled)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    memcpy(stats, &self.stats, sizeof(*stats));
+    stats->size = entry_count();
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+static void entry_remove(ogs_dbi_cache_entry_t *entry)
+{
+    ogs_assert(entry);
+
+    ogs_list_remove(&self.lru_list, entry);
+    ogs_hash_set(self.supi_hash, entry->supi, OGS_HASH_KEY_STRING, NULL);
+
+    ogs_free(entry->supi);
+    bson_destroy(entry->document);
+    if (entry->record)
+        ogs_free(entry->record);
+
+    ogs_pool_free(&self.pool, entry);
+}
+
+static void entry_remove_all(void)
+{
+    ogs_dbi_cache_entry_t *entry = NULL, *next_entry = NULL;
+
+    ogs_list_for_each_safe(&self.lru_list, next_entry, entry)
+        entry_remove(entry);
+}
+
+static int entry_count(void)
+{
+    return ogs_pool_size(&self.pool) - ogs_pool_avail(&self.pool);
+}
+
+/*
+ * With `ttl: 0` only the change stream bounds the staleness.
+ * Do not use the cache while it is down. Called with the mutex held.
+ */
+static bool entry_is_trusted(void)
+{
+    return self.ttl || !self.watch.client || self.watch.healthy;
+}
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+static void watch_handle_change(const bson_t *change)
+{
+    bson_iter_t iter, child_iter;
+    const char *operation = NULL;
+    const char *imsi = NULL;
+    uint32_t length = 0;
+    bson_t full_document;
+    bool has_full_document = false;
+
+    char *supi = NULL;
+
+    ogs_assert(change);
+
+    if (bson_iter_init_find(&iter, change, "operationType") &&
+        BSON_ITER_HOLDS_UTF8(&iter))
+        operation = bson_iter_utf8(&iter, &length);
+
+    if (bson_iter_init_find(&iter, change, "fullDocument") &&
+        BSON_ITER_HOLDS_DOCUMENT(&iter)) {
+        const uint8_t *data = NULL;
+
+        bson_iter_document(&iter, &length, &data);
+        if (bson_init_static(&full_document, data, length)) {
+            has_full_document = true;
+
+            if (bson_iter_init(&child_iter, &full_document)) {
+                while (bson_iter_next(&child_iter)) {
+                    if (!strcmp(bson_iter_key(&child_iter), "imsi") &&
+                        BSON_ITER_HOLDS_UTF8(&child_iter)) {
+                        imsi = bson_iter_utf8(&child_iter, &length);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    ogs_debug("Change stream [%s:%s]",
+            operation ? operation : "Unknown", imsi ? imsi : "Unknown");
+
+    if (!has_full_document || !imsi) {
+        /*
+         * A delete (or drop/invalidate) event only carries the ObjectID,
+         * which is not our key. Start over.
+         */
+        ogs_dbi_cache_remove_all();
+        return;
+    }
+
+    /* 'updateLookup' gives us the current document. Refresh in place */
+    supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi);
+    ogs_assert(supi);
+    ogs_dbi_cache_update(supi, &full_document);
+    ogs_free(supi);
+}
+
+static bool watch_is_running(void)
+{
+    bool running;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    running = self.watch.running;
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return running;
+}
+
+static void watch_set_healthy(bool healthy)
+{
+    ogs_thread_mutex_lock(&self.mutex);
+
+    self.watch.healthy = healthy;
+
+    /* Changes may have been missed while the stream was down */
+    self.stats.invalidation += entry_count();
+    entry_remove_all();
+
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+/* Sleep in short steps so that ogs_dbi_cache_final() is not delayed */
+static void watch_backoff(ogs_time_t timeout)
+{
+    ogs_time_t slept = 0;
+
+    while (slept < timeout && watch_is_running()) {
+        ogs_msleep(100);
+        slept += ogs_time_from_msec(100);
+    }
+}
+
+#define WATCH_BACKOFF_MIN ogs_time_from_sec(1)
+#define WATCH_BACKOFF_MAX ogs_time_from_sec(60)
+
+static void watch_main(void *data)
+{
+    mongoc_collection_t *collection = NULL;
+    mongoc_change_stream_t *stream = NULL;
+    bson_t *pipeline = NULL;
+    bson_t *opts = NULL;
+    const bson_t *change = NULL;
+    const bson_t *reply = NULL;
+    bson_error_t error;
+
+    ogs_time_t backoff = WATCH_BACKOFF_MIN;
+    bool healthy = true;
+
+    ogs_assert(self.watch.client);
+
+    collection = mongoc_client_get_collection(
+            self.watch.client, ogs_mongoc()->name, "subscribers");
+    ogs_assert(collection);
+
+    pipeline = bson_new();
+    ogs_assert(pipeline);
+    opts = BCON_NEW(
+            "fullDocument", BCON_UTF8("updateLookup"),
+            "maxAwaitTimeMS", BCON_INT64(1000));
+    ogs_assert(opts);
+
+    while (watch_is_running()) {
+        stream = mongoc_collection_watch(collection, pipeline, opts);
+        ogs_assert(stream);
+
+        if (!mongoc_change_stream_error_document(stream, &error, &reply)) {
+            if (!healthy)
+                ogs_info("Change stream resumed");
+            healthy = true;
+            watch_set_healthy(true);
+            backoff = WATCH_BACKOFF_MIN;
+
+            while (watch_is_running()) {
+                if (mongoc_change_stream_next(stream, &change)) {
+                    watch_handle_change(change);
+                    continue;
+                }
+
+                if (mongoc_change_stream_error_document(
+                            stream, &error, &reply))
+                    break;
+            }
+        }
+
+        mongoc_change_stream_destroy(stream);
+
+        if (!watch_is_running())
+            break;
+
+        /* e.g. Standalone server : $changeStream needs a replica set */
+        if (healthy) {
+            ogs_warn("Change stream failure: %s", error.message);
+            if (self.ttl)
+                ogs_warn("Subscriber cache is bounded by TTL only");
+            else
+                ogs_warn("Subscriber cache is bypassed");
+        } else {
+            ogs_debug("Change stream failure: %s", error.message);
+        }
+        healthy = false;
+        watch_set_healthy(false);
+
+        watch_backoff(backoff);
+        backoff = ogs_min(backoff * 2, WATCH_BACKOFF_MAX);
+    }
+
+    bson_destroy(opts);
+    bson_destroy(pipeline);
+    mongoc_collection_destroy(collection);
+}
+#endif
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_CACHE_H
+#define OGS_DBI_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ogs_dbi_cache_stats_s {
+    uint64_t hit;
+    uint64_t miss;
+    uint64_t eviction;
+    uint64_t expiration;
+    uint64_t invalidation;
+
+    int size;
+    int max;
+} ogs_dbi_cache_stats_t;
+
+/*
+ * Read-through cache of the 'subscribers' collection keyed by SUPI.
+ *
+ * - max   : Maximum number of cached documents. 0 disables the cache.
+ * - ttl   : Lifetime of each cached document. 0 means no expiry.
+ * - watch : Invalidate entries from a MongoDB change stream.
+ *           Change streams need a replica set. While the stream is down,
+ *           the cache is flushed and reopening is retried with a backoff.
+ *           With `ttl: 0` the cache is not used until the stream is back.
+ */
+int ogs_dbi_cache_init(int max, ogs_time_t ttl, bool watch);
+void ogs_dbi_cache_final(void);
+
+/*
+ * Returns a copy of the subscriber document, from the cache if possible.
+ * The caller must release it with bson_destroy().
+ */
+bson_t *ogs_dbi_cache_lookup(char *supi);
+
+/*
+ * Copies the subscription record of the subscriber into `record`
+ * and binds it. The record is built once and kept with the document.
+ */
+int ogs_dbi_cache_lookup_record(char *supi, ogs_dbi_record_t *record);
+
+/*
+ * Replaces the cached document of `supi`, if it is cached, with one
+ * changed behind our back, e.g. from the MongoDB change stream.
+ */
+void ogs_dbi_cache_update(char *supi, const bson_t *document);
+
+void ogs_dbi_cache_remove(char *supi);
+void ogs_dbi_cache_remove_all(void);
+
+void ogs_dbi_cache_update_sqn(char *supi, uint64_t sqn);
+void ogs_dbi_cache_increment_sqn(char *supi);
+
+void ogs_dbi_cache_stats(ogs_dbi_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_CACHE_H */
@@ -23,10 +23,7 @@ int ogs_dbi_msisdn_data(
         char *imsi_or_msisdn_bcd, ogs_msisdn_data_t *msisdn_data)
 {
     int rv = OGS_OK;
-    mongoc_cursor_t *cursor = NULL;
-    bson_t *query = NULL;
-    bson_error_t error;
-    const bson_t *document;
+    bson_t *document = NULL;
     bson_iter_t iter;
     bson_iter_t child1_iter;
     const char *utf8 = NULL;
@@ -42,33 +39,14 @@ int ogs_dbi_msisdn_data(
     /* msisdn_data should be initialized to zero */
     ogs_assert(memcmp(msisdn_data, &zero_data, sizeof(zero_data)) == 0);
 
-    query = BCON_NEW("$or",
-            "[",
-                "{", "imsi", BCON_UTF8(imsi_or_msisdn_bcd), "}",
-                "{", "msisdn", BCON_UTF8(imsi_or_msisdn_bcd), "}",
-            "]");
-#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
-#else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
-            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
-#endif
-
-    if (!mongoc_cursor_next(cursor, &document)) {
+    document = ogs_dbi_backend()->find_msisdn(imsi_or_msisdn_bcd);
+    if (!document) {
         ogs_error("[%s] Cannot find IMSI or MSISDN in DB", imsi_or_msisdn_bcd);
 
         rv = OGS_ERROR;
         goto out;
     }
 
-    if (mongoc_cursor_error(cursor, &error)) {
-        ogs_error("Cursor Failure: %s", error.message);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
-
     if (!bson_iter_init(&iter, document)) {
         ogs_error("bson_iter_init failed in this document");
 
@@ -111,8 +89,7 @@ int ogs_dbi_msisdn_data(
     }
 
 out:
-    if (query) bson_destroy(query);
-    if (cursor) mongoc_cursor_destroy(cursor);
+    if (document) bson_destroy(document);
 
     return rv;
 }
@@ -120,18 +97,12 @@ out:
 int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
 {
     int rv = OGS_OK;
-    mongoc_cursor_t *cursor = NULL;
-    bson_t *query = NULL;
-    bson_error_t error;
-    const bson_t *document;
+    bson_t *document = NULL;
     bson_iter_t iter;
     bson_iter_t child1_iter;
     const char *utf8 = NULL;
     uint32_t length = 0;
 
-    char *supi_type = NULL;
-    char *supi_id = NULL;
-
     ogs_ims_data_t zero_data;
 
     ogs_assert(ims_data);
@@ -142,34 +113,14 @@ int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
     /* ims_data should be initialized to zero */
     ogs_assert(memcmp(ims_data, &zero_data, sizeof(zero_data)) == 0);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
-#else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
-            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
-#endif
-
-    if (!mongoc_cursor_next(cursor, &document)) {
+    document = ogs_dbi_cache_lookup(supi);
+    if (!document) {
         ogs_error("[%s] Cannot find IMSI in DB", supi);
 
         rv = OGS_ERROR;
         goto out;
     }
 
-    if (mongoc_cursor_error(cursor, &error)) {
-        ogs_error("Cursor Failure: %s", error.message);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
-
     if (!bson_iter_init(&iter, document)) {
         ogs_error("bson_iter_init failed in this document");
 
@@ -204,11 +155,7 @@ int ogs_dbi_ims_data(char *supi, ogs_ims_data_t *ims_data)
     }
 
 out:
-    if (query) bson_destroy(query);
-    if (cursor) mongoc_cursor_destroy(cursor);
-
-    ogs_free(supi_type);
-    ogs_free(supi_id);
+    if (document) bson_destroy(document);
 
     return rv;
 }
@@ -25,6 +25,12 @@
 #define OGS_DBI_INSIDE
 
 #include "dbi/ogs-mongoc.h"
+#include "dbi/record.h"
+#include "dbi/backend.h"
+#include "dbi/store.h"
+#include "dbi/cache.h"
+#include "dbi/worker.h"
+#include "dbi/sqn.h"
 #include "dbi/subscription.h"
 #include "dbi/session.h"
 #include "dbi/ims.h"
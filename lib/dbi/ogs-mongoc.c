@@ -25,6 +25,11 @@ int __ogs_dbi_domain;
 
 static ogs_mongoc_t self;
 
+/* Set in worker threads that own their mongoc_client_t */
+static __thread ogs_mongoc_t *thread_self;
+
+static const ogs_dbi_backend_t *backend = &ogs_dbi_mongoc_backend;
+
 /*
  * We've added it 
  * Because the following function is deprecated in the mongo-c-driver
@@ -155,15 +160,294 @@ void ogs_mongoc_final(void)
 
 ogs_mongoc_t *ogs_mongoc(void)
 {
+    if (thread_self)
+        return thread_self;
+
     return &self;
 }
 
+static bson_t *find_subscriber(char *supi)
+{
+    mongoc_cursor_t *cursor = NULL;
+    bson_t *query = NULL;
+    bson_error_t error;
+    const bson_t *document;
+    bson_t *copy = NULL;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    cursor = mongoc_collection_find_with_opts(
+            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+#else
+    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
+#endif
+
+    if (!mongoc_cursor_next(cursor, &document)) {
+        if (mongoc_cursor_error(cursor, &error))
+            ogs_error("Cursor Failure: %s", error.message);
+        goto out;
+    }
+
+    copy = bson_copy(document);
+    ogs_assert(copy);
+
+out:
+    if (query) bson_destroy(query);
+    if (cursor) mongoc_cursor_destroy(cursor);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return copy;
+}
+
+static bson_t *find_msisdn(char *imsi_or_msisdn_bcd)
+{
+    mongoc_cursor_t *cursor = NULL;
+    bson_t *query = NULL;
+    bson_error_t error;
+    const bson_t *document;
+    bson_t *copy = NULL;
+
+    ogs_assert(imsi_or_msisdn_bcd);
+
+    query = BCON_NEW("$or",
+            "[",
+                "{", "imsi", BCON_UTF8(imsi_or_msisdn_bcd), "}",
+                "{", "msisdn", BCON_UTF8(imsi_or_msisdn_bcd), "}",
+            "]");
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    cursor = mongoc_collection_find_with_opts(
+            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+#else
+    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
+#endif
+
+    if (!mongoc_cursor_next(cursor, &document)) {
+        if (mongoc_cursor_error(cursor, &error))
+            ogs_error("Cursor Failure: %s", error.message);
+        goto out;
+    }
+
+    copy = bson_copy(document);
+    ogs_assert(copy);
+
+out:
+    if (query) bson_destroy(query);
+    if (cursor) mongoc_cursor_destroy(cursor);
+
+    return copy;
+}
+
+static int update_sqn(char *supi, uint64_t sqn)
+{
+    int rv = OGS_OK;
+    bson_t *query = NULL;
+    bson_t *update = NULL;
+    bson_error_t error;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+    update = BCON_NEW("$set",
+            "{",
+                "security.sqn", BCON_INT64(sqn),
+            "}");
+
+    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
+        ogs_error("mongoc_collection_update() failure: %s", error.message);
+
+        rv = OGS_ERROR;
+    }
+
+    if (query) bson_destroy(query);
+    if (update) bson_destroy(update);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return rv;
+}
+
+static int increment_sqn(char *supi)
+{
+    int rv = OGS_OK;
+    bson_t *query = NULL;
+    bson_t *update = NULL;
+    bson_error_t error;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 17
+    /*
+     * security.sqn = (security.sqn + 32) % 2^48 with one pipeline update.
+     * MongoDB 4.2 or later is required. Otherwise, fall back to $inc/$bit.
+     */
+    update = BCON_NEW("0",
+            "{",
+                "$set",
+                "{",
+                    "security.sqn",
+                    "{",
+                        "$mod",
+                        "[",
+                            "{",
+                                "$add",
+                                "[",
+                                    BCON_UTF8("$security.sqn"),
+                                    BCON_INT64(32),
+                                "]",
+                            "}",
+                            BCON_INT64(OGS_MAX_SQN + 1),
+                        "]",
+                    "}",
+                "}",
+            "}");
+    if (mongoc_collection_update_one(ogs_mongoc()->collection.subscriber,
+            query, update, NULL, NULL, &error))
+        goto out;
+
+    ogs_debug("Pipeline update failure: %s", error.message);
+    bson_destroy(update);
+#endif
+
+    update = BCON_NEW("$inc",
+            "{",
+                "security.sqn", BCON_INT64(32),
+            "}");
+    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
+        ogs_error("mongoc_collection_update() failure: %s", error.message);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+    bson_destroy(update);
+
+    update = BCON_NEW("$bit",
+            "{",
+                "security.sqn",
+                "{", "and", BCON_INT64(OGS_MAX_SQN), "}",
+            "}");
+    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
+        ogs_error("mongoc_collection_update() failure: %s", error.message);
+
+        rv = OGS_ERROR;
+    }
+
+out:
+    if (query) bson_destroy(query);
+    if (update) bson_destroy(update);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return rv;
+}
+
+static int update_imeisv(char *supi, char *imeisv)
+{
+    int rv = OGS_OK;
+    bson_t *query = NULL;
+    bson_t *update = NULL;
+    bson_error_t error;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    ogs_assert(supi);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    ogs_debug("SUPI type: %s, SUPI id: %s, imeisv: %s",
+            supi_type, supi_id, imeisv);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+    update = BCON_NEW("$set",
+            "{",
+                "imeisv", BCON_UTF8(imeisv),
+            "}");
+    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+            MONGOC_UPDATE_UPSERT, query, update, NULL, &error)) {
+        ogs_error("mongoc_collection_update() failure: %s", error.message);
+
+        rv = OGS_ERROR;
+    }
+
+    if (query) bson_destroy(query);
+    if (update) bson_destroy(update);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return rv;
+}
+
+const ogs_dbi_backend_t ogs_dbi_mongoc_backend = {
+    "mongodb",
+    find_subscriber,
+    find_msisdn,
+    update_sqn,
+    increment_sqn,
+    update_imeisv,
+    NULL,
+};
+
+const ogs_dbi_backend_t *ogs_dbi_backend(void)
+{
+    return backend;
+}
+
 int ogs_dbi_init(const char *db_uri)
 {
     int rv;
 
     ogs_assert(db_uri);
 
+    if (!strncmp(db_uri, OGS_DBI_STORE_URI_PREFIX,
+                strlen(OGS_DBI_STORE_URI_PREFIX))) {
+        rv = ogs_dbi_store_open(db_uri + strlen(OGS_DBI_STORE_URI_PREFIX));
+        if (rv != OGS_OK) return rv;
+
+        backend = &ogs_dbi_store_backend;
+        return OGS_OK;
+    }
+
     rv = ogs_mongoc_init(db_uri);
     if (rv != OGS_OK) return rv;
 
@@ -173,14 +457,91 @@ int ogs_dbi_init(const char *db_uri)
         ogs_assert(self.collection.subscriber);
     }
 
+    backend = &ogs_dbi_mongoc_backend;
+
     return OGS_OK;
 }
 
 void ogs_dbi_final()
 {
+    ogs_dbi_sqn_final();
+    ogs_dbi_cache_final();
+
+    if (backend == &ogs_dbi_store_backend)
+        ogs_dbi_store_close();
+    backend = &ogs_dbi_mongoc_backend;
+
     if (self.collection.subscriber) {
         mongoc_collection_destroy(self.collection.subscriber);
+        self.collection.subscriber = NULL;
     }
 
     ogs_mongoc_final();
 }
+
+int ogs_dbi_thread_init(ogs_time_t timeout)
+{
+    mongoc_uri_t *uri = NULL;
+
+    /* Only MongoDB needs a connection per thread */
+    if (backend != &ogs_dbi_mongoc_backend)
+        return OGS_OK;
+
+    ogs_assert(!thread_self);
+    ogs_assert(self.client);
+    ogs_assert(self.name);
+
+    thread_self = ogs_calloc(1, sizeof(ogs_mongoc_t));
+    ogs_assert(thread_self);
+
+    thread_self->initialized = true;
+    thread_self->name = self.name;
+
+    uri = mongoc_uri_copy(mongoc_client_get_uri(self.client));
+    ogs_assert(uri);
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 4
+    /* A stuck query must not hold the worker longer than the timeout */
+    if (timeout)
+        mongoc_uri_set_option_as_int32(uri, "sockettimeoutms",
+                (int32_t)ogs_time_to_msec(timeout));
+#endif
+
+    thread_self->client = mongoc_client_new_from_uri(uri);
+    mongoc_uri_destroy(uri);
+    if (!thread_self->client) {
+        ogs_error("Failed to create MongoDB client [%s]", self.masked_db_uri);
+        ogs_free(thread_self);
+        thread_self = NULL;
+        return OGS_ERROR;
+    }
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 4
+    mongoc_client_set_error_api(thread_self->client, 2);
+#endif
+
+    thread_self->database = mongoc_client_get_database(
+            thread_self->client, thread_self->name);
+    ogs_assert(thread_self->database);
+
+    thread_self->collection.subscriber = mongoc_client_get_collection(
+            thread_self->client, thread_self->name, "subscribers");
+    ogs_assert(thread_self->collection.subscriber);
+
+    return OGS_OK;
+}
+
+void ogs_dbi_thread_final(void)
+{
+    if (!thread_self)
+        return;
+
+    if (thread_self->collection.subscriber)
+        mongoc_collection_destroy(thread_self->collection.subscriber);
+    if (thread_self->database)
+        mongoc_database_destroy(thread_self->database);
+    if (thread_self->client)
+        mongoc_client_destroy(thread_self->client);
+
+    ogs_free(thread_self);
+    thread_self = NULL;
+}
@@ -51,6 +51,13 @@ ogs_mongoc_t *ogs_mongoc(void);
 int ogs_dbi_init(const char *db_uri);
 void ogs_dbi_final(void);
 
+/*
+ * mongoc_client_t is not thread-safe. A thread other than the main one
+ * must open its own connection before calling ogs_dbi_*() functions.
+ */
+int ogs_dbi_thread_init(ogs_time_t timeout);
+void ogs_dbi_thread_final(void);
+
 #ifdef __cplusplus
 }
 #endif
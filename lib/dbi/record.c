@@ -0,0 +1,405 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+#define RECORD_HEADER_LEN offsetof(ogs_dbi_record_t, dnn)
+
+static void parse_bitrate(bson_iter_t *iter, uint64_t *bitrate)
+{
+    bson_iter_t child_iter;
+    uint8_t unit = 0;
+    int n;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!strcmp(key, "value") && BSON_ITER_HOLDS_INT32(&child_iter)) {
+            *bitrate = bson_iter_int32(&child_iter);
+        } else if (!strcmp(key, "unit") &&
+                BSON_ITER_HOLDS_INT32(&child_iter)) {
+            unit = bson_iter_int32(&child_iter);
+        }
+    }
+
+    for (n = 0; n < unit; n++)
+        *bitrate *= 1024;
+}
+
+static void parse_ambr(bson_iter_t *iter, ogs_bitrate_t *ambr)
+{
+    bson_iter_t child_iter;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!strcmp(key, "downlink") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_bitrate(&child_iter, &ambr->downlink);
+        } else if (!strcmp(key, "uplink") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_bitrate(&child_iter, &ambr->uplink);
+        }
+    }
+}
+
+static void parse_qos(bson_iter_t *iter, ogs_qos_t *qos)
+{
+    bson_iter_t child_iter, arp_iter;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!strcmp(key, "index") && BSON_ITER_HOLDS_INT32(&child_iter)) {
+            qos->index = bson_iter_int32(&child_iter);
+        } else if (!strcmp(key, "arp") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            if (!bson_iter_recurse(&child_iter, &arp_iter))
+                continue;
+
+            while (bson_iter_next(&arp_iter)) {
+                const char *arp_key = bson_iter_key(&arp_iter);
+                if (!BSON_ITER_HOLDS_INT32(&arp_iter))
+                    continue;
+
+                if (!strcmp(arp_key, "priority_level"))
+                    qos->arp.priority_level = bson_iter_int32(&arp_iter);
+                else if (!strcmp(arp_key, "pre_emption_capability"))
+                    qos->arp.pre_emption_capability =
+                        bson_iter_int32(&arp_iter);
+                else if (!strcmp(arp_key, "pre_emption_vulnerability"))
+                    qos->arp.pre_emption_vulnerability =
+                        bson_iter_int32(&arp_iter);
+            }
+        }
+    }
+}
+
+static void parse_ip(bson_iter_t *iter, ogs_ip_t *ip)
+{
+    bson_iter_t child_iter;
+    ogs_ipsubnet_t ipsub;
+    const char *v = NULL;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!BSON_ITER_HOLDS_UTF8(&child_iter))
+            continue;
+
+        v = bson_iter_utf8(&child_iter, NULL);
+        if (!strcmp(key, "addr")) {
+            if (ogs_ipsubnet(&ipsub, v, NULL) == OGS_OK) {
+                ip->ipv4 = 1;
+                ip->addr = ipsub.sub[0];
+            }
+        } else if (!strcmp(key, "addr6")) {
+            if (ogs_ipsubnet(&ipsub, v, NULL) == OGS_OK) {
+                ip->ipv6 = 1;
+                memcpy(ip->addr6, ipsub.sub, OGS_IPV6_LEN);
+            }
+        }
+    }
+}
+
+static int parse_session(ogs_dbi_record_t *record, size_t *used,
+        bson_iter_t *iter, ogs_session_t *session, uint16_t *dnn_offset)
+{
+    bson_iter_t child_iter;
+    const char *utf8 = NULL;
+    uint32_t length = 0;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return OGS_ERROR;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!strcmp(key, "name") && BSON_ITER_HOLDS_UTF8(&child_iter)) {
+            utf8 = bson_iter_utf8(&child_iter, &length);
+            if (length > OGS_MAX_DNN_LEN) {
+                ogs_error("DNN is too long [%d]", length);
+                return OGS_ERROR;
+            }
+            if (*dnn_offset) {
+                ogs_error("Duplicated session name");
+                return OGS_ERROR;
+            }
+            if (!length)
+                continue;
+
+            ogs_assert(*used + length + 1 <= sizeof(record->dnn));
+            memcpy(record->dnn + *used, utf8, length);
+            record->dnn[*used + length] = 0;
+
+            *dnn_offset = *used;
+            *used += length + 1;
+        } else if (!strcmp(key, "type") &&
+                BSON_ITER_HOLDS_INT32(&child_iter)) {
+            session->session_type = bson_iter_int32(&child_iter);
+        } else if (!strcmp(key, "qos") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_qos(&child_iter, &session->qos);
+        } else if (!strcmp(key, "ambr") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_ambr(&child_iter, &session->ambr);
+        } else if (!strcmp(key, "smf") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_ip(&child_iter, &session->smf_ip);
+        } else if (!strcmp(key, "ue") &&
+                BSON_ITER_HOLDS_DOCUMENT(&child_iter)) {
+            parse_ip(&child_iter, &session->ue_ip);
+        }
+    }
+
+    return OGS_OK;
+}
+
+static int parse_slice(ogs_dbi_record_t *record, size_t *used,
+        bson_iter_t *iter, int slice_index)
+{
+    ogs_slice_data_t *slice_data = NULL;
+    bson_iter_t child_iter, session_iter;
+    const char *utf8 = NULL;
+    int rv;
+
+    slice_data = &record->subscription_data.slice[slice_index];
+
+    slice_data->s_nssai.sst = 0;
+    slice_data->s_nssai.sd.v = OGS_S_NSSAI_NO_SD_VALUE;
+
+    if (!bson_iter_recurse(iter, &child_iter))
+        return OGS_ERROR;
+
+    while (bson_iter_next(&child_iter)) {
+        const char *key = bson_iter_key(&child_iter);
+        if (!strcmp(key, "sst") && BSON_ITER_HOLDS_INT32(&child_iter)) {
+            slice_data->s_nssai.sst = bson_iter_int32(&child_iter);
+        } else if (!strcmp(key, "sd") && BSON_ITER_HOLDS_UTF8(&child_iter)) {
+            utf8 = bson_iter_utf8(&child_iter, NULL);
+            slice_data->s_nssai.sd = ogs_s_nssai_sd_from_string(utf8);
+        } else if (!strcmp(key, "default_indicator") &&
+                BSON_ITER_HOLDS_BOOL(&child_iter)) {
+            slice_data->default_indicator = bson_iter_bool(&child_iter);
+        } else if (!strcmp(key, "session") &&
+                BSON_ITER_HOLDS_ARRAY(&child_iter)) {
+            if (!bson_iter_recurse(&child_iter, &session_iter))
+                return OGS_ERROR;
+
+            while (bson_iter_next(&session_iter)) {
+                int n = slice_data->num_of_session;
+
+                if (!BSON_ITER_HOLDS_DOCUMENT(&session_iter))
+                    continue;
+                if (n >= OGS_MAX_NUM_OF_SESS) {
+                    ogs_error("Too many sessions in a slice");
+                    return OGS_ERROR;
+                }
+
+                rv = parse_session(record, used, &session_iter,
+                        &slice_data->session[n],
+                        &record->dnn_offset[slice_index][n]);
+                if (rv != OGS_OK)
+                    return rv;
+
+                slice_data->num_of_session++;
+            }
+        }
+    }
+
+    return OGS_OK;
+}
+
+int ogs_dbi_record_build(
+        ogs_dbi_record_t *record, const uint8_t *data, size_t length)
+{
+    int rv;
+    bson_t document;
+    bson_iter_t iter, child_iter;
+    ogs_subscription_data_t *subscription_data = NULL;
+    const char *utf8 = NULL;
+    uint32_t utf8_length = 0;
+    size_t used = 1;    /* dnn[0] is the empty string */
+
+    ogs_assert(record);
+    ogs_assert(data);
+
+    memset(record, 0, RECORD_HEADER_LEN + 1);
+    subscription_data = &record->subscription_data;
+
+    if (!bson_init_static(&document, data, length)) {
+        ogs_error("Invalid BSON document [length:%d]", (int)length);
+        return OGS_ERROR;
+    }
+    if (!bson_iter_init(&iter, &document)) {
+        ogs_error("bson_iter_init failed in this document");
+        return OGS_ERROR;
+    }
+
+    while (bson_iter_next(&iter)) {
+        const char *key = bson_iter_key(&iter);
+        if (!strcmp(key, "msisdn") && BSON_ITER_HOLDS_ARRAY(&iter)) {
+            if (!bson_iter_recurse(&iter, &child_iter))
+                return OGS_ERROR;
+
+            while (bson_iter_next(&child_iter)) {
+                int n = subscription_data->num_of_msisdn;
+
+                if (!BSON_ITER_HOLDS_UTF8(&child_iter))
+                    continue;
+                if (n >= OGS_MAX_NUM_OF_MSISDN) {
+                    ogs_error("Too many MSISDNs");
+                    return OGS_ERROR;
+                }
+
+                utf8 = bson_iter_utf8(&child_iter, &utf8_length);
+                ogs_cpystrn(subscription_data->msisdn[n].bcd, utf8,
+                        ogs_min(utf8_length, OGS_MAX_MSISDN_BCD_LEN)+1);
+                ogs_bcd_to_buffer(subscription_data->msisdn[n].bcd,
+                        subscription_data->msisdn[n].buf,
+                        &subscription_data->msisdn[n].len);
+
+                subscription_data->num_of_msisdn++;
+            }
+        } else if (!strcmp(key, "access_restriction_data") &&
+                BSON_ITER_HOLDS_INT32(&iter)) {
+            subscription_data->access_restriction_data =
+                bson_iter_int32(&iter);
+        } else if (!strcmp(key, "subscriber_status") &&
+                BSON_ITER_HOLDS_INT32(&iter)) {
+            subscription_data->subscriber_status = bson_iter_int32(&iter);
+        } else if (!strcmp(key, "network_access_mode") &&
+                BSON_ITER_HOLDS_INT32(&iter)) {
+            subscription_data->network_access_mode = bson_iter_int32(&iter);
+        } else if (!strcmp(key, "subscribed_rau_tau_timer") &&
+                BSON_ITER_HOLDS_INT32(&iter)) {
+            subscription_data->subscribed_rau_tau_timer =
+                bson_iter_int32(&iter);
+        } else if (!strcmp(key, "ambr") && BSON_ITER_HOLDS_DOCUMENT(&iter)) {
+            parse_ambr(&iter, &subscription_data->ambr);
+        } else if (!strcmp(key, "slice") && BSON_ITER_HOLDS_ARRAY(&iter)) {
+            if (!bson_iter_recurse(&iter, &child_iter))
+                return OGS_ERROR;
+
+            while (bson_iter_next(&child_iter)) {
+                int n = subscription_data->num_of_slice;
+
+                if (!BSON_ITER_HOLDS_DOCUMENT(&child_iter))
+                    continue;
+                if (n >= OGS_MAX_NUM_OF_SLICE) {
+                    ogs_error("Too many slices");
+                    return OGS_ERROR;
+                }
+
+                rv = parse_slice(record, &used, &child_iter, n);
+                if (rv != OGS_OK)
+                    return rv;
+
+                subscription_data->num_of_slice++;
+            }
+        }
+    }
+
+    record->version = OGS_DBI_RECORD_VERSION;
+    record->length = RECORD_HEADER_LEN + used;
+
+    return OGS_OK;
+}
+
+bool ogs_dbi_record_valid(const ogs_dbi_record_t *record, size_t length)
+{
+    const ogs_subscription_data_t *subscription_data = NULL;
+    size_t used;
+    int i, j;
+
+    ogs_assert(record);
+
+    if (length <= RECORD_HEADER_LEN || length > sizeof(*record))
+        return false;
+    if (record->version != OGS_DBI_RECORD_VERSION ||
+        record->length != length)
+        return false;
+
+    used = length - RECORD_HEADER_LEN;
+    if (record->dnn[0] || record->dnn[used-1])
+        return false;
+
+    subscription_data = &record->subscription_data;
+    if (subscription_data->num_of_slice < 0 ||
+        subscription_data->num_of_slice > OGS_MAX_NUM_OF_SLICE ||
+        subscription_data->num_of_msisdn < 0 ||
+        subscription_data->num_of_msisdn > OGS_MAX_NUM_OF_MSISDN)
+        return false;
+
+    for (i = 0; i < subscription_data->num_of_slice; i++) {
+        const ogs_slice_data_t *slice_data = &subscription_data->slice[i];
+
+        if (slice_data->num_of_session < 0 ||
+            slice_data->num_of_session > OGS_MAX_NUM_OF_SESS)
+            return false;
+
+        for (j = 0; j < slice_data->num_of_session; j++) {
+            if (record->dnn_offset[i][j] >= used)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void ogs_dbi_record_copy(ogs_dbi_record_t *dst, const ogs_dbi_record_t *src)
+{
+    ogs_assert(dst);
+    ogs_assert(src);
+    ogs_assert(src->length > RECORD_HEADER_LEN);
+    ogs_assert(src->length <= sizeof(*src));
+
+    memcpy(dst, src, src->length);
+}
+
+void ogs_dbi_record_bind(ogs_dbi_record_t *record)
+{
+    ogs_subscription_data_t *subscription_data = NULL;
+    int i, j;
+
+    ogs_assert(record);
+
+    subscription_data = &record->subscription_data;
+    ogs_assert(subscription_data->num_of_slice <= OGS_MAX_NUM_OF_SLICE);
+
+    for (i = 0; i < subscription_data->num_of_slice; i++) {
+        ogs_slice_data_t *slice_data = &subscription_data->slice[i];
+
+        ogs_assert(slice_data->num_of_session <= OGS_MAX_NUM_OF_SESS);
+
+        for (j = 0; j < slice_data->num_of_session; j++) {
+            uint16_t offset = record->dnn_offset[i][j];
+
+            slice_data->session[j].name =
+                offset ? &record->dnn[offset] : NULL;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_RECORD_H
+#define OGS_DBI_RECORD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Decoded subscription data of a subscriber document.
+ *
+ * A record holds no pointers once built. Session names are packed in
+ * `dnn` and referenced by offset, so the first `length` bytes can be
+ * moved with memcpy() and shared read-only. ogs_dbi_record_bind()
+ * then points `subscription_data.slice[].session[].name` at `dnn`.
+ *
+ * The layout follows ogs_subscription_data_t of this build.
+ * It is not meant to be exchanged between different builds.
+ */
+#define OGS_DBI_RECORD_VERSION 1
+
+#define OGS_DBI_RECORD_MAX_DNN \
+    (OGS_MAX_NUM_OF_SLICE * OGS_MAX_NUM_OF_SESS * (OGS_MAX_DNN_LEN+1) + 1)
+
+typedef struct ogs_dbi_record_s {
+    uint32_t version;
+    uint32_t length;            /* Bytes in use from the start */
+
+    ogs_subscription_data_t subscription_data;
+
+    /* Offset in `dnn`. 0 is an empty string : no name */
+    uint16_t dnn_offset[OGS_MAX_NUM_OF_SLICE][OGS_MAX_NUM_OF_SESS];
+    char dnn[OGS_DBI_RECORD_MAX_DNN];
+} ogs_dbi_record_t;
+
+/*
+ * Builds an unbound record from a BSON subscriber document.
+ *
+ * `data` is not trusted. Malformed documents and documents exceeding
+ * the limits of ogs_subscription_data_t return OGS_ERROR.
+ */
+int ogs_dbi_record_build(
+        ogs_dbi_record_t *record, const uint8_t *data, size_t length);
+
+/* Checks a record received from elsewhere before it is used */
+bool ogs_dbi_record_valid(const ogs_dbi_record_t *record, size_t length);
+
+/* Copies the bytes in use. `dst` must be bound again */
+void ogs_dbi_record_copy(ogs_dbi_record_t *dst, const ogs_dbi_record_t *src);
+void ogs_dbi_record_bind(ogs_dbi_record_t *record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_RECORD_H */
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+typedef struct ogs_dbi_sqn_entry_s {
+    char *supi;
+    uint64_t sqn;
+} ogs_dbi_sqn_entry_t;
+
+static struct {
+    bool enabled;
+    bool running;
+    bool started;           /* The flusher has tried to connect */
+    bool connected;
+    ogs_time_t flush_interval;
+
+    ogs_thread_mutex_t mutex;
+    ogs_thread_cond_t cond;
+    ogs_thread_t *thread;
+
+    ogs_hash_t *pending;
+    ogs_hash_t *flushing;   /* Being written by the flusher */
+} self;
+
+static void flush_main(void *data);
+static void flush(void);
+static void entry_free_all(ogs_hash_t *hash);
+static ogs_dbi_sqn_entry_t *entry_find(char *supi);
+static void entry_set(char *supi, uint64_t sqn);
+
+int ogs_dbi_sqn_init(ogs_time_t flush_interval)
+{
+    memset(&self, 0, sizeof(self));
+
+    if (!flush_interval)
+        return OGS_OK;
+
+    if (ogs_dbi_backend() != &ogs_dbi_mongoc_backend) {
+        /* SQN is already written in place without a network round trip */
+        ogs_info("SQN write-behind is not used with the %s backend",
+                ogs_dbi_backend()->name);
+        return OGS_OK;
+    }
+
+    ogs_thread_mutex_init(&self.mutex);
+    ogs_thread_cond_init(&self.cond);
+
+    self.pending = ogs_hash_make();
+    ogs_assert(self.pending);
+
+    self.flush_interval = flush_interval;
+    self.running = true;
+
+    self.thread = ogs_thread_create(flush_main, NULL);
+    ogs_assert(self.thread);
+
+    /* Nothing is deferred until the flusher can write it */
+    ogs_thread_mutex_lock(&self.mutex);
+    while (!self.started)
+        ogs_thread_cond_wait(&self.cond, &self.mutex);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    if (!self.connected) {
+        ogs_thread_destroy(self.thread);
+        ogs_hash_destroy(self.pending);
+        ogs_thread_cond_destroy(&self.cond);
+        ogs_thread_mutex_destroy(&self.mutex);
+
+        memset(&self, 0, sizeof(self));
+
+        ogs_warn("SQN write-behind is disabled, SQN is written immediately");
+        return OGS_OK;
+    }
+
+    self.enabled = true;
+
+    ogs_info("SQN write-behind [flush_interval:%lld ms]",
+            (long long)ogs_time_to_msec(flush_interval));
+
+    return OGS_OK;
+}
+
+void ogs_dbi_sqn_final(void)
+{
+    if (!self.enabled)
+        return;
+
+    /* The flusher writes whatever is still pending before it exits */
+    ogs_thread_mutex_lock(&self.mutex);
+    self.running = false;
+    ogs_thread_cond_signal(&self.cond);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    ogs_thread_destroy(self.thread);
+    self.thread = NULL;
+
+    if (ogs_hash_count(self.pending))
+        ogs_error("%d SQN updates were not written",
+                ogs_hash_count(self.pending));
+
+    entry_free_all(self.pending);
+    ogs_hash_destroy(self.pending);
+
+    ogs_thread_cond_destroy(&self.cond);
+    ogs_thread_mutex_destroy(&self.mutex);
+
+    self.enabled = false;
+}
+
+bool ogs_dbi_sqn_defer(char *supi, uint64_t sqn)
+{
+    ogs_assert(supi);
+
+    if (!self.enabled)
+        return false;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    entry_set(supi, sqn);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return true;
+}
+
+bool ogs_dbi_sqn_defer_increment(char *supi, uint64_t *sqn)
+{
+    ogs_dbi_sqn_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(sqn);
+
+    if (!self.enabled)
+        return false;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    entry = entry_find(supi);
+    if (entry) {
+        *sqn = (entry->sqn + 32) & OGS_MAX_SQN;
+        entry_set(supi, *sqn);
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return entry ? true : false;
+}
+
+bool ogs_dbi_sqn_pending(char *supi, uint64_t *sqn)
+{
+    ogs_dbi_sqn_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(sqn);
+
+    if (!self.enabled)
+        return false;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    entry = entry_find(supi);
+    if (entry)
+        *sqn = entry->sqn;
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return entry ? true : false;
+}
+
+static void flush_main(void *data)
+{
+    bool running = true;
+    int rv;
+
+    rv = ogs_dbi_thread_init(0);
+    if (rv != OGS_OK)
+        ogs_error("SQN write-behind cannot connect to MongoDB");
+
+    ogs_thread_mutex_lock(&self.mutex);
+    self.started = true;
+    self.connected = (rv == OGS_OK);
+    ogs_thread_cond_signal(&self.cond);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    if (rv != OGS_OK)
+        return;
+
+    while (running) {
+        ogs_thread_mutex_lock(&self.mutex);
+        if (self.running)
+            ogs_thread_cond_timedwait(
+                    &self.cond, &self.mutex, self.flush_interval);
+        running = self.running;
+        ogs_thread_mutex_unlock(&self.mutex);
+
+        flush();
+    }
+
+    ogs_dbi_thread_final();
+}
+
+static void flush(void)
+{
+    ogs_hash_t *batch = NULL;
+    ogs_hash_index_t *hi = NULL;
+    mongoc_bulk_operation_t *bulk = NULL;
+    bson_error_t error;
+    bson_t reply;
+    bool ok;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (!ogs_hash_count(self.pending)) {
+        ogs_thread_mutex_unlock(&self.mutex);
+        return;
+    }
+    batch = self.pending;
+    self.pending = ogs_hash_make();
+    ogs_assert(self.pending);
+    self.flushing = batch;
+    ogs_thread_mutex_unlock(&self.mutex);
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+    bulk = mongoc_collection_create_bulk_operation_with_opts(
+            ogs_mongoc()->collection.subscriber, NULL);
+#else
+    bulk = mongoc_collection_create_bulk_operation(
+            ogs_mongoc()->collection.subscriber, false, NULL);
+#endif
+    ogs_assert(bulk);
+
+    for (hi = ogs_hash_first(batch); hi; hi = ogs_hash_next(hi)) {
+        ogs_dbi_sqn_entry_t *entry = ogs_hash_this_val(hi);
+        bson_t *query = NULL;
+        bson_t *update = NULL;
+        char *supi_type = NULL;
+        char *supi_id = NULL;
+
+        ogs_assert(entry);
+
+        supi_type = ogs_id_get_type(entry->supi);
+        ogs_assert(supi_type);
+        supi_id = ogs_id_get_value(entry->supi);
+        ogs_assert(supi_id);
+
+        query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+        update = BCON_NEW("$set",
+                "{",
+                    "security.sqn", BCON_INT64(entry->sqn),
+                "}");
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 7
+        if (!mongoc_bulk_operation_update_one_with_opts(
+                    bulk, query, update, NULL, &error))
+            ogs_error("mongoc_bulk_operation_update_one_with_opts() "
+                    "failure: %s", error.message);
+#else
+        mongoc_bulk_operation_update_one(bulk, query, update, false);
+#endif
+
+        bson_destroy(query);
+        bson_destroy(update);
+        ogs_free(supi_type);
+        ogs_free(supi_id);
+    }
+
+    ok = mongoc_bulk_operation_execute(bulk, &reply, &error);
+    if (!ok)
+        ogs_error("mongoc_bulk_operation_execute() failure: %s",
+                error.message);
+
+    bson_destroy(&reply);
+    mongoc_bulk_operation_destroy(bulk);
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (!ok) {
+        /* Retry on the next tick unless a newer SQN has been deferred */
+        for (hi = ogs_hash_first(batch); hi; hi = ogs_hash_next(hi)) {
+            ogs_dbi_sqn_entry_t *entry = ogs_hash_this_val(hi);
+
+            if (ogs_hash_get(self.pending, entry->supi, OGS_HASH_KEY_STRING))
+                continue;
+
+            ogs_hash_set(batch, entry->supi, OGS_HASH_KEY_STRING, NULL);
+            ogs_hash_set(self.pending,
+                    entry->supi, OGS_HASH_KEY_STRING, entry);
+        }
+    }
+    self.flushing = NULL;
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    entry_free_all(batch);
+    ogs_hash_destroy(batch);
+}
+
+static void entry_free_all(ogs_hash_t *hash)
+{
+    ogs_hash_index_t *hi = NULL;
+
+    ogs_assert(hash);
+
+    for (hi = ogs_hash_first(hash); hi; hi = ogs_hash_next(hi)) {
+        ogs_dbi_sqn_entry_t *entry = ogs_hash_this_val(hi);
+
+        ogs_hash_set(hash, entry->supi, OGS_HASH_KEY_STRING, NULL);
+
+        ogs_free(entry->supi);
+        ogs_free(entry);
+    }
+}
+
+/* Called with the mutex held */
+static void entry_set(char *supi, uint64_t sqn)
+{
+    ogs_dbi_sqn_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+
+    entry = ogs_hash_get(self.pending, supi, OGS_HASH_KEY_STRING);
+    if (!entry) {
+        entry = ogs_calloc(1, sizeof(*entry));
+        ogs_assert(entry);
+        entry->supi = ogs_strdup(supi);
+        ogs_assert(entry->supi);
+
+        ogs_hash_set(self.pending, entry->supi, OGS_HASH_KEY_STRING, entry);
+    }
+    entry->sqn = sqn;
+}
+
+/*
+ * An entry that is being flushed is still the latest SQN
+ * until the bulk write completes. Called with the mutex held.
+ */
+static ogs_dbi_sqn_entry_t *entry_find(char *supi)
+{
+    ogs_dbi_sqn_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+
+    entry = ogs_hash_get(self.pending, supi, OGS_HASH_KEY_STRING);
+    if (!entry && self.flushing)
+        entry = ogs_hash_get(self.flushing, supi, OGS_HASH_KEY_STRING);
+
+    return entry;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_SQN_H
+#define OGS_DBI_SQN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Write-behind of 'security.sqn'.
+ *
+ * SQN writes are kept in memory and written to MongoDB with one bulk
+ * operation every `flush_interval`. 0 disables write-behind and every
+ * SQN write goes to MongoDB immediately.
+ *
+ * SQN advanced within the last interval is lost if the process crashes.
+ * The UE then detects a stale SQN and triggers re-synchronisation.
+ *
+ * If the flusher has no connection of its own to MongoDB, write-behind
+ * stays disabled as if `flush_interval` were 0.
+ */
+int ogs_dbi_sqn_init(ogs_time_t flush_interval);
+void ogs_dbi_sqn_final(void);
+
+/*
+ * Used by ogs_dbi_*() functions in subscription.c
+ *
+ * ogs_dbi_sqn_defer() returns false if write-behind is disabled.
+ * ogs_dbi_sqn_defer_increment() returns false if there is nothing
+ * pending for this SUPI. Otherwise the new SQN is stored in `sqn`.
+ */
+bool ogs_dbi_sqn_defer(char *supi, uint64_t sqn);
+bool ogs_dbi_sqn_defer_increment(char *supi, uint64_t *sqn);
+bool ogs_dbi_sqn_pending(char *supi, uint64_t *sqn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_SQN_H */
@@ -0,0 +1,817 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ogs-dbi.h"
+
+/*
+ * File Layout
+ *
+ * +-----------------+ 0
+ * | store_header_t  |
+ * +-----------------+ STORE_HEADER_SIZE
+ * | bucket[]        | uint64_t offset of the first store_key_t
+ * +-----------------+
+ * | store_key_t     | appended by ogs_dbi_store_put()
+ * | store_record_t  |
+ * | ...             |
+ * +-----------------+ used
+ *
+ * Every offset is relative to the start of the file,
+ * so that the file can be mapped at any address.
+ *
+ * A key is always appended after the key it is chained to, so `next`
+ * is smaller than the offset of its own key. Offsets read from the file
+ * are checked before they are followed.
+ */
+#define STORE_MAGIC             "OGSDBST"
+#define STORE_VERSION           2
+#define STORE_HEADER_SIZE       4096
+#define STORE_MIN_BUCKET        1024
+#define STORE_MAX_BUCKET        (1U << 30)
+#define STORE_MIN_SIZE          (1024*1024)
+
+#define STORE_ALIGN(__sIZE)     (((__sIZE) + 7) & ~((uint64_t)7))
+
+typedef struct store_header_s {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_of_bucket;
+    uint64_t num_of_document;
+    uint64_t used;
+
+    /* ogs_dbi_record_t is specific to the build that imported the file */
+    uint32_t record_version;
+    uint32_t record_size;
+} store_header_t;
+
+/* Followed by the NUL-terminated key */
+typedef struct store_key_s {
+    uint64_t next;              /* Next key in the same bucket */
+    uint64_t record;
+    uint32_t hash;
+    uint32_t len;
+} store_key_t;
+
+/*
+ * Followed by the BSON document, and then by its ogs_dbi_record_t
+ * if the document could be decoded.
+ *
+ * 'security.sqn' lives in `sqn` rather than in the document. Other NFs
+ * may map the same file, so it is only accessed with 64-bit atomics.
+ */
+typedef struct store_record_s {
+    uint64_t sqn;
+    uint32_t length;            /* BSON document */
+    uint32_t record_length;     /* 0 : The document was not decodable */
+    uint8_t has_sqn;
+    uint8_t reserved[7];
+    char imeisv[24];
+} store_record_t;
+
+#define STORE_RECORD(__r) ((ogs_dbi_record_t *) \
+        ((uint8_t *)((__r) + 1) + STORE_ALIGN((__r)->length)))
+
+static struct {
+    int fd;
+    uint8_t *base;
+    size_t size;
+
+    ogs_thread_mutex_t mutex;
+} self;
+
+static int store_map(int fd, size_t size);
+static uint64_t store_alloc(size_t size);
+static bool store_valid(void);
+static bool store_in_range(uint64_t offset, uint64_t len);
+static uint64_t key_find(const char *key);
+static bool key_set(const char *key, uint64_t record);
+static store_record_t *record_find(const char *key);
+static int record_set_sqn(store_record_t *record, bool increment, uint64_t sqn);
+
+static store_header_t *header(void)
+{
+    return (store_header_t *)self.base;
+}
+
+static uint64_t *bucket(uint32_t hash)
+{
+    return (uint64_t *)(self.base + STORE_HEADER_SIZE) +
+        (hash & (header()->num_of_bucket - 1));
+}
+
+/* Offset of the first key */
+static uint64_t data_offset(void)
+{
+    return STORE_ALIGN(STORE_HEADER_SIZE +
+            (uint64_t)header()->num_of_bucket * sizeof(uint64_t));
+}
+
+static uint32_t hash_key(const char *key)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    while (*key) {
+        hash ^= (uint8_t)*key++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+int ogs_dbi_store_create(const char *path, int max)
+{
+    int fd;
+    uint32_t num_of_bucket = STORE_MIN_BUCKET;
+    size_t size;
+
+    ogs_assert(path);
+    ogs_assert(!self.base);
+
+    /* Keep the load factor of the hash table under 0.5 */
+    while (num_of_bucket < (uint32_t)max * 2 &&
+            num_of_bucket < STORE_MAX_BUCKET)
+        num_of_bucket <<= 1;
+
+    size = STORE_HEADER_SIZE + num_of_bucket * sizeof(uint64_t);
+    size = ogs_max(size * 2, STORE_MIN_SIZE);
+
+    fd = open(path, O_RDWR|O_CREAT|O_TRUNC, 0600);
+    if (fd < 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno, "open(%s) failed", path);
+        return OGS_ERROR;
+    }
+
+    if (ftruncate(fd, size) != 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno,
+                "ftruncate(%s) failed", path);
+        close(fd);
+        return OGS_ERROR;
+    }
+
+    if (store_map(fd, size) != OGS_OK) {
+        close(fd);
+        return OGS_ERROR;
+    }
+
+    memset(self.base, 0, STORE_HEADER_SIZE + num_of_bucket * sizeof(uint64_t));
+    memcpy(header()->magic, STORE_MAGIC, sizeof(header()->magic));
+    header()->version = STORE_VERSION;
+    header()->num_of_bucket = num_of_bucket;
+    header()->used = data_offset();
+    header()->record_version = OGS_DBI_RECORD_VERSION;
+    header()->record_size = sizeof(ogs_dbi_record_t);
+
+    return OGS_OK;
+}
+
+int ogs_dbi_store_open(const char *path)
+{
+    int fd;
+    struct stat st;
+
+    ogs_assert(path);
+    ogs_assert(!self.base);
+
+    if (!__atomic_always_lock_free(sizeof(uint64_t), 0)) {
+        ogs_error("Subscriber store needs lock-free 64-bit atomics");
+        return OGS_ERROR;
+    }
+
+    fd = open(path, O_RDWR);
+    if (fd < 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno, "open(%s) failed", path);
+        return OGS_ERROR;
+    }
+
+    if (fstat(fd, &st) != 0 || st.st_size < STORE_HEADER_SIZE) {
+        ogs_error("Invalid subscriber store [%s]", path);
+        close(fd);
+        return OGS_ERROR;
+    }
+
+    if (store_map(fd, st.st_size) != OGS_OK) {
+        close(fd);
+        return OGS_ERROR;
+    }
+
+    if (!store_valid()) {
+        ogs_error("Invalid subscriber store [%s]", path);
+        ogs_dbi_store_close();
+        return OGS_ERROR;
+    }
+
+    if (header()->record_version != OGS_DBI_RECORD_VERSION ||
+        header()->record_size != sizeof(ogs_dbi_record_t)) {
+        ogs_error("Subscriber store [%s] was imported by another build, "
+                "run open5gs-dbimport again", path);
+        ogs_dbi_store_close();
+        return OGS_ERROR;
+    }
+
+    ogs_info("Subscriber store: '%s' [%llu subscribers]", path,
+            (unsigned long long)header()->num_of_document);
+
+    return OGS_OK;
+}
+
+void ogs_dbi_store_close(void)
+{
+    if (!self.base)
+        return;
+
+    if (msync(self.base, self.size, MS_SYNC) != 0)
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno, "msync() failed");
+
+    munmap(self.base, self.size);
+    close(self.fd);
+
+    ogs_thread_mutex_destroy(&self.mutex);
+
+    memset(&self, 0, sizeof(self));
+}
+
+int ogs_dbi_store_put(const bson_t *document)
+{
+    bson_iter_t iter, child_iter, sqn_iter;
+    uint64_t record;
+    store_record_t *r = NULL;
+    ogs_dbi_record_t *decoded = NULL;
+    uint32_t record_length = 0;
+    char *key = NULL;
+
+    ogs_assert(document);
+    ogs_assert(self.base);
+
+    if (!bson_iter_init_find(&iter, document, "imsi") ||
+        !BSON_ITER_HOLDS_UTF8(&iter)) {
+        ogs_error("No 'imsi' field in this document");
+        return OGS_ERROR;
+    }
+
+    decoded = ogs_malloc(sizeof(*decoded));
+    ogs_assert(decoded);
+    if (ogs_dbi_record_build(decoded,
+                bson_get_data(document), document->len) == OGS_OK)
+        record_length = decoded->length;
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    record = store_alloc(sizeof(store_record_t) +
+            STORE_ALIGN(document->len) + record_length);
+    if (!record) {
+        ogs_thread_mutex_unlock(&self.mutex);
+        ogs_free(decoded);
+        return OGS_ERROR;
+    }
+
+    r = (store_record_t *)(self.base + record);
+    r->length = document->len;
+    memcpy(r + 1, bson_get_data(document), document->len);
+
+    r->record_length = record_length;
+    if (record_length)
+        ogs_dbi_record_copy(STORE_RECORD(r), decoded);
+
+    if (bson_iter_init(&child_iter, document) &&
+        bson_iter_find_descendant(&child_iter, "security.sqn", &sqn_iter) &&
+        BSON_ITER_HOLDS_INT64(&sqn_iter)) {
+        r->sqn = bson_iter_int64(&sqn_iter);
+        r->has_sqn = 1;
+    }
+
+    key = ogs_msprintf("%s-%s",
+            OGS_ID_SUPI_TYPE_IMSI, bson_iter_utf8(&iter, NULL));
+    ogs_assert(key);
+    if (key_set(key, record) == true)
+        header()->num_of_document++;
+    ogs_free(key);
+
+    if (bson_iter_init_find(&iter, document, "msisdn") &&
+        BSON_ITER_HOLDS_ARRAY(&iter)) {
+        bson_iter_recurse(&iter, &child_iter);
+        while (bson_iter_next(&child_iter)) {
+            if (!BSON_ITER_HOLDS_UTF8(&child_iter))
+                continue;
+
+            key = ogs_msprintf("msisdn-%s",
+                    bson_iter_utf8(&child_iter, NULL));
+            ogs_assert(key);
+            key_set(key, record);
+            ogs_free(key);
+        }
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    ogs_free(decoded);
+
+    return OGS_OK;
+}
+
+int ogs_dbi_store_count(void)
+{
+    ogs_assert(self.base);
+
+    return header()->num_of_document;
+}
+
+int ogs_dbi_store_import(const char *path)
+{
+    int rv = OGS_OK;
+    int64_t count = 0;
+    int skipped = 0, imported = 0;
+    char *tmp = NULL;
+    mongoc_collection_t *collection = NULL;
+    mongoc_cursor_t *cursor = NULL;
+    bson_t *query = NULL;
+    const bson_t *document = NULL;
+    bson_error_t error;
+
+    ogs_assert(path);
+
+    collection = ogs_mongoc()->collection.subscriber;
+    ogs_assert(collection);
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 11
+    count = mongoc_collection_estimated_document_count(
+            collection, NULL, NULL, NULL, &error);
+#else
+    count = mongoc_collection_count(
+            collection, MONGOC_QUERY_NONE, NULL, 0, 0, NULL, &error);
+#endif
+    if (count < 0) {
+        ogs_error("Cannot count subscribers: %s", error.message);
+        return OGS_ERROR;
+    }
+
+    /* Written aside and renamed, so that `path` is never half-written */
+    tmp = ogs_msprintf("%s.tmp", path);
+    ogs_assert(tmp);
+
+    rv = ogs_dbi_store_create(tmp, (int)count);
+    if (rv != OGS_OK) {
+        ogs_free(tmp);
+        return rv;
+    }
+
+    query = bson_new();
+    ogs_assert(query);
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
+    cursor = mongoc_collection_find_with_opts(collection, query, NULL, NULL);
+#else
+    cursor = mongoc_collection_find(collection,
+            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
+#endif
+    ogs_assert(cursor);
+
+    while (mongoc_cursor_next(cursor, &document)) {
+        if (ogs_dbi_store_put(document) != OGS_OK) {
+            skipped++;
+            continue;
+        }
+    }
+
+    if (mongoc_cursor_error(cursor, &error)) {
+        ogs_error("Cursor Failure: %s", error.message);
+        rv = OGS_ERROR;
+    }
+
+    mongoc_cursor_destroy(cursor);
+    bson_destroy(query);
+
+    imported = ogs_dbi_store_count();
+    ogs_dbi_store_close();
+
+    if (rv == OGS_OK && rename(tmp, path) != 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno,
+                "rename(%s, %s) failed", tmp, path);
+        rv = OGS_ERROR;
+    }
+    if (rv != OGS_OK)
+        unlink(tmp);
+
+    if (rv == OGS_OK)
+        ogs_info("%d subscribers imported to '%s' (%d skipped)",
+                imported, path, skipped);
+
+    ogs_free(tmp);
+
+    return rv;
+}
+
+static int store_map(int fd, size_t size)
+{
+    void *base;
+
+    base = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno, "mmap() failed");
+        return OGS_ERROR;
+    }
+
+    self.fd = fd;
+    self.base = base;
+    self.size = size;
+
+    ogs_thread_mutex_init(&self.mutex);
+
+    return OGS_OK;
+}
+
+/*
+ * Returns the offset of `size` bytes at the end of the store.
+ * The file may be remapped, so pointers into the store must be
+ * taken again after this call. Called with the mutex held.
+ */
+static uint64_t store_alloc(size_t size)
+{
+    uint64_t offset;
+    size_t new_size;
+    void *base;
+
+    size = STORE_ALIGN(size);
+
+    if (header()->used + size > self.size) {
+        new_size = self.size * 2;
+        while (header()->used + size > new_size)
+            new_size *= 2;
+
+        if (ftruncate(self.fd, new_size) != 0) {
+            ogs_log_message(OGS_LOG_ERROR, ogs_errno, "ftruncate() failed");
+            return 0;
+        }
+
+        base = mmap(NULL, new_size,
+                PROT_READ|PROT_WRITE, MAP_SHARED, self.fd, 0);
+        if (base == MAP_FAILED) {
+            ogs_log_message(OGS_LOG_ERROR, ogs_errno, "mmap() failed");
+            return 0;
+        }
+
+        munmap(self.base, self.size);
+        self.base = base;
+        self.size = new_size;
+    }
+
+    offset = header()->used;
+    header()->used += size;
+
+    return offset;
+}
+
+/* Checks the header and the bucket table of a file just mapped */
+static bool store_valid(void)
+{
+    uint32_t i, num_of_bucket;
+
+    if (memcmp(header()->magic, STORE_MAGIC, sizeof(header()->magic)) ||
+        header()->version != STORE_VERSION)
+        return false;
+
+    num_of_bucket = header()->num_of_bucket;
+    if (num_of_bucket < STORE_MIN_BUCKET ||
+        num_of_bucket > STORE_MAX_BUCKET ||
+        (num_of_bucket & (num_of_bucket - 1)))
+        return false;
+
+    if (data_offset() > header()->used || header()->used > self.size)
+        return false;
+
+    for (i = 0; i < num_of_bucket; i++) {
+        uint64_t offset = *bucket(i);
+        if (offset && !store_in_range(offset, sizeof(store_key_t)))
+            return false;
+    }
+
+    return true;
+}
+
+/* `len` bytes at `offset` lie within the keys and records in use */
+static bool store_in_range(uint64_t offset, uint64_t len)
+{
+    uint64_t used = header()->used;
+
+    return !(offset & 7) && offset >= data_offset() &&
+        used <= self.size && offset <= used && len <= used - offset;
+}
+
+/* Called with the mutex held */
+static uint64_t key_find(const char *key)
+{
+    uint32_t hash;
+    uint64_t offset, limit = UINT64_MAX;
+    store_key_t *k = NULL;
+
+    ogs_assert(key);
+
+    hash = hash_key(key);
+
+    for (offset = *bucket(hash); offset; offset = k->next) {
+        if (offset >= limit ||
+            !store_in_range(offset, sizeof(store_key_t))) {
+            ogs_error("Subscriber store is corrupted [key:%llu]",
+                    (unsigned long long)offset);
+            return 0;
+        }
+
+        k = (store_key_t *)(self.base + offset);
+        if (!k->len || !store_in_range(offset, sizeof(*k) + k->len) ||
+            ((char *)(k + 1))[k->len-1]) {
+            ogs_error("Subscriber store is corrupted [key:%llu]",
+                    (unsigned long long)offset);
+            return 0;
+        }
+
+        if (k->hash == hash && !strcmp((char *)(k + 1), key))
+            return offset;
+
+        limit = offset;
+    }
+
+    return 0;
+}
+
+/* Returns true if `key` is new. Called with the mutex held */
+static bool key_set(const char *key, uint64_t record)
+{
+    uint32_t hash;
+    uint32_t len;
+    uint64_t offset;
+    store_key_t *k = NULL;
+
+    ogs_assert(key);
+
+    offset = key_find(key);
+    if (offset) {
+        /* Re-imported : the previous record is left unused */
+        k = (store_key_t *)(self.base + offset);
+        k->record = record;
+        return false;
+    }
+
+    hash = hash_key(key);
+    len = strlen(key) + 1;
+
+    offset = store_alloc(sizeof(store_key_t) + len);
+    ogs_assert(offset);
+
+    k = (store_key_t *)(self.base + offset);
+    k->hash = hash;
+    k->len = len;
+    k->record = record;
+    memcpy(k + 1, key, len);
+
+    k->next = *bucket(hash);
+    *bucket(hash) = offset;
+
+    return true;
+}
+
+/* Called with the mutex held */
+static store_record_t *record_find(const char *key)
+{
+    uint64_t offset;
+    store_record_t *r = NULL;
+
+    offset = key_find(key);
+    if (!offset)
+        return NULL;
+
+    offset = ((store_key_t *)(self.base + offset))->record;
+    if (!store_in_range(offset, sizeof(store_record_t)))
+        goto corrupted;
+
+    r = (store_record_t *)(self.base + offset);
+    if (r->record_length > sizeof(ogs_dbi_record_t) ||
+        !store_in_range(offset, sizeof(*r) +
+            STORE_ALIGN(r->length) + r->record_length))
+        goto corrupted;
+
+    return r;
+
+corrupted:
+    ogs_error("Subscriber store is corrupted [record:%llu]",
+            (unsigned long long)offset);
+    return NULL;
+}
+
+/* Called with the mutex held */
+static bson_t *record_document(store_record_t *record)
+{
+    bson_t *document = NULL;
+    bson_iter_t iter, sqn_iter;
+
+    ogs_assert(record);
+
+    document = bson_new_from_data((const uint8_t *)(record + 1),
+            record->length);
+    if (!document) {
+        ogs_error("Invalid BSON document [length:%d]", record->length);
+        return NULL;
+    }
+
+    if (record->has_sqn && bson_iter_init(&iter, document) &&
+        bson_iter_find_descendant(&iter, "security.sqn", &sqn_iter) &&
+        BSON_ITER_HOLDS_INT64(&sqn_iter))
+        bson_iter_overwrite_int64(&sqn_iter,
+                __atomic_load_n(&record->sqn, __ATOMIC_ACQUIRE));
+
+    return document;
+}
+
+/*
+ * SQN may be advanced by another process at the same time,
+ * so the increment is a compare-and-swap on the mapping.
+ */
+static int record_set_sqn(store_record_t *record, bool increment, uint64_t sqn)
+{
+    uint64_t current;
+
+    ogs_assert(record);
+
+    if (!record->has_sqn) {
+        ogs_error("No 'security.sqn' field in this document");
+        return OGS_ERROR;
+    }
+
+    if (!increment) {
+        __atomic_store_n(&record->sqn, sqn, __ATOMIC_RELEASE);
+        return OGS_OK;
+    }
+
+    current = __atomic_load_n(&record->sqn, __ATOMIC_ACQUIRE);
+    while (!__atomic_compare_exchange_n(&record->sqn,
+                &current, (current + 32) & OGS_MAX_SQN,
+                false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        ;
+
+    return OGS_OK;
+}
+
+static bson_t *find_document(const char *key)
+{
+    bson_t *document = NULL;
+    store_record_t *r = NULL;
+
+    ogs_assert(key);
+    ogs_assert(self.base);
+
+    ogs_thread_mutex_lock(&self.mutex);
+    r = record_find(key);
+    if (r)
+        document = record_document(r);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return document;
+}
+
+static bson_t *find_subscriber(char *supi)
+{
+    ogs_assert(supi);
+
+    return find_document(supi);
+}
+
+static bson_t *find_msisdn(char *imsi_or_msisdn_bcd)
+{
+    bson_t *document = NULL;
+    char *key = NULL;
+
+    ogs_assert(imsi_or_msisdn_bcd);
+
+    key = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_or_msisdn_bcd);
+    ogs_assert(key);
+    document = find_document(key);
+    ogs_free(key);
+
+    if (document)
+        return document;
+
+    key = ogs_msprintf("msisdn-%s", imsi_or_msisdn_bcd);
+    ogs_assert(key);
+    document = find_document(key);
+    ogs_free(key);
+
+    return document;
+}
+
+static int find_record(char *supi, ogs_dbi_record_t *record)
+{
+    int rv = OGS_ERROR;
+    store_record_t *r = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(record);
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    r = record_find(supi);
+    if (!r) {
+        ogs_error("[%s] Cannot find IMSI in DB", supi);
+    } else if (!r->record_length) {
+        ogs_error("[%s] Invalid subscriber document", supi);
+    } else if (!ogs_dbi_record_valid(STORE_RECORD(r), r->record_length)) {
+        ogs_error("[%s] Subscriber store is corrupted", supi);
+    } else {
+        ogs_dbi_record_copy(record, STORE_RECORD(r));
+        rv = OGS_OK;
+    }
+
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return rv;
+}
+
+static int update_sqn(char *supi, uint64_t sqn)
+{
+    int rv = OGS_ERROR;
+    store_record_t *r = NULL;
+
+    ogs_assert(supi);
+
+    ogs_thread_mutex_lock(&self.mutex);
+    r = record_find(supi);
+    if (r)
+        rv = record_set_sqn(r, false, sqn);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return rv;
+}
+
+static int increment_sqn(char *supi)
+{
+    int rv = OGS_ERROR;
+    store_record_t *r = NULL;
+
+    ogs_assert(supi);
+
+    ogs_thread_mutex_lock(&self.mutex);
+    r = record_find(supi);
+    if (r)
+        rv = record_set_sqn(r, true, 0);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return rv;
+}
+
+static int update_imeisv(char *supi, char *imeisv)
+{
+    int rv = OGS_ERROR;
+    store_record_t *r = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(imeisv);
+
+    ogs_thread_mutex_lock(&self.mutex);
+
+    /* Other processes may write the same record */
+    if (flock(self.fd, LOCK_EX) != 0) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_errno, "flock() failed");
+        ogs_thread_mutex_unlock(&self.mutex);
+        return OGS_ERROR;
+    }
+
+    r = record_find(supi);
+    if (r) {
+        ogs_cpystrn(r->imeisv, imeisv, sizeof(r->imeisv));
+        rv = OGS_OK;
+    }
+
+    flock(self.fd, LOCK_UN);
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return rv;
+}
+
+const ogs_dbi_backend_t ogs_dbi_store_backend = {
+    "store",
+    find_subscriber,
+    find_msisdn,
+    update_sqn,
+    increment_sqn,
+    update_imeisv,
+    find_record,
+};
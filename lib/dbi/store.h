@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_STORE_H
+#define OGS_DBI_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Embedded subscriber store
+ *
+ * A single memory-mapped file holds the subscriber documents as BSON,
+ * indexed by SUPI ("imsi-001010000000001") and by MSISDN with a hash
+ * table. A lookup needs no network round trip.
+ *
+ * Each document is stored with its ogs_dbi_record_t, decoded at import.
+ * ogs_dbi_subscription_record() copies that record out of the mapping
+ * without parsing BSON or allocating. Document lookups such as
+ * ogs_dbi_auth_info() still return a heap copy of the BSON document.
+ *
+ * SQN and IMEISV are updated in place. Any other change requires
+ * importing the documents again from MongoDB :
+ *
+ *   $ open5gs-dbimport -d mongodb://localhost/open5gs \
+ *         -o /var/lib/open5gs/subscribers.db
+ *
+ * and then using the following in the NF configuration :
+ *
+ *   db_uri: file:///var/lib/open5gs/subscribers.db
+ *
+ * Every NF that opens the same file shares it. SQN is updated with
+ * 64-bit atomics and IMEISV under flock(), so several processes may
+ * write at the same time. The file must not be re-imported in place
+ * while any of them is running. The record layout depends on the build,
+ * so the file must be imported again after an upgrade.
+ */
+#define OGS_DBI_STORE_URI_PREFIX "file://"
+
+int ogs_dbi_store_create(const char *path, int max);
+int ogs_dbi_store_open(const char *path);
+void ogs_dbi_store_close(void);
+
+/* Keyed by 'imsi' and every 'msisdn' of the document */
+int ogs_dbi_store_put(const bson_t *document);
+
+int ogs_dbi_store_count(void);
+
+/* Copies the 'subscribers' collection of the MongoDB in use to `path` */
+int ogs_dbi_store_import(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_STORE_H */
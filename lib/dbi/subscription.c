@@ -22,50 +22,24 @@
 int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
 {
     int rv = OGS_OK;
-    mongoc_cursor_t *cursor = NULL;
-    bson_t *query = NULL;
-    bson_error_t error;
-    const bson_t *document;
+    bson_t *document = NULL;
     bson_iter_t iter;
     bson_iter_t inner_iter;
     char buf[OGS_KEY_LEN];
     char *utf8 = NULL;
     uint32_t length = 0;
 
-    char *supi_type = NULL;
-    char *supi_id = NULL;
-
     ogs_assert(supi);
     ogs_assert(auth_info);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
-#else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
-            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
-#endif
-
-    if (!mongoc_cursor_next(cursor, &document)) {
+    document = ogs_dbi_cache_lookup(supi);
+    if (!document) {
         ogs_info("[%s] Cannot find IMSI in DB", supi);
 
         rv = OGS_ERROR;
         goto out;
     }
 
-    if (mongoc_cursor_error(cursor, &error)) {
-        ogs_error("Cursor Failure: %s", error.message);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
-
     if (!bson_iter_init_find(&iter, document, "security")) {
         ogs_error("No 'security' field in this document");
 
@@ -99,146 +73,91 @@ int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
         }
     }
 
-out:
-    if (query) bson_destroy(query);
-    if (cursor) mongoc_cursor_destroy(cursor);
+    /* Not yet written by the SQN write-behind */
+    ogs_dbi_sqn_pending(supi, &auth_info->sqn);
 
-    ogs_free(supi_type);
-    ogs_free(supi_id);
+out:
+    if (document) bson_destroy(document);
 
     return rv;
 }
 
-int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
+static int set_sqn(char *supi, uint64_t sqn)
 {
-    int rv = OGS_OK;
-    bson_t *query = NULL;
-    bson_t *update = NULL;
-    bson_error_t error;
-
-    char *supi_type = NULL;
-    char *supi_id = NULL;
+    int rv;
 
     ogs_assert(supi);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-    update = BCON_NEW("$set",
-            "{",
-                "security.sqn", BCON_INT64(sqn),
-            "}");
-
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
-
-        rv = OGS_ERROR;
+    if (ogs_dbi_sqn_defer(supi, sqn)) {
+        ogs_dbi_cache_update_sqn(supi, sqn);
+        return OGS_OK;
     }
 
-    if (query) bson_destroy(query);
-    if (update) bson_destroy(update);
-
-    ogs_free(supi_type);
-    ogs_free(supi_id);
+    rv = ogs_dbi_backend()->update_sqn(supi, sqn);
+    if (rv == OGS_OK)
+        ogs_dbi_cache_update_sqn(supi, sqn);
+    else
+        ogs_dbi_cache_remove(supi);
 
     return rv;
 }
 
-int ogs_dbi_update_imeisv(char *supi, char *imeisv)
+int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
 {
-    int rv = OGS_OK;
-    bson_t *query = NULL;
-    bson_t *update = NULL;
-    bson_error_t error;
+    return set_sqn(supi, sqn);
+}
 
-    char *supi_type = NULL;
-    char *supi_id = NULL;
+int ogs_dbi_advance_sqn(char *supi, uint64_t sqn)
+{
+    /* Same result as ogs_dbi_update_sqn() + ogs_dbi_increment_sqn() */
+    return set_sqn(supi, (sqn + 32) & OGS_MAX_SQN);
+}
 
+int ogs_dbi_update_imeisv(char *supi, char *imeisv)
+{
     ogs_assert(supi);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
+    /*
+     * 'imeisv' is never read back through ogs_dbi_*(),
+     * so the cached document does not need to be touched.
+     */
+    return ogs_dbi_backend()->update_imeisv(supi, imeisv);
+}
 
-    ogs_debug("SUPI type: %s, SUPI id: %s, imeisv: %s",
-            supi_type, supi_id, imeisv);
+int ogs_dbi_increment_sqn(char *supi)
+{
+    int rv;
+    uint64_t sqn = 0;
 
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-    update = BCON_NEW("$set",
-            "{",
-                "imeisv", BCON_UTF8(imeisv),
-            "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_UPSERT, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
+    ogs_assert(supi);
 
-        rv = OGS_ERROR;
+    if (ogs_dbi_sqn_defer_increment(supi, &sqn)) {
+        ogs_dbi_cache_update_sqn(supi, sqn);
+        return OGS_OK;
     }
 
-    if (query) bson_destroy(query);
-    if (update) bson_destroy(update);
-
-    ogs_free(supi_type);
-    ogs_free(supi_id);
+    rv = ogs_dbi_backend()->increment_sqn(supi);
+    if (rv == OGS_OK)
+        ogs_dbi_cache_increment_sqn(supi);
+    else
+        ogs_dbi_cache_remove(supi);
 
     return rv;
 }
 
-int ogs_dbi_increment_sqn(char *supi)
+int ogs_dbi_subscription_record(char *supi, ogs_dbi_record_t *record)
 {
-    int rv = OGS_OK;
-    bson_t *query = NULL;
-    bson_t *update = NULL;
-    bson_error_t error;
-    uint64_t max_sqn = OGS_MAX_SQN;
-
-    char *supi_type = NULL;
-    char *supi_id = NULL;
+    int rv;
 
     ogs_assert(supi);
+    ogs_assert(record);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-    update = BCON_NEW("$inc",
-            "{",
-                "security.sqn", BCON_INT64(32),
-            "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
+    if (!ogs_dbi_backend()->find_record)
+        return ogs_dbi_cache_lookup_record(supi, record);
 
-        rv = OGS_ERROR;
-        goto out;
-    }
-    bson_destroy(update);
-
-    update = BCON_NEW("$bit",
-            "{",
-                "security.sqn", 
-                "{", "and", BCON_INT64(max_sqn), "}",
-            "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
-            MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
-        ogs_error("mongoc_collection_update() failure: %s", error.message);
-
-        rv = OGS_ERROR;
-    }
-
-out:
-    if (query) bson_destroy(query);
-    if (update) bson_destroy(update);
-
-    ogs_free(supi_type);
-    ogs_free(supi_id);
+    rv = ogs_dbi_backend()->find_record(supi, record);
+    if (rv == OGS_OK)
+        ogs_dbi_record_bind(record);
 
     return rv;
 }
@@ -246,19 +165,8 @@ out:
 int ogs_dbi_subscription_data(char *supi,
         ogs_subscription_data_t *subscription_data)
 {
-    int rv = OGS_OK;
-    mongoc_cursor_t *cursor = NULL;
-    bson_t *query = NULL;
-    bson_error_t error;
-    const bson_t *document;
-    bson_iter_t iter;
-    bson_iter_t child1_iter, child2_iter, child3_iter;
-    bson_iter_t child4_iter, child5_iter, child6_iter;
-    const char *utf8 = NULL;
-    uint32_t length = 0;
-
-    char *supi_type = NULL;
-    char *supi_id = NULL;
+    int rv, i, j;
+    ogs_dbi_record_t record;
 
     ogs_subscription_data_t zero_data;
 
@@ -270,394 +178,26 @@ int ogs_dbi_subscription_data(char *supi,
     /* subscription_data should be initialized to zero */
     ogs_assert(memcmp(subscription_data, &zero_data, sizeof(zero_data)) == 0);
 
-    supi_type = ogs_id_get_type(supi);
-    ogs_assert(supi_type);
-    supi_id = ogs_id_get_value(supi);
-    ogs_assert(supi_id);
-
-    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
-#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
-#else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
-            MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
-#endif
-
-    if (!mongoc_cursor_next(cursor, &document)) {
-        ogs_error("[%s] Cannot find IMSI in DB", supi);
-
-        rv = OGS_ERROR;
-        goto out;
-    }
+    rv = ogs_dbi_subscription_record(supi, &record);
+    if (rv != OGS_OK)
+        return rv;
 
-    if (mongoc_cursor_error(cursor, &error)) {
-        ogs_error("Cursor Failure: %s", error.message);
+    memcpy(subscription_data, &record.subscription_data,
+            sizeof(*subscription_data));
 
-        rv = OGS_ERROR;
-        goto out;
-    }
+    /* The caller owns the session names */
+    for (i = 0; i < subscription_data->num_of_slice; i++) {
+        ogs_slice_data_t *slice_data = &subscription_data->slice[i];
 
-    if (!bson_iter_init(&iter, document)) {
-        ogs_error("bson_iter_init failed in this document");
+        for (j = 0; j < slice_data->num_of_session; j++) {
+            ogs_session_t *session = &slice_data->session[j];
 
-        rv = OGS_ERROR;
-        goto out;
-    }
-
-    while (bson_iter_next(&iter)) {
-        const char *key = bson_iter_key(&iter);
-        if (!strcmp(key, "msisdn") &&
-            BSON_ITER_HOLDS_ARRAY(&iter)) {
-            int msisdn_index = 0;
-
-            bson_iter_recurse(&iter, &child1_iter);
-            while (bson_iter_next(&child1_iter)) {
-                ogs_assert(msisdn_index < OGS_MAX_NUM_OF_MSISDN);
-
-                if (BSON_ITER_HOLDS_UTF8(&child1_iter)) {
-                    utf8 = bson_iter_utf8(&child1_iter, &length);
-                    ogs_cpystrn(subscription_data->msisdn[msisdn_index].bcd,
-                            utf8, ogs_min(length, OGS_MAX_MSISDN_BCD_LEN)+1);
-                    ogs_bcd_to_buffer(
-                            subscription_data->msisdn[msisdn_index].bcd,
-                            subscription_data->msisdn[msisdn_index].buf,
-                            &subscription_data->msisdn[msisdn_index].len);
-
-                    msisdn_index++;
-                }
-            }
-            subscription_data->num_of_msisdn = msisdn_index;
-
-        } else if (!strcmp(key, "access_restriction_data") &&
-            BSON_ITER_HOLDS_INT32(&iter)) {
-            subscription_data->access_restriction_data =
-                bson_iter_int32(&iter);
-        } else if (!strcmp(key, "subscriber_status") &&
-            BSON_ITER_HOLDS_INT32(&iter)) {
-            subscription_data->subscriber_status =
-                bson_iter_int32(&iter);
-        } else if (!strcmp(key, "network_access_mode") &&
-            BSON_ITER_HOLDS_INT32(&iter)) {
-            subscription_data->network_access_mode =
-                bson_iter_int32(&iter);
-        } else if (!strcmp(key, "subscribed_rau_tau_timer") &&
-            BSON_ITER_HOLDS_INT32(&iter)) {
-            subscription_data->subscribed_rau_tau_timer =
-                bson_iter_int32(&iter);
-        } else if (!strcmp(key, "ambr") && BSON_ITER_HOLDS_DOCUMENT(&iter)) {
-            bson_iter_recurse(&iter, &child1_iter);
-            while (bson_iter_next(&child1_iter)) {
-                const char *child1_key = bson_iter_key(&child1_iter);
-                if (!strcmp(child1_key, "downlink") &&
-                        BSON_ITER_HOLDS_DOCUMENT(&child1_iter)) {
-                    uint8_t unit = 0;
-                    int n;
-
-                    bson_iter_recurse(&child1_iter, &child2_iter);
-                    while (bson_iter_next(&child2_iter)) {
-                        const char *child2_key = bson_iter_key(&child2_iter);
-                        if (!strcmp(child2_key, "value") &&
-                            BSON_ITER_HOLDS_INT32(&child2_iter)) {
-                            subscription_data->ambr.downlink =
-                                bson_iter_int32(&child2_iter);
-                        } else if (!strcmp(child2_key, "unit") &&
-                            BSON_ITER_HOLDS_INT32(&child2_iter)) {
-                            unit = bson_iter_int32(&child2_iter);
-                        }
-                    }
-
-                    for (n = 0; n < unit; n++)
-                        subscription_data->ambr.downlink *= 1024;
-                } else if (!strcmp(child1_key, "uplink") &&
-                        BSON_ITER_HOLDS_DOCUMENT(&child1_iter)) {
-                    uint8_t unit = 0;
-                    int n;
-
-                    bson_iter_recurse(&child1_iter, &child2_iter);
-                    while (bson_iter_next(&child2_iter)) {
-                        const char *child2_key = bson_iter_key(&child2_iter);
-                        if (!strcmp(child2_key, "value") &&
-                            BSON_ITER_HOLDS_INT32(&child2_iter)) {
-                            subscription_data->ambr.uplink =
-                                bson_iter_int32(&child2_iter);
-                        } else if (!strcmp(child2_key, "unit") &&
-                            BSON_ITER_HOLDS_INT32(&child2_iter)) {
-                            unit = bson_iter_int32(&child2_iter);
-                        }
-                    }
-
-                    for (n = 0; n < unit; n++)
-                        subscription_data->ambr.uplink *= 1024;
-                }
-
-            }
-        } else if (!strcmp(key, "slice") && BSON_ITER_HOLDS_ARRAY(&iter)) {
-
-            bson_iter_recurse(&iter, &child1_iter);
-            while (bson_iter_next(&child1_iter)) {
-                ogs_slice_data_t *slice_data = NULL;
-
-                ogs_assert(
-                        subscription_data->num_of_slice < OGS_MAX_NUM_OF_SLICE);
-
-                slice_data = &subscription_data->slice[
-                                subscription_data->num_of_slice];
-
-                slice_data->s_nssai.sst = 0;
-                slice_data->s_nssai.sd.v = OGS_S_NSSAI_NO_SD_VALUE;
-
-                bson_iter_recurse(&child1_iter, &child2_iter);
-                while (bson_iter_next(&child2_iter)) {
-                    const char *child2_key = bson_iter_key(&child2_iter);
-
-                    if (!strcmp(child2_key, "sst") &&
-                        BSON_ITER_HOLDS_INT32(&child2_iter)) {
-                        slice_data->s_nssai.sst = bson_iter_int32(&child2_iter);
-                    } else if (!strcmp(child2_key, "sd") &&
-                        BSON_ITER_HOLDS_UTF8(&child2_iter)) {
-                        utf8 = bson_iter_utf8(&child2_iter, &length);
-                        ogs_assert(utf8);
-                        slice_data->s_nssai.sd =
-                            ogs_s_nssai_sd_from_string(utf8);
-                    } else if (!strcmp(child2_key, "default_indicator") &&
-                        BSON_ITER_HOLDS_BOOL(&child2_iter)) {
-                        slice_data->default_indicator =
-                            bson_iter_bool(&child2_iter);
-                    } else if (!strcmp(child2_key, "session") &&
-                        BSON_ITER_HOLDS_ARRAY(&child2_iter)) {
-
-                        bson_iter_recurse(&child2_iter, &child3_iter);
-                        while (bson_iter_next(&child3_iter)) {
-                            ogs_session_t *session = NULL;
-
-                            ogs_assert(
-                                slice_data->num_of_session <
-                                    OGS_MAX_NUM_OF_SESS);
-                            session = &slice_data->session
-                                [slice_data->num_of_session];
-
-                            bson_iter_recurse(&child3_iter, &child4_iter);
-                            while (bson_iter_next(&child4_iter)) {
-                                const char *child4_key =
-                                    bson_iter_key(&child4_iter);
-                                if (!strcmp(child4_key, "name") &&
-                                    BSON_ITER_HOLDS_UTF8(&child4_iter)) {
-                                    utf8 = bson_iter_utf8(
-                                            &child4_iter, &length);
-                                    session->name = ogs_strndup(utf8, length);
-                                    ogs_assert(session->name);
-                                } else if (!strcmp(child4_key, "type") &&
-                                    BSON_ITER_HOLDS_INT32(&child4_iter)) {
-                                    session->session_type =
-                                        bson_iter_int32(&child4_iter);
-                                } else if (!strcmp(child4_key, "qos") &&
-                                    BSON_ITER_HOLDS_DOCUMENT(&child4_iter)) {
-                                    bson_iter_recurse(
-                                            &child4_iter, &child5_iter);
-                                    while (bson_iter_next(&child5_iter)) {
-                                        const char *child5_key =
-                                            bson_iter_key(&child5_iter);
-                                        if (!strcmp(child5_key, "index") &&
-                                            BSON_ITER_HOLDS_INT32(
-                                                &child5_iter)) {
-                                            session->qos.index =
-                                                bson_iter_int32(&child5_iter);
-                                        } else if (!strcmp(child5_key, "arp") &&
-                                            BSON_ITER_HOLDS_DOCUMENT(
-                                                &child5_iter)) {
-                                            bson_iter_recurse(
-                                                    &child5_iter, &child6_iter);
-                                            while (bson_iter_next(
-                                                        &child6_iter)) {
-                                                const char *child6_key =
-                                                    bson_iter_key(&child6_iter);
-                                                if (!strcmp(child6_key,
-                                                            "priority_level") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    session->qos.arp.
-                                                        priority_level =
-                                                        bson_iter_int32(
-                                                                &child6_iter);
-                                                } else if (!strcmp(child6_key,
-                                                    "pre_emption_capability") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    session->qos.arp.
-                                                        pre_emption_capability =
-                                                            bson_iter_int32(
-                                                                &child6_iter);
-                                                } else if (!strcmp(child6_key,
-                                                "pre_emption_vulnerability") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    session->qos.arp.
-                                                    pre_emption_vulnerability =
-                                                        bson_iter_int32(
-                                                                &child6_iter);
-                                                }
-                                            }
-                                        }
-                                    }
-                                } else if (!strcmp(child4_key, "ambr") &&
-                                    BSON_ITER_HOLDS_DOCUMENT(&child4_iter)) {
-                                    bson_iter_recurse(
-                                            &child4_iter, &child5_iter);
-
-                                    while (bson_iter_next(&child5_iter)) {
-                                        const char *child5_key =
-                                            bson_iter_key(&child5_iter);
-                                        if (!strcmp(child5_key, "downlink") &&
-                                                BSON_ITER_HOLDS_DOCUMENT(
-                                                    &child5_iter)) {
-                                            uint8_t unit = 0;
-                                            int n;
-
-                                            bson_iter_recurse(
-                                                    &child5_iter, &child6_iter);
-                                            while (bson_iter_next(
-                                                        &child6_iter)) {
-                                                const char *child6_key =
-                                                    bson_iter_key(&child6_iter);
-                                                if (!strcmp(child6_key,
-                                                            "value") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    session->ambr.downlink =
-                                                        bson_iter_int32(
-                                                                &child6_iter);
-                                                } else if (!strcmp(child6_key,
-                                                            "unit") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    unit = bson_iter_int32(
-                                                            &child6_iter);
-                                                }
-                                            }
-
-                                            for (n = 0; n < unit; n++)
-                                                session->ambr.downlink *= 1024;
-                                        } else if (!strcmp(child5_key,
-                                                    "uplink") &&
-                                                BSON_ITER_HOLDS_DOCUMENT(
-                                                    &child5_iter)) {
-                                            uint8_t unit = 0;
-                                            int n;
-
-                                            bson_iter_recurse(
-                                                    &child5_iter, &child6_iter);
-                                            while (bson_iter_next(
-                                                        &child6_iter)) {
-                                                const char *child6_key =
-                                                    bson_iter_key(&child6_iter);
-                                                if (!strcmp(child6_key,
-                                                            "value") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    session->ambr.uplink =
-                                                        bson_iter_int32(
-                                                                &child6_iter);
-                                                } else if (!strcmp(child6_key,
-                                                            "unit") &&
-                                                    BSON_ITER_HOLDS_INT32(
-                                                        &child6_iter)) {
-                                                    unit = bson_iter_int32(
-                                                            &child6_iter);
-                                                }
-                                            }
-
-                                            for (n = 0; n < unit; n++)
-                                                session->ambr.uplink *= 1024;
-                                        }
-                                    }
-                                } else if (!strcmp(child4_key, "smf") &&
-                                    BSON_ITER_HOLDS_DOCUMENT(&child4_iter)) {
-                                    bson_iter_recurse(
-                                            &child4_iter, &child5_iter);
-                                    while (bson_iter_next(&child5_iter)) {
-                                        const char *child5_key =
-                                            bson_iter_key(&child5_iter);
-                                        if (!strcmp(child5_key, "addr") &&
-                                            BSON_ITER_HOLDS_UTF8(
-                                                &child5_iter)) {
-                                            ogs_ipsubnet_t ipsub;
-                                            const char *v = bson_iter_utf8(
-                                                    &child5_iter, &length);
-                                            rv = ogs_ipsubnet(&ipsub, v, NULL);
-                                            if (rv == OGS_OK) {
-                                                session->smf_ip.ipv4 = 1;
-                                                session->smf_ip.addr =
-                                                    ipsub.sub[0];
-                                            }
-                                        } else if (!strcmp(
-                                                    child5_key, "addr6") &&
-                                            BSON_ITER_HOLDS_UTF8(
-                                                &child5_iter)) {
-                                            ogs_ipsubnet_t ipsub;
-                                            const char *v = bson_iter_utf8(
-                                                    &child5_iter, &length);
-                                            rv = ogs_ipsubnet(&ipsub, v, NULL);
-                                            if (rv == OGS_OK) {
-                                                session->smf_ip.ipv6 = 1;
-                                                memcpy(session->smf_ip.addr6,
-                                                        ipsub.sub,
-                                                        sizeof(ipsub.sub));
-                                            }
-                                        }
-                                    }
-                                } else if (!strcmp(child4_key, "ue") &&
-                                    BSON_ITER_HOLDS_DOCUMENT(&child4_iter)) {
-                                    bson_iter_recurse(
-                                            &child4_iter, &child5_iter);
-                                    while (bson_iter_next(&child5_iter)) {
-                                        const char *child5_key =
-                                            bson_iter_key(&child5_iter);
-                                        if (!strcmp(child5_key, "addr") &&
-                                            BSON_ITER_HOLDS_UTF8(
-                                                &child5_iter)) {
-                                            ogs_ipsubnet_t ipsub;
-                                            const char *v = bson_iter_utf8(
-                                                    &child5_iter, &length);
-                                            rv = ogs_ipsubnet(&ipsub, v, NULL);
-                                            if (rv == OGS_OK) {
-                                                session->ue_ip.ipv4 = true;
-                                                session->ue_ip.addr =
-                                                    ipsub.sub[0];
-                                            }
-                                        } else if (!strcmp(
-                                                    child5_key, "addr6") &&
-                                            BSON_ITER_HOLDS_UTF8(
-                                                &child5_iter)) {
-                                            ogs_ipsubnet_t ipsub;
-                                            const char *v = bson_iter_utf8(
-                                                    &child5_iter, &length);
-                                            rv = ogs_ipsubnet(&ipsub, v, NULL);
-                                            if (rv == OGS_OK) {
-                                                session->ue_ip.ipv6 = true;
-                                                memcpy(session->ue_ip.addr6,
-                                                    ipsub.sub, OGS_IPV6_LEN);
-                                            }
-
-                                        }
-                                    }
-                                }
-                            }
-                            slice_data->num_of_session++;
-                        }
-                    }
-                }
-                subscription_data->num_of_slice++;
+            if (session->name) {
+                session->name = ogs_strdup(session->name);
+                ogs_assert(session->name);
             }
         }
     }
 
-out:
-    if (query) bson_destroy(query);
-    if (cursor) mongoc_cursor_destroy(cursor);
-
-    ogs_free(supi_type);
-    ogs_free(supi_id);
-
-    return rv;
+    return OGS_OK;
 }
@@ -41,8 +41,18 @@ typedef struct ogs_dbi_auth_info_s {
 int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info);
 int ogs_dbi_update_sqn(char *supi, uint64_t sqn);
 int ogs_dbi_increment_sqn(char *supi);
+/* Sets 'security.sqn' to (sqn + 32) with a single write */
+int ogs_dbi_advance_sqn(char *supi, uint64_t sqn);
 int ogs_dbi_update_imeisv(char *supi, char *imeisv);
 
+/*
+ * Copies the decoded subscription data of the subscriber into `record`
+ * and binds it. Nothing is allocated, so there is nothing to free.
+ */
+int ogs_dbi_subscription_record(char *supi, ogs_dbi_record_t *record);
+
+/* Same, but session names are allocated and must be freed with
+ * ogs_subscription_data_free() */
 int ogs_dbi_subscription_data(char *supi,
         ogs_subscription_data_t *subscription_data);
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+static struct {
+    bool initialized;
+
+    ogs_time_t timeout;
+    ogs_dbi_job_handler_t complete;
+
+    ogs_queue_t *queue;
+
+    int num_of_worker;
+    ogs_thread_t *thread[OGS_DBI_MAX_NUM_OF_WORKER];
+} self;
+
+static void worker_main(void *data);
+
+int ogs_dbi_worker_init(int num_of_worker, int max_job, ogs_time_t timeout,
+        ogs_dbi_job_handler_t complete)
+{
+    int i;
+
+    ogs_assert(complete);
+    ogs_assert(max_job > 0);
+
+    memset(&self, 0, sizeof(self));
+
+    self.timeout = timeout;
+    self.complete = complete;
+
+    if (num_of_worker <= 0)
+        return OGS_OK;
+
+    if (num_of_worker > OGS_DBI_MAX_NUM_OF_WORKER) {
+        ogs_warn("Too many DB workers [%d>%d]",
+                num_of_worker, OGS_DBI_MAX_NUM_OF_WORKER);
+        num_of_worker = OGS_DBI_MAX_NUM_OF_WORKER;
+    }
+
+    self.queue = ogs_queue_create(max_job);
+    ogs_assert(self.queue);
+
+    for (i = 0; i < num_of_worker; i++) {
+        self.thread[i] = ogs_thread_create(worker_main, NULL);
+        ogs_assert(self.thread[i]);
+    }
+    self.num_of_worker = num_of_worker;
+
+    self.initialized = true;
+
+    ogs_info("DB workers [num:%d, max:%d, timeout:%lld ms]",
+            num_of_worker, max_job, (long long)ogs_time_to_msec(timeout));
+
+    return OGS_OK;
+}
+
+void ogs_dbi_worker_final(void)
+{
+    int i;
+
+    if (!self.initialized)
+        return;
+
+    /* Pending jobs are dropped. Their owner releases them */
+    ogs_queue_term(self.queue);
+
+    for (i = 0; i < self.num_of_worker; i++)
+        ogs_thread_destroy(self.thread[i]);
+
+    ogs_queue_destroy(self.queue);
+
+    self.initialized = false;
+}
+
+int ogs_dbi_worker_submit(ogs_dbi_job_t *job)
+{
+    int rv;
+
+    ogs_assert(job);
+    ogs_assert(job->run);
+
+    job->rv = OGS_ERROR;
+
+    if (!self.initialized) {
+        /* No worker : run it in the caller's thread */
+        ogs_assert(self.complete);
+        job->run(job);
+        self.complete(job);
+        return OGS_OK;
+    }
+
+    job->deadline = 0;
+    if (self.timeout)
+        job->deadline = ogs_get_monotonic_time() + self.timeout;
+
+    rv = ogs_queue_trypush(self.queue, job);
+    if (rv != OGS_OK) {
+        ogs_warn("DB worker queue is full [%d]", rv);
+        return OGS_RETRY;
+    }
+
+    return OGS_OK;
+}
+
+static void worker_main(void *data)
+{
+    ogs_dbi_job_t *job = NULL;
+    int rv;
+
+    rv = ogs_dbi_thread_init(self.timeout);
+    ogs_assert(rv == OGS_OK);
+
+    for ( ;; ) {
+        rv = ogs_queue_pop(self.queue, (void **)&job);
+        if (rv == OGS_DONE)
+            break;
+        if (rv != OGS_OK)
+            continue;
+
+        ogs_assert(job);
+
+        if (job->deadline && ogs_get_monotonic_time() > job->deadline) {
+            job->rv = OGS_TIMEUP;
+        } else {
+            job->run(job);
+        }
+
+        self.complete(job);
+    }
+
+    ogs_dbi_thread_final();
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_WORKER_H
+#define OGS_DBI_WORKER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OGS_DBI_MAX_NUM_OF_WORKER 64
+
+/*
+ * A job is owned by the caller. It is usually embedded in an NF-specific
+ * transaction that keeps the SBI stream until the response is sent.
+ *
+ * - run()      : called in a worker thread. It sets job->rv.
+ * - complete() : called in the worker thread right after run().
+ *                It should only post an event to the main event loop.
+ *
+ * With no worker, run() and complete() are called from
+ * ogs_dbi_worker_submit() itself.
+ *
+ * A job that waited longer than the timeout in the queue is completed
+ * with job->rv = OGS_TIMEUP without calling run().
+ */
+typedef struct ogs_dbi_job_s ogs_dbi_job_t;
+typedef void (*ogs_dbi_job_handler_t)(ogs_dbi_job_t *job);
+
+struct ogs_dbi_job_s {
+    ogs_dbi_job_handler_t run;
+    int rv;
+
+    ogs_time_t deadline;
+
+    void *data;
+};
+
+int ogs_dbi_worker_init(int num_of_worker, int max_job, ogs_time_t timeout,
+        ogs_dbi_job_handler_t complete);
+void ogs_dbi_worker_final(void);
+
+int ogs_dbi_worker_submit(ogs_dbi_job_t *job);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_WORKER_H */
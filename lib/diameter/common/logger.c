@@ -27,6 +27,35 @@ static pthread_t fd_stats_th = (pthread_t)NULL;
 
 static ogs_diam_logger_user_handler user_handler = NULL;
 
+/*
+ * Counters per application, command and peer live in a fixed open
+ * addressing table. A slot is only ever filled, under stats_mtx, and
+ * is published with a release store, so lookups never lock. When the
+ * table is full, only the totals in self.stats are kept.
+ */
+#define MAX_NUM_OF_STATS_KEY 256
+
+typedef enum {
+    STATS_SENT = 0,
+    STATS_ANSWERED,
+    STATS_RECEIVED,
+    STATS_ERRORS,
+    STATS_RTT,
+    MAX_NUM_OF_STATS,
+} stats_type_e;
+
+typedef struct stats_key_s {
+    uint32_t app;
+    uint32_t cmd;
+    char *peer; /* NULL for the requests we send */
+
+    ogs_metrics_inst_t *inst[MAX_NUM_OF_STATS];
+} stats_key_t;
+
+static ogs_metrics_spec_t *stats_spec[MAX_NUM_OF_STATS];
+static stats_key_t *stats_table[MAX_NUM_OF_STATS_KEY];
+static pthread_mutex_t stats_mtx = PTHREAD_MUTEX_INITIALIZER;
+
 static void ogs_diam_logger_cb(enum fd_hook_type type, struct msg * msg, 
     struct peer_hdr * peer, void * other, struct fd_hook_permsgdata *pmd, 
     void * regdata);
@@ -44,15 +73,25 @@ int ogs_diam_logger_init(int mode)
     CHECK_FCT( fd_hook_register( 
             mask_peers, ogs_diam_logger_cb, NULL, NULL, &logger_hdl) );
 
-	CHECK_POSIX( pthread_mutex_init(&self.stats_lock, NULL) );
-
 	return 0;
 }
 
 void ogs_diam_logger_final()
 {
+    int i;
+
 	CHECK_FCT_DO( fd_thr_term(&fd_stats_th), );
-	CHECK_POSIX_DO( pthread_mutex_destroy(&self.stats_lock), );
+
+    /* The metrics instances go away with their specs */
+    for (i = 0; i < MAX_NUM_OF_STATS_KEY; i++) {
+        if (stats_table[i]) {
+            if (stats_table[i]->peer)
+                ogs_free(stats_table[i]->peer);
+            ogs_free(stats_table[i]);
+            stats_table[i] = NULL;
+        }
+    }
+    memset(stats_spec, 0, sizeof(stats_spec));
 
 	if (logger_hdl) { CHECK_FCT_DO( fd_hook_unregister( logger_hdl ), ); }
 }
@@ -70,6 +109,203 @@ int ogs_diam_logger_stats_start()
     return 0;
 }
 
+void ogs_diam_logger_metrics_open(void)
+{
+    const char *labels[] = { "application", "command", "peer" };
+
+    stats_spec[STATS_SENT] = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_COUNTER, "diameter_requests_sent",
+            "Diameter requests sent", 0, 2, labels);
+    stats_spec[STATS_ANSWERED] = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_COUNTER, "diameter_requests_answered",
+            "Diameter requests received and answered", 0, 3, labels);
+    stats_spec[STATS_RECEIVED] = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_COUNTER, "diameter_answers_received",
+            "Diameter answers received", 0, 3, labels);
+    stats_spec[STATS_ERRORS] = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_COUNTER, "diameter_answers_failed",
+            "Diameter answers received with an error", 0, 3, labels);
+    stats_spec[STATS_RTT] = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_HISTOGRAM, "diameter_rtt_microseconds",
+            "Diameter request round-trip time", 0, 3, labels);
+}
+
+static const char *application_name(uint32_t app, char *buf, size_t len)
+{
+    switch (app) {
+    case 0: return "base";
+    case 4: return "gy";
+    case 16777216: return "cx";
+    case 16777236: return "rx";
+    case 16777238: return "gx";
+    case 16777251: return "s6a";
+    case 16777265: return "swx";
+    case 16777272: return "s6b";
+    default:
+        ogs_snprintf(buf, len, "%u", app);
+        return buf;
+    }
+}
+
+static bool stats_key_match(stats_key_t *key,
+        uint32_t app, uint32_t cmd, const char *peer, size_t peerlen)
+{
+    if (key->app != app || key->cmd != cmd)
+        return false;
+    if (!peer || !key->peer)
+        return !peer && !key->peer;
+
+    return strlen(key->peer) == peerlen &&
+        memcmp(key->peer, peer, peerlen) == 0;
+}
+
+static stats_key_t *stats_key_lookup(uint32_t app, uint32_t cmd,
+        const char *peer, size_t peerlen, bool create)
+{
+    uint32_t hash = app * 31 + cmd;
+    stats_key_t *key = NULL;
+    size_t i, n;
+
+    for (i = 0; peer && i < peerlen; i++)
+        hash = hash * 31 + (uint8_t)peer[i];
+
+    for (n = 0, i = hash % MAX_NUM_OF_STATS_KEY; n < MAX_NUM_OF_STATS_KEY;
+            n++, i = (i + 1) % MAX_NUM_OF_STATS_KEY) {
+        key = __atomic_load_n(&stats_table[i], __ATOMIC_ACQUIRE);
+        if (!key)
+            break;
+        if (stats_key_match(key, app, cmd, peer, peerlen))
+            return key;
+    }
+
+    if (!create || n == MAX_NUM_OF_STATS_KEY)
+        return NULL;
+
+    key = ogs_calloc(1, sizeof(*key));
+    ogs_assert(key);
+    key->app = app;
+    key->cmd = cmd;
+    if (peer) {
+        key->peer = ogs_strndup(peer, peerlen);
+        ogs_assert(key->peer);
+    }
+    __atomic_store_n(&stats_table[i], key, __ATOMIC_RELEASE);
+
+    return key;
+}
+
+static ogs_metrics_inst_t *stats_inst(
+        struct msg *msg, bool with_peer, stats_type_e type)
+{
+    struct msg_hdr *hdr = NULL;
+    DiamId_t peer = NULL;
+    size_t peerlen = 0;
+    stats_key_t *key = NULL;
+    ogs_metrics_inst_t *inst = NULL;
+
+    if (!stats_spec[type])
+        return NULL;
+
+    if (!msg || fd_msg_hdr(msg, &hdr) != 0)
+        return NULL;
+    if (with_peer) {
+        if (fd_msg_source_get(msg, &peer, &peerlen) != 0 || !peer) {
+            peer = (DiamId_t)"unknown";
+            peerlen = strlen(peer);
+        }
+    }
+
+    key = stats_key_lookup(hdr->msg_appl, hdr->msg_code, peer, peerlen, false);
+    if (key) {
+        inst = __atomic_load_n(&key->inst[type], __ATOMIC_ACQUIRE);
+        if (inst)
+            return inst;
+    }
+
+    CHECK_POSIX_DO( pthread_mutex_lock(&stats_mtx), );
+
+    if (!key)
+        key = stats_key_lookup(
+                hdr->msg_appl, hdr->msg_code, peer, peerlen, true);
+
+    if (key && !key->inst[type]) {
+        char app[16], cmd[16];
+        const char *values[3];
+
+        values[0] = application_name(key->app, app, sizeof(app));
+        ogs_snprintf(cmd, sizeof(cmd), "%u", key->cmd);
+        values[1] = cmd;
+        values[2] = key->peer;
+
+        __atomic_store_n(&key->inst[type],
+                ogs_metrics_inst_new(stats_spec[type],
+                    key->peer ? 3 : 2, values), __ATOMIC_RELEASE);
+    }
+    if (key)
+        inst = key->inst[type];
+
+    CHECK_POSIX_DO( pthread_mutex_unlock(&stats_mtx), );
+
+    return inst;
+}
+
+void ogs_diam_logger_stats_sent(struct msg *req)
+{
+    ogs_metrics_inst_t *inst = NULL;
+
+    __atomic_fetch_add(&self.stats.nb_sent, 1, __ATOMIC_RELAXED);
+
+    inst = stats_inst(req, false, STATS_SENT);
+    if (inst)
+        ogs_metrics_inst_inc(inst);
+}
+
+void ogs_diam_logger_stats_answered(struct msg *ans)
+{
+    struct msg *qry = NULL;
+    ogs_metrics_inst_t *inst = NULL;
+
+    __atomic_fetch_add(&self.stats.nb_echoed, 1, __ATOMIC_RELAXED);
+
+    /* The peer is the one the request came from */
+    if (fd_msg_answ_getq(ans, &qry) != 0)
+        return;
+
+    inst = stats_inst(qry, true, STATS_ANSWERED);
+    if (inst)
+        ogs_metrics_inst_inc(inst);
+}
+
+void ogs_diam_logger_stats_received(
+        struct msg *ans, unsigned long dur, bool error)
+{
+    unsigned long cur;
+    ogs_metrics_inst_t *inst = NULL;
+
+    if (error)
+        __atomic_fetch_add(&self.stats.nb_errs, 1, __ATOMIC_RELAXED);
+    else
+        __atomic_fetch_add(&self.stats.nb_recv, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&self.stats.total, dur, __ATOMIC_RELAXED);
+
+    /* Zero means no answer yet */
+    cur = __atomic_load_n(&self.stats.shortest, __ATOMIC_RELAXED);
+    while ((cur == 0 || dur < cur) &&
+            !__atomic_compare_exchange_n(&self.stats.shortest, &cur, dur,
+                true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    cur = __atomic_load_n(&self.stats.longest, __ATOMIC_RELAXED);
+    while (dur > cur &&
+            !__atomic_compare_exchange_n(&self.stats.longest, &cur, dur,
+                true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    inst = stats_inst(ans, true, error ? STATS_ERRORS : STATS_RECEIVED);
+    if (inst)
+        ogs_metrics_inst_inc(inst);
+    inst = stats_inst(ans, true, STATS_RTT);
+    if (inst)
+        ogs_metrics_inst_observe(inst, dur);
+}
+
 void ogs_diam_logger_register(ogs_diam_logger_user_handler instance)
 {
     user_handler = instance;
@@ -121,6 +357,7 @@ static void * diam_stats_worker(void * arg)
 {
 	struct timespec start, now;
 	struct fd_stats copy;
+    unsigned long long nb_answer;
 	
 	/* Get the start time */
 	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &start), );
@@ -131,9 +368,16 @@ static void * diam_stats_worker(void * arg)
 		sleep(self.duration);
 		
 		/* Now, get the current stats */
-		CHECK_POSIX_DO( pthread_mutex_lock(&self.stats_lock), );
-		memcpy(&copy, &self.stats, sizeof(struct fd_stats));
-		CHECK_POSIX_DO( pthread_mutex_unlock(&self.stats_lock), );
+        copy.nb_echoed = __atomic_load_n(&self.stats.nb_echoed,
+                __ATOMIC_RELAXED);
+        copy.nb_sent = __atomic_load_n(&self.stats.nb_sent, __ATOMIC_RELAXED);
+        copy.nb_recv = __atomic_load_n(&self.stats.nb_recv, __ATOMIC_RELAXED);
+        copy.nb_errs = __atomic_load_n(&self.stats.nb_errs, __ATOMIC_RELAXED);
+        copy.shortest = __atomic_load_n(&self.stats.shortest,
+                __ATOMIC_RELAXED);
+        copy.longest = __atomic_load_n(&self.stats.longest, __ATOMIC_RELAXED);
+        copy.total = __atomic_load_n(&self.stats.total, __ATOMIC_RELAXED);
+        nb_answer = copy.nb_recv + copy.nb_errs;
 		
 		/* Get the current execution time */
 		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), );
@@ -166,8 +410,9 @@ static void * diam_stats_worker(void * arg)
                     copy.shortest / 1000000, copy.shortest % 1000000);
             ogs_trace("     slowest: %ld.%06ld sec.", 
                     copy.longest / 1000000, copy.longest % 1000000);
-            ogs_trace("     Average: %ld.%06ld sec.", 
-                    copy.avg / 1000000, copy.avg % 1000000);
+            ogs_trace("     Average: %lld.%06lld sec.",
+                    nb_answer ? (copy.total / nb_answer) / 1000000 : 0,
+                    nb_answer ? (copy.total / nb_answer) % 1000000 : 0);
         }
 		ogs_trace("-------------------------------------");
 	}
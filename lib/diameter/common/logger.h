@@ -35,6 +35,8 @@ struct ogs_diam_logger_t {
     int mode;        /* default FD_MODE_SERVER | FD_MODE_CLIENT */
     
     int duration; /* default 10 */
+
+    /* Totals for the log, only updated with atomic operations */
     struct fd_stats {
         unsigned long long nb_echoed; /* server */
         unsigned long long nb_sent;   /* client */
@@ -42,10 +44,8 @@ struct ogs_diam_logger_t {
         unsigned long long nb_errs;   /* client */
         unsigned long shortest;  /* fastest answer, in microseconds */
         unsigned long longest;   /* slowest answer, in microseconds */
-        unsigned long avg;       /* average answer time, in microseconds */
+        unsigned long long total; /* sum of answer times, in microseconds */
     } stats;
-
-    pthread_mutex_t stats_lock;
 };
 
 int ogs_diam_logger_init(int mode);
@@ -55,6 +55,24 @@ struct ogs_diam_logger_t* ogs_diam_logger_self(void);
 
 int ogs_diam_logger_stats_start(void);
 
+/*
+ * Per application, command and peer statistics. They may be called
+ * from any freeDiameter thread and take no lock once the counters
+ * for a key exist.
+ *
+ * ogs_diam_logger_metrics_open() exports them through lib/metrics;
+ * without it only the totals above are kept.
+ */
+void ogs_diam_logger_metrics_open(void);
+
+/* Call before fd_msg_send(), which takes the message */
+void ogs_diam_logger_stats_sent(struct msg *req);
+void ogs_diam_logger_stats_answered(struct msg *ans);
+
+/* dur is the time since the request was sent, in microseconds */
+void ogs_diam_logger_stats_received(
+        struct msg *ans, unsigned long dur, bool error);
+
 typedef void (*ogs_diam_logger_user_handler)(
     enum fd_hook_type type, struct msg *msg, struct peer_hdr *peer, 
     void *other, struct fd_hook_permsgdata *pmd, void *regdata);
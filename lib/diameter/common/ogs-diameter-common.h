@@ -38,6 +38,7 @@
 #endif
 
 #include "proto/ogs-proto.h"
+#include "metrics/ogs-metrics.h"
 
 #define OGS_DIAMETER_INSIDE
 
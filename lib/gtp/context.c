@@ -547,6 +547,9 @@ void ogs_gtp_node_free(ogs_gtp_node_t *node)
 
     ogs_gtp_xact_delete_all(node);
 
+    if (node->metrics_rtt)
+        ogs_metrics_inst_free(node->metrics_rtt);
+
     ogs_freeaddrinfo(node->sa_list);
     ogs_pool_free(&pool, node);
 }
@@ -76,6 +76,8 @@ typedef struct ogs_gtp_node_s {
 
     ogs_list_t      local_list;
     ogs_list_t      remote_list;
+
+    ogs_metrics_inst_t *metrics_rtt; /* Created on the first response */
 } ogs_gtp_node_t;
 
 typedef struct ogs_gtpu_resource_s {
@@ -23,6 +23,7 @@
 #include "ipfw/ogs-ipfw.h"
 #include "proto/ogs-proto.h"
 #include "app/ogs-app.h"
+#include "metrics/ogs-metrics.h"
 
 #define OGS_GTPV1_U_UDP_PORT            2152
 #define OGS_GTPV2_C_UDP_PORT            2123
@@ -2689,6 +2689,4463 @@ ogs_tlv_desc_t ogs_gtp2_tlv_desc_modify_access_bearers_response =
 }};
 
 
+static int gtp2_parse_tlv_pc5_qos_parameters(
+        ogs_gtp2_tlv_pc5_qos_parameters_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_remote_ue_context(
+        ogs_gtp2_tlv_remote_ue_context_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_v2x_context(
+        ogs_gtp2_tlv_v2x_context_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_bearer_context(
+        ogs_gtp2_tlv_bearer_context_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_pdn_connection(
+        ogs_gtp2_tlv_pdn_connection_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_overload_control_information(
+        ogs_gtp2_tlv_overload_control_information_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_load_control_information(
+        ogs_gtp2_tlv_load_control_information_t *msg, uint8_t *data, uint32_t length);
+static int gtp2_parse_tlv_scef_pdn_connection(
+        ogs_gtp2_tlv_scef_pdn_connection_t *msg, uint8_t *data, uint32_t length);
+
+static int gtp2_parse_tlv_pc5_qos_parameters(
+        ogs_gtp2_tlv_pc5_qos_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_PC5_QOS_FLOW_TYPE, 0):
+            if (!msg->pc5_qos_flows.presence)
+                rv = ogs_tlv_parse_element(&msg->pc5_qos_flows,
+                        &ogs_gtp2_tlv_desc_pc5_qos_flow_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BIT_RATE_TYPE, 0):
+            if (!msg->pc5_link_aggregated_bit_rates.presence)
+                rv = ogs_tlv_parse_element(&msg->pc5_link_aggregated_bit_rates,
+                        &ogs_gtp2_tlv_desc_bit_rate_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_remote_ue_context(
+        ogs_gtp2_tlv_remote_ue_context_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_REMOTE_USER_ID_TYPE, 0):
+            if (!msg->remote_user_id.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_user_id,
+                        &ogs_gtp2_tlv_desc_remote_user_id_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_REMOTE_UE_IP_INFORMATION_TYPE, 0):
+            if (!msg->remote_ue_ip_information.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_ue_ip_information,
+                        &ogs_gtp2_tlv_desc_remote_ue_ip_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_v2x_context(
+        ogs_gtp2_tlv_v2x_context_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_SERVICES_AUTHORIZED_TYPE, 0):
+            if (!msg->lte_v2x_services_authorized.presence)
+                rv = ogs_tlv_parse_element(&msg->lte_v2x_services_authorized,
+                        &ogs_gtp2_tlv_desc_services_authorized_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVICES_AUTHORIZED_TYPE, 1):
+            if (!msg->nr_v2x_services_authorized.presence)
+                rv = ogs_tlv_parse_element(&msg->nr_v2x_services_authorized,
+                        &ogs_gtp2_tlv_desc_services_authorized_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BIT_RATE_TYPE, 0):
+            if (!msg->lte_ue_sidelink_aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->lte_ue_sidelink_aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_bit_rate_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BIT_RATE_TYPE, 1):
+            if (!msg->nr_ue_sidelink_aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->nr_ue_sidelink_aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_bit_rate_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PC5_QOS_PARAMETERS_TYPE, 0):
+            if (!msg->pc5_qos_parameters.presence)
+                rv = gtp2_parse_tlv_pc5_qos_parameters(&msg->pc5_qos_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_bearer_context(
+        ogs_gtp2_tlv_bearer_context_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_TFT_TYPE, 0):
+            if (!msg->tft.presence)
+                rv = ogs_tlv_parse_element(&msg->tft,
+                        &ogs_gtp2_tlv_desc_bearer_tft_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->s1_u_enodeb_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s1_u_enodeb_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 1):
+            if (!msg->s4_u_sgsn_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s4_u_sgsn_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 2):
+            if (!msg->s5_s8_u_sgw_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s5_s8_u_sgw_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 3):
+            if (!msg->s5_s8_u_pgw_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s5_s8_u_pgw_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 4):
+            if (!msg->s12_rnc_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s12_rnc_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_4, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 5):
+            if (!msg->s2b_u_epdg_f_teid_5.presence)
+                rv = ogs_tlv_parse_element(&msg->s2b_u_epdg_f_teid_5,
+                        &ogs_gtp2_tlv_desc_f_teid_5, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 6):
+            if (!msg->s2a_u_twan_f_teid_6.presence)
+                rv = ogs_tlv_parse_element(&msg->s2a_u_twan_f_teid_6,
+                        &ogs_gtp2_tlv_desc_f_teid_6, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_QOS_TYPE, 0):
+            if (!msg->bearer_level_qos.presence)
+                rv = ogs_tlv_parse_element(&msg->bearer_level_qos,
+                        &ogs_gtp2_tlv_desc_bearer_qos_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 7):
+            if (!msg->s11_u_mme_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s11_u_mme_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_7, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHARGING_ID_TYPE, 0):
+            if (!msg->charging_id.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_id,
+                        &ogs_gtp2_tlv_desc_charging_id_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_FLAGS_TYPE, 0):
+            if (!msg->bearer_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->bearer_flags,
+                        &ogs_gtp2_tlv_desc_bearer_flags_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MAXIMUM_PACKET_LOSS_RATE_TYPE, 0):
+            if (!msg->maximum_packet_loss_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_packet_loss_rate,
+                        &ogs_gtp2_tlv_desc_maximum_packet_loss_rate_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 8):
+            if (!msg->s2b_u_epdg_f_teid_8.presence)
+                rv = ogs_tlv_parse_element(&msg->s2b_u_epdg_f_teid_8,
+                        &ogs_gtp2_tlv_desc_f_teid_8, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 9):
+            if (!msg->s2b_u_pgw_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s2b_u_pgw_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_9, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 10):
+            if (!msg->s2a_u_twan_f_teid_10.presence)
+                rv = ogs_tlv_parse_element(&msg->s2a_u_twan_f_teid_10,
+                        &ogs_gtp2_tlv_desc_f_teid_10, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 11):
+            if (!msg->s2a_u_pgw_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s2a_u_pgw_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_11, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RAN_NAS_CAUSE_TYPE, 0):
+            if (!msg->ran_nas_cause.presence)
+                rv = ogs_tlv_parse_element(&msg->ran_nas_cause,
+                        &ogs_gtp2_tlv_desc_ran_nas_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APCO_TYPE, 0):
+            if (!msg->additional_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_apco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->bss_container.presence)
+                rv = ogs_tlv_parse_element(&msg->bss_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TI_TYPE, 0):
+            if (!msg->transaction_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->transaction_identifier,
+                        &ogs_gtp2_tlv_desc_ti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PACKET_FLOW_ID_TYPE, 0):
+            if (!msg->packet_flow_id.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_flow_id,
+                        &ogs_gtp2_tlv_desc_packet_flow_id_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_pdn_connection(
+        ogs_gtp2_tlv_pdn_connection_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_APN_TYPE, 0):
+            if (!msg->apn.presence)
+                rv = ogs_tlv_parse_element(&msg->apn,
+                        &ogs_gtp2_tlv_desc_apn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RESTRICTION_TYPE, 0):
+            if (!msg->apn_restriction.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_restriction,
+                        &ogs_gtp2_tlv_desc_apn_restriction_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SELECTION_MODE_TYPE, 0):
+            if (!msg->selection_mode.presence)
+                rv = ogs_tlv_parse_element(&msg->selection_mode,
+                        &ogs_gtp2_tlv_desc_selection_mode_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->ipv4_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ipv4_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 1):
+            if (!msg->ipv6_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ipv6_address,
+                        &ogs_gtp2_tlv_desc_ip_address_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->pgw_s5_s8_ip_address_for_control_plane_or_pmip.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_s5_s8_ip_address_for_control_plane_or_pmip,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQDN_TYPE, 0):
+            if (!msg->pgw_node_name.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_node_name,
+                        &ogs_gtp2_tlv_desc_fqdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts_.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHARGING_CHARACTERISTICS_TYPE, 0):
+            if (!msg->charging_characteristics.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_characteristics,
+                        &ogs_gtp2_tlv_desc_charging_characteristics_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_REPORTING_ACTION_TYPE, 0):
+            if (!msg->change_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->change_reporting_action,
+                        &ogs_gtp2_tlv_desc_change_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CSG_INFORMATION_REPORTING_ACTION_TYPE, 0):
+            if (!msg->csg_information_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->csg_information_reporting_action,
+                        &ogs_gtp2_tlv_desc_csg_information_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ENB_INFORMATION_REPORTING_TYPE, 0):
+            if (!msg->hnb_information_reporting_.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_information_reporting_,
+                        &ogs_gtp2_tlv_desc_enb_information_reporting_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SIGNALLING_PRIORITY_INDICATION_TYPE, 0):
+            if (!msg->signalling_priority_indication__.presence)
+                rv = ogs_tlv_parse_element(&msg->signalling_priority_indication__,
+                        &ogs_gtp2_tlv_desc_signalling_priority_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_TO_REPORT_FLAGS_TYPE, 0):
+            if (!msg->change_to_report_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->change_to_report_flags,
+                        &ogs_gtp2_tlv_desc_change_to_report_flags_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQDN_TYPE, 1):
+            if (!msg->local_home_network_id.presence)
+                rv = ogs_tlv_parse_element(&msg->local_home_network_id,
+                        &ogs_gtp2_tlv_desc_fqdn_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_ACTION_TYPE, 0):
+            if (!msg->presence_reporting_area_action.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_action,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_WLAN_OFFLOADABILITY_INDICATION_TYPE, 0):
+            if (!msg->wlan_offloadability_indication.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_offloadability_indication,
+                        &ogs_gtp2_tlv_desc_wlan_offloadability_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_REMOTE_UE_CONTEXT_TYPE, 0):
+            if (!msg->remote_ue_context_connected.presence)
+                rv = gtp2_parse_tlv_remote_ue_context(&msg->remote_ue_context_connected,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PDN_TYPE_TYPE, 0):
+            if (!msg->pdn_type.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_type,
+                        &ogs_gtp2_tlv_desc_pdn_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_HEADER_COMPRESSION_CONFIGURATION_TYPE, 0):
+            if (!msg->header_compression_configuration.presence)
+                rv = ogs_tlv_parse_element(&msg->header_compression_configuration,
+                        &ogs_gtp2_tlv_desc_header_compression_configuration_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_overload_control_information(
+        ogs_gtp2_tlv_overload_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_SEQUENCE_NUMBER_TYPE, 0):
+            if (!msg->overload_control_sequence_number.presence)
+                rv = ogs_tlv_parse_element(&msg->overload_control_sequence_number,
+                        &ogs_gtp2_tlv_desc_sequence_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_METRIC_TYPE, 0):
+            if (!msg->overload_reduction_metric.presence)
+                rv = ogs_tlv_parse_element(&msg->overload_reduction_metric,
+                        &ogs_gtp2_tlv_desc_metric_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPC_TIMER_TYPE, 0):
+            if (!msg->period_of_validity.presence)
+                rv = ogs_tlv_parse_element(&msg->period_of_validity,
+                        &ogs_gtp2_tlv_desc_epc_timer_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_TYPE, 0):
+            if (!msg->list_of_access_point_name.presence)
+                rv = ogs_tlv_parse_element(&msg->list_of_access_point_name,
+                        &ogs_gtp2_tlv_desc_apn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_load_control_information(
+        ogs_gtp2_tlv_load_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_SEQUENCE_NUMBER_TYPE, 0):
+            if (!msg->load_control_sequence_number.presence)
+                rv = ogs_tlv_parse_element(&msg->load_control_sequence_number,
+                        &ogs_gtp2_tlv_desc_sequence_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_METRIC_TYPE, 0):
+            if (!msg->load_metric.presence)
+                rv = ogs_tlv_parse_element(&msg->load_metric,
+                        &ogs_gtp2_tlv_desc_metric_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_AND_RELATIVE_CAPACITY_TYPE, 0):
+            if (!msg->list_of_apn_and_relative_capacity.presence)
+                rv = ogs_tlv_parse_element(&msg->list_of_apn_and_relative_capacity,
+                        &ogs_gtp2_tlv_desc_apn_and_relative_capacity_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_tlv_scef_pdn_connection(
+        ogs_gtp2_tlv_scef_pdn_connection_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_APN_TYPE, 0):
+            if (!msg->apn.presence)
+                rv = ogs_tlv_parse_element(&msg->apn,
+                        &ogs_gtp2_tlv_desc_apn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->default_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->default_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_IDENTIFIER_TYPE, 0):
+            if (!msg->scef_id.presence)
+                rv = ogs_tlv_parse_element(&msg->scef_id,
+                        &ogs_gtp2_tlv_desc_node_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_echo_request(
+        ogs_gtp2_echo_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_FEATURES_TYPE, 0):
+            if (!msg->sending_node_features.presence)
+                rv = ogs_tlv_parse_element(&msg->sending_node_features,
+                        &ogs_gtp2_tlv_desc_node_features_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_echo_response(
+        ogs_gtp2_echo_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_FEATURES_TYPE, 0):
+            if (!msg->sending_node_features.presence)
+                rv = ogs_tlv_parse_element(&msg->sending_node_features,
+                        &ogs_gtp2_tlv_desc_node_features_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_session_request(
+        ogs_gtp2_create_session_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MSISDN_TYPE, 0):
+            if (!msg->msisdn.presence)
+                rv = ogs_tlv_parse_element(&msg->msisdn,
+                        &ogs_gtp2_tlv_desc_msisdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MEI_TYPE, 0):
+            if (!msg->me_identity.presence)
+                rv = ogs_tlv_parse_element(&msg->me_identity,
+                        &ogs_gtp2_tlv_desc_mei_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVING_NETWORK_TYPE, 0):
+            if (!msg->serving_network.presence)
+                rv = ogs_tlv_parse_element(&msg->serving_network,
+                        &ogs_gtp2_tlv_desc_serving_network_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RAT_TYPE_TYPE, 0):
+            if (!msg->rat_type.presence)
+                rv = ogs_tlv_parse_element(&msg->rat_type,
+                        &ogs_gtp2_tlv_desc_rat_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 1):
+            if (!msg->pgw_s5_s8_address_for_control_plane_or_pmip.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_s5_s8_address_for_control_plane_or_pmip,
+                        &ogs_gtp2_tlv_desc_f_teid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_TYPE, 0):
+            if (!msg->access_point_name.presence)
+                rv = ogs_tlv_parse_element(&msg->access_point_name,
+                        &ogs_gtp2_tlv_desc_apn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SELECTION_MODE_TYPE, 0):
+            if (!msg->selection_mode.presence)
+                rv = ogs_tlv_parse_element(&msg->selection_mode,
+                        &ogs_gtp2_tlv_desc_selection_mode_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PDN_TYPE_TYPE, 0):
+            if (!msg->pdn_type.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_type,
+                        &ogs_gtp2_tlv_desc_pdn_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PAA_TYPE, 0):
+            if (!msg->pdn_address_allocation.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_address_allocation,
+                        &ogs_gtp2_tlv_desc_paa_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RESTRICTION_TYPE, 0):
+            if (!msg->maximum_apn_restriction.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_apn_restriction,
+                        &ogs_gtp2_tlv_desc_apn_restriction_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWMI_TYPE, 0):
+            if (!msg->trusted_wlan_mode_indication.presence)
+                rv = ogs_tlv_parse_element(&msg->trusted_wlan_mode_indication,
+                        &ogs_gtp2_tlv_desc_twmi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts_to_be_created,
+                    sizeof(msg->bearer_contexts_to_be_created[0]), OGS_ARRAY_SIZE(msg->bearer_contexts_to_be_created));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_to_be_removed.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_to_be_removed,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TRACE_INFORMATION_TYPE, 0):
+            if (!msg->trace_information.presence)
+                rv = ogs_tlv_parse_element(&msg->trace_information,
+                        &ogs_gtp2_tlv_desc_trace_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 2):
+            if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 3):
+            if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UCI_TYPE, 0):
+            if (!msg->user_csg_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_csg_information,
+                        &ogs_gtp2_tlv_desc_uci_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHARGING_CHARACTERISTICS_TYPE, 0):
+            if (!msg->charging_characteristics.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_characteristics,
+                        &ogs_gtp2_tlv_desc_charging_characteristics_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 0):
+            if (!msg->mme_s4_sgsn_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 1):
+            if (!msg->sgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 2):
+            if (!msg->epdg_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 3):
+            if (!msg->twan_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SIGNALLING_PRIORITY_INDICATION_TYPE, 0):
+            if (!msg->signalling_priority_indication.presence)
+                rv = ogs_tlv_parse_element(&msg->signalling_priority_indication,
+                        &ogs_gtp2_tlv_desc_signalling_priority_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->ue_local_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_local_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APCO_TYPE, 0):
+            if (!msg->additional_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_apco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 1):
+            if (!msg->hnb_local_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_local_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->hnb_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 2):
+            if (!msg->mme_s4_sgsn_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_identifier,
+                        &ogs_gtp2_tlv_desc_ip_address_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->twan_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 3):
+            if (!msg->epdg_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CN_OPERATOR_SELECTION_ENTITY_TYPE, 0):
+            if (!msg->cn_operator_selection_entity.presence)
+                rv = ogs_tlv_parse_element(&msg->cn_operator_selection_entity,
+                        &ogs_gtp2_tlv_desc_cn_operator_selection_entity_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_INFORMATION_TYPE, 0):
+            if (!msg->presence_reporting_area_information.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_information,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MILLISECOND_TIME_STAMP_TYPE, 0):
+            if (!msg->origination_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->origination_time_stamp,
+                        &ogs_gtp2_tlv_desc_millisecond_time_stamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INTEGER_NUMBER_TYPE, 0):
+            if (!msg->maximum_wait_time.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_wait_time,
+                        &ogs_gtp2_tlv_desc_integer_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 1):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 0):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_REMOTE_UE_CONTEXT_TYPE, 0):
+            if (!msg->remote_ue_context_connected.presence)
+                rv = gtp2_parse_tlv_remote_ue_context(&msg->remote_ue_context_connected,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_IDENTIFIER_TYPE, 0):
+            if (!msg->_aaa_server_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->_aaa_server_identifier,
+                        &ogs_gtp2_tlv_desc_node_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVING_PLMN_RATE_CONTROL_TYPE, 0):
+            if (!msg->serving_plmn_rate_control.presence)
+                rv = ogs_tlv_parse_element(&msg->serving_plmn_rate_control,
+                        &ogs_gtp2_tlv_desc_serving_plmn_rate_control_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_COUNTER_TYPE, 0):
+            if (!msg->mo_exception_data_counter.presence)
+                rv = ogs_tlv_parse_element(&msg->mo_exception_data_counter,
+                        &ogs_gtp2_tlv_desc_counter_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 2):
+            if (!msg->ue_tcp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_tcp_port,
+                        &ogs_gtp2_tlv_desc_port_number_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MAPPED_UE_USAGE_TYPE_TYPE, 0):
+            if (!msg->mapped_ue_usage_type.presence)
+                rv = ogs_tlv_parse_element(&msg->mapped_ue_usage_type,
+                        &ogs_gtp2_tlv_desc_mapped_ue_usage_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 1):
+            if (!msg->user_location_information_for_sgw_.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information_for_sgw_,
+                        &ogs_gtp2_tlv_desc_uli_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQDN_TYPE, 0):
+            if (!msg->sgw_u_node_name.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_u_node_name,
+                        &ogs_gtp2_tlv_desc_fqdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UP_FUNCTION_SELECTION_INDICATION_FLAGS_TYPE, 0):
+            if (!msg->up_function_selection_indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->up_function_selection_indication_flags,
+                        &ogs_gtp2_tlv_desc_up_function_selection_indication_flags_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RATE_CONTROL_STATUS_TYPE, 0):
+            if (!msg->apn_rate_control_status.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_rate_control_status,
+                        &ogs_gtp2_tlv_desc_apn_rate_control_status_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_session_response(
+        ogs_gtp2_create_session_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_REPORTING_ACTION_TYPE, 0):
+            if (!msg->change_reporting_action_.presence)
+                rv = ogs_tlv_parse_element(&msg->change_reporting_action_,
+                        &ogs_gtp2_tlv_desc_change_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CSG_INFORMATION_REPORTING_ACTION_TYPE, 0):
+            if (!msg->csg_information_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->csg_information_reporting_action,
+                        &ogs_gtp2_tlv_desc_csg_information_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ENB_INFORMATION_REPORTING_TYPE, 0):
+            if (!msg->hnb_information_reporting.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_information_reporting,
+                        &ogs_gtp2_tlv_desc_enb_information_reporting_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 1):
+            if (!msg->pgw_s5_s8__s2a_s2b_f_teid_for_pmip_based_interface_or_for_gtp_based_control_plane_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_s5_s8__s2a_s2b_f_teid_for_pmip_based_interface_or_for_gtp_based_control_plane_interface,
+                        &ogs_gtp2_tlv_desc_f_teid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PAA_TYPE, 0):
+            if (!msg->pdn_address_allocation.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_address_allocation,
+                        &ogs_gtp2_tlv_desc_paa_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RESTRICTION_TYPE, 0):
+            if (!msg->apn_restriction.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_restriction,
+                        &ogs_gtp2_tlv_desc_apn_restriction_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts_created,
+                    sizeof(msg->bearer_contexts_created[0]), OGS_ARRAY_SIZE(msg->bearer_contexts_created));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_marked_for_removal.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_marked_for_removal,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQDN_TYPE, 0):
+            if (!msg->charging_gateway_name.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_gateway_name,
+                        &ogs_gtp2_tlv_desc_fqdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->charging_gateway_address.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_gateway_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->pgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 0):
+            if (!msg->sgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 1):
+            if (!msg->pgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPC_TIMER_TYPE, 0):
+            if (!msg->pgw_back_off_time.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_back_off_time,
+                        &ogs_gtp2_tlv_desc_epc_timer_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APCO_TYPE, 0):
+            if (!msg->additional_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_apco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP4CP_TYPE, 0):
+            if (!msg->trusted_wlan_ipv4_parameters_.presence)
+                rv = ogs_tlv_parse_element(&msg->trusted_wlan_ipv4_parameters_,
+                        &ogs_gtp2_tlv_desc_ip4cp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_ACTION_TYPE, 0):
+            if (!msg->presence_reporting_area_action.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_action,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHARGING_ID_TYPE, 0):
+            if (!msg->pdn_connection_charging_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_connection_charging_id,
+                        &ogs_gtp2_tlv_desc_charging_id_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_bearer_request(
+        ogs_gtp2_modify_bearer_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_MEI_TYPE, 0):
+            if (!msg->me_identity.presence)
+                rv = ogs_tlv_parse_element(&msg->me_identity,
+                        &ogs_gtp2_tlv_desc_mei_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVING_NETWORK_TYPE, 0):
+            if (!msg->serving_network.presence)
+                rv = ogs_tlv_parse_element(&msg->serving_network,
+                        &ogs_gtp2_tlv_desc_serving_network_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RAT_TYPE_TYPE, 0):
+            if (!msg->rat_type.presence)
+                rv = ogs_tlv_parse_element(&msg->rat_type,
+                        &ogs_gtp2_tlv_desc_rat_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_DELAY_VALUE_TYPE, 0):
+            if (!msg->delay_downlink_packet_notification_request.presence)
+                rv = ogs_tlv_parse_element(&msg->delay_downlink_packet_notification_request,
+                        &ogs_gtp2_tlv_desc_delay_value_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts_to_be_modified,
+                    sizeof(msg->bearer_contexts_to_be_modified[0]), OGS_ARRAY_SIZE(msg->bearer_contexts_to_be_modified));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_to_be_removed.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_to_be_removed,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UCI_TYPE, 0):
+            if (!msg->user_csg_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_csg_information,
+                        &ogs_gtp2_tlv_desc_uci_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 1):
+            if (!msg->ue_local_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_local_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 0):
+            if (!msg->mme_s4_sgsn_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 1):
+            if (!msg->sgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->hnb_local_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_local_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->hnb_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 2):
+            if (!msg->mme_s4_sgsn_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_identifier,
+                        &ogs_gtp2_tlv_desc_ip_address_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CN_OPERATOR_SELECTION_ENTITY_TYPE, 0):
+            if (!msg->cn_operator_selection_entity.presence)
+                rv = ogs_tlv_parse_element(&msg->cn_operator_selection_entity,
+                        &ogs_gtp2_tlv_desc_cn_operator_selection_entity_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_INFORMATION_TYPE, 0):
+            if (!msg->presence_reporting_area_information.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_information,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVING_PLMN_RATE_CONTROL_TYPE, 0):
+            if (!msg->serving_plmn_rate_control.presence)
+                rv = ogs_tlv_parse_element(&msg->serving_plmn_rate_control,
+                        &ogs_gtp2_tlv_desc_serving_plmn_rate_control_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_COUNTER_TYPE, 0):
+            if (!msg->mo_exception_data_counter.presence)
+                rv = ogs_tlv_parse_element(&msg->mo_exception_data_counter,
+                        &ogs_gtp2_tlv_desc_counter_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 1):
+            if (!msg->user_location_information_for_sgw_.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information_for_sgw_,
+                        &ogs_gtp2_tlv_desc_uli_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 0):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_bearer_response(
+        ogs_gtp2_modify_bearer_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MSISDN_TYPE, 0):
+            if (!msg->msisdn.presence)
+                rv = ogs_tlv_parse_element(&msg->msisdn,
+                        &ogs_gtp2_tlv_desc_msisdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RESTRICTION_TYPE, 0):
+            if (!msg->apn_restriction.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_restriction,
+                        &ogs_gtp2_tlv_desc_apn_restriction_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts_modified,
+                    sizeof(msg->bearer_contexts_modified[0]), OGS_ARRAY_SIZE(msg->bearer_contexts_modified));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_marked_for_removal.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_marked_for_removal,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_REPORTING_ACTION_TYPE, 0):
+            if (!msg->change_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->change_reporting_action,
+                        &ogs_gtp2_tlv_desc_change_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CSG_INFORMATION_REPORTING_ACTION_TYPE, 0):
+            if (!msg->csg_information_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->csg_information_reporting_action,
+                        &ogs_gtp2_tlv_desc_csg_information_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ENB_INFORMATION_REPORTING_TYPE, 0):
+            if (!msg->hnb_information_reporting_.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_information_reporting_,
+                        &ogs_gtp2_tlv_desc_enb_information_reporting_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQDN_TYPE, 0):
+            if (!msg->charging_gateway_name.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_gateway_name,
+                        &ogs_gtp2_tlv_desc_fqdn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->charging_gateway_address.presence)
+                rv = ogs_tlv_parse_element(&msg->charging_gateway_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->pgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 0):
+            if (!msg->sgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LDN_TYPE, 1):
+            if (!msg->pgw_ldn.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_ldn,
+                        &ogs_gtp2_tlv_desc_ldn_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_ACTION_TYPE, 0):
+            if (!msg->presence_reporting_area_action.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_action,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHARGING_ID_TYPE, 0):
+            if (!msg->pdn_connection_charging_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_connection_charging_id,
+                        &ogs_gtp2_tlv_desc_charging_id_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_session_request(
+        ogs_gtp2_delete_session_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_TYPE_TYPE, 0):
+            if (!msg->originating_node.presence)
+                rv = ogs_tlv_parse_element(&msg->originating_node,
+                        &ogs_gtp2_tlv_desc_node_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TIMESTAMP_TYPE, 0):
+            if (!msg->uli_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->uli_timestamp,
+                        &ogs_gtp2_tlv_desc_uli_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RAN_NAS_CAUSE_TYPE, 0):
+            if (!msg->ran_nas_release_cause.presence)
+                rv = ogs_tlv_parse_element(&msg->ran_nas_release_cause,
+                        &ogs_gtp2_tlv_desc_ran_nas_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->twan_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 0):
+            if (!msg->twan_identifier_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 1):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 1):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->ue_local_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_local_ip_address,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->ue_tcp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_tcp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_session_response(
+        ogs_gtp2_delete_session_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RATE_CONTROL_STATUS_TYPE, 0):
+            if (!msg->apn_rate_control_status.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_rate_control_status,
+                        &ogs_gtp2_tlv_desc_apn_rate_control_status_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_bearer_command(
+        ogs_gtp2_modify_bearer_command_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->apn_aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_context.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_context,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_bearer_failure_indication(
+        ogs_gtp2_modify_bearer_failure_indication_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_bearer_command(
+        ogs_gtp2_delete_bearer_command_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TIMESTAMP_TYPE, 0):
+            if (!msg->uli_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->uli_timestamp,
+                        &ogs_gtp2_tlv_desc_uli_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_bearer_failure_indication(
+        ogs_gtp2_delete_bearer_failure_indication_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_context.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_context,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_bearer_resource_command(
+        ogs_gtp2_bearer_resource_command_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PTI_TYPE, 0):
+            if (!msg->procedure_transaction_id.presence)
+                rv = ogs_tlv_parse_element(&msg->procedure_transaction_id,
+                        &ogs_gtp2_tlv_desc_pti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FLOW_QOS_TYPE, 0):
+            if (!msg->flow_quality_of_service.presence)
+                rv = ogs_tlv_parse_element(&msg->flow_quality_of_service,
+                        &ogs_gtp2_tlv_desc_flow_qos_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TAD_TYPE, 0):
+            if (!msg->traffic_aggregate_description.presence)
+                rv = ogs_tlv_parse_element(&msg->traffic_aggregate_description,
+                        &ogs_gtp2_tlv_desc_tad_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RAT_TYPE_TYPE, 0):
+            if (!msg->rat_type.presence)
+                rv = ogs_tlv_parse_element(&msg->rat_type,
+                        &ogs_gtp2_tlv_desc_rat_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SERVING_NETWORK_TYPE, 0):
+            if (!msg->serving_network.presence)
+                rv = ogs_tlv_parse_element(&msg->serving_network,
+                        &ogs_gtp2_tlv_desc_serving_network_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 1):
+            if (!msg->eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->s4_u_sgsn_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s4_u_sgsn_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 1):
+            if (!msg->s12_rnc_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->s12_rnc_f_teid,
+                        &ogs_gtp2_tlv_desc_f_teid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SIGNALLING_PRIORITY_INDICATION_TYPE, 0):
+            if (!msg->signalling_priority_indication__.presence)
+                rv = ogs_tlv_parse_element(&msg->signalling_priority_indication__,
+                        &ogs_gtp2_tlv_desc_signalling_priority_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 2):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_bearer_resource_failure_indication(
+        ogs_gtp2_bearer_resource_failure_indication_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PTI_TYPE, 0):
+            if (!msg->procedure_transaction_id.presence)
+                rv = ogs_tlv_parse_element(&msg->procedure_transaction_id,
+                        &ogs_gtp2_tlv_desc_pti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_downlink_data_notification_failure_indication(
+        ogs_gtp2_downlink_data_notification_failure_indication_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_TYPE_TYPE, 0):
+            if (!msg->originating_node.presence)
+                rv = ogs_tlv_parse_element(&msg->originating_node,
+                        &ogs_gtp2_tlv_desc_node_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_bearer_request(
+        ogs_gtp2_create_bearer_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_PTI_TYPE, 0):
+            if (!msg->procedure_transaction_id.presence)
+                rv = ogs_tlv_parse_element(&msg->procedure_transaction_id,
+                        &ogs_gtp2_tlv_desc_pti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->pgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_REPORTING_ACTION_TYPE, 0):
+            if (!msg->change_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->change_reporting_action,
+                        &ogs_gtp2_tlv_desc_change_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CSG_INFORMATION_REPORTING_ACTION_TYPE, 0):
+            if (!msg->csg_information_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->csg_information_reporting_action,
+                        &ogs_gtp2_tlv_desc_csg_information_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ENB_INFORMATION_REPORTING_TYPE, 0):
+            if (!msg->hnb_information_reporting.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_information_reporting,
+                        &ogs_gtp2_tlv_desc_enb_information_reporting_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_ACTION_TYPE, 0):
+            if (!msg->presence_reporting_area_action.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_action,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_bearer_response(
+        ogs_gtp2_create_bearer_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 2):
+            if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 3):
+            if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->twan_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_INFORMATION_TYPE, 0):
+            if (!msg->presence_reporting_area_information.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_information,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->mme_s4_sgsn_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_identifier,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 1):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 1):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->ue_tcp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_tcp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_update_bearer_request(
+        ogs_gtp2_update_bearer_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PTI_TYPE, 0):
+            if (!msg->procedure_transaction_id.presence)
+                rv = ogs_tlv_parse_element(&msg->procedure_transaction_id,
+                        &ogs_gtp2_tlv_desc_pti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_AMBR_TYPE, 0):
+            if (!msg->aggregate_maximum_bit_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregate_maximum_bit_rate,
+                        &ogs_gtp2_tlv_desc_ambr_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CHANGE_REPORTING_ACTION_TYPE, 0):
+            if (!msg->change_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->change_reporting_action,
+                        &ogs_gtp2_tlv_desc_change_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CSG_INFORMATION_REPORTING_ACTION_TYPE, 0):
+            if (!msg->csg_information_reporting_action.presence)
+                rv = ogs_tlv_parse_element(&msg->csg_information_reporting_action,
+                        &ogs_gtp2_tlv_desc_csg_information_reporting_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ENB_INFORMATION_REPORTING_TYPE, 0):
+            if (!msg->hnb_information_reporting_.presence)
+                rv = ogs_tlv_parse_element(&msg->hnb_information_reporting_,
+                        &ogs_gtp2_tlv_desc_enb_information_reporting_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->pgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_ACTION_TYPE, 0):
+            if (!msg->presence_reporting_area_action.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_action,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_action_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_update_bearer_response(
+        ogs_gtp2_update_bearer_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 2):
+            if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 3):
+            if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->twan_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PRESENCE_REPORTING_AREA_INFORMATION_TYPE, 0):
+            if (!msg->presence_reporting_area_information.presence)
+                rv = ogs_tlv_parse_element(&msg->presence_reporting_area_information,
+                        &ogs_gtp2_tlv_desc_presence_reporting_area_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->mme_s4_sgsn_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_identifier,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 1):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 1):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->ue_tcp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_tcp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_bearer_request(
+        ogs_gtp2_delete_bearer_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 1):
+            if (!msg->eps_bearer_ids.presence)
+                rv = ogs_tlv_parse_element(&msg->eps_bearer_ids,
+                        &ogs_gtp2_tlv_desc_ebi_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->failed_bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->failed_bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PTI_TYPE, 0):
+            if (!msg->procedure_transaction_id.presence)
+                rv = ogs_tlv_parse_element(&msg->procedure_transaction_id,
+                        &ogs_gtp2_tlv_desc_pti_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->pgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->pgw_s_apn_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->pgw_s_apn_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->pgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->pgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_APN_RATE_CONTROL_STATUS_TYPE, 0):
+            if (!msg->apn_rate_control_status.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_rate_control_status,
+                        &ogs_gtp2_tlv_desc_apn_rate_control_status_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPCO_TYPE, 0):
+            if (!msg->extended_protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->extended_protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_epco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_bearer_response(
+        ogs_gtp2_delete_bearer_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->linked_eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 0):
+            if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 1):
+            if (!msg->sgw_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 2):
+            if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_2, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_FQ_CSID_TYPE, 3):
+            if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_gtp2_tlv_desc_fq_csid_3, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PCO_TYPE, 0):
+            if (!msg->protocol_configuration_options.presence)
+                rv = ogs_tlv_parse_element(&msg->protocol_configuration_options,
+                        &ogs_gtp2_tlv_desc_pco_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_UE_TIME_ZONE_TYPE, 0):
+            if (!msg->ue_time_zone.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_time_zone,
+                        &ogs_gtp2_tlv_desc_ue_time_zone_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TYPE, 0):
+            if (!msg->user_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->user_location_information,
+                        &ogs_gtp2_tlv_desc_uli_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ULI_TIMESTAMP_TYPE, 0):
+            if (!msg->uli_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->uli_timestamp,
+                        &ogs_gtp2_tlv_desc_uli_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 0):
+            if (!msg->twan_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier,
+                        &ogs_gtp2_tlv_desc_twan_identifier_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 0):
+            if (!msg->twan_identifier_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_identifier_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->mme_s4_sgsn_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->mme_s4_sgsn_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 1):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IP_ADDRESS_TYPE, 0):
+            if (!msg->mme_s4_sgsn_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_s4_sgsn_identifier,
+                        &ogs_gtp2_tlv_desc_ip_address_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 2):
+            if (!msg->twan_epdg_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->twan_epdg_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TYPE, 1):
+            if (!msg->wlan_location_information.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_information,
+                        &ogs_gtp2_tlv_desc_twan_identifier_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_TWAN_IDENTIFIER_TIMESTAMP_TYPE, 1):
+            if (!msg->wlan_location_timestamp.presence)
+                rv = ogs_tlv_parse_element(&msg->wlan_location_timestamp,
+                        &ogs_gtp2_tlv_desc_twan_identifier_timestamp_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 0):
+            if (!msg->ue_udp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_udp_port,
+                        &ogs_gtp2_tlv_desc_port_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_CONTAINER_TYPE, 0):
+            if (!msg->nbifom_container.presence)
+                rv = ogs_tlv_parse_element(&msg->nbifom_container,
+                        &ogs_gtp2_tlv_desc_f_container_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PORT_NUMBER_TYPE, 1):
+            if (!msg->ue_tcp_port.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_tcp_port,
+                        &ogs_gtp2_tlv_desc_port_number_1, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_indirect_data_forwarding_tunnel_request(
+        ogs_gtp2_create_indirect_data_forwarding_tunnel_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_MEI_TYPE, 0):
+            if (!msg->me_identity.presence)
+                rv = ogs_tlv_parse_element(&msg->me_identity,
+                        &ogs_gtp2_tlv_desc_mei_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts,
+                    sizeof(msg->bearer_contexts[0]), OGS_ARRAY_SIZE(msg->bearer_contexts));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_create_indirect_data_forwarding_tunnel_response(
+        ogs_gtp2_create_indirect_data_forwarding_tunnel_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            v = ogs_tlv_more_slot(msg->bearer_contexts,
+                    sizeof(msg->bearer_contexts[0]), OGS_ARRAY_SIZE(msg->bearer_contexts));
+            if (v)
+                rv = gtp2_parse_tlv_bearer_context(v,
+                        e.value, e.length);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_indirect_data_forwarding_tunnel_request(
+        ogs_gtp2_delete_indirect_data_forwarding_tunnel_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_delete_indirect_data_forwarding_tunnel_response(
+        ogs_gtp2_delete_indirect_data_forwarding_tunnel_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_release_access_bearers_request(
+        ogs_gtp2_release_access_bearers_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->list_of_rabs.presence)
+                rv = ogs_tlv_parse_element(&msg->list_of_rabs,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_NODE_TYPE_TYPE, 0):
+            if (!msg->originating_node.presence)
+                rv = ogs_tlv_parse_element(&msg->originating_node,
+                        &ogs_gtp2_tlv_desc_node_type_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_release_access_bearers_response(
+        ogs_gtp2_release_access_bearers_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_downlink_data_notification(
+        ogs_gtp2_downlink_data_notification_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EBI_TYPE, 0):
+            if (!msg->eps_bearer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->eps_bearer_id,
+                        &ogs_gtp2_tlv_desc_ebi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_ARP_TYPE, 0):
+            if (!msg->allocation_retention_priority.presence)
+                rv = ogs_tlv_parse_element(&msg->allocation_retention_priority,
+                        &ogs_gtp2_tlv_desc_arp_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_PAGING_AND_SERVICE_INFORMATION_TYPE, 0):
+            if (!msg->paging_and_service_information.presence)
+                rv = ogs_tlv_parse_element(&msg->paging_and_service_information,
+                        &ogs_gtp2_tlv_desc_paging_and_service_information_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INTEGER_NUMBER_TYPE, 0):
+            if (!msg->dl_data_packets_size.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_data_packets_size,
+                        &ogs_gtp2_tlv_desc_integer_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_downlink_data_notification_acknowledge(
+        ogs_gtp2_downlink_data_notification_acknowledge_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_DELAY_VALUE_TYPE, 0):
+            if (!msg->data_notification_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->data_notification_delay,
+                        &ogs_gtp2_tlv_desc_delay_value_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_THROTTLING_TYPE, 0):
+            if (!msg->dl_low_priority_traffic_throttling_.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_low_priority_traffic_throttling_,
+                        &ogs_gtp2_tlv_desc_throttling_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_IMSI_TYPE, 0):
+            if (!msg->imsi.presence)
+                rv = ogs_tlv_parse_element(&msg->imsi,
+                        &ogs_gtp2_tlv_desc_imsi_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_EPC_TIMER_TYPE, 0):
+            if (!msg->dl_buffering_duration.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_buffering_duration,
+                        &ogs_gtp2_tlv_desc_epc_timer_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INTEGER_NUMBER_TYPE, 0):
+            if (!msg->dl_buffering_suggested_packet_count.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_buffering_suggested_packet_count,
+                        &ogs_gtp2_tlv_desc_integer_number_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_access_bearers_request(
+        ogs_gtp2_modify_access_bearers_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_F_TEID_TYPE, 0):
+            if (!msg->sender_f_teid_for_control_plane.presence)
+                rv = ogs_tlv_parse_element(&msg->sender_f_teid_for_control_plane,
+                        &ogs_gtp2_tlv_desc_f_teid_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_DELAY_VALUE_TYPE, 0):
+            if (!msg->delay_downlink_packet_notification_request.presence)
+                rv = ogs_tlv_parse_element(&msg->delay_downlink_packet_notification_request,
+                        &ogs_gtp2_tlv_desc_delay_value_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts_to_be_modified.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_to_be_modified,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_to_be_removed.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_to_be_removed,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE, 0):
+            if (!msg->secondary_rat_usage_data_report.presence)
+                rv = ogs_tlv_parse_element(&msg->secondary_rat_usage_data_report,
+                        &ogs_gtp2_tlv_desc_secondary_rat_usage_data_report_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int gtp2_parse_msg_modify_access_bearers_response(
+        ogs_gtp2_modify_access_bearers_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (OGS_TLV_KEY(e.type, e.instance)) {
+        case OGS_TLV_KEY(OGS_GTP2_CAUSE_TYPE, 0):
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_gtp2_tlv_desc_cause_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 0):
+            if (!msg->bearer_contexts_modified.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_modified,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_BEARER_CONTEXT_TYPE, 1):
+            if (!msg->bearer_contexts_marked_for_removal.presence)
+                rv = gtp2_parse_tlv_bearer_context(&msg->bearer_contexts_marked_for_removal,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_RECOVERY_TYPE, 0):
+            if (!msg->recovery.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery,
+                        &ogs_gtp2_tlv_desc_recovery_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_INDICATION_TYPE, 0):
+            if (!msg->indication_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->indication_flags,
+                        &ogs_gtp2_tlv_desc_indication_0, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_LOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_node_level_load_control_information.presence)
+                rv = gtp2_parse_tlv_load_control_information(&msg->sgw_s_node_level_load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_TLV_KEY(OGS_GTP2_OVERLOAD_CONTROL_INFORMATION_TYPE, 0):
+            if (!msg->sgw_s_overload_control_information.presence)
+                rv = gtp2_parse_tlv_overload_control_information(&msg->sgw_s_overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
 int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t *pkbuf)
 {
     int rv = OGS_ERROR;
@@ -2702,7 +7159,8 @@ int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t *pkbuf)
     h = (ogs_gtp2_header_t *)pkbuf->data;
     ogs_assert(h);
 
-    memset(gtp2_message, 0, sizeof(ogs_gtp2_message_t));
+    /* Only the header and the decoded message are cleared */
+    memset(&gtp2_message->h, 0, sizeof(gtp2_message->h));
 
     if (h->teid_presence)
         size = OGS_GTPV2C_HEADER_LEN;
@@ -2715,137 +7173,167 @@ int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t *pkbuf)
     if (h->teid_presence)
         gtp2_message->h.teid = be32toh(gtp2_message->h.teid);
 
-    if (pkbuf->len == 0) {
-        ogs_assert(ogs_pkbuf_push(pkbuf, size));
-        return OGS_OK;
-    }
-
     switch(gtp2_message->h.type) {
     case OGS_GTP2_ECHO_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->echo_request,
-                &ogs_gtp2_tlv_desc_echo_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_echo_request(
+                &gtp2_message->echo_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_ECHO_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->echo_response,
-                &ogs_gtp2_tlv_desc_echo_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_echo_response(
+                &gtp2_message->echo_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_SESSION_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_session_request,
-                &ogs_gtp2_tlv_desc_create_session_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_session_request(
+                &gtp2_message->create_session_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_SESSION_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_session_response,
-                &ogs_gtp2_tlv_desc_create_session_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_session_response(
+                &gtp2_message->create_session_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_BEARER_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_bearer_request,
-                &ogs_gtp2_tlv_desc_modify_bearer_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_bearer_request(
+                &gtp2_message->modify_bearer_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_BEARER_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_bearer_response,
-                &ogs_gtp2_tlv_desc_modify_bearer_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_bearer_response(
+                &gtp2_message->modify_bearer_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_SESSION_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_session_request,
-                &ogs_gtp2_tlv_desc_delete_session_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_session_request(
+                &gtp2_message->delete_session_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_SESSION_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_session_response,
-                &ogs_gtp2_tlv_desc_delete_session_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_session_response(
+                &gtp2_message->delete_session_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_BEARER_COMMAND_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_bearer_command,
-                &ogs_gtp2_tlv_desc_modify_bearer_command, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_bearer_command(
+                &gtp2_message->modify_bearer_command,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_BEARER_FAILURE_INDICATION_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_bearer_failure_indication,
-                &ogs_gtp2_tlv_desc_modify_bearer_failure_indication, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_bearer_failure_indication(
+                &gtp2_message->modify_bearer_failure_indication,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_BEARER_COMMAND_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_bearer_command,
-                &ogs_gtp2_tlv_desc_delete_bearer_command, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_bearer_command(
+                &gtp2_message->delete_bearer_command,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_BEARER_FAILURE_INDICATION_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_bearer_failure_indication,
-                &ogs_gtp2_tlv_desc_delete_bearer_failure_indication, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_bearer_failure_indication(
+                &gtp2_message->delete_bearer_failure_indication,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_BEARER_RESOURCE_COMMAND_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->bearer_resource_command,
-                &ogs_gtp2_tlv_desc_bearer_resource_command, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_bearer_resource_command(
+                &gtp2_message->bearer_resource_command,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_BEARER_RESOURCE_FAILURE_INDICATION_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->bearer_resource_failure_indication,
-                &ogs_gtp2_tlv_desc_bearer_resource_failure_indication, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_bearer_resource_failure_indication(
+                &gtp2_message->bearer_resource_failure_indication,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DOWNLINK_DATA_NOTIFICATION_FAILURE_INDICATION_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->downlink_data_notification_failure_indication,
-                &ogs_gtp2_tlv_desc_downlink_data_notification_failure_indication, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_downlink_data_notification_failure_indication(
+                &gtp2_message->downlink_data_notification_failure_indication,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_BEARER_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_bearer_request,
-                &ogs_gtp2_tlv_desc_create_bearer_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_bearer_request(
+                &gtp2_message->create_bearer_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_BEARER_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_bearer_response,
-                &ogs_gtp2_tlv_desc_create_bearer_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_bearer_response(
+                &gtp2_message->create_bearer_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_UPDATE_BEARER_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->update_bearer_request,
-                &ogs_gtp2_tlv_desc_update_bearer_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_update_bearer_request(
+                &gtp2_message->update_bearer_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_UPDATE_BEARER_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->update_bearer_response,
-                &ogs_gtp2_tlv_desc_update_bearer_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_update_bearer_response(
+                &gtp2_message->update_bearer_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_BEARER_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_bearer_request,
-                &ogs_gtp2_tlv_desc_delete_bearer_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_bearer_request(
+                &gtp2_message->delete_bearer_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_BEARER_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_bearer_response,
-                &ogs_gtp2_tlv_desc_delete_bearer_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_bearer_response(
+                &gtp2_message->delete_bearer_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_INDIRECT_DATA_FORWARDING_TUNNEL_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_indirect_data_forwarding_tunnel_request,
-                &ogs_gtp2_tlv_desc_create_indirect_data_forwarding_tunnel_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_indirect_data_forwarding_tunnel_request(
+                &gtp2_message->create_indirect_data_forwarding_tunnel_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_CREATE_INDIRECT_DATA_FORWARDING_TUNNEL_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->create_indirect_data_forwarding_tunnel_response,
-                &ogs_gtp2_tlv_desc_create_indirect_data_forwarding_tunnel_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_create_indirect_data_forwarding_tunnel_response(
+                &gtp2_message->create_indirect_data_forwarding_tunnel_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_INDIRECT_DATA_FORWARDING_TUNNEL_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_indirect_data_forwarding_tunnel_request,
-                &ogs_gtp2_tlv_desc_delete_indirect_data_forwarding_tunnel_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_indirect_data_forwarding_tunnel_request(
+                &gtp2_message->delete_indirect_data_forwarding_tunnel_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DELETE_INDIRECT_DATA_FORWARDING_TUNNEL_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->delete_indirect_data_forwarding_tunnel_response,
-                &ogs_gtp2_tlv_desc_delete_indirect_data_forwarding_tunnel_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_delete_indirect_data_forwarding_tunnel_response(
+                &gtp2_message->delete_indirect_data_forwarding_tunnel_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_RELEASE_ACCESS_BEARERS_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->release_access_bearers_request,
-                &ogs_gtp2_tlv_desc_release_access_bearers_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_release_access_bearers_request(
+                &gtp2_message->release_access_bearers_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_RELEASE_ACCESS_BEARERS_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->release_access_bearers_response,
-                &ogs_gtp2_tlv_desc_release_access_bearers_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_release_access_bearers_response(
+                &gtp2_message->release_access_bearers_response,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DOWNLINK_DATA_NOTIFICATION_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->downlink_data_notification,
-                &ogs_gtp2_tlv_desc_downlink_data_notification, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_downlink_data_notification(
+                &gtp2_message->downlink_data_notification,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_DOWNLINK_DATA_NOTIFICATION_ACKNOWLEDGE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->downlink_data_notification_acknowledge,
-                &ogs_gtp2_tlv_desc_downlink_data_notification_acknowledge, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_downlink_data_notification_acknowledge(
+                &gtp2_message->downlink_data_notification_acknowledge,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_ACCESS_BEARERS_REQUEST_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_access_bearers_request,
-                &ogs_gtp2_tlv_desc_modify_access_bearers_request, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_access_bearers_request(
+                &gtp2_message->modify_access_bearers_request,
+                pkbuf->data, pkbuf->len);
         break;
     case OGS_GTP2_MODIFY_ACCESS_BEARERS_RESPONSE_TYPE:
-        rv = ogs_tlv_parse_msg(&gtp2_message->modify_access_bearers_response,
-                &ogs_gtp2_tlv_desc_modify_access_bearers_response, pkbuf, OGS_TLV_MODE_T1_L2_I1);
+        rv = gtp2_parse_msg_modify_access_bearers_response(
+                &gtp2_message->modify_access_bearers_response,
+                pkbuf->data, pkbuf->len);
         break;
     default:
+        if (pkbuf->len == 0) {
+            rv = OGS_OK;
+            break;
+        }
         ogs_warn("Not implmeneted(type:%d)", gtp2_message->h.type);
         break;
     }
@@ -19,23 +19,17 @@
 
 #include "ogs-gtp.h"
 
-int ogs_gtp2_send_user_plane(
-        ogs_gtp_node_t *gnode,
-        ogs_gtp2_header_t *gtp_hdesc, ogs_gtp2_extension_header_t *ext_hdesc,
-        ogs_pkbuf_t *pkbuf)
+uint8_t ogs_gtp2_build_user_plane_header(uint8_t *hdr,
+        ogs_gtp2_header_t *gtp_hdesc, ogs_gtp2_extension_header_t *ext_hdesc)
 {
-    char buf[OGS_ADDRSTRLEN];
-    int rv;
-
     ogs_gtp2_header_t *gtp_h = NULL;
     ogs_gtp2_extension_header_t *ext_h = NULL;
     uint8_t flags;
     uint8_t gtp_hlen = 0;
 
-    ogs_assert(gnode);
+    ogs_assert(hdr);
     ogs_assert(gtp_hdesc);
     ogs_assert(ext_hdesc);
-    ogs_assert(pkbuf);
 
     /* Processing GTP Flags */
     flags = gtp_hdesc->flags;
@@ -50,11 +44,8 @@ int ogs_gtp2_send_user_plane(
     else
         gtp_hlen = OGS_GTPV1U_HEADER_LEN;
 
-    ogs_pkbuf_push(pkbuf, gtp_hlen);
-
     /* Fill GTP Header */
-    gtp_h = (ogs_gtp2_header_t *)pkbuf->data;
-    ogs_assert(gtp_h);
+    gtp_h = (ogs_gtp2_header_t *)hdr;
     memset(gtp_h, 0, gtp_hlen);
 
     gtp_h->flags = flags;
@@ -77,22 +68,9 @@ int ogs_gtp2_send_user_plane(
 
     gtp_h->teid = htobe32(gtp_hdesc->teid);
 
-    /*
-     * TS29.281 5.1 General format in GTP-U header
-     *
-     * Length: This field indicates the length in octets of the payload,
-     * i.e. the rest of the packet following the mandatory part of
-     * the GTP header (that is the first 8 octets). The Sequence Number,
-     * the N-PDU Number or any Extension headers shall be considered
-     * to be part of the payload, i.e. included in the length count.
-     */
-    gtp_h->length = htobe16(pkbuf->len - OGS_GTPV1U_HEADER_LEN);
-
     /* Fill Extention Header */
     if (gtp_h->flags & OGS_GTPU_FLAGS_E) {
-        ext_h = (ogs_gtp2_extension_header_t *)
-            (pkbuf->data + OGS_GTPV1U_HEADER_LEN);
-        ogs_assert(ext_h);
+        ext_h = (ogs_gtp2_extension_header_t *)(hdr + OGS_GTPV1U_HEADER_LEN);
 
         if (ext_hdesc->qos_flow_identifier) {
             /* 5G Core */
@@ -111,13 +89,45 @@ int ogs_gtp2_send_user_plane(
         }
     }
 
+    return gtp_hlen;
+}
+
+int ogs_gtp2_send_user_plane_header(ogs_gtp_node_t *gnode,
+        const uint8_t *hdr, uint8_t hlen, ogs_pkbuf_t *pkbuf)
+{
+    char buf[OGS_ADDRSTRLEN];
+    int rv;
+
+    ogs_gtp2_header_t *gtp_h = NULL;
+
+    ogs_assert(gnode);
+    ogs_assert(hdr);
+    ogs_assert(hlen >= OGS_GTPV1U_HEADER_LEN);
+    ogs_assert(pkbuf);
+
+    gtp_h = (ogs_gtp2_header_t *)ogs_pkbuf_push(pkbuf, hlen);
+    ogs_assert(gtp_h);
+    memcpy(gtp_h, hdr, hlen);
+
+    /*
+     * TS29.281 5.1 General format in GTP-U header
+     *
+     * Length: This field indicates the length in octets of the payload,
+     * i.e. the rest of the packet following the mandatory part of
+     * the GTP header (that is the first 8 octets). The Sequence Number,
+     * the N-PDU Number or any Extension headers shall be considered
+     * to be part of the payload, i.e. included in the length count.
+     */
+    gtp_h->length = htobe16(pkbuf->len - OGS_GTPV1U_HEADER_LEN);
+
     ogs_debug("SEND GTP-U[%d] to Peer[%s] : TEID[0x%x]",
-            gtp_hdesc->type, OGS_ADDR(&gnode->addr, buf), gtp_hdesc->teid);
+            gtp_h->type, OGS_ADDR(&gnode->addr, buf), be32toh(gtp_h->teid));
     rv = ogs_gtp_sendto(gnode, pkbuf);
     if (rv != OGS_OK) {
         if (ogs_socket_errno != OGS_EAGAIN) {
             ogs_error("SEND GTP-U[%d] to Peer[%s] : TEID[0x%x]",
-                gtp_hdesc->type, OGS_ADDR(&gnode->addr, buf), gtp_hdesc->teid);
+                gtp_h->type, OGS_ADDR(&gnode->addr, buf),
+                be32toh(gtp_h->teid));
         }
     }
 
@@ -126,6 +136,24 @@ int ogs_gtp2_send_user_plane(
     return rv;
 }
 
+int ogs_gtp2_send_user_plane(
+        ogs_gtp_node_t *gnode,
+        ogs_gtp2_header_t *gtp_hdesc, ogs_gtp2_extension_header_t *ext_hdesc,
+        ogs_pkbuf_t *pkbuf)
+{
+    uint8_t hdr[OGS_GTPV1U_5GC_HEADER_LEN];
+    uint8_t hlen;
+
+    ogs_assert(gnode);
+    ogs_assert(gtp_hdesc);
+    ogs_assert(ext_hdesc);
+    ogs_assert(pkbuf);
+
+    hlen = ogs_gtp2_build_user_plane_header(hdr, gtp_hdesc, ext_hdesc);
+
+    return ogs_gtp2_send_user_plane_header(gnode, hdr, hlen, pkbuf);
+}
+
 ogs_pkbuf_t *ogs_gtp2_handle_echo_req(ogs_pkbuf_t *pkb)
 {
     ogs_gtp2_header_t *gtph = NULL;
@@ -35,6 +35,16 @@ int ogs_gtp2_send_user_plane(
         ogs_gtp2_header_t *gtp_hdesc, ogs_gtp2_extension_header_t *ext_hdesc,
         ogs_pkbuf_t *pkbuf);
 
+/*
+ * The header ogs_gtp2_send_user_plane() prepends, built once into hdr
+ * (OGS_GTPV1U_5GC_HEADER_LEN bytes) and returning its length. Sending it
+ * only copies it in front of the payload and patches the length.
+ */
+uint8_t ogs_gtp2_build_user_plane_header(uint8_t *hdr,
+        ogs_gtp2_header_t *gtp_hdesc, ogs_gtp2_extension_header_t *ext_hdesc);
+int ogs_gtp2_send_user_plane_header(ogs_gtp_node_t *gnode,
+        const uint8_t *hdr, uint8_t hlen, ogs_pkbuf_t *pkbuf);
+
 ogs_pkbuf_t *ogs_gtp2_handle_echo_req(ogs_pkbuf_t *pkb);
 void ogs_gtp2_send_error_message(
         ogs_gtp_xact_t *xact, uint32_t teid, uint8_t type, uint8_t cause_value);
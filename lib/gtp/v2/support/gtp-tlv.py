@@ -682,6 +682,103 @@ for (k, v) in sorted_msg_list:
         f.write("}};\n\n")
 f.write("\n")
 
+def is_bearer_contexts_more(k, ies):
+    return ((k == 'Create Indirect Data Forwarding Tunnel Request' or k == 'Create Indirect Data Forwarding Tunnel Response') and ies["ie_value"] == 'Bearer Contexts') or (k == 'Create Session Request' and ies["ie_value"] == 'Bearer Contexts to be created') or (k == 'Create Session Response' and ies["ie_value"] == 'Bearer Contexts created') or (k == 'Modify Bearer Request' and ies["ie_value"] == 'Bearer Contexts to be modified') or (k == 'Modify Bearer Response' and ies["ie_value"] == 'Bearer Contexts modified')
+
+def group_field_name(ies):
+    if ies["ie_type"] == "F-TEID":
+        if ies["ie_value"] == "S2b-U ePDG F-TEID":
+            return v_lower(ies["ie_value"]) + "_" + ies["instance"]
+        elif ies["ie_value"] == "S2a-U TWAN F-TEID":
+            return v_lower(ies["ie_value"]) + "_" + ies["instance"]
+    return v_lower(ies["ie_value"])
+
+def write_parse_ie(f, indent, field, ies, e):
+    if ies["ie_type"] in group_list.keys():
+        f.write(indent + "rv = gtp2_parse_tlv_%s(%s,\n" % (v_lower(ies["ie_type"]), field))
+        f.write(indent + "        %s.value, %s.length);\n" % (e, e))
+    else:
+        f.write(indent + "rv = ogs_tlv_parse_element(%s,\n" % field)
+        f.write(indent + "        &ogs_gtp2_tlv_desc_%s_%s, &%s);\n" % (v_lower(ies["ie_type"]), v_lower(ies["instance"]), e))
+
+def write_parse_function(f, name, struct, fields_list, is_group):
+    keys = []
+    fields = {}
+    need_slot = False
+    for (ies, field, more) in fields_list:
+        key = (ies["ie_type"], ies["instance"])
+        if key not in fields:
+            keys.append(key)
+            fields[key] = []
+        fields[key].append((ies, field, more))
+        if more:
+            need_slot = True
+
+    f.write("static int %s(\n" % name)
+    f.write("        %s *msg, uint8_t *data, uint32_t length)\n" % struct)
+    f.write("{\n")
+    f.write("    ogs_tlv_cursor_t cursor;\n")
+    f.write("    ogs_tlv_element_t e;\n")
+    if need_slot:
+        f.write("    void *v = NULL;\n")
+    f.write("    int rv;\n\n")
+    if not is_group:
+        f.write("    memset(msg, 0, sizeof(*msg));\n\n")
+    f.write("    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T1_L2_I1);\n")
+    f.write("    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {\n")
+    f.write("        switch (OGS_TLV_KEY(e.type, e.instance)) {\n")
+    for key in keys:
+        f.write("        case OGS_TLV_KEY(OGS_GTP2_%s_TYPE, %s):\n" % (v_upper(key[0]), key[1]))
+        if len(fields[key]) == 1 and fields[key][0][2]:
+            (ies, field, more) = fields[key][0]
+            field = "msg->" + field
+            f.write("            v = ogs_tlv_more_slot(%s,\n" % field)
+            f.write("                    sizeof(%s[0]), OGS_ARRAY_SIZE(%s));\n" % (field, field))
+            f.write("            if (v)\n")
+            write_parse_ie(f, "                ", "v", ies, "e")
+        else:
+            cond = "if"
+            for (ies, field, more) in fields[key]:
+                assert more == False, "Mixed IE array for key = %s" % key[0]
+                field = "msg->" + field
+                f.write("            %s (!%s.presence)\n" % (cond, field))
+                write_parse_ie(f, "                ", "&" + field, ies, "e")
+                cond = "else if"
+            f.write("            else\n")
+            f.write("                ogs_warn(\"Duplicated TLV type [%d]\", e.type);\n")
+        f.write("            break;\n")
+    f.write("        default:\n")
+    f.write("            ogs_warn(\"Unknown TLV type [%d]\", e.type);\n")
+    f.write("            break;\n")
+    f.write("        }\n\n")
+    f.write("        if (rv != OGS_OK)\n")
+    f.write("            return OGS_ERROR;\n")
+    f.write("    }\n\n")
+    f.write("    if (rv != OGS_DONE)\n")
+    f.write("        return OGS_ERROR;\n\n")
+    if is_group:
+        f.write("    msg->presence = 1;\n\n")
+    f.write("    return OGS_OK;\n")
+    f.write("}\n\n")
+
+for (k, v) in sorted_group_list:
+    f.write("static int gtp2_parse_tlv_%s(\n" % v_lower(k))
+    f.write("        ogs_gtp2_tlv_%s_t *msg, uint8_t *data, uint32_t length);\n" % v_lower(k))
+f.write("\n")
+
+for (k, v) in sorted_group_list:
+    write_parse_function(f, "gtp2_parse_tlv_%s" % v_lower(k),
+            "ogs_gtp2_tlv_%s_t" % v_lower(k),
+            [(ies, group_field_name(ies), False) for ies in group_list[k]["ies"]],
+            True)
+
+for (k, v) in sorted_msg_list:
+    if "ies" in msg_list[k]:
+        write_parse_function(f, "gtp2_parse_msg_%s" % v_lower(k),
+                "ogs_gtp2_%s_t" % v_lower(k),
+                [(ies, v_lower(ies["ie_value"]), is_bearer_contexts_more(k, ies)) for ies in msg_list[k]["ies"]],
+                False)
+
 f.write("""int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t *pkbuf)
 {
     int rv = OGS_ERROR;
@@ -695,7 +792,8 @@ f.write("""int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t
     h = (ogs_gtp2_header_t *)pkbuf->data;
     ogs_assert(h);
 
-    memset(gtp2_message, 0, sizeof(ogs_gtp2_message_t));
+    /* Only the header and the decoded message are cleared */
+    memset(&gtp2_message->h, 0, sizeof(gtp2_message->h));
 
     if (h->teid_presence)
         size = OGS_GTPV2C_HEADER_LEN;
@@ -708,20 +806,20 @@ f.write("""int ogs_gtp2_parse_msg(ogs_gtp2_message_t *gtp2_message, ogs_pkbuf_t
     if (h->teid_presence)
         gtp2_message->h.teid = be32toh(gtp2_message->h.teid);
 
-    if (pkbuf->len == 0) {
-        ogs_assert(ogs_pkbuf_push(pkbuf, size));
-        return OGS_OK;
-    }
-
     switch(gtp2_message->h.type) {
 """)
 for (k, v) in sorted_msg_list:
     if "ies" in msg_list[k]:
         f.write("    case OGS_GTP2_%s_TYPE:\n" % v_upper(k))
-        f.write("        rv = ogs_tlv_parse_msg(&gtp2_message->%s,\n" % v_lower(k))
-        f.write("                &ogs_gtp2_tlv_desc_%s, pkbuf, OGS_TLV_MODE_T1_L2_I1);\n" % v_lower(k))
+        f.write("        rv = gtp2_parse_msg_%s(\n" % v_lower(k))
+        f.write("                &gtp2_message->%s,\n" % v_lower(k))
+        f.write("                pkbuf->data, pkbuf->len);\n")
         f.write("        break;\n")
 f.write("""    default:
+        if (pkbuf->len == 0) {
+            rv = OGS_OK;
+            break;
+        }
         ogs_warn("Not implmeneted(type:%d)", gtp2_message->h.type);
         break;
     }
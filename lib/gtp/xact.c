@@ -33,6 +33,8 @@ static uint32_t g_xact_id = 0;
 
 static OGS_POOL(pool, ogs_gtp_xact_t);
 
+static ogs_metrics_spec_t *rtt_spec = NULL;
+
 static ogs_gtp_xact_t *ogs_gtp_xact_remote_create(ogs_gtp_node_t *gnode, uint8_t gtp_version, uint32_t sqn);
 static ogs_gtp_xact_stage_t ogs_gtp2_xact_get_stage(uint8_t type, uint32_t xid);
 static ogs_gtp_xact_stage_t ogs_gtp1_xact_get_stage(uint8_t type, uint32_t xid);
@@ -43,6 +45,7 @@ static ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
 
 static void response_timeout(void *data);
 static void holding_timeout(void *data);
+static void observe_rtt(ogs_gtp_xact_t *xact);
 
 int ogs_gtp_xact_init(void)
 {
@@ -66,6 +69,16 @@ void ogs_gtp_xact_final(void)
     ogs_gtp_xact_initialized = 0;
 }
 
+void ogs_gtp_xact_metrics_open(void)
+{
+    const char *labels[] = { "peer" };
+
+    rtt_spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_HISTOGRAM, "gtp_peer_rtt_microseconds",
+            "GTP-C request round-trip time per peer", 0, 1, labels);
+    ogs_assert(rtt_spec);
+}
+
 ogs_gtp_xact_t *ogs_gtp1_xact_local_create(ogs_gtp_node_t *gnode,
         ogs_gtp1_header_t *hdesc, ogs_pkbuf_t *pkbuf,
         void (*cb)(ogs_gtp_xact_t *xact, void *data), void *data)
@@ -513,6 +526,8 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
                 return OGS_ERROR;
             }
 
+            observe_rtt(xact);
+
             if (xact->tm_holding)
                 ogs_timer_start(xact->tm_holding,
                         ogs_app()->time.message.gtp.t3_holding_duration);
@@ -524,6 +539,7 @@ static int ogs_gtp_xact_update_rx(ogs_gtp_xact_t *xact, uint8_t type)
                 ogs_error("invalid step[%d]", xact->step);
                 return OGS_ERROR;
             }
+            observe_rtt(xact);
             break;
 
         default:
@@ -654,6 +670,7 @@ int ogs_gtp_xact_commit(ogs_gtp_xact_t *xact)
             if (xact->tm_response)
                 ogs_timer_start(xact->tm_response,
                         ogs_app()->time.message.gtp.t3_response_duration);
+            xact->rtt_start = ogs_loop_monotonic_time();
 
             break;
 
@@ -735,6 +752,30 @@ int ogs_gtp_xact_commit(ogs_gtp_xact_t *xact)
     return OGS_OK;
 }
 
+static void observe_rtt(ogs_gtp_xact_t *xact)
+{
+    char buf[OGS_ADDRSTRLEN];
+    const char *peer = NULL;
+    ogs_gtp_node_t *gnode = NULL;
+
+    ogs_assert(xact);
+    gnode = xact->gnode;
+    ogs_assert(gnode);
+
+    if (!rtt_spec || !xact->rtt_start)
+        return;
+
+    if (!gnode->metrics_rtt) {
+        peer = OGS_ADDR(&gnode->addr, buf);
+        gnode->metrics_rtt = ogs_metrics_inst_new(rtt_spec, 1, &peer);
+        ogs_assert(gnode->metrics_rtt);
+    }
+
+    ogs_metrics_inst_observe(gnode->metrics_rtt,
+            ogs_loop_monotonic_time() - xact->rtt_start);
+    xact->rtt_start = 0;
+}
+
 static void response_timeout(void *data)
 {
     char buf[OGS_ADDRSTRLEN];
@@ -761,6 +802,9 @@ static void response_timeout(void *data)
         pkbuf = xact->seq[xact->step-1].pkbuf;
         ogs_assert(pkbuf);
 
+        /* A response to a retransmission is ambiguous, so skip it */
+        xact->rtt_start = 0;
+
         if (ogs_gtp_sendto(xact->gnode, pkbuf) != OGS_OK) {
             ogs_error("ogs_gtp_sendto() failed");
             goto out;
@@ -83,6 +83,7 @@ typedef struct ogs_gtp_xact_s {
 
     ogs_timer_t     *tm_response;   /**< Timer waiting for next message */
     uint8_t         response_rcount;
+    ogs_time_t      rtt_start;      /**< Request sent, 0 once retransmitted */
     ogs_timer_t     *tm_holding;    /**< Timer waiting for holding message */
     uint8_t         holding_rcount;
 
@@ -129,6 +130,7 @@ typedef struct ogs_gtp_xact_s {
 
 int ogs_gtp_xact_init(void);
 void ogs_gtp_xact_final(void);
+void ogs_gtp_xact_metrics_open(void);
 
 ogs_gtp_xact_t *ogs_gtp1_xact_local_create(ogs_gtp_node_t *gnode,
         ogs_gtp1_header_t *hdesc, ogs_pkbuf_t *pkbuf,
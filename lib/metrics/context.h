@@ -31,8 +31,59 @@ extern "C" {
 typedef enum ogs_metrics_metric_type_s  {
     OGS_METRICS_METRIC_TYPE_COUNTER,
     OGS_METRICS_METRIC_TYPE_GAUGE,
+    OGS_METRICS_METRIC_TYPE_HISTOGRAM,
 } ogs_metrics_metric_type_t;
 
+/*
+ * Histograms use fixed log-linear buckets. Values below
+ * OGS_METRICS_HISTOGRAM_SUB_BUCKETS get a bucket each, and every power
+ * of two above is split into OGS_METRICS_HISTOGRAM_SUB_BUCKETS linear
+ * steps, so a bucket is never wider than a quarter of its value.
+ * Values from 2^OGS_METRICS_HISTOGRAM_MAX_EXP on are only counted
+ * in the +Inf bucket.
+ */
+#define OGS_METRICS_HISTOGRAM_SUB_BITS 2
+#define OGS_METRICS_HISTOGRAM_SUB_BUCKETS (1 << OGS_METRICS_HISTOGRAM_SUB_BITS)
+#define OGS_METRICS_HISTOGRAM_MAX_EXP 24
+#define OGS_METRICS_HISTOGRAM_NUM_BUCKETS \
+    (OGS_METRICS_HISTOGRAM_SUB_BUCKETS * \
+     (OGS_METRICS_HISTOGRAM_MAX_EXP - OGS_METRICS_HISTOGRAM_SUB_BITS + 1))
+
+/* Returns OGS_METRICS_HISTOGRAM_NUM_BUCKETS for the +Inf bucket */
+static inline int ogs_metrics_histogram_bucket(uint64_t val)
+{
+    int exp;
+
+    if (val < OGS_METRICS_HISTOGRAM_SUB_BUCKETS)
+        return (int)val;
+
+    exp = 63 - __builtin_clzll(val);
+    if (exp >= OGS_METRICS_HISTOGRAM_MAX_EXP)
+        return OGS_METRICS_HISTOGRAM_NUM_BUCKETS;
+
+    return ((exp - OGS_METRICS_HISTOGRAM_SUB_BITS + 1) <<
+                OGS_METRICS_HISTOGRAM_SUB_BITS) +
+        (int)((val >> (exp - OGS_METRICS_HISTOGRAM_SUB_BITS)) &
+                (OGS_METRICS_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/* Inclusive upper bound of the bucket, i.e. its 'le' label */
+static inline uint64_t ogs_metrics_histogram_bound(int bucket)
+{
+    int shift;
+    uint64_t sub;
+
+    ogs_assert(bucket >= 0 && bucket < OGS_METRICS_HISTOGRAM_NUM_BUCKETS);
+
+    if (bucket < OGS_METRICS_HISTOGRAM_SUB_BUCKETS)
+        return bucket;
+
+    shift = (bucket >> OGS_METRICS_HISTOGRAM_SUB_BITS) - 1;
+    sub = bucket & (OGS_METRICS_HISTOGRAM_SUB_BUCKETS - 1);
+
+    return ((OGS_METRICS_HISTOGRAM_SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
 typedef struct ogs_metrics_context_s ogs_metrics_context_t;
 void ogs_metrics_context_init(void);
 void ogs_metrics_context_open(ogs_metrics_context_t *ctx);
@@ -48,6 +99,10 @@ ogs_metrics_spec_t *ogs_metrics_spec_new(
         int initial_val, unsigned int num_labels, const char **labels);
 void ogs_metrics_spec_free(ogs_metrics_spec_t *spec);
 
+/*
+ * Instances may be created, updated and freed from any thread.
+ * Specs are created at start-up, before any other thread runs.
+ */
 typedef struct ogs_metrics_inst_s ogs_metrics_inst_t;
 ogs_metrics_inst_t *ogs_metrics_inst_new(
         ogs_metrics_spec_t *spec,
@@ -56,6 +111,7 @@ void ogs_metrics_inst_free(ogs_metrics_inst_t *inst);
 void ogs_metrics_inst_set(ogs_metrics_inst_t *inst, int val);
 void ogs_metrics_inst_reset(ogs_metrics_inst_t *inst);
 void ogs_metrics_inst_add(ogs_metrics_inst_t *inst, int val);
+void ogs_metrics_inst_observe(ogs_metrics_inst_t *inst, uint64_t val);
 static inline void ogs_metrics_inst_inc(ogs_metrics_inst_t *inst)
 {
     ogs_metrics_inst_add(inst, 1);
@@ -26,6 +26,20 @@
 #define DEFAULT_PROMETHEUS_HTTP_PORT       9090
 #define MAX_LABELS 8
 
+/*
+ * Every instance keeps its value in MAX_NUM_OF_SHARD cache-line-aligned
+ * shards. A thread always updates the same shard with relaxed atomics,
+ * and the shards are only summed up when /metrics is scraped.
+ */
+#define MAX_NUM_OF_SHARD 8
+#define CACHE_LINE_SIZE 64
+
+#define SLOT_VALUE 0    /* COUNTER/GAUGE value, HISTOGRAM sum */
+#define SLOT_COUNT 1    /* HISTOGRAM count */
+#define SLOT_BUCKET 2   /* HISTOGRAM buckets */
+#define NUM_OF_HISTOGRAM_SLOT \
+    (SLOT_BUCKET + OGS_METRICS_HISTOGRAM_NUM_BUCKETS)
+
 typedef struct ogs_metrics_context_s {
     //uint32_t        port;      /* METRICS local port */
 
@@ -34,6 +48,9 @@ typedef struct ogs_metrics_context_s {
 
     ogs_list_t  spec_list;
     struct MHD_Daemon *mhd_server;
+
+    /* Guards the instance lists, values are never locked */
+    ogs_thread_mutex_t inst_lock;
 } ogs_metrics_context_t;
 
 typedef struct ogs_metrics_spec_s {
@@ -46,7 +63,6 @@ typedef struct ogs_metrics_spec_s {
     ogs_list_t                  inst_list; /* list of ogs_metrics_instance_t */
     unsigned int                num_labels;
     char                        *labels[MAX_LABELS];
-    prom_metric_t               *prom;
 } ogs_metrics_spec_t;
 
 typedef struct ogs_metrics_inst_s {
@@ -54,12 +70,25 @@ typedef struct ogs_metrics_inst_s {
     ogs_list_t              entry; /* included in ogs_metrics_spec_t spec */
     unsigned int            num_labels;
     char                    *label_values[MAX_LABELS];
+
+    void                    *mem;
+    uint8_t                 *shard; /* aligned to CACHE_LINE_SIZE */
+    size_t                  shard_size;
 } ogs_metrics_inst_t;
 
+typedef struct metrics_text_s {
+    char                    *buf; /* freed by MHD with free() */
+    size_t                  len;
+    size_t                  size;
+} metrics_text_t;
+
 static ogs_metrics_context_t self;
 static int context_initialized = 0;
 static OGS_POOL(metrics_spec_pool, ogs_metrics_spec_t);
 
+static __thread int shard_id = -1;
+static int next_shard_id = 0;
+
 void ogs_metrics_context_init(void)
 {
     ogs_assert(context_initialized == 0);
@@ -71,6 +100,7 @@ void ogs_metrics_context_init(void)
     /* Initialize METRICS context */
     memset(&self, 0, sizeof(ogs_metrics_context_t));
     ogs_list_init(&self.spec_list);
+    ogs_thread_mutex_init(&self.inst_lock);
     prom_collector_registry_default_init();
 
     context_initialized = 1;
@@ -95,6 +125,7 @@ void ogs_metrics_context_final(void)
     }
 
     ogs_pool_final(&metrics_spec_pool);
+    ogs_thread_mutex_destroy(&self.inst_lock);
 
     context_initialized = 0;
 }
@@ -193,6 +224,166 @@ static void mhd_server_notify_connection(void *cls,
     }
 }
 
+static int64_t *shard_slot(ogs_metrics_inst_t *inst, int shard)
+{
+    return (int64_t *)(inst->shard + shard * inst->shard_size);
+}
+
+static int64_t *local_slot(ogs_metrics_inst_t *inst)
+{
+    if (ogs_unlikely(shard_id < 0))
+        shard_id = __atomic_fetch_add(
+                &next_shard_id, 1, __ATOMIC_RELAXED) % MAX_NUM_OF_SHARD;
+
+    return shard_slot(inst, shard_id);
+}
+
+static int64_t sum_slot(ogs_metrics_inst_t *inst, int slot)
+{
+    int i;
+    int64_t sum = 0;
+
+    for (i = 0; i < MAX_NUM_OF_SHARD; i++)
+        sum += __atomic_load_n(&shard_slot(inst, i)[slot], __ATOMIC_RELAXED);
+
+    return sum;
+}
+
+static void text_printf(metrics_text_t *text, const char *fmt, ...)
+    OGS_GNUC_PRINTF(2, 3);
+
+static void text_printf(metrics_text_t *text, const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    while (1) {
+        va_start(ap, fmt);
+        n = vsnprintf(text->buf + text->len, text->size - text->len, fmt, ap);
+        va_end(ap);
+        ogs_assert(n >= 0);
+
+        if (text->len + n < text->size)
+            break;
+
+        text->size = ogs_max(text->size * 2, text->len + n + 1);
+        text->buf = realloc(text->buf, text->size);
+        ogs_assert(text->buf);
+    }
+    text->len += n;
+}
+
+static void text_labels(metrics_text_t *text,
+        ogs_metrics_inst_t *inst, const char *le)
+{
+    unsigned int i;
+    const char *p;
+
+    if (inst->num_labels == 0 && !le)
+        return;
+
+    text_printf(text, "{");
+    for (i = 0; i < inst->num_labels; i++) {
+        text_printf(text, "%s%s=\"", i ? "," : "", inst->spec->labels[i]);
+        for (p = inst->label_values[i]; *p; p++) {
+            if (*p == '\\' || *p == '"')
+                text_printf(text, "\\%c", *p);
+            else if (*p == '\n')
+                text_printf(text, "\\n");
+            else
+                text_printf(text, "%c", *p);
+        }
+        text_printf(text, "\"");
+    }
+    if (le)
+        text_printf(text, "%sle=\"%s\"", inst->num_labels ? "," : "", le);
+    text_printf(text, "}");
+}
+
+static void text_histogram(metrics_text_t *text, ogs_metrics_inst_t *inst)
+{
+    int i;
+    int64_t count = 0;
+    char le[24];
+    const char *name = inst->spec->name;
+
+    for (i = 0; i < OGS_METRICS_HISTOGRAM_NUM_BUCKETS; i++) {
+        count += sum_slot(inst, SLOT_BUCKET + i);
+        ogs_snprintf(le, sizeof(le), "%llu",
+                (unsigned long long)ogs_metrics_histogram_bound(i));
+
+        text_printf(text, "%s_bucket", name);
+        text_labels(text, inst, le);
+        text_printf(text, " %lld\n", (long long)count);
+    }
+
+    /* Read after the buckets so that +Inf is never below the last one */
+    count = ogs_max(count, sum_slot(inst, SLOT_COUNT));
+
+    text_printf(text, "%s_bucket", name);
+    text_labels(text, inst, "+Inf");
+    text_printf(text, " %lld\n", (long long)count);
+
+    text_printf(text, "%s_sum", name);
+    text_labels(text, inst, NULL);
+    text_printf(text, " %lld\n", (long long)sum_slot(inst, SLOT_VALUE));
+
+    text_printf(text, "%s_count", name);
+    text_labels(text, inst, NULL);
+    text_printf(text, " %lld\n", (long long)count);
+}
+
+static char *metrics_scrape(ogs_metrics_context_t *ctx)
+{
+    metrics_text_t text;
+    ogs_metrics_spec_t *spec = NULL;
+    ogs_metrics_inst_t *inst = NULL;
+    const char *type = NULL;
+
+    ogs_assert(ctx);
+
+    /* Process metrics collected by prometheus-client-c come first */
+    text.buf = (char *)prom_collector_registry_bridge(
+            PROM_COLLECTOR_REGISTRY_DEFAULT);
+    ogs_assert(text.buf);
+    text.len = strlen(text.buf);
+    text.size = text.len + 1;
+
+    ogs_thread_mutex_lock(&ctx->inst_lock);
+    ogs_list_for_each_entry(&ctx->spec_list, spec, entry) {
+        switch (spec->type) {
+        case OGS_METRICS_METRIC_TYPE_COUNTER:
+            type = "counter";
+            break;
+        case OGS_METRICS_METRIC_TYPE_GAUGE:
+            type = "gauge";
+            break;
+        case OGS_METRICS_METRIC_TYPE_HISTOGRAM:
+            type = "histogram";
+            break;
+        default:
+            ogs_assert_if_reached();
+            break;
+        }
+        text_printf(&text, "# HELP %s %s\n# TYPE %s %s\n",
+                spec->name, spec->description, spec->name, type);
+
+        ogs_list_for_each_entry(&spec->inst_list, inst, entry) {
+            if (spec->type == OGS_METRICS_METRIC_TYPE_HISTOGRAM) {
+                text_histogram(&text, inst);
+                continue;
+            }
+            text_printf(&text, "%s", spec->name);
+            text_labels(&text, inst, NULL);
+            text_printf(&text, " %lld\n",
+                    (long long)sum_slot(inst, SLOT_VALUE));
+        }
+    }
+    ogs_thread_mutex_unlock(&ctx->inst_lock);
+
+    return text.buf;
+}
+
 #if MHD_VERSION >= 0x00097001
 typedef enum MHD_Result _MHD_Result;
 #else
@@ -222,7 +413,7 @@ static _MHD_Result mhd_server_access_handler(void *cls, struct MHD_Connection *c
         return ret;
     }
     if (strcmp(url, "/metrics") == 0) {
-        buf = prom_collector_registry_bridge(PROM_COLLECTOR_REGISTRY_DEFAULT);
+        buf = metrics_scrape(cls);
         rsp = MHD_create_response_from_buffer(strlen(buf), (void *)buf, MHD_RESPMEM_MUST_FREE);
         ret = MHD_queue_response(connection, MHD_HTTP_OK, rsp);
         MHD_destroy_response(rsp);
@@ -363,18 +554,13 @@ ogs_metrics_spec_t *ogs_metrics_spec_new(
 
     switch (type) {
     case OGS_METRICS_METRIC_TYPE_COUNTER:
-        spec->prom = prom_counter_new(spec->name, spec->description,
-                                      spec->num_labels, (const char **)spec->labels);
-        break;
     case OGS_METRICS_METRIC_TYPE_GAUGE:
-        spec->prom = prom_gauge_new(spec->name, spec->description,
-                                    spec->num_labels, (const char **)spec->labels);
+    case OGS_METRICS_METRIC_TYPE_HISTOGRAM:
         break;
     default:
         ogs_assert_if_reached();
         break;
     }
-    prom_collector_registry_must_register_metric(spec->prom);
 
     ogs_list_add(&ctx->spec_list, &spec->entry);
     return spec;
@@ -406,6 +592,7 @@ ogs_metrics_inst_t *ogs_metrics_inst_new(
 {
     ogs_metrics_inst_t *inst;
     unsigned int i;
+    size_t slots = 1;
 
     ogs_assert(spec);
     ogs_assert(num_labels == spec->num_labels);
@@ -418,8 +605,23 @@ ogs_metrics_inst_t *ogs_metrics_inst_new(
         ogs_assert(label_values[i]);
         inst->label_values[i] = ogs_strdup(label_values[i]);
     }
-    ogs_list_add(&spec->inst_list, &inst->entry);
+
+    if (spec->type == OGS_METRICS_METRIC_TYPE_HISTOGRAM)
+        slots = NUM_OF_HISTOGRAM_SLOT;
+    inst->shard_size = ((slots * sizeof(int64_t) + CACHE_LINE_SIZE - 1) /
+            CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+
+    inst->mem = ogs_calloc(1,
+            inst->shard_size * MAX_NUM_OF_SHARD + CACHE_LINE_SIZE - 1);
+    ogs_assert(inst->mem);
+    inst->shard = (uint8_t *)(((uintptr_t)inst->mem + CACHE_LINE_SIZE - 1) &
+            ~(uintptr_t)(CACHE_LINE_SIZE - 1));
+
     ogs_metrics_inst_reset(inst);
+
+    ogs_thread_mutex_lock(&spec->ctx->inst_lock);
+    ogs_list_add(&spec->inst_list, &inst->entry);
+    ogs_thread_mutex_unlock(&spec->ctx->inst_lock);
     return inst;
 }
 
@@ -427,19 +629,40 @@ void ogs_metrics_inst_free(ogs_metrics_inst_t *inst)
 {
     unsigned int i;
 
+    ogs_thread_mutex_lock(&inst->spec->ctx->inst_lock);
     ogs_list_remove(&inst->spec->inst_list, &inst->entry);
+    ogs_thread_mutex_unlock(&inst->spec->ctx->inst_lock);
 
     for (i = 0; i < inst->num_labels; i++)
         ogs_free(inst->label_values[i]);
 
+    ogs_free(inst->mem);
     ogs_free(inst);
 }
 
+/*
+ * Gauges are meant to be set by a single thread. The value goes
+ * to its shard and the other shards are cleared, so an add racing
+ * on another thread may be lost.
+ */
+static void store_value(ogs_metrics_inst_t *inst, int64_t val)
+{
+    int i;
+    int64_t *local = local_slot(inst);
+
+    for (i = 0; i < MAX_NUM_OF_SHARD; i++) {
+        int64_t *slot = shard_slot(inst, i);
+        if (slot != local)
+            __atomic_store_n(&slot[SLOT_VALUE], 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&local[SLOT_VALUE], val, __ATOMIC_RELAXED);
+}
+
 void ogs_metrics_inst_set(ogs_metrics_inst_t *inst, int val)
 {
     switch (inst->spec->type) {
     case OGS_METRICS_METRIC_TYPE_GAUGE:
-        prom_gauge_set(inst->spec->prom, (double)val, (const char **)inst->label_values);
+        store_value(inst, val);
         break;
     default:
         ogs_assert_if_reached();
@@ -449,12 +672,22 @@ void ogs_metrics_inst_set(ogs_metrics_inst_t *inst, int val)
 
 void ogs_metrics_inst_reset(ogs_metrics_inst_t *inst)
 {
+    int i, j;
+    int64_t *slot = NULL;
+
     switch (inst->spec->type) {
     case OGS_METRICS_METRIC_TYPE_COUNTER:
-        prom_counter_add(inst->spec->prom, 0.0, (const char **)inst->label_values);
+        store_value(inst, 0);
         break;
     case OGS_METRICS_METRIC_TYPE_GAUGE:
-        prom_gauge_set(inst->spec->prom, (double)inst->spec->initial_val, (const char **)inst->label_values);
+        store_value(inst, inst->spec->initial_val);
+        break;
+    case OGS_METRICS_METRIC_TYPE_HISTOGRAM:
+        for (i = 0; i < MAX_NUM_OF_SHARD; i++) {
+            slot = shard_slot(inst, i);
+            for (j = 0; j < NUM_OF_HISTOGRAM_SLOT; j++)
+                __atomic_store_n(&slot[j], 0, __ATOMIC_RELAXED);
+        }
         break;
     default:
         /* Other types have no way to reset */
@@ -467,16 +700,30 @@ void ogs_metrics_inst_add(ogs_metrics_inst_t *inst, int val)
     switch (inst->spec->type) {
     case OGS_METRICS_METRIC_TYPE_COUNTER:
         ogs_assert(val >= 0);
-        prom_counter_add(inst->spec->prom, (double)val, (const char **)inst->label_values);
-        break;
+        /* fallthrough */
     case OGS_METRICS_METRIC_TYPE_GAUGE:
-        if (val >= 0)
-            prom_gauge_add(inst->spec->prom, (double)val, (const char **)inst->label_values);
-        else
-            prom_gauge_sub(inst->spec->prom, (double)-1.0*(double)val, (const char **)inst->label_values);
+        __atomic_fetch_add(&local_slot(inst)[SLOT_VALUE],
+                (int64_t)val, __ATOMIC_RELAXED);
         break;
     default:
         ogs_assert_if_reached();
         break;
     }
 }
+
+void ogs_metrics_inst_observe(ogs_metrics_inst_t *inst, uint64_t val)
+{
+    int64_t *slot = NULL;
+    int bucket;
+
+    ogs_assert(inst->spec->type == OGS_METRICS_METRIC_TYPE_HISTOGRAM);
+
+    slot = local_slot(inst);
+    bucket = ogs_metrics_histogram_bucket(val);
+    __atomic_fetch_add(&slot[SLOT_VALUE], (int64_t)val, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot[SLOT_COUNT], 1, __ATOMIC_RELAXED);
+
+    /* +Inf has no slot of its own, it is SLOT_COUNT at scrape time */
+    if (bucket < OGS_METRICS_HISTOGRAM_NUM_BUCKETS)
+        __atomic_fetch_add(&slot[SLOT_BUCKET + bucket], 1, __ATOMIC_RELAXED);
+}
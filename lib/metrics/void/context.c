@@ -97,3 +97,7 @@ void ogs_metrics_inst_reset(ogs_metrics_inst_t *inst)
 void ogs_metrics_inst_add(ogs_metrics_inst_t *inst, int val)
 {
 }
+
+void ogs_metrics_inst_observe(ogs_metrics_inst_t *inst, uint64_t val)
+{
+}
@@ -35,8 +35,13 @@ static OGS_POOL(ogs_pfcp_bar_pool, ogs_pfcp_bar_t);
 
 static OGS_POOL(ogs_pfcp_dev_pool, ogs_pfcp_dev_t);
 static OGS_POOL(ogs_pfcp_subnet_pool, ogs_pfcp_subnet_t);
+static OGS_POOL(ogs_pfcp_ue_ip_pool, ogs_pfcp_ue_ip_t);
 static OGS_POOL(ogs_pfcp_rule_pool, ogs_pfcp_rule_t);
 
+static ogs_metrics_spec_t *sessions_spec = NULL;
+static ogs_metrics_spec_t *load_spec = NULL;
+static ogs_metrics_spec_t *overload_reduction_spec = NULL;
+
 void ogs_pfcp_context_init(void)
 {
     ogs_assert(context_initialized == 0);
@@ -46,29 +51,34 @@ void ogs_pfcp_context_init(void)
 
     self.pfcp_started = ogs_time_ntp32_now();
 
+    ogs_list_init(&self.buffer.far_list);
+    ogs_list_init(&self.buffer.report_list);
+
     ogs_log_install_domain(&__ogs_pfcp_domain, "pfcp", ogs_core()->log.level);
 
     ogs_pool_init(&ogs_pfcp_node_pool, ogs_app()->pool.nf);
 
-    ogs_pool_init(&ogs_pfcp_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_init_growable(&ogs_pfcp_sess_pool, ogs_app()->pool.sess);
 
-    ogs_pool_init(&ogs_pfcp_pdr_pool,
+    ogs_pool_init_growable(&ogs_pfcp_pdr_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_PDR);
-    ogs_pool_init(&ogs_pfcp_far_pool,
+    ogs_pool_init_growable(&ogs_pfcp_far_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_FAR);
-    ogs_pool_init(&ogs_pfcp_urr_pool,
+    ogs_pool_init_growable(&ogs_pfcp_urr_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_URR);
-    ogs_pool_init(&ogs_pfcp_qer_pool,
+    ogs_pool_init_growable(&ogs_pfcp_qer_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_QER);
-    ogs_pool_init(&ogs_pfcp_bar_pool,
+    ogs_pool_init_growable(&ogs_pfcp_bar_pool,
             ogs_app()->pool.sess * OGS_MAX_NUM_OF_BAR);
 
-    ogs_pool_init(&ogs_pfcp_rule_pool,
+    ogs_pool_init_growable(&ogs_pfcp_rule_pool,
             ogs_app()->pool.sess *
             OGS_MAX_NUM_OF_PDR * OGS_MAX_NUM_OF_FLOW_IN_PDR);
 
     ogs_pool_init(&ogs_pfcp_dev_pool, OGS_MAX_NUM_OF_DEV);
     ogs_pool_init(&ogs_pfcp_subnet_pool, OGS_MAX_NUM_OF_SUBNET);
+    /* An IPv4 and an IPv6 address per session */
+    ogs_pool_init(&ogs_pfcp_ue_ip_pool, ogs_app()->pool.sess * 2);
 
     self.object_teid_hash = ogs_hash_make();
     ogs_assert(self.object_teid_hash);
@@ -94,8 +104,12 @@ void ogs_pfcp_context_final(void)
     ogs_pfcp_dev_remove_all();
     ogs_pfcp_subnet_remove_all();
 
+    if (self.buffer.t_expire)
+        ogs_timer_delete(self.buffer.t_expire);
+
     ogs_pool_final(&ogs_pfcp_dev_pool);
     ogs_pool_final(&ogs_pfcp_subnet_pool);
+    ogs_pool_final(&ogs_pfcp_ue_ip_pool);
     ogs_pool_final(&ogs_pfcp_rule_pool);
 
     ogs_pool_final(&ogs_pfcp_sess_pool);
@@ -123,6 +137,11 @@ static int ogs_pfcp_context_prepare(void)
 
     self.tun_ifname = "ogstun";
 
+    /* At most half of the packet pool is held by buffering */
+    self.buffer.max_size = (size_t)ogs_app()->pool.packet * OGS_MAX_PKT_LEN / 2;
+    self.buffer.sess_max_size = OGS_MAX_NUM_OF_PACKET_BUFFER * OGS_MAX_PKT_LEN;
+    self.buffer.validity = ogs_time_from_sec(10);
+
     return OGS_OK;
 }
 
@@ -136,6 +155,41 @@ static int ogs_pfcp_context_validation(const char *local)
     return OGS_OK;
 }
 
+static int subnet_range_parse(ogs_yaml_iter_t *subnet_iter,
+        const char **low, const char **high, int num)
+{
+    ogs_yaml_iter_t range_iter;
+
+    ogs_yaml_iter_recurse(subnet_iter, &range_iter);
+    ogs_assert(ogs_yaml_iter_type(&range_iter) != YAML_MAPPING_NODE);
+    do {
+        char *v = NULL;
+
+        if (ogs_yaml_iter_type(&range_iter) == YAML_SEQUENCE_NODE) {
+            if (!ogs_yaml_iter_next(&range_iter))
+                break;
+        }
+
+        ogs_assert(num < OGS_MAX_NUM_OF_SUBNET_RANGE);
+        low[num] = high[num] = NULL;
+
+        v = (char *)ogs_yaml_iter_value(&range_iter);
+        if (v) {
+            low[num] = (const char *)strsep(&v, "-");
+            if (low[num] && strlen(low[num]) == 0)
+                low[num] = NULL;
+
+            high[num] = (const char *)v;
+            if (high[num] && strlen(high[num]) == 0)
+                high[num] = NULL;
+        }
+
+        if (low[num] || high[num]) num++;
+    } while (ogs_yaml_iter_type(&range_iter) == YAML_SEQUENCE_NODE);
+
+    return num;
+}
+
 int ogs_pfcp_context_parse_config(const char *local, const char *remote)
 {
     int rv;
@@ -287,6 +341,26 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                                 NULL, self.pfcp_port, NULL);
                         ogs_assert(rv == OGS_OK);
                     }
+                } else if (!strcmp(local_key, "buffer")) {
+                    ogs_yaml_iter_t buffer_iter;
+                    ogs_yaml_iter_recurse(&local_iter, &buffer_iter);
+                    while (ogs_yaml_iter_next(&buffer_iter)) {
+                        const char *buffer_key =
+                            ogs_yaml_iter_key(&buffer_iter);
+                        const char *v = ogs_yaml_iter_value(&buffer_iter);
+                        ogs_assert(buffer_key);
+                        if (!strcmp(buffer_key, "size")) {
+                            if (v) self.buffer.max_size = atoll(v);
+                        } else if (!strcmp(buffer_key, "session_size")) {
+                            if (v) self.buffer.sess_max_size = atoll(v);
+                        } else if (!strcmp(buffer_key, "validity")) {
+                            if (v) self.buffer.validity =
+                                ogs_time_from_sec(atoi(v));
+                        } else if (!strcmp(buffer_key, "report_rate")) {
+                            if (v) self.buffer.report_rate = atoi(v);
+                        } else
+                            ogs_warn("unknown key `%s`", buffer_key);
+                    }
                 } else if (!strcmp(local_key, "subnet")) {
                     ogs_yaml_iter_t subnet_array, subnet_iter;
                     ogs_yaml_iter_recurse(&local_iter, &subnet_array);
@@ -299,7 +373,9 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                         const char *dev = self.tun_ifname;
                         const char *low[OGS_MAX_NUM_OF_SUBNET_RANGE];
                         const char *high[OGS_MAX_NUM_OF_SUBNET_RANGE];
-                        int i, num = 0;
+                        const char *reserved_low[OGS_MAX_NUM_OF_SUBNET_RANGE];
+                        const char *reserved_high[OGS_MAX_NUM_OF_SUBNET_RANGE];
+                        int i, num = 0, num_of_reserved = 0;
 
                         if (ogs_yaml_iter_type(&subnet_array) ==
                                 YAML_MAPPING_NODE) {
@@ -335,39 +411,13 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                             } else if (!strcmp(subnet_key, "dev")) {
                                 dev = ogs_yaml_iter_value(&subnet_iter);
                             } else if (!strcmp(subnet_key, "range")) {
-                                ogs_yaml_iter_t range_iter;
-                                ogs_yaml_iter_recurse(
-                                        &subnet_iter, &range_iter);
-                                ogs_assert(ogs_yaml_iter_type(&range_iter) !=
-                                    YAML_MAPPING_NODE);
-                                do {
-                                    char *v = NULL;
-
-                                    if (ogs_yaml_iter_type(&range_iter) ==
-                                            YAML_SEQUENCE_NODE) {
-                                        if (!ogs_yaml_iter_next(&range_iter))
-                                            break;
-                                    }
-
-                                    v = (char *)
-                                        ogs_yaml_iter_value(&range_iter);
-                                    if (v) {
-                                        ogs_assert(num <
-                                                OGS_MAX_NUM_OF_SUBNET_RANGE);
-                                        low[num] =
-                                            (const char *)strsep(&v, "-");
-                                        if (low[num] && strlen(low[num]) == 0)
-                                            low[num] = NULL;
-
-                                        high[num] = (const char *)v;
-                                        if (high[num] && strlen(high[num]) == 0)
-                                            high[num] = NULL;
-                                    }
-
-                                    if (low[num] || high[num]) num++;
-                                } while (
-                                    ogs_yaml_iter_type(&range_iter) ==
-                                    YAML_SEQUENCE_NODE);
+                                num = subnet_range_parse(
+                                        &subnet_iter, low, high, num);
+                            } else if (!strcmp(subnet_key, "reserved")) {
+                                num_of_reserved = subnet_range_parse(
+                                        &subnet_iter,
+                                        reserved_low, reserved_high,
+                                        num_of_reserved);
                             } else
                                 ogs_warn("unknown key `%s`", subnet_key);
                         }
@@ -382,6 +432,12 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                             subnet->range[i].high = high[i];
                         }
 
+                        subnet->num_of_reserved = num_of_reserved;
+                        for (i = 0; i < subnet->num_of_reserved; i++) {
+                            subnet->reserved[i].low = reserved_low[i];
+                            subnet->reserved[i].high = reserved_high[i];
+                        }
+
                     } while (ogs_yaml_iter_type(&subnet_array) ==
                             YAML_SEQUENCE_NODE);
                 }
@@ -413,6 +469,7 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
 
                         /* full list RR enabled by default */
                         uint8_t rr_enable = 1;
+                        uint16_t capacity = 100;
 
                         if (ogs_yaml_iter_type(&pfcp_array) ==
                                 YAML_MAPPING_NODE) {
@@ -578,6 +635,9 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                             } else if (!strcmp(pfcp_key, "rr")) {
                                 const char *v = ogs_yaml_iter_value(&pfcp_iter);
                                 if (v) rr_enable = atoi(v);
+                            } else if (!strcmp(pfcp_key, "capacity")) {
+                                const char *v = ogs_yaml_iter_value(&pfcp_iter);
+                                if (v) capacity = atoi(v);
                             } else
                                 ogs_warn("unknown key `%s`", pfcp_key);
                         }
@@ -619,6 +679,7 @@ int ogs_pfcp_context_parse_config(const char *local, const char *remote)
                                     sizeof(node->nr_cell_id));
 
                         node->rr_enable = rr_enable;
+                        node->capacity = capacity;
                     } while (ogs_yaml_iter_type(&pfcp_array) ==
                             YAML_SEQUENCE_NODE);
                 }
@@ -649,6 +710,8 @@ ogs_pfcp_node_t *ogs_pfcp_node_new(ogs_sockaddr_t *sa_list)
 
     ogs_list_init(&node->gtpu_resource_list);
 
+    node->capacity = 100;
+
     return node;
 }
 
@@ -660,6 +723,15 @@ void ogs_pfcp_node_free(ogs_pfcp_node_t *node)
 
     ogs_pfcp_xact_delete_all(node);
 
+    if (node->metrics_rtt)
+        ogs_metrics_inst_free(node->metrics_rtt);
+    if (node->metrics.sessions)
+        ogs_metrics_inst_free(node->metrics.sessions);
+    if (node->metrics.load)
+        ogs_metrics_inst_free(node->metrics.load);
+    if (node->metrics.overload_reduction)
+        ogs_metrics_inst_free(node->metrics.overload_reduction);
+
     ogs_freeaddrinfo(node->sa_list);
     ogs_pool_free(&ogs_pfcp_node_pool, node);
 }
@@ -719,6 +791,129 @@ void ogs_pfcp_node_remove_all(ogs_list_t *list)
         ogs_pfcp_node_remove(list, node);
 }
 
+void ogs_pfcp_node_metrics_open(void)
+{
+    const char *labels[] = { "peer" };
+
+    sessions_spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_GAUGE, "pfcp_peer_sessions",
+            "Sessions set up per PFCP peer", 0, 1, labels);
+    ogs_assert(sessions_spec);
+    load_spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_GAUGE, "pfcp_peer_load",
+            "Load metric reported by PFCP peer", 0, 1, labels);
+    ogs_assert(load_spec);
+    overload_reduction_spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_GAUGE, "pfcp_peer_overload_reduction",
+            "Overload reduction metric reported by PFCP peer", 0, 1, labels);
+    ogs_assert(overload_reduction_spec);
+}
+
+static void node_metrics_set(ogs_pfcp_node_t *node,
+        ogs_metrics_spec_t *spec, ogs_metrics_inst_t **inst, int val)
+{
+    char buf[OGS_ADDRSTRLEN];
+    const char *peer = NULL;
+
+    if (!spec)
+        return;
+
+    if (!*inst) {
+        peer = OGS_ADDR(&node->addr, buf);
+        *inst = ogs_metrics_inst_new(spec, 1, &peer);
+        ogs_assert(*inst);
+    }
+
+    ogs_metrics_inst_set(*inst, val);
+}
+
+void ogs_pfcp_node_sess_inc(ogs_pfcp_node_t *node)
+{
+    ogs_assert(node);
+
+    node->num_of_sess++;
+    node_metrics_set(node, sessions_spec,
+            &node->metrics.sessions, node->num_of_sess);
+}
+
+void ogs_pfcp_node_sess_dec(ogs_pfcp_node_t *node)
+{
+    ogs_assert(node);
+    ogs_assert(node->num_of_sess > 0);
+
+    node->num_of_sess--;
+    node_metrics_set(node, sessions_spec,
+            &node->metrics.sessions, node->num_of_sess);
+}
+
+/*
+ * TS 29.244 6.2.5.2 / 6.2.6.2: a report is applied only if its sequence
+ * number is newer than the one of the report currently in use
+ */
+#define SEQUENCE_NUMBER_IS_NEWER(__nEW, __oLD) \
+    ((int32_t)((__nEW) - (__oLD)) > 0)
+
+void ogs_pfcp_node_set_load(ogs_pfcp_node_t *node,
+        uint32_t sequence_number, uint8_t metric)
+{
+    ogs_assert(node);
+
+    if (node->load.presence &&
+        !SEQUENCE_NUMBER_IS_NEWER(
+            sequence_number, node->load.sequence_number))
+        return;
+
+    node->load.presence = true;
+    node->load.sequence_number = sequence_number;
+    node->load.metric = ogs_min(metric, 100);
+
+    node_metrics_set(node, load_spec, &node->metrics.load, node->load.metric);
+}
+
+void ogs_pfcp_node_set_overload(ogs_pfcp_node_t *node,
+        uint32_t sequence_number, uint8_t reduction, ogs_time_t validity)
+{
+    ogs_assert(node);
+
+    if (node->overload.presence &&
+        !SEQUENCE_NUMBER_IS_NEWER(
+            sequence_number, node->overload.sequence_number))
+        return;
+
+    node->overload.presence = true;
+    node->overload.sequence_number = sequence_number;
+    node->overload.reduction = ogs_min(reduction, 100);
+    node->overload.expires =
+        validity ? ogs_get_monotonic_time() + validity : 0;
+
+    node_metrics_set(node, overload_reduction_spec,
+            &node->metrics.overload_reduction, node->overload.reduction);
+}
+
+int ogs_pfcp_node_weight(ogs_pfcp_node_t *node)
+{
+    int weight;
+
+    ogs_assert(node);
+
+    weight = node->capacity;
+
+    if (node->load.presence)
+        weight = weight * (100 - node->load.metric) / 100;
+
+    if (node->overload.presence && node->overload.expires &&
+        node->overload.expires <= ogs_get_monotonic_time()) {
+        node->overload.reduction = 0;
+        node->overload.expires = 0;
+        node_metrics_set(node, overload_reduction_spec,
+                &node->metrics.overload_reduction, 0);
+    }
+    if (node->overload.presence)
+        weight = weight * (100 - node->overload.reduction) / 100;
+
+    return weight;
+}
+
 ogs_gtpu_resource_t *ogs_pfcp_find_gtpu_resource(ogs_list_t *list,
         char *dnn, ogs_pfcp_interface_t source_interface)
 {
@@ -1044,6 +1239,8 @@ ogs_pfcp_far_t *ogs_pfcp_far_add(ogs_pfcp_sess_t *sess)
 
     far->dst_if = OGS_PFCP_INTERFACE_UNKNOWN;
 
+    ogs_list_init(&far->buffer.queue);
+
     far->sess = sess;
     ogs_list_add(&sess->far_list, far);
 
@@ -1205,7 +1402,6 @@ ogs_pfcp_far_t *ogs_pfcp_far_find_by_teid(uint32_t teid)
 
 void ogs_pfcp_far_remove(ogs_pfcp_far_t *far)
 {
-    int i;
     ogs_pfcp_sess_t *sess = NULL;
 
     ogs_assert(far);
@@ -1225,8 +1421,7 @@ void ogs_pfcp_far_remove(ogs_pfcp_far_t *far)
     if (far->dnn)
         ogs_free(far->dnn);
 
-    for (i = 0; i < far->num_of_buffered_packet; i++)
-        ogs_pkbuf_free(far->buffered_packet[i]);
+    ogs_pfcp_far_remove_buffered_packets(far);
 
     if (far->id_node)
         ogs_pool_free(&far->sess->far_id_pool, far->id_node);
@@ -1244,6 +1439,230 @@ void ogs_pfcp_far_remove_all(ogs_pfcp_sess_t *sess)
         ogs_pfcp_far_remove(far);
 }
 
+/*
+ * A buffered packet keeps the cluster it was received in,
+ * so that is what counts against the limits.
+ */
+#define BUFFERED_SIZE(__pKBUF) ((size_t)((__pKBUF)->end - (__pKBUF)->head))
+/* The time a packet was buffered */
+#define BUFFERED_TIME(__pKBUF) ((__pKBUF)->param[0])
+
+static void buffer_metrics_add(int packets, ssize_t bytes)
+{
+    if (self.metrics.buffered_packets)
+        ogs_metrics_inst_add(self.metrics.buffered_packets, packets);
+    if (self.metrics.buffered_bytes)
+        ogs_metrics_inst_add(self.metrics.buffered_bytes, (int)bytes);
+}
+
+static void buffer_unlink(ogs_pfcp_far_t *far, ogs_pkbuf_t *pkbuf)
+{
+    size_t size = BUFFERED_SIZE(pkbuf);
+
+    ogs_assert(far->sess);
+
+    ogs_list_remove(&far->buffer.queue, pkbuf);
+    far->buffer.num_of_packet--;
+    far->buffer.size -= size;
+    far->sess->buffered_size -= size;
+    self.buffer.size -= size;
+
+    if (ogs_list_empty(&far->buffer.queue))
+        ogs_list_remove(&self.buffer.far_list, &far->buffer.lnode);
+
+    buffer_metrics_add(-1, -(ssize_t)size);
+}
+
+static bool buffer_report_allowed(void);
+static void buffer_expire(void *data);
+
+static void buffer_report_cancel(ogs_pfcp_far_t *far)
+{
+    if (!far->buffer.report_pending)
+        return;
+
+    ogs_list_remove(&self.buffer.report_list, &far->buffer.report_node);
+    far->buffer.report_pending = false;
+}
+
+/* Sends the held-back reports, oldest first, as report_rate allows */
+static void buffer_report_pending(void)
+{
+    ogs_lnode_t *lnode = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_user_plane_report_t report;
+
+    while ((lnode = ogs_list_first(&self.buffer.report_list))) {
+        if (buffer_report_allowed() == false)
+            break;
+
+        far = ogs_list_entry(lnode, ogs_pfcp_far_t, buffer.report_node);
+
+        buffer_report_cancel(far);
+        far->buffer.reported = true;
+
+        memset(&report, 0, sizeof(report));
+        report.type.downlink_data_report = 1;
+        report.downlink_data.pdr_id = far->buffer.pdr_id;
+        report.downlink_data.qfi = far->buffer.qfi;
+
+        ogs_assert(far->sess);
+        ogs_assert(self.buffer.send_report);
+        if (self.buffer.send_report(far->sess, &report) != OGS_OK)
+            ogs_error("Cannot send Downlink Data Report");
+    }
+}
+
+static void buffer_timer_start(void)
+{
+    if (!self.buffer.t_expire) {
+        self.buffer.t_expire =
+            ogs_timer_add(ogs_app()->timer_mgr, buffer_expire, NULL);
+        ogs_assert(self.buffer.t_expire);
+    }
+    if (!self.buffer.t_expire->running)
+        ogs_timer_start(self.buffer.t_expire, ogs_time_from_sec(1));
+}
+
+static void buffer_expire(void *data)
+{
+    ogs_pfcp_far_t *far = NULL, *next_far = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_time_t now = ogs_loop_monotonic_time();
+
+    buffer_report_pending();
+
+    ogs_list_for_each_entry_safe(
+            &self.buffer.far_list, next_far, far, buffer.lnode) {
+        while ((pkbuf = ogs_list_first(&far->buffer.queue)) &&
+                now - (ogs_time_t)BUFFERED_TIME(pkbuf) >=
+                    self.buffer.validity) {
+            buffer_unlink(far, pkbuf);
+            ogs_pkbuf_free(pkbuf);
+            if (self.metrics.buffer_expired)
+                ogs_metrics_inst_inc(self.metrics.buffer_expired);
+        }
+
+        /* The UE was not reached, report again on the next packet */
+        if (ogs_list_empty(&far->buffer.queue))
+            far->buffer.reported = false;
+    }
+
+    if (ogs_list_first(&self.buffer.far_list) ||
+        ogs_list_first(&self.buffer.report_list))
+        ogs_timer_start(self.buffer.t_expire, ogs_time_from_sec(1));
+}
+
+static bool buffer_report_allowed(void)
+{
+    ogs_time_t now;
+
+    if (!self.buffer.report_rate)
+        return true;
+
+    now = ogs_loop_monotonic_time();
+    if (now - self.buffer.report_window >= ogs_time_from_sec(1)) {
+        self.buffer.report_window = now;
+        self.buffer.num_of_report = 0;
+    }
+
+    if (self.buffer.num_of_report >= self.buffer.report_rate)
+        return false;
+
+    self.buffer.num_of_report++;
+    return true;
+}
+
+bool ogs_pfcp_far_buffer_packet(ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *pkbuf)
+{
+    ogs_pfcp_sess_t *sess = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    bool report = false;
+    size_t size;
+
+    ogs_assert(pdr);
+    ogs_assert(pkbuf);
+    far = pdr->far;
+    ogs_assert(far);
+    sess = far->sess;
+    ogs_assert(sess);
+
+    /*
+     * Only the first packet while the UE is idle reports downlink
+     * notifications. A report held back by report_rate is sent
+     * from the buffer timer, or on a later packet if that comes first.
+     */
+    if (!far->buffer.reported) {
+        if (buffer_report_allowed()) {
+            buffer_report_cancel(far);
+            far->buffer.reported = true;
+            report = true;
+        } else if (!far->buffer.report_pending && self.buffer.send_report) {
+            far->buffer.pdr_id = pdr->id;
+            far->buffer.qfi = pdr->qer ? pdr->qer->qfi : 0;
+            ogs_list_add(&self.buffer.report_list, &far->buffer.report_node);
+            far->buffer.report_pending = true;
+            buffer_timer_start();
+        }
+    }
+
+    size = BUFFERED_SIZE(pkbuf);
+    if (sess->buffered_size + size > self.buffer.sess_max_size ||
+        self.buffer.size + size > self.buffer.max_size) {
+        ogs_pkbuf_free(pkbuf);
+        if (self.metrics.buffer_full)
+            ogs_metrics_inst_inc(self.metrics.buffer_full);
+        return report;
+    }
+
+    buffer_timer_start();
+
+    if (ogs_list_empty(&far->buffer.queue))
+        ogs_list_add(&self.buffer.far_list, &far->buffer.lnode);
+
+    BUFFERED_TIME(pkbuf) = ogs_loop_monotonic_time();
+    ogs_list_add(&far->buffer.queue, pkbuf);
+    far->buffer.num_of_packet++;
+    far->buffer.size += size;
+    sess->buffered_size += size;
+    self.buffer.size += size;
+
+    buffer_metrics_add(1, size);
+
+    return report;
+}
+
+ogs_pkbuf_t *ogs_pfcp_far_dequeue_buffered_packet(ogs_pfcp_far_t *far)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    ogs_assert(far);
+
+    /* The UE is reachable again */
+    buffer_report_cancel(far);
+    far->buffer.reported = false;
+
+    pkbuf = ogs_list_first(&far->buffer.queue);
+    if (pkbuf)
+        buffer_unlink(far, pkbuf);
+
+    return pkbuf;
+}
+
+void ogs_pfcp_far_remove_buffered_packets(ogs_pfcp_far_t *far)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    ogs_assert(far);
+
+    while ((pkbuf = ogs_list_first(&far->buffer.queue))) {
+        buffer_unlink(far, pkbuf);
+        ogs_pkbuf_free(pkbuf);
+    }
+    buffer_report_cancel(far);
+    far->buffer.reported = false;
+}
+
 ogs_pfcp_urr_t *ogs_pfcp_urr_add(ogs_pfcp_sess_t *sess)
 {
     ogs_pfcp_urr_t *urr = NULL;
@@ -1510,98 +1929,156 @@ void ogs_pfcp_rule_remove_all(ogs_pfcp_pdr_t *pdr)
         ogs_pfcp_rule_remove(rule);
 }
 
+/*
+ * An IPv4 address or an IPv6 /64 prefix as a number,
+ * so that a range of them maps onto bitmap indexes.
+ */
+static uint64_t ue_ip_number(int family, uint32_t *addr)
+{
+    if (family == AF_INET)
+        return be32toh(addr[0]);
+
+    return ((uint64_t)be32toh(addr[0]) << 32) | be32toh(addr[1]);
+}
+
+static void ue_ip_from_number(
+        int family, uint32_t *addr, uint64_t number, uint32_t index)
+{
+    memset(addr, 0, OGS_IPV6_LEN);
+
+    if (family == AF_INET) {
+        addr[0] = htobe32((uint32_t)number);
+    } else {
+        addr[0] = htobe32((uint32_t)(number >> 32));
+        addr[1] = htobe32((uint32_t)number);
+        /* Allocate Full IPv6 Address */
+        addr[3] = htobe32(index + 1);
+    }
+}
+
+static uint64_t ue_ip_number_from_string(int family, const char *str)
+{
+    int rv;
+    ogs_ipsubnet_t ipsub;
+
+    rv = ogs_ipsubnet(&ipsub, str, NULL);
+    ogs_assert(rv == OGS_OK);
+
+    return ue_ip_number(family, ipsub.sub);
+}
+
+static void ue_pool_reserve(ogs_pfcp_subnet_t *subnet, int poolindex,
+        uint64_t end, uint64_t first, uint64_t last)
+{
+    uint64_t start = subnet->pool[poolindex].start;
+    uint64_t number;
+
+    if (first < start) first = start;
+    if (last >= end) last = end - 1;
+
+    for (number = first; number <= last; number++)
+        ogs_bitmap_set(subnet->pool[poolindex].bitmap,
+                (uint32_t)(number - start));
+}
+
 int ogs_pfcp_ue_pool_generate(void)
 {
-    int i, rv;
+    int i;
     ogs_pfcp_subnet_t *subnet = NULL;
 
     ogs_list_for_each(&self.subnet_list, subnet) {
-        int maxbytes = 0;
-        int lastindex = 0;
-        uint32_t start[4], end[4], broadcast[4];
+        uint64_t network, broadcast, gw;
         int rangeindex, num_of_range;
-        int poolindex;
-        int inc;
-
-        if (subnet->family == AF_INET) {
-            maxbytes = 4;
-            lastindex = 0;
-        } else if (subnet->family == AF_INET6) {
-            maxbytes = 8; /* Default Prefixlen 64bits */
-            lastindex = 1;
-        } else {
+
+        if (subnet->family != AF_INET && subnet->family != AF_INET6) {
             /* subnet->family might be AF_UNSPEC. So, skip it */
             continue;
         }
 
-        for (i = 0; i < 4; i++) {
-            broadcast[i] = subnet->sub.sub[i] + ~subnet->sub.mask[i];
+        network = ue_ip_number(subnet->family, subnet->sub.sub);
+        broadcast = network | ~ue_ip_number(subnet->family, subnet->sub.mask);
+        if (subnet->family == AF_INET)
+            broadcast &= 0xffffffff;
+        gw = ue_ip_number(subnet->family, subnet->gw.sub);
+
+        for (i = 0; i < subnet->num_of_reserved; i++) {
+            const char *low = subnet->reserved[i].low;
+            const char *high = subnet->reserved[i].high;
+
+            if (!low) {
+                ogs_warn("Ignore reserved range without low address [%s]",
+                        high);
+                subnet->reserved[i].first = 1;
+                subnet->reserved[i].last = 0;
+                continue;
+            }
+            if (!high)
+                high = low;
+
+            subnet->reserved[i].first =
+                ue_ip_number_from_string(subnet->family, low);
+            subnet->reserved[i].last =
+                ue_ip_number_from_string(subnet->family, high);
         }
 
         num_of_range = subnet->num_of_range;
         if (!num_of_range) num_of_range = 1;
 
-        poolindex = 0;
+        subnet->num_of_pool = 0;
         for (rangeindex = 0; rangeindex < num_of_range; rangeindex++) {
+            int poolindex = subnet->num_of_pool;
+            const char *low = NULL, *high = NULL;
+            uint64_t start, end;
 
-            if (subnet->num_of_range &&
-                subnet->range[rangeindex].low) {
-                ogs_ipsubnet_t low;
-                rv = ogs_ipsubnet(&low, subnet->range[rangeindex].low, NULL);
-                ogs_assert(rv == OGS_OK);
-                memcpy(start, low.sub, maxbytes);
-            } else {
-                memcpy(start, subnet->sub.sub, maxbytes);
+            if (subnet->num_of_range) {
+                low = subnet->range[rangeindex].low;
+                high = subnet->range[rangeindex].high;
             }
 
-            if (subnet->num_of_range &&
-                subnet->range[rangeindex].high) {
-                ogs_ipsubnet_t high;
-                rv = ogs_ipsubnet(&high, subnet->range[rangeindex].high, NULL);
-                ogs_assert(rv == OGS_OK);
-                high.sub[lastindex] += htobe32(1);
-                memcpy(end, high.sub, maxbytes);
-            } else {
-                memcpy(end, broadcast, maxbytes);
+            if (low)
+                start = ue_ip_number_from_string(subnet->family, low);
+            else
+                start = network;
+
+            /* The broadcast address is not allocated */
+            if (high)
+                end = ue_ip_number_from_string(subnet->family, high) + 1;
+            else
+                end = broadcast;
+
+            if (end <= start) {
+                ogs_warn("No address in range [%s-%s]",
+                        low ? low : "", high ? high : "");
+                continue;
             }
 
-            inc = 0;
-            while(poolindex < ogs_app()->pool.sess) {
-                ogs_pfcp_ue_ip_t *ue_ip = NULL;
-
-                ue_ip = &subnet->pool.array[poolindex];
-                ogs_assert(ue_ip);
-                memset(ue_ip, 0, sizeof *ue_ip);
-                ue_ip->subnet = subnet;
-
-                memcpy(ue_ip->addr, start, maxbytes);
-                ue_ip->addr[lastindex] += htobe32(inc);
-                inc++;
-
-                if (memcmp(ue_ip->addr, end, maxbytes) == 0)
-                    break;
-
-                /* Exclude Network Address */
-                if (memcmp(ue_ip->addr, subnet->sub.sub, maxbytes) == 0)
-                    continue;
-
-                /* Exclude TUN IP Address */
-                if (memcmp(ue_ip->addr, subnet->gw.sub, maxbytes) == 0)
-                    continue;
-
-                /* Allocate Full IPv6 Address */
-                if (lastindex == 1)
-                    ue_ip->addr[3] += htobe32(inc);
-
-                ogs_trace("[%d] - %x:%x:%x:%x",
-                        poolindex,
-                        ue_ip->addr[0], ue_ip->addr[1],
-                        ue_ip->addr[2], ue_ip->addr[3]);
-
-                poolindex++;
+            if (end - start > OGS_BITMAP_MAX_SIZE) {
+                ogs_warn("Only the first %d addresses in range [%s-%s] "
+                        "are used", OGS_BITMAP_MAX_SIZE,
+                        low ? low : "", high ? high : "");
+                end = start + OGS_BITMAP_MAX_SIZE;
             }
+
+            subnet->pool[poolindex].start = start;
+            subnet->pool[poolindex].bitmap =
+                ogs_bitmap_create((uint32_t)(end - start));
+            ogs_assert(subnet->pool[poolindex].bitmap);
+            subnet->num_of_pool++;
+
+            /* Exclude Network Address */
+            ue_pool_reserve(subnet, poolindex, end, network, network);
+            /* Exclude TUN IP Address */
+            ue_pool_reserve(subnet, poolindex, end, gw, gw);
+
+            for (i = 0; i < subnet->num_of_reserved; i++)
+                ue_pool_reserve(subnet, poolindex, end,
+                        subnet->reserved[i].first, subnet->reserved[i].last);
+
+            ogs_debug("UE Pool[%s:%d] %d addresses (%d reserved)",
+                    subnet->dnn, poolindex,
+                    ogs_bitmap_size(subnet->pool[poolindex].bitmap),
+                    ogs_bitmap_used(subnet->pool[poolindex].bitmap));
         }
-        subnet->pool.size = subnet->pool.avail = poolindex;
     }
 
     return OGS_OK;
@@ -1615,6 +2092,7 @@ ogs_pfcp_ue_ip_t *ogs_pfcp_ue_ip_alloc(
 
     uint8_t zero[16];
     size_t maxbytes = 0;
+    int i;
 
     memset(zero, 0, sizeof zero);
     if (family == AF_INET) {
@@ -1646,22 +2124,61 @@ ogs_pfcp_ue_ip_t *ogs_pfcp_ue_ip_alloc(
         return NULL;
     }
 
+    ogs_pool_alloc(&ogs_pfcp_ue_ip_pool, &ue_ip);
+    if (!ue_ip) {
+        ogs_error("No resources available");
+        *cause_value = OGS_PFCP_CAUSE_NO_RESOURCES_AVAILABLE;
+        return NULL;
+    }
+    memset(ue_ip, 0, sizeof *ue_ip);
+    ue_ip->subnet = subnet;
+
     /* if assigning a static IP, do so. If not, assign dynamically! */
     if (memcmp(addr, zero, maxbytes) != 0) {
-        ue_ip = ogs_calloc(1, sizeof(ogs_pfcp_ue_ip_t));
-        if (!ue_ip) {
-            ogs_error("All dynamic addresses are occupied");
-            *cause_value = OGS_PFCP_CAUSE_ALL_DYNAMIC_ADDRESS_ARE_OCCUPIED;
-            return NULL;
-        }
+        uint64_t number;
 
-        ue_ip->subnet = subnet;
         ue_ip->static_ip = true;
         memcpy(ue_ip->addr, addr, maxbytes);
+
+        /*
+         * Mark the address in its range so that it is not handed out
+         * dynamically. Reserved addresses are already marked.
+         */
+        number = ue_ip_number(family, ue_ip->addr);
+        for (i = 0; i < subnet->num_of_reserved; i++) {
+            if (number >= subnet->reserved[i].first &&
+                number <= subnet->reserved[i].last)
+                return ue_ip;
+        }
+        for (i = 0; i < subnet->num_of_pool; i++) {
+            uint64_t start = subnet->pool[i].start;
+            ogs_bitmap_t *bitmap = subnet->pool[i].bitmap;
+
+            if (number < start || number - start >= ogs_bitmap_size(bitmap))
+                continue;
+
+            if (ogs_bitmap_set(bitmap, (uint32_t)(number - start))) {
+                ue_ip->bitmap = bitmap;
+                ue_ip->index = (uint32_t)(number - start);
+            } else {
+                ogs_warn("Static IP is already in use");
+            }
+            break;
+        }
     } else {
-        ogs_pool_alloc(&subnet->pool, &ue_ip);
-        if (!ue_ip) {
+        for (i = 0; i < subnet->num_of_pool; i++) {
+            ogs_bitmap_t *bitmap = subnet->pool[i].bitmap;
+
+            if (ogs_bitmap_alloc(bitmap, &ue_ip->index) == OGS_OK) {
+                ue_ip->bitmap = bitmap;
+                ue_ip_from_number(family, ue_ip->addr,
+                        subnet->pool[i].start + ue_ip->index, ue_ip->index);
+                break;
+            }
+        }
+        if (!ue_ip->bitmap) {
             ogs_error("No resources available");
+            ogs_pool_free(&ogs_pfcp_ue_ip_pool, ue_ip);
             *cause_value = OGS_PFCP_CAUSE_NO_RESOURCES_AVAILABLE;
             return NULL;
         }
@@ -1672,18 +2189,13 @@ ogs_pfcp_ue_ip_t *ogs_pfcp_ue_ip_alloc(
 
 void ogs_pfcp_ue_ip_free(ogs_pfcp_ue_ip_t *ue_ip)
 {
-    ogs_pfcp_subnet_t *subnet = NULL;
-
     ogs_assert(ue_ip);
-    subnet = ue_ip->subnet;
+    ogs_assert(ue_ip->subnet);
 
-    ogs_assert(subnet);
+    if (ue_ip->bitmap)
+        ogs_bitmap_clear(ue_ip->bitmap, ue_ip->index);
 
-    if (ue_ip->static_ip) {
-        ogs_free(ue_ip);
-    } else {
-        ogs_pool_free(&subnet->pool, ue_ip);
-    }
+    ogs_pool_free(&ogs_pfcp_ue_ip_pool, ue_ip);
 }
 
 ogs_pfcp_dev_t *ogs_pfcp_dev_add(const char *ifname)
@@ -1769,8 +2281,6 @@ ogs_pfcp_subnet_t *ogs_pfcp_subnet_add(
     if (dnn)
         strcpy(subnet->dnn, dnn);
 
-    ogs_pool_init(&subnet->pool, ogs_app()->pool.sess);
-
     ogs_list_add(&self.subnet_list, subnet);
 
     return subnet;
@@ -1778,11 +2288,14 @@ ogs_pfcp_subnet_t *ogs_pfcp_subnet_add(
 
 void ogs_pfcp_subnet_remove(ogs_pfcp_subnet_t *subnet)
 {
+    int i;
+
     ogs_assert(subnet);
 
     ogs_list_remove(&self.subnet_list, subnet);
 
-    ogs_pool_final(&subnet->pool);
+    for (i = 0; i < subnet->num_of_pool; i++)
+        ogs_bitmap_destroy(subnet->pool[i].bitmap);
 
     ogs_pool_free(&ogs_pfcp_subnet_pool, subnet);
 }
@@ -40,6 +40,7 @@ extern "C" {
 #define OGS_MAX_NUM_OF_SUBNET   16
 
 typedef struct ogs_pfcp_node_s ogs_pfcp_node_t;
+typedef struct ogs_pfcp_sess_s ogs_pfcp_sess_t;
 
 typedef struct ogs_pfcp_context_s {
     uint32_t        pfcp_port;      /* PFCP local port */
@@ -70,6 +71,42 @@ typedef struct ogs_pfcp_context_s {
     ogs_hash_t      *object_teid_hash; /* hash table for PFCP OBJ(TEID) */
     ogs_hash_t      *far_f_teid_hash;  /* hash table for FAR(TEID+ADDR) */
     ogs_hash_t      *far_teid_hash; /* hash table for FAR(TEID) */
+
+    /* Data plane metrics set by the UP function, NULL if not counted */
+    struct {
+        ogs_metrics_inst_t *access_tx_packets;
+        ogs_metrics_inst_t *access_tx_bytes;
+        ogs_metrics_inst_t *core_tx_packets;
+        ogs_metrics_inst_t *core_tx_bytes;
+        ogs_metrics_inst_t *buffered_packets;
+        ogs_metrics_inst_t *buffered_bytes;
+        ogs_metrics_inst_t *buffer_full;
+        ogs_metrics_inst_t *buffer_expired;
+    } metrics;
+
+    /* Downlink buffering of the UP function, shared by all FARs */
+    struct {
+        size_t      max_size;       /* Node-wide limit in bytes */
+        size_t      sess_max_size;  /* Per-session limit in bytes */
+        ogs_time_t  validity;       /* How long a packet may wait */
+        int         report_rate;    /* Reports per second, 0 if unlimited */
+
+        size_t      size;           /* Bytes buffered now */
+        ogs_list_t  far_list;       /* FARs holding buffered packets */
+        ogs_list_t  report_list;    /* FARs whose report is held back */
+        ogs_timer_t *t_expire;      /* Drops packets older than validity */
+
+        ogs_time_t  report_window;  /* Start of the current second */
+        int         num_of_report;  /* Reports in the current second */
+
+        /*
+         * Set by the UP function to send the Downlink Data Reports
+         * held back by report_rate. Without it, a held-back report
+         * waits for the next packet.
+         */
+        int (*send_report)(ogs_pfcp_sess_t *sess,
+                ogs_pfcp_user_plane_report_t *report);
+    } buffer;
 } ogs_pfcp_context_t;
 
 #define OGS_SETUP_PFCP_NODE(__cTX, __pNODE) \
@@ -110,6 +147,33 @@ typedef struct ogs_pfcp_node_s {
 
     ogs_pfcp_up_function_features_t up_function_features;
     int up_function_features_len;
+
+    ogs_metrics_inst_t *metrics_rtt; /* Created on the first response */
+
+    /* Relative capacity for UPF selection (default: 100) */
+    uint16_t        capacity;
+
+    /* Reported by the UP function (TS 29.244 6.2.5, 6.2.6) */
+    struct {
+        bool        presence;
+        uint32_t    sequence_number;
+        uint8_t     metric;         /* 0 ~ 100 */
+    } load;
+    struct {
+        bool        presence;
+        uint32_t    sequence_number;
+        uint8_t     reduction;      /* 0 ~ 100 */
+        ogs_time_t  expires;        /* 0 if valid until the next report */
+    } overload;
+
+    int             num_of_sess;    /* Sessions set up on this node */
+    int64_t         current_weight; /* Smooth weighted round-robin */
+
+    struct {
+        ogs_metrics_inst_t *sessions;
+        ogs_metrics_inst_t *load;
+        ogs_metrics_inst_t *overload_reduction;
+    } metrics;                      /* Created on the first update */
 } ogs_pfcp_node_t;
 
 typedef enum {
@@ -126,7 +190,6 @@ typedef struct ogs_pfcp_object_s {
     ogs_pfcp_object_type_e type;
 } ogs_pfcp_object_t;
 
-typedef struct ogs_pfcp_sess_s ogs_pfcp_sess_t;
 typedef struct ogs_pfcp_pdr_s ogs_pfcp_pdr_t;
 typedef struct ogs_pfcp_far_s ogs_pfcp_far_t;
 typedef struct ogs_pfcp_urr_s ogs_pfcp_urr_t;
@@ -183,6 +246,12 @@ typedef struct ogs_pfcp_pdr_s {
 
     ogs_list_t              rule_list;      /* Rule List */
 
+    /* Per-DNN counters set by the UP function, NULL if not counted */
+    struct {
+        ogs_metrics_inst_t *dnn_ul_bytes;
+        ogs_metrics_inst_t *dnn_dl_bytes;
+    } metrics;
+
     /* Related Context */
     ogs_pfcp_sess_t         *sess;
     void                    *gnode;         /* For CP-Function */
@@ -222,8 +291,33 @@ typedef struct ogs_pfcp_far_s {
 
     ogs_pfcp_smreq_flags_t  smreq_flags;
 
-    uint32_t                num_of_buffered_packet;
-    ogs_pkbuf_t             *buffered_packet[OGS_MAX_NUM_OF_PACKET_BUFFER];
+    /* Downlink packets held while the UE is idle */
+    struct {
+        ogs_lnode_t         lnode;      /* A node of buffer.far_list */
+        ogs_list_t          queue;      /* ogs_pkbuf_t, oldest first */
+        uint32_t            num_of_packet;
+        size_t              size;
+        bool                reported;   /* Downlink Data Report was sent */
+
+        /* Report held back by report_rate, in buffer.report_list */
+        ogs_lnode_t         report_node;
+        bool                report_pending;
+        ogs_pfcp_pdr_id_t   pdr_id;
+        uint8_t             qfi;
+    } buffer;
+
+    /*
+     * GTP-U header for ogs_pfcp_send_g_pdu(). It is rebuilt on the next
+     * packet whenever the message type, TEID or QFI it was built for
+     * no longer matches.
+     */
+    struct {
+        uint8_t buf[OGS_GTPV1U_5GC_HEADER_LEN];
+        uint8_t len;    /* 0 if not built yet */
+        uint8_t type;
+        uint8_t qfi;
+        uint32_t teid;
+    } gtpu_header;
 
     struct {
         bool prepared;
@@ -301,6 +395,8 @@ typedef struct ogs_pfcp_sess_s {
     OGS_POOL(urr_id_pool, uint8_t);
     OGS_POOL(qer_id_pool, uint8_t);
     OGS_POOL(bar_id_pool, uint8_t);
+
+    size_t              buffered_size;  /* Bytes buffered in all FARs */
 } ogs_pfcp_sess_t;
 
 typedef struct ogs_pfcp_subnet_s ogs_pfcp_subnet_t;
@@ -308,6 +404,9 @@ typedef struct ogs_pfcp_ue_ip_s {
     uint32_t        addr[4];
     bool            static_ip;
 
+    ogs_bitmap_t    *bitmap;    /* NULL if the address is not in a range */
+    uint32_t        index;
+
     /* Related Context */
     ogs_pfcp_subnet_t    *subnet;
 } ogs_pfcp_ue_ip_t;
@@ -337,9 +436,26 @@ typedef struct ogs_pfcp_subnet_s {
     } range[OGS_MAX_NUM_OF_SUBNET_RANGE];
     int num_of_range;
 
+    /* Not allocated dynamically, but can be assigned as a static IP */
+    struct {
+        const char *low;
+        const char *high;
+        uint64_t first, last;
+    } reserved[OGS_MAX_NUM_OF_SUBNET_RANGE];
+    int num_of_reserved;
+
     int             family;         /* AF_INET or AF_INET6 */
     uint8_t         prefixlen;      /* prefixlen */
-    OGS_POOL(pool, ogs_pfcp_ue_ip_t);
+
+    /*
+     * A free bitmap per range, built by ogs_pfcp_ue_pool_generate().
+     * An IPv4 address or an IPv6 /64 prefix is start + index.
+     */
+    struct {
+        uint64_t start;
+        ogs_bitmap_t *bitmap;
+    } pool[OGS_MAX_NUM_OF_SUBNET_RANGE];
+    int num_of_pool;
 
     ogs_pfcp_dev_t  *dev;           /* Related Context */
 } ogs_pfcp_subnet_t;
@@ -381,6 +497,16 @@ ogs_pfcp_node_t *ogs_pfcp_node_find(
 void ogs_pfcp_node_remove(ogs_list_t *list, ogs_pfcp_node_t *node);
 void ogs_pfcp_node_remove_all(ogs_list_t *list);
 
+void ogs_pfcp_node_metrics_open(void);
+void ogs_pfcp_node_sess_inc(ogs_pfcp_node_t *node);
+void ogs_pfcp_node_sess_dec(ogs_pfcp_node_t *node);
+void ogs_pfcp_node_set_load(ogs_pfcp_node_t *node,
+        uint32_t sequence_number, uint8_t metric);
+void ogs_pfcp_node_set_overload(ogs_pfcp_node_t *node,
+        uint32_t sequence_number, uint8_t reduction, ogs_time_t validity);
+/* Selection weight from capacity, load and overload. 0 if saturated */
+int ogs_pfcp_node_weight(ogs_pfcp_node_t *node);
+
 ogs_gtpu_resource_t *ogs_pfcp_find_gtpu_resource(ogs_list_t *list,
         char *dnn, ogs_pfcp_interface_t source_interface);
 int ogs_pfcp_setup_far_gtpu_node(ogs_pfcp_far_t *far);
@@ -424,6 +550,12 @@ ogs_pfcp_far_t *ogs_pfcp_far_find_by_teid(uint32_t teid);
 void ogs_pfcp_far_remove(ogs_pfcp_far_t *far);
 void ogs_pfcp_far_remove_all(ogs_pfcp_sess_t *sess);
 
+/* Returns true if a Downlink Data Report is to be sent */
+bool ogs_pfcp_far_buffer_packet(ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *pkbuf);
+/* Takes the oldest buffered packet, NULL if none */
+ogs_pkbuf_t *ogs_pfcp_far_dequeue_buffered_packet(ogs_pfcp_far_t *far);
+void ogs_pfcp_far_remove_buffered_packets(ogs_pfcp_far_t *far);
+
 ogs_pfcp_urr_t *ogs_pfcp_urr_add(ogs_pfcp_sess_t *sess);
 ogs_pfcp_urr_t *ogs_pfcp_urr_find(
         ogs_pfcp_sess_t *sess, ogs_pfcp_urr_id_t id);
@@ -142,6 +142,100 @@ bool ogs_pfcp_cp_handle_association_setup_response(
     return true;
 }
 
+static bool sequence_number_and_metric(
+        ogs_pfcp_tlv_sequence_number_t *sequence_number,
+        ogs_pfcp_tlv_metric_t *metric, uint32_t *sqn, uint8_t *value)
+{
+    if (!sequence_number->presence || sequence_number->len != 4) {
+        ogs_error("Invalid Sequence Number");
+        return false;
+    }
+    if (!metric->presence || metric->len != 1) {
+        ogs_error("Invalid Metric");
+        return false;
+    }
+
+    memcpy(sqn, sequence_number->data, 4);
+    *sqn = be32toh(*sqn);
+    *value = *(uint8_t *)metric->data;
+    if (*value > 100) {
+        ogs_error("Invalid Metric [%d]", *value);
+        return false;
+    }
+
+    return true;
+}
+
+void ogs_pfcp_cp_handle_load_control_information(ogs_pfcp_node_t *node,
+        ogs_pfcp_tlv_load_control_information_t *message)
+{
+    uint32_t sqn;
+    uint8_t metric;
+
+    ogs_assert(node);
+    ogs_assert(message);
+
+    if (message->presence == 0)
+        return;
+
+    if (sequence_number_and_metric(&message->load_control_sequence_number,
+                &message->load_metric, &sqn, &metric) == false)
+        return;
+
+    ogs_pfcp_node_set_load(node, sqn, metric);
+}
+
+void ogs_pfcp_cp_handle_overload_control_information(ogs_pfcp_node_t *node,
+        ogs_pfcp_tlv_overload_control_information_t *message)
+{
+    uint32_t sqn;
+    uint8_t reduction, timer;
+    ogs_time_t validity = 0;
+
+    ogs_assert(node);
+    ogs_assert(message);
+
+    if (message->presence == 0)
+        return;
+
+    if (sequence_number_and_metric(
+                &message->overload_control_sequence_number,
+                &message->overload_reduction_metric,
+                &sqn, &reduction) == false)
+        return;
+
+    if (message->period_of_validity.presence &&
+        message->period_of_validity.len == 1) {
+        /* TS 29.244 8.2.44 Timer : Unit(bits 8-6), Value(bits 5-1) */
+        timer = *(uint8_t *)message->period_of_validity.data;
+        switch (timer >> 5) {
+        case 0:
+            validity = ogs_time_from_sec((timer & 0x1f) * 2);
+            break;
+        case 2:
+            validity = ogs_time_from_sec((timer & 0x1f) * 10 * 60);
+            break;
+        case 3:
+            validity = ogs_time_from_sec((timer & 0x1f) * 60 * 60);
+            break;
+        case 4:
+            validity = ogs_time_from_sec((timer & 0x1f) * 10 * 60 * 60);
+            break;
+        case 7:
+            /* Infinite */
+            break;
+        default:
+            validity = ogs_time_from_sec((timer & 0x1f) * 60);
+            break;
+        }
+        /* A zero value ends the overload right away */
+        if ((timer >> 5) != 7 && validity == 0)
+            reduction = 0;
+    }
+
+    ogs_pfcp_node_set_overload(node, sqn, reduction, validity);
+}
+
 bool ogs_pfcp_up_handle_association_setup_request(
         ogs_pfcp_node_t *node, ogs_pfcp_xact_t *xact,
         ogs_pfcp_association_setup_request_t *req)
@@ -216,18 +310,8 @@ bool ogs_pfcp_up_handle_pdr(
     }
 
     if (buffering == true) {
-
-        if (far->num_of_buffered_packet == 0) {
-            /* Only the first time a packet is buffered,
-             * it reports downlink notifications. */
+        if (ogs_pfcp_far_buffer_packet(pdr, sendbuf) == true)
             report->type.downlink_data_report = 1;
-        }
-
-        if (far->num_of_buffered_packet < OGS_MAX_NUM_OF_PACKET_BUFFER) {
-            far->buffered_packet[far->num_of_buffered_packet++] = sendbuf;
-        } else {
-            ogs_pkbuf_free(sendbuf);
-        }
     }
 
     return true;
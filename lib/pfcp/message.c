@@ -3977,6 +3977,7085 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_report_response =
 }};
 
 
+static int pfcp_parse_tlv_ethernet_packet_filter(
+        ogs_pfcp_tlv_ethernet_packet_filter_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_redundant_transmission_parameters(
+        ogs_pfcp_tlv_redundant_transmission_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request(
+        ogs_pfcp_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_pdi(
+        ogs_pfcp_tlv_pdi_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_transport_delay_reporting(
+        ogs_pfcp_tlv_transport_delay_reporting_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_pdr(
+        ogs_pfcp_tlv_create_pdr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_forwarding_parameters(
+        ogs_pfcp_tlv_forwarding_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_duplicating_parameters(
+        ogs_pfcp_tlv_duplicating_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_redundant_transmission_forwarding_parameters(
+        ogs_pfcp_tlv_redundant_transmission_forwarding_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_far(
+        ogs_pfcp_tlv_create_far_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_forwarding_parameters(
+        ogs_pfcp_tlv_update_forwarding_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_duplicating_parameters(
+        ogs_pfcp_tlv_update_duplicating_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_far(
+        ogs_pfcp_tlv_update_far_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_pfd_context(
+        ogs_pfcp_tlv_pfd_context_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_application_id_s_pfds(
+        ogs_pfcp_tlv_application_id_s_pfds_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_ethernet_traffic_information(
+        ogs_pfcp_tlv_ethernet_traffic_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv__access_forwarding_action_information(
+        ogs_pfcp_tlv__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_non__access_forwarding_action_information(
+        ogs_pfcp_tlv_non__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update__access_forwarding_action_information(
+        ogs_pfcp_tlv_update__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_non__access_forwarding_action_information(
+        ogs_pfcp_tlv_update_non__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_access_availability_report(
+        ogs_pfcp_tlv_access_availability_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_qos_monitoring_report(
+        ogs_pfcp_tlv_qos_monitoring_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_mptcp_parameters(
+        ogs_pfcp_tlv_mptcp_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_atsss_ll_parameters(
+        ogs_pfcp_tlv_atsss_ll_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_pmf_parameters(
+        ogs_pfcp_tlv_pmf_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_join_ip_multicast_information_ie_within_usage_report(
+        ogs_pfcp_tlv_join_ip_multicast_information_ie_within_usage_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_leave_ip_multicast_information_ie_within_usage_report(
+        ogs_pfcp_tlv_leave_ip_multicast_information_ie_within_usage_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_urr(
+        ogs_pfcp_tlv_create_urr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_qer(
+        ogs_pfcp_tlv_create_qer_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_created_pdr(
+        ogs_pfcp_tlv_created_pdr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_pdr(
+        ogs_pfcp_tlv_update_pdr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_bar_pfcp_session_report_response(
+        ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_urr(
+        ogs_pfcp_tlv_update_urr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_qer(
+        ogs_pfcp_tlv_update_qer_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_pdr(
+        ogs_pfcp_tlv_remove_pdr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_far(
+        ogs_pfcp_tlv_remove_far_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_urr(
+        ogs_pfcp_tlv_remove_urr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_qer(
+        ogs_pfcp_tlv_remove_qer_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_load_control_information(
+        ogs_pfcp_tlv_load_control_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_overload_control_information(
+        ogs_pfcp_tlv_overload_control_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_application_detection_information(
+        ogs_pfcp_tlv_application_detection_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_query_urr(
+        ogs_pfcp_tlv_query_urr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_usage_report_session_modification_response(
+        ogs_pfcp_tlv_usage_report_session_modification_response_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_usage_report_session_deletion_response(
+        ogs_pfcp_tlv_usage_report_session_deletion_response_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_usage_report_session_report_request(
+        ogs_pfcp_tlv_usage_report_session_report_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_downlink_data_report(
+        ogs_pfcp_tlv_downlink_data_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_bar(
+        ogs_pfcp_tlv_create_bar_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_bar_session_modification_request(
+        ogs_pfcp_tlv_update_bar_session_modification_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_bar(
+        ogs_pfcp_tlv_remove_bar_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_error_indication_report(
+        ogs_pfcp_tlv_error_indication_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_user_plane_path_failure_report(
+        ogs_pfcp_tlv_user_plane_path_failure_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_traffic_endpoint(
+        ogs_pfcp_tlv_create_traffic_endpoint_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_created_traffic_endpoint(
+        ogs_pfcp_tlv_created_traffic_endpoint_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_traffic_endpoint(
+        ogs_pfcp_tlv_remove_traffic_endpoint_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_mar(
+        ogs_pfcp_tlv_create_mar_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_mar(
+        ogs_pfcp_tlv_remove_mar_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_mar(
+        ogs_pfcp_tlv_update_mar_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_pfcp_session_retention_information_within_pfcp_association_setup_request(
+        ogs_pfcp_tlv_pfcp_session_retention_information_within_pfcp_association_setup_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_user_plane_path_recovery_report(
+        ogs_pfcp_tlv_user_plane_path_recovery_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_created_bridge_info_for_tsc(
+        ogs_pfcp_tlv_created_bridge_info_for_tsc_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_request(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_modification_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_response(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_modification_response_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_report_request(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_report_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_clock_drift_control_information(
+        ogs_pfcp_tlv_clock_drift_control_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_clock_drift_report(
+        ogs_pfcp_tlv_clock_drift_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_remove_srr(
+        ogs_pfcp_tlv_remove_srr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_create_srr(
+        ogs_pfcp_tlv_create_srr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_update_srr(
+        ogs_pfcp_tlv_update_srr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_session_report(
+        ogs_pfcp_tlv_session_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_provide_atsss_control_information(
+        ogs_pfcp_tlv_provide_atsss_control_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_atsss_control_parameters(
+        ogs_pfcp_tlv_atsss_control_parameters_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_ue_ip_address_pool_information(
+        ogs_pfcp_tlv_ue_ip_address_pool_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_gtp_u_path_qos_report_pfcp_node_report_request(
+        ogs_pfcp_tlv_gtp_u_path_qos_report_pfcp_node_report_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_qos_information_in_gtp_u_path_qos_report(
+        ogs_pfcp_tlv_qos_information_in_gtp_u_path_qos_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_packet_rate_status_report(
+        ogs_pfcp_tlv_packet_rate_status_report_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_ethernet_context_information(
+        ogs_pfcp_tlv_ethernet_context_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_updated_pdr(
+        ogs_pfcp_tlv_updated_pdr_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_provide_rds_configuration_information(
+        ogs_pfcp_tlv_provide_rds_configuration_information_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_query_packet_rate_status_ie_within_pfcp_session_modification_request(
+        ogs_pfcp_tlv_query_packet_rate_status_ie_within_pfcp_session_modification_request_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_packet_rate_status_report_ie_within_pfcp_session_modification_response(
+        ogs_pfcp_tlv_packet_rate_status_report_ie_within_pfcp_session_modification_response_t *msg, uint8_t *data, uint32_t length);
+static int pfcp_parse_tlv_ue_ip_address_usage_information(
+        ogs_pfcp_tlv_ue_ip_address_usage_information_t *msg, uint8_t *data, uint32_t length);
+
+static int pfcp_parse_tlv_ethernet_packet_filter(
+        ogs_pfcp_tlv_ethernet_packet_filter_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_ETHERNET_FILTER_ID_TYPE:
+            if (!msg->ethernet_filter_id.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_filter_id,
+                        &ogs_pfcp_tlv_desc_ethernet_filter_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_FILTER_PROPERTIES_TYPE:
+            if (!msg->ethernet_filter_properties.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_filter_properties,
+                        &ogs_pfcp_tlv_desc_ethernet_filter_properties, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MAC_ADDRESS_TYPE:
+            if (!msg->mac_address.presence)
+                rv = ogs_tlv_parse_element(&msg->mac_address,
+                        &ogs_pfcp_tlv_desc_mac_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERTYPE_TYPE:
+            if (!msg->ethertype.presence)
+                rv = ogs_tlv_parse_element(&msg->ethertype,
+                        &ogs_pfcp_tlv_desc_ethertype, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_C_TAG_TYPE:
+            if (!msg->c_tag.presence)
+                rv = ogs_tlv_parse_element(&msg->c_tag,
+                        &ogs_pfcp_tlv_desc_c_tag, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_S_TAG_TYPE:
+            if (!msg->s_tag.presence)
+                rv = ogs_tlv_parse_element(&msg->s_tag,
+                        &ogs_pfcp_tlv_desc_s_tag, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SDF_FILTER_TYPE:
+            v = ogs_tlv_more_slot(msg->sdf_filter,
+                    sizeof(msg->sdf_filter[0]), OGS_ARRAY_SIZE(msg->sdf_filter));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_sdf_filter, &e);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_redundant_transmission_parameters(
+        ogs_pfcp_tlv_redundant_transmission_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request(
+        ogs_pfcp_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_IP_MULTICAST_ADDRESS_TYPE:
+            if (!msg->ip_multicast_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ip_multicast_address,
+                        &ogs_pfcp_tlv_desc_ip_multicast_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SOURCE_IP_ADDRESS_TYPE:
+            if (!msg->source_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->source_ip_address,
+                        &ogs_pfcp_tlv_desc_source_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_pdi(
+        ogs_pfcp_tlv_pdi_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SOURCE_INTERFACE_TYPE:
+            if (!msg->source_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->source_interface,
+                        &ogs_pfcp_tlv_desc_source_interface, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDUNDANT_TRANSMISSION_PARAMETERS_TYPE:
+            if (!msg->redundant_transmission_detection_parameters.presence)
+                rv = pfcp_parse_tlv_redundant_transmission_parameters(&msg->redundant_transmission_detection_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SDF_FILTER_TYPE:
+            v = ogs_tlv_more_slot(msg->sdf_filter,
+                    sizeof(msg->sdf_filter[0]), OGS_ARRAY_SIZE(msg->sdf_filter));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_sdf_filter, &e);
+            break;
+        case OGS_PFCP_APPLICATION_ID_TYPE:
+            if (!msg->application_id.presence)
+                rv = ogs_tlv_parse_element(&msg->application_id,
+                        &ogs_pfcp_tlv_desc_application_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_PDU_SESSION_INFORMATION_TYPE:
+            if (!msg->ethernet_pdu_session_information.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_pdu_session_information,
+                        &ogs_pfcp_tlv_desc_ethernet_pdu_session_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_PACKET_FILTER_TYPE:
+            if (!msg->ethernet_packet_filter.presence)
+                rv = pfcp_parse_tlv_ethernet_packet_filter(&msg->ethernet_packet_filter,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QFI_TYPE:
+            if (!msg->qfi.presence)
+                rv = ogs_tlv_parse_element(&msg->qfi,
+                        &ogs_pfcp_tlv_desc_qfi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_ROUTE_TYPE:
+            if (!msg->framed_route.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_route,
+                        &ogs_pfcp_tlv_desc_framed_route, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_ROUTING_TYPE:
+            if (!msg->framed_routing.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_routing,
+                        &ogs_pfcp_tlv_desc_framed_routing, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_IPV6_ROUTE_TYPE:
+            if (!msg->framed_ipv6_route.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_ipv6_route,
+                        &ogs_pfcp_tlv_desc_framed_ipv6_route, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__INTERFACE_TYPE_TYPE:
+            if (!msg->source_interface_type.presence)
+                rv = ogs_tlv_parse_element(&msg->source_interface_type,
+                        &ogs_pfcp_tlv_desc__interface_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_IP_MULTICAST_ADDRESSING_INFO_WITHIN_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE:
+            if (!msg->ip_multicast_addressing_info.presence)
+                rv = pfcp_parse_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request(&msg->ip_multicast_addressing_info,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_transport_delay_reporting(
+        ogs_pfcp_tlv_transport_delay_reporting_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REMOTE_GTP_U_PEER_TYPE:
+            if (!msg->preceding_ul_gtp_u_peer.presence)
+                rv = ogs_tlv_parse_element(&msg->preceding_ul_gtp_u_peer,
+                        &ogs_pfcp_tlv_desc_remote_gtp_u_peer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->dscp.presence)
+                rv = ogs_tlv_parse_element(&msg->dscp,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_pdr(
+        ogs_pfcp_tlv_create_pdr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRECEDENCE_TYPE:
+            if (!msg->precedence.presence)
+                rv = ogs_tlv_parse_element(&msg->precedence,
+                        &ogs_pfcp_tlv_desc_precedence, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PDI_TYPE:
+            if (!msg->pdi.presence)
+                rv = pfcp_parse_tlv_pdi(&msg->pdi,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_REMOVAL_TYPE:
+            if (!msg->outer_header_removal.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_removal,
+                        &ogs_pfcp_tlv_desc_outer_header_removal, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            v = ogs_tlv_more_slot(msg->urr_id,
+                    sizeof(msg->urr_id[0]), OGS_ARRAY_SIZE(msg->urr_id));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            break;
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACTIVATE_PREDEFINED_RULES_TYPE:
+            if (!msg->activate_predefined_rules.presence)
+                rv = ogs_tlv_parse_element(&msg->activate_predefined_rules,
+                        &ogs_pfcp_tlv_desc_activate_predefined_rules, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACTIVATION_TIME_TYPE:
+            if (!msg->activation_time.presence)
+                rv = ogs_tlv_parse_element(&msg->activation_time,
+                        &ogs_pfcp_tlv_desc_activation_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DEACTIVATION_TIME_TYPE:
+            if (!msg->deactivation_time.presence)
+                rv = ogs_tlv_parse_element(&msg->deactivation_time,
+                        &ogs_pfcp_tlv_desc_deactivation_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MAR_ID_TYPE:
+            if (!msg->mar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->mar_id,
+                        &ogs_pfcp_tlv_desc_mar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_REPLICATION_AND_DETECTION_CARRY_ON_INFORMATION_TYPE:
+            if (!msg->packet_replication_and_detection_carry_on_information.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_replication_and_detection_carry_on_information,
+                        &ogs_pfcp_tlv_desc_packet_replication_and_detection_carry_on_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_IP_MULTICAST_ADDRESSING_INFO_WITHIN_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE:
+            if (!msg->ip_multicast_addressing_info.presence)
+                rv = pfcp_parse_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request(&msg->ip_multicast_addressing_info,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_identity.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_identity,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MPTCP_APPLICABLE_INDICATION_TYPE:
+            if (!msg->mptcp_applicable_indication.presence)
+                rv = ogs_tlv_parse_element(&msg->mptcp_applicable_indication,
+                        &ogs_pfcp_tlv_desc_mptcp_applicable_indication, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_DELAY_REPORTING_TYPE:
+            if (!msg->transport_delay_reporting.presence)
+                rv = pfcp_parse_tlv_transport_delay_reporting(&msg->transport_delay_reporting,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_forwarding_parameters(
+        ogs_pfcp_tlv_forwarding_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+            if (!msg->destination_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface,
+                        &ogs_pfcp_tlv_desc_destination_interface, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDIRECT_INFORMATION_TYPE:
+            if (!msg->redirect_information.presence)
+                rv = ogs_tlv_parse_element(&msg->redirect_information,
+                        &ogs_pfcp_tlv_desc_redirect_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+            if (!msg->outer_header_creation.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_creation,
+                        &ogs_pfcp_tlv_desc_outer_header_creation, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->transport_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->transport_level_marking,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FORWARDING_POLICY_TYPE:
+            if (!msg->forwarding_policy.presence)
+                rv = ogs_tlv_parse_element(&msg->forwarding_policy,
+                        &ogs_pfcp_tlv_desc_forwarding_policy, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_HEADER_ENRICHMENT_TYPE:
+            if (!msg->header_enrichment.presence)
+                rv = ogs_tlv_parse_element(&msg->header_enrichment,
+                        &ogs_pfcp_tlv_desc_header_enrichment, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->linked_traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PROXYING_TYPE:
+            if (!msg->proxying.presence)
+                rv = ogs_tlv_parse_element(&msg->proxying,
+                        &ogs_pfcp_tlv_desc_proxying, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__INTERFACE_TYPE_TYPE:
+            if (!msg->destination_interface_type.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface_type,
+                        &ogs_pfcp_tlv_desc__interface_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DATA_NETWORK_ACCESS_IDENTIFIER_TYPE:
+            if (!msg->data_network_access_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->data_network_access_identifier,
+                        &ogs_pfcp_tlv_desc_data_network_access_identifier, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_duplicating_parameters(
+        ogs_pfcp_tlv_duplicating_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+            if (!msg->destination_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface,
+                        &ogs_pfcp_tlv_desc_destination_interface, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+            if (!msg->outer_header_creation.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_creation,
+                        &ogs_pfcp_tlv_desc_outer_header_creation, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->transport_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->transport_level_marking,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FORWARDING_POLICY_TYPE:
+            if (!msg->forwarding_policy.presence)
+                rv = ogs_tlv_parse_element(&msg->forwarding_policy,
+                        &ogs_pfcp_tlv_desc_forwarding_policy, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_redundant_transmission_forwarding_parameters(
+        ogs_pfcp_tlv_redundant_transmission_forwarding_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+            if (!msg->outer_header_creation.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_creation,
+                        &ogs_pfcp_tlv_desc_outer_header_creation, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_far(
+        ogs_pfcp_tlv_create_far_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_APPLY_ACTION_TYPE:
+            if (!msg->apply_action.presence)
+                rv = ogs_tlv_parse_element(&msg->apply_action,
+                        &ogs_pfcp_tlv_desc_apply_action, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FORWARDING_PARAMETERS_TYPE:
+            if (!msg->forwarding_parameters.presence)
+                rv = pfcp_parse_tlv_forwarding_parameters(&msg->forwarding_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DUPLICATING_PARAMETERS_TYPE:
+            if (!msg->duplicating_parameters.presence)
+                rv = pfcp_parse_tlv_duplicating_parameters(&msg->duplicating_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDUNDANT_TRANSMISSION_FORWARDING_PARAMETERS_TYPE:
+            if (!msg->redundant_transmission_forwarding_parameters.presence)
+                rv = pfcp_parse_tlv_redundant_transmission_forwarding_parameters(&msg->redundant_transmission_forwarding_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_forwarding_parameters(
+        ogs_pfcp_tlv_update_forwarding_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+            if (!msg->destination_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface,
+                        &ogs_pfcp_tlv_desc_destination_interface, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDIRECT_INFORMATION_TYPE:
+            if (!msg->redirect_information.presence)
+                rv = ogs_tlv_parse_element(&msg->redirect_information,
+                        &ogs_pfcp_tlv_desc_redirect_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+            if (!msg->outer_header_creation.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_creation,
+                        &ogs_pfcp_tlv_desc_outer_header_creation, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->transport_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->transport_level_marking,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FORWARDING_POLICY_TYPE:
+            if (!msg->forwarding_policy.presence)
+                rv = ogs_tlv_parse_element(&msg->forwarding_policy,
+                        &ogs_pfcp_tlv_desc_forwarding_policy, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_HEADER_ENRICHMENT_TYPE:
+            if (!msg->header_enrichment.presence)
+                rv = ogs_tlv_parse_element(&msg->header_enrichment,
+                        &ogs_pfcp_tlv_desc_header_enrichment, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPSMREQ_FLAGS_TYPE:
+            if (!msg->pfcpsmreq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpsmreq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpsmreq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->linked_traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__INTERFACE_TYPE_TYPE:
+            if (!msg->destination_interface_type.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface_type,
+                        &ogs_pfcp_tlv_desc__interface_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DATA_NETWORK_ACCESS_IDENTIFIER_TYPE:
+            if (!msg->data_network_access_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->data_network_access_identifier,
+                        &ogs_pfcp_tlv_desc_data_network_access_identifier, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_duplicating_parameters(
+        ogs_pfcp_tlv_update_duplicating_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+            if (!msg->destination_interface.presence)
+                rv = ogs_tlv_parse_element(&msg->destination_interface,
+                        &ogs_pfcp_tlv_desc_destination_interface, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+            if (!msg->outer_header_creation.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_creation,
+                        &ogs_pfcp_tlv_desc_outer_header_creation, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->transport_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->transport_level_marking,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FORWARDING_POLICY_TYPE:
+            if (!msg->forwarding_policy.presence)
+                rv = ogs_tlv_parse_element(&msg->forwarding_policy,
+                        &ogs_pfcp_tlv_desc_forwarding_policy, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_far(
+        ogs_pfcp_tlv_update_far_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_APPLY_ACTION_TYPE:
+            if (!msg->apply_action.presence)
+                rv = ogs_tlv_parse_element(&msg->apply_action,
+                        &ogs_pfcp_tlv_desc_apply_action, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_FORWARDING_PARAMETERS_TYPE:
+            if (!msg->update_forwarding_parameters.presence)
+                rv = pfcp_parse_tlv_update_forwarding_parameters(&msg->update_forwarding_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_DUPLICATING_PARAMETERS_TYPE:
+            if (!msg->update_duplicating_parameters.presence)
+                rv = pfcp_parse_tlv_update_duplicating_parameters(&msg->update_duplicating_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDUNDANT_TRANSMISSION_FORWARDING_PARAMETERS_TYPE:
+            if (!msg->redundant_transmission_forwarding_parameters.presence)
+                rv = pfcp_parse_tlv_redundant_transmission_forwarding_parameters(&msg->redundant_transmission_forwarding_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_pfd_context(
+        ogs_pfcp_tlv_pfd_context_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PFD_CONTENTS_TYPE:
+            if (!msg->pfd_contents.presence)
+                rv = ogs_tlv_parse_element(&msg->pfd_contents,
+                        &ogs_pfcp_tlv_desc_pfd_contents, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_application_id_s_pfds(
+        ogs_pfcp_tlv_application_id_s_pfds_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_APPLICATION_ID_TYPE:
+            if (!msg->application_id.presence)
+                rv = ogs_tlv_parse_element(&msg->application_id,
+                        &ogs_pfcp_tlv_desc_application_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFD_CONTEXT_TYPE:
+            if (!msg->pfd_context.presence)
+                rv = pfcp_parse_tlv_pfd_context(&msg->pfd_context,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_ethernet_traffic_information(
+        ogs_pfcp_tlv_ethernet_traffic_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MAC_ADDRESSES_DETECTED_TYPE:
+            if (!msg->mac_addresses_detected.presence)
+                rv = ogs_tlv_parse_element(&msg->mac_addresses_detected,
+                        &ogs_pfcp_tlv_desc_mac_addresses_detected, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MAC_ADDRESSES_REMOVED_TYPE:
+            if (!msg->mac_addresses_removed.presence)
+                rv = ogs_tlv_parse_element(&msg->mac_addresses_removed,
+                        &ogs_pfcp_tlv_desc_mac_addresses_removed, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv__access_forwarding_action_information(
+        ogs_pfcp_tlv__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_WEIGHT_TYPE:
+            if (!msg->weight.presence)
+                rv = ogs_tlv_parse_element(&msg->weight,
+                        &ogs_pfcp_tlv_desc_weight, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRIORITY_TYPE:
+            if (!msg->priority.presence)
+                rv = ogs_tlv_parse_element(&msg->priority,
+                        &ogs_pfcp_tlv_desc_priority, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            v = ogs_tlv_more_slot(msg->urr_id,
+                    sizeof(msg->urr_id[0]), OGS_ARRAY_SIZE(msg->urr_id));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_non__access_forwarding_action_information(
+        ogs_pfcp_tlv_non__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_WEIGHT_TYPE:
+            if (!msg->weight.presence)
+                rv = ogs_tlv_parse_element(&msg->weight,
+                        &ogs_pfcp_tlv_desc_weight, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRIORITY_TYPE:
+            if (!msg->priority.presence)
+                rv = ogs_tlv_parse_element(&msg->priority,
+                        &ogs_pfcp_tlv_desc_priority, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            v = ogs_tlv_more_slot(msg->urr_id,
+                    sizeof(msg->urr_id[0]), OGS_ARRAY_SIZE(msg->urr_id));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update__access_forwarding_action_information(
+        ogs_pfcp_tlv_update__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_WEIGHT_TYPE:
+            if (!msg->weight.presence)
+                rv = ogs_tlv_parse_element(&msg->weight,
+                        &ogs_pfcp_tlv_desc_weight, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRIORITY_TYPE:
+            if (!msg->priority.presence)
+                rv = ogs_tlv_parse_element(&msg->priority,
+                        &ogs_pfcp_tlv_desc_priority, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_non__access_forwarding_action_information(
+        ogs_pfcp_tlv_update_non__access_forwarding_action_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_WEIGHT_TYPE:
+            if (!msg->weight.presence)
+                rv = ogs_tlv_parse_element(&msg->weight,
+                        &ogs_pfcp_tlv_desc_weight, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRIORITY_TYPE:
+            if (!msg->priority.presence)
+                rv = ogs_tlv_parse_element(&msg->priority,
+                        &ogs_pfcp_tlv_desc_priority, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_access_availability_report(
+        ogs_pfcp_tlv_access_availability_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_ACCESS_AVAILABILITY_INFORMATION_TYPE:
+            if (!msg->access_availability_information.presence)
+                rv = ogs_tlv_parse_element(&msg->access_availability_information,
+                        &ogs_pfcp_tlv_desc_access_availability_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_qos_monitoring_report(
+        ogs_pfcp_tlv_qos_monitoring_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QFI_TYPE:
+            if (!msg->qfi.presence)
+                rv = ogs_tlv_parse_element(&msg->qfi,
+                        &ogs_pfcp_tlv_desc_qfi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QOS_MONITORING_MEASUREMENT_TYPE:
+            if (!msg->qos_monitoring_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_monitoring_measurement,
+                        &ogs_pfcp_tlv_desc_qos_monitoring_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_STAMP_TYPE:
+            if (!msg->time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->time_stamp,
+                        &ogs_pfcp_tlv_desc_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_START_TIME_TYPE:
+            if (!msg->start_time.presence)
+                rv = ogs_tlv_parse_element(&msg->start_time,
+                        &ogs_pfcp_tlv_desc_start_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_mptcp_parameters(
+        ogs_pfcp_tlv_mptcp_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MPTCP_ADDRESS_INFORMATION_TYPE:
+            if (!msg->mptcp_address_information.presence)
+                rv = ogs_tlv_parse_element(&msg->mptcp_address_information,
+                        &ogs_pfcp_tlv_desc_mptcp_address_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_LINK_SPECIFIC_IP_ADDRESS_TYPE:
+            if (!msg->ue_link_specific_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_link_specific_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_link_specific_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_atsss_ll_parameters(
+        ogs_pfcp_tlv_atsss_ll_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_ATSSS_LL_INFORMATION_TYPE:
+            if (!msg->atsss_ll_information.presence)
+                rv = ogs_tlv_parse_element(&msg->atsss_ll_information,
+                        &ogs_pfcp_tlv_desc_atsss_ll_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_pmf_parameters(
+        ogs_pfcp_tlv_pmf_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PMF_ADDRESS_INFORMATION_TYPE:
+            if (!msg->pmf_address_information.presence)
+                rv = ogs_tlv_parse_element(&msg->pmf_address_information,
+                        &ogs_pfcp_tlv_desc_pmf_address_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_join_ip_multicast_information_ie_within_usage_report(
+        ogs_pfcp_tlv_join_ip_multicast_information_ie_within_usage_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_IP_MULTICAST_ADDRESS_TYPE:
+            if (!msg->ip_multicast_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ip_multicast_address,
+                        &ogs_pfcp_tlv_desc_ip_multicast_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SOURCE_IP_ADDRESS_TYPE:
+            if (!msg->source_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->source_ip_address,
+                        &ogs_pfcp_tlv_desc_source_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_leave_ip_multicast_information_ie_within_usage_report(
+        ogs_pfcp_tlv_leave_ip_multicast_information_ie_within_usage_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_IP_MULTICAST_ADDRESS_TYPE:
+            if (!msg->ip_multicast_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ip_multicast_address,
+                        &ogs_pfcp_tlv_desc_ip_multicast_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SOURCE_IP_ADDRESS_TYPE:
+            if (!msg->source_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->source_ip_address,
+                        &ogs_pfcp_tlv_desc_source_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_urr(
+        ogs_pfcp_tlv_create_urr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_METHOD_TYPE:
+            if (!msg->measurement_method.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_method,
+                        &ogs_pfcp_tlv_desc_measurement_method, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REPORTING_TRIGGERS_TYPE:
+            if (!msg->reporting_triggers.presence)
+                rv = ogs_tlv_parse_element(&msg->reporting_triggers,
+                        &ogs_pfcp_tlv_desc_reporting_triggers, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_PERIOD_TYPE:
+            if (!msg->measurement_period.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_period,
+                        &ogs_pfcp_tlv_desc_measurement_period, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_THRESHOLD_TYPE:
+            if (!msg->volume_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_threshold,
+                        &ogs_pfcp_tlv_desc_volume_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_QUOTA_TYPE:
+            if (!msg->volume_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_quota,
+                        &ogs_pfcp_tlv_desc_volume_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_EVENT_THRESHOLD_TYPE:
+            if (!msg->event_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->event_threshold,
+                        &ogs_pfcp_tlv_desc_event_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_EVENT_QUOTA_TYPE:
+            if (!msg->event_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->event_quota,
+                        &ogs_pfcp_tlv_desc_event_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_THRESHOLD_TYPE:
+            if (!msg->time_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->time_threshold,
+                        &ogs_pfcp_tlv_desc_time_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_QUOTA_TYPE:
+            if (!msg->time_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->time_quota,
+                        &ogs_pfcp_tlv_desc_time_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUOTA_HOLDING_TIME_TYPE:
+            if (!msg->quota_holding_time.presence)
+                rv = ogs_tlv_parse_element(&msg->quota_holding_time,
+                        &ogs_pfcp_tlv_desc_quota_holding_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DROPPED_DL_TRAFFIC_THRESHOLD_TYPE:
+            if (!msg->dropped_dl_traffic_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->dropped_dl_traffic_threshold,
+                        &ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUOTA_VALIDITY_TIME_TYPE:
+            if (!msg->quota_validity_time.presence)
+                rv = ogs_tlv_parse_element(&msg->quota_validity_time,
+                        &ogs_pfcp_tlv_desc_quota_validity_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MONITORING_TIME_TYPE:
+            if (!msg->monitoring_time.presence)
+                rv = ogs_tlv_parse_element(&msg->monitoring_time,
+                        &ogs_pfcp_tlv_desc_monitoring_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_VOLUME_THRESHOLD_TYPE:
+            if (!msg->subsequent_volume_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_volume_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_volume_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_TIME_THRESHOLD_TYPE:
+            if (!msg->subsequent_time_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_time_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_time_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_VOLUME_QUOTA_TYPE:
+            if (!msg->subsequent_volume_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_volume_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_volume_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_TIME_QUOTA_TYPE:
+            if (!msg->subsequent_time_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_time_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_time_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_EVENT_THRESHOLD_TYPE:
+            if (!msg->subsequent_event_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_event_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_event_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_EVENT_QUOTA_TYPE:
+            if (!msg->subsequent_event_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_event_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_event_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_INACTIVITY_DETECTION_TIME_TYPE:
+            if (!msg->inactivity_detection_time.presence)
+                rv = ogs_tlv_parse_element(&msg->inactivity_detection_time,
+                        &ogs_pfcp_tlv_desc_inactivity_detection_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_LINKED_URR_ID_TYPE:
+            if (!msg->linked_urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_urr_id,
+                        &ogs_pfcp_tlv_desc_linked_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_INFORMATION_TYPE:
+            if (!msg->measurement_information.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_information,
+                        &ogs_pfcp_tlv_desc_measurement_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_QUOTA_MECHANISM_TYPE:
+            if (!msg->time_quota_mechanism.presence)
+                rv = ogs_tlv_parse_element(&msg->time_quota_mechanism,
+                        &ogs_pfcp_tlv_desc_time_quota_mechanism, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_AGGREGATED_URRS_TYPE:
+            if (!msg->aggregated_urrs.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregated_urrs,
+                        &ogs_pfcp_tlv_desc_aggregated_urrs, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id_for_quota_action.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id_for_quota_action,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_INACTIVITY_TIMER_TYPE:
+            if (!msg->ethernet_inactivity_timer.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_inactivity_timer,
+                        &ogs_pfcp_tlv_desc_ethernet_inactivity_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ADDITIONAL_MONITORING_TIME_TYPE:
+            if (!msg->additional_monitoring_time.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_monitoring_time,
+                        &ogs_pfcp_tlv_desc_additional_monitoring_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NUMBER_OF_REPORTS_TYPE:
+            if (!msg->number_of_reports.presence)
+                rv = ogs_tlv_parse_element(&msg->number_of_reports,
+                        &ogs_pfcp_tlv_desc_number_of_reports, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_qer(
+        ogs_pfcp_tlv_create_qer_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QER_CORRELATION_ID_TYPE:
+            if (!msg->qer_correlation_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_correlation_id,
+                        &ogs_pfcp_tlv_desc_qer_correlation_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GATE_STATUS_TYPE:
+            if (!msg->gate_status.presence)
+                rv = ogs_tlv_parse_element(&msg->gate_status,
+                        &ogs_pfcp_tlv_desc_gate_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MBR_TYPE:
+            if (!msg->maximum_bitrate.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_bitrate,
+                        &ogs_pfcp_tlv_desc_mbr, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GBR_TYPE:
+            if (!msg->guaranteed_bitrate.presence)
+                rv = ogs_tlv_parse_element(&msg->guaranteed_bitrate,
+                        &ogs_pfcp_tlv_desc_gbr, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_TYPE:
+            if (!msg->packet_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_rate,
+                        &ogs_pfcp_tlv_desc_packet_rate, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_TYPE:
+            if (!msg->packet_rate_status.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_rate_status,
+                        &ogs_pfcp_tlv_desc_packet_rate_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DL_FLOW_LEVEL_MARKING_TYPE:
+            if (!msg->dl_flow_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_flow_level_marking,
+                        &ogs_pfcp_tlv_desc_dl_flow_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QFI_TYPE:
+            if (!msg->qos_flow_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_flow_identifier,
+                        &ogs_pfcp_tlv_desc_qfi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RQI_TYPE:
+            if (!msg->reflective_qos.presence)
+                rv = ogs_tlv_parse_element(&msg->reflective_qos,
+                        &ogs_pfcp_tlv_desc_rqi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PAGING_POLICY_INDICATOR_TYPE:
+            if (!msg->paging_policy_indicator.presence)
+                rv = ogs_tlv_parse_element(&msg->paging_policy_indicator,
+                        &ogs_pfcp_tlv_desc_paging_policy_indicator, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_AVERAGING_WINDOW_TYPE:
+            if (!msg->averaging_window.presence)
+                rv = ogs_tlv_parse_element(&msg->averaging_window,
+                        &ogs_pfcp_tlv_desc_averaging_window, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QER_CONTROL_INDICATIONS_TYPE:
+            if (!msg->qer_control_indications.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_control_indications,
+                        &ogs_pfcp_tlv_desc_qer_control_indications, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_created_pdr(
+        ogs_pfcp_tlv_created_pdr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else if (!msg->local_f_teid_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_pdr(
+        ogs_pfcp_tlv_update_pdr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OUTER_HEADER_REMOVAL_TYPE:
+            if (!msg->outer_header_removal.presence)
+                rv = ogs_tlv_parse_element(&msg->outer_header_removal,
+                        &ogs_pfcp_tlv_desc_outer_header_removal, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PRECEDENCE_TYPE:
+            if (!msg->precedence.presence)
+                rv = ogs_tlv_parse_element(&msg->precedence,
+                        &ogs_pfcp_tlv_desc_precedence, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PDI_TYPE:
+            if (!msg->pdi.presence)
+                rv = pfcp_parse_tlv_pdi(&msg->pdi,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACTIVATE_PREDEFINED_RULES_TYPE:
+            if (!msg->activate_predefined_rules.presence)
+                rv = ogs_tlv_parse_element(&msg->activate_predefined_rules,
+                        &ogs_pfcp_tlv_desc_activate_predefined_rules, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DEACTIVATE_PREDEFINED_RULES_TYPE:
+            if (!msg->deactivate_predefined_rules.presence)
+                rv = ogs_tlv_parse_element(&msg->deactivate_predefined_rules,
+                        &ogs_pfcp_tlv_desc_deactivate_predefined_rules, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACTIVATION_TIME_TYPE:
+            if (!msg->activation_time.presence)
+                rv = ogs_tlv_parse_element(&msg->activation_time,
+                        &ogs_pfcp_tlv_desc_activation_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DEACTIVATION_TIME_TYPE:
+            if (!msg->deactivation_time.presence)
+                rv = ogs_tlv_parse_element(&msg->deactivation_time,
+                        &ogs_pfcp_tlv_desc_deactivation_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_IP_MULTICAST_ADDRESSING_INFO_WITHIN_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE:
+            if (!msg->ip_multicast_addressing_info.presence)
+                rv = pfcp_parse_tlv_ip_multicast_addressing_info_within_pfcp_session_establishment_request(&msg->ip_multicast_addressing_info,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_DELAY_REPORTING_TYPE:
+            if (!msg->transport_delay_reporting.presence)
+                rv = pfcp_parse_tlv_transport_delay_reporting(&msg->transport_delay_reporting,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_bar_pfcp_session_report_response(
+        ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+            if (!msg->downlink_data_notification_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->downlink_data_notification_delay,
+                        &ogs_pfcp_tlv_desc_downlink_data_notification_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DL_BUFFERING_DURATION_TYPE:
+            if (!msg->dl_buffering_duration.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_buffering_duration,
+                        &ogs_pfcp_tlv_desc_dl_buffering_duration, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DL_BUFFERING_SUGGESTED_PACKET_COUNT_TYPE:
+            if (!msg->dl_buffering_suggested_packet_count.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_buffering_suggested_packet_count,
+                        &ogs_pfcp_tlv_desc_dl_buffering_suggested_packet_count, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+            if (!msg->suggested_buffering_packets_count.presence)
+                rv = ogs_tlv_parse_element(&msg->suggested_buffering_packets_count,
+                        &ogs_pfcp_tlv_desc_suggested_buffering_packets_count, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_urr(
+        ogs_pfcp_tlv_update_urr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_METHOD_TYPE:
+            if (!msg->measurement_method.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_method,
+                        &ogs_pfcp_tlv_desc_measurement_method, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REPORTING_TRIGGERS_TYPE:
+            if (!msg->reporting_triggers.presence)
+                rv = ogs_tlv_parse_element(&msg->reporting_triggers,
+                        &ogs_pfcp_tlv_desc_reporting_triggers, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_PERIOD_TYPE:
+            if (!msg->measurement_period.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_period,
+                        &ogs_pfcp_tlv_desc_measurement_period, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_THRESHOLD_TYPE:
+            if (!msg->volume_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_threshold,
+                        &ogs_pfcp_tlv_desc_volume_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_QUOTA_TYPE:
+            if (!msg->volume_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_quota,
+                        &ogs_pfcp_tlv_desc_volume_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_THRESHOLD_TYPE:
+            if (!msg->time_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->time_threshold,
+                        &ogs_pfcp_tlv_desc_time_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_QUOTA_TYPE:
+            if (!msg->time_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->time_quota,
+                        &ogs_pfcp_tlv_desc_time_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_EVENT_THRESHOLD_TYPE:
+            if (!msg->event_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->event_threshold,
+                        &ogs_pfcp_tlv_desc_event_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_EVENT_QUOTA_TYPE:
+            if (!msg->event_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->event_quota,
+                        &ogs_pfcp_tlv_desc_event_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUOTA_HOLDING_TIME_TYPE:
+            if (!msg->quota_holding_time.presence)
+                rv = ogs_tlv_parse_element(&msg->quota_holding_time,
+                        &ogs_pfcp_tlv_desc_quota_holding_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DROPPED_DL_TRAFFIC_THRESHOLD_TYPE:
+            if (!msg->dropped_dl_traffic_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->dropped_dl_traffic_threshold,
+                        &ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUOTA_VALIDITY_TIME_TYPE:
+            if (!msg->quota_validity_time.presence)
+                rv = ogs_tlv_parse_element(&msg->quota_validity_time,
+                        &ogs_pfcp_tlv_desc_quota_validity_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MONITORING_TIME_TYPE:
+            if (!msg->monitoring_time.presence)
+                rv = ogs_tlv_parse_element(&msg->monitoring_time,
+                        &ogs_pfcp_tlv_desc_monitoring_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_VOLUME_THRESHOLD_TYPE:
+            if (!msg->subsequent_volume_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_volume_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_volume_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_TIME_THRESHOLD_TYPE:
+            if (!msg->subsequent_time_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_time_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_time_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_VOLUME_QUOTA_TYPE:
+            if (!msg->subsequent_volume_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_volume_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_volume_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_TIME_QUOTA_TYPE:
+            if (!msg->subsequent_time_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_time_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_time_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_EVENT_THRESHOLD_TYPE:
+            if (!msg->subsequent_event_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_event_threshold,
+                        &ogs_pfcp_tlv_desc_subsequent_event_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUBSEQUENT_EVENT_QUOTA_TYPE:
+            if (!msg->subsequent_event_quota.presence)
+                rv = ogs_tlv_parse_element(&msg->subsequent_event_quota,
+                        &ogs_pfcp_tlv_desc_subsequent_event_quota, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_INACTIVITY_DETECTION_TIME_TYPE:
+            if (!msg->inactivity_detection_time.presence)
+                rv = ogs_tlv_parse_element(&msg->inactivity_detection_time,
+                        &ogs_pfcp_tlv_desc_inactivity_detection_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_LINKED_URR_ID_TYPE:
+            if (!msg->linked_urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->linked_urr_id,
+                        &ogs_pfcp_tlv_desc_linked_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_INFORMATION_TYPE:
+            if (!msg->measurement_information.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_information,
+                        &ogs_pfcp_tlv_desc_measurement_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_QUOTA_MECHANISM_TYPE:
+            if (!msg->time_quota_mechanism.presence)
+                rv = ogs_tlv_parse_element(&msg->time_quota_mechanism,
+                        &ogs_pfcp_tlv_desc_time_quota_mechanism, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_AGGREGATED_URRS_TYPE:
+            if (!msg->aggregated_urrs.presence)
+                rv = ogs_tlv_parse_element(&msg->aggregated_urrs,
+                        &ogs_pfcp_tlv_desc_aggregated_urrs, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id_for_quota_action.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id_for_quota_action,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_INACTIVITY_TIMER_TYPE:
+            if (!msg->ethernet_inactivity_timer.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_inactivity_timer,
+                        &ogs_pfcp_tlv_desc_ethernet_inactivity_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ADDITIONAL_MONITORING_TIME_TYPE:
+            if (!msg->additional_monitoring_time.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_monitoring_time,
+                        &ogs_pfcp_tlv_desc_additional_monitoring_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NUMBER_OF_REPORTS_TYPE:
+            if (!msg->number_of_reports.presence)
+                rv = ogs_tlv_parse_element(&msg->number_of_reports,
+                        &ogs_pfcp_tlv_desc_number_of_reports, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_qer(
+        ogs_pfcp_tlv_update_qer_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QER_CORRELATION_ID_TYPE:
+            if (!msg->qer_correlation_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_correlation_id,
+                        &ogs_pfcp_tlv_desc_qer_correlation_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GATE_STATUS_TYPE:
+            if (!msg->gate_status.presence)
+                rv = ogs_tlv_parse_element(&msg->gate_status,
+                        &ogs_pfcp_tlv_desc_gate_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MBR_TYPE:
+            if (!msg->maximum_bitrate.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_bitrate,
+                        &ogs_pfcp_tlv_desc_mbr, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GBR_TYPE:
+            if (!msg->guaranteed_bitrate.presence)
+                rv = ogs_tlv_parse_element(&msg->guaranteed_bitrate,
+                        &ogs_pfcp_tlv_desc_gbr, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_TYPE:
+            if (!msg->packet_rate.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_rate,
+                        &ogs_pfcp_tlv_desc_packet_rate, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DL_FLOW_LEVEL_MARKING_TYPE:
+            if (!msg->dl_flow_level_marking.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_flow_level_marking,
+                        &ogs_pfcp_tlv_desc_dl_flow_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QFI_TYPE:
+            if (!msg->qos_flow_identifier.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_flow_identifier,
+                        &ogs_pfcp_tlv_desc_qfi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RQI_TYPE:
+            if (!msg->reflective_qos.presence)
+                rv = ogs_tlv_parse_element(&msg->reflective_qos,
+                        &ogs_pfcp_tlv_desc_rqi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PAGING_POLICY_INDICATOR_TYPE:
+            if (!msg->paging_policy_indicator.presence)
+                rv = ogs_tlv_parse_element(&msg->paging_policy_indicator,
+                        &ogs_pfcp_tlv_desc_paging_policy_indicator, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_AVERAGING_WINDOW_TYPE:
+            if (!msg->averaging_window.presence)
+                rv = ogs_tlv_parse_element(&msg->averaging_window,
+                        &ogs_pfcp_tlv_desc_averaging_window, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QER_CONTROL_INDICATIONS_TYPE:
+            if (!msg->qer_control_indications.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_control_indications,
+                        &ogs_pfcp_tlv_desc_qer_control_indications, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_pdr(
+        ogs_pfcp_tlv_remove_pdr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_far(
+        ogs_pfcp_tlv_remove_far_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_FAR_ID_TYPE:
+            if (!msg->far_id.presence)
+                rv = ogs_tlv_parse_element(&msg->far_id,
+                        &ogs_pfcp_tlv_desc_far_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_urr(
+        ogs_pfcp_tlv_remove_urr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_qer(
+        ogs_pfcp_tlv_remove_qer_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_load_control_information(
+        ogs_pfcp_tlv_load_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SEQUENCE_NUMBER_TYPE:
+            if (!msg->load_control_sequence_number.presence)
+                rv = ogs_tlv_parse_element(&msg->load_control_sequence_number,
+                        &ogs_pfcp_tlv_desc_sequence_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_METRIC_TYPE:
+            if (!msg->load_metric.presence)
+                rv = ogs_tlv_parse_element(&msg->load_metric,
+                        &ogs_pfcp_tlv_desc_metric, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_overload_control_information(
+        ogs_pfcp_tlv_overload_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SEQUENCE_NUMBER_TYPE:
+            if (!msg->overload_control_sequence_number.presence)
+                rv = ogs_tlv_parse_element(&msg->overload_control_sequence_number,
+                        &ogs_pfcp_tlv_desc_sequence_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_METRIC_TYPE:
+            if (!msg->overload_reduction_metric.presence)
+                rv = ogs_tlv_parse_element(&msg->overload_reduction_metric,
+                        &ogs_pfcp_tlv_desc_metric, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIMER_TYPE:
+            if (!msg->period_of_validity.presence)
+                rv = ogs_tlv_parse_element(&msg->period_of_validity,
+                        &ogs_pfcp_tlv_desc_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OCI_FLAGS_TYPE:
+            if (!msg->overload_control_information_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->overload_control_information_flags,
+                        &ogs_pfcp_tlv_desc_oci_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_application_detection_information(
+        ogs_pfcp_tlv_application_detection_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_APPLICATION_ID_TYPE:
+            if (!msg->application_id.presence)
+                rv = ogs_tlv_parse_element(&msg->application_id,
+                        &ogs_pfcp_tlv_desc_application_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_APPLICATION_INSTANCE_ID_TYPE:
+            if (!msg->application_instance_id.presence)
+                rv = ogs_tlv_parse_element(&msg->application_instance_id,
+                        &ogs_pfcp_tlv_desc_application_instance_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FLOW_INFORMATION_TYPE:
+            if (!msg->flow_information.presence)
+                rv = ogs_tlv_parse_element(&msg->flow_information,
+                        &ogs_pfcp_tlv_desc_flow_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_query_urr(
+        ogs_pfcp_tlv_query_urr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_usage_report_session_modification_response(
+        ogs_pfcp_tlv_usage_report_session_modification_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UR_SEQN_TYPE:
+            if (!msg->ur_seqn.presence)
+                rv = ogs_tlv_parse_element(&msg->ur_seqn,
+                        &ogs_pfcp_tlv_desc_ur_seqn, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+            if (!msg->usage_report_trigger.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_report_trigger,
+                        &ogs_pfcp_tlv_desc_usage_report_trigger, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_START_TIME_TYPE:
+            if (!msg->start_time.presence)
+                rv = ogs_tlv_parse_element(&msg->start_time,
+                        &ogs_pfcp_tlv_desc_start_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_END_TIME_TYPE:
+            if (!msg->end_time.presence)
+                rv = ogs_tlv_parse_element(&msg->end_time,
+                        &ogs_pfcp_tlv_desc_end_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+            if (!msg->volume_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_measurement,
+                        &ogs_pfcp_tlv_desc_volume_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+            if (!msg->duration_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->duration_measurement,
+                        &ogs_pfcp_tlv_desc_duration_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+            if (!msg->time_of_first_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_first_packet,
+                        &ogs_pfcp_tlv_desc_time_of_first_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+            if (!msg->time_of_last_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_last_packet,
+                        &ogs_pfcp_tlv_desc_time_of_last_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_INFORMATION_TYPE:
+            if (!msg->usage_information.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_information,
+                        &ogs_pfcp_tlv_desc_usage_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+            if (!msg->query_urr_reference.presence)
+                rv = ogs_tlv_parse_element(&msg->query_urr_reference,
+                        &ogs_pfcp_tlv_desc_query_urr_reference, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+            if (!msg->ethernet_traffic_information.presence)
+                rv = pfcp_parse_tlv_ethernet_traffic_information(&msg->ethernet_traffic_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_usage_report_session_deletion_response(
+        ogs_pfcp_tlv_usage_report_session_deletion_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UR_SEQN_TYPE:
+            if (!msg->ur_seqn.presence)
+                rv = ogs_tlv_parse_element(&msg->ur_seqn,
+                        &ogs_pfcp_tlv_desc_ur_seqn, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+            if (!msg->usage_report_trigger.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_report_trigger,
+                        &ogs_pfcp_tlv_desc_usage_report_trigger, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_START_TIME_TYPE:
+            if (!msg->start_time.presence)
+                rv = ogs_tlv_parse_element(&msg->start_time,
+                        &ogs_pfcp_tlv_desc_start_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_END_TIME_TYPE:
+            if (!msg->end_time.presence)
+                rv = ogs_tlv_parse_element(&msg->end_time,
+                        &ogs_pfcp_tlv_desc_end_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+            if (!msg->volume_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_measurement,
+                        &ogs_pfcp_tlv_desc_volume_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+            if (!msg->duration_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->duration_measurement,
+                        &ogs_pfcp_tlv_desc_duration_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+            if (!msg->time_of_first_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_first_packet,
+                        &ogs_pfcp_tlv_desc_time_of_first_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+            if (!msg->time_of_last_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_last_packet,
+                        &ogs_pfcp_tlv_desc_time_of_last_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_INFORMATION_TYPE:
+            if (!msg->usage_information.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_information,
+                        &ogs_pfcp_tlv_desc_usage_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+            if (!msg->ethernet_traffic_information.presence)
+                rv = pfcp_parse_tlv_ethernet_traffic_information(&msg->ethernet_traffic_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_usage_report_session_report_request(
+        ogs_pfcp_tlv_usage_report_session_report_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_URR_ID_TYPE:
+            if (!msg->urr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->urr_id,
+                        &ogs_pfcp_tlv_desc_urr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UR_SEQN_TYPE:
+            if (!msg->ur_seqn.presence)
+                rv = ogs_tlv_parse_element(&msg->ur_seqn,
+                        &ogs_pfcp_tlv_desc_ur_seqn, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+            if (!msg->usage_report_trigger.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_report_trigger,
+                        &ogs_pfcp_tlv_desc_usage_report_trigger, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_START_TIME_TYPE:
+            if (!msg->start_time.presence)
+                rv = ogs_tlv_parse_element(&msg->start_time,
+                        &ogs_pfcp_tlv_desc_start_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_END_TIME_TYPE:
+            if (!msg->end_time.presence)
+                rv = ogs_tlv_parse_element(&msg->end_time,
+                        &ogs_pfcp_tlv_desc_end_time, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+            if (!msg->volume_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->volume_measurement,
+                        &ogs_pfcp_tlv_desc_volume_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+            if (!msg->duration_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->duration_measurement,
+                        &ogs_pfcp_tlv_desc_duration_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_APPLICATION_DETECTION_INFORMATION_TYPE:
+            if (!msg->application_detection_information.presence)
+                rv = pfcp_parse_tlv_application_detection_information(&msg->application_detection_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+            if (!msg->time_of_first_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_first_packet,
+                        &ogs_pfcp_tlv_desc_time_of_first_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+            if (!msg->time_of_last_packet.presence)
+                rv = ogs_tlv_parse_element(&msg->time_of_last_packet,
+                        &ogs_pfcp_tlv_desc_time_of_last_packet, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_INFORMATION_TYPE:
+            if (!msg->usage_information.presence)
+                rv = ogs_tlv_parse_element(&msg->usage_information,
+                        &ogs_pfcp_tlv_desc_usage_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+            if (!msg->query_urr_reference.presence)
+                rv = ogs_tlv_parse_element(&msg->query_urr_reference,
+                        &ogs_pfcp_tlv_desc_query_urr_reference, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_STAMP_TYPE:
+            if (!msg->event_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->event_time_stamp,
+                        &ogs_pfcp_tlv_desc_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+            if (!msg->ethernet_traffic_information.presence)
+                rv = pfcp_parse_tlv_ethernet_traffic_information(&msg->ethernet_traffic_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_JOIN_IP_MULTICAST_INFORMATION_IE_WITHIN_USAGE_REPORT_TYPE:
+            if (!msg->join_ip_muticast_information.presence)
+                rv = pfcp_parse_tlv_join_ip_multicast_information_ie_within_usage_report(&msg->join_ip_muticast_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_LEAVE_IP_MULTICAST_INFORMATION_IE_WITHIN_USAGE_REPORT_TYPE:
+            if (!msg->leave_ip_muticast_information.presence)
+                rv = pfcp_parse_tlv_leave_ip_multicast_information_ie_within_usage_report(&msg->leave_ip_muticast_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_downlink_data_report(
+        ogs_pfcp_tlv_downlink_data_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DOWNLINK_DATA_SERVICE_INFORMATION_TYPE:
+            if (!msg->downlink_data_service_information.presence)
+                rv = ogs_tlv_parse_element(&msg->downlink_data_service_information,
+                        &ogs_pfcp_tlv_desc_downlink_data_service_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DL_DATA_PACKETS_SIZE_TYPE:
+            if (!msg->dl_data_packets_size.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_data_packets_size,
+                        &ogs_pfcp_tlv_desc_dl_data_packets_size, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DATA_STATUS_TYPE:
+            if (!msg->dl_data_status.presence)
+                rv = ogs_tlv_parse_element(&msg->dl_data_status,
+                        &ogs_pfcp_tlv_desc_data_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_bar(
+        ogs_pfcp_tlv_create_bar_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+            if (!msg->downlink_data_notification_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->downlink_data_notification_delay,
+                        &ogs_pfcp_tlv_desc_downlink_data_notification_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+            if (!msg->suggested_buffering_packets_count.presence)
+                rv = ogs_tlv_parse_element(&msg->suggested_buffering_packets_count,
+                        &ogs_pfcp_tlv_desc_suggested_buffering_packets_count, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MT_EDT_CONTROL_INFORMATION_TYPE:
+            if (!msg->mt_edt_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->mt_edt_control_information,
+                        &ogs_pfcp_tlv_desc_mt_edt_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_bar_session_modification_request(
+        ogs_pfcp_tlv_update_bar_session_modification_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+            if (!msg->downlink_data_notification_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->downlink_data_notification_delay,
+                        &ogs_pfcp_tlv_desc_downlink_data_notification_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+            if (!msg->suggested_buffering_packets_count.presence)
+                rv = ogs_tlv_parse_element(&msg->suggested_buffering_packets_count,
+                        &ogs_pfcp_tlv_desc_suggested_buffering_packets_count, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MT_EDT_CONTROL_INFORMATION_TYPE:
+            if (!msg->mt_edt_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->mt_edt_control_information,
+                        &ogs_pfcp_tlv_desc_mt_edt_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_bar(
+        ogs_pfcp_tlv_remove_bar_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_BAR_ID_TYPE:
+            if (!msg->bar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->bar_id,
+                        &ogs_pfcp_tlv_desc_bar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_error_indication_report(
+        ogs_pfcp_tlv_error_indication_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->remote_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_user_plane_path_failure_report(
+        ogs_pfcp_tlv_user_plane_path_failure_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REMOTE_GTP_U_PEER_TYPE:
+            if (!msg->remote_gtp_u_peer.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_gtp_u_peer,
+                        &ogs_pfcp_tlv_desc_remote_gtp_u_peer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_traffic_endpoint(
+        ogs_pfcp_tlv_create_traffic_endpoint_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REDUNDANT_TRANSMISSION_PARAMETERS_TYPE:
+            if (!msg->redundant_transmission_detection_parameters.presence)
+                rv = pfcp_parse_tlv_redundant_transmission_parameters(&msg->redundant_transmission_detection_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_PDU_SESSION_INFORMATION_TYPE:
+            if (!msg->ethernet_pdu_session_information.presence)
+                rv = ogs_tlv_parse_element(&msg->ethernet_pdu_session_information,
+                        &ogs_pfcp_tlv_desc_ethernet_pdu_session_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_ROUTE_TYPE:
+            if (!msg->framed_route.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_route,
+                        &ogs_pfcp_tlv_desc_framed_route, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_ROUTING_TYPE:
+            if (!msg->framed_routing.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_routing,
+                        &ogs_pfcp_tlv_desc_framed_routing, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FRAMED_IPV6_ROUTE_TYPE:
+            if (!msg->framed_ipv6_route.presence)
+                rv = ogs_tlv_parse_element(&msg->framed_ipv6_route,
+                        &ogs_pfcp_tlv_desc_framed_ipv6_route, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QFI_TYPE:
+            if (!msg->qfi.presence)
+                rv = ogs_tlv_parse_element(&msg->qfi,
+                        &ogs_pfcp_tlv_desc_qfi, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__INTERFACE_TYPE_TYPE:
+            if (!msg->source_interface_type.presence)
+                rv = ogs_tlv_parse_element(&msg->source_interface_type,
+                        &ogs_pfcp_tlv_desc__interface_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_created_traffic_endpoint(
+        ogs_pfcp_tlv_created_traffic_endpoint_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else if (!msg->local_f_teid_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_traffic_endpoint(
+        ogs_pfcp_tlv_remove_traffic_endpoint_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+            if (!msg->traffic_endpoint_id.presence)
+                rv = ogs_tlv_parse_element(&msg->traffic_endpoint_id,
+                        &ogs_pfcp_tlv_desc_traffic_endpoint_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_mar(
+        ogs_pfcp_tlv_create_mar_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MAR_ID_TYPE:
+            if (!msg->mar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->mar_id,
+                        &ogs_pfcp_tlv_desc_mar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_STEERING_FUNCTIONALITY_TYPE:
+            if (!msg->steering_functionality.presence)
+                rv = ogs_tlv_parse_element(&msg->steering_functionality,
+                        &ogs_pfcp_tlv_desc_steering_functionality, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_STEERING_MODE_TYPE:
+            if (!msg->steering_mode.presence)
+                rv = ogs_tlv_parse_element(&msg->steering_mode,
+                        &ogs_pfcp_tlv_desc_steering_mode, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->_access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv__access_forwarding_action_information(&msg->_access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NON__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->non__access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv_non__access_forwarding_action_information(&msg->non__access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_mar(
+        ogs_pfcp_tlv_remove_mar_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MAR_ID_TYPE:
+            if (!msg->mar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->mar_id,
+                        &ogs_pfcp_tlv_desc_mar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_mar(
+        ogs_pfcp_tlv_update_mar_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MAR_ID_TYPE:
+            if (!msg->mar_id.presence)
+                rv = ogs_tlv_parse_element(&msg->mar_id,
+                        &ogs_pfcp_tlv_desc_mar_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_STEERING_FUNCTIONALITY_TYPE:
+            if (!msg->steering_functionality.presence)
+                rv = ogs_tlv_parse_element(&msg->steering_functionality,
+                        &ogs_pfcp_tlv_desc_steering_functionality, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_STEERING_MODE_TYPE:
+            if (!msg->steering_mode.presence)
+                rv = ogs_tlv_parse_element(&msg->steering_mode,
+                        &ogs_pfcp_tlv_desc_steering_mode, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->update__access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv_update__access_forwarding_action_information(&msg->update__access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_NON__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->update_non__access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv_update_non__access_forwarding_action_information(&msg->update_non__access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->_access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv__access_forwarding_action_information(&msg->_access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NON__ACCESS_FORWARDING_ACTION_INFORMATION_TYPE:
+            if (!msg->non__access_forwarding_action_information.presence)
+                rv = pfcp_parse_tlv_non__access_forwarding_action_information(&msg->non__access_forwarding_action_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_pfcp_session_retention_information_within_pfcp_association_setup_request(
+        ogs_pfcp_tlv_pfcp_session_retention_information_within_pfcp_association_setup_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_CP_PFCP_ENTITY_IP_ADDRESS_TYPE:
+            if (!msg->cp_pfcp_entity_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_pfcp_entity_ip_address,
+                        &ogs_pfcp_tlv_desc_cp_pfcp_entity_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_user_plane_path_recovery_report(
+        ogs_pfcp_tlv_user_plane_path_recovery_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REMOTE_GTP_U_PEER_TYPE:
+            if (!msg->remote_gtp_u_peer.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_gtp_u_peer,
+                        &ogs_pfcp_tlv_desc_remote_gtp_u_peer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_created_bridge_info_for_tsc(
+        ogs_pfcp_tlv_created_bridge_info_for_tsc_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_DS_TT_PORT_NUMBER_TYPE:
+            if (!msg->ds_tt_port_number.presence)
+                rv = ogs_tlv_parse_element(&msg->ds_tt_port_number,
+                        &ogs_pfcp_tlv_desc_ds_tt_port_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TSN_BRIDGE_ID_TYPE:
+            if (!msg->tsn_bridge_id.presence)
+                rv = ogs_tlv_parse_element(&msg->tsn_bridge_id,
+                        &ogs_pfcp_tlv_desc_tsn_bridge_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_request(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_modification_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PORT_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->port_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->port_management_information_container,
+                        &ogs_pfcp_tlv_desc_port_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_BRIDGE_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->bridge_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->bridge_management_information_container,
+                        &ogs_pfcp_tlv_desc_bridge_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NW_TT_PORT_NUMBER_TYPE:
+            if (!msg->nw_tt_port_number.presence)
+                rv = ogs_tlv_parse_element(&msg->nw_tt_port_number,
+                        &ogs_pfcp_tlv_desc_nw_tt_port_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_response(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_modification_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PORT_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->port_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->port_management_information_container,
+                        &ogs_pfcp_tlv_desc_port_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_BRIDGE_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->bridge_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->bridge_management_information_container,
+                        &ogs_pfcp_tlv_desc_bridge_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NW_TT_PORT_NUMBER_TYPE:
+            if (!msg->nw_tt_port_number.presence)
+                rv = ogs_tlv_parse_element(&msg->nw_tt_port_number,
+                        &ogs_pfcp_tlv_desc_nw_tt_port_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_report_request(
+        ogs_pfcp_tlv_tsc_management_information_ie_within_pfcp_session_report_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PORT_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->port_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->port_management_information_container,
+                        &ogs_pfcp_tlv_desc_port_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_BRIDGE_MANAGEMENT_INFORMATION_CONTAINER_TYPE:
+            if (!msg->bridge_management_information_container.presence)
+                rv = ogs_tlv_parse_element(&msg->bridge_management_information_container,
+                        &ogs_pfcp_tlv_desc_bridge_management_information_container, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NW_TT_PORT_NUMBER_TYPE:
+            if (!msg->nw_tt_port_number.presence)
+                rv = ogs_tlv_parse_element(&msg->nw_tt_port_number,
+                        &ogs_pfcp_tlv_desc_nw_tt_port_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_clock_drift_control_information(
+        ogs_pfcp_tlv_clock_drift_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REQUESTED_CLOCK_DRIFT_INFORMATION_TYPE:
+            if (!msg->requested_clock_drift_information.presence)
+                rv = ogs_tlv_parse_element(&msg->requested_clock_drift_information,
+                        &ogs_pfcp_tlv_desc_requested_clock_drift_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TSN_TIME_DOMAIN_NUMBER_TYPE:
+            if (!msg->tsn_time_domain_number.presence)
+                rv = ogs_tlv_parse_element(&msg->tsn_time_domain_number,
+                        &ogs_pfcp_tlv_desc_tsn_time_domain_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OFFSET_THRESHOLD_TYPE:
+            if (!msg->time_offset_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->time_offset_threshold,
+                        &ogs_pfcp_tlv_desc_time_offset_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CUMULATIVE_RATERATIO_THRESHOLD_TYPE:
+            if (!msg->cumulative_rateratio_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->cumulative_rateratio_threshold,
+                        &ogs_pfcp_tlv_desc_cumulative_rateratio_threshold, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_clock_drift_report(
+        ogs_pfcp_tlv_clock_drift_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_TSN_TIME_DOMAIN_NUMBER_TYPE:
+            if (!msg->tsn_time_domain_number.presence)
+                rv = ogs_tlv_parse_element(&msg->tsn_time_domain_number,
+                        &ogs_pfcp_tlv_desc_tsn_time_domain_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_OFFSET_MEASUREMENT_TYPE:
+            if (!msg->time_offset_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->time_offset_measurement,
+                        &ogs_pfcp_tlv_desc_time_offset_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CUMULATIVE_RATERATIO_MEASUREMENT_TYPE:
+            if (!msg->cumulative_rateratio_measurement.presence)
+                rv = ogs_tlv_parse_element(&msg->cumulative_rateratio_measurement,
+                        &ogs_pfcp_tlv_desc_cumulative_rateratio_measurement, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIME_STAMP_TYPE:
+            if (!msg->time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->time_stamp,
+                        &ogs_pfcp_tlv_desc_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_remove_srr(
+        ogs_pfcp_tlv_remove_srr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SRR_ID_TYPE:
+            if (!msg->srr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->srr_id,
+                        &ogs_pfcp_tlv_desc_srr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_create_srr(
+        ogs_pfcp_tlv_create_srr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SRR_ID_TYPE:
+            if (!msg->srr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->srr_id,
+                        &ogs_pfcp_tlv_desc_srr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACCESS_AVAILABILITY_CONTROL_INFORMATION_TYPE:
+            if (!msg->access_availability_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->access_availability_control_information,
+                        &ogs_pfcp_tlv_desc_access_availability_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QOS_MONITORING_PER_QOS_FLOW_CONTROL_INFORMATION_TYPE:
+            if (!msg->qos_monitoring_per_qos_flow_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_monitoring_per_qos_flow_control_information,
+                        &ogs_pfcp_tlv_desc_qos_monitoring_per_qos_flow_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_update_srr(
+        ogs_pfcp_tlv_update_srr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SRR_ID_TYPE:
+            if (!msg->srr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->srr_id,
+                        &ogs_pfcp_tlv_desc_srr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACCESS_AVAILABILITY_CONTROL_INFORMATION_TYPE:
+            if (!msg->access_availability_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->access_availability_control_information,
+                        &ogs_pfcp_tlv_desc_access_availability_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QOS_MONITORING_PER_QOS_FLOW_CONTROL_INFORMATION_TYPE:
+            if (!msg->qos_monitoring_per_qos_flow_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_monitoring_per_qos_flow_control_information,
+                        &ogs_pfcp_tlv_desc_qos_monitoring_per_qos_flow_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_session_report(
+        ogs_pfcp_tlv_session_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SRR_ID_TYPE:
+            if (!msg->srr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->srr_id,
+                        &ogs_pfcp_tlv_desc_srr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACCESS_AVAILABILITY_REPORT_TYPE:
+            if (!msg->access_availability_report.presence)
+                rv = pfcp_parse_tlv_access_availability_report(&msg->access_availability_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QOS_MONITORING_REPORT_TYPE:
+            if (!msg->qos_monitoring_report.presence)
+                rv = pfcp_parse_tlv_qos_monitoring_report(&msg->qos_monitoring_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_provide_atsss_control_information(
+        ogs_pfcp_tlv_provide_atsss_control_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MPTCP_CONTROL_INFORMATION_TYPE:
+            if (!msg->mptcp_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->mptcp_control_information,
+                        &ogs_pfcp_tlv_desc_mptcp_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ATSSS_LL_CONTROL_INFORMATION_TYPE:
+            if (!msg->atsss_ll_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->atsss_ll_control_information,
+                        &ogs_pfcp_tlv_desc_atsss_ll_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PMF_CONTROL_INFORMATION_TYPE:
+            if (!msg->pmf_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->pmf_control_information,
+                        &ogs_pfcp_tlv_desc_pmf_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_atsss_control_parameters(
+        ogs_pfcp_tlv_atsss_control_parameters_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MPTCP_PARAMETERS_TYPE:
+            if (!msg->mptcp_parameters.presence)
+                rv = pfcp_parse_tlv_mptcp_parameters(&msg->mptcp_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ATSSS_LL_PARAMETERS_TYPE:
+            if (!msg->atsss_ll_parameters.presence)
+                rv = pfcp_parse_tlv_atsss_ll_parameters(&msg->atsss_ll_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PMF_PARAMETERS_TYPE:
+            if (!msg->pmf_parameters.presence)
+                rv = pfcp_parse_tlv_pmf_parameters(&msg->pmf_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_ue_ip_address_pool_information(
+        ogs_pfcp_tlv_ue_ip_address_pool_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_identity.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_identity,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_S_NSSAI_TYPE:
+            if (!msg->s_nssai.presence)
+                rv = ogs_tlv_parse_element(&msg->s_nssai,
+                        &ogs_pfcp_tlv_desc_s_nssai, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_IP_VERSION_TYPE:
+            if (!msg->ip_version.presence)
+                rv = ogs_tlv_parse_element(&msg->ip_version,
+                        &ogs_pfcp_tlv_desc_ip_version, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_gtp_u_path_qos_report_pfcp_node_report_request(
+        ogs_pfcp_tlv_gtp_u_path_qos_report_pfcp_node_report_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REMOTE_GTP_U_PEER_TYPE:
+            if (!msg->remote_gtp_u_peer.presence)
+                rv = ogs_tlv_parse_element(&msg->remote_gtp_u_peer,
+                        &ogs_pfcp_tlv_desc_remote_gtp_u_peer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GTP_U_PATH_INTERFACE_TYPE_TYPE:
+            if (!msg->gtp_u_path_interface_type.presence)
+                rv = ogs_tlv_parse_element(&msg->gtp_u_path_interface_type,
+                        &ogs_pfcp_tlv_desc_gtp_u_path_interface_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QOS_REPORT_TRIGGER_TYPE:
+            if (!msg->qos_report_trigger.presence)
+                rv = ogs_tlv_parse_element(&msg->qos_report_trigger,
+                        &ogs_pfcp_tlv_desc_qos_report_trigger, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->dscp.presence)
+                rv = ogs_tlv_parse_element(&msg->dscp,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MEASUREMENT_PERIOD_TYPE:
+            if (!msg->measurement_period.presence)
+                rv = ogs_tlv_parse_element(&msg->measurement_period,
+                        &ogs_pfcp_tlv_desc_measurement_period, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_AVERAGE_PACKET_DELAY_TYPE:
+            if (!msg->average_packet_delay_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->average_packet_delay_threshold,
+                        &ogs_pfcp_tlv_desc_average_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MINIMUM_PACKET_DELAY_TYPE:
+            if (!msg->minimum_packet_delay_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->minimum_packet_delay_threshold,
+                        &ogs_pfcp_tlv_desc_minimum_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MAXIMUM_PACKET_DELAY_TYPE:
+            if (!msg->maximum_packet_delay_threshold.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_packet_delay_threshold,
+                        &ogs_pfcp_tlv_desc_maximum_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TIMER_TYPE:
+            if (!msg->minimum_waiting_time.presence)
+                rv = ogs_tlv_parse_element(&msg->minimum_waiting_time,
+                        &ogs_pfcp_tlv_desc_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_qos_information_in_gtp_u_path_qos_report(
+        ogs_pfcp_tlv_qos_information_in_gtp_u_path_qos_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_AVERAGE_PACKET_DELAY_TYPE:
+            if (!msg->average_packet_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->average_packet_delay,
+                        &ogs_pfcp_tlv_desc_average_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MINIMUM_PACKET_DELAY_TYPE:
+            if (!msg->minimum_packet_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->minimum_packet_delay,
+                        &ogs_pfcp_tlv_desc_minimum_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_MAXIMUM_PACKET_DELAY_TYPE:
+            if (!msg->maximum_packet_delay.presence)
+                rv = ogs_tlv_parse_element(&msg->maximum_packet_delay,
+                        &ogs_pfcp_tlv_desc_maximum_packet_delay, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+            if (!msg->dscp.presence)
+                rv = ogs_tlv_parse_element(&msg->dscp,
+                        &ogs_pfcp_tlv_desc_transport_level_marking, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_packet_rate_status_report(
+        ogs_pfcp_tlv_packet_rate_status_report_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_TYPE:
+            if (!msg->packet_rate_status.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_rate_status,
+                        &ogs_pfcp_tlv_desc_packet_rate_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_ethernet_context_information(
+        ogs_pfcp_tlv_ethernet_context_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_MAC_ADDRESSES_DETECTED_TYPE:
+            if (!msg->mac_addresses_detected.presence)
+                rv = ogs_tlv_parse_element(&msg->mac_addresses_detected,
+                        &ogs_pfcp_tlv_desc_mac_addresses_detected, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_updated_pdr(
+        ogs_pfcp_tlv_updated_pdr_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_PDR_ID_TYPE:
+            if (!msg->pdr_id.presence)
+                rv = ogs_tlv_parse_element(&msg->pdr_id,
+                        &ogs_pfcp_tlv_desc_pdr_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->local_f_teid_for_redundant_transmission.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid_for_redundant_transmission,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else if (!msg->local_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->local_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_provide_rds_configuration_information(
+        ogs_pfcp_tlv_provide_rds_configuration_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_RDS_CONFIGURATION_INFORMATION_TYPE:
+            if (!msg->rds_configuration_information.presence)
+                rv = ogs_tlv_parse_element(&msg->rds_configuration_information,
+                        &ogs_pfcp_tlv_desc_rds_configuration_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_query_packet_rate_status_ie_within_pfcp_session_modification_request(
+        ogs_pfcp_tlv_query_packet_rate_status_ie_within_pfcp_session_modification_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_packet_rate_status_report_ie_within_pfcp_session_modification_response(
+        ogs_pfcp_tlv_packet_rate_status_report_ie_within_pfcp_session_modification_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_QER_ID_TYPE:
+            if (!msg->qer_id.presence)
+                rv = ogs_tlv_parse_element(&msg->qer_id,
+                        &ogs_pfcp_tlv_desc_qer_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_TYPE:
+            if (!msg->packet_rate_status.presence)
+                rv = ogs_tlv_parse_element(&msg->packet_rate_status,
+                        &ogs_pfcp_tlv_desc_packet_rate_status, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_tlv_ue_ip_address_usage_information(
+        ogs_pfcp_tlv_ue_ip_address_usage_information_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_SEQUENCE_NUMBER_TYPE:
+            if (!msg->ue_ip_address_usage_sequence_number.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_usage_sequence_number,
+                        &ogs_pfcp_tlv_desc_sequence_number, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_METRIC_TYPE:
+            if (!msg->ue_ip_address_usage_metric.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_usage_metric,
+                        &ogs_pfcp_tlv_desc_metric, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_VALIDITY_TIMER_TYPE:
+            if (!msg->validity_timer.presence)
+                rv = ogs_tlv_parse_element(&msg->validity_timer,
+                        &ogs_pfcp_tlv_desc_validity_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NUMBER_OF_UE_IP_ADDRESSES_TYPE:
+            if (!msg->number_of_ue_ip_addresses.presence)
+                rv = ogs_tlv_parse_element(&msg->number_of_ue_ip_addresses,
+                        &ogs_pfcp_tlv_desc_number_of_ue_ip_addresses, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+            if (!msg->network_instance.presence)
+                rv = ogs_tlv_parse_element(&msg->network_instance,
+                        &ogs_pfcp_tlv_desc_network_instance, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_id.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_id,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    msg->presence = 1;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_heartbeat_request(
+        ogs_pfcp_heartbeat_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+            if (!msg->recovery_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery_time_stamp,
+                        &ogs_pfcp_tlv_desc_recovery_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SOURCE_IP_ADDRESS_TYPE:
+            if (!msg->source_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->source_ip_address,
+                        &ogs_pfcp_tlv_desc_source_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_heartbeat_response(
+        ogs_pfcp_heartbeat_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+            if (!msg->recovery_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery_time_stamp,
+                        &ogs_pfcp_tlv_desc_recovery_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_pfd_management_request(
+        ogs_pfcp_pfd_management_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_APPLICATION_ID_S_PFDS_TYPE:
+            if (!msg->application_id_s_pfds.presence)
+                rv = pfcp_parse_tlv_application_id_s_pfds(&msg->application_id_s_pfds,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_pfd_management_response(
+        ogs_pfcp_pfd_management_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_setup_request(
+        ogs_pfcp_association_setup_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+            if (!msg->recovery_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery_time_stamp,
+                        &ogs_pfcp_tlv_desc_recovery_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+            if (!msg->up_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->up_function_features,
+                        &ogs_pfcp_tlv_desc_up_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+            if (!msg->cp_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_function_features,
+                        &ogs_pfcp_tlv_desc_cp_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+            v = ogs_tlv_more_slot(msg->user_plane_ip_resource_information,
+                    sizeof(msg->user_plane_ip_resource_information[0]), OGS_ARRAY_SIZE(msg->user_plane_ip_resource_information));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_user_plane_ip_resource_information, &e);
+            break;
+        case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+            if (!msg->alternative_smf_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->alternative_smf_ip_address,
+                        &ogs_pfcp_tlv_desc_alternative_smf_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SMF_SET_ID_TYPE:
+            if (!msg->smf_set_id.presence)
+                rv = ogs_tlv_parse_element(&msg->smf_set_id,
+                        &ogs_pfcp_tlv_desc_smf_set_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCP_SESSION_RETENTION_INFORMATION_WITHIN_PFCP_ASSOCIATION_SETUP_REQUEST_TYPE:
+            if (!msg->pfcp_session_retention_information.presence)
+                rv = pfcp_parse_tlv_pfcp_session_retention_information_within_pfcp_association_setup_request(&msg->pfcp_session_retention_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_information.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_information,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GTP_U_PATH_QOS_CONTROL_INFORMATION_TYPE:
+            if (!msg->gtp_u_path_qos_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->gtp_u_path_qos_control_information,
+                        &ogs_pfcp_tlv_desc_gtp_u_path_qos_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CLOCK_DRIFT_CONTROL_INFORMATION_TYPE:
+            if (!msg->clock_drift_control_information.presence)
+                rv = pfcp_parse_tlv_clock_drift_control_information(&msg->clock_drift_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NF_INSTANCE_ID_TYPE:
+            if (!msg->upf_instance_id.presence)
+                rv = ogs_tlv_parse_element(&msg->upf_instance_id,
+                        &ogs_pfcp_tlv_desc_nf_instance_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPASREQ_FLAGS_TYPE:
+            if (!msg->pfcpasreq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpasreq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpasreq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_setup_response(
+        ogs_pfcp_association_setup_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+            if (!msg->recovery_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery_time_stamp,
+                        &ogs_pfcp_tlv_desc_recovery_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+            if (!msg->up_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->up_function_features,
+                        &ogs_pfcp_tlv_desc_up_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+            if (!msg->cp_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_function_features,
+                        &ogs_pfcp_tlv_desc_cp_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+            v = ogs_tlv_more_slot(msg->user_plane_ip_resource_information,
+                    sizeof(msg->user_plane_ip_resource_information[0]), OGS_ARRAY_SIZE(msg->user_plane_ip_resource_information));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_user_plane_ip_resource_information, &e);
+            break;
+        case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+            if (!msg->alternative_smf_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->alternative_smf_ip_address,
+                        &ogs_pfcp_tlv_desc_alternative_smf_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SMF_SET_ID_TYPE:
+            if (!msg->smf_set_id.presence)
+                rv = ogs_tlv_parse_element(&msg->smf_set_id,
+                        &ogs_pfcp_tlv_desc_smf_set_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPASRSP_FLAGS_TYPE:
+            if (!msg->pfcpasrsp_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpasrsp_flags,
+                        &ogs_pfcp_tlv_desc_pfcpasrsp_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CLOCK_DRIFT_CONTROL_INFORMATION_TYPE:
+            if (!msg->clock_drift_control_information.presence)
+                rv = pfcp_parse_tlv_clock_drift_control_information(&msg->clock_drift_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_information.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_information,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GTP_U_PATH_QOS_CONTROL_INFORMATION_TYPE:
+            if (!msg->gtp_u_path_qos_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->gtp_u_path_qos_control_information,
+                        &ogs_pfcp_tlv_desc_gtp_u_path_qos_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NF_INSTANCE_ID_TYPE:
+            if (!msg->upf_instance_id.presence)
+                rv = ogs_tlv_parse_element(&msg->upf_instance_id,
+                        &ogs_pfcp_tlv_desc_nf_instance_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_update_request(
+        ogs_pfcp_association_update_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+            if (!msg->up_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->up_function_features,
+                        &ogs_pfcp_tlv_desc_up_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+            if (!msg->cp_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_function_features,
+                        &ogs_pfcp_tlv_desc_cp_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+            v = ogs_tlv_more_slot(msg->user_plane_ip_resource_information,
+                    sizeof(msg->user_plane_ip_resource_information[0]), OGS_ARRAY_SIZE(msg->user_plane_ip_resource_information));
+            if (v)
+                rv = ogs_tlv_parse_element(v,
+                        &ogs_pfcp_tlv_desc_user_plane_ip_resource_information, &e);
+            break;
+        case OGS_PFCP_PFCP_ASSOCIATION_RELEASE_REQUEST_TYPE:
+            if (!msg->pfcp_association_release_request.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcp_association_release_request,
+                        &ogs_pfcp_tlv_desc_pfcp_association_release_request, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GRACEFUL_RELEASE_PERIOD_TYPE:
+            if (!msg->graceful_release_period.presence)
+                rv = ogs_tlv_parse_element(&msg->graceful_release_period,
+                        &ogs_pfcp_tlv_desc_graceful_release_period, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPAUREQ_FLAGS_TYPE:
+            if (!msg->pfcpaureq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpaureq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpaureq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+            if (!msg->alternative_smf_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->alternative_smf_ip_address,
+                        &ogs_pfcp_tlv_desc_alternative_smf_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SMF_SET_ID_TYPE:
+            if (!msg->smf_set_id.presence)
+                rv = ogs_tlv_parse_element(&msg->smf_set_id,
+                        &ogs_pfcp_tlv_desc_smf_set_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CLOCK_DRIFT_CONTROL_INFORMATION_TYPE:
+            if (!msg->clock_drift_control_information.presence)
+                rv = pfcp_parse_tlv_clock_drift_control_information(&msg->clock_drift_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+            if (!msg->ue_ip_address_pool_information.presence)
+                rv = ogs_tlv_parse_element(&msg->ue_ip_address_pool_information,
+                        &ogs_pfcp_tlv_desc_ue_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GTP_U_PATH_QOS_CONTROL_INFORMATION_TYPE:
+            if (!msg->gtp_u_path_qos_control_information.presence)
+                rv = ogs_tlv_parse_element(&msg->gtp_u_path_qos_control_information,
+                        &ogs_pfcp_tlv_desc_gtp_u_path_qos_control_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_USAGE_INFORMATION_TYPE:
+            if (!msg->ue_ip_address_usage_information.presence)
+                rv = pfcp_parse_tlv_ue_ip_address_usage_information(&msg->ue_ip_address_usage_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_update_response(
+        ogs_pfcp_association_update_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+            if (!msg->up_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->up_function_features,
+                        &ogs_pfcp_tlv_desc_up_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+            if (!msg->cp_function_features.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_function_features,
+                        &ogs_pfcp_tlv_desc_cp_function_features, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UE_IP_ADDRESS_USAGE_INFORMATION_TYPE:
+            if (!msg->ue_ip_address_usage_information.presence)
+                rv = pfcp_parse_tlv_ue_ip_address_usage_information(&msg->ue_ip_address_usage_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_release_request(
+        ogs_pfcp_association_release_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_association_release_response(
+        ogs_pfcp_association_release_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_version_not_supported_response(
+        ogs_pfcp_version_not_supported_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_node_report_request(
+        ogs_pfcp_node_report_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NODE_REPORT_TYPE_TYPE:
+            if (!msg->node_report_type.presence)
+                rv = ogs_tlv_parse_element(&msg->node_report_type,
+                        &ogs_pfcp_tlv_desc_node_report_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_PATH_FAILURE_REPORT_TYPE:
+            if (!msg->user_plane_path_failure_report.presence)
+                rv = pfcp_parse_tlv_user_plane_path_failure_report(&msg->user_plane_path_failure_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_PATH_RECOVERY_REPORT_TYPE:
+            if (!msg->user_plane_path_recovery_report.presence)
+                rv = pfcp_parse_tlv_user_plane_path_recovery_report(&msg->user_plane_path_recovery_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CLOCK_DRIFT_REPORT_TYPE:
+            if (!msg->clock_drift_report.presence)
+                rv = pfcp_parse_tlv_clock_drift_report(&msg->clock_drift_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_GTP_U_PATH_QOS_REPORT_PFCP_NODE_REPORT_REQUEST_TYPE:
+            if (!msg->gtp_u_path_qos_report.presence)
+                rv = pfcp_parse_tlv_gtp_u_path_qos_report_pfcp_node_report_request(&msg->gtp_u_path_qos_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_node_report_response(
+        ogs_pfcp_node_report_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_set_deletion_request(
+        ogs_pfcp_session_set_deletion_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FQ_CSID_TYPE:
+            if (!msg->sgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->pgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->pgw_u_sgw_u_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_u_sgw_u_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_set_deletion_response(
+        ogs_pfcp_session_set_deletion_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_establishment_request(
+        ogs_pfcp_session_establishment_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_SEID_TYPE:
+            if (!msg->cp_f_seid.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_f_seid,
+                        &ogs_pfcp_tlv_desc_f_seid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_pdr,
+                    sizeof(msg->create_pdr[0]), OGS_ARRAY_SIZE(msg->create_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_create_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_FAR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_far,
+                    sizeof(msg->create_far[0]), OGS_ARRAY_SIZE(msg->create_far));
+            if (v)
+                rv = pfcp_parse_tlv_create_far(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_URR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_urr,
+                    sizeof(msg->create_urr[0]), OGS_ARRAY_SIZE(msg->create_urr));
+            if (v)
+                rv = pfcp_parse_tlv_create_urr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_QER_TYPE:
+            v = ogs_tlv_more_slot(msg->create_qer,
+                    sizeof(msg->create_qer[0]), OGS_ARRAY_SIZE(msg->create_qer));
+            if (v)
+                rv = pfcp_parse_tlv_create_qer(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_BAR_TYPE:
+            if (!msg->create_bar.presence)
+                rv = pfcp_parse_tlv_create_bar(&msg->create_bar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->create_traffic_endpoint.presence)
+                rv = pfcp_parse_tlv_create_traffic_endpoint(&msg->create_traffic_endpoint,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PDN_TYPE_TYPE:
+            if (!msg->pdn_type.presence)
+                rv = ogs_tlv_parse_element(&msg->pdn_type,
+                        &ogs_pfcp_tlv_desc_pdn_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FQ_CSID_TYPE:
+            if (!msg->sgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->pgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_INACTIVITY_TIMER_TYPE:
+            if (!msg->user_plane_inactivity_timer.presence)
+                rv = ogs_tlv_parse_element(&msg->user_plane_inactivity_timer,
+                        &ogs_pfcp_tlv_desc_user_plane_inactivity_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_ID_TYPE:
+            if (!msg->user_id.presence)
+                rv = ogs_tlv_parse_element(&msg->user_id,
+                        &ogs_pfcp_tlv_desc_user_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRACE_INFORMATION_TYPE:
+            if (!msg->trace_information.presence)
+                rv = ogs_tlv_parse_element(&msg->trace_information,
+                        &ogs_pfcp_tlv_desc_trace_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_APN_DNN_TYPE:
+            if (!msg->apn_dnn.presence)
+                rv = ogs_tlv_parse_element(&msg->apn_dnn,
+                        &ogs_pfcp_tlv_desc_apn_dnn, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_MAR_TYPE:
+            if (!msg->create_mar.presence)
+                rv = pfcp_parse_tlv_create_mar(&msg->create_mar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPSEREQ_FLAGS_TYPE:
+            if (!msg->pfcpsereq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpsereq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpsereq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_BRIDGE_INFO_FOR_TSC_TYPE:
+            if (!msg->create_bridge_info_for_tsc.presence)
+                rv = ogs_tlv_parse_element(&msg->create_bridge_info_for_tsc,
+                        &ogs_pfcp_tlv_desc_create_bridge_info_for_tsc, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_SRR_TYPE:
+            if (!msg->create_srr.presence)
+                rv = pfcp_parse_tlv_create_srr(&msg->create_srr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PROVIDE_ATSSS_CONTROL_INFORMATION_TYPE:
+            if (!msg->provide_atsss_control_information.presence)
+                rv = pfcp_parse_tlv_provide_atsss_control_information(&msg->provide_atsss_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+            if (!msg->recovery_time_stamp.presence)
+                rv = ogs_tlv_parse_element(&msg->recovery_time_stamp,
+                        &ogs_pfcp_tlv_desc_recovery_time_stamp, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_S_NSSAI_TYPE:
+            if (!msg->s_nssai.presence)
+                rv = ogs_tlv_parse_element(&msg->s_nssai,
+                        &ogs_pfcp_tlv_desc_s_nssai, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PROVIDE_RDS_CONFIGURATION_INFORMATION_TYPE:
+            if (!msg->provide_rds_configuration_information.presence)
+                rv = pfcp_parse_tlv_provide_rds_configuration_information(&msg->provide_rds_configuration_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_establishment_response(
+        ogs_pfcp_session_establishment_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_SEID_TYPE:
+            if (!msg->up_f_seid.presence)
+                rv = ogs_tlv_parse_element(&msg->up_f_seid,
+                        &ogs_pfcp_tlv_desc_f_seid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATED_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->created_pdr,
+                    sizeof(msg->created_pdr[0]), OGS_ARRAY_SIZE(msg->created_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_created_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->load_control_information.presence)
+                rv = pfcp_parse_tlv_load_control_information(&msg->load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->overload_control_information.presence)
+                rv = pfcp_parse_tlv_overload_control_information(&msg->overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FQ_CSID_TYPE:
+            if (!msg->pgw_u_sgw_u_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_u_sgw_u_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FAILED_RULE_ID_TYPE:
+            if (!msg->failed_rule_id.presence)
+                rv = ogs_tlv_parse_element(&msg->failed_rule_id,
+                        &ogs_pfcp_tlv_desc_failed_rule_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATED_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->created_traffic_endpoint.presence)
+                rv = pfcp_parse_tlv_created_traffic_endpoint(&msg->created_traffic_endpoint,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATED_BRIDGE_INFO_FOR_TSC_TYPE:
+            if (!msg->created_bridge_info_for_tsc.presence)
+                rv = pfcp_parse_tlv_created_bridge_info_for_tsc(&msg->created_bridge_info_for_tsc,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ATSSS_CONTROL_PARAMETERS_TYPE:
+            if (!msg->atsss_control_parameters.presence)
+                rv = pfcp_parse_tlv_atsss_control_parameters(&msg->atsss_control_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_RDS_CONFIGURATION_INFORMATION_TYPE:
+            if (!msg->rds_configuration_information.presence)
+                rv = ogs_tlv_parse_element(&msg->rds_configuration_information,
+                        &ogs_pfcp_tlv_desc_rds_configuration_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_modification_request(
+        ogs_pfcp_session_modification_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_F_SEID_TYPE:
+            if (!msg->cp_f_seid.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_f_seid,
+                        &ogs_pfcp_tlv_desc_f_seid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REMOVE_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->remove_pdr,
+                    sizeof(msg->remove_pdr[0]), OGS_ARRAY_SIZE(msg->remove_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_remove_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_REMOVE_FAR_TYPE:
+            v = ogs_tlv_more_slot(msg->remove_far,
+                    sizeof(msg->remove_far[0]), OGS_ARRAY_SIZE(msg->remove_far));
+            if (v)
+                rv = pfcp_parse_tlv_remove_far(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_REMOVE_URR_TYPE:
+            v = ogs_tlv_more_slot(msg->remove_urr,
+                    sizeof(msg->remove_urr[0]), OGS_ARRAY_SIZE(msg->remove_urr));
+            if (v)
+                rv = pfcp_parse_tlv_remove_urr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_REMOVE_QER_TYPE:
+            v = ogs_tlv_more_slot(msg->remove_qer,
+                    sizeof(msg->remove_qer[0]), OGS_ARRAY_SIZE(msg->remove_qer));
+            if (v)
+                rv = pfcp_parse_tlv_remove_qer(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_REMOVE_BAR_TYPE:
+            if (!msg->remove_bar.presence)
+                rv = pfcp_parse_tlv_remove_bar(&msg->remove_bar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REMOVE_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->remove_traffic_endpoint.presence)
+                rv = pfcp_parse_tlv_remove_traffic_endpoint(&msg->remove_traffic_endpoint,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_pdr,
+                    sizeof(msg->create_pdr[0]), OGS_ARRAY_SIZE(msg->create_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_create_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_FAR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_far,
+                    sizeof(msg->create_far[0]), OGS_ARRAY_SIZE(msg->create_far));
+            if (v)
+                rv = pfcp_parse_tlv_create_far(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_URR_TYPE:
+            v = ogs_tlv_more_slot(msg->create_urr,
+                    sizeof(msg->create_urr[0]), OGS_ARRAY_SIZE(msg->create_urr));
+            if (v)
+                rv = pfcp_parse_tlv_create_urr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_QER_TYPE:
+            v = ogs_tlv_more_slot(msg->create_qer,
+                    sizeof(msg->create_qer[0]), OGS_ARRAY_SIZE(msg->create_qer));
+            if (v)
+                rv = pfcp_parse_tlv_create_qer(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_CREATE_BAR_TYPE:
+            if (!msg->create_bar.presence)
+                rv = pfcp_parse_tlv_create_bar(&msg->create_bar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->create_traffic_endpoint.presence)
+                rv = pfcp_parse_tlv_create_traffic_endpoint(&msg->create_traffic_endpoint,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->update_pdr,
+                    sizeof(msg->update_pdr[0]), OGS_ARRAY_SIZE(msg->update_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_update_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_UPDATE_FAR_TYPE:
+            v = ogs_tlv_more_slot(msg->update_far,
+                    sizeof(msg->update_far[0]), OGS_ARRAY_SIZE(msg->update_far));
+            if (v)
+                rv = pfcp_parse_tlv_update_far(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_UPDATE_URR_TYPE:
+            v = ogs_tlv_more_slot(msg->update_urr,
+                    sizeof(msg->update_urr[0]), OGS_ARRAY_SIZE(msg->update_urr));
+            if (v)
+                rv = pfcp_parse_tlv_update_urr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_UPDATE_QER_TYPE:
+            v = ogs_tlv_more_slot(msg->update_qer,
+                    sizeof(msg->update_qer[0]), OGS_ARRAY_SIZE(msg->update_qer));
+            if (v)
+                rv = pfcp_parse_tlv_update_qer(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_UPDATE_BAR_SESSION_MODIFICATION_REQUEST_TYPE:
+            if (!msg->update_bar.presence)
+                rv = pfcp_parse_tlv_update_bar_session_modification_request(&msg->update_bar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->update_traffic_endpoint.presence)
+                rv = ogs_tlv_parse_element(&msg->update_traffic_endpoint,
+                        &ogs_pfcp_tlv_desc_update_traffic_endpoint, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPSMREQ_FLAGS_TYPE:
+            if (!msg->pfcpsmreq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpsmreq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpsmreq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUERY_URR_TYPE:
+            if (!msg->query_urr.presence)
+                rv = pfcp_parse_tlv_query_urr(&msg->query_urr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_FQ_CSID_TYPE:
+            if (!msg->pgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->pgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->sgw_c_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->sgw_c_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->mme_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->mme_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->epdg_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->epdg_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else if (!msg->twan_fq_csid.presence)
+                rv = ogs_tlv_parse_element(&msg->twan_fq_csid,
+                        &ogs_pfcp_tlv_desc_fq_csid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USER_PLANE_INACTIVITY_TIMER_TYPE:
+            if (!msg->user_plane_inactivity_timer.presence)
+                rv = ogs_tlv_parse_element(&msg->user_plane_inactivity_timer,
+                        &ogs_pfcp_tlv_desc_user_plane_inactivity_timer, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+            if (!msg->query_urr_reference.presence)
+                rv = ogs_tlv_parse_element(&msg->query_urr_reference,
+                        &ogs_pfcp_tlv_desc_query_urr_reference, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TRACE_INFORMATION_TYPE:
+            if (!msg->trace_information.presence)
+                rv = ogs_tlv_parse_element(&msg->trace_information,
+                        &ogs_pfcp_tlv_desc_trace_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REMOVE_MAR_TYPE:
+            if (!msg->remove_mar.presence)
+                rv = pfcp_parse_tlv_remove_mar(&msg->remove_mar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_MAR_TYPE:
+            if (!msg->update_mar.presence)
+                rv = pfcp_parse_tlv_update_mar(&msg->update_mar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_MAR_TYPE:
+            if (!msg->create_mar.presence)
+                rv = pfcp_parse_tlv_create_mar(&msg->create_mar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_NODE_ID_TYPE:
+            if (!msg->node_id.presence)
+                rv = ogs_tlv_parse_element(&msg->node_id,
+                        &ogs_pfcp_tlv_desc_node_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TSC_MANAGEMENT_INFORMATION_IE_WITHIN_PFCP_SESSION_MODIFICATION_REQUEST_TYPE:
+            if (!msg->tsc_management_information.presence)
+                rv = pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_request(&msg->tsc_management_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_REMOVE_SRR_TYPE:
+            if (!msg->remove_srr.presence)
+                rv = pfcp_parse_tlv_remove_srr(&msg->remove_srr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATE_SRR_TYPE:
+            if (!msg->create_srr.presence)
+                rv = pfcp_parse_tlv_create_srr(&msg->create_srr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_SRR_TYPE:
+            if (!msg->update_srr.presence)
+                rv = pfcp_parse_tlv_update_srr(&msg->update_srr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PROVIDE_ATSSS_CONTROL_INFORMATION_TYPE:
+            if (!msg->provide_atsss_control_information.presence)
+                rv = pfcp_parse_tlv_provide_atsss_control_information(&msg->provide_atsss_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ETHERNET_CONTEXT_INFORMATION_TYPE:
+            if (!msg->ethernet_context_information.presence)
+                rv = pfcp_parse_tlv_ethernet_context_information(&msg->ethernet_context_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ACCESS_AVAILABILITY_INFORMATION_TYPE:
+            if (!msg->access_availability_information.presence)
+                rv = ogs_tlv_parse_element(&msg->access_availability_information,
+                        &ogs_pfcp_tlv_desc_access_availability_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_QUERY_PACKET_RATE_STATUS_IE_WITHIN_PFCP_SESSION_MODIFICATION_REQUEST_TYPE:
+            if (!msg->query_packet_rate_status.presence)
+                rv = pfcp_parse_tlv_query_packet_rate_status_ie_within_pfcp_session_modification_request(&msg->query_packet_rate_status,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_S_NSSAI_TYPE:
+            if (!msg->s_nssai.presence)
+                rv = ogs_tlv_parse_element(&msg->s_nssai,
+                        &ogs_pfcp_tlv_desc_s_nssai, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_modification_response(
+        ogs_pfcp_session_modification_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATED_PDR_TYPE:
+            v = ogs_tlv_more_slot(msg->created_pdr,
+                    sizeof(msg->created_pdr[0]), OGS_ARRAY_SIZE(msg->created_pdr));
+            if (v)
+                rv = pfcp_parse_tlv_created_pdr(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->load_control_information.presence)
+                rv = pfcp_parse_tlv_load_control_information(&msg->load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->overload_control_information.presence)
+                rv = pfcp_parse_tlv_overload_control_information(&msg->overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_SESSION_MODIFICATION_RESPONSE_TYPE:
+            v = ogs_tlv_more_slot(msg->usage_report,
+                    sizeof(msg->usage_report[0]), OGS_ARRAY_SIZE(msg->usage_report));
+            if (v)
+                rv = pfcp_parse_tlv_usage_report_session_modification_response(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_FAILED_RULE_ID_TYPE:
+            if (!msg->failed_rule_id.presence)
+                rv = ogs_tlv_parse_element(&msg->failed_rule_id,
+                        &ogs_pfcp_tlv_desc_failed_rule_id, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ADDITIONAL_USAGE_REPORTS_INFORMATION_TYPE:
+            if (!msg->additional_usage_reports_information.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_usage_reports_information,
+                        &ogs_pfcp_tlv_desc_additional_usage_reports_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_CREATED_TRAFFIC_ENDPOINT_TYPE:
+            if (!msg->created_updated_traffic_endpoint.presence)
+                rv = pfcp_parse_tlv_created_traffic_endpoint(&msg->created_updated_traffic_endpoint,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TSC_MANAGEMENT_INFORMATION_IE_WITHIN_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE:
+            if (!msg->tsc_management_information.presence)
+                rv = pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_modification_response(&msg->tsc_management_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ATSSS_CONTROL_PARAMETERS_TYPE:
+            if (!msg->atsss_control_parameters.presence)
+                rv = pfcp_parse_tlv_atsss_control_parameters(&msg->atsss_control_parameters,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATED_PDR_TYPE:
+            if (!msg->updated_pdr.presence)
+                rv = pfcp_parse_tlv_updated_pdr(&msg->updated_pdr,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_REPORT_IE_WITHIN_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE:
+            if (!msg->packet_rate_status_report.presence)
+                rv = pfcp_parse_tlv_packet_rate_status_report_ie_within_pfcp_session_modification_response(&msg->packet_rate_status_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_deletion_request(
+        ogs_pfcp_session_deletion_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_deletion_response(
+        ogs_pfcp_session_deletion_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->load_control_information.presence)
+                rv = pfcp_parse_tlv_load_control_information(&msg->load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->overload_control_information.presence)
+                rv = pfcp_parse_tlv_overload_control_information(&msg->overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_SESSION_DELETION_RESPONSE_TYPE:
+            v = ogs_tlv_more_slot(msg->usage_report,
+                    sizeof(msg->usage_report[0]), OGS_ARRAY_SIZE(msg->usage_report));
+            if (v)
+                rv = pfcp_parse_tlv_usage_report_session_deletion_response(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_ADDITIONAL_USAGE_REPORTS_INFORMATION_TYPE:
+            if (!msg->additional_usage_reports_information.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_usage_reports_information,
+                        &ogs_pfcp_tlv_desc_additional_usage_reports_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_REPORT_TYPE:
+            if (!msg->packet_rate_status_report.presence)
+                rv = pfcp_parse_tlv_packet_rate_status_report(&msg->packet_rate_status_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SESSION_REPORT_TYPE:
+            if (!msg->session_report.presence)
+                rv = pfcp_parse_tlv_session_report(&msg->session_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_report_request(
+        ogs_pfcp_session_report_request_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    void *v = NULL;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_REPORT_TYPE_TYPE:
+            if (!msg->report_type.presence)
+                rv = ogs_tlv_parse_element(&msg->report_type,
+                        &ogs_pfcp_tlv_desc_report_type, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_DOWNLINK_DATA_REPORT_TYPE:
+            if (!msg->downlink_data_report.presence)
+                rv = pfcp_parse_tlv_downlink_data_report(&msg->downlink_data_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_USAGE_REPORT_SESSION_REPORT_REQUEST_TYPE:
+            v = ogs_tlv_more_slot(msg->usage_report,
+                    sizeof(msg->usage_report[0]), OGS_ARRAY_SIZE(msg->usage_report));
+            if (v)
+                rv = pfcp_parse_tlv_usage_report_session_report_request(v,
+                        e.value, e.length);
+            break;
+        case OGS_PFCP_ERROR_INDICATION_REPORT_TYPE:
+            if (!msg->error_indication_report.presence)
+                rv = pfcp_parse_tlv_error_indication_report(&msg->error_indication_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->load_control_information.presence)
+                rv = pfcp_parse_tlv_load_control_information(&msg->load_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+            if (!msg->overload_control_information.presence)
+                rv = pfcp_parse_tlv_overload_control_information(&msg->overload_control_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ADDITIONAL_USAGE_REPORTS_INFORMATION_TYPE:
+            if (!msg->additional_usage_reports_information.presence)
+                rv = ogs_tlv_parse_element(&msg->additional_usage_reports_information,
+                        &ogs_pfcp_tlv_desc_additional_usage_reports_information, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPSRREQ_FLAGS_TYPE:
+            if (!msg->pfcpsrreq_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpsrreq_flags,
+                        &ogs_pfcp_tlv_desc_pfcpsrreq_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_SEID_TYPE:
+            if (!msg->old_cp_f_seid.presence)
+                rv = ogs_tlv_parse_element(&msg->old_cp_f_seid,
+                        &ogs_pfcp_tlv_desc_f_seid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PACKET_RATE_STATUS_REPORT_TYPE:
+            if (!msg->packet_rate_status_report.presence)
+                rv = pfcp_parse_tlv_packet_rate_status_report(&msg->packet_rate_status_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_TSC_MANAGEMENT_INFORMATION_IE_WITHIN_PFCP_SESSION_REPORT_REQUEST_TYPE:
+            if (!msg->tsc_management_information.presence)
+                rv = pfcp_parse_tlv_tsc_management_information_ie_within_pfcp_session_report_request(&msg->tsc_management_information,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_SESSION_REPORT_TYPE:
+            if (!msg->session_report.presence)
+                rv = pfcp_parse_tlv_session_report(&msg->session_report,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
+static int pfcp_parse_msg_pfcp_session_report_response(
+        ogs_pfcp_session_report_response_t *msg, uint8_t *data, uint32_t length)
+{
+    ogs_tlv_cursor_t cursor;
+    ogs_tlv_element_t e;
+    int rv;
+
+    memset(msg, 0, sizeof(*msg));
+
+    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);
+    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {
+        switch (e.type) {
+        case OGS_PFCP_CAUSE_TYPE:
+            if (!msg->cause.presence)
+                rv = ogs_tlv_parse_element(&msg->cause,
+                        &ogs_pfcp_tlv_desc_cause, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_OFFENDING_IE_TYPE:
+            if (!msg->offending_ie.presence)
+                rv = ogs_tlv_parse_element(&msg->offending_ie,
+                        &ogs_pfcp_tlv_desc_offending_ie, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_UPDATE_BAR_PFCP_SESSION_REPORT_RESPONSE_TYPE:
+            if (!msg->update_bar.presence)
+                rv = pfcp_parse_tlv_update_bar_pfcp_session_report_response(&msg->update_bar,
+                        e.value, e.length);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_PFCPSRRSP_FLAGS_TYPE:
+            if (!msg->pfcpsrrsp_flags.presence)
+                rv = ogs_tlv_parse_element(&msg->pfcpsrrsp_flags,
+                        &ogs_pfcp_tlv_desc_pfcpsrrsp_flags, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_SEID_TYPE:
+            if (!msg->cp_f_seid.presence)
+                rv = ogs_tlv_parse_element(&msg->cp_f_seid,
+                        &ogs_pfcp_tlv_desc_f_seid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_F_TEID_TYPE:
+            if (!msg->n4_u_f_teid.presence)
+                rv = ogs_tlv_parse_element(&msg->n4_u_f_teid,
+                        &ogs_pfcp_tlv_desc_f_teid, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+            if (!msg->alternative_smf_ip_address.presence)
+                rv = ogs_tlv_parse_element(&msg->alternative_smf_ip_address,
+                        &ogs_pfcp_tlv_desc_alternative_smf_ip_address, &e);
+            else
+                ogs_warn("Duplicated TLV type [%d]", e.type);
+            break;
+        default:
+            ogs_warn("Unknown TLV type [%d]", e.type);
+            break;
+        }
+
+        if (rv != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    if (rv != OGS_DONE)
+        return OGS_ERROR;
+
+    return OGS_OK;
+}
+
 int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
 {
     int rv = OGS_ERROR;
@@ -3990,7 +11069,8 @@ int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
     h = (ogs_pfcp_header_t *)pkbuf->data;
     ogs_assert(h);
 
-    memset(pfcp_message, 0, sizeof(ogs_pfcp_message_t));
+    /* Only the header and the decoded message are cleared */
+    memset(&pfcp_message->h, 0, sizeof(pfcp_message->h));
 
     if (h->seid_presence)
         size = OGS_PFCP_HEADER_LEN;
@@ -4006,104 +11086,128 @@ int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
         pfcp_message->h.sqn = pfcp_message->h.sqn_only;
     }
 
-    if (pkbuf->len == 0)
-        return OGS_OK;
-
     switch(pfcp_message->h.type)
     {
         case OGS_PFCP_HEARTBEAT_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_heartbeat_request,
-                    &ogs_pfcp_msg_desc_pfcp_heartbeat_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_heartbeat_request(
+                    &pfcp_message->pfcp_heartbeat_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_HEARTBEAT_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_heartbeat_response,
-                    &ogs_pfcp_msg_desc_pfcp_heartbeat_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_heartbeat_response(
+                    &pfcp_message->pfcp_heartbeat_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_PFD_MANAGEMENT_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_pfd_management_request,
-                    &ogs_pfcp_msg_desc_pfcp_pfd_management_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_pfd_management_request(
+                    &pfcp_message->pfcp_pfd_management_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_PFD_MANAGEMENT_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_pfd_management_response,
-                    &ogs_pfcp_msg_desc_pfcp_pfd_management_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_pfd_management_response(
+                    &pfcp_message->pfcp_pfd_management_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_SETUP_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_setup_request,
-                    &ogs_pfcp_msg_desc_pfcp_association_setup_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_setup_request(
+                    &pfcp_message->pfcp_association_setup_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_SETUP_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_setup_response,
-                    &ogs_pfcp_msg_desc_pfcp_association_setup_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_setup_response(
+                    &pfcp_message->pfcp_association_setup_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_UPDATE_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_update_request,
-                    &ogs_pfcp_msg_desc_pfcp_association_update_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_update_request(
+                    &pfcp_message->pfcp_association_update_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_UPDATE_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_update_response,
-                    &ogs_pfcp_msg_desc_pfcp_association_update_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_update_response(
+                    &pfcp_message->pfcp_association_update_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_RELEASE_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_release_request,
-                    &ogs_pfcp_msg_desc_pfcp_association_release_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_release_request(
+                    &pfcp_message->pfcp_association_release_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_ASSOCIATION_RELEASE_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_association_release_response,
-                    &ogs_pfcp_msg_desc_pfcp_association_release_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_association_release_response(
+                    &pfcp_message->pfcp_association_release_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_VERSION_NOT_SUPPORTED_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_version_not_supported_response,
-                    &ogs_pfcp_msg_desc_pfcp_version_not_supported_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_version_not_supported_response(
+                    &pfcp_message->pfcp_version_not_supported_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_NODE_REPORT_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_node_report_request,
-                    &ogs_pfcp_msg_desc_pfcp_node_report_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_node_report_request(
+                    &pfcp_message->pfcp_node_report_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_NODE_REPORT_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_node_report_response,
-                    &ogs_pfcp_msg_desc_pfcp_node_report_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_node_report_response(
+                    &pfcp_message->pfcp_node_report_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_SET_DELETION_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_set_deletion_request,
-                    &ogs_pfcp_msg_desc_pfcp_session_set_deletion_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_set_deletion_request(
+                    &pfcp_message->pfcp_session_set_deletion_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_SET_DELETION_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_set_deletion_response,
-                    &ogs_pfcp_msg_desc_pfcp_session_set_deletion_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_set_deletion_response(
+                    &pfcp_message->pfcp_session_set_deletion_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_establishment_request,
-                    &ogs_pfcp_msg_desc_pfcp_session_establishment_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_establishment_request(
+                    &pfcp_message->pfcp_session_establishment_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_establishment_response,
-                    &ogs_pfcp_msg_desc_pfcp_session_establishment_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_establishment_response(
+                    &pfcp_message->pfcp_session_establishment_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_MODIFICATION_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_modification_request,
-                    &ogs_pfcp_msg_desc_pfcp_session_modification_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_modification_request(
+                    &pfcp_message->pfcp_session_modification_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_modification_response,
-                    &ogs_pfcp_msg_desc_pfcp_session_modification_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_modification_response(
+                    &pfcp_message->pfcp_session_modification_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_DELETION_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_deletion_request,
-                    &ogs_pfcp_msg_desc_pfcp_session_deletion_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_deletion_request(
+                    &pfcp_message->pfcp_session_deletion_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_DELETION_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_deletion_response,
-                    &ogs_pfcp_msg_desc_pfcp_session_deletion_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_deletion_response(
+                    &pfcp_message->pfcp_session_deletion_response,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_REPORT_REQUEST_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_report_request,
-                    &ogs_pfcp_msg_desc_pfcp_session_report_request, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_report_request(
+                    &pfcp_message->pfcp_session_report_request,
+                    pkbuf->data, pkbuf->len);
             break;
         case OGS_PFCP_SESSION_REPORT_RESPONSE_TYPE:
-            rv = ogs_tlv_parse_msg(&pfcp_message->pfcp_session_report_response,
-                    &ogs_pfcp_msg_desc_pfcp_session_report_response, pkbuf, OGS_TLV_MODE_T2_L2);
+            rv = pfcp_parse_msg_pfcp_session_report_response(
+                    &pfcp_message->pfcp_session_report_response,
+                    pkbuf->data, pkbuf->len);
             break;
         default:
+            if (pkbuf->len == 0) {
+                rv = OGS_OK;
+                break;
+            }
             ogs_warn("Not implmeneted(type:%d)", pfcp_message->h.type);
             break;
     }
@@ -289,14 +289,21 @@ int ogs_pfcp_up_send_association_setup_response(ogs_pfcp_xact_t *xact,
     return rv;
 }
 
+static void count_tx(ogs_metrics_inst_t *packets,
+        ogs_metrics_inst_t *bytes, ogs_pkbuf_t *sendbuf)
+{
+    if (packets)
+        ogs_metrics_inst_inc(packets);
+    if (bytes)
+        ogs_metrics_inst_add(bytes, sendbuf->len);
+}
+
 void ogs_pfcp_send_g_pdu(
         ogs_pfcp_pdr_t *pdr, uint8_t type, ogs_pkbuf_t *sendbuf)
 {
     ogs_gtp_node_t *gnode = NULL;
     ogs_pfcp_far_t *far = NULL;
-
-    ogs_gtp2_header_t gtp_hdesc;
-    ogs_gtp2_extension_header_t ext_hdesc;
+    uint8_t qfi = 0;
 
     ogs_assert(pdr);
     ogs_assert(type);
@@ -319,15 +326,39 @@ void ogs_pfcp_send_g_pdu(
     ogs_assert(gnode);
     ogs_assert(gnode->sock);
 
-    memset(&gtp_hdesc, 0, sizeof(gtp_hdesc));
-    memset(&ext_hdesc, 0, sizeof(ext_hdesc));
+    if (pdr->qer)
+        qfi = pdr->qer->qfi;
 
-    gtp_hdesc.type = type;
-    gtp_hdesc.teid = far->outer_header_creation.teid;
-    if (pdr->qer && pdr->qer->qfi)
-        ext_hdesc.qos_flow_identifier = pdr->qer->qfi;
+    if (!far->gtpu_header.len ||
+        far->gtpu_header.type != type ||
+        far->gtpu_header.teid != far->outer_header_creation.teid ||
+        far->gtpu_header.qfi != qfi) {
+        ogs_gtp2_header_t gtp_hdesc;
+        ogs_gtp2_extension_header_t ext_hdesc;
 
-    ogs_gtp2_send_user_plane(gnode, &gtp_hdesc, &ext_hdesc, sendbuf);
+        memset(&gtp_hdesc, 0, sizeof(gtp_hdesc));
+        memset(&ext_hdesc, 0, sizeof(ext_hdesc));
+
+        gtp_hdesc.type = type;
+        gtp_hdesc.teid = far->outer_header_creation.teid;
+        ext_hdesc.qos_flow_identifier = qfi;
+
+        far->gtpu_header.len = ogs_gtp2_build_user_plane_header(
+                far->gtpu_header.buf, &gtp_hdesc, &ext_hdesc);
+        far->gtpu_header.type = type;
+        far->gtpu_header.teid = far->outer_header_creation.teid;
+        far->gtpu_header.qfi = qfi;
+    }
+
+    if (far->dst_if == OGS_PFCP_INTERFACE_ACCESS)
+        count_tx(ogs_pfcp_self()->metrics.access_tx_packets,
+                ogs_pfcp_self()->metrics.access_tx_bytes, sendbuf);
+    else if (far->dst_if == OGS_PFCP_INTERFACE_CORE)
+        count_tx(ogs_pfcp_self()->metrics.core_tx_packets,
+                ogs_pfcp_self()->metrics.core_tx_bytes, sendbuf);
+
+    ogs_gtp2_send_user_plane_header(gnode,
+            far->gtpu_header.buf, far->gtpu_header.len, sendbuf);
 }
 
 int ogs_pfcp_send_end_marker(ogs_pfcp_pdr_t *pdr)
@@ -374,18 +405,15 @@ int ogs_pfcp_send_end_marker(ogs_pfcp_pdr_t *pdr)
 void ogs_pfcp_send_buffered_packet(ogs_pfcp_pdr_t *pdr)
 {
     ogs_pfcp_far_t *far = NULL;
-    int i;
+    ogs_pkbuf_t *pkbuf = NULL;
 
     ogs_assert(pdr);
     far = pdr->far;
 
     if (far && far->gnode) {
         if (far->apply_action & OGS_PFCP_APPLY_ACTION_FORW) {
-            for (i = 0; i < far->num_of_buffered_packet; i++) {
-                ogs_pfcp_send_g_pdu(
-                        pdr, OGS_GTPU_MSGTYPE_GPDU, far->buffered_packet[i]);
-            }
-            far->num_of_buffered_packet = 0;
+            while ((pkbuf = ogs_pfcp_far_dequeue_buffered_packet(far)))
+                ogs_pfcp_send_g_pdu(pdr, OGS_GTPU_MSGTYPE_GPDU, pkbuf);
         }
     }
 }
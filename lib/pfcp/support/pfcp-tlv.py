@@ -761,6 +761,89 @@ for (k, v) in sorted_msg_list:
         f.write("}};\n\n")
 f.write("\n")
 
+def write_parse_ie(f, indent, field, ies, e):
+    if ies["ie_type"] in group_list.keys():
+        f.write(indent + "rv = pfcp_parse_tlv_%s(%s,\n" % (v_lower(ies["ie_type"]), field))
+        f.write(indent + "        %s.value, %s.length);\n" % (e, e))
+    else:
+        f.write(indent + "rv = ogs_tlv_parse_element(%s,\n" % field)
+        f.write(indent + "        &ogs_pfcp_tlv_desc_%s, &%s);\n" % (v_lower(ies["ie_type"]), e))
+
+def write_parse_function(f, name, struct, ies_list, is_group):
+    keys = []
+    fields = {}
+    need_slot = False
+    for ies in ies_list:
+        key = ies["ie_type"]
+        if key not in fields:
+            keys.append(key)
+            fields[key] = []
+        more = type_list[ies["ie_type"]]["max_tlv_more"] != "0" and ies["tlv_more"] != "0"
+        fields[key].append((ies, more))
+        if more:
+            need_slot = True
+
+    f.write("static int %s(\n" % name)
+    f.write("        %s *msg, uint8_t *data, uint32_t length)\n" % struct)
+    f.write("{\n")
+    f.write("    ogs_tlv_cursor_t cursor;\n")
+    f.write("    ogs_tlv_element_t e;\n")
+    if need_slot:
+        f.write("    void *v = NULL;\n")
+    f.write("    int rv;\n\n")
+    if not is_group:
+        f.write("    memset(msg, 0, sizeof(*msg));\n\n")
+    f.write("    ogs_tlv_cursor_init(&cursor, data, length, OGS_TLV_MODE_T2_L2);\n")
+    f.write("    while ((rv = ogs_tlv_cursor_next(&cursor, &e)) == OGS_OK) {\n")
+    f.write("        switch (e.type) {\n")
+    for key in keys:
+        f.write("        case OGS_PFCP_%s_TYPE:\n" % v_upper(key))
+        if len(fields[key]) == 1 and fields[key][0][1]:
+            (ies, more) = fields[key][0]
+            field = "msg->" + v_lower(ies["ie_value"])
+            f.write("            v = ogs_tlv_more_slot(%s,\n" % field)
+            f.write("                    sizeof(%s[0]), OGS_ARRAY_SIZE(%s));\n" % (field, field))
+            f.write("            if (v)\n")
+            write_parse_ie(f, "                ", "v", ies, "e")
+        else:
+            cond = "if"
+            for (ies, more) in fields[key]:
+                assert more == False, "Mixed IE array for key = %s" % key
+                field = "msg->" + v_lower(ies["ie_value"])
+                f.write("            %s (!%s.presence)\n" % (cond, field))
+                write_parse_ie(f, "                ", "&" + field, ies, "e")
+                cond = "else if"
+            f.write("            else\n")
+            f.write("                ogs_warn(\"Duplicated TLV type [%d]\", e.type);\n")
+        f.write("            break;\n")
+    f.write("        default:\n")
+    f.write("            ogs_warn(\"Unknown TLV type [%d]\", e.type);\n")
+    f.write("            break;\n")
+    f.write("        }\n\n")
+    f.write("        if (rv != OGS_OK)\n")
+    f.write("            return OGS_ERROR;\n")
+    f.write("    }\n\n")
+    f.write("    if (rv != OGS_DONE)\n")
+    f.write("        return OGS_ERROR;\n\n")
+    if is_group:
+        f.write("    msg->presence = 1;\n\n")
+    f.write("    return OGS_OK;\n")
+    f.write("}\n\n")
+
+for (k, v) in sorted_group_list:
+    f.write("static int pfcp_parse_tlv_%s(\n" % v_lower(k))
+    f.write("        ogs_pfcp_tlv_%s_t *msg, uint8_t *data, uint32_t length);\n" % v_lower(k))
+f.write("\n")
+
+for (k, v) in sorted_group_list:
+    write_parse_function(f, "pfcp_parse_tlv_%s" % v_lower(k),
+            "ogs_pfcp_tlv_%s_t" % v_lower(k), group_list[k]["ies"], True)
+
+for (k, v) in sorted_msg_list:
+    if "ies" in msg_list[k]:
+        write_parse_function(f, "pfcp_parse_msg_%s" % v_lower(k),
+                "ogs_%s_t" % v_lower(k), msg_list[k]["ies"], False)
+
 f.write("""int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
 {
     int rv = OGS_ERROR;
@@ -774,7 +857,8 @@ f.write("""int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t
     h = (ogs_pfcp_header_t *)pkbuf->data;
     ogs_assert(h);
 
-    memset(pfcp_message, 0, sizeof(ogs_pfcp_message_t));
+    /* Only the header and the decoded message are cleared */
+    memset(&pfcp_message->h, 0, sizeof(pfcp_message->h));
 
     if (h->seid_presence)
         size = OGS_PFCP_HEADER_LEN;
@@ -790,19 +874,21 @@ f.write("""int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t
         pfcp_message->h.sqn = pfcp_message->h.sqn_only;
     }
 
-    if (pkbuf->len == 0)
-        return OGS_OK;
-
     switch(pfcp_message->h.type)
     {
 """)
 for (k, v) in sorted_msg_list:
     if "ies" in msg_list[k]:
         f.write("        case OGS_%s_TYPE:\n" % v_upper(k))
-        f.write("            rv = ogs_tlv_parse_msg(&pfcp_message->%s,\n" % v_lower(k))
-        f.write("                    &ogs_pfcp_msg_desc_%s, pkbuf, OGS_TLV_MODE_T2_L2);\n" % v_lower(k))
+        f.write("            rv = pfcp_parse_msg_%s(\n" % v_lower(k))
+        f.write("                    &pfcp_message->%s,\n" % v_lower(k))
+        f.write("                    pkbuf->data, pkbuf->len);\n")
         f.write("            break;\n")
 f.write("""        default:
+            if (pkbuf->len == 0) {
+                rv = OGS_OK;
+                break;
+            }
             ogs_warn("Not implmeneted(type:%d)", pfcp_message->h.type);
             break;
     }
@@ -35,6 +35,8 @@ static uint32_t g_xact_id = 0;
 
 static OGS_POOL(pool, ogs_pfcp_xact_t);
 
+static ogs_metrics_spec_t *rtt_spec = NULL;
+
 static ogs_pfcp_xact_t *ogs_pfcp_xact_remote_create(
         ogs_pfcp_node_t *node, uint32_t sqn);
 static ogs_pfcp_xact_stage_t ogs_pfcp_xact_get_stage(
@@ -47,6 +49,7 @@ static ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
 
 static void response_timeout(void *data);
 static void holding_timeout(void *data);
+static void observe_rtt(ogs_pfcp_xact_t *xact);
 static void delayed_commit_timeout(void *data);
 
 int ogs_pfcp_xact_init(void)
@@ -71,6 +74,16 @@ void ogs_pfcp_xact_final(void)
     ogs_pfcp_xact_initialized = 0;
 }
 
+void ogs_pfcp_xact_metrics_open(void)
+{
+    const char *labels[] = { "peer" };
+
+    rtt_spec = ogs_metrics_spec_new(ogs_metrics_self(),
+            OGS_METRICS_METRIC_TYPE_HISTOGRAM, "pfcp_peer_rtt_microseconds",
+            "PFCP request round-trip time per peer", 0, 1, labels);
+    ogs_assert(rtt_spec);
+}
+
 ogs_pfcp_xact_t *ogs_pfcp_xact_local_create(ogs_pfcp_node_t *node,
         void (*cb)(ogs_pfcp_xact_t *xact, void *data), void *data)
 {
@@ -352,6 +365,8 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
                 return OGS_ERROR;
             }
 
+            observe_rtt(xact);
+
             if (xact->tm_holding)
                 ogs_timer_start(xact->tm_holding,
                         ogs_app()->time.message.pfcp.t1_holding_duration);
@@ -363,6 +378,7 @@ static int ogs_pfcp_xact_update_rx(ogs_pfcp_xact_t *xact, uint8_t type)
                 ogs_error("invalid step[%d] type[%d]", xact->step, type);
                 return OGS_ERROR;
             }
+            observe_rtt(xact);
             break;
 
         default:
@@ -489,6 +505,7 @@ int ogs_pfcp_xact_commit(ogs_pfcp_xact_t *xact)
             if (xact->tm_response)
                 ogs_timer_start(xact->tm_response,
                         ogs_app()->time.message.pfcp.t1_response_duration);
+            xact->rtt_start = ogs_loop_monotonic_time();
 
             break;
 
@@ -579,6 +596,30 @@ void ogs_pfcp_xact_delayed_commit(ogs_pfcp_xact_t *xact, ogs_time_t duration)
     ogs_timer_start(xact->tm_delayed_commit, duration);
 }
 
+static void observe_rtt(ogs_pfcp_xact_t *xact)
+{
+    char buf[OGS_ADDRSTRLEN];
+    const char *peer = NULL;
+    ogs_pfcp_node_t *node = NULL;
+
+    ogs_assert(xact);
+    node = xact->node;
+    ogs_assert(node);
+
+    if (!rtt_spec || !xact->rtt_start)
+        return;
+
+    if (!node->metrics_rtt) {
+        peer = OGS_ADDR(&node->addr, buf);
+        node->metrics_rtt = ogs_metrics_inst_new(rtt_spec, 1, &peer);
+        ogs_assert(node->metrics_rtt);
+    }
+
+    ogs_metrics_inst_observe(node->metrics_rtt,
+            ogs_loop_monotonic_time() - xact->rtt_start);
+    xact->rtt_start = 0;
+}
+
 static void response_timeout(void *data)
 {
     char buf[OGS_ADDRSTRLEN];
@@ -605,6 +646,9 @@ static void response_timeout(void *data)
         pkbuf = xact->seq[xact->step-1].pkbuf;
         ogs_assert(pkbuf);
 
+        /* A response to a retransmission is ambiguous, so skip it */
+        xact->rtt_start = 0;
+
         if (ogs_pfcp_sendto(xact->node, pkbuf) != OGS_OK) {
             ogs_error("ogs_pfcp_sendto() failed");
             goto out;
@@ -60,6 +60,7 @@ typedef struct ogs_pfcp_xact_s {
 
     ogs_timer_t     *tm_response;   /**< Timer waiting for next message */
     uint8_t         response_rcount;
+    ogs_time_t      rtt_start;      /**< Request sent, 0 once retransmitted */
     ogs_timer_t     *tm_holding;    /**< Timer waiting for holding message */
     uint8_t         holding_rcount;
 
@@ -128,6 +129,7 @@ typedef struct ogs_pfcp_xact_s {
 
 int ogs_pfcp_xact_init(void);
 void ogs_pfcp_xact_final(void);
+void ogs_pfcp_xact_metrics_open(void);
 
 ogs_pfcp_xact_t *ogs_pfcp_xact_local_create(ogs_pfcp_node_t *node,
         void (*cb)(ogs_pfcp_xact_t *xact, void *data), void *data);
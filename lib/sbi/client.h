@@ -67,16 +67,46 @@ typedef struct ogs_sbi_client_s {
     ogs_timer_t     *t_curl;            /* timer for CURL */
     ogs_list_t      connection_list;    /* CURL connection list */
 
+    ogs_list_t      session_list;       /* nghttp2 session list */
+
     void            *multi;             /* CURL multi handle */
     int             still_running;      /* number of running CURL handle */
 
+#define OGS_SBI_MAX_NUM_OF_IDLE_HANDLE 64
+    struct {
+        void        **idle;             /* Reset CURL easy handles */
+        int         num_of_idle;
+
+        uint64_t    created;
+        uint64_t    reused;
+    } handle;
+
+    ogs_metrics_inst_t *metrics_rtt;    /* Created on the first response */
+
     unsigned int    reference_count;    /* reference count for memory free */
 } ogs_sbi_client_t;
 
 typedef struct ogs_sbi_nf_instance_s ogs_sbi_nf_instance_t;
 
+typedef struct ogs_sbi_client_actions_s {
+    void (*init)(int num_of_sockinfo_pool, int num_of_connection_pool);
+    void (*cleanup)(void);
+
+    void (*add)(ogs_sbi_client_t *client);
+    void (*remove)(ogs_sbi_client_t *client);
+    void (*stop)(ogs_sbi_client_t *client);
+
+    bool (*send_request)(
+            ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
+            ogs_sbi_request_t *request, void *data);
+} ogs_sbi_client_actions_t;
+
+extern ogs_sbi_client_actions_t ogs_sbi_client_actions;
+extern bool ogs_sbi_client_actions_initialized;
+
 void ogs_sbi_client_init(int num_of_sockinfo_pool, int num_of_connection_pool);
 void ogs_sbi_client_final(void);
+void ogs_sbi_client_metrics_open(void);
 
 ogs_sbi_client_t *ogs_sbi_client_add(ogs_sockaddr_t *addr);
 void ogs_sbi_client_remove(ogs_sbi_client_t *client);
@@ -86,6 +116,8 @@ ogs_sbi_client_t *ogs_sbi_client_find(ogs_sockaddr_t *addr);
 void ogs_sbi_client_stop(ogs_sbi_client_t *client);
 void ogs_sbi_client_stop_all(void);
 
+void ogs_sbi_client_observe_rtt(ogs_sbi_client_t *client, ogs_time_t sent);
+
 bool ogs_sbi_client_send_reqmem_persistent(
         ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
         ogs_sbi_request_t *request, void *data);
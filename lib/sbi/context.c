@@ -204,6 +204,8 @@ int ogs_sbi_context_parse_config(
                         ogs_sockopt_t option;
                         bool is_option = false;
 
+                        int num_of_io_thread = 0;
+
                         if (ogs_yaml_iter_type(&sbi_array) ==
                                 YAML_MAPPING_NODE) {
                             memcpy(&sbi_iter, &sbi_array,
@@ -289,6 +291,14 @@ int ogs_sbi_context_parse_config(
                                         &sbi_iter, &option);
                                 if (rv != OGS_OK) return rv;
                                 is_option = true;
+                            } else if (!strcmp(sbi_key, "io_threads")) {
+                                const char *v = ogs_yaml_iter_value(&sbi_iter);
+                                if (v) num_of_io_thread = atoi(v);
+                                if (num_of_io_thread < 0) {
+                                    ogs_warn("Ignore io_threads(%d)",
+                                            num_of_io_thread);
+                                    num_of_io_thread = 0;
+                                }
                             } else if (!strcmp(sbi_key, "tls")) {
                                 ogs_yaml_iter_t tls_iter;
                                 ogs_yaml_iter_recurse(&sbi_iter, &tls_iter);
@@ -356,6 +366,8 @@ int ogs_sbi_context_parse_config(
 
                             if (key) server->tls.key = key;
                             if (pem) server->tls.pem = pem;
+
+                            server->num_of_io_thread = num_of_io_thread;
                         }
                         node6 = ogs_list_first(&list6);
                         if (node6) {
@@ -369,6 +381,8 @@ int ogs_sbi_context_parse_config(
 
                             if (key) server->tls.key = key;
                             if (pem) server->tls.pem = pem;
+
+                            server->num_of_io_thread = num_of_io_thread;
                         }
 
                         if (addr)
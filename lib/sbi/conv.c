@@ -467,7 +467,7 @@ char *ogs_sbi_s_nssai_to_string(ogs_s_nssai_t *s_nssai)
     ogs_expect_or_return_val(item, NULL);
     if (sNSSAI.sd) ogs_free(sNSSAI.sd);
 
-    v = cJSON_Print(item);
+    v = cJSON_PrintUnformatted(item);
     ogs_expect(v);
     cJSON_Delete(item);
 
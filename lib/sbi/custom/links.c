@@ -56,3 +56,41 @@ cJSON *ogs_sbi_links_convertToJSON(ogs_sbi_links_t *links)
 
     return root;
 }
+
+bool ogs_sbi_links_writeJSON(
+        OpenAPI_json_writer_t *writer, ogs_sbi_links_t *links)
+{
+    OpenAPI_lnode_t *node;
+
+    ogs_assert(links);
+    ogs_assert(links->self);
+
+    if (OpenAPI_json_write_object_start(writer, NULL) == false ||
+        OpenAPI_json_write_object_start(writer, "_links") == false)
+        return false;
+
+    /* _links.items */
+    if (OpenAPI_json_write_array_start(writer, "items") == false)
+        return false;
+
+    OpenAPI_list_for_each(links->items, node) {
+        if (!node->data) continue;
+
+        if (OpenAPI_json_write_object_start(writer, NULL) == false ||
+            OpenAPI_json_write_string(writer, "href", node->data) == false ||
+            OpenAPI_json_write_object_end(writer) == false)
+            return false;
+    }
+
+    if (OpenAPI_json_write_array_end(writer) == false)
+        return false;
+
+    /* _links.self */
+    if (OpenAPI_json_write_object_start(writer, "self") == false ||
+        OpenAPI_json_write_string(writer, "href", links->self) == false ||
+        OpenAPI_json_write_object_end(writer) == false)
+        return false;
+
+    return OpenAPI_json_write_object_end(writer) &&
+        OpenAPI_json_write_object_end(writer);
+}
@@ -11,6 +11,7 @@
 #include "../openapi/external/cJSON.h"
 #include "../openapi/include/list.h"
 #include "../openapi/include/keyValuePair.h"
+#include "../openapi/include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,6 +24,8 @@ typedef struct ogs_sbi_links_s {
 } ogs_sbi_links_t;
 
 cJSON *ogs_sbi_links_convertToJSON(ogs_sbi_links_t *links);
+bool ogs_sbi_links_writeJSON(
+        OpenAPI_json_writer_t *writer, ogs_sbi_links_t *links);
 
 #ifdef __cplusplus
 }
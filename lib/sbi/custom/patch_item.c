@@ -87,6 +87,68 @@ end:
     return item;
 }
 
+bool OpenAPI_patch_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_patch_item_t *patch_item)
+{
+    if (patch_item == NULL) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [PatchItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [PatchItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "op", OpenAPI_patch_operation_ToString(patch_item->op)) == false) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [op]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "path", patch_item->path) == false) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [path]");
+        goto end;
+    }
+
+    if (patch_item->from) {
+    if (OpenAPI_json_write_string(writer, "from", patch_item->from) == false) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [from]");
+        goto end;
+    }
+    }
+
+    if (patch_item->value) {
+        if (OpenAPI_IsString(patch_item->value)) {
+            ogs_assert(patch_item->value->valuestring);
+            if (OpenAPI_json_write_string(
+                    writer, "value", patch_item->value->valuestring) == false) {
+                ogs_error("OpenAPI_patch_item_writeJSON() failed [value]");
+                goto end;
+            }
+        } else if (OpenAPI_IsNumber(patch_item->value)) {
+            if (OpenAPI_json_write_number(
+                    writer, "value", patch_item->value->valuedouble) == false) {
+                ogs_error("OpenAPI_patch_item_writeJSON() failed [value]");
+                goto end;
+            }
+        } else if (OpenAPI_IsBool(patch_item->value)) {
+            if (OpenAPI_json_write_bool(
+                    writer, "value", OpenAPI_IsTrue(patch_item->value)) == false) {
+                ogs_error("OpenAPI_patch_item_writeJSON() failed [value]");
+                goto end;
+            }
+        }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_patch_item_writeJSON() failed [PatchItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_patch_item_t *OpenAPI_patch_item_parseFromJSON(cJSON *patch_itemJSON)
 {
     OpenAPI_patch_item_t *patch_item_local_var = NULL;
@@ -154,7 +216,6 @@ end:
 OpenAPI_patch_item_t *OpenAPI_patch_item_copy(OpenAPI_patch_item_t *dst, OpenAPI_patch_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_patch_item_convertToJSON(src);
@@ -163,21 +224,6 @@ OpenAPI_patch_item_t *OpenAPI_patch_item_copy(OpenAPI_patch_item_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_patch_item_free(dst);
     dst = OpenAPI_patch_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -10,6 +10,7 @@
 #include <string.h>
 #include "../openapi/external/cJSON.h"
 #include "../openapi/include/list.h"
+#include "../openapi/include/json_writer.h"
 #include "../openapi/model/patch_operation.h"
 
 #include "../custom/any_type.h"
@@ -35,6 +36,7 @@ OpenAPI_patch_item_t *OpenAPI_patch_item_create(
 void OpenAPI_patch_item_free(OpenAPI_patch_item_t *patch_item);
 OpenAPI_patch_item_t *OpenAPI_patch_item_parseFromJSON(cJSON *patch_itemJSON);
 cJSON *OpenAPI_patch_item_convertToJSON(OpenAPI_patch_item_t *patch_item);
+bool OpenAPI_patch_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_patch_item_t *patch_item);
 OpenAPI_patch_item_t *OpenAPI_patch_item_copy(OpenAPI_patch_item_t *dst, OpenAPI_patch_item_t *src);
 
 #ifdef __cplusplus
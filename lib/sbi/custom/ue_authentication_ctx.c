@@ -119,6 +119,73 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_authentication_ctx_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_authentication_ctx_t *ue_authentication_ctx)
+{
+    if (ue_authentication_ctx == NULL) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [UEAuthenticationCtx]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [UEAuthenticationCtx]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "authType", OpenAPI_auth_type_ToString(ue_authentication_ctx->auth_type)) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [auth_type]");
+        goto end;
+    }
+
+    if (ue_authentication_ctx->_5g_auth_data) {
+    if (OpenAPI_av5g_aka_writeJSON(writer, "5gAuthData", ue_authentication_ctx->_5g_auth_data) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [_5g_auth_data]");
+        goto end;
+    }
+    }
+
+    if (ue_authentication_ctx->eap_payload) {
+    if (OpenAPI_json_write_string(writer, "EapPayload", ue_authentication_ctx->eap_payload) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [eap_payload]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_start(writer, "_links") == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [_links]");
+        goto end;
+    }
+    OpenAPI_lnode_t *_links_node;
+    if (ue_authentication_ctx->_links) {
+        OpenAPI_list_for_each(ue_authentication_ctx->_links, _links_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)_links_node->data;
+        if (OpenAPI_links_value_schema_writeJSON(writer, localKeyValue->key, localKeyValue->value) == false) {
+            ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [_links]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [_links]");
+        goto end;
+    }
+
+    if (ue_authentication_ctx->serving_network_name) {
+    if (OpenAPI_json_write_string(writer, "servingNetworkName", ue_authentication_ctx->serving_network_name) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [serving_network_name]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_authentication_ctx_writeJSON() failed [UEAuthenticationCtx]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_parseFromJSON(cJSON *ue_authentication_ctxJSON)
 {
     OpenAPI_ue_authentication_ctx_t *ue_authentication_ctx_local_var = NULL;
@@ -203,7 +270,6 @@ end:
 OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_copy(OpenAPI_ue_authentication_ctx_t *dst, OpenAPI_ue_authentication_ctx_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_authentication_ctx_convertToJSON(src);
@@ -212,21 +278,6 @@ OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_copy(OpenAPI_ue_a
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_authentication_ctx_free(dst);
     dst = OpenAPI_ue_authentication_ctx_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../openapi/include/list.h"
 #include "../openapi/include/keyValuePair.h"
 #include "../openapi/include/binary.h"
+#include "../openapi/include/json_writer.h"
 #include "../openapi/model/auth_type.h"
 #include "../openapi/model/av5g_aka.h"
 #include "../openapi/model/links_value_schema.h"
@@ -39,6 +40,7 @@ OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_create(
 void OpenAPI_ue_authentication_ctx_free(OpenAPI_ue_authentication_ctx_t *ue_authentication_ctx);
 OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_parseFromJSON(cJSON *ue_authentication_ctxJSON);
 cJSON *OpenAPI_ue_authentication_ctx_convertToJSON(OpenAPI_ue_authentication_ctx_t *ue_authentication_ctx);
+bool OpenAPI_ue_authentication_ctx_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_authentication_ctx_t *ue_authentication_ctx);
 OpenAPI_ue_authentication_ctx_t *OpenAPI_ue_authentication_ctx_copy(OpenAPI_ue_authentication_ctx_t *dst, OpenAPI_ue_authentication_ctx_t *src);
 
 #ifdef __cplusplus
@@ -22,10 +22,14 @@
 
 #include "contrib/multipart_parser.h"
 
+/*
+ * Requests and responses also cross the SBI server I/O threads.
+ */
 static OGS_POOL(request_pool, ogs_sbi_request_t);
 static OGS_POOL(response_pool, ogs_sbi_response_t);
+static ogs_thread_mutex_t pool_mutex;
 
-static char *build_json(ogs_sbi_message_t *message);
+static bool build_json(ogs_sbi_message_t *message, char **json);
 static int parse_json(ogs_sbi_message_t *message,
         char *content_type, char *json);
 
@@ -45,10 +49,12 @@ void ogs_sbi_message_init(int num_of_request_pool, int num_of_response_pool)
 {
     ogs_pool_init(&request_pool, num_of_request_pool);
     ogs_pool_init(&response_pool, num_of_response_pool);
+    ogs_thread_mutex_init(&pool_mutex);
 }
 
 void ogs_sbi_message_final(void)
 {
+    ogs_thread_mutex_destroy(&pool_mutex);
     ogs_pool_final(&request_pool);
     ogs_pool_final(&response_pool);
 }
@@ -191,7 +197,9 @@ ogs_sbi_request_t *ogs_sbi_request_new(void)
 {
     ogs_sbi_request_t *request = NULL;
 
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_alloc(&request_pool, &request);
+    ogs_thread_mutex_unlock(&pool_mutex);
     ogs_expect_or_return_val(request, NULL);
     memset(request, 0, sizeof(ogs_sbi_request_t));
 
@@ -207,7 +215,9 @@ ogs_sbi_response_t *ogs_sbi_response_new(void)
 {
     ogs_sbi_response_t *response = NULL;
 
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_alloc(&response_pool, &response);
+    ogs_thread_mutex_unlock(&pool_mutex);
     ogs_expect_or_return_val(response, NULL);
     memset(response, 0, sizeof(ogs_sbi_response_t));
 
@@ -229,7 +239,9 @@ void ogs_sbi_request_free(ogs_sbi_request_t *request)
     ogs_sbi_header_free(&request->h);
     http_message_free(&request->http);
 
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_free(&request_pool, request);
+    ogs_thread_mutex_unlock(&pool_mutex);
 }
 
 void ogs_sbi_response_free(ogs_sbi_response_t *response)
@@ -242,7 +254,9 @@ void ogs_sbi_response_free(ogs_sbi_response_t *response)
     ogs_sbi_header_free(&response->h);
     http_message_free(&response->http);
 
+    ogs_thread_mutex_lock(&pool_mutex);
     ogs_pool_free(&response_pool, response);
+    ogs_thread_mutex_unlock(&pool_mutex);
 }
 
 ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
@@ -313,7 +327,7 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
                 discovery_option->num_of_service_names);
             ogs_expect_or_return_val(item, NULL);
 
-            v = cJSON_Print(item);
+            v = cJSON_PrintUnformatted(item);
             ogs_expect_or_return_val(v, NULL);
             cJSON_Delete(item);
 
@@ -358,7 +372,7 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
             if (plmn_id.mnc) ogs_free(plmn_id.mnc);
             if (plmn_id.mcc) ogs_free(plmn_id.mcc);
 
-            v = cJSON_Print(item);
+            v = cJSON_PrintUnformatted(item);
             ogs_expect_or_return_val(v, NULL);
             cJSON_Delete(item);
 
@@ -402,7 +416,7 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
                 &SliceInfoForPDUSession);
         ogs_expect_or_return_val(item, NULL);
 
-        v = cJSON_Print(item);
+        v = cJSON_PrintUnformatted(item);
         ogs_expect_or_return_val(v, NULL);
         cJSON_Delete(item);
 
@@ -422,8 +436,11 @@ ogs_sbi_request_t *ogs_sbi_build_request(ogs_sbi_message_t *message)
                 OGS_SBI_PARAM_IPV6PREFIX, message->param.ipv6prefix);
     }
 
-    ogs_expect_or_return_val(true ==
-            build_content(&request->http, message), NULL);
+    if (build_content(&request->http, message) == false) {
+        ogs_error("build_content() failed");
+        ogs_sbi_request_free(request);
+        return NULL;
+    }
 
     if (message->http.accept) {
         ogs_sbi_header_set(request->http.headers, OGS_SBI_ACCEPT,
@@ -461,8 +478,11 @@ ogs_sbi_response_t *ogs_sbi_build_response(
     response->status = status;
 
     if (response->status != OGS_SBI_HTTP_STATUS_NO_CONTENT) {
-        ogs_expect_or_return_val(true ==
-            build_content(&response->http, message), NULL);
+        if (build_content(&response->http, message) == false) {
+            ogs_error("build_content() failed");
+            ogs_sbi_response_free(response);
+            return NULL;
+        }
     }
 
     if (message->http.location) {
@@ -801,218 +821,190 @@ void ogs_sbi_http_hash_free(ogs_hash_t *hash)
     ogs_hash_destroy(hash);
 }
 
-static char *build_json(ogs_sbi_message_t *message)
+/*
+ * Sets `json` to the encoded body, or to NULL if the message has none.
+ * Returns false only if the body cannot be encoded.
+ */
+static bool build_json(ogs_sbi_message_t *message, char **json)
 {
-    char *content = NULL;
-    cJSON *item = NULL;
+    OpenAPI_json_writer_t writer;
+    bool rc;
 
     ogs_assert(message);
+    ogs_assert(json);
+
+    *json = NULL;
+
+    OpenAPI_json_writer_init(&writer);
 
     if (message->ProblemDetails) {
-        item = OpenAPI_problem_details_convertToJSON(message->ProblemDetails);
-        ogs_assert(item);
+        rc = OpenAPI_problem_details_writeJSON(
+                &writer, NULL, message->ProblemDetails);
     } else if (message->NFProfile) {
-        item = OpenAPI_nf_profile_convertToJSON(message->NFProfile);
-        ogs_assert(item);
+        rc = OpenAPI_nf_profile_writeJSON(&writer, NULL, message->NFProfile);
     } else if (message->PatchItemList) {
         OpenAPI_lnode_t *node = NULL;
 
-        item = cJSON_CreateArray();
-        ogs_assert(item);
-
+        rc = OpenAPI_json_write_array_start(&writer, NULL);
         OpenAPI_list_for_each(message->PatchItemList, node) {
-            cJSON *patchItem = OpenAPI_patch_item_convertToJSON(node->data);
-            ogs_assert(patchItem);
-            cJSON_AddItemToArray(item, patchItem);
+            if (rc == false)
+                break;
+            rc = OpenAPI_patch_item_writeJSON(&writer, NULL, node->data);
         }
+        rc = rc && OpenAPI_json_write_array_end(&writer);
     } else if (message->SubscriptionData) {
-        item = OpenAPI_subscription_data_convertToJSON(
-                message->SubscriptionData);
-        ogs_assert(item);
+        rc = OpenAPI_subscription_data_writeJSON(
+                &writer, NULL, message->SubscriptionData);
     } else if (message->NotificationData) {
-        item = OpenAPI_notification_data_convertToJSON(
-                message->NotificationData);
-        ogs_assert(item);
+        rc = OpenAPI_notification_data_writeJSON(
+                &writer, NULL, message->NotificationData);
     } else if (message->SearchResult) {
-        item = OpenAPI_search_result_convertToJSON(message->SearchResult);
-        ogs_assert(item);
+        rc = OpenAPI_search_result_writeJSON(
+                &writer, NULL, message->SearchResult);
     } else if (message->links) {
-        item = ogs_sbi_links_convertToJSON(message->links);
-        ogs_assert(item);
+        rc = ogs_sbi_links_writeJSON(&writer, message->links);
     } else if (message->AuthenticationInfo) {
-        item = OpenAPI_authentication_info_convertToJSON(
-                message->AuthenticationInfo);
-        ogs_assert(item);
+        rc = OpenAPI_authentication_info_writeJSON(
+                &writer, NULL, message->AuthenticationInfo);
     } else if (message->AuthenticationInfoRequest) {
-        item = OpenAPI_authentication_info_request_convertToJSON(
-                message->AuthenticationInfoRequest);
-        ogs_assert(item);
+        rc = OpenAPI_authentication_info_request_writeJSON(
+                &writer, NULL, message->AuthenticationInfoRequest);
     } else if (message->AuthenticationInfoResult) {
-        item = OpenAPI_authentication_info_result_convertToJSON(
-                message->AuthenticationInfoResult);
-        ogs_assert(item);
+        rc = OpenAPI_authentication_info_result_writeJSON(
+                &writer, NULL, message->AuthenticationInfoResult);
     } else if (message->AuthenticationSubscription) {
-        item = OpenAPI_authentication_subscription_convertToJSON(
-                message->AuthenticationSubscription);
-        ogs_assert(item);
+        rc = OpenAPI_authentication_subscription_writeJSON(
+                &writer, NULL, message->AuthenticationSubscription);
     } else if (message->UeAuthenticationCtx) {
-        item = OpenAPI_ue_authentication_ctx_convertToJSON(
-                message->UeAuthenticationCtx);
-        ogs_assert(item);
+        rc = OpenAPI_ue_authentication_ctx_writeJSON(
+                &writer, NULL, message->UeAuthenticationCtx);
     } else if (message->ConfirmationData) {
-        item = OpenAPI_confirmation_data_convertToJSON(
-                message->ConfirmationData);
-        ogs_assert(item);
+        rc = OpenAPI_confirmation_data_writeJSON(
+                &writer, NULL, message->ConfirmationData);
     } else if (message->ConfirmationDataResponse) {
-        item = OpenAPI_confirmation_data_response_convertToJSON(
-                message->ConfirmationDataResponse);
-        ogs_assert(item);
+        rc = OpenAPI_confirmation_data_response_writeJSON(
+                &writer, NULL, message->ConfirmationDataResponse);
     } else if (message->AuthEvent) {
-        item = OpenAPI_auth_event_convertToJSON(message->AuthEvent);
-        ogs_assert(item);
+        rc = OpenAPI_auth_event_writeJSON(&writer, NULL, message->AuthEvent);
     } else if (message->Amf3GppAccessRegistration) {
-        item = OpenAPI_amf3_gpp_access_registration_convertToJSON(
-                message->Amf3GppAccessRegistration);
-        ogs_assert(item);
+        rc = OpenAPI_amf3_gpp_access_registration_writeJSON(
+                &writer, NULL, message->Amf3GppAccessRegistration);
     } else if (message->Amf3GppAccessRegistrationModification) {
-        item = OpenAPI_amf3_gpp_access_registration_modification_convertToJSON(
-                message->Amf3GppAccessRegistrationModification);
-        ogs_assert(item);
+        rc = OpenAPI_amf3_gpp_access_registration_modification_writeJSON(
+                &writer, NULL, message->Amf3GppAccessRegistrationModification);
     } else if (message->AccessAndMobilitySubscriptionData) {
-        item = OpenAPI_access_and_mobility_subscription_data_convertToJSON(
-                message->AccessAndMobilitySubscriptionData);
-        ogs_assert(item);
+        rc = OpenAPI_access_and_mobility_subscription_data_writeJSON(
+                &writer, NULL, message->AccessAndMobilitySubscriptionData);
     } else if (message->SmfSelectionSubscriptionData) {
-        item = OpenAPI_smf_selection_subscription_data_convertToJSON(
-                message->SmfSelectionSubscriptionData);
-        ogs_assert(item);
+        rc = OpenAPI_smf_selection_subscription_data_writeJSON(
+                &writer, NULL, message->SmfSelectionSubscriptionData);
     } else if (message->UeContextInSmfData) {
-        item = OpenAPI_ue_context_in_smf_data_convertToJSON(
-                message->UeContextInSmfData);
-        ogs_assert(item);
+        rc = OpenAPI_ue_context_in_smf_data_writeJSON(
+                &writer, NULL, message->UeContextInSmfData);
     } else if (message->SmContextCreateData) {
-        item = OpenAPI_sm_context_create_data_convertToJSON(
-                message->SmContextCreateData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_create_data_writeJSON(
+                &writer, NULL, message->SmContextCreateData);
     } else if (message->SmContextCreatedData) {
-        item = OpenAPI_sm_context_created_data_convertToJSON(
-                message->SmContextCreatedData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_created_data_writeJSON(
+                &writer, NULL, message->SmContextCreatedData);
     } else if (message->SmContextCreateError) {
-        item = OpenAPI_sm_context_create_error_convertToJSON(
-                message->SmContextCreateError);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_create_error_writeJSON(
+                &writer, NULL, message->SmContextCreateError);
     } else if (message->SmContextUpdateData) {
-        item = OpenAPI_sm_context_update_data_convertToJSON(
-                message->SmContextUpdateData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_update_data_writeJSON(
+                &writer, NULL, message->SmContextUpdateData);
     } else if (message->SmContextUpdatedData) {
-        item = OpenAPI_sm_context_updated_data_convertToJSON(
-                message->SmContextUpdatedData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_updated_data_writeJSON(
+                &writer, NULL, message->SmContextUpdatedData);
     } else if (message->SmContextUpdateError) {
-        item = OpenAPI_sm_context_update_error_convertToJSON(
-                message->SmContextUpdateError);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_update_error_writeJSON(
+                &writer, NULL, message->SmContextUpdateError);
     } else if (message->SmContextReleaseData) {
-        item = OpenAPI_sm_context_release_data_convertToJSON(
-                message->SmContextReleaseData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_release_data_writeJSON(
+                &writer, NULL, message->SmContextReleaseData);
     } else if (message->SmContextReleasedData) {
-        item = OpenAPI_sm_context_released_data_convertToJSON(
-                message->SmContextReleasedData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_released_data_writeJSON(
+                &writer, NULL, message->SmContextReleasedData);
     } else if (message->SessionManagementSubscriptionDataList) {
         OpenAPI_lnode_t *node = NULL;
 
-        item = cJSON_CreateArray();
-        ogs_assert(item);
-
-        OpenAPI_list_for_each(message->SessionManagementSubscriptionDataList, node) {
-            cJSON *smSubDataItem = 
-                OpenAPI_session_management_subscription_data_convertToJSON(node->data);
-            ogs_assert(smSubDataItem);
-            cJSON_AddItemToArray(item, smSubDataItem);
+        rc = OpenAPI_json_write_array_start(&writer, NULL);
+        OpenAPI_list_for_each(
+                message->SessionManagementSubscriptionDataList, node) {
+            if (rc == false)
+                break;
+            rc = OpenAPI_session_management_subscription_data_writeJSON(
+                    &writer, NULL, node->data);
         }
+        rc = rc && OpenAPI_json_write_array_end(&writer);
     } else if (message->N1N2MessageTransferReqData) {
-        item = OpenAPI_n1_n2_message_transfer_req_data_convertToJSON(
-                message->N1N2MessageTransferReqData);
-        ogs_assert(item);
+        rc = OpenAPI_n1_n2_message_transfer_req_data_writeJSON(
+                &writer, NULL, message->N1N2MessageTransferReqData);
     } else if (message->N1N2MessageTransferRspData) {
-        item = OpenAPI_n1_n2_message_transfer_rsp_data_convertToJSON(
-                message->N1N2MessageTransferRspData);
-        ogs_assert(item);
+        rc = OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON(
+                &writer, NULL, message->N1N2MessageTransferRspData);
     } else if (message->N1N2MsgTxfrFailureNotification) {
-        item = OpenAPI_n1_n2_msg_txfr_failure_notification_convertToJSON(
-                message->N1N2MsgTxfrFailureNotification);
-        ogs_assert(item);
+        rc = OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON(
+                &writer, NULL, message->N1N2MsgTxfrFailureNotification);
     } else if (message->SmContextStatusNotification) {
-        item = OpenAPI_sm_context_status_notification_convertToJSON(
-                message->SmContextStatusNotification);
-        ogs_assert(item);
+        rc = OpenAPI_sm_context_status_notification_writeJSON(
+                &writer, NULL, message->SmContextStatusNotification);
     } else if (message->PolicyAssociationRequest) {
-        item = OpenAPI_policy_association_request_convertToJSON(
-                message->PolicyAssociationRequest);
-        ogs_assert(item);
+        rc = OpenAPI_policy_association_request_writeJSON(
+                &writer, NULL, message->PolicyAssociationRequest);
     } else if (message->PolicyAssociation) {
-        item = OpenAPI_policy_association_convertToJSON(
-                message->PolicyAssociation);
-        ogs_assert(item);
+        rc = OpenAPI_policy_association_writeJSON(
+                &writer, NULL, message->PolicyAssociation);
     } else if (message->AmPolicyData) {
-        item = OpenAPI_am_policy_data_convertToJSON(message->AmPolicyData);
-        ogs_assert(item);
+        rc = OpenAPI_am_policy_data_writeJSON(
+                &writer, NULL, message->AmPolicyData);
     } else if (message->SmPolicyContextData) {
-        item = OpenAPI_sm_policy_context_data_convertToJSON(
-                message->SmPolicyContextData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_policy_context_data_writeJSON(
+                &writer, NULL, message->SmPolicyContextData);
     } else if (message->SmPolicyDecision) {
-        item = OpenAPI_sm_policy_decision_convertToJSON(
-                message->SmPolicyDecision);
-        ogs_assert(item);
+        rc = OpenAPI_sm_policy_decision_writeJSON(
+                &writer, NULL, message->SmPolicyDecision);
     } else if (message->SmPolicyData) {
-        item = OpenAPI_sm_policy_data_convertToJSON(message->SmPolicyData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_policy_data_writeJSON(
+                &writer, NULL, message->SmPolicyData);
     } else if (message->SmPolicyDeleteData) {
-        item = OpenAPI_sm_policy_delete_data_convertToJSON(
-                message->SmPolicyDeleteData);
-        ogs_assert(item);
+        rc = OpenAPI_sm_policy_delete_data_writeJSON(
+                &writer, NULL, message->SmPolicyDeleteData);
     } else if (message->AuthorizedNetworkSliceInfo) {
-        item = OpenAPI_authorized_network_slice_info_convertToJSON(
-                message->AuthorizedNetworkSliceInfo);
-        ogs_assert(item);
+        rc = OpenAPI_authorized_network_slice_info_writeJSON(
+                &writer, NULL, message->AuthorizedNetworkSliceInfo);
     } else if (message->PcfBinding) {
-        item = OpenAPI_pcf_binding_convertToJSON(message->PcfBinding);
-        ogs_assert(item);
+        rc = OpenAPI_pcf_binding_writeJSON(&writer, NULL, message->PcfBinding);
     } else if (message->AppSessionContext) {
-        item = OpenAPI_app_session_context_convertToJSON(
-                message->AppSessionContext);
-        ogs_assert(item);
+        rc = OpenAPI_app_session_context_writeJSON(
+                &writer, NULL, message->AppSessionContext);
     } else if (message->AppSessionContextUpdateDataPatch) {
-        item = OpenAPI_app_session_context_update_data_patch_convertToJSON(
-                message->AppSessionContextUpdateDataPatch);
-        ogs_assert(item);
+        rc = OpenAPI_app_session_context_update_data_patch_writeJSON(
+                &writer, NULL, message->AppSessionContextUpdateDataPatch);
     } else if (message->SmPolicyNotification) {
-        item = OpenAPI_sm_policy_notification_convertToJSON(
-                message->SmPolicyNotification);
-        ogs_assert(item);
+        rc = OpenAPI_sm_policy_notification_writeJSON(
+                &writer, NULL, message->SmPolicyNotification);
     } else if (message->TerminationNotification) {
-        item = OpenAPI_termination_notification_convertToJSON(
-                message->TerminationNotification);
-        ogs_assert(item);
+        rc = OpenAPI_termination_notification_writeJSON(
+                &writer, NULL, message->TerminationNotification);
     } else if (message->DeregistrationData) {
-        item = OpenAPI_deregistration_data_convertToJSON(
-                message->DeregistrationData);
-        ogs_assert(item);
+        rc = OpenAPI_deregistration_data_writeJSON(
+                &writer, NULL, message->DeregistrationData);
+    } else {
+        return true;
     }
 
-    if (item) {
-        content = cJSON_Print(item);
-        ogs_assert(content);
-        ogs_log_print(OGS_LOG_TRACE, "%s", content);
-        cJSON_Delete(item);
+    if (rc == false) {
+        ogs_error("Cannot encode JSON");
+        OpenAPI_json_writer_clear(&writer);
+        return false;
     }
 
-    return content;
+    ogs_log_print(OGS_LOG_TRACE, "%s", writer.buf);
+
+    *json = OpenAPI_json_writer_finish(&writer);
+
+    return true;
 }
 
 static int parse_json(ogs_sbi_message_t *message,
@@ -1940,7 +1932,8 @@ static bool build_content(
         ogs_expect_or_return_val(true ==
                 build_multipart(http, message), false);
     } else {
-        http->content = build_json(message);
+        ogs_expect_or_return_val(true ==
+                build_json(message, &http->content), false);
         if (http->content) {
             http->content_length = strlen(http->content);
             if (message->http.content_type) {
@@ -2221,7 +2214,7 @@ static bool build_multipart(
     p = ogs_slprintf(p, last, "--%s\r\n", boundary);
 
     /* Encapsulated multipart part (application/json) */
-    json = build_json(message);
+    ogs_expect_or_return_val(true == build_json(message, &json), false);
     ogs_expect_or_return_val(json, false);
 
     p = ogs_slprintf(p, last, "%s\r\n\r\n%s",
@@ -0,0 +1,1315 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-sbi.h"
+
+#include <ctype.h>
+#include <netinet/tcp.h>
+#include <sys/uio.h>
+#include <nghttp2/nghttp2.h>
+
+/*
+ * HTTP/2 client over cleartext TCP (prior knowledge).
+ *
+ * Each client keeps a few sessions to its peer and multiplexes
+ * the requests on them. A new session is opened only when the others
+ * have no free stream left under the peer's MAX_CONCURRENT_STREAMS.
+ */
+
+#define MAX_NUM_OF_SESSION_PER_CLIENT   8
+#define MAX_NUM_OF_IOV                  64
+
+typedef struct session_s {
+    ogs_lnode_t             lnode;
+
+    ogs_sock_t              *sock;
+    struct {
+        ogs_poll_t          *read;
+        ogs_poll_t          *write;
+    } poll;
+
+    bool                    connected;
+    bool                    goaway;     /* No more new streams */
+    bool                    busy;       /* Inside nghttp2_session_xxx() */
+
+    nghttp2_session         *session;
+    ogs_list_t              write_queue;
+
+    ogs_list_t              stream_list;
+    int                     num_of_stream;
+
+    ogs_sbi_client_t        *client;
+} session_t;
+
+typedef struct stream_s {
+    ogs_lnode_t             lnode;
+
+    int32_t                 stream_id;
+
+    char                    *method;
+    char                    *uri;
+
+    struct {
+        char                *content;
+        size_t              length;
+        size_t              offset;
+    } body;                 /* Request body until it is framed */
+
+    ogs_sbi_response_t      *response;
+    size_t                  content_size;   /* Allocated response body */
+    bool                    completed;      /* END_STREAM received */
+
+    ogs_timer_t             *timer;
+    ogs_time_t              sent;           /* For the RTT histogram */
+
+    session_t               *session;
+
+    ogs_sbi_client_cb_f     client_cb;      /* NULL once reported */
+    void                    *data;
+} stream_t;
+
+typedef struct output_s {
+    ogs_lnode_t             lnode;
+
+    ogs_pkbuf_t             *pkbuf;
+} output_t;
+
+static void client_init(int num_of_sockinfo_pool, int num_of_connection_pool);
+static void client_final(void);
+
+static void client_add(ogs_sbi_client_t *client);
+static void client_remove(ogs_sbi_client_t *client);
+static void client_stop(ogs_sbi_client_t *client);
+
+static bool client_send_request(
+        ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
+        ogs_sbi_request_t *request, void *data);
+
+const ogs_sbi_client_actions_t ogs_nghttp2_client_actions = {
+    client_init,
+    client_final,
+
+    client_add,
+    client_remove,
+    client_stop,
+
+    client_send_request,
+};
+
+static OGS_POOL(session_pool, session_t);
+static OGS_POOL(stream_pool, stream_t);
+
+static session_t *session_add(ogs_sbi_client_t *client);
+static void session_remove(session_t *sess, bool failed);
+static int session_set_callbacks(session_t *sess);
+static int session_send(session_t *sess);
+static void session_flush(session_t *sess);
+
+static void stream_remove(stream_t *stream);
+static void stream_timer_expired(void *data);
+
+static void connect_handler(short when, ogs_socket_t fd, void *data);
+static void recv_handler(short when, ogs_socket_t fd, void *data);
+
+static void client_init(int num_of_sockinfo_pool, int num_of_connection_pool)
+{
+    ogs_pool_init(&session_pool, num_of_sockinfo_pool);
+    ogs_pool_init(&stream_pool, num_of_connection_pool);
+}
+
+static void client_final(void)
+{
+    ogs_pool_final(&session_pool);
+    ogs_pool_final(&stream_pool);
+}
+
+static void client_add(ogs_sbi_client_t *client)
+{
+    ogs_assert(client);
+
+    ogs_list_init(&client->session_list);
+}
+
+static void client_remove(ogs_sbi_client_t *client)
+{
+    session_t *sess = NULL, *next_sess = NULL;
+
+    ogs_assert(client);
+
+    ogs_list_for_each_safe(&client->session_list, next_sess, sess)
+        session_remove(sess, false);
+}
+
+static void client_stop(ogs_sbi_client_t *client)
+{
+    session_t *sess = NULL;
+    stream_t *stream = NULL;
+
+    ogs_assert(client);
+
+    ogs_list_for_each(&client->session_list, sess) {
+        ogs_list_for_each(&sess->stream_list, stream) {
+            if (stream->client_cb)
+                stream->client_cb(OGS_DONE, NULL, stream->data);
+        }
+    }
+}
+
+static void add_header(nghttp2_nv *nv, const char *key, const char *value)
+{
+    nv->name = (uint8_t *)key;
+    nv->namelen = strlen(key);
+    nv->value = (uint8_t *)value;
+    nv->valuelen = strlen(value);
+    nv->flags = NGHTTP2_NV_FLAG_NONE;
+}
+
+/* HTTP/2 only allows lowercase header names */
+static char *header_name(const char *key)
+{
+    char *name = NULL, *p = NULL;
+
+    ogs_assert(key);
+
+    name = ogs_strdup(key);
+    ogs_expect_or_return_val(name, NULL);
+
+    for (p = name; *p; p++)
+        *p = tolower((unsigned char)*p);
+
+    return name;
+}
+
+static char *uri_escape(const char *str)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char *escaped = NULL, *p = NULL;
+
+    ogs_assert(str);
+
+    escaped = ogs_malloc(strlen(str) * 3 + 1);
+    ogs_expect_or_return_val(escaped, NULL);
+
+    for (p = escaped; *str; str++) {
+        unsigned char c = *str;
+
+        if (isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~') {
+            *p++ = c;
+        } else {
+            *p++ = '%';
+            *p++ = hex[c >> 4];
+            *p++ = hex[c & 0x0f];
+        }
+    }
+    *p = '\0';
+
+    return escaped;
+}
+
+static char *add_params_to_path(char *path, ogs_hash_t *params)
+{
+    ogs_hash_index_t *hi;
+    int has_params = 0;
+    const char *fp = "?", *np = "&";
+
+    ogs_assert(path);
+    ogs_assert(params);
+    ogs_assert(ogs_hash_count(params));
+
+    has_params = (strchr(path, '?') != NULL);
+
+    for (hi = ogs_hash_first(params); hi && path; hi = ogs_hash_next(hi)) {
+        const char *key = NULL;
+        char *key_esc = NULL;
+        char *val = NULL;
+        char *val_esc = NULL;
+
+        key = ogs_hash_this_key(hi);
+        ogs_assert(key);
+        val = ogs_hash_this_val(hi);
+        ogs_assert(val);
+
+        key_esc = uri_escape(key);
+        ogs_assert(key_esc);
+        val_esc = uri_escape(val);
+        ogs_assert(val_esc);
+
+        path = ogs_mstrcatf(path, "%s%s=%s",
+                has_params ? np : fp, key_esc, val_esc);
+        ogs_expect(path);
+        has_params = 1;
+
+        ogs_free(val_esc);
+        ogs_free(key_esc);
+    }
+
+    return path;
+}
+
+/*
+ * http://127.0.0.10:7777/nnrf-disc/v1/nf-instances
+ * => authority(127.0.0.10:7777), path(/nnrf-disc/v1/nf-instances)
+ */
+static int uri_split(const char *uri, char **authority, char **path)
+{
+    const char http[] = "http://";
+    const char *p = NULL;
+
+    ogs_assert(uri);
+    ogs_assert(authority);
+    ogs_assert(path);
+
+    if (strncmp(uri, http, sizeof(http) - 1) != 0) {
+        ogs_error("Only cleartext HTTP/2 is supported [%s]", uri);
+        return OGS_ERROR;
+    }
+    uri += sizeof(http) - 1;
+
+    p = strchr(uri, '/');
+    if (p) {
+        *authority = ogs_strndup(uri, p - uri);
+        *path = ogs_strdup(p);
+    } else {
+        *authority = ogs_strdup(uri);
+        *path = ogs_strdup("/");
+    }
+    ogs_expect_or_return_val(*authority, OGS_ERROR);
+    ogs_expect_or_return_val(*path, OGS_ERROR);
+
+    return OGS_OK;
+}
+
+static stream_t *stream_add(session_t *sess,
+        ogs_sbi_client_cb_f client_cb, ogs_sbi_request_t *request, void *data)
+{
+    stream_t *stream = NULL;
+
+    ogs_assert(sess);
+    ogs_assert(client_cb);
+    ogs_assert(request);
+    ogs_assert(request->h.method);
+    ogs_assert(request->h.uri);
+
+    ogs_pool_alloc(&stream_pool, &stream);
+    ogs_expect_or_return_val(stream, NULL);
+    memset(stream, 0, sizeof(stream_t));
+
+    stream->session = sess;
+    stream->client_cb = client_cb;
+    stream->data = data;
+    stream->sent = ogs_get_monotonic_time();
+
+    ogs_list_add(&sess->stream_list, stream);
+    sess->num_of_stream++;
+
+    stream->method = ogs_strdup(request->h.method);
+    if (!stream->method) {
+        ogs_error("stream->method is NULL");
+        stream_remove(stream);
+        return NULL;
+    }
+
+    stream->uri = ogs_strdup(request->h.uri);
+    if (!stream->uri) {
+        ogs_error("stream->uri is NULL");
+        stream_remove(stream);
+        return NULL;
+    }
+
+    if (request->http.content && request->http.content_length) {
+        stream->body.content = ogs_memdup(
+                request->http.content, request->http.content_length);
+        if (!stream->body.content) {
+            ogs_error("stream->body.content is NULL");
+            stream_remove(stream);
+            return NULL;
+        }
+        stream->body.length = request->http.content_length;
+
+        ogs_debug("SENDING...[%d]", (int)request->http.content_length);
+        ogs_debug("%s", request->http.content);
+    }
+
+    stream->timer = ogs_timer_add(
+            ogs_app()->timer_mgr, stream_timer_expired, stream);
+    if (!stream->timer) {
+        ogs_error("stream->timer is NULL");
+        stream_remove(stream);
+        return NULL;
+    }
+
+    /* If http response is not received within deadline,
+     * Open5GS will discard this request. */
+    ogs_timer_start(stream->timer,
+            ogs_app()->time.message.sbi.connection_deadline);
+
+    return stream;
+}
+
+static void stream_remove(stream_t *stream)
+{
+    session_t *sess = NULL;
+
+    ogs_assert(stream);
+    sess = stream->session;
+    ogs_assert(sess);
+
+    ogs_list_remove(&sess->stream_list, stream);
+    sess->num_of_stream--;
+
+    if (stream->timer)
+        ogs_timer_delete(stream->timer);
+
+    if (stream->response)
+        ogs_sbi_response_free(stream->response);
+
+    if (stream->body.content)
+        ogs_free(stream->body.content);
+
+    if (stream->uri)
+        ogs_free(stream->uri);
+    if (stream->method)
+        ogs_free(stream->method);
+
+    ogs_pool_free(&stream_pool, stream);
+}
+
+static stream_t *stream_find(session_t *sess, int32_t stream_id)
+{
+    stream_t *stream = NULL;
+
+    ogs_assert(sess);
+
+    ogs_list_for_each(&sess->stream_list, stream) {
+        if (stream->stream_id == stream_id)
+            break;
+    }
+
+    return stream;
+}
+
+/* Reports the result to the NF and frees the stream */
+static void stream_complete(stream_t *stream, uint32_t error_code)
+{
+    ogs_sbi_response_t *response = NULL;
+
+    ogs_assert(stream);
+
+    if (stream->client_cb) {
+        response = stream->response;
+
+        if (error_code == NGHTTP2_NO_ERROR &&
+                stream->completed && response && response->status) {
+            stream->response = NULL;
+
+            response->h.method = ogs_strdup(stream->method);
+            ogs_assert(response->h.method);
+            response->h.uri = ogs_strdup(stream->uri);
+            ogs_assert(response->h.uri);
+
+            if (response->http.content &&
+                    response->http.content_length == 0) {
+                ogs_free(response->http.content);
+                response->http.content = NULL;
+            }
+
+            ogs_debug("[%d:%s] %s",
+                    response->status, response->h.method, response->h.uri);
+
+            ogs_debug("RECEIVED[%d]", (int)response->http.content_length);
+            if (response->http.content_length && response->http.content)
+                ogs_debug("%s", response->http.content);
+
+            ogs_sbi_client_observe_rtt(
+                    stream->session->client, stream->sent);
+            stream->client_cb(OGS_OK, response, stream->data);
+        } else {
+            ogs_warn("[%s] %s failed (%d:%s)", stream->method, stream->uri,
+                    error_code, nghttp2_http2_strerror(error_code));
+            stream->client_cb(OGS_ERROR, NULL, stream->data);
+        }
+    }
+
+    stream_remove(stream);
+}
+
+static void stream_timer_expired(void *data)
+{
+    stream_t *stream = data;
+    session_t *sess = NULL;
+
+    ogs_assert(stream);
+    sess = stream->session;
+    ogs_assert(sess);
+
+    ogs_error("Stream timer expired [%s] %s", stream->method, stream->uri);
+
+    ogs_timer_delete(stream->timer);
+    stream->timer = NULL;
+
+    ogs_assert(stream->client_cb);
+    stream->client_cb(OGS_TIMEUP, NULL, stream->data);
+    stream->client_cb = NULL;
+
+    /* The stream is freed when nghttp2 closes it */
+    nghttp2_submit_rst_stream(sess->session,
+            NGHTTP2_FLAG_NONE, stream->stream_id, NGHTTP2_CANCEL);
+    if (session_send(sess) != OGS_OK)
+        session_remove(sess, true);
+}
+
+static ssize_t request_read_callback(nghttp2_session *session,
+                                     int32_t stream_id,
+                                     uint8_t *buf, size_t length,
+                                     uint32_t *data_flags,
+                                     nghttp2_data_source *source,
+                                     void *user_data)
+{
+    stream_t *stream = NULL;
+    size_t len;
+
+    ogs_assert(source);
+    stream = source->ptr;
+    ogs_assert(stream);
+
+    ogs_assert(stream->body.content);
+    ogs_assert(stream->body.offset <= stream->body.length);
+
+    len = ogs_min(stream->body.length - stream->body.offset, length);
+    memcpy(buf, stream->body.content + stream->body.offset, len);
+
+    stream->body.offset += len;
+    if (stream->body.offset == stream->body.length) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+
+        ogs_free(stream->body.content);
+        stream->body.content = NULL;
+    }
+
+    return len;
+}
+
+static int32_t stream_submit(stream_t *stream, ogs_sbi_request_t *request)
+{
+    session_t *sess = NULL;
+
+    ogs_hash_index_t *hi;
+    nghttp2_nv *nva = NULL;
+    char **names = NULL;
+    int num_of_name = 0;
+    nghttp2_data_provider data_prd;
+    char *authority = NULL, *path = NULL;
+    char clen[32];
+    int32_t stream_id = NGHTTP2_ERR_INVALID_ARGUMENT;
+    int i, j;
+
+    ogs_assert(stream);
+    sess = stream->session;
+    ogs_assert(sess);
+    ogs_assert(request);
+
+    if (uri_split(stream->uri, &authority, &path) != OGS_OK)
+        goto cleanup;
+
+    if (ogs_hash_count(request->http.params)) {
+        path = add_params_to_path(path, request->http.params);
+        if (!path) {
+            ogs_error("add_params_to_path() failed");
+            goto cleanup;
+        }
+    }
+
+    /* :method, :scheme, :authority, :path and content-length */
+    nva = ogs_calloc(5 + ogs_hash_count(request->http.headers),
+            sizeof(nghttp2_nv));
+    if (!nva) {
+        ogs_error("nva is NULL");
+        goto cleanup;
+    }
+    names = ogs_calloc(1 + ogs_hash_count(request->http.headers),
+            sizeof(char *));
+    if (!names) {
+        ogs_error("names is NULL");
+        goto cleanup;
+    }
+
+    i = 0;
+    add_header(&nva[i++], ":method", stream->method);
+    add_header(&nva[i++], ":scheme", "http");
+    add_header(&nva[i++], ":authority", authority);
+    add_header(&nva[i++], ":path", path);
+
+    for (hi = ogs_hash_first(request->http.headers);
+            hi; hi = ogs_hash_next(hi)) {
+        names[num_of_name] = header_name(ogs_hash_this_key(hi));
+        if (!names[num_of_name]) {
+            ogs_error("header_name() failed");
+            goto cleanup;
+        }
+        add_header(&nva[i++], names[num_of_name++], ogs_hash_this_val(hi));
+    }
+
+    memset(&data_prd, 0, sizeof(data_prd));
+    if (stream->body.content) {
+        /* Lets the server allocate the body once */
+        ogs_snprintf(clen, sizeof(clen), "%d", (int)stream->body.length);
+        add_header(&nva[i++], "content-length", clen);
+
+        data_prd.source.ptr = stream;
+        data_prd.read_callback = request_read_callback;
+    }
+
+    stream_id = nghttp2_submit_request(sess->session, NULL, nva, i,
+            stream->body.content ? &data_prd : NULL, stream);
+    if (stream_id < 0) {
+        ogs_error("nghttp2_submit_request() failed (%d:%s)",
+                    (int)stream_id, nghttp2_strerror((int)stream_id));
+        goto cleanup;
+    }
+
+    stream->stream_id = stream_id;
+    ogs_debug("STREAM submitted [%d]", stream_id);
+
+cleanup:
+    if (names) {
+        for (j = 0; j < num_of_name; j++)
+            ogs_free(names[j]);
+        ogs_free(names);
+    }
+    if (nva)
+        ogs_free(nva);
+    if (path)
+        ogs_free(path);
+    if (authority)
+        ogs_free(authority);
+
+    return stream_id;
+}
+
+/*
+ * Takes the session with the fewest streams if it can open one more.
+ * Otherwise a new session is opened up to MAX_NUM_OF_SESSION_PER_CLIENT,
+ * after which nghttp2 queues the request until a stream is closed.
+ */
+static session_t *session_find(ogs_sbi_client_t *client)
+{
+    session_t *sess = NULL, *least = NULL;
+    int num_of_session = 0;
+
+    ogs_assert(client);
+
+    ogs_list_for_each(&client->session_list, sess) {
+        if (sess->goaway)
+            continue;
+
+        num_of_session++;
+        if (!least || sess->num_of_stream < least->num_of_stream)
+            least = sess;
+    }
+
+    if (least && (uint32_t)least->num_of_stream <
+            nghttp2_session_get_remote_settings(least->session,
+                NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS))
+        return least;
+
+    if (num_of_session < MAX_NUM_OF_SESSION_PER_CLIENT) {
+        sess = session_add(client);
+        if (sess)
+            return sess;
+    }
+
+    return least;
+}
+
+static bool client_send_request(
+        ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
+        ogs_sbi_request_t *request, void *data)
+{
+    session_t *sess = NULL;
+    stream_t *stream = NULL;
+    int32_t stream_id;
+
+    ogs_assert(client);
+    ogs_assert(request);
+
+    sess = session_find(client);
+    ogs_expect_or_return_val(sess, false);
+
+    stream = stream_add(sess, client_cb, request, data);
+    ogs_expect_or_return_val(stream, false);
+
+    stream_id = stream_submit(stream, request);
+    if (stream_id == NGHTTP2_ERR_STREAM_ID_NOT_AVAILABLE) {
+        /* Stream IDs are used up : retire the session */
+        sess->goaway = true;
+        stream_remove(stream);
+
+        sess = session_find(client);
+        ogs_expect_or_return_val(sess, false);
+
+        stream = stream_add(sess, client_cb, request, data);
+        ogs_expect_or_return_val(stream, false);
+
+        stream_id = stream_submit(stream, request);
+    }
+    if (stream_id < 0) {
+        stream_remove(stream);
+        return false;
+    }
+
+    if (session_send(sess) != OGS_OK) {
+        ogs_error("session_send() failed");
+
+        /* The caller learns it from the return value, not the callback */
+        stream->client_cb = NULL;
+        session_remove(sess, true);
+        return false;
+    }
+
+    return true;
+}
+
+static session_t *session_add(ogs_sbi_client_t *client)
+{
+    char buf[OGS_ADDRSTRLEN];
+    ogs_sockaddr_t *addr = NULL;
+    session_t *sess = NULL;
+    ogs_sock_t *sock = NULL;
+    nghttp2_settings_entry iv[1];
+    int rv;
+
+    ogs_assert(client);
+    addr = client->node.addr;
+    ogs_assert(addr);
+
+    ogs_pool_alloc(&session_pool, &sess);
+    ogs_expect_or_return_val(sess, NULL);
+    memset(sess, 0, sizeof(session_t));
+
+    sess->client = client;
+    ogs_list_init(&sess->stream_list);
+    ogs_list_init(&sess->write_queue);
+
+    ogs_list_add(&client->session_list, sess);
+
+    sock = ogs_sock_socket(addr->ogs_sa_family, SOCK_STREAM, IPPROTO_TCP);
+    if (!sock) {
+        ogs_error("ogs_sock_socket() failed");
+        session_remove(sess, false);
+        return NULL;
+    }
+    sess->sock = sock;
+
+    rv = ogs_nonblocking(sock->fd);
+    ogs_assert(rv == OGS_OK);
+    rv = ogs_tcp_nodelay(sock->fd, true);
+    ogs_assert(rv == OGS_OK);
+
+    if (session_set_callbacks(sess) != OGS_OK) {
+        session_remove(sess, false);
+        return NULL;
+    }
+
+    iv[0].settings_id = NGHTTP2_SETTINGS_ENABLE_PUSH;
+    iv[0].value = 0;
+    rv = nghttp2_submit_settings(
+            sess->session, NGHTTP2_FLAG_NONE, iv, OGS_ARRAY_SIZE(iv));
+    if (rv != 0) {
+        ogs_error("nghttp2_submit_settings() failed (%d:%s)",
+                    rv, nghttp2_strerror(rv));
+        session_remove(sess, false);
+        return NULL;
+    }
+
+    rv = connect(sock->fd, &addr->sa, ogs_sockaddr_len(addr));
+    if (rv == 0) {
+        sess->connected = true;
+    } else if (errno == EINPROGRESS) {
+        sess->poll.write = ogs_pollset_add(ogs_app()->pollset,
+                OGS_POLLOUT, sock->fd, connect_handler, sess);
+        ogs_assert(sess->poll.write);
+    } else {
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                "connect() [%s]:%d failed",
+                OGS_ADDR(addr, buf), OGS_PORT(addr));
+        session_remove(sess, false);
+        return NULL;
+    }
+    memcpy(&sock->remote_addr, addr, sizeof(sock->remote_addr));
+
+    sess->poll.read = ogs_pollset_add(ogs_app()->pollset,
+            OGS_POLLIN, sock->fd, recv_handler, sess);
+    ogs_assert(sess->poll.read);
+
+    ogs_debug("SESSION added [%s]:%d",
+            OGS_ADDR(addr, buf), OGS_PORT(addr));
+
+    return sess;
+}
+
+/* If `failed` is set, the pending requests are reported with OGS_ERROR */
+static void session_remove(session_t *sess, bool failed)
+{
+    ogs_sbi_client_t *client = NULL;
+    stream_t *stream = NULL, *next_stream = NULL;
+    output_t *output = NULL, *next_output = NULL;
+
+    ogs_assert(sess);
+    client = sess->client;
+    ogs_assert(client);
+
+    /* The callback may send again : do not pick this session */
+    ogs_list_remove(&client->session_list, sess);
+
+    ogs_list_for_each_safe(&sess->stream_list, next_stream, stream) {
+        if (failed && stream->client_cb)
+            stream->client_cb(OGS_ERROR, NULL, stream->data);
+        stream_remove(stream);
+    }
+
+    if (sess->poll.read)
+        ogs_pollset_remove(sess->poll.read);
+    if (sess->poll.write)
+        ogs_pollset_remove(sess->poll.write);
+
+    if (sess->session)
+        nghttp2_session_del(sess->session);
+
+    ogs_list_for_each_safe(&sess->write_queue, next_output, output) {
+        ogs_list_remove(&sess->write_queue, output);
+        ogs_pkbuf_free(output->pkbuf);
+        ogs_free(output);
+    }
+
+    if (sess->sock)
+        ogs_sock_destroy(sess->sock);
+
+    ogs_pool_free(&session_pool, sess);
+}
+
+static void connect_handler(short when, ogs_socket_t fd, void *data)
+{
+    char buf[OGS_ADDRSTRLEN];
+    ogs_sockaddr_t *addr = NULL;
+    session_t *sess = data;
+    int error = 0;
+    socklen_t len = sizeof(error);
+
+    ogs_assert(sess);
+    ogs_assert(sess->client);
+    addr = sess->client->node.addr;
+    ogs_assert(addr);
+
+    ogs_assert(sess->poll.write);
+    ogs_pollset_remove(sess->poll.write);
+    sess->poll.write = NULL;
+
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error) {
+        ogs_error("connect() [%s]:%d failed (%d:%s)",
+                OGS_ADDR(addr, buf), OGS_PORT(addr), error, strerror(error));
+        session_remove(sess, true);
+        return;
+    }
+
+    ogs_debug("SESSION connected [%s]:%d",
+            OGS_ADDR(addr, buf), OGS_PORT(addr));
+
+    sess->connected = true;
+    if (session_send(sess) != OGS_OK)
+        session_remove(sess, true);
+}
+
+static void recv_handler(short when, ogs_socket_t fd, void *data)
+{
+    char buf[OGS_ADDRSTRLEN];
+    ogs_sockaddr_t *addr = NULL;
+
+    session_t *sess = data;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ssize_t readlen;
+    int n;
+
+    ogs_assert(sess);
+    ogs_assert(sess->client);
+    addr = sess->client->node.addr;
+    ogs_assert(addr);
+    ogs_assert(fd != INVALID_SOCKET);
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+    ogs_assert(pkbuf);
+
+    n = ogs_recv(fd, pkbuf->data, OGS_MAX_SDU_LEN, 0);
+    if (n > 0) {
+        ogs_pkbuf_put(pkbuf, n);
+
+        ogs_assert(sess->session);
+        sess->busy = true;
+        readlen = nghttp2_session_mem_recv(
+                sess->session, pkbuf->data, pkbuf->len);
+        sess->busy = false;
+
+        if (readlen < 0) {
+            ogs_error("nghttp2_session_mem_recv() failed (%d:%s)",
+                        (int)readlen, nghttp2_strerror((int)readlen));
+            session_remove(sess, true);
+        } else if (session_send(sess) != OGS_OK) {
+            ogs_error("session_send() failed");
+            session_remove(sess, true);
+        } else if (sess->goaway && sess->num_of_stream == 0) {
+            ogs_debug("SESSION drained [%s]:%d",
+                        OGS_ADDR(addr, buf), OGS_PORT(addr));
+            session_remove(sess, false);
+        }
+    } else {
+        if (n < 0) {
+            if (errno != OGS_ECONNRESET)
+                ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                                "lost connection [%s]:%d",
+                                OGS_ADDR(addr, buf), OGS_PORT(addr));
+        } else if (n == 0) {
+            ogs_debug("connection closed [%s]:%d",
+                        OGS_ADDR(addr, buf), OGS_PORT(addr));
+        }
+
+        session_remove(sess, true);
+    }
+
+    ogs_pkbuf_free(pkbuf);
+}
+
+static int on_frame_recv(nghttp2_session *session,
+                         const nghttp2_frame *frame, void *user_data)
+{
+    session_t *sess = user_data;
+    stream_t *stream = NULL;
+
+    ogs_assert(sess);
+    ogs_assert(frame);
+
+    switch (frame->hd.type) {
+    case NGHTTP2_GOAWAY:
+        ogs_debug("GOAWAY received [last_stream_id:%d]",
+                frame->goaway.last_stream_id);
+        sess->goaway = true;
+        break;
+    case NGHTTP2_HEADERS:
+    case NGHTTP2_DATA:
+        if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) {
+            stream = nghttp2_session_get_stream_user_data(
+                    session, frame->hd.stream_id);
+            if (stream)
+                stream->completed = true;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+static int on_frame_not_send(nghttp2_session *session,
+                             const nghttp2_frame *frame,
+                             int lib_error_code, void *user_data)
+{
+    session_t *sess = user_data;
+    stream_t *stream = NULL;
+
+    ogs_assert(sess);
+    ogs_assert(frame);
+
+    if (frame->hd.type != NGHTTP2_HEADERS)
+        return 0;
+
+    /* nghttp2 may not close a stream that was never opened */
+    stream = stream_find(sess, frame->hd.stream_id);
+    if (!stream)
+        return 0;
+
+    ogs_warn("Request not sent (%d:%s)",
+            lib_error_code, nghttp2_strerror(lib_error_code));
+    nghttp2_session_set_stream_user_data(
+            session, frame->hd.stream_id, NULL);
+    stream_complete(stream, NGHTTP2_REFUSED_STREAM);
+
+    return 0;
+}
+
+static int on_stream_close(nghttp2_session *session, int32_t stream_id,
+                           uint32_t error_code, void *user_data)
+{
+    stream_t *stream = NULL;
+
+    ogs_assert(session);
+
+    stream = nghttp2_session_get_stream_user_data(session, stream_id);
+    if (!stream)
+        return 0;
+
+    ogs_debug("STREAM closed [%d]", stream_id);
+    stream_complete(stream, error_code);
+
+    return 0;
+}
+
+static int on_header(nghttp2_session *session, const nghttp2_frame *frame,
+                     nghttp2_rcbuf *name, nghttp2_rcbuf *value,
+                     uint8_t flags, void *user_data)
+{
+    stream_t *stream = NULL;
+    ogs_sbi_response_t *response = NULL;
+
+    const char STATUS[] = ":status";
+    const char CONTENT_TYPE[] = "content-type";
+    const char CONTENT_LENGTH[] = "content-length";
+    const char LOCATION[] = "location";
+
+    nghttp2_vec namebuf, valuebuf;
+    char *namestr = NULL, *valuestr = NULL;
+
+    ogs_assert(session);
+    ogs_assert(frame);
+
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_RESPONSE) {
+        return 0;
+    }
+
+    stream = nghttp2_session_get_stream_user_data(session, frame->hd.stream_id);
+    if (!stream)
+        return 0;
+
+    if (!stream->response) {
+        stream->response = ogs_sbi_response_new();
+        ogs_assert(stream->response);
+    }
+    response = stream->response;
+
+    ogs_assert(name);
+    namebuf = nghttp2_rcbuf_get_buf(name);
+    ogs_assert(namebuf.base);
+    ogs_assert(namebuf.len);
+
+    ogs_assert(value);
+    valuebuf = nghttp2_rcbuf_get_buf(value);
+    ogs_assert(valuebuf.base);
+
+    if (valuebuf.len == 0) return 0;
+
+    namestr = ogs_strndup((const char *)namebuf.base, namebuf.len);
+    ogs_assert(namestr);
+
+    valuestr = ogs_strndup((const char *)valuebuf.base, valuebuf.len);
+    ogs_assert(valuestr);
+
+    if (strcmp(namestr, STATUS) == 0) {
+        response->status = atoi(valuestr);
+
+    } else if (strcmp(namestr, CONTENT_TYPE) == 0) {
+        ogs_sbi_header_set(response->http.headers,
+                OGS_SBI_CONTENT_TYPE, valuestr);
+
+    } else if (strcmp(namestr, LOCATION) == 0) {
+        ogs_sbi_header_set(response->http.headers,
+                OGS_SBI_LOCATION, valuestr);
+
+    } else if (strcmp(namestr, CONTENT_LENGTH) == 0) {
+        /*
+         * The body is received into a single buffer.
+         * Content-Length comes from the peer. Pre-allocate up to
+         * OGS_MAX_SDU_LEN and let on_data_chunk_recv() grow the rest.
+         */
+        size_t size = ogs_min(strtoul(valuestr, NULL, 10), OGS_MAX_SDU_LEN);
+
+        if (size && !response->http.content) {
+            response->http.content = ogs_malloc(size + 1);
+            if (response->http.content)
+                stream->content_size = size;
+        }
+
+    } else {
+        ogs_sbi_header_set(response->http.headers, namestr, valuestr);
+
+    }
+
+    ogs_free(namestr);
+    ogs_free(valuestr);
+
+    return 0;
+}
+
+static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
+                              int32_t stream_id, const uint8_t *data,
+                              size_t len, void *user_data)
+{
+    stream_t *stream = NULL;
+    ogs_sbi_response_t *response = NULL;
+    size_t length;
+
+    ogs_assert(session);
+
+    stream = nghttp2_session_get_stream_user_data(session, stream_id);
+    if (!stream)
+        return 0;
+
+    response = stream->response;
+    if (!response) {
+        ogs_error("DATA before HEADERS [%d]", stream_id);
+        return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+    }
+
+    ogs_assert(data);
+    ogs_assert(len);
+
+    length = response->http.content_length + len;
+    if (length > stream->content_size) {
+        /* Double the buffer so that a large body is not copied per chunk */
+        size_t size = ogs_max(length, stream->content_size * 2);
+        char *content = ogs_realloc(response->http.content, size + 1);
+        if (!content) {
+            ogs_error("Cannot allocate Content-Length[%d]", (int)size);
+            return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+        }
+        response->http.content = content;
+        stream->content_size = size;
+    }
+
+    memcpy(response->http.content + response->http.content_length, data, len);
+    response->http.content_length = length;
+    response->http.content[length] = '\0';
+
+    return 0;
+}
+
+static int error_callback(nghttp2_session *session,
+                          const char *msg, size_t len, void *user_data)
+{
+    char buf[OGS_ADDRSTRLEN];
+    ogs_sockaddr_t *addr = NULL;
+    session_t *sess = user_data;
+
+    ogs_assert(sess);
+    ogs_assert(sess->client);
+    addr = sess->client->node.addr;
+    ogs_assert(addr);
+
+    ogs_assert(msg);
+
+    ogs_error("[%s]:%d http2 error: %.*s",
+            OGS_ADDR(addr, buf), OGS_PORT(addr), (int)len, msg);
+
+    return 0;
+}
+
+static output_t *output_add(session_t *sess, size_t len)
+{
+    output_t *output = NULL;
+
+    ogs_assert(sess);
+
+    output = ogs_calloc(1, sizeof(*output));
+    ogs_assert(output);
+
+    output->pkbuf = ogs_pkbuf_alloc(NULL, ogs_max(len, OGS_MAX_SDU_LEN));
+    ogs_assert(output->pkbuf);
+
+    ogs_list_add(&sess->write_queue, output);
+
+    return output;
+}
+
+static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
+                             size_t length, int flags, void *user_data)
+{
+    session_t *sess = user_data;
+    output_t *output = NULL;
+
+    ogs_assert(sess);
+    ogs_assert(data);
+    ogs_assert(length);
+
+    /* Coalesce the frames into the last buffer if it has room */
+    output = ogs_list_last(&sess->write_queue);
+    if (!output || ogs_pkbuf_tailroom(output->pkbuf) < length)
+        output = output_add(sess, length);
+
+    ogs_pkbuf_put_data(output->pkbuf, data, length);
+
+    return length;
+}
+
+static int session_set_callbacks(session_t *sess)
+{
+    int rv;
+    nghttp2_session_callbacks *callbacks = NULL;
+
+    ogs_assert(sess);
+
+    rv = nghttp2_session_callbacks_new(&callbacks);
+    if (rv != 0) {
+        ogs_error("nghttp2_session_callbacks_new() failed (%d:%s)",
+                    rv, nghttp2_strerror(rv));
+        return OGS_ERROR;
+    }
+
+    nghttp2_session_callbacks_set_on_frame_recv_callback(
+            callbacks, on_frame_recv);
+
+    nghttp2_session_callbacks_set_on_frame_not_send_callback(
+            callbacks, on_frame_not_send);
+
+    nghttp2_session_callbacks_set_on_stream_close_callback(
+            callbacks, on_stream_close);
+
+    nghttp2_session_callbacks_set_on_header_callback2(callbacks, on_header);
+
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+            callbacks, on_data_chunk_recv);
+
+    nghttp2_session_callbacks_set_error_callback(callbacks, error_callback);
+
+    nghttp2_session_callbacks_set_send_callback(callbacks, send_callback);
+
+    rv = nghttp2_session_client_new(&sess->session, callbacks, sess);
+    nghttp2_session_callbacks_del(callbacks);
+    if (rv != 0) {
+        ogs_error("nghttp2_session_client_new() failed (%d:%s)",
+                    rv, nghttp2_strerror(rv));
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+/*
+ * Frames are not sent until the connection is up.
+ * Inside a callback, the caller of nghttp2 sends them on return.
+ */
+static int session_send(session_t *sess)
+{
+    int rv;
+
+    ogs_assert(sess);
+    ogs_assert(sess->session);
+
+    if (!sess->connected || sess->busy)
+        return OGS_OK;
+
+    sess->busy = true;
+    rv = nghttp2_session_send(sess->session);
+    sess->busy = false;
+
+    if (rv != 0) {
+        ogs_error("nghttp_session_send() failed (%d:%s)",
+                    rv, nghttp2_strerror(rv));
+        return OGS_ERROR;
+    }
+
+    session_flush(sess);
+
+    return OGS_OK;
+}
+
+static void session_write_callback(short when, ogs_socket_t fd, void *data)
+{
+    session_t *sess = data;
+
+    ogs_assert(sess);
+
+    session_flush(sess);
+}
+
+static void session_flush(session_t *sess)
+{
+    ogs_sock_t *sock = NULL;
+    ogs_socket_t fd = INVALID_SOCKET;
+
+    output_t *output = NULL, *next_output = NULL;
+    struct iovec iov[MAX_NUM_OF_IOV];
+    ssize_t sent;
+    int i;
+
+    ogs_assert(sess);
+    sock = sess->sock;
+    ogs_assert(sock);
+    fd = sock->fd;
+    ogs_assert(fd != INVALID_SOCKET);
+
+    while (ogs_list_first(&sess->write_queue)) {
+        i = 0;
+        ogs_list_for_each(&sess->write_queue, output) {
+            if (i == MAX_NUM_OF_IOV)
+                break;
+
+            iov[i].iov_base = output->pkbuf->data;
+            iov[i].iov_len = output->pkbuf->len;
+            i++;
+        }
+
+        sent = writev(fd, iov, i);
+        if (sent < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == OGS_EAGAIN)
+                break;
+
+            /* recv_handler() will remove the session */
+            ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                    "writev() failed");
+            ogs_list_for_each_safe(&sess->write_queue, next_output, output) {
+                ogs_list_remove(&sess->write_queue, output);
+                ogs_pkbuf_free(output->pkbuf);
+                ogs_free(output);
+            }
+            break;
+        }
+
+        ogs_list_for_each_safe(&sess->write_queue, next_output, output) {
+            if (sent == 0)
+                break;
+
+            if ((size_t)sent < output->pkbuf->len) {
+                ogs_pkbuf_pull(output->pkbuf, sent);
+                sent = 0;
+                break;
+            }
+
+            sent -= output->pkbuf->len;
+            ogs_list_remove(&sess->write_queue, output);
+            ogs_pkbuf_free(output->pkbuf);
+            ogs_free(output);
+        }
+
+        if (ogs_list_first(&sess->write_queue) && i < MAX_NUM_OF_IOV)
+            break; /* Short write : the socket is full */
+    }
+
+    if (ogs_list_first(&sess->write_queue)) {
+        if (!sess->poll.write) {
+            sess->poll.write = ogs_pollset_add(ogs_app()->pollset,
+                OGS_POLLOUT, fd, session_write_callback, sess);
+            ogs_assert(sess->poll.write);
+        }
+    } else {
+        if (sess->poll.write) {
+            ogs_pollset_remove(sess->poll.write);
+            sess->poll.write = NULL;
+        }
+    }
+}
@@ -21,6 +21,7 @@
 #include "yuarel.h"
 
 #include <netinet/tcp.h>
+#include <sys/uio.h>
 #include <nghttp2/nghttp2.h>
 
 #define USE_SEND_DATA_WITH_NO_COPY 1
@@ -57,6 +58,8 @@ struct h2_settings {
     bool enable_push;
 };
 
+typedef struct ogs_sbi_loop_s ogs_sbi_loop_t;
+
 typedef struct ogs_sbi_session_s {
     ogs_lnode_t             lnode;
 
@@ -71,6 +74,7 @@ typedef struct ogs_sbi_session_s {
     ogs_list_t              write_queue;
 
     ogs_sbi_server_t        *server;
+    ogs_sbi_loop_t          *loop;
     ogs_list_t              stream_list;
     int32_t                 last_stream_id;
 
@@ -83,36 +87,136 @@ typedef struct ogs_sbi_stream_s {
     int32_t                 stream_id;
     ogs_sbi_request_t       *request;
 
+    struct {
+        char                *content;
+        size_t              length;
+        size_t              offset;
+    } body;                 /* Response body until it is queued */
+
+    bool                    dispatched; /* The NF owes a response */
+
+    ogs_sbi_server_t        *server;
     ogs_sbi_session_t       *session;
+    ogs_sbi_loop_t          *loop;
 } ogs_sbi_stream_t;
 
+/*
+ * Bytes waiting for the socket.
+ *
+ * Frames from nghttp2 are copied and coalesced into `pkbuf`.
+ * The last chunk of a response body is referenced by `content`
+ * and freed once written.
+ */
+typedef struct ogs_sbi_output_s {
+    ogs_lnode_t             lnode;
+
+    ogs_pkbuf_t             *pkbuf;
+
+    char                    *content;
+    uint8_t                 *data;
+    size_t                  len;
+} ogs_sbi_output_t;
+
+#define MAX_NUM_OF_IOV      64
+
+/*
+ * Sessions and streams served by one thread.
+ *
+ * `main_loop` is the NF thread, shared by the servers without I/O threads.
+ * An I/O thread has its own SO_REUSEPORT listener and pollset.
+ * The decoded requests are passed to the NF thread with `request`
+ * and the responses come back with `response_queue`.
+ *
+ * A stream closed while the NF still holds its request is kept
+ * in `orphan_list` until the response arrives, on any loop.
+ */
+struct ogs_sbi_loop_s {
+    ogs_sbi_server_t        *server;
+
+    ogs_thread_t            *thread;
+    ogs_pollset_t           *pollset;
+
+    ogs_sock_t              *sock;
+    ogs_poll_t              *poll;
+
+    ogs_list_t              session_list;
+    ogs_list_t              orphan_list;
+
+    OGS_POOL(session_pool, ogs_sbi_session_t);
+    OGS_POOL(stream_pool, ogs_sbi_stream_t);
+
+    struct {
+        ogs_queue_t         *queue;
+        ogs_socket_t        fd[2];
+        ogs_poll_t          *poll;  /* fd[0] on the NF pollset */
+    } request;
+
+    ogs_queue_t             *response_queue;
+};
+
+typedef struct ogs_sbi_reply_s {
+    ogs_sbi_stream_t        *stream;
+    ogs_sbi_response_t      *response;
+} ogs_sbi_reply_t;
+
 static void session_remove(ogs_sbi_session_t *sbi_sess);
 static void session_remove_all(ogs_sbi_server_t *server);
 
 static void stream_remove(ogs_sbi_stream_t *stream);
+static void stream_free(ogs_sbi_stream_t *stream);
+
+static int loop_start_all(ogs_sbi_server_t *server);
+static void loop_stop_all(ogs_sbi_server_t *server);
+static ogs_sbi_loop_t *loop_find(ogs_sbi_stream_t *stream);
+static int loop_dispatch(ogs_sbi_loop_t *loop, ogs_sbi_stream_t *stream);
+static bool loop_send_response(ogs_sbi_loop_t *loop,
+        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response);
 
 static void accept_handler(short when, ogs_socket_t fd, void *data);
+static void loop_accept_handler(short when, ogs_socket_t fd, void *data);
 static void recv_handler(short when, ogs_socket_t fd, void *data);
 
 static int session_set_callbacks(ogs_sbi_session_t *sbi_sess);
 static int session_send_preface(ogs_sbi_session_t *sbi_sess);
 static int session_send(ogs_sbi_session_t *sbi_sess);
-static void session_write_to_buffer(
-        ogs_sbi_session_t *sbi_sess, ogs_pkbuf_t *pkbuf);
+static void session_write_data(
+        ogs_sbi_session_t *sbi_sess, const void *data, size_t len);
+static void session_write_content(ogs_sbi_session_t *sbi_sess,
+        char *content, uint8_t *data, size_t len);
+static void session_flush(ogs_sbi_session_t *sbi_sess);
+static void output_remove(ogs_sbi_session_t *sbi_sess,
+        ogs_sbi_output_t *output);
+
+static ogs_sbi_loop_t main_loop;
 
-static OGS_POOL(session_pool, ogs_sbi_session_t);
-static OGS_POOL(stream_pool, ogs_sbi_stream_t);
+static struct {
+    int session;
+    int stream;
+} pool_size;
 
 static void server_init(int num_of_session_pool, int num_of_stream_pool)
 {
-    ogs_pool_init(&session_pool, num_of_session_pool);
-    ogs_pool_init(&stream_pool, num_of_stream_pool);
+    pool_size.session = num_of_session_pool;
+    pool_size.stream = num_of_stream_pool;
+
+    ogs_list_init(&main_loop.orphan_list);
+
+    ogs_pool_init(&main_loop.session_pool, num_of_session_pool);
+    ogs_pool_init(&main_loop.stream_pool, num_of_stream_pool);
 }
 
 static void server_final(void)
 {
-    ogs_pool_final(&stream_pool);
-    ogs_pool_final(&session_pool);
+    ogs_sbi_stream_t *stream = NULL, *next_stream = NULL;
+
+    /* Responses which never came */
+    ogs_list_for_each_safe(&main_loop.orphan_list, next_stream, stream) {
+        ogs_list_remove(&main_loop.orphan_list, stream);
+        stream_free(stream);
+    }
+
+    ogs_pool_final(&main_loop.stream_pool);
+    ogs_pool_final(&main_loop.session_pool);
 }
 
 static int server_start(ogs_sbi_server_t *server,
@@ -126,21 +230,30 @@ static int server_start(ogs_sbi_server_t *server,
     addr = server->node.addr;
     ogs_assert(addr);
 
-    sock = ogs_tcp_server(addr, server->node.option);
-    if (!sock) {
-        ogs_error("Cannot start SBI server");
-        return OGS_ERROR;
-    }
-
-    server->node.sock = sock;
-
     /* Setup callback function */
     server->cb = cb;
 
-    /* Setup poll for server listening socket */
-    server->node.poll = ogs_pollset_add(ogs_app()->pollset,
-            OGS_POLLIN, sock->fd, accept_handler, server);
-    ogs_assert(server->node.poll);
+    if (server->num_of_io_thread) {
+        if (loop_start_all(server) != OGS_OK) {
+            ogs_error("Cannot start SBI server");
+            loop_stop_all(server);
+            return OGS_ERROR;
+        }
+    } else {
+        sock = ogs_tcp_server(addr, server->node.option);
+        if (!sock) {
+            ogs_error("Cannot start SBI server");
+            return OGS_ERROR;
+        }
+
+        server->node.sock = sock;
+
+        /* Setup poll for server listening socket */
+        main_loop.pollset = ogs_app()->pollset;
+        server->node.poll = ogs_pollset_add(main_loop.pollset,
+                OGS_POLLIN, sock->fd, accept_handler, server);
+        ogs_assert(server->node.poll);
+    }
 
     hostname = ogs_gethostname(addr);
     if (hostname)
@@ -149,6 +262,10 @@ static int server_start(ogs_sbi_server_t *server,
         ogs_info("nghttp2_server() [%s]:%d",
                 OGS_ADDR(addr, buf), OGS_PORT(addr));
 
+    if (server->num_of_io_thread)
+        ogs_info("nghttp2_server() I/O threads [%d]",
+                server->num_of_io_thread);
+
     return OGS_OK;
 }
 
@@ -156,6 +273,8 @@ static void server_stop(ogs_sbi_server_t *server)
 {
     ogs_assert(server);
 
+    loop_stop_all(server);
+
     if (server->node.poll)
         ogs_pollset_remove(server->node.poll);
 
@@ -247,8 +366,8 @@ static ssize_t response_read_callback(nghttp2_session *session,
     int rv;
 #endif
 
-    ogs_sbi_response_t *response = NULL;
     ogs_sbi_stream_t *stream = NULL;
+    size_t len;
 
     ogs_assert(session);
 
@@ -258,19 +377,22 @@ static ssize_t response_read_callback(nghttp2_session *session,
         return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
     }
 
-    ogs_assert(source);
-    response = source->ptr;
-    ogs_assert(response);
+    ogs_assert(stream->body.content);
+    ogs_assert(stream->body.offset < stream->body.length);
 
-    ogs_assert(response->http.content);
-    ogs_assert(response->http.content_length);
+    len = ogs_min(stream->body.length - stream->body.offset, length);
 
 #if USE_SEND_DATA_WITH_NO_COPY
+    /* on_send_data() takes [offset - len, offset) */
     *data_flags |= NGHTTP2_DATA_FLAG_NO_COPY;
 #else
-    memcpy(buf, response->http.content, response->http.content_length);
+    memcpy(buf, stream->body.content + stream->body.offset, len);
 #endif
 
+    stream->body.offset += len;
+    if (stream->body.offset < stream->body.length)
+        return len;
+
     *data_flags |= NGHTTP2_DATA_FLAG_EOF;
 
 #if USE_SEND_DATA_WITH_NO_COPY
@@ -284,11 +406,15 @@ static ssize_t response_read_callback(nghttp2_session *session,
     }
 #endif
 
-    return response->http.content_length;
+    return len;
 }
 
-static bool server_send_rspmem_persistent(
-        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
+/*
+ * The stream keeps the response body until nghttp2 has framed it.
+ * If `move` is set, the body is taken from the response without a copy.
+ */
+static bool stream_send_response(ogs_sbi_loop_t *loop,
+        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response, bool move)
 {
     ogs_sbi_session_t *sbi_sess = NULL;
     ogs_sock_t *sock = NULL;
@@ -302,14 +428,25 @@ static bool server_send_rspmem_persistent(
     char srv_version[128];
     char clen[128];
 
+    ogs_assert(loop);
     ogs_assert(response);
 
-    stream = ogs_pool_cycle(&stream_pool, stream);
+    stream = ogs_pool_cycle(&loop->stream_pool, stream);
     if (!stream) {
         ogs_error("stream has already been removed");
         return true;
     }
 
+    if (stream->dispatched) {
+        stream->dispatched = false;
+        if (!stream->session) {
+            ogs_debug("STREAM orphan freed [%d]", stream->stream_id);
+            ogs_list_remove(&loop->orphan_list, stream);
+            stream_free(stream);
+            return true;
+        }
+    }
+
     sbi_sess = stream->session;
     ogs_assert(sbi_sess);
     ogs_assert(sbi_sess->session);
@@ -358,12 +495,30 @@ static bool server_send_rspmem_persistent(
     if (response->http.content && response->http.content_length) {
         nghttp2_data_provider data_prd;
 
-        data_prd.source.ptr = response;
-        data_prd.read_callback = response_read_callback;
+        if (stream->body.content) {
+            ogs_error("response has already been sent [%d]",
+                    stream->stream_id);
+            ogs_free(nva);
+            return false;
+        }
 
         ogs_debug("SENDING...: %d", (int)response->http.content_length);
         ogs_debug("%s", response->http.content);
 
+        if (move) {
+            stream->body.content = response->http.content;
+            response->http.content = NULL;
+        } else {
+            stream->body.content = ogs_memdup(
+                    response->http.content, response->http.content_length);
+            ogs_assert(stream->body.content);
+        }
+        stream->body.length = response->http.content_length;
+        stream->body.offset = 0;
+
+        data_prd.source.ptr = stream;
+        data_prd.read_callback = response_read_callback;
+
         rv = nghttp2_submit_response(sbi_sess->session,
                 stream->stream_id, nva, nvlen, &data_prd);
     } else {
@@ -389,14 +544,61 @@ static bool server_send_rspmem_persistent(
     return true;
 }
 
+static ogs_sbi_response_t *response_copy(ogs_sbi_response_t *response)
+{
+    ogs_sbi_response_t *copy = NULL;
+    ogs_hash_index_t *hi;
+
+    ogs_assert(response);
+
+    copy = ogs_sbi_response_new();
+    ogs_assert(copy);
+
+    copy->status = response->status;
+
+    for (hi = ogs_hash_first(response->http.headers);
+            hi; hi = ogs_hash_next(hi))
+        ogs_sbi_header_set(copy->http.headers,
+                ogs_hash_this_key(hi), ogs_hash_this_val(hi));
+
+    if (response->http.content && response->http.content_length) {
+        copy->http.content = ogs_memdup(
+                response->http.content, response->http.content_length);
+        ogs_assert(copy->http.content);
+        copy->http.content_length = response->http.content_length;
+    }
+
+    return copy;
+}
+
+static bool server_send_rspmem_persistent(
+        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
+{
+    ogs_sbi_loop_t *loop = NULL;
+
+    ogs_assert(response);
+
+    /* The caller keeps the response : the I/O thread gets a copy */
+    loop = loop_find(stream);
+    if (loop)
+        return loop_send_response(loop, stream, response_copy(response));
+
+    return stream_send_response(&main_loop, stream, response, false);
+}
+
 static bool server_send_response(
         ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
 {
+    ogs_sbi_loop_t *loop = NULL;
     bool rc;
 
     ogs_assert(response);
 
-    rc = server_send_rspmem_persistent(stream, response);
+    loop = loop_find(stream);
+    if (loop)
+        return loop_send_response(loop, stream, response);
+
+    rc = stream_send_response(&main_loop, stream, response, true);
 
     ogs_sbi_response_free(response);
 
@@ -405,14 +607,21 @@ static bool server_send_response(
 
 static ogs_sbi_server_t *server_from_stream(ogs_sbi_stream_t *stream)
 {
-    ogs_sbi_session_t *sbi_sess = NULL;
+    ogs_sbi_loop_t *loop = NULL;
 
     ogs_assert(stream);
-    sbi_sess = stream->session;
-    ogs_assert(sbi_sess);
-    ogs_assert(sbi_sess->server);
 
-    return sbi_sess->server;
+    /* The session belongs to the I/O thread */
+    loop = loop_find(stream);
+    if (loop)
+        return loop->server;
+
+    /* An orphan has no session left, but keeps its server */
+    stream = ogs_pool_cycle(&main_loop.stream_pool, stream);
+    ogs_assert(stream);
+    ogs_assert(stream->server);
+
+    return stream->server;
 }
 
 static ogs_sbi_stream_t *stream_add(
@@ -421,8 +630,9 @@ static ogs_sbi_stream_t *stream_add(
     ogs_sbi_stream_t *stream = NULL;
 
     ogs_assert(sbi_sess);
+    ogs_assert(sbi_sess->loop);
 
-    ogs_pool_alloc(&stream_pool, &stream);
+    ogs_pool_alloc(&sbi_sess->loop->stream_pool, &stream);
     ogs_expect_or_return_val(stream, NULL);
     memset(stream, 0, sizeof(ogs_sbi_stream_t));
 
@@ -432,7 +642,9 @@ static ogs_sbi_stream_t *stream_add(
     stream->stream_id = stream_id;
     sbi_sess->last_stream_id = stream_id;
 
+    stream->server = sbi_sess->server;
     stream->session = sbi_sess;
+    stream->loop = sbi_sess->loop;
 
     ogs_list_add(&sbi_sess->stream_list, stream);
 
@@ -449,10 +661,28 @@ static void stream_remove(ogs_sbi_stream_t *stream)
 
     ogs_list_remove(&sbi_sess->stream_list, stream);
 
+    if (stream->dispatched) {
+        /* The NF still uses the request : free it on the response */
+        stream->session = NULL;
+        ogs_list_add(&stream->loop->orphan_list, stream);
+        return;
+    }
+
+    stream_free(stream);
+}
+
+static void stream_free(ogs_sbi_stream_t *stream)
+{
+    ogs_assert(stream);
+    ogs_assert(stream->loop);
+
     ogs_assert(stream->request);
     ogs_sbi_request_free(stream->request);
 
-    ogs_pool_free(&stream_pool, stream);
+    if (stream->body.content)
+        ogs_free(stream->body.content);
+
+    ogs_pool_free(&stream->loop->stream_pool, stream);
 }
 
 static void stream_remove_all(ogs_sbi_session_t *sbi_sess)
@@ -465,40 +695,54 @@ static void stream_remove_all(ogs_sbi_session_t *sbi_sess)
         stream_remove(stream);
 }
 
-static ogs_sbi_session_t *session_add(
+/* The NF thread keeps the sessions of each server apart */
+static ogs_list_t *session_list(ogs_sbi_session_t *sbi_sess)
+{
+    ogs_assert(sbi_sess);
+    ogs_assert(sbi_sess->loop);
+
+    if (sbi_sess->loop == &main_loop)
+        return &sbi_sess->server->session_list;
+
+    return &sbi_sess->loop->session_list;
+}
+
+static ogs_sbi_session_t *session_add(ogs_sbi_loop_t *loop,
         ogs_sbi_server_t *server, ogs_sock_t *sock)
 {
     ogs_sbi_session_t *sbi_sess = NULL;
 
+    ogs_assert(loop);
     ogs_assert(server);
     ogs_assert(sock);
 
-    ogs_pool_alloc(&session_pool, &sbi_sess);
+    ogs_pool_alloc(&loop->session_pool, &sbi_sess);
     ogs_expect_or_return_val(sbi_sess, NULL);
     memset(sbi_sess, 0, sizeof(ogs_sbi_session_t));
 
     sbi_sess->server = server;
+    sbi_sess->loop = loop;
     sbi_sess->sock = sock;
 
     sbi_sess->addr = ogs_calloc(1, sizeof(ogs_sockaddr_t));
     ogs_expect_or_return_val(sbi_sess->addr, NULL);
     memcpy(sbi_sess->addr, &sock->remote_addr, sizeof(ogs_sockaddr_t));
 
-    ogs_list_add(&server->session_list, sbi_sess);
+    ogs_list_add(session_list(sbi_sess), sbi_sess);
 
     return sbi_sess;
 }
 
 static void session_remove(ogs_sbi_session_t *sbi_sess)
 {
-    ogs_sbi_server_t *server = NULL;
-    ogs_pkbuf_t *pkbuf = NULL, *next_pkbuf = NULL;
+    ogs_sbi_loop_t *loop = NULL;
+    ogs_sbi_output_t *output = NULL, *next_output = NULL;
 
     ogs_assert(sbi_sess);
-    server = sbi_sess->server;
-    ogs_assert(server);
+    loop = sbi_sess->loop;
+    ogs_assert(loop);
 
-    ogs_list_remove(&server->session_list, sbi_sess);
+    ogs_list_remove(session_list(sbi_sess), sbi_sess);
 
     stream_remove_all(sbi_sess);
     nghttp2_session_del(sbi_sess->session);
@@ -509,10 +753,8 @@ static void session_remove(ogs_sbi_session_t *sbi_sess)
     if (sbi_sess->poll.write)
         ogs_pollset_remove(sbi_sess->poll.write);
 
-    ogs_list_for_each_safe(&sbi_sess->write_queue, next_pkbuf, pkbuf) {
-        ogs_list_remove(&sbi_sess->write_queue, pkbuf);
-        ogs_pkbuf_free(pkbuf);
-    }
+    ogs_list_for_each_safe(&sbi_sess->write_queue, next_output, output)
+        output_remove(sbi_sess, output);
 
     ogs_assert(sbi_sess->addr);
     ogs_free(sbi_sess->addr);
@@ -520,7 +762,7 @@ static void session_remove(ogs_sbi_session_t *sbi_sess)
     ogs_assert(sbi_sess->sock);
     ogs_sock_destroy(sbi_sess->sock);
 
-    ogs_pool_free(&session_pool, sbi_sess);
+    ogs_pool_free(&loop->session_pool, sbi_sess);
 }
 
 static void session_remove_all(ogs_sbi_server_t *server)
@@ -533,19 +775,17 @@ static void session_remove_all(ogs_sbi_server_t *server)
         session_remove(sbi_sess);
 }
 
-static void accept_handler(short when, ogs_socket_t fd, void *data)
+static void session_accept(ogs_sbi_loop_t *loop,
+        ogs_sbi_server_t *server, ogs_sock_t *sock)
 {
-    ogs_sbi_server_t *server = data;
     ogs_sbi_session_t *sbi_sess = NULL;
-    ogs_sock_t *sock = NULL;
     ogs_sock_t *new = NULL;
 
     int on;
 
-    ogs_assert(data);
-    ogs_assert(fd != INVALID_SOCKET);
-
-    sock = server->node.sock;
+    ogs_assert(loop);
+    ogs_assert(server);
+    ogs_assert(sock);
 
     new = ogs_sock_accept(sock);
     if (!new) {
@@ -562,11 +802,11 @@ static void accept_handler(short when, ogs_socket_t fd, void *data)
         return;
     }
 
-    sbi_sess = session_add(server, new);
+    sbi_sess = session_add(loop, server, new);
     ogs_assert(sbi_sess);
 
-    sbi_sess->poll.read = ogs_pollset_add(ogs_app()->pollset,
-        OGS_POLLIN, new->fd, recv_handler, sbi_sess);
+    sbi_sess->poll.read = ogs_pollset_add(loop->pollset,
+        OGS_POLLIN|OGS_POLLET, new->fd, recv_handler, sbi_sess);
     ogs_assert(sbi_sess->poll.read);
 
     if (session_set_callbacks(sbi_sess) != OGS_OK ||
@@ -576,6 +816,27 @@ static void accept_handler(short when, ogs_socket_t fd, void *data)
     }
 }
 
+static void accept_handler(short when, ogs_socket_t fd, void *data)
+{
+    ogs_sbi_server_t *server = data;
+
+    ogs_assert(server);
+    ogs_assert(fd != INVALID_SOCKET);
+
+    session_accept(&main_loop, server, server->node.sock);
+}
+
+static void loop_accept_handler(short when, ogs_socket_t fd, void *data)
+{
+    ogs_sbi_loop_t *loop = data;
+
+    ogs_assert(loop);
+    ogs_assert(fd != INVALID_SOCKET);
+
+    session_accept(loop, loop->server, loop->sock);
+}
+
+/* Edge-triggered : reads until the socket is drained */
 static void recv_handler(short when, ogs_socket_t fd, void *data)
 {
     char buf[OGS_ADDRSTRLEN];
@@ -594,30 +855,45 @@ static void recv_handler(short when, ogs_socket_t fd, void *data)
     pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
     ogs_assert(pkbuf);
 
-    n = ogs_recv(fd, pkbuf->data, OGS_MAX_SDU_LEN, 0);
-    if (n > 0) {
-        ogs_pkbuf_put(pkbuf, n);
+    for ( ;; ) {
+        n = ogs_recv(fd, pkbuf->data, OGS_MAX_SDU_LEN, 0);
+        if (n < 0 && errno == OGS_EAGAIN)
+            break;
+
+        if (n <= 0) {
+            if (n < 0) {
+                if (errno != OGS_ECONNRESET)
+                    ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                                    "lost connection [%s]:%d",
+                                    OGS_ADDR(addr, buf), OGS_PORT(addr));
+            } else if (n == 0) {
+                ogs_debug("connection closed [%s]:%d",
+                            OGS_ADDR(addr, buf), OGS_PORT(addr));
+            }
+
+            session_remove(sbi_sess);
+            break;
+        }
 
         ogs_assert(sbi_sess->session);
-        readlen = nghttp2_session_mem_recv(
-                sbi_sess->session, pkbuf->data, pkbuf->len);
+        readlen = nghttp2_session_mem_recv(sbi_sess->session, pkbuf->data, n);
         if (readlen < 0) {
             ogs_error("nghttp2_session_mem_recv() failed (%d:%s)",
                         (int)readlen, nghttp2_strerror((int)readlen));
             session_remove(sbi_sess);
-        }
-    } else {
-        if (n < 0) {
-            if (errno != OGS_ECONNRESET)
-                ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                                "lost connection [%s]:%d",
-                                OGS_ADDR(addr, buf), OGS_PORT(addr));
-        } else if (n == 0) {
-            ogs_debug("connection closed [%s]:%d",
-                        OGS_ADDR(addr, buf), OGS_PORT(addr));
+            break;
+        } else if (nghttp2_session_want_write(sbi_sess->session)) {
+            /* e.g. RST_STREAM for a request the NF cannot take */
+            if (session_send(sbi_sess) != OGS_OK) {
+                ogs_error("session_send() failed");
+                session_remove(sbi_sess);
+                break;
+            }
         }
 
-        session_remove(sbi_sess);
+        /* A short read has taken all there was */
+        if (n < OGS_MAX_SDU_LEN)
+            break;
     }
 
     ogs_pkbuf_free(pkbuf);
@@ -799,6 +1075,21 @@ static int on_frame_recv(nghttp2_session *session,
                 ogs_debug("%s", request->http.content);
             }
 
+            if (sbi_sess->loop != &main_loop) {
+                if (loop_dispatch(sbi_sess->loop, stream) != OGS_OK)
+                    nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE,
+                            stream->stream_id, NGHTTP2_REFUSED_STREAM);
+                break;
+            }
+
+            /*
+             * The NF may answer later, e.g. after a DB job or another
+             * SBI request. If the peer resets the stream meanwhile, it
+             * is kept as an orphan so that the late response does not
+             * reach a stream reused for another request.
+             */
+            stream->dispatched = true;
+
             if (server->cb(request, stream) != OGS_OK) {
                 ogs_warn("server callback error");
                 ogs_assert(true ==
@@ -1135,10 +1426,10 @@ static int on_send_data(nghttp2_session *session, nghttp2_frame *frame,
 {
     ogs_sbi_session_t *sbi_sess = user_data;
 
-    ogs_sbi_response_t *response = NULL;
     ogs_sbi_stream_t *stream = NULL;
-    ogs_pkbuf_t *pkbuf = NULL;
+    uint8_t *data = NULL;
     size_t padlen = 0;
+    uint8_t pad[256];
 
     ogs_assert(session);
     ogs_assert(frame);
@@ -1151,35 +1442,35 @@ static int on_send_data(nghttp2_session *session, nghttp2_frame *frame,
 
     ogs_assert(sbi_sess);
 
-    ogs_assert(source);
-    response = source->ptr;
-    ogs_assert(response);
-
-    ogs_assert(response->http.content);
-    ogs_assert(response->http.content_length);
+    ogs_assert(stream->body.content);
+    ogs_assert(stream->body.offset >= length);
 
     ogs_assert(framehd);
     ogs_assert(length);
 
-    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_put_data(pkbuf, framehd, 9);
+    session_write_data(sbi_sess, framehd, 9);
 
     padlen = frame->data.padlen;
 
     if (padlen > 0) {
-        ogs_pkbuf_put_u8(pkbuf, padlen-1);
+        pad[0] = padlen-1;
+        session_write_data(sbi_sess, pad, 1);
     }
 
-    ogs_pkbuf_put_data(pkbuf,
-            response->http.content, response->http.content_length);
+    data = (uint8_t *)stream->body.content + stream->body.offset - length;
 
-    if (padlen > 0) {
-        memset(pkbuf->tail, 0, padlen-1);
-        ogs_pkbuf_put(pkbuf, padlen-1);
+    if (stream->body.offset == stream->body.length) {
+        /* The last chunk : the queue takes the body */
+        session_write_content(sbi_sess, stream->body.content, data, length);
+        stream->body.content = NULL;
+    } else {
+        session_write_data(sbi_sess, data, length);
     }
 
-    session_write_to_buffer(sbi_sess, pkbuf);
+    if (padlen > 1) {
+        memset(pad, 0, padlen-1);
+        session_write_data(sbi_sess, pad, padlen-1);
+    }
 
     return 0;
 }
@@ -1191,8 +1482,6 @@ static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
     ogs_sock_t *sock = NULL;
     ogs_socket_t fd = INVALID_SOCKET;
 
-    ogs_pkbuf_t *pkbuf = NULL;
-
     ogs_assert(sbi_sess);
     sock = sbi_sess->sock;
     ogs_assert(sock);
@@ -1202,11 +1491,7 @@ static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
     ogs_assert(data);
     ogs_assert(length);
 
-    pkbuf = ogs_pkbuf_alloc(NULL, length);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_put_data(pkbuf, data, length);
-
-    session_write_to_buffer(sbi_sess, pkbuf);
+    session_write_data(sbi_sess, data, length);
 
     return length;
 }
@@ -1214,9 +1499,7 @@ static ssize_t send_callback(nghttp2_session *session, const uint8_t *data,
 
 static int session_send(ogs_sbi_session_t *sbi_sess)
 {
-#if USE_SEND_DATA_WITH_NO_COPY
-    ogs_pkbuf_t *pkbuf = NULL;
-#else
+#if !USE_SEND_DATA_WITH_NO_COPY
     int rv;
 #endif
 
@@ -1239,11 +1522,7 @@ static int session_send(ogs_sbi_session_t *sbi_sess)
             break;
         }
 
-        pkbuf = ogs_pkbuf_alloc(NULL, data_len);
-        ogs_assert(pkbuf);
-        ogs_pkbuf_put_data(pkbuf, data, data_len);
-
-        session_write_to_buffer(sbi_sess, pkbuf);
+        session_write_data(sbi_sess, data, data_len);
     }
 #else
     rv = nghttp2_session_send(sbi_sess->session);
@@ -1254,40 +1533,100 @@ static int session_send(ogs_sbi_session_t *sbi_sess)
     }
 #endif
 
+    session_flush(sbi_sess);
+
     return OGS_OK;
 }
 
 static void session_write_callback(short when, ogs_socket_t fd, void *data)
 {
     ogs_sbi_session_t *sbi_sess = data;
-    ogs_pkbuf_t *pkbuf = NULL;
 
     ogs_assert(sbi_sess);
 
-    if (ogs_list_empty(&sbi_sess->write_queue) == true) {
-        ogs_assert(sbi_sess->poll.write);
-        ogs_pollset_remove(sbi_sess->poll.write);
-        sbi_sess->poll.write = NULL;
-        return;
+    session_flush(sbi_sess);
+}
+
+static ogs_sbi_output_t *output_add(ogs_sbi_session_t *sbi_sess)
+{
+    ogs_sbi_output_t *output = NULL;
+
+    ogs_assert(sbi_sess);
+
+    output = ogs_calloc(1, sizeof(*output));
+    ogs_assert(output);
+
+    ogs_list_add(&sbi_sess->write_queue, output);
+
+    return output;
+}
+
+static void output_remove(ogs_sbi_session_t *sbi_sess,
+        ogs_sbi_output_t *output)
+{
+    ogs_assert(sbi_sess);
+    ogs_assert(output);
+
+    ogs_list_remove(&sbi_sess->write_queue, output);
+
+    if (output->pkbuf)
+        ogs_pkbuf_free(output->pkbuf);
+    if (output->content)
+        ogs_free(output->content);
+
+    ogs_free(output);
+}
+
+static void session_write_data(
+        ogs_sbi_session_t *sbi_sess, const void *data, size_t len)
+{
+    ogs_sbi_output_t *output = NULL;
+
+    ogs_assert(sbi_sess);
+    ogs_assert(data);
+    ogs_assert(len);
+
+    /* Append to the last buffer if it has room */
+    output = ogs_list_last(&sbi_sess->write_queue);
+    if (!output || !output->pkbuf ||
+        ogs_pkbuf_tailroom(output->pkbuf) < len) {
+        output = output_add(sbi_sess);
+        output->pkbuf = ogs_pkbuf_alloc(NULL, ogs_max(len, OGS_MAX_SDU_LEN));
+        ogs_assert(output->pkbuf);
     }
 
-    pkbuf = ogs_list_first(&sbi_sess->write_queue);
-    ogs_assert(pkbuf);
-    ogs_list_remove(&sbi_sess->write_queue, pkbuf);
+    ogs_pkbuf_put_data(output->pkbuf, data, len);
+}
 
-    ogs_send(fd, pkbuf->data, pkbuf->len, 0);
-    ogs_log_hexdump(OGS_LOG_DEBUG, pkbuf->data, pkbuf->len);
+static void session_write_content(ogs_sbi_session_t *sbi_sess,
+        char *content, uint8_t *data, size_t len)
+{
+    ogs_sbi_output_t *output = NULL;
 
-    ogs_pkbuf_free(pkbuf);
+    ogs_assert(content);
+    ogs_assert(data);
+    ogs_assert(len);
+
+    output = output_add(sbi_sess);
+
+    output->content = content;
+    output->data = data;
+    output->len = len;
 }
 
-static void session_write_to_buffer(
-        ogs_sbi_session_t *sbi_sess, ogs_pkbuf_t *pkbuf)
+/*
+ * Writes as much of the queue as the socket takes with writev().
+ * POLLOUT is only armed while some of it is left.
+ */
+static void session_flush(ogs_sbi_session_t *sbi_sess)
 {
     ogs_sock_t *sock = NULL;
     ogs_socket_t fd = INVALID_SOCKET;
 
-    ogs_assert(pkbuf);
+    ogs_sbi_output_t *output = NULL, *next_output = NULL;
+    struct iovec iov[MAX_NUM_OF_IOV];
+    ssize_t sent;
+    int i;
 
     ogs_assert(sbi_sess);
     sock = sbi_sess->sock;
@@ -1295,11 +1634,371 @@ static void session_write_to_buffer(
     fd = sock->fd;
     ogs_assert(fd != INVALID_SOCKET);
 
-    ogs_list_add(&sbi_sess->write_queue, pkbuf);
+    while (ogs_list_first(&sbi_sess->write_queue)) {
+        i = 0;
+        ogs_list_for_each(&sbi_sess->write_queue, output) {
+            if (i == MAX_NUM_OF_IOV)
+                break;
+
+            if (output->pkbuf) {
+                iov[i].iov_base = output->pkbuf->data;
+                iov[i].iov_len = output->pkbuf->len;
+            } else {
+                iov[i].iov_base = output->data;
+                iov[i].iov_len = output->len;
+            }
+            i++;
+        }
+
+        sent = writev(fd, iov, i);
+        if (sent < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == OGS_EAGAIN)
+                break;
+
+            /* recv_handler() will remove the session */
+            ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                    "writev() failed");
+            ogs_list_for_each_safe(
+                    &sbi_sess->write_queue, next_output, output)
+                output_remove(sbi_sess, output);
+            break;
+        }
+
+        ogs_list_for_each_safe(&sbi_sess->write_queue, next_output, output) {
+            size_t len = output->pkbuf ? output->pkbuf->len : output->len;
+
+            if (sent == 0)
+                break;
+
+            if ((size_t)sent < len) {
+                if (output->pkbuf) {
+                    ogs_pkbuf_pull(output->pkbuf, sent);
+                } else {
+                    output->data += sent;
+                    output->len -= sent;
+                }
+                sent = 0;
+                break;
+            }
+
+            sent -= len;
+            output_remove(sbi_sess, output);
+        }
+
+        if (ogs_list_first(&sbi_sess->write_queue) && i < MAX_NUM_OF_IOV)
+            break; /* Short write : the socket is full */
+    }
+
+    if (ogs_list_first(&sbi_sess->write_queue)) {
+        if (!sbi_sess->poll.write) {
+            sbi_sess->poll.write = ogs_pollset_add(sbi_sess->loop->pollset,
+                OGS_POLLOUT|OGS_POLLET, fd, session_write_callback, sbi_sess);
+            ogs_assert(sbi_sess->poll.write);
+        }
+    } else {
+        if (sbi_sess->poll.write) {
+            ogs_pollset_remove(sbi_sess->poll.write);
+            sbi_sess->poll.write = NULL;
+        }
+    }
+}
+
+/* Runs on the NF thread : pass the decoded requests to the server callback */
+static void request_handler(short when, ogs_socket_t fd, void *data)
+{
+    ogs_sbi_loop_t *loop = data;
+    ogs_sbi_server_t *server = NULL;
+    ogs_sbi_stream_t *stream = NULL;
+    char buf[64];
+    int rv;
+
+    ogs_assert(loop);
+    server = loop->server;
+    ogs_assert(server);
+    ogs_assert(server->cb);
+
+    /* Drain before popping : a request pushed after this wakes us again */
+    while (ogs_recv(fd, buf, sizeof(buf), 0) > 0);
+
+    for ( ;; ) {
+        rv = ogs_queue_trypop(loop->request.queue, (void **)&stream);
+        ogs_assert(rv != OGS_ERROR);
+
+        if (rv != OGS_OK)
+            break;
+
+        ogs_assert(stream);
+        ogs_assert(stream->request);
+
+        if (server->cb(stream->request, stream) != OGS_OK) {
+            ogs_warn("server callback error");
+            ogs_assert(true ==
+                ogs_sbi_server_send_error(stream,
+                    OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR, NULL,
+                    "server callback error", NULL));
+        }
+    }
+}
+
+/* Runs on the I/O thread */
+static int loop_dispatch(ogs_sbi_loop_t *loop, ogs_sbi_stream_t *stream)
+{
+    char c = 0;
+    int rv;
+
+    ogs_assert(loop);
+    ogs_assert(stream);
+
+    stream->dispatched = true;
+
+    rv = ogs_queue_trypush(loop->request.queue, stream);
+    if (rv != OGS_OK) {
+        ogs_warn("ogs_queue_trypush() failed:%d", rv);
+        stream->dispatched = false;
+        return OGS_ERROR;
+    }
+
+    /*
+     * Always wake the NF thread. The queue size is not read under the
+     * queue lock, so waking only on the first request could miss one.
+     * A full pipe (EAGAIN) already has a wakeup pending.
+     */
+    if (ogs_send(loop->request.fd[1], &c, 1, 0) < 0 && errno != OGS_EAGAIN)
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "ogs_send() failed");
+
+    return OGS_OK;
+}
+
+/* Runs on the NF thread */
+static bool loop_send_response(ogs_sbi_loop_t *loop,
+        ogs_sbi_stream_t *stream, ogs_sbi_response_t *response)
+{
+    ogs_sbi_reply_t *reply = NULL;
+    int rv;
+
+    ogs_assert(loop);
+    ogs_assert(stream);
+    ogs_assert(response);
+
+    reply = ogs_calloc(1, sizeof(*reply));
+    ogs_assert(reply);
+
+    reply->stream = stream;
+    reply->response = response;
+
+    rv = ogs_queue_push(loop->response_queue, reply);
+    if (rv != OGS_OK) {
+        ogs_error("ogs_queue_push() failed:%d", rv);
+        ogs_sbi_response_free(response);
+        ogs_free(reply);
+        return false;
+    }
+
+    /* Wakeups coalesce in the pollset. See loop_dispatch() */
+    ogs_pollset_notify(loop->pollset);
+
+    return true;
+}
+
+static void loop_main(void *data)
+{
+    ogs_sbi_loop_t *loop = data;
+    ogs_sbi_reply_t *reply = NULL;
+    int rv;
+
+    ogs_assert(loop);
+
+    for ( ;; ) {
+        ogs_pollset_poll(loop->pollset, OGS_INFINITE_TIME);
+
+        for ( ;; ) {
+            rv = ogs_queue_trypop(loop->response_queue, (void **)&reply);
+            ogs_assert(rv != OGS_ERROR);
+
+            if (rv != OGS_OK)
+                break;
+
+            /* NULL is pushed by loop_stop() */
+            if (!reply)
+                return;
+
+            stream_send_response(loop, reply->stream, reply->response, true);
+
+            ogs_sbi_response_free(reply->response);
+            ogs_free(reply);
+        }
+    }
+}
+
+static int loop_start(ogs_sbi_loop_t *loop,
+        ogs_sbi_server_t *server, ogs_sockopt_t *option)
+{
+    int rv;
+
+    ogs_assert(loop);
+    ogs_assert(server);
+    ogs_assert(option);
+
+    loop->server = server;
+
+    loop->sock = ogs_tcp_server(server->node.addr, option);
+    if (!loop->sock)
+        return OGS_ERROR;
+
+    loop->pollset = ogs_pollset_create(ogs_app()->pool.socket);
+    ogs_assert(loop->pollset);
+
+    ogs_list_init(&loop->session_list);
+    ogs_list_init(&loop->orphan_list);
+
+    ogs_pool_init(&loop->session_pool, pool_size.session);
+    ogs_pool_init(&loop->stream_pool, pool_size.stream);
 
-    if (!sbi_sess->poll.write) {
-        sbi_sess->poll.write = ogs_pollset_add(ogs_app()->pollset,
-            OGS_POLLOUT, fd, session_write_callback, sbi_sess);
-        ogs_assert(sbi_sess->poll.write);
+    loop->request.queue = ogs_queue_create(pool_size.stream);
+    ogs_assert(loop->request.queue);
+    loop->response_queue = ogs_queue_create(pool_size.stream + 1);
+    ogs_assert(loop->response_queue);
+
+    rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, loop->request.fd);
+    ogs_assert(rv == OGS_OK);
+    rv = ogs_nonblocking(loop->request.fd[1]);
+    ogs_assert(rv == OGS_OK);
+
+    loop->request.poll = ogs_pollset_add(ogs_app()->pollset,
+            OGS_POLLIN, loop->request.fd[0], request_handler, loop);
+    ogs_assert(loop->request.poll);
+
+    loop->poll = ogs_pollset_add(loop->pollset,
+            OGS_POLLIN, loop->sock->fd, loop_accept_handler, loop);
+    ogs_assert(loop->poll);
+
+    loop->thread = ogs_thread_create(loop_main, loop);
+    ogs_assert(loop->thread);
+
+    return OGS_OK;
+}
+
+static void loop_stop(ogs_sbi_loop_t *loop)
+{
+    ogs_sbi_session_t *sbi_sess = NULL, *next_sbi_sess = NULL;
+    ogs_sbi_stream_t *stream = NULL, *next_stream = NULL;
+    ogs_sbi_reply_t *reply = NULL;
+
+    ogs_assert(loop);
+
+    if (!loop->sock)
+        return;
+
+    ogs_assert(OGS_OK == ogs_queue_push(loop->response_queue, NULL));
+    ogs_pollset_notify(loop->pollset);
+    ogs_thread_destroy(loop->thread);
+
+    /* The thread has exited : its sessions are ours now */
+    while (ogs_queue_trypop(loop->response_queue, (void **)&reply) == OGS_OK) {
+        if (reply) {
+            ogs_sbi_response_free(reply->response);
+            ogs_free(reply);
+        }
     }
+
+    ogs_list_for_each_safe(&loop->session_list, next_sbi_sess, sbi_sess)
+        session_remove(sbi_sess);
+
+    ogs_list_for_each_safe(&loop->orphan_list, next_stream, stream) {
+        ogs_list_remove(&loop->orphan_list, stream);
+        stream_free(stream);
+    }
+
+    ogs_pollset_remove(loop->poll);
+    ogs_sock_destroy(loop->sock);
+
+    ogs_pollset_remove(loop->request.poll);
+    ogs_closesocket(loop->request.fd[0]);
+    ogs_closesocket(loop->request.fd[1]);
+
+    ogs_queue_destroy(loop->request.queue);
+    ogs_queue_destroy(loop->response_queue);
+
+    ogs_pool_final(&loop->stream_pool);
+    ogs_pool_final(&loop->session_pool);
+
+    ogs_pollset_destroy(loop->pollset);
+
+    memset(loop, 0, sizeof(*loop));
+}
+
+static int loop_start_all(ogs_sbi_server_t *server)
+{
+    ogs_sbi_loop_t *loop = NULL;
+    ogs_sockopt_t option;
+    int i;
+
+    ogs_assert(server);
+    ogs_assert(server->num_of_io_thread > 0);
+
+    ogs_sockopt_init(&option);
+    if (server->node.option)
+        memcpy(&option, server->node.option, sizeof option);
+    option.so_reuseport = true;
+
+    loop = ogs_calloc(server->num_of_io_thread, sizeof(ogs_sbi_loop_t));
+    ogs_assert(loop);
+    server->loop = loop;
+
+    for (i = 0; i < server->num_of_io_thread; i++) {
+        if (loop_start(&loop[i], server, &option) != OGS_OK)
+            return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+static void loop_stop_all(ogs_sbi_server_t *server)
+{
+    ogs_sbi_loop_t *loop = NULL;
+    int i;
+
+    ogs_assert(server);
+
+    loop = server->loop;
+    if (!loop)
+        return;
+
+    for (i = 0; i < server->num_of_io_thread; i++)
+        loop_stop(&loop[i]);
+
+    ogs_free(loop);
+    server->loop = NULL;
+}
+
+/*
+ * Finds the I/O thread owning the stream from its address in the pool.
+ * The stream itself may only be touched by that thread.
+ */
+static ogs_sbi_loop_t *loop_find(ogs_sbi_stream_t *stream)
+{
+    ogs_sbi_server_t *server = NULL;
+    ogs_sbi_loop_t *loop = NULL;
+    int i;
+
+    ogs_assert(stream);
+
+    ogs_list_for_each(&ogs_sbi_self()->server_list, server) {
+        if (!server->loop)
+            continue;
+
+        for (i = 0; i < server->num_of_io_thread; i++) {
+            loop = (ogs_sbi_loop_t *)server->loop + i;
+            if (!loop->sock)
+                continue;
+
+            if (stream >= loop->stream_pool.array &&
+                stream < loop->stream_pool.array + loop->stream_pool.size)
+                return loop;
+        }
+    }
+
+    return NULL;
 }
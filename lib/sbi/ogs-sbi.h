@@ -22,6 +22,7 @@
 
 #include "crypt/ogs-crypt.h"
 #include "app/ogs-app.h"
+#include "metrics/ogs-metrics.h"
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
@@ -0,0 +1,52 @@
+#ifndef OGS_SBI_JSON_WRITER_H
+#define OGS_SBI_JSON_WRITER_H
+
+#include "../external/cJSON.h"
+#include "ogs-core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Writes compact JSON straight into one growing buffer, without building
+ * a cJSON tree. The output is the same as cJSON_PrintUnformatted().
+ *
+ * A NULL key writes an array element or the top-level value.
+ */
+typedef struct OpenAPI_json_writer_s {
+    char *buf;
+    size_t len;
+    size_t size;
+    bool comma;
+} OpenAPI_json_writer_t;
+
+void OpenAPI_json_writer_init(OpenAPI_json_writer_t *writer);
+/* Returns the JSON text and hands it over to the caller */
+char *OpenAPI_json_writer_finish(OpenAPI_json_writer_t *writer);
+void OpenAPI_json_writer_clear(OpenAPI_json_writer_t *writer);
+
+bool OpenAPI_json_write_object_start(
+        OpenAPI_json_writer_t *writer, const char *key);
+bool OpenAPI_json_write_object_end(OpenAPI_json_writer_t *writer);
+bool OpenAPI_json_write_array_start(
+        OpenAPI_json_writer_t *writer, const char *key);
+bool OpenAPI_json_write_array_end(OpenAPI_json_writer_t *writer);
+
+/* A NULL value fails, as cJSON_AddStringToObject() does */
+bool OpenAPI_json_write_string(
+        OpenAPI_json_writer_t *writer, const char *key, const char *value);
+bool OpenAPI_json_write_number(
+        OpenAPI_json_writer_t *writer, const char *key, double value);
+bool OpenAPI_json_write_bool(
+        OpenAPI_json_writer_t *writer, const char *key, bool value);
+bool OpenAPI_json_write_null(OpenAPI_json_writer_t *writer, const char *key);
+/* For values that are still kept as a cJSON tree */
+bool OpenAPI_json_write_item(
+        OpenAPI_json_writer_t *writer, const char *key, const cJSON *item);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OGS_SBI_JSON_WRITER_H
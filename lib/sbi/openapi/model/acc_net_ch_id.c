@@ -77,6 +77,59 @@ end:
     return item;
 }
 
+bool OpenAPI_acc_net_ch_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acc_net_ch_id_t *acc_net_ch_id)
+{
+    if (acc_net_ch_id == NULL) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [AccNetChId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [AccNetChId]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "accNetChaIdValue", acc_net_ch_id->acc_net_cha_id_value) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [acc_net_cha_id_value]");
+        goto end;
+    }
+
+    if (acc_net_ch_id->ref_pcc_rule_ids) {
+    if (OpenAPI_json_write_array_start(writer, "refPccRuleIds") == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_pcc_rule_ids_node;
+    OpenAPI_list_for_each(acc_net_ch_id->ref_pcc_rule_ids, ref_pcc_rule_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_pcc_rule_ids_node->data) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+    }
+
+    if (acc_net_ch_id->is_session_ch_scope) {
+    if (OpenAPI_json_write_bool(writer, "sessionChScope", acc_net_ch_id->session_ch_scope) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [session_ch_scope]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acc_net_ch_id_writeJSON() failed [AccNetChId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_acc_net_ch_id_t *OpenAPI_acc_net_ch_id_parseFromJSON(cJSON *acc_net_ch_idJSON)
 {
     OpenAPI_acc_net_ch_id_t *acc_net_ch_id_local_var = NULL;
@@ -136,7 +189,6 @@ end:
 OpenAPI_acc_net_ch_id_t *OpenAPI_acc_net_ch_id_copy(OpenAPI_acc_net_ch_id_t *dst, OpenAPI_acc_net_ch_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acc_net_ch_id_convertToJSON(src);
@@ -145,21 +197,6 @@ OpenAPI_acc_net_ch_id_t *OpenAPI_acc_net_ch_id_copy(OpenAPI_acc_net_ch_id_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acc_net_ch_id_free(dst);
     dst = OpenAPI_acc_net_ch_id_parseFromJSON(item);
     cJSON_Delete(item);
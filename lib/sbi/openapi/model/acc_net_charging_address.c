@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_acc_net_charging_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acc_net_charging_address_t *acc_net_charging_address)
+{
+    if (acc_net_charging_address == NULL) {
+        ogs_error("OpenAPI_acc_net_charging_address_writeJSON() failed [AccNetChargingAddress]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_acc_net_charging_address_writeJSON() failed [AccNetChargingAddress]");
+        return false;
+    }
+    if (acc_net_charging_address->an_charg_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "anChargIpv4Addr", acc_net_charging_address->an_charg_ipv4_addr) == false) {
+        ogs_error("OpenAPI_acc_net_charging_address_writeJSON() failed [an_charg_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (acc_net_charging_address->an_charg_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "anChargIpv6Addr", acc_net_charging_address->an_charg_ipv6_addr) == false) {
+        ogs_error("OpenAPI_acc_net_charging_address_writeJSON() failed [an_charg_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acc_net_charging_address_writeJSON() failed [AccNetChargingAddress]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_parseFromJSON(cJSON *acc_net_charging_addressJSON)
 {
     OpenAPI_acc_net_charging_address_t *acc_net_charging_address_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_copy(OpenAPI_acc_net_charging_address_t *dst, OpenAPI_acc_net_charging_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acc_net_charging_address_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acc_net_charging_address_free(dst);
     dst = OpenAPI_acc_net_charging_address_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_create(
 void OpenAPI_acc_net_charging_address_free(OpenAPI_acc_net_charging_address_t *acc_net_charging_address);
 OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_parseFromJSON(cJSON *acc_net_charging_addressJSON);
 cJSON *OpenAPI_acc_net_charging_address_convertToJSON(OpenAPI_acc_net_charging_address_t *acc_net_charging_address);
+bool OpenAPI_acc_net_charging_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acc_net_charging_address_t *acc_net_charging_address);
 OpenAPI_acc_net_charging_address_t *OpenAPI_acc_net_charging_address_copy(OpenAPI_acc_net_charging_address_t *dst, OpenAPI_acc_net_charging_address_t *src);
 
 #ifdef __cplusplus
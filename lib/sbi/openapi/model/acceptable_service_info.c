@@ -89,6 +89,65 @@ end:
     return item;
 }
 
+bool OpenAPI_acceptable_service_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acceptable_service_info_t *acceptable_service_info)
+{
+    if (acceptable_service_info == NULL) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [AcceptableServiceInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [AcceptableServiceInfo]");
+        return false;
+    }
+    if (acceptable_service_info->acc_bw_med_comps) {
+    if (OpenAPI_json_write_object_start(writer, "accBwMedComps") == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [acc_bw_med_comps]");
+        goto end;
+    }
+    OpenAPI_lnode_t *acc_bw_med_comps_node;
+    if (acceptable_service_info->acc_bw_med_comps) {
+        OpenAPI_list_for_each(acceptable_service_info->acc_bw_med_comps, acc_bw_med_comps_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)acc_bw_med_comps_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_media_component_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [acc_bw_med_comps]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [acc_bw_med_comps]");
+        goto end;
+    }
+    }
+
+    if (acceptable_service_info->mar_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "marBwUl", acceptable_service_info->mar_bw_ul) == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [mar_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (acceptable_service_info->mar_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "marBwDl", acceptable_service_info->mar_bw_dl) == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [mar_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acceptable_service_info_writeJSON() failed [AcceptableServiceInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_parseFromJSON(cJSON *acceptable_service_infoJSON)
 {
     OpenAPI_acceptable_service_info_t *acceptable_service_info_local_var = NULL;
@@ -150,7 +209,6 @@ end:
 OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_copy(OpenAPI_acceptable_service_info_t *dst, OpenAPI_acceptable_service_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acceptable_service_info_convertToJSON(src);
@@ -159,21 +217,6 @@ OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acceptable_service_info_free(dst);
     dst = OpenAPI_acceptable_service_info_parseFromJSON(item);
     cJSON_Delete(item);
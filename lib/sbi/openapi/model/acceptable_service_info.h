@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "media_component.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_create(
 void OpenAPI_acceptable_service_info_free(OpenAPI_acceptable_service_info_t *acceptable_service_info);
 OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_parseFromJSON(cJSON *acceptable_service_infoJSON);
 cJSON *OpenAPI_acceptable_service_info_convertToJSON(OpenAPI_acceptable_service_info_t *acceptable_service_info);
+bool OpenAPI_acceptable_service_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acceptable_service_info_t *acceptable_service_info);
 OpenAPI_acceptable_service_info_t *OpenAPI_acceptable_service_info_copy(OpenAPI_acceptable_service_info_t *dst, OpenAPI_acceptable_service_info_t *src);
 
 #ifdef __cplusplus
@@ -294,6 +294,207 @@ end:
     return item;
 }
 
+bool OpenAPI_access_and_mobility_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_and_mobility_data_t *access_and_mobility_data)
+{
+    if (access_and_mobility_data == NULL) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [AccessAndMobilityData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [AccessAndMobilityData]");
+        return false;
+    }
+    if (access_and_mobility_data->location) {
+    if (OpenAPI_user_location_writeJSON(writer, "location", access_and_mobility_data->location) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [location]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->location_ts) {
+    if (OpenAPI_json_write_string(writer, "locationTs", access_and_mobility_data->location_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [location_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->time_zone) {
+    if (OpenAPI_json_write_string(writer, "timeZone", access_and_mobility_data->time_zone) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [time_zone]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->time_zone_ts) {
+    if (OpenAPI_json_write_string(writer, "timeZoneTs", access_and_mobility_data->time_zone_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [time_zone_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(access_and_mobility_data->access_type)) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->reg_states) {
+    if (OpenAPI_json_write_array_start(writer, "regStates") == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reg_states]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *reg_states_node;
+    if (access_and_mobility_data->reg_states) {
+        OpenAPI_list_for_each(access_and_mobility_data->reg_states, reg_states_node) {
+            if (OpenAPI_rm_info_writeJSON(writer, NULL, reg_states_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reg_states]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reg_states]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->reg_states_ts) {
+    if (OpenAPI_json_write_string(writer, "regStatesTs", access_and_mobility_data->reg_states_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reg_states_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->conn_states) {
+    if (OpenAPI_json_write_array_start(writer, "connStates") == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [conn_states]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *conn_states_node;
+    if (access_and_mobility_data->conn_states) {
+        OpenAPI_list_for_each(access_and_mobility_data->conn_states, conn_states_node) {
+            if (OpenAPI_cm_info_writeJSON(writer, NULL, conn_states_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [conn_states]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [conn_states]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->conn_states_ts) {
+    if (OpenAPI_json_write_string(writer, "connStatesTs", access_and_mobility_data->conn_states_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [conn_states_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->reachability_status) {
+    if (OpenAPI_ue_reachability_writeJSON(writer, "reachabilityStatus", access_and_mobility_data->reachability_status) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reachability_status]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->reachability_status_ts) {
+    if (OpenAPI_json_write_string(writer, "reachabilityStatusTs", access_and_mobility_data->reachability_status_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [reachability_status_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->sms_over_nas_status) {
+    if (OpenAPI_json_write_string(writer, "smsOverNasStatus", OpenAPI_sms_support_ToString(access_and_mobility_data->sms_over_nas_status)) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [sms_over_nas_status]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->sms_over_nas_status_ts) {
+    if (OpenAPI_json_write_string(writer, "smsOverNasStatusTs", access_and_mobility_data->sms_over_nas_status_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [sms_over_nas_status_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->is_roaming_status) {
+    if (OpenAPI_json_write_bool(writer, "roamingStatus", access_and_mobility_data->roaming_status) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [roaming_status]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->roaming_status_ts) {
+    if (OpenAPI_json_write_string(writer, "roamingStatusTs", access_and_mobility_data->roaming_status_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [roaming_status_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->current_plmn) {
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "currentPlmn", access_and_mobility_data->current_plmn) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [current_plmn]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->current_plmn_ts) {
+    if (OpenAPI_json_write_string(writer, "currentPlmnTs", access_and_mobility_data->current_plmn_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [current_plmn_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->rat_type) {
+    if (OpenAPI_json_write_array_start(writer, "ratType") == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rat_type_node;
+    OpenAPI_list_for_each(access_and_mobility_data->rat_type, rat_type_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)rat_type_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [rat_type]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->rat_types_ts) {
+    if (OpenAPI_json_write_string(writer, "ratTypesTs", access_and_mobility_data->rat_types_ts) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [rat_types_ts]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", access_and_mobility_data->supp_feat) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_data_writeJSON() failed [AccessAndMobilityData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_and_mobility_data_t *OpenAPI_access_and_mobility_data_parseFromJSON(cJSON *access_and_mobility_dataJSON)
 {
     OpenAPI_access_and_mobility_data_t *access_and_mobility_data_local_var = NULL;
@@ -560,7 +761,6 @@ end:
 OpenAPI_access_and_mobility_data_t *OpenAPI_access_and_mobility_data_copy(OpenAPI_access_and_mobility_data_t *dst, OpenAPI_access_and_mobility_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_and_mobility_data_convertToJSON(src);
@@ -569,21 +769,6 @@ OpenAPI_access_and_mobility_data_t *OpenAPI_access_and_mobility_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_and_mobility_data_free(dst);
     dst = OpenAPI_access_and_mobility_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -731,6 +731,512 @@ end:
     return item;
 }
 
+bool OpenAPI_access_and_mobility_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_and_mobility_subscription_data_1_t *access_and_mobility_subscription_data_1)
+{
+    if (access_and_mobility_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [AccessAndMobilitySubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [AccessAndMobilitySubscriptionData_1]");
+        return false;
+    }
+    if (access_and_mobility_subscription_data_1->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", access_and_mobility_subscription_data_1->supported_features) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->gpsis) {
+    if (OpenAPI_json_write_array_start(writer, "gpsis") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [gpsis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsis_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->gpsis, gpsis_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gpsis_node->data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [gpsis]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [gpsis]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->internal_group_ids) {
+    if (OpenAPI_json_write_array_start(writer, "internalGroupIds") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *internal_group_ids_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->internal_group_ids, internal_group_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)internal_group_ids_node->data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->shared_vn_group_data_ids) {
+    if (OpenAPI_json_write_object_start(writer, "sharedVnGroupDataIds") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [shared_vn_group_data_ids]");
+        goto end;
+    }
+    OpenAPI_lnode_t *shared_vn_group_data_ids_node;
+    if (access_and_mobility_subscription_data_1->shared_vn_group_data_ids) {
+        OpenAPI_list_for_each(access_and_mobility_subscription_data_1->shared_vn_group_data_ids, shared_vn_group_data_ids_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)shared_vn_group_data_ids_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [shared_vn_group_data_ids]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->subscribed_ue_ambr) {
+    if (OpenAPI_ambr_rm_writeJSON(writer, "subscribedUeAmbr", access_and_mobility_subscription_data_1->subscribed_ue_ambr) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [subscribed_ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->nssai) {
+    if (OpenAPI_nssai_1_writeJSON(writer, "nssai", access_and_mobility_subscription_data_1->nssai) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [nssai]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->rat_restrictions) {
+    if (OpenAPI_json_write_array_start(writer, "ratRestrictions") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [rat_restrictions]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rat_restrictions_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->rat_restrictions, rat_restrictions_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)rat_restrictions_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [rat_restrictions]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [rat_restrictions]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->forbidden_areas) {
+    if (OpenAPI_json_write_array_start(writer, "forbiddenAreas") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [forbidden_areas]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *forbidden_areas_node;
+    if (access_and_mobility_subscription_data_1->forbidden_areas) {
+        OpenAPI_list_for_each(access_and_mobility_subscription_data_1->forbidden_areas, forbidden_areas_node) {
+            if (OpenAPI_area_1_writeJSON(writer, NULL, forbidden_areas_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [forbidden_areas]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [forbidden_areas]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->service_area_restriction) {
+    if (OpenAPI_service_area_restriction_1_writeJSON(writer, "serviceAreaRestriction", access_and_mobility_subscription_data_1->service_area_restriction) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [service_area_restriction]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->core_network_type_restrictions) {
+    if (OpenAPI_json_write_array_start(writer, "coreNetworkTypeRestrictions") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [core_network_type_restrictions]");
+        goto end;
+    }
+    OpenAPI_lnode_t *core_network_type_restrictions_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->core_network_type_restrictions, core_network_type_restrictions_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_core_network_type_ToString((intptr_t)core_network_type_restrictions_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [core_network_type_restrictions]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [core_network_type_restrictions]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_rfsp_index) {
+    if (OpenAPI_json_write_number(writer, "rfspIndex", access_and_mobility_subscription_data_1->rfsp_index) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [rfsp_index]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_subs_reg_timer) {
+    if (OpenAPI_json_write_number(writer, "subsRegTimer", access_and_mobility_subscription_data_1->subs_reg_timer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [subs_reg_timer]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_ue_usage_type) {
+    if (OpenAPI_json_write_number(writer, "ueUsageType", access_and_mobility_subscription_data_1->ue_usage_type) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ue_usage_type]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_mps_priority) {
+    if (OpenAPI_json_write_bool(writer, "mpsPriority", access_and_mobility_subscription_data_1->mps_priority) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [mps_priority]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_mcs_priority) {
+    if (OpenAPI_json_write_bool(writer, "mcsPriority", access_and_mobility_subscription_data_1->mcs_priority) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [mcs_priority]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_active_time) {
+    if (OpenAPI_json_write_number(writer, "activeTime", access_and_mobility_subscription_data_1->active_time) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [active_time]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->sor_info) {
+    if (OpenAPI_sor_info_1_writeJSON(writer, "sorInfo", access_and_mobility_subscription_data_1->sor_info) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [sor_info]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_sor_info_expect_ind) {
+    if (OpenAPI_json_write_bool(writer, "sorInfoExpectInd", access_and_mobility_subscription_data_1->sor_info_expect_ind) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [sor_info_expect_ind]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_soraf_retrieval) {
+    if (OpenAPI_json_write_bool(writer, "sorafRetrieval", access_and_mobility_subscription_data_1->soraf_retrieval) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [soraf_retrieval]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->sor_update_indicator_list) {
+    if (OpenAPI_json_write_array_start(writer, "sorUpdateIndicatorList") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [sor_update_indicator_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sor_update_indicator_list_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->sor_update_indicator_list, sor_update_indicator_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_sor_update_indicator_ToString((intptr_t)sor_update_indicator_list_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [sor_update_indicator_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [sor_update_indicator_list]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->upu_info) {
+    if (OpenAPI_upu_info_1_writeJSON(writer, "upuInfo", access_and_mobility_subscription_data_1->upu_info) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [upu_info]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_mico_allowed) {
+    if (OpenAPI_json_write_bool(writer, "micoAllowed", access_and_mobility_subscription_data_1->mico_allowed) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [mico_allowed]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->shared_am_data_ids) {
+    if (OpenAPI_json_write_array_start(writer, "sharedAmDataIds") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [shared_am_data_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *shared_am_data_ids_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->shared_am_data_ids, shared_am_data_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)shared_am_data_ids_node->data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [shared_am_data_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [shared_am_data_ids]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->odb_packet_services) {
+    if (OpenAPI_json_write_string(writer, "odbPacketServices", OpenAPI_odb_packet_services_ToString(access_and_mobility_subscription_data_1->odb_packet_services)) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [odb_packet_services]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->subscribed_dnn_list) {
+    if (OpenAPI_json_write_array_start(writer, "subscribedDnnList") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [subscribed_dnn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscribed_dnn_list_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->subscribed_dnn_list, subscribed_dnn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)subscribed_dnn_list_node->data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [subscribed_dnn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [subscribed_dnn_list]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_service_gap_time) {
+    if (OpenAPI_json_write_number(writer, "serviceGapTime", access_and_mobility_subscription_data_1->service_gap_time) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [service_gap_time]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->mdt_user_consent) {
+    if (OpenAPI_json_write_string(writer, "mdtUserConsent", OpenAPI_mdt_user_consent_ToString(access_and_mobility_subscription_data_1->mdt_user_consent)) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [mdt_user_consent]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->mdt_configuration) {
+    if (OpenAPI_mdt_configuration_1_writeJSON(writer, "mdtConfiguration", access_and_mobility_subscription_data_1->mdt_configuration) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [mdt_configuration]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", access_and_mobility_subscription_data_1->trace_data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->cag_data) {
+    if (OpenAPI_cag_data_1_writeJSON(writer, "cagData", access_and_mobility_subscription_data_1->cag_data) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [cag_data]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->stn_sr) {
+    if (OpenAPI_json_write_string(writer, "stnSr", access_and_mobility_subscription_data_1->stn_sr) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [stn_sr]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->c_msisdn) {
+    if (OpenAPI_json_write_string(writer, "cMsisdn", access_and_mobility_subscription_data_1->c_msisdn) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [c_msisdn]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_nb_io_tue_priority) {
+    if (OpenAPI_json_write_number(writer, "nbIoTUePriority", access_and_mobility_subscription_data_1->nb_io_tue_priority) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [nb_io_tue_priority]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_nssai_inclusion_allowed) {
+    if (OpenAPI_json_write_bool(writer, "nssaiInclusionAllowed", access_and_mobility_subscription_data_1->nssai_inclusion_allowed) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [nssai_inclusion_allowed]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->rg_wireline_characteristics) {
+    if (OpenAPI_json_write_string(writer, "rgWirelineCharacteristics", access_and_mobility_subscription_data_1->rg_wireline_characteristics) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [rg_wireline_characteristics]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->ec_restriction_data_wb) {
+    if (OpenAPI_ec_restriction_data_wb_writeJSON(writer, "ecRestrictionDataWb", access_and_mobility_subscription_data_1->ec_restriction_data_wb) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ec_restriction_data_wb]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_ec_restriction_data_nb) {
+    if (OpenAPI_json_write_bool(writer, "ecRestrictionDataNb", access_and_mobility_subscription_data_1->ec_restriction_data_nb) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ec_restriction_data_nb]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->expected_ue_behaviour_list) {
+    if (OpenAPI_expected_ue_behaviour_data_1_writeJSON(writer, "expectedUeBehaviourList", access_and_mobility_subscription_data_1->expected_ue_behaviour_list) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [expected_ue_behaviour_list]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->primary_rat_restrictions) {
+    if (OpenAPI_json_write_array_start(writer, "primaryRatRestrictions") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [primary_rat_restrictions]");
+        goto end;
+    }
+    OpenAPI_lnode_t *primary_rat_restrictions_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->primary_rat_restrictions, primary_rat_restrictions_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)primary_rat_restrictions_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [primary_rat_restrictions]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [primary_rat_restrictions]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->secondary_rat_restrictions) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatRestrictions") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [secondary_rat_restrictions]");
+        goto end;
+    }
+    OpenAPI_lnode_t *secondary_rat_restrictions_node;
+    OpenAPI_list_for_each(access_and_mobility_subscription_data_1->secondary_rat_restrictions, secondary_rat_restrictions_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)secondary_rat_restrictions_node->data)) == false) {
+            ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [secondary_rat_restrictions]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [secondary_rat_restrictions]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->edrx_parameters_list) {
+    if (OpenAPI_json_write_array_start(writer, "edrxParametersList") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [edrx_parameters_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *edrx_parameters_list_node;
+    if (access_and_mobility_subscription_data_1->edrx_parameters_list) {
+        OpenAPI_list_for_each(access_and_mobility_subscription_data_1->edrx_parameters_list, edrx_parameters_list_node) {
+            if (OpenAPI_edrx_parameters_1_writeJSON(writer, NULL, edrx_parameters_list_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [edrx_parameters_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [edrx_parameters_list]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->ptw_parameters_list) {
+    if (OpenAPI_json_write_array_start(writer, "ptwParametersList") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ptw_parameters_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ptw_parameters_list_node;
+    if (access_and_mobility_subscription_data_1->ptw_parameters_list) {
+        OpenAPI_list_for_each(access_and_mobility_subscription_data_1->ptw_parameters_list, ptw_parameters_list_node) {
+            if (OpenAPI_ptw_parameters_1_writeJSON(writer, NULL, ptw_parameters_list_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ptw_parameters_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [ptw_parameters_list]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->is_iab_operation_allowed) {
+    if (OpenAPI_json_write_bool(writer, "iabOperationAllowed", access_and_mobility_subscription_data_1->iab_operation_allowed) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [iab_operation_allowed]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->wireline_forbidden_areas) {
+    if (OpenAPI_json_write_array_start(writer, "wirelineForbiddenAreas") == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [wireline_forbidden_areas]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *wireline_forbidden_areas_node;
+    if (access_and_mobility_subscription_data_1->wireline_forbidden_areas) {
+        OpenAPI_list_for_each(access_and_mobility_subscription_data_1->wireline_forbidden_areas, wireline_forbidden_areas_node) {
+            if (OpenAPI_wireline_area_1_writeJSON(writer, NULL, wireline_forbidden_areas_node->data) == false) {
+                ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [wireline_forbidden_areas]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [wireline_forbidden_areas]");
+        goto end;
+    }
+    }
+
+    if (access_and_mobility_subscription_data_1->wireline_service_area_restriction) {
+    if (OpenAPI_wireline_service_area_restriction_1_writeJSON(writer, "wirelineServiceAreaRestriction", access_and_mobility_subscription_data_1->wireline_service_area_restriction) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [wireline_service_area_restriction]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_and_mobility_subscription_data_1_writeJSON() failed [AccessAndMobilitySubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_and_mobility_subscription_data_1_t *OpenAPI_access_and_mobility_subscription_data_1_parseFromJSON(cJSON *access_and_mobility_subscription_data_1JSON)
 {
     OpenAPI_access_and_mobility_subscription_data_1_t *access_and_mobility_subscription_data_1_local_var = NULL;
@@ -1388,7 +1894,6 @@ end:
 OpenAPI_access_and_mobility_subscription_data_1_t *OpenAPI_access_and_mobility_subscription_data_1_copy(OpenAPI_access_and_mobility_subscription_data_1_t *dst, OpenAPI_access_and_mobility_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_and_mobility_subscription_data_1_convertToJSON(src);
@@ -1397,21 +1902,6 @@ OpenAPI_access_and_mobility_subscription_data_1_t *OpenAPI_access_and_mobility_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_and_mobility_subscription_data_1_free(dst);
     dst = OpenAPI_access_and_mobility_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -70,6 +70,54 @@ end:
     return item;
 }
 
+bool OpenAPI_access_net_charging_identifier_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_net_charging_identifier_t *access_net_charging_identifier)
+{
+    if (access_net_charging_identifier == NULL) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [AccessNetChargingIdentifier]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [AccessNetChargingIdentifier]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "accNetChaIdValue", access_net_charging_identifier->acc_net_cha_id_value) == false) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [acc_net_cha_id_value]");
+        goto end;
+    }
+
+    if (access_net_charging_identifier->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (access_net_charging_identifier->flows) {
+        OpenAPI_list_for_each(access_net_charging_identifier->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_net_charging_identifier_writeJSON() failed [AccessNetChargingIdentifier]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier_parseFromJSON(cJSON *access_net_charging_identifierJSON)
 {
     OpenAPI_access_net_charging_identifier_t *access_net_charging_identifier_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier_copy(OpenAPI_access_net_charging_identifier_t *dst, OpenAPI_access_net_charging_identifier_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_net_charging_identifier_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_net_charging_identifier_free(dst);
     dst = OpenAPI_access_net_charging_identifier_parseFromJSON(item);
     cJSON_Delete(item);
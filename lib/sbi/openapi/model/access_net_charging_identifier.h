@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flows.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier
 void OpenAPI_access_net_charging_identifier_free(OpenAPI_access_net_charging_identifier_t *access_net_charging_identifier);
 OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier_parseFromJSON(cJSON *access_net_charging_identifierJSON);
 cJSON *OpenAPI_access_net_charging_identifier_convertToJSON(OpenAPI_access_net_charging_identifier_t *access_net_charging_identifier);
+bool OpenAPI_access_net_charging_identifier_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_net_charging_identifier_t *access_net_charging_identifier);
 OpenAPI_access_net_charging_identifier_t *OpenAPI_access_net_charging_identifier_copy(OpenAPI_access_net_charging_identifier_t *dst, OpenAPI_access_net_charging_identifier_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_access_right_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_right_status_t *access_right_status)
+{
+    if (access_right_status == NULL) {
+        ogs_error("OpenAPI_access_right_status_writeJSON() failed [AccessRightStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_right_status_writeJSON() failed [AccessRightStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_right_status_writeJSON() failed [AccessRightStatus]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_right_status_t *OpenAPI_access_right_status_parseFromJSON(cJSON *access_right_statusJSON)
 {
     OpenAPI_access_right_status_t *access_right_status_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_access_right_status_t *OpenAPI_access_right_status_copy(OpenAPI_access_right_status_t *dst, OpenAPI_access_right_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_right_status_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_access_right_status_t *OpenAPI_access_right_status_copy(OpenAPI_access_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_right_status_free(dst);
     dst = OpenAPI_access_right_status_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_right_status_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_access_right_status_t *OpenAPI_access_right_status_create(
 void OpenAPI_access_right_status_free(OpenAPI_access_right_status_t *access_right_status);
 OpenAPI_access_right_status_t *OpenAPI_access_right_status_parseFromJSON(cJSON *access_right_statusJSON);
 cJSON *OpenAPI_access_right_status_convertToJSON(OpenAPI_access_right_status_t *access_right_status);
+bool OpenAPI_access_right_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_right_status_t *access_right_status);
 OpenAPI_access_right_status_t *OpenAPI_access_right_status_copy(OpenAPI_access_right_status_t *dst, OpenAPI_access_right_status_t *src);
 
 #ifdef __cplusplus
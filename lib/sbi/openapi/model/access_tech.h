@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_tech_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_access_tech_t *OpenAPI_access_tech_create(
 void OpenAPI_access_tech_free(OpenAPI_access_tech_t *access_tech);
 OpenAPI_access_tech_t *OpenAPI_access_tech_parseFromJSON(cJSON *access_techJSON);
 cJSON *OpenAPI_access_tech_convertToJSON(OpenAPI_access_tech_t *access_tech);
+bool OpenAPI_access_tech_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_tech_t *access_tech);
 OpenAPI_access_tech_t *OpenAPI_access_tech_copy(OpenAPI_access_tech_t *dst, OpenAPI_access_tech_t *src);
 
 #ifdef __cplusplus
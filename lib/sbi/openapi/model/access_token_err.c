@@ -87,6 +87,47 @@ end:
     return item;
 }
 
+bool OpenAPI_access_token_err_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_token_err_t *access_token_err)
+{
+    if (access_token_err == NULL) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [AccessTokenErr]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [AccessTokenErr]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "error", OpenAPI_erroraccess_token_err_ToString(access_token_err->error)) == false) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (access_token_err->error_description) {
+    if (OpenAPI_json_write_string(writer, "error_description", access_token_err->error_description) == false) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [error_description]");
+        goto end;
+    }
+    }
+
+    if (access_token_err->error_uri) {
+    if (OpenAPI_json_write_string(writer, "error_uri", access_token_err->error_uri) == false) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [error_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_err_writeJSON() failed [AccessTokenErr]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_token_err_t *OpenAPI_access_token_err_parseFromJSON(cJSON *access_token_errJSON)
 {
     OpenAPI_access_token_err_t *access_token_err_local_var = NULL;
@@ -135,7 +176,6 @@ end:
 OpenAPI_access_token_err_t *OpenAPI_access_token_err_copy(OpenAPI_access_token_err_t *dst, OpenAPI_access_token_err_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_token_err_convertToJSON(src);
@@ -144,21 +184,6 @@ OpenAPI_access_token_err_t *OpenAPI_access_token_err_copy(OpenAPI_access_token_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_token_err_free(dst);
     dst = OpenAPI_access_token_err_parseFromJSON(item);
     cJSON_Delete(item);
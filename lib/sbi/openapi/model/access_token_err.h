@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +38,7 @@ OpenAPI_access_token_err_t *OpenAPI_access_token_err_create(
 void OpenAPI_access_token_err_free(OpenAPI_access_token_err_t *access_token_err);
 OpenAPI_access_token_err_t *OpenAPI_access_token_err_parseFromJSON(cJSON *access_token_errJSON);
 cJSON *OpenAPI_access_token_err_convertToJSON(OpenAPI_access_token_err_t *access_token_err);
+bool OpenAPI_access_token_err_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_token_err_t *access_token_err);
 OpenAPI_access_token_err_t *OpenAPI_access_token_err_copy(OpenAPI_access_token_err_t *dst, OpenAPI_access_token_err_t *src);
 
 #ifdef __cplusplus
@@ -299,6 +299,202 @@ end:
     return item;
 }
 
+bool OpenAPI_access_token_req_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_token_req_t *access_token_req)
+{
+    if (access_token_req == NULL) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [AccessTokenReq]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [AccessTokenReq]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "grant_type", OpenAPI_grant_typeaccess_token_req_ToString(access_token_req->grant_type)) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [grant_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfInstanceId", access_token_req->nf_instance_id) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [nf_instance_id]");
+        goto end;
+    }
+
+    if (access_token_req->nf_type) {
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_type_ToString(access_token_req->nf_type)) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [nf_type]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_nf_type) {
+    if (OpenAPI_json_write_string(writer, "targetNfType", OpenAPI_nf_type_ToString(access_token_req->target_nf_type)) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nf_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "scope", access_token_req->scope) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [scope]");
+        goto end;
+    }
+
+    if (access_token_req->target_nf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "targetNfInstanceId", access_token_req->target_nf_instance_id) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->requester_plmn) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "requesterPlmn", access_token_req->requester_plmn) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_plmn]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->requester_plmn_list) {
+    if (OpenAPI_json_write_array_start(writer, "requesterPlmnList") == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_plmn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *requester_plmn_list_node;
+    if (access_token_req->requester_plmn_list) {
+        OpenAPI_list_for_each(access_token_req->requester_plmn_list, requester_plmn_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, requester_plmn_list_node->data) == false) {
+                ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_plmn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_plmn_list]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->requester_snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "requesterSnssaiList") == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *requester_snssai_list_node;
+    if (access_token_req->requester_snssai_list) {
+        OpenAPI_list_for_each(access_token_req->requester_snssai_list, requester_snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, requester_snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snssai_list]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->requester_fqdn) {
+    if (OpenAPI_json_write_string(writer, "requesterFqdn", access_token_req->requester_fqdn) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_fqdn]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->requester_snpn_list) {
+    if (OpenAPI_json_write_array_start(writer, "requesterSnpnList") == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snpn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *requester_snpn_list_node;
+    if (access_token_req->requester_snpn_list) {
+        OpenAPI_list_for_each(access_token_req->requester_snpn_list, requester_snpn_list_node) {
+            if (OpenAPI_plmn_id_nid_writeJSON(writer, NULL, requester_snpn_list_node->data) == false) {
+                ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snpn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [requester_snpn_list]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_plmn) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "targetPlmn", access_token_req->target_plmn) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_plmn]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "targetSnssaiList") == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *target_snssai_list_node;
+    if (access_token_req->target_snssai_list) {
+        OpenAPI_list_for_each(access_token_req->target_snssai_list, target_snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, target_snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_snssai_list]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_nsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "targetNsiList") == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *target_nsi_list_node;
+    OpenAPI_list_for_each(access_token_req->target_nsi_list, target_nsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)target_nsi_list_node->data) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nsi_list]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_nf_set_id) {
+    if (OpenAPI_json_write_string(writer, "targetNfSetId", access_token_req->target_nf_set_id) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nf_set_id]");
+        goto end;
+    }
+    }
+
+    if (access_token_req->target_nf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "targetNfServiceSetId", access_token_req->target_nf_service_set_id) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [target_nf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_token_req_writeJSON() failed [AccessTokenReq]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_token_req_t *OpenAPI_access_token_req_parseFromJSON(cJSON *access_token_reqJSON)
 {
     OpenAPI_access_token_req_t *access_token_req_local_var = NULL;
@@ -572,7 +768,6 @@ end:
 OpenAPI_access_token_req_t *OpenAPI_access_token_req_copy(OpenAPI_access_token_req_t *dst, OpenAPI_access_token_req_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_token_req_convertToJSON(src);
@@ -581,21 +776,6 @@ OpenAPI_access_token_req_t *OpenAPI_access_token_req_copy(OpenAPI_access_token_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_token_req_free(dst);
     dst = OpenAPI_access_token_req_parseFromJSON(item);
     cJSON_Delete(item);
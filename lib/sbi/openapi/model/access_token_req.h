@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_type.h"
 #include "plmn_id.h"
 #include "plmn_id_nid.h"
@@ -67,6 +68,7 @@ OpenAPI_access_token_req_t *OpenAPI_access_token_req_create(
 void OpenAPI_access_token_req_free(OpenAPI_access_token_req_t *access_token_req);
 OpenAPI_access_token_req_t *OpenAPI_access_token_req_parseFromJSON(cJSON *access_token_reqJSON);
 cJSON *OpenAPI_access_token_req_convertToJSON(OpenAPI_access_token_req_t *access_token_req);
+bool OpenAPI_access_token_req_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_token_req_t *access_token_req);
 OpenAPI_access_token_req_t *OpenAPI_access_token_req_copy(OpenAPI_access_token_req_t *dst, OpenAPI_access_token_req_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_access_type_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_type_rm_t *access_type_rm)
+{
+    if (access_type_rm == NULL) {
+        ogs_error("OpenAPI_access_type_rm_writeJSON() failed [AccessTypeRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_access_type_rm_writeJSON() failed [AccessTypeRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_access_type_rm_writeJSON() failed [AccessTypeRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_parseFromJSON(cJSON *access_type_rmJSON)
 {
     OpenAPI_access_type_rm_t *access_type_rm_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_copy(OpenAPI_access_type_rm_t *dst, OpenAPI_access_type_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_access_type_rm_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_copy(OpenAPI_access_type_rm_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_access_type_rm_free(dst);
     dst = OpenAPI_access_type_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "null_value.h"
 
@@ -28,6 +29,7 @@ OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_create(
 void OpenAPI_access_type_rm_free(OpenAPI_access_type_rm_t *access_type_rm);
 OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_parseFromJSON(cJSON *access_type_rmJSON);
 cJSON *OpenAPI_access_type_rm_convertToJSON(OpenAPI_access_type_rm_t *access_type_rm);
+bool OpenAPI_access_type_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_access_type_rm_t *access_type_rm);
 OpenAPI_access_type_rm_t *OpenAPI_access_type_rm_copy(OpenAPI_access_type_rm_t *dst, OpenAPI_access_type_rm_t *src);
 
 #ifdef __cplusplus
@@ -133,6 +133,89 @@ end:
     return item;
 }
 
+bool OpenAPI_accu_usage_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_accu_usage_report_t *accu_usage_report)
+{
+    if (accu_usage_report == NULL) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [AccuUsageReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [AccuUsageReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "refUmIds", accu_usage_report->ref_um_ids) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [ref_um_ids]");
+        goto end;
+    }
+
+    if (accu_usage_report->is_vol_usage) {
+    if (OpenAPI_json_write_number(writer, "volUsage", accu_usage_report->vol_usage) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [vol_usage]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_vol_usage_uplink) {
+    if (OpenAPI_json_write_number(writer, "volUsageUplink", accu_usage_report->vol_usage_uplink) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [vol_usage_uplink]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_vol_usage_downlink) {
+    if (OpenAPI_json_write_number(writer, "volUsageDownlink", accu_usage_report->vol_usage_downlink) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [vol_usage_downlink]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_time_usage) {
+    if (OpenAPI_json_write_number(writer, "timeUsage", accu_usage_report->time_usage) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [time_usage]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_next_vol_usage) {
+    if (OpenAPI_json_write_number(writer, "nextVolUsage", accu_usage_report->next_vol_usage) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [next_vol_usage]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_next_vol_usage_uplink) {
+    if (OpenAPI_json_write_number(writer, "nextVolUsageUplink", accu_usage_report->next_vol_usage_uplink) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [next_vol_usage_uplink]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_next_vol_usage_downlink) {
+    if (OpenAPI_json_write_number(writer, "nextVolUsageDownlink", accu_usage_report->next_vol_usage_downlink) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [next_vol_usage_downlink]");
+        goto end;
+    }
+    }
+
+    if (accu_usage_report->is_next_time_usage) {
+    if (OpenAPI_json_write_number(writer, "nextTimeUsage", accu_usage_report->next_time_usage) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [next_time_usage]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_accu_usage_report_writeJSON() failed [AccuUsageReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_parseFromJSON(cJSON *accu_usage_reportJSON)
 {
     OpenAPI_accu_usage_report_t *accu_usage_report_local_var = NULL;
@@ -247,7 +330,6 @@ end:
 OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_copy(OpenAPI_accu_usage_report_t *dst, OpenAPI_accu_usage_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_accu_usage_report_convertToJSON(src);
@@ -256,21 +338,6 @@ OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_copy(OpenAPI_accu_usage_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_accu_usage_report_free(dst);
     dst = OpenAPI_accu_usage_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -60,6 +61,7 @@ OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_create(
 void OpenAPI_accu_usage_report_free(OpenAPI_accu_usage_report_t *accu_usage_report);
 OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_parseFromJSON(cJSON *accu_usage_reportJSON);
 cJSON *OpenAPI_accu_usage_report_convertToJSON(OpenAPI_accu_usage_report_t *accu_usage_report);
+bool OpenAPI_accu_usage_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_accu_usage_report_t *accu_usage_report);
 OpenAPI_accu_usage_report_t *OpenAPI_accu_usage_report_copy(OpenAPI_accu_usage_report_t *dst, OpenAPI_accu_usage_report_t *src);
 
 #ifdef __cplusplus
@@ -81,6 +81,56 @@ end:
     return item;
 }
 
+bool OpenAPI_accumulated_usage_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_accumulated_usage_t *accumulated_usage)
+{
+    if (accumulated_usage == NULL) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [AccumulatedUsage]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [AccumulatedUsage]");
+        return false;
+    }
+    if (accumulated_usage->is_duration) {
+    if (OpenAPI_json_write_number(writer, "duration", accumulated_usage->duration) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [duration]");
+        goto end;
+    }
+    }
+
+    if (accumulated_usage->is_total_volume) {
+    if (OpenAPI_json_write_number(writer, "totalVolume", accumulated_usage->total_volume) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [total_volume]");
+        goto end;
+    }
+    }
+
+    if (accumulated_usage->is_downlink_volume) {
+    if (OpenAPI_json_write_number(writer, "downlinkVolume", accumulated_usage->downlink_volume) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [downlink_volume]");
+        goto end;
+    }
+    }
+
+    if (accumulated_usage->is_uplink_volume) {
+    if (OpenAPI_json_write_number(writer, "uplinkVolume", accumulated_usage->uplink_volume) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [uplink_volume]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_accumulated_usage_writeJSON() failed [AccumulatedUsage]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_parseFromJSON(cJSON *accumulated_usageJSON)
 {
     OpenAPI_accumulated_usage_t *accumulated_usage_local_var = NULL;
@@ -139,7 +189,6 @@ end:
 OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_copy(OpenAPI_accumulated_usage_t *dst, OpenAPI_accumulated_usage_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_accumulated_usage_convertToJSON(src);
@@ -148,21 +197,6 @@ OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_copy(OpenAPI_accumulated_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_accumulated_usage_free(dst);
     dst = OpenAPI_accumulated_usage_parseFromJSON(item);
     cJSON_Delete(item);
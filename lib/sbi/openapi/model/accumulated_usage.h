@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,7 @@ OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_create(
 void OpenAPI_accumulated_usage_free(OpenAPI_accumulated_usage_t *accumulated_usage);
 OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_parseFromJSON(cJSON *accumulated_usageJSON);
 cJSON *OpenAPI_accumulated_usage_convertToJSON(OpenAPI_accumulated_usage_t *accumulated_usage);
+bool OpenAPI_accumulated_usage_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_accumulated_usage_t *accumulated_usage);
 OpenAPI_accumulated_usage_t *OpenAPI_accumulated_usage_copy(OpenAPI_accumulated_usage_t *dst, OpenAPI_accumulated_usage_t *src);
 
 #ifdef __cplusplus
@@ -86,6 +86,61 @@ end:
     return item;
 }
 
+bool OpenAPI_acknowledge_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acknowledge_info_t *acknowledge_info)
+{
+    if (acknowledge_info == NULL) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [AcknowledgeInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [AcknowledgeInfo]");
+        return false;
+    }
+    if (acknowledge_info->sor_mac_iue) {
+    if (OpenAPI_json_write_string(writer, "sorMacIue", acknowledge_info->sor_mac_iue) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [sor_mac_iue]");
+        goto end;
+    }
+    }
+
+    if (acknowledge_info->upu_mac_iue) {
+    if (OpenAPI_json_write_string(writer, "upuMacIue", acknowledge_info->upu_mac_iue) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [upu_mac_iue]");
+        goto end;
+    }
+    }
+
+    if (acknowledge_info->secured_packet) {
+    if (OpenAPI_json_write_string(writer, "securedPacket", acknowledge_info->secured_packet) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [secured_packet]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "provisioningTime", acknowledge_info->provisioning_time) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (acknowledge_info->is_ue_not_reachable) {
+    if (OpenAPI_json_write_bool(writer, "ueNotReachable", acknowledge_info->ue_not_reachable) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [ue_not_reachable]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acknowledge_info_writeJSON() failed [AcknowledgeInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_parseFromJSON(cJSON *acknowledge_infoJSON)
 {
     OpenAPI_acknowledge_info_t *acknowledge_info_local_var = NULL;
@@ -153,7 +208,6 @@ end:
 OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_copy(OpenAPI_acknowledge_info_t *dst, OpenAPI_acknowledge_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acknowledge_info_convertToJSON(src);
@@ -162,21 +216,6 @@ OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_copy(OpenAPI_acknowledge_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acknowledge_info_free(dst);
     dst = OpenAPI_acknowledge_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,7 @@ OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_create(
 void OpenAPI_acknowledge_info_free(OpenAPI_acknowledge_info_t *acknowledge_info);
 OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_parseFromJSON(cJSON *acknowledge_infoJSON);
 cJSON *OpenAPI_acknowledge_info_convertToJSON(OpenAPI_acknowledge_info_t *acknowledge_info);
+bool OpenAPI_acknowledge_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acknowledge_info_t *acknowledge_info);
 OpenAPI_acknowledge_info_t *OpenAPI_acknowledge_info_copy(OpenAPI_acknowledge_info_t *dst, OpenAPI_acknowledge_info_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_acs_info_t *OpenAPI_acs_info_create(
 void OpenAPI_acs_info_free(OpenAPI_acs_info_t *acs_info);
 OpenAPI_acs_info_t *OpenAPI_acs_info_parseFromJSON(cJSON *acs_infoJSON);
 cJSON *OpenAPI_acs_info_convertToJSON(OpenAPI_acs_info_t *acs_info);
+bool OpenAPI_acs_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acs_info_t *acs_info);
 OpenAPI_acs_info_t *OpenAPI_acs_info_copy(OpenAPI_acs_info_t *dst, OpenAPI_acs_info_t *src);
 
 #ifdef __cplusplus
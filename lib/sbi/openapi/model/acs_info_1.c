@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_acs_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acs_info_1_t *acs_info_1)
+{
+    if (acs_info_1 == NULL) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [AcsInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [AcsInfo_1]");
+        return false;
+    }
+    if (acs_info_1->acs_url) {
+    if (OpenAPI_json_write_string(writer, "acsUrl", acs_info_1->acs_url) == false) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [acs_url]");
+        goto end;
+    }
+    }
+
+    if (acs_info_1->acs_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "acsIpv4Addr", acs_info_1->acs_ipv4_addr) == false) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [acs_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (acs_info_1->acs_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "acsIpv6Addr", acs_info_1->acs_ipv6_addr) == false) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [acs_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_acs_info_1_writeJSON() failed [AcsInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_acs_info_1_t *OpenAPI_acs_info_1_parseFromJSON(cJSON *acs_info_1JSON)
 {
     OpenAPI_acs_info_1_t *acs_info_1_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_acs_info_1_t *OpenAPI_acs_info_1_copy(OpenAPI_acs_info_1_t *dst, OpenAPI_acs_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_acs_info_1_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_acs_info_1_t *OpenAPI_acs_info_1_copy(OpenAPI_acs_info_1_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_acs_info_1_free(dst);
     dst = OpenAPI_acs_info_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acs_info.h"
 #include "null_value.h"
 
@@ -34,6 +35,7 @@ OpenAPI_acs_info_rm_t *OpenAPI_acs_info_rm_create(
 void OpenAPI_acs_info_rm_free(OpenAPI_acs_info_rm_t *acs_info_rm);
 OpenAPI_acs_info_rm_t *OpenAPI_acs_info_rm_parseFromJSON(cJSON *acs_info_rmJSON);
 cJSON *OpenAPI_acs_info_rm_convertToJSON(OpenAPI_acs_info_rm_t *acs_info_rm);
+bool OpenAPI_acs_info_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_acs_info_rm_t *acs_info_rm);
 OpenAPI_acs_info_rm_t *OpenAPI_acs_info_rm_copy(OpenAPI_acs_info_rm_t *dst, OpenAPI_acs_info_rm_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,40 @@ end:
     return item;
 }
 
+bool OpenAPI_additional_access_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_additional_access_info_t *additional_access_info)
+{
+    if (additional_access_info == NULL) {
+        ogs_error("OpenAPI_additional_access_info_writeJSON() failed [AdditionalAccessInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_additional_access_info_writeJSON() failed [AdditionalAccessInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(additional_access_info->access_type)) == false) {
+        ogs_error("OpenAPI_additional_access_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (additional_access_info->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(additional_access_info->rat_type)) == false) {
+        ogs_error("OpenAPI_additional_access_info_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_additional_access_info_writeJSON() failed [AdditionalAccessInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_parseFromJSON(cJSON *additional_access_infoJSON)
 {
     OpenAPI_additional_access_info_t *additional_access_info_local_var = NULL;
@@ -93,7 +127,6 @@ end:
 OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_copy(OpenAPI_additional_access_info_t *dst, OpenAPI_additional_access_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_additional_access_info_convertToJSON(src);
@@ -102,21 +135,6 @@ OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_copy(OpenAPI_ad
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_additional_access_info_free(dst);
     dst = OpenAPI_additional_access_info_parseFromJSON(item);
     cJSON_Delete(item);
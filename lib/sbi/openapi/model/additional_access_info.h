@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "rat_type.h"
 
@@ -32,6 +33,7 @@ OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_create(
 void OpenAPI_additional_access_info_free(OpenAPI_additional_access_info_t *additional_access_info);
 OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_parseFromJSON(cJSON *additional_access_infoJSON);
 cJSON *OpenAPI_additional_access_info_convertToJSON(OpenAPI_additional_access_info_t *additional_access_info);
+bool OpenAPI_additional_access_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_additional_access_info_t *additional_access_info);
 OpenAPI_additional_access_info_t *OpenAPI_additional_access_info_copy(OpenAPI_additional_access_info_t *dst, OpenAPI_additional_access_info_t *src);
 
 #ifdef __cplusplus
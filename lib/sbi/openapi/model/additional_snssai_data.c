@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_additional_snssai_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_additional_snssai_data_t *additional_snssai_data)
+{
+    if (additional_snssai_data == NULL) {
+        ogs_error("OpenAPI_additional_snssai_data_writeJSON() failed [AdditionalSnssaiData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_additional_snssai_data_writeJSON() failed [AdditionalSnssaiData]");
+        return false;
+    }
+    if (additional_snssai_data->is_required_authn_authz) {
+    if (OpenAPI_json_write_bool(writer, "requiredAuthnAuthz", additional_snssai_data->required_authn_authz) == false) {
+        ogs_error("OpenAPI_additional_snssai_data_writeJSON() failed [required_authn_authz]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_additional_snssai_data_writeJSON() failed [AdditionalSnssaiData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_additional_snssai_data_t *OpenAPI_additional_snssai_data_parseFromJSON(cJSON *additional_snssai_dataJSON)
 {
     OpenAPI_additional_snssai_data_t *additional_snssai_data_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_additional_snssai_data_t *OpenAPI_additional_snssai_data_copy(OpenAPI_additional_snssai_data_t *dst, OpenAPI_additional_snssai_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_additional_snssai_data_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_additional_snssai_data_t *OpenAPI_additional_snssai_data_copy(OpenAPI_ad
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_additional_snssai_data_free(dst);
     dst = OpenAPI_additional_snssai_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -97,6 +97,82 @@ end:
     return item;
 }
 
+bool OpenAPI_af_event_exposure_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_event_exposure_data_t *af_event_exposure_data)
+{
+    if (af_event_exposure_data == NULL) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [AfEventExposureData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [AfEventExposureData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "afEvents") == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_events]");
+        goto end;
+    }
+    OpenAPI_lnode_t *af_events_node;
+    OpenAPI_list_for_each(af_event_exposure_data->af_events, af_events_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_af_event_ToString((intptr_t)af_events_node->data)) == false) {
+            ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_events]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_events]");
+        goto end;
+    }
+
+    if (af_event_exposure_data->af_ids) {
+    if (OpenAPI_json_write_array_start(writer, "afIds") == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *af_ids_node;
+    OpenAPI_list_for_each(af_event_exposure_data->af_ids, af_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)af_ids_node->data) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+    }
+
+    if (af_event_exposure_data->app_ids) {
+    if (OpenAPI_json_write_array_start(writer, "appIds") == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_ids_node;
+    OpenAPI_list_for_each(af_event_exposure_data->app_ids, app_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)app_ids_node->data) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_exposure_data_writeJSON() failed [AfEventExposureData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_af_event_exposure_data_t *OpenAPI_af_event_exposure_data_parseFromJSON(cJSON *af_event_exposure_dataJSON)
 {
     OpenAPI_af_event_exposure_data_t *af_event_exposure_data_local_var = NULL;
@@ -178,7 +254,6 @@ end:
 OpenAPI_af_event_exposure_data_t *OpenAPI_af_event_exposure_data_copy(OpenAPI_af_event_exposure_data_t *dst, OpenAPI_af_event_exposure_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_event_exposure_data_convertToJSON(src);
@@ -187,21 +262,6 @@ OpenAPI_af_event_exposure_data_t *OpenAPI_af_event_exposure_data_copy(OpenAPI_af
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_event_exposure_data_free(dst);
     dst = OpenAPI_af_event_exposure_data_parseFromJSON(item);
     cJSON_Delete(item);
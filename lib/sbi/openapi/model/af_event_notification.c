@@ -70,6 +70,54 @@ end:
     return item;
 }
 
+bool OpenAPI_af_event_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_event_notification_t *af_event_notification)
+{
+    if (af_event_notification == NULL) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [AfEventNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [AfEventNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "event", OpenAPI_af_event_ToString(af_event_notification->event)) == false) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [event]");
+        goto end;
+    }
+
+    if (af_event_notification->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (af_event_notification->flows) {
+        OpenAPI_list_for_each(af_event_notification->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_af_event_notification_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_notification_writeJSON() failed [AfEventNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_parseFromJSON(cJSON *af_event_notificationJSON)
 {
     OpenAPI_af_event_notification_t *af_event_notification_local_var = NULL;
@@ -128,7 +176,6 @@ end:
 OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_copy(OpenAPI_af_event_notification_t *dst, OpenAPI_af_event_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_event_notification_convertToJSON(src);
@@ -137,21 +184,6 @@ OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_copy(OpenAPI_af_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_event_notification_free(dst);
     dst = OpenAPI_af_event_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_event.h"
 #include "flows.h"
 
@@ -32,6 +33,7 @@ OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_create(
 void OpenAPI_af_event_notification_free(OpenAPI_af_event_notification_t *af_event_notification);
 OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_parseFromJSON(cJSON *af_event_notificationJSON);
 cJSON *OpenAPI_af_event_notification_convertToJSON(OpenAPI_af_event_notification_t *af_event_notification);
+bool OpenAPI_af_event_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_event_notification_t *af_event_notification);
 OpenAPI_af_event_notification_t *OpenAPI_af_event_notification_copy(OpenAPI_af_event_notification_t *dst, OpenAPI_af_event_notification_t *src);
 
 #ifdef __cplusplus
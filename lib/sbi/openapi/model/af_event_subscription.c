@@ -75,6 +75,54 @@ end:
     return item;
 }
 
+bool OpenAPI_af_event_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_event_subscription_t *af_event_subscription)
+{
+    if (af_event_subscription == NULL) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [AfEventSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [AfEventSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "event", OpenAPI_af_event_ToString(af_event_subscription->event)) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [event]");
+        goto end;
+    }
+
+    if (af_event_subscription->notif_method) {
+    if (OpenAPI_json_write_string(writer, "notifMethod", OpenAPI_af_notif_method_ToString(af_event_subscription->notif_method)) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [notif_method]");
+        goto end;
+    }
+    }
+
+    if (af_event_subscription->is_rep_period) {
+    if (OpenAPI_json_write_number(writer, "repPeriod", af_event_subscription->rep_period) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [rep_period]");
+        goto end;
+    }
+    }
+
+    if (af_event_subscription->is_wait_time) {
+    if (OpenAPI_json_write_number(writer, "waitTime", af_event_subscription->wait_time) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [wait_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_af_event_subscription_writeJSON() failed [AfEventSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_parseFromJSON(cJSON *af_event_subscriptionJSON)
 {
     OpenAPI_af_event_subscription_t *af_event_subscription_local_var = NULL;
@@ -137,7 +185,6 @@ end:
 OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_copy(OpenAPI_af_event_subscription_t *dst, OpenAPI_af_event_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_event_subscription_convertToJSON(src);
@@ -146,21 +193,6 @@ OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_copy(OpenAPI_af_e
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_event_subscription_free(dst);
     dst = OpenAPI_af_event_subscription_parseFromJSON(item);
     cJSON_Delete(item);
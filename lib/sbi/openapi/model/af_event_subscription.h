@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_event.h"
 #include "af_notif_method.h"
 
@@ -40,6 +41,7 @@ OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_create(
 void OpenAPI_af_event_subscription_free(OpenAPI_af_event_subscription_t *af_event_subscription);
 OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_parseFromJSON(cJSON *af_event_subscriptionJSON);
 cJSON *OpenAPI_af_event_subscription_convertToJSON(OpenAPI_af_event_subscription_t *af_event_subscription);
+bool OpenAPI_af_event_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_event_subscription_t *af_event_subscription);
 OpenAPI_af_event_subscription_t *OpenAPI_af_event_subscription_copy(OpenAPI_af_event_subscription_t *dst, OpenAPI_af_event_subscription_t *src);
 
 #ifdef __cplusplus
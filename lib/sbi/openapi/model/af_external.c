@@ -98,6 +98,70 @@ end:
     return item;
 }
 
+bool OpenAPI_af_external_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_external_t *af_external)
+{
+    if (af_external == NULL) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [AfExternal]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [AfExternal]");
+        return false;
+    }
+    if (af_external->af_id) {
+    if (OpenAPI_json_write_string(writer, "afId", af_external->af_id) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [af_id]");
+        goto end;
+    }
+    }
+
+    if (af_external->allowed_geographic_area) {
+    if (OpenAPI_json_write_array_start(writer, "allowedGeographicArea") == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_geographic_area_node;
+    if (af_external->allowed_geographic_area) {
+        OpenAPI_list_for_each(af_external->allowed_geographic_area, allowed_geographic_area_node) {
+            if (OpenAPI_geographic_area_writeJSON(writer, NULL, allowed_geographic_area_node->data) == false) {
+                ogs_error("OpenAPI_af_external_writeJSON() failed [allowed_geographic_area]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+    }
+
+    if (af_external->privacy_check_related_action) {
+    if (OpenAPI_json_write_string(writer, "privacyCheckRelatedAction", OpenAPI_privacy_check_related_action_ToString(af_external->privacy_check_related_action)) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [privacy_check_related_action]");
+        goto end;
+    }
+    }
+
+    if (af_external->valid_time_period) {
+    if (OpenAPI_valid_time_period_writeJSON(writer, "validTimePeriod", af_external->valid_time_period) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_af_external_writeJSON() failed [AfExternal]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_af_external_t *OpenAPI_af_external_parseFromJSON(cJSON *af_externalJSON)
 {
     OpenAPI_af_external_t *af_external_local_var = NULL;
@@ -172,7 +236,6 @@ end:
 OpenAPI_af_external_t *OpenAPI_af_external_copy(OpenAPI_af_external_t *dst, OpenAPI_af_external_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_external_convertToJSON(src);
@@ -181,21 +244,6 @@ OpenAPI_af_external_t *OpenAPI_af_external_copy(OpenAPI_af_external_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_external_free(dst);
     dst = OpenAPI_af_external_parseFromJSON(item);
     cJSON_Delete(item);
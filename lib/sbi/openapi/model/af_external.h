@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "geographic_area.h"
 #include "privacy_check_related_action.h"
 #include "valid_time_period.h"
@@ -37,6 +38,7 @@ OpenAPI_af_external_t *OpenAPI_af_external_create(
 void OpenAPI_af_external_free(OpenAPI_af_external_t *af_external);
 OpenAPI_af_external_t *OpenAPI_af_external_parseFromJSON(cJSON *af_externalJSON);
 cJSON *OpenAPI_af_external_convertToJSON(OpenAPI_af_external_t *af_external);
+bool OpenAPI_af_external_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_external_t *af_external);
 OpenAPI_af_external_t *OpenAPI_af_external_copy(OpenAPI_af_external_t *dst, OpenAPI_af_external_t *src);
 
 #ifdef __cplusplus
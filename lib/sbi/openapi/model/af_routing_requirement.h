@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "route_to_location.h"
 #include "spatial_validity.h"
 #include "temporal_validity.h"
@@ -46,6 +47,7 @@ OpenAPI_af_routing_requirement_t *OpenAPI_af_routing_requirement_create(
 void OpenAPI_af_routing_requirement_free(OpenAPI_af_routing_requirement_t *af_routing_requirement);
 OpenAPI_af_routing_requirement_t *OpenAPI_af_routing_requirement_parseFromJSON(cJSON *af_routing_requirementJSON);
 cJSON *OpenAPI_af_routing_requirement_convertToJSON(OpenAPI_af_routing_requirement_t *af_routing_requirement);
+bool OpenAPI_af_routing_requirement_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_routing_requirement_t *af_routing_requirement);
 OpenAPI_af_routing_requirement_t *OpenAPI_af_routing_requirement_copy(OpenAPI_af_routing_requirement_t *dst, OpenAPI_af_routing_requirement_t *src);
 
 #ifdef __cplusplus
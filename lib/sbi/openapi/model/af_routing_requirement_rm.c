@@ -143,6 +143,98 @@ end:
     return item;
 }
 
+bool OpenAPI_af_routing_requirement_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_af_routing_requirement_rm_t *af_routing_requirement_rm)
+{
+    if (af_routing_requirement_rm == NULL) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [AfRoutingRequirementRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [AfRoutingRequirementRm]");
+        return false;
+    }
+    if (af_routing_requirement_rm->is_app_reloc) {
+    if (OpenAPI_json_write_bool(writer, "appReloc", af_routing_requirement_rm->app_reloc) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [app_reloc]");
+        goto end;
+    }
+    }
+
+    if (af_routing_requirement_rm->route_to_locs) {
+    if (OpenAPI_json_write_array_start(writer, "routeToLocs") == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [route_to_locs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *route_to_locs_node;
+    if (af_routing_requirement_rm->route_to_locs) {
+        OpenAPI_list_for_each(af_routing_requirement_rm->route_to_locs, route_to_locs_node) {
+            if (OpenAPI_route_to_location_writeJSON(writer, NULL, route_to_locs_node->data) == false) {
+                ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [route_to_locs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [route_to_locs]");
+        goto end;
+    }
+    }
+
+    if (af_routing_requirement_rm->sp_val) {
+    if (OpenAPI_spatial_validity_rm_writeJSON(writer, "spVal", af_routing_requirement_rm->sp_val) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [sp_val]");
+        goto end;
+    }
+    }
+
+    if (af_routing_requirement_rm->temp_vals) {
+    if (OpenAPI_json_write_array_start(writer, "tempVals") == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [temp_vals]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *temp_vals_node;
+    if (af_routing_requirement_rm->temp_vals) {
+        OpenAPI_list_for_each(af_routing_requirement_rm->temp_vals, temp_vals_node) {
+            if (OpenAPI_temporal_validity_writeJSON(writer, NULL, temp_vals_node->data) == false) {
+                ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [temp_vals]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [temp_vals]");
+        goto end;
+    }
+    }
+
+    if (af_routing_requirement_rm->up_path_chg_sub) {
+    if (OpenAPI_up_path_chg_event_writeJSON(writer, "upPathChgSub", af_routing_requirement_rm->up_path_chg_sub) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [up_path_chg_sub]");
+        goto end;
+    }
+    }
+
+    if (af_routing_requirement_rm->is_addr_preser_ind) {
+    if (OpenAPI_json_write_bool(writer, "addrPreserInd", af_routing_requirement_rm->addr_preser_ind) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [addr_preser_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_af_routing_requirement_rm_writeJSON() failed [AfRoutingRequirementRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_af_routing_requirement_rm_t *OpenAPI_af_routing_requirement_rm_parseFromJSON(cJSON *af_routing_requirement_rmJSON)
 {
     OpenAPI_af_routing_requirement_rm_t *af_routing_requirement_rm_local_var = NULL;
@@ -255,7 +347,6 @@ end:
 OpenAPI_af_routing_requirement_rm_t *OpenAPI_af_routing_requirement_rm_copy(OpenAPI_af_routing_requirement_rm_t *dst, OpenAPI_af_routing_requirement_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_af_routing_requirement_rm_convertToJSON(src);
@@ -264,21 +355,6 @@ OpenAPI_af_routing_requirement_rm_t *OpenAPI_af_routing_requirement_rm_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_af_routing_requirement_rm_free(dst);
     dst = OpenAPI_af_routing_requirement_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_allowed_mtc_provider_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_allowed_mtc_provider_info_t *allowed_mtc_provider_info)
+{
+    if (allowed_mtc_provider_info == NULL) {
+        ogs_error("OpenAPI_allowed_mtc_provider_info_writeJSON() failed [AllowedMtcProviderInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_allowed_mtc_provider_info_writeJSON() failed [AllowedMtcProviderInfo]");
+        return false;
+    }
+    if (allowed_mtc_provider_info->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", allowed_mtc_provider_info->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_allowed_mtc_provider_info_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (allowed_mtc_provider_info->af_id) {
+    if (OpenAPI_json_write_string(writer, "afId", allowed_mtc_provider_info->af_id) == false) {
+        ogs_error("OpenAPI_allowed_mtc_provider_info_writeJSON() failed [af_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_allowed_mtc_provider_info_writeJSON() failed [AllowedMtcProviderInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_allowed_mtc_provider_info_t *OpenAPI_allowed_mtc_provider_info_parseFromJSON(cJSON *allowed_mtc_provider_infoJSON)
 {
     OpenAPI_allowed_mtc_provider_info_t *allowed_mtc_provider_info_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_allowed_mtc_provider_info_t *OpenAPI_allowed_mtc_provider_info_copy(OpenAPI_allowed_mtc_provider_info_t *dst, OpenAPI_allowed_mtc_provider_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_allowed_mtc_provider_info_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_allowed_mtc_provider_info_t *OpenAPI_allowed_mtc_provider_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_allowed_mtc_provider_info_free(dst);
     dst = OpenAPI_allowed_mtc_provider_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -68,6 +68,52 @@ end:
     return item;
 }
 
+bool OpenAPI_allowed_nssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_allowed_nssai_t *allowed_nssai)
+{
+    if (allowed_nssai == NULL) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [AllowedNssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [AllowedNssai]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "allowedSnssaiList") == false) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [allowed_snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_snssai_list_node;
+    if (allowed_nssai->allowed_snssai_list) {
+        OpenAPI_list_for_each(allowed_nssai->allowed_snssai_list, allowed_snssai_list_node) {
+            if (OpenAPI_allowed_snssai_writeJSON(writer, NULL, allowed_snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [allowed_snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [allowed_snssai_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(allowed_nssai->access_type)) == false) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_allowed_nssai_writeJSON() failed [AllowedNssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_parseFromJSON(cJSON *allowed_nssaiJSON)
 {
     OpenAPI_allowed_nssai_t *allowed_nssai_local_var = NULL;
@@ -128,7 +174,6 @@ end:
 OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_copy(OpenAPI_allowed_nssai_t *dst, OpenAPI_allowed_nssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_allowed_nssai_convertToJSON(src);
@@ -137,21 +182,6 @@ OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_copy(OpenAPI_allowed_nssai_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_allowed_nssai_free(dst);
     dst = OpenAPI_allowed_nssai_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "allowed_snssai.h"
 
@@ -32,6 +33,7 @@ OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_create(
 void OpenAPI_allowed_nssai_free(OpenAPI_allowed_nssai_t *allowed_nssai);
 OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_parseFromJSON(cJSON *allowed_nssaiJSON);
 cJSON *OpenAPI_allowed_nssai_convertToJSON(OpenAPI_allowed_nssai_t *allowed_nssai);
+bool OpenAPI_allowed_nssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_allowed_nssai_t *allowed_nssai);
 OpenAPI_allowed_nssai_t *OpenAPI_allowed_nssai_copy(OpenAPI_allowed_nssai_t *dst, OpenAPI_allowed_nssai_t *src);
 
 #ifdef __cplusplus
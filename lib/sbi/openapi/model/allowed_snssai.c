@@ -93,6 +93,61 @@ end:
     return item;
 }
 
+bool OpenAPI_allowed_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_allowed_snssai_t *allowed_snssai)
+{
+    if (allowed_snssai == NULL) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [AllowedSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [AllowedSnssai]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "allowedSnssai", allowed_snssai->allowed_snssai) == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [allowed_snssai]");
+        goto end;
+    }
+
+    if (allowed_snssai->nsi_information_list) {
+    if (OpenAPI_json_write_array_start(writer, "nsiInformationList") == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [nsi_information_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nsi_information_list_node;
+    if (allowed_snssai->nsi_information_list) {
+        OpenAPI_list_for_each(allowed_snssai->nsi_information_list, nsi_information_list_node) {
+            if (OpenAPI_nsi_information_writeJSON(writer, NULL, nsi_information_list_node->data) == false) {
+                ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [nsi_information_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [nsi_information_list]");
+        goto end;
+    }
+    }
+
+    if (allowed_snssai->mapped_home_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "mappedHomeSnssai", allowed_snssai->mapped_home_snssai) == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [mapped_home_snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_allowed_snssai_writeJSON() failed [AllowedSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_parseFromJSON(cJSON *allowed_snssaiJSON)
 {
     OpenAPI_allowed_snssai_t *allowed_snssai_local_var = NULL;
@@ -155,7 +210,6 @@ end:
 OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_copy(OpenAPI_allowed_snssai_t *dst, OpenAPI_allowed_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_allowed_snssai_convertToJSON(src);
@@ -164,21 +218,6 @@ OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_copy(OpenAPI_allowed_snssai_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_allowed_snssai_free(dst);
     dst = OpenAPI_allowed_snssai_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nsi_information.h"
 #include "snssai.h"
 
@@ -34,6 +35,7 @@ OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_create(
 void OpenAPI_allowed_snssai_free(OpenAPI_allowed_snssai_t *allowed_snssai);
 OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_parseFromJSON(cJSON *allowed_snssaiJSON);
 cJSON *OpenAPI_allowed_snssai_convertToJSON(OpenAPI_allowed_snssai_t *allowed_snssai);
+bool OpenAPI_allowed_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_allowed_snssai_t *allowed_snssai);
 OpenAPI_allowed_snssai_t *OpenAPI_allowed_snssai_copy(OpenAPI_allowed_snssai_t *dst, OpenAPI_allowed_snssai_t *src);
 
 #ifdef __cplusplus
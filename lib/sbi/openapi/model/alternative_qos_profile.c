@@ -85,6 +85,61 @@ end:
     return item;
 }
 
+bool OpenAPI_alternative_qos_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_alternative_qos_profile_t *alternative_qos_profile)
+{
+    if (alternative_qos_profile == NULL) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [AlternativeQosProfile]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [AlternativeQosProfile]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "index", alternative_qos_profile->index) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [index]");
+        goto end;
+    }
+
+    if (alternative_qos_profile->gua_fbr_dl) {
+    if (OpenAPI_json_write_string(writer, "guaFbrDl", alternative_qos_profile->gua_fbr_dl) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [gua_fbr_dl]");
+        goto end;
+    }
+    }
+
+    if (alternative_qos_profile->gua_fbr_ul) {
+    if (OpenAPI_json_write_string(writer, "guaFbrUl", alternative_qos_profile->gua_fbr_ul) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [gua_fbr_ul]");
+        goto end;
+    }
+    }
+
+    if (alternative_qos_profile->is_packet_delay_budget) {
+    if (OpenAPI_json_write_number(writer, "packetDelayBudget", alternative_qos_profile->packet_delay_budget) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [packet_delay_budget]");
+        goto end;
+    }
+    }
+
+    if (alternative_qos_profile->packet_err_rate) {
+    if (OpenAPI_json_write_string(writer, "packetErrRate", alternative_qos_profile->packet_err_rate) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [packet_err_rate]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_alternative_qos_profile_writeJSON() failed [AlternativeQosProfile]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_alternative_qos_profile_t *OpenAPI_alternative_qos_profile_parseFromJSON(cJSON *alternative_qos_profileJSON)
 {
     OpenAPI_alternative_qos_profile_t *alternative_qos_profile_local_var = NULL;
@@ -153,7 +208,6 @@ end:
 OpenAPI_alternative_qos_profile_t *OpenAPI_alternative_qos_profile_copy(OpenAPI_alternative_qos_profile_t *dst, OpenAPI_alternative_qos_profile_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_alternative_qos_profile_convertToJSON(src);
@@ -162,21 +216,6 @@ OpenAPI_alternative_qos_profile_t *OpenAPI_alternative_qos_profile_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_alternative_qos_profile_free(dst);
     dst = OpenAPI_alternative_qos_profile_parseFromJSON(item);
     cJSON_Delete(item);
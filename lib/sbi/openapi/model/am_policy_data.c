@@ -91,6 +91,70 @@ end:
     return item;
 }
 
+bool OpenAPI_am_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_am_policy_data_t *am_policy_data)
+{
+    if (am_policy_data == NULL) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [AmPolicyData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [AmPolicyData]");
+        return false;
+    }
+    if (am_policy_data->pra_infos) {
+    if (OpenAPI_json_write_object_start(writer, "praInfos") == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pra_infos_node;
+    if (am_policy_data->pra_infos) {
+        OpenAPI_list_for_each(am_policy_data->pra_infos, pra_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pra_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_am_policy_data_writeJSON() failed [pra_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    }
+
+    if (am_policy_data->subsc_cats) {
+    if (OpenAPI_json_write_array_start(writer, "subscCats") == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subsc_cats_node;
+    OpenAPI_list_for_each(am_policy_data->subsc_cats, subsc_cats_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)subsc_cats_node->data) == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_am_policy_data_writeJSON() failed [AmPolicyData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_parseFromJSON(cJSON *am_policy_dataJSON)
 {
     OpenAPI_am_policy_data_t *am_policy_data_local_var = NULL;
@@ -153,7 +217,6 @@ end:
 OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_copy(OpenAPI_am_policy_data_t *dst, OpenAPI_am_policy_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_am_policy_data_convertToJSON(src);
@@ -162,21 +225,6 @@ OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_copy(OpenAPI_am_policy_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_am_policy_data_free(dst);
     dst = OpenAPI_am_policy_data_parseFromJSON(item);
     cJSON_Delete(item);
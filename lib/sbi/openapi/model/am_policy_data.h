@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "presence_info.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_create(
 void OpenAPI_am_policy_data_free(OpenAPI_am_policy_data_t *am_policy_data);
 OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_parseFromJSON(cJSON *am_policy_dataJSON);
 cJSON *OpenAPI_am_policy_data_convertToJSON(OpenAPI_am_policy_data_t *am_policy_data);
+bool OpenAPI_am_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_am_policy_data_t *am_policy_data);
 OpenAPI_am_policy_data_t *OpenAPI_am_policy_data_copy(OpenAPI_am_policy_data_t *dst, OpenAPI_am_policy_data_t *src);
 
 #ifdef __cplusplus
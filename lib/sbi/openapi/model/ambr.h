@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_ambr_t *OpenAPI_ambr_create(
 void OpenAPI_ambr_free(OpenAPI_ambr_t *ambr);
 OpenAPI_ambr_t *OpenAPI_ambr_parseFromJSON(cJSON *ambrJSON);
 cJSON *OpenAPI_ambr_convertToJSON(OpenAPI_ambr_t *ambr);
+bool OpenAPI_ambr_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ambr_t *ambr);
 OpenAPI_ambr_t *OpenAPI_ambr_copy(OpenAPI_ambr_t *dst, OpenAPI_ambr_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ambr_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ambr_1_t *ambr_1)
+{
+    if (ambr_1 == NULL) {
+        ogs_error("OpenAPI_ambr_1_writeJSON() failed [Ambr_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ambr_1_writeJSON() failed [Ambr_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "uplink", ambr_1->uplink) == false) {
+        ogs_error("OpenAPI_ambr_1_writeJSON() failed [uplink]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "downlink", ambr_1->downlink) == false) {
+        ogs_error("OpenAPI_ambr_1_writeJSON() failed [downlink]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ambr_1_writeJSON() failed [Ambr_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ambr_1_t *OpenAPI_ambr_1_parseFromJSON(cJSON *ambr_1JSON)
 {
     OpenAPI_ambr_1_t *ambr_1_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_ambr_1_t *OpenAPI_ambr_1_copy(OpenAPI_ambr_1_t *dst, OpenAPI_ambr_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ambr_1_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_ambr_1_t *OpenAPI_ambr_1_copy(OpenAPI_ambr_1_t *dst, OpenAPI_ambr_1_t *s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ambr_1_free(dst);
     dst = OpenAPI_ambr_1_parseFromJSON(item);
     cJSON_Delete(item);
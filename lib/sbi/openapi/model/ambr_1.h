@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_ambr_1_t *OpenAPI_ambr_1_create(
 void OpenAPI_ambr_1_free(OpenAPI_ambr_1_t *ambr_1);
 OpenAPI_ambr_1_t *OpenAPI_ambr_1_parseFromJSON(cJSON *ambr_1JSON);
 cJSON *OpenAPI_ambr_1_convertToJSON(OpenAPI_ambr_1_t *ambr_1);
+bool OpenAPI_ambr_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ambr_1_t *ambr_1);
 OpenAPI_ambr_1_t *OpenAPI_ambr_1_copy(OpenAPI_ambr_1_t *dst, OpenAPI_ambr_1_t *src);
 
 #ifdef __cplusplus
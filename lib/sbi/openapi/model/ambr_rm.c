@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ambr_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ambr_rm_t *ambr_rm)
+{
+    if (ambr_rm == NULL) {
+        ogs_error("OpenAPI_ambr_rm_writeJSON() failed [AmbrRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ambr_rm_writeJSON() failed [AmbrRm]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "uplink", ambr_rm->uplink) == false) {
+        ogs_error("OpenAPI_ambr_rm_writeJSON() failed [uplink]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "downlink", ambr_rm->downlink) == false) {
+        ogs_error("OpenAPI_ambr_rm_writeJSON() failed [downlink]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ambr_rm_writeJSON() failed [AmbrRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_parseFromJSON(cJSON *ambr_rmJSON)
 {
     OpenAPI_ambr_rm_t *ambr_rm_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_copy(OpenAPI_ambr_rm_t *dst, OpenAPI_ambr_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ambr_rm_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_copy(OpenAPI_ambr_rm_t *dst, OpenAPI_ambr_rm_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ambr_rm_free(dst);
     dst = OpenAPI_ambr_rm_parseFromJSON(item);
     cJSON_Delete(item);
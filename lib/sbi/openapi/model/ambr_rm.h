@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "null_value.h"
 
@@ -32,6 +33,7 @@ OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_create(
 void OpenAPI_ambr_rm_free(OpenAPI_ambr_rm_t *ambr_rm);
 OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_parseFromJSON(cJSON *ambr_rmJSON);
 cJSON *OpenAPI_ambr_rm_convertToJSON(OpenAPI_ambr_rm_t *ambr_rm);
+bool OpenAPI_ambr_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ambr_rm_t *ambr_rm);
 OpenAPI_ambr_rm_t *OpenAPI_ambr_rm_copy(OpenAPI_ambr_rm_t *dst, OpenAPI_ambr_rm_t *src);
 
 #ifdef __cplusplus
@@ -134,6 +134,89 @@ end:
     return item;
 }
 
+bool OpenAPI_amf3_gpp_access_registration_modification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf3_gpp_access_registration_modification_t *amf3_gpp_access_registration_modification)
+{
+    if (amf3_gpp_access_registration_modification == NULL) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [Amf3GppAccessRegistrationModification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [Amf3GppAccessRegistrationModification]");
+        return false;
+    }
+    if (OpenAPI_guami_writeJSON(writer, "guami", amf3_gpp_access_registration_modification->guami) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [guami]");
+        goto end;
+    }
+
+    if (amf3_gpp_access_registration_modification->is_purge_flag) {
+    if (OpenAPI_json_write_bool(writer, "purgeFlag", amf3_gpp_access_registration_modification->purge_flag) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [purge_flag]");
+        goto end;
+    }
+    }
+
+    if (amf3_gpp_access_registration_modification->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", amf3_gpp_access_registration_modification->pei) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (amf3_gpp_access_registration_modification->ims_vo_ps) {
+    if (OpenAPI_json_write_string(writer, "imsVoPs", OpenAPI_ims_vo_ps_ToString(amf3_gpp_access_registration_modification->ims_vo_ps)) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [ims_vo_ps]");
+        goto end;
+    }
+    }
+
+    if (amf3_gpp_access_registration_modification->backup_amf_info) {
+    if (OpenAPI_json_write_array_start(writer, "backupAmfInfo") == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_amf_info_node;
+    if (amf3_gpp_access_registration_modification->backup_amf_info) {
+        OpenAPI_list_for_each(amf3_gpp_access_registration_modification->backup_amf_info, backup_amf_info_node) {
+            if (OpenAPI_backup_amf_info_writeJSON(writer, NULL, backup_amf_info_node->data) == false) {
+                ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+    }
+
+    if (amf3_gpp_access_registration_modification->eps_interworking_info) {
+    if (OpenAPI_eps_interworking_info_writeJSON(writer, "epsInterworkingInfo", amf3_gpp_access_registration_modification->eps_interworking_info) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [eps_interworking_info]");
+        goto end;
+    }
+    }
+
+    if (amf3_gpp_access_registration_modification->is_ue_srvcc_capability) {
+    if (OpenAPI_json_write_bool(writer, "ueSrvccCapability", amf3_gpp_access_registration_modification->ue_srvcc_capability) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [ue_srvcc_capability]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf3_gpp_access_registration_modification_writeJSON() failed [Amf3GppAccessRegistrationModification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf3_gpp_access_registration_modification_t *OpenAPI_amf3_gpp_access_registration_modification_parseFromJSON(cJSON *amf3_gpp_access_registration_modificationJSON)
 {
     OpenAPI_amf3_gpp_access_registration_modification_t *amf3_gpp_access_registration_modification_local_var = NULL;
@@ -240,7 +323,6 @@ end:
 OpenAPI_amf3_gpp_access_registration_modification_t *OpenAPI_amf3_gpp_access_registration_modification_copy(OpenAPI_amf3_gpp_access_registration_modification_t *dst, OpenAPI_amf3_gpp_access_registration_modification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf3_gpp_access_registration_modification_convertToJSON(src);
@@ -249,21 +331,6 @@ OpenAPI_amf3_gpp_access_registration_modification_t *OpenAPI_amf3_gpp_access_reg
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf3_gpp_access_registration_modification_free(dst);
     dst = OpenAPI_amf3_gpp_access_registration_modification_parseFromJSON(item);
     cJSON_Delete(item);
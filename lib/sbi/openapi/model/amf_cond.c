@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_cond_t *amf_cond)
+{
+    if (amf_cond == NULL) {
+        ogs_error("OpenAPI_amf_cond_writeJSON() failed [AmfCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_cond_writeJSON() failed [AmfCond]");
+        return false;
+    }
+    if (amf_cond->amf_set_id) {
+    if (OpenAPI_json_write_string(writer, "amfSetId", amf_cond->amf_set_id) == false) {
+        ogs_error("OpenAPI_amf_cond_writeJSON() failed [amf_set_id]");
+        goto end;
+    }
+    }
+
+    if (amf_cond->amf_region_id) {
+    if (OpenAPI_json_write_string(writer, "amfRegionId", amf_cond->amf_region_id) == false) {
+        ogs_error("OpenAPI_amf_cond_writeJSON() failed [amf_region_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_cond_writeJSON() failed [AmfCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_cond_t *OpenAPI_amf_cond_parseFromJSON(cJSON *amf_condJSON)
 {
     OpenAPI_amf_cond_t *amf_cond_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_amf_cond_t *OpenAPI_amf_cond_copy(OpenAPI_amf_cond_t *dst, OpenAPI_amf_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_cond_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_amf_cond_t *OpenAPI_amf_cond_copy(OpenAPI_amf_cond_t *dst, OpenAPI_amf_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_cond_free(dst);
     dst = OpenAPI_amf_cond_parseFromJSON(item);
     cJSON_Delete(item);
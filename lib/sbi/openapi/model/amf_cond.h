@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_amf_cond_t *OpenAPI_amf_cond_create(
 void OpenAPI_amf_cond_free(OpenAPI_amf_cond_t *amf_cond);
 OpenAPI_amf_cond_t *OpenAPI_amf_cond_parseFromJSON(cJSON *amf_condJSON);
 cJSON *OpenAPI_amf_cond_convertToJSON(OpenAPI_amf_cond_t *amf_cond);
+bool OpenAPI_amf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_cond_t *amf_cond);
 OpenAPI_amf_cond_t *OpenAPI_amf_cond_copy(OpenAPI_amf_cond_t *dst, OpenAPI_amf_cond_t *src);
 
 #ifdef __cplusplus
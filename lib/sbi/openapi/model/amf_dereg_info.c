@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_dereg_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_dereg_info_t *amf_dereg_info)
+{
+    if (amf_dereg_info == NULL) {
+        ogs_error("OpenAPI_amf_dereg_info_writeJSON() failed [AmfDeregInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_dereg_info_writeJSON() failed [AmfDeregInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "deregReason", OpenAPI_deregistration_reason_ToString(amf_dereg_info->dereg_reason)) == false) {
+        ogs_error("OpenAPI_amf_dereg_info_writeJSON() failed [dereg_reason]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_dereg_info_writeJSON() failed [AmfDeregInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_dereg_info_t *OpenAPI_amf_dereg_info_parseFromJSON(cJSON *amf_dereg_infoJSON)
 {
     OpenAPI_amf_dereg_info_t *amf_dereg_info_local_var = NULL;
@@ -72,7 +99,6 @@ end:
 OpenAPI_amf_dereg_info_t *OpenAPI_amf_dereg_info_copy(OpenAPI_amf_dereg_info_t *dst, OpenAPI_amf_dereg_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_dereg_info_convertToJSON(src);
@@ -81,21 +107,6 @@ OpenAPI_amf_dereg_info_t *OpenAPI_amf_dereg_info_copy(OpenAPI_amf_dereg_info_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_dereg_info_free(dst);
     dst = OpenAPI_amf_dereg_info_parseFromJSON(item);
     cJSON_Delete(item);
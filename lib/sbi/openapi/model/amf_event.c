@@ -200,6 +200,138 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_t *amf_event)
+{
+    if (amf_event == NULL) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [AmfEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [AmfEvent]");
+        return false;
+    }
+    if (OpenAPI_amf_event_type_writeJSON(writer, "type", amf_event->type) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [type]");
+        goto end;
+    }
+
+    if (amf_event->is_immediate_flag) {
+    if (OpenAPI_json_write_bool(writer, "immediateFlag", amf_event->immediate_flag) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [immediate_flag]");
+        goto end;
+    }
+    }
+
+    if (amf_event->area_list) {
+    if (OpenAPI_json_write_array_start(writer, "areaList") == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [area_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *area_list_node;
+    if (amf_event->area_list) {
+        OpenAPI_list_for_each(amf_event->area_list, area_list_node) {
+            if (OpenAPI_amf_event_area_writeJSON(writer, NULL, area_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_event_writeJSON() failed [area_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [area_list]");
+        goto end;
+    }
+    }
+
+    if (amf_event->location_filter_list) {
+    if (OpenAPI_json_write_array_start(writer, "locationFilterList") == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [location_filter_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *location_filter_list_node;
+    if (amf_event->location_filter_list) {
+        OpenAPI_list_for_each(amf_event->location_filter_list, location_filter_list_node) {
+            if (OpenAPI_location_filter_writeJSON(writer, NULL, location_filter_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_event_writeJSON() failed [location_filter_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [location_filter_list]");
+        goto end;
+    }
+    }
+
+    if (amf_event->is_ref_id) {
+    if (OpenAPI_json_write_number(writer, "refId", amf_event->ref_id) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [ref_id]");
+        goto end;
+    }
+    }
+
+    if (amf_event->traffic_descriptor_list) {
+    if (OpenAPI_json_write_array_start(writer, "trafficDescriptorList") == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [traffic_descriptor_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_descriptor_list_node;
+    if (amf_event->traffic_descriptor_list) {
+        OpenAPI_list_for_each(amf_event->traffic_descriptor_list, traffic_descriptor_list_node) {
+            if (OpenAPI_traffic_descriptor_writeJSON(writer, NULL, traffic_descriptor_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_event_writeJSON() failed [traffic_descriptor_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [traffic_descriptor_list]");
+        goto end;
+    }
+    }
+
+    if (amf_event->is_report_ue_reachable) {
+    if (OpenAPI_json_write_bool(writer, "reportUeReachable", amf_event->report_ue_reachable) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [report_ue_reachable]");
+        goto end;
+    }
+    }
+
+    if (amf_event->reachability_filter) {
+    if (OpenAPI_reachability_filter_writeJSON(writer, "reachabilityFilter", amf_event->reachability_filter) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [reachability_filter]");
+        goto end;
+    }
+    }
+
+    if (amf_event->is_max_reports) {
+    if (OpenAPI_json_write_number(writer, "maxReports", amf_event->max_reports) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [max_reports]");
+        goto end;
+    }
+    }
+
+    if (amf_event->is_max_response_time) {
+    if (OpenAPI_json_write_number(writer, "maxResponseTime", amf_event->max_response_time) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [max_response_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_writeJSON() failed [AmfEvent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_t *OpenAPI_amf_event_parseFromJSON(cJSON *amf_eventJSON)
 {
     OpenAPI_amf_event_t *amf_event_local_var = NULL;
@@ -377,7 +509,6 @@ end:
 OpenAPI_amf_event_t *OpenAPI_amf_event_copy(OpenAPI_amf_event_t *dst, OpenAPI_amf_event_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_convertToJSON(src);
@@ -386,21 +517,6 @@ OpenAPI_amf_event_t *OpenAPI_amf_event_copy(OpenAPI_amf_event_t *dst, OpenAPI_am
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_free(dst);
     dst = OpenAPI_amf_event_parseFromJSON(item);
     cJSON_Delete(item);
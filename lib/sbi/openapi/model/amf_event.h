@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_event_area.h"
 #include "amf_event_type.h"
 #include "location_filter.h"
@@ -61,6 +62,7 @@ OpenAPI_amf_event_t *OpenAPI_amf_event_create(
 void OpenAPI_amf_event_free(OpenAPI_amf_event_t *amf_event);
 OpenAPI_amf_event_t *OpenAPI_amf_event_parseFromJSON(cJSON *amf_eventJSON);
 cJSON *OpenAPI_amf_event_convertToJSON(OpenAPI_amf_event_t *amf_event);
+bool OpenAPI_amf_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_t *amf_event);
 OpenAPI_amf_event_t *OpenAPI_amf_event_copy(OpenAPI_amf_event_t *dst, OpenAPI_amf_event_t *src);
 
 #ifdef __cplusplus
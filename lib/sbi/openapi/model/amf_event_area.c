@@ -95,6 +95,56 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_area_t *amf_event_area)
+{
+    if (amf_event_area == NULL) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [AmfEventArea]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [AmfEventArea]");
+        return false;
+    }
+    if (amf_event_area->presence_info) {
+    if (OpenAPI_presence_info_writeJSON(writer, "presenceInfo", amf_event_area->presence_info) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [presence_info]");
+        goto end;
+    }
+    }
+
+    if (amf_event_area->ladn_info) {
+    if (OpenAPI_ladn_info_writeJSON(writer, "ladnInfo", amf_event_area->ladn_info) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [ladn_info]");
+        goto end;
+    }
+    }
+
+    if (amf_event_area->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", amf_event_area->s_nssai) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (amf_event_area->nsi_id) {
+    if (OpenAPI_json_write_string(writer, "nsiId", amf_event_area->nsi_id) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [nsi_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_area_writeJSON() failed [AmfEventArea]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_parseFromJSON(cJSON *amf_event_areaJSON)
 {
     OpenAPI_amf_event_area_t *amf_event_area_local_var = NULL;
@@ -143,7 +193,6 @@ end:
 OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_copy(OpenAPI_amf_event_area_t *dst, OpenAPI_amf_event_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_area_convertToJSON(src);
@@ -152,21 +201,6 @@ OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_copy(OpenAPI_amf_event_area_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_area_free(dst);
     dst = OpenAPI_amf_event_area_parseFromJSON(item);
     cJSON_Delete(item);
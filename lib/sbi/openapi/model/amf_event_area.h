@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ladn_info.h"
 #include "presence_info.h"
 #include "snssai.h"
@@ -37,6 +38,7 @@ OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_create(
 void OpenAPI_amf_event_area_free(OpenAPI_amf_event_area_t *amf_event_area);
 OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_parseFromJSON(cJSON *amf_event_areaJSON);
 cJSON *OpenAPI_amf_event_area_convertToJSON(OpenAPI_amf_event_area_t *amf_event_area);
+bool OpenAPI_amf_event_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_area_t *amf_event_area);
 OpenAPI_amf_event_area_t *OpenAPI_amf_event_area_copy(OpenAPI_amf_event_area_t *dst, OpenAPI_amf_event_area_t *src);
 
 #ifdef __cplusplus
@@ -94,6 +94,61 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_mode_t *amf_event_mode)
+{
+    if (amf_event_mode == NULL) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [AmfEventMode]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [AmfEventMode]");
+        return false;
+    }
+    if (OpenAPI_amf_event_trigger_writeJSON(writer, "trigger", amf_event_mode->trigger) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [trigger]");
+        goto end;
+    }
+
+    if (amf_event_mode->is_max_reports) {
+    if (OpenAPI_json_write_number(writer, "maxReports", amf_event_mode->max_reports) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [max_reports]");
+        goto end;
+    }
+    }
+
+    if (amf_event_mode->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", amf_event_mode->expiry) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (amf_event_mode->is_rep_period) {
+    if (OpenAPI_json_write_number(writer, "repPeriod", amf_event_mode->rep_period) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [rep_period]");
+        goto end;
+    }
+    }
+
+    if (amf_event_mode->is_samp_ratio) {
+    if (OpenAPI_json_write_number(writer, "sampRatio", amf_event_mode->samp_ratio) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [samp_ratio]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_mode_writeJSON() failed [AmfEventMode]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_parseFromJSON(cJSON *amf_event_modeJSON)
 {
     OpenAPI_amf_event_mode_t *amf_event_mode_local_var = NULL;
@@ -161,7 +216,6 @@ end:
 OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_copy(OpenAPI_amf_event_mode_t *dst, OpenAPI_amf_event_mode_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_mode_convertToJSON(src);
@@ -170,21 +224,6 @@ OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_copy(OpenAPI_amf_event_mode_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_mode_free(dst);
     dst = OpenAPI_amf_event_mode_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_event_trigger.h"
 
 #ifdef __cplusplus
@@ -43,6 +44,7 @@ OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_create(
 void OpenAPI_amf_event_mode_free(OpenAPI_amf_event_mode_t *amf_event_mode);
 OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_parseFromJSON(cJSON *amf_event_modeJSON);
 cJSON *OpenAPI_amf_event_mode_convertToJSON(OpenAPI_amf_event_mode_t *amf_event_mode);
+bool OpenAPI_amf_event_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_mode_t *amf_event_mode);
 OpenAPI_amf_event_mode_t *OpenAPI_amf_event_mode_copy(OpenAPI_amf_event_mode_t *dst, OpenAPI_amf_event_mode_t *src);
 
 #ifdef __cplusplus
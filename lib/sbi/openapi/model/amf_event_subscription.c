@@ -181,6 +181,125 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_subscription_t *amf_event_subscription)
+{
+    if (amf_event_subscription == NULL) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [AmfEventSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [AmfEventSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "eventList") == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [event_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *event_list_node;
+    if (amf_event_subscription->event_list) {
+        OpenAPI_list_for_each(amf_event_subscription->event_list, event_list_node) {
+            if (OpenAPI_amf_event_writeJSON(writer, NULL, event_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [event_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [event_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "eventNotifyUri", amf_event_subscription->event_notify_uri) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [event_notify_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "notifyCorrelationId", amf_event_subscription->notify_correlation_id) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [notify_correlation_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfId", amf_event_subscription->nf_id) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [nf_id]");
+        goto end;
+    }
+
+    if (amf_event_subscription->subs_change_notify_uri) {
+    if (OpenAPI_json_write_string(writer, "subsChangeNotifyUri", amf_event_subscription->subs_change_notify_uri) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [subs_change_notify_uri]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->subs_change_notify_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "subsChangeNotifyCorrelationId", amf_event_subscription->subs_change_notify_correlation_id) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [subs_change_notify_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", amf_event_subscription->supi) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", amf_event_subscription->group_id) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", amf_event_subscription->gpsi) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", amf_event_subscription->pei) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->is_any_ue) {
+    if (OpenAPI_json_write_bool(writer, "anyUE", amf_event_subscription->any_ue) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [any_ue]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->options) {
+    if (OpenAPI_amf_event_mode_writeJSON(writer, "options", amf_event_subscription->options) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [options]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription->source_nf_type) {
+    if (OpenAPI_json_write_string(writer, "sourceNfType", OpenAPI_nf_type_ToString(amf_event_subscription->source_nf_type)) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [source_nf_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_writeJSON() failed [AmfEventSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_parseFromJSON(cJSON *amf_event_subscriptionJSON)
 {
     OpenAPI_amf_event_subscription_t *amf_event_subscription_local_var = NULL;
@@ -354,7 +473,6 @@ end:
 OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_copy(OpenAPI_amf_event_subscription_t *dst, OpenAPI_amf_event_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_subscription_convertToJSON(src);
@@ -363,21 +481,6 @@ OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_copy(OpenAPI_am
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_subscription_free(dst);
     dst = OpenAPI_amf_event_subscription_parseFromJSON(item);
     cJSON_Delete(item);
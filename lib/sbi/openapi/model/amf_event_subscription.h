@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_event.h"
 #include "amf_event_mode.h"
 #include "nf_type.h"
@@ -57,6 +58,7 @@ OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_create(
 void OpenAPI_amf_event_subscription_free(OpenAPI_amf_event_subscription_t *amf_event_subscription);
 OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_parseFromJSON(cJSON *amf_event_subscriptionJSON);
 cJSON *OpenAPI_amf_event_subscription_convertToJSON(OpenAPI_amf_event_subscription_t *amf_event_subscription);
+bool OpenAPI_amf_event_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_subscription_t *amf_event_subscription);
 OpenAPI_amf_event_subscription_t *OpenAPI_amf_event_subscription_copy(OpenAPI_amf_event_subscription_t *dst, OpenAPI_amf_event_subscription_t *src);
 
 #ifdef __cplusplus
@@ -68,6 +68,54 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_subscription_add_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_subscription_add_info_t *amf_event_subscription_add_info)
+{
+    if (amf_event_subscription_add_info == NULL) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [AmfEventSubscriptionAddInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [AmfEventSubscriptionAddInfo]");
+        return false;
+    }
+    if (amf_event_subscription_add_info->binding_info) {
+    if (OpenAPI_json_write_array_start(writer, "bindingInfo") == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [binding_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *binding_info_node;
+    OpenAPI_list_for_each(amf_event_subscription_add_info->binding_info, binding_info_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)binding_info_node->data) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [binding_info]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [binding_info]");
+        goto end;
+    }
+    }
+
+    if (amf_event_subscription_add_info->subscribing_nf_type) {
+    if (OpenAPI_json_write_string(writer, "subscribingNfType", OpenAPI_nf_type_ToString(amf_event_subscription_add_info->subscribing_nf_type)) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [subscribing_nf_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_subscription_add_info_writeJSON() failed [AmfEventSubscriptionAddInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_subscription_add_info_t *OpenAPI_amf_event_subscription_add_info_parseFromJSON(cJSON *amf_event_subscription_add_infoJSON)
 {
     OpenAPI_amf_event_subscription_add_info_t *amf_event_subscription_add_info_local_var = NULL;
@@ -115,7 +163,6 @@ end:
 OpenAPI_amf_event_subscription_add_info_t *OpenAPI_amf_event_subscription_add_info_copy(OpenAPI_amf_event_subscription_add_info_t *dst, OpenAPI_amf_event_subscription_add_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_subscription_add_info_convertToJSON(src);
@@ -124,21 +171,6 @@ OpenAPI_amf_event_subscription_add_info_t *OpenAPI_amf_event_subscription_add_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_subscription_add_info_free(dst);
     dst = OpenAPI_amf_event_subscription_add_info_parseFromJSON(item);
     cJSON_Delete(item);
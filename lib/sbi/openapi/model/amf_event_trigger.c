@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_event_trigger_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_trigger_t *amf_event_trigger)
+{
+    if (amf_event_trigger == NULL) {
+        ogs_error("OpenAPI_amf_event_trigger_writeJSON() failed [AmfEventTrigger]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_event_trigger_writeJSON() failed [AmfEventTrigger]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_event_trigger_writeJSON() failed [AmfEventTrigger]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_parseFromJSON(cJSON *amf_event_triggerJSON)
 {
     OpenAPI_amf_event_trigger_t *amf_event_trigger_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_copy(OpenAPI_amf_event_trigger_t *dst, OpenAPI_amf_event_trigger_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_event_trigger_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_copy(OpenAPI_amf_event_tr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_event_trigger_free(dst);
     dst = OpenAPI_amf_event_trigger_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_event_trigger_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_create(
 void OpenAPI_amf_event_trigger_free(OpenAPI_amf_event_trigger_t *amf_event_trigger);
 OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_parseFromJSON(cJSON *amf_event_triggerJSON);
 cJSON *OpenAPI_amf_event_trigger_convertToJSON(OpenAPI_amf_event_trigger_t *amf_event_trigger);
+bool OpenAPI_amf_event_trigger_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_trigger_t *amf_event_trigger);
 OpenAPI_amf_event_trigger_t *OpenAPI_amf_event_trigger_copy(OpenAPI_amf_event_trigger_t *dst, OpenAPI_amf_event_trigger_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_event_type_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_amf_event_type_t *OpenAPI_amf_event_type_create(
 void OpenAPI_amf_event_type_free(OpenAPI_amf_event_type_t *amf_event_type);
 OpenAPI_amf_event_type_t *OpenAPI_amf_event_type_parseFromJSON(cJSON *amf_event_typeJSON);
 cJSON *OpenAPI_amf_event_type_convertToJSON(OpenAPI_amf_event_type_t *amf_event_type);
+bool OpenAPI_amf_event_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_event_type_t *amf_event_type);
 OpenAPI_amf_event_type_t *OpenAPI_amf_event_type_copy(OpenAPI_amf_event_type_t *dst, OpenAPI_amf_event_type_t *src);
 
 #ifdef __cplusplus
@@ -197,6 +197,148 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_info_t *amf_info)
+{
+    if (amf_info == NULL) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [AmfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [AmfInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "amfSetId", amf_info->amf_set_id) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [amf_set_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "amfRegionId", amf_info->amf_region_id) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [amf_region_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (amf_info->guami_list) {
+        OpenAPI_list_for_each(amf_info->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_info_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    if (amf_info->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (amf_info->tai_list) {
+        OpenAPI_list_for_each(amf_info->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (amf_info->tai_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiRangeList") == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_range_list_node;
+    if (amf_info->tai_range_list) {
+        OpenAPI_list_for_each(amf_info->tai_range_list, tai_range_list_node) {
+            if (OpenAPI_tai_range_writeJSON(writer, NULL, tai_range_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+    }
+
+    if (amf_info->backup_info_amf_failure) {
+    if (OpenAPI_json_write_array_start(writer, "backupInfoAmfFailure") == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_failure]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_info_amf_failure_node;
+    if (amf_info->backup_info_amf_failure) {
+        OpenAPI_list_for_each(amf_info->backup_info_amf_failure, backup_info_amf_failure_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, backup_info_amf_failure_node->data) == false) {
+                ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_failure]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_failure]");
+        goto end;
+    }
+    }
+
+    if (amf_info->backup_info_amf_removal) {
+    if (OpenAPI_json_write_array_start(writer, "backupInfoAmfRemoval") == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_removal]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_info_amf_removal_node;
+    if (amf_info->backup_info_amf_removal) {
+        OpenAPI_list_for_each(amf_info->backup_info_amf_removal, backup_info_amf_removal_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, backup_info_amf_removal_node->data) == false) {
+                ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_removal]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [backup_info_amf_removal]");
+        goto end;
+    }
+    }
+
+    if (amf_info->n2_interface_amf_info) {
+    if (OpenAPI_n2_interface_amf_info_writeJSON(writer, "n2InterfaceAmfInfo", amf_info->n2_interface_amf_info) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [n2_interface_amf_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_info_writeJSON() failed [AmfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_info_t *OpenAPI_amf_info_parseFromJSON(cJSON *amf_infoJSON)
 {
     OpenAPI_amf_info_t *amf_info_local_var = NULL;
@@ -395,7 +537,6 @@ end:
 OpenAPI_amf_info_t *OpenAPI_amf_info_copy(OpenAPI_amf_info_t *dst, OpenAPI_amf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_info_convertToJSON(src);
@@ -404,21 +545,6 @@ OpenAPI_amf_info_t *OpenAPI_amf_info_copy(OpenAPI_amf_info_t *dst, OpenAPI_amf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_info_free(dst);
     dst = OpenAPI_amf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "guami.h"
 #include "n2_interface_amf_info.h"
 #include "tai.h"
@@ -46,6 +47,7 @@ OpenAPI_amf_info_t *OpenAPI_amf_info_create(
 void OpenAPI_amf_info_free(OpenAPI_amf_info_t *amf_info);
 OpenAPI_amf_info_t *OpenAPI_amf_info_parseFromJSON(cJSON *amf_infoJSON);
 cJSON *OpenAPI_amf_info_convertToJSON(OpenAPI_amf_info_t *amf_info);
+bool OpenAPI_amf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_info_t *amf_info);
 OpenAPI_amf_info_t *OpenAPI_amf_info_copy(OpenAPI_amf_info_t *dst, OpenAPI_amf_info_t *src);
 
 #ifdef __cplusplus
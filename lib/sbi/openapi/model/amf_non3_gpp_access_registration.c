@@ -252,6 +252,165 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_non3_gpp_access_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_non3_gpp_access_registration_t *amf_non3_gpp_access_registration)
+{
+    if (amf_non3_gpp_access_registration == NULL) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [AmfNon3GppAccessRegistration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [AmfNon3GppAccessRegistration]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "amfInstanceId", amf_non3_gpp_access_registration->amf_instance_id) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [amf_instance_id]");
+        goto end;
+    }
+
+    if (amf_non3_gpp_access_registration->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", amf_non3_gpp_access_registration->supported_features) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->is_purge_flag) {
+    if (OpenAPI_json_write_bool(writer, "purgeFlag", amf_non3_gpp_access_registration->purge_flag) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [purge_flag]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", amf_non3_gpp_access_registration->pei) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "imsVoPs", OpenAPI_ims_vo_ps_ToString(amf_non3_gpp_access_registration->ims_vo_ps)) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [ims_vo_ps]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "deregCallbackUri", amf_non3_gpp_access_registration->dereg_callback_uri) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [dereg_callback_uri]");
+        goto end;
+    }
+
+    if (amf_non3_gpp_access_registration->amf_service_name_dereg) {
+    if (OpenAPI_json_write_string(writer, "amfServiceNameDereg", amf_non3_gpp_access_registration->amf_service_name_dereg) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [amf_service_name_dereg]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->pcscf_restoration_callback_uri) {
+    if (OpenAPI_json_write_string(writer, "pcscfRestorationCallbackUri", amf_non3_gpp_access_registration->pcscf_restoration_callback_uri) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [pcscf_restoration_callback_uri]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->amf_service_name_pcscf_rest) {
+    if (OpenAPI_json_write_string(writer, "amfServiceNamePcscfRest", amf_non3_gpp_access_registration->amf_service_name_pcscf_rest) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [amf_service_name_pcscf_rest]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_guami_writeJSON(writer, "guami", amf_non3_gpp_access_registration->guami) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [guami]");
+        goto end;
+    }
+
+    if (amf_non3_gpp_access_registration->backup_amf_info) {
+    if (OpenAPI_json_write_array_start(writer, "backupAmfInfo") == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_amf_info_node;
+    if (amf_non3_gpp_access_registration->backup_amf_info) {
+        OpenAPI_list_for_each(amf_non3_gpp_access_registration->backup_amf_info, backup_amf_info_node) {
+            if (OpenAPI_backup_amf_info_writeJSON(writer, NULL, backup_amf_info_node->data) == false) {
+                ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [backup_amf_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(amf_non3_gpp_access_registration->rat_type)) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [rat_type]");
+        goto end;
+    }
+
+    if (amf_non3_gpp_access_registration->is_urrp_indicator) {
+    if (OpenAPI_json_write_bool(writer, "urrpIndicator", amf_non3_gpp_access_registration->urrp_indicator) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [urrp_indicator]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->amf_ee_subscription_id) {
+    if (OpenAPI_json_write_string(writer, "amfEeSubscriptionId", amf_non3_gpp_access_registration->amf_ee_subscription_id) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [amf_ee_subscription_id]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->registration_time) {
+    if (OpenAPI_json_write_string(writer, "registrationTime", amf_non3_gpp_access_registration->registration_time) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [registration_time]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->vgmlc_address) {
+    if (OpenAPI_vgmlc_address_writeJSON(writer, "vgmlcAddress", amf_non3_gpp_access_registration->vgmlc_address) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [vgmlc_address]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->context_info) {
+    if (OpenAPI_context_info_writeJSON(writer, "contextInfo", amf_non3_gpp_access_registration->context_info) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [context_info]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->is_no_ee_subscription_ind) {
+    if (OpenAPI_json_write_bool(writer, "noEeSubscriptionInd", amf_non3_gpp_access_registration->no_ee_subscription_ind) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [no_ee_subscription_ind]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", amf_non3_gpp_access_registration->supi) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_writeJSON() failed [AmfNon3GppAccessRegistration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_non3_gpp_access_registration_t *OpenAPI_amf_non3_gpp_access_registration_parseFromJSON(cJSON *amf_non3_gpp_access_registrationJSON)
 {
     OpenAPI_amf_non3_gpp_access_registration_t *amf_non3_gpp_access_registration_local_var = NULL;
@@ -487,7 +646,6 @@ end:
 OpenAPI_amf_non3_gpp_access_registration_t *OpenAPI_amf_non3_gpp_access_registration_copy(OpenAPI_amf_non3_gpp_access_registration_t *dst, OpenAPI_amf_non3_gpp_access_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_non3_gpp_access_registration_convertToJSON(src);
@@ -496,21 +654,6 @@ OpenAPI_amf_non3_gpp_access_registration_t *OpenAPI_amf_non3_gpp_access_registra
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_non3_gpp_access_registration_free(dst);
     dst = OpenAPI_amf_non3_gpp_access_registration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -107,6 +107,75 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_non3_gpp_access_registration_modification_t *amf_non3_gpp_access_registration_modification)
+{
+    if (amf_non3_gpp_access_registration_modification == NULL) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [AmfNon3GppAccessRegistrationModification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [AmfNon3GppAccessRegistrationModification]");
+        return false;
+    }
+    if (OpenAPI_guami_writeJSON(writer, "guami", amf_non3_gpp_access_registration_modification->guami) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [guami]");
+        goto end;
+    }
+
+    if (amf_non3_gpp_access_registration_modification->is_purge_flag) {
+    if (OpenAPI_json_write_bool(writer, "purgeFlag", amf_non3_gpp_access_registration_modification->purge_flag) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [purge_flag]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration_modification->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", amf_non3_gpp_access_registration_modification->pei) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration_modification->ims_vo_ps) {
+    if (OpenAPI_json_write_string(writer, "imsVoPs", OpenAPI_ims_vo_ps_ToString(amf_non3_gpp_access_registration_modification->ims_vo_ps)) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [ims_vo_ps]");
+        goto end;
+    }
+    }
+
+    if (amf_non3_gpp_access_registration_modification->backup_amf_info) {
+    if (OpenAPI_json_write_array_start(writer, "backupAmfInfo") == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_amf_info_node;
+    if (amf_non3_gpp_access_registration_modification->backup_amf_info) {
+        OpenAPI_list_for_each(amf_non3_gpp_access_registration_modification->backup_amf_info, backup_amf_info_node) {
+            if (OpenAPI_backup_amf_info_writeJSON(writer, NULL, backup_amf_info_node->data) == false) {
+                ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_non3_gpp_access_registration_modification_writeJSON() failed [AmfNon3GppAccessRegistrationModification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_non3_gpp_access_registration_modification_t *OpenAPI_amf_non3_gpp_access_registration_modification_parseFromJSON(cJSON *amf_non3_gpp_access_registration_modificationJSON)
 {
     OpenAPI_amf_non3_gpp_access_registration_modification_t *amf_non3_gpp_access_registration_modification_local_var = NULL;
@@ -194,7 +263,6 @@ end:
 OpenAPI_amf_non3_gpp_access_registration_modification_t *OpenAPI_amf_non3_gpp_access_registration_modification_copy(OpenAPI_amf_non3_gpp_access_registration_modification_t *dst, OpenAPI_amf_non3_gpp_access_registration_modification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_non3_gpp_access_registration_modification_convertToJSON(src);
@@ -203,21 +271,6 @@ OpenAPI_amf_non3_gpp_access_registration_modification_t *OpenAPI_amf_non3_gpp_ac
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_non3_gpp_access_registration_modification_free(dst);
     dst = OpenAPI_amf_non3_gpp_access_registration_modification_parseFromJSON(item);
     cJSON_Delete(item);
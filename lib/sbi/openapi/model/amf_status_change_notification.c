@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_status_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_status_change_notification_t *amf_status_change_notification)
+{
+    if (amf_status_change_notification == NULL) {
+        ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [AmfStatusChangeNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [AmfStatusChangeNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "amfStatusInfoList") == false) {
+        ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [amf_status_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *amf_status_info_list_node;
+    if (amf_status_change_notification->amf_status_info_list) {
+        OpenAPI_list_for_each(amf_status_change_notification->amf_status_info_list, amf_status_info_list_node) {
+            if (OpenAPI_amf_status_info_writeJSON(writer, NULL, amf_status_info_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [amf_status_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [amf_status_info_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_change_notification_writeJSON() failed [AmfStatusChangeNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification_parseFromJSON(cJSON *amf_status_change_notificationJSON)
 {
     OpenAPI_amf_status_change_notification_t *amf_status_change_notification_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification_copy(OpenAPI_amf_status_change_notification_t *dst, OpenAPI_amf_status_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_status_change_notification_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_status_change_notification_free(dst);
     dst = OpenAPI_amf_status_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
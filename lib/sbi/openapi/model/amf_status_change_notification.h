@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_status_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification
 void OpenAPI_amf_status_change_notification_free(OpenAPI_amf_status_change_notification_t *amf_status_change_notification);
 OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification_parseFromJSON(cJSON *amf_status_change_notificationJSON);
 cJSON *OpenAPI_amf_status_change_notification_convertToJSON(OpenAPI_amf_status_change_notification_t *amf_status_change_notification);
+bool OpenAPI_amf_status_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_status_change_notification_t *amf_status_change_notification);
 OpenAPI_amf_status_change_notification_t *OpenAPI_amf_status_change_notification_copy(OpenAPI_amf_status_change_notification_t *dst, OpenAPI_amf_status_change_notification_t *src);
 
 #ifdef __cplusplus
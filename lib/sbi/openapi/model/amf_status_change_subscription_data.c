@@ -71,6 +71,54 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_status_change_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_status_change_subscription_data_t *amf_status_change_subscription_data)
+{
+    if (amf_status_change_subscription_data == NULL) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [AMFStatusChangeSubscriptionData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [AMFStatusChangeSubscriptionData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "amfStatusUri", amf_status_change_subscription_data->amf_status_uri) == false) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [amf_status_uri]");
+        goto end;
+    }
+
+    if (amf_status_change_subscription_data->guami_list) {
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (amf_status_change_subscription_data->guami_list) {
+        OpenAPI_list_for_each(amf_status_change_subscription_data->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [guami_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_change_subscription_data_writeJSON() failed [AMFStatusChangeSubscriptionData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_status_change_subscription_data_t *OpenAPI_amf_status_change_subscription_data_parseFromJSON(cJSON *amf_status_change_subscription_dataJSON)
 {
     OpenAPI_amf_status_change_subscription_data_t *amf_status_change_subscription_data_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_amf_status_change_subscription_data_t *OpenAPI_amf_status_change_subscription_data_copy(OpenAPI_amf_status_change_subscription_data_t *dst, OpenAPI_amf_status_change_subscription_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_status_change_subscription_data_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_amf_status_change_subscription_data_t *OpenAPI_amf_status_change_subscri
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_status_change_subscription_data_free(dst);
     dst = OpenAPI_amf_status_change_subscription_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -88,6 +88,66 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_status_info_t *amf_status_info)
+{
+    if (amf_status_info == NULL) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [AmfStatusInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [AmfStatusInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (amf_status_info->guami_list) {
+        OpenAPI_list_for_each(amf_status_info->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_amf_status_info_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "statusChange", OpenAPI_status_change_ToString(amf_status_info->status_change)) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [status_change]");
+        goto end;
+    }
+
+    if (amf_status_info->target_amf_removal) {
+    if (OpenAPI_json_write_string(writer, "targetAmfRemoval", amf_status_info->target_amf_removal) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [target_amf_removal]");
+        goto end;
+    }
+    }
+
+    if (amf_status_info->target_amf_failure) {
+    if (OpenAPI_json_write_string(writer, "targetAmfFailure", amf_status_info->target_amf_failure) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [target_amf_failure]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_status_info_writeJSON() failed [AmfStatusInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_parseFromJSON(cJSON *amf_status_infoJSON)
 {
     OpenAPI_amf_status_info_t *amf_status_info_local_var = NULL;
@@ -168,7 +228,6 @@ end:
 OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_copy(OpenAPI_amf_status_info_t *dst, OpenAPI_amf_status_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_status_info_convertToJSON(src);
@@ -177,21 +236,6 @@ OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_copy(OpenAPI_amf_status_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_status_info_free(dst);
     dst = OpenAPI_amf_status_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "guami.h"
 #include "status_change.h"
 
@@ -36,6 +37,7 @@ OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_create(
 void OpenAPI_amf_status_info_free(OpenAPI_amf_status_info_t *amf_status_info);
 OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_parseFromJSON(cJSON *amf_status_infoJSON);
 cJSON *OpenAPI_amf_status_info_convertToJSON(OpenAPI_amf_status_info_t *amf_status_info);
+bool OpenAPI_amf_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_status_info_t *amf_status_info);
 OpenAPI_amf_status_info_t *OpenAPI_amf_status_info_copy(OpenAPI_amf_status_info_t *dst, OpenAPI_amf_status_info_t *src);
 
 #ifdef __cplusplus
@@ -63,6 +63,45 @@ end:
     return item;
 }
 
+bool OpenAPI_amf_subscription_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_amf_subscription_info_t *amf_subscription_info)
+{
+    if (amf_subscription_info == NULL) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [AmfSubscriptionInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [AmfSubscriptionInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "amfInstanceId", amf_subscription_info->amf_instance_id) == false) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [amf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "subscriptionId", amf_subscription_info->subscription_id) == false) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+
+    if (amf_subscription_info->subs_change_notify_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "subsChangeNotifyCorrelationId", amf_subscription_info->subs_change_notify_correlation_id) == false) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [subs_change_notify_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_amf_subscription_info_writeJSON() failed [AmfSubscriptionInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_amf_subscription_info_t *OpenAPI_amf_subscription_info_parseFromJSON(cJSON *amf_subscription_infoJSON)
 {
     OpenAPI_amf_subscription_info_t *amf_subscription_info_local_var = NULL;
@@ -111,7 +150,6 @@ end:
 OpenAPI_amf_subscription_info_t *OpenAPI_amf_subscription_info_copy(OpenAPI_amf_subscription_info_t *dst, OpenAPI_amf_subscription_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_amf_subscription_info_convertToJSON(src);
@@ -120,21 +158,6 @@ OpenAPI_amf_subscription_info_t *OpenAPI_amf_subscription_info_copy(OpenAPI_amf_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_amf_subscription_info_free(dst);
     dst = OpenAPI_amf_subscription_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_an_gw_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_an_gw_address_t *an_gw_address)
+{
+    if (an_gw_address == NULL) {
+        ogs_error("OpenAPI_an_gw_address_writeJSON() failed [AnGwAddress]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_an_gw_address_writeJSON() failed [AnGwAddress]");
+        return false;
+    }
+    if (an_gw_address->an_gw_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "anGwIpv4Addr", an_gw_address->an_gw_ipv4_addr) == false) {
+        ogs_error("OpenAPI_an_gw_address_writeJSON() failed [an_gw_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (an_gw_address->an_gw_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "anGwIpv6Addr", an_gw_address->an_gw_ipv6_addr) == false) {
+        ogs_error("OpenAPI_an_gw_address_writeJSON() failed [an_gw_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_an_gw_address_writeJSON() failed [AnGwAddress]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_parseFromJSON(cJSON *an_gw_addressJSON)
 {
     OpenAPI_an_gw_address_t *an_gw_address_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_copy(OpenAPI_an_gw_address_t *dst, OpenAPI_an_gw_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_an_gw_address_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_copy(OpenAPI_an_gw_address_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_an_gw_address_free(dst);
     dst = OpenAPI_an_gw_address_parseFromJSON(item);
     cJSON_Delete(item);
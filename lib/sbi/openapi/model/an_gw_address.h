@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_create(
 void OpenAPI_an_gw_address_free(OpenAPI_an_gw_address_t *an_gw_address);
 OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_parseFromJSON(cJSON *an_gw_addressJSON);
 cJSON *OpenAPI_an_gw_address_convertToJSON(OpenAPI_an_gw_address_t *an_gw_address);
+bool OpenAPI_an_gw_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_an_gw_address_t *an_gw_address);
 OpenAPI_an_gw_address_t *OpenAPI_an_gw_address_copy(OpenAPI_an_gw_address_t *dst, OpenAPI_an_gw_address_t *src);
 
 #ifdef __cplusplus
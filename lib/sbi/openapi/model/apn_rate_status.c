@@ -91,6 +91,63 @@ end:
     return item;
 }
 
+bool OpenAPI_apn_rate_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_apn_rate_status_t *apn_rate_status)
+{
+    if (apn_rate_status == NULL) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [ApnRateStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [ApnRateStatus]");
+        return false;
+    }
+    if (apn_rate_status->is_remain_packets_ul) {
+    if (OpenAPI_json_write_number(writer, "remainPacketsUl", apn_rate_status->remain_packets_ul) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [remain_packets_ul]");
+        goto end;
+    }
+    }
+
+    if (apn_rate_status->is_remain_packets_dl) {
+    if (OpenAPI_json_write_number(writer, "remainPacketsDl", apn_rate_status->remain_packets_dl) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [remain_packets_dl]");
+        goto end;
+    }
+    }
+
+    if (apn_rate_status->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", apn_rate_status->validity_time) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (apn_rate_status->is_remain_ex_reports_ul) {
+    if (OpenAPI_json_write_number(writer, "remainExReportsUl", apn_rate_status->remain_ex_reports_ul) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [remain_ex_reports_ul]");
+        goto end;
+    }
+    }
+
+    if (apn_rate_status->is_remain_ex_reports_dl) {
+    if (OpenAPI_json_write_number(writer, "remainExReportsDl", apn_rate_status->remain_ex_reports_dl) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [remain_ex_reports_dl]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_apn_rate_status_writeJSON() failed [ApnRateStatus]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_parseFromJSON(cJSON *apn_rate_statusJSON)
 {
     OpenAPI_apn_rate_status_t *apn_rate_status_local_var = NULL;
@@ -159,7 +216,6 @@ end:
 OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_copy(OpenAPI_apn_rate_status_t *dst, OpenAPI_apn_rate_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_apn_rate_status_convertToJSON(src);
@@ -168,21 +224,6 @@ OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_copy(OpenAPI_apn_rate_status_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_apn_rate_status_free(dst);
     dst = OpenAPI_apn_rate_status_parseFromJSON(item);
     cJSON_Delete(item);
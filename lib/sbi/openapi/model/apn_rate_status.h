@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,6 +45,7 @@ OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_create(
 void OpenAPI_apn_rate_status_free(OpenAPI_apn_rate_status_t *apn_rate_status);
 OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_parseFromJSON(cJSON *apn_rate_statusJSON);
 cJSON *OpenAPI_apn_rate_status_convertToJSON(OpenAPI_apn_rate_status_t *apn_rate_status);
+bool OpenAPI_apn_rate_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_apn_rate_status_t *apn_rate_status);
 OpenAPI_apn_rate_status_t *OpenAPI_apn_rate_status_copy(OpenAPI_apn_rate_status_t *dst, OpenAPI_apn_rate_status_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_app_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_descriptor_t *app_descriptor)
+{
+    if (app_descriptor == NULL) {
+        ogs_error("OpenAPI_app_descriptor_writeJSON() failed [AppDescriptor]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_descriptor_writeJSON() failed [AppDescriptor]");
+        return false;
+    }
+    if (app_descriptor->os_id) {
+    if (OpenAPI_json_write_string(writer, "osId", app_descriptor->os_id) == false) {
+        ogs_error("OpenAPI_app_descriptor_writeJSON() failed [os_id]");
+        goto end;
+    }
+    }
+
+    if (app_descriptor->app_id) {
+    if (OpenAPI_json_write_string(writer, "appId", app_descriptor->app_id) == false) {
+        ogs_error("OpenAPI_app_descriptor_writeJSON() failed [app_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_descriptor_writeJSON() failed [AppDescriptor]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_parseFromJSON(cJSON *app_descriptorJSON)
 {
     OpenAPI_app_descriptor_t *app_descriptor_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_copy(OpenAPI_app_descriptor_t *dst, OpenAPI_app_descriptor_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_descriptor_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_copy(OpenAPI_app_descriptor_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_descriptor_free(dst);
     dst = OpenAPI_app_descriptor_parseFromJSON(item);
     cJSON_Delete(item);
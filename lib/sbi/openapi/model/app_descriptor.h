@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_create(
 void OpenAPI_app_descriptor_free(OpenAPI_app_descriptor_t *app_descriptor);
 OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_parseFromJSON(cJSON *app_descriptorJSON);
 cJSON *OpenAPI_app_descriptor_convertToJSON(OpenAPI_app_descriptor_t *app_descriptor);
+bool OpenAPI_app_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_descriptor_t *app_descriptor);
 OpenAPI_app_descriptor_t *OpenAPI_app_descriptor_copy(OpenAPI_app_descriptor_t *dst, OpenAPI_app_descriptor_t *src);
 
 #ifdef __cplusplus
@@ -81,6 +81,61 @@ end:
     return item;
 }
 
+bool OpenAPI_app_detection_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_detection_info_t *app_detection_info)
+{
+    if (app_detection_info == NULL) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [AppDetectionInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [AppDetectionInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "appId", app_detection_info->app_id) == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [app_id]");
+        goto end;
+    }
+
+    if (app_detection_info->instance_id) {
+    if (OpenAPI_json_write_string(writer, "instanceId", app_detection_info->instance_id) == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [instance_id]");
+        goto end;
+    }
+    }
+
+    if (app_detection_info->sdf_descriptions) {
+    if (OpenAPI_json_write_array_start(writer, "sdfDescriptions") == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [sdf_descriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sdf_descriptions_node;
+    if (app_detection_info->sdf_descriptions) {
+        OpenAPI_list_for_each(app_detection_info->sdf_descriptions, sdf_descriptions_node) {
+            if (OpenAPI_flow_information_writeJSON(writer, NULL, sdf_descriptions_node->data) == false) {
+                ogs_error("OpenAPI_app_detection_info_writeJSON() failed [sdf_descriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [sdf_descriptions]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_detection_info_writeJSON() failed [AppDetectionInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_parseFromJSON(cJSON *app_detection_infoJSON)
 {
     OpenAPI_app_detection_info_t *app_detection_info_local_var = NULL;
@@ -147,7 +202,6 @@ end:
 OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_copy(OpenAPI_app_detection_info_t *dst, OpenAPI_app_detection_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_detection_info_convertToJSON(src);
@@ -156,21 +210,6 @@ OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_copy(OpenAPI_app_detect
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_detection_info_free(dst);
     dst = OpenAPI_app_detection_info_parseFromJSON(item);
     cJSON_Delete(item);
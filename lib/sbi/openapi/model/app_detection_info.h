@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flow_information.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_create(
 void OpenAPI_app_detection_info_free(OpenAPI_app_detection_info_t *app_detection_info);
 OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_parseFromJSON(cJSON *app_detection_infoJSON);
 cJSON *OpenAPI_app_detection_info_convertToJSON(OpenAPI_app_detection_info_t *app_detection_info);
+bool OpenAPI_app_detection_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_detection_info_t *app_detection_info);
 OpenAPI_app_detection_info_t *OpenAPI_app_detection_info_copy(OpenAPI_app_detection_info_t *dst, OpenAPI_app_detection_info_t *src);
 
 #ifdef __cplusplus
@@ -59,6 +59,42 @@ end:
     return item;
 }
 
+bool OpenAPI_app_port_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_port_id_t *app_port_id)
+{
+    if (app_port_id == NULL) {
+        ogs_error("OpenAPI_app_port_id_writeJSON() failed [AppPortId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_port_id_writeJSON() failed [AppPortId]");
+        return false;
+    }
+    if (app_port_id->is_destination_port) {
+    if (OpenAPI_json_write_number(writer, "destinationPort", app_port_id->destination_port) == false) {
+        ogs_error("OpenAPI_app_port_id_writeJSON() failed [destination_port]");
+        goto end;
+    }
+    }
+
+    if (app_port_id->is_originator_port) {
+    if (OpenAPI_json_write_number(writer, "originatorPort", app_port_id->originator_port) == false) {
+        ogs_error("OpenAPI_app_port_id_writeJSON() failed [originator_port]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_port_id_writeJSON() failed [AppPortId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_port_id_t *OpenAPI_app_port_id_parseFromJSON(cJSON *app_port_idJSON)
 {
     OpenAPI_app_port_id_t *app_port_id_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_app_port_id_t *OpenAPI_app_port_id_copy(OpenAPI_app_port_id_t *dst, OpenAPI_app_port_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_port_id_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_app_port_id_t *OpenAPI_app_port_id_copy(OpenAPI_app_port_id_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_port_id_free(dst);
     dst = OpenAPI_app_port_id_parseFromJSON(item);
     cJSON_Delete(item);
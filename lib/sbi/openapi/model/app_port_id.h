@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_app_port_id_t *OpenAPI_app_port_id_create(
 void OpenAPI_app_port_id_free(OpenAPI_app_port_id_t *app_port_id);
 OpenAPI_app_port_id_t *OpenAPI_app_port_id_parseFromJSON(cJSON *app_port_idJSON);
 cJSON *OpenAPI_app_port_id_convertToJSON(OpenAPI_app_port_id_t *app_port_id);
+bool OpenAPI_app_port_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_port_id_t *app_port_id);
 OpenAPI_app_port_id_t *OpenAPI_app_port_id_copy(OpenAPI_app_port_id_t *dst, OpenAPI_app_port_id_t *src);
 
 #ifdef __cplusplus
@@ -85,6 +85,49 @@ end:
     return item;
 }
 
+bool OpenAPI_app_session_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_t *app_session_context)
+{
+    if (app_session_context == NULL) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [AppSessionContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [AppSessionContext]");
+        return false;
+    }
+    if (app_session_context->asc_req_data) {
+    if (OpenAPI_app_session_context_req_data_writeJSON(writer, "ascReqData", app_session_context->asc_req_data) == false) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [asc_req_data]");
+        goto end;
+    }
+    }
+
+    if (app_session_context->asc_resp_data) {
+    if (OpenAPI_app_session_context_resp_data_writeJSON(writer, "ascRespData", app_session_context->asc_resp_data) == false) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [asc_resp_data]");
+        goto end;
+    }
+    }
+
+    if (app_session_context->evs_notif) {
+    if (OpenAPI_events_notification_writeJSON(writer, "evsNotif", app_session_context->evs_notif) == false) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [evs_notif]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_writeJSON() failed [AppSessionContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_session_context_t *OpenAPI_app_session_context_parseFromJSON(cJSON *app_session_contextJSON)
 {
     OpenAPI_app_session_context_t *app_session_context_local_var = NULL;
@@ -123,7 +166,6 @@ end:
 OpenAPI_app_session_context_t *OpenAPI_app_session_context_copy(OpenAPI_app_session_context_t *dst, OpenAPI_app_session_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_convertToJSON(src);
@@ -132,21 +174,6 @@ OpenAPI_app_session_context_t *OpenAPI_app_session_context_copy(OpenAPI_app_sess
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_free(dst);
     dst = OpenAPI_app_session_context_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "app_session_context_req_data.h"
 #include "app_session_context_resp_data.h"
 #include "events_notification.h"
@@ -35,6 +36,7 @@ OpenAPI_app_session_context_t *OpenAPI_app_session_context_create(
 void OpenAPI_app_session_context_free(OpenAPI_app_session_context_t *app_session_context);
 OpenAPI_app_session_context_t *OpenAPI_app_session_context_parseFromJSON(cJSON *app_session_contextJSON);
 cJSON *OpenAPI_app_session_context_convertToJSON(OpenAPI_app_session_context_t *app_session_context);
+bool OpenAPI_app_session_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_t *app_session_context);
 OpenAPI_app_session_context_t *OpenAPI_app_session_context_copy(OpenAPI_app_session_context_t *dst, OpenAPI_app_session_context_t *src);
 
 #ifdef __cplusplus
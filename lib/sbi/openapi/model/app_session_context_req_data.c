@@ -406,6 +406,271 @@ end:
     return item;
 }
 
+bool OpenAPI_app_session_context_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_req_data_t *app_session_context_req_data)
+{
+    if (app_session_context_req_data == NULL) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [AppSessionContextReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [AppSessionContextReqData]");
+        return false;
+    }
+    if (app_session_context_req_data->af_app_id) {
+    if (OpenAPI_json_write_string(writer, "afAppId", app_session_context_req_data->af_app_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->af_charg_id) {
+    if (OpenAPI_json_write_string(writer, "afChargId", app_session_context_req_data->af_charg_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [af_charg_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->af_req_data) {
+    if (OpenAPI_json_write_string(writer, "afReqData", OpenAPI_af_requested_data_ToString(app_session_context_req_data->af_req_data)) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [af_req_data]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->af_rout_req) {
+    if (OpenAPI_af_routing_requirement_writeJSON(writer, "afRoutReq", app_session_context_req_data->af_rout_req) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [af_rout_req]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->asp_id) {
+    if (OpenAPI_json_write_string(writer, "aspId", app_session_context_req_data->asp_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [asp_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->bdt_ref_id) {
+    if (OpenAPI_json_write_string(writer, "bdtRefId", app_session_context_req_data->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", app_session_context_req_data->dnn) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->ev_subsc) {
+    if (OpenAPI_events_subsc_req_data_writeJSON(writer, "evSubsc", app_session_context_req_data->ev_subsc) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [ev_subsc]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->mcptt_id) {
+    if (OpenAPI_json_write_string(writer, "mcpttId", app_session_context_req_data->mcptt_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [mcptt_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->mc_video_id) {
+    if (OpenAPI_json_write_string(writer, "mcVideoId", app_session_context_req_data->mc_video_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [mc_video_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->med_components) {
+    if (OpenAPI_json_write_object_start(writer, "medComponents") == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [med_components]");
+        goto end;
+    }
+    OpenAPI_lnode_t *med_components_node;
+    if (app_session_context_req_data->med_components) {
+        OpenAPI_list_for_each(app_session_context_req_data->med_components, med_components_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)med_components_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_media_component_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [med_components]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [med_components]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", app_session_context_req_data->ip_domain) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->mps_id) {
+    if (OpenAPI_json_write_string(writer, "mpsId", app_session_context_req_data->mps_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [mps_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->mcs_id) {
+    if (OpenAPI_json_write_string(writer, "mcsId", app_session_context_req_data->mcs_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [mcs_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->preempt_control_info) {
+    if (OpenAPI_json_write_string(writer, "preemptControlInfo", OpenAPI_preemption_control_information_ToString(app_session_context_req_data->preempt_control_info)) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [preempt_control_info]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->res_prio) {
+    if (OpenAPI_json_write_string(writer, "resPrio", OpenAPI_reserv_priority_ToString(app_session_context_req_data->res_prio)) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [res_prio]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->serv_inf_status) {
+    if (OpenAPI_json_write_string(writer, "servInfStatus", OpenAPI_service_info_status_ToString(app_session_context_req_data->serv_inf_status)) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [serv_inf_status]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "notifUri", app_session_context_req_data->notif_uri) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [notif_uri]");
+        goto end;
+    }
+
+    if (app_session_context_req_data->serv_urn) {
+    if (OpenAPI_json_write_string(writer, "servUrn", app_session_context_req_data->serv_urn) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [serv_urn]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->slice_info) {
+    if (OpenAPI_snssai_writeJSON(writer, "sliceInfo", app_session_context_req_data->slice_info) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [slice_info]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->spon_id) {
+    if (OpenAPI_json_write_string(writer, "sponId", app_session_context_req_data->spon_id) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [spon_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->spon_status) {
+    if (OpenAPI_json_write_string(writer, "sponStatus", OpenAPI_sponsoring_status_ToString(app_session_context_req_data->spon_status)) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [spon_status]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", app_session_context_req_data->supi) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", app_session_context_req_data->gpsi) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "suppFeat", app_session_context_req_data->supp_feat) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+
+    if (app_session_context_req_data->ue_ipv4) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4", app_session_context_req_data->ue_ipv4) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [ue_ipv4]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->ue_ipv6) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6", app_session_context_req_data->ue_ipv6) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [ue_ipv6]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->ue_mac) {
+    if (OpenAPI_json_write_string(writer, "ueMac", app_session_context_req_data->ue_mac) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [ue_mac]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", app_session_context_req_data->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", app_session_context_req_data->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_req_data->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (app_session_context_req_data->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(app_session_context_req_data->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_req_data_writeJSON() failed [AppSessionContextReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_parseFromJSON(cJSON *app_session_context_req_dataJSON)
 {
     OpenAPI_app_session_context_req_data_t *app_session_context_req_data_local_var = NULL;
@@ -771,7 +1036,6 @@ end:
 OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_copy(OpenAPI_app_session_context_req_data_t *dst, OpenAPI_app_session_context_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_req_data_convertToJSON(src);
@@ -780,21 +1044,6 @@ OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_req_data_free(dst);
     dst = OpenAPI_app_session_context_req_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_requested_data.h"
 #include "af_routing_requirement.h"
 #include "bridge_management_container.h"
@@ -99,6 +100,7 @@ OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_cre
 void OpenAPI_app_session_context_req_data_free(OpenAPI_app_session_context_req_data_t *app_session_context_req_data);
 OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_parseFromJSON(cJSON *app_session_context_req_dataJSON);
 cJSON *OpenAPI_app_session_context_req_data_convertToJSON(OpenAPI_app_session_context_req_data_t *app_session_context_req_data);
+bool OpenAPI_app_session_context_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_req_data_t *app_session_context_req_data);
 OpenAPI_app_session_context_req_data_t *OpenAPI_app_session_context_req_data_copy(OpenAPI_app_session_context_req_data_t *dst, OpenAPI_app_session_context_req_data_t *src);
 
 #ifdef __cplusplus
@@ -82,6 +82,63 @@ end:
     return item;
 }
 
+bool OpenAPI_app_session_context_resp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_resp_data_t *app_session_context_resp_data)
+{
+    if (app_session_context_resp_data == NULL) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [AppSessionContextRespData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [AppSessionContextRespData]");
+        return false;
+    }
+    if (app_session_context_resp_data->serv_auth_info) {
+    if (OpenAPI_json_write_string(writer, "servAuthInfo", OpenAPI_serv_auth_info_ToString(app_session_context_resp_data->serv_auth_info)) == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [serv_auth_info]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_resp_data->ue_ids) {
+    if (OpenAPI_json_write_array_start(writer, "ueIds") == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [ue_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ue_ids_node;
+    if (app_session_context_resp_data->ue_ids) {
+        OpenAPI_list_for_each(app_session_context_resp_data->ue_ids, ue_ids_node) {
+            if (OpenAPI_ue_identity_info_writeJSON(writer, NULL, ue_ids_node->data) == false) {
+                ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [ue_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [ue_ids]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_resp_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", app_session_context_resp_data->supp_feat) == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_resp_data_writeJSON() failed [AppSessionContextRespData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_session_context_resp_data_t *OpenAPI_app_session_context_resp_data_parseFromJSON(cJSON *app_session_context_resp_dataJSON)
 {
     OpenAPI_app_session_context_resp_data_t *app_session_context_resp_data_local_var = NULL;
@@ -148,7 +205,6 @@ end:
 OpenAPI_app_session_context_resp_data_t *OpenAPI_app_session_context_resp_data_copy(OpenAPI_app_session_context_resp_data_t *dst, OpenAPI_app_session_context_resp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_resp_data_convertToJSON(src);
@@ -157,21 +213,6 @@ OpenAPI_app_session_context_resp_data_t *OpenAPI_app_session_context_resp_data_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_resp_data_free(dst);
     dst = OpenAPI_app_session_context_resp_data_parseFromJSON(item);
     cJSON_Delete(item);
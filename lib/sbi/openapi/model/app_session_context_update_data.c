@@ -291,6 +291,191 @@ end:
     return item;
 }
 
+bool OpenAPI_app_session_context_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_update_data_t *app_session_context_update_data)
+{
+    if (app_session_context_update_data == NULL) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [AppSessionContextUpdateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [AppSessionContextUpdateData]");
+        return false;
+    }
+    if (app_session_context_update_data->af_app_id) {
+    if (OpenAPI_json_write_string(writer, "afAppId", app_session_context_update_data->af_app_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->af_rout_req) {
+    if (OpenAPI_af_routing_requirement_rm_writeJSON(writer, "afRoutReq", app_session_context_update_data->af_rout_req) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [af_rout_req]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->asp_id) {
+    if (OpenAPI_json_write_string(writer, "aspId", app_session_context_update_data->asp_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [asp_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->bdt_ref_id) {
+    if (OpenAPI_json_write_string(writer, "bdtRefId", app_session_context_update_data->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->ev_subsc) {
+    if (OpenAPI_events_subsc_req_data_rm_writeJSON(writer, "evSubsc", app_session_context_update_data->ev_subsc) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [ev_subsc]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->mcptt_id) {
+    if (OpenAPI_json_write_string(writer, "mcpttId", app_session_context_update_data->mcptt_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [mcptt_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->mc_video_id) {
+    if (OpenAPI_json_write_string(writer, "mcVideoId", app_session_context_update_data->mc_video_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [mc_video_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->med_components) {
+    if (OpenAPI_json_write_object_start(writer, "medComponents") == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [med_components]");
+        goto end;
+    }
+    OpenAPI_lnode_t *med_components_node;
+    if (app_session_context_update_data->med_components) {
+        OpenAPI_list_for_each(app_session_context_update_data->med_components, med_components_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)med_components_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_media_component_rm_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [med_components]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [med_components]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->mps_id) {
+    if (OpenAPI_json_write_string(writer, "mpsId", app_session_context_update_data->mps_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [mps_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->mcs_id) {
+    if (OpenAPI_json_write_string(writer, "mcsId", app_session_context_update_data->mcs_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [mcs_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->preempt_control_info) {
+    if (OpenAPI_preemption_control_information_rm_writeJSON(writer, "preemptControlInfo", app_session_context_update_data->preempt_control_info) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [preempt_control_info]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->res_prio) {
+    if (OpenAPI_json_write_string(writer, "resPrio", OpenAPI_reserv_priority_ToString(app_session_context_update_data->res_prio)) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [res_prio]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->serv_inf_status) {
+    if (OpenAPI_json_write_string(writer, "servInfStatus", OpenAPI_service_info_status_ToString(app_session_context_update_data->serv_inf_status)) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [serv_inf_status]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->sip_fork_ind) {
+    if (OpenAPI_json_write_string(writer, "sipForkInd", OpenAPI_sip_forking_indication_ToString(app_session_context_update_data->sip_fork_ind)) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [sip_fork_ind]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->spon_id) {
+    if (OpenAPI_json_write_string(writer, "sponId", app_session_context_update_data->spon_id) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [spon_id]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->spon_status) {
+    if (OpenAPI_json_write_string(writer, "sponStatus", OpenAPI_sponsoring_status_ToString(app_session_context_update_data->spon_status)) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [spon_status]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", app_session_context_update_data->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", app_session_context_update_data->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (app_session_context_update_data->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (app_session_context_update_data->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(app_session_context_update_data->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_writeJSON() failed [AppSessionContextUpdateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_data_parseFromJSON(cJSON *app_session_context_update_dataJSON)
 {
     OpenAPI_app_session_context_update_data_t *app_session_context_update_data_local_var = NULL;
@@ -530,7 +715,6 @@ end:
 OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_data_copy(OpenAPI_app_session_context_update_data_t *dst, OpenAPI_app_session_context_update_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_update_data_convertToJSON(src);
@@ -539,21 +723,6 @@ OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_update_data_free(dst);
     dst = OpenAPI_app_session_context_update_data_parseFromJSON(item);
     cJSON_Delete(item);
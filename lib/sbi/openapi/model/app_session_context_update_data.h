@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_routing_requirement_rm.h"
 #include "bridge_management_container.h"
 #include "events_subsc_req_data_rm.h"
@@ -74,6 +75,7 @@ OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_da
 void OpenAPI_app_session_context_update_data_free(OpenAPI_app_session_context_update_data_t *app_session_context_update_data);
 OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_data_parseFromJSON(cJSON *app_session_context_update_dataJSON);
 cJSON *OpenAPI_app_session_context_update_data_convertToJSON(OpenAPI_app_session_context_update_data_t *app_session_context_update_data);
+bool OpenAPI_app_session_context_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_update_data_t *app_session_context_update_data);
 OpenAPI_app_session_context_update_data_t *OpenAPI_app_session_context_update_data_copy(OpenAPI_app_session_context_update_data_t *dst, OpenAPI_app_session_context_update_data_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_app_session_context_update_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_update_data_patch_t *app_session_context_update_data_patch)
+{
+    if (app_session_context_update_data_patch == NULL) {
+        ogs_error("OpenAPI_app_session_context_update_data_patch_writeJSON() failed [AppSessionContextUpdateDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_patch_writeJSON() failed [AppSessionContextUpdateDataPatch]");
+        return false;
+    }
+    if (app_session_context_update_data_patch->asc_req_data) {
+    if (OpenAPI_app_session_context_update_data_writeJSON(writer, "ascReqData", app_session_context_update_data_patch->asc_req_data) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_patch_writeJSON() failed [asc_req_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_app_session_context_update_data_patch_writeJSON() failed [AppSessionContextUpdateDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_update_data_patch_parseFromJSON(cJSON *app_session_context_update_data_patchJSON)
 {
     OpenAPI_app_session_context_update_data_patch_t *app_session_context_update_data_patch_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_update_data_patch_copy(OpenAPI_app_session_context_update_data_patch_t *dst, OpenAPI_app_session_context_update_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_app_session_context_update_data_patch_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_upd
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_app_session_context_update_data_patch_free(dst);
     dst = OpenAPI_app_session_context_update_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
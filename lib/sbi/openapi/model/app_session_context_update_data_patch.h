@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "app_session_context_update_data.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_upd
 void OpenAPI_app_session_context_update_data_patch_free(OpenAPI_app_session_context_update_data_patch_t *app_session_context_update_data_patch);
 OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_update_data_patch_parseFromJSON(cJSON *app_session_context_update_data_patchJSON);
 cJSON *OpenAPI_app_session_context_update_data_patch_convertToJSON(OpenAPI_app_session_context_update_data_patch_t *app_session_context_update_data_patch);
+bool OpenAPI_app_session_context_update_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_app_session_context_update_data_patch_t *app_session_context_update_data_patch);
 OpenAPI_app_session_context_update_data_patch_t *OpenAPI_app_session_context_update_data_patch_copy(OpenAPI_app_session_context_update_data_patch_t *dst, OpenAPI_app_session_context_update_data_patch_t *src);
 
 #ifdef __cplusplus
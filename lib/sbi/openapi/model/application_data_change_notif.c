@@ -109,6 +109,61 @@ end:
     return item;
 }
 
+bool OpenAPI_application_data_change_notif_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_application_data_change_notif_t *application_data_change_notif)
+{
+    if (application_data_change_notif == NULL) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [ApplicationDataChangeNotif]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [ApplicationDataChangeNotif]");
+        return false;
+    }
+    if (application_data_change_notif->iptv_config_data) {
+    if (OpenAPI_iptv_config_data_writeJSON(writer, "iptvConfigData", application_data_change_notif->iptv_config_data) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [iptv_config_data]");
+        goto end;
+    }
+    }
+
+    if (application_data_change_notif->pfd_data) {
+    if (OpenAPI_pfd_change_notification_writeJSON(writer, "pfdData", application_data_change_notif->pfd_data) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [pfd_data]");
+        goto end;
+    }
+    }
+
+    if (application_data_change_notif->bdt_policy_data) {
+    if (OpenAPI_bdt_policy_data_writeJSON(writer, "bdtPolicyData", application_data_change_notif->bdt_policy_data) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [bdt_policy_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "resUri", application_data_change_notif->res_uri) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [res_uri]");
+        goto end;
+    }
+
+    if (application_data_change_notif->ser_param_data) {
+    if (OpenAPI_service_parameter_data_writeJSON(writer, "serParamData", application_data_change_notif->ser_param_data) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [ser_param_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_application_data_change_notif_writeJSON() failed [ApplicationDataChangeNotif]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_parseFromJSON(cJSON *application_data_change_notifJSON)
 {
     OpenAPI_application_data_change_notif_t *application_data_change_notif_local_var = NULL;
@@ -167,7 +222,6 @@ end:
 OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_copy(OpenAPI_application_data_change_notif_t *dst, OpenAPI_application_data_change_notif_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_application_data_change_notif_convertToJSON(src);
@@ -176,21 +230,6 @@ OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_application_data_change_notif_free(dst);
     dst = OpenAPI_application_data_change_notif_parseFromJSON(item);
     cJSON_Delete(item);
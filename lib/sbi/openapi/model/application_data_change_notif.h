@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "bdt_policy_data.h"
 #include "iptv_config_data.h"
 #include "pfd_change_notification.h"
@@ -40,6 +41,7 @@ OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_c
 void OpenAPI_application_data_change_notif_free(OpenAPI_application_data_change_notif_t *application_data_change_notif);
 OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_parseFromJSON(cJSON *application_data_change_notifJSON);
 cJSON *OpenAPI_application_data_change_notif_convertToJSON(OpenAPI_application_data_change_notif_t *application_data_change_notif);
+bool OpenAPI_application_data_change_notif_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_application_data_change_notif_t *application_data_change_notif);
 OpenAPI_application_data_change_notif_t *OpenAPI_application_data_change_notif_copy(OpenAPI_application_data_change_notif_t *dst, OpenAPI_application_data_change_notif_t *src);
 
 #ifdef __cplusplus
@@ -91,6 +91,68 @@ end:
     return item;
 }
 
+bool OpenAPI_application_data_subs_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_application_data_subs_t *application_data_subs)
+{
+    if (application_data_subs == NULL) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [ApplicationDataSubs]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [ApplicationDataSubs]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationUri", application_data_subs->notification_uri) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (application_data_subs->data_filters) {
+    if (OpenAPI_json_write_array_start(writer, "dataFilters") == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [data_filters]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *data_filters_node;
+    if (application_data_subs->data_filters) {
+        OpenAPI_list_for_each(application_data_subs->data_filters, data_filters_node) {
+            if (OpenAPI_data_filter_writeJSON(writer, NULL, data_filters_node->data) == false) {
+                ogs_error("OpenAPI_application_data_subs_writeJSON() failed [data_filters]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [data_filters]");
+        goto end;
+    }
+    }
+
+    if (application_data_subs->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", application_data_subs->expiry) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (application_data_subs->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", application_data_subs->supported_features) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_application_data_subs_writeJSON() failed [ApplicationDataSubs]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_parseFromJSON(cJSON *application_data_subsJSON)
 {
     OpenAPI_application_data_subs_t *application_data_subs_local_var = NULL;
@@ -167,7 +229,6 @@ end:
 OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_copy(OpenAPI_application_data_subs_t *dst, OpenAPI_application_data_subs_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_application_data_subs_convertToJSON(src);
@@ -176,21 +237,6 @@ OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_copy(OpenAPI_appl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_application_data_subs_free(dst);
     dst = OpenAPI_application_data_subs_parseFromJSON(item);
     cJSON_Delete(item);
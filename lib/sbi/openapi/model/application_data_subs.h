@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "data_filter.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_create(
 void OpenAPI_application_data_subs_free(OpenAPI_application_data_subs_t *application_data_subs);
 OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_parseFromJSON(cJSON *application_data_subsJSON);
 cJSON *OpenAPI_application_data_subs_convertToJSON(OpenAPI_application_data_subs_t *application_data_subs);
+bool OpenAPI_application_data_subs_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_application_data_subs_t *application_data_subs);
 OpenAPI_application_data_subs_t *OpenAPI_application_data_subs_copy(OpenAPI_application_data_subs_t *dst, OpenAPI_application_data_subs_t *src);
 
 #ifdef __cplusplus
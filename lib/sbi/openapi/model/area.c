@@ -69,6 +69,54 @@ end:
     return item;
 }
 
+bool OpenAPI_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_t *area)
+{
+    if (area == NULL) {
+        ogs_error("OpenAPI_area_writeJSON() failed [Area]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [Area]");
+        return false;
+    }
+    if (area->tacs) {
+    if (OpenAPI_json_write_array_start(writer, "tacs") == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [tacs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tacs_node;
+    OpenAPI_list_for_each(area->tacs, tacs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)tacs_node->data) == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [tacs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [tacs]");
+        goto end;
+    }
+    }
+
+    if (area->area_code) {
+    if (OpenAPI_json_write_string(writer, "areaCode", area->area_code) == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [area_code]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_area_writeJSON() failed [Area]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_area_t *OpenAPI_area_parseFromJSON(cJSON *areaJSON)
 {
     OpenAPI_area_t *area_local_var = NULL;
@@ -114,7 +162,6 @@ end:
 OpenAPI_area_t *OpenAPI_area_copy(OpenAPI_area_t *dst, OpenAPI_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_area_convertToJSON(src);
@@ -123,21 +170,6 @@ OpenAPI_area_t *OpenAPI_area_copy(OpenAPI_area_t *dst, OpenAPI_area_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_area_free(dst);
     dst = OpenAPI_area_parseFromJSON(item);
     cJSON_Delete(item);
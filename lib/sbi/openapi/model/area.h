@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_area_t *OpenAPI_area_create(
 void OpenAPI_area_free(OpenAPI_area_t *area);
 OpenAPI_area_t *OpenAPI_area_parseFromJSON(cJSON *areaJSON);
 cJSON *OpenAPI_area_convertToJSON(OpenAPI_area_t *area);
+bool OpenAPI_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_t *area);
 OpenAPI_area_t *OpenAPI_area_copy(OpenAPI_area_t *dst, OpenAPI_area_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_area_1_t *OpenAPI_area_1_create(
 void OpenAPI_area_1_free(OpenAPI_area_1_t *area_1);
 OpenAPI_area_1_t *OpenAPI_area_1_parseFromJSON(cJSON *area_1JSON);
 cJSON *OpenAPI_area_1_convertToJSON(OpenAPI_area_1_t *area_1);
+bool OpenAPI_area_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_1_t *area_1);
 OpenAPI_area_1_t *OpenAPI_area_1_copy(OpenAPI_area_1_t *dst, OpenAPI_area_1_t *src);
 
 #ifdef __cplusplus
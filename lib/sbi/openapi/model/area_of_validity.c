@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_area_of_validity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_of_validity_t *area_of_validity)
+{
+    if (area_of_validity == NULL) {
+        ogs_error("OpenAPI_area_of_validity_writeJSON() failed [AreaOfValidity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_area_of_validity_writeJSON() failed [AreaOfValidity]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_area_of_validity_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (area_of_validity->tai_list) {
+        OpenAPI_list_for_each(area_of_validity->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_area_of_validity_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_area_of_validity_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_area_of_validity_writeJSON() failed [AreaOfValidity]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_parseFromJSON(cJSON *area_of_validityJSON)
 {
     OpenAPI_area_of_validity_t *area_of_validity_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_copy(OpenAPI_area_of_validity_t *dst, OpenAPI_area_of_validity_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_area_of_validity_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_copy(OpenAPI_area_of_validi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_area_of_validity_free(dst);
     dst = OpenAPI_area_of_validity_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "tai.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_create(
 void OpenAPI_area_of_validity_free(OpenAPI_area_of_validity_t *area_of_validity);
 OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_parseFromJSON(cJSON *area_of_validityJSON);
 cJSON *OpenAPI_area_of_validity_convertToJSON(OpenAPI_area_of_validity_t *area_of_validity);
+bool OpenAPI_area_of_validity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_of_validity_t *area_of_validity);
 OpenAPI_area_of_validity_t *OpenAPI_area_of_validity_copy(OpenAPI_area_of_validity_t *dst, OpenAPI_area_of_validity_t *src);
 
 #ifdef __cplusplus
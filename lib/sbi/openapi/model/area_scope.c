@@ -135,6 +135,108 @@ end:
     return item;
 }
 
+bool OpenAPI_area_scope_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_scope_t *area_scope)
+{
+    if (area_scope == NULL) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [AreaScope]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [AreaScope]");
+        return false;
+    }
+    if (area_scope->eutra_cell_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "eutraCellIdList") == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [eutra_cell_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eutra_cell_id_list_node;
+    OpenAPI_list_for_each(area_scope->eutra_cell_id_list, eutra_cell_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)eutra_cell_id_list_node->data) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [eutra_cell_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [eutra_cell_id_list]");
+        goto end;
+    }
+    }
+
+    if (area_scope->nr_cell_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "nrCellIdList") == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [nr_cell_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nr_cell_id_list_node;
+    OpenAPI_list_for_each(area_scope->nr_cell_id_list, nr_cell_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nr_cell_id_list_node->data) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [nr_cell_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [nr_cell_id_list]");
+        goto end;
+    }
+    }
+
+    if (area_scope->tac_list) {
+    if (OpenAPI_json_write_array_start(writer, "tacList") == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tac_list_node;
+    OpenAPI_list_for_each(area_scope->tac_list, tac_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)tac_list_node->data) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_list]");
+        goto end;
+    }
+    }
+
+    if (area_scope->tac_info_per_plmn) {
+    if (OpenAPI_json_write_object_start(writer, "tacInfoPerPlmn") == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_info_per_plmn]");
+        goto end;
+    }
+    OpenAPI_lnode_t *tac_info_per_plmn_node;
+    if (area_scope->tac_info_per_plmn) {
+        OpenAPI_list_for_each(area_scope->tac_info_per_plmn, tac_info_per_plmn_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)tac_info_per_plmn_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_tac_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_info_per_plmn]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [tac_info_per_plmn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_area_scope_writeJSON() failed [AreaScope]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_area_scope_t *OpenAPI_area_scope_parseFromJSON(cJSON *area_scopeJSON)
 {
     OpenAPI_area_scope_t *area_scope_local_var = NULL;
@@ -239,7 +341,6 @@ end:
 OpenAPI_area_scope_t *OpenAPI_area_scope_copy(OpenAPI_area_scope_t *dst, OpenAPI_area_scope_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_area_scope_convertToJSON(src);
@@ -248,21 +349,6 @@ OpenAPI_area_scope_t *OpenAPI_area_scope_copy(OpenAPI_area_scope_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_area_scope_free(dst);
     dst = OpenAPI_area_scope_parseFromJSON(item);
     cJSON_Delete(item);
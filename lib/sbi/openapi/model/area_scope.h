@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "tac_info.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_area_scope_t *OpenAPI_area_scope_create(
 void OpenAPI_area_scope_free(OpenAPI_area_scope_t *area_scope);
 OpenAPI_area_scope_t *OpenAPI_area_scope_parseFromJSON(cJSON *area_scopeJSON);
 cJSON *OpenAPI_area_scope_convertToJSON(OpenAPI_area_scope_t *area_scope);
+bool OpenAPI_area_scope_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_area_scope_t *area_scope);
 OpenAPI_area_scope_t *OpenAPI_area_scope_copy(OpenAPI_area_scope_t *dst, OpenAPI_area_scope_t *src);
 
 #ifdef __cplusplus
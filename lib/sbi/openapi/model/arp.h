@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "preemption_capability.h"
 #include "preemption_vulnerability.h"
 
@@ -34,6 +35,7 @@ OpenAPI_arp_t *OpenAPI_arp_create(
 void OpenAPI_arp_free(OpenAPI_arp_t *arp);
 OpenAPI_arp_t *OpenAPI_arp_parseFromJSON(cJSON *arpJSON);
 cJSON *OpenAPI_arp_convertToJSON(OpenAPI_arp_t *arp);
+bool OpenAPI_arp_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_arp_t *arp);
 OpenAPI_arp_t *OpenAPI_arp_copy(OpenAPI_arp_t *dst, OpenAPI_arp_t *src);
 
 #ifdef __cplusplus
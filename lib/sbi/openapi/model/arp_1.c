@@ -58,6 +58,43 @@ end:
     return item;
 }
 
+bool OpenAPI_arp_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_arp_1_t *arp_1)
+{
+    if (arp_1 == NULL) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [Arp_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [Arp_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "priorityLevel", arp_1->priority_level) == false) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [priority_level]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "preemptCap", OpenAPI_preemption_capability_ToString(arp_1->preempt_cap)) == false) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [preempt_cap]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "preemptVuln", OpenAPI_preemption_vulnerability_ToString(arp_1->preempt_vuln)) == false) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [preempt_vuln]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_arp_1_writeJSON() failed [Arp_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_arp_1_t *OpenAPI_arp_1_parseFromJSON(cJSON *arp_1JSON)
 {
     OpenAPI_arp_1_t *arp_1_local_var = NULL;
@@ -113,7 +150,6 @@ end:
 OpenAPI_arp_1_t *OpenAPI_arp_1_copy(OpenAPI_arp_1_t *dst, OpenAPI_arp_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_arp_1_convertToJSON(src);
@@ -122,21 +158,6 @@ OpenAPI_arp_1_t *OpenAPI_arp_1_copy(OpenAPI_arp_1_t *dst, OpenAPI_arp_1_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_arp_1_free(dst);
     dst = OpenAPI_arp_1_parseFromJSON(item);
     cJSON_Delete(item);
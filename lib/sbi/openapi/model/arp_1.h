@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "preemption_capability.h"
 #include "preemption_vulnerability.h"
 
@@ -34,6 +35,7 @@ OpenAPI_arp_1_t *OpenAPI_arp_1_create(
 void OpenAPI_arp_1_free(OpenAPI_arp_1_t *arp_1);
 OpenAPI_arp_1_t *OpenAPI_arp_1_parseFromJSON(cJSON *arp_1JSON);
 cJSON *OpenAPI_arp_1_convertToJSON(OpenAPI_arp_1_t *arp_1);
+bool OpenAPI_arp_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_arp_1_t *arp_1);
 OpenAPI_arp_1_t *OpenAPI_arp_1_copy(OpenAPI_arp_1_t *dst, OpenAPI_arp_1_t *src);
 
 #ifdef __cplusplus
@@ -108,6 +108,80 @@ end:
     return item;
 }
 
+bool OpenAPI_assign_ebi_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_data_t *assign_ebi_data)
+{
+    if (assign_ebi_data == NULL) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [AssignEbiData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [AssignEbiData]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", assign_ebi_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (assign_ebi_data->arp_list) {
+    if (OpenAPI_json_write_array_start(writer, "arpList") == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [arp_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *arp_list_node;
+    if (assign_ebi_data->arp_list) {
+        OpenAPI_list_for_each(assign_ebi_data->arp_list, arp_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, arp_list_node->data) == false) {
+                ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [arp_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [arp_list]");
+        goto end;
+    }
+    }
+
+    if (assign_ebi_data->released_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "releasedEbiList") == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *released_ebi_list_node;
+    OpenAPI_list_for_each(assign_ebi_data->released_ebi_list, released_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)released_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (assign_ebi_data->old_guami) {
+    if (OpenAPI_guami_writeJSON(writer, "oldGuami", assign_ebi_data->old_guami) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [old_guami]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_data_writeJSON() failed [AssignEbiData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_parseFromJSON(cJSON *assign_ebi_dataJSON)
 {
     OpenAPI_assign_ebi_data_t *assign_ebi_data_local_var = NULL;
@@ -194,7 +268,6 @@ end:
 OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_copy(OpenAPI_assign_ebi_data_t *dst, OpenAPI_assign_ebi_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_assign_ebi_data_convertToJSON(src);
@@ -203,21 +276,6 @@ OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_copy(OpenAPI_assign_ebi_data_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_assign_ebi_data_free(dst);
     dst = OpenAPI_assign_ebi_data_parseFromJSON(item);
     cJSON_Delete(item);
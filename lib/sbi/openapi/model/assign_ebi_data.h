@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 #include "guami.h"
 
@@ -36,6 +37,7 @@ OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_create(
 void OpenAPI_assign_ebi_data_free(OpenAPI_assign_ebi_data_t *assign_ebi_data);
 OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_parseFromJSON(cJSON *assign_ebi_dataJSON);
 cJSON *OpenAPI_assign_ebi_data_convertToJSON(OpenAPI_assign_ebi_data_t *assign_ebi_data);
+bool OpenAPI_assign_ebi_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_data_t *assign_ebi_data);
 OpenAPI_assign_ebi_data_t *OpenAPI_assign_ebi_data_copy(OpenAPI_assign_ebi_data_t *dst, OpenAPI_assign_ebi_data_t *src);
 
 #ifdef __cplusplus
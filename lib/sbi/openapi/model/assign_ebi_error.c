@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_assign_ebi_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_error_t *assign_ebi_error)
+{
+    if (assign_ebi_error == NULL) {
+        ogs_error("OpenAPI_assign_ebi_error_writeJSON() failed [AssignEbiError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_assign_ebi_error_writeJSON() failed [AssignEbiError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", assign_ebi_error->error) == false) {
+        ogs_error("OpenAPI_assign_ebi_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (OpenAPI_assign_ebi_failed_writeJSON(writer, "failureDetails", assign_ebi_error->failure_details) == false) {
+        ogs_error("OpenAPI_assign_ebi_error_writeJSON() failed [failure_details]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_error_writeJSON() failed [AssignEbiError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_parseFromJSON(cJSON *assign_ebi_errorJSON)
 {
     OpenAPI_assign_ebi_error_t *assign_ebi_error_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_copy(OpenAPI_assign_ebi_error_t *dst, OpenAPI_assign_ebi_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_assign_ebi_error_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_copy(OpenAPI_assign_ebi_err
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_assign_ebi_error_free(dst);
     dst = OpenAPI_assign_ebi_error_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "assign_ebi_failed.h"
 #include "problem_details.h"
 
@@ -32,6 +33,7 @@ OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_create(
 void OpenAPI_assign_ebi_error_free(OpenAPI_assign_ebi_error_t *assign_ebi_error);
 OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_parseFromJSON(cJSON *assign_ebi_errorJSON);
 cJSON *OpenAPI_assign_ebi_error_convertToJSON(OpenAPI_assign_ebi_error_t *assign_ebi_error);
+bool OpenAPI_assign_ebi_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_error_t *assign_ebi_error);
 OpenAPI_assign_ebi_error_t *OpenAPI_assign_ebi_error_copy(OpenAPI_assign_ebi_error_t *dst, OpenAPI_assign_ebi_error_t *src);
 
 #ifdef __cplusplus
@@ -70,6 +70,54 @@ end:
     return item;
 }
 
+bool OpenAPI_assign_ebi_failed_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_failed_t *assign_ebi_failed)
+{
+    if (assign_ebi_failed == NULL) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [AssignEbiFailed]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [AssignEbiFailed]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", assign_ebi_failed->pdu_session_id) == false) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (assign_ebi_failed->failed_arp_list) {
+    if (OpenAPI_json_write_array_start(writer, "failedArpList") == false) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [failed_arp_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_arp_list_node;
+    if (assign_ebi_failed->failed_arp_list) {
+        OpenAPI_list_for_each(assign_ebi_failed->failed_arp_list, failed_arp_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, failed_arp_list_node->data) == false) {
+                ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [failed_arp_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [failed_arp_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_assign_ebi_failed_writeJSON() failed [AssignEbiFailed]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_parseFromJSON(cJSON *assign_ebi_failedJSON)
 {
     OpenAPI_assign_ebi_failed_t *assign_ebi_failed_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_copy(OpenAPI_assign_ebi_failed_t *dst, OpenAPI_assign_ebi_failed_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_assign_ebi_failed_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_copy(OpenAPI_assign_ebi_f
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_assign_ebi_failed_free(dst);
     dst = OpenAPI_assign_ebi_failed_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_create(
 void OpenAPI_assign_ebi_failed_free(OpenAPI_assign_ebi_failed_t *assign_ebi_failed);
 OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_parseFromJSON(cJSON *assign_ebi_failedJSON);
 cJSON *OpenAPI_assign_ebi_failed_convertToJSON(OpenAPI_assign_ebi_failed_t *assign_ebi_failed);
+bool OpenAPI_assign_ebi_failed_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assign_ebi_failed_t *assign_ebi_failed);
 OpenAPI_assign_ebi_failed_t *OpenAPI_assign_ebi_failed_copy(OpenAPI_assign_ebi_failed_t *dst, OpenAPI_assign_ebi_failed_t *src);
 
 #ifdef __cplusplus
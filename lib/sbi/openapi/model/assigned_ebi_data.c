@@ -116,6 +116,92 @@ end:
     return item;
 }
 
+bool OpenAPI_assigned_ebi_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_assigned_ebi_data_t *assigned_ebi_data)
+{
+    if (assigned_ebi_data == NULL) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [AssignedEbiData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [AssignedEbiData]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", assigned_ebi_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "assignedEbiList") == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [assigned_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *assigned_ebi_list_node;
+    if (assigned_ebi_data->assigned_ebi_list) {
+        OpenAPI_list_for_each(assigned_ebi_data->assigned_ebi_list, assigned_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, assigned_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [assigned_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [assigned_ebi_list]");
+        goto end;
+    }
+
+    if (assigned_ebi_data->failed_arp_list) {
+    if (OpenAPI_json_write_array_start(writer, "failedArpList") == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [failed_arp_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_arp_list_node;
+    if (assigned_ebi_data->failed_arp_list) {
+        OpenAPI_list_for_each(assigned_ebi_data->failed_arp_list, failed_arp_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, failed_arp_list_node->data) == false) {
+                ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [failed_arp_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [failed_arp_list]");
+        goto end;
+    }
+    }
+
+    if (assigned_ebi_data->released_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "releasedEbiList") == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *released_ebi_list_node;
+    OpenAPI_list_for_each(assigned_ebi_data->released_ebi_list, released_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)released_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_assigned_ebi_data_writeJSON() failed [AssignedEbiData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_assigned_ebi_data_t *OpenAPI_assigned_ebi_data_parseFromJSON(cJSON *assigned_ebi_dataJSON)
 {
     OpenAPI_assigned_ebi_data_t *assigned_ebi_data_local_var = NULL;
@@ -226,7 +312,6 @@ end:
 OpenAPI_assigned_ebi_data_t *OpenAPI_assigned_ebi_data_copy(OpenAPI_assigned_ebi_data_t *dst, OpenAPI_assigned_ebi_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_assigned_ebi_data_convertToJSON(src);
@@ -235,21 +320,6 @@ OpenAPI_assigned_ebi_data_t *OpenAPI_assigned_ebi_data_copy(OpenAPI_assigned_ebi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_assigned_ebi_data_free(dst);
     dst = OpenAPI_assigned_ebi_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "association_type_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_association_type_t *OpenAPI_association_type_create(
 void OpenAPI_association_type_free(OpenAPI_association_type_t *association_type);
 OpenAPI_association_type_t *OpenAPI_association_type_parseFromJSON(cJSON *association_typeJSON);
 cJSON *OpenAPI_association_type_convertToJSON(OpenAPI_association_type_t *association_type);
+bool OpenAPI_association_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_association_type_t *association_type);
 OpenAPI_association_type_t *OpenAPI_association_type_copy(OpenAPI_association_type_t *dst, OpenAPI_association_type_t *src);
 
 #ifdef __cplusplus
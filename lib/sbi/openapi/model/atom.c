@@ -64,6 +64,45 @@ end:
     return item;
 }
 
+bool OpenAPI_atom_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_atom_t *atom)
+{
+    if (atom == NULL) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [Atom]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [Atom]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "attr", atom->attr) == false) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [attr]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "value", atom->value) == false) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [value]");
+        goto end;
+    }
+
+    if (atom->is_negative) {
+    if (OpenAPI_json_write_bool(writer, "negative", atom->negative) == false) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [negative]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_atom_writeJSON() failed [Atom]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_atom_t *OpenAPI_atom_parseFromJSON(cJSON *atomJSON)
 {
     OpenAPI_atom_t *atom_local_var = NULL;
@@ -113,7 +152,6 @@ end:
 OpenAPI_atom_t *OpenAPI_atom_copy(OpenAPI_atom_t *dst, OpenAPI_atom_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_atom_convertToJSON(src);
@@ -122,21 +160,6 @@ OpenAPI_atom_t *OpenAPI_atom_copy(OpenAPI_atom_t *dst, OpenAPI_atom_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_atom_free(dst);
     dst = OpenAPI_atom_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_atom_t *OpenAPI_atom_create(
 void OpenAPI_atom_free(OpenAPI_atom_t *atom);
 OpenAPI_atom_t *OpenAPI_atom_parseFromJSON(cJSON *atomJSON);
 cJSON *OpenAPI_atom_convertToJSON(OpenAPI_atom_t *atom);
+bool OpenAPI_atom_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_atom_t *atom);
 OpenAPI_atom_t *OpenAPI_atom_copy(OpenAPI_atom_t *dst, OpenAPI_atom_t *src);
 
 #ifdef __cplusplus
@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_atsss_capability_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_atsss_capability_t *atsss_capability)
+{
+    if (atsss_capability == NULL) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [AtsssCapability]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [AtsssCapability]");
+        return false;
+    }
+    if (atsss_capability->is_atsss_ll) {
+    if (OpenAPI_json_write_bool(writer, "atsssLL", atsss_capability->atsss_ll) == false) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [atsss_ll]");
+        goto end;
+    }
+    }
+
+    if (atsss_capability->is_mptcp) {
+    if (OpenAPI_json_write_bool(writer, "mptcp", atsss_capability->mptcp) == false) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [mptcp]");
+        goto end;
+    }
+    }
+
+    if (atsss_capability->is_rtt_without_pmf) {
+    if (OpenAPI_json_write_bool(writer, "rttWithoutPmf", atsss_capability->rtt_without_pmf) == false) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [rtt_without_pmf]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_atsss_capability_writeJSON() failed [AtsssCapability]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_parseFromJSON(cJSON *atsss_capabilityJSON)
 {
     OpenAPI_atsss_capability_t *atsss_capability_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_copy(OpenAPI_atsss_capability_t *dst, OpenAPI_atsss_capability_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_atsss_capability_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_copy(OpenAPI_atsss_capabili
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_atsss_capability_free(dst);
     dst = OpenAPI_atsss_capability_parseFromJSON(item);
     cJSON_Delete(item);
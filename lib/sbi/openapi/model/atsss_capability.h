@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,7 @@ OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_create(
 void OpenAPI_atsss_capability_free(OpenAPI_atsss_capability_t *atsss_capability);
 OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_parseFromJSON(cJSON *atsss_capabilityJSON);
 cJSON *OpenAPI_atsss_capability_convertToJSON(OpenAPI_atsss_capability_t *atsss_capability);
+bool OpenAPI_atsss_capability_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_atsss_capability_t *atsss_capability);
 OpenAPI_atsss_capability_t *OpenAPI_atsss_capability_copy(OpenAPI_atsss_capability_t *dst, OpenAPI_atsss_capability_t *src);
 
 #ifdef __cplusplus
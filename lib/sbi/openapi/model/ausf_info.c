@@ -95,6 +95,75 @@ end:
     return item;
 }
 
+bool OpenAPI_ausf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ausf_info_t *ausf_info)
+{
+    if (ausf_info == NULL) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [AusfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [AusfInfo]");
+        return false;
+    }
+    if (ausf_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", ausf_info->group_id) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (ausf_info->supi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "supiRanges") == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_ranges_node;
+    if (ausf_info->supi_ranges) {
+        OpenAPI_list_for_each(ausf_info->supi_ranges, supi_ranges_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_ausf_info_writeJSON() failed [supi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+    }
+
+    if (ausf_info->routing_indicators) {
+    if (OpenAPI_json_write_array_start(writer, "routingIndicators") == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *routing_indicators_node;
+    OpenAPI_list_for_each(ausf_info->routing_indicators, routing_indicators_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)routing_indicators_node->data) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ausf_info_writeJSON() failed [AusfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ausf_info_t *OpenAPI_ausf_info_parseFromJSON(cJSON *ausf_infoJSON)
 {
     OpenAPI_ausf_info_t *ausf_info_local_var = NULL;
@@ -170,7 +239,6 @@ end:
 OpenAPI_ausf_info_t *OpenAPI_ausf_info_copy(OpenAPI_ausf_info_t *dst, OpenAPI_ausf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ausf_info_convertToJSON(src);
@@ -179,21 +247,6 @@ OpenAPI_ausf_info_t *OpenAPI_ausf_info_copy(OpenAPI_ausf_info_t *dst, OpenAPI_au
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ausf_info_free(dst);
     dst = OpenAPI_ausf_info_parseFromJSON(item);
     cJSON_Delete(item);
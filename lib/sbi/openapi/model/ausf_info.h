@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "supi_range.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ausf_info_t *OpenAPI_ausf_info_create(
 void OpenAPI_ausf_info_free(OpenAPI_ausf_info_t *ausf_info);
 OpenAPI_ausf_info_t *OpenAPI_ausf_info_parseFromJSON(cJSON *ausf_infoJSON);
 cJSON *OpenAPI_ausf_info_convertToJSON(OpenAPI_ausf_info_t *ausf_info);
+bool OpenAPI_ausf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ausf_info_t *ausf_info);
 OpenAPI_ausf_info_t *OpenAPI_ausf_info_copy(OpenAPI_ausf_info_t *dst, OpenAPI_ausf_info_t *src);
 
 #ifdef __cplusplus
@@ -86,6 +86,60 @@ end:
     return item;
 }
 
+bool OpenAPI_auth_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_auth_event_t *auth_event)
+{
+    if (auth_event == NULL) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [AuthEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [AuthEvent]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfInstanceId", auth_event->nf_instance_id) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [nf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_bool(writer, "success", auth_event->success) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [success]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "timeStamp", auth_event->time_stamp) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [time_stamp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "authType", OpenAPI_auth_type_ToString(auth_event->auth_type)) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [auth_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "servingNetworkName", auth_event->serving_network_name) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [serving_network_name]");
+        goto end;
+    }
+
+    if (auth_event->is_auth_removal_ind) {
+    if (OpenAPI_json_write_bool(writer, "authRemovalInd", auth_event->auth_removal_ind) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [auth_removal_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_auth_event_writeJSON() failed [AuthEvent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_auth_event_t *OpenAPI_auth_event_parseFromJSON(cJSON *auth_eventJSON)
 {
     OpenAPI_auth_event_t *auth_event_local_var = NULL;
@@ -174,7 +228,6 @@ end:
 OpenAPI_auth_event_t *OpenAPI_auth_event_copy(OpenAPI_auth_event_t *dst, OpenAPI_auth_event_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_auth_event_convertToJSON(src);
@@ -183,21 +236,6 @@ OpenAPI_auth_event_t *OpenAPI_auth_event_copy(OpenAPI_auth_event_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_auth_event_free(dst);
     dst = OpenAPI_auth_event_parseFromJSON(item);
     cJSON_Delete(item);
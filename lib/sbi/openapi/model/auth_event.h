@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_type.h"
 
 #ifdef __cplusplus
@@ -41,6 +42,7 @@ OpenAPI_auth_event_t *OpenAPI_auth_event_create(
 void OpenAPI_auth_event_free(OpenAPI_auth_event_t *auth_event);
 OpenAPI_auth_event_t *OpenAPI_auth_event_parseFromJSON(cJSON *auth_eventJSON);
 cJSON *OpenAPI_auth_event_convertToJSON(OpenAPI_auth_event_t *auth_event);
+bool OpenAPI_auth_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_auth_event_t *auth_event);
 OpenAPI_auth_event_t *OpenAPI_auth_event_copy(OpenAPI_auth_event_t *dst, OpenAPI_auth_event_t *src);
 
 #ifdef __cplusplus
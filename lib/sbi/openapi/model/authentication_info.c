@@ -158,6 +158,106 @@ end:
     return item;
 }
 
+bool OpenAPI_authentication_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_info_t *authentication_info)
+{
+    if (authentication_info == NULL) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [AuthenticationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [AuthenticationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supiOrSuci", authentication_info->supi_or_suci) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [supi_or_suci]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "servingNetworkName", authentication_info->serving_network_name) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [serving_network_name]");
+        goto end;
+    }
+
+    if (authentication_info->resynchronization_info) {
+    if (OpenAPI_resynchronization_info_writeJSON(writer, "resynchronizationInfo", authentication_info->resynchronization_info) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [resynchronization_info]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", authentication_info->pei) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", authentication_info->trace_data) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->udm_group_id) {
+    if (OpenAPI_json_write_string(writer, "udmGroupId", authentication_info->udm_group_id) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [udm_group_id]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->routing_indicator) {
+    if (OpenAPI_json_write_string(writer, "routingIndicator", authentication_info->routing_indicator) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [routing_indicator]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->cell_cag_info) {
+    if (OpenAPI_json_write_array_start(writer, "cellCagInfo") == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cell_cag_info_node;
+    OpenAPI_list_for_each(authentication_info->cell_cag_info, cell_cag_info_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)cell_cag_info_node->data) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->is_n5gc_ind) {
+    if (OpenAPI_json_write_bool(writer, "n5gcInd", authentication_info->n5gc_ind) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [n5gc_ind]");
+        goto end;
+    }
+    }
+
+    if (authentication_info->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", authentication_info->supported_features) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_info_writeJSON() failed [AuthenticationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authentication_info_t *OpenAPI_authentication_info_parseFromJSON(cJSON *authentication_infoJSON)
 {
     OpenAPI_authentication_info_t *authentication_info_local_var = NULL;
@@ -284,7 +384,6 @@ end:
 OpenAPI_authentication_info_t *OpenAPI_authentication_info_copy(OpenAPI_authentication_info_t *dst, OpenAPI_authentication_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_info_convertToJSON(src);
@@ -293,21 +392,6 @@ OpenAPI_authentication_info_t *OpenAPI_authentication_info_copy(OpenAPI_authenti
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_info_free(dst);
     dst = OpenAPI_authentication_info_parseFromJSON(item);
     cJSON_Delete(item);
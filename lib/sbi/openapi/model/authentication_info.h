@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "resynchronization_info.h"
 #include "trace_data.h"
 
@@ -50,6 +51,7 @@ OpenAPI_authentication_info_t *OpenAPI_authentication_info_create(
 void OpenAPI_authentication_info_free(OpenAPI_authentication_info_t *authentication_info);
 OpenAPI_authentication_info_t *OpenAPI_authentication_info_parseFromJSON(cJSON *authentication_infoJSON);
 cJSON *OpenAPI_authentication_info_convertToJSON(OpenAPI_authentication_info_t *authentication_info);
+bool OpenAPI_authentication_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_info_t *authentication_info);
 OpenAPI_authentication_info_t *OpenAPI_authentication_info_copy(OpenAPI_authentication_info_t *dst, OpenAPI_authentication_info_t *src);
 
 #ifdef __cplusplus
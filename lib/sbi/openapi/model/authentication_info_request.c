@@ -112,6 +112,78 @@ end:
     return item;
 }
 
+bool OpenAPI_authentication_info_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_info_request_t *authentication_info_request)
+{
+    if (authentication_info_request == NULL) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [AuthenticationInfoRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [AuthenticationInfoRequest]");
+        return false;
+    }
+    if (authentication_info_request->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", authentication_info_request->supported_features) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "servingNetworkName", authentication_info_request->serving_network_name) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [serving_network_name]");
+        goto end;
+    }
+
+    if (authentication_info_request->resynchronization_info) {
+    if (OpenAPI_resynchronization_info_writeJSON(writer, "resynchronizationInfo", authentication_info_request->resynchronization_info) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [resynchronization_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "ausfInstanceId", authentication_info_request->ausf_instance_id) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [ausf_instance_id]");
+        goto end;
+    }
+
+    if (authentication_info_request->cell_cag_info) {
+    if (OpenAPI_json_write_array_start(writer, "cellCagInfo") == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cell_cag_info_node;
+    OpenAPI_list_for_each(authentication_info_request->cell_cag_info, cell_cag_info_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)cell_cag_info_node->data) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+    }
+
+    if (authentication_info_request->is_n5gc_ind) {
+    if (OpenAPI_json_write_bool(writer, "n5gcInd", authentication_info_request->n5gc_ind) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [n5gc_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_info_request_writeJSON() failed [AuthenticationInfoRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authentication_info_request_t *OpenAPI_authentication_info_request_parseFromJSON(cJSON *authentication_info_requestJSON)
 {
     OpenAPI_authentication_info_request_t *authentication_info_request_local_var = NULL;
@@ -200,7 +272,6 @@ end:
 OpenAPI_authentication_info_request_t *OpenAPI_authentication_info_request_copy(OpenAPI_authentication_info_request_t *dst, OpenAPI_authentication_info_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_info_request_convertToJSON(src);
@@ -209,21 +280,6 @@ OpenAPI_authentication_info_request_t *OpenAPI_authentication_info_request_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_info_request_free(dst);
     dst = OpenAPI_authentication_info_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -80,6 +80,54 @@ end:
     return item;
 }
 
+bool OpenAPI_authentication_info_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_info_result_t *authentication_info_result)
+{
+    if (authentication_info_result == NULL) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [AuthenticationInfoResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [AuthenticationInfoResult]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "authType", OpenAPI_auth_type_ToString(authentication_info_result->auth_type)) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [auth_type]");
+        goto end;
+    }
+
+    if (authentication_info_result->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", authentication_info_result->supported_features) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (authentication_info_result->authentication_vector) {
+    if (OpenAPI_authentication_vector_writeJSON(writer, "authenticationVector", authentication_info_result->authentication_vector) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [authentication_vector]");
+        goto end;
+    }
+    }
+
+    if (authentication_info_result->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", authentication_info_result->supi) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_info_result_writeJSON() failed [AuthenticationInfoResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_parseFromJSON(cJSON *authentication_info_resultJSON)
 {
     OpenAPI_authentication_info_result_t *authentication_info_result_local_var = NULL;
@@ -136,7 +184,6 @@ end:
 OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_copy(OpenAPI_authentication_info_result_t *dst, OpenAPI_authentication_info_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_info_result_convertToJSON(src);
@@ -145,21 +192,6 @@ OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_info_result_free(dst);
     dst = OpenAPI_authentication_info_result_parseFromJSON(item);
     cJSON_Delete(item);
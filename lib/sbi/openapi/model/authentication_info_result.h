@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_type.h"
 #include "authentication_vector.h"
 
@@ -36,6 +37,7 @@ OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_create(
 void OpenAPI_authentication_info_result_free(OpenAPI_authentication_info_result_t *authentication_info_result);
 OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_parseFromJSON(cJSON *authentication_info_resultJSON);
 cJSON *OpenAPI_authentication_info_result_convertToJSON(OpenAPI_authentication_info_result_t *authentication_info_result);
+bool OpenAPI_authentication_info_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_info_result_t *authentication_info_result);
 OpenAPI_authentication_info_result_t *OpenAPI_authentication_info_result_copy(OpenAPI_authentication_info_result_t *dst, OpenAPI_authentication_info_result_t *src);
 
 #ifdef __cplusplus
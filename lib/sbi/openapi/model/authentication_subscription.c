@@ -161,6 +161,110 @@ end:
     return item;
 }
 
+bool OpenAPI_authentication_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_subscription_t *authentication_subscription)
+{
+    if (authentication_subscription == NULL) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [AuthenticationSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [AuthenticationSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "authenticationMethod", OpenAPI_auth_method_ToString(authentication_subscription->authentication_method)) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [authentication_method]");
+        goto end;
+    }
+
+    if (authentication_subscription->enc_permanent_key) {
+    if (OpenAPI_json_write_string(writer, "encPermanentKey", authentication_subscription->enc_permanent_key) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [enc_permanent_key]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->protection_parameter_id) {
+    if (OpenAPI_json_write_string(writer, "protectionParameterId", authentication_subscription->protection_parameter_id) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [protection_parameter_id]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->sequence_number) {
+    if (OpenAPI_sequence_number_writeJSON(writer, "sequenceNumber", authentication_subscription->sequence_number) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [sequence_number]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->authentication_management_field) {
+    if (OpenAPI_json_write_string(writer, "authenticationManagementField", authentication_subscription->authentication_management_field) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [authentication_management_field]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->algorithm_id) {
+    if (OpenAPI_json_write_string(writer, "algorithmId", authentication_subscription->algorithm_id) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [algorithm_id]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->enc_opc_key) {
+    if (OpenAPI_json_write_string(writer, "encOpcKey", authentication_subscription->enc_opc_key) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [enc_opc_key]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->enc_topc_key) {
+    if (OpenAPI_json_write_string(writer, "encTopcKey", authentication_subscription->enc_topc_key) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [enc_topc_key]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->is_vector_generation_in_hss) {
+    if (OpenAPI_json_write_bool(writer, "vectorGenerationInHss", authentication_subscription->vector_generation_in_hss) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [vector_generation_in_hss]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->n5gc_auth_method) {
+    if (OpenAPI_json_write_string(writer, "n5gcAuthMethod", OpenAPI_auth_method_ToString(authentication_subscription->n5gc_auth_method)) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [n5gc_auth_method]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->is_rg_authentication_ind) {
+    if (OpenAPI_json_write_bool(writer, "rgAuthenticationInd", authentication_subscription->rg_authentication_ind) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [rg_authentication_ind]");
+        goto end;
+    }
+    }
+
+    if (authentication_subscription->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", authentication_subscription->supi) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_subscription_writeJSON() failed [AuthenticationSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authentication_subscription_t *OpenAPI_authentication_subscription_parseFromJSON(cJSON *authentication_subscriptionJSON)
 {
     OpenAPI_authentication_subscription_t *authentication_subscription_local_var = NULL;
@@ -301,7 +405,6 @@ end:
 OpenAPI_authentication_subscription_t *OpenAPI_authentication_subscription_copy(OpenAPI_authentication_subscription_t *dst, OpenAPI_authentication_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_subscription_convertToJSON(src);
@@ -310,21 +413,6 @@ OpenAPI_authentication_subscription_t *OpenAPI_authentication_subscription_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_subscription_free(dst);
     dst = OpenAPI_authentication_subscription_parseFromJSON(item);
     cJSON_Delete(item);
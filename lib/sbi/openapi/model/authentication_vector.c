@@ -110,6 +110,78 @@ end:
     return item;
 }
 
+bool OpenAPI_authentication_vector_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_vector_t *authentication_vector)
+{
+    if (authentication_vector == NULL) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [AuthenticationVector]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [AuthenticationVector]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "avType", OpenAPI_av_type_ToString(authentication_vector->av_type)) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [av_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "rand", authentication_vector->rand) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (authentication_vector->xres) {
+    if (OpenAPI_json_write_string(writer, "xres", authentication_vector->xres) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [xres]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "autn", authentication_vector->autn) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [autn]");
+        goto end;
+    }
+
+    if (authentication_vector->ck_prime) {
+    if (OpenAPI_json_write_string(writer, "ckPrime", authentication_vector->ck_prime) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [ck_prime]");
+        goto end;
+    }
+    }
+
+    if (authentication_vector->ik_prime) {
+    if (OpenAPI_json_write_string(writer, "ikPrime", authentication_vector->ik_prime) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [ik_prime]");
+        goto end;
+    }
+    }
+
+    if (authentication_vector->xres_star) {
+    if (OpenAPI_json_write_string(writer, "xresStar", authentication_vector->xres_star) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [xres_star]");
+        goto end;
+    }
+    }
+
+    if (authentication_vector->kausf) {
+    if (OpenAPI_json_write_string(writer, "kausf", authentication_vector->kausf) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [kausf]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authentication_vector_writeJSON() failed [AuthenticationVector]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_parseFromJSON(cJSON *authentication_vectorJSON)
 {
     OpenAPI_authentication_vector_t *authentication_vector_local_var = NULL;
@@ -212,7 +284,6 @@ end:
 OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_copy(OpenAPI_authentication_vector_t *dst, OpenAPI_authentication_vector_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authentication_vector_convertToJSON(src);
@@ -221,21 +292,6 @@ OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_copy(OpenAPI_auth
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authentication_vector_free(dst);
     dst = OpenAPI_authentication_vector_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "av5_ghe_aka.h"
 #include "av_eap_aka_prime.h"
 #include "av_type.h"
@@ -45,6 +46,7 @@ OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_create(
 void OpenAPI_authentication_vector_free(OpenAPI_authentication_vector_t *authentication_vector);
 OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_parseFromJSON(cJSON *authentication_vectorJSON);
 cJSON *OpenAPI_authentication_vector_convertToJSON(OpenAPI_authentication_vector_t *authentication_vector);
+bool OpenAPI_authentication_vector_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authentication_vector_t *authentication_vector);
 OpenAPI_authentication_vector_t *OpenAPI_authentication_vector_copy(OpenAPI_authentication_vector_t *dst, OpenAPI_authentication_vector_t *src);
 
 #ifdef __cplusplus
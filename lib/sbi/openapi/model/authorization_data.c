@@ -71,6 +71,54 @@ end:
     return item;
 }
 
+bool OpenAPI_authorization_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorization_data_t *authorization_data)
+{
+    if (authorization_data == NULL) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [AuthorizationData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [AuthorizationData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "authorizationData") == false) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [authorization_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *authorization_data_node;
+    if (authorization_data->authorization_data) {
+        OpenAPI_list_for_each(authorization_data->authorization_data, authorization_data_node) {
+            if (OpenAPI_user_identifier_writeJSON(writer, NULL, authorization_data_node->data) == false) {
+                ogs_error("OpenAPI_authorization_data_writeJSON() failed [authorization_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [authorization_data]");
+        goto end;
+    }
+
+    if (authorization_data->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", authorization_data->validity_time) == false) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authorization_data_writeJSON() failed [AuthorizationData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authorization_data_t *OpenAPI_authorization_data_parseFromJSON(cJSON *authorization_dataJSON)
 {
     OpenAPI_authorization_data_t *authorization_data_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_authorization_data_t *OpenAPI_authorization_data_copy(OpenAPI_authorization_data_t *dst, OpenAPI_authorization_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorization_data_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_authorization_data_t *OpenAPI_authorization_data_copy(OpenAPI_authorizat
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorization_data_free(dst);
     dst = OpenAPI_authorization_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "user_identifier.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_authorization_data_t *OpenAPI_authorization_data_create(
 void OpenAPI_authorization_data_free(OpenAPI_authorization_data_t *authorization_data);
 OpenAPI_authorization_data_t *OpenAPI_authorization_data_parseFromJSON(cJSON *authorization_dataJSON);
 cJSON *OpenAPI_authorization_data_convertToJSON(OpenAPI_authorization_data_t *authorization_data);
+bool OpenAPI_authorization_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorization_data_t *authorization_data);
 OpenAPI_authorization_data_t *OpenAPI_authorization_data_copy(OpenAPI_authorization_data_t *dst, OpenAPI_authorization_data_t *src);
 
 #ifdef __cplusplus
@@ -148,6 +148,98 @@ end:
     return item;
 }
 
+bool OpenAPI_authorized_default_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorized_default_qos_t *authorized_default_qos)
+{
+    if (authorized_default_qos == NULL) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [AuthorizedDefaultQos]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [AuthorizedDefaultQos]");
+        return false;
+    }
+    if (authorized_default_qos->is__5qi) {
+    if (OpenAPI_json_write_number(writer, "5qi", authorized_default_qos->_5qi) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [_5qi]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->arp) {
+    if (OpenAPI_arp_writeJSON(writer, "arp", authorized_default_qos->arp) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [arp]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->is_priority_level) {
+    if (OpenAPI_json_write_number(writer, "priorityLevel", authorized_default_qos->priority_level) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [priority_level]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->is_aver_window) {
+    if (OpenAPI_json_write_number(writer, "averWindow", authorized_default_qos->aver_window) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [aver_window]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->is_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "maxDataBurstVol", authorized_default_qos->max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->maxbr_ul) {
+    if (OpenAPI_json_write_string(writer, "maxbrUl", authorized_default_qos->maxbr_ul) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [maxbr_ul]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->maxbr_dl) {
+    if (OpenAPI_json_write_string(writer, "maxbrDl", authorized_default_qos->maxbr_dl) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [maxbr_dl]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->gbr_ul) {
+    if (OpenAPI_json_write_string(writer, "gbrUl", authorized_default_qos->gbr_ul) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [gbr_ul]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->gbr_dl) {
+    if (OpenAPI_json_write_string(writer, "gbrDl", authorized_default_qos->gbr_dl) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [gbr_dl]");
+        goto end;
+    }
+    }
+
+    if (authorized_default_qos->is_ext_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "extMaxDataBurstVol", authorized_default_qos->ext_max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [ext_max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_default_qos_writeJSON() failed [AuthorizedDefaultQos]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_parseFromJSON(cJSON *authorized_default_qosJSON)
 {
     OpenAPI_authorized_default_qos_t *authorized_default_qos_local_var = NULL;
@@ -265,7 +357,6 @@ end:
 OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_copy(OpenAPI_authorized_default_qos_t *dst, OpenAPI_authorized_default_qos_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorized_default_qos_convertToJSON(src);
@@ -274,21 +365,6 @@ OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_copy(OpenAPI_au
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorized_default_qos_free(dst);
     dst = OpenAPI_authorized_default_qos_parseFromJSON(item);
     cJSON_Delete(item);
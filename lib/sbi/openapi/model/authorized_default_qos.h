@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 
 #ifdef __cplusplus
@@ -57,6 +58,7 @@ OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_create(
 void OpenAPI_authorized_default_qos_free(OpenAPI_authorized_default_qos_t *authorized_default_qos);
 OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_parseFromJSON(cJSON *authorized_default_qosJSON);
 cJSON *OpenAPI_authorized_default_qos_convertToJSON(OpenAPI_authorized_default_qos_t *authorized_default_qos);
+bool OpenAPI_authorized_default_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorized_default_qos_t *authorized_default_qos);
 OpenAPI_authorized_default_qos_t *OpenAPI_authorized_default_qos_copy(OpenAPI_authorized_default_qos_t *dst, OpenAPI_authorized_default_qos_t *src);
 
 #ifdef __cplusplus
@@ -239,6 +239,180 @@ end:
     return item;
 }
 
+bool OpenAPI_authorized_network_slice_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorized_network_slice_info_t *authorized_network_slice_info)
+{
+    if (authorized_network_slice_info == NULL) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [AuthorizedNetworkSliceInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [AuthorizedNetworkSliceInfo]");
+        return false;
+    }
+    if (authorized_network_slice_info->allowed_nssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNssaiList") == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [allowed_nssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nssai_list_node;
+    if (authorized_network_slice_info->allowed_nssai_list) {
+        OpenAPI_list_for_each(authorized_network_slice_info->allowed_nssai_list, allowed_nssai_list_node) {
+            if (OpenAPI_allowed_nssai_writeJSON(writer, NULL, allowed_nssai_list_node->data) == false) {
+                ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [allowed_nssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [allowed_nssai_list]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->configured_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "configuredNssai") == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [configured_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *configured_nssai_node;
+    if (authorized_network_slice_info->configured_nssai) {
+        OpenAPI_list_for_each(authorized_network_slice_info->configured_nssai, configured_nssai_node) {
+            if (OpenAPI_configured_snssai_writeJSON(writer, NULL, configured_nssai_node->data) == false) {
+                ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [configured_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [configured_nssai]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->target_amf_set) {
+    if (OpenAPI_json_write_string(writer, "targetAmfSet", authorized_network_slice_info->target_amf_set) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [target_amf_set]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->candidate_amf_list) {
+    if (OpenAPI_json_write_array_start(writer, "candidateAmfList") == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [candidate_amf_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *candidate_amf_list_node;
+    OpenAPI_list_for_each(authorized_network_slice_info->candidate_amf_list, candidate_amf_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)candidate_amf_list_node->data) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [candidate_amf_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [candidate_amf_list]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->rejected_nssai_in_plmn) {
+    if (OpenAPI_json_write_array_start(writer, "rejectedNssaiInPlmn") == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_plmn]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rejected_nssai_in_plmn_node;
+    if (authorized_network_slice_info->rejected_nssai_in_plmn) {
+        OpenAPI_list_for_each(authorized_network_slice_info->rejected_nssai_in_plmn, rejected_nssai_in_plmn_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, rejected_nssai_in_plmn_node->data) == false) {
+                ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_plmn]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_plmn]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->rejected_nssai_in_ta) {
+    if (OpenAPI_json_write_array_start(writer, "rejectedNssaiInTa") == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_ta]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rejected_nssai_in_ta_node;
+    if (authorized_network_slice_info->rejected_nssai_in_ta) {
+        OpenAPI_list_for_each(authorized_network_slice_info->rejected_nssai_in_ta, rejected_nssai_in_ta_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, rejected_nssai_in_ta_node->data) == false) {
+                ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_ta]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [rejected_nssai_in_ta]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->nsi_information) {
+    if (OpenAPI_nsi_information_writeJSON(writer, "nsiInformation", authorized_network_slice_info->nsi_information) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [nsi_information]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", authorized_network_slice_info->supported_features) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->nrf_amf_set) {
+    if (OpenAPI_json_write_string(writer, "nrfAmfSet", authorized_network_slice_info->nrf_amf_set) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [nrf_amf_set]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->nrf_amf_set_nf_mgt_uri) {
+    if (OpenAPI_json_write_string(writer, "nrfAmfSetNfMgtUri", authorized_network_slice_info->nrf_amf_set_nf_mgt_uri) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [nrf_amf_set_nf_mgt_uri]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->nrf_amf_set_access_token_uri) {
+    if (OpenAPI_json_write_string(writer, "nrfAmfSetAccessTokenUri", authorized_network_slice_info->nrf_amf_set_access_token_uri) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [nrf_amf_set_access_token_uri]");
+        goto end;
+    }
+    }
+
+    if (authorized_network_slice_info->target_amf_service_set) {
+    if (OpenAPI_json_write_string(writer, "targetAmfServiceSet", authorized_network_slice_info->target_amf_service_set) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [target_amf_service_set]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_authorized_network_slice_info_writeJSON() failed [AuthorizedNetworkSliceInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_parseFromJSON(cJSON *authorized_network_slice_infoJSON)
 {
     OpenAPI_authorized_network_slice_info_t *authorized_network_slice_info_local_var = NULL;
@@ -462,7 +636,6 @@ end:
 OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_copy(OpenAPI_authorized_network_slice_info_t *dst, OpenAPI_authorized_network_slice_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_authorized_network_slice_info_convertToJSON(src);
@@ -471,21 +644,6 @@ OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_authorized_network_slice_info_free(dst);
     dst = OpenAPI_authorized_network_slice_info_parseFromJSON(item);
     cJSON_Delete(item);
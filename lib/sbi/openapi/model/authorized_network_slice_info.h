@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "allowed_nssai.h"
 #include "configured_snssai.h"
 #include "nsi_information.h"
@@ -54,6 +55,7 @@ OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_c
 void OpenAPI_authorized_network_slice_info_free(OpenAPI_authorized_network_slice_info_t *authorized_network_slice_info);
 OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_parseFromJSON(cJSON *authorized_network_slice_infoJSON);
 cJSON *OpenAPI_authorized_network_slice_info_convertToJSON(OpenAPI_authorized_network_slice_info_t *authorized_network_slice_info);
+bool OpenAPI_authorized_network_slice_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_authorized_network_slice_info_t *authorized_network_slice_info);
 OpenAPI_authorized_network_slice_info_t *OpenAPI_authorized_network_slice_info_copy(OpenAPI_authorized_network_slice_info_t *dst, OpenAPI_authorized_network_slice_info_t *src);
 
 #ifdef __cplusplus
@@ -80,6 +80,57 @@ end:
     return item;
 }
 
+bool OpenAPI_av5_ghe_aka_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av5_ghe_aka_t *av5_ghe_aka)
+{
+    if (av5_ghe_aka == NULL) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [Av5GHeAka]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [Av5GHeAka]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "avType", OpenAPI_av_type_ToString(av5_ghe_aka->av_type)) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [av_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "rand", av5_ghe_aka->rand) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (av5_ghe_aka->xres_star) {
+    if (OpenAPI_json_write_string(writer, "xresStar", av5_ghe_aka->xres_star) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [xres_star]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "autn", av5_ghe_aka->autn) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [autn]");
+        goto end;
+    }
+
+    if (av5_ghe_aka->kausf) {
+    if (OpenAPI_json_write_string(writer, "kausf", av5_ghe_aka->kausf) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [kausf]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_av5_ghe_aka_writeJSON() failed [Av5GHeAka]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_av5_ghe_aka_t *OpenAPI_av5_ghe_aka_parseFromJSON(cJSON *av5_ghe_akaJSON)
 {
     OpenAPI_av5_ghe_aka_t *av5_ghe_aka_local_var = NULL;
@@ -152,7 +203,6 @@ end:
 OpenAPI_av5_ghe_aka_t *OpenAPI_av5_ghe_aka_copy(OpenAPI_av5_ghe_aka_t *dst, OpenAPI_av5_ghe_aka_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_av5_ghe_aka_convertToJSON(src);
@@ -161,21 +211,6 @@ OpenAPI_av5_ghe_aka_t *OpenAPI_av5_ghe_aka_copy(OpenAPI_av5_ghe_aka_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_av5_ghe_aka_free(dst);
     dst = OpenAPI_av5_ghe_aka_parseFromJSON(item);
     cJSON_Delete(item);
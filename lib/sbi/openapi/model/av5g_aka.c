@@ -61,6 +61,43 @@ end:
     return item;
 }
 
+bool OpenAPI_av5g_aka_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av5g_aka_t *av5g_aka)
+{
+    if (av5g_aka == NULL) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [Av5gAka]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [Av5gAka]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "rand", av5g_aka->rand) == false) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "hxresStar", av5g_aka->hxres_star) == false) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [hxres_star]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "autn", av5g_aka->autn) == false) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [autn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_av5g_aka_writeJSON() failed [Av5gAka]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_parseFromJSON(cJSON *av5g_akaJSON)
 {
     OpenAPI_av5g_aka_t *av5g_aka_local_var = NULL;
@@ -111,7 +148,6 @@ end:
 OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_copy(OpenAPI_av5g_aka_t *dst, OpenAPI_av5g_aka_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_av5g_aka_convertToJSON(src);
@@ -120,21 +156,6 @@ OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_copy(OpenAPI_av5g_aka_t *dst, OpenAPI_av5g_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_av5g_aka_free(dst);
     dst = OpenAPI_av5g_aka_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_create(
 void OpenAPI_av5g_aka_free(OpenAPI_av5g_aka_t *av5g_aka);
 OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_parseFromJSON(cJSON *av5g_akaJSON);
 cJSON *OpenAPI_av5g_aka_convertToJSON(OpenAPI_av5g_aka_t *av5g_aka);
+bool OpenAPI_av5g_aka_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av5g_aka_t *av5g_aka);
 OpenAPI_av5g_aka_t *OpenAPI_av5g_aka_copy(OpenAPI_av5g_aka_t *dst, OpenAPI_av5g_aka_t *src);
 
 #ifdef __cplusplus
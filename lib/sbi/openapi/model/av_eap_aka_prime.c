@@ -90,6 +90,64 @@ end:
     return item;
 }
 
+bool OpenAPI_av_eap_aka_prime_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av_eap_aka_prime_t *av_eap_aka_prime)
+{
+    if (av_eap_aka_prime == NULL) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [AvEapAkaPrime]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [AvEapAkaPrime]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "avType", OpenAPI_av_type_ToString(av_eap_aka_prime->av_type)) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [av_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "rand", av_eap_aka_prime->rand) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (av_eap_aka_prime->xres) {
+    if (OpenAPI_json_write_string(writer, "xres", av_eap_aka_prime->xres) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [xres]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "autn", av_eap_aka_prime->autn) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [autn]");
+        goto end;
+    }
+
+    if (av_eap_aka_prime->ck_prime) {
+    if (OpenAPI_json_write_string(writer, "ckPrime", av_eap_aka_prime->ck_prime) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [ck_prime]");
+        goto end;
+    }
+    }
+
+    if (av_eap_aka_prime->ik_prime) {
+    if (OpenAPI_json_write_string(writer, "ikPrime", av_eap_aka_prime->ik_prime) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [ik_prime]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_av_eap_aka_prime_writeJSON() failed [AvEapAkaPrime]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_parseFromJSON(cJSON *av_eap_aka_primeJSON)
 {
     OpenAPI_av_eap_aka_prime_t *av_eap_aka_prime_local_var = NULL;
@@ -172,7 +230,6 @@ end:
 OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_copy(OpenAPI_av_eap_aka_prime_t *dst, OpenAPI_av_eap_aka_prime_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_av_eap_aka_prime_convertToJSON(src);
@@ -181,21 +238,6 @@ OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_copy(OpenAPI_av_eap_aka_pri
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_av_eap_aka_prime_free(dst);
     dst = OpenAPI_av_eap_aka_prime_parseFromJSON(item);
     cJSON_Delete(item);
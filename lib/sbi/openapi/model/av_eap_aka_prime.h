@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "av_type.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_create(
 void OpenAPI_av_eap_aka_prime_free(OpenAPI_av_eap_aka_prime_t *av_eap_aka_prime);
 OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_parseFromJSON(cJSON *av_eap_aka_primeJSON);
 cJSON *OpenAPI_av_eap_aka_prime_convertToJSON(OpenAPI_av_eap_aka_prime_t *av_eap_aka_prime);
+bool OpenAPI_av_eap_aka_prime_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av_eap_aka_prime_t *av_eap_aka_prime);
 OpenAPI_av_eap_aka_prime_t *OpenAPI_av_eap_aka_prime_copy(OpenAPI_av_eap_aka_prime_t *dst, OpenAPI_av_eap_aka_prime_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "hss_av_type.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_av_eps_aka_t *OpenAPI_av_eps_aka_create(
 void OpenAPI_av_eps_aka_free(OpenAPI_av_eps_aka_t *av_eps_aka);
 OpenAPI_av_eps_aka_t *OpenAPI_av_eps_aka_parseFromJSON(cJSON *av_eps_akaJSON);
 cJSON *OpenAPI_av_eps_aka_convertToJSON(OpenAPI_av_eps_aka_t *av_eps_aka);
+bool OpenAPI_av_eps_aka_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av_eps_aka_t *av_eps_aka);
 OpenAPI_av_eps_aka_t *OpenAPI_av_eps_aka_copy(OpenAPI_av_eps_aka_t *dst, OpenAPI_av_eps_aka_t *src);
 
 #ifdef __cplusplus
@@ -84,6 +84,58 @@ end:
     return item;
 }
 
+bool OpenAPI_av_ims_gba_eap_aka_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_av_ims_gba_eap_aka_t *av_ims_gba_eap_aka)
+{
+    if (av_ims_gba_eap_aka == NULL) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [AvImsGbaEapAka]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [AvImsGbaEapAka]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "avType", OpenAPI_hss_av_type_ToString(av_ims_gba_eap_aka->av_type)) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [av_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "rand", av_ims_gba_eap_aka->rand) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "xres", av_ims_gba_eap_aka->xres) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [xres]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "autn", av_ims_gba_eap_aka->autn) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [autn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ck", av_ims_gba_eap_aka->ck) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [ck]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ik", av_ims_gba_eap_aka->ik) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [ik]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_av_ims_gba_eap_aka_writeJSON() failed [AvImsGbaEapAka]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_av_ims_gba_eap_aka_t *OpenAPI_av_ims_gba_eap_aka_parseFromJSON(cJSON *av_ims_gba_eap_akaJSON)
 {
     OpenAPI_av_ims_gba_eap_aka_t *av_ims_gba_eap_aka_local_var = NULL;
@@ -172,7 +224,6 @@ end:
 OpenAPI_av_ims_gba_eap_aka_t *OpenAPI_av_ims_gba_eap_aka_copy(OpenAPI_av_ims_gba_eap_aka_t *dst, OpenAPI_av_ims_gba_eap_aka_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_av_ims_gba_eap_aka_convertToJSON(src);
@@ -181,21 +232,6 @@ OpenAPI_av_ims_gba_eap_aka_t *OpenAPI_av_ims_gba_eap_aka_copy(OpenAPI_av_ims_gba
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_av_ims_gba_eap_aka_free(dst);
     dst = OpenAPI_av_ims_gba_eap_aka_parseFromJSON(item);
     cJSON_Delete(item);
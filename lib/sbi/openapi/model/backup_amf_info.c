@@ -71,6 +71,54 @@ end:
     return item;
 }
 
+bool OpenAPI_backup_amf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_backup_amf_info_t *backup_amf_info)
+{
+    if (backup_amf_info == NULL) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [BackupAmfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [BackupAmfInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "backupAmf", backup_amf_info->backup_amf) == false) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [backup_amf]");
+        goto end;
+    }
+
+    if (backup_amf_info->guami_list) {
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (backup_amf_info->guami_list) {
+        OpenAPI_list_for_each(backup_amf_info->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [guami_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_backup_amf_info_writeJSON() failed [BackupAmfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_parseFromJSON(cJSON *backup_amf_infoJSON)
 {
     OpenAPI_backup_amf_info_t *backup_amf_info_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_copy(OpenAPI_backup_amf_info_t *dst, OpenAPI_backup_amf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_backup_amf_info_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_copy(OpenAPI_backup_amf_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_backup_amf_info_free(dst);
     dst = OpenAPI_backup_amf_info_parseFromJSON(item);
     cJSON_Delete(item);
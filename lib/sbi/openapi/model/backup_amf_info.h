@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "guami.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_create(
 void OpenAPI_backup_amf_info_free(OpenAPI_backup_amf_info_t *backup_amf_info);
 OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_parseFromJSON(cJSON *backup_amf_infoJSON);
 cJSON *OpenAPI_backup_amf_info_convertToJSON(OpenAPI_backup_amf_info_t *backup_amf_info);
+bool OpenAPI_backup_amf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_backup_amf_info_t *backup_amf_info);
 OpenAPI_backup_amf_info_t *OpenAPI_backup_amf_info_copy(OpenAPI_backup_amf_info_t *dst, OpenAPI_backup_amf_info_t *src);
 
 #ifdef __cplusplus
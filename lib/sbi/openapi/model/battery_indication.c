@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_battery_indication_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_battery_indication_t *battery_indication)
+{
+    if (battery_indication == NULL) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [BatteryIndication]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [BatteryIndication]");
+        return false;
+    }
+    if (battery_indication->is_battery_ind) {
+    if (OpenAPI_json_write_bool(writer, "batteryInd", battery_indication->battery_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [battery_ind]");
+        goto end;
+    }
+    }
+
+    if (battery_indication->is_replaceable_ind) {
+    if (OpenAPI_json_write_bool(writer, "replaceableInd", battery_indication->replaceable_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [replaceable_ind]");
+        goto end;
+    }
+    }
+
+    if (battery_indication->is_rechargeable_ind) {
+    if (OpenAPI_json_write_bool(writer, "rechargeableInd", battery_indication->rechargeable_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [rechargeable_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_battery_indication_writeJSON() failed [BatteryIndication]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_battery_indication_t *OpenAPI_battery_indication_parseFromJSON(cJSON *battery_indicationJSON)
 {
     OpenAPI_battery_indication_t *battery_indication_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_battery_indication_t *OpenAPI_battery_indication_copy(OpenAPI_battery_indication_t *dst, OpenAPI_battery_indication_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_battery_indication_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_battery_indication_t *OpenAPI_battery_indication_copy(OpenAPI_battery_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_battery_indication_free(dst);
     dst = OpenAPI_battery_indication_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,7 @@ OpenAPI_battery_indication_t *OpenAPI_battery_indication_create(
 void OpenAPI_battery_indication_free(OpenAPI_battery_indication_t *battery_indication);
 OpenAPI_battery_indication_t *OpenAPI_battery_indication_parseFromJSON(cJSON *battery_indicationJSON);
 cJSON *OpenAPI_battery_indication_convertToJSON(OpenAPI_battery_indication_t *battery_indication);
+bool OpenAPI_battery_indication_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_battery_indication_t *battery_indication);
 OpenAPI_battery_indication_t *OpenAPI_battery_indication_copy(OpenAPI_battery_indication_t *dst, OpenAPI_battery_indication_t *src);
 
 #ifdef __cplusplus
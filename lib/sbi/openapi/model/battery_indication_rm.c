@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_battery_indication_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_battery_indication_rm_t *battery_indication_rm)
+{
+    if (battery_indication_rm == NULL) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [BatteryIndicationRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [BatteryIndicationRm]");
+        return false;
+    }
+    if (battery_indication_rm->is_battery_ind) {
+    if (OpenAPI_json_write_bool(writer, "batteryInd", battery_indication_rm->battery_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [battery_ind]");
+        goto end;
+    }
+    }
+
+    if (battery_indication_rm->is_replaceable_ind) {
+    if (OpenAPI_json_write_bool(writer, "replaceableInd", battery_indication_rm->replaceable_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [replaceable_ind]");
+        goto end;
+    }
+    }
+
+    if (battery_indication_rm->is_rechargeable_ind) {
+    if (OpenAPI_json_write_bool(writer, "rechargeableInd", battery_indication_rm->rechargeable_ind) == false) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [rechargeable_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_battery_indication_rm_writeJSON() failed [BatteryIndicationRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_parseFromJSON(cJSON *battery_indication_rmJSON)
 {
     OpenAPI_battery_indication_rm_t *battery_indication_rm_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_copy(OpenAPI_battery_indication_rm_t *dst, OpenAPI_battery_indication_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_battery_indication_rm_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_copy(OpenAPI_batt
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_battery_indication_rm_free(dst);
     dst = OpenAPI_battery_indication_rm_parseFromJSON(item);
     cJSON_Delete(item);
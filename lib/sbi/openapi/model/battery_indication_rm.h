@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "battery_indication.h"
 #include "null_value.h"
 
@@ -40,6 +41,7 @@ OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_create(
 void OpenAPI_battery_indication_rm_free(OpenAPI_battery_indication_rm_t *battery_indication_rm);
 OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_parseFromJSON(cJSON *battery_indication_rmJSON);
 cJSON *OpenAPI_battery_indication_rm_convertToJSON(OpenAPI_battery_indication_rm_t *battery_indication_rm);
+bool OpenAPI_battery_indication_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_battery_indication_rm_t *battery_indication_rm);
 OpenAPI_battery_indication_rm_t *OpenAPI_battery_indication_rm_copy(OpenAPI_battery_indication_rm_t *dst, OpenAPI_battery_indication_rm_t *src);
 
 #ifdef __cplusplus
@@ -174,6 +174,101 @@ end:
     return item;
 }
 
+bool OpenAPI_bdt_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_data_t *bdt_data)
+{
+    if (bdt_data == NULL) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [BdtData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [BdtData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "aspId", bdt_data->asp_id) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [asp_id]");
+        goto end;
+    }
+
+    if (OpenAPI_transfer_policy_writeJSON(writer, "transPolicy", bdt_data->trans_policy) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [trans_policy]");
+        goto end;
+    }
+
+    if (bdt_data->bdt_ref_id) {
+    if (OpenAPI_json_write_string(writer, "bdtRefId", bdt_data->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->nw_area_info) {
+    if (OpenAPI_network_area_info_1_writeJSON(writer, "nwAreaInfo", bdt_data->nw_area_info) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [nw_area_info]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->is_num_of_ues) {
+    if (OpenAPI_json_write_number(writer, "numOfUes", bdt_data->num_of_ues) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [num_of_ues]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->vol_per_ue) {
+    if (OpenAPI_usage_threshold_writeJSON(writer, "volPerUe", bdt_data->vol_per_ue) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [vol_per_ue]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", bdt_data->dnn) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", bdt_data->snssai) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->traffic_des) {
+    if (OpenAPI_json_write_string(writer, "trafficDes", bdt_data->traffic_des) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [traffic_des]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->bdtp_status) {
+    if (OpenAPI_bdt_policy_status_writeJSON(writer, "bdtpStatus", bdt_data->bdtp_status) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [bdtp_status]");
+        goto end;
+    }
+    }
+
+    if (bdt_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", bdt_data->supp_feat) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bdt_data_writeJSON() failed [BdtData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bdt_data_t *OpenAPI_bdt_data_parseFromJSON(cJSON *bdt_dataJSON)
 {
     OpenAPI_bdt_data_t *bdt_data_local_var = NULL;
@@ -293,7 +388,6 @@ end:
 OpenAPI_bdt_data_t *OpenAPI_bdt_data_copy(OpenAPI_bdt_data_t *dst, OpenAPI_bdt_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bdt_data_convertToJSON(src);
@@ -302,21 +396,6 @@ OpenAPI_bdt_data_t *OpenAPI_bdt_data_copy(OpenAPI_bdt_data_t *dst, OpenAPI_bdt_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bdt_data_free(dst);
     dst = OpenAPI_bdt_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "bdt_policy_status.h"
 #include "network_area_info_1.h"
 #include "snssai.h"
@@ -55,6 +56,7 @@ OpenAPI_bdt_data_t *OpenAPI_bdt_data_create(
 void OpenAPI_bdt_data_free(OpenAPI_bdt_data_t *bdt_data);
 OpenAPI_bdt_data_t *OpenAPI_bdt_data_parseFromJSON(cJSON *bdt_dataJSON);
 cJSON *OpenAPI_bdt_data_convertToJSON(OpenAPI_bdt_data_t *bdt_data);
+bool OpenAPI_bdt_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_data_t *bdt_data);
 OpenAPI_bdt_data_t *OpenAPI_bdt_data_copy(OpenAPI_bdt_data_t *dst, OpenAPI_bdt_data_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,42 @@ end:
     return item;
 }
 
+bool OpenAPI_bdt_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_data_patch_t *bdt_data_patch)
+{
+    if (bdt_data_patch == NULL) {
+        ogs_error("OpenAPI_bdt_data_patch_writeJSON() failed [BdtDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bdt_data_patch_writeJSON() failed [BdtDataPatch]");
+        return false;
+    }
+    if (bdt_data_patch->trans_policy) {
+    if (OpenAPI_transfer_policy_writeJSON(writer, "transPolicy", bdt_data_patch->trans_policy) == false) {
+        ogs_error("OpenAPI_bdt_data_patch_writeJSON() failed [trans_policy]");
+        goto end;
+    }
+    }
+
+    if (bdt_data_patch->bdtp_status) {
+    if (OpenAPI_bdt_policy_status_writeJSON(writer, "bdtpStatus", bdt_data_patch->bdtp_status) == false) {
+        ogs_error("OpenAPI_bdt_data_patch_writeJSON() failed [bdtp_status]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bdt_data_patch_writeJSON() failed [BdtDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_parseFromJSON(cJSON *bdt_data_patchJSON)
 {
     OpenAPI_bdt_data_patch_t *bdt_data_patch_local_var = NULL;
@@ -99,7 +135,6 @@ end:
 OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_copy(OpenAPI_bdt_data_patch_t *dst, OpenAPI_bdt_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bdt_data_patch_convertToJSON(src);
@@ -108,21 +143,6 @@ OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_copy(OpenAPI_bdt_data_patch_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bdt_data_patch_free(dst);
     dst = OpenAPI_bdt_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "bdt_policy_status.h"
 #include "transfer_policy.h"
 
@@ -32,6 +33,7 @@ OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_create(
 void OpenAPI_bdt_data_patch_free(OpenAPI_bdt_data_patch_t *bdt_data_patch);
 OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_parseFromJSON(cJSON *bdt_data_patchJSON);
 cJSON *OpenAPI_bdt_data_patch_convertToJSON(OpenAPI_bdt_data_patch_t *bdt_data_patch);
+bool OpenAPI_bdt_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_data_patch_t *bdt_data_patch);
 OpenAPI_bdt_data_patch_t *OpenAPI_bdt_data_patch_copy(OpenAPI_bdt_data_patch_t *dst, OpenAPI_bdt_data_patch_t *src);
 
 #ifdef __cplusplus
@@ -101,6 +101,68 @@ end:
     return item;
 }
 
+bool OpenAPI_bdt_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_policy_data_t *bdt_policy_data)
+{
+    if (bdt_policy_data == NULL) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [BdtPolicyData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [BdtPolicyData]");
+        return false;
+    }
+    if (bdt_policy_data->inter_group_id) {
+    if (OpenAPI_json_write_string(writer, "interGroupId", bdt_policy_data->inter_group_id) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [inter_group_id]");
+        goto end;
+    }
+    }
+
+    if (bdt_policy_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", bdt_policy_data->supi) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "bdtRefId", bdt_policy_data->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+
+    if (bdt_policy_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", bdt_policy_data->dnn) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (bdt_policy_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", bdt_policy_data->snssai) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (bdt_policy_data->res_uri) {
+    if (OpenAPI_json_write_string(writer, "resUri", bdt_policy_data->res_uri) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [res_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_writeJSON() failed [BdtPolicyData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_parseFromJSON(cJSON *bdt_policy_dataJSON)
 {
     OpenAPI_bdt_policy_data_t *bdt_policy_data_local_var = NULL;
@@ -175,7 +237,6 @@ end:
 OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_copy(OpenAPI_bdt_policy_data_t *dst, OpenAPI_bdt_policy_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bdt_policy_data_convertToJSON(src);
@@ -184,21 +245,6 @@ OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_copy(OpenAPI_bdt_policy_data_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bdt_policy_data_free(dst);
     dst = OpenAPI_bdt_policy_data_parseFromJSON(item);
     cJSON_Delete(item);
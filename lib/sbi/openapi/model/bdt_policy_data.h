@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_create(
 void OpenAPI_bdt_policy_data_free(OpenAPI_bdt_policy_data_t *bdt_policy_data);
 OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_parseFromJSON(cJSON *bdt_policy_dataJSON);
 cJSON *OpenAPI_bdt_policy_data_convertToJSON(OpenAPI_bdt_policy_data_t *bdt_policy_data);
+bool OpenAPI_bdt_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_policy_data_t *bdt_policy_data);
 OpenAPI_bdt_policy_data_t *OpenAPI_bdt_policy_data_copy(OpenAPI_bdt_policy_data_t *dst, OpenAPI_bdt_policy_data_t *src);
 
 #ifdef __cplusplus
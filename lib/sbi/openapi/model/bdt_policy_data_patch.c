@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_bdt_policy_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_policy_data_patch_t *bdt_policy_data_patch)
+{
+    if (bdt_policy_data_patch == NULL) {
+        ogs_error("OpenAPI_bdt_policy_data_patch_writeJSON() failed [BdtPolicyDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_patch_writeJSON() failed [BdtPolicyDataPatch]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "bdtRefId", bdt_policy_data_patch->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_patch_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bdt_policy_data_patch_writeJSON() failed [BdtPolicyDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bdt_policy_data_patch_t *OpenAPI_bdt_policy_data_patch_parseFromJSON(cJSON *bdt_policy_data_patchJSON)
 {
     OpenAPI_bdt_policy_data_patch_t *bdt_policy_data_patch_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_bdt_policy_data_patch_t *OpenAPI_bdt_policy_data_patch_copy(OpenAPI_bdt_policy_data_patch_t *dst, OpenAPI_bdt_policy_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bdt_policy_data_patch_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_bdt_policy_data_patch_t *OpenAPI_bdt_policy_data_patch_copy(OpenAPI_bdt_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bdt_policy_data_patch_free(dst);
     dst = OpenAPI_bdt_policy_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
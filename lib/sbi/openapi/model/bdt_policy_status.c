@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_bdt_policy_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bdt_policy_status_t *bdt_policy_status)
+{
+    if (bdt_policy_status == NULL) {
+        ogs_error("OpenAPI_bdt_policy_status_writeJSON() failed [BdtPolicyStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bdt_policy_status_writeJSON() failed [BdtPolicyStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bdt_policy_status_writeJSON() failed [BdtPolicyStatus]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bdt_policy_status_t *OpenAPI_bdt_policy_status_parseFromJSON(cJSON *bdt_policy_statusJSON)
 {
     OpenAPI_bdt_policy_status_t *bdt_policy_status_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_bdt_policy_status_t *OpenAPI_bdt_policy_status_copy(OpenAPI_bdt_policy_status_t *dst, OpenAPI_bdt_policy_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bdt_policy_status_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_bdt_policy_status_t *OpenAPI_bdt_policy_status_copy(OpenAPI_bdt_policy_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bdt_policy_status_free(dst);
     dst = OpenAPI_bdt_policy_status_parseFromJSON(item);
     cJSON_Delete(item);
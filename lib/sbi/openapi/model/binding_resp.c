@@ -73,6 +73,56 @@ end:
     return item;
 }
 
+bool OpenAPI_binding_resp_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_binding_resp_t *binding_resp)
+{
+    if (binding_resp == NULL) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [BindingResp]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [BindingResp]");
+        return false;
+    }
+    if (binding_resp->pcf_sm_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pcfSmFqdn", binding_resp->pcf_sm_fqdn) == false) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [pcf_sm_fqdn]");
+        goto end;
+    }
+    }
+
+    if (binding_resp->pcf_sm_ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "pcfSmIpEndPoints") == false) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [pcf_sm_ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pcf_sm_ip_end_points_node;
+    if (binding_resp->pcf_sm_ip_end_points) {
+        OpenAPI_list_for_each(binding_resp->pcf_sm_ip_end_points, pcf_sm_ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, pcf_sm_ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_binding_resp_writeJSON() failed [pcf_sm_ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [pcf_sm_ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_binding_resp_writeJSON() failed [BindingResp]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_binding_resp_t *OpenAPI_binding_resp_parseFromJSON(cJSON *binding_respJSON)
 {
     OpenAPI_binding_resp_t *binding_resp_local_var = NULL;
@@ -127,7 +177,6 @@ end:
 OpenAPI_binding_resp_t *OpenAPI_binding_resp_copy(OpenAPI_binding_resp_t *dst, OpenAPI_binding_resp_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_binding_resp_convertToJSON(src);
@@ -136,21 +185,6 @@ OpenAPI_binding_resp_t *OpenAPI_binding_resp_copy(OpenAPI_binding_resp_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_binding_resp_free(dst);
     dst = OpenAPI_binding_resp_parseFromJSON(item);
     cJSON_Delete(item);
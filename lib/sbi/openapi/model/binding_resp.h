@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_end_point.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_binding_resp_t *OpenAPI_binding_resp_create(
 void OpenAPI_binding_resp_free(OpenAPI_binding_resp_t *binding_resp);
 OpenAPI_binding_resp_t *OpenAPI_binding_resp_parseFromJSON(cJSON *binding_respJSON);
 cJSON *OpenAPI_binding_resp_convertToJSON(OpenAPI_binding_resp_t *binding_resp);
+bool OpenAPI_binding_resp_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_binding_resp_t *binding_resp);
 OpenAPI_binding_resp_t *OpenAPI_binding_resp_copy(OpenAPI_binding_resp_t *dst, OpenAPI_binding_resp_t *src);
 
 #ifdef __cplusplus
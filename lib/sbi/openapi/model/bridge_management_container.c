@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_bridge_management_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bridge_management_container_t *bridge_management_container)
+{
+    if (bridge_management_container == NULL) {
+        ogs_error("OpenAPI_bridge_management_container_writeJSON() failed [BridgeManagementContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bridge_management_container_writeJSON() failed [BridgeManagementContainer]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "bridgeManCont", bridge_management_container->bridge_man_cont) == false) {
+        ogs_error("OpenAPI_bridge_management_container_writeJSON() failed [bridge_man_cont]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bridge_management_container_writeJSON() failed [BridgeManagementContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_parseFromJSON(cJSON *bridge_management_containerJSON)
 {
     OpenAPI_bridge_management_container_t *bridge_management_container_local_var = NULL;
@@ -70,7 +97,6 @@ end:
 OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_copy(OpenAPI_bridge_management_container_t *dst, OpenAPI_bridge_management_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bridge_management_container_convertToJSON(src);
@@ -79,21 +105,6 @@ OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bridge_management_container_free(dst);
     dst = OpenAPI_bridge_management_container_parseFromJSON(item);
     cJSON_Delete(item);
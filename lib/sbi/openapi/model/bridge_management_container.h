@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_creat
 void OpenAPI_bridge_management_container_free(OpenAPI_bridge_management_container_t *bridge_management_container);
 OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_parseFromJSON(cJSON *bridge_management_containerJSON);
 cJSON *OpenAPI_bridge_management_container_convertToJSON(OpenAPI_bridge_management_container_t *bridge_management_container);
+bool OpenAPI_bridge_management_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bridge_management_container_t *bridge_management_container);
 OpenAPI_bridge_management_container_t *OpenAPI_bridge_management_container_copy(OpenAPI_bridge_management_container_t *dst, OpenAPI_bridge_management_container_t *src);
 
 #ifdef __cplusplus
@@ -133,6 +133,108 @@ end:
     return item;
 }
 
+bool OpenAPI_bsf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bsf_info_t *bsf_info)
+{
+    if (bsf_info == NULL) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [BsfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [BsfInfo]");
+        return false;
+    }
+    if (bsf_info->dnn_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnnList") == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_list_node;
+    OpenAPI_list_for_each(bsf_info->dnn_list, dnn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnn_list_node->data) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+    }
+
+    if (bsf_info->ip_domain_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipDomainList") == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ip_domain_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ip_domain_list_node;
+    OpenAPI_list_for_each(bsf_info->ip_domain_list, ip_domain_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ip_domain_list_node->data) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ip_domain_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ip_domain_list]");
+        goto end;
+    }
+    }
+
+    if (bsf_info->ipv4_address_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4AddressRanges") == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv4_address_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_address_ranges_node;
+    if (bsf_info->ipv4_address_ranges) {
+        OpenAPI_list_for_each(bsf_info->ipv4_address_ranges, ipv4_address_ranges_node) {
+            if (OpenAPI_ipv4_address_range_writeJSON(writer, NULL, ipv4_address_ranges_node->data) == false) {
+                ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv4_address_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv4_address_ranges]");
+        goto end;
+    }
+    }
+
+    if (bsf_info->ipv6_prefix_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6PrefixRanges") == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_prefix_ranges_node;
+    if (bsf_info->ipv6_prefix_ranges) {
+        OpenAPI_list_for_each(bsf_info->ipv6_prefix_ranges, ipv6_prefix_ranges_node) {
+            if (OpenAPI_ipv6_prefix_range_writeJSON(writer, NULL, ipv6_prefix_ranges_node->data) == false) {
+                ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv6_prefix_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_bsf_info_writeJSON() failed [BsfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_bsf_info_t *OpenAPI_bsf_info_parseFromJSON(cJSON *bsf_infoJSON)
 {
     OpenAPI_bsf_info_t *bsf_info_local_var = NULL;
@@ -249,7 +351,6 @@ end:
 OpenAPI_bsf_info_t *OpenAPI_bsf_info_copy(OpenAPI_bsf_info_t *dst, OpenAPI_bsf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_bsf_info_convertToJSON(src);
@@ -258,21 +359,6 @@ OpenAPI_bsf_info_t *OpenAPI_bsf_info_copy(OpenAPI_bsf_info_t *dst, OpenAPI_bsf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_bsf_info_free(dst);
     dst = OpenAPI_bsf_info_parseFromJSON(item);
     cJSON_Delete(item);
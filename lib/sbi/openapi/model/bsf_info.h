@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ipv4_address_range.h"
 #include "ipv6_prefix_range.h"
 
@@ -36,6 +37,7 @@ OpenAPI_bsf_info_t *OpenAPI_bsf_info_create(
 void OpenAPI_bsf_info_free(OpenAPI_bsf_info_t *bsf_info);
 OpenAPI_bsf_info_t *OpenAPI_bsf_info_parseFromJSON(cJSON *bsf_infoJSON);
 cJSON *OpenAPI_bsf_info_convertToJSON(OpenAPI_bsf_info_t *bsf_info);
+bool OpenAPI_bsf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_bsf_info_t *bsf_info);
 OpenAPI_bsf_info_t *OpenAPI_bsf_info_copy(OpenAPI_bsf_info_t *dst, OpenAPI_bsf_info_t *src);
 
 #ifdef __cplusplus
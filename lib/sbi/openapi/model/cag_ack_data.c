@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_cag_ack_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_ack_data_t *cag_ack_data)
+{
+    if (cag_ack_data == NULL) {
+        ogs_error("OpenAPI_cag_ack_data_writeJSON() failed [CagAckData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cag_ack_data_writeJSON() failed [CagAckData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "provisioningTime", cag_ack_data->provisioning_time) == false) {
+        ogs_error("OpenAPI_cag_ack_data_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ueUpdateStatus", OpenAPI_ue_update_status_ToString(cag_ack_data->ue_update_status)) == false) {
+        ogs_error("OpenAPI_cag_ack_data_writeJSON() failed [ue_update_status]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cag_ack_data_writeJSON() failed [CagAckData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cag_ack_data_t *OpenAPI_cag_ack_data_parseFromJSON(cJSON *cag_ack_dataJSON)
 {
     OpenAPI_cag_ack_data_t *cag_ack_data_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_cag_ack_data_t *OpenAPI_cag_ack_data_copy(OpenAPI_cag_ack_data_t *dst, OpenAPI_cag_ack_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cag_ack_data_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_cag_ack_data_t *OpenAPI_cag_ack_data_copy(OpenAPI_cag_ack_data_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cag_ack_data_free(dst);
     dst = OpenAPI_cag_ack_data_parseFromJSON(item);
     cJSON_Delete(item);
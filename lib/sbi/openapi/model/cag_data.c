@@ -77,6 +77,56 @@ end:
     return item;
 }
 
+bool OpenAPI_cag_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_data_t *cag_data)
+{
+    if (cag_data == NULL) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [CagData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [CagData]");
+        return false;
+    }
+    if (OpenAPI_json_write_object_start(writer, "cagInfos") == false) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [cag_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *cag_infos_node;
+    if (cag_data->cag_infos) {
+        OpenAPI_list_for_each(cag_data->cag_infos, cag_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)cag_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_cag_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_cag_data_writeJSON() failed [cag_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [cag_infos]");
+        goto end;
+    }
+
+    if (cag_data->provisioning_time) {
+    if (OpenAPI_json_write_string(writer, "provisioningTime", cag_data->provisioning_time) == false) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cag_data_writeJSON() failed [CagData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cag_data_t *OpenAPI_cag_data_parseFromJSON(cJSON *cag_dataJSON)
 {
     OpenAPI_cag_data_t *cag_data_local_var = NULL;
@@ -130,7 +180,6 @@ end:
 OpenAPI_cag_data_t *OpenAPI_cag_data_copy(OpenAPI_cag_data_t *dst, OpenAPI_cag_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cag_data_convertToJSON(src);
@@ -139,21 +188,6 @@ OpenAPI_cag_data_t *OpenAPI_cag_data_copy(OpenAPI_cag_data_t *dst, OpenAPI_cag_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cag_data_free(dst);
     dst = OpenAPI_cag_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cag_info.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_cag_data_t *OpenAPI_cag_data_create(
 void OpenAPI_cag_data_free(OpenAPI_cag_data_t *cag_data);
 OpenAPI_cag_data_t *OpenAPI_cag_data_parseFromJSON(cJSON *cag_dataJSON);
 cJSON *OpenAPI_cag_data_convertToJSON(OpenAPI_cag_data_t *cag_data);
+bool OpenAPI_cag_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_data_t *cag_data);
 OpenAPI_cag_data_t *OpenAPI_cag_data_copy(OpenAPI_cag_data_t *dst, OpenAPI_cag_data_t *src);
 
 #ifdef __cplusplus
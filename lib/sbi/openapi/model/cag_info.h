@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_cag_info_t *OpenAPI_cag_info_create(
 void OpenAPI_cag_info_free(OpenAPI_cag_info_t *cag_info);
 OpenAPI_cag_info_t *OpenAPI_cag_info_parseFromJSON(cJSON *cag_infoJSON);
 cJSON *OpenAPI_cag_info_convertToJSON(OpenAPI_cag_info_t *cag_info);
+bool OpenAPI_cag_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_info_t *cag_info);
 OpenAPI_cag_info_t *OpenAPI_cag_info_copy(OpenAPI_cag_info_t *dst, OpenAPI_cag_info_t *src);
 
 #ifdef __cplusplus
@@ -68,6 +68,52 @@ end:
     return item;
 }
 
+bool OpenAPI_cag_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_info_1_t *cag_info_1)
+{
+    if (cag_info_1 == NULL) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [CagInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [CagInfo_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "allowedCagList") == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [allowed_cag_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_cag_list_node;
+    OpenAPI_list_for_each(cag_info_1->allowed_cag_list, allowed_cag_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)allowed_cag_list_node->data) == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [allowed_cag_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [allowed_cag_list]");
+        goto end;
+    }
+
+    if (cag_info_1->is_cag_only_indicator) {
+    if (OpenAPI_json_write_bool(writer, "cagOnlyIndicator", cag_info_1->cag_only_indicator) == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [cag_only_indicator]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cag_info_1_writeJSON() failed [CagInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_parseFromJSON(cJSON *cag_info_1JSON)
 {
     OpenAPI_cag_info_1_t *cag_info_1_local_var = NULL;
@@ -116,7 +162,6 @@ end:
 OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_copy(OpenAPI_cag_info_1_t *dst, OpenAPI_cag_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cag_info_1_convertToJSON(src);
@@ -125,21 +170,6 @@ OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_copy(OpenAPI_cag_info_1_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cag_info_1_free(dst);
     dst = OpenAPI_cag_info_1_parseFromJSON(item);
     cJSON_Delete(item);
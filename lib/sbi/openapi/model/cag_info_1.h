@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_create(
 void OpenAPI_cag_info_1_free(OpenAPI_cag_info_1_t *cag_info_1);
 OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_parseFromJSON(cJSON *cag_info_1JSON);
 cJSON *OpenAPI_cag_info_1_convertToJSON(OpenAPI_cag_info_1_t *cag_info_1);
+bool OpenAPI_cag_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cag_info_1_t *cag_info_1);
 OpenAPI_cag_info_1_t *OpenAPI_cag_info_1_copy(OpenAPI_cag_info_1_t *dst, OpenAPI_cag_info_1_t *src);
 
 #ifdef __cplusplus
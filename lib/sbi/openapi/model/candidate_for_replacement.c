@@ -73,6 +73,52 @@ end:
     return item;
 }
 
+bool OpenAPI_candidate_for_replacement_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_candidate_for_replacement_t *candidate_for_replacement)
+{
+    if (candidate_for_replacement == NULL) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [CandidateForReplacement]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [CandidateForReplacement]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", candidate_for_replacement->snssai) == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (candidate_for_replacement->dnns) {
+    if (OpenAPI_json_write_array_start(writer, "dnns") == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [dnns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnns_node;
+    OpenAPI_list_for_each(candidate_for_replacement->dnns, dnns_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnns_node->data) == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [dnns]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [dnns]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_candidate_for_replacement_writeJSON() failed [CandidateForReplacement]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_parseFromJSON(cJSON *candidate_for_replacementJSON)
 {
     OpenAPI_candidate_for_replacement_t *candidate_for_replacement_local_var = NULL;
@@ -118,7 +164,6 @@ end:
 OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_copy(OpenAPI_candidate_for_replacement_t *dst, OpenAPI_candidate_for_replacement_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_candidate_for_replacement_convertToJSON(src);
@@ -127,21 +172,6 @@ OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_candidate_for_replacement_free(dst);
     dst = OpenAPI_candidate_for_replacement_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_create(
 void OpenAPI_candidate_for_replacement_free(OpenAPI_candidate_for_replacement_t *candidate_for_replacement);
 OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_parseFromJSON(cJSON *candidate_for_replacementJSON);
 cJSON *OpenAPI_candidate_for_replacement_convertToJSON(OpenAPI_candidate_for_replacement_t *candidate_for_replacement);
+bool OpenAPI_candidate_for_replacement_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_candidate_for_replacement_t *candidate_for_replacement);
 OpenAPI_candidate_for_replacement_t *OpenAPI_candidate_for_replacement_copy(OpenAPI_candidate_for_replacement_t *dst, OpenAPI_candidate_for_replacement_t *src);
 
 #ifdef __cplusplus
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_ce_mode_b_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ce_mode_b_ind_t *ce_mode_b_ind)
+{
+    if (ce_mode_b_ind == NULL) {
+        ogs_error("OpenAPI_ce_mode_b_ind_writeJSON() failed [CeModeBInd]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ce_mode_b_ind_writeJSON() failed [CeModeBInd]");
+        return false;
+    }
+    if (OpenAPI_json_write_bool(writer, "ceModeBSupportInd", ce_mode_b_ind->ce_mode_b_support_ind) == false) {
+        ogs_error("OpenAPI_ce_mode_b_ind_writeJSON() failed [ce_mode_b_support_ind]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ce_mode_b_ind_writeJSON() failed [CeModeBInd]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_parseFromJSON(cJSON *ce_mode_b_indJSON)
 {
     OpenAPI_ce_mode_b_ind_t *ce_mode_b_ind_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_copy(OpenAPI_ce_mode_b_ind_t *dst, OpenAPI_ce_mode_b_ind_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ce_mode_b_ind_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_copy(OpenAPI_ce_mode_b_ind_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ce_mode_b_ind_free(dst);
     dst = OpenAPI_ce_mode_b_ind_parseFromJSON(item);
     cJSON_Delete(item);
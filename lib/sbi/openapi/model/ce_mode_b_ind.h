@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_create(
 void OpenAPI_ce_mode_b_ind_free(OpenAPI_ce_mode_b_ind_t *ce_mode_b_ind);
 OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_parseFromJSON(cJSON *ce_mode_b_indJSON);
 cJSON *OpenAPI_ce_mode_b_ind_convertToJSON(OpenAPI_ce_mode_b_ind_t *ce_mode_b_ind);
+bool OpenAPI_ce_mode_b_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ce_mode_b_ind_t *ce_mode_b_ind);
 OpenAPI_ce_mode_b_ind_t *OpenAPI_ce_mode_b_ind_copy(OpenAPI_ce_mode_b_ind_t *dst, OpenAPI_ce_mode_b_ind_t *src);
 
 #ifdef __cplusplus
@@ -82,6 +82,59 @@ end:
     return item;
 }
 
+bool OpenAPI_change_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_change_item_t *change_item)
+{
+    if (change_item == NULL) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [ChangeItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [ChangeItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "op", OpenAPI_change_type_ToString(change_item->op)) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [op]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "path", change_item->path) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [path]");
+        goto end;
+    }
+
+    if (change_item->from) {
+    if (OpenAPI_json_write_string(writer, "from", change_item->from) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [from]");
+        goto end;
+    }
+    }
+
+    if (change_item->orig_value) {
+    if (OpenAPI_json_write_string(writer, "origValue", change_item->orig_value) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [orig_value]");
+        goto end;
+    }
+    }
+
+    if (change_item->new_value) {
+    if (OpenAPI_json_write_string(writer, "newValue", change_item->new_value) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [new_value]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_change_item_writeJSON() failed [ChangeItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_change_item_t *OpenAPI_change_item_parseFromJSON(cJSON *change_itemJSON)
 {
     OpenAPI_change_item_t *change_item_local_var = NULL;
@@ -152,7 +205,6 @@ end:
 OpenAPI_change_item_t *OpenAPI_change_item_copy(OpenAPI_change_item_t *dst, OpenAPI_change_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_change_item_convertToJSON(src);
@@ -161,21 +213,6 @@ OpenAPI_change_item_t *OpenAPI_change_item_copy(OpenAPI_change_item_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_change_item_free(dst);
     dst = OpenAPI_change_item_parseFromJSON(item);
     cJSON_Delete(item);
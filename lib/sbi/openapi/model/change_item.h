@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "change_type.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_change_item_t *OpenAPI_change_item_create(
 void OpenAPI_change_item_free(OpenAPI_change_item_t *change_item);
 OpenAPI_change_item_t *OpenAPI_change_item_parseFromJSON(cJSON *change_itemJSON);
 cJSON *OpenAPI_change_item_convertToJSON(OpenAPI_change_item_t *change_item);
+bool OpenAPI_change_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_change_item_t *change_item);
 OpenAPI_change_item_t *OpenAPI_change_item_copy(OpenAPI_change_item_t *dst, OpenAPI_change_item_t *src);
 
 #ifdef __cplusplus
@@ -159,6 +159,110 @@ end:
     return item;
 }
 
+bool OpenAPI_charging_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_charging_data_t *charging_data)
+{
+    if (charging_data == NULL) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [ChargingData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [ChargingData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "chgId", charging_data->chg_id) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [chg_id]");
+        goto end;
+    }
+
+    if (charging_data->metering_method) {
+    if (OpenAPI_json_write_string(writer, "meteringMethod", OpenAPI_metering_method_ToString(charging_data->metering_method)) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [metering_method]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_offline) {
+    if (OpenAPI_json_write_bool(writer, "offline", charging_data->offline) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [offline]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_online) {
+    if (OpenAPI_json_write_bool(writer, "online", charging_data->online) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [online]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_sdf_handl) {
+    if (OpenAPI_json_write_bool(writer, "sdfHandl", charging_data->sdf_handl) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [sdf_handl]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_rating_group) {
+    if (OpenAPI_json_write_number(writer, "ratingGroup", charging_data->rating_group) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [rating_group]");
+        goto end;
+    }
+    }
+
+    if (charging_data->reporting_level) {
+    if (OpenAPI_json_write_string(writer, "reportingLevel", OpenAPI_reporting_level_ToString(charging_data->reporting_level)) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [reporting_level]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_service_id) {
+    if (OpenAPI_json_write_number(writer, "serviceId", charging_data->service_id) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [service_id]");
+        goto end;
+    }
+    }
+
+    if (charging_data->sponsor_id) {
+    if (OpenAPI_json_write_string(writer, "sponsorId", charging_data->sponsor_id) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [sponsor_id]");
+        goto end;
+    }
+    }
+
+    if (charging_data->app_svc_prov_id) {
+    if (OpenAPI_json_write_string(writer, "appSvcProvId", charging_data->app_svc_prov_id) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [app_svc_prov_id]");
+        goto end;
+    }
+    }
+
+    if (charging_data->is_af_charging_identifier) {
+    if (OpenAPI_json_write_number(writer, "afChargingIdentifier", charging_data->af_charging_identifier) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [af_charging_identifier]");
+        goto end;
+    }
+    }
+
+    if (charging_data->af_charg_id) {
+    if (OpenAPI_json_write_string(writer, "afChargId", charging_data->af_charg_id) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [af_charg_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_charging_data_writeJSON() failed [ChargingData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_charging_data_t *OpenAPI_charging_data_parseFromJSON(cJSON *charging_dataJSON)
 {
     OpenAPI_charging_data_t *charging_data_local_var = NULL;
@@ -305,7 +409,6 @@ end:
 OpenAPI_charging_data_t *OpenAPI_charging_data_copy(OpenAPI_charging_data_t *dst, OpenAPI_charging_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_charging_data_convertToJSON(src);
@@ -314,21 +417,6 @@ OpenAPI_charging_data_t *OpenAPI_charging_data_copy(OpenAPI_charging_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_charging_data_free(dst);
     dst = OpenAPI_charging_data_parseFromJSON(item);
     cJSON_Delete(item);
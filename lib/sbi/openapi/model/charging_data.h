@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "metering_method.h"
 #include "reporting_level.h"
 
@@ -64,6 +65,7 @@ OpenAPI_charging_data_t *OpenAPI_charging_data_create(
 void OpenAPI_charging_data_free(OpenAPI_charging_data_t *charging_data);
 OpenAPI_charging_data_t *OpenAPI_charging_data_parseFromJSON(cJSON *charging_dataJSON);
 cJSON *OpenAPI_charging_data_convertToJSON(OpenAPI_charging_data_t *charging_data);
+bool OpenAPI_charging_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_charging_data_t *charging_data);
 OpenAPI_charging_data_t *OpenAPI_charging_data_copy(OpenAPI_charging_data_t *dst, OpenAPI_charging_data_t *src);
 
 #ifdef __cplusplus
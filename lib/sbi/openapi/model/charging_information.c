@@ -93,6 +93,66 @@ end:
     return item;
 }
 
+bool OpenAPI_charging_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_charging_information_t *charging_information)
+{
+    if (charging_information == NULL) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [ChargingInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [ChargingInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "primaryChfAddress", charging_information->primary_chf_address) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [primary_chf_address]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "secondaryChfAddress", charging_information->secondary_chf_address) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [secondary_chf_address]");
+        goto end;
+    }
+
+    if (charging_information->primary_chf_set_id) {
+    if (OpenAPI_json_write_string(writer, "primaryChfSetId", charging_information->primary_chf_set_id) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [primary_chf_set_id]");
+        goto end;
+    }
+    }
+
+    if (charging_information->primary_chf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "primaryChfInstanceId", charging_information->primary_chf_instance_id) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [primary_chf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (charging_information->secondary_chf_set_id) {
+    if (OpenAPI_json_write_string(writer, "secondaryChfSetId", charging_information->secondary_chf_set_id) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [secondary_chf_set_id]");
+        goto end;
+    }
+    }
+
+    if (charging_information->secondary_chf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "secondaryChfInstanceId", charging_information->secondary_chf_instance_id) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [secondary_chf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_charging_information_writeJSON() failed [ChargingInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_charging_information_t *OpenAPI_charging_information_parseFromJSON(cJSON *charging_informationJSON)
 {
     OpenAPI_charging_information_t *charging_information_local_var = NULL;
@@ -171,7 +231,6 @@ end:
 OpenAPI_charging_information_t *OpenAPI_charging_information_copy(OpenAPI_charging_information_t *dst, OpenAPI_charging_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_charging_information_convertToJSON(src);
@@ -180,21 +239,6 @@ OpenAPI_charging_information_t *OpenAPI_charging_information_copy(OpenAPI_chargi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_charging_information_free(dst);
     dst = OpenAPI_charging_information_parseFromJSON(item);
     cJSON_Delete(item);
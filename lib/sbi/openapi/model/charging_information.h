@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,7 @@ OpenAPI_charging_information_t *OpenAPI_charging_information_create(
 void OpenAPI_charging_information_free(OpenAPI_charging_information_t *charging_information);
 OpenAPI_charging_information_t *OpenAPI_charging_information_parseFromJSON(cJSON *charging_informationJSON);
 cJSON *OpenAPI_charging_information_convertToJSON(OpenAPI_charging_information_t *charging_information);
+bool OpenAPI_charging_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_charging_information_t *charging_information);
 OpenAPI_charging_information_t *OpenAPI_charging_information_copy(OpenAPI_charging_information_t *dst, OpenAPI_charging_information_t *src);
 
 #ifdef __cplusplus
@@ -145,6 +145,112 @@ end:
     return item;
 }
 
+bool OpenAPI_chf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_chf_info_t *chf_info)
+{
+    if (chf_info == NULL) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [ChfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [ChfInfo]");
+        return false;
+    }
+    if (chf_info->supi_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "supiRangeList") == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [supi_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_range_list_node;
+    if (chf_info->supi_range_list) {
+        OpenAPI_list_for_each(chf_info->supi_range_list, supi_range_list_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_range_list_node->data) == false) {
+                ogs_error("OpenAPI_chf_info_writeJSON() failed [supi_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [supi_range_list]");
+        goto end;
+    }
+    }
+
+    if (chf_info->gpsi_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRangeList") == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [gpsi_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_range_list_node;
+    if (chf_info->gpsi_range_list) {
+        OpenAPI_list_for_each(chf_info->gpsi_range_list, gpsi_range_list_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_range_list_node->data) == false) {
+                ogs_error("OpenAPI_chf_info_writeJSON() failed [gpsi_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [gpsi_range_list]");
+        goto end;
+    }
+    }
+
+    if (chf_info->plmn_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "plmnRangeList") == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [plmn_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *plmn_range_list_node;
+    if (chf_info->plmn_range_list) {
+        OpenAPI_list_for_each(chf_info->plmn_range_list, plmn_range_list_node) {
+            if (OpenAPI_plmn_range_writeJSON(writer, NULL, plmn_range_list_node->data) == false) {
+                ogs_error("OpenAPI_chf_info_writeJSON() failed [plmn_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [plmn_range_list]");
+        goto end;
+    }
+    }
+
+    if (chf_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", chf_info->group_id) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (chf_info->primary_chf_instance) {
+    if (OpenAPI_json_write_string(writer, "primaryChfInstance", chf_info->primary_chf_instance) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [primary_chf_instance]");
+        goto end;
+    }
+    }
+
+    if (chf_info->secondary_chf_instance) {
+    if (OpenAPI_json_write_string(writer, "secondaryChfInstance", chf_info->secondary_chf_instance) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [secondary_chf_instance]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_chf_info_writeJSON() failed [ChfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_chf_info_t *OpenAPI_chf_info_parseFromJSON(cJSON *chf_infoJSON)
 {
     OpenAPI_chf_info_t *chf_info_local_var = NULL;
@@ -279,7 +385,6 @@ end:
 OpenAPI_chf_info_t *OpenAPI_chf_info_copy(OpenAPI_chf_info_t *dst, OpenAPI_chf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_chf_info_convertToJSON(src);
@@ -288,21 +393,6 @@ OpenAPI_chf_info_t *OpenAPI_chf_info_copy(OpenAPI_chf_info_t *dst, OpenAPI_chf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_chf_info_free(dst);
     dst = OpenAPI_chf_info_parseFromJSON(item);
     cJSON_Delete(item);
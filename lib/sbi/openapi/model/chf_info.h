@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "identity_range.h"
 #include "plmn_range.h"
 #include "supi_range.h"
@@ -41,6 +42,7 @@ OpenAPI_chf_info_t *OpenAPI_chf_info_create(
 void OpenAPI_chf_info_free(OpenAPI_chf_info_t *chf_info);
 OpenAPI_chf_info_t *OpenAPI_chf_info_parseFromJSON(cJSON *chf_infoJSON);
 cJSON *OpenAPI_chf_info_convertToJSON(OpenAPI_chf_info_t *chf_info);
+bool OpenAPI_chf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_chf_info_t *chf_info);
 OpenAPI_chf_info_t *OpenAPI_chf_info_copy(OpenAPI_chf_info_t *dst, OpenAPI_chf_info_t *src);
 
 #ifdef __cplusplus
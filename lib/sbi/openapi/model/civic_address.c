@@ -377,6 +377,266 @@ end:
     return item;
 }
 
+bool OpenAPI_civic_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_civic_address_t *civic_address)
+{
+    if (civic_address == NULL) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [CivicAddress]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [CivicAddress]");
+        return false;
+    }
+    if (civic_address->country) {
+    if (OpenAPI_json_write_string(writer, "country", civic_address->country) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [country]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a1) {
+    if (OpenAPI_json_write_string(writer, "A1", civic_address->a1) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a1]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a2) {
+    if (OpenAPI_json_write_string(writer, "A2", civic_address->a2) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a2]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a3) {
+    if (OpenAPI_json_write_string(writer, "A3", civic_address->a3) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a3]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a4) {
+    if (OpenAPI_json_write_string(writer, "A4", civic_address->a4) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a4]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a5) {
+    if (OpenAPI_json_write_string(writer, "A5", civic_address->a5) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a5]");
+        goto end;
+    }
+    }
+
+    if (civic_address->a6) {
+    if (OpenAPI_json_write_string(writer, "A6", civic_address->a6) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [a6]");
+        goto end;
+    }
+    }
+
+    if (civic_address->prd) {
+    if (OpenAPI_json_write_string(writer, "PRD", civic_address->prd) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [prd]");
+        goto end;
+    }
+    }
+
+    if (civic_address->pod) {
+    if (OpenAPI_json_write_string(writer, "POD", civic_address->pod) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [pod]");
+        goto end;
+    }
+    }
+
+    if (civic_address->sts) {
+    if (OpenAPI_json_write_string(writer, "STS", civic_address->sts) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [sts]");
+        goto end;
+    }
+    }
+
+    if (civic_address->hno) {
+    if (OpenAPI_json_write_string(writer, "HNO", civic_address->hno) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [hno]");
+        goto end;
+    }
+    }
+
+    if (civic_address->hns) {
+    if (OpenAPI_json_write_string(writer, "HNS", civic_address->hns) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [hns]");
+        goto end;
+    }
+    }
+
+    if (civic_address->lmk) {
+    if (OpenAPI_json_write_string(writer, "LMK", civic_address->lmk) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [lmk]");
+        goto end;
+    }
+    }
+
+    if (civic_address->loc) {
+    if (OpenAPI_json_write_string(writer, "LOC", civic_address->loc) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [loc]");
+        goto end;
+    }
+    }
+
+    if (civic_address->nam) {
+    if (OpenAPI_json_write_string(writer, "NAM", civic_address->nam) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [nam]");
+        goto end;
+    }
+    }
+
+    if (civic_address->pc) {
+    if (OpenAPI_json_write_string(writer, "PC", civic_address->pc) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [pc]");
+        goto end;
+    }
+    }
+
+    if (civic_address->bld) {
+    if (OpenAPI_json_write_string(writer, "BLD", civic_address->bld) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [bld]");
+        goto end;
+    }
+    }
+
+    if (civic_address->unit) {
+    if (OpenAPI_json_write_string(writer, "UNIT", civic_address->unit) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [unit]");
+        goto end;
+    }
+    }
+
+    if (civic_address->flr) {
+    if (OpenAPI_json_write_string(writer, "FLR", civic_address->flr) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [flr]");
+        goto end;
+    }
+    }
+
+    if (civic_address->room) {
+    if (OpenAPI_json_write_string(writer, "ROOM", civic_address->room) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [room]");
+        goto end;
+    }
+    }
+
+    if (civic_address->plc) {
+    if (OpenAPI_json_write_string(writer, "PLC", civic_address->plc) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [plc]");
+        goto end;
+    }
+    }
+
+    if (civic_address->pcn) {
+    if (OpenAPI_json_write_string(writer, "PCN", civic_address->pcn) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [pcn]");
+        goto end;
+    }
+    }
+
+    if (civic_address->pobox) {
+    if (OpenAPI_json_write_string(writer, "POBOX", civic_address->pobox) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [pobox]");
+        goto end;
+    }
+    }
+
+    if (civic_address->addcode) {
+    if (OpenAPI_json_write_string(writer, "ADDCODE", civic_address->addcode) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [addcode]");
+        goto end;
+    }
+    }
+
+    if (civic_address->seat) {
+    if (OpenAPI_json_write_string(writer, "SEAT", civic_address->seat) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [seat]");
+        goto end;
+    }
+    }
+
+    if (civic_address->rd) {
+    if (OpenAPI_json_write_string(writer, "RD", civic_address->rd) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [rd]");
+        goto end;
+    }
+    }
+
+    if (civic_address->rdsec) {
+    if (OpenAPI_json_write_string(writer, "RDSEC", civic_address->rdsec) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [rdsec]");
+        goto end;
+    }
+    }
+
+    if (civic_address->rdbr) {
+    if (OpenAPI_json_write_string(writer, "RDBR", civic_address->rdbr) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [rdbr]");
+        goto end;
+    }
+    }
+
+    if (civic_address->rdsubbr) {
+    if (OpenAPI_json_write_string(writer, "RDSUBBR", civic_address->rdsubbr) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [rdsubbr]");
+        goto end;
+    }
+    }
+
+    if (civic_address->prm) {
+    if (OpenAPI_json_write_string(writer, "PRM", civic_address->prm) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [prm]");
+        goto end;
+    }
+    }
+
+    if (civic_address->pom) {
+    if (OpenAPI_json_write_string(writer, "POM", civic_address->pom) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [pom]");
+        goto end;
+    }
+    }
+
+    if (civic_address->usage_rules) {
+    if (OpenAPI_json_write_string(writer, "usageRules", civic_address->usage_rules) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [usage_rules]");
+        goto end;
+    }
+    }
+
+    if (civic_address->method) {
+    if (OpenAPI_json_write_string(writer, "method", civic_address->method) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [method]");
+        goto end;
+    }
+    }
+
+    if (civic_address->provided_by) {
+    if (OpenAPI_json_write_string(writer, "providedBy", civic_address->provided_by) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [provided_by]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_civic_address_writeJSON() failed [CivicAddress]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_civic_address_t *OpenAPI_civic_address_parseFromJSON(cJSON *civic_addressJSON)
 {
     OpenAPI_civic_address_t *civic_address_local_var = NULL;
@@ -731,7 +991,6 @@ end:
 OpenAPI_civic_address_t *OpenAPI_civic_address_copy(OpenAPI_civic_address_t *dst, OpenAPI_civic_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_civic_address_convertToJSON(src);
@@ -740,21 +999,6 @@ OpenAPI_civic_address_t *OpenAPI_civic_address_copy(OpenAPI_civic_address_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_civic_address_free(dst);
     dst = OpenAPI_civic_address_parseFromJSON(item);
     cJSON_Delete(item);
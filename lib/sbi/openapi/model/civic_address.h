@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -94,6 +95,7 @@ OpenAPI_civic_address_t *OpenAPI_civic_address_create(
 void OpenAPI_civic_address_free(OpenAPI_civic_address_t *civic_address);
 OpenAPI_civic_address_t *OpenAPI_civic_address_parseFromJSON(cJSON *civic_addressJSON);
 cJSON *OpenAPI_civic_address_convertToJSON(OpenAPI_civic_address_t *civic_address);
+bool OpenAPI_civic_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_civic_address_t *civic_address);
 OpenAPI_civic_address_t *OpenAPI_civic_address_copy(OpenAPI_civic_address_t *dst, OpenAPI_civic_address_t *src);
 
 #ifdef __cplusplus
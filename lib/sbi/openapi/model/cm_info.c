@@ -58,6 +58,38 @@ end:
     return item;
 }
 
+bool OpenAPI_cm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cm_info_t *cm_info)
+{
+    if (cm_info == NULL) {
+        ogs_error("OpenAPI_cm_info_writeJSON() failed [CmInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cm_info_writeJSON() failed [CmInfo]");
+        return false;
+    }
+    if (OpenAPI_cm_state_writeJSON(writer, "cmState", cm_info->cm_state) == false) {
+        ogs_error("OpenAPI_cm_info_writeJSON() failed [cm_state]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(cm_info->access_type)) == false) {
+        ogs_error("OpenAPI_cm_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cm_info_writeJSON() failed [CmInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cm_info_t *OpenAPI_cm_info_parseFromJSON(cJSON *cm_infoJSON)
 {
     OpenAPI_cm_info_t *cm_info_local_var = NULL;
@@ -96,7 +128,6 @@ end:
 OpenAPI_cm_info_t *OpenAPI_cm_info_copy(OpenAPI_cm_info_t *dst, OpenAPI_cm_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cm_info_convertToJSON(src);
@@ -105,21 +136,6 @@ OpenAPI_cm_info_t *OpenAPI_cm_info_copy(OpenAPI_cm_info_t *dst, OpenAPI_cm_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cm_info_free(dst);
     dst = OpenAPI_cm_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "cm_state.h"
 
@@ -32,6 +33,7 @@ OpenAPI_cm_info_t *OpenAPI_cm_info_create(
 void OpenAPI_cm_info_free(OpenAPI_cm_info_t *cm_info);
 OpenAPI_cm_info_t *OpenAPI_cm_info_parseFromJSON(cJSON *cm_infoJSON);
 cJSON *OpenAPI_cm_info_convertToJSON(OpenAPI_cm_info_t *cm_info);
+bool OpenAPI_cm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cm_info_t *cm_info);
 OpenAPI_cm_info_t *OpenAPI_cm_info_copy(OpenAPI_cm_info_t *dst, OpenAPI_cm_info_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_cm_state_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cm_state_t *cm_state)
+{
+    if (cm_state == NULL) {
+        ogs_error("OpenAPI_cm_state_writeJSON() failed [CmState]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cm_state_writeJSON() failed [CmState]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cm_state_writeJSON() failed [CmState]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cm_state_t *OpenAPI_cm_state_parseFromJSON(cJSON *cm_stateJSON)
 {
     OpenAPI_cm_state_t *cm_state_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_cm_state_t *OpenAPI_cm_state_copy(OpenAPI_cm_state_t *dst, OpenAPI_cm_state_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cm_state_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_cm_state_t *OpenAPI_cm_state_copy(OpenAPI_cm_state_t *dst, OpenAPI_cm_st
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cm_state_free(dst);
     dst = OpenAPI_cm_state_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cm_state_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_cm_state_t *OpenAPI_cm_state_create(
 void OpenAPI_cm_state_free(OpenAPI_cm_state_t *cm_state);
 OpenAPI_cm_state_t *OpenAPI_cm_state_parseFromJSON(cJSON *cm_stateJSON);
 cJSON *OpenAPI_cm_state_convertToJSON(OpenAPI_cm_state_t *cm_state);
+bool OpenAPI_cm_state_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cm_state_t *cm_state);
 OpenAPI_cm_state_t *OpenAPI_cm_state_copy(OpenAPI_cm_state_t *dst, OpenAPI_cm_state_t *src);
 
 #ifdef __cplusplus
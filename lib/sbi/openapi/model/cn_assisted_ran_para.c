@@ -118,6 +118,77 @@ end:
     return item;
 }
 
+bool OpenAPI_cn_assisted_ran_para_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cn_assisted_ran_para_t *cn_assisted_ran_para)
+{
+    if (cn_assisted_ran_para == NULL) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [CnAssistedRanPara]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [CnAssistedRanPara]");
+        return false;
+    }
+    if (cn_assisted_ran_para->stationary_indication) {
+    if (OpenAPI_json_write_string(writer, "stationaryIndication", OpenAPI_stationary_indication_ToString(cn_assisted_ran_para->stationary_indication)) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [stationary_indication]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->is_communication_duration_time) {
+    if (OpenAPI_json_write_number(writer, "communicationDurationTime", cn_assisted_ran_para->communication_duration_time) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [communication_duration_time]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->is_periodic_time) {
+    if (OpenAPI_json_write_number(writer, "periodicTime", cn_assisted_ran_para->periodic_time) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [periodic_time]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->scheduled_communication_time) {
+    if (OpenAPI_scheduled_communication_time_writeJSON(writer, "scheduledCommunicationTime", cn_assisted_ran_para->scheduled_communication_time) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [scheduled_communication_time]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->scheduled_communication_type) {
+    if (OpenAPI_json_write_string(writer, "scheduledCommunicationType", OpenAPI_scheduled_communication_type_ToString(cn_assisted_ran_para->scheduled_communication_type)) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [scheduled_communication_type]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->traffic_profile) {
+    if (OpenAPI_json_write_string(writer, "trafficProfile", OpenAPI_traffic_profile_ToString(cn_assisted_ran_para->traffic_profile)) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [traffic_profile]");
+        goto end;
+    }
+    }
+
+    if (cn_assisted_ran_para->battery_indication) {
+    if (OpenAPI_battery_indication_writeJSON(writer, "batteryIndication", cn_assisted_ran_para->battery_indication) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [battery_indication]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cn_assisted_ran_para_writeJSON() failed [CnAssistedRanPara]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cn_assisted_ran_para_t *OpenAPI_cn_assisted_ran_para_parseFromJSON(cJSON *cn_assisted_ran_paraJSON)
 {
     OpenAPI_cn_assisted_ran_para_t *cn_assisted_ran_para_local_var = NULL;
@@ -206,7 +277,6 @@ end:
 OpenAPI_cn_assisted_ran_para_t *OpenAPI_cn_assisted_ran_para_copy(OpenAPI_cn_assisted_ran_para_t *dst, OpenAPI_cn_assisted_ran_para_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cn_assisted_ran_para_convertToJSON(src);
@@ -215,21 +285,6 @@ OpenAPI_cn_assisted_ran_para_t *OpenAPI_cn_assisted_ran_para_copy(OpenAPI_cn_ass
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cn_assisted_ran_para_free(dst);
     dst = OpenAPI_cn_assisted_ran_para_parseFromJSON(item);
     cJSON_Delete(item);
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_cnf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cnf_t *cnf)
+{
+    if (cnf == NULL) {
+        ogs_error("OpenAPI_cnf_writeJSON() failed [Cnf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cnf_writeJSON() failed [Cnf]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "cnfUnits") == false) {
+        ogs_error("OpenAPI_cnf_writeJSON() failed [cnf_units]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cnf_units_node;
+    if (cnf->cnf_units) {
+        OpenAPI_list_for_each(cnf->cnf_units, cnf_units_node) {
+            if (OpenAPI_cnf_unit_writeJSON(writer, NULL, cnf_units_node->data) == false) {
+                ogs_error("OpenAPI_cnf_writeJSON() failed [cnf_units]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_cnf_writeJSON() failed [cnf_units]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cnf_writeJSON() failed [Cnf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cnf_t *OpenAPI_cnf_parseFromJSON(cJSON *cnfJSON)
 {
     OpenAPI_cnf_t *cnf_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_cnf_t *OpenAPI_cnf_copy(OpenAPI_cnf_t *dst, OpenAPI_cnf_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cnf_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_cnf_t *OpenAPI_cnf_copy(OpenAPI_cnf_t *dst, OpenAPI_cnf_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cnf_free(dst);
     dst = OpenAPI_cnf_parseFromJSON(item);
     cJSON_Delete(item);
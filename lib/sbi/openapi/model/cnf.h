@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cnf_unit.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_cnf_t *OpenAPI_cnf_create(
 void OpenAPI_cnf_free(OpenAPI_cnf_t *cnf);
 OpenAPI_cnf_t *OpenAPI_cnf_parseFromJSON(cJSON *cnfJSON);
 cJSON *OpenAPI_cnf_convertToJSON(OpenAPI_cnf_t *cnf);
+bool OpenAPI_cnf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cnf_t *cnf);
 OpenAPI_cnf_t *OpenAPI_cnf_copy(OpenAPI_cnf_t *dst, OpenAPI_cnf_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_cnf_unit_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cnf_unit_t *cnf_unit)
+{
+    if (cnf_unit == NULL) {
+        ogs_error("OpenAPI_cnf_unit_writeJSON() failed [CnfUnit]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_cnf_unit_writeJSON() failed [CnfUnit]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "cnfUnit") == false) {
+        ogs_error("OpenAPI_cnf_unit_writeJSON() failed [cnf_unit]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cnf_unit_node;
+    if (cnf_unit->cnf_unit) {
+        OpenAPI_list_for_each(cnf_unit->cnf_unit, cnf_unit_node) {
+            if (OpenAPI_atom_writeJSON(writer, NULL, cnf_unit_node->data) == false) {
+                ogs_error("OpenAPI_cnf_unit_writeJSON() failed [cnf_unit]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_cnf_unit_writeJSON() failed [cnf_unit]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_cnf_unit_writeJSON() failed [CnfUnit]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_parseFromJSON(cJSON *cnf_unitJSON)
 {
     OpenAPI_cnf_unit_t *cnf_unit_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_copy(OpenAPI_cnf_unit_t *dst, OpenAPI_cnf_unit_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_cnf_unit_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_copy(OpenAPI_cnf_unit_t *dst, OpenAPI_cnf_u
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_cnf_unit_free(dst);
     dst = OpenAPI_cnf_unit_parseFromJSON(item);
     cJSON_Delete(item);
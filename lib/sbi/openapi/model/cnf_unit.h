@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "atom.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_create(
 void OpenAPI_cnf_unit_free(OpenAPI_cnf_unit_t *cnf_unit);
 OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_parseFromJSON(cJSON *cnf_unitJSON);
 cJSON *OpenAPI_cnf_unit_convertToJSON(OpenAPI_cnf_unit_t *cnf_unit);
+bool OpenAPI_cnf_unit_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_cnf_unit_t *cnf_unit);
 OpenAPI_cnf_unit_t *OpenAPI_cnf_unit_copy(OpenAPI_cnf_unit_t *dst, OpenAPI_cnf_unit_t *src);
 
 #ifdef __cplusplus
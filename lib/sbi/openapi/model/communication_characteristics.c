@@ -128,6 +128,70 @@ end:
     return item;
 }
 
+bool OpenAPI_communication_characteristics_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_communication_characteristics_t *communication_characteristics)
+{
+    if (communication_characteristics == NULL) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [CommunicationCharacteristics]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [CommunicationCharacteristics]");
+        return false;
+    }
+    if (communication_characteristics->pp_subs_reg_timer) {
+    if (OpenAPI_pp_subs_reg_timer_writeJSON(writer, "ppSubsRegTimer", communication_characteristics->pp_subs_reg_timer) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_subs_reg_timer]");
+        goto end;
+    }
+    }
+
+    if (communication_characteristics->pp_active_time) {
+    if (OpenAPI_pp_active_time_writeJSON(writer, "ppActiveTime", communication_characteristics->pp_active_time) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_active_time]");
+        goto end;
+    }
+    }
+
+    if (communication_characteristics->is_pp_dl_packet_count) {
+    if (OpenAPI_json_write_number(writer, "ppDlPacketCount", communication_characteristics->pp_dl_packet_count) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_dl_packet_count]");
+        goto end;
+    }
+    }
+
+    if (communication_characteristics->pp_dl_packet_count_ext) {
+    if (OpenAPI_pp_dl_packet_count_ext_writeJSON(writer, "ppDlPacketCountExt", communication_characteristics->pp_dl_packet_count_ext) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_dl_packet_count_ext]");
+        goto end;
+    }
+    }
+
+    if (communication_characteristics->pp_maximum_response_time) {
+    if (OpenAPI_pp_maximum_response_time_writeJSON(writer, "ppMaximumResponseTime", communication_characteristics->pp_maximum_response_time) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_maximum_response_time]");
+        goto end;
+    }
+    }
+
+    if (communication_characteristics->pp_maximum_latency) {
+    if (OpenAPI_pp_maximum_latency_writeJSON(writer, "ppMaximumLatency", communication_characteristics->pp_maximum_latency) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [pp_maximum_latency]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_communication_characteristics_writeJSON() failed [CommunicationCharacteristics]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_parseFromJSON(cJSON *communication_characteristicsJSON)
 {
     OpenAPI_communication_characteristics_t *communication_characteristics_local_var = NULL;
@@ -193,7 +257,6 @@ end:
 OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_copy(OpenAPI_communication_characteristics_t *dst, OpenAPI_communication_characteristics_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_communication_characteristics_convertToJSON(src);
@@ -202,21 +265,6 @@ OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_communication_characteristics_free(dst);
     dst = OpenAPI_communication_characteristics_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pp_active_time.h"
 #include "pp_dl_packet_count_ext.h"
 #include "pp_maximum_latency.h"
@@ -45,6 +46,7 @@ OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_c
 void OpenAPI_communication_characteristics_free(OpenAPI_communication_characteristics_t *communication_characteristics);
 OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_parseFromJSON(cJSON *communication_characteristicsJSON);
 cJSON *OpenAPI_communication_characteristics_convertToJSON(OpenAPI_communication_characteristics_t *communication_characteristics);
+bool OpenAPI_communication_characteristics_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_communication_characteristics_t *communication_characteristics);
 OpenAPI_communication_characteristics_t *OpenAPI_communication_characteristics_copy(OpenAPI_communication_characteristics_t *dst, OpenAPI_communication_characteristics_t *src);
 
 #ifdef __cplusplus
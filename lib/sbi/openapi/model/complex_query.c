@@ -85,6 +85,66 @@ end:
     return item;
 }
 
+bool OpenAPI_complex_query_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_complex_query_t *complex_query)
+{
+    if (complex_query == NULL) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [ComplexQuery]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [ComplexQuery]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "cnfUnits") == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [cnf_units]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cnf_units_node;
+    if (complex_query->cnf_units) {
+        OpenAPI_list_for_each(complex_query->cnf_units, cnf_units_node) {
+            if (OpenAPI_cnf_unit_writeJSON(writer, NULL, cnf_units_node->data) == false) {
+                ogs_error("OpenAPI_complex_query_writeJSON() failed [cnf_units]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [cnf_units]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "dnfUnits") == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [dnf_units]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnf_units_node;
+    if (complex_query->dnf_units) {
+        OpenAPI_list_for_each(complex_query->dnf_units, dnf_units_node) {
+            if (OpenAPI_dnf_unit_writeJSON(writer, NULL, dnf_units_node->data) == false) {
+                ogs_error("OpenAPI_complex_query_writeJSON() failed [dnf_units]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [dnf_units]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_complex_query_writeJSON() failed [ComplexQuery]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_complex_query_t *OpenAPI_complex_query_parseFromJSON(cJSON *complex_queryJSON)
 {
     OpenAPI_complex_query_t *complex_query_local_var = NULL;
@@ -163,7 +223,6 @@ end:
 OpenAPI_complex_query_t *OpenAPI_complex_query_copy(OpenAPI_complex_query_t *dst, OpenAPI_complex_query_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_complex_query_convertToJSON(src);
@@ -172,21 +231,6 @@ OpenAPI_complex_query_t *OpenAPI_complex_query_copy(OpenAPI_complex_query_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_complex_query_free(dst);
     dst = OpenAPI_complex_query_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cnf.h"
 #include "cnf_unit.h"
 #include "dnf.h"
@@ -34,6 +35,7 @@ OpenAPI_complex_query_t *OpenAPI_complex_query_create(
 void OpenAPI_complex_query_free(OpenAPI_complex_query_t *complex_query);
 OpenAPI_complex_query_t *OpenAPI_complex_query_parseFromJSON(cJSON *complex_queryJSON);
 cJSON *OpenAPI_complex_query_convertToJSON(OpenAPI_complex_query_t *complex_query);
+bool OpenAPI_complex_query_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_complex_query_t *complex_query);
 OpenAPI_complex_query_t *OpenAPI_complex_query_copy(OpenAPI_complex_query_t *dst, OpenAPI_complex_query_t *src);
 
 #ifdef __cplusplus
@@ -83,6 +83,61 @@ end:
     return item;
 }
 
+bool OpenAPI_condition_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_condition_data_t *condition_data)
+{
+    if (condition_data == NULL) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [ConditionData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [ConditionData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "condId", condition_data->cond_id) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [cond_id]");
+        goto end;
+    }
+
+    if (condition_data->activation_time) {
+    if (OpenAPI_json_write_string(writer, "activationTime", condition_data->activation_time) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [activation_time]");
+        goto end;
+    }
+    }
+
+    if (condition_data->deactivation_time) {
+    if (OpenAPI_json_write_string(writer, "deactivationTime", condition_data->deactivation_time) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [deactivation_time]");
+        goto end;
+    }
+    }
+
+    if (condition_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(condition_data->access_type)) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (condition_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(condition_data->rat_type)) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_condition_data_writeJSON() failed [ConditionData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_condition_data_t *OpenAPI_condition_data_parseFromJSON(cJSON *condition_dataJSON)
 {
     OpenAPI_condition_data_t *condition_data_local_var = NULL;
@@ -153,7 +208,6 @@ end:
 OpenAPI_condition_data_t *OpenAPI_condition_data_copy(OpenAPI_condition_data_t *dst, OpenAPI_condition_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_condition_data_convertToJSON(src);
@@ -162,21 +216,6 @@ OpenAPI_condition_data_t *OpenAPI_condition_data_copy(OpenAPI_condition_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_condition_data_free(dst);
     dst = OpenAPI_condition_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "rat_type.h"
 
@@ -38,6 +39,7 @@ OpenAPI_condition_data_t *OpenAPI_condition_data_create(
 void OpenAPI_condition_data_free(OpenAPI_condition_data_t *condition_data);
 OpenAPI_condition_data_t *OpenAPI_condition_data_parseFromJSON(cJSON *condition_dataJSON);
 cJSON *OpenAPI_condition_data_convertToJSON(OpenAPI_condition_data_t *condition_data);
+bool OpenAPI_condition_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_condition_data_t *condition_data);
 OpenAPI_condition_data_t *OpenAPI_condition_data_copy(OpenAPI_condition_data_t *dst, OpenAPI_condition_data_t *src);
 
 #ifdef __cplusplus
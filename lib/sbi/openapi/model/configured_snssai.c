@@ -67,6 +67,40 @@ end:
     return item;
 }
 
+bool OpenAPI_configured_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_configured_snssai_t *configured_snssai)
+{
+    if (configured_snssai == NULL) {
+        ogs_error("OpenAPI_configured_snssai_writeJSON() failed [ConfiguredSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_configured_snssai_writeJSON() failed [ConfiguredSnssai]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "configuredSnssai", configured_snssai->configured_snssai) == false) {
+        ogs_error("OpenAPI_configured_snssai_writeJSON() failed [configured_snssai]");
+        goto end;
+    }
+
+    if (configured_snssai->mapped_home_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "mappedHomeSnssai", configured_snssai->mapped_home_snssai) == false) {
+        ogs_error("OpenAPI_configured_snssai_writeJSON() failed [mapped_home_snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_configured_snssai_writeJSON() failed [ConfiguredSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_parseFromJSON(cJSON *configured_snssaiJSON)
 {
     OpenAPI_configured_snssai_t *configured_snssai_local_var = NULL;
@@ -99,7 +133,6 @@ end:
 OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_copy(OpenAPI_configured_snssai_t *dst, OpenAPI_configured_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_configured_snssai_convertToJSON(src);
@@ -108,21 +141,6 @@ OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_copy(OpenAPI_configured_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_configured_snssai_free(dst);
     dst = OpenAPI_configured_snssai_parseFromJSON(item);
     cJSON_Delete(item);
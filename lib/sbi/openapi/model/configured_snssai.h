@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_create(
 void OpenAPI_configured_snssai_free(OpenAPI_configured_snssai_t *configured_snssai);
 OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_parseFromJSON(cJSON *configured_snssaiJSON);
 cJSON *OpenAPI_configured_snssai_convertToJSON(OpenAPI_configured_snssai_t *configured_snssai);
+bool OpenAPI_configured_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_configured_snssai_t *configured_snssai);
 OpenAPI_configured_snssai_t *OpenAPI_configured_snssai_copy(OpenAPI_configured_snssai_t *dst, OpenAPI_configured_snssai_t *src);
 
 #ifdef __cplusplus
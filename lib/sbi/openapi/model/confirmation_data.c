@@ -55,6 +55,40 @@ end:
     return item;
 }
 
+bool OpenAPI_confirmation_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_confirmation_data_t *confirmation_data)
+{
+    if (confirmation_data == NULL) {
+        ogs_error("OpenAPI_confirmation_data_writeJSON() failed [ConfirmationData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_confirmation_data_writeJSON() failed [ConfirmationData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resStar", confirmation_data->res_star) == false) {
+        ogs_error("OpenAPI_confirmation_data_writeJSON() failed [res_star]");
+        goto end;
+    }
+
+    if (confirmation_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", confirmation_data->supported_features) == false) {
+        ogs_error("OpenAPI_confirmation_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_confirmation_data_writeJSON() failed [ConfirmationData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_parseFromJSON(cJSON *confirmation_dataJSON)
 {
     OpenAPI_confirmation_data_t *confirmation_data_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_copy(OpenAPI_confirmation_data_t *dst, OpenAPI_confirmation_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_confirmation_data_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_copy(OpenAPI_confirmation
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_confirmation_data_free(dst);
     dst = OpenAPI_confirmation_data_parseFromJSON(item);
     cJSON_Delete(item);
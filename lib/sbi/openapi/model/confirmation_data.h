@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_create(
 void OpenAPI_confirmation_data_free(OpenAPI_confirmation_data_t *confirmation_data);
 OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_parseFromJSON(cJSON *confirmation_dataJSON);
 cJSON *OpenAPI_confirmation_data_convertToJSON(OpenAPI_confirmation_data_t *confirmation_data);
+bool OpenAPI_confirmation_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_confirmation_data_t *confirmation_data);
 OpenAPI_confirmation_data_t *OpenAPI_confirmation_data_copy(OpenAPI_confirmation_data_t *dst, OpenAPI_confirmation_data_t *src);
 
 #ifdef __cplusplus
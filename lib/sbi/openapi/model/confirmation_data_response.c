@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_confirmation_data_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_confirmation_data_response_t *confirmation_data_response)
+{
+    if (confirmation_data_response == NULL) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [ConfirmationDataResponse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [ConfirmationDataResponse]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "authResult", OpenAPI_auth_result_ToString(confirmation_data_response->auth_result)) == false) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [auth_result]");
+        goto end;
+    }
+
+    if (confirmation_data_response->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", confirmation_data_response->supi) == false) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (confirmation_data_response->kseaf) {
+    if (OpenAPI_json_write_string(writer, "kseaf", confirmation_data_response->kseaf) == false) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [kseaf]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_confirmation_data_response_writeJSON() failed [ConfirmationDataResponse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_parseFromJSON(cJSON *confirmation_data_responseJSON)
 {
     OpenAPI_confirmation_data_response_t *confirmation_data_response_local_var = NULL;
@@ -112,7 +153,6 @@ end:
 OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_copy(OpenAPI_confirmation_data_response_t *dst, OpenAPI_confirmation_data_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_confirmation_data_response_convertToJSON(src);
@@ -121,21 +161,6 @@ OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_confirmation_data_response_free(dst);
     dst = OpenAPI_confirmation_data_response_parseFromJSON(item);
     cJSON_Delete(item);
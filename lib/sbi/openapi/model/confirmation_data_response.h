@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_result.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_create(
 void OpenAPI_confirmation_data_response_free(OpenAPI_confirmation_data_response_t *confirmation_data_response);
 OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_parseFromJSON(cJSON *confirmation_data_responseJSON);
 cJSON *OpenAPI_confirmation_data_response_convertToJSON(OpenAPI_confirmation_data_response_t *confirmation_data_response);
+bool OpenAPI_confirmation_data_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_confirmation_data_response_t *confirmation_data_response);
 OpenAPI_confirmation_data_response_t *OpenAPI_confirmation_data_response_copy(OpenAPI_confirmation_data_response_t *dst, OpenAPI_confirmation_data_response_t *src);
 
 #ifdef __cplusplus
@@ -221,6 +221,147 @@ end:
     return item;
 }
 
+bool OpenAPI_context_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_context_data_sets_t *context_data_sets)
+{
+    if (context_data_sets == NULL) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ContextDataSets]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ContextDataSets]");
+        return false;
+    }
+    if (context_data_sets->amf3_gpp) {
+    if (OpenAPI_amf3_gpp_access_registration_writeJSON(writer, "amf3Gpp", context_data_sets->amf3_gpp) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [amf3_gpp]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->amf_non3_gpp) {
+    if (OpenAPI_amf_non3_gpp_access_registration_writeJSON(writer, "amfNon3Gpp", context_data_sets->amf_non3_gpp) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [amf_non3_gpp]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->sdm_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "sdmSubscriptions") == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [sdm_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sdm_subscriptions_node;
+    if (context_data_sets->sdm_subscriptions) {
+        OpenAPI_list_for_each(context_data_sets->sdm_subscriptions, sdm_subscriptions_node) {
+            if (OpenAPI_sdm_subscription_writeJSON(writer, NULL, sdm_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_context_data_sets_writeJSON() failed [sdm_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [sdm_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->ee_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "eeSubscriptions") == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ee_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ee_subscriptions_node;
+    if (context_data_sets->ee_subscriptions) {
+        OpenAPI_list_for_each(context_data_sets->ee_subscriptions, ee_subscriptions_node) {
+            if (OpenAPI_ee_subscription_writeJSON(writer, NULL, ee_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ee_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ee_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->smsf3_gpp_access) {
+    if (OpenAPI_smsf_registration_writeJSON(writer, "smsf3GppAccess", context_data_sets->smsf3_gpp_access) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [smsf3_gpp_access]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->smsf_non3_gpp_access) {
+    if (OpenAPI_smsf_registration_writeJSON(writer, "smsfNon3GppAccess", context_data_sets->smsf_non3_gpp_access) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [smsf_non3_gpp_access]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->subscription_data_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "subscriptionDataSubscriptions") == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [subscription_data_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscription_data_subscriptions_node;
+    if (context_data_sets->subscription_data_subscriptions) {
+        OpenAPI_list_for_each(context_data_sets->subscription_data_subscriptions, subscription_data_subscriptions_node) {
+            if (OpenAPI_subscription_data_subscriptions_writeJSON(writer, NULL, subscription_data_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_context_data_sets_writeJSON() failed [subscription_data_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [subscription_data_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->smf_registrations) {
+    if (OpenAPI_json_write_array_start(writer, "smfRegistrations") == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [smf_registrations]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_registrations_node;
+    if (context_data_sets->smf_registrations) {
+        OpenAPI_list_for_each(context_data_sets->smf_registrations, smf_registrations_node) {
+            if (OpenAPI_smf_registration_writeJSON(writer, NULL, smf_registrations_node->data) == false) {
+                ogs_error("OpenAPI_context_data_sets_writeJSON() failed [smf_registrations]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [smf_registrations]");
+        goto end;
+    }
+    }
+
+    if (context_data_sets->ip_sm_gw) {
+    if (OpenAPI_ip_sm_gw_registration_writeJSON(writer, "ipSmGw", context_data_sets->ip_sm_gw) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ip_sm_gw]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_context_data_sets_writeJSON() failed [ContextDataSets]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_parseFromJSON(cJSON *context_data_setsJSON)
 {
     OpenAPI_context_data_sets_t *context_data_sets_local_var = NULL;
@@ -395,7 +536,6 @@ end:
 OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_copy(OpenAPI_context_data_sets_t *dst, OpenAPI_context_data_sets_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_context_data_sets_convertToJSON(src);
@@ -404,21 +544,6 @@ OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_copy(OpenAPI_context_data
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_context_data_sets_free(dst);
     dst = OpenAPI_context_data_sets_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf3_gpp_access_registration.h"
 #include "amf_non3_gpp_access_registration.h"
 #include "ee_subscription.h"
@@ -52,6 +53,7 @@ OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_create(
 void OpenAPI_context_data_sets_free(OpenAPI_context_data_sets_t *context_data_sets);
 OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_parseFromJSON(cJSON *context_data_setsJSON);
 cJSON *OpenAPI_context_data_sets_convertToJSON(OpenAPI_context_data_sets_t *context_data_sets);
+bool OpenAPI_context_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_context_data_sets_t *context_data_sets);
 OpenAPI_context_data_sets_t *OpenAPI_context_data_sets_copy(OpenAPI_context_data_sets_t *dst, OpenAPI_context_data_sets_t *src);
 
 #ifdef __cplusplus
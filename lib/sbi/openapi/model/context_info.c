@@ -59,6 +59,47 @@ end:
     return item;
 }
 
+bool OpenAPI_context_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_context_info_t *context_info)
+{
+    if (context_info == NULL) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [ContextInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [ContextInfo]");
+        return false;
+    }
+    if (context_info->orig_headers) {
+    if (OpenAPI_json_write_array_start(writer, "origHeaders") == false) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [orig_headers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *orig_headers_node;
+    OpenAPI_list_for_each(context_info->orig_headers, orig_headers_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)orig_headers_node->data) == false) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [orig_headers]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [orig_headers]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_context_info_writeJSON() failed [ContextInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_context_info_t *OpenAPI_context_info_parseFromJSON(cJSON *context_infoJSON)
 {
     OpenAPI_context_info_t *context_info_local_var = NULL;
@@ -94,7 +135,6 @@ end:
 OpenAPI_context_info_t *OpenAPI_context_info_copy(OpenAPI_context_info_t *dst, OpenAPI_context_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_context_info_convertToJSON(src);
@@ -103,21 +143,6 @@ OpenAPI_context_info_t *OpenAPI_context_info_copy(OpenAPI_context_info_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_context_info_free(dst);
     dst = OpenAPI_context_info_parseFromJSON(item);
     cJSON_Delete(item);
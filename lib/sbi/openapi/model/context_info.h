@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_context_info_t *OpenAPI_context_info_create(
 void OpenAPI_context_info_free(OpenAPI_context_info_t *context_info);
 OpenAPI_context_info_t *OpenAPI_context_info_parseFromJSON(cJSON *context_infoJSON);
 cJSON *OpenAPI_context_info_convertToJSON(OpenAPI_context_info_t *context_info);
+bool OpenAPI_context_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_context_info_t *context_info);
 OpenAPI_context_info_t *OpenAPI_context_info_copy(OpenAPI_context_info_t *dst, OpenAPI_context_info_t *src);
 
 #ifdef __cplusplus
@@ -163,6 +163,124 @@ end:
     return item;
 }
 
+bool OpenAPI_data_change_notify_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_change_notify_t *data_change_notify)
+{
+    if (data_change_notify == NULL) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [DataChangeNotify]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [DataChangeNotify]");
+        return false;
+    }
+    if (data_change_notify->original_callback_reference) {
+    if (OpenAPI_json_write_array_start(writer, "originalCallbackReference") == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [original_callback_reference]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *original_callback_reference_node;
+    OpenAPI_list_for_each(data_change_notify->original_callback_reference, original_callback_reference_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)original_callback_reference_node->data) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [original_callback_reference]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [original_callback_reference]");
+        goto end;
+    }
+    }
+
+    if (data_change_notify->ue_id) {
+    if (OpenAPI_json_write_string(writer, "ueId", data_change_notify->ue_id) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [ue_id]");
+        goto end;
+    }
+    }
+
+    if (data_change_notify->notify_items) {
+    if (OpenAPI_json_write_array_start(writer, "notifyItems") == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [notify_items]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *notify_items_node;
+    if (data_change_notify->notify_items) {
+        OpenAPI_list_for_each(data_change_notify->notify_items, notify_items_node) {
+            if (OpenAPI_notify_item_writeJSON(writer, NULL, notify_items_node->data) == false) {
+                ogs_error("OpenAPI_data_change_notify_writeJSON() failed [notify_items]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [notify_items]");
+        goto end;
+    }
+    }
+
+    if (data_change_notify->sdm_subscription) {
+    if (OpenAPI_sdm_subscription_1_writeJSON(writer, "sdmSubscription", data_change_notify->sdm_subscription) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [sdm_subscription]");
+        goto end;
+    }
+    }
+
+    if (data_change_notify->additional_sdm_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "additionalSdmSubscriptions") == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [additional_sdm_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *additional_sdm_subscriptions_node;
+    if (data_change_notify->additional_sdm_subscriptions) {
+        OpenAPI_list_for_each(data_change_notify->additional_sdm_subscriptions, additional_sdm_subscriptions_node) {
+            if (OpenAPI_sdm_subscription_1_writeJSON(writer, NULL, additional_sdm_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_data_change_notify_writeJSON() failed [additional_sdm_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [additional_sdm_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (data_change_notify->subscription_data_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "subscriptionDataSubscriptions") == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [subscription_data_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscription_data_subscriptions_node;
+    if (data_change_notify->subscription_data_subscriptions) {
+        OpenAPI_list_for_each(data_change_notify->subscription_data_subscriptions, subscription_data_subscriptions_node) {
+            if (OpenAPI_subscription_data_subscriptions_writeJSON(writer, NULL, subscription_data_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_data_change_notify_writeJSON() failed [subscription_data_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [subscription_data_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_data_change_notify_writeJSON() failed [DataChangeNotify]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_parseFromJSON(cJSON *data_change_notifyJSON)
 {
     OpenAPI_data_change_notify_t *data_change_notify_local_var = NULL;
@@ -306,7 +424,6 @@ end:
 OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_copy(OpenAPI_data_change_notify_t *dst, OpenAPI_data_change_notify_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_data_change_notify_convertToJSON(src);
@@ -315,21 +432,6 @@ OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_copy(OpenAPI_data_chang
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_data_change_notify_free(dst);
     dst = OpenAPI_data_change_notify_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "notify_item.h"
 #include "sdm_subscription_1.h"
 #include "subscription_data_subscriptions.h"
@@ -41,6 +42,7 @@ OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_create(
 void OpenAPI_data_change_notify_free(OpenAPI_data_change_notify_t *data_change_notify);
 OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_parseFromJSON(cJSON *data_change_notifyJSON);
 cJSON *OpenAPI_data_change_notify_convertToJSON(OpenAPI_data_change_notify_t *data_change_notify);
+bool OpenAPI_data_change_notify_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_change_notify_t *data_change_notify);
 OpenAPI_data_change_notify_t *OpenAPI_data_change_notify_copy(OpenAPI_data_change_notify_t *dst, OpenAPI_data_change_notify_t *src);
 
 #ifdef __cplusplus
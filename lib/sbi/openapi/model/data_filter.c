@@ -231,6 +231,187 @@ end:
     return item;
 }
 
+bool OpenAPI_data_filter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_filter_t *data_filter)
+{
+    if (data_filter == NULL) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [DataFilter]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [DataFilter]");
+        return false;
+    }
+    if (OpenAPI_data_ind_writeJSON(writer, "dataInd", data_filter->data_ind) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [data_ind]");
+        goto end;
+    }
+
+    if (data_filter->dnns) {
+    if (OpenAPI_json_write_array_start(writer, "dnns") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [dnns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnns_node;
+    OpenAPI_list_for_each(data_filter->dnns, dnns_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnns_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [dnns]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [dnns]");
+        goto end;
+    }
+    }
+
+    if (data_filter->snssais) {
+    if (OpenAPI_json_write_array_start(writer, "snssais") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssais_node;
+    if (data_filter->snssais) {
+        OpenAPI_list_for_each(data_filter->snssais, snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssais_node->data) == false) {
+                ogs_error("OpenAPI_data_filter_writeJSON() failed [snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [snssais]");
+        goto end;
+    }
+    }
+
+    if (data_filter->internal_group_ids) {
+    if (OpenAPI_json_write_array_start(writer, "internalGroupIds") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *internal_group_ids_node;
+    OpenAPI_list_for_each(data_filter->internal_group_ids, internal_group_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)internal_group_ids_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+    }
+
+    if (data_filter->supis) {
+    if (OpenAPI_json_write_array_start(writer, "supis") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [supis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supis_node;
+    OpenAPI_list_for_each(data_filter->supis, supis_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)supis_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [supis]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [supis]");
+        goto end;
+    }
+    }
+
+    if (data_filter->app_ids) {
+    if (OpenAPI_json_write_array_start(writer, "appIds") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [app_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_ids_node;
+    OpenAPI_list_for_each(data_filter->app_ids, app_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)app_ids_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [app_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [app_ids]");
+        goto end;
+    }
+    }
+
+    if (data_filter->ue_ipv4s) {
+    if (OpenAPI_json_write_array_start(writer, "ueIpv4s") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv4s]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ue_ipv4s_node;
+    OpenAPI_list_for_each(data_filter->ue_ipv4s, ue_ipv4s_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ue_ipv4s_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv4s]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv4s]");
+        goto end;
+    }
+    }
+
+    if (data_filter->ue_ipv6s) {
+    if (OpenAPI_json_write_array_start(writer, "ueIpv6s") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv6s]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ue_ipv6s_node;
+    OpenAPI_list_for_each(data_filter->ue_ipv6s, ue_ipv6s_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ue_ipv6s_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv6s]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_ipv6s]");
+        goto end;
+    }
+    }
+
+    if (data_filter->ue_macs) {
+    if (OpenAPI_json_write_array_start(writer, "ueMacs") == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_macs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ue_macs_node;
+    OpenAPI_list_for_each(data_filter->ue_macs, ue_macs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ue_macs_node->data) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_macs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [ue_macs]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_data_filter_writeJSON() failed [DataFilter]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_data_filter_t *OpenAPI_data_filter_parseFromJSON(cJSON *data_filterJSON)
 {
     OpenAPI_data_filter_t *data_filter_local_var = NULL;
@@ -432,7 +613,6 @@ end:
 OpenAPI_data_filter_t *OpenAPI_data_filter_copy(OpenAPI_data_filter_t *dst, OpenAPI_data_filter_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_data_filter_convertToJSON(src);
@@ -441,21 +621,6 @@ OpenAPI_data_filter_t *OpenAPI_data_filter_copy(OpenAPI_data_filter_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_data_filter_free(dst);
     dst = OpenAPI_data_filter_parseFromJSON(item);
     cJSON_Delete(item);
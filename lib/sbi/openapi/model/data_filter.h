@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "data_ind.h"
 #include "snssai.h"
 
@@ -46,6 +47,7 @@ OpenAPI_data_filter_t *OpenAPI_data_filter_create(
 void OpenAPI_data_filter_free(OpenAPI_data_filter_t *data_filter);
 OpenAPI_data_filter_t *OpenAPI_data_filter_parseFromJSON(cJSON *data_filterJSON);
 cJSON *OpenAPI_data_filter_convertToJSON(OpenAPI_data_filter_t *data_filter);
+bool OpenAPI_data_filter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_filter_t *data_filter);
 OpenAPI_data_filter_t *OpenAPI_data_filter_copy(OpenAPI_data_filter_t *dst, OpenAPI_data_filter_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_data_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_ind_t *data_ind)
+{
+    if (data_ind == NULL) {
+        ogs_error("OpenAPI_data_ind_writeJSON() failed [DataInd]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_data_ind_writeJSON() failed [DataInd]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_data_ind_writeJSON() failed [DataInd]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_data_ind_t *OpenAPI_data_ind_parseFromJSON(cJSON *data_indJSON)
 {
     OpenAPI_data_ind_t *data_ind_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_data_ind_t *OpenAPI_data_ind_copy(OpenAPI_data_ind_t *dst, OpenAPI_data_ind_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_data_ind_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_data_ind_t *OpenAPI_data_ind_copy(OpenAPI_data_ind_t *dst, OpenAPI_data_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_data_ind_free(dst);
     dst = OpenAPI_data_ind_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "data_ind_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_data_ind_t *OpenAPI_data_ind_create(
 void OpenAPI_data_ind_free(OpenAPI_data_ind_t *data_ind);
 OpenAPI_data_ind_t *OpenAPI_data_ind_parseFromJSON(cJSON *data_indJSON);
 cJSON *OpenAPI_data_ind_convertToJSON(OpenAPI_data_ind_t *data_ind);
+bool OpenAPI_data_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_data_ind_t *data_ind);
 OpenAPI_data_ind_t *OpenAPI_data_ind_copy(OpenAPI_data_ind_t *dst, OpenAPI_data_ind_t *src);
 
 #ifdef __cplusplus
@@ -107,6 +107,81 @@ end:
     return item;
 }
 
+bool OpenAPI_datalink_reporting_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_datalink_reporting_configuration_t *datalink_reporting_configuration)
+{
+    if (datalink_reporting_configuration == NULL) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [DatalinkReportingConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [DatalinkReportingConfiguration]");
+        return false;
+    }
+    if (datalink_reporting_configuration->ddd_traffic_des) {
+    if (OpenAPI_json_write_array_start(writer, "dddTrafficDes") == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_traffic_des]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ddd_traffic_des_node;
+    if (datalink_reporting_configuration->ddd_traffic_des) {
+        OpenAPI_list_for_each(datalink_reporting_configuration->ddd_traffic_des, ddd_traffic_des_node) {
+            if (OpenAPI_ddd_traffic_descriptor_writeJSON(writer, NULL, ddd_traffic_des_node->data) == false) {
+                ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_traffic_des]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_traffic_des]");
+        goto end;
+    }
+    }
+
+    if (datalink_reporting_configuration->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", datalink_reporting_configuration->dnn) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (datalink_reporting_configuration->slice) {
+    if (OpenAPI_snssai_writeJSON(writer, "slice", datalink_reporting_configuration->slice) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [slice]");
+        goto end;
+    }
+    }
+
+    if (datalink_reporting_configuration->ddd_status_list) {
+    if (OpenAPI_json_write_array_start(writer, "dddStatusList") == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_status_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ddd_status_list_node;
+    OpenAPI_list_for_each(datalink_reporting_configuration->ddd_status_list, ddd_status_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_dl_data_delivery_status_ToString((intptr_t)ddd_status_list_node->data)) == false) {
+            ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_status_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [ddd_status_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_datalink_reporting_configuration_writeJSON() failed [DatalinkReportingConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_datalink_reporting_configuration_t *OpenAPI_datalink_reporting_configuration_parseFromJSON(cJSON *datalink_reporting_configurationJSON)
 {
     OpenAPI_datalink_reporting_configuration_t *datalink_reporting_configuration_local_var = NULL;
@@ -192,7 +267,6 @@ end:
 OpenAPI_datalink_reporting_configuration_t *OpenAPI_datalink_reporting_configuration_copy(OpenAPI_datalink_reporting_configuration_t *dst, OpenAPI_datalink_reporting_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_datalink_reporting_configuration_convertToJSON(src);
@@ -201,21 +275,6 @@ OpenAPI_datalink_reporting_configuration_t *OpenAPI_datalink_reporting_configura
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_datalink_reporting_configuration_free(dst);
     dst = OpenAPI_datalink_reporting_configuration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -78,6 +78,56 @@ end:
     return item;
 }
 
+bool OpenAPI_ddd_traffic_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ddd_traffic_descriptor_t *ddd_traffic_descriptor)
+{
+    if (ddd_traffic_descriptor == NULL) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [DddTrafficDescriptor]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [DddTrafficDescriptor]");
+        return false;
+    }
+    if (ddd_traffic_descriptor->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", ddd_traffic_descriptor->ipv4_addr) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (ddd_traffic_descriptor->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", ddd_traffic_descriptor->ipv6_addr) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (ddd_traffic_descriptor->is_port_number) {
+    if (OpenAPI_json_write_number(writer, "portNumber", ddd_traffic_descriptor->port_number) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [port_number]");
+        goto end;
+    }
+    }
+
+    if (ddd_traffic_descriptor->mac_addr) {
+    if (OpenAPI_json_write_string(writer, "macAddr", ddd_traffic_descriptor->mac_addr) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [mac_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ddd_traffic_descriptor_writeJSON() failed [DddTrafficDescriptor]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ddd_traffic_descriptor_t *OpenAPI_ddd_traffic_descriptor_parseFromJSON(cJSON *ddd_traffic_descriptorJSON)
 {
     OpenAPI_ddd_traffic_descriptor_t *ddd_traffic_descriptor_local_var = NULL;
@@ -133,7 +183,6 @@ end:
 OpenAPI_ddd_traffic_descriptor_t *OpenAPI_ddd_traffic_descriptor_copy(OpenAPI_ddd_traffic_descriptor_t *dst, OpenAPI_ddd_traffic_descriptor_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ddd_traffic_descriptor_convertToJSON(src);
@@ -142,21 +191,6 @@ OpenAPI_ddd_traffic_descriptor_t *OpenAPI_ddd_traffic_descriptor_copy(OpenAPI_dd
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ddd_traffic_descriptor_free(dst);
     dst = OpenAPI_ddd_traffic_descriptor_parseFromJSON(item);
     cJSON_Delete(item);
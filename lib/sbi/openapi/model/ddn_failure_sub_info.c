@@ -71,6 +71,54 @@ end:
     return item;
 }
 
+bool OpenAPI_ddn_failure_sub_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ddn_failure_sub_info_t *ddn_failure_sub_info)
+{
+    if (ddn_failure_sub_info == NULL) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [DdnFailureSubInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [DdnFailureSubInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notifyCorrelationId", ddn_failure_sub_info->notify_correlation_id) == false) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [notify_correlation_id]");
+        goto end;
+    }
+
+    if (ddn_failure_sub_info->ddd_traffic_descriptor_list) {
+    if (OpenAPI_json_write_array_start(writer, "dddTrafficDescriptorList") == false) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [ddd_traffic_descriptor_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ddd_traffic_descriptor_list_node;
+    if (ddn_failure_sub_info->ddd_traffic_descriptor_list) {
+        OpenAPI_list_for_each(ddn_failure_sub_info->ddd_traffic_descriptor_list, ddd_traffic_descriptor_list_node) {
+            if (OpenAPI_ddd_traffic_descriptor_writeJSON(writer, NULL, ddd_traffic_descriptor_list_node->data) == false) {
+                ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [ddd_traffic_descriptor_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [ddd_traffic_descriptor_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ddn_failure_sub_info_writeJSON() failed [DdnFailureSubInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ddn_failure_sub_info_t *OpenAPI_ddn_failure_sub_info_parseFromJSON(cJSON *ddn_failure_sub_infoJSON)
 {
     OpenAPI_ddn_failure_sub_info_t *ddn_failure_sub_info_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_ddn_failure_sub_info_t *OpenAPI_ddn_failure_sub_info_copy(OpenAPI_ddn_failure_sub_info_t *dst, OpenAPI_ddn_failure_sub_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ddn_failure_sub_info_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_ddn_failure_sub_info_t *OpenAPI_ddn_failure_sub_info_copy(OpenAPI_ddn_fa
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ddn_failure_sub_info_free(dst);
     dst = OpenAPI_ddn_failure_sub_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -74,6 +74,56 @@ end:
     return item;
 }
 
+bool OpenAPI_ddn_failure_subs_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ddn_failure_subs_t *ddn_failure_subs)
+{
+    if (ddn_failure_subs == NULL) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [DdnFailureSubs]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [DdnFailureSubs]");
+        return false;
+    }
+    if (ddn_failure_subs->is_ddn_failure_subs_ind) {
+    if (OpenAPI_json_write_bool(writer, "ddnFailureSubsInd", ddn_failure_subs->ddn_failure_subs_ind) == false) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [ddn_failure_subs_ind]");
+        goto end;
+    }
+    }
+
+    if (ddn_failure_subs->ddn_failure_subs_info_list) {
+    if (OpenAPI_json_write_array_start(writer, "ddnFailureSubsInfoList") == false) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [ddn_failure_subs_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ddn_failure_subs_info_list_node;
+    if (ddn_failure_subs->ddn_failure_subs_info_list) {
+        OpenAPI_list_for_each(ddn_failure_subs->ddn_failure_subs_info_list, ddn_failure_subs_info_list_node) {
+            if (OpenAPI_ddn_failure_sub_info_writeJSON(writer, NULL, ddn_failure_subs_info_list_node->data) == false) {
+                ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [ddn_failure_subs_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [ddn_failure_subs_info_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ddn_failure_subs_writeJSON() failed [DdnFailureSubs]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_parseFromJSON(cJSON *ddn_failure_subsJSON)
 {
     OpenAPI_ddn_failure_subs_t *ddn_failure_subs_local_var = NULL;
@@ -129,7 +179,6 @@ end:
 OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_copy(OpenAPI_ddn_failure_subs_t *dst, OpenAPI_ddn_failure_subs_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ddn_failure_subs_convertToJSON(src);
@@ -138,21 +187,6 @@ OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_copy(OpenAPI_ddn_failure_su
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ddn_failure_subs_free(dst);
     dst = OpenAPI_ddn_failure_subs_parseFromJSON(item);
     cJSON_Delete(item);
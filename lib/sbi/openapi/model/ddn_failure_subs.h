@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ddn_failure_sub_info.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_create(
 void OpenAPI_ddn_failure_subs_free(OpenAPI_ddn_failure_subs_t *ddn_failure_subs);
 OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_parseFromJSON(cJSON *ddn_failure_subsJSON);
 cJSON *OpenAPI_ddn_failure_subs_convertToJSON(OpenAPI_ddn_failure_subs_t *ddn_failure_subs);
+bool OpenAPI_ddn_failure_subs_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ddn_failure_subs_t *ddn_failure_subs);
 OpenAPI_ddn_failure_subs_t *OpenAPI_ddn_failure_subs_copy(OpenAPI_ddn_failure_subs_t *dst, OpenAPI_ddn_failure_subs_t *src);
 
 #ifdef __cplusplus
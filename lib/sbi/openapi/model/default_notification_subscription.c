@@ -102,6 +102,78 @@ end:
     return item;
 }
 
+bool OpenAPI_default_notification_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_notification_subscription_t *default_notification_subscription)
+{
+    if (default_notification_subscription == NULL) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [DefaultNotificationSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [DefaultNotificationSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationType", OpenAPI_notification_type_ToString(default_notification_subscription->notification_type)) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [notification_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "callbackUri", default_notification_subscription->callback_uri) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [callback_uri]");
+        goto end;
+    }
+
+    if (default_notification_subscription->n1_message_class) {
+    if (OpenAPI_json_write_string(writer, "n1MessageClass", OpenAPI_n1_message_class_ToString(default_notification_subscription->n1_message_class)) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [n1_message_class]");
+        goto end;
+    }
+    }
+
+    if (default_notification_subscription->n2_information_class) {
+    if (OpenAPI_json_write_string(writer, "n2InformationClass", OpenAPI_n2_information_class_ToString(default_notification_subscription->n2_information_class)) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [n2_information_class]");
+        goto end;
+    }
+    }
+
+    if (default_notification_subscription->versions) {
+    if (OpenAPI_json_write_array_start(writer, "versions") == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [versions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *versions_node;
+    OpenAPI_list_for_each(default_notification_subscription->versions, versions_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)versions_node->data) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [versions]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [versions]");
+        goto end;
+    }
+    }
+
+    if (default_notification_subscription->binding) {
+    if (OpenAPI_json_write_string(writer, "binding", default_notification_subscription->binding) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [binding]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_default_notification_subscription_writeJSON() failed [DefaultNotificationSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscription_parseFromJSON(cJSON *default_notification_subscriptionJSON)
 {
     OpenAPI_default_notification_subscription_t *default_notification_subscription_local_var = NULL;
@@ -197,7 +269,6 @@ end:
 OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscription_copy(OpenAPI_default_notification_subscription_t *dst, OpenAPI_default_notification_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_default_notification_subscription_convertToJSON(src);
@@ -206,21 +277,6 @@ OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_default_notification_subscription_free(dst);
     dst = OpenAPI_default_notification_subscription_parseFromJSON(item);
     cJSON_Delete(item);
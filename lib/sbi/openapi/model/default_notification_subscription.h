@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n1_message_class.h"
 #include "n2_information_class.h"
 #include "notification_type.h"
@@ -41,6 +42,7 @@ OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscr
 void OpenAPI_default_notification_subscription_free(OpenAPI_default_notification_subscription_t *default_notification_subscription);
 OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscription_parseFromJSON(cJSON *default_notification_subscriptionJSON);
 cJSON *OpenAPI_default_notification_subscription_convertToJSON(OpenAPI_default_notification_subscription_t *default_notification_subscription);
+bool OpenAPI_default_notification_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_notification_subscription_t *default_notification_subscription);
 OpenAPI_default_notification_subscription_t *OpenAPI_default_notification_subscription_copy(OpenAPI_default_notification_subscription_t *dst, OpenAPI_default_notification_subscription_t *src);
 
 #ifdef __cplusplus
@@ -119,6 +119,89 @@ end:
     return item;
 }
 
+bool OpenAPI_default_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_unrelated_class_t *default_unrelated_class)
+{
+    if (default_unrelated_class == NULL) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [DefaultUnrelatedClass]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [DefaultUnrelatedClass]");
+        return false;
+    }
+    if (default_unrelated_class->allowed_geographic_area) {
+    if (OpenAPI_json_write_array_start(writer, "allowedGeographicArea") == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_geographic_area_node;
+    if (default_unrelated_class->allowed_geographic_area) {
+        OpenAPI_list_for_each(default_unrelated_class->allowed_geographic_area, allowed_geographic_area_node) {
+            if (OpenAPI_geographic_area_writeJSON(writer, NULL, allowed_geographic_area_node->data) == false) {
+                ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class->privacy_check_related_action) {
+    if (OpenAPI_json_write_string(writer, "privacyCheckRelatedAction", OpenAPI_privacy_check_related_action_ToString(default_unrelated_class->privacy_check_related_action)) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [privacy_check_related_action]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class->code_word_ind) {
+    if (OpenAPI_json_write_string(writer, "codeWordInd", OpenAPI_code_word_ind_ToString(default_unrelated_class->code_word_ind)) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [code_word_ind]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class->valid_time_period) {
+    if (OpenAPI_valid_time_period_writeJSON(writer, "validTimePeriod", default_unrelated_class->valid_time_period) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class->code_word_list) {
+    if (OpenAPI_json_write_array_start(writer, "codeWordList") == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *code_word_list_node;
+    OpenAPI_list_for_each(default_unrelated_class->code_word_list, code_word_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)code_word_list_node->data) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_writeJSON() failed [DefaultUnrelatedClass]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_parseFromJSON(cJSON *default_unrelated_classJSON)
 {
     OpenAPI_default_unrelated_class_t *default_unrelated_class_local_var = NULL;
@@ -216,7 +299,6 @@ end:
 OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_copy(OpenAPI_default_unrelated_class_t *dst, OpenAPI_default_unrelated_class_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_default_unrelated_class_convertToJSON(src);
@@ -225,21 +307,6 @@ OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_default_unrelated_class_free(dst);
     dst = OpenAPI_default_unrelated_class_parseFromJSON(item);
     cJSON_Delete(item);
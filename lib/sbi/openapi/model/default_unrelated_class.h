@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "code_word_ind.h"
 #include "geographic_area.h"
 #include "privacy_check_related_action.h"
@@ -40,6 +41,7 @@ OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_create(
 void OpenAPI_default_unrelated_class_free(OpenAPI_default_unrelated_class_t *default_unrelated_class);
 OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_parseFromJSON(cJSON *default_unrelated_classJSON);
 cJSON *OpenAPI_default_unrelated_class_convertToJSON(OpenAPI_default_unrelated_class_t *default_unrelated_class);
+bool OpenAPI_default_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_unrelated_class_t *default_unrelated_class);
 OpenAPI_default_unrelated_class_t *OpenAPI_default_unrelated_class_copy(OpenAPI_default_unrelated_class_t *dst, OpenAPI_default_unrelated_class_t *src);
 
 #ifdef __cplusplus
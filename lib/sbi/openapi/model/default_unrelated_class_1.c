@@ -119,6 +119,89 @@ end:
     return item;
 }
 
+bool OpenAPI_default_unrelated_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_unrelated_class_1_t *default_unrelated_class_1)
+{
+    if (default_unrelated_class_1 == NULL) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [DefaultUnrelatedClass_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [DefaultUnrelatedClass_1]");
+        return false;
+    }
+    if (default_unrelated_class_1->allowed_geographic_area) {
+    if (OpenAPI_json_write_array_start(writer, "allowedGeographicArea") == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_geographic_area_node;
+    if (default_unrelated_class_1->allowed_geographic_area) {
+        OpenAPI_list_for_each(default_unrelated_class_1->allowed_geographic_area, allowed_geographic_area_node) {
+            if (OpenAPI_geographic_area_writeJSON(writer, NULL, allowed_geographic_area_node->data) == false) {
+                ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [allowed_geographic_area]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class_1->privacy_check_related_action) {
+    if (OpenAPI_json_write_string(writer, "privacyCheckRelatedAction", OpenAPI_privacy_check_related_action_ToString(default_unrelated_class_1->privacy_check_related_action)) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [privacy_check_related_action]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class_1->code_word_ind) {
+    if (OpenAPI_json_write_string(writer, "codeWordInd", OpenAPI_code_word_ind_ToString(default_unrelated_class_1->code_word_ind)) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [code_word_ind]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class_1->valid_time_period) {
+    if (OpenAPI_valid_time_period_1_writeJSON(writer, "validTimePeriod", default_unrelated_class_1->valid_time_period) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (default_unrelated_class_1->code_word_list) {
+    if (OpenAPI_json_write_array_start(writer, "codeWordList") == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *code_word_list_node;
+    OpenAPI_list_for_each(default_unrelated_class_1->code_word_list, code_word_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)code_word_list_node->data) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_default_unrelated_class_1_writeJSON() failed [DefaultUnrelatedClass_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_parseFromJSON(cJSON *default_unrelated_class_1JSON)
 {
     OpenAPI_default_unrelated_class_1_t *default_unrelated_class_1_local_var = NULL;
@@ -216,7 +299,6 @@ end:
 OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_copy(OpenAPI_default_unrelated_class_1_t *dst, OpenAPI_default_unrelated_class_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_default_unrelated_class_1_convertToJSON(src);
@@ -225,21 +307,6 @@ OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_default_unrelated_class_1_free(dst);
     dst = OpenAPI_default_unrelated_class_1_parseFromJSON(item);
     cJSON_Delete(item);
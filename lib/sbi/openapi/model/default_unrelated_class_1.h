@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "code_word_ind.h"
 #include "geographic_area.h"
 #include "privacy_check_related_action.h"
@@ -40,6 +41,7 @@ OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_create(
 void OpenAPI_default_unrelated_class_1_free(OpenAPI_default_unrelated_class_1_t *default_unrelated_class_1);
 OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_parseFromJSON(cJSON *default_unrelated_class_1JSON);
 cJSON *OpenAPI_default_unrelated_class_1_convertToJSON(OpenAPI_default_unrelated_class_1_t *default_unrelated_class_1);
+bool OpenAPI_default_unrelated_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_default_unrelated_class_1_t *default_unrelated_class_1);
 OpenAPI_default_unrelated_class_1_t *OpenAPI_default_unrelated_class_1_copy(OpenAPI_default_unrelated_class_1_t *dst, OpenAPI_default_unrelated_class_1_t *src);
 
 #ifdef __cplusplus
@@ -74,6 +74,54 @@ end:
     return item;
 }
 
+bool OpenAPI_deregistration_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_deregistration_data_t *deregistration_data)
+{
+    if (deregistration_data == NULL) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [DeregistrationData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [DeregistrationData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "deregReason", OpenAPI_deregistration_reason_ToString(deregistration_data->dereg_reason)) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [dereg_reason]");
+        goto end;
+    }
+
+    if (deregistration_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(deregistration_data->access_type)) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (deregistration_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", deregistration_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (deregistration_data->new_smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "newSmfInstanceId", deregistration_data->new_smf_instance_id) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [new_smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_deregistration_data_writeJSON() failed [DeregistrationData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_parseFromJSON(cJSON *deregistration_dataJSON)
 {
     OpenAPI_deregistration_data_t *deregistration_data_local_var = NULL;
@@ -135,7 +183,6 @@ end:
 OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_copy(OpenAPI_deregistration_data_t *dst, OpenAPI_deregistration_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_deregistration_data_convertToJSON(src);
@@ -144,21 +191,6 @@ OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_copy(OpenAPI_deregist
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_deregistration_data_free(dst);
     dst = OpenAPI_deregistration_data_parseFromJSON(item);
     cJSON_Delete(item);
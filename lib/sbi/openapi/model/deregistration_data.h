@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "deregistration_reason.h"
 
@@ -38,6 +39,7 @@ OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_create(
 void OpenAPI_deregistration_data_free(OpenAPI_deregistration_data_t *deregistration_data);
 OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_parseFromJSON(cJSON *deregistration_dataJSON);
 cJSON *OpenAPI_deregistration_data_convertToJSON(OpenAPI_deregistration_data_t *deregistration_data);
+bool OpenAPI_deregistration_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_deregistration_data_t *deregistration_data);
 OpenAPI_deregistration_data_t *OpenAPI_deregistration_data_copy(OpenAPI_deregistration_data_t *dst, OpenAPI_deregistration_data_t *src);
 
 #ifdef __cplusplus
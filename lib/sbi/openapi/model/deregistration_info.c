@@ -55,6 +55,40 @@ end:
     return item;
 }
 
+bool OpenAPI_deregistration_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_deregistration_info_t *deregistration_info)
+{
+    if (deregistration_info == NULL) {
+        ogs_error("OpenAPI_deregistration_info_writeJSON() failed [DeregistrationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_deregistration_info_writeJSON() failed [DeregistrationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supi", deregistration_info->supi) == false) {
+        ogs_error("OpenAPI_deregistration_info_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (deregistration_info->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", deregistration_info->supported_features) == false) {
+        ogs_error("OpenAPI_deregistration_info_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_deregistration_info_writeJSON() failed [DeregistrationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_parseFromJSON(cJSON *deregistration_infoJSON)
 {
     OpenAPI_deregistration_info_t *deregistration_info_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_copy(OpenAPI_deregistration_info_t *dst, OpenAPI_deregistration_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_deregistration_info_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_copy(OpenAPI_deregist
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_deregistration_info_free(dst);
     dst = OpenAPI_deregistration_info_parseFromJSON(item);
     cJSON_Delete(item);
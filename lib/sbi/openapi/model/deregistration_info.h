@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_create(
 void OpenAPI_deregistration_info_free(OpenAPI_deregistration_info_t *deregistration_info);
 OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_parseFromJSON(cJSON *deregistration_infoJSON);
 cJSON *OpenAPI_deregistration_info_convertToJSON(OpenAPI_deregistration_info_t *deregistration_info);
+bool OpenAPI_deregistration_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_deregistration_info_t *deregistration_info);
 OpenAPI_deregistration_info_t *OpenAPI_deregistration_info_copy(OpenAPI_deregistration_info_t *dst, OpenAPI_deregistration_info_t *src);
 
 #ifdef __cplusplus
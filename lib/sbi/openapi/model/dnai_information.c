@@ -67,6 +67,47 @@ end:
     return item;
 }
 
+bool OpenAPI_dnai_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnai_information_t *dnai_information)
+{
+    if (dnai_information == NULL) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [DnaiInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [DnaiInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnai", dnai_information->dnai) == false) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [dnai]");
+        goto end;
+    }
+
+    if (dnai_information->is_no_dnai_change_ind) {
+    if (OpenAPI_json_write_bool(writer, "noDnaiChangeInd", dnai_information->no_dnai_change_ind) == false) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [no_dnai_change_ind]");
+        goto end;
+    }
+    }
+
+    if (dnai_information->is_no_local_psa_change_ind) {
+    if (OpenAPI_json_write_bool(writer, "noLocalPsaChangeInd", dnai_information->no_local_psa_change_ind) == false) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [no_local_psa_change_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnai_information_writeJSON() failed [DnaiInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnai_information_t *OpenAPI_dnai_information_parseFromJSON(cJSON *dnai_informationJSON)
 {
     OpenAPI_dnai_information_t *dnai_information_local_var = NULL;
@@ -115,7 +156,6 @@ end:
 OpenAPI_dnai_information_t *OpenAPI_dnai_information_copy(OpenAPI_dnai_information_t *dst, OpenAPI_dnai_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnai_information_convertToJSON(src);
@@ -124,21 +164,6 @@ OpenAPI_dnai_information_t *OpenAPI_dnai_information_copy(OpenAPI_dnai_informati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnai_information_free(dst);
     dst = OpenAPI_dnai_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +37,7 @@ OpenAPI_dnai_information_t *OpenAPI_dnai_information_create(
 void OpenAPI_dnai_information_free(OpenAPI_dnai_information_t *dnai_information);
 OpenAPI_dnai_information_t *OpenAPI_dnai_information_parseFromJSON(cJSON *dnai_informationJSON);
 cJSON *OpenAPI_dnai_information_convertToJSON(OpenAPI_dnai_information_t *dnai_information);
+bool OpenAPI_dnai_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnai_information_t *dnai_information);
 OpenAPI_dnai_information_t *OpenAPI_dnai_information_copy(OpenAPI_dnai_information_t *dst, OpenAPI_dnai_information_t *src);
 
 #ifdef __cplusplus
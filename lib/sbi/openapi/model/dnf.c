@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_dnf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnf_t *dnf)
+{
+    if (dnf == NULL) {
+        ogs_error("OpenAPI_dnf_writeJSON() failed [Dnf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnf_writeJSON() failed [Dnf]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "dnfUnits") == false) {
+        ogs_error("OpenAPI_dnf_writeJSON() failed [dnf_units]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnf_units_node;
+    if (dnf->dnf_units) {
+        OpenAPI_list_for_each(dnf->dnf_units, dnf_units_node) {
+            if (OpenAPI_dnf_unit_writeJSON(writer, NULL, dnf_units_node->data) == false) {
+                ogs_error("OpenAPI_dnf_writeJSON() failed [dnf_units]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnf_writeJSON() failed [dnf_units]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnf_writeJSON() failed [Dnf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnf_t *OpenAPI_dnf_parseFromJSON(cJSON *dnfJSON)
 {
     OpenAPI_dnf_t *dnf_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_dnf_t *OpenAPI_dnf_copy(OpenAPI_dnf_t *dst, OpenAPI_dnf_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnf_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_dnf_t *OpenAPI_dnf_copy(OpenAPI_dnf_t *dst, OpenAPI_dnf_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnf_free(dst);
     dst = OpenAPI_dnf_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnf_unit.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_dnf_t *OpenAPI_dnf_create(
 void OpenAPI_dnf_free(OpenAPI_dnf_t *dnf);
 OpenAPI_dnf_t *OpenAPI_dnf_parseFromJSON(cJSON *dnfJSON);
 cJSON *OpenAPI_dnf_convertToJSON(OpenAPI_dnf_t *dnf);
+bool OpenAPI_dnf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnf_t *dnf);
 OpenAPI_dnf_t *OpenAPI_dnf_copy(OpenAPI_dnf_t *dst, OpenAPI_dnf_t *src);
 
 #ifdef __cplusplus
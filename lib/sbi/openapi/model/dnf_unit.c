@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_dnf_unit_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnf_unit_t *dnf_unit)
+{
+    if (dnf_unit == NULL) {
+        ogs_error("OpenAPI_dnf_unit_writeJSON() failed [DnfUnit]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnf_unit_writeJSON() failed [DnfUnit]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "dnfUnit") == false) {
+        ogs_error("OpenAPI_dnf_unit_writeJSON() failed [dnf_unit]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnf_unit_node;
+    if (dnf_unit->dnf_unit) {
+        OpenAPI_list_for_each(dnf_unit->dnf_unit, dnf_unit_node) {
+            if (OpenAPI_atom_writeJSON(writer, NULL, dnf_unit_node->data) == false) {
+                ogs_error("OpenAPI_dnf_unit_writeJSON() failed [dnf_unit]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnf_unit_writeJSON() failed [dnf_unit]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnf_unit_writeJSON() failed [DnfUnit]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_parseFromJSON(cJSON *dnf_unitJSON)
 {
     OpenAPI_dnf_unit_t *dnf_unit_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_copy(OpenAPI_dnf_unit_t *dst, OpenAPI_dnf_unit_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnf_unit_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_copy(OpenAPI_dnf_unit_t *dst, OpenAPI_dnf_u
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnf_unit_free(dst);
     dst = OpenAPI_dnf_unit_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "atom.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_create(
 void OpenAPI_dnf_unit_free(OpenAPI_dnf_unit_t *dnf_unit);
 OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_parseFromJSON(cJSON *dnf_unitJSON);
 cJSON *OpenAPI_dnf_unit_convertToJSON(OpenAPI_dnf_unit_t *dnf_unit);
+bool OpenAPI_dnf_unit_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnf_unit_t *dnf_unit);
 OpenAPI_dnf_unit_t *OpenAPI_dnf_unit_copy(OpenAPI_dnf_unit_t *dst, OpenAPI_dnf_unit_t *src);
 
 #ifdef __cplusplus
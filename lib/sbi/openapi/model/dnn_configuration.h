@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acs_info.h"
 #include "ambr.h"
 #include "frame_route_info.h"
@@ -86,6 +87,7 @@ OpenAPI_dnn_configuration_t *OpenAPI_dnn_configuration_create(
 void OpenAPI_dnn_configuration_free(OpenAPI_dnn_configuration_t *dnn_configuration);
 OpenAPI_dnn_configuration_t *OpenAPI_dnn_configuration_parseFromJSON(cJSON *dnn_configurationJSON);
 cJSON *OpenAPI_dnn_configuration_convertToJSON(OpenAPI_dnn_configuration_t *dnn_configuration);
+bool OpenAPI_dnn_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_configuration_t *dnn_configuration);
 OpenAPI_dnn_configuration_t *OpenAPI_dnn_configuration_copy(OpenAPI_dnn_configuration_t *dst, OpenAPI_dnn_configuration_t *src);
 
 #ifdef __cplusplus
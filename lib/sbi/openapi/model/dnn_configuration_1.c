@@ -333,6 +333,206 @@ end:
     return item;
 }
 
+bool OpenAPI_dnn_configuration_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_configuration_1_t *dnn_configuration_1)
+{
+    if (dnn_configuration_1 == NULL) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [DnnConfiguration_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [DnnConfiguration_1]");
+        return false;
+    }
+    if (OpenAPI_pdu_session_types_1_writeJSON(writer, "pduSessionTypes", dnn_configuration_1->pdu_session_types) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+
+    if (OpenAPI_ssc_modes_1_writeJSON(writer, "sscModes", dnn_configuration_1->ssc_modes) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ssc_modes]");
+        goto end;
+    }
+
+    if (dnn_configuration_1->is_iwk_eps_ind) {
+    if (OpenAPI_json_write_bool(writer, "iwkEpsInd", dnn_configuration_1->iwk_eps_ind) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [iwk_eps_ind]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->_5g_qos_profile) {
+    if (OpenAPI_subscribed_default_qos_1_writeJSON(writer, "5gQosProfile", dnn_configuration_1->_5g_qos_profile) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [_5g_qos_profile]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->session_ambr) {
+    if (OpenAPI_ambr_1_writeJSON(writer, "sessionAmbr", dnn_configuration_1->session_ambr) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->_3gpp_charging_characteristics) {
+    if (OpenAPI_json_write_string(writer, "3gppChargingCharacteristics", dnn_configuration_1->_3gpp_charging_characteristics) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [_3gpp_charging_characteristics]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->static_ip_address) {
+    if (OpenAPI_json_write_array_start(writer, "staticIpAddress") == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [static_ip_address]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *static_ip_address_node;
+    if (dnn_configuration_1->static_ip_address) {
+        OpenAPI_list_for_each(dnn_configuration_1->static_ip_address, static_ip_address_node) {
+            if (OpenAPI_ip_address_1_writeJSON(writer, NULL, static_ip_address_node->data) == false) {
+                ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [static_ip_address]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [static_ip_address]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->up_security) {
+    if (OpenAPI_up_security_1_writeJSON(writer, "upSecurity", dnn_configuration_1->up_security) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [up_security]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->pdu_session_continuity_ind) {
+    if (OpenAPI_json_write_string(writer, "pduSessionContinuityInd", OpenAPI_pdu_session_continuity_ind_ToString(dnn_configuration_1->pdu_session_continuity_ind)) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [pdu_session_continuity_ind]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->nidd_nef_id) {
+    if (OpenAPI_json_write_string(writer, "niddNefId", dnn_configuration_1->nidd_nef_id) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [nidd_nef_id]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->nidd_info) {
+    if (OpenAPI_nidd_information_1_writeJSON(writer, "niddInfo", dnn_configuration_1->nidd_info) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [nidd_info]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->is_redundant_session_allowed) {
+    if (OpenAPI_json_write_bool(writer, "redundantSessionAllowed", dnn_configuration_1->redundant_session_allowed) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [redundant_session_allowed]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->acs_info) {
+    if (OpenAPI_acs_info_1_writeJSON(writer, "acsInfo", dnn_configuration_1->acs_info) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [acs_info]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->ipv4_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4FrameRouteList") == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_frame_route_list_node;
+    if (dnn_configuration_1->ipv4_frame_route_list) {
+        OpenAPI_list_for_each(dnn_configuration_1->ipv4_frame_route_list, ipv4_frame_route_list_node) {
+            if (OpenAPI_frame_route_info_1_writeJSON(writer, NULL, ipv4_frame_route_list_node->data) == false) {
+                ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv4_frame_route_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->ipv6_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6FrameRouteList") == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_frame_route_list_node;
+    if (dnn_configuration_1->ipv6_frame_route_list) {
+        OpenAPI_list_for_each(dnn_configuration_1->ipv6_frame_route_list, ipv6_frame_route_list_node) {
+            if (OpenAPI_frame_route_info_1_writeJSON(writer, NULL, ipv6_frame_route_list_node->data) == false) {
+                ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv6_frame_route_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->is_atsss_allowed) {
+    if (OpenAPI_json_write_bool(writer, "atsssAllowed", dnn_configuration_1->atsss_allowed) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [atsss_allowed]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->is_secondary_auth) {
+    if (OpenAPI_json_write_bool(writer, "secondaryAuth", dnn_configuration_1->secondary_auth) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [secondary_auth]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->is_dn_aaa_ip_address_allocation) {
+    if (OpenAPI_json_write_bool(writer, "dnAaaIpAddressAllocation", dnn_configuration_1->dn_aaa_ip_address_allocation) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [dn_aaa_ip_address_allocation]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->dn_aaa_address) {
+    if (OpenAPI_ip_address_1_writeJSON(writer, "dnAaaAddress", dnn_configuration_1->dn_aaa_address) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [dn_aaa_address]");
+        goto end;
+    }
+    }
+
+    if (dnn_configuration_1->iptv_acc_ctrl_info) {
+    if (OpenAPI_json_write_string(writer, "iptvAccCtrlInfo", dnn_configuration_1->iptv_acc_ctrl_info) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [iptv_acc_ctrl_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_configuration_1_writeJSON() failed [DnnConfiguration_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_parseFromJSON(cJSON *dnn_configuration_1JSON)
 {
     OpenAPI_dnn_configuration_1_t *dnn_configuration_1_local_var = NULL;
@@ -602,7 +802,6 @@ end:
 OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_copy(OpenAPI_dnn_configuration_1_t *dst, OpenAPI_dnn_configuration_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnn_configuration_1_convertToJSON(src);
@@ -611,21 +810,6 @@ OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_copy(OpenAPI_dnn_conf
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnn_configuration_1_free(dst);
     dst = OpenAPI_dnn_configuration_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acs_info_1.h"
 #include "ambr_1.h"
 #include "frame_route_info_1.h"
@@ -86,6 +87,7 @@ OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_create(
 void OpenAPI_dnn_configuration_1_free(OpenAPI_dnn_configuration_1_t *dnn_configuration_1);
 OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_parseFromJSON(cJSON *dnn_configuration_1JSON);
 cJSON *OpenAPI_dnn_configuration_1_convertToJSON(OpenAPI_dnn_configuration_1_t *dnn_configuration_1);
+bool OpenAPI_dnn_configuration_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_configuration_1_t *dnn_configuration_1);
 OpenAPI_dnn_configuration_1_t *OpenAPI_dnn_configuration_1_copy(OpenAPI_dnn_configuration_1_t *dst, OpenAPI_dnn_configuration_1_t *src);
 
 #ifdef __cplusplus
@@ -133,6 +133,94 @@ end:
     return item;
 }
 
+bool OpenAPI_dnn_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_info_t *dnn_info)
+{
+    if (dnn_info == NULL) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [DnnInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [DnnInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", dnn_info->dnn) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (dnn_info->is_default_dnn_indicator) {
+    if (OpenAPI_json_write_bool(writer, "defaultDnnIndicator", dnn_info->default_dnn_indicator) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [default_dnn_indicator]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->is_lbo_roaming_allowed) {
+    if (OpenAPI_json_write_bool(writer, "lboRoamingAllowed", dnn_info->lbo_roaming_allowed) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [lbo_roaming_allowed]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->is_iwk_eps_ind) {
+    if (OpenAPI_json_write_bool(writer, "iwkEpsInd", dnn_info->iwk_eps_ind) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [iwk_eps_ind]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->is_dnn_barred) {
+    if (OpenAPI_json_write_bool(writer, "dnnBarred", dnn_info->dnn_barred) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [dnn_barred]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->is_invoke_nef_ind) {
+    if (OpenAPI_json_write_bool(writer, "invokeNefInd", dnn_info->invoke_nef_ind) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [invoke_nef_ind]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->smf_list) {
+    if (OpenAPI_json_write_array_start(writer, "smfList") == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [smf_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_list_node;
+    OpenAPI_list_for_each(dnn_info->smf_list, smf_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)smf_list_node->data) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [smf_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [smf_list]");
+        goto end;
+    }
+    }
+
+    if (dnn_info->is_same_smf_ind) {
+    if (OpenAPI_json_write_bool(writer, "sameSmfInd", dnn_info->same_smf_ind) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [same_smf_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_info_writeJSON() failed [DnnInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnn_info_t *OpenAPI_dnn_info_parseFromJSON(cJSON *dnn_infoJSON)
 {
     OpenAPI_dnn_info_t *dnn_info_local_var = NULL;
@@ -246,7 +334,6 @@ end:
 OpenAPI_dnn_info_t *OpenAPI_dnn_info_copy(OpenAPI_dnn_info_t *dst, OpenAPI_dnn_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnn_info_convertToJSON(src);
@@ -255,21 +342,6 @@ OpenAPI_dnn_info_t *OpenAPI_dnn_info_copy(OpenAPI_dnn_info_t *dst, OpenAPI_dnn_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnn_info_free(dst);
     dst = OpenAPI_dnn_info_parseFromJSON(item);
     cJSON_Delete(item);
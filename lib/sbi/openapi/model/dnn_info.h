@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +55,7 @@ OpenAPI_dnn_info_t *OpenAPI_dnn_info_create(
 void OpenAPI_dnn_info_free(OpenAPI_dnn_info_t *dnn_info);
 OpenAPI_dnn_info_t *OpenAPI_dnn_info_parseFromJSON(cJSON *dnn_infoJSON);
 cJSON *OpenAPI_dnn_info_convertToJSON(OpenAPI_dnn_info_t *dnn_info);
+bool OpenAPI_dnn_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_info_t *dnn_info);
 OpenAPI_dnn_info_t *OpenAPI_dnn_info_copy(OpenAPI_dnn_info_t *dst, OpenAPI_dnn_info_t *src);
 
 #ifdef __cplusplus
@@ -92,6 +92,76 @@ end:
     return item;
 }
 
+bool OpenAPI_dnn_route_selection_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_route_selection_descriptor_t *dnn_route_selection_descriptor)
+{
+    if (dnn_route_selection_descriptor == NULL) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [DnnRouteSelectionDescriptor]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [DnnRouteSelectionDescriptor]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", dnn_route_selection_descriptor->dnn) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (dnn_route_selection_descriptor->ssc_modes) {
+    if (OpenAPI_json_write_array_start(writer, "sscModes") == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [ssc_modes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ssc_modes_node;
+    OpenAPI_list_for_each(dnn_route_selection_descriptor->ssc_modes, ssc_modes_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_ssc_mode_ToString((intptr_t)ssc_modes_node->data)) == false) {
+            ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [ssc_modes]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [ssc_modes]");
+        goto end;
+    }
+    }
+
+    if (dnn_route_selection_descriptor->pdu_sess_types) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessTypes") == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [pdu_sess_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pdu_sess_types_node;
+    OpenAPI_list_for_each(dnn_route_selection_descriptor->pdu_sess_types, pdu_sess_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_pdu_session_type_ToString((intptr_t)pdu_sess_types_node->data)) == false) {
+            ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [pdu_sess_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [pdu_sess_types]");
+        goto end;
+    }
+    }
+
+    if (dnn_route_selection_descriptor->is_atsss_info) {
+    if (OpenAPI_json_write_bool(writer, "atsssInfo", dnn_route_selection_descriptor->atsss_info) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [atsss_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_route_selection_descriptor_writeJSON() failed [DnnRouteSelectionDescriptor]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnn_route_selection_descriptor_t *OpenAPI_dnn_route_selection_descriptor_parseFromJSON(cJSON *dnn_route_selection_descriptorJSON)
 {
     OpenAPI_dnn_route_selection_descriptor_t *dnn_route_selection_descriptor_local_var = NULL;
@@ -175,7 +245,6 @@ end:
 OpenAPI_dnn_route_selection_descriptor_t *OpenAPI_dnn_route_selection_descriptor_copy(OpenAPI_dnn_route_selection_descriptor_t *dst, OpenAPI_dnn_route_selection_descriptor_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnn_route_selection_descriptor_convertToJSON(src);
@@ -184,21 +253,6 @@ OpenAPI_dnn_route_selection_descriptor_t *OpenAPI_dnn_route_selection_descriptor
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnn_route_selection_descriptor_free(dst);
     dst = OpenAPI_dnn_route_selection_descriptor_parseFromJSON(item);
     cJSON_Delete(item);
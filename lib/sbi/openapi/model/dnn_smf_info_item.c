@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_dnn_smf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_smf_info_item_t *dnn_smf_info_item)
+{
+    if (dnn_smf_info_item == NULL) {
+        ogs_error("OpenAPI_dnn_smf_info_item_writeJSON() failed [DnnSmfInfoItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnn_smf_info_item_writeJSON() failed [DnnSmfInfoItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", dnn_smf_info_item->dnn) == false) {
+        ogs_error("OpenAPI_dnn_smf_info_item_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_smf_info_item_writeJSON() failed [DnnSmfInfoItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnn_smf_info_item_t *OpenAPI_dnn_smf_info_item_parseFromJSON(cJSON *dnn_smf_info_itemJSON)
 {
     OpenAPI_dnn_smf_info_item_t *dnn_smf_info_item_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_dnn_smf_info_item_t *OpenAPI_dnn_smf_info_item_copy(OpenAPI_dnn_smf_info_item_t *dst, OpenAPI_dnn_smf_info_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnn_smf_info_item_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_dnn_smf_info_item_t *OpenAPI_dnn_smf_info_item_copy(OpenAPI_dnn_smf_info
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnn_smf_info_item_free(dst);
     dst = OpenAPI_dnn_smf_info_item_parseFromJSON(item);
     cJSON_Delete(item);
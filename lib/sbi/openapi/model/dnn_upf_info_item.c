@@ -161,6 +161,129 @@ end:
     return item;
 }
 
+bool OpenAPI_dnn_upf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dnn_upf_info_item_t *dnn_upf_info_item)
+{
+    if (dnn_upf_info_item == NULL) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [DnnUpfInfoItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [DnnUpfInfoItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", dnn_upf_info_item->dnn) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (dnn_upf_info_item->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(dnn_upf_info_item->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (dnn_upf_info_item->pdu_session_types) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionTypes") == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pdu_session_types_node;
+    OpenAPI_list_for_each(dnn_upf_info_item->pdu_session_types, pdu_session_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_pdu_session_type_ToString((intptr_t)pdu_session_types_node->data)) == false) {
+            ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [pdu_session_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    }
+
+    if (dnn_upf_info_item->ipv4_address_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4AddressRanges") == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv4_address_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_address_ranges_node;
+    if (dnn_upf_info_item->ipv4_address_ranges) {
+        OpenAPI_list_for_each(dnn_upf_info_item->ipv4_address_ranges, ipv4_address_ranges_node) {
+            if (OpenAPI_ipv4_address_range_writeJSON(writer, NULL, ipv4_address_ranges_node->data) == false) {
+                ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv4_address_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv4_address_ranges]");
+        goto end;
+    }
+    }
+
+    if (dnn_upf_info_item->ipv6_prefix_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6PrefixRanges") == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_prefix_ranges_node;
+    if (dnn_upf_info_item->ipv6_prefix_ranges) {
+        OpenAPI_list_for_each(dnn_upf_info_item->ipv6_prefix_ranges, ipv6_prefix_ranges_node) {
+            if (OpenAPI_ipv6_prefix_range_writeJSON(writer, NULL, ipv6_prefix_ranges_node->data) == false) {
+                ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv6_prefix_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+    }
+
+    if (dnn_upf_info_item->dnai_nw_instance_list) {
+    if (OpenAPI_json_write_object_start(writer, "dnaiNwInstanceList") == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnai_nw_instance_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *dnai_nw_instance_list_node;
+    if (dnn_upf_info_item->dnai_nw_instance_list) {
+        OpenAPI_list_for_each(dnn_upf_info_item->dnai_nw_instance_list, dnai_nw_instance_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)dnai_nw_instance_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [dnai_nw_instance_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dnn_upf_info_item_writeJSON() failed [DnnUpfInfoItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dnn_upf_info_item_t *OpenAPI_dnn_upf_info_item_parseFromJSON(cJSON *dnn_upf_info_itemJSON)
 {
     OpenAPI_dnn_upf_info_item_t *dnn_upf_info_item_local_var = NULL;
@@ -309,7 +432,6 @@ end:
 OpenAPI_dnn_upf_info_item_t *OpenAPI_dnn_upf_info_item_copy(OpenAPI_dnn_upf_info_item_t *dst, OpenAPI_dnn_upf_info_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dnn_upf_info_item_convertToJSON(src);
@@ -318,21 +440,6 @@ OpenAPI_dnn_upf_info_item_t *OpenAPI_dnn_upf_info_item_copy(OpenAPI_dnn_upf_info
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dnn_upf_info_item_free(dst);
     dst = OpenAPI_dnn_upf_info_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_domain_name_protocol_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_domain_name_protocol_t *domain_name_protocol)
+{
+    if (domain_name_protocol == NULL) {
+        ogs_error("OpenAPI_domain_name_protocol_writeJSON() failed [DomainNameProtocol]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_domain_name_protocol_writeJSON() failed [DomainNameProtocol]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_domain_name_protocol_writeJSON() failed [DomainNameProtocol]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_domain_name_protocol_t *OpenAPI_domain_name_protocol_parseFromJSON(cJSON *domain_name_protocolJSON)
 {
     OpenAPI_domain_name_protocol_t *domain_name_protocol_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_domain_name_protocol_t *OpenAPI_domain_name_protocol_copy(OpenAPI_domain_name_protocol_t *dst, OpenAPI_domain_name_protocol_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_domain_name_protocol_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_domain_name_protocol_t *OpenAPI_domain_name_protocol_copy(OpenAPI_domain
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_domain_name_protocol_free(dst);
     dst = OpenAPI_domain_name_protocol_parseFromJSON(item);
     cJSON_Delete(item);
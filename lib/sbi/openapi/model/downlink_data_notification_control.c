@@ -73,6 +73,64 @@ end:
     return item;
 }
 
+bool OpenAPI_downlink_data_notification_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_downlink_data_notification_control_t *downlink_data_notification_control)
+{
+    if (downlink_data_notification_control == NULL) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [DownlinkDataNotificationControl]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [DownlinkDataNotificationControl]");
+        return false;
+    }
+    if (downlink_data_notification_control->notif_ctrl_inds) {
+    if (OpenAPI_json_write_array_start(writer, "notifCtrlInds") == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [notif_ctrl_inds]");
+        goto end;
+    }
+    OpenAPI_lnode_t *notif_ctrl_inds_node;
+    OpenAPI_list_for_each(downlink_data_notification_control->notif_ctrl_inds, notif_ctrl_inds_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_notification_control_indication_ToString((intptr_t)notif_ctrl_inds_node->data)) == false) {
+            ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [notif_ctrl_inds]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [notif_ctrl_inds]");
+        goto end;
+    }
+    }
+
+    if (downlink_data_notification_control->types_of_notif) {
+    if (OpenAPI_json_write_array_start(writer, "typesOfNotif") == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [types_of_notif]");
+        goto end;
+    }
+    OpenAPI_lnode_t *types_of_notif_node;
+    OpenAPI_list_for_each(downlink_data_notification_control->types_of_notif, types_of_notif_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_dl_data_delivery_status_ToString((intptr_t)types_of_notif_node->data)) == false) {
+            ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [types_of_notif]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [types_of_notif]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_downlink_data_notification_control_writeJSON() failed [DownlinkDataNotificationControl]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification_control_parseFromJSON(cJSON *downlink_data_notification_controlJSON)
 {
     OpenAPI_downlink_data_notification_control_t *downlink_data_notification_control_local_var = NULL;
@@ -133,7 +191,6 @@ end:
 OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification_control_copy(OpenAPI_downlink_data_notification_control_t *dst, OpenAPI_downlink_data_notification_control_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_downlink_data_notification_control_convertToJSON(src);
@@ -142,21 +199,6 @@ OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_downlink_data_notification_control_free(dst);
     dst = OpenAPI_downlink_data_notification_control_parseFromJSON(item);
     cJSON_Delete(item);
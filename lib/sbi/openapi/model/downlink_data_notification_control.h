@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dl_data_delivery_status.h"
 #include "notification_control_indication.h"
 
@@ -32,6 +33,7 @@ OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification
 void OpenAPI_downlink_data_notification_control_free(OpenAPI_downlink_data_notification_control_t *downlink_data_notification_control);
 OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification_control_parseFromJSON(cJSON *downlink_data_notification_controlJSON);
 cJSON *OpenAPI_downlink_data_notification_control_convertToJSON(OpenAPI_downlink_data_notification_control_t *downlink_data_notification_control);
+bool OpenAPI_downlink_data_notification_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_downlink_data_notification_control_t *downlink_data_notification_control);
 OpenAPI_downlink_data_notification_control_t *OpenAPI_downlink_data_notification_control_copy(OpenAPI_downlink_data_notification_control_t *dst, OpenAPI_downlink_data_notification_control_t *src);
 
 #ifdef __cplusplus
@@ -132,6 +132,90 @@ end:
     return item;
 }
 
+bool OpenAPI_dynamic5_qi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dynamic5_qi_t *dynamic5_qi)
+{
+    if (dynamic5_qi == NULL) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [Dynamic5Qi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [Dynamic5Qi]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceType", OpenAPI_qos_resource_type_ToString(dynamic5_qi->resource_type)) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [resource_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "priorityLevel", dynamic5_qi->priority_level) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [priority_level]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "packetDelayBudget", dynamic5_qi->packet_delay_budget) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [packet_delay_budget]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "packetErrRate", dynamic5_qi->packet_err_rate) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [packet_err_rate]");
+        goto end;
+    }
+
+    if (dynamic5_qi->is_aver_window) {
+    if (OpenAPI_json_write_number(writer, "averWindow", dynamic5_qi->aver_window) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [aver_window]");
+        goto end;
+    }
+    }
+
+    if (dynamic5_qi->is_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "maxDataBurstVol", dynamic5_qi->max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (dynamic5_qi->is_ext_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "extMaxDataBurstVol", dynamic5_qi->ext_max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [ext_max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (dynamic5_qi->is_ext_packet_del_budget) {
+    if (OpenAPI_json_write_number(writer, "extPacketDelBudget", dynamic5_qi->ext_packet_del_budget) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [ext_packet_del_budget]");
+        goto end;
+    }
+    }
+
+    if (dynamic5_qi->is_cn_packet_delay_budget_dl) {
+    if (OpenAPI_json_write_number(writer, "cnPacketDelayBudgetDl", dynamic5_qi->cn_packet_delay_budget_dl) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [cn_packet_delay_budget_dl]");
+        goto end;
+    }
+    }
+
+    if (dynamic5_qi->is_cn_packet_delay_budget_ul) {
+    if (OpenAPI_json_write_number(writer, "cnPacketDelayBudgetUl", dynamic5_qi->cn_packet_delay_budget_ul) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [cn_packet_delay_budget_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_dynamic5_qi_writeJSON() failed [Dynamic5Qi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_parseFromJSON(cJSON *dynamic5_qiJSON)
 {
     OpenAPI_dynamic5_qi_t *dynamic5_qi_local_var = NULL;
@@ -264,7 +348,6 @@ end:
 OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_copy(OpenAPI_dynamic5_qi_t *dst, OpenAPI_dynamic5_qi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_dynamic5_qi_convertToJSON(src);
@@ -273,21 +356,6 @@ OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_copy(OpenAPI_dynamic5_qi_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_dynamic5_qi_free(dst);
     dst = OpenAPI_dynamic5_qi_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "qos_resource_type.h"
 
 #ifdef __cplusplus
@@ -59,6 +60,7 @@ OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_create(
 void OpenAPI_dynamic5_qi_free(OpenAPI_dynamic5_qi_t *dynamic5_qi);
 OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_parseFromJSON(cJSON *dynamic5_qiJSON);
 cJSON *OpenAPI_dynamic5_qi_convertToJSON(OpenAPI_dynamic5_qi_t *dynamic5_qi);
+bool OpenAPI_dynamic5_qi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_dynamic5_qi_t *dynamic5_qi);
 OpenAPI_dynamic5_qi_t *OpenAPI_dynamic5_qi_copy(OpenAPI_dynamic5_qi_t *dst, OpenAPI_dynamic5_qi_t *src);
 
 #ifdef __cplusplus
@@ -116,6 +116,84 @@ end:
     return item;
 }
 
+bool OpenAPI_eap_session_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eap_session_t *eap_session)
+{
+    if (eap_session == NULL) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [EapSession]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [EapSession]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "eapPayload", eap_session->eap_payload) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [eap_payload]");
+        goto end;
+    }
+
+    if (eap_session->k_seaf) {
+    if (OpenAPI_json_write_string(writer, "kSeaf", eap_session->k_seaf) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [k_seaf]");
+        goto end;
+    }
+    }
+
+    if (eap_session->_links) {
+    if (OpenAPI_json_write_object_start(writer, "_links") == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [_links]");
+        goto end;
+    }
+    OpenAPI_lnode_t *_links_node;
+    if (eap_session->_links) {
+        OpenAPI_list_for_each(eap_session->_links, _links_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)_links_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_links_value_schema_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_eap_session_writeJSON() failed [_links]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [_links]");
+        goto end;
+    }
+    }
+
+    if (eap_session->auth_result) {
+    if (OpenAPI_json_write_string(writer, "authResult", OpenAPI_auth_result_ToString(eap_session->auth_result)) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [auth_result]");
+        goto end;
+    }
+    }
+
+    if (eap_session->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", eap_session->supi) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (eap_session->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", eap_session->supported_features) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eap_session_writeJSON() failed [EapSession]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eap_session_t *OpenAPI_eap_session_parseFromJSON(cJSON *eap_sessionJSON)
 {
     OpenAPI_eap_session_t *eap_session_local_var = NULL;
@@ -211,7 +289,6 @@ end:
 OpenAPI_eap_session_t *OpenAPI_eap_session_copy(OpenAPI_eap_session_t *dst, OpenAPI_eap_session_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eap_session_convertToJSON(src);
@@ -220,21 +297,6 @@ OpenAPI_eap_session_t *OpenAPI_eap_session_copy(OpenAPI_eap_session_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eap_session_free(dst);
     dst = OpenAPI_eap_session_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_result.h"
 #include "links_value_schema.h"
 
@@ -40,6 +41,7 @@ OpenAPI_eap_session_t *OpenAPI_eap_session_create(
 void OpenAPI_eap_session_free(OpenAPI_eap_session_t *eap_session);
 OpenAPI_eap_session_t *OpenAPI_eap_session_parseFromJSON(cJSON *eap_sessionJSON);
 cJSON *OpenAPI_eap_session_convertToJSON(OpenAPI_eap_session_t *eap_session);
+bool OpenAPI_eap_session_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eap_session_t *eap_session);
 OpenAPI_eap_session_t *OpenAPI_eap_session_copy(OpenAPI_eap_session_t *dst, OpenAPI_eap_session_t *src);
 
 #ifdef __cplusplus
@@ -58,6 +58,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ebi_arp_mapping_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ebi_arp_mapping_t *ebi_arp_mapping)
+{
+    if (ebi_arp_mapping == NULL) {
+        ogs_error("OpenAPI_ebi_arp_mapping_writeJSON() failed [EbiArpMapping]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ebi_arp_mapping_writeJSON() failed [EbiArpMapping]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "epsBearerId", ebi_arp_mapping->eps_bearer_id) == false) {
+        ogs_error("OpenAPI_ebi_arp_mapping_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+
+    if (OpenAPI_arp_writeJSON(writer, "arp", ebi_arp_mapping->arp) == false) {
+        ogs_error("OpenAPI_ebi_arp_mapping_writeJSON() failed [arp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ebi_arp_mapping_writeJSON() failed [EbiArpMapping]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_parseFromJSON(cJSON *ebi_arp_mappingJSON)
 {
     OpenAPI_ebi_arp_mapping_t *ebi_arp_mapping_local_var = NULL;
@@ -95,7 +127,6 @@ end:
 OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_copy(OpenAPI_ebi_arp_mapping_t *dst, OpenAPI_ebi_arp_mapping_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ebi_arp_mapping_convertToJSON(src);
@@ -104,21 +135,6 @@ OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_copy(OpenAPI_ebi_arp_mapping_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ebi_arp_mapping_free(dst);
     dst = OpenAPI_ebi_arp_mapping_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_create(
 void OpenAPI_ebi_arp_mapping_free(OpenAPI_ebi_arp_mapping_t *ebi_arp_mapping);
 OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_parseFromJSON(cJSON *ebi_arp_mappingJSON);
 cJSON *OpenAPI_ebi_arp_mapping_convertToJSON(OpenAPI_ebi_arp_mapping_t *ebi_arp_mapping);
+bool OpenAPI_ebi_arp_mapping_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ebi_arp_mapping_t *ebi_arp_mapping);
 OpenAPI_ebi_arp_mapping_t *OpenAPI_ebi_arp_mapping_copy(OpenAPI_ebi_arp_mapping_t *dst, OpenAPI_ebi_arp_mapping_t *src);
 
 #ifdef __cplusplus
@@ -88,6 +88,66 @@ end:
     return item;
 }
 
+bool OpenAPI_ec_restriction_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ec_restriction_t *ec_restriction)
+{
+    if (ec_restriction == NULL) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [EcRestriction]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [EcRestriction]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "afInstanceId", ec_restriction->af_instance_id) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", ec_restriction->reference_id) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (ec_restriction->plmn_ec_infos) {
+    if (OpenAPI_json_write_array_start(writer, "plmnEcInfos") == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [plmn_ec_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *plmn_ec_infos_node;
+    if (ec_restriction->plmn_ec_infos) {
+        OpenAPI_list_for_each(ec_restriction->plmn_ec_infos, plmn_ec_infos_node) {
+            if (OpenAPI_plmn_ec_info_writeJSON(writer, NULL, plmn_ec_infos_node->data) == false) {
+                ogs_error("OpenAPI_ec_restriction_writeJSON() failed [plmn_ec_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [plmn_ec_infos]");
+        goto end;
+    }
+    }
+
+    if (ec_restriction->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", ec_restriction->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ec_restriction_writeJSON() failed [EcRestriction]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_parseFromJSON(cJSON *ec_restrictionJSON)
 {
     OpenAPI_ec_restriction_t *ec_restriction_local_var = NULL;
@@ -167,7 +227,6 @@ end:
 OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_copy(OpenAPI_ec_restriction_t *dst, OpenAPI_ec_restriction_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ec_restriction_convertToJSON(src);
@@ -176,21 +235,6 @@ OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_copy(OpenAPI_ec_restriction_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ec_restriction_free(dst);
     dst = OpenAPI_ec_restriction_parseFromJSON(item);
     cJSON_Delete(item);
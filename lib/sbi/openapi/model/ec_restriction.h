@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_ec_info.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_create(
 void OpenAPI_ec_restriction_free(OpenAPI_ec_restriction_t *ec_restriction);
 OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_parseFromJSON(cJSON *ec_restrictionJSON);
 cJSON *OpenAPI_ec_restriction_convertToJSON(OpenAPI_ec_restriction_t *ec_restriction);
+bool OpenAPI_ec_restriction_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ec_restriction_t *ec_restriction);
 OpenAPI_ec_restriction_t *OpenAPI_ec_restriction_copy(OpenAPI_ec_restriction_t *dst, OpenAPI_ec_restriction_t *src);
 
 #ifdef __cplusplus
@@ -55,6 +55,40 @@ end:
     return item;
 }
 
+bool OpenAPI_ec_restriction_data_wb_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ec_restriction_data_wb_t *ec_restriction_data_wb)
+{
+    if (ec_restriction_data_wb == NULL) {
+        ogs_error("OpenAPI_ec_restriction_data_wb_writeJSON() failed [EcRestrictionDataWb]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ec_restriction_data_wb_writeJSON() failed [EcRestrictionDataWb]");
+        return false;
+    }
+    if (ec_restriction_data_wb->is_ec_mode_a_restricted) {
+    if (OpenAPI_json_write_bool(writer, "ecModeARestricted", ec_restriction_data_wb->ec_mode_a_restricted) == false) {
+        ogs_error("OpenAPI_ec_restriction_data_wb_writeJSON() failed [ec_mode_a_restricted]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_bool(writer, "ecModeBRestricted", ec_restriction_data_wb->ec_mode_b_restricted) == false) {
+        ogs_error("OpenAPI_ec_restriction_data_wb_writeJSON() failed [ec_mode_b_restricted]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ec_restriction_data_wb_writeJSON() failed [EcRestrictionDataWb]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ec_restriction_data_wb_t *OpenAPI_ec_restriction_data_wb_parseFromJSON(cJSON *ec_restriction_data_wbJSON)
 {
     OpenAPI_ec_restriction_data_wb_t *ec_restriction_data_wb_local_var = NULL;
@@ -93,7 +127,6 @@ end:
 OpenAPI_ec_restriction_data_wb_t *OpenAPI_ec_restriction_data_wb_copy(OpenAPI_ec_restriction_data_wb_t *dst, OpenAPI_ec_restriction_data_wb_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ec_restriction_data_wb_convertToJSON(src);
@@ -102,21 +135,6 @@ OpenAPI_ec_restriction_data_wb_t *OpenAPI_ec_restriction_data_wb_copy(OpenAPI_ec
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ec_restriction_data_wb_free(dst);
     dst = OpenAPI_ec_restriction_data_wb_parseFromJSON(item);
     cJSON_Delete(item);
@@ -69,6 +69,45 @@ end:
     return item;
 }
 
+bool OpenAPI_ecgi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ecgi_t *ecgi)
+{
+    if (ecgi == NULL) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [Ecgi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [Ecgi]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", ecgi->plmn_id) == false) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "eutraCellId", ecgi->eutra_cell_id) == false) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [eutra_cell_id]");
+        goto end;
+    }
+
+    if (ecgi->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", ecgi->nid) == false) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ecgi_writeJSON() failed [Ecgi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ecgi_t *OpenAPI_ecgi_parseFromJSON(cJSON *ecgiJSON)
 {
     OpenAPI_ecgi_t *ecgi_local_var = NULL;
@@ -115,7 +154,6 @@ end:
 OpenAPI_ecgi_t *OpenAPI_ecgi_copy(OpenAPI_ecgi_t *dst, OpenAPI_ecgi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ecgi_convertToJSON(src);
@@ -124,21 +162,6 @@ OpenAPI_ecgi_t *OpenAPI_ecgi_copy(OpenAPI_ecgi_t *dst, OpenAPI_ecgi_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ecgi_free(dst);
     dst = OpenAPI_ecgi_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ecgi_t *OpenAPI_ecgi_create(
 void OpenAPI_ecgi_free(OpenAPI_ecgi_t *ecgi);
 OpenAPI_ecgi_t *OpenAPI_ecgi_parseFromJSON(cJSON *ecgiJSON);
 cJSON *OpenAPI_ecgi_convertToJSON(OpenAPI_ecgi_t *ecgi);
+bool OpenAPI_ecgi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ecgi_t *ecgi);
 OpenAPI_ecgi_t *OpenAPI_ecgi_copy(OpenAPI_ecgi_t *dst, OpenAPI_ecgi_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ecgi_1_t *OpenAPI_ecgi_1_create(
 void OpenAPI_ecgi_1_free(OpenAPI_ecgi_1_t *ecgi_1);
 OpenAPI_ecgi_1_t *OpenAPI_ecgi_1_parseFromJSON(cJSON *ecgi_1JSON);
 cJSON *OpenAPI_ecgi_1_convertToJSON(OpenAPI_ecgi_1_t *ecgi_1);
+bool OpenAPI_ecgi_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ecgi_1_t *ecgi_1);
 OpenAPI_ecgi_1_t *OpenAPI_ecgi_1_copy(OpenAPI_ecgi_1_t *dst, OpenAPI_ecgi_1_t *src);
 
 #ifdef __cplusplus
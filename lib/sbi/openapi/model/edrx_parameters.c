@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_edrx_parameters_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_edrx_parameters_t *edrx_parameters)
+{
+    if (edrx_parameters == NULL) {
+        ogs_error("OpenAPI_edrx_parameters_writeJSON() failed [EdrxParameters]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_edrx_parameters_writeJSON() failed [EdrxParameters]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(edrx_parameters->rat_type)) == false) {
+        ogs_error("OpenAPI_edrx_parameters_writeJSON() failed [rat_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "edrxValue", edrx_parameters->edrx_value) == false) {
+        ogs_error("OpenAPI_edrx_parameters_writeJSON() failed [edrx_value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_edrx_parameters_writeJSON() failed [EdrxParameters]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_parseFromJSON(cJSON *edrx_parametersJSON)
 {
     OpenAPI_edrx_parameters_t *edrx_parameters_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_copy(OpenAPI_edrx_parameters_t *dst, OpenAPI_edrx_parameters_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_edrx_parameters_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_copy(OpenAPI_edrx_parameters_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_edrx_parameters_free(dst);
     dst = OpenAPI_edrx_parameters_parseFromJSON(item);
     cJSON_Delete(item);
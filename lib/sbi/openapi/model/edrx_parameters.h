@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "rat_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_create(
 void OpenAPI_edrx_parameters_free(OpenAPI_edrx_parameters_t *edrx_parameters);
 OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_parseFromJSON(cJSON *edrx_parametersJSON);
 cJSON *OpenAPI_edrx_parameters_convertToJSON(OpenAPI_edrx_parameters_t *edrx_parameters);
+bool OpenAPI_edrx_parameters_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_edrx_parameters_t *edrx_parameters);
 OpenAPI_edrx_parameters_t *OpenAPI_edrx_parameters_copy(OpenAPI_edrx_parameters_t *dst, OpenAPI_edrx_parameters_t *src);
 
 #ifdef __cplusplus
@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_edrx_parameters_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_edrx_parameters_1_t *edrx_parameters_1)
+{
+    if (edrx_parameters_1 == NULL) {
+        ogs_error("OpenAPI_edrx_parameters_1_writeJSON() failed [EdrxParameters_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_edrx_parameters_1_writeJSON() failed [EdrxParameters_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(edrx_parameters_1->rat_type)) == false) {
+        ogs_error("OpenAPI_edrx_parameters_1_writeJSON() failed [rat_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "edrxValue", edrx_parameters_1->edrx_value) == false) {
+        ogs_error("OpenAPI_edrx_parameters_1_writeJSON() failed [edrx_value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_edrx_parameters_1_writeJSON() failed [EdrxParameters_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_parseFromJSON(cJSON *edrx_parameters_1JSON)
 {
     OpenAPI_edrx_parameters_1_t *edrx_parameters_1_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_copy(OpenAPI_edrx_parameters_1_t *dst, OpenAPI_edrx_parameters_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_edrx_parameters_1_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_copy(OpenAPI_edrx_paramet
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_edrx_parameters_1_free(dst);
     dst = OpenAPI_edrx_parameters_1_parseFromJSON(item);
     cJSON_Delete(item);
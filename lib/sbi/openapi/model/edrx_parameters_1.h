@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "rat_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_create(
 void OpenAPI_edrx_parameters_1_free(OpenAPI_edrx_parameters_1_t *edrx_parameters_1);
 OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_parseFromJSON(cJSON *edrx_parameters_1JSON);
 cJSON *OpenAPI_edrx_parameters_1_convertToJSON(OpenAPI_edrx_parameters_1_t *edrx_parameters_1);
+bool OpenAPI_edrx_parameters_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_edrx_parameters_1_t *edrx_parameters_1);
 OpenAPI_edrx_parameters_1_t *OpenAPI_edrx_parameters_1_copy(OpenAPI_edrx_parameters_1_t *dst, OpenAPI_edrx_parameters_1_t *src);
 
 #ifdef __cplusplus
@@ -97,6 +97,73 @@ end:
     return item;
 }
 
+bool OpenAPI_ee_group_profile_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ee_group_profile_data_t *ee_group_profile_data)
+{
+    if (ee_group_profile_data == NULL) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [EeGroupProfileData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [EeGroupProfileData]");
+        return false;
+    }
+    if (ee_group_profile_data->restricted_event_types) {
+    if (OpenAPI_json_write_array_start(writer, "restrictedEventTypes") == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [restricted_event_types]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *restricted_event_types_node;
+    if (ee_group_profile_data->restricted_event_types) {
+        OpenAPI_list_for_each(ee_group_profile_data->restricted_event_types, restricted_event_types_node) {
+            if (OpenAPI_event_type_writeJSON(writer, NULL, restricted_event_types_node->data) == false) {
+                ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [restricted_event_types]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [restricted_event_types]");
+        goto end;
+    }
+    }
+
+    if (ee_group_profile_data->allowed_mtc_provider) {
+    if (OpenAPI_json_write_object_start(writer, "allowedMtcProvider") == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [allowed_mtc_provider]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_mtc_provider_node;
+    if (ee_group_profile_data->allowed_mtc_provider) {
+        OpenAPI_list_for_each(ee_group_profile_data->allowed_mtc_provider, allowed_mtc_provider_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)allowed_mtc_provider_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [allowed_mtc_provider]");
+        goto end;
+    }
+    }
+
+    if (ee_group_profile_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ee_group_profile_data->supported_features) == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ee_group_profile_data_writeJSON() failed [EeGroupProfileData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ee_group_profile_data_t *OpenAPI_ee_group_profile_data_parseFromJSON(cJSON *ee_group_profile_dataJSON)
 {
     OpenAPI_ee_group_profile_data_t *ee_group_profile_data_local_var = NULL;
@@ -169,7 +236,6 @@ end:
 OpenAPI_ee_group_profile_data_t *OpenAPI_ee_group_profile_data_copy(OpenAPI_ee_group_profile_data_t *dst, OpenAPI_ee_group_profile_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ee_group_profile_data_convertToJSON(src);
@@ -178,21 +244,6 @@ OpenAPI_ee_group_profile_data_t *OpenAPI_ee_group_profile_data_copy(OpenAPI_ee_g
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ee_group_profile_data_free(dst);
     dst = OpenAPI_ee_group_profile_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_type.h"
 #include "mtc_provider.h"
 
@@ -34,6 +35,7 @@ OpenAPI_ee_profile_data_t *OpenAPI_ee_profile_data_create(
 void OpenAPI_ee_profile_data_free(OpenAPI_ee_profile_data_t *ee_profile_data);
 OpenAPI_ee_profile_data_t *OpenAPI_ee_profile_data_parseFromJSON(cJSON *ee_profile_dataJSON);
 cJSON *OpenAPI_ee_profile_data_convertToJSON(OpenAPI_ee_profile_data_t *ee_profile_data);
+bool OpenAPI_ee_profile_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ee_profile_data_t *ee_profile_data);
 OpenAPI_ee_profile_data_t *OpenAPI_ee_profile_data_copy(OpenAPI_ee_profile_data_t *dst, OpenAPI_ee_profile_data_t *src);
 
 #ifdef __cplusplus
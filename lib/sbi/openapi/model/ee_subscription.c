@@ -168,6 +168,110 @@ end:
     return item;
 }
 
+bool OpenAPI_ee_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ee_subscription_t *ee_subscription)
+{
+    if (ee_subscription == NULL) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [EeSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [EeSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "callbackReference", ee_subscription->callback_reference) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [callback_reference]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, "monitoringConfigurations") == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [monitoring_configurations]");
+        goto end;
+    }
+    OpenAPI_lnode_t *monitoring_configurations_node;
+    if (ee_subscription->monitoring_configurations) {
+        OpenAPI_list_for_each(ee_subscription->monitoring_configurations, monitoring_configurations_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)monitoring_configurations_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_monitoring_configuration_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ee_subscription_writeJSON() failed [monitoring_configurations]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [monitoring_configurations]");
+        goto end;
+    }
+
+    if (ee_subscription->reporting_options) {
+    if (OpenAPI_reporting_options_writeJSON(writer, "reportingOptions", ee_subscription->reporting_options) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [reporting_options]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ee_subscription->supported_features) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->subscription_id) {
+    if (OpenAPI_json_write_string(writer, "subscriptionId", ee_subscription->subscription_id) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->context_info) {
+    if (OpenAPI_context_info_writeJSON(writer, "contextInfo", ee_subscription->context_info) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [context_info]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->is_epc_applied_ind) {
+    if (OpenAPI_json_write_bool(writer, "epcAppliedInd", ee_subscription->epc_applied_ind) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [epc_applied_ind]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->scef_diam_host) {
+    if (OpenAPI_json_write_string(writer, "scefDiamHost", ee_subscription->scef_diam_host) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [scef_diam_host]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->scef_diam_realm) {
+    if (OpenAPI_json_write_string(writer, "scefDiamRealm", ee_subscription->scef_diam_realm) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [scef_diam_realm]");
+        goto end;
+    }
+    }
+
+    if (ee_subscription->notify_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "notifyCorrelationId", ee_subscription->notify_correlation_id) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [notify_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ee_subscription_writeJSON() failed [EeSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_parseFromJSON(cJSON *ee_subscriptionJSON)
 {
     OpenAPI_ee_subscription_t *ee_subscription_local_var = NULL;
@@ -300,7 +404,6 @@ end:
 OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_copy(OpenAPI_ee_subscription_t *dst, OpenAPI_ee_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ee_subscription_convertToJSON(src);
@@ -309,21 +412,6 @@ OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_copy(OpenAPI_ee_subscription_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ee_subscription_free(dst);
     dst = OpenAPI_ee_subscription_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "context_info.h"
 #include "monitoring_configuration.h"
 #include "reporting_options.h"
@@ -51,6 +52,7 @@ OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_create(
 void OpenAPI_ee_subscription_free(OpenAPI_ee_subscription_t *ee_subscription);
 OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_parseFromJSON(cJSON *ee_subscriptionJSON);
 cJSON *OpenAPI_ee_subscription_convertToJSON(OpenAPI_ee_subscription_t *ee_subscription);
+bool OpenAPI_ee_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ee_subscription_t *ee_subscription);
 OpenAPI_ee_subscription_t *OpenAPI_ee_subscription_copy(OpenAPI_ee_subscription_t *dst, OpenAPI_ee_subscription_t *src);
 
 #ifdef __cplusplus
@@ -100,6 +100,63 @@ end:
     return item;
 }
 
+bool OpenAPI_ellipsoid_arc_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ellipsoid_arc_t *ellipsoid_arc)
+{
+    if (ellipsoid_arc == NULL) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [EllipsoidArc]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [EllipsoidArc]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", ellipsoid_arc->shape) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", ellipsoid_arc->point) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "innerRadius", ellipsoid_arc->inner_radius) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [inner_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyRadius", ellipsoid_arc->uncertainty_radius) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [uncertainty_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "offsetAngle", ellipsoid_arc->offset_angle) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [offset_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "includedAngle", ellipsoid_arc->included_angle) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [included_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", ellipsoid_arc->confidence) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_writeJSON() failed [EllipsoidArc]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ellipsoid_arc_t *OpenAPI_ellipsoid_arc_parseFromJSON(cJSON *ellipsoid_arcJSON)
 {
     OpenAPI_ellipsoid_arc_t *ellipsoid_arc_local_var = NULL;
@@ -199,7 +256,6 @@ end:
 OpenAPI_ellipsoid_arc_t *OpenAPI_ellipsoid_arc_copy(OpenAPI_ellipsoid_arc_t *dst, OpenAPI_ellipsoid_arc_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ellipsoid_arc_convertToJSON(src);
@@ -208,21 +264,6 @@ OpenAPI_ellipsoid_arc_t *OpenAPI_ellipsoid_arc_copy(OpenAPI_ellipsoid_arc_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ellipsoid_arc_free(dst);
     dst = OpenAPI_ellipsoid_arc_parseFromJSON(item);
     cJSON_Delete(item);
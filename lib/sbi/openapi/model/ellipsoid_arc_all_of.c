@@ -86,6 +86,58 @@ end:
     return item;
 }
 
+bool OpenAPI_ellipsoid_arc_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ellipsoid_arc_all_of_t *ellipsoid_arc_all_of)
+{
+    if (ellipsoid_arc_all_of == NULL) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [EllipsoidArc_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [EllipsoidArc_allOf]");
+        return false;
+    }
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", ellipsoid_arc_all_of->point) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "innerRadius", ellipsoid_arc_all_of->inner_radius) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [inner_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyRadius", ellipsoid_arc_all_of->uncertainty_radius) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [uncertainty_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "offsetAngle", ellipsoid_arc_all_of->offset_angle) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [offset_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "includedAngle", ellipsoid_arc_all_of->included_angle) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [included_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", ellipsoid_arc_all_of->confidence) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ellipsoid_arc_all_of_writeJSON() failed [EllipsoidArc_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ellipsoid_arc_all_of_t *OpenAPI_ellipsoid_arc_all_of_parseFromJSON(cJSON *ellipsoid_arc_all_ofJSON)
 {
     OpenAPI_ellipsoid_arc_all_of_t *ellipsoid_arc_all_of_local_var = NULL;
@@ -175,7 +227,6 @@ end:
 OpenAPI_ellipsoid_arc_all_of_t *OpenAPI_ellipsoid_arc_all_of_copy(OpenAPI_ellipsoid_arc_all_of_t *dst, OpenAPI_ellipsoid_arc_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ellipsoid_arc_all_of_convertToJSON(src);
@@ -184,21 +235,6 @@ OpenAPI_ellipsoid_arc_all_of_t *OpenAPI_ellipsoid_arc_all_of_copy(OpenAPI_ellips
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ellipsoid_arc_all_of_free(dst);
     dst = OpenAPI_ellipsoid_arc_all_of_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_address.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_emergency_info_t *OpenAPI_emergency_info_create(
 void OpenAPI_emergency_info_free(OpenAPI_emergency_info_t *emergency_info);
 OpenAPI_emergency_info_t *OpenAPI_emergency_info_parseFromJSON(cJSON *emergency_infoJSON);
 cJSON *OpenAPI_emergency_info_convertToJSON(OpenAPI_emergency_info_t *emergency_info);
+bool OpenAPI_emergency_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_emergency_info_t *emergency_info);
 OpenAPI_emergency_info_t *OpenAPI_emergency_info_copy(OpenAPI_emergency_info_t *dst, OpenAPI_emergency_info_t *src);
 
 #ifdef __cplusplus
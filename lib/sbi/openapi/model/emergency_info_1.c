@@ -84,6 +84,56 @@ end:
     return item;
 }
 
+bool OpenAPI_emergency_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_emergency_info_1_t *emergency_info_1)
+{
+    if (emergency_info_1 == NULL) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [EmergencyInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [EmergencyInfo_1]");
+        return false;
+    }
+    if (emergency_info_1->pgw_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", emergency_info_1->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+    }
+
+    if (emergency_info_1->pgw_ip_address) {
+    if (OpenAPI_ip_address_1_writeJSON(writer, "pgwIpAddress", emergency_info_1->pgw_ip_address) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [pgw_ip_address]");
+        goto end;
+    }
+    }
+
+    if (emergency_info_1->smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", emergency_info_1->smf_instance_id) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (emergency_info_1->is_epdg_ind) {
+    if (OpenAPI_json_write_bool(writer, "epdgInd", emergency_info_1->epdg_ind) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [epdg_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_emergency_info_1_writeJSON() failed [EmergencyInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_parseFromJSON(cJSON *emergency_info_1JSON)
 {
     OpenAPI_emergency_info_1_t *emergency_info_1_local_var = NULL;
@@ -137,7 +187,6 @@ end:
 OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_copy(OpenAPI_emergency_info_1_t *dst, OpenAPI_emergency_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_emergency_info_1_convertToJSON(src);
@@ -146,21 +195,6 @@ OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_copy(OpenAPI_emergency_info
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_emergency_info_1_free(dst);
     dst = OpenAPI_emergency_info_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_address_1.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_create(
 void OpenAPI_emergency_info_1_free(OpenAPI_emergency_info_1_t *emergency_info_1);
 OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_parseFromJSON(cJSON *emergency_info_1JSON);
 cJSON *OpenAPI_emergency_info_1_convertToJSON(OpenAPI_emergency_info_1_t *emergency_info_1);
+bool OpenAPI_emergency_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_emergency_info_1_t *emergency_info_1);
 OpenAPI_emergency_info_1_t *OpenAPI_emergency_info_1_copy(OpenAPI_emergency_info_1_t *dst, OpenAPI_emergency_info_1_t *src);
 
 #ifdef __cplusplus
@@ -63,6 +63,49 @@ end:
     return item;
 }
 
+bool OpenAPI_enhanced_coverage_restriction_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_enhanced_coverage_restriction_data_t *enhanced_coverage_restriction_data)
+{
+    if (enhanced_coverage_restriction_data == NULL) {
+        ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [EnhancedCoverageRestrictionData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [EnhancedCoverageRestrictionData]");
+        return false;
+    }
+    if (enhanced_coverage_restriction_data->plmn_ec_info_list) {
+    if (OpenAPI_json_write_array_start(writer, "plmnEcInfoList") == false) {
+        ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [plmn_ec_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *plmn_ec_info_list_node;
+    if (enhanced_coverage_restriction_data->plmn_ec_info_list) {
+        OpenAPI_list_for_each(enhanced_coverage_restriction_data->plmn_ec_info_list, plmn_ec_info_list_node) {
+            if (OpenAPI_plmn_ec_info_writeJSON(writer, NULL, plmn_ec_info_list_node->data) == false) {
+                ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [plmn_ec_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [plmn_ec_info_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_enhanced_coverage_restriction_data_writeJSON() failed [EnhancedCoverageRestrictionData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_enhanced_coverage_restriction_data_t *OpenAPI_enhanced_coverage_restriction_data_parseFromJSON(cJSON *enhanced_coverage_restriction_dataJSON)
 {
     OpenAPI_enhanced_coverage_restriction_data_t *enhanced_coverage_restriction_data_local_var = NULL;
@@ -107,7 +150,6 @@ end:
 OpenAPI_enhanced_coverage_restriction_data_t *OpenAPI_enhanced_coverage_restriction_data_copy(OpenAPI_enhanced_coverage_restriction_data_t *dst, OpenAPI_enhanced_coverage_restriction_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_enhanced_coverage_restriction_data_convertToJSON(src);
@@ -116,21 +158,6 @@ OpenAPI_enhanced_coverage_restriction_data_t *OpenAPI_enhanced_coverage_restrict
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_enhanced_coverage_restriction_data_free(dst);
     dst = OpenAPI_enhanced_coverage_restriction_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -58,6 +58,43 @@ end:
     return item;
 }
 
+bool OpenAPI_eps_bearer_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_bearer_info_t *eps_bearer_info)
+{
+    if (eps_bearer_info == NULL) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [EpsBearerInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [EpsBearerInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "ebi", eps_bearer_info->ebi) == false) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [ebi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "pgwS8uFteid", eps_bearer_info->pgw_s8u_fteid) == false) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [pgw_s8u_fteid]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "bearerLevelQoS", eps_bearer_info->bearer_level_qo_s) == false) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [bearer_level_qo_s]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eps_bearer_info_writeJSON() failed [EpsBearerInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eps_bearer_info_t *OpenAPI_eps_bearer_info_parseFromJSON(cJSON *eps_bearer_infoJSON)
 {
     OpenAPI_eps_bearer_info_t *eps_bearer_info_local_var = NULL;
@@ -109,7 +146,6 @@ end:
 OpenAPI_eps_bearer_info_t *OpenAPI_eps_bearer_info_copy(OpenAPI_eps_bearer_info_t *dst, OpenAPI_eps_bearer_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eps_bearer_info_convertToJSON(src);
@@ -118,21 +154,6 @@ OpenAPI_eps_bearer_info_t *OpenAPI_eps_bearer_info_copy(OpenAPI_eps_bearer_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eps_bearer_info_free(dst);
     dst = OpenAPI_eps_bearer_info_parseFromJSON(item);
     cJSON_Delete(item);
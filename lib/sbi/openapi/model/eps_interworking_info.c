@@ -69,6 +69,51 @@ end:
     return item;
 }
 
+bool OpenAPI_eps_interworking_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_interworking_info_t *eps_interworking_info)
+{
+    if (eps_interworking_info == NULL) {
+        ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [EpsInterworkingInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [EpsInterworkingInfo]");
+        return false;
+    }
+    if (eps_interworking_info->eps_iwk_pgws) {
+    if (OpenAPI_json_write_object_start(writer, "epsIwkPgws") == false) {
+        ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [eps_iwk_pgws]");
+        goto end;
+    }
+    OpenAPI_lnode_t *eps_iwk_pgws_node;
+    if (eps_interworking_info->eps_iwk_pgws) {
+        OpenAPI_list_for_each(eps_interworking_info->eps_iwk_pgws, eps_iwk_pgws_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)eps_iwk_pgws_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_eps_iwk_pgw_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [eps_iwk_pgws]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [eps_iwk_pgws]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eps_interworking_info_writeJSON() failed [EpsInterworkingInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_parseFromJSON(cJSON *eps_interworking_infoJSON)
 {
     OpenAPI_eps_interworking_info_t *eps_interworking_info_local_var = NULL;
@@ -110,7 +155,6 @@ end:
 OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_copy(OpenAPI_eps_interworking_info_t *dst, OpenAPI_eps_interworking_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eps_interworking_info_convertToJSON(src);
@@ -119,21 +163,6 @@ OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_copy(OpenAPI_eps_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eps_interworking_info_free(dst);
     dst = OpenAPI_eps_interworking_info_parseFromJSON(item);
     cJSON_Delete(item);
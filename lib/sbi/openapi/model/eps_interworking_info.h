@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "eps_iwk_pgw.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_create(
 void OpenAPI_eps_interworking_info_free(OpenAPI_eps_interworking_info_t *eps_interworking_info);
 OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_parseFromJSON(cJSON *eps_interworking_infoJSON);
 cJSON *OpenAPI_eps_interworking_info_convertToJSON(OpenAPI_eps_interworking_info_t *eps_interworking_info);
+bool OpenAPI_eps_interworking_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_interworking_info_t *eps_interworking_info);
 OpenAPI_eps_interworking_info_t *OpenAPI_eps_interworking_info_copy(OpenAPI_eps_interworking_info_t *dst, OpenAPI_eps_interworking_info_t *src);
 
 #ifdef __cplusplus
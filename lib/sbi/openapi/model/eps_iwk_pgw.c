@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_eps_iwk_pgw_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_iwk_pgw_t *eps_iwk_pgw)
+{
+    if (eps_iwk_pgw == NULL) {
+        ogs_error("OpenAPI_eps_iwk_pgw_writeJSON() failed [EpsIwkPgw]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eps_iwk_pgw_writeJSON() failed [EpsIwkPgw]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", eps_iwk_pgw->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_eps_iwk_pgw_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", eps_iwk_pgw->smf_instance_id) == false) {
+        ogs_error("OpenAPI_eps_iwk_pgw_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eps_iwk_pgw_writeJSON() failed [EpsIwkPgw]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eps_iwk_pgw_t *OpenAPI_eps_iwk_pgw_parseFromJSON(cJSON *eps_iwk_pgwJSON)
 {
     OpenAPI_eps_iwk_pgw_t *eps_iwk_pgw_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_eps_iwk_pgw_t *OpenAPI_eps_iwk_pgw_copy(OpenAPI_eps_iwk_pgw_t *dst, OpenAPI_eps_iwk_pgw_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eps_iwk_pgw_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_eps_iwk_pgw_t *OpenAPI_eps_iwk_pgw_copy(OpenAPI_eps_iwk_pgw_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eps_iwk_pgw_free(dst);
     dst = OpenAPI_eps_iwk_pgw_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "eps_nas_ciphering_algorithm.h"
 #include "eps_nas_integrity_algorithm.h"
 
@@ -32,6 +33,7 @@ OpenAPI_eps_nas_security_mode_t *OpenAPI_eps_nas_security_mode_create(
 void OpenAPI_eps_nas_security_mode_free(OpenAPI_eps_nas_security_mode_t *eps_nas_security_mode);
 OpenAPI_eps_nas_security_mode_t *OpenAPI_eps_nas_security_mode_parseFromJSON(cJSON *eps_nas_security_modeJSON);
 cJSON *OpenAPI_eps_nas_security_mode_convertToJSON(OpenAPI_eps_nas_security_mode_t *eps_nas_security_mode);
+bool OpenAPI_eps_nas_security_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_nas_security_mode_t *eps_nas_security_mode);
 OpenAPI_eps_nas_security_mode_t *OpenAPI_eps_nas_security_mode_copy(OpenAPI_eps_nas_security_mode_t *dst, OpenAPI_eps_nas_security_mode_t *src);
 
 #ifdef __cplusplus
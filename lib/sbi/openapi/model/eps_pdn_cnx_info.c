@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_eps_pdn_cnx_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eps_pdn_cnx_info_t *eps_pdn_cnx_info)
+{
+    if (eps_pdn_cnx_info == NULL) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [EpsPdnCnxInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [EpsPdnCnxInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pgwS8cFteid", eps_pdn_cnx_info->pgw_s8c_fteid) == false) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [pgw_s8c_fteid]");
+        goto end;
+    }
+
+    if (eps_pdn_cnx_info->pgw_node_name) {
+    if (OpenAPI_json_write_number(writer, "pgwNodeName", eps_pdn_cnx_info->pgw_node_name) == false) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [pgw_node_name]");
+        goto end;
+    }
+    }
+
+    if (eps_pdn_cnx_info->is_linked_bearer_id) {
+    if (OpenAPI_json_write_number(writer, "linkedBearerId", eps_pdn_cnx_info->linked_bearer_id) == false) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [linked_bearer_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eps_pdn_cnx_info_writeJSON() failed [EpsPdnCnxInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eps_pdn_cnx_info_t *OpenAPI_eps_pdn_cnx_info_parseFromJSON(cJSON *eps_pdn_cnx_infoJSON)
 {
     OpenAPI_eps_pdn_cnx_info_t *eps_pdn_cnx_info_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_eps_pdn_cnx_info_t *OpenAPI_eps_pdn_cnx_info_copy(OpenAPI_eps_pdn_cnx_info_t *dst, OpenAPI_eps_pdn_cnx_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eps_pdn_cnx_info_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_eps_pdn_cnx_info_t *OpenAPI_eps_pdn_cnx_info_copy(OpenAPI_eps_pdn_cnx_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eps_pdn_cnx_info_free(dst);
     dst = OpenAPI_eps_pdn_cnx_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -133,6 +133,102 @@ end:
     return item;
 }
 
+bool OpenAPI_error_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_error_report_t *error_report)
+{
+    if (error_report == NULL) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [ErrorReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [ErrorReport]");
+        return false;
+    }
+    if (error_report->error) {
+    if (OpenAPI_problem_details_writeJSON(writer, "error", error_report->error) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [error]");
+        goto end;
+    }
+    }
+
+    if (error_report->rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "ruleReports") == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rule_reports_node;
+    if (error_report->rule_reports) {
+        OpenAPI_list_for_each(error_report->rule_reports, rule_reports_node) {
+            if (OpenAPI_rule_report_writeJSON(writer, NULL, rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_error_report_writeJSON() failed [rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+    }
+
+    if (error_report->sess_rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "sessRuleReports") == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sess_rule_reports_node;
+    if (error_report->sess_rule_reports) {
+        OpenAPI_list_for_each(error_report->sess_rule_reports, sess_rule_reports_node) {
+            if (OpenAPI_session_rule_report_writeJSON(writer, NULL, sess_rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_error_report_writeJSON() failed [sess_rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+    }
+
+    if (error_report->pol_dec_failure_reports) {
+    if (OpenAPI_json_write_array_start(writer, "polDecFailureReports") == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [pol_dec_failure_reports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pol_dec_failure_reports_node;
+    OpenAPI_list_for_each(error_report->pol_dec_failure_reports, pol_dec_failure_reports_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_decision_failure_code_ToString((intptr_t)pol_dec_failure_reports_node->data)) == false) {
+            ogs_error("OpenAPI_error_report_writeJSON() failed [pol_dec_failure_reports]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [pol_dec_failure_reports]");
+        goto end;
+    }
+    }
+
+    if (error_report->alt_qos_param_id) {
+    if (OpenAPI_json_write_string(writer, "altQosParamId", error_report->alt_qos_param_id) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [alt_qos_param_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_error_report_writeJSON() failed [ErrorReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_error_report_t *OpenAPI_error_report_parseFromJSON(cJSON *error_reportJSON)
 {
     OpenAPI_error_report_t *error_report_local_var = NULL;
@@ -248,7 +344,6 @@ end:
 OpenAPI_error_report_t *OpenAPI_error_report_copy(OpenAPI_error_report_t *dst, OpenAPI_error_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_error_report_convertToJSON(src);
@@ -257,21 +352,6 @@ OpenAPI_error_report_t *OpenAPI_error_report_copy(OpenAPI_error_report_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_error_report_free(dst);
     dst = OpenAPI_error_report_parseFromJSON(item);
     cJSON_Delete(item);
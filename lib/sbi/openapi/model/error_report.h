@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "policy_decision_failure_code.h"
 #include "problem_details.h"
 #include "rule_report.h"
@@ -40,6 +41,7 @@ OpenAPI_error_report_t *OpenAPI_error_report_create(
 void OpenAPI_error_report_free(OpenAPI_error_report_t *error_report);
 OpenAPI_error_report_t *OpenAPI_error_report_parseFromJSON(cJSON *error_reportJSON);
 cJSON *OpenAPI_error_report_convertToJSON(OpenAPI_error_report_t *error_report);
+bool OpenAPI_error_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_error_report_t *error_report);
 OpenAPI_error_report_t *OpenAPI_error_report_copy(OpenAPI_error_report_t *dst, OpenAPI_error_report_t *src);
 
 #ifdef __cplusplus
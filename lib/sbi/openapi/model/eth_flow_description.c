@@ -126,6 +126,94 @@ end:
     return item;
 }
 
+bool OpenAPI_eth_flow_description_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eth_flow_description_t *eth_flow_description)
+{
+    if (eth_flow_description == NULL) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [EthFlowDescription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [EthFlowDescription]");
+        return false;
+    }
+    if (eth_flow_description->dest_mac_addr) {
+    if (OpenAPI_json_write_string(writer, "destMacAddr", eth_flow_description->dest_mac_addr) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [dest_mac_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "ethType", eth_flow_description->eth_type) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [eth_type]");
+        goto end;
+    }
+
+    if (eth_flow_description->f_desc) {
+    if (OpenAPI_json_write_string(writer, "fDesc", eth_flow_description->f_desc) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [f_desc]");
+        goto end;
+    }
+    }
+
+    if (eth_flow_description->f_dir) {
+    if (OpenAPI_json_write_string(writer, "fDir", OpenAPI_flow_direction_ToString(eth_flow_description->f_dir)) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [f_dir]");
+        goto end;
+    }
+    }
+
+    if (eth_flow_description->source_mac_addr) {
+    if (OpenAPI_json_write_string(writer, "sourceMacAddr", eth_flow_description->source_mac_addr) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [source_mac_addr]");
+        goto end;
+    }
+    }
+
+    if (eth_flow_description->vlan_tags) {
+    if (OpenAPI_json_write_array_start(writer, "vlanTags") == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [vlan_tags]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *vlan_tags_node;
+    OpenAPI_list_for_each(eth_flow_description->vlan_tags, vlan_tags_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)vlan_tags_node->data) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [vlan_tags]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [vlan_tags]");
+        goto end;
+    }
+    }
+
+    if (eth_flow_description->src_mac_addr_end) {
+    if (OpenAPI_json_write_string(writer, "srcMacAddrEnd", eth_flow_description->src_mac_addr_end) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [src_mac_addr_end]");
+        goto end;
+    }
+    }
+
+    if (eth_flow_description->dest_mac_addr_end) {
+    if (OpenAPI_json_write_string(writer, "destMacAddrEnd", eth_flow_description->dest_mac_addr_end) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [dest_mac_addr_end]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eth_flow_description_writeJSON() failed [EthFlowDescription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_parseFromJSON(cJSON *eth_flow_descriptionJSON)
 {
     OpenAPI_eth_flow_description_t *eth_flow_description_local_var = NULL;
@@ -235,7 +323,6 @@ end:
 OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_copy(OpenAPI_eth_flow_description_t *dst, OpenAPI_eth_flow_description_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eth_flow_description_convertToJSON(src);
@@ -244,21 +331,6 @@ OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_copy(OpenAPI_eth_fl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eth_flow_description_free(dst);
     dst = OpenAPI_eth_flow_description_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flow_direction.h"
 
 #ifdef __cplusplus
@@ -43,6 +44,7 @@ OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_create(
 void OpenAPI_eth_flow_description_free(OpenAPI_eth_flow_description_t *eth_flow_description);
 OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_parseFromJSON(cJSON *eth_flow_descriptionJSON);
 cJSON *OpenAPI_eth_flow_description_convertToJSON(OpenAPI_eth_flow_description_t *eth_flow_description);
+bool OpenAPI_eth_flow_description_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eth_flow_description_t *eth_flow_description);
 OpenAPI_eth_flow_description_t *OpenAPI_eth_flow_description_copy(OpenAPI_eth_flow_description_t *dst, OpenAPI_eth_flow_description_t *src);
 
 #ifdef __cplusplus
@@ -160,6 +160,94 @@ end:
     return item;
 }
 
+bool OpenAPI_eutra_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eutra_location_t *eutra_location)
+{
+    if (eutra_location == NULL) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [EutraLocation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [EutraLocation]");
+        return false;
+    }
+    if (OpenAPI_tai_writeJSON(writer, "tai", eutra_location->tai) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [tai]");
+        goto end;
+    }
+
+    if (eutra_location->is_ignore_tai) {
+    if (OpenAPI_json_write_bool(writer, "ignoreTai", eutra_location->ignore_tai) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [ignore_tai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_ecgi_writeJSON(writer, "ecgi", eutra_location->ecgi) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [ecgi]");
+        goto end;
+    }
+
+    if (eutra_location->is_ignore_ecgi) {
+    if (OpenAPI_json_write_bool(writer, "ignoreEcgi", eutra_location->ignore_ecgi) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [ignore_ecgi]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->is_age_of_location_information) {
+    if (OpenAPI_json_write_number(writer, "ageOfLocationInformation", eutra_location->age_of_location_information) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [age_of_location_information]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->ue_location_timestamp) {
+    if (OpenAPI_json_write_string(writer, "ueLocationTimestamp", eutra_location->ue_location_timestamp) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [ue_location_timestamp]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->geographical_information) {
+    if (OpenAPI_json_write_string(writer, "geographicalInformation", eutra_location->geographical_information) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [geographical_information]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->geodetic_information) {
+    if (OpenAPI_json_write_string(writer, "geodeticInformation", eutra_location->geodetic_information) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [geodetic_information]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->global_ngenb_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "globalNgenbId", eutra_location->global_ngenb_id) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [global_ngenb_id]");
+        goto end;
+    }
+    }
+
+    if (eutra_location->global_enb_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "globalENbId", eutra_location->global_enb_id) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [global_enb_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_eutra_location_writeJSON() failed [EutraLocation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_eutra_location_t *OpenAPI_eutra_location_parseFromJSON(cJSON *eutra_locationJSON)
 {
     OpenAPI_eutra_location_t *eutra_location_local_var = NULL;
@@ -273,7 +361,6 @@ end:
 OpenAPI_eutra_location_t *OpenAPI_eutra_location_copy(OpenAPI_eutra_location_t *dst, OpenAPI_eutra_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_eutra_location_convertToJSON(src);
@@ -282,21 +369,6 @@ OpenAPI_eutra_location_t *OpenAPI_eutra_location_copy(OpenAPI_eutra_location_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_eutra_location_free(dst);
     dst = OpenAPI_eutra_location_parseFromJSON(item);
     cJSON_Delete(item);
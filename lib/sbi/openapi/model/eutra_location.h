@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi.h"
 #include "global_ran_node_id.h"
 #include "tai.h"
@@ -55,6 +56,7 @@ OpenAPI_eutra_location_t *OpenAPI_eutra_location_create(
 void OpenAPI_eutra_location_free(OpenAPI_eutra_location_t *eutra_location);
 OpenAPI_eutra_location_t *OpenAPI_eutra_location_parseFromJSON(cJSON *eutra_locationJSON);
 cJSON *OpenAPI_eutra_location_convertToJSON(OpenAPI_eutra_location_t *eutra_location);
+bool OpenAPI_eutra_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_eutra_location_t *eutra_location);
 OpenAPI_eutra_location_t *OpenAPI_eutra_location_copy(OpenAPI_eutra_location_t *dst, OpenAPI_eutra_location_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_id_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_event_id_t *OpenAPI_event_id_create(
 void OpenAPI_event_id_free(OpenAPI_event_id_t *event_id);
 OpenAPI_event_id_t *OpenAPI_event_id_parseFromJSON(cJSON *event_idJSON);
 cJSON *OpenAPI_event_id_convertToJSON(OpenAPI_event_id_t *event_id);
+bool OpenAPI_event_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_event_id_t *event_id);
 OpenAPI_event_id_t *OpenAPI_event_id_copy(OpenAPI_event_id_t *dst, OpenAPI_event_id_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_event_report_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_event_report_mode_t *event_report_mode)
+{
+    if (event_report_mode == NULL) {
+        ogs_error("OpenAPI_event_report_mode_writeJSON() failed [EventReportMode]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_event_report_mode_writeJSON() failed [EventReportMode]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_event_report_mode_writeJSON() failed [EventReportMode]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_parseFromJSON(cJSON *event_report_modeJSON)
 {
     OpenAPI_event_report_mode_t *event_report_mode_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_copy(OpenAPI_event_report_mode_t *dst, OpenAPI_event_report_mode_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_event_report_mode_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_copy(OpenAPI_event_report
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_event_report_mode_free(dst);
     dst = OpenAPI_event_report_mode_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_report_mode_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_create(
 void OpenAPI_event_report_mode_free(OpenAPI_event_report_mode_t *event_report_mode);
 OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_parseFromJSON(cJSON *event_report_modeJSON);
 cJSON *OpenAPI_event_report_mode_convertToJSON(OpenAPI_event_report_mode_t *event_report_mode);
+bool OpenAPI_event_report_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_event_report_mode_t *event_report_mode);
 OpenAPI_event_report_mode_t *OpenAPI_event_report_mode_copy(OpenAPI_event_report_mode_t *dst, OpenAPI_event_report_mode_t *src);
 
 #ifdef __cplusplus
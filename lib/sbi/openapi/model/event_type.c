@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_event_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_event_type_t *event_type)
+{
+    if (event_type == NULL) {
+        ogs_error("OpenAPI_event_type_writeJSON() failed [EventType]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_event_type_writeJSON() failed [EventType]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_event_type_writeJSON() failed [EventType]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_event_type_t *OpenAPI_event_type_parseFromJSON(cJSON *event_typeJSON)
 {
     OpenAPI_event_type_t *event_type_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_event_type_t *OpenAPI_event_type_copy(OpenAPI_event_type_t *dst, OpenAPI_event_type_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_event_type_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_event_type_t *OpenAPI_event_type_copy(OpenAPI_event_type_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_event_type_free(dst);
     dst = OpenAPI_event_type_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_type_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_event_type_t *OpenAPI_event_type_create(
 void OpenAPI_event_type_free(OpenAPI_event_type_t *event_type);
 OpenAPI_event_type_t *OpenAPI_event_type_parseFromJSON(cJSON *event_typeJSON);
 cJSON *OpenAPI_event_type_convertToJSON(OpenAPI_event_type_t *event_type);
+bool OpenAPI_event_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_event_type_t *event_type);
 OpenAPI_event_type_t *OpenAPI_event_type_copy(OpenAPI_event_type_t *dst, OpenAPI_event_type_t *src);
 
 #ifdef __cplusplus
@@ -458,6 +458,311 @@ end:
     return item;
 }
 
+bool OpenAPI_events_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_notification_t *events_notification)
+{
+    if (events_notification == NULL) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [EventsNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [EventsNotification]");
+        return false;
+    }
+    if (events_notification->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(events_notification->access_type)) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (events_notification->add_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "addAccessInfo", events_notification->add_access_info) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [add_access_info]");
+        goto end;
+    }
+    }
+
+    if (events_notification->rel_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "relAccessInfo", events_notification->rel_access_info) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [rel_access_info]");
+        goto end;
+    }
+    }
+
+    if (events_notification->an_charg_addr) {
+    if (OpenAPI_acc_net_charging_address_writeJSON(writer, "anChargAddr", events_notification->an_charg_addr) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [an_charg_addr]");
+        goto end;
+    }
+    }
+
+    if (events_notification->an_charg_ids) {
+    if (OpenAPI_json_write_array_start(writer, "anChargIds") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [an_charg_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *an_charg_ids_node;
+    if (events_notification->an_charg_ids) {
+        OpenAPI_list_for_each(events_notification->an_charg_ids, an_charg_ids_node) {
+            if (OpenAPI_access_net_charging_identifier_writeJSON(writer, NULL, an_charg_ids_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [an_charg_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [an_charg_ids]");
+        goto end;
+    }
+    }
+
+    if (events_notification->an_gw_addr) {
+    if (OpenAPI_an_gw_address_writeJSON(writer, "anGwAddr", events_notification->an_gw_addr) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [an_gw_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "evSubsUri", events_notification->ev_subs_uri) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ev_subs_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "evNotifs") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ev_notifs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ev_notifs_node;
+    if (events_notification->ev_notifs) {
+        OpenAPI_list_for_each(events_notification->ev_notifs, ev_notifs_node) {
+            if (OpenAPI_af_event_notification_writeJSON(writer, NULL, ev_notifs_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [ev_notifs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ev_notifs]");
+        goto end;
+    }
+
+    if (events_notification->failed_resourc_alloc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "failedResourcAllocReports") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [failed_resourc_alloc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_resourc_alloc_reports_node;
+    if (events_notification->failed_resourc_alloc_reports) {
+        OpenAPI_list_for_each(events_notification->failed_resourc_alloc_reports, failed_resourc_alloc_reports_node) {
+            if (OpenAPI_resources_allocation_info_writeJSON(writer, NULL, failed_resourc_alloc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [failed_resourc_alloc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [failed_resourc_alloc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_notification->succ_resourc_alloc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "succResourcAllocReports") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [succ_resourc_alloc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *succ_resourc_alloc_reports_node;
+    if (events_notification->succ_resourc_alloc_reports) {
+        OpenAPI_list_for_each(events_notification->succ_resourc_alloc_reports, succ_resourc_alloc_reports_node) {
+            if (OpenAPI_resources_allocation_info_writeJSON(writer, NULL, succ_resourc_alloc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [succ_resourc_alloc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [succ_resourc_alloc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_notification->no_net_loc_supp) {
+    if (OpenAPI_json_write_string(writer, "noNetLocSupp", OpenAPI_net_loc_access_support_ToString(events_notification->no_net_loc_supp)) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [no_net_loc_supp]");
+        goto end;
+    }
+    }
+
+    if (events_notification->out_of_cred_reports) {
+    if (OpenAPI_json_write_array_start(writer, "outOfCredReports") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [out_of_cred_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *out_of_cred_reports_node;
+    if (events_notification->out_of_cred_reports) {
+        OpenAPI_list_for_each(events_notification->out_of_cred_reports, out_of_cred_reports_node) {
+            if (OpenAPI_out_of_credit_information_writeJSON(writer, NULL, out_of_cred_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [out_of_cred_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [out_of_cred_reports]");
+        goto end;
+    }
+    }
+
+    if (events_notification->plmn_id) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "plmnId", events_notification->plmn_id) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (events_notification->qnc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qncReports") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qnc_reports_node;
+    if (events_notification->qnc_reports) {
+        OpenAPI_list_for_each(events_notification->qnc_reports, qnc_reports_node) {
+            if (OpenAPI_qos_notification_control_info_writeJSON(writer, NULL, qnc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [qnc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_notification->qos_mon_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qosMonReports") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_mon_reports_node;
+    if (events_notification->qos_mon_reports) {
+        OpenAPI_list_for_each(events_notification->qos_mon_reports, qos_mon_reports_node) {
+            if (OpenAPI_qos_monitoring_report_writeJSON(writer, NULL, qos_mon_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [qos_mon_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+    }
+
+    if (events_notification->ran_nas_rel_causes) {
+    if (OpenAPI_json_write_array_start(writer, "ranNasRelCauses") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ran_nas_rel_causes_node;
+    if (events_notification->ran_nas_rel_causes) {
+        OpenAPI_list_for_each(events_notification->ran_nas_rel_causes, ran_nas_rel_causes_node) {
+            if (OpenAPI_ran_nas_rel_cause_writeJSON(writer, NULL, ran_nas_rel_causes_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [ran_nas_rel_causes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+    }
+
+    if (events_notification->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(events_notification->rat_type)) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (events_notification->ue_loc) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLoc", events_notification->ue_loc) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ue_loc]");
+        goto end;
+    }
+    }
+
+    if (events_notification->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", events_notification->ue_time_zone) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (events_notification->usg_rep) {
+    if (OpenAPI_accumulated_usage_writeJSON(writer, "usgRep", events_notification->usg_rep) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [usg_rep]");
+        goto end;
+    }
+    }
+
+    if (events_notification->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", events_notification->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (events_notification->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", events_notification->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (events_notification->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (events_notification->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(events_notification->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_events_notification_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_events_notification_writeJSON() failed [EventsNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_events_notification_t *OpenAPI_events_notification_parseFromJSON(cJSON *events_notificationJSON)
 {
     OpenAPI_events_notification_t *events_notification_local_var = NULL;
@@ -874,7 +1179,6 @@ end:
 OpenAPI_events_notification_t *OpenAPI_events_notification_copy(OpenAPI_events_notification_t *dst, OpenAPI_events_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_events_notification_convertToJSON(src);
@@ -883,21 +1187,6 @@ OpenAPI_events_notification_t *OpenAPI_events_notification_copy(OpenAPI_events_n
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_events_notification_free(dst);
     dst = OpenAPI_events_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acc_net_charging_address.h"
 #include "access_net_charging_identifier.h"
 #include "access_type.h"
@@ -90,6 +91,7 @@ OpenAPI_events_notification_t *OpenAPI_events_notification_create(
 void OpenAPI_events_notification_free(OpenAPI_events_notification_t *events_notification);
 OpenAPI_events_notification_t *OpenAPI_events_notification_parseFromJSON(cJSON *events_notificationJSON);
 cJSON *OpenAPI_events_notification_convertToJSON(OpenAPI_events_notification_t *events_notification);
+bool OpenAPI_events_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_notification_t *events_notification);
 OpenAPI_events_notification_t *OpenAPI_events_notification_copy(OpenAPI_events_notification_t *dst, OpenAPI_events_notification_t *src);
 
 #ifdef __cplusplus
@@ -570,6 +570,394 @@ end:
     return item;
 }
 
+bool OpenAPI_events_subsc_put_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_subsc_put_data_t *events_subsc_put_data)
+{
+    if (events_subsc_put_data == NULL) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [EventsSubscPutData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [EventsSubscPutData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "events") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [events]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *events_node;
+    if (events_subsc_put_data->events) {
+        OpenAPI_list_for_each(events_subsc_put_data->events, events_node) {
+            if (OpenAPI_af_event_subscription_writeJSON(writer, NULL, events_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [events]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [events]");
+        goto end;
+    }
+
+    if (events_subsc_put_data->notif_uri) {
+    if (OpenAPI_json_write_string(writer, "notifUri", events_subsc_put_data->notif_uri) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [notif_uri]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->req_qos_mon_params) {
+    if (OpenAPI_json_write_array_start(writer, "reqQosMonParams") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_qos_mon_params_node;
+    OpenAPI_list_for_each(events_subsc_put_data->req_qos_mon_params, req_qos_mon_params_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_requested_qos_monitoring_parameter_ToString((intptr_t)req_qos_mon_params_node->data)) == false) {
+            ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_qos_mon_params]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->qos_mon) {
+    if (OpenAPI_qos_monitoring_information_writeJSON(writer, "qosMon", events_subsc_put_data->qos_mon) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qos_mon]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->req_anis) {
+    if (OpenAPI_json_write_array_start(writer, "reqAnis") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_anis]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_anis_node;
+    OpenAPI_list_for_each(events_subsc_put_data->req_anis, req_anis_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_required_access_info_ToString((intptr_t)req_anis_node->data)) == false) {
+            ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_anis]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [req_anis]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->usg_thres) {
+    if (OpenAPI_usage_threshold_writeJSON(writer, "usgThres", events_subsc_put_data->usg_thres) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [usg_thres]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->notif_corre_id) {
+    if (OpenAPI_json_write_string(writer, "notifCorreId", events_subsc_put_data->notif_corre_id) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [notif_corre_id]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(events_subsc_put_data->access_type)) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->add_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "addAccessInfo", events_subsc_put_data->add_access_info) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [add_access_info]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->rel_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "relAccessInfo", events_subsc_put_data->rel_access_info) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [rel_access_info]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->an_charg_addr) {
+    if (OpenAPI_acc_net_charging_address_writeJSON(writer, "anChargAddr", events_subsc_put_data->an_charg_addr) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [an_charg_addr]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->an_charg_ids) {
+    if (OpenAPI_json_write_array_start(writer, "anChargIds") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [an_charg_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *an_charg_ids_node;
+    if (events_subsc_put_data->an_charg_ids) {
+        OpenAPI_list_for_each(events_subsc_put_data->an_charg_ids, an_charg_ids_node) {
+            if (OpenAPI_access_net_charging_identifier_writeJSON(writer, NULL, an_charg_ids_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [an_charg_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [an_charg_ids]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->an_gw_addr) {
+    if (OpenAPI_an_gw_address_writeJSON(writer, "anGwAddr", events_subsc_put_data->an_gw_addr) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [an_gw_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "evSubsUri", events_subsc_put_data->ev_subs_uri) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ev_subs_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "evNotifs") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ev_notifs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ev_notifs_node;
+    if (events_subsc_put_data->ev_notifs) {
+        OpenAPI_list_for_each(events_subsc_put_data->ev_notifs, ev_notifs_node) {
+            if (OpenAPI_af_event_notification_writeJSON(writer, NULL, ev_notifs_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ev_notifs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ev_notifs]");
+        goto end;
+    }
+
+    if (events_subsc_put_data->failed_resourc_alloc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "failedResourcAllocReports") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [failed_resourc_alloc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_resourc_alloc_reports_node;
+    if (events_subsc_put_data->failed_resourc_alloc_reports) {
+        OpenAPI_list_for_each(events_subsc_put_data->failed_resourc_alloc_reports, failed_resourc_alloc_reports_node) {
+            if (OpenAPI_resources_allocation_info_writeJSON(writer, NULL, failed_resourc_alloc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [failed_resourc_alloc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [failed_resourc_alloc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->succ_resourc_alloc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "succResourcAllocReports") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [succ_resourc_alloc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *succ_resourc_alloc_reports_node;
+    if (events_subsc_put_data->succ_resourc_alloc_reports) {
+        OpenAPI_list_for_each(events_subsc_put_data->succ_resourc_alloc_reports, succ_resourc_alloc_reports_node) {
+            if (OpenAPI_resources_allocation_info_writeJSON(writer, NULL, succ_resourc_alloc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [succ_resourc_alloc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [succ_resourc_alloc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->no_net_loc_supp) {
+    if (OpenAPI_json_write_string(writer, "noNetLocSupp", OpenAPI_net_loc_access_support_ToString(events_subsc_put_data->no_net_loc_supp)) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [no_net_loc_supp]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->out_of_cred_reports) {
+    if (OpenAPI_json_write_array_start(writer, "outOfCredReports") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [out_of_cred_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *out_of_cred_reports_node;
+    if (events_subsc_put_data->out_of_cred_reports) {
+        OpenAPI_list_for_each(events_subsc_put_data->out_of_cred_reports, out_of_cred_reports_node) {
+            if (OpenAPI_out_of_credit_information_writeJSON(writer, NULL, out_of_cred_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [out_of_cred_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [out_of_cred_reports]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->plmn_id) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "plmnId", events_subsc_put_data->plmn_id) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->qnc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qncReports") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qnc_reports_node;
+    if (events_subsc_put_data->qnc_reports) {
+        OpenAPI_list_for_each(events_subsc_put_data->qnc_reports, qnc_reports_node) {
+            if (OpenAPI_qos_notification_control_info_writeJSON(writer, NULL, qnc_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qnc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->qos_mon_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qosMonReports") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_mon_reports_node;
+    if (events_subsc_put_data->qos_mon_reports) {
+        OpenAPI_list_for_each(events_subsc_put_data->qos_mon_reports, qos_mon_reports_node) {
+            if (OpenAPI_qos_monitoring_report_writeJSON(writer, NULL, qos_mon_reports_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qos_mon_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->ran_nas_rel_causes) {
+    if (OpenAPI_json_write_array_start(writer, "ranNasRelCauses") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ran_nas_rel_causes_node;
+    if (events_subsc_put_data->ran_nas_rel_causes) {
+        OpenAPI_list_for_each(events_subsc_put_data->ran_nas_rel_causes, ran_nas_rel_causes_node) {
+            if (OpenAPI_ran_nas_rel_cause_writeJSON(writer, NULL, ran_nas_rel_causes_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ran_nas_rel_causes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(events_subsc_put_data->rat_type)) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->ue_loc) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLoc", events_subsc_put_data->ue_loc) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ue_loc]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", events_subsc_put_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->usg_rep) {
+    if (OpenAPI_accumulated_usage_writeJSON(writer, "usgRep", events_subsc_put_data->usg_rep) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [usg_rep]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", events_subsc_put_data->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", events_subsc_put_data->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_put_data->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (events_subsc_put_data->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(events_subsc_put_data->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_put_data_writeJSON() failed [EventsSubscPutData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_parseFromJSON(cJSON *events_subsc_put_dataJSON)
 {
     OpenAPI_events_subsc_put_data_t *events_subsc_put_data_local_var = NULL;
@@ -1100,7 +1488,6 @@ end:
 OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_copy(OpenAPI_events_subsc_put_data_t *dst, OpenAPI_events_subsc_put_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_events_subsc_put_data_convertToJSON(src);
@@ -1109,21 +1496,6 @@ OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_copy(OpenAPI_even
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_events_subsc_put_data_free(dst);
     dst = OpenAPI_events_subsc_put_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acc_net_charging_address.h"
 #include "access_net_charging_identifier.h"
 #include "access_type.h"
@@ -111,6 +112,7 @@ OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_create(
 void OpenAPI_events_subsc_put_data_free(OpenAPI_events_subsc_put_data_t *events_subsc_put_data);
 OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_parseFromJSON(cJSON *events_subsc_put_dataJSON);
 cJSON *OpenAPI_events_subsc_put_data_convertToJSON(OpenAPI_events_subsc_put_data_t *events_subsc_put_data);
+bool OpenAPI_events_subsc_put_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_subsc_put_data_t *events_subsc_put_data);
 OpenAPI_events_subsc_put_data_t *OpenAPI_events_subsc_put_data_copy(OpenAPI_events_subsc_put_data_t *dst, OpenAPI_events_subsc_put_data_t *src);
 
 #ifdef __cplusplus
@@ -149,6 +149,111 @@ end:
     return item;
 }
 
+bool OpenAPI_events_subsc_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_subsc_req_data_t *events_subsc_req_data)
+{
+    if (events_subsc_req_data == NULL) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [EventsSubscReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [EventsSubscReqData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "events") == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [events]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *events_node;
+    if (events_subsc_req_data->events) {
+        OpenAPI_list_for_each(events_subsc_req_data->events, events_node) {
+            if (OpenAPI_af_event_subscription_writeJSON(writer, NULL, events_node->data) == false) {
+                ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [events]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [events]");
+        goto end;
+    }
+
+    if (events_subsc_req_data->notif_uri) {
+    if (OpenAPI_json_write_string(writer, "notifUri", events_subsc_req_data->notif_uri) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [notif_uri]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_req_data->req_qos_mon_params) {
+    if (OpenAPI_json_write_array_start(writer, "reqQosMonParams") == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_qos_mon_params_node;
+    OpenAPI_list_for_each(events_subsc_req_data->req_qos_mon_params, req_qos_mon_params_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_requested_qos_monitoring_parameter_ToString((intptr_t)req_qos_mon_params_node->data)) == false) {
+            ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_qos_mon_params]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_req_data->qos_mon) {
+    if (OpenAPI_qos_monitoring_information_writeJSON(writer, "qosMon", events_subsc_req_data->qos_mon) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [qos_mon]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_req_data->req_anis) {
+    if (OpenAPI_json_write_array_start(writer, "reqAnis") == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_anis]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_anis_node;
+    OpenAPI_list_for_each(events_subsc_req_data->req_anis, req_anis_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_required_access_info_ToString((intptr_t)req_anis_node->data)) == false) {
+            ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_anis]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [req_anis]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_req_data->usg_thres) {
+    if (OpenAPI_usage_threshold_writeJSON(writer, "usgThres", events_subsc_req_data->usg_thres) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [usg_thres]");
+        goto end;
+    }
+    }
+
+    if (events_subsc_req_data->notif_corre_id) {
+    if (OpenAPI_json_write_string(writer, "notifCorreId", events_subsc_req_data->notif_corre_id) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [notif_corre_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_events_subsc_req_data_writeJSON() failed [EventsSubscReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_parseFromJSON(cJSON *events_subsc_req_dataJSON)
 {
     OpenAPI_events_subsc_req_data_t *events_subsc_req_data_local_var = NULL;
@@ -277,7 +382,6 @@ end:
 OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_copy(OpenAPI_events_subsc_req_data_t *dst, OpenAPI_events_subsc_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_events_subsc_req_data_convertToJSON(src);
@@ -286,21 +390,6 @@ OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_copy(OpenAPI_even
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_events_subsc_req_data_free(dst);
     dst = OpenAPI_events_subsc_req_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_event_subscription.h"
 #include "qos_monitoring_information.h"
 #include "requested_qos_monitoring_parameter.h"
@@ -45,6 +46,7 @@ OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_create(
 void OpenAPI_events_subsc_req_data_free(OpenAPI_events_subsc_req_data_t *events_subsc_req_data);
 OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_parseFromJSON(cJSON *events_subsc_req_dataJSON);
 cJSON *OpenAPI_events_subsc_req_data_convertToJSON(OpenAPI_events_subsc_req_data_t *events_subsc_req_data);
+bool OpenAPI_events_subsc_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_events_subsc_req_data_t *events_subsc_req_data);
 OpenAPI_events_subsc_req_data_t *OpenAPI_events_subsc_req_data_copy(OpenAPI_events_subsc_req_data_t *dst, OpenAPI_events_subsc_req_data_t *src);
 
 #ifdef __cplusplus
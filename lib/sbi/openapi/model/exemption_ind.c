@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_exemption_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_exemption_ind_t *exemption_ind)
+{
+    if (exemption_ind == NULL) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [ExemptionInd]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [ExemptionInd]");
+        return false;
+    }
+    if (exemption_ind->is_dnn_congestion) {
+    if (OpenAPI_json_write_bool(writer, "dnnCongestion", exemption_ind->dnn_congestion) == false) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [dnn_congestion]");
+        goto end;
+    }
+    }
+
+    if (exemption_ind->is_snssai_only_congestion) {
+    if (OpenAPI_json_write_bool(writer, "snssaiOnlyCongestion", exemption_ind->snssai_only_congestion) == false) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [snssai_only_congestion]");
+        goto end;
+    }
+    }
+
+    if (exemption_ind->is_snssai_dnn_congestion) {
+    if (OpenAPI_json_write_bool(writer, "snssaiDnnCongestion", exemption_ind->snssai_dnn_congestion) == false) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [snssai_dnn_congestion]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_exemption_ind_writeJSON() failed [ExemptionInd]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_parseFromJSON(cJSON *exemption_indJSON)
 {
     OpenAPI_exemption_ind_t *exemption_ind_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_copy(OpenAPI_exemption_ind_t *dst, OpenAPI_exemption_ind_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_exemption_ind_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_copy(OpenAPI_exemption_ind_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_exemption_ind_free(dst);
     dst = OpenAPI_exemption_ind_parseFromJSON(item);
     cJSON_Delete(item);
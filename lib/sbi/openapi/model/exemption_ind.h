@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,7 @@ OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_create(
 void OpenAPI_exemption_ind_free(OpenAPI_exemption_ind_t *exemption_ind);
 OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_parseFromJSON(cJSON *exemption_indJSON);
 cJSON *OpenAPI_exemption_ind_convertToJSON(OpenAPI_exemption_ind_t *exemption_ind);
+bool OpenAPI_exemption_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_exemption_ind_t *exemption_ind);
 OpenAPI_exemption_ind_t *OpenAPI_exemption_ind_copy(OpenAPI_exemption_ind_t *dst, OpenAPI_exemption_ind_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,52 @@ end:
     return item;
 }
 
+bool OpenAPI_expected_ue_behavior_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_expected_ue_behavior_t *expected_ue_behavior)
+{
+    if (expected_ue_behavior == NULL) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [ExpectedUeBehavior]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [ExpectedUeBehavior]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "expMoveTrajectory") == false) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [exp_move_trajectory]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *exp_move_trajectory_node;
+    if (expected_ue_behavior->exp_move_trajectory) {
+        OpenAPI_list_for_each(expected_ue_behavior->exp_move_trajectory, exp_move_trajectory_node) {
+            if (OpenAPI_user_location_writeJSON(writer, NULL, exp_move_trajectory_node->data) == false) {
+                ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [exp_move_trajectory]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [exp_move_trajectory]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "validityTime", expected_ue_behavior->validity_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [validity_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behavior_writeJSON() failed [ExpectedUeBehavior]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_parseFromJSON(cJSON *expected_ue_behaviorJSON)
 {
     OpenAPI_expected_ue_behavior_t *expected_ue_behavior_local_var = NULL;
@@ -127,7 +173,6 @@ end:
 OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_copy(OpenAPI_expected_ue_behavior_t *dst, OpenAPI_expected_ue_behavior_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_expected_ue_behavior_convertToJSON(src);
@@ -136,21 +181,6 @@ OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_copy(OpenAPI_expect
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_expected_ue_behavior_free(dst);
     dst = OpenAPI_expected_ue_behavior_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "user_location.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_create(
 void OpenAPI_expected_ue_behavior_free(OpenAPI_expected_ue_behavior_t *expected_ue_behavior);
 OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_parseFromJSON(cJSON *expected_ue_behaviorJSON);
 cJSON *OpenAPI_expected_ue_behavior_convertToJSON(OpenAPI_expected_ue_behavior_t *expected_ue_behavior);
+bool OpenAPI_expected_ue_behavior_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_expected_ue_behavior_t *expected_ue_behavior);
 OpenAPI_expected_ue_behavior_t *OpenAPI_expected_ue_behavior_copy(OpenAPI_expected_ue_behavior_t *dst, OpenAPI_expected_ue_behavior_t *src);
 
 #ifdef __cplusplus
@@ -200,6 +200,122 @@ end:
     return item;
 }
 
+bool OpenAPI_expected_ue_behaviour_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_expected_ue_behaviour_t *expected_ue_behaviour)
+{
+    if (expected_ue_behaviour == NULL) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [ExpectedUeBehaviour]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [ExpectedUeBehaviour]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "afInstanceId", expected_ue_behaviour->af_instance_id) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", expected_ue_behaviour->reference_id) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (expected_ue_behaviour->stationary_indication) {
+    if (OpenAPI_stationary_indication_rm_writeJSON(writer, "stationaryIndication", expected_ue_behaviour->stationary_indication) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [stationary_indication]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->is_communication_duration_time) {
+    if (OpenAPI_json_write_number(writer, "communicationDurationTime", expected_ue_behaviour->communication_duration_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [communication_duration_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->scheduled_communication_type) {
+    if (OpenAPI_scheduled_communication_type_rm_writeJSON(writer, "scheduledCommunicationType", expected_ue_behaviour->scheduled_communication_type) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [scheduled_communication_type]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->is_periodic_time) {
+    if (OpenAPI_json_write_number(writer, "periodicTime", expected_ue_behaviour->periodic_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [periodic_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->scheduled_communication_time) {
+    if (OpenAPI_scheduled_communication_time_rm_writeJSON(writer, "scheduledCommunicationTime", expected_ue_behaviour->scheduled_communication_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [scheduled_communication_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->expected_umts) {
+    if (OpenAPI_json_write_array_start(writer, "expectedUmts") == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [expected_umts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *expected_umts_node;
+    if (expected_ue_behaviour->expected_umts) {
+        OpenAPI_list_for_each(expected_ue_behaviour->expected_umts, expected_umts_node) {
+            if (OpenAPI_location_area_writeJSON(writer, NULL, expected_umts_node->data) == false) {
+                ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [expected_umts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [expected_umts]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->traffic_profile) {
+    if (OpenAPI_traffic_profile_rm_writeJSON(writer, "trafficProfile", expected_ue_behaviour->traffic_profile) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [traffic_profile]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->battery_indication) {
+    if (OpenAPI_battery_indication_rm_writeJSON(writer, "batteryIndication", expected_ue_behaviour->battery_indication) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [battery_indication]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", expected_ue_behaviour->validity_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", expected_ue_behaviour->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_writeJSON() failed [ExpectedUeBehaviour]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_expected_ue_behaviour_t *OpenAPI_expected_ue_behaviour_parseFromJSON(cJSON *expected_ue_behaviourJSON)
 {
     OpenAPI_expected_ue_behaviour_t *expected_ue_behaviour_local_var = NULL;
@@ -351,7 +467,6 @@ end:
 OpenAPI_expected_ue_behaviour_t *OpenAPI_expected_ue_behaviour_copy(OpenAPI_expected_ue_behaviour_t *dst, OpenAPI_expected_ue_behaviour_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_expected_ue_behaviour_convertToJSON(src);
@@ -360,21 +475,6 @@ OpenAPI_expected_ue_behaviour_t *OpenAPI_expected_ue_behaviour_copy(OpenAPI_expe
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_expected_ue_behaviour_free(dst);
     dst = OpenAPI_expected_ue_behaviour_parseFromJSON(item);
     cJSON_Delete(item);
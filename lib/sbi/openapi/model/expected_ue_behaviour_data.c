@@ -154,6 +154,105 @@ end:
     return item;
 }
 
+bool OpenAPI_expected_ue_behaviour_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_expected_ue_behaviour_data_t *expected_ue_behaviour_data)
+{
+    if (expected_ue_behaviour_data == NULL) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [ExpectedUeBehaviourData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [ExpectedUeBehaviourData]");
+        return false;
+    }
+    if (expected_ue_behaviour_data->stationary_indication) {
+    if (OpenAPI_json_write_string(writer, "stationaryIndication", OpenAPI_stationary_indication_ToString(expected_ue_behaviour_data->stationary_indication)) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [stationary_indication]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->is_communication_duration_time) {
+    if (OpenAPI_json_write_number(writer, "communicationDurationTime", expected_ue_behaviour_data->communication_duration_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [communication_duration_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->is_periodic_time) {
+    if (OpenAPI_json_write_number(writer, "periodicTime", expected_ue_behaviour_data->periodic_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [periodic_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->scheduled_communication_time) {
+    if (OpenAPI_scheduled_communication_time_writeJSON(writer, "scheduledCommunicationTime", expected_ue_behaviour_data->scheduled_communication_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [scheduled_communication_time]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->scheduled_communication_type) {
+    if (OpenAPI_json_write_string(writer, "scheduledCommunicationType", OpenAPI_scheduled_communication_type_ToString(expected_ue_behaviour_data->scheduled_communication_type)) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [scheduled_communication_type]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->expected_umts) {
+    if (OpenAPI_json_write_array_start(writer, "expectedUmts") == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [expected_umts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *expected_umts_node;
+    if (expected_ue_behaviour_data->expected_umts) {
+        OpenAPI_list_for_each(expected_ue_behaviour_data->expected_umts, expected_umts_node) {
+            if (OpenAPI_location_area_writeJSON(writer, NULL, expected_umts_node->data) == false) {
+                ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [expected_umts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [expected_umts]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->traffic_profile) {
+    if (OpenAPI_json_write_string(writer, "trafficProfile", OpenAPI_traffic_profile_ToString(expected_ue_behaviour_data->traffic_profile)) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [traffic_profile]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->battery_indication) {
+    if (OpenAPI_battery_indication_writeJSON(writer, "batteryIndication", expected_ue_behaviour_data->battery_indication) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [battery_indication]");
+        goto end;
+    }
+    }
+
+    if (expected_ue_behaviour_data->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", expected_ue_behaviour_data->validity_time) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_expected_ue_behaviour_data_writeJSON() failed [ExpectedUeBehaviourData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_expected_ue_behaviour_data_t *OpenAPI_expected_ue_behaviour_data_parseFromJSON(cJSON *expected_ue_behaviour_dataJSON)
 {
     OpenAPI_expected_ue_behaviour_data_t *expected_ue_behaviour_data_local_var = NULL;
@@ -282,7 +381,6 @@ end:
 OpenAPI_expected_ue_behaviour_data_t *OpenAPI_expected_ue_behaviour_data_copy(OpenAPI_expected_ue_behaviour_data_t *dst, OpenAPI_expected_ue_behaviour_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_expected_ue_behaviour_data_convertToJSON(src);
@@ -291,21 +389,6 @@ OpenAPI_expected_ue_behaviour_data_t *OpenAPI_expected_ue_behaviour_data_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_expected_ue_behaviour_data_free(dst);
     dst = OpenAPI_expected_ue_behaviour_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,6 +111,82 @@ end:
     return item;
 }
 
+bool OpenAPI_exposure_data_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_exposure_data_change_notification_t *exposure_data_change_notification)
+{
+    if (exposure_data_change_notification == NULL) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [ExposureDataChangeNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [ExposureDataChangeNotification]");
+        return false;
+    }
+    if (exposure_data_change_notification->ue_id) {
+    if (OpenAPI_json_write_string(writer, "ueId", exposure_data_change_notification->ue_id) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [ue_id]");
+        goto end;
+    }
+    }
+
+    if (exposure_data_change_notification->access_and_mobility_data) {
+    if (OpenAPI_access_and_mobility_data_writeJSON(writer, "accessAndMobilityData", exposure_data_change_notification->access_and_mobility_data) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [access_and_mobility_data]");
+        goto end;
+    }
+    }
+
+    if (exposure_data_change_notification->pdu_session_management_data) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionManagementData") == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [pdu_session_management_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_session_management_data_node;
+    if (exposure_data_change_notification->pdu_session_management_data) {
+        OpenAPI_list_for_each(exposure_data_change_notification->pdu_session_management_data, pdu_session_management_data_node) {
+            if (OpenAPI_pdu_session_management_data_writeJSON(writer, NULL, pdu_session_management_data_node->data) == false) {
+                ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [pdu_session_management_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [pdu_session_management_data]");
+        goto end;
+    }
+    }
+
+    if (exposure_data_change_notification->del_resources) {
+    if (OpenAPI_json_write_array_start(writer, "delResources") == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *del_resources_node;
+    OpenAPI_list_for_each(exposure_data_change_notification->del_resources, del_resources_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)del_resources_node->data) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_exposure_data_change_notification_writeJSON() failed [ExposureDataChangeNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_exposure_data_change_notification_t *OpenAPI_exposure_data_change_notification_parseFromJSON(cJSON *exposure_data_change_notificationJSON)
 {
     OpenAPI_exposure_data_change_notification_t *exposure_data_change_notification_local_var = NULL;
@@ -194,7 +270,6 @@ end:
 OpenAPI_exposure_data_change_notification_t *OpenAPI_exposure_data_change_notification_copy(OpenAPI_exposure_data_change_notification_t *dst, OpenAPI_exposure_data_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_exposure_data_change_notification_convertToJSON(src);
@@ -203,21 +278,6 @@ OpenAPI_exposure_data_change_notification_t *OpenAPI_exposure_data_change_notifi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_exposure_data_change_notification_free(dst);
     dst = OpenAPI_exposure_data_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
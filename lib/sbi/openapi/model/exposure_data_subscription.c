@@ -85,6 +85,64 @@ end:
     return item;
 }
 
+bool OpenAPI_exposure_data_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_exposure_data_subscription_t *exposure_data_subscription)
+{
+    if (exposure_data_subscription == NULL) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [ExposureDataSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [ExposureDataSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationUri", exposure_data_subscription->notification_uri) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "monitoredResourceUris") == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_resource_uris_node;
+    OpenAPI_list_for_each(exposure_data_subscription->monitored_resource_uris, monitored_resource_uris_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_resource_uris_node->data) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    if (exposure_data_subscription->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", exposure_data_subscription->expiry) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (exposure_data_subscription->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", exposure_data_subscription->supported_features) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_exposure_data_subscription_writeJSON() failed [ExposureDataSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_exposure_data_subscription_t *OpenAPI_exposure_data_subscription_parseFromJSON(cJSON *exposure_data_subscriptionJSON)
 {
     OpenAPI_exposure_data_subscription_t *exposure_data_subscription_local_var = NULL;
@@ -154,7 +212,6 @@ end:
 OpenAPI_exposure_data_subscription_t *OpenAPI_exposure_data_subscription_copy(OpenAPI_exposure_data_subscription_t *dst, OpenAPI_exposure_data_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_exposure_data_subscription_convertToJSON(src);
@@ -163,21 +220,6 @@ OpenAPI_exposure_data_subscription_t *OpenAPI_exposure_data_subscription_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_exposure_data_subscription_free(dst);
     dst = OpenAPI_exposure_data_subscription_parseFromJSON(item);
     cJSON_Delete(item);
@@ -212,6 +212,151 @@ end:
     return item;
 }
 
+bool OpenAPI_ext_amf_event_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ext_amf_event_subscription_t *ext_amf_event_subscription)
+{
+    if (ext_amf_event_subscription == NULL) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [ExtAmfEventSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [ExtAmfEventSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "eventList") == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [event_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *event_list_node;
+    if (ext_amf_event_subscription->event_list) {
+        OpenAPI_list_for_each(ext_amf_event_subscription->event_list, event_list_node) {
+            if (OpenAPI_amf_event_writeJSON(writer, NULL, event_list_node->data) == false) {
+                ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [event_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [event_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "eventNotifyUri", ext_amf_event_subscription->event_notify_uri) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [event_notify_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "notifyCorrelationId", ext_amf_event_subscription->notify_correlation_id) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [notify_correlation_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfId", ext_amf_event_subscription->nf_id) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [nf_id]");
+        goto end;
+    }
+
+    if (ext_amf_event_subscription->subs_change_notify_uri) {
+    if (OpenAPI_json_write_string(writer, "subsChangeNotifyUri", ext_amf_event_subscription->subs_change_notify_uri) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [subs_change_notify_uri]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->subs_change_notify_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "subsChangeNotifyCorrelationId", ext_amf_event_subscription->subs_change_notify_correlation_id) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [subs_change_notify_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", ext_amf_event_subscription->supi) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", ext_amf_event_subscription->group_id) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", ext_amf_event_subscription->gpsi) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", ext_amf_event_subscription->pei) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->is_any_ue) {
+    if (OpenAPI_json_write_bool(writer, "anyUE", ext_amf_event_subscription->any_ue) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [any_ue]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->options) {
+    if (OpenAPI_amf_event_mode_writeJSON(writer, "options", ext_amf_event_subscription->options) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [options]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->source_nf_type) {
+    if (OpenAPI_json_write_string(writer, "sourceNfType", OpenAPI_nf_type_ToString(ext_amf_event_subscription->source_nf_type)) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [source_nf_type]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->binding_info) {
+    if (OpenAPI_json_write_array_start(writer, "bindingInfo") == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [binding_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *binding_info_node;
+    OpenAPI_list_for_each(ext_amf_event_subscription->binding_info, binding_info_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)binding_info_node->data) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [binding_info]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [binding_info]");
+        goto end;
+    }
+    }
+
+    if (ext_amf_event_subscription->subscribing_nf_type) {
+    if (OpenAPI_json_write_string(writer, "subscribingNfType", OpenAPI_nf_type_ToString(ext_amf_event_subscription->subscribing_nf_type)) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [subscribing_nf_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ext_amf_event_subscription_writeJSON() failed [ExtAmfEventSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ext_amf_event_subscription_t *OpenAPI_ext_amf_event_subscription_parseFromJSON(cJSON *ext_amf_event_subscriptionJSON)
 {
     OpenAPI_ext_amf_event_subscription_t *ext_amf_event_subscription_local_var = NULL;
@@ -418,7 +563,6 @@ end:
 OpenAPI_ext_amf_event_subscription_t *OpenAPI_ext_amf_event_subscription_copy(OpenAPI_ext_amf_event_subscription_t *dst, OpenAPI_ext_amf_event_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ext_amf_event_subscription_convertToJSON(src);
@@ -427,21 +571,6 @@ OpenAPI_ext_amf_event_subscription_t *OpenAPI_ext_amf_event_subscription_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ext_amf_event_subscription_free(dst);
     dst = OpenAPI_ext_amf_event_subscription_parseFromJSON(item);
     cJSON_Delete(item);
@@ -187,6 +187,126 @@ end:
     return item;
 }
 
+bool OpenAPI_ext_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ext_problem_details_t *ext_problem_details)
+{
+    if (ext_problem_details == NULL) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [ExtProblemDetails]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [ExtProblemDetails]");
+        return false;
+    }
+    if (ext_problem_details->type) {
+    if (OpenAPI_json_write_string(writer, "type", ext_problem_details->type) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [type]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->title) {
+    if (OpenAPI_json_write_string(writer, "title", ext_problem_details->title) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [title]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->is_status) {
+    if (OpenAPI_json_write_number(writer, "status", ext_problem_details->status) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [status]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->detail) {
+    if (OpenAPI_json_write_string(writer, "detail", ext_problem_details->detail) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [detail]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->instance) {
+    if (OpenAPI_json_write_string(writer, "instance", ext_problem_details->instance) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [instance]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", ext_problem_details->cause) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->invalid_params) {
+    if (OpenAPI_json_write_array_start(writer, "invalidParams") == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *invalid_params_node;
+    if (ext_problem_details->invalid_params) {
+        OpenAPI_list_for_each(ext_problem_details->invalid_params, invalid_params_node) {
+            if (OpenAPI_invalid_param_writeJSON(writer, NULL, invalid_params_node->data) == false) {
+                ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [invalid_params]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ext_problem_details->supported_features) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->access_token_error) {
+    if (OpenAPI_access_token_err_writeJSON(writer, "accessTokenError", ext_problem_details->access_token_error) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [access_token_error]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->access_token_request) {
+    if (OpenAPI_access_token_req_writeJSON(writer, "accessTokenRequest", ext_problem_details->access_token_request) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [access_token_request]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->nrf_id) {
+    if (OpenAPI_json_write_string(writer, "nrfId", ext_problem_details->nrf_id) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [nrf_id]");
+        goto end;
+    }
+    }
+
+    if (ext_problem_details->is_remote_error) {
+    if (OpenAPI_json_write_bool(writer, "remoteError", ext_problem_details->remote_error) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [remote_error]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ext_problem_details_writeJSON() failed [ExtProblemDetails]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_parseFromJSON(cJSON *ext_problem_detailsJSON)
 {
     OpenAPI_ext_problem_details_t *ext_problem_details_local_var = NULL;
@@ -339,7 +459,6 @@ end:
 OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_copy(OpenAPI_ext_problem_details_t *dst, OpenAPI_ext_problem_details_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ext_problem_details_convertToJSON(src);
@@ -348,21 +467,6 @@ OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_copy(OpenAPI_ext_prob
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ext_problem_details_free(dst);
     dst = OpenAPI_ext_problem_details_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_token_err.h"
 #include "access_token_req.h"
 #include "invalid_param.h"
@@ -59,6 +60,7 @@ OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_create(
 void OpenAPI_ext_problem_details_free(OpenAPI_ext_problem_details_t *ext_problem_details);
 OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_parseFromJSON(cJSON *ext_problem_detailsJSON);
 cJSON *OpenAPI_ext_problem_details_convertToJSON(OpenAPI_ext_problem_details_t *ext_problem_details);
+bool OpenAPI_ext_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ext_problem_details_t *ext_problem_details);
 OpenAPI_ext_problem_details_t *OpenAPI_ext_problem_details_copy(OpenAPI_ext_problem_details_t *dst, OpenAPI_ext_problem_details_t *src);
 
 #ifdef __cplusplus
@@ -91,6 +91,68 @@ end:
     return item;
 }
 
+bool OpenAPI_ext_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ext_snssai_t *ext_snssai)
+{
+    if (ext_snssai == NULL) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [ExtSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [ExtSnssai]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "sst", ext_snssai->sst) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [sst]");
+        goto end;
+    }
+
+    if (ext_snssai->sd) {
+    if (OpenAPI_json_write_string(writer, "sd", ext_snssai->sd) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [sd]");
+        goto end;
+    }
+    }
+
+    if (ext_snssai->sd_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "sdRanges") == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [sd_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sd_ranges_node;
+    if (ext_snssai->sd_ranges) {
+        OpenAPI_list_for_each(ext_snssai->sd_ranges, sd_ranges_node) {
+            if (OpenAPI_sd_range_writeJSON(writer, NULL, sd_ranges_node->data) == false) {
+                ogs_error("OpenAPI_ext_snssai_writeJSON() failed [sd_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [sd_ranges]");
+        goto end;
+    }
+    }
+
+    if (ext_snssai->is_wildcard_sd) {
+    if (OpenAPI_json_write_bool(writer, "wildcardSd", ext_snssai->wildcard_sd) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [wildcard_sd]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ext_snssai_writeJSON() failed [ExtSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_parseFromJSON(cJSON *ext_snssaiJSON)
 {
     OpenAPI_ext_snssai_t *ext_snssai_local_var = NULL;
@@ -169,7 +231,6 @@ end:
 OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_copy(OpenAPI_ext_snssai_t *dst, OpenAPI_ext_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ext_snssai_convertToJSON(src);
@@ -178,21 +239,6 @@ OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_copy(OpenAPI_ext_snssai_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ext_snssai_free(dst);
     dst = OpenAPI_ext_snssai_parseFromJSON(item);
     cJSON_Delete(item);
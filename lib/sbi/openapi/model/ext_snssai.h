@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sd_range.h"
 #include "snssai.h"
 #include "snssai_extension.h"
@@ -39,6 +40,7 @@ OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_create(
 void OpenAPI_ext_snssai_free(OpenAPI_ext_snssai_t *ext_snssai);
 OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_parseFromJSON(cJSON *ext_snssaiJSON);
 cJSON *OpenAPI_ext_snssai_convertToJSON(OpenAPI_ext_snssai_t *ext_snssai);
+bool OpenAPI_ext_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ext_snssai_t *ext_snssai);
 OpenAPI_ext_snssai_t *OpenAPI_ext_snssai_copy(OpenAPI_ext_snssai_t *dst, OpenAPI_ext_snssai_t *src);
 
 #ifdef __cplusplus
@@ -192,6 +192,126 @@ end:
     return item;
 }
 
+bool OpenAPI_extended_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_extended_problem_details_t *extended_problem_details)
+{
+    if (extended_problem_details == NULL) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [ExtendedProblemDetails]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [ExtendedProblemDetails]");
+        return false;
+    }
+    if (extended_problem_details->type) {
+    if (OpenAPI_json_write_string(writer, "type", extended_problem_details->type) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [type]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->title) {
+    if (OpenAPI_json_write_string(writer, "title", extended_problem_details->title) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [title]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->is_status) {
+    if (OpenAPI_json_write_number(writer, "status", extended_problem_details->status) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [status]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->detail) {
+    if (OpenAPI_json_write_string(writer, "detail", extended_problem_details->detail) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [detail]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->instance) {
+    if (OpenAPI_json_write_string(writer, "instance", extended_problem_details->instance) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [instance]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", extended_problem_details->cause) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->invalid_params) {
+    if (OpenAPI_json_write_array_start(writer, "invalidParams") == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *invalid_params_node;
+    if (extended_problem_details->invalid_params) {
+        OpenAPI_list_for_each(extended_problem_details->invalid_params, invalid_params_node) {
+            if (OpenAPI_invalid_param_writeJSON(writer, NULL, invalid_params_node->data) == false) {
+                ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [invalid_params]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", extended_problem_details->supported_features) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->access_token_error) {
+    if (OpenAPI_access_token_err_writeJSON(writer, "accessTokenError", extended_problem_details->access_token_error) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [access_token_error]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->access_token_request) {
+    if (OpenAPI_access_token_req_writeJSON(writer, "accessTokenRequest", extended_problem_details->access_token_request) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [access_token_request]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->nrf_id) {
+    if (OpenAPI_json_write_string(writer, "nrfId", extended_problem_details->nrf_id) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [nrf_id]");
+        goto end;
+    }
+    }
+
+    if (extended_problem_details->acceptable_serv_info) {
+    if (OpenAPI_acceptable_service_info_writeJSON(writer, "acceptableServInfo", extended_problem_details->acceptable_serv_info) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [acceptable_serv_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_extended_problem_details_writeJSON() failed [ExtendedProblemDetails]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_parseFromJSON(cJSON *extended_problem_detailsJSON)
 {
     OpenAPI_extended_problem_details_t *extended_problem_details_local_var = NULL;
@@ -341,7 +461,6 @@ end:
 OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_copy(OpenAPI_extended_problem_details_t *dst, OpenAPI_extended_problem_details_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_extended_problem_details_convertToJSON(src);
@@ -350,21 +469,6 @@ OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_extended_problem_details_free(dst);
     dst = OpenAPI_extended_problem_details_parseFromJSON(item);
     cJSON_Delete(item);
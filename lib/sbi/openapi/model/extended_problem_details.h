@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acceptable_service_info.h"
 #include "access_token_err.h"
 #include "access_token_req.h"
@@ -58,6 +59,7 @@ OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_create(
 void OpenAPI_extended_problem_details_free(OpenAPI_extended_problem_details_t *extended_problem_details);
 OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_parseFromJSON(cJSON *extended_problem_detailsJSON);
 cJSON *OpenAPI_extended_problem_details_convertToJSON(OpenAPI_extended_problem_details_t *extended_problem_details);
+bool OpenAPI_extended_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_extended_problem_details_t *extended_problem_details);
 OpenAPI_extended_problem_details_t *OpenAPI_extended_problem_details_copy(OpenAPI_extended_problem_details_t *dst, OpenAPI_extended_problem_details_t *src);
 
 #ifdef __cplusplus
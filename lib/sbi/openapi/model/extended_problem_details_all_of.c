@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_extended_problem_details_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_extended_problem_details_all_of_t *extended_problem_details_all_of)
+{
+    if (extended_problem_details_all_of == NULL) {
+        ogs_error("OpenAPI_extended_problem_details_all_of_writeJSON() failed [ExtendedProblemDetails_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_extended_problem_details_all_of_writeJSON() failed [ExtendedProblemDetails_allOf]");
+        return false;
+    }
+    if (extended_problem_details_all_of->acceptable_serv_info) {
+    if (OpenAPI_acceptable_service_info_writeJSON(writer, "acceptableServInfo", extended_problem_details_all_of->acceptable_serv_info) == false) {
+        ogs_error("OpenAPI_extended_problem_details_all_of_writeJSON() failed [acceptable_serv_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_extended_problem_details_all_of_writeJSON() failed [ExtendedProblemDetails_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_of_parseFromJSON(cJSON *extended_problem_details_all_ofJSON)
 {
     OpenAPI_extended_problem_details_all_of_t *extended_problem_details_all_of_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_of_copy(OpenAPI_extended_problem_details_all_of_t *dst, OpenAPI_extended_problem_details_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_extended_problem_details_all_of_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_extended_problem_details_all_of_free(dst);
     dst = OpenAPI_extended_problem_details_all_of_parseFromJSON(item);
     cJSON_Delete(item);
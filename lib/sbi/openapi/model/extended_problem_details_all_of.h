@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acceptable_service_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_
 void OpenAPI_extended_problem_details_all_of_free(OpenAPI_extended_problem_details_all_of_t *extended_problem_details_all_of);
 OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_of_parseFromJSON(cJSON *extended_problem_details_all_ofJSON);
 cJSON *OpenAPI_extended_problem_details_all_of_convertToJSON(OpenAPI_extended_problem_details_all_of_t *extended_problem_details_all_of);
+bool OpenAPI_extended_problem_details_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_extended_problem_details_all_of_t *extended_problem_details_all_of);
 OpenAPI_extended_problem_details_all_of_t *OpenAPI_extended_problem_details_all_of_copy(OpenAPI_extended_problem_details_all_of_t *dst, OpenAPI_extended_problem_details_all_of_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "external_client_type_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_external_client_type_t *OpenAPI_external_client_type_create(
 void OpenAPI_external_client_type_free(OpenAPI_external_client_type_t *external_client_type);
 OpenAPI_external_client_type_t *OpenAPI_external_client_type_parseFromJSON(cJSON *external_client_typeJSON);
 cJSON *OpenAPI_external_client_type_convertToJSON(OpenAPI_external_client_type_t *external_client_type);
+bool OpenAPI_external_client_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_external_client_type_t *external_client_type);
 OpenAPI_external_client_type_t *OpenAPI_external_client_type_copy(OpenAPI_external_client_type_t *dst, OpenAPI_external_client_type_t *src);
 
 #ifdef __cplusplus
@@ -115,6 +115,91 @@ end:
     return item;
 }
 
+bool OpenAPI_external_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_external_unrelated_class_t *external_unrelated_class)
+{
+    if (external_unrelated_class == NULL) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [ExternalUnrelatedClass]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [ExternalUnrelatedClass]");
+        return false;
+    }
+    if (external_unrelated_class->lcs_client_externals) {
+    if (OpenAPI_json_write_array_start(writer, "lcsClientExternals") == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_externals]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *lcs_client_externals_node;
+    if (external_unrelated_class->lcs_client_externals) {
+        OpenAPI_list_for_each(external_unrelated_class->lcs_client_externals, lcs_client_externals_node) {
+            if (OpenAPI_lcs_client_external_writeJSON(writer, NULL, lcs_client_externals_node->data) == false) {
+                ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_externals]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_externals]");
+        goto end;
+    }
+    }
+
+    if (external_unrelated_class->af_externals) {
+    if (OpenAPI_json_write_array_start(writer, "afExternals") == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [af_externals]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *af_externals_node;
+    if (external_unrelated_class->af_externals) {
+        OpenAPI_list_for_each(external_unrelated_class->af_externals, af_externals_node) {
+            if (OpenAPI_af_external_writeJSON(writer, NULL, af_externals_node->data) == false) {
+                ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [af_externals]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [af_externals]");
+        goto end;
+    }
+    }
+
+    if (external_unrelated_class->lcs_client_group_externals) {
+    if (OpenAPI_json_write_array_start(writer, "lcsClientGroupExternals") == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_group_externals]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *lcs_client_group_externals_node;
+    if (external_unrelated_class->lcs_client_group_externals) {
+        OpenAPI_list_for_each(external_unrelated_class->lcs_client_group_externals, lcs_client_group_externals_node) {
+            if (OpenAPI_lcs_client_group_external_writeJSON(writer, NULL, lcs_client_group_externals_node->data) == false) {
+                ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_group_externals]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [lcs_client_group_externals]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_external_unrelated_class_writeJSON() failed [ExternalUnrelatedClass]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_parseFromJSON(cJSON *external_unrelated_classJSON)
 {
     OpenAPI_external_unrelated_class_t *external_unrelated_class_local_var = NULL;
@@ -219,7 +304,6 @@ end:
 OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_copy(OpenAPI_external_unrelated_class_t *dst, OpenAPI_external_unrelated_class_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_external_unrelated_class_convertToJSON(src);
@@ -228,21 +312,6 @@ OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_external_unrelated_class_free(dst);
     dst = OpenAPI_external_unrelated_class_parseFromJSON(item);
     cJSON_Delete(item);
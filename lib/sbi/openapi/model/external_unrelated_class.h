@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_external.h"
 #include "lcs_client_external.h"
 #include "lcs_client_group_external.h"
@@ -35,6 +36,7 @@ OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_create(
 void OpenAPI_external_unrelated_class_free(OpenAPI_external_unrelated_class_t *external_unrelated_class);
 OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_parseFromJSON(cJSON *external_unrelated_classJSON);
 cJSON *OpenAPI_external_unrelated_class_convertToJSON(OpenAPI_external_unrelated_class_t *external_unrelated_class);
+bool OpenAPI_external_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_external_unrelated_class_t *external_unrelated_class);
 OpenAPI_external_unrelated_class_t *OpenAPI_external_unrelated_class_copy(OpenAPI_external_unrelated_class_t *dst, OpenAPI_external_unrelated_class_t *src);
 
 #ifdef __cplusplus
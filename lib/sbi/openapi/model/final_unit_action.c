@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_final_unit_action_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_final_unit_action_t *final_unit_action)
+{
+    if (final_unit_action == NULL) {
+        ogs_error("OpenAPI_final_unit_action_writeJSON() failed [FinalUnitAction]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_final_unit_action_writeJSON() failed [FinalUnitAction]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_final_unit_action_writeJSON() failed [FinalUnitAction]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_parseFromJSON(cJSON *final_unit_actionJSON)
 {
     OpenAPI_final_unit_action_t *final_unit_action_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_copy(OpenAPI_final_unit_action_t *dst, OpenAPI_final_unit_action_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_final_unit_action_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_copy(OpenAPI_final_unit_a
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_final_unit_action_free(dst);
     dst = OpenAPI_final_unit_action_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "final_unit_action_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_create(
 void OpenAPI_final_unit_action_free(OpenAPI_final_unit_action_t *final_unit_action);
 OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_parseFromJSON(cJSON *final_unit_actionJSON);
 cJSON *OpenAPI_final_unit_action_convertToJSON(OpenAPI_final_unit_action_t *final_unit_action);
+bool OpenAPI_final_unit_action_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_final_unit_action_t *final_unit_action);
 OpenAPI_final_unit_action_t *OpenAPI_final_unit_action_copy(OpenAPI_final_unit_action_t *dst, OpenAPI_final_unit_action_t *src);
 
 #ifdef __cplusplus
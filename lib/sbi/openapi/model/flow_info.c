@@ -66,6 +66,52 @@ end:
     return item;
 }
 
+bool OpenAPI_flow_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flow_info_t *flow_info)
+{
+    if (flow_info == NULL) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [FlowInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [FlowInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "flowId", flow_info->flow_id) == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [flow_id]");
+        goto end;
+    }
+
+    if (flow_info->flow_descriptions) {
+    if (OpenAPI_json_write_array_start(writer, "flowDescriptions") == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flow_descriptions_node;
+    OpenAPI_list_for_each(flow_info->flow_descriptions, flow_descriptions_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)flow_descriptions_node->data) == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_flow_info_writeJSON() failed [FlowInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_flow_info_t *OpenAPI_flow_info_parseFromJSON(cJSON *flow_infoJSON)
 {
     OpenAPI_flow_info_t *flow_info_local_var = NULL;
@@ -114,7 +160,6 @@ end:
 OpenAPI_flow_info_t *OpenAPI_flow_info_copy(OpenAPI_flow_info_t *dst, OpenAPI_flow_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_flow_info_convertToJSON(src);
@@ -123,21 +168,6 @@ OpenAPI_flow_info_t *OpenAPI_flow_info_copy(OpenAPI_flow_info_t *dst, OpenAPI_fl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_flow_info_free(dst);
     dst = OpenAPI_flow_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_flow_info_t *OpenAPI_flow_info_create(
 void OpenAPI_flow_info_free(OpenAPI_flow_info_t *flow_info);
 OpenAPI_flow_info_t *OpenAPI_flow_info_parseFromJSON(cJSON *flow_infoJSON);
 cJSON *OpenAPI_flow_info_convertToJSON(OpenAPI_flow_info_t *flow_info);
+bool OpenAPI_flow_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flow_info_t *flow_info);
 OpenAPI_flow_info_t *OpenAPI_flow_info_copy(OpenAPI_flow_info_t *dst, OpenAPI_flow_info_t *src);
 
 #ifdef __cplusplus
@@ -123,6 +123,84 @@ end:
     return item;
 }
 
+bool OpenAPI_flow_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flow_information_t *flow_information)
+{
+    if (flow_information == NULL) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [FlowInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [FlowInformation]");
+        return false;
+    }
+    if (flow_information->flow_description) {
+    if (OpenAPI_json_write_string(writer, "flowDescription", flow_information->flow_description) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [flow_description]");
+        goto end;
+    }
+    }
+
+    if (flow_information->eth_flow_description) {
+    if (OpenAPI_eth_flow_description_writeJSON(writer, "ethFlowDescription", flow_information->eth_flow_description) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [eth_flow_description]");
+        goto end;
+    }
+    }
+
+    if (flow_information->pack_filt_id) {
+    if (OpenAPI_json_write_string(writer, "packFiltId", flow_information->pack_filt_id) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [pack_filt_id]");
+        goto end;
+    }
+    }
+
+    if (flow_information->is_packet_filter_usage) {
+    if (OpenAPI_json_write_bool(writer, "packetFilterUsage", flow_information->packet_filter_usage) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [packet_filter_usage]");
+        goto end;
+    }
+    }
+
+    if (flow_information->tos_traffic_class) {
+    if (OpenAPI_json_write_string(writer, "tosTrafficClass", flow_information->tos_traffic_class) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [tos_traffic_class]");
+        goto end;
+    }
+    }
+
+    if (flow_information->spi) {
+    if (OpenAPI_json_write_string(writer, "spi", flow_information->spi) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [spi]");
+        goto end;
+    }
+    }
+
+    if (flow_information->flow_label) {
+    if (OpenAPI_json_write_string(writer, "flowLabel", flow_information->flow_label) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [flow_label]");
+        goto end;
+    }
+    }
+
+    if (flow_information->flow_direction) {
+    if (OpenAPI_json_write_string(writer, "flowDirection", OpenAPI_flow_direction_ToString(flow_information->flow_direction)) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [flow_direction]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_flow_information_writeJSON() failed [FlowInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_flow_information_t *OpenAPI_flow_information_parseFromJSON(cJSON *flow_informationJSON)
 {
     OpenAPI_flow_information_t *flow_information_local_var = NULL;
@@ -218,7 +296,6 @@ end:
 OpenAPI_flow_information_t *OpenAPI_flow_information_copy(OpenAPI_flow_information_t *dst, OpenAPI_flow_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_flow_information_convertToJSON(src);
@@ -227,21 +304,6 @@ OpenAPI_flow_information_t *OpenAPI_flow_information_copy(OpenAPI_flow_informati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_flow_information_free(dst);
     dst = OpenAPI_flow_information_parseFromJSON(item);
     cJSON_Delete(item);
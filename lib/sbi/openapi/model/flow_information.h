@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "eth_flow_description.h"
 #include "flow_direction.h"
 
@@ -46,6 +47,7 @@ OpenAPI_flow_information_t *OpenAPI_flow_information_create(
 void OpenAPI_flow_information_free(OpenAPI_flow_information_t *flow_information);
 OpenAPI_flow_information_t *OpenAPI_flow_information_parseFromJSON(cJSON *flow_informationJSON);
 cJSON *OpenAPI_flow_information_convertToJSON(OpenAPI_flow_information_t *flow_information);
+bool OpenAPI_flow_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flow_information_t *flow_information);
 OpenAPI_flow_information_t *OpenAPI_flow_information_copy(OpenAPI_flow_information_t *dst, OpenAPI_flow_information_t *src);
 
 #ifdef __cplusplus
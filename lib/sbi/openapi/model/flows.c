@@ -88,6 +88,71 @@ end:
     return item;
 }
 
+bool OpenAPI_flows_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flows_t *flows)
+{
+    if (flows == NULL) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [Flows]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [Flows]");
+        return false;
+    }
+    if (flows->cont_vers) {
+    if (OpenAPI_json_write_array_start(writer, "contVers") == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cont_vers_node;
+    OpenAPI_list_for_each(flows->cont_vers, cont_vers_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)cont_vers_node->data) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+    }
+
+    if (flows->f_nums) {
+    if (OpenAPI_json_write_array_start(writer, "fNums") == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [f_nums]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *f_nums_node;
+    OpenAPI_list_for_each(flows->f_nums, f_nums_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)f_nums_node->data) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [f_nums]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [f_nums]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "medCompN", flows->med_comp_n) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [med_comp_n]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_flows_writeJSON() failed [Flows]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_flows_t *OpenAPI_flows_parseFromJSON(cJSON *flowsJSON)
 {
     OpenAPI_flows_t *flows_local_var = NULL;
@@ -157,7 +222,6 @@ end:
 OpenAPI_flows_t *OpenAPI_flows_copy(OpenAPI_flows_t *dst, OpenAPI_flows_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_flows_convertToJSON(src);
@@ -166,21 +230,6 @@ OpenAPI_flows_t *OpenAPI_flows_copy(OpenAPI_flows_t *dst, OpenAPI_flows_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_flows_free(dst);
     dst = OpenAPI_flows_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_flows_t *OpenAPI_flows_create(
 void OpenAPI_flows_free(OpenAPI_flows_t *flows);
 OpenAPI_flows_t *OpenAPI_flows_parseFromJSON(cJSON *flowsJSON);
 cJSON *OpenAPI_flows_convertToJSON(OpenAPI_flows_t *flows);
+bool OpenAPI_flows_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_flows_t *flows);
 OpenAPI_flows_t *OpenAPI_flows_copy(OpenAPI_flows_t *dst, OpenAPI_flows_t *src);
 
 #ifdef __cplusplus
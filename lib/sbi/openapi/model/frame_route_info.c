@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_frame_route_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_frame_route_info_t *frame_route_info)
+{
+    if (frame_route_info == NULL) {
+        ogs_error("OpenAPI_frame_route_info_writeJSON() failed [FrameRouteInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_frame_route_info_writeJSON() failed [FrameRouteInfo]");
+        return false;
+    }
+    if (frame_route_info->ipv4_mask) {
+    if (OpenAPI_json_write_string(writer, "ipv4Mask", frame_route_info->ipv4_mask) == false) {
+        ogs_error("OpenAPI_frame_route_info_writeJSON() failed [ipv4_mask]");
+        goto end;
+    }
+    }
+
+    if (frame_route_info->ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6Prefix", frame_route_info->ipv6_prefix) == false) {
+        ogs_error("OpenAPI_frame_route_info_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_frame_route_info_writeJSON() failed [FrameRouteInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_parseFromJSON(cJSON *frame_route_infoJSON)
 {
     OpenAPI_frame_route_info_t *frame_route_info_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_copy(OpenAPI_frame_route_info_t *dst, OpenAPI_frame_route_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_frame_route_info_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_copy(OpenAPI_frame_route_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_frame_route_info_free(dst);
     dst = OpenAPI_frame_route_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_create(
 void OpenAPI_frame_route_info_free(OpenAPI_frame_route_info_t *frame_route_info);
 OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_parseFromJSON(cJSON *frame_route_infoJSON);
 cJSON *OpenAPI_frame_route_info_convertToJSON(OpenAPI_frame_route_info_t *frame_route_info);
+bool OpenAPI_frame_route_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_frame_route_info_t *frame_route_info);
 OpenAPI_frame_route_info_t *OpenAPI_frame_route_info_copy(OpenAPI_frame_route_info_t *dst, OpenAPI_frame_route_info_t *src);
 
 #ifdef __cplusplus
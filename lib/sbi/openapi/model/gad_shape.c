@@ -51,6 +51,33 @@ end:
     return item;
 }
 
+bool OpenAPI_gad_shape_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gad_shape_t *gad_shape)
+{
+    if (gad_shape == NULL) {
+        ogs_error("OpenAPI_gad_shape_writeJSON() failed [GADShape]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_gad_shape_writeJSON() failed [GADShape]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", gad_shape->shape) == false) {
+        ogs_error("OpenAPI_gad_shape_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_gad_shape_writeJSON() failed [GADShape]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_gad_shape_t *OpenAPI_gad_shape_parseFromJSON(cJSON *gad_shapeJSON)
 {
     OpenAPI_gad_shape_t *gad_shape_local_var = NULL;
@@ -75,7 +102,6 @@ end:
 OpenAPI_gad_shape_t *OpenAPI_gad_shape_copy(OpenAPI_gad_shape_t *dst, OpenAPI_gad_shape_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_gad_shape_convertToJSON(src);
@@ -84,21 +110,6 @@ OpenAPI_gad_shape_t *OpenAPI_gad_shape_copy(OpenAPI_gad_shape_t *dst, OpenAPI_ga
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_gad_shape_free(dst);
     dst = OpenAPI_gad_shape_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "supported_gad_shapes.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_gad_shape_t *OpenAPI_gad_shape_create(
 void OpenAPI_gad_shape_free(OpenAPI_gad_shape_t *gad_shape);
 OpenAPI_gad_shape_t *OpenAPI_gad_shape_parseFromJSON(cJSON *gad_shapeJSON);
 cJSON *OpenAPI_gad_shape_convertToJSON(OpenAPI_gad_shape_t *gad_shape);
+bool OpenAPI_gad_shape_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gad_shape_t *gad_shape);
 OpenAPI_gad_shape_t *OpenAPI_gad_shape_copy(OpenAPI_gad_shape_t *dst, OpenAPI_gad_shape_t *src);
 
 #ifdef __cplusplus
@@ -126,6 +126,90 @@ end:
     return item;
 }
 
+bool OpenAPI_gbr_qos_flow_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gbr_qos_flow_information_t *gbr_qos_flow_information)
+{
+    if (gbr_qos_flow_information == NULL) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [GbrQosFlowInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [GbrQosFlowInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "maxFbrDl", gbr_qos_flow_information->max_fbr_dl) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [max_fbr_dl]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "maxFbrUl", gbr_qos_flow_information->max_fbr_ul) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [max_fbr_ul]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "guaFbrDl", gbr_qos_flow_information->gua_fbr_dl) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [gua_fbr_dl]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "guaFbrUl", gbr_qos_flow_information->gua_fbr_ul) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [gua_fbr_ul]");
+        goto end;
+    }
+
+    if (gbr_qos_flow_information->notif_control) {
+    if (OpenAPI_json_write_string(writer, "notifControl", OpenAPI_notification_control_ToString(gbr_qos_flow_information->notif_control)) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [notif_control]");
+        goto end;
+    }
+    }
+
+    if (gbr_qos_flow_information->is_max_packet_loss_rate_dl) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateDl", gbr_qos_flow_information->max_packet_loss_rate_dl) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [max_packet_loss_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (gbr_qos_flow_information->is_max_packet_loss_rate_ul) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateUl", gbr_qos_flow_information->max_packet_loss_rate_ul) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [max_packet_loss_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (gbr_qos_flow_information->alternative_qos_profile_list) {
+    if (OpenAPI_json_write_array_start(writer, "alternativeQosProfileList") == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [alternative_qos_profile_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alternative_qos_profile_list_node;
+    if (gbr_qos_flow_information->alternative_qos_profile_list) {
+        OpenAPI_list_for_each(gbr_qos_flow_information->alternative_qos_profile_list, alternative_qos_profile_list_node) {
+            if (OpenAPI_alternative_qos_profile_writeJSON(writer, NULL, alternative_qos_profile_list_node->data) == false) {
+                ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [alternative_qos_profile_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [alternative_qos_profile_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_gbr_qos_flow_information_writeJSON() failed [GbrQosFlowInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_gbr_qos_flow_information_t *OpenAPI_gbr_qos_flow_information_parseFromJSON(cJSON *gbr_qos_flow_informationJSON)
 {
     OpenAPI_gbr_qos_flow_information_t *gbr_qos_flow_information_local_var = NULL;
@@ -252,7 +336,6 @@ end:
 OpenAPI_gbr_qos_flow_information_t *OpenAPI_gbr_qos_flow_information_copy(OpenAPI_gbr_qos_flow_information_t *dst, OpenAPI_gbr_qos_flow_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_gbr_qos_flow_information_convertToJSON(src);
@@ -261,21 +344,6 @@ OpenAPI_gbr_qos_flow_information_t *OpenAPI_gbr_qos_flow_information_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_gbr_qos_flow_information_free(dst);
     dst = OpenAPI_gbr_qos_flow_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -159,6 +159,102 @@ end:
     return item;
 }
 
+bool OpenAPI_geographic_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_geographic_area_t *geographic_area)
+{
+    if (geographic_area == NULL) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [GeographicArea]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [GeographicArea]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", geographic_area->shape) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", geographic_area->point) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertainty", geographic_area->uncertainty) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [uncertainty]");
+        goto end;
+    }
+
+    if (OpenAPI_uncertainty_ellipse_writeJSON(writer, "uncertaintyEllipse", geographic_area->uncertainty_ellipse) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [uncertainty_ellipse]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", geographic_area->confidence) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pointList") == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *point_list_node;
+    if (geographic_area->point_list) {
+        OpenAPI_list_for_each(geographic_area->point_list, point_list_node) {
+            if (OpenAPI_geographical_coordinates_writeJSON(writer, NULL, point_list_node->data) == false) {
+                ogs_error("OpenAPI_geographic_area_writeJSON() failed [point_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "altitude", geographic_area->altitude) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyAltitude", geographic_area->uncertainty_altitude) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [uncertainty_altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "innerRadius", geographic_area->inner_radius) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [inner_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyRadius", geographic_area->uncertainty_radius) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [uncertainty_radius]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "offsetAngle", geographic_area->offset_angle) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [offset_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "includedAngle", geographic_area->included_angle) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [included_angle]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_geographic_area_writeJSON() failed [GeographicArea]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_geographic_area_t *OpenAPI_geographic_area_parseFromJSON(cJSON *geographic_areaJSON)
 {
     OpenAPI_geographic_area_t *geographic_area_local_var = NULL;
@@ -339,7 +435,6 @@ end:
 OpenAPI_geographic_area_t *OpenAPI_geographic_area_copy(OpenAPI_geographic_area_t *dst, OpenAPI_geographic_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_geographic_area_convertToJSON(src);
@@ -348,21 +443,6 @@ OpenAPI_geographic_area_t *OpenAPI_geographic_area_copy(OpenAPI_geographic_area_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_geographic_area_free(dst);
     dst = OpenAPI_geographic_area_parseFromJSON(item);
     cJSON_Delete(item);
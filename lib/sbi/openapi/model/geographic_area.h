@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ellipsoid_arc.h"
 #include "geographical_coordinates.h"
 #include "point.h"
@@ -60,6 +61,7 @@ OpenAPI_geographic_area_t *OpenAPI_geographic_area_create(
 void OpenAPI_geographic_area_free(OpenAPI_geographic_area_t *geographic_area);
 OpenAPI_geographic_area_t *OpenAPI_geographic_area_parseFromJSON(cJSON *geographic_areaJSON);
 cJSON *OpenAPI_geographic_area_convertToJSON(OpenAPI_geographic_area_t *geographic_area);
+bool OpenAPI_geographic_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_geographic_area_t *geographic_area);
 OpenAPI_geographic_area_t *OpenAPI_geographic_area_copy(OpenAPI_geographic_area_t *dst, OpenAPI_geographic_area_t *src);
 
 #ifdef __cplusplus
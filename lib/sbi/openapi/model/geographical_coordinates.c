@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_geographical_coordinates_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_geographical_coordinates_t *geographical_coordinates)
+{
+    if (geographical_coordinates == NULL) {
+        ogs_error("OpenAPI_geographical_coordinates_writeJSON() failed [GeographicalCoordinates]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_geographical_coordinates_writeJSON() failed [GeographicalCoordinates]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "lon", geographical_coordinates->lon) == false) {
+        ogs_error("OpenAPI_geographical_coordinates_writeJSON() failed [lon]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "lat", geographical_coordinates->lat) == false) {
+        ogs_error("OpenAPI_geographical_coordinates_writeJSON() failed [lat]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_geographical_coordinates_writeJSON() failed [GeographicalCoordinates]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_geographical_coordinates_t *OpenAPI_geographical_coordinates_parseFromJSON(cJSON *geographical_coordinatesJSON)
 {
     OpenAPI_geographical_coordinates_t *geographical_coordinates_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_geographical_coordinates_t *OpenAPI_geographical_coordinates_copy(OpenAPI_geographical_coordinates_t *dst, OpenAPI_geographical_coordinates_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_geographical_coordinates_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_geographical_coordinates_t *OpenAPI_geographical_coordinates_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_geographical_coordinates_free(dst);
     dst = OpenAPI_geographical_coordinates_parseFromJSON(item);
     cJSON_Delete(item);
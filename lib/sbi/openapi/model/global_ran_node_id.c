@@ -127,6 +127,82 @@ end:
     return item;
 }
 
+bool OpenAPI_global_ran_node_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_global_ran_node_id_t *global_ran_node_id)
+{
+    if (global_ran_node_id == NULL) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [GlobalRanNodeId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [GlobalRanNodeId]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", global_ran_node_id->plmn_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (global_ran_node_id->n3_iwf_id) {
+    if (OpenAPI_json_write_string(writer, "n3IwfId", global_ran_node_id->n3_iwf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [n3_iwf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->g_nb_id) {
+    if (OpenAPI_gnb_id_writeJSON(writer, "gNbId", global_ran_node_id->g_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [g_nb_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->nge_nb_id) {
+    if (OpenAPI_json_write_string(writer, "ngeNbId", global_ran_node_id->nge_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [nge_nb_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->wagf_id) {
+    if (OpenAPI_json_write_string(writer, "wagfId", global_ran_node_id->wagf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [wagf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->tngf_id) {
+    if (OpenAPI_json_write_string(writer, "tngfId", global_ran_node_id->tngf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [tngf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", global_ran_node_id->nid) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id->e_nb_id) {
+    if (OpenAPI_json_write_string(writer, "eNbId", global_ran_node_id->e_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [e_nb_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_writeJSON() failed [GlobalRanNodeId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_parseFromJSON(cJSON *global_ran_node_idJSON)
 {
     OpenAPI_global_ran_node_id_t *global_ran_node_id_local_var = NULL;
@@ -219,7 +295,6 @@ end:
 OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_copy(OpenAPI_global_ran_node_id_t *dst, OpenAPI_global_ran_node_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_global_ran_node_id_convertToJSON(src);
@@ -228,21 +303,6 @@ OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_copy(OpenAPI_global_ran
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_global_ran_node_id_free(dst);
     dst = OpenAPI_global_ran_node_id_parseFromJSON(item);
     cJSON_Delete(item);
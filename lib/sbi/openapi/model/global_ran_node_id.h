@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "gnb_id.h"
 #include "plmn_id.h"
 
@@ -44,6 +45,7 @@ OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_create(
 void OpenAPI_global_ran_node_id_free(OpenAPI_global_ran_node_id_t *global_ran_node_id);
 OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_parseFromJSON(cJSON *global_ran_node_idJSON);
 cJSON *OpenAPI_global_ran_node_id_convertToJSON(OpenAPI_global_ran_node_id_t *global_ran_node_id);
+bool OpenAPI_global_ran_node_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_global_ran_node_id_t *global_ran_node_id);
 OpenAPI_global_ran_node_id_t *OpenAPI_global_ran_node_id_copy(OpenAPI_global_ran_node_id_t *dst, OpenAPI_global_ran_node_id_t *src);
 
 #ifdef __cplusplus
@@ -127,6 +127,82 @@ end:
     return item;
 }
 
+bool OpenAPI_global_ran_node_id_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_global_ran_node_id_1_t *global_ran_node_id_1)
+{
+    if (global_ran_node_id_1 == NULL) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [GlobalRanNodeId_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [GlobalRanNodeId_1]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", global_ran_node_id_1->plmn_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (global_ran_node_id_1->n3_iwf_id) {
+    if (OpenAPI_json_write_string(writer, "n3IwfId", global_ran_node_id_1->n3_iwf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [n3_iwf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->g_nb_id) {
+    if (OpenAPI_gnb_id_writeJSON(writer, "gNbId", global_ran_node_id_1->g_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [g_nb_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->nge_nb_id) {
+    if (OpenAPI_json_write_string(writer, "ngeNbId", global_ran_node_id_1->nge_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [nge_nb_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->wagf_id) {
+    if (OpenAPI_json_write_string(writer, "wagfId", global_ran_node_id_1->wagf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [wagf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->tngf_id) {
+    if (OpenAPI_json_write_string(writer, "tngfId", global_ran_node_id_1->tngf_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [tngf_id]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", global_ran_node_id_1->nid) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (global_ran_node_id_1->e_nb_id) {
+    if (OpenAPI_json_write_string(writer, "eNbId", global_ran_node_id_1->e_nb_id) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [e_nb_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_global_ran_node_id_1_writeJSON() failed [GlobalRanNodeId_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_parseFromJSON(cJSON *global_ran_node_id_1JSON)
 {
     OpenAPI_global_ran_node_id_1_t *global_ran_node_id_1_local_var = NULL;
@@ -219,7 +295,6 @@ end:
 OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_copy(OpenAPI_global_ran_node_id_1_t *dst, OpenAPI_global_ran_node_id_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_global_ran_node_id_1_convertToJSON(src);
@@ -228,21 +303,6 @@ OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_copy(OpenAPI_global
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_global_ran_node_id_1_free(dst);
     dst = OpenAPI_global_ran_node_id_1_parseFromJSON(item);
     cJSON_Delete(item);
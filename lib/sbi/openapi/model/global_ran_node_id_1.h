@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "gnb_id.h"
 #include "plmn_id_1.h"
 
@@ -44,6 +45,7 @@ OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_create(
 void OpenAPI_global_ran_node_id_1_free(OpenAPI_global_ran_node_id_1_t *global_ran_node_id_1);
 OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_parseFromJSON(cJSON *global_ran_node_id_1JSON);
 cJSON *OpenAPI_global_ran_node_id_1_convertToJSON(OpenAPI_global_ran_node_id_1_t *global_ran_node_id_1);
+bool OpenAPI_global_ran_node_id_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_global_ran_node_id_1_t *global_ran_node_id_1);
 OpenAPI_global_ran_node_id_1_t *OpenAPI_global_ran_node_id_1_copy(OpenAPI_global_ran_node_id_1_t *dst, OpenAPI_global_ran_node_id_1_t *src);
 
 #ifdef __cplusplus
@@ -63,6 +63,49 @@ end:
     return item;
 }
 
+bool OpenAPI_gmlc_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gmlc_info_t *gmlc_info)
+{
+    if (gmlc_info == NULL) {
+        ogs_error("OpenAPI_gmlc_info_writeJSON() failed [GmlcInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_gmlc_info_writeJSON() failed [GmlcInfo]");
+        return false;
+    }
+    if (gmlc_info->serving_client_types) {
+    if (OpenAPI_json_write_array_start(writer, "servingClientTypes") == false) {
+        ogs_error("OpenAPI_gmlc_info_writeJSON() failed [serving_client_types]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *serving_client_types_node;
+    if (gmlc_info->serving_client_types) {
+        OpenAPI_list_for_each(gmlc_info->serving_client_types, serving_client_types_node) {
+            if (OpenAPI_external_client_type_writeJSON(writer, NULL, serving_client_types_node->data) == false) {
+                ogs_error("OpenAPI_gmlc_info_writeJSON() failed [serving_client_types]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_gmlc_info_writeJSON() failed [serving_client_types]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_gmlc_info_writeJSON() failed [GmlcInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_parseFromJSON(cJSON *gmlc_infoJSON)
 {
     OpenAPI_gmlc_info_t *gmlc_info_local_var = NULL;
@@ -107,7 +150,6 @@ end:
 OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_copy(OpenAPI_gmlc_info_t *dst, OpenAPI_gmlc_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_gmlc_info_convertToJSON(src);
@@ -116,21 +158,6 @@ OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_copy(OpenAPI_gmlc_info_t *dst, OpenAPI_gm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_gmlc_info_free(dst);
     dst = OpenAPI_gmlc_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "external_client_type.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_create(
 void OpenAPI_gmlc_info_free(OpenAPI_gmlc_info_t *gmlc_info);
 OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_parseFromJSON(cJSON *gmlc_infoJSON);
 cJSON *OpenAPI_gmlc_info_convertToJSON(OpenAPI_gmlc_info_t *gmlc_info);
+bool OpenAPI_gmlc_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gmlc_info_t *gmlc_info);
 OpenAPI_gmlc_info_t *OpenAPI_gmlc_info_copy(OpenAPI_gmlc_info_t *dst, OpenAPI_gmlc_info_t *src);
 
 #ifdef __cplusplus
@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_gnb_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gnb_id_t *gnb_id)
+{
+    if (gnb_id == NULL) {
+        ogs_error("OpenAPI_gnb_id_writeJSON() failed [GNbId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_gnb_id_writeJSON() failed [GNbId]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "bitLength", gnb_id->bit_length) == false) {
+        ogs_error("OpenAPI_gnb_id_writeJSON() failed [bit_length]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "gNBValue", gnb_id->g_nb_value) == false) {
+        ogs_error("OpenAPI_gnb_id_writeJSON() failed [g_nb_value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_gnb_id_writeJSON() failed [GNbId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_gnb_id_t *OpenAPI_gnb_id_parseFromJSON(cJSON *gnb_idJSON)
 {
     OpenAPI_gnb_id_t *gnb_id_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_gnb_id_t *OpenAPI_gnb_id_copy(OpenAPI_gnb_id_t *dst, OpenAPI_gnb_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_gnb_id_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_gnb_id_t *OpenAPI_gnb_id_copy(OpenAPI_gnb_id_t *dst, OpenAPI_gnb_id_t *s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_gnb_id_free(dst);
     dst = OpenAPI_gnb_id_parseFromJSON(item);
     cJSON_Delete(item);
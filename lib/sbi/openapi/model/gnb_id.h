@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_gnb_id_t *OpenAPI_gnb_id_create(
 void OpenAPI_gnb_id_free(OpenAPI_gnb_id_t *gnb_id);
 OpenAPI_gnb_id_t *OpenAPI_gnb_id_parseFromJSON(cJSON *gnb_idJSON);
 cJSON *OpenAPI_gnb_id_convertToJSON(OpenAPI_gnb_id_t *gnb_id);
+bool OpenAPI_gnb_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_gnb_id_t *gnb_id);
 OpenAPI_gnb_id_t *OpenAPI_gnb_id_copy(OpenAPI_gnb_id_t *dst, OpenAPI_gnb_id_t *src);
 
 #ifdef __cplusplus
@@ -83,6 +83,63 @@ end:
     return item;
 }
 
+bool OpenAPI_group_identifiers_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_group_identifiers_t *group_identifiers)
+{
+    if (group_identifiers == NULL) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [GroupIdentifiers]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [GroupIdentifiers]");
+        return false;
+    }
+    if (group_identifiers->ext_group_id) {
+    if (OpenAPI_json_write_string(writer, "extGroupId", group_identifiers->ext_group_id) == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [ext_group_id]");
+        goto end;
+    }
+    }
+
+    if (group_identifiers->int_group_id) {
+    if (OpenAPI_json_write_string(writer, "intGroupId", group_identifiers->int_group_id) == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [int_group_id]");
+        goto end;
+    }
+    }
+
+    if (group_identifiers->ue_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "ueIdList") == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [ue_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ue_id_list_node;
+    if (group_identifiers->ue_id_list) {
+        OpenAPI_list_for_each(group_identifiers->ue_id_list, ue_id_list_node) {
+            if (OpenAPI_ue_id_writeJSON(writer, NULL, ue_id_list_node->data) == false) {
+                ogs_error("OpenAPI_group_identifiers_writeJSON() failed [ue_id_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [ue_id_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_group_identifiers_writeJSON() failed [GroupIdentifiers]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_parseFromJSON(cJSON *group_identifiersJSON)
 {
     OpenAPI_group_identifiers_t *group_identifiers_local_var = NULL;
@@ -147,7 +204,6 @@ end:
 OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_copy(OpenAPI_group_identifiers_t *dst, OpenAPI_group_identifiers_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_group_identifiers_convertToJSON(src);
@@ -156,21 +212,6 @@ OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_copy(OpenAPI_group_identi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_group_identifiers_free(dst);
     dst = OpenAPI_group_identifiers_parseFromJSON(item);
     cJSON_Delete(item);
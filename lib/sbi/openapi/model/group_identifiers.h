@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_id.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_create(
 void OpenAPI_group_identifiers_free(OpenAPI_group_identifiers_t *group_identifiers);
 OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_parseFromJSON(cJSON *group_identifiersJSON);
 cJSON *OpenAPI_group_identifiers_convertToJSON(OpenAPI_group_identifiers_t *group_identifiers);
+bool OpenAPI_group_identifiers_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_group_identifiers_t *group_identifiers);
 OpenAPI_group_identifiers_t *OpenAPI_group_identifiers_copy(OpenAPI_group_identifiers_t *dst, OpenAPI_group_identifiers_t *src);
 
 #ifdef __cplusplus
@@ -59,6 +59,38 @@ end:
     return item;
 }
 
+bool OpenAPI_guami_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_guami_t *guami)
+{
+    if (guami == NULL) {
+        ogs_error("OpenAPI_guami_writeJSON() failed [Guami]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_guami_writeJSON() failed [Guami]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "plmnId", guami->plmn_id) == false) {
+        ogs_error("OpenAPI_guami_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "amfId", guami->amf_id) == false) {
+        ogs_error("OpenAPI_guami_writeJSON() failed [amf_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_guami_writeJSON() failed [Guami]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_guami_t *OpenAPI_guami_parseFromJSON(cJSON *guamiJSON)
 {
     OpenAPI_guami_t *guami_local_var = NULL;
@@ -95,7 +127,6 @@ end:
 OpenAPI_guami_t *OpenAPI_guami_copy(OpenAPI_guami_t *dst, OpenAPI_guami_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_guami_convertToJSON(src);
@@ -104,21 +135,6 @@ OpenAPI_guami_t *OpenAPI_guami_copy(OpenAPI_guami_t *dst, OpenAPI_guami_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_guami_free(dst);
     dst = OpenAPI_guami_parseFromJSON(item);
     cJSON_Delete(item);
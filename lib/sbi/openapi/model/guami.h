@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_nid.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_guami_t *OpenAPI_guami_create(
 void OpenAPI_guami_free(OpenAPI_guami_t *guami);
 OpenAPI_guami_t *OpenAPI_guami_parseFromJSON(cJSON *guamiJSON);
 cJSON *OpenAPI_guami_convertToJSON(OpenAPI_guami_t *guami);
+bool OpenAPI_guami_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_guami_t *guami);
 OpenAPI_guami_t *OpenAPI_guami_copy(OpenAPI_guami_t *dst, OpenAPI_guami_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_guami_list_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_guami_list_cond_t *guami_list_cond)
+{
+    if (guami_list_cond == NULL) {
+        ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [GuamiListCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [GuamiListCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (guami_list_cond->guami_list) {
+        OpenAPI_list_for_each(guami_list_cond->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_guami_list_cond_writeJSON() failed [GuamiListCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_parseFromJSON(cJSON *guami_list_condJSON)
 {
     OpenAPI_guami_list_cond_t *guami_list_cond_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_copy(OpenAPI_guami_list_cond_t *dst, OpenAPI_guami_list_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_guami_list_cond_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_copy(OpenAPI_guami_list_cond_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_guami_list_cond_free(dst);
     dst = OpenAPI_guami_list_cond_parseFromJSON(item);
     cJSON_Delete(item);
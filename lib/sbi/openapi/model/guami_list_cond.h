@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "guami.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_create(
 void OpenAPI_guami_list_cond_free(OpenAPI_guami_list_cond_t *guami_list_cond);
 OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_parseFromJSON(cJSON *guami_list_condJSON);
 cJSON *OpenAPI_guami_list_cond_convertToJSON(OpenAPI_guami_list_cond_t *guami_list_cond);
+bool OpenAPI_guami_list_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_guami_list_cond_t *guami_list_cond);
 OpenAPI_guami_list_cond_t *OpenAPI_guami_list_cond_copy(OpenAPI_guami_list_cond_t *dst, OpenAPI_guami_list_cond_t *src);
 
 #ifdef __cplusplus
@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_hfc_node_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hfc_node_id_t *hfc_node_id)
+{
+    if (hfc_node_id == NULL) {
+        ogs_error("OpenAPI_hfc_node_id_writeJSON() failed [HfcNodeId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hfc_node_id_writeJSON() failed [HfcNodeId]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "hfcNId", hfc_node_id->hfc_nid) == false) {
+        ogs_error("OpenAPI_hfc_node_id_writeJSON() failed [hfc_nid]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hfc_node_id_writeJSON() failed [HfcNodeId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_parseFromJSON(cJSON *hfc_node_idJSON)
 {
     OpenAPI_hfc_node_id_t *hfc_node_id_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_copy(OpenAPI_hfc_node_id_t *dst, OpenAPI_hfc_node_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hfc_node_id_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_copy(OpenAPI_hfc_node_id_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hfc_node_id_free(dst);
     dst = OpenAPI_hfc_node_id_parseFromJSON(item);
     cJSON_Delete(item);
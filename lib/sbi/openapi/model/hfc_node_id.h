@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_create(
 void OpenAPI_hfc_node_id_free(OpenAPI_hfc_node_id_t *hfc_node_id);
 OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_parseFromJSON(cJSON *hfc_node_idJSON);
 cJSON *OpenAPI_hfc_node_id_convertToJSON(OpenAPI_hfc_node_id_t *hfc_node_id);
+bool OpenAPI_hfc_node_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hfc_node_id_t *hfc_node_id);
 OpenAPI_hfc_node_id_t *OpenAPI_hfc_node_id_copy(OpenAPI_hfc_node_id_t *dst, OpenAPI_hfc_node_id_t *src);
 
 #ifdef __cplusplus
@@ -841,6 +841,538 @@ end:
     return item;
 }
 
+bool OpenAPI_hsmf_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hsmf_update_data_t *hsmf_update_data)
+{
+    if (hsmf_update_data == NULL) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [HsmfUpdateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [HsmfUpdateData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "requestIndication", OpenAPI_request_indication_ToString(hsmf_update_data->request_indication)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [request_indication]");
+        goto end;
+    }
+
+    if (hsmf_update_data->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", hsmf_update_data->pei) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->vcn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "vcnTunnelInfo", hsmf_update_data->vcn_tunnel_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [vcn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->icn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "icnTunnelInfo", hsmf_update_data->icn_tunnel_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [icn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->additional_cn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "additionalCnTunnelInfo", hsmf_update_data->additional_cn_tunnel_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [additional_cn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", hsmf_update_data->serving_network) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->an_type) {
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(hsmf_update_data->an_type)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [an_type]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->additional_an_type) {
+    if (OpenAPI_json_write_string(writer, "additionalAnType", OpenAPI_access_type_ToString(hsmf_update_data->additional_an_type)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [additional_an_type]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(hsmf_update_data->rat_type)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", hsmf_update_data->ue_location) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", hsmf_update_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", hsmf_update_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_pause_charging) {
+    if (OpenAPI_json_write_bool(writer, "pauseCharging", hsmf_update_data->pause_charging) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [pause_charging]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_pti) {
+    if (OpenAPI_json_write_number(writer, "pti", hsmf_update_data->pti) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [pti]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->n1_sm_info_from_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoFromUe", hsmf_update_data->n1_sm_info_from_ue) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [n1_sm_info_from_ue]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->unknown_n1_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "unknownN1SmInfo", hsmf_update_data->unknown_n1_sm_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [unknown_n1_sm_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->qos_flows_rel_notify_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsRelNotifyList") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_rel_notify_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_rel_notify_list_node;
+    if (hsmf_update_data->qos_flows_rel_notify_list) {
+        OpenAPI_list_for_each(hsmf_update_data->qos_flows_rel_notify_list, qos_flows_rel_notify_list_node) {
+            if (OpenAPI_qos_flow_item_writeJSON(writer, NULL, qos_flows_rel_notify_list_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_rel_notify_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_rel_notify_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->qos_flows_notify_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsNotifyList") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_notify_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_notify_list_node;
+    if (hsmf_update_data->qos_flows_notify_list) {
+        OpenAPI_list_for_each(hsmf_update_data->qos_flows_notify_list, qos_flows_notify_list_node) {
+            if (OpenAPI_qos_flow_notify_item_writeJSON(writer, NULL, qos_flows_notify_list_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_notify_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [qos_flows_notify_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->notify_list) {
+    if (OpenAPI_json_write_array_start(writer, "NotifyList") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [notify_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *notify_list_node;
+    if (hsmf_update_data->notify_list) {
+        OpenAPI_list_for_each(hsmf_update_data->notify_list, notify_list_node) {
+            if (OpenAPI_pdu_session_notify_item_writeJSON(writer, NULL, notify_list_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [notify_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [notify_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->eps_bearer_id) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerId") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_id_node;
+    OpenAPI_list_for_each(hsmf_update_data->eps_bearer_id, eps_bearer_id_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)eps_bearer_id_node->data) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_ho_preparation_indication) {
+    if (OpenAPI_json_write_bool(writer, "hoPreparationIndication", hsmf_update_data->ho_preparation_indication) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ho_preparation_indication]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->revoke_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "revokeEbiList") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *revoke_ebi_list_node;
+    OpenAPI_list_for_each(hsmf_update_data->revoke_ebi_list, revoke_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)revoke_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(hsmf_update_data->cause)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", hsmf_update_data->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is__5g_mm_cause_value) {
+    if (OpenAPI_json_write_number(writer, "5gMmCauseValue", hsmf_update_data->_5g_mm_cause_value) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [_5g_mm_cause_value]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_always_on_requested) {
+    if (OpenAPI_json_write_bool(writer, "alwaysOnRequested", hsmf_update_data->always_on_requested) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [always_on_requested]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->eps_interworking_ind) {
+    if (OpenAPI_json_write_string(writer, "epsInterworkingInd", OpenAPI_eps_interworking_indication_ToString(hsmf_update_data->eps_interworking_ind)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [eps_interworking_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->secondary_rat_usage_report) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageReport") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_report_node;
+    if (hsmf_update_data->secondary_rat_usage_report) {
+        OpenAPI_list_for_each(hsmf_update_data->secondary_rat_usage_report, secondary_rat_usage_report_node) {
+            if (OpenAPI_secondary_rat_usage_report_writeJSON(writer, NULL, secondary_rat_usage_report_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_report]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->secondary_rat_usage_info) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageInfo") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_info_node;
+    if (hsmf_update_data->secondary_rat_usage_info) {
+        OpenAPI_list_for_each(hsmf_update_data->secondary_rat_usage_info, secondary_rat_usage_info_node) {
+            if (OpenAPI_secondary_rat_usage_info_writeJSON(writer, NULL, secondary_rat_usage_info_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_an_type_can_be_changed) {
+    if (OpenAPI_json_write_bool(writer, "anTypeCanBeChanged", hsmf_update_data->an_type_can_be_changed) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [an_type_can_be_changed]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ma_release_ind) {
+    if (OpenAPI_json_write_string(writer, "maReleaseInd", OpenAPI_ma_release_indication_ToString(hsmf_update_data->ma_release_ind)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ma_release_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_ma_nw_upgrade_ind) {
+    if (OpenAPI_json_write_bool(writer, "maNwUpgradeInd", hsmf_update_data->ma_nw_upgrade_ind) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ma_nw_upgrade_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_ma_request_ind) {
+    if (OpenAPI_json_write_bool(writer, "maRequestInd", hsmf_update_data->ma_request_ind) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ma_request_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->unavailable_access_ind) {
+    if (OpenAPI_json_write_string(writer, "unavailableAccessInd", OpenAPI_unavailable_access_indication_ToString(hsmf_update_data->unavailable_access_ind)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [unavailable_access_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->psa_info) {
+    if (OpenAPI_json_write_array_start(writer, "psaInfo") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [psa_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *psa_info_node;
+    if (hsmf_update_data->psa_info) {
+        OpenAPI_list_for_each(hsmf_update_data->psa_info, psa_info_node) {
+            if (OpenAPI_psa_information_writeJSON(writer, NULL, psa_info_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [psa_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [psa_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ulcl_bp_info) {
+    if (OpenAPI_ulcl_bp_information_writeJSON(writer, "ulclBpInfo", hsmf_update_data->ulcl_bp_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ulcl_bp_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", hsmf_update_data->n4_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", hsmf_update_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", hsmf_update_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->presence_in_ladn) {
+    if (OpenAPI_json_write_string(writer, "presenceInLadn", OpenAPI_presence_state_ToString(hsmf_update_data->presence_in_ladn)) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [presence_in_ladn]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->vsmf_pdu_session_uri) {
+    if (OpenAPI_json_write_string(writer, "vsmfPduSessionUri", hsmf_update_data->vsmf_pdu_session_uri) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [vsmf_pdu_session_uri]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->vsmf_id) {
+    if (OpenAPI_json_write_string(writer, "vsmfId", hsmf_update_data->vsmf_id) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [vsmf_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->v_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "vSmfServiceInstanceId", hsmf_update_data->v_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [v_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ismf_pdu_session_uri) {
+    if (OpenAPI_json_write_string(writer, "ismfPduSessionUri", hsmf_update_data->ismf_pdu_session_uri) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ismf_pdu_session_uri]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->ismf_id) {
+    if (OpenAPI_json_write_string(writer, "ismfId", hsmf_update_data->ismf_id) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [ismf_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->i_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "iSmfServiceInstanceId", hsmf_update_data->i_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [i_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->is_dl_serving_plmn_rate_ctl) {
+    if (OpenAPI_json_write_number(writer, "dlServingPlmnRateCtl", hsmf_update_data->dl_serving_plmn_rate_ctl) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [dl_serving_plmn_rate_ctl]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(hsmf_update_data->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", hsmf_update_data->supported_features) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->roaming_charging_profile) {
+    if (OpenAPI_roaming_charging_profile_writeJSON(writer, "roamingChargingProfile", hsmf_update_data->roaming_charging_profile) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [roaming_charging_profile]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->mo_exp_data_counter) {
+    if (OpenAPI_mo_exp_data_counter_writeJSON(writer, "moExpDataCounter", hsmf_update_data->mo_exp_data_counter) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [mo_exp_data_counter]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->vplmn_qos) {
+    if (OpenAPI_vplmn_qos_writeJSON(writer, "vplmnQos", hsmf_update_data->vplmn_qos) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [vplmn_qos]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->security_result) {
+    if (OpenAPI_security_result_writeJSON(writer, "securityResult", hsmf_update_data->security_result) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [security_result]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->up_security_info) {
+    if (OpenAPI_up_security_info_writeJSON(writer, "upSecurityInfo", hsmf_update_data->up_security_info) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [up_security_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->amf_nf_id) {
+    if (OpenAPI_json_write_string(writer, "amfNfId", hsmf_update_data->amf_nf_id) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [amf_nf_id]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_data->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", hsmf_update_data->guami) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_data_writeJSON() failed [HsmfUpdateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_parseFromJSON(cJSON *hsmf_update_dataJSON)
 {
     OpenAPI_hsmf_update_data_t *hsmf_update_data_local_var = NULL;
@@ -1559,7 +2091,6 @@ end:
 OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_copy(OpenAPI_hsmf_update_data_t *dst, OpenAPI_hsmf_update_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hsmf_update_data_convertToJSON(src);
@@ -1568,21 +2099,6 @@ OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_copy(OpenAPI_hsmf_update_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hsmf_update_data_free(dst);
     dst = OpenAPI_hsmf_update_data_parseFromJSON(item);
     cJSON_Delete(item);
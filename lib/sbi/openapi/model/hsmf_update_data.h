@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "cause.h"
 #include "eps_interworking_indication.h"
@@ -183,6 +184,7 @@ OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_create(
 void OpenAPI_hsmf_update_data_free(OpenAPI_hsmf_update_data_t *hsmf_update_data);
 OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_parseFromJSON(cJSON *hsmf_update_dataJSON);
 cJSON *OpenAPI_hsmf_update_data_convertToJSON(OpenAPI_hsmf_update_data_t *hsmf_update_data);
+bool OpenAPI_hsmf_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hsmf_update_data_t *hsmf_update_data);
 OpenAPI_hsmf_update_data_t *OpenAPI_hsmf_update_data_copy(OpenAPI_hsmf_update_data_t *dst, OpenAPI_hsmf_update_data_t *src);
 
 #ifdef __cplusplus
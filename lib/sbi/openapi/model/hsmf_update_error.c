@@ -109,6 +109,68 @@ end:
     return item;
 }
 
+bool OpenAPI_hsmf_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hsmf_update_error_t *hsmf_update_error)
+{
+    if (hsmf_update_error == NULL) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [HsmfUpdateError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [HsmfUpdateError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", hsmf_update_error->error) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (hsmf_update_error->is_pti) {
+    if (OpenAPI_json_write_number(writer, "pti", hsmf_update_error->pti) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [pti]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_error->n1sm_cause) {
+    if (OpenAPI_json_write_string(writer, "n1smCause", hsmf_update_error->n1sm_cause) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [n1sm_cause]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_error->n1_sm_info_to_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoToUe", hsmf_update_error->n1_sm_info_to_ue) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [n1_sm_info_to_ue]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_error->is_back_off_timer) {
+    if (OpenAPI_json_write_number(writer, "backOffTimer", hsmf_update_error->back_off_timer) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [back_off_timer]");
+        goto end;
+    }
+    }
+
+    if (hsmf_update_error->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", hsmf_update_error->recovery_time) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_update_error_writeJSON() failed [HsmfUpdateError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_parseFromJSON(cJSON *hsmf_update_errorJSON)
 {
     OpenAPI_hsmf_update_error_t *hsmf_update_error_local_var = NULL;
@@ -183,7 +245,6 @@ end:
 OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_copy(OpenAPI_hsmf_update_error_t *dst, OpenAPI_hsmf_update_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hsmf_update_error_convertToJSON(src);
@@ -192,21 +253,6 @@ OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_copy(OpenAPI_hsmf_update_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hsmf_update_error_free(dst);
     dst = OpenAPI_hsmf_update_error_parseFromJSON(item);
     cJSON_Delete(item);
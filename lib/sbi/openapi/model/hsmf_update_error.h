@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "problem_details.h"
 #include "ref_to_binary_data.h"
 
@@ -44,6 +45,7 @@ OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_create(
 void OpenAPI_hsmf_update_error_free(OpenAPI_hsmf_update_error_t *hsmf_update_error);
 OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_parseFromJSON(cJSON *hsmf_update_errorJSON);
 cJSON *OpenAPI_hsmf_update_error_convertToJSON(OpenAPI_hsmf_update_error_t *hsmf_update_error);
+bool OpenAPI_hsmf_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hsmf_update_error_t *hsmf_update_error);
 OpenAPI_hsmf_update_error_t *OpenAPI_hsmf_update_error_copy(OpenAPI_hsmf_update_error_t *dst, OpenAPI_hsmf_update_error_t *src);
 
 #ifdef __cplusplus
@@ -289,6 +289,180 @@ end:
     return item;
 }
 
+bool OpenAPI_hsmf_updated_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hsmf_updated_data_t *hsmf_updated_data)
+{
+    if (hsmf_updated_data == NULL) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [HsmfUpdatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [HsmfUpdatedData]");
+        return false;
+    }
+    if (hsmf_updated_data->n1_sm_info_to_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoToUe", hsmf_updated_data->n1_sm_info_to_ue) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [n1_sm_info_to_ue]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", hsmf_updated_data->n4_info) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", hsmf_updated_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", hsmf_updated_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(hsmf_updated_data->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", hsmf_updated_data->supported_features) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->roaming_charging_profile) {
+    if (OpenAPI_roaming_charging_profile_writeJSON(writer, "roamingChargingProfile", hsmf_updated_data->roaming_charging_profile) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [roaming_charging_profile]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->up_security) {
+    if (OpenAPI_up_security_writeJSON(writer, "upSecurity", hsmf_updated_data->up_security) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [up_security]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->max_integrity_protected_data_rate_ul) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateUl", OpenAPI_max_integrity_protected_data_rate_ToString(hsmf_updated_data->max_integrity_protected_data_rate_ul)) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [max_integrity_protected_data_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->max_integrity_protected_data_rate_dl) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateDl", OpenAPI_max_integrity_protected_data_rate_ToString(hsmf_updated_data->max_integrity_protected_data_rate_dl)) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [max_integrity_protected_data_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->is_ipv6_multi_homing_ind) {
+    if (OpenAPI_json_write_bool(writer, "ipv6MultiHomingInd", hsmf_updated_data->ipv6_multi_homing_ind) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [ipv6_multi_homing_ind]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->qos_flows_setup_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsSetupList") == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [qos_flows_setup_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_setup_list_node;
+    if (hsmf_updated_data->qos_flows_setup_list) {
+        OpenAPI_list_for_each(hsmf_updated_data->qos_flows_setup_list, qos_flows_setup_list_node) {
+            if (OpenAPI_qos_flow_setup_item_writeJSON(writer, NULL, qos_flows_setup_list_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [qos_flows_setup_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [qos_flows_setup_list]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->session_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "sessionAmbr", hsmf_updated_data->session_ambr) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->eps_pdn_cnx_info) {
+    if (OpenAPI_eps_pdn_cnx_info_writeJSON(writer, "epsPdnCnxInfo", hsmf_updated_data->eps_pdn_cnx_info) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [eps_pdn_cnx_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->eps_bearer_info) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerInfo") == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_info_node;
+    if (hsmf_updated_data->eps_bearer_info) {
+        OpenAPI_list_for_each(hsmf_updated_data->eps_bearer_info, eps_bearer_info_node) {
+            if (OpenAPI_eps_bearer_info_writeJSON(writer, NULL, eps_bearer_info_node->data) == false) {
+                ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [eps_bearer_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+    }
+
+    if (hsmf_updated_data->is_pti) {
+    if (OpenAPI_json_write_number(writer, "pti", hsmf_updated_data->pti) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [pti]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hsmf_updated_data_writeJSON() failed [HsmfUpdatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hsmf_updated_data_t *OpenAPI_hsmf_updated_data_parseFromJSON(cJSON *hsmf_updated_dataJSON)
 {
     OpenAPI_hsmf_updated_data_t *hsmf_updated_data_local_var = NULL;
@@ -504,7 +678,6 @@ end:
 OpenAPI_hsmf_updated_data_t *OpenAPI_hsmf_updated_data_copy(OpenAPI_hsmf_updated_data_t *dst, OpenAPI_hsmf_updated_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hsmf_updated_data_convertToJSON(src);
@@ -513,21 +686,6 @@ OpenAPI_hsmf_updated_data_t *OpenAPI_hsmf_updated_data_copy(OpenAPI_hsmf_updated
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hsmf_updated_data_free(dst);
     dst = OpenAPI_hsmf_updated_data_parseFromJSON(item);
     cJSON_Delete(item);
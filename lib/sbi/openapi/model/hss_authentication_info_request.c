@@ -111,6 +111,73 @@ end:
     return item;
 }
 
+bool OpenAPI_hss_authentication_info_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_authentication_info_request_t *hss_authentication_info_request)
+{
+    if (hss_authentication_info_request == NULL) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [HssAuthenticationInfoRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [HssAuthenticationInfoRequest]");
+        return false;
+    }
+    if (hss_authentication_info_request->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", hss_authentication_info_request->supported_features) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "hssAuthType", OpenAPI_hss_auth_type_ToString(hss_authentication_info_request->hss_auth_type)) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [hss_auth_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "numOfRequestedVectors", hss_authentication_info_request->num_of_requested_vectors) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [num_of_requested_vectors]");
+        goto end;
+    }
+
+    if (hss_authentication_info_request->requesting_node_type) {
+    if (OpenAPI_json_write_string(writer, "requestingNodeType", OpenAPI_node_type_ToString(hss_authentication_info_request->requesting_node_type)) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [requesting_node_type]");
+        goto end;
+    }
+    }
+
+    if (hss_authentication_info_request->serving_network_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "servingNetworkId", hss_authentication_info_request->serving_network_id) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [serving_network_id]");
+        goto end;
+    }
+    }
+
+    if (hss_authentication_info_request->resynchronization_info) {
+    if (OpenAPI_resynchronization_info_writeJSON(writer, "resynchronizationInfo", hss_authentication_info_request->resynchronization_info) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [resynchronization_info]");
+        goto end;
+    }
+    }
+
+    if (hss_authentication_info_request->an_id) {
+    if (OpenAPI_json_write_string(writer, "anId", OpenAPI_access_network_id_ToString(hss_authentication_info_request->an_id)) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [an_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_request_writeJSON() failed [HssAuthenticationInfoRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hss_authentication_info_request_t *OpenAPI_hss_authentication_info_request_parseFromJSON(cJSON *hss_authentication_info_requestJSON)
 {
     OpenAPI_hss_authentication_info_request_t *hss_authentication_info_request_local_var = NULL;
@@ -202,7 +269,6 @@ end:
 OpenAPI_hss_authentication_info_request_t *OpenAPI_hss_authentication_info_request_copy(OpenAPI_hss_authentication_info_request_t *dst, OpenAPI_hss_authentication_info_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_info_request_convertToJSON(src);
@@ -211,21 +277,6 @@ OpenAPI_hss_authentication_info_request_t *OpenAPI_hss_authentication_info_reque
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_info_request_free(dst);
     dst = OpenAPI_hss_authentication_info_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -61,6 +61,40 @@ end:
     return item;
 }
 
+bool OpenAPI_hss_authentication_info_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_authentication_info_result_t *hss_authentication_info_result)
+{
+    if (hss_authentication_info_result == NULL) {
+        ogs_error("OpenAPI_hss_authentication_info_result_writeJSON() failed [HssAuthenticationInfoResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_result_writeJSON() failed [HssAuthenticationInfoResult]");
+        return false;
+    }
+    if (hss_authentication_info_result->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", hss_authentication_info_result->supported_features) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_result_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_hss_authentication_vectors_writeJSON(writer, "hssAuthenticationVectors", hss_authentication_info_result->hss_authentication_vectors) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_result_writeJSON() failed [hss_authentication_vectors]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hss_authentication_info_result_writeJSON() failed [HssAuthenticationInfoResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result_parseFromJSON(cJSON *hss_authentication_info_resultJSON)
 {
     OpenAPI_hss_authentication_info_result_t *hss_authentication_info_result_local_var = NULL;
@@ -95,7 +129,6 @@ end:
 OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result_copy(OpenAPI_hss_authentication_info_result_t *dst, OpenAPI_hss_authentication_info_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_info_result_convertToJSON(src);
@@ -104,21 +137,6 @@ OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_info_result_free(dst);
     dst = OpenAPI_hss_authentication_info_result_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "hss_authentication_vectors.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result
 void OpenAPI_hss_authentication_info_result_free(OpenAPI_hss_authentication_info_result_t *hss_authentication_info_result);
 OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result_parseFromJSON(cJSON *hss_authentication_info_resultJSON);
 cJSON *OpenAPI_hss_authentication_info_result_convertToJSON(OpenAPI_hss_authentication_info_result_t *hss_authentication_info_result);
+bool OpenAPI_hss_authentication_info_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_authentication_info_result_t *hss_authentication_info_result);
 OpenAPI_hss_authentication_info_result_t *OpenAPI_hss_authentication_info_result_copy(OpenAPI_hss_authentication_info_result_t *dst, OpenAPI_hss_authentication_info_result_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_hss_authentication_vectors_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_authentication_vectors_t *hss_authentication_vectors)
+{
+    if (hss_authentication_vectors == NULL) {
+        ogs_error("OpenAPI_hss_authentication_vectors_writeJSON() failed [HssAuthenticationVectors]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hss_authentication_vectors_writeJSON() failed [HssAuthenticationVectors]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hss_authentication_vectors_writeJSON() failed [HssAuthenticationVectors]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_parseFromJSON(cJSON *hss_authentication_vectorsJSON)
 {
     OpenAPI_hss_authentication_vectors_t *hss_authentication_vectors_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_copy(OpenAPI_hss_authentication_vectors_t *dst, OpenAPI_hss_authentication_vectors_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_authentication_vectors_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_authentication_vectors_free(dst);
     dst = OpenAPI_hss_authentication_vectors_parseFromJSON(item);
     cJSON_Delete(item);
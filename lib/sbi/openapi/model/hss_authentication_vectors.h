@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "av_eap_aka_prime.h"
 #include "av_eps_aka.h"
 #include "av_ims_gba_eap_aka.h"
@@ -29,6 +30,7 @@ OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_create(
 void OpenAPI_hss_authentication_vectors_free(OpenAPI_hss_authentication_vectors_t *hss_authentication_vectors);
 OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_parseFromJSON(cJSON *hss_authentication_vectorsJSON);
 cJSON *OpenAPI_hss_authentication_vectors_convertToJSON(OpenAPI_hss_authentication_vectors_t *hss_authentication_vectors);
+bool OpenAPI_hss_authentication_vectors_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_authentication_vectors_t *hss_authentication_vectors);
 OpenAPI_hss_authentication_vectors_t *OpenAPI_hss_authentication_vectors_copy(OpenAPI_hss_authentication_vectors_t *dst, OpenAPI_hss_authentication_vectors_t *src);
 
 #ifdef __cplusplus
@@ -151,6 +151,119 @@ end:
     return item;
 }
 
+bool OpenAPI_hss_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_info_t *hss_info)
+{
+    if (hss_info == NULL) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [HssInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [HssInfo]");
+        return false;
+    }
+    if (hss_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", hss_info->group_id) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (hss_info->imsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "imsiRanges") == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [imsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *imsi_ranges_node;
+    if (hss_info->imsi_ranges) {
+        OpenAPI_list_for_each(hss_info->imsi_ranges, imsi_ranges_node) {
+            if (OpenAPI_imsi_range_writeJSON(writer, NULL, imsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_hss_info_writeJSON() failed [imsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [imsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (hss_info->ims_private_identity_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "imsPrivateIdentityRanges") == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_private_identity_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ims_private_identity_ranges_node;
+    if (hss_info->ims_private_identity_ranges) {
+        OpenAPI_list_for_each(hss_info->ims_private_identity_ranges, ims_private_identity_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, ims_private_identity_ranges_node->data) == false) {
+                ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_private_identity_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_private_identity_ranges]");
+        goto end;
+    }
+    }
+
+    if (hss_info->ims_public_identity_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "imsPublicIdentityRanges") == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_public_identity_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ims_public_identity_ranges_node;
+    if (hss_info->ims_public_identity_ranges) {
+        OpenAPI_list_for_each(hss_info->ims_public_identity_ranges, ims_public_identity_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, ims_public_identity_ranges_node->data) == false) {
+                ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_public_identity_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [ims_public_identity_ranges]");
+        goto end;
+    }
+    }
+
+    if (hss_info->msisdn_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "msisdnRanges") == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [msisdn_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *msisdn_ranges_node;
+    if (hss_info->msisdn_ranges) {
+        OpenAPI_list_for_each(hss_info->msisdn_ranges, msisdn_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, msisdn_ranges_node->data) == false) {
+                ogs_error("OpenAPI_hss_info_writeJSON() failed [msisdn_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [msisdn_ranges]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_hss_info_writeJSON() failed [HssInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_hss_info_t *OpenAPI_hss_info_parseFromJSON(cJSON *hss_infoJSON)
 {
     OpenAPI_hss_info_t *hss_info_local_var = NULL;
@@ -295,7 +408,6 @@ end:
 OpenAPI_hss_info_t *OpenAPI_hss_info_copy(OpenAPI_hss_info_t *dst, OpenAPI_hss_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_hss_info_convertToJSON(src);
@@ -304,21 +416,6 @@ OpenAPI_hss_info_t *OpenAPI_hss_info_copy(OpenAPI_hss_info_t *dst, OpenAPI_hss_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_hss_info_free(dst);
     dst = OpenAPI_hss_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "identity_range.h"
 #include "imsi_range.h"
 
@@ -38,6 +39,7 @@ OpenAPI_hss_info_t *OpenAPI_hss_info_create(
 void OpenAPI_hss_info_free(OpenAPI_hss_info_t *hss_info);
 OpenAPI_hss_info_t *OpenAPI_hss_info_parseFromJSON(cJSON *hss_infoJSON);
 cJSON *OpenAPI_hss_info_convertToJSON(OpenAPI_hss_info_t *hss_info);
+bool OpenAPI_hss_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_hss_info_t *hss_info);
 OpenAPI_hss_info_t *OpenAPI_hss_info_copy(OpenAPI_hss_info_t *dst, OpenAPI_hss_info_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,47 @@ end:
     return item;
 }
 
+bool OpenAPI_id_translation_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_id_translation_result_t *id_translation_result)
+{
+    if (id_translation_result == NULL) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [IdTranslationResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [IdTranslationResult]");
+        return false;
+    }
+    if (id_translation_result->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", id_translation_result->supported_features) == false) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "supi", id_translation_result->supi) == false) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (id_translation_result->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", id_translation_result->gpsi) == false) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_id_translation_result_writeJSON() failed [IdTranslationResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_parseFromJSON(cJSON *id_translation_resultJSON)
 {
     OpenAPI_id_translation_result_t *id_translation_result_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_copy(OpenAPI_id_translation_result_t *dst, OpenAPI_id_translation_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_id_translation_result_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_copy(OpenAPI_id_t
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_id_translation_result_free(dst);
     dst = OpenAPI_id_translation_result_parseFromJSON(item);
     cJSON_Delete(item);
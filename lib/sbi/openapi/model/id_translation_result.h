@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_create(
 void OpenAPI_id_translation_result_free(OpenAPI_id_translation_result_t *id_translation_result);
 OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_parseFromJSON(cJSON *id_translation_resultJSON);
 cJSON *OpenAPI_id_translation_result_convertToJSON(OpenAPI_id_translation_result_t *id_translation_result);
+bool OpenAPI_id_translation_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_id_translation_result_t *id_translation_result);
 OpenAPI_id_translation_result_t *OpenAPI_id_translation_result_copy(OpenAPI_id_translation_result_t *dst, OpenAPI_id_translation_result_t *src);
 
 #ifdef __cplusplus
@@ -81,6 +81,66 @@ end:
     return item;
 }
 
+bool OpenAPI_identity_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_identity_data_t *identity_data)
+{
+    if (identity_data == NULL) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [IdentityData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [IdentityData]");
+        return false;
+    }
+    if (identity_data->supi_list) {
+    if (OpenAPI_json_write_array_start(writer, "supiList") == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [supi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_list_node;
+    OpenAPI_list_for_each(identity_data->supi_list, supi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)supi_list_node->data) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [supi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [supi_list]");
+        goto end;
+    }
+    }
+
+    if (identity_data->gpsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiList") == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_list_node;
+    OpenAPI_list_for_each(identity_data->gpsi_list, gpsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gpsi_list_node->data) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_identity_data_writeJSON() failed [IdentityData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_identity_data_t *OpenAPI_identity_data_parseFromJSON(cJSON *identity_dataJSON)
 {
     OpenAPI_identity_data_t *identity_data_local_var = NULL;
@@ -137,7 +197,6 @@ end:
 OpenAPI_identity_data_t *OpenAPI_identity_data_copy(OpenAPI_identity_data_t *dst, OpenAPI_identity_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_identity_data_convertToJSON(src);
@@ -146,21 +205,6 @@ OpenAPI_identity_data_t *OpenAPI_identity_data_copy(OpenAPI_identity_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_identity_data_free(dst);
     dst = OpenAPI_identity_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_identity_data_t *OpenAPI_identity_data_create(
 void OpenAPI_identity_data_free(OpenAPI_identity_data_t *identity_data);
 OpenAPI_identity_data_t *OpenAPI_identity_data_parseFromJSON(cJSON *identity_dataJSON);
 cJSON *OpenAPI_identity_data_convertToJSON(OpenAPI_identity_data_t *identity_data);
+bool OpenAPI_identity_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_identity_data_t *identity_data);
 OpenAPI_identity_data_t *OpenAPI_identity_data_copy(OpenAPI_identity_data_t *dst, OpenAPI_identity_data_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_identity_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_identity_range_t *identity_range)
+{
+    if (identity_range == NULL) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [IdentityRange]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [IdentityRange]");
+        return false;
+    }
+    if (identity_range->start) {
+    if (OpenAPI_json_write_string(writer, "start", identity_range->start) == false) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [start]");
+        goto end;
+    }
+    }
+
+    if (identity_range->end) {
+    if (OpenAPI_json_write_string(writer, "end", identity_range->end) == false) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [end]");
+        goto end;
+    }
+    }
+
+    if (identity_range->pattern) {
+    if (OpenAPI_json_write_string(writer, "pattern", identity_range->pattern) == false) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [pattern]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_identity_range_writeJSON() failed [IdentityRange]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_identity_range_t *OpenAPI_identity_range_parseFromJSON(cJSON *identity_rangeJSON)
 {
     OpenAPI_identity_range_t *identity_range_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_identity_range_t *OpenAPI_identity_range_copy(OpenAPI_identity_range_t *dst, OpenAPI_identity_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_identity_range_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_identity_range_t *OpenAPI_identity_range_copy(OpenAPI_identity_range_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_identity_range_free(dst);
     dst = OpenAPI_identity_range_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_identity_range_t *OpenAPI_identity_range_create(
 void OpenAPI_identity_range_free(OpenAPI_identity_range_t *identity_range);
 OpenAPI_identity_range_t *OpenAPI_identity_range_parseFromJSON(cJSON *identity_rangeJSON);
 cJSON *OpenAPI_identity_range_convertToJSON(OpenAPI_identity_range_t *identity_range);
+bool OpenAPI_identity_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_identity_range_t *identity_range);
 OpenAPI_identity_range_t *OpenAPI_identity_range_copy(OpenAPI_identity_range_t *dst, OpenAPI_identity_range_t *src);
 
 #ifdef __cplusplus
@@ -283,6 +283,228 @@ end:
     return item;
 }
 
+bool OpenAPI_immediate_mdt_conf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_immediate_mdt_conf_t *immediate_mdt_conf)
+{
+    if (immediate_mdt_conf == NULL) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [ImmediateMdtConf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [ImmediateMdtConf]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "jobType", OpenAPI_job_type_ToString(immediate_mdt_conf->job_type)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [job_type]");
+        goto end;
+    }
+
+    if (immediate_mdt_conf->measurement_lte_list) {
+    if (OpenAPI_json_write_array_start(writer, "measurementLteList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_lte_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *measurement_lte_list_node;
+    OpenAPI_list_for_each(immediate_mdt_conf->measurement_lte_list, measurement_lte_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_measurement_lte_for_mdt_ToString((intptr_t)measurement_lte_list_node->data)) == false) {
+            ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_lte_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_lte_list]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->measurement_nr_list) {
+    if (OpenAPI_json_write_array_start(writer, "measurementNrList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_nr_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *measurement_nr_list_node;
+    OpenAPI_list_for_each(immediate_mdt_conf->measurement_nr_list, measurement_nr_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_measurement_nr_for_mdt_ToString((intptr_t)measurement_nr_list_node->data)) == false) {
+            ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_nr_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_nr_list]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->reporting_trigger_list) {
+    if (OpenAPI_json_write_array_start(writer, "reportingTriggerList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [reporting_trigger_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *reporting_trigger_list_node;
+    OpenAPI_list_for_each(immediate_mdt_conf->reporting_trigger_list, reporting_trigger_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_reporting_trigger_ToString((intptr_t)reporting_trigger_list_node->data)) == false) {
+            ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [reporting_trigger_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [reporting_trigger_list]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->report_interval) {
+    if (OpenAPI_json_write_string(writer, "reportInterval", OpenAPI_report_interval_mdt_ToString(immediate_mdt_conf->report_interval)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [report_interval]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->report_interval_nr) {
+    if (OpenAPI_json_write_string(writer, "reportIntervalNr", OpenAPI_report_interval_nr_mdt_ToString(immediate_mdt_conf->report_interval_nr)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [report_interval_nr]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->report_amount) {
+    if (OpenAPI_json_write_string(writer, "reportAmount", OpenAPI_report_amount_mdt_ToString(immediate_mdt_conf->report_amount)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [report_amount]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->is_event_threshold_rsrp) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrp", immediate_mdt_conf->event_threshold_rsrp) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [event_threshold_rsrp]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->is_event_threshold_rsrq) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrq", immediate_mdt_conf->event_threshold_rsrq) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [event_threshold_rsrq]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->is_event_threshold_rsrp_nr) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrpNr", immediate_mdt_conf->event_threshold_rsrp_nr) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [event_threshold_rsrp_nr]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->is_event_threshold_rsrq_nr) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrqNr", immediate_mdt_conf->event_threshold_rsrq_nr) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [event_threshold_rsrq_nr]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->collection_period_rmm_lte) {
+    if (OpenAPI_json_write_string(writer, "collectionPeriodRmmLte", OpenAPI_collection_period_rmm_lte_mdt_ToString(immediate_mdt_conf->collection_period_rmm_lte)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [collection_period_rmm_lte]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->collection_period_rmm_nr) {
+    if (OpenAPI_json_write_string(writer, "collectionPeriodRmmNr", OpenAPI_collection_period_rmm_nr_mdt_ToString(immediate_mdt_conf->collection_period_rmm_nr)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [collection_period_rmm_nr]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->measurement_period_lte) {
+    if (OpenAPI_json_write_string(writer, "measurementPeriodLte", OpenAPI_measurement_period_lte_mdt_ToString(immediate_mdt_conf->measurement_period_lte)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [measurement_period_lte]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->area_scope) {
+    if (OpenAPI_area_scope_writeJSON(writer, "areaScope", immediate_mdt_conf->area_scope) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [area_scope]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->positioning_method) {
+    if (OpenAPI_json_write_string(writer, "positioningMethod", OpenAPI_positioning_method_mdt_ToString(immediate_mdt_conf->positioning_method)) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [positioning_method]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->add_positioning_method_list) {
+    if (OpenAPI_json_write_array_start(writer, "addPositioningMethodList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [add_positioning_method_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *add_positioning_method_list_node;
+    OpenAPI_list_for_each(immediate_mdt_conf->add_positioning_method_list, add_positioning_method_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_positioning_method_mdt_ToString((intptr_t)add_positioning_method_list_node->data)) == false) {
+            ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [add_positioning_method_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [add_positioning_method_list]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->mdt_allowed_plmn_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "mdtAllowedPlmnIdList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [mdt_allowed_plmn_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mdt_allowed_plmn_id_list_node;
+    if (immediate_mdt_conf->mdt_allowed_plmn_id_list) {
+        OpenAPI_list_for_each(immediate_mdt_conf->mdt_allowed_plmn_id_list, mdt_allowed_plmn_id_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, mdt_allowed_plmn_id_list_node->data) == false) {
+                ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [mdt_allowed_plmn_id_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [mdt_allowed_plmn_id_list]");
+        goto end;
+    }
+    }
+
+    if (immediate_mdt_conf->sensor_measurement_list) {
+    if (OpenAPI_json_write_array_start(writer, "sensorMeasurementList") == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [sensor_measurement_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sensor_measurement_list_node;
+    OpenAPI_list_for_each(immediate_mdt_conf->sensor_measurement_list, sensor_measurement_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_sensor_measurement_ToString((intptr_t)sensor_measurement_list_node->data)) == false) {
+            ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [sensor_measurement_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [sensor_measurement_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_immediate_mdt_conf_writeJSON() failed [ImmediateMdtConf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_parseFromJSON(cJSON *immediate_mdt_confJSON)
 {
     OpenAPI_immediate_mdt_conf_t *immediate_mdt_conf_local_var = NULL;
@@ -592,7 +814,6 @@ end:
 OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_copy(OpenAPI_immediate_mdt_conf_t *dst, OpenAPI_immediate_mdt_conf_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_immediate_mdt_conf_convertToJSON(src);
@@ -601,21 +822,6 @@ OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_copy(OpenAPI_immediate_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_immediate_mdt_conf_free(dst);
     dst = OpenAPI_immediate_mdt_conf_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "area_scope.h"
 #include "collection_period_rmm_lte_mdt.h"
 #include "collection_period_rmm_nr_mdt.h"
@@ -86,6 +87,7 @@ OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_create(
 void OpenAPI_immediate_mdt_conf_free(OpenAPI_immediate_mdt_conf_t *immediate_mdt_conf);
 OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_parseFromJSON(cJSON *immediate_mdt_confJSON);
 cJSON *OpenAPI_immediate_mdt_conf_convertToJSON(OpenAPI_immediate_mdt_conf_t *immediate_mdt_conf);
+bool OpenAPI_immediate_mdt_conf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_immediate_mdt_conf_t *immediate_mdt_conf);
 OpenAPI_immediate_mdt_conf_t *OpenAPI_immediate_mdt_conf_copy(OpenAPI_immediate_mdt_conf_t *dst, OpenAPI_immediate_mdt_conf_t *src);
 
 #ifdef __cplusplus
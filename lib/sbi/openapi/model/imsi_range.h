@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_imsi_range_t *OpenAPI_imsi_range_create(
 void OpenAPI_imsi_range_free(OpenAPI_imsi_range_t *imsi_range);
 OpenAPI_imsi_range_t *OpenAPI_imsi_range_parseFromJSON(cJSON *imsi_rangeJSON);
 cJSON *OpenAPI_imsi_range_convertToJSON(OpenAPI_imsi_range_t *imsi_range);
+bool OpenAPI_imsi_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_imsi_range_t *imsi_range);
 OpenAPI_imsi_range_t *OpenAPI_imsi_range_copy(OpenAPI_imsi_range_t *dst, OpenAPI_imsi_range_t *src);
 
 #ifdef __cplusplus
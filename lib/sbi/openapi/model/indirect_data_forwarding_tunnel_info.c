@@ -87,6 +87,61 @@ end:
     return item;
 }
 
+bool OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_indirect_data_forwarding_tunnel_info_t *indirect_data_forwarding_tunnel_info)
+{
+    if (indirect_data_forwarding_tunnel_info == NULL) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [IndirectDataForwardingTunnelInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [IndirectDataForwardingTunnelInfo]");
+        return false;
+    }
+    if (indirect_data_forwarding_tunnel_info->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", indirect_data_forwarding_tunnel_info->ipv4_addr) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (indirect_data_forwarding_tunnel_info->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", indirect_data_forwarding_tunnel_info->ipv6_addr) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "gtpTeid", indirect_data_forwarding_tunnel_info->gtp_teid) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [gtp_teid]");
+        goto end;
+    }
+
+    if (indirect_data_forwarding_tunnel_info->is_drb_id) {
+    if (OpenAPI_json_write_number(writer, "drbId", indirect_data_forwarding_tunnel_info->drb_id) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [drb_id]");
+        goto end;
+    }
+    }
+
+    if (indirect_data_forwarding_tunnel_info->is_additional_tnl_nb) {
+    if (OpenAPI_json_write_number(writer, "additionalTnlNb", indirect_data_forwarding_tunnel_info->additional_tnl_nb) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [additional_tnl_nb]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON() failed [IndirectDataForwardingTunnelInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_indirect_data_forwarding_tunnel_info_t *OpenAPI_indirect_data_forwarding_tunnel_info_parseFromJSON(cJSON *indirect_data_forwarding_tunnel_infoJSON)
 {
     OpenAPI_indirect_data_forwarding_tunnel_info_t *indirect_data_forwarding_tunnel_info_local_var = NULL;
@@ -155,7 +210,6 @@ end:
 OpenAPI_indirect_data_forwarding_tunnel_info_t *OpenAPI_indirect_data_forwarding_tunnel_info_copy(OpenAPI_indirect_data_forwarding_tunnel_info_t *dst, OpenAPI_indirect_data_forwarding_tunnel_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_indirect_data_forwarding_tunnel_info_convertToJSON(src);
@@ -164,21 +218,6 @@ OpenAPI_indirect_data_forwarding_tunnel_info_t *OpenAPI_indirect_data_forwarding
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_indirect_data_forwarding_tunnel_info_free(dst);
     dst = OpenAPI_indirect_data_forwarding_tunnel_info_parseFromJSON(item);
     cJSON_Delete(item);
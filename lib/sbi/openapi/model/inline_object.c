@@ -257,6 +257,188 @@ end:
     return item;
 }
 
+bool OpenAPI_inline_object_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_t *inline_object)
+{
+    if (inline_object == NULL) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [inline_object]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [inline_object]");
+        return false;
+    }
+    if (inline_object->json_data) {
+    if (OpenAPI_ue_context_create_data_writeJSON(writer, "jsonData", inline_object->json_data) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [json_data]");
+        goto end;
+    }
+    }
+
+    if (inline_object->binary_data_n2_information) {
+    char* encoded_str_binary_data_n2_information = OpenAPI_base64encode(inline_object->binary_data_n2_information->data,inline_object->binary_data_n2_information->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2Information", encoded_str_binary_data_n2_information) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information);
+    }
+
+    if (inline_object->binary_data_n2_information_ext1) {
+    char* encoded_str_binary_data_n2_information_ext1 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext1->data,inline_object->binary_data_n2_information_ext1->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt1", encoded_str_binary_data_n2_information_ext1) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext1]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext1);
+    }
+
+    if (inline_object->binary_data_n2_information_ext2) {
+    char* encoded_str_binary_data_n2_information_ext2 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext2->data,inline_object->binary_data_n2_information_ext2->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt2", encoded_str_binary_data_n2_information_ext2) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext2]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext2);
+    }
+
+    if (inline_object->binary_data_n2_information_ext3) {
+    char* encoded_str_binary_data_n2_information_ext3 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext3->data,inline_object->binary_data_n2_information_ext3->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt3", encoded_str_binary_data_n2_information_ext3) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext3]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext3);
+    }
+
+    if (inline_object->binary_data_n2_information_ext4) {
+    char* encoded_str_binary_data_n2_information_ext4 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext4->data,inline_object->binary_data_n2_information_ext4->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt4", encoded_str_binary_data_n2_information_ext4) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext4]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext4);
+    }
+
+    if (inline_object->binary_data_n2_information_ext5) {
+    char* encoded_str_binary_data_n2_information_ext5 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext5->data,inline_object->binary_data_n2_information_ext5->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt5", encoded_str_binary_data_n2_information_ext5) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext5]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext5);
+    }
+
+    if (inline_object->binary_data_n2_information_ext6) {
+    char* encoded_str_binary_data_n2_information_ext6 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext6->data,inline_object->binary_data_n2_information_ext6->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt6", encoded_str_binary_data_n2_information_ext6) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext6]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext6);
+    }
+
+    if (inline_object->binary_data_n2_information_ext7) {
+    char* encoded_str_binary_data_n2_information_ext7 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext7->data,inline_object->binary_data_n2_information_ext7->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt7", encoded_str_binary_data_n2_information_ext7) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext7]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext7);
+    }
+
+    if (inline_object->binary_data_n2_information_ext8) {
+    char* encoded_str_binary_data_n2_information_ext8 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext8->data,inline_object->binary_data_n2_information_ext8->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt8", encoded_str_binary_data_n2_information_ext8) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext8]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext8);
+    }
+
+    if (inline_object->binary_data_n2_information_ext9) {
+    char* encoded_str_binary_data_n2_information_ext9 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext9->data,inline_object->binary_data_n2_information_ext9->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt9", encoded_str_binary_data_n2_information_ext9) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext9]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext9);
+    }
+
+    if (inline_object->binary_data_n2_information_ext10) {
+    char* encoded_str_binary_data_n2_information_ext10 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext10->data,inline_object->binary_data_n2_information_ext10->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt10", encoded_str_binary_data_n2_information_ext10) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext10]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext10);
+    }
+
+    if (inline_object->binary_data_n2_information_ext11) {
+    char* encoded_str_binary_data_n2_information_ext11 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext11->data,inline_object->binary_data_n2_information_ext11->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt11", encoded_str_binary_data_n2_information_ext11) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext11]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext11);
+    }
+
+    if (inline_object->binary_data_n2_information_ext12) {
+    char* encoded_str_binary_data_n2_information_ext12 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext12->data,inline_object->binary_data_n2_information_ext12->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt12", encoded_str_binary_data_n2_information_ext12) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext12]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext12);
+    }
+
+    if (inline_object->binary_data_n2_information_ext13) {
+    char* encoded_str_binary_data_n2_information_ext13 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext13->data,inline_object->binary_data_n2_information_ext13->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt13", encoded_str_binary_data_n2_information_ext13) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext13]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext13);
+    }
+
+    if (inline_object->binary_data_n2_information_ext14) {
+    char* encoded_str_binary_data_n2_information_ext14 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext14->data,inline_object->binary_data_n2_information_ext14->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt14", encoded_str_binary_data_n2_information_ext14) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext14]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext14);
+    }
+
+    if (inline_object->binary_data_n2_information_ext15) {
+    char* encoded_str_binary_data_n2_information_ext15 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext15->data,inline_object->binary_data_n2_information_ext15->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt15", encoded_str_binary_data_n2_information_ext15) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext15]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext15);
+    }
+
+    if (inline_object->binary_data_n2_information_ext16) {
+    char* encoded_str_binary_data_n2_information_ext16 = OpenAPI_base64encode(inline_object->binary_data_n2_information_ext16->data,inline_object->binary_data_n2_information_ext16->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2InformationExt16", encoded_str_binary_data_n2_information_ext16) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [binary_data_n2_information_ext16]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information_ext16);
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inline_object_writeJSON() failed [inline_object]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_inline_object_t *OpenAPI_inline_object_parseFromJSON(cJSON *inline_objectJSON)
 {
     OpenAPI_inline_object_t *inline_object_local_var = NULL;
@@ -568,7 +750,6 @@ end:
 OpenAPI_inline_object_t *OpenAPI_inline_object_copy(OpenAPI_inline_object_t *dst, OpenAPI_inline_object_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inline_object_convertToJSON(src);
@@ -577,21 +758,6 @@ OpenAPI_inline_object_t *OpenAPI_inline_object_copy(OpenAPI_inline_object_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inline_object_free(dst);
     dst = OpenAPI_inline_object_parseFromJSON(item);
     cJSON_Delete(item);
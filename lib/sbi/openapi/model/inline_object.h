@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_context_create_data.h"
 
 #ifdef __cplusplus
@@ -63,6 +64,7 @@ OpenAPI_inline_object_t *OpenAPI_inline_object_create(
 void OpenAPI_inline_object_free(OpenAPI_inline_object_t *inline_object);
 OpenAPI_inline_object_t *OpenAPI_inline_object_parseFromJSON(cJSON *inline_objectJSON);
 cJSON *OpenAPI_inline_object_convertToJSON(OpenAPI_inline_object_t *inline_object);
+bool OpenAPI_inline_object_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_t *inline_object);
 OpenAPI_inline_object_t *OpenAPI_inline_object_copy(OpenAPI_inline_object_t *dst, OpenAPI_inline_object_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_context_relocate_data.h"
 
 #ifdef __cplusplus
@@ -65,6 +66,7 @@ OpenAPI_inline_object_1_t *OpenAPI_inline_object_1_create(
 void OpenAPI_inline_object_1_free(OpenAPI_inline_object_1_t *inline_object_1);
 OpenAPI_inline_object_1_t *OpenAPI_inline_object_1_parseFromJSON(cJSON *inline_object_1JSON);
 cJSON *OpenAPI_inline_object_1_convertToJSON(OpenAPI_inline_object_1_t *inline_object_1);
+bool OpenAPI_inline_object_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_1_t *inline_object_1);
 OpenAPI_inline_object_1_t *OpenAPI_inline_object_1_copy(OpenAPI_inline_object_1_t *dst, OpenAPI_inline_object_1_t *src);
 
 #ifdef __cplusplus
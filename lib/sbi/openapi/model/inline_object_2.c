@@ -65,6 +65,44 @@ end:
     return item;
 }
 
+bool OpenAPI_inline_object_2_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_2_t *inline_object_2)
+{
+    if (inline_object_2 == NULL) {
+        ogs_error("OpenAPI_inline_object_2_writeJSON() failed [inline_object_2]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_inline_object_2_writeJSON() failed [inline_object_2]");
+        return false;
+    }
+    if (inline_object_2->json_data) {
+    if (OpenAPI_ue_context_cancel_relocate_data_writeJSON(writer, "jsonData", inline_object_2->json_data) == false) {
+        ogs_error("OpenAPI_inline_object_2_writeJSON() failed [json_data]");
+        goto end;
+    }
+    }
+
+    if (inline_object_2->binary_data_gtpc_message) {
+    char* encoded_str_binary_data_gtpc_message = OpenAPI_base64encode(inline_object_2->binary_data_gtpc_message->data,inline_object_2->binary_data_gtpc_message->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataGtpcMessage", encoded_str_binary_data_gtpc_message) == false) {
+        ogs_error("OpenAPI_inline_object_2_writeJSON() failed [binary_data_gtpc_message]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_gtpc_message);
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inline_object_2_writeJSON() failed [inline_object_2]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_parseFromJSON(cJSON *inline_object_2JSON)
 {
     OpenAPI_inline_object_2_t *inline_object_2_local_var = NULL;
@@ -104,7 +142,6 @@ end:
 OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_copy(OpenAPI_inline_object_2_t *dst, OpenAPI_inline_object_2_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inline_object_2_convertToJSON(src);
@@ -113,21 +150,6 @@ OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_copy(OpenAPI_inline_object_2_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inline_object_2_free(dst);
     dst = OpenAPI_inline_object_2_parseFromJSON(item);
     cJSON_Delete(item);
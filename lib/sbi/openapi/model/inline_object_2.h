@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_context_cancel_relocate_data.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_create(
 void OpenAPI_inline_object_2_free(OpenAPI_inline_object_2_t *inline_object_2);
 OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_parseFromJSON(cJSON *inline_object_2JSON);
 cJSON *OpenAPI_inline_object_2_convertToJSON(OpenAPI_inline_object_2_t *inline_object_2);
+bool OpenAPI_inline_object_2_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_2_t *inline_object_2);
 OpenAPI_inline_object_2_t *OpenAPI_inline_object_2_copy(OpenAPI_inline_object_2_t *dst, OpenAPI_inline_object_2_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n1_message_notification.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_inline_object_3_t *OpenAPI_inline_object_3_create(
 void OpenAPI_inline_object_3_free(OpenAPI_inline_object_3_t *inline_object_3);
 OpenAPI_inline_object_3_t *OpenAPI_inline_object_3_parseFromJSON(cJSON *inline_object_3JSON);
 cJSON *OpenAPI_inline_object_3_convertToJSON(OpenAPI_inline_object_3_t *inline_object_3);
+bool OpenAPI_inline_object_3_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_3_t *inline_object_3);
 OpenAPI_inline_object_3_t *OpenAPI_inline_object_3_copy(OpenAPI_inline_object_3_t *dst, OpenAPI_inline_object_3_t *src);
 
 #ifdef __cplusplus
@@ -77,6 +77,53 @@ end:
     return item;
 }
 
+bool OpenAPI_inline_object_4_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_4_t *inline_object_4)
+{
+    if (inline_object_4 == NULL) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [inline_object_4]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [inline_object_4]");
+        return false;
+    }
+    if (inline_object_4->json_data) {
+    if (OpenAPI_n2_information_notification_writeJSON(writer, "jsonData", inline_object_4->json_data) == false) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [json_data]");
+        goto end;
+    }
+    }
+
+    if (inline_object_4->binary_data_n1_message) {
+    char* encoded_str_binary_data_n1_message = OpenAPI_base64encode(inline_object_4->binary_data_n1_message->data,inline_object_4->binary_data_n1_message->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN1Message", encoded_str_binary_data_n1_message) == false) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [binary_data_n1_message]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n1_message);
+    }
+
+    if (inline_object_4->binary_data_n2_information) {
+    char* encoded_str_binary_data_n2_information = OpenAPI_base64encode(inline_object_4->binary_data_n2_information->data,inline_object_4->binary_data_n2_information->len);
+    if (OpenAPI_json_write_string(writer, "binaryDataN2Information", encoded_str_binary_data_n2_information) == false) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [binary_data_n2_information]");
+        goto end;
+    }
+    ogs_free(encoded_str_binary_data_n2_information);
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inline_object_4_writeJSON() failed [inline_object_4]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_parseFromJSON(cJSON *inline_object_4JSON)
 {
     OpenAPI_inline_object_4_t *inline_object_4_local_var = NULL;
@@ -133,7 +180,6 @@ end:
 OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_copy(OpenAPI_inline_object_4_t *dst, OpenAPI_inline_object_4_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inline_object_4_convertToJSON(src);
@@ -142,21 +188,6 @@ OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_copy(OpenAPI_inline_object_4_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inline_object_4_free(dst);
     dst = OpenAPI_inline_object_4_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_information_notification.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_create(
 void OpenAPI_inline_object_4_free(OpenAPI_inline_object_4_t *inline_object_4);
 OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_parseFromJSON(cJSON *inline_object_4JSON);
 cJSON *OpenAPI_inline_object_4_convertToJSON(OpenAPI_inline_object_4_t *inline_object_4);
+bool OpenAPI_inline_object_4_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_object_4_t *inline_object_4);
 OpenAPI_inline_object_4_t *OpenAPI_inline_object_4_copy(OpenAPI_inline_object_4_t *dst, OpenAPI_inline_object_4_t *src);
 
 #ifdef __cplusplus
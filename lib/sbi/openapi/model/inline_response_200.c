@@ -69,6 +69,51 @@ end:
     return item;
 }
 
+bool OpenAPI_inline_response_200_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_response_200_t *inline_response_200)
+{
+    if (inline_response_200 == NULL) {
+        ogs_error("OpenAPI_inline_response_200_writeJSON() failed [inline_response_200]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_inline_response_200_writeJSON() failed [inline_response_200]");
+        return false;
+    }
+    if (inline_response_200->_links) {
+    if (OpenAPI_json_write_object_start(writer, "_links") == false) {
+        ogs_error("OpenAPI_inline_response_200_writeJSON() failed [_links]");
+        goto end;
+    }
+    OpenAPI_lnode_t *_links_node;
+    if (inline_response_200->_links) {
+        OpenAPI_list_for_each(inline_response_200->_links, _links_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)_links_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_links_value_schema_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_inline_response_200_writeJSON() failed [_links]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inline_response_200_writeJSON() failed [_links]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inline_response_200_writeJSON() failed [inline_response_200]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_parseFromJSON(cJSON *inline_response_200JSON)
 {
     OpenAPI_inline_response_200_t *inline_response_200_local_var = NULL;
@@ -110,7 +155,6 @@ end:
 OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_copy(OpenAPI_inline_response_200_t *dst, OpenAPI_inline_response_200_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inline_response_200_convertToJSON(src);
@@ -119,21 +163,6 @@ OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_copy(OpenAPI_inline_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inline_response_200_free(dst);
     dst = OpenAPI_inline_response_200_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "links_value_schema.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_create(
 void OpenAPI_inline_response_200_free(OpenAPI_inline_response_200_t *inline_response_200);
 OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_parseFromJSON(cJSON *inline_response_200JSON);
 cJSON *OpenAPI_inline_response_200_convertToJSON(OpenAPI_inline_response_200_t *inline_response_200);
+bool OpenAPI_inline_response_200_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inline_response_200_t *inline_response_200);
 OpenAPI_inline_response_200_t *OpenAPI_inline_response_200_copy(OpenAPI_inline_response_200_t *dst, OpenAPI_inline_response_200_t *src);
 
 #ifdef __cplusplus
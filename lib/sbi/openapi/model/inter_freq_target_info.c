@@ -66,6 +66,52 @@ end:
     return item;
 }
 
+bool OpenAPI_inter_freq_target_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_inter_freq_target_info_t *inter_freq_target_info)
+{
+    if (inter_freq_target_info == NULL) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [InterFreqTargetInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [InterFreqTargetInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "dlCarrierFreq", inter_freq_target_info->dl_carrier_freq) == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [dl_carrier_freq]");
+        goto end;
+    }
+
+    if (inter_freq_target_info->cell_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "cellIdList") == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [cell_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cell_id_list_node;
+    OpenAPI_list_for_each(inter_freq_target_info->cell_id_list, cell_id_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)cell_id_list_node->data) == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [cell_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [cell_id_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_inter_freq_target_info_writeJSON() failed [InterFreqTargetInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_inter_freq_target_info_t *OpenAPI_inter_freq_target_info_parseFromJSON(cJSON *inter_freq_target_infoJSON)
 {
     OpenAPI_inter_freq_target_info_t *inter_freq_target_info_local_var = NULL;
@@ -114,7 +160,6 @@ end:
 OpenAPI_inter_freq_target_info_t *OpenAPI_inter_freq_target_info_copy(OpenAPI_inter_freq_target_info_t *dst, OpenAPI_inter_freq_target_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_inter_freq_target_info_convertToJSON(src);
@@ -123,21 +168,6 @@ OpenAPI_inter_freq_target_info_t *OpenAPI_inter_freq_target_info_copy(OpenAPI_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_inter_freq_target_info_free(dst);
     dst = OpenAPI_inter_freq_target_info_parseFromJSON(item);
     cJSON_Delete(item);
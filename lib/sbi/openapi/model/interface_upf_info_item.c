@@ -108,6 +108,85 @@ end:
     return item;
 }
 
+bool OpenAPI_interface_upf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_interface_upf_info_item_t *interface_upf_info_item)
+{
+    if (interface_upf_info_item == NULL) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [InterfaceUpfInfoItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [InterfaceUpfInfoItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "interfaceType", OpenAPI_up_interface_type_ToString(interface_upf_info_item->interface_type)) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [interface_type]");
+        goto end;
+    }
+
+    if (interface_upf_info_item->ipv4_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4EndpointAddresses") == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_endpoint_addresses_node;
+    OpenAPI_list_for_each(interface_upf_info_item->ipv4_endpoint_addresses, ipv4_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (interface_upf_info_item->ipv6_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6EndpointAddresses") == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_endpoint_addresses_node;
+    OpenAPI_list_for_each(interface_upf_info_item->ipv6_endpoint_addresses, ipv6_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (interface_upf_info_item->endpoint_fqdn) {
+    if (OpenAPI_json_write_string(writer, "endpointFqdn", interface_upf_info_item->endpoint_fqdn) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [endpoint_fqdn]");
+        goto end;
+    }
+    }
+
+    if (interface_upf_info_item->network_instance) {
+    if (OpenAPI_json_write_string(writer, "networkInstance", interface_upf_info_item->network_instance) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [network_instance]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_interface_upf_info_item_writeJSON() failed [InterfaceUpfInfoItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_parseFromJSON(cJSON *interface_upf_info_itemJSON)
 {
     OpenAPI_interface_upf_info_item_t *interface_upf_info_item_local_var = NULL;
@@ -198,7 +277,6 @@ end:
 OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_copy(OpenAPI_interface_upf_info_item_t *dst, OpenAPI_interface_upf_info_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_interface_upf_info_item_convertToJSON(src);
@@ -207,21 +285,6 @@ OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_interface_upf_info_item_free(dst);
     dst = OpenAPI_interface_upf_info_item_parseFromJSON(item);
     cJSON_Delete(item);
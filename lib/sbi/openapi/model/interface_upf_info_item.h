@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "up_interface_type.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_create(
 void OpenAPI_interface_upf_info_item_free(OpenAPI_interface_upf_info_item_t *interface_upf_info_item);
 OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_parseFromJSON(cJSON *interface_upf_info_itemJSON);
 cJSON *OpenAPI_interface_upf_info_item_convertToJSON(OpenAPI_interface_upf_info_item_t *interface_upf_info_item);
+bool OpenAPI_interface_upf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_interface_upf_info_item_t *interface_upf_info_item);
 OpenAPI_interface_upf_info_item_t *OpenAPI_interface_upf_info_item_copy(OpenAPI_interface_upf_info_item_t *dst, OpenAPI_interface_upf_info_item_t *src);
 
 #ifdef __cplusplus
@@ -55,6 +55,40 @@ end:
     return item;
 }
 
+bool OpenAPI_invalid_param_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_invalid_param_t *invalid_param)
+{
+    if (invalid_param == NULL) {
+        ogs_error("OpenAPI_invalid_param_writeJSON() failed [InvalidParam]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_invalid_param_writeJSON() failed [InvalidParam]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "param", invalid_param->param) == false) {
+        ogs_error("OpenAPI_invalid_param_writeJSON() failed [param]");
+        goto end;
+    }
+
+    if (invalid_param->reason) {
+    if (OpenAPI_json_write_string(writer, "reason", invalid_param->reason) == false) {
+        ogs_error("OpenAPI_invalid_param_writeJSON() failed [reason]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_invalid_param_writeJSON() failed [InvalidParam]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_invalid_param_t *OpenAPI_invalid_param_parseFromJSON(cJSON *invalid_paramJSON)
 {
     OpenAPI_invalid_param_t *invalid_param_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_invalid_param_t *OpenAPI_invalid_param_copy(OpenAPI_invalid_param_t *dst, OpenAPI_invalid_param_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_invalid_param_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_invalid_param_t *OpenAPI_invalid_param_copy(OpenAPI_invalid_param_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_invalid_param_free(dst);
     dst = OpenAPI_invalid_param_parseFromJSON(item);
     cJSON_Delete(item);
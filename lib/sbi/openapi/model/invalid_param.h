@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_invalid_param_t *OpenAPI_invalid_param_create(
 void OpenAPI_invalid_param_free(OpenAPI_invalid_param_t *invalid_param);
 OpenAPI_invalid_param_t *OpenAPI_invalid_param_parseFromJSON(cJSON *invalid_paramJSON);
 cJSON *OpenAPI_invalid_param_convertToJSON(OpenAPI_invalid_param_t *invalid_param);
+bool OpenAPI_invalid_param_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_invalid_param_t *invalid_param);
 OpenAPI_invalid_param_t *OpenAPI_invalid_param_copy(OpenAPI_invalid_param_t *dst, OpenAPI_invalid_param_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_invalid_param_1_t *OpenAPI_invalid_param_1_create(
 void OpenAPI_invalid_param_1_free(OpenAPI_invalid_param_1_t *invalid_param_1);
 OpenAPI_invalid_param_1_t *OpenAPI_invalid_param_1_parseFromJSON(cJSON *invalid_param_1JSON);
 cJSON *OpenAPI_invalid_param_1_convertToJSON(OpenAPI_invalid_param_1_t *invalid_param_1);
+bool OpenAPI_invalid_param_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_invalid_param_1_t *invalid_param_1);
 OpenAPI_invalid_param_1_t *OpenAPI_invalid_param_1_copy(OpenAPI_invalid_param_1_t *dst, OpenAPI_invalid_param_1_t *src);
 
 #ifdef __cplusplus
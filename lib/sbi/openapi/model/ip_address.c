@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_ip_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_address_t *ip_address)
+{
+    if (ip_address == NULL) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [IpAddress]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [IpAddress]");
+        return false;
+    }
+    if (ip_address->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", ip_address->ipv4_addr) == false) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_address->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", ip_address->ipv6_addr) == false) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_address->ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6Prefix", ip_address->ipv6_prefix) == false) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ip_address_writeJSON() failed [IpAddress]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ip_address_t *OpenAPI_ip_address_parseFromJSON(cJSON *ip_addressJSON)
 {
     OpenAPI_ip_address_t *ip_address_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_ip_address_t *OpenAPI_ip_address_copy(OpenAPI_ip_address_t *dst, OpenAPI_ip_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_address_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_ip_address_t *OpenAPI_ip_address_copy(OpenAPI_ip_address_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_address_free(dst);
     dst = OpenAPI_ip_address_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_ip_address_t *OpenAPI_ip_address_create(
 void OpenAPI_ip_address_free(OpenAPI_ip_address_t *ip_address);
 OpenAPI_ip_address_t *OpenAPI_ip_address_parseFromJSON(cJSON *ip_addressJSON);
 cJSON *OpenAPI_ip_address_convertToJSON(OpenAPI_ip_address_t *ip_address);
+bool OpenAPI_ip_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_address_t *ip_address);
 OpenAPI_ip_address_t *OpenAPI_ip_address_copy(OpenAPI_ip_address_t *dst, OpenAPI_ip_address_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_ip_address_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_address_1_t *ip_address_1)
+{
+    if (ip_address_1 == NULL) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [IpAddress_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [IpAddress_1]");
+        return false;
+    }
+    if (ip_address_1->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", ip_address_1->ipv4_addr) == false) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_address_1->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", ip_address_1->ipv6_addr) == false) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_address_1->ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6Prefix", ip_address_1->ipv6_prefix) == false) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ip_address_1_writeJSON() failed [IpAddress_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_parseFromJSON(cJSON *ip_address_1JSON)
 {
     OpenAPI_ip_address_1_t *ip_address_1_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_copy(OpenAPI_ip_address_1_t *dst, OpenAPI_ip_address_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_address_1_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_copy(OpenAPI_ip_address_1_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_address_1_free(dst);
     dst = OpenAPI_ip_address_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_create(
 void OpenAPI_ip_address_1_free(OpenAPI_ip_address_1_t *ip_address_1);
 OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_parseFromJSON(cJSON *ip_address_1JSON);
 cJSON *OpenAPI_ip_address_1_convertToJSON(OpenAPI_ip_address_1_t *ip_address_1);
+bool OpenAPI_ip_address_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_address_1_t *ip_address_1);
 OpenAPI_ip_address_1_t *OpenAPI_ip_address_1_copy(OpenAPI_ip_address_1_t *dst, OpenAPI_ip_address_1_t *src);
 
 #ifdef __cplusplus
@@ -77,6 +77,56 @@ end:
     return item;
 }
 
+bool OpenAPI_ip_end_point_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_end_point_t *ip_end_point)
+{
+    if (ip_end_point == NULL) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [IpEndPoint]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [IpEndPoint]");
+        return false;
+    }
+    if (ip_end_point->ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "ipv4Address", ip_end_point->ipv4_address) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (ip_end_point->ipv6_address) {
+    if (OpenAPI_json_write_string(writer, "ipv6Address", ip_end_point->ipv6_address) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [ipv6_address]");
+        goto end;
+    }
+    }
+
+    if (ip_end_point->transport) {
+    if (OpenAPI_json_write_string(writer, "transport", OpenAPI_transport_protocol_ToString(ip_end_point->transport)) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [transport]");
+        goto end;
+    }
+    }
+
+    if (ip_end_point->is_port) {
+    if (OpenAPI_json_write_number(writer, "port", ip_end_point->port) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [port]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ip_end_point_writeJSON() failed [IpEndPoint]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_parseFromJSON(cJSON *ip_end_pointJSON)
 {
     OpenAPI_ip_end_point_t *ip_end_point_local_var = NULL;
@@ -134,7 +184,6 @@ end:
 OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_copy(OpenAPI_ip_end_point_t *dst, OpenAPI_ip_end_point_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_end_point_convertToJSON(src);
@@ -143,21 +192,6 @@ OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_copy(OpenAPI_ip_end_point_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_end_point_free(dst);
     dst = OpenAPI_ip_end_point_parseFromJSON(item);
     cJSON_Delete(item);
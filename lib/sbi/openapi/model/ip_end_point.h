@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "transport_protocol.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_create(
 void OpenAPI_ip_end_point_free(OpenAPI_ip_end_point_t *ip_end_point);
 OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_parseFromJSON(cJSON *ip_end_pointJSON);
 cJSON *OpenAPI_ip_end_point_convertToJSON(OpenAPI_ip_end_point_t *ip_end_point);
+bool OpenAPI_ip_end_point_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_end_point_t *ip_end_point);
 OpenAPI_ip_end_point_t *OpenAPI_ip_end_point_copy(OpenAPI_ip_end_point_t *dst, OpenAPI_ip_end_point_t *src);
 
 #ifdef __cplusplus
@@ -77,6 +77,56 @@ end:
     return item;
 }
 
+bool OpenAPI_ip_multicast_address_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_multicast_address_info_t *ip_multicast_address_info)
+{
+    if (ip_multicast_address_info == NULL) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [IpMulticastAddressInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [IpMulticastAddressInfo]");
+        return false;
+    }
+    if (ip_multicast_address_info->src_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "srcIpv4Addr", ip_multicast_address_info->src_ipv4_addr) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [src_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_multicast_address_info->ipv4_mul_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4MulAddr", ip_multicast_address_info->ipv4_mul_addr) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [ipv4_mul_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_multicast_address_info->src_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "srcIpv6Addr", ip_multicast_address_info->src_ipv6_addr) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [src_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (ip_multicast_address_info->ipv6_mul_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6MulAddr", ip_multicast_address_info->ipv6_mul_addr) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [ipv6_mul_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ip_multicast_address_info_writeJSON() failed [IpMulticastAddressInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ip_multicast_address_info_t *OpenAPI_ip_multicast_address_info_parseFromJSON(cJSON *ip_multicast_address_infoJSON)
 {
     OpenAPI_ip_multicast_address_info_t *ip_multicast_address_info_local_var = NULL;
@@ -131,7 +181,6 @@ end:
 OpenAPI_ip_multicast_address_info_t *OpenAPI_ip_multicast_address_info_copy(OpenAPI_ip_multicast_address_info_t *dst, OpenAPI_ip_multicast_address_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_multicast_address_info_convertToJSON(src);
@@ -140,21 +189,6 @@ OpenAPI_ip_multicast_address_info_t *OpenAPI_ip_multicast_address_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_multicast_address_info_free(dst);
     dst = OpenAPI_ip_multicast_address_info_parseFromJSON(item);
     cJSON_Delete(item);
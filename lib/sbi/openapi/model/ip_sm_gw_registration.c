@@ -74,6 +74,49 @@ end:
     return item;
 }
 
+bool OpenAPI_ip_sm_gw_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ip_sm_gw_registration_t *ip_sm_gw_registration)
+{
+    if (ip_sm_gw_registration == NULL) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [IpSmGwRegistration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [IpSmGwRegistration]");
+        return false;
+    }
+    if (ip_sm_gw_registration->ip_sm_gw_map_address) {
+    if (OpenAPI_json_write_string(writer, "ipSmGwMapAddress", ip_sm_gw_registration->ip_sm_gw_map_address) == false) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [ip_sm_gw_map_address]");
+        goto end;
+    }
+    }
+
+    if (ip_sm_gw_registration->ip_sm_gw_diameter_address) {
+    if (OpenAPI_network_node_diameter_address_writeJSON(writer, "ipSmGwDiameterAddress", ip_sm_gw_registration->ip_sm_gw_diameter_address) == false) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [ip_sm_gw_diameter_address]");
+        goto end;
+    }
+    }
+
+    if (ip_sm_gw_registration->is_unri_indicator) {
+    if (OpenAPI_json_write_bool(writer, "unriIndicator", ip_sm_gw_registration->unri_indicator) == false) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [unri_indicator]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ip_sm_gw_registration_writeJSON() failed [IpSmGwRegistration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ip_sm_gw_registration_t *OpenAPI_ip_sm_gw_registration_parseFromJSON(cJSON *ip_sm_gw_registrationJSON)
 {
     OpenAPI_ip_sm_gw_registration_t *ip_sm_gw_registration_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_ip_sm_gw_registration_t *OpenAPI_ip_sm_gw_registration_copy(OpenAPI_ip_sm_gw_registration_t *dst, OpenAPI_ip_sm_gw_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ip_sm_gw_registration_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_ip_sm_gw_registration_t *OpenAPI_ip_sm_gw_registration_copy(OpenAPI_ip_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ip_sm_gw_registration_free(dst);
     dst = OpenAPI_ip_sm_gw_registration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -141,6 +141,96 @@ end:
     return item;
 }
 
+bool OpenAPI_iptv_config_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_iptv_config_data_t *iptv_config_data)
+{
+    if (iptv_config_data == NULL) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [IptvConfigData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [IptvConfigData]");
+        return false;
+    }
+    if (iptv_config_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", iptv_config_data->supi) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (iptv_config_data->inter_group_id) {
+    if (OpenAPI_json_write_string(writer, "interGroupId", iptv_config_data->inter_group_id) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [inter_group_id]");
+        goto end;
+    }
+    }
+
+    if (iptv_config_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", iptv_config_data->dnn) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (iptv_config_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", iptv_config_data->snssai) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "afAppId", iptv_config_data->af_app_id) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, "multiAccCtrls") == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [multi_acc_ctrls]");
+        goto end;
+    }
+    OpenAPI_lnode_t *multi_acc_ctrls_node;
+    if (iptv_config_data->multi_acc_ctrls) {
+        OpenAPI_list_for_each(iptv_config_data->multi_acc_ctrls, multi_acc_ctrls_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)multi_acc_ctrls_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_multicast_access_control_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [multi_acc_ctrls]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [multi_acc_ctrls]");
+        goto end;
+    }
+
+    if (iptv_config_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", iptv_config_data->supp_feat) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (iptv_config_data->res_uri) {
+    if (OpenAPI_json_write_string(writer, "resUri", iptv_config_data->res_uri) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [res_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_iptv_config_data_writeJSON() failed [IptvConfigData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_parseFromJSON(cJSON *iptv_config_dataJSON)
 {
     OpenAPI_iptv_config_data_t *iptv_config_data_local_var = NULL;
@@ -254,7 +344,6 @@ end:
 OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_copy(OpenAPI_iptv_config_data_t *dst, OpenAPI_iptv_config_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_iptv_config_data_convertToJSON(src);
@@ -263,21 +352,6 @@ OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_copy(OpenAPI_iptv_config_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_iptv_config_data_free(dst);
     dst = OpenAPI_iptv_config_data_parseFromJSON(item);
     cJSON_Delete(item);
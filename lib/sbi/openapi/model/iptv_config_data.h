@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "multicast_access_control.h"
 #include "snssai.h"
 
@@ -44,6 +45,7 @@ OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_create(
 void OpenAPI_iptv_config_data_free(OpenAPI_iptv_config_data_t *iptv_config_data);
 OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_parseFromJSON(cJSON *iptv_config_dataJSON);
 cJSON *OpenAPI_iptv_config_data_convertToJSON(OpenAPI_iptv_config_data_t *iptv_config_data);
+bool OpenAPI_iptv_config_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_iptv_config_data_t *iptv_config_data);
 OpenAPI_iptv_config_data_t *OpenAPI_iptv_config_data_copy(OpenAPI_iptv_config_data_t *dst, OpenAPI_iptv_config_data_t *src);
 
 #ifdef __cplusplus
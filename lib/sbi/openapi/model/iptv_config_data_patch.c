@@ -69,6 +69,51 @@ end:
     return item;
 }
 
+bool OpenAPI_iptv_config_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_iptv_config_data_patch_t *iptv_config_data_patch)
+{
+    if (iptv_config_data_patch == NULL) {
+        ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [IptvConfigDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [IptvConfigDataPatch]");
+        return false;
+    }
+    if (iptv_config_data_patch->multi_acc_ctrls) {
+    if (OpenAPI_json_write_object_start(writer, "multiAccCtrls") == false) {
+        ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [multi_acc_ctrls]");
+        goto end;
+    }
+    OpenAPI_lnode_t *multi_acc_ctrls_node;
+    if (iptv_config_data_patch->multi_acc_ctrls) {
+        OpenAPI_list_for_each(iptv_config_data_patch->multi_acc_ctrls, multi_acc_ctrls_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)multi_acc_ctrls_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_multicast_access_control_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [multi_acc_ctrls]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [multi_acc_ctrls]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_iptv_config_data_patch_writeJSON() failed [IptvConfigDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_iptv_config_data_patch_t *OpenAPI_iptv_config_data_patch_parseFromJSON(cJSON *iptv_config_data_patchJSON)
 {
     OpenAPI_iptv_config_data_patch_t *iptv_config_data_patch_local_var = NULL;
@@ -110,7 +155,6 @@ end:
 OpenAPI_iptv_config_data_patch_t *OpenAPI_iptv_config_data_patch_copy(OpenAPI_iptv_config_data_patch_t *dst, OpenAPI_iptv_config_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_iptv_config_data_patch_convertToJSON(src);
@@ -119,21 +163,6 @@ OpenAPI_iptv_config_data_patch_t *OpenAPI_iptv_config_data_patch_copy(OpenAPI_ip
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_iptv_config_data_patch_free(dst);
     dst = OpenAPI_iptv_config_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_key_amf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_key_amf_t *key_amf)
+{
+    if (key_amf == NULL) {
+        ogs_error("OpenAPI_key_amf_writeJSON() failed [KeyAmf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_key_amf_writeJSON() failed [KeyAmf]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "keyType", OpenAPI_key_amf_type_ToString(key_amf->key_type)) == false) {
+        ogs_error("OpenAPI_key_amf_writeJSON() failed [key_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "keyVal", key_amf->key_val) == false) {
+        ogs_error("OpenAPI_key_amf_writeJSON() failed [key_val]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_key_amf_writeJSON() failed [KeyAmf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_key_amf_t *OpenAPI_key_amf_parseFromJSON(cJSON *key_amfJSON)
 {
     OpenAPI_key_amf_t *key_amf_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_key_amf_t *OpenAPI_key_amf_copy(OpenAPI_key_amf_t *dst, OpenAPI_key_amf_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_key_amf_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_key_amf_t *OpenAPI_key_amf_copy(OpenAPI_key_amf_t *dst, OpenAPI_key_amf_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_key_amf_free(dst);
     dst = OpenAPI_key_amf_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "key_amf_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_key_amf_t *OpenAPI_key_amf_create(
 void OpenAPI_key_amf_free(OpenAPI_key_amf_t *key_amf);
 OpenAPI_key_amf_t *OpenAPI_key_amf_parseFromJSON(cJSON *key_amfJSON);
 cJSON *OpenAPI_key_amf_convertToJSON(OpenAPI_key_amf_t *key_amf);
+bool OpenAPI_key_amf_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_key_amf_t *key_amf);
 OpenAPI_key_amf_t *OpenAPI_key_amf_copy(OpenAPI_key_amf_t *dst, OpenAPI_key_amf_t *src);
 
 #ifdef __cplusplus
@@ -54,6 +54,40 @@ end:
     return item;
 }
 
+bool OpenAPI_ladn_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ladn_info_t *ladn_info)
+{
+    if (ladn_info == NULL) {
+        ogs_error("OpenAPI_ladn_info_writeJSON() failed [LadnInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ladn_info_writeJSON() failed [LadnInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "ladn", ladn_info->ladn) == false) {
+        ogs_error("OpenAPI_ladn_info_writeJSON() failed [ladn]");
+        goto end;
+    }
+
+    if (ladn_info->presence) {
+    if (OpenAPI_json_write_string(writer, "presence", OpenAPI_presence_state_ToString(ladn_info->presence)) == false) {
+        ogs_error("OpenAPI_ladn_info_writeJSON() failed [presence]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ladn_info_writeJSON() failed [LadnInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ladn_info_t *OpenAPI_ladn_info_parseFromJSON(cJSON *ladn_infoJSON)
 {
     OpenAPI_ladn_info_t *ladn_info_local_var = NULL;
@@ -92,7 +126,6 @@ end:
 OpenAPI_ladn_info_t *OpenAPI_ladn_info_copy(OpenAPI_ladn_info_t *dst, OpenAPI_ladn_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ladn_info_convertToJSON(src);
@@ -101,21 +134,6 @@ OpenAPI_ladn_info_t *OpenAPI_ladn_info_copy(OpenAPI_ladn_info_t *dst, OpenAPI_la
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ladn_info_free(dst);
     dst = OpenAPI_ladn_info_parseFromJSON(item);
     cJSON_Delete(item);
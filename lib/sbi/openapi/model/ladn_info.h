@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "presence_state.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ladn_info_t *OpenAPI_ladn_info_create(
 void OpenAPI_ladn_info_free(OpenAPI_ladn_info_t *ladn_info);
 OpenAPI_ladn_info_t *OpenAPI_ladn_info_parseFromJSON(cJSON *ladn_infoJSON);
 cJSON *OpenAPI_ladn_info_convertToJSON(OpenAPI_ladn_info_t *ladn_info);
+bool OpenAPI_ladn_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ladn_info_t *ladn_info);
 OpenAPI_ladn_info_t *OpenAPI_ladn_info_copy(OpenAPI_ladn_info_t *dst, OpenAPI_ladn_info_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,41 @@ end:
     return item;
 }
 
+bool OpenAPI_lcs_broadcast_assistance_types_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_broadcast_assistance_types_data_t *lcs_broadcast_assistance_types_data)
+{
+    if (lcs_broadcast_assistance_types_data == NULL) {
+        ogs_error("OpenAPI_lcs_broadcast_assistance_types_data_writeJSON() failed [LcsBroadcastAssistanceTypesData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lcs_broadcast_assistance_types_data_writeJSON() failed [LcsBroadcastAssistanceTypesData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "locationAssistanceType") == false) {
+        ogs_error("OpenAPI_lcs_broadcast_assistance_types_data_writeJSON() failed [location_assistance_type]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *location_assistance_type_node;
+    OpenAPI_list_for_each(lcs_broadcast_assistance_types_data->location_assistance_type, location_assistance_type_node)  {
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_broadcast_assistance_types_data_writeJSON() failed [location_assistance_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_broadcast_assistance_types_data_writeJSON() failed [LcsBroadcastAssistanceTypesData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lcs_broadcast_assistance_types_data_t *OpenAPI_lcs_broadcast_assistance_types_data_parseFromJSON(cJSON *lcs_broadcast_assistance_types_dataJSON)
 {
     OpenAPI_lcs_broadcast_assistance_types_data_t *lcs_broadcast_assistance_types_data_local_var = NULL;
@@ -85,7 +120,6 @@ end:
 OpenAPI_lcs_broadcast_assistance_types_data_t *OpenAPI_lcs_broadcast_assistance_types_data_copy(OpenAPI_lcs_broadcast_assistance_types_data_t *dst, OpenAPI_lcs_broadcast_assistance_types_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lcs_broadcast_assistance_types_data_convertToJSON(src);
@@ -94,21 +128,6 @@ OpenAPI_lcs_broadcast_assistance_types_data_t *OpenAPI_lcs_broadcast_assistance_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lcs_broadcast_assistance_types_data_free(dst);
     dst = OpenAPI_lcs_broadcast_assistance_types_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "geographic_area.h"
 #include "privacy_check_related_action.h"
 #include "valid_time_period.h"
@@ -35,6 +36,7 @@ OpenAPI_lcs_client_external_t *OpenAPI_lcs_client_external_create(
 void OpenAPI_lcs_client_external_free(OpenAPI_lcs_client_external_t *lcs_client_external);
 OpenAPI_lcs_client_external_t *OpenAPI_lcs_client_external_parseFromJSON(cJSON *lcs_client_externalJSON);
 cJSON *OpenAPI_lcs_client_external_convertToJSON(OpenAPI_lcs_client_external_t *lcs_client_external);
+bool OpenAPI_lcs_client_external_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_client_external_t *lcs_client_external);
 OpenAPI_lcs_client_external_t *OpenAPI_lcs_client_external_copy(OpenAPI_lcs_client_external_t *dst, OpenAPI_lcs_client_external_t *src);
 
 #ifdef __cplusplus
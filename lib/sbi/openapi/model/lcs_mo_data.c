@@ -53,6 +53,44 @@ end:
     return item;
 }
 
+bool OpenAPI_lcs_mo_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_mo_data_t *lcs_mo_data)
+{
+    if (lcs_mo_data == NULL) {
+        ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [LcsMoData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [LcsMoData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "allowedServiceClasses") == false) {
+        ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [allowed_service_classes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_service_classes_node;
+    OpenAPI_list_for_each(lcs_mo_data->allowed_service_classes, allowed_service_classes_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_lcs_mo_service_class_ToString((intptr_t)allowed_service_classes_node->data)) == false) {
+            ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [allowed_service_classes]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [allowed_service_classes]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_mo_data_writeJSON() failed [LcsMoData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_parseFromJSON(cJSON *lcs_mo_dataJSON)
 {
     OpenAPI_lcs_mo_data_t *lcs_mo_data_local_var = NULL;
@@ -92,7 +130,6 @@ end:
 OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_copy(OpenAPI_lcs_mo_data_t *dst, OpenAPI_lcs_mo_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lcs_mo_data_convertToJSON(src);
@@ -101,21 +138,6 @@ OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_copy(OpenAPI_lcs_mo_data_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lcs_mo_data_free(dst);
     dst = OpenAPI_lcs_mo_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lcs_mo_service_class.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_create(
 void OpenAPI_lcs_mo_data_free(OpenAPI_lcs_mo_data_t *lcs_mo_data);
 OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_parseFromJSON(cJSON *lcs_mo_dataJSON);
 cJSON *OpenAPI_lcs_mo_data_convertToJSON(OpenAPI_lcs_mo_data_t *lcs_mo_data);
+bool OpenAPI_lcs_mo_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_mo_data_t *lcs_mo_data);
 OpenAPI_lcs_mo_data_t *OpenAPI_lcs_mo_data_copy(OpenAPI_lcs_mo_data_t *dst, OpenAPI_lcs_mo_data_t *src);
 
 #ifdef __cplusplus
@@ -84,6 +84,56 @@ end:
     return item;
 }
 
+bool OpenAPI_lcs_privacy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_privacy_t *lcs_privacy)
+{
+    if (lcs_privacy == NULL) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [LcsPrivacy]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [LcsPrivacy]");
+        return false;
+    }
+    if (lcs_privacy->af_instance_id) {
+    if (OpenAPI_json_write_string(writer, "afInstanceId", lcs_privacy->af_instance_id) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+    }
+
+    if (lcs_privacy->is_reference_id) {
+    if (OpenAPI_json_write_number(writer, "referenceId", lcs_privacy->reference_id) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [reference_id]");
+        goto end;
+    }
+    }
+
+    if (lcs_privacy->lpi) {
+    if (OpenAPI_lpi_writeJSON(writer, "lpi", lcs_privacy->lpi) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [lpi]");
+        goto end;
+    }
+    }
+
+    if (lcs_privacy->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", lcs_privacy->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_privacy_writeJSON() failed [LcsPrivacy]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_parseFromJSON(cJSON *lcs_privacyJSON)
 {
     OpenAPI_lcs_privacy_t *lcs_privacy_local_var = NULL;
@@ -137,7 +187,6 @@ end:
 OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_copy(OpenAPI_lcs_privacy_t *dst, OpenAPI_lcs_privacy_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lcs_privacy_convertToJSON(src);
@@ -146,21 +195,6 @@ OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_copy(OpenAPI_lcs_privacy_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lcs_privacy_free(dst);
     dst = OpenAPI_lcs_privacy_parseFromJSON(item);
     cJSON_Delete(item);
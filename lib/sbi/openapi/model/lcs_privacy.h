@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lpi.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_create(
 void OpenAPI_lcs_privacy_free(OpenAPI_lcs_privacy_t *lcs_privacy);
 OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_parseFromJSON(cJSON *lcs_privacyJSON);
 cJSON *OpenAPI_lcs_privacy_convertToJSON(OpenAPI_lcs_privacy_t *lcs_privacy);
+bool OpenAPI_lcs_privacy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_privacy_t *lcs_privacy);
 OpenAPI_lcs_privacy_t *OpenAPI_lcs_privacy_copy(OpenAPI_lcs_privacy_t *dst, OpenAPI_lcs_privacy_t *src);
 
 #ifdef __cplusplus
@@ -95,6 +95,63 @@ end:
     return item;
 }
 
+bool OpenAPI_lcs_privacy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_privacy_data_t *lcs_privacy_data)
+{
+    if (lcs_privacy_data == NULL) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [LcsPrivacyData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [LcsPrivacyData]");
+        return false;
+    }
+    if (lcs_privacy_data->lpi) {
+    if (OpenAPI_lpi_writeJSON(writer, "lpi", lcs_privacy_data->lpi) == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [lpi]");
+        goto end;
+    }
+    }
+
+    if (lcs_privacy_data->unrelated_class) {
+    if (OpenAPI_unrelated_class_writeJSON(writer, "unrelatedClass", lcs_privacy_data->unrelated_class) == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [unrelated_class]");
+        goto end;
+    }
+    }
+
+    if (lcs_privacy_data->plmn_operator_classes) {
+    if (OpenAPI_json_write_array_start(writer, "plmnOperatorClasses") == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [plmn_operator_classes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *plmn_operator_classes_node;
+    if (lcs_privacy_data->plmn_operator_classes) {
+        OpenAPI_list_for_each(lcs_privacy_data->plmn_operator_classes, plmn_operator_classes_node) {
+            if (OpenAPI_plmn_operator_class_writeJSON(writer, NULL, plmn_operator_classes_node->data) == false) {
+                ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [plmn_operator_classes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [plmn_operator_classes]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lcs_privacy_data_writeJSON() failed [LcsPrivacyData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lcs_privacy_data_t *OpenAPI_lcs_privacy_data_parseFromJSON(cJSON *lcs_privacy_dataJSON)
 {
     OpenAPI_lcs_privacy_data_t *lcs_privacy_data_local_var = NULL;
@@ -155,7 +212,6 @@ end:
 OpenAPI_lcs_privacy_data_t *OpenAPI_lcs_privacy_data_copy(OpenAPI_lcs_privacy_data_t *dst, OpenAPI_lcs_privacy_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lcs_privacy_data_convertToJSON(src);
@@ -164,21 +220,6 @@ OpenAPI_lcs_privacy_data_t *OpenAPI_lcs_privacy_data_copy(OpenAPI_lcs_privacy_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lcs_privacy_data_free(dst);
     dst = OpenAPI_lcs_privacy_data_parseFromJSON(item);
     cJSON_Delete(item);
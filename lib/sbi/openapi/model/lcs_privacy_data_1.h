@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lpi_1.h"
 #include "plmn_operator_class_1.h"
 #include "unrelated_class_1.h"
@@ -35,6 +36,7 @@ OpenAPI_lcs_privacy_data_1_t *OpenAPI_lcs_privacy_data_1_create(
 void OpenAPI_lcs_privacy_data_1_free(OpenAPI_lcs_privacy_data_1_t *lcs_privacy_data_1);
 OpenAPI_lcs_privacy_data_1_t *OpenAPI_lcs_privacy_data_1_parseFromJSON(cJSON *lcs_privacy_data_1JSON);
 cJSON *OpenAPI_lcs_privacy_data_1_convertToJSON(OpenAPI_lcs_privacy_data_1_t *lcs_privacy_data_1);
+bool OpenAPI_lcs_privacy_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lcs_privacy_data_1_t *lcs_privacy_data_1);
 OpenAPI_lcs_privacy_data_1_t *OpenAPI_lcs_privacy_data_1_copy(OpenAPI_lcs_privacy_data_1_t *dst, OpenAPI_lcs_privacy_data_1_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,52 @@ end:
     return item;
 }
 
+bool OpenAPI_limit_id_to_monitoring_key_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_limit_id_to_monitoring_key_t *limit_id_to_monitoring_key)
+{
+    if (limit_id_to_monitoring_key == NULL) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [LimitIdToMonitoringKey]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [LimitIdToMonitoringKey]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "limitId", limit_id_to_monitoring_key->limit_id) == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [limit_id]");
+        goto end;
+    }
+
+    if (limit_id_to_monitoring_key->monkey) {
+    if (OpenAPI_json_write_array_start(writer, "monkey") == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [monkey]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monkey_node;
+    OpenAPI_list_for_each(limit_id_to_monitoring_key->monkey, monkey_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monkey_node->data) == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [monkey]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [monkey]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_limit_id_to_monitoring_key_writeJSON() failed [LimitIdToMonitoringKey]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_limit_id_to_monitoring_key_t *OpenAPI_limit_id_to_monitoring_key_parseFromJSON(cJSON *limit_id_to_monitoring_keyJSON)
 {
     OpenAPI_limit_id_to_monitoring_key_t *limit_id_to_monitoring_key_local_var = NULL;
@@ -114,7 +160,6 @@ end:
 OpenAPI_limit_id_to_monitoring_key_t *OpenAPI_limit_id_to_monitoring_key_copy(OpenAPI_limit_id_to_monitoring_key_t *dst, OpenAPI_limit_id_to_monitoring_key_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_limit_id_to_monitoring_key_convertToJSON(src);
@@ -123,21 +168,6 @@ OpenAPI_limit_id_to_monitoring_key_t *OpenAPI_limit_id_to_monitoring_key_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_limit_id_to_monitoring_key_free(dst);
     dst = OpenAPI_limit_id_to_monitoring_key_parseFromJSON(item);
     cJSON_Delete(item);
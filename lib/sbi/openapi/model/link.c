@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_link_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_link_t *link)
+{
+    if (link == NULL) {
+        ogs_error("OpenAPI_link_writeJSON() failed [Link]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_link_writeJSON() failed [Link]");
+        return false;
+    }
+    if (link->href) {
+    if (OpenAPI_json_write_string(writer, "href", link->href) == false) {
+        ogs_error("OpenAPI_link_writeJSON() failed [href]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_link_writeJSON() failed [Link]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_link_t *OpenAPI_link_parseFromJSON(cJSON *linkJSON)
 {
     OpenAPI_link_t *link_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_link_t *OpenAPI_link_copy(OpenAPI_link_t *dst, OpenAPI_link_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_link_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_link_t *OpenAPI_link_copy(OpenAPI_link_t *dst, OpenAPI_link_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_link_free(dst);
     dst = OpenAPI_link_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_link_t *OpenAPI_link_create(
 void OpenAPI_link_free(OpenAPI_link_t *link);
 OpenAPI_link_t *OpenAPI_link_parseFromJSON(cJSON *linkJSON);
 cJSON *OpenAPI_link_convertToJSON(OpenAPI_link_t *link);
+bool OpenAPI_link_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_link_t *link);
 OpenAPI_link_t *OpenAPI_link_copy(OpenAPI_link_t *dst, OpenAPI_link_t *src);
 
 #ifdef __cplusplus
@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_links_value_schema_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_links_value_schema_t *links_value_schema)
+{
+    if (links_value_schema == NULL) {
+        ogs_error("OpenAPI_links_value_schema_writeJSON() failed [LinksValueSchema]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_links_value_schema_writeJSON() failed [LinksValueSchema]");
+        return false;
+    }
+    if (links_value_schema->href) {
+    if (OpenAPI_json_write_string(writer, "href", links_value_schema->href) == false) {
+        ogs_error("OpenAPI_links_value_schema_writeJSON() failed [href]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_links_value_schema_writeJSON() failed [LinksValueSchema]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_parseFromJSON(cJSON *links_value_schemaJSON)
 {
     OpenAPI_links_value_schema_t *links_value_schema_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_copy(OpenAPI_links_value_schema_t *dst, OpenAPI_links_value_schema_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_links_value_schema_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_copy(OpenAPI_links_valu
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_links_value_schema_free(dst);
     dst = OpenAPI_links_value_schema_parseFromJSON(item);
     cJSON_Delete(item);
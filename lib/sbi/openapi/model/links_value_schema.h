@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "link.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_create(
 void OpenAPI_links_value_schema_free(OpenAPI_links_value_schema_t *links_value_schema);
 OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_parseFromJSON(cJSON *links_value_schemaJSON);
 cJSON *OpenAPI_links_value_schema_convertToJSON(OpenAPI_links_value_schema_t *links_value_schema);
+bool OpenAPI_links_value_schema_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_links_value_schema_t *links_value_schema);
 OpenAPI_links_value_schema_t *OpenAPI_links_value_schema_copy(OpenAPI_links_value_schema_t *dst, OpenAPI_links_value_schema_t *src);
 
 #ifdef __cplusplus
@@ -127,6 +127,110 @@ end:
     return item;
 }
 
+bool OpenAPI_lmf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lmf_info_t *lmf_info)
+{
+    if (lmf_info == NULL) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [LmfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [LmfInfo]");
+        return false;
+    }
+    if (lmf_info->serving_client_types) {
+    if (OpenAPI_json_write_array_start(writer, "servingClientTypes") == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_client_types]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *serving_client_types_node;
+    if (lmf_info->serving_client_types) {
+        OpenAPI_list_for_each(lmf_info->serving_client_types, serving_client_types_node) {
+            if (OpenAPI_external_client_type_writeJSON(writer, NULL, serving_client_types_node->data) == false) {
+                ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_client_types]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_client_types]");
+        goto end;
+    }
+    }
+
+    if (lmf_info->lmf_id) {
+    if (OpenAPI_json_write_string(writer, "lmfId", lmf_info->lmf_id) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [lmf_id]");
+        goto end;
+    }
+    }
+
+    if (lmf_info->serving_access_types) {
+    if (OpenAPI_json_write_array_start(writer, "servingAccessTypes") == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_access_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *serving_access_types_node;
+    OpenAPI_list_for_each(lmf_info->serving_access_types, serving_access_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)serving_access_types_node->data)) == false) {
+            ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_access_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_access_types]");
+        goto end;
+    }
+    }
+
+    if (lmf_info->serving_an_node_types) {
+    if (OpenAPI_json_write_array_start(writer, "servingAnNodeTypes") == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_an_node_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *serving_an_node_types_node;
+    OpenAPI_list_for_each(lmf_info->serving_an_node_types, serving_an_node_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_an_node_type_ToString((intptr_t)serving_an_node_types_node->data)) == false) {
+            ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_an_node_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_an_node_types]");
+        goto end;
+    }
+    }
+
+    if (lmf_info->serving_rat_types) {
+    if (OpenAPI_json_write_array_start(writer, "servingRatTypes") == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_rat_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *serving_rat_types_node;
+    OpenAPI_list_for_each(lmf_info->serving_rat_types, serving_rat_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)serving_rat_types_node->data)) == false) {
+            ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_rat_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [serving_rat_types]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lmf_info_writeJSON() failed [LmfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lmf_info_t *OpenAPI_lmf_info_parseFromJSON(cJSON *lmf_infoJSON)
 {
     OpenAPI_lmf_info_t *lmf_info_local_var = NULL;
@@ -250,7 +354,6 @@ end:
 OpenAPI_lmf_info_t *OpenAPI_lmf_info_copy(OpenAPI_lmf_info_t *dst, OpenAPI_lmf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lmf_info_convertToJSON(src);
@@ -259,21 +362,6 @@ OpenAPI_lmf_info_t *OpenAPI_lmf_info_copy(OpenAPI_lmf_info_t *dst, OpenAPI_lmf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lmf_info_free(dst);
     dst = OpenAPI_lmf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "an_node_type.h"
 #include "external_client_type.h"
@@ -40,6 +41,7 @@ OpenAPI_lmf_info_t *OpenAPI_lmf_info_create(
 void OpenAPI_lmf_info_free(OpenAPI_lmf_info_t *lmf_info);
 OpenAPI_lmf_info_t *OpenAPI_lmf_info_parseFromJSON(cJSON *lmf_infoJSON);
 cJSON *OpenAPI_lmf_info_convertToJSON(OpenAPI_lmf_info_t *lmf_info);
+bool OpenAPI_lmf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lmf_info_t *lmf_info);
 OpenAPI_lmf_info_t *OpenAPI_lmf_info_copy(OpenAPI_lmf_info_t *dst, OpenAPI_lmf_info_t *src);
 
 #ifdef __cplusplus
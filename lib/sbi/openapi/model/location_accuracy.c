@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_location_accuracy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_accuracy_t *location_accuracy)
+{
+    if (location_accuracy == NULL) {
+        ogs_error("OpenAPI_location_accuracy_writeJSON() failed [LocationAccuracy]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_location_accuracy_writeJSON() failed [LocationAccuracy]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_location_accuracy_writeJSON() failed [LocationAccuracy]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_parseFromJSON(cJSON *location_accuracyJSON)
 {
     OpenAPI_location_accuracy_t *location_accuracy_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_copy(OpenAPI_location_accuracy_t *dst, OpenAPI_location_accuracy_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_accuracy_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_copy(OpenAPI_location_acc
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_accuracy_free(dst);
     dst = OpenAPI_location_accuracy_parseFromJSON(item);
     cJSON_Delete(item);
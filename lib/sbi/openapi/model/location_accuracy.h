@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "location_accuracy_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_create(
 void OpenAPI_location_accuracy_free(OpenAPI_location_accuracy_t *location_accuracy);
 OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_parseFromJSON(cJSON *location_accuracyJSON);
 cJSON *OpenAPI_location_accuracy_convertToJSON(OpenAPI_location_accuracy_t *location_accuracy);
+bool OpenAPI_location_accuracy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_accuracy_t *location_accuracy);
 OpenAPI_location_accuracy_t *OpenAPI_location_accuracy_copy(OpenAPI_location_accuracy_t *dst, OpenAPI_location_accuracy_t *src);
 
 #ifdef __cplusplus
@@ -105,6 +105,77 @@ end:
     return item;
 }
 
+bool OpenAPI_location_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_area_t *location_area)
+{
+    if (location_area == NULL) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [LocationArea]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [LocationArea]");
+        return false;
+    }
+    if (location_area->geographic_areas) {
+    if (OpenAPI_json_write_array_start(writer, "geographicAreas") == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [geographic_areas]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *geographic_areas_node;
+    if (location_area->geographic_areas) {
+        OpenAPI_list_for_each(location_area->geographic_areas, geographic_areas_node) {
+            if (OpenAPI_geographic_area_writeJSON(writer, NULL, geographic_areas_node->data) == false) {
+                ogs_error("OpenAPI_location_area_writeJSON() failed [geographic_areas]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [geographic_areas]");
+        goto end;
+    }
+    }
+
+    if (location_area->civic_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "civicAddresses") == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [civic_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *civic_addresses_node;
+    if (location_area->civic_addresses) {
+        OpenAPI_list_for_each(location_area->civic_addresses, civic_addresses_node) {
+            if (OpenAPI_civic_address_writeJSON(writer, NULL, civic_addresses_node->data) == false) {
+                ogs_error("OpenAPI_location_area_writeJSON() failed [civic_addresses]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [civic_addresses]");
+        goto end;
+    }
+    }
+
+    if (location_area->nw_area_info) {
+    if (OpenAPI_network_area_info_writeJSON(writer, "nwAreaInfo", location_area->nw_area_info) == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [nw_area_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_location_area_writeJSON() failed [LocationArea]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_location_area_t *OpenAPI_location_area_parseFromJSON(cJSON *location_areaJSON)
 {
     OpenAPI_location_area_t *location_area_local_var = NULL;
@@ -187,7 +258,6 @@ end:
 OpenAPI_location_area_t *OpenAPI_location_area_copy(OpenAPI_location_area_t *dst, OpenAPI_location_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_area_convertToJSON(src);
@@ -196,21 +266,6 @@ OpenAPI_location_area_t *OpenAPI_location_area_copy(OpenAPI_location_area_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_area_free(dst);
     dst = OpenAPI_location_area_parseFromJSON(item);
     cJSON_Delete(item);
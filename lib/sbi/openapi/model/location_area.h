@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "civic_address.h"
 #include "geographic_area.h"
 #include "network_area_info.h"
@@ -35,6 +36,7 @@ OpenAPI_location_area_t *OpenAPI_location_area_create(
 void OpenAPI_location_area_free(OpenAPI_location_area_t *location_area);
 OpenAPI_location_area_t *OpenAPI_location_area_parseFromJSON(cJSON *location_areaJSON);
 cJSON *OpenAPI_location_area_convertToJSON(OpenAPI_location_area_t *location_area);
+bool OpenAPI_location_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_area_t *location_area);
 OpenAPI_location_area_t *OpenAPI_location_area_copy(OpenAPI_location_area_t *dst, OpenAPI_location_area_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "civic_address.h"
 #include "geographic_area.h"
 #include "network_area_info_1.h"
@@ -35,6 +36,7 @@ OpenAPI_location_area_1_t *OpenAPI_location_area_1_create(
 void OpenAPI_location_area_1_free(OpenAPI_location_area_1_t *location_area_1);
 OpenAPI_location_area_1_t *OpenAPI_location_area_1_parseFromJSON(cJSON *location_area_1JSON);
 cJSON *OpenAPI_location_area_1_convertToJSON(OpenAPI_location_area_1_t *location_area_1);
+bool OpenAPI_location_area_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_area_1_t *location_area_1);
 OpenAPI_location_area_1_t *OpenAPI_location_area_1_copy(OpenAPI_location_area_1_t *dst, OpenAPI_location_area_1_t *src);
 
 #ifdef __cplusplus
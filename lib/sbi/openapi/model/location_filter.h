@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "location_filter_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_location_filter_t *OpenAPI_location_filter_create(
 void OpenAPI_location_filter_free(OpenAPI_location_filter_t *location_filter);
 OpenAPI_location_filter_t *OpenAPI_location_filter_parseFromJSON(cJSON *location_filterJSON);
 cJSON *OpenAPI_location_filter_convertToJSON(OpenAPI_location_filter_t *location_filter);
+bool OpenAPI_location_filter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_filter_t *location_filter);
 OpenAPI_location_filter_t *OpenAPI_location_filter_copy(OpenAPI_location_filter_t *dst, OpenAPI_location_filter_t *src);
 
 #ifdef __cplusplus
@@ -91,6 +91,68 @@ end:
     return item;
 }
 
+bool OpenAPI_location_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_info_t *location_info)
+{
+    if (location_info == NULL) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [LocationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [LocationInfo]");
+        return false;
+    }
+    if (location_info->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", location_info->supi) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (location_info->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", location_info->gpsi) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "registrationLocationInfoList") == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [registration_location_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *registration_location_info_list_node;
+    if (location_info->registration_location_info_list) {
+        OpenAPI_list_for_each(location_info->registration_location_info_list, registration_location_info_list_node) {
+            if (OpenAPI_registration_location_info_writeJSON(writer, NULL, registration_location_info_list_node->data) == false) {
+                ogs_error("OpenAPI_location_info_writeJSON() failed [registration_location_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [registration_location_info_list]");
+        goto end;
+    }
+
+    if (location_info->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", location_info->supported_features) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_location_info_writeJSON() failed [LocationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_location_info_t *OpenAPI_location_info_parseFromJSON(cJSON *location_infoJSON)
 {
     OpenAPI_location_info_t *location_info_local_var = NULL;
@@ -167,7 +229,6 @@ end:
 OpenAPI_location_info_t *OpenAPI_location_info_copy(OpenAPI_location_info_t *dst, OpenAPI_location_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_info_convertToJSON(src);
@@ -176,21 +237,6 @@ OpenAPI_location_info_t *OpenAPI_location_info_copy(OpenAPI_location_info_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_info_free(dst);
     dst = OpenAPI_location_info_parseFromJSON(item);
     cJSON_Delete(item);
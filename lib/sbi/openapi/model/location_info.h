@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "registration_location_info.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_location_info_t *OpenAPI_location_info_create(
 void OpenAPI_location_info_free(OpenAPI_location_info_t *location_info);
 OpenAPI_location_info_t *OpenAPI_location_info_parseFromJSON(cJSON *location_infoJSON);
 cJSON *OpenAPI_location_info_convertToJSON(OpenAPI_location_info_t *location_info);
+bool OpenAPI_location_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_info_t *location_info);
 OpenAPI_location_info_t *OpenAPI_location_info_copy(OpenAPI_location_info_t *dst, OpenAPI_location_info_t *src);
 
 #ifdef __cplusplus
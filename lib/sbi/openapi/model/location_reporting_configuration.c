@@ -87,6 +87,54 @@ end:
     return item;
 }
 
+bool OpenAPI_location_reporting_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_reporting_configuration_t *location_reporting_configuration)
+{
+    if (location_reporting_configuration == NULL) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [LocationReportingConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [LocationReportingConfiguration]");
+        return false;
+    }
+    if (OpenAPI_json_write_bool(writer, "currentLocation", location_reporting_configuration->current_location) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [current_location]");
+        goto end;
+    }
+
+    if (location_reporting_configuration->is_one_time) {
+    if (OpenAPI_json_write_bool(writer, "oneTime", location_reporting_configuration->one_time) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [one_time]");
+        goto end;
+    }
+    }
+
+    if (location_reporting_configuration->accuracy) {
+    if (OpenAPI_location_accuracy_writeJSON(writer, "accuracy", location_reporting_configuration->accuracy) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [accuracy]");
+        goto end;
+    }
+    }
+
+    if (location_reporting_configuration->n3gpp_accuracy) {
+    if (OpenAPI_location_accuracy_writeJSON(writer, "n3gppAccuracy", location_reporting_configuration->n3gpp_accuracy) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [n3gpp_accuracy]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_location_reporting_configuration_writeJSON() failed [LocationReportingConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configuration_parseFromJSON(cJSON *location_reporting_configurationJSON)
 {
     OpenAPI_location_reporting_configuration_t *location_reporting_configuration_local_var = NULL;
@@ -141,7 +189,6 @@ end:
 OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configuration_copy(OpenAPI_location_reporting_configuration_t *dst, OpenAPI_location_reporting_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_location_reporting_configuration_convertToJSON(src);
@@ -150,21 +197,6 @@ OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configura
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_location_reporting_configuration_free(dst);
     dst = OpenAPI_location_reporting_configuration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "location_accuracy.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configura
 void OpenAPI_location_reporting_configuration_free(OpenAPI_location_reporting_configuration_t *location_reporting_configuration);
 OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configuration_parseFromJSON(cJSON *location_reporting_configurationJSON);
 cJSON *OpenAPI_location_reporting_configuration_convertToJSON(OpenAPI_location_reporting_configuration_t *location_reporting_configuration);
+bool OpenAPI_location_reporting_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_location_reporting_configuration_t *location_reporting_configuration);
 OpenAPI_location_reporting_configuration_t *OpenAPI_location_reporting_configuration_copy(OpenAPI_location_reporting_configuration_t *dst, OpenAPI_location_reporting_configuration_t *src);
 
 #ifdef __cplusplus
@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_loss_connectivity_cfg_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_loss_connectivity_cfg_t *loss_connectivity_cfg)
+{
+    if (loss_connectivity_cfg == NULL) {
+        ogs_error("OpenAPI_loss_connectivity_cfg_writeJSON() failed [LossConnectivityCfg]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_loss_connectivity_cfg_writeJSON() failed [LossConnectivityCfg]");
+        return false;
+    }
+    if (loss_connectivity_cfg->is_max_detection_time) {
+    if (OpenAPI_json_write_number(writer, "maxDetectionTime", loss_connectivity_cfg->max_detection_time) == false) {
+        ogs_error("OpenAPI_loss_connectivity_cfg_writeJSON() failed [max_detection_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_loss_connectivity_cfg_writeJSON() failed [LossConnectivityCfg]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_loss_connectivity_cfg_t *OpenAPI_loss_connectivity_cfg_parseFromJSON(cJSON *loss_connectivity_cfgJSON)
 {
     OpenAPI_loss_connectivity_cfg_t *loss_connectivity_cfg_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_loss_connectivity_cfg_t *OpenAPI_loss_connectivity_cfg_copy(OpenAPI_loss_connectivity_cfg_t *dst, OpenAPI_loss_connectivity_cfg_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_loss_connectivity_cfg_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_loss_connectivity_cfg_t *OpenAPI_loss_connectivity_cfg_copy(OpenAPI_loss
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_loss_connectivity_cfg_free(dst);
     dst = OpenAPI_loss_connectivity_cfg_parseFromJSON(item);
     cJSON_Delete(item);
@@ -60,6 +60,40 @@ end:
     return item;
 }
 
+bool OpenAPI_lpi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lpi_t *lpi)
+{
+    if (lpi == NULL) {
+        ogs_error("OpenAPI_lpi_writeJSON() failed [Lpi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lpi_writeJSON() failed [Lpi]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "locationPrivacyInd", OpenAPI_location_privacy_ind_ToString(lpi->location_privacy_ind)) == false) {
+        ogs_error("OpenAPI_lpi_writeJSON() failed [location_privacy_ind]");
+        goto end;
+    }
+
+    if (lpi->valid_time_period) {
+    if (OpenAPI_valid_time_period_writeJSON(writer, "validTimePeriod", lpi->valid_time_period) == false) {
+        ogs_error("OpenAPI_lpi_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lpi_writeJSON() failed [Lpi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lpi_t *OpenAPI_lpi_parseFromJSON(cJSON *lpiJSON)
 {
     OpenAPI_lpi_t *lpi_local_var = NULL;
@@ -96,7 +130,6 @@ end:
 OpenAPI_lpi_t *OpenAPI_lpi_copy(OpenAPI_lpi_t *dst, OpenAPI_lpi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lpi_convertToJSON(src);
@@ -105,21 +138,6 @@ OpenAPI_lpi_t *OpenAPI_lpi_copy(OpenAPI_lpi_t *dst, OpenAPI_lpi_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lpi_free(dst);
     dst = OpenAPI_lpi_parseFromJSON(item);
     cJSON_Delete(item);
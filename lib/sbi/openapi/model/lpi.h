@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "location_privacy_ind.h"
 #include "valid_time_period.h"
 
@@ -32,6 +33,7 @@ OpenAPI_lpi_t *OpenAPI_lpi_create(
 void OpenAPI_lpi_free(OpenAPI_lpi_t *lpi);
 OpenAPI_lpi_t *OpenAPI_lpi_parseFromJSON(cJSON *lpiJSON);
 cJSON *OpenAPI_lpi_convertToJSON(OpenAPI_lpi_t *lpi);
+bool OpenAPI_lpi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lpi_t *lpi);
 OpenAPI_lpi_t *OpenAPI_lpi_copy(OpenAPI_lpi_t *dst, OpenAPI_lpi_t *src);
 
 #ifdef __cplusplus
@@ -60,6 +60,40 @@ end:
     return item;
 }
 
+bool OpenAPI_lpi_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lpi_1_t *lpi_1)
+{
+    if (lpi_1 == NULL) {
+        ogs_error("OpenAPI_lpi_1_writeJSON() failed [Lpi_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lpi_1_writeJSON() failed [Lpi_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "locationPrivacyInd", OpenAPI_location_privacy_ind_ToString(lpi_1->location_privacy_ind)) == false) {
+        ogs_error("OpenAPI_lpi_1_writeJSON() failed [location_privacy_ind]");
+        goto end;
+    }
+
+    if (lpi_1->valid_time_period) {
+    if (OpenAPI_valid_time_period_1_writeJSON(writer, "validTimePeriod", lpi_1->valid_time_period) == false) {
+        ogs_error("OpenAPI_lpi_1_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lpi_1_writeJSON() failed [Lpi_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lpi_1_t *OpenAPI_lpi_1_parseFromJSON(cJSON *lpi_1JSON)
 {
     OpenAPI_lpi_1_t *lpi_1_local_var = NULL;
@@ -96,7 +130,6 @@ end:
 OpenAPI_lpi_1_t *OpenAPI_lpi_1_copy(OpenAPI_lpi_1_t *dst, OpenAPI_lpi_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lpi_1_convertToJSON(src);
@@ -105,21 +138,6 @@ OpenAPI_lpi_1_t *OpenAPI_lpi_1_copy(OpenAPI_lpi_1_t *dst, OpenAPI_lpi_1_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lpi_1_free(dst);
     dst = OpenAPI_lpi_1_parseFromJSON(item);
     cJSON_Delete(item);
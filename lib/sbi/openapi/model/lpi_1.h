@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "location_privacy_ind.h"
 #include "valid_time_period_1.h"
 
@@ -32,6 +33,7 @@ OpenAPI_lpi_1_t *OpenAPI_lpi_1_create(
 void OpenAPI_lpi_1_free(OpenAPI_lpi_1_t *lpi_1);
 OpenAPI_lpi_1_t *OpenAPI_lpi_1_parseFromJSON(cJSON *lpi_1JSON);
 cJSON *OpenAPI_lpi_1_convertToJSON(OpenAPI_lpi_1_t *lpi_1);
+bool OpenAPI_lpi_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lpi_1_t *lpi_1);
 OpenAPI_lpi_1_t *OpenAPI_lpi_1_copy(OpenAPI_lpi_1_t *dst, OpenAPI_lpi_1_t *src);
 
 #ifdef __cplusplus
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_lte_m_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lte_m_ind_t *lte_m_ind)
+{
+    if (lte_m_ind == NULL) {
+        ogs_error("OpenAPI_lte_m_ind_writeJSON() failed [LteMInd]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_lte_m_ind_writeJSON() failed [LteMInd]");
+        return false;
+    }
+    if (OpenAPI_json_write_bool(writer, "lteCatMInd", lte_m_ind->lte_cat_m_ind) == false) {
+        ogs_error("OpenAPI_lte_m_ind_writeJSON() failed [lte_cat_m_ind]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_lte_m_ind_writeJSON() failed [LteMInd]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_parseFromJSON(cJSON *lte_m_indJSON)
 {
     OpenAPI_lte_m_ind_t *lte_m_ind_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_copy(OpenAPI_lte_m_ind_t *dst, OpenAPI_lte_m_ind_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_lte_m_ind_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_copy(OpenAPI_lte_m_ind_t *dst, OpenAPI_lt
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_lte_m_ind_free(dst);
     dst = OpenAPI_lte_m_ind_parseFromJSON(item);
     cJSON_Delete(item);
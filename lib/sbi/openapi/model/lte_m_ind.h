@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_create(
 void OpenAPI_lte_m_ind_free(OpenAPI_lte_m_ind_t *lte_m_ind);
 OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_parseFromJSON(cJSON *lte_m_indJSON);
 cJSON *OpenAPI_lte_m_ind_convertToJSON(OpenAPI_lte_m_ind_t *lte_m_ind);
+bool OpenAPI_lte_m_ind_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lte_m_ind_t *lte_m_ind);
 OpenAPI_lte_m_ind_t *OpenAPI_lte_m_ind_copy(OpenAPI_lte_m_ind_t *dst, OpenAPI_lte_m_ind_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_auth.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_lte_v2x_auth_1_t *OpenAPI_lte_v2x_auth_1_create(
 void OpenAPI_lte_v2x_auth_1_free(OpenAPI_lte_v2x_auth_1_t *lte_v2x_auth_1);
 OpenAPI_lte_v2x_auth_1_t *OpenAPI_lte_v2x_auth_1_parseFromJSON(cJSON *lte_v2x_auth_1JSON);
 cJSON *OpenAPI_lte_v2x_auth_1_convertToJSON(OpenAPI_lte_v2x_auth_1_t *lte_v2x_auth_1);
+bool OpenAPI_lte_v2x_auth_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_lte_v2x_auth_1_t *lte_v2x_auth_1);
 OpenAPI_lte_v2x_auth_1_t *OpenAPI_lte_v2x_auth_1_copy(OpenAPI_lte_v2x_auth_1_t *dst, OpenAPI_lte_v2x_auth_1_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_mapping_of_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mapping_of_snssai_t *mapping_of_snssai)
+{
+    if (mapping_of_snssai == NULL) {
+        ogs_error("OpenAPI_mapping_of_snssai_writeJSON() failed [MappingOfSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mapping_of_snssai_writeJSON() failed [MappingOfSnssai]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "servingSnssai", mapping_of_snssai->serving_snssai) == false) {
+        ogs_error("OpenAPI_mapping_of_snssai_writeJSON() failed [serving_snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "homeSnssai", mapping_of_snssai->home_snssai) == false) {
+        ogs_error("OpenAPI_mapping_of_snssai_writeJSON() failed [home_snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mapping_of_snssai_writeJSON() failed [MappingOfSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_parseFromJSON(cJSON *mapping_of_snssaiJSON)
 {
     OpenAPI_mapping_of_snssai_t *mapping_of_snssai_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_copy(OpenAPI_mapping_of_snssai_t *dst, OpenAPI_mapping_of_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mapping_of_snssai_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_copy(OpenAPI_mapping_of_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mapping_of_snssai_free(dst);
     dst = OpenAPI_mapping_of_snssai_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_create(
 void OpenAPI_mapping_of_snssai_free(OpenAPI_mapping_of_snssai_t *mapping_of_snssai);
 OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_parseFromJSON(cJSON *mapping_of_snssaiJSON);
 cJSON *OpenAPI_mapping_of_snssai_convertToJSON(OpenAPI_mapping_of_snssai_t *mapping_of_snssai);
+bool OpenAPI_mapping_of_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mapping_of_snssai_t *mapping_of_snssai);
 OpenAPI_mapping_of_snssai_t *OpenAPI_mapping_of_snssai_copy(OpenAPI_mapping_of_snssai_t *dst, OpenAPI_mapping_of_snssai_t *src);
 
 #ifdef __cplusplus
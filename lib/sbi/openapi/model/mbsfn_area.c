@@ -59,6 +59,42 @@ end:
     return item;
 }
 
+bool OpenAPI_mbsfn_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mbsfn_area_t *mbsfn_area)
+{
+    if (mbsfn_area == NULL) {
+        ogs_error("OpenAPI_mbsfn_area_writeJSON() failed [MbsfnArea]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mbsfn_area_writeJSON() failed [MbsfnArea]");
+        return false;
+    }
+    if (mbsfn_area->is_mbsfn_area_id) {
+    if (OpenAPI_json_write_number(writer, "mbsfnAreaId", mbsfn_area->mbsfn_area_id) == false) {
+        ogs_error("OpenAPI_mbsfn_area_writeJSON() failed [mbsfn_area_id]");
+        goto end;
+    }
+    }
+
+    if (mbsfn_area->is_carrier_frequency) {
+    if (OpenAPI_json_write_number(writer, "carrierFrequency", mbsfn_area->carrier_frequency) == false) {
+        ogs_error("OpenAPI_mbsfn_area_writeJSON() failed [carrier_frequency]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mbsfn_area_writeJSON() failed [MbsfnArea]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_parseFromJSON(cJSON *mbsfn_areaJSON)
 {
     OpenAPI_mbsfn_area_t *mbsfn_area_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_copy(OpenAPI_mbsfn_area_t *dst, OpenAPI_mbsfn_area_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mbsfn_area_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_copy(OpenAPI_mbsfn_area_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mbsfn_area_free(dst);
     dst = OpenAPI_mbsfn_area_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_create(
 void OpenAPI_mbsfn_area_free(OpenAPI_mbsfn_area_t *mbsfn_area);
 OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_parseFromJSON(cJSON *mbsfn_areaJSON);
 cJSON *OpenAPI_mbsfn_area_convertToJSON(OpenAPI_mbsfn_area_t *mbsfn_area);
+bool OpenAPI_mbsfn_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mbsfn_area_t *mbsfn_area);
 OpenAPI_mbsfn_area_t *OpenAPI_mbsfn_area_copy(OpenAPI_mbsfn_area_t *dst, OpenAPI_mbsfn_area_t *src);
 
 #ifdef __cplusplus
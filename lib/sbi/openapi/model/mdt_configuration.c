@@ -398,6 +398,323 @@ end:
     return item;
 }
 
+bool OpenAPI_mdt_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mdt_configuration_t *mdt_configuration)
+{
+    if (mdt_configuration == NULL) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [MdtConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [MdtConfiguration]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "jobType", OpenAPI_job_type_ToString(mdt_configuration->job_type)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [job_type]");
+        goto end;
+    }
+
+    if (mdt_configuration->report_type) {
+    if (OpenAPI_json_write_string(writer, "reportType", OpenAPI_report_type_mdt_ToString(mdt_configuration->report_type)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [report_type]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->area_scope) {
+    if (OpenAPI_area_scope_writeJSON(writer, "areaScope", mdt_configuration->area_scope) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [area_scope]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->measurement_lte_list) {
+    if (OpenAPI_json_write_array_start(writer, "measurementLteList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_lte_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *measurement_lte_list_node;
+    OpenAPI_list_for_each(mdt_configuration->measurement_lte_list, measurement_lte_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_measurement_lte_for_mdt_ToString((intptr_t)measurement_lte_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_lte_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_lte_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->measurement_nr_list) {
+    if (OpenAPI_json_write_array_start(writer, "measurementNrList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_nr_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *measurement_nr_list_node;
+    OpenAPI_list_for_each(mdt_configuration->measurement_nr_list, measurement_nr_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_measurement_nr_for_mdt_ToString((intptr_t)measurement_nr_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_nr_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_nr_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->sensor_measurement_list) {
+    if (OpenAPI_json_write_array_start(writer, "sensorMeasurementList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [sensor_measurement_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sensor_measurement_list_node;
+    OpenAPI_list_for_each(mdt_configuration->sensor_measurement_list, sensor_measurement_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_sensor_measurement_ToString((intptr_t)sensor_measurement_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [sensor_measurement_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [sensor_measurement_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->reporting_trigger_list) {
+    if (OpenAPI_json_write_array_start(writer, "reportingTriggerList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [reporting_trigger_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *reporting_trigger_list_node;
+    OpenAPI_list_for_each(mdt_configuration->reporting_trigger_list, reporting_trigger_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_reporting_trigger_ToString((intptr_t)reporting_trigger_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [reporting_trigger_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [reporting_trigger_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->report_interval) {
+    if (OpenAPI_json_write_string(writer, "reportInterval", OpenAPI_report_interval_mdt_ToString(mdt_configuration->report_interval)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [report_interval]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->report_interval_nr) {
+    if (OpenAPI_json_write_string(writer, "reportIntervalNr", OpenAPI_report_interval_nr_mdt_ToString(mdt_configuration->report_interval_nr)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [report_interval_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->report_amount) {
+    if (OpenAPI_json_write_string(writer, "reportAmount", OpenAPI_report_amount_mdt_ToString(mdt_configuration->report_amount)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [report_amount]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->is_event_threshold_rsrp) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrp", mdt_configuration->event_threshold_rsrp) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_threshold_rsrp]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->is_event_threshold_rsrp_nr) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrpNr", mdt_configuration->event_threshold_rsrp_nr) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_threshold_rsrp_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->is_event_threshold_rsrq) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrq", mdt_configuration->event_threshold_rsrq) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_threshold_rsrq]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->is_event_threshold_rsrq_nr) {
+    if (OpenAPI_json_write_number(writer, "eventThresholdRsrqNr", mdt_configuration->event_threshold_rsrq_nr) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_threshold_rsrq_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->event_list) {
+    if (OpenAPI_json_write_array_start(writer, "eventList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *event_list_node;
+    OpenAPI_list_for_each(mdt_configuration->event_list, event_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_event_for_mdt_ToString((intptr_t)event_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [event_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->logging_interval) {
+    if (OpenAPI_json_write_string(writer, "loggingInterval", OpenAPI_logging_interval_mdt_ToString(mdt_configuration->logging_interval)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [logging_interval]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->logging_interval_nr) {
+    if (OpenAPI_json_write_string(writer, "loggingIntervalNr", OpenAPI_logging_interval_nr_mdt_ToString(mdt_configuration->logging_interval_nr)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [logging_interval_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->logging_duration) {
+    if (OpenAPI_json_write_string(writer, "loggingDuration", OpenAPI_logging_duration_mdt_ToString(mdt_configuration->logging_duration)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [logging_duration]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->logging_duration_nr) {
+    if (OpenAPI_json_write_string(writer, "loggingDurationNr", OpenAPI_logging_duration_nr_mdt_ToString(mdt_configuration->logging_duration_nr)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [logging_duration_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->positioning_method) {
+    if (OpenAPI_json_write_string(writer, "positioningMethod", OpenAPI_positioning_method_mdt_ToString(mdt_configuration->positioning_method)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [positioning_method]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->add_positioning_method_list) {
+    if (OpenAPI_json_write_array_start(writer, "addPositioningMethodList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [add_positioning_method_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *add_positioning_method_list_node;
+    OpenAPI_list_for_each(mdt_configuration->add_positioning_method_list, add_positioning_method_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_positioning_method_mdt_ToString((intptr_t)add_positioning_method_list_node->data)) == false) {
+            ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [add_positioning_method_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [add_positioning_method_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->collection_period_rmm_lte) {
+    if (OpenAPI_json_write_string(writer, "collectionPeriodRmmLte", OpenAPI_collection_period_rmm_lte_mdt_ToString(mdt_configuration->collection_period_rmm_lte)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [collection_period_rmm_lte]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->collection_period_rmm_nr) {
+    if (OpenAPI_json_write_string(writer, "collectionPeriodRmmNr", OpenAPI_collection_period_rmm_nr_mdt_ToString(mdt_configuration->collection_period_rmm_nr)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [collection_period_rmm_nr]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->measurement_period_lte) {
+    if (OpenAPI_json_write_string(writer, "measurementPeriodLte", OpenAPI_measurement_period_lte_mdt_ToString(mdt_configuration->measurement_period_lte)) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [measurement_period_lte]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->mdt_allowed_plmn_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "mdtAllowedPlmnIdList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mdt_allowed_plmn_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mdt_allowed_plmn_id_list_node;
+    if (mdt_configuration->mdt_allowed_plmn_id_list) {
+        OpenAPI_list_for_each(mdt_configuration->mdt_allowed_plmn_id_list, mdt_allowed_plmn_id_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, mdt_allowed_plmn_id_list_node->data) == false) {
+                ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mdt_allowed_plmn_id_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mdt_allowed_plmn_id_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->mbsfn_area_list) {
+    if (OpenAPI_json_write_array_start(writer, "mbsfnAreaList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mbsfn_area_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mbsfn_area_list_node;
+    if (mdt_configuration->mbsfn_area_list) {
+        OpenAPI_list_for_each(mdt_configuration->mbsfn_area_list, mbsfn_area_list_node) {
+            if (OpenAPI_mbsfn_area_writeJSON(writer, NULL, mbsfn_area_list_node->data) == false) {
+                ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mbsfn_area_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [mbsfn_area_list]");
+        goto end;
+    }
+    }
+
+    if (mdt_configuration->inter_freq_target_list) {
+    if (OpenAPI_json_write_array_start(writer, "interFreqTargetList") == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [inter_freq_target_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *inter_freq_target_list_node;
+    if (mdt_configuration->inter_freq_target_list) {
+        OpenAPI_list_for_each(mdt_configuration->inter_freq_target_list, inter_freq_target_list_node) {
+            if (OpenAPI_inter_freq_target_info_writeJSON(writer, NULL, inter_freq_target_list_node->data) == false) {
+                ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [inter_freq_target_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [inter_freq_target_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mdt_configuration_writeJSON() failed [MdtConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_parseFromJSON(cJSON *mdt_configurationJSON)
 {
     OpenAPI_mdt_configuration_t *mdt_configuration_local_var = NULL;
@@ -850,7 +1167,6 @@ end:
 OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_copy(OpenAPI_mdt_configuration_t *dst, OpenAPI_mdt_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mdt_configuration_convertToJSON(src);
@@ -859,21 +1175,6 @@ OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_copy(OpenAPI_mdt_configur
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mdt_configuration_free(dst);
     dst = OpenAPI_mdt_configuration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "area_scope.h"
 #include "collection_period_rmm_lte_mdt.h"
 #include "collection_period_rmm_nr_mdt.h"
@@ -110,6 +111,7 @@ OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_create(
 void OpenAPI_mdt_configuration_free(OpenAPI_mdt_configuration_t *mdt_configuration);
 OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_parseFromJSON(cJSON *mdt_configurationJSON);
 cJSON *OpenAPI_mdt_configuration_convertToJSON(OpenAPI_mdt_configuration_t *mdt_configuration);
+bool OpenAPI_mdt_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mdt_configuration_t *mdt_configuration);
 OpenAPI_mdt_configuration_t *OpenAPI_mdt_configuration_copy(OpenAPI_mdt_configuration_t *dst, OpenAPI_mdt_configuration_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "area_scope.h"
 #include "collection_period_rmm_lte_mdt.h"
 #include "collection_period_rmm_nr_mdt.h"
@@ -110,6 +111,7 @@ OpenAPI_mdt_configuration_1_t *OpenAPI_mdt_configuration_1_create(
 void OpenAPI_mdt_configuration_1_free(OpenAPI_mdt_configuration_1_t *mdt_configuration_1);
 OpenAPI_mdt_configuration_1_t *OpenAPI_mdt_configuration_1_parseFromJSON(cJSON *mdt_configuration_1JSON);
 cJSON *OpenAPI_mdt_configuration_1_convertToJSON(OpenAPI_mdt_configuration_1_t *mdt_configuration_1);
+bool OpenAPI_mdt_configuration_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mdt_configuration_1_t *mdt_configuration_1);
 OpenAPI_mdt_configuration_1_t *OpenAPI_mdt_configuration_1_copy(OpenAPI_mdt_configuration_1_t *dst, OpenAPI_mdt_configuration_1_t *src);
 
 #ifdef __cplusplus
@@ -456,6 +456,311 @@ end:
     return item;
 }
 
+bool OpenAPI_media_component_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_media_component_t *media_component)
+{
+    if (media_component == NULL) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [MediaComponent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [MediaComponent]");
+        return false;
+    }
+    if (media_component->af_app_id) {
+    if (OpenAPI_json_write_string(writer, "afAppId", media_component->af_app_id) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+    }
+
+    if (media_component->af_rout_req) {
+    if (OpenAPI_af_routing_requirement_writeJSON(writer, "afRoutReq", media_component->af_rout_req) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [af_rout_req]");
+        goto end;
+    }
+    }
+
+    if (media_component->qos_reference) {
+    if (OpenAPI_json_write_string(writer, "qosReference", media_component->qos_reference) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [qos_reference]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_dis_ue_notif) {
+    if (OpenAPI_json_write_bool(writer, "disUeNotif", media_component->dis_ue_notif) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [dis_ue_notif]");
+        goto end;
+    }
+    }
+
+    if (media_component->alt_ser_reqs) {
+    if (OpenAPI_json_write_array_start(writer, "altSerReqs") == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_ser_reqs_node;
+    OpenAPI_list_for_each(media_component->alt_ser_reqs, alt_ser_reqs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_ser_reqs_node->data) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_cont_ver) {
+    if (OpenAPI_json_write_number(writer, "contVer", media_component->cont_ver) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [cont_ver]");
+        goto end;
+    }
+    }
+
+    if (media_component->codecs) {
+    if (OpenAPI_json_write_array_start(writer, "codecs") == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [codecs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *codecs_node;
+    OpenAPI_list_for_each(media_component->codecs, codecs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)codecs_node->data) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [codecs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [codecs]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_des_max_latency) {
+    if (OpenAPI_json_write_number(writer, "desMaxLatency", media_component->des_max_latency) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [des_max_latency]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_des_max_loss) {
+    if (OpenAPI_json_write_number(writer, "desMaxLoss", media_component->des_max_loss) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [des_max_loss]");
+        goto end;
+    }
+    }
+
+    if (media_component->flus_id) {
+    if (OpenAPI_json_write_string(writer, "flusId", media_component->flus_id) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [flus_id]");
+        goto end;
+    }
+    }
+
+    if (media_component->f_status) {
+    if (OpenAPI_json_write_string(writer, "fStatus", OpenAPI_flow_status_ToString(media_component->f_status)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [f_status]");
+        goto end;
+    }
+    }
+
+    if (media_component->mar_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "marBwDl", media_component->mar_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [mar_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->mar_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "marBwUl", media_component->mar_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [mar_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_max_packet_loss_rate_dl) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateDl", media_component->max_packet_loss_rate_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [max_packet_loss_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_max_packet_loss_rate_ul) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateUl", media_component->max_packet_loss_rate_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [max_packet_loss_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component->max_supp_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "maxSuppBwDl", media_component->max_supp_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [max_supp_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->max_supp_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "maxSuppBwUl", media_component->max_supp_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [max_supp_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "medCompN", media_component->med_comp_n) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [med_comp_n]");
+        goto end;
+    }
+
+    if (media_component->med_sub_comps) {
+    if (OpenAPI_json_write_object_start(writer, "medSubComps") == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [med_sub_comps]");
+        goto end;
+    }
+    OpenAPI_lnode_t *med_sub_comps_node;
+    if (media_component->med_sub_comps) {
+        OpenAPI_list_for_each(media_component->med_sub_comps, med_sub_comps_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)med_sub_comps_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_media_sub_component_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_media_component_writeJSON() failed [med_sub_comps]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [med_sub_comps]");
+        goto end;
+    }
+    }
+
+    if (media_component->med_type) {
+    if (OpenAPI_json_write_string(writer, "medType", OpenAPI_media_type_ToString(media_component->med_type)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [med_type]");
+        goto end;
+    }
+    }
+
+    if (media_component->min_des_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "minDesBwDl", media_component->min_des_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [min_des_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->min_des_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "minDesBwUl", media_component->min_des_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [min_des_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component->mir_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "mirBwDl", media_component->mir_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [mir_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->mir_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "mirBwUl", media_component->mir_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [mir_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component->preempt_cap) {
+    if (OpenAPI_json_write_string(writer, "preemptCap", OpenAPI_preemption_capability_ToString(media_component->preempt_cap)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [preempt_cap]");
+        goto end;
+    }
+    }
+
+    if (media_component->preempt_vuln) {
+    if (OpenAPI_json_write_string(writer, "preemptVuln", OpenAPI_preemption_vulnerability_ToString(media_component->preempt_vuln)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [preempt_vuln]");
+        goto end;
+    }
+    }
+
+    if (media_component->prio_sharing_ind) {
+    if (OpenAPI_json_write_string(writer, "prioSharingInd", OpenAPI_priority_sharing_indicator_ToString(media_component->prio_sharing_ind)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [prio_sharing_ind]");
+        goto end;
+    }
+    }
+
+    if (media_component->res_prio) {
+    if (OpenAPI_json_write_string(writer, "resPrio", OpenAPI_reserv_priority_ToString(media_component->res_prio)) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [res_prio]");
+        goto end;
+    }
+    }
+
+    if (media_component->rr_bw) {
+    if (OpenAPI_json_write_string(writer, "rrBw", media_component->rr_bw) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [rr_bw]");
+        goto end;
+    }
+    }
+
+    if (media_component->rs_bw) {
+    if (OpenAPI_json_write_string(writer, "rsBw", media_component->rs_bw) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [rs_bw]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_sharing_key_dl) {
+    if (OpenAPI_json_write_number(writer, "sharingKeyDl", media_component->sharing_key_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [sharing_key_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->is_sharing_key_ul) {
+    if (OpenAPI_json_write_number(writer, "sharingKeyUl", media_component->sharing_key_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [sharing_key_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component->tsn_qos) {
+    if (OpenAPI_tsn_qos_container_writeJSON(writer, "tsnQos", media_component->tsn_qos) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [tsn_qos]");
+        goto end;
+    }
+    }
+
+    if (media_component->tscai_input_dl) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputDl", media_component->tscai_input_dl) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [tscai_input_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component->tscai_input_ul) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputUl", media_component->tscai_input_ul) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [tscai_input_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_writeJSON() failed [MediaComponent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_media_component_t *OpenAPI_media_component_parseFromJSON(cJSON *media_componentJSON)
 {
     OpenAPI_media_component_t *media_component_local_var = NULL;
@@ -874,7 +1179,6 @@ end:
 OpenAPI_media_component_t *OpenAPI_media_component_copy(OpenAPI_media_component_t *dst, OpenAPI_media_component_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_media_component_convertToJSON(src);
@@ -883,21 +1187,6 @@ OpenAPI_media_component_t *OpenAPI_media_component_copy(OpenAPI_media_component_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_media_component_free(dst);
     dst = OpenAPI_media_component_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_routing_requirement.h"
 #include "flow_status.h"
 #include "media_sub_component.h"
@@ -122,6 +123,7 @@ OpenAPI_media_component_t *OpenAPI_media_component_create(
 void OpenAPI_media_component_free(OpenAPI_media_component_t *media_component);
 OpenAPI_media_component_t *OpenAPI_media_component_parseFromJSON(cJSON *media_componentJSON);
 cJSON *OpenAPI_media_component_convertToJSON(OpenAPI_media_component_t *media_component);
+bool OpenAPI_media_component_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_media_component_t *media_component);
 OpenAPI_media_component_t *OpenAPI_media_component_copy(OpenAPI_media_component_t *dst, OpenAPI_media_component_t *src);
 
 #ifdef __cplusplus
@@ -470,6 +470,311 @@ end:
     return item;
 }
 
+bool OpenAPI_media_component_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_media_component_rm_t *media_component_rm)
+{
+    if (media_component_rm == NULL) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [MediaComponentRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [MediaComponentRm]");
+        return false;
+    }
+    if (media_component_rm->af_app_id) {
+    if (OpenAPI_json_write_string(writer, "afAppId", media_component_rm->af_app_id) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->af_rout_req) {
+    if (OpenAPI_af_routing_requirement_rm_writeJSON(writer, "afRoutReq", media_component_rm->af_rout_req) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [af_rout_req]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->qos_reference) {
+    if (OpenAPI_json_write_string(writer, "qosReference", media_component_rm->qos_reference) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [qos_reference]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->alt_ser_reqs) {
+    if (OpenAPI_json_write_array_start(writer, "altSerReqs") == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_ser_reqs_node;
+    OpenAPI_list_for_each(media_component_rm->alt_ser_reqs, alt_ser_reqs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_ser_reqs_node->data) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [alt_ser_reqs]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_dis_ue_notif) {
+    if (OpenAPI_json_write_bool(writer, "disUeNotif", media_component_rm->dis_ue_notif) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [dis_ue_notif]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_cont_ver) {
+    if (OpenAPI_json_write_number(writer, "contVer", media_component_rm->cont_ver) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [cont_ver]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->codecs) {
+    if (OpenAPI_json_write_array_start(writer, "codecs") == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [codecs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *codecs_node;
+    OpenAPI_list_for_each(media_component_rm->codecs, codecs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)codecs_node->data) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [codecs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [codecs]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_des_max_latency) {
+    if (OpenAPI_json_write_number(writer, "desMaxLatency", media_component_rm->des_max_latency) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [des_max_latency]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_des_max_loss) {
+    if (OpenAPI_json_write_number(writer, "desMaxLoss", media_component_rm->des_max_loss) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [des_max_loss]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->flus_id) {
+    if (OpenAPI_json_write_string(writer, "flusId", media_component_rm->flus_id) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [flus_id]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->f_status) {
+    if (OpenAPI_json_write_string(writer, "fStatus", OpenAPI_flow_status_ToString(media_component_rm->f_status)) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [f_status]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->mar_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "marBwDl", media_component_rm->mar_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [mar_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->mar_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "marBwUl", media_component_rm->mar_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [mar_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_max_packet_loss_rate_dl) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateDl", media_component_rm->max_packet_loss_rate_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [max_packet_loss_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_max_packet_loss_rate_ul) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateUl", media_component_rm->max_packet_loss_rate_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [max_packet_loss_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->max_supp_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "maxSuppBwDl", media_component_rm->max_supp_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [max_supp_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->max_supp_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "maxSuppBwUl", media_component_rm->max_supp_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [max_supp_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "medCompN", media_component_rm->med_comp_n) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [med_comp_n]");
+        goto end;
+    }
+
+    if (media_component_rm->med_sub_comps) {
+    if (OpenAPI_json_write_object_start(writer, "medSubComps") == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [med_sub_comps]");
+        goto end;
+    }
+    OpenAPI_lnode_t *med_sub_comps_node;
+    if (media_component_rm->med_sub_comps) {
+        OpenAPI_list_for_each(media_component_rm->med_sub_comps, med_sub_comps_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)med_sub_comps_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_media_sub_component_rm_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_media_component_rm_writeJSON() failed [med_sub_comps]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [med_sub_comps]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->med_type) {
+    if (OpenAPI_json_write_string(writer, "medType", OpenAPI_media_type_ToString(media_component_rm->med_type)) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [med_type]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->min_des_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "minDesBwDl", media_component_rm->min_des_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [min_des_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->min_des_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "minDesBwUl", media_component_rm->min_des_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [min_des_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->mir_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "mirBwDl", media_component_rm->mir_bw_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [mir_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->mir_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "mirBwUl", media_component_rm->mir_bw_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [mir_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->preempt_cap) {
+    if (OpenAPI_preemption_capability_rm_writeJSON(writer, "preemptCap", media_component_rm->preempt_cap) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [preempt_cap]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->preempt_vuln) {
+    if (OpenAPI_preemption_vulnerability_rm_writeJSON(writer, "preemptVuln", media_component_rm->preempt_vuln) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [preempt_vuln]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->prio_sharing_ind) {
+    if (OpenAPI_json_write_string(writer, "prioSharingInd", OpenAPI_priority_sharing_indicator_ToString(media_component_rm->prio_sharing_ind)) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [prio_sharing_ind]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->res_prio) {
+    if (OpenAPI_json_write_string(writer, "resPrio", OpenAPI_reserv_priority_ToString(media_component_rm->res_prio)) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [res_prio]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->rr_bw) {
+    if (OpenAPI_json_write_string(writer, "rrBw", media_component_rm->rr_bw) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [rr_bw]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->rs_bw) {
+    if (OpenAPI_json_write_string(writer, "rsBw", media_component_rm->rs_bw) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [rs_bw]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_sharing_key_dl) {
+    if (OpenAPI_json_write_number(writer, "sharingKeyDl", media_component_rm->sharing_key_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [sharing_key_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->is_sharing_key_ul) {
+    if (OpenAPI_json_write_number(writer, "sharingKeyUl", media_component_rm->sharing_key_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [sharing_key_ul]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->tsn_qos) {
+    if (OpenAPI_tsn_qos_container_rm_writeJSON(writer, "tsnQos", media_component_rm->tsn_qos) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [tsn_qos]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->tscai_input_dl) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputDl", media_component_rm->tscai_input_dl) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [tscai_input_dl]");
+        goto end;
+    }
+    }
+
+    if (media_component_rm->tscai_input_ul) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputUl", media_component_rm->tscai_input_ul) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [tscai_input_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_media_component_rm_writeJSON() failed [MediaComponentRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_parseFromJSON(cJSON *media_component_rmJSON)
 {
     OpenAPI_media_component_rm_t *media_component_rm_local_var = NULL;
@@ -880,7 +1185,6 @@ end:
 OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_copy(OpenAPI_media_component_rm_t *dst, OpenAPI_media_component_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_media_component_rm_convertToJSON(src);
@@ -889,21 +1193,6 @@ OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_copy(OpenAPI_media_comp
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_media_component_rm_free(dst);
     dst = OpenAPI_media_component_rm_parseFromJSON(item);
     cJSON_Delete(item);
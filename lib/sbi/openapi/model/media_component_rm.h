@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_routing_requirement_rm.h"
 #include "flow_status.h"
 #include "media_sub_component_rm.h"
@@ -122,6 +123,7 @@ OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_create(
 void OpenAPI_media_component_rm_free(OpenAPI_media_component_rm_t *media_component_rm);
 OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_parseFromJSON(cJSON *media_component_rmJSON);
 cJSON *OpenAPI_media_component_rm_convertToJSON(OpenAPI_media_component_rm_t *media_component_rm);
+bool OpenAPI_media_component_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_media_component_rm_t *media_component_rm);
 OpenAPI_media_component_rm_t *OpenAPI_media_component_rm_copy(OpenAPI_media_component_rm_t *dst, OpenAPI_media_component_rm_t *src);
 
 #ifdef __cplusplus
@@ -149,6 +149,115 @@ end:
     return item;
 }
 
+bool OpenAPI_media_sub_component_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_media_sub_component_rm_t *media_sub_component_rm)
+{
+    if (media_sub_component_rm == NULL) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [MediaSubComponentRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [MediaSubComponentRm]");
+        return false;
+    }
+    if (media_sub_component_rm->af_sig_protocol) {
+    if (OpenAPI_json_write_string(writer, "afSigProtocol", OpenAPI_af_sig_protocol_ToString(media_sub_component_rm->af_sig_protocol)) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [af_sig_protocol]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->ethf_descs) {
+    if (OpenAPI_json_write_array_start(writer, "ethfDescs") == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [ethf_descs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ethf_descs_node;
+    if (media_sub_component_rm->ethf_descs) {
+        OpenAPI_list_for_each(media_sub_component_rm->ethf_descs, ethf_descs_node) {
+            if (OpenAPI_eth_flow_description_writeJSON(writer, NULL, ethf_descs_node->data) == false) {
+                ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [ethf_descs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [ethf_descs]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "fNum", media_sub_component_rm->f_num) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [f_num]");
+        goto end;
+    }
+
+    if (media_sub_component_rm->f_descs) {
+    if (OpenAPI_json_write_array_start(writer, "fDescs") == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [f_descs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *f_descs_node;
+    OpenAPI_list_for_each(media_sub_component_rm->f_descs, f_descs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)f_descs_node->data) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [f_descs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [f_descs]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->f_status) {
+    if (OpenAPI_json_write_string(writer, "fStatus", OpenAPI_flow_status_ToString(media_sub_component_rm->f_status)) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [f_status]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->mar_bw_dl) {
+    if (OpenAPI_json_write_string(writer, "marBwDl", media_sub_component_rm->mar_bw_dl) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [mar_bw_dl]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->mar_bw_ul) {
+    if (OpenAPI_json_write_string(writer, "marBwUl", media_sub_component_rm->mar_bw_ul) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [mar_bw_ul]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->tos_tr_cl) {
+    if (OpenAPI_json_write_string(writer, "tosTrCl", media_sub_component_rm->tos_tr_cl) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [tos_tr_cl]");
+        goto end;
+    }
+    }
+
+    if (media_sub_component_rm->flow_usage) {
+    if (OpenAPI_json_write_string(writer, "flowUsage", OpenAPI_flow_usage_ToString(media_sub_component_rm->flow_usage)) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [flow_usage]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_media_sub_component_rm_writeJSON() failed [MediaSubComponentRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_media_sub_component_rm_t *OpenAPI_media_sub_component_rm_parseFromJSON(cJSON *media_sub_component_rmJSON)
 {
     OpenAPI_media_sub_component_rm_t *media_sub_component_rm_local_var = NULL;
@@ -293,7 +402,6 @@ end:
 OpenAPI_media_sub_component_rm_t *OpenAPI_media_sub_component_rm_copy(OpenAPI_media_sub_component_rm_t *dst, OpenAPI_media_sub_component_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_media_sub_component_rm_convertToJSON(src);
@@ -302,21 +410,6 @@ OpenAPI_media_sub_component_rm_t *OpenAPI_media_sub_component_rm_copy(OpenAPI_me
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_media_sub_component_rm_free(dst);
     dst = OpenAPI_media_sub_component_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -63,6 +63,49 @@ end:
     return item;
 }
 
+bool OpenAPI_message_waiting_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_message_waiting_data_t *message_waiting_data)
+{
+    if (message_waiting_data == NULL) {
+        ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [MessageWaitingData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [MessageWaitingData]");
+        return false;
+    }
+    if (message_waiting_data->mwd_list) {
+    if (OpenAPI_json_write_array_start(writer, "mwdList") == false) {
+        ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [mwd_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mwd_list_node;
+    if (message_waiting_data->mwd_list) {
+        OpenAPI_list_for_each(message_waiting_data->mwd_list, mwd_list_node) {
+            if (OpenAPI_smsc_data_writeJSON(writer, NULL, mwd_list_node->data) == false) {
+                ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [mwd_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [mwd_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_message_waiting_data_writeJSON() failed [MessageWaitingData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_parseFromJSON(cJSON *message_waiting_dataJSON)
 {
     OpenAPI_message_waiting_data_t *message_waiting_data_local_var = NULL;
@@ -107,7 +150,6 @@ end:
 OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_copy(OpenAPI_message_waiting_data_t *dst, OpenAPI_message_waiting_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_message_waiting_data_convertToJSON(src);
@@ -116,21 +158,6 @@ OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_copy(OpenAPI_messag
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_message_waiting_data_free(dst);
     dst = OpenAPI_message_waiting_data_parseFromJSON(item);
     cJSON_Delete(item);
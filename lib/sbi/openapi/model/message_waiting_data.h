@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "smsc_data.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_create(
 void OpenAPI_message_waiting_data_free(OpenAPI_message_waiting_data_t *message_waiting_data);
 OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_parseFromJSON(cJSON *message_waiting_dataJSON);
 cJSON *OpenAPI_message_waiting_data_convertToJSON(OpenAPI_message_waiting_data_t *message_waiting_data);
+bool OpenAPI_message_waiting_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_message_waiting_data_t *message_waiting_data);
 OpenAPI_message_waiting_data_t *OpenAPI_message_waiting_data_copy(OpenAPI_message_waiting_data_t *dst, OpenAPI_message_waiting_data_t *src);
 
 #ifdef __cplusplus
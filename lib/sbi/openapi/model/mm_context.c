@@ -387,6 +387,262 @@ end:
     return item;
 }
 
+bool OpenAPI_mm_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mm_context_t *mm_context)
+{
+    if (mm_context == NULL) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [MmContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [MmContext]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(mm_context->access_type)) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (mm_context->nas_security_mode) {
+    if (OpenAPI_nas_security_mode_writeJSON(writer, "nasSecurityMode", mm_context->nas_security_mode) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nas_security_mode]");
+        goto end;
+    }
+    }
+
+    if (mm_context->eps_nas_security_mode) {
+    if (OpenAPI_eps_nas_security_mode_writeJSON(writer, "epsNasSecurityMode", mm_context->eps_nas_security_mode) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [eps_nas_security_mode]");
+        goto end;
+    }
+    }
+
+    if (mm_context->is_nas_downlink_count) {
+    if (OpenAPI_json_write_number(writer, "nasDownlinkCount", mm_context->nas_downlink_count) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nas_downlink_count]");
+        goto end;
+    }
+    }
+
+    if (mm_context->is_nas_uplink_count) {
+    if (OpenAPI_json_write_number(writer, "nasUplinkCount", mm_context->nas_uplink_count) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nas_uplink_count]");
+        goto end;
+    }
+    }
+
+    if (mm_context->ue_security_capability) {
+    if (OpenAPI_json_write_number(writer, "ueSecurityCapability", mm_context->ue_security_capability) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ue_security_capability]");
+        goto end;
+    }
+    }
+
+    if (mm_context->s1_ue_network_capability) {
+    if (OpenAPI_json_write_number(writer, "s1UeNetworkCapability", mm_context->s1_ue_network_capability) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [s1_ue_network_capability]");
+        goto end;
+    }
+    }
+
+    if (mm_context->allowed_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNssai") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nssai_node;
+    if (mm_context->allowed_nssai) {
+        OpenAPI_list_for_each(mm_context->allowed_nssai, allowed_nssai_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, allowed_nssai_node->data) == false) {
+                ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_nssai]");
+        goto end;
+    }
+    }
+
+    if (mm_context->nssai_mapping_list) {
+    if (OpenAPI_json_write_array_start(writer, "nssaiMappingList") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nssai_mapping_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nssai_mapping_list_node;
+    if (mm_context->nssai_mapping_list) {
+        OpenAPI_list_for_each(mm_context->nssai_mapping_list, nssai_mapping_list_node) {
+            if (OpenAPI_nssai_mapping_writeJSON(writer, NULL, nssai_mapping_list_node->data) == false) {
+                ogs_error("OpenAPI_mm_context_writeJSON() failed [nssai_mapping_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nssai_mapping_list]");
+        goto end;
+    }
+    }
+
+    if (mm_context->allowed_home_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "allowedHomeNssai") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_home_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_home_nssai_node;
+    if (mm_context->allowed_home_nssai) {
+        OpenAPI_list_for_each(mm_context->allowed_home_nssai, allowed_home_nssai_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, allowed_home_nssai_node->data) == false) {
+                ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_home_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [allowed_home_nssai]");
+        goto end;
+    }
+    }
+
+    if (mm_context->ns_instance_list) {
+    if (OpenAPI_json_write_array_start(writer, "nsInstanceList") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ns_instance_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ns_instance_list_node;
+    OpenAPI_list_for_each(mm_context->ns_instance_list, ns_instance_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ns_instance_list_node->data) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ns_instance_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ns_instance_list]");
+        goto end;
+    }
+    }
+
+    if (mm_context->expected_u_ebehavior) {
+    if (OpenAPI_expected_ue_behavior_writeJSON(writer, "expectedUEbehavior", mm_context->expected_u_ebehavior) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [expected_u_ebehavior]");
+        goto end;
+    }
+    }
+
+    if (mm_context->ue_differentiation_info) {
+    if (OpenAPI_ue_differentiation_info_writeJSON(writer, "ueDifferentiationInfo", mm_context->ue_differentiation_info) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ue_differentiation_info]");
+        goto end;
+    }
+    }
+
+    if (mm_context->plmn_assi_ue_radio_cap_id) {
+    if (OpenAPI_json_write_number(writer, "plmnAssiUeRadioCapId", mm_context->plmn_assi_ue_radio_cap_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [plmn_assi_ue_radio_cap_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->man_assi_ue_radio_cap_id) {
+    if (OpenAPI_json_write_number(writer, "manAssiUeRadioCapId", mm_context->man_assi_ue_radio_cap_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [man_assi_ue_radio_cap_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->ucmf_dic_entry_id) {
+    if (OpenAPI_json_write_string(writer, "ucmfDicEntryId", mm_context->ucmf_dic_entry_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [ucmf_dic_entry_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->n3_iwf_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "n3IwfId", mm_context->n3_iwf_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [n3_iwf_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->wagf_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "wagfId", mm_context->wagf_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [wagf_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->tngf_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "tngfId", mm_context->tngf_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [tngf_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->is_an_n2_ap_id) {
+    if (OpenAPI_json_write_number(writer, "anN2ApId", mm_context->an_n2_ap_id) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [an_n2_ap_id]");
+        goto end;
+    }
+    }
+
+    if (mm_context->nssaa_status_list) {
+    if (OpenAPI_json_write_array_start(writer, "nssaaStatusList") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nssaa_status_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nssaa_status_list_node;
+    if (mm_context->nssaa_status_list) {
+        OpenAPI_list_for_each(mm_context->nssaa_status_list, nssaa_status_list_node) {
+            if (OpenAPI_nssaa_status_writeJSON(writer, NULL, nssaa_status_list_node->data) == false) {
+                ogs_error("OpenAPI_mm_context_writeJSON() failed [nssaa_status_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [nssaa_status_list]");
+        goto end;
+    }
+    }
+
+    if (mm_context->pending_nssai_mapping_list) {
+    if (OpenAPI_json_write_array_start(writer, "pendingNssaiMappingList") == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [pending_nssai_mapping_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pending_nssai_mapping_list_node;
+    if (mm_context->pending_nssai_mapping_list) {
+        OpenAPI_list_for_each(mm_context->pending_nssai_mapping_list, pending_nssai_mapping_list_node) {
+            if (OpenAPI_nssai_mapping_writeJSON(writer, NULL, pending_nssai_mapping_list_node->data) == false) {
+                ogs_error("OpenAPI_mm_context_writeJSON() failed [pending_nssai_mapping_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [pending_nssai_mapping_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mm_context_writeJSON() failed [MmContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mm_context_t *OpenAPI_mm_context_parseFromJSON(cJSON *mm_contextJSON)
 {
     OpenAPI_mm_context_t *mm_context_local_var = NULL;
@@ -725,7 +981,6 @@ end:
 OpenAPI_mm_context_t *OpenAPI_mm_context_copy(OpenAPI_mm_context_t *dst, OpenAPI_mm_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mm_context_convertToJSON(src);
@@ -734,21 +989,6 @@ OpenAPI_mm_context_t *OpenAPI_mm_context_copy(OpenAPI_mm_context_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mm_context_free(dst);
     dst = OpenAPI_mm_context_parseFromJSON(item);
     cJSON_Delete(item);
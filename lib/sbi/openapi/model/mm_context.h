@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "eps_nas_security_mode.h"
 #include "expected_ue_behavior.h"
@@ -85,6 +86,7 @@ OpenAPI_mm_context_t *OpenAPI_mm_context_create(
 void OpenAPI_mm_context_free(OpenAPI_mm_context_t *mm_context);
 OpenAPI_mm_context_t *OpenAPI_mm_context_parseFromJSON(cJSON *mm_contextJSON);
 cJSON *OpenAPI_mm_context_convertToJSON(OpenAPI_mm_context_t *mm_context);
+bool OpenAPI_mm_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mm_context_t *mm_context);
 OpenAPI_mm_context_t *OpenAPI_mm_context_copy(OpenAPI_mm_context_t *dst, OpenAPI_mm_context_t *src);
 
 #ifdef __cplusplus
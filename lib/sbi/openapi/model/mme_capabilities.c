@@ -59,6 +59,42 @@ end:
     return item;
 }
 
+bool OpenAPI_mme_capabilities_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mme_capabilities_t *mme_capabilities)
+{
+    if (mme_capabilities == NULL) {
+        ogs_error("OpenAPI_mme_capabilities_writeJSON() failed [MmeCapabilities]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mme_capabilities_writeJSON() failed [MmeCapabilities]");
+        return false;
+    }
+    if (mme_capabilities->is_non_ip_supported) {
+    if (OpenAPI_json_write_bool(writer, "nonIpSupported", mme_capabilities->non_ip_supported) == false) {
+        ogs_error("OpenAPI_mme_capabilities_writeJSON() failed [non_ip_supported]");
+        goto end;
+    }
+    }
+
+    if (mme_capabilities->is_ethernet_supported) {
+    if (OpenAPI_json_write_bool(writer, "ethernetSupported", mme_capabilities->ethernet_supported) == false) {
+        ogs_error("OpenAPI_mme_capabilities_writeJSON() failed [ethernet_supported]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mme_capabilities_writeJSON() failed [MmeCapabilities]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_parseFromJSON(cJSON *mme_capabilitiesJSON)
 {
     OpenAPI_mme_capabilities_t *mme_capabilities_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_copy(OpenAPI_mme_capabilities_t *dst, OpenAPI_mme_capabilities_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mme_capabilities_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_copy(OpenAPI_mme_capabiliti
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mme_capabilities_free(dst);
     dst = OpenAPI_mme_capabilities_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_create(
 void OpenAPI_mme_capabilities_free(OpenAPI_mme_capabilities_t *mme_capabilities);
 OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_parseFromJSON(cJSON *mme_capabilitiesJSON);
 cJSON *OpenAPI_mme_capabilities_convertToJSON(OpenAPI_mme_capabilities_t *mme_capabilities);
+bool OpenAPI_mme_capabilities_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mme_capabilities_t *mme_capabilities);
 OpenAPI_mme_capabilities_t *OpenAPI_mme_capabilities_copy(OpenAPI_mme_capabilities_t *dst, OpenAPI_mme_capabilities_t *src);
 
 #ifdef __cplusplus
@@ -54,6 +54,40 @@ end:
     return item;
 }
 
+bool OpenAPI_mo_exp_data_counter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mo_exp_data_counter_t *mo_exp_data_counter)
+{
+    if (mo_exp_data_counter == NULL) {
+        ogs_error("OpenAPI_mo_exp_data_counter_writeJSON() failed [MoExpDataCounter]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mo_exp_data_counter_writeJSON() failed [MoExpDataCounter]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "counter", mo_exp_data_counter->counter) == false) {
+        ogs_error("OpenAPI_mo_exp_data_counter_writeJSON() failed [counter]");
+        goto end;
+    }
+
+    if (mo_exp_data_counter->time_stamp) {
+    if (OpenAPI_json_write_string(writer, "timeStamp", mo_exp_data_counter->time_stamp) == false) {
+        ogs_error("OpenAPI_mo_exp_data_counter_writeJSON() failed [time_stamp]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mo_exp_data_counter_writeJSON() failed [MoExpDataCounter]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mo_exp_data_counter_t *OpenAPI_mo_exp_data_counter_parseFromJSON(cJSON *mo_exp_data_counterJSON)
 {
     OpenAPI_mo_exp_data_counter_t *mo_exp_data_counter_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_mo_exp_data_counter_t *OpenAPI_mo_exp_data_counter_copy(OpenAPI_mo_exp_data_counter_t *dst, OpenAPI_mo_exp_data_counter_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mo_exp_data_counter_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_mo_exp_data_counter_t *OpenAPI_mo_exp_data_counter_copy(OpenAPI_mo_exp_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mo_exp_data_counter_free(dst);
     dst = OpenAPI_mo_exp_data_counter_parseFromJSON(item);
     cJSON_Delete(item);
@@ -116,6 +116,82 @@ end:
     return item;
 }
 
+bool OpenAPI_model_5_gvn_group_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_model_5_gvn_group_configuration_t *model_5_gvn_group_configuration)
+{
+    if (model_5_gvn_group_configuration == NULL) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [5GVnGroupConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [5GVnGroupConfiguration]");
+        return false;
+    }
+    if (model_5_gvn_group_configuration->_5g_vn_group_data) {
+    if (OpenAPI_model_5_gvn_group_data_writeJSON(writer, "5gVnGroupData", model_5_gvn_group_configuration->_5g_vn_group_data) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [_5g_vn_group_data]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_configuration->members) {
+    if (OpenAPI_json_write_array_start(writer, "members") == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [members]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *members_node;
+    OpenAPI_list_for_each(model_5_gvn_group_configuration->members, members_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)members_node->data) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [members]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [members]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_configuration->is_reference_id) {
+    if (OpenAPI_json_write_number(writer, "referenceId", model_5_gvn_group_configuration->reference_id) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [reference_id]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_configuration->af_instance_id) {
+    if (OpenAPI_json_write_string(writer, "afInstanceId", model_5_gvn_group_configuration->af_instance_id) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_configuration->internal_group_identifier) {
+    if (OpenAPI_json_write_string(writer, "internalGroupIdentifier", model_5_gvn_group_configuration->internal_group_identifier) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [internal_group_identifier]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_configuration->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", model_5_gvn_group_configuration->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_configuration_writeJSON() failed [5GVnGroupConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_model_5_gvn_group_configuration_t *OpenAPI_model_5_gvn_group_configuration_parseFromJSON(cJSON *model_5_gvn_group_configurationJSON)
 {
     OpenAPI_model_5_gvn_group_configuration_t *model_5_gvn_group_configuration_local_var = NULL;
@@ -200,7 +276,6 @@ end:
 OpenAPI_model_5_gvn_group_configuration_t *OpenAPI_model_5_gvn_group_configuration_copy(OpenAPI_model_5_gvn_group_configuration_t *dst, OpenAPI_model_5_gvn_group_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_model_5_gvn_group_configuration_convertToJSON(src);
@@ -209,21 +284,6 @@ OpenAPI_model_5_gvn_group_configuration_t *OpenAPI_model_5_gvn_group_configurati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_model_5_gvn_group_configuration_free(dst);
     dst = OpenAPI_model_5_gvn_group_configuration_parseFromJSON(item);
     cJSON_Delete(item);
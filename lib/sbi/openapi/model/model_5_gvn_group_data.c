@@ -130,6 +130,91 @@ end:
     return item;
 }
 
+bool OpenAPI_model_5_gvn_group_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_model_5_gvn_group_data_t *model_5_gvn_group_data)
+{
+    if (model_5_gvn_group_data == NULL) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [5GVnGroupData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [5GVnGroupData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", model_5_gvn_group_data->dnn) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", model_5_gvn_group_data->s_nssai) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (model_5_gvn_group_data->pdu_session_types) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionTypes") == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pdu_session_types_node;
+    OpenAPI_list_for_each(model_5_gvn_group_data->pdu_session_types, pdu_session_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_pdu_session_type_ToString((intptr_t)pdu_session_types_node->data)) == false) {
+            ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [pdu_session_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_data->app_descriptors) {
+    if (OpenAPI_json_write_array_start(writer, "appDescriptors") == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [app_descriptors]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_descriptors_node;
+    if (model_5_gvn_group_data->app_descriptors) {
+        OpenAPI_list_for_each(model_5_gvn_group_data->app_descriptors, app_descriptors_node) {
+            if (OpenAPI_app_descriptor_writeJSON(writer, NULL, app_descriptors_node->data) == false) {
+                ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [app_descriptors]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [app_descriptors]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_data->is_secondary_auth) {
+    if (OpenAPI_json_write_bool(writer, "secondaryAuth", model_5_gvn_group_data->secondary_auth) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [secondary_auth]");
+        goto end;
+    }
+    }
+
+    if (model_5_gvn_group_data->dn_aaa_address) {
+    if (OpenAPI_ip_address_1_writeJSON(writer, "dnAaaAddress", model_5_gvn_group_data->dn_aaa_address) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [dn_aaa_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_model_5_gvn_group_data_writeJSON() failed [5GVnGroupData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_model_5_gvn_group_data_t *OpenAPI_model_5_gvn_group_data_parseFromJSON(cJSON *model_5_gvn_group_dataJSON)
 {
     OpenAPI_model_5_gvn_group_data_t *model_5_gvn_group_data_local_var = NULL;
@@ -238,7 +323,6 @@ end:
 OpenAPI_model_5_gvn_group_data_t *OpenAPI_model_5_gvn_group_data_copy(OpenAPI_model_5_gvn_group_data_t *dst, OpenAPI_model_5_gvn_group_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_model_5_gvn_group_data_convertToJSON(src);
@@ -247,21 +331,6 @@ OpenAPI_model_5_gvn_group_data_t *OpenAPI_model_5_gvn_group_data_copy(OpenAPI_mo
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_model_5_gvn_group_data_free(dst);
     dst = OpenAPI_model_5_gvn_group_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_modification_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_modification_notification_t *modification_notification)
+{
+    if (modification_notification == NULL) {
+        ogs_error("OpenAPI_modification_notification_writeJSON() failed [ModificationNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_modification_notification_writeJSON() failed [ModificationNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "notifyItems") == false) {
+        ogs_error("OpenAPI_modification_notification_writeJSON() failed [notify_items]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *notify_items_node;
+    if (modification_notification->notify_items) {
+        OpenAPI_list_for_each(modification_notification->notify_items, notify_items_node) {
+            if (OpenAPI_notify_item_writeJSON(writer, NULL, notify_items_node->data) == false) {
+                ogs_error("OpenAPI_modification_notification_writeJSON() failed [notify_items]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_modification_notification_writeJSON() failed [notify_items]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_modification_notification_writeJSON() failed [ModificationNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_modification_notification_t *OpenAPI_modification_notification_parseFromJSON(cJSON *modification_notificationJSON)
 {
     OpenAPI_modification_notification_t *modification_notification_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_modification_notification_t *OpenAPI_modification_notification_copy(OpenAPI_modification_notification_t *dst, OpenAPI_modification_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_modification_notification_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_modification_notification_t *OpenAPI_modification_notification_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_modification_notification_free(dst);
     dst = OpenAPI_modification_notification_parseFromJSON(item);
     cJSON_Delete(item);
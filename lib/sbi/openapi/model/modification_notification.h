@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "notify_item.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_modification_notification_t *OpenAPI_modification_notification_create(
 void OpenAPI_modification_notification_free(OpenAPI_modification_notification_t *modification_notification);
 OpenAPI_modification_notification_t *OpenAPI_modification_notification_parseFromJSON(cJSON *modification_notificationJSON);
 cJSON *OpenAPI_modification_notification_convertToJSON(OpenAPI_modification_notification_t *modification_notification);
+bool OpenAPI_modification_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_modification_notification_t *modification_notification);
 OpenAPI_modification_notification_t *OpenAPI_modification_notification_copy(OpenAPI_modification_notification_t *dst, OpenAPI_modification_notification_t *src);
 
 #ifdef __cplusplus
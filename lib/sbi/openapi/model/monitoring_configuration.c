@@ -211,6 +211,117 @@ end:
     return item;
 }
 
+bool OpenAPI_monitoring_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_monitoring_configuration_t *monitoring_configuration)
+{
+    if (monitoring_configuration == NULL) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [MonitoringConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [MonitoringConfiguration]");
+        return false;
+    }
+    if (OpenAPI_event_type_writeJSON(writer, "eventType", monitoring_configuration->event_type) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [event_type]");
+        goto end;
+    }
+
+    if (monitoring_configuration->is_immediate_flag) {
+    if (OpenAPI_json_write_bool(writer, "immediateFlag", monitoring_configuration->immediate_flag) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [immediate_flag]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->location_reporting_configuration) {
+    if (OpenAPI_location_reporting_configuration_writeJSON(writer, "locationReportingConfiguration", monitoring_configuration->location_reporting_configuration) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [location_reporting_configuration]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->association_type) {
+    if (OpenAPI_association_type_writeJSON(writer, "associationType", monitoring_configuration->association_type) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [association_type]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->datalink_report_cfg) {
+    if (OpenAPI_datalink_reporting_configuration_writeJSON(writer, "datalinkReportCfg", monitoring_configuration->datalink_report_cfg) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [datalink_report_cfg]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->loss_connectivity_cfg) {
+    if (OpenAPI_loss_connectivity_cfg_writeJSON(writer, "lossConnectivityCfg", monitoring_configuration->loss_connectivity_cfg) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [loss_connectivity_cfg]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->is_maximum_latency) {
+    if (OpenAPI_json_write_number(writer, "maximumLatency", monitoring_configuration->maximum_latency) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [maximum_latency]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->is_maximum_response_time) {
+    if (OpenAPI_json_write_number(writer, "maximumResponseTime", monitoring_configuration->maximum_response_time) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [maximum_response_time]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->is_suggested_packet_num_dl) {
+    if (OpenAPI_json_write_number(writer, "suggestedPacketNumDl", monitoring_configuration->suggested_packet_num_dl) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [suggested_packet_num_dl]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->pdu_session_status_cfg) {
+    if (OpenAPI_pdu_session_status_cfg_writeJSON(writer, "pduSessionStatusCfg", monitoring_configuration->pdu_session_status_cfg) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [pdu_session_status_cfg]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->reachability_for_sms_cfg) {
+    if (OpenAPI_reachability_for_sms_configuration_writeJSON(writer, "reachabilityForSmsCfg", monitoring_configuration->reachability_for_sms_cfg) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [reachability_for_sms_cfg]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", monitoring_configuration->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (monitoring_configuration->af_id) {
+    if (OpenAPI_json_write_string(writer, "afId", monitoring_configuration->af_id) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [af_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_monitoring_configuration_writeJSON() failed [MonitoringConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_parseFromJSON(cJSON *monitoring_configurationJSON)
 {
     OpenAPI_monitoring_configuration_t *monitoring_configuration_local_var = NULL;
@@ -347,7 +458,6 @@ end:
 OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_copy(OpenAPI_monitoring_configuration_t *dst, OpenAPI_monitoring_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_monitoring_configuration_convertToJSON(src);
@@ -356,21 +466,6 @@ OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_monitoring_configuration_free(dst);
     dst = OpenAPI_monitoring_configuration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "association_type.h"
 #include "datalink_reporting_configuration.h"
 #include "event_type.h"
@@ -67,6 +68,7 @@ OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_create(
 void OpenAPI_monitoring_configuration_free(OpenAPI_monitoring_configuration_t *monitoring_configuration);
 OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_parseFromJSON(cJSON *monitoring_configurationJSON);
 cJSON *OpenAPI_monitoring_configuration_convertToJSON(OpenAPI_monitoring_configuration_t *monitoring_configuration);
+bool OpenAPI_monitoring_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_monitoring_configuration_t *monitoring_configuration);
 OpenAPI_monitoring_configuration_t *OpenAPI_monitoring_configuration_copy(OpenAPI_monitoring_configuration_t *dst, OpenAPI_monitoring_configuration_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_mtc_provider_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mtc_provider_t *mtc_provider)
+{
+    if (mtc_provider == NULL) {
+        ogs_error("OpenAPI_mtc_provider_writeJSON() failed [MtcProvider]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_mtc_provider_writeJSON() failed [MtcProvider]");
+        return false;
+    }
+    if (mtc_provider->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", mtc_provider->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_mtc_provider_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (mtc_provider->af_id) {
+    if (OpenAPI_json_write_string(writer, "afId", mtc_provider->af_id) == false) {
+        ogs_error("OpenAPI_mtc_provider_writeJSON() failed [af_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_mtc_provider_writeJSON() failed [MtcProvider]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_parseFromJSON(cJSON *mtc_providerJSON)
 {
     OpenAPI_mtc_provider_t *mtc_provider_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_copy(OpenAPI_mtc_provider_t *dst, OpenAPI_mtc_provider_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_mtc_provider_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_copy(OpenAPI_mtc_provider_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_mtc_provider_free(dst);
     dst = OpenAPI_mtc_provider_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_create(
 void OpenAPI_mtc_provider_free(OpenAPI_mtc_provider_t *mtc_provider);
 OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_parseFromJSON(cJSON *mtc_providerJSON);
 cJSON *OpenAPI_mtc_provider_convertToJSON(OpenAPI_mtc_provider_t *mtc_provider);
+bool OpenAPI_mtc_provider_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_mtc_provider_t *mtc_provider);
 OpenAPI_mtc_provider_t *OpenAPI_mtc_provider_copy(OpenAPI_mtc_provider_t *dst, OpenAPI_mtc_provider_t *src);
 
 #ifdef __cplusplus
@@ -91,6 +91,61 @@ end:
     return item;
 }
 
+bool OpenAPI_multicast_access_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_multicast_access_control_t *multicast_access_control)
+{
+    if (multicast_access_control == NULL) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [MulticastAccessControl]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [MulticastAccessControl]");
+        return false;
+    }
+    if (multicast_access_control->src_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "srcIpv4Addr", multicast_access_control->src_ipv4_addr) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [src_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (multicast_access_control->src_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "srcIpv6Addr", multicast_access_control->src_ipv6_addr) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [src_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (multicast_access_control->multicast_v4_addr) {
+    if (OpenAPI_json_write_string(writer, "multicastV4Addr", multicast_access_control->multicast_v4_addr) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [multicast_v4_addr]");
+        goto end;
+    }
+    }
+
+    if (multicast_access_control->multicast_v6_addr) {
+    if (OpenAPI_json_write_string(writer, "multicastV6Addr", multicast_access_control->multicast_v6_addr) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [multicast_v6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_access_right_status_writeJSON(writer, "accStatus", multicast_access_control->acc_status) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [acc_status]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_multicast_access_control_writeJSON() failed [MulticastAccessControl]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_parseFromJSON(cJSON *multicast_access_controlJSON)
 {
     OpenAPI_multicast_access_control_t *multicast_access_control_local_var = NULL;
@@ -155,7 +210,6 @@ end:
 OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_copy(OpenAPI_multicast_access_control_t *dst, OpenAPI_multicast_access_control_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_multicast_access_control_convertToJSON(src);
@@ -164,21 +218,6 @@ OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_multicast_access_control_free(dst);
     dst = OpenAPI_multicast_access_control_parseFromJSON(item);
     cJSON_Delete(item);
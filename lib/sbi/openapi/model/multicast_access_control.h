@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_right_status.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_create(
 void OpenAPI_multicast_access_control_free(OpenAPI_multicast_access_control_t *multicast_access_control);
 OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_parseFromJSON(cJSON *multicast_access_controlJSON);
 cJSON *OpenAPI_multicast_access_control_convertToJSON(OpenAPI_multicast_access_control_t *multicast_access_control);
+bool OpenAPI_multicast_access_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_multicast_access_control_t *multicast_access_control);
 OpenAPI_multicast_access_control_t *OpenAPI_multicast_access_control_copy(OpenAPI_multicast_access_control_t *dst, OpenAPI_multicast_access_control_t *src);
 
 #ifdef __cplusplus
@@ -78,6 +78,52 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_message_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_message_container_t *n1_message_container)
+{
+    if (n1_message_container == NULL) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [N1MessageContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [N1MessageContainer]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n1MessageClass", OpenAPI_n1_message_class_ToString(n1_message_container->n1_message_class)) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [n1_message_class]");
+        goto end;
+    }
+
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1MessageContent", n1_message_container->n1_message_content) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [n1_message_content]");
+        goto end;
+    }
+
+    if (n1_message_container->nf_id) {
+    if (OpenAPI_json_write_string(writer, "nfId", n1_message_container->nf_id) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [nf_id]");
+        goto end;
+    }
+    }
+
+    if (n1_message_container->service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "serviceInstanceId", n1_message_container->service_instance_id) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_message_container_writeJSON() failed [N1MessageContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_parseFromJSON(cJSON *n1_message_containerJSON)
 {
     OpenAPI_n1_message_container_t *n1_message_container_local_var = NULL;
@@ -136,7 +182,6 @@ end:
 OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_copy(OpenAPI_n1_message_container_t *dst, OpenAPI_n1_message_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_message_container_convertToJSON(src);
@@ -145,21 +190,6 @@ OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_copy(OpenAPI_n1_mes
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_message_container_free(dst);
     dst = OpenAPI_n1_message_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n1_message_class.h"
 #include "ref_to_binary_data.h"
 
@@ -36,6 +37,7 @@ OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_create(
 void OpenAPI_n1_message_container_free(OpenAPI_n1_message_container_t *n1_message_container);
 OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_parseFromJSON(cJSON *n1_message_containerJSON);
 cJSON *OpenAPI_n1_message_container_convertToJSON(OpenAPI_n1_message_container_t *n1_message_container);
+bool OpenAPI_n1_message_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_message_container_t *n1_message_container);
 OpenAPI_n1_message_container_t *OpenAPI_n1_message_container_copy(OpenAPI_n1_message_container_t *dst, OpenAPI_n1_message_container_t *src);
 
 #ifdef __cplusplus
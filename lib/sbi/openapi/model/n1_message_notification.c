@@ -156,6 +156,89 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_message_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_message_notification_t *n1_message_notification)
+{
+    if (n1_message_notification == NULL) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [N1MessageNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [N1MessageNotification]");
+        return false;
+    }
+    if (n1_message_notification->n1_notify_subscription_id) {
+    if (OpenAPI_json_write_string(writer, "n1NotifySubscriptionId", n1_message_notification->n1_notify_subscription_id) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [n1_notify_subscription_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_n1_message_container_writeJSON(writer, "n1MessageContainer", n1_message_notification->n1_message_container) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [n1_message_container]");
+        goto end;
+    }
+
+    if (n1_message_notification->lcs_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "lcsCorrelationId", n1_message_notification->lcs_correlation_id) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [lcs_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->registration_ctxt_container) {
+    if (OpenAPI_registration_context_container_writeJSON(writer, "registrationCtxtContainer", n1_message_notification->registration_ctxt_container) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [registration_ctxt_container]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->new_lmf_identification) {
+    if (OpenAPI_json_write_string(writer, "newLmfIdentification", n1_message_notification->new_lmf_identification) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [new_lmf_identification]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", n1_message_notification->guami) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->is_c_io_t5_gs_optimisation) {
+    if (OpenAPI_json_write_bool(writer, "cIoT5GSOptimisation", n1_message_notification->c_io_t5_gs_optimisation) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [c_io_t5_gs_optimisation]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->ecgi) {
+    if (OpenAPI_ecgi_writeJSON(writer, "ecgi", n1_message_notification->ecgi) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [ecgi]");
+        goto end;
+    }
+    }
+
+    if (n1_message_notification->ncgi) {
+    if (OpenAPI_ncgi_writeJSON(writer, "ncgi", n1_message_notification->ncgi) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [ncgi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_message_notification_writeJSON() failed [N1MessageNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_parseFromJSON(cJSON *n1_message_notificationJSON)
 {
     OpenAPI_n1_message_notification_t *n1_message_notification_local_var = NULL;
@@ -253,7 +336,6 @@ end:
 OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_copy(OpenAPI_n1_message_notification_t *dst, OpenAPI_n1_message_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_message_notification_convertToJSON(src);
@@ -262,21 +344,6 @@ OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_message_notification_free(dst);
     dst = OpenAPI_n1_message_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi.h"
 #include "guami.h"
 #include "n1_message_container.h"
@@ -51,6 +52,7 @@ OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_create(
 void OpenAPI_n1_message_notification_free(OpenAPI_n1_message_notification_t *n1_message_notification);
 OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_parseFromJSON(cJSON *n1_message_notificationJSON);
 cJSON *OpenAPI_n1_message_notification_convertToJSON(OpenAPI_n1_message_notification_t *n1_message_notification);
+bool OpenAPI_n1_message_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_message_notification_t *n1_message_notification);
 OpenAPI_n1_message_notification_t *OpenAPI_n1_message_notification_copy(OpenAPI_n1_message_notification_t *dst, OpenAPI_n1_message_notification_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,40 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_n2_message_transfer_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_n2_message_transfer_error_t *n1_n2_message_transfer_error)
+{
+    if (n1_n2_message_transfer_error == NULL) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_error_writeJSON() failed [N1N2MessageTransferError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_error_writeJSON() failed [N1N2MessageTransferError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", n1_n2_message_transfer_error->error) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (n1_n2_message_transfer_error->err_info) {
+    if (OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON(writer, "errInfo", n1_n2_message_transfer_error->err_info) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_error_writeJSON() failed [err_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_error_writeJSON() failed [N1N2MessageTransferError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_n2_message_transfer_error_t *OpenAPI_n1_n2_message_transfer_error_parseFromJSON(cJSON *n1_n2_message_transfer_errorJSON)
 {
     OpenAPI_n1_n2_message_transfer_error_t *n1_n2_message_transfer_error_local_var = NULL;
@@ -99,7 +133,6 @@ end:
 OpenAPI_n1_n2_message_transfer_error_t *OpenAPI_n1_n2_message_transfer_error_copy(OpenAPI_n1_n2_message_transfer_error_t *dst, OpenAPI_n1_n2_message_transfer_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_n2_message_transfer_error_convertToJSON(src);
@@ -108,21 +141,6 @@ OpenAPI_n1_n2_message_transfer_error_t *OpenAPI_n1_n2_message_transfer_error_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_n2_message_transfer_error_free(dst);
     dst = OpenAPI_n1_n2_message_transfer_error_parseFromJSON(item);
     cJSON_Delete(item);
@@ -260,6 +260,154 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_n2_message_transfer_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_n2_message_transfer_req_data_t *n1_n2_message_transfer_req_data)
+{
+    if (n1_n2_message_transfer_req_data == NULL) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [N1N2MessageTransferReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [N1N2MessageTransferReqData]");
+        return false;
+    }
+    if (n1_n2_message_transfer_req_data->n1_message_container) {
+    if (OpenAPI_n1_message_container_writeJSON(writer, "n1MessageContainer", n1_n2_message_transfer_req_data->n1_message_container) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [n1_message_container]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->n2_info_container) {
+    if (OpenAPI_n2_info_container_writeJSON(writer, "n2InfoContainer", n1_n2_message_transfer_req_data->n2_info_container) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [n2_info_container]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->mt_data) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "mtData", n1_n2_message_transfer_req_data->mt_data) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [mt_data]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_skip_ind) {
+    if (OpenAPI_json_write_bool(writer, "skipInd", n1_n2_message_transfer_req_data->skip_ind) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [skip_ind]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_last_msg_indication) {
+    if (OpenAPI_json_write_bool(writer, "lastMsgIndication", n1_n2_message_transfer_req_data->last_msg_indication) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [last_msg_indication]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", n1_n2_message_transfer_req_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->lcs_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "lcsCorrelationId", n1_n2_message_transfer_req_data->lcs_correlation_id) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [lcs_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_ppi) {
+    if (OpenAPI_json_write_number(writer, "ppi", n1_n2_message_transfer_req_data->ppi) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [ppi]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->arp) {
+    if (OpenAPI_arp_writeJSON(writer, "arp", n1_n2_message_transfer_req_data->arp) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [arp]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is__5qi) {
+    if (OpenAPI_json_write_number(writer, "5qi", n1_n2_message_transfer_req_data->_5qi) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [_5qi]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->n1n2_failure_txf_notif_uri) {
+    if (OpenAPI_json_write_string(writer, "n1n2FailureTxfNotifURI", n1_n2_message_transfer_req_data->n1n2_failure_txf_notif_uri) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [n1n2_failure_txf_notif_uri]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_smf_reallocation_ind) {
+    if (OpenAPI_json_write_bool(writer, "smfReallocationInd", n1_n2_message_transfer_req_data->smf_reallocation_ind) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [smf_reallocation_ind]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->area_of_validity) {
+    if (OpenAPI_area_of_validity_writeJSON(writer, "areaOfValidity", n1_n2_message_transfer_req_data->area_of_validity) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [area_of_validity]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", n1_n2_message_transfer_req_data->supported_features) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->old_guami) {
+    if (OpenAPI_guami_writeJSON(writer, "oldGuami", n1_n2_message_transfer_req_data->old_guami) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [old_guami]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_ma_accepted_ind) {
+    if (OpenAPI_json_write_bool(writer, "maAcceptedInd", n1_n2_message_transfer_req_data->ma_accepted_ind) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [ma_accepted_ind]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->is_ext_buf_support) {
+    if (OpenAPI_json_write_bool(writer, "extBufSupport", n1_n2_message_transfer_req_data->ext_buf_support) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [ext_buf_support]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_message_transfer_req_data->target_access) {
+    if (OpenAPI_json_write_string(writer, "targetAccess", OpenAPI_access_type_ToString(n1_n2_message_transfer_req_data->target_access)) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [target_access]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_req_data_writeJSON() failed [N1N2MessageTransferReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_n2_message_transfer_req_data_t *OpenAPI_n1_n2_message_transfer_req_data_parseFromJSON(cJSON *n1_n2_message_transfer_req_dataJSON)
 {
     OpenAPI_n1_n2_message_transfer_req_data_t *n1_n2_message_transfer_req_data_local_var = NULL;
@@ -452,7 +600,6 @@ end:
 OpenAPI_n1_n2_message_transfer_req_data_t *OpenAPI_n1_n2_message_transfer_req_data_copy(OpenAPI_n1_n2_message_transfer_req_data_t *dst, OpenAPI_n1_n2_message_transfer_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_n2_message_transfer_req_data_convertToJSON(src);
@@ -461,21 +608,6 @@ OpenAPI_n1_n2_message_transfer_req_data_t *OpenAPI_n1_n2_message_transfer_req_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_n2_message_transfer_req_data_free(dst);
     dst = OpenAPI_n1_n2_message_transfer_req_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -54,6 +54,40 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_n2_message_transfer_rsp_data_t *n1_n2_message_transfer_rsp_data)
+{
+    if (n1_n2_message_transfer_rsp_data == NULL) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON() failed [N1N2MessageTransferRspData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON() failed [N1N2MessageTransferRspData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_n1_n2_message_transfer_cause_ToString(n1_n2_message_transfer_rsp_data->cause)) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON() failed [cause]");
+        goto end;
+    }
+
+    if (n1_n2_message_transfer_rsp_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", n1_n2_message_transfer_rsp_data->supported_features) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_n2_message_transfer_rsp_data_writeJSON() failed [N1N2MessageTransferRspData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_n2_message_transfer_rsp_data_t *OpenAPI_n1_n2_message_transfer_rsp_data_parseFromJSON(cJSON *n1_n2_message_transfer_rsp_dataJSON)
 {
     OpenAPI_n1_n2_message_transfer_rsp_data_t *n1_n2_message_transfer_rsp_data_local_var = NULL;
@@ -92,7 +126,6 @@ end:
 OpenAPI_n1_n2_message_transfer_rsp_data_t *OpenAPI_n1_n2_message_transfer_rsp_data_copy(OpenAPI_n1_n2_message_transfer_rsp_data_t *dst, OpenAPI_n1_n2_message_transfer_rsp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_n2_message_transfer_rsp_data_convertToJSON(src);
@@ -101,21 +134,6 @@ OpenAPI_n1_n2_message_transfer_rsp_data_t *OpenAPI_n1_n2_message_transfer_rsp_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_n2_message_transfer_rsp_data_free(dst);
     dst = OpenAPI_n1_n2_message_transfer_rsp_data_parseFromJSON(item);
     cJSON_Delete(item);
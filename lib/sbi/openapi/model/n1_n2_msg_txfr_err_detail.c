@@ -75,6 +75,49 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_n2_msg_txfr_err_detail_t *n1_n2_msg_txfr_err_detail)
+{
+    if (n1_n2_msg_txfr_err_detail == NULL) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [N1N2MsgTxfrErrDetail]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [N1N2MsgTxfrErrDetail]");
+        return false;
+    }
+    if (n1_n2_msg_txfr_err_detail->is_retry_after) {
+    if (OpenAPI_json_write_number(writer, "retryAfter", n1_n2_msg_txfr_err_detail->retry_after) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [retry_after]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_msg_txfr_err_detail->highest_prio_arp) {
+    if (OpenAPI_arp_writeJSON(writer, "highestPrioArp", n1_n2_msg_txfr_err_detail->highest_prio_arp) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [highest_prio_arp]");
+        goto end;
+    }
+    }
+
+    if (n1_n2_msg_txfr_err_detail->is_max_waiting_time) {
+    if (OpenAPI_json_write_number(writer, "maxWaitingTime", n1_n2_msg_txfr_err_detail->max_waiting_time) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [max_waiting_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_err_detail_writeJSON() failed [N1N2MsgTxfrErrDetail]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_n2_msg_txfr_err_detail_t *OpenAPI_n1_n2_msg_txfr_err_detail_parseFromJSON(cJSON *n1_n2_msg_txfr_err_detailJSON)
 {
     OpenAPI_n1_n2_msg_txfr_err_detail_t *n1_n2_msg_txfr_err_detail_local_var = NULL;
@@ -119,7 +162,6 @@ end:
 OpenAPI_n1_n2_msg_txfr_err_detail_t *OpenAPI_n1_n2_msg_txfr_err_detail_copy(OpenAPI_n1_n2_msg_txfr_err_detail_t *dst, OpenAPI_n1_n2_msg_txfr_err_detail_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_n2_msg_txfr_err_detail_convertToJSON(src);
@@ -128,21 +170,6 @@ OpenAPI_n1_n2_msg_txfr_err_detail_t *OpenAPI_n1_n2_msg_txfr_err_detail_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_n2_msg_txfr_err_detail_free(dst);
     dst = OpenAPI_n1_n2_msg_txfr_err_detail_parseFromJSON(item);
     cJSON_Delete(item);
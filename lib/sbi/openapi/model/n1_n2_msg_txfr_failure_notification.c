@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n1_n2_msg_txfr_failure_notification_t *n1_n2_msg_txfr_failure_notification)
+{
+    if (n1_n2_msg_txfr_failure_notification == NULL) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON() failed [N1N2MsgTxfrFailureNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON() failed [N1N2MsgTxfrFailureNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_n1_n2_message_transfer_cause_ToString(n1_n2_msg_txfr_failure_notification->cause)) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON() failed [cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "n1n2MsgDataUri", n1_n2_msg_txfr_failure_notification->n1n2_msg_data_uri) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON() failed [n1n2_msg_data_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n1_n2_msg_txfr_failure_notification_writeJSON() failed [N1N2MsgTxfrFailureNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n1_n2_msg_txfr_failure_notification_t *OpenAPI_n1_n2_msg_txfr_failure_notification_parseFromJSON(cJSON *n1_n2_msg_txfr_failure_notificationJSON)
 {
     OpenAPI_n1_n2_msg_txfr_failure_notification_t *n1_n2_msg_txfr_failure_notification_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_n1_n2_msg_txfr_failure_notification_t *OpenAPI_n1_n2_msg_txfr_failure_notification_copy(OpenAPI_n1_n2_msg_txfr_failure_notification_t *dst, OpenAPI_n1_n2_msg_txfr_failure_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n1_n2_msg_txfr_failure_notification_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_n1_n2_msg_txfr_failure_notification_t *OpenAPI_n1_n2_msg_txfr_failure_no
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n1_n2_msg_txfr_failure_notification_free(dst);
     dst = OpenAPI_n1_n2_msg_txfr_failure_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -124,6 +124,68 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_info_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_info_container_t *n2_info_container)
+{
+    if (n2_info_container == NULL) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [N2InfoContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [N2InfoContainer]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n2InformationClass", OpenAPI_n2_information_class_ToString(n2_info_container->n2_information_class)) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [n2_information_class]");
+        goto end;
+    }
+
+    if (n2_info_container->sm_info) {
+    if (OpenAPI_n2_sm_information_writeJSON(writer, "smInfo", n2_info_container->sm_info) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [sm_info]");
+        goto end;
+    }
+    }
+
+    if (n2_info_container->ran_info) {
+    if (OpenAPI_n2_ran_information_writeJSON(writer, "ranInfo", n2_info_container->ran_info) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [ran_info]");
+        goto end;
+    }
+    }
+
+    if (n2_info_container->nrppa_info) {
+    if (OpenAPI_nrppa_information_writeJSON(writer, "nrppaInfo", n2_info_container->nrppa_info) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [nrppa_info]");
+        goto end;
+    }
+    }
+
+    if (n2_info_container->pws_info) {
+    if (OpenAPI_pws_information_writeJSON(writer, "pwsInfo", n2_info_container->pws_info) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [pws_info]");
+        goto end;
+    }
+    }
+
+    if (n2_info_container->v2x_info) {
+    if (OpenAPI_v2x_information_writeJSON(writer, "v2xInfo", n2_info_container->v2x_info) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [v2x_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_info_container_writeJSON() failed [N2InfoContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_parseFromJSON(cJSON *n2_info_containerJSON)
 {
     OpenAPI_n2_info_container_t *n2_info_container_local_var = NULL;
@@ -192,7 +254,6 @@ end:
 OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_copy(OpenAPI_n2_info_container_t *dst, OpenAPI_n2_info_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_info_container_convertToJSON(src);
@@ -201,21 +262,6 @@ OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_copy(OpenAPI_n2_info_cont
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_info_container_free(dst);
     dst = OpenAPI_n2_info_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_information_class.h"
 #include "n2_ran_information.h"
 #include "n2_sm_information.h"
@@ -44,6 +45,7 @@ OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_create(
 void OpenAPI_n2_info_container_free(OpenAPI_n2_info_container_t *n2_info_container);
 OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_parseFromJSON(cJSON *n2_info_containerJSON);
 cJSON *OpenAPI_n2_info_container_convertToJSON(OpenAPI_n2_info_container_t *n2_info_container);
+bool OpenAPI_n2_info_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_info_container_t *n2_info_container);
 OpenAPI_n2_info_container_t *OpenAPI_n2_info_container_copy(OpenAPI_n2_info_container_t *dst, OpenAPI_n2_info_container_t *src);
 
 #ifdef __cplusplus
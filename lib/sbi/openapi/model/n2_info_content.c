@@ -71,6 +71,47 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_info_content_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_info_content_t *n2_info_content)
+{
+    if (n2_info_content == NULL) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [N2InfoContent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [N2InfoContent]");
+        return false;
+    }
+    if (n2_info_content->is_ngap_message_type) {
+    if (OpenAPI_json_write_number(writer, "ngapMessageType", n2_info_content->ngap_message_type) == false) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [ngap_message_type]");
+        goto end;
+    }
+    }
+
+    if (n2_info_content->ngap_ie_type) {
+    if (OpenAPI_json_write_string(writer, "ngapIeType", OpenAPI_ngap_ie_type_ToString(n2_info_content->ngap_ie_type)) == false) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [ngap_ie_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "ngapData", n2_info_content->ngap_data) == false) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [ngap_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_info_content_writeJSON() failed [N2InfoContent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_parseFromJSON(cJSON *n2_info_contentJSON)
 {
     OpenAPI_n2_info_content_t *n2_info_content_local_var = NULL;
@@ -118,7 +159,6 @@ end:
 OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_copy(OpenAPI_n2_info_content_t *dst, OpenAPI_n2_info_content_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_info_content_convertToJSON(src);
@@ -127,21 +167,6 @@ OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_copy(OpenAPI_n2_info_content_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_info_content_free(dst);
     dst = OpenAPI_n2_info_content_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ngap_ie_type.h"
 #include "ref_to_binary_data.h"
 
@@ -36,6 +37,7 @@ OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_create(
 void OpenAPI_n2_info_content_free(OpenAPI_n2_info_content_t *n2_info_content);
 OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_parseFromJSON(cJSON *n2_info_contentJSON);
 cJSON *OpenAPI_n2_info_content_convertToJSON(OpenAPI_n2_info_content_t *n2_info_content);
+bool OpenAPI_n2_info_content_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_info_content_t *n2_info_content);
 OpenAPI_n2_info_content_t *OpenAPI_n2_info_content_copy(OpenAPI_n2_info_content_t *dst, OpenAPI_n2_info_content_t *src);
 
 #ifdef __cplusplus
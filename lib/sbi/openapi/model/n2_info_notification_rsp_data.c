@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_info_notification_rsp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_info_notification_rsp_data_t *n2_info_notification_rsp_data)
+{
+    if (n2_info_notification_rsp_data == NULL) {
+        ogs_error("OpenAPI_n2_info_notification_rsp_data_writeJSON() failed [N2InfoNotificationRspData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_info_notification_rsp_data_writeJSON() failed [N2InfoNotificationRspData]");
+        return false;
+    }
+    if (n2_info_notification_rsp_data->n2_info_content) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "n2InfoContent", n2_info_notification_rsp_data->n2_info_content) == false) {
+        ogs_error("OpenAPI_n2_info_notification_rsp_data_writeJSON() failed [n2_info_content]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_info_notification_rsp_data_writeJSON() failed [N2InfoNotificationRspData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_info_notification_rsp_data_t *OpenAPI_n2_info_notification_rsp_data_parseFromJSON(cJSON *n2_info_notification_rsp_dataJSON)
 {
     OpenAPI_n2_info_notification_rsp_data_t *n2_info_notification_rsp_data_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_n2_info_notification_rsp_data_t *OpenAPI_n2_info_notification_rsp_data_copy(OpenAPI_n2_info_notification_rsp_data_t *dst, OpenAPI_n2_info_notification_rsp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_info_notification_rsp_data_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_n2_info_notification_rsp_data_t *OpenAPI_n2_info_notification_rsp_data_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_info_notification_rsp_data_free(dst);
     dst = OpenAPI_n2_info_notification_rsp_data_parseFromJSON(item);
     cJSON_Delete(item);
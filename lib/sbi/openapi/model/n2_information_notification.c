@@ -201,6 +201,136 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_information_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_notification_t *n2_information_notification)
+{
+    if (n2_information_notification == NULL) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [N2InformationNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [N2InformationNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n2NotifySubscriptionId", n2_information_notification->n2_notify_subscription_id) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [n2_notify_subscription_id]");
+        goto end;
+    }
+
+    if (n2_information_notification->n2_info_container) {
+    if (OpenAPI_n2_info_container_writeJSON(writer, "n2InfoContainer", n2_information_notification->n2_info_container) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [n2_info_container]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->to_release_session_list) {
+    if (OpenAPI_json_write_array_start(writer, "toReleaseSessionList") == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *to_release_session_list_node;
+    OpenAPI_list_for_each(n2_information_notification->to_release_session_list, to_release_session_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)to_release_session_list_node->data) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->lcs_correlation_id) {
+    if (OpenAPI_json_write_string(writer, "lcsCorrelationId", n2_information_notification->lcs_correlation_id) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [lcs_correlation_id]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->notify_reason) {
+    if (OpenAPI_json_write_string(writer, "notifyReason", OpenAPI_n2_info_notify_reason_ToString(n2_information_notification->notify_reason)) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [notify_reason]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->smf_change_info_list) {
+    if (OpenAPI_json_write_array_start(writer, "smfChangeInfoList") == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [smf_change_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_change_info_list_node;
+    if (n2_information_notification->smf_change_info_list) {
+        OpenAPI_list_for_each(n2_information_notification->smf_change_info_list, smf_change_info_list_node) {
+            if (OpenAPI_smf_change_info_writeJSON(writer, NULL, smf_change_info_list_node->data) == false) {
+                ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [smf_change_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [smf_change_info_list]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->ran_node_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "ranNodeId", n2_information_notification->ran_node_id) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [ran_node_id]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->initial_amf_name) {
+    if (OpenAPI_json_write_string(writer, "initialAmfName", n2_information_notification->initial_amf_name) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [initial_amf_name]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->an_n2_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "anN2IPv4Addr", n2_information_notification->an_n2_ipv4_addr) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [an_n2_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->an_n2_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "anN2IPv6Addr", n2_information_notification->an_n2_ipv6_addr) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [an_n2_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", n2_information_notification->guami) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (n2_information_notification->is_notify_source_ng_ran) {
+    if (OpenAPI_json_write_bool(writer, "notifySourceNgRan", n2_information_notification->notify_source_ng_ran) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [notify_source_ng_ran]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_notification_writeJSON() failed [N2InformationNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_parseFromJSON(cJSON *n2_information_notificationJSON)
 {
     OpenAPI_n2_information_notification_t *n2_information_notification_local_var = NULL;
@@ -365,7 +495,6 @@ end:
 OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_copy(OpenAPI_n2_information_notification_t *dst, OpenAPI_n2_information_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_notification_convertToJSON(src);
@@ -374,21 +503,6 @@ OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_notification_free(dst);
     dst = OpenAPI_n2_information_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "global_ran_node_id.h"
 #include "guami.h"
 #include "n2_info_container.h"
@@ -57,6 +58,7 @@ OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_creat
 void OpenAPI_n2_information_notification_free(OpenAPI_n2_information_notification_t *n2_information_notification);
 OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_parseFromJSON(cJSON *n2_information_notificationJSON);
 cJSON *OpenAPI_n2_information_notification_convertToJSON(OpenAPI_n2_information_notification_t *n2_information_notification);
+bool OpenAPI_n2_information_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_notification_t *n2_information_notification);
 OpenAPI_n2_information_notification_t *OpenAPI_n2_information_notification_copy(OpenAPI_n2_information_notification_t *dst, OpenAPI_n2_information_notification_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,40 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_information_transfer_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_transfer_error_t *n2_information_transfer_error)
+{
+    if (n2_information_transfer_error == NULL) {
+        ogs_error("OpenAPI_n2_information_transfer_error_writeJSON() failed [N2InformationTransferError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_error_writeJSON() failed [N2InformationTransferError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", n2_information_transfer_error->error) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (n2_information_transfer_error->pws_error_info) {
+    if (OpenAPI_pws_error_data_writeJSON(writer, "pwsErrorInfo", n2_information_transfer_error->pws_error_info) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_error_writeJSON() failed [pws_error_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_error_writeJSON() failed [N2InformationTransferError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_parseFromJSON(cJSON *n2_information_transfer_errorJSON)
 {
     OpenAPI_n2_information_transfer_error_t *n2_information_transfer_error_local_var = NULL;
@@ -99,7 +133,6 @@ end:
 OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_copy(OpenAPI_n2_information_transfer_error_t *dst, OpenAPI_n2_information_transfer_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_transfer_error_convertToJSON(src);
@@ -108,21 +141,6 @@ OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_transfer_error_free(dst);
     dst = OpenAPI_n2_information_transfer_error_parseFromJSON(item);
     cJSON_Delete(item);
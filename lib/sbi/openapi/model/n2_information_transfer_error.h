@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "problem_details.h"
 #include "pws_error_data.h"
 
@@ -32,6 +33,7 @@ OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_c
 void OpenAPI_n2_information_transfer_error_free(OpenAPI_n2_information_transfer_error_t *n2_information_transfer_error);
 OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_parseFromJSON(cJSON *n2_information_transfer_errorJSON);
 cJSON *OpenAPI_n2_information_transfer_error_convertToJSON(OpenAPI_n2_information_transfer_error_t *n2_information_transfer_error);
+bool OpenAPI_n2_information_transfer_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_transfer_error_t *n2_information_transfer_error);
 OpenAPI_n2_information_transfer_error_t *OpenAPI_n2_information_transfer_error_copy(OpenAPI_n2_information_transfer_error_t *dst, OpenAPI_n2_information_transfer_error_t *src);
 
 #ifdef __cplusplus
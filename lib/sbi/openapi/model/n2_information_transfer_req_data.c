@@ -122,6 +122,89 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_information_transfer_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_transfer_req_data_t *n2_information_transfer_req_data)
+{
+    if (n2_information_transfer_req_data == NULL) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [N2InformationTransferReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [N2InformationTransferReqData]");
+        return false;
+    }
+    if (n2_information_transfer_req_data->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (n2_information_transfer_req_data->tai_list) {
+        OpenAPI_list_for_each(n2_information_transfer_req_data->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (n2_information_transfer_req_data->rat_selector) {
+    if (OpenAPI_json_write_string(writer, "ratSelector", OpenAPI_rat_selector_ToString(n2_information_transfer_req_data->rat_selector)) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [rat_selector]");
+        goto end;
+    }
+    }
+
+    if (n2_information_transfer_req_data->global_ran_node_list) {
+    if (OpenAPI_json_write_array_start(writer, "globalRanNodeList") == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [global_ran_node_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *global_ran_node_list_node;
+    if (n2_information_transfer_req_data->global_ran_node_list) {
+        OpenAPI_list_for_each(n2_information_transfer_req_data->global_ran_node_list, global_ran_node_list_node) {
+            if (OpenAPI_global_ran_node_id_writeJSON(writer, NULL, global_ran_node_list_node->data) == false) {
+                ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [global_ran_node_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [global_ran_node_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_n2_info_container_writeJSON(writer, "n2Information", n2_information_transfer_req_data->n2_information) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [n2_information]");
+        goto end;
+    }
+
+    if (n2_information_transfer_req_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", n2_information_transfer_req_data->supported_features) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_req_data_writeJSON() failed [N2InformationTransferReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_information_transfer_req_data_t *OpenAPI_n2_information_transfer_req_data_parseFromJSON(cJSON *n2_information_transfer_req_dataJSON)
 {
     OpenAPI_n2_information_transfer_req_data_t *n2_information_transfer_req_data_local_var = NULL;
@@ -228,7 +311,6 @@ end:
 OpenAPI_n2_information_transfer_req_data_t *OpenAPI_n2_information_transfer_req_data_copy(OpenAPI_n2_information_transfer_req_data_t *dst, OpenAPI_n2_information_transfer_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_transfer_req_data_convertToJSON(src);
@@ -237,21 +319,6 @@ OpenAPI_n2_information_transfer_req_data_t *OpenAPI_n2_information_transfer_req_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_transfer_req_data_free(dst);
     dst = OpenAPI_n2_information_transfer_req_data_parseFromJSON(item);
     cJSON_Delete(item);
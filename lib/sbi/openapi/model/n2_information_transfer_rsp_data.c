@@ -70,6 +70,47 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_information_transfer_rsp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_information_transfer_rsp_data_t *n2_information_transfer_rsp_data)
+{
+    if (n2_information_transfer_rsp_data == NULL) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [N2InformationTransferRspData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [N2InformationTransferRspData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "result", OpenAPI_n2_information_transfer_result_ToString(n2_information_transfer_rsp_data->result)) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [result]");
+        goto end;
+    }
+
+    if (n2_information_transfer_rsp_data->pws_rsp_data) {
+    if (OpenAPI_pws_response_data_writeJSON(writer, "pwsRspData", n2_information_transfer_rsp_data->pws_rsp_data) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [pws_rsp_data]");
+        goto end;
+    }
+    }
+
+    if (n2_information_transfer_rsp_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", n2_information_transfer_rsp_data->supported_features) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_information_transfer_rsp_data_writeJSON() failed [N2InformationTransferRspData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_information_transfer_rsp_data_t *OpenAPI_n2_information_transfer_rsp_data_parseFromJSON(cJSON *n2_information_transfer_rsp_dataJSON)
 {
     OpenAPI_n2_information_transfer_rsp_data_t *n2_information_transfer_rsp_data_local_var = NULL;
@@ -116,7 +157,6 @@ end:
 OpenAPI_n2_information_transfer_rsp_data_t *OpenAPI_n2_information_transfer_rsp_data_copy(OpenAPI_n2_information_transfer_rsp_data_t *dst, OpenAPI_n2_information_transfer_rsp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_information_transfer_rsp_data_convertToJSON(src);
@@ -125,21 +165,6 @@ OpenAPI_n2_information_transfer_rsp_data_t *OpenAPI_n2_information_transfer_rsp_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_information_transfer_rsp_data_free(dst);
     dst = OpenAPI_n2_information_transfer_rsp_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -91,6 +91,73 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_interface_amf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_interface_amf_info_t *n2_interface_amf_info)
+{
+    if (n2_interface_amf_info == NULL) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [N2InterfaceAmfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [N2InterfaceAmfInfo]");
+        return false;
+    }
+    if (n2_interface_amf_info->ipv4_endpoint_address) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4EndpointAddress") == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv4_endpoint_address]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_endpoint_address_node;
+    OpenAPI_list_for_each(n2_interface_amf_info->ipv4_endpoint_address, ipv4_endpoint_address_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_endpoint_address_node->data) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv4_endpoint_address]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv4_endpoint_address]");
+        goto end;
+    }
+    }
+
+    if (n2_interface_amf_info->ipv6_endpoint_address) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6EndpointAddress") == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv6_endpoint_address]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_endpoint_address_node;
+    OpenAPI_list_for_each(n2_interface_amf_info->ipv6_endpoint_address, ipv6_endpoint_address_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_endpoint_address_node->data) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv6_endpoint_address]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [ipv6_endpoint_address]");
+        goto end;
+    }
+    }
+
+    if (n2_interface_amf_info->amf_name) {
+    if (OpenAPI_json_write_string(writer, "amfName", n2_interface_amf_info->amf_name) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [amf_name]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_interface_amf_info_writeJSON() failed [N2InterfaceAmfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_interface_amf_info_t *OpenAPI_n2_interface_amf_info_parseFromJSON(cJSON *n2_interface_amf_infoJSON)
 {
     OpenAPI_n2_interface_amf_info_t *n2_interface_amf_info_local_var = NULL;
@@ -157,7 +224,6 @@ end:
 OpenAPI_n2_interface_amf_info_t *OpenAPI_n2_interface_amf_info_copy(OpenAPI_n2_interface_amf_info_t *dst, OpenAPI_n2_interface_amf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_interface_amf_info_convertToJSON(src);
@@ -166,21 +232,6 @@ OpenAPI_n2_interface_amf_info_t *OpenAPI_n2_interface_amf_info_copy(OpenAPI_n2_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_interface_amf_info_free(dst);
     dst = OpenAPI_n2_interface_amf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,6 +51,33 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_ran_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_ran_information_t *n2_ran_information)
+{
+    if (n2_ran_information == NULL) {
+        ogs_error("OpenAPI_n2_ran_information_writeJSON() failed [N2RanInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_ran_information_writeJSON() failed [N2RanInformation]");
+        return false;
+    }
+    if (OpenAPI_n2_info_content_writeJSON(writer, "n2InfoContent", n2_ran_information->n2_info_content) == false) {
+        ogs_error("OpenAPI_n2_ran_information_writeJSON() failed [n2_info_content]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_ran_information_writeJSON() failed [N2RanInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_ran_information_t *OpenAPI_n2_ran_information_parseFromJSON(cJSON *n2_ran_informationJSON)
 {
     OpenAPI_n2_ran_information_t *n2_ran_information_local_var = NULL;
@@ -75,7 +102,6 @@ end:
 OpenAPI_n2_ran_information_t *OpenAPI_n2_ran_information_copy(OpenAPI_n2_ran_information_t *dst, OpenAPI_n2_ran_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_ran_information_convertToJSON(src);
@@ -84,21 +110,6 @@ OpenAPI_n2_ran_information_t *OpenAPI_n2_ran_information_copy(OpenAPI_n2_ran_inf
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_ran_information_free(dst);
     dst = OpenAPI_n2_ran_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -119,6 +119,68 @@ end:
     return item;
 }
 
+bool OpenAPI_n2_sm_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_sm_information_t *n2_sm_information)
+{
+    if (n2_sm_information == NULL) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [N2SmInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [N2SmInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", n2_sm_information->pdu_session_id) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (n2_sm_information->n2_info_content) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "n2InfoContent", n2_sm_information->n2_info_content) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [n2_info_content]");
+        goto end;
+    }
+    }
+
+    if (n2_sm_information->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", n2_sm_information->s_nssai) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (n2_sm_information->home_plmn_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "homePlmnSnssai", n2_sm_information->home_plmn_snssai) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [home_plmn_snssai]");
+        goto end;
+    }
+    }
+
+    if (n2_sm_information->iwk_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "iwkSnssai", n2_sm_information->iwk_snssai) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [iwk_snssai]");
+        goto end;
+    }
+    }
+
+    if (n2_sm_information->is_subject_to_ho) {
+    if (OpenAPI_json_write_bool(writer, "subjectToHo", n2_sm_information->subject_to_ho) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [subject_to_ho]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n2_sm_information_writeJSON() failed [N2SmInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_parseFromJSON(cJSON *n2_sm_informationJSON)
 {
     OpenAPI_n2_sm_information_t *n2_sm_information_local_var = NULL;
@@ -189,7 +251,6 @@ end:
 OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_copy(OpenAPI_n2_sm_information_t *dst, OpenAPI_n2_sm_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n2_sm_information_convertToJSON(src);
@@ -198,21 +259,6 @@ OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_copy(OpenAPI_n2_sm_inform
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n2_sm_information_free(dst);
     dst = OpenAPI_n2_sm_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_info_content.h"
 #include "snssai.h"
 
@@ -42,6 +43,7 @@ OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_create(
 void OpenAPI_n2_sm_information_free(OpenAPI_n2_sm_information_t *n2_sm_information);
 OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_parseFromJSON(cJSON *n2_sm_informationJSON);
 cJSON *OpenAPI_n2_sm_information_convertToJSON(OpenAPI_n2_sm_information_t *n2_sm_information);
+bool OpenAPI_n2_sm_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n2_sm_information_t *n2_sm_information);
 OpenAPI_n2_sm_information_t *OpenAPI_n2_sm_information_copy(OpenAPI_n2_sm_information_t *dst, OpenAPI_n2_sm_information_t *src);
 
 #ifdef __cplusplus
@@ -171,6 +171,105 @@ end:
     return item;
 }
 
+bool OpenAPI_n3ga_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n3ga_location_t *n3ga_location)
+{
+    if (n3ga_location == NULL) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [N3gaLocation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [N3gaLocation]");
+        return false;
+    }
+    if (n3ga_location->n3gpp_tai) {
+    if (OpenAPI_tai_writeJSON(writer, "n3gppTai", n3ga_location->n3gpp_tai) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [n3gpp_tai]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->n3_iwf_id) {
+    if (OpenAPI_json_write_string(writer, "n3IwfId", n3ga_location->n3_iwf_id) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [n3_iwf_id]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->ue_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4Addr", n3ga_location->ue_ipv4_addr) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [ue_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->ue_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6Addr", n3ga_location->ue_ipv6_addr) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [ue_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->is_port_number) {
+    if (OpenAPI_json_write_number(writer, "portNumber", n3ga_location->port_number) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [port_number]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->tnap_id) {
+    if (OpenAPI_tnap_id_writeJSON(writer, "tnapId", n3ga_location->tnap_id) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [tnap_id]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->twap_id) {
+    if (OpenAPI_twap_id_writeJSON(writer, "twapId", n3ga_location->twap_id) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [twap_id]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->hfc_node_id) {
+    if (OpenAPI_hfc_node_id_writeJSON(writer, "hfcNodeId", n3ga_location->hfc_node_id) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [hfc_node_id]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->gli) {
+    if (OpenAPI_json_write_string(writer, "gli", n3ga_location->gli) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [gli]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->w5gban_line_type) {
+    if (OpenAPI_json_write_string(writer, "w5gbanLineType", OpenAPI_line_type_ToString(n3ga_location->w5gban_line_type)) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [w5gban_line_type]");
+        goto end;
+    }
+    }
+
+    if (n3ga_location->gci) {
+    if (OpenAPI_json_write_string(writer, "gci", n3ga_location->gci) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [gci]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n3ga_location_writeJSON() failed [N3gaLocation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_parseFromJSON(cJSON *n3ga_locationJSON)
 {
     OpenAPI_n3ga_location_t *n3ga_location_local_var = NULL;
@@ -290,7 +389,6 @@ end:
 OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_copy(OpenAPI_n3ga_location_t *dst, OpenAPI_n3ga_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n3ga_location_convertToJSON(src);
@@ -299,21 +397,6 @@ OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_copy(OpenAPI_n3ga_location_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n3ga_location_free(dst);
     dst = OpenAPI_n3ga_location_parseFromJSON(item);
     cJSON_Delete(item);
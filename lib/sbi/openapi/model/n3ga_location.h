@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "hfc_node_id.h"
 #include "line_type.h"
 #include "tai.h"
@@ -55,6 +56,7 @@ OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_create(
 void OpenAPI_n3ga_location_free(OpenAPI_n3ga_location_t *n3ga_location);
 OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_parseFromJSON(cJSON *n3ga_locationJSON);
 cJSON *OpenAPI_n3ga_location_convertToJSON(OpenAPI_n3ga_location_t *n3ga_location);
+bool OpenAPI_n3ga_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n3ga_location_t *n3ga_location);
 OpenAPI_n3ga_location_t *OpenAPI_n3ga_location_copy(OpenAPI_n3ga_location_t *dst, OpenAPI_n3ga_location_t *src);
 
 #ifdef __cplusplus
@@ -74,6 +74,45 @@ end:
     return item;
 }
 
+bool OpenAPI_n4_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n4_information_t *n4_information)
+{
+    if (n4_information == NULL) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [N4Information]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [N4Information]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n4MessageType", OpenAPI_n4_message_type_ToString(n4_information->n4_message_type)) == false) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [n4_message_type]");
+        goto end;
+    }
+
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n4MessagePayload", n4_information->n4_message_payload) == false) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [n4_message_payload]");
+        goto end;
+    }
+
+    if (n4_information->n4_dnai_info) {
+    if (OpenAPI_dnai_information_writeJSON(writer, "n4DnaiInfo", n4_information->n4_dnai_info) == false) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [n4_dnai_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_n4_information_writeJSON() failed [N4Information]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_n4_information_t *OpenAPI_n4_information_parseFromJSON(cJSON *n4_informationJSON)
 {
     OpenAPI_n4_information_t *n4_information_local_var = NULL;
@@ -120,7 +159,6 @@ end:
 OpenAPI_n4_information_t *OpenAPI_n4_information_copy(OpenAPI_n4_information_t *dst, OpenAPI_n4_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_n4_information_convertToJSON(src);
@@ -129,21 +167,6 @@ OpenAPI_n4_information_t *OpenAPI_n4_information_copy(OpenAPI_n4_information_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_n4_information_free(dst);
     dst = OpenAPI_n4_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnai_information.h"
 #include "n4_message_type.h"
 #include "ref_to_binary_data.h"
@@ -35,6 +36,7 @@ OpenAPI_n4_information_t *OpenAPI_n4_information_create(
 void OpenAPI_n4_information_free(OpenAPI_n4_information_t *n4_information);
 OpenAPI_n4_information_t *OpenAPI_n4_information_parseFromJSON(cJSON *n4_informationJSON);
 cJSON *OpenAPI_n4_information_convertToJSON(OpenAPI_n4_information_t *n4_information);
+bool OpenAPI_n4_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_n4_information_t *n4_information);
 OpenAPI_n4_information_t *OpenAPI_n4_information_copy(OpenAPI_n4_information_t *dst, OpenAPI_n4_information_t *src);
 
 #ifdef __cplusplus
@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_nas_security_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nas_security_mode_t *nas_security_mode)
+{
+    if (nas_security_mode == NULL) {
+        ogs_error("OpenAPI_nas_security_mode_writeJSON() failed [NasSecurityMode]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nas_security_mode_writeJSON() failed [NasSecurityMode]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "integrityAlgorithm", OpenAPI_integrity_algorithm_ToString(nas_security_mode->integrity_algorithm)) == false) {
+        ogs_error("OpenAPI_nas_security_mode_writeJSON() failed [integrity_algorithm]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "cipheringAlgorithm", OpenAPI_ciphering_algorithm_ToString(nas_security_mode->ciphering_algorithm)) == false) {
+        ogs_error("OpenAPI_nas_security_mode_writeJSON() failed [ciphering_algorithm]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nas_security_mode_writeJSON() failed [NasSecurityMode]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_parseFromJSON(cJSON *nas_security_modeJSON)
 {
     OpenAPI_nas_security_mode_t *nas_security_mode_local_var = NULL;
@@ -93,7 +125,6 @@ end:
 OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_copy(OpenAPI_nas_security_mode_t *dst, OpenAPI_nas_security_mode_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nas_security_mode_convertToJSON(src);
@@ -102,21 +133,6 @@ OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_copy(OpenAPI_nas_security
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nas_security_mode_free(dst);
     dst = OpenAPI_nas_security_mode_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ciphering_algorithm.h"
 #include "integrity_algorithm.h"
 
@@ -32,6 +33,7 @@ OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_create(
 void OpenAPI_nas_security_mode_free(OpenAPI_nas_security_mode_t *nas_security_mode);
 OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_parseFromJSON(cJSON *nas_security_modeJSON);
 cJSON *OpenAPI_nas_security_mode_convertToJSON(OpenAPI_nas_security_mode_t *nas_security_mode);
+bool OpenAPI_nas_security_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nas_security_mode_t *nas_security_mode);
 OpenAPI_nas_security_mode_t *OpenAPI_nas_security_mode_copy(OpenAPI_nas_security_mode_t *dst, OpenAPI_nas_security_mode_t *src);
 
 #ifdef __cplusplus
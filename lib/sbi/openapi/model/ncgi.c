@@ -69,6 +69,45 @@ end:
     return item;
 }
 
+bool OpenAPI_ncgi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ncgi_t *ncgi)
+{
+    if (ncgi == NULL) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [Ncgi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [Ncgi]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", ncgi->plmn_id) == false) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nrCellId", ncgi->nr_cell_id) == false) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [nr_cell_id]");
+        goto end;
+    }
+
+    if (ncgi->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", ncgi->nid) == false) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ncgi_writeJSON() failed [Ncgi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ncgi_t *OpenAPI_ncgi_parseFromJSON(cJSON *ncgiJSON)
 {
     OpenAPI_ncgi_t *ncgi_local_var = NULL;
@@ -115,7 +154,6 @@ end:
 OpenAPI_ncgi_t *OpenAPI_ncgi_copy(OpenAPI_ncgi_t *dst, OpenAPI_ncgi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ncgi_convertToJSON(src);
@@ -124,21 +162,6 @@ OpenAPI_ncgi_t *OpenAPI_ncgi_copy(OpenAPI_ncgi_t *dst, OpenAPI_ncgi_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ncgi_free(dst);
     dst = OpenAPI_ncgi_parseFromJSON(item);
     cJSON_Delete(item);
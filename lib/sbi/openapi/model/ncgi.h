@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ncgi_t *OpenAPI_ncgi_create(
 void OpenAPI_ncgi_free(OpenAPI_ncgi_t *ncgi);
 OpenAPI_ncgi_t *OpenAPI_ncgi_parseFromJSON(cJSON *ncgiJSON);
 cJSON *OpenAPI_ncgi_convertToJSON(OpenAPI_ncgi_t *ncgi);
+bool OpenAPI_ncgi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ncgi_t *ncgi);
 OpenAPI_ncgi_t *OpenAPI_ncgi_copy(OpenAPI_ncgi_t *dst, OpenAPI_ncgi_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_ncgi_1_t *OpenAPI_ncgi_1_create(
 void OpenAPI_ncgi_1_free(OpenAPI_ncgi_1_t *ncgi_1);
 OpenAPI_ncgi_1_t *OpenAPI_ncgi_1_parseFromJSON(cJSON *ncgi_1JSON);
 cJSON *OpenAPI_ncgi_1_convertToJSON(OpenAPI_ncgi_1_t *ncgi_1);
+bool OpenAPI_ncgi_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ncgi_1_t *ncgi_1);
 OpenAPI_ncgi_1_t *OpenAPI_ncgi_1_copy(OpenAPI_ncgi_1_t *dst, OpenAPI_ncgi_1_t *src);
 
 #ifdef __cplusplus
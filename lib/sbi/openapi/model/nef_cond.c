@@ -201,6 +201,140 @@ end:
     return item;
 }
 
+bool OpenAPI_nef_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nef_cond_t *nef_cond)
+{
+    if (nef_cond == NULL) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [NefCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [NefCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "conditionType", OpenAPI_condition_typenef_cond_ToString(nef_cond->condition_type)) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [condition_type]");
+        goto end;
+    }
+
+    if (nef_cond->af_events) {
+    if (OpenAPI_json_write_array_start(writer, "afEvents") == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [af_events]");
+        goto end;
+    }
+    OpenAPI_lnode_t *af_events_node;
+    OpenAPI_list_for_each(nef_cond->af_events, af_events_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_af_event_ToString((intptr_t)af_events_node->data)) == false) {
+            ogs_error("OpenAPI_nef_cond_writeJSON() failed [af_events]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [af_events]");
+        goto end;
+    }
+    }
+
+    if (nef_cond->snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "snssaiList") == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssai_list_node;
+    if (nef_cond->snssai_list) {
+        OpenAPI_list_for_each(nef_cond->snssai_list, snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_nef_cond_writeJSON() failed [snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+    }
+
+    if (nef_cond->pfd_data) {
+    if (OpenAPI_pfd_data_writeJSON(writer, "pfdData", nef_cond->pfd_data) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [pfd_data]");
+        goto end;
+    }
+    }
+
+    if (nef_cond->gpsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRanges") == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_ranges_node;
+    if (nef_cond->gpsi_ranges) {
+        OpenAPI_list_for_each(nef_cond->gpsi_ranges, gpsi_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_nef_cond_writeJSON() failed [gpsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (nef_cond->external_group_identifiers_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "externalGroupIdentifiersRanges") == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *external_group_identifiers_ranges_node;
+    if (nef_cond->external_group_identifiers_ranges) {
+        OpenAPI_list_for_each(nef_cond->external_group_identifiers_ranges, external_group_identifiers_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, external_group_identifiers_ranges_node->data) == false) {
+                ogs_error("OpenAPI_nef_cond_writeJSON() failed [external_group_identifiers_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+    }
+
+    if (nef_cond->served_fqdn_list) {
+    if (OpenAPI_json_write_array_start(writer, "servedFqdnList") == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *served_fqdn_list_node;
+    OpenAPI_list_for_each(nef_cond->served_fqdn_list, served_fqdn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)served_fqdn_list_node->data) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nef_cond_writeJSON() failed [NefCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nef_cond_t *OpenAPI_nef_cond_parseFromJSON(cJSON *nef_condJSON)
 {
     OpenAPI_nef_cond_t *nef_cond_local_var = NULL;
@@ -371,7 +505,6 @@ end:
 OpenAPI_nef_cond_t *OpenAPI_nef_cond_copy(OpenAPI_nef_cond_t *dst, OpenAPI_nef_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nef_cond_convertToJSON(src);
@@ -380,21 +513,6 @@ OpenAPI_nef_cond_t *OpenAPI_nef_cond_copy(OpenAPI_nef_cond_t *dst, OpenAPI_nef_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nef_cond_free(dst);
     dst = OpenAPI_nef_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_event.h"
 #include "identity_range.h"
 #include "pfd_data.h"
@@ -49,6 +50,7 @@ OpenAPI_nef_cond_t *OpenAPI_nef_cond_create(
 void OpenAPI_nef_cond_free(OpenAPI_nef_cond_t *nef_cond);
 OpenAPI_nef_cond_t *OpenAPI_nef_cond_parseFromJSON(cJSON *nef_condJSON);
 cJSON *OpenAPI_nef_cond_convertToJSON(OpenAPI_nef_cond_t *nef_cond);
+bool OpenAPI_nef_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nef_cond_t *nef_cond);
 OpenAPI_nef_cond_t *OpenAPI_nef_cond_copy(OpenAPI_nef_cond_t *dst, OpenAPI_nef_cond_t *src);
 
 #ifdef __cplusplus
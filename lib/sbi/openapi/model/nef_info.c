@@ -153,6 +153,110 @@ end:
     return item;
 }
 
+bool OpenAPI_nef_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nef_info_t *nef_info)
+{
+    if (nef_info == NULL) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [NefInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [NefInfo]");
+        return false;
+    }
+    if (nef_info->nef_id) {
+    if (OpenAPI_json_write_string(writer, "nefId", nef_info->nef_id) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [nef_id]");
+        goto end;
+    }
+    }
+
+    if (nef_info->pfd_data) {
+    if (OpenAPI_pfd_data_writeJSON(writer, "pfdData", nef_info->pfd_data) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [pfd_data]");
+        goto end;
+    }
+    }
+
+    if (nef_info->af_ee_data) {
+    if (OpenAPI_af_event_exposure_data_writeJSON(writer, "afEeData", nef_info->af_ee_data) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [af_ee_data]");
+        goto end;
+    }
+    }
+
+    if (nef_info->gpsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRanges") == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_ranges_node;
+    if (nef_info->gpsi_ranges) {
+        OpenAPI_list_for_each(nef_info->gpsi_ranges, gpsi_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_nef_info_writeJSON() failed [gpsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (nef_info->external_group_identifiers_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "externalGroupIdentifiersRanges") == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *external_group_identifiers_ranges_node;
+    if (nef_info->external_group_identifiers_ranges) {
+        OpenAPI_list_for_each(nef_info->external_group_identifiers_ranges, external_group_identifiers_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, external_group_identifiers_ranges_node->data) == false) {
+                ogs_error("OpenAPI_nef_info_writeJSON() failed [external_group_identifiers_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+    }
+
+    if (nef_info->served_fqdn_list) {
+    if (OpenAPI_json_write_array_start(writer, "servedFqdnList") == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *served_fqdn_list_node;
+    OpenAPI_list_for_each(nef_info->served_fqdn_list, served_fqdn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)served_fqdn_list_node->data) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [served_fqdn_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nef_info_writeJSON() failed [NefInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nef_info_t *OpenAPI_nef_info_parseFromJSON(cJSON *nef_infoJSON)
 {
     OpenAPI_nef_info_t *nef_info_local_var = NULL;
@@ -274,7 +378,6 @@ end:
 OpenAPI_nef_info_t *OpenAPI_nef_info_copy(OpenAPI_nef_info_t *dst, OpenAPI_nef_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nef_info_convertToJSON(src);
@@ -283,21 +386,6 @@ OpenAPI_nef_info_t *OpenAPI_nef_info_copy(OpenAPI_nef_info_t *dst, OpenAPI_nef_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nef_info_free(dst);
     dst = OpenAPI_nef_info_parseFromJSON(item);
     cJSON_Delete(item);
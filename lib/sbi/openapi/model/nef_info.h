@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_event_exposure_data.h"
 #include "identity_range.h"
 #include "pfd_data.h"
@@ -41,6 +42,7 @@ OpenAPI_nef_info_t *OpenAPI_nef_info_create(
 void OpenAPI_nef_info_free(OpenAPI_nef_info_t *nef_info);
 OpenAPI_nef_info_t *OpenAPI_nef_info_parseFromJSON(cJSON *nef_infoJSON);
 cJSON *OpenAPI_nef_info_convertToJSON(OpenAPI_nef_info_t *nef_info);
+bool OpenAPI_nef_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nef_info_t *nef_info);
 OpenAPI_nef_info_t *OpenAPI_nef_info_copy(OpenAPI_nef_info_t *dst, OpenAPI_nef_info_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi.h"
 #include "global_ran_node_id.h"
 #include "ncgi.h"
@@ -38,6 +39,7 @@ OpenAPI_network_area_info_t *OpenAPI_network_area_info_create(
 void OpenAPI_network_area_info_free(OpenAPI_network_area_info_t *network_area_info);
 OpenAPI_network_area_info_t *OpenAPI_network_area_info_parseFromJSON(cJSON *network_area_infoJSON);
 cJSON *OpenAPI_network_area_info_convertToJSON(OpenAPI_network_area_info_t *network_area_info);
+bool OpenAPI_network_area_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_area_info_t *network_area_info);
 OpenAPI_network_area_info_t *OpenAPI_network_area_info_copy(OpenAPI_network_area_info_t *dst, OpenAPI_network_area_info_t *src);
 
 #ifdef __cplusplus
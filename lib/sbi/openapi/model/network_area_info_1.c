@@ -141,6 +141,112 @@ end:
     return item;
 }
 
+bool OpenAPI_network_area_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_area_info_1_t *network_area_info_1)
+{
+    if (network_area_info_1 == NULL) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [NetworkAreaInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [NetworkAreaInfo_1]");
+        return false;
+    }
+    if (network_area_info_1->ecgis) {
+    if (OpenAPI_json_write_array_start(writer, "ecgis") == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ecgis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ecgis_node;
+    if (network_area_info_1->ecgis) {
+        OpenAPI_list_for_each(network_area_info_1->ecgis, ecgis_node) {
+            if (OpenAPI_ecgi_1_writeJSON(writer, NULL, ecgis_node->data) == false) {
+                ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ecgis]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ecgis]");
+        goto end;
+    }
+    }
+
+    if (network_area_info_1->ncgis) {
+    if (OpenAPI_json_write_array_start(writer, "ncgis") == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ncgis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ncgis_node;
+    if (network_area_info_1->ncgis) {
+        OpenAPI_list_for_each(network_area_info_1->ncgis, ncgis_node) {
+            if (OpenAPI_ncgi_1_writeJSON(writer, NULL, ncgis_node->data) == false) {
+                ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ncgis]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [ncgis]");
+        goto end;
+    }
+    }
+
+    if (network_area_info_1->g_ran_node_ids) {
+    if (OpenAPI_json_write_array_start(writer, "gRanNodeIds") == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [g_ran_node_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *g_ran_node_ids_node;
+    if (network_area_info_1->g_ran_node_ids) {
+        OpenAPI_list_for_each(network_area_info_1->g_ran_node_ids, g_ran_node_ids_node) {
+            if (OpenAPI_global_ran_node_id_1_writeJSON(writer, NULL, g_ran_node_ids_node->data) == false) {
+                ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [g_ran_node_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [g_ran_node_ids]");
+        goto end;
+    }
+    }
+
+    if (network_area_info_1->tais) {
+    if (OpenAPI_json_write_array_start(writer, "tais") == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [tais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tais_node;
+    if (network_area_info_1->tais) {
+        OpenAPI_list_for_each(network_area_info_1->tais, tais_node) {
+            if (OpenAPI_tai_1_writeJSON(writer, NULL, tais_node->data) == false) {
+                ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [tais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [tais]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_network_area_info_1_writeJSON() failed [NetworkAreaInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_parseFromJSON(cJSON *network_area_info_1JSON)
 {
     OpenAPI_network_area_info_1_t *network_area_info_1_local_var = NULL;
@@ -275,7 +381,6 @@ end:
 OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_copy(OpenAPI_network_area_info_1_t *dst, OpenAPI_network_area_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_area_info_1_convertToJSON(src);
@@ -284,21 +389,6 @@ OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_copy(OpenAPI_network_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_area_info_1_free(dst);
     dst = OpenAPI_network_area_info_1_parseFromJSON(item);
     cJSON_Delete(item);
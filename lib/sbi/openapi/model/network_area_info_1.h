@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi_1.h"
 #include "global_ran_node_id_1.h"
 #include "ncgi_1.h"
@@ -38,6 +39,7 @@ OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_create(
 void OpenAPI_network_area_info_1_free(OpenAPI_network_area_info_1_t *network_area_info_1);
 OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_parseFromJSON(cJSON *network_area_info_1JSON);
 cJSON *OpenAPI_network_area_info_1_convertToJSON(OpenAPI_network_area_info_1_t *network_area_info_1);
+bool OpenAPI_network_area_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_area_info_1_t *network_area_info_1);
 OpenAPI_network_area_info_1_t *OpenAPI_network_area_info_1_copy(OpenAPI_network_area_info_1_t *dst, OpenAPI_network_area_info_1_t *src);
 
 #ifdef __cplusplus
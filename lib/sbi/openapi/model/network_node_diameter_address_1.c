@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_network_node_diameter_address_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_node_diameter_address_1_t *network_node_diameter_address_1)
+{
+    if (network_node_diameter_address_1 == NULL) {
+        ogs_error("OpenAPI_network_node_diameter_address_1_writeJSON() failed [NetworkNodeDiameterAddress_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_network_node_diameter_address_1_writeJSON() failed [NetworkNodeDiameterAddress_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "name", network_node_diameter_address_1->name) == false) {
+        ogs_error("OpenAPI_network_node_diameter_address_1_writeJSON() failed [name]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "realm", network_node_diameter_address_1->realm) == false) {
+        ogs_error("OpenAPI_network_node_diameter_address_1_writeJSON() failed [realm]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_network_node_diameter_address_1_writeJSON() failed [NetworkNodeDiameterAddress_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_network_node_diameter_address_1_t *OpenAPI_network_node_diameter_address_1_parseFromJSON(cJSON *network_node_diameter_address_1JSON)
 {
     OpenAPI_network_node_diameter_address_1_t *network_node_diameter_address_1_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_network_node_diameter_address_1_t *OpenAPI_network_node_diameter_address_1_copy(OpenAPI_network_node_diameter_address_1_t *dst, OpenAPI_network_node_diameter_address_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_node_diameter_address_1_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_network_node_diameter_address_1_t *OpenAPI_network_node_diameter_address
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_node_diameter_address_1_free(dst);
     dst = OpenAPI_network_node_diameter_address_1_parseFromJSON(item);
     cJSON_Delete(item);
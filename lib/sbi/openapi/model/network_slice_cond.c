@@ -83,6 +83,66 @@ end:
     return item;
 }
 
+bool OpenAPI_network_slice_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_slice_cond_t *network_slice_cond)
+{
+    if (network_slice_cond == NULL) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [NetworkSliceCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [NetworkSliceCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "snssaiList") == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssai_list_node;
+    if (network_slice_cond->snssai_list) {
+        OpenAPI_list_for_each(network_slice_cond->snssai_list, snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+
+    if (network_slice_cond->nsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "nsiList") == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nsi_list_node;
+    OpenAPI_list_for_each(network_slice_cond->nsi_list, nsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nsi_list_node->data) == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_network_slice_cond_writeJSON() failed [NetworkSliceCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_parseFromJSON(cJSON *network_slice_condJSON)
 {
     OpenAPI_network_slice_cond_t *network_slice_cond_local_var = NULL;
@@ -150,7 +210,6 @@ end:
 OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_copy(OpenAPI_network_slice_cond_t *dst, OpenAPI_network_slice_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_network_slice_cond_convertToJSON(src);
@@ -159,21 +218,6 @@ OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_copy(OpenAPI_network_sl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_network_slice_cond_free(dst);
     dst = OpenAPI_network_slice_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_create(
 void OpenAPI_network_slice_cond_free(OpenAPI_network_slice_cond_t *network_slice_cond);
 OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_parseFromJSON(cJSON *network_slice_condJSON);
 cJSON *OpenAPI_network_slice_cond_convertToJSON(OpenAPI_network_slice_cond_t *network_slice_cond);
+bool OpenAPI_network_slice_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_network_slice_cond_t *network_slice_cond);
 OpenAPI_network_slice_cond_t *OpenAPI_network_slice_cond_copy(OpenAPI_network_slice_cond_t *dst, OpenAPI_network_slice_cond_t *src);
 
 #ifdef __cplusplus
@@ -75,6 +75,38 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_group_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_group_cond_t *nf_group_cond)
+{
+    if (nf_group_cond == NULL) {
+        ogs_error("OpenAPI_nf_group_cond_writeJSON() failed [NfGroupCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_group_cond_writeJSON() failed [NfGroupCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_typenf_group_cond_ToString(nf_group_cond->nf_type)) == false) {
+        ogs_error("OpenAPI_nf_group_cond_writeJSON() failed [nf_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfGroupId", nf_group_cond->nf_group_id) == false) {
+        ogs_error("OpenAPI_nf_group_cond_writeJSON() failed [nf_group_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_group_cond_writeJSON() failed [NfGroupCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_parseFromJSON(cJSON *nf_group_condJSON)
 {
     OpenAPI_nf_group_cond_t *nf_group_cond_local_var = NULL;
@@ -115,7 +147,6 @@ end:
 OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_copy(OpenAPI_nf_group_cond_t *dst, OpenAPI_nf_group_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_group_cond_convertToJSON(src);
@@ -124,21 +155,6 @@ OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_copy(OpenAPI_nf_group_cond_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_group_cond_free(dst);
     dst = OpenAPI_nf_group_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +36,7 @@ OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_create(
 void OpenAPI_nf_group_cond_free(OpenAPI_nf_group_cond_t *nf_group_cond);
 OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_parseFromJSON(cJSON *nf_group_condJSON);
 cJSON *OpenAPI_nf_group_cond_convertToJSON(OpenAPI_nf_group_cond_t *nf_group_cond);
+bool OpenAPI_nf_group_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_group_cond_t *nf_group_cond);
 OpenAPI_nf_group_cond_t *OpenAPI_nf_group_cond_copy(OpenAPI_nf_group_cond_t *dst, OpenAPI_nf_group_cond_t *src);
 
 #ifdef __cplusplus
@@ -46,6 +46,35 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_info_t *nf_info)
+{
+    if (nf_info == NULL) {
+        ogs_error("OpenAPI_nf_info_writeJSON() failed [NfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_info_writeJSON() failed [NfInfo]");
+        return false;
+    }
+    if (nf_info->nf_type) {
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_type_ToString(nf_info->nf_type)) == false) {
+        ogs_error("OpenAPI_nf_info_writeJSON() failed [nf_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_info_writeJSON() failed [NfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_info_t *OpenAPI_nf_info_parseFromJSON(cJSON *nf_infoJSON)
 {
     OpenAPI_nf_info_t *nf_info_local_var = NULL;
@@ -72,7 +101,6 @@ end:
 OpenAPI_nf_info_t *OpenAPI_nf_info_copy(OpenAPI_nf_info_t *dst, OpenAPI_nf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_info_convertToJSON(src);
@@ -81,21 +109,6 @@ OpenAPI_nf_info_t *OpenAPI_nf_info_copy(OpenAPI_nf_info_t *dst, OpenAPI_nf_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_info_free(dst);
     dst = OpenAPI_nf_info_parseFromJSON(item);
     cJSON_Delete(item);
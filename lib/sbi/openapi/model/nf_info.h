@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_type.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_nf_info_t *OpenAPI_nf_info_create(
 void OpenAPI_nf_info_free(OpenAPI_nf_info_t *nf_info);
 OpenAPI_nf_info_t *OpenAPI_nf_info_parseFromJSON(cJSON *nf_infoJSON);
 cJSON *OpenAPI_nf_info_convertToJSON(OpenAPI_nf_info_t *nf_info);
+bool OpenAPI_nf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_info_t *nf_info);
 OpenAPI_nf_info_t *OpenAPI_nf_info_copy(OpenAPI_nf_info_t *dst, OpenAPI_nf_info_t *src);
 
 #ifdef __cplusplus
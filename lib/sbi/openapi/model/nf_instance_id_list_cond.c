@@ -57,6 +57,45 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_instance_id_list_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_instance_id_list_cond_t *nf_instance_id_list_cond)
+{
+    if (nf_instance_id_list_cond == NULL) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [NfInstanceIdListCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [NfInstanceIdListCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "nfInstanceIdList") == false) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [nf_instance_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_instance_id_list_node;
+    OpenAPI_list_for_each(nf_instance_id_list_cond->nf_instance_id_list, nf_instance_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nf_instance_id_list_node->data) == false) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [nf_instance_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [nf_instance_id_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_instance_id_list_cond_writeJSON() failed [NfInstanceIdListCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_instance_id_list_cond_t *OpenAPI_nf_instance_id_list_cond_parseFromJSON(cJSON *nf_instance_id_list_condJSON)
 {
     OpenAPI_nf_instance_id_list_cond_t *nf_instance_id_list_cond_local_var = NULL;
@@ -94,7 +133,6 @@ end:
 OpenAPI_nf_instance_id_list_cond_t *OpenAPI_nf_instance_id_list_cond_copy(OpenAPI_nf_instance_id_list_cond_t *dst, OpenAPI_nf_instance_id_list_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_instance_id_list_cond_convertToJSON(src);
@@ -103,21 +141,6 @@ OpenAPI_nf_instance_id_list_cond_t *OpenAPI_nf_instance_id_list_cond_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_instance_id_list_cond_free(dst);
     dst = OpenAPI_nf_instance_id_list_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -1360,6 +1360,940 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_profile_t *nf_profile)
+{
+    if (nf_profile == NULL) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [NFProfile]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [NFProfile]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfInstanceId", nf_profile->nf_instance_id) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_instance_id]");
+        goto end;
+    }
+
+    if (nf_profile->nf_instance_name) {
+    if (OpenAPI_json_write_string(writer, "nfInstanceName", nf_profile->nf_instance_name) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_instance_name]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_type_ToString(nf_profile->nf_type)) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfStatus", OpenAPI_nf_status_ToString(nf_profile->nf_status)) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_status]");
+        goto end;
+    }
+
+    if (nf_profile->is_heart_beat_timer) {
+    if (OpenAPI_json_write_number(writer, "heartBeatTimer", nf_profile->heart_beat_timer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [heart_beat_timer]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->plmn_list) {
+    if (OpenAPI_json_write_array_start(writer, "plmnList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [plmn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *plmn_list_node;
+    if (nf_profile->plmn_list) {
+        OpenAPI_list_for_each(nf_profile->plmn_list, plmn_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, plmn_list_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [plmn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [plmn_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->snpn_list) {
+    if (OpenAPI_json_write_array_start(writer, "snpnList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [snpn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snpn_list_node;
+    if (nf_profile->snpn_list) {
+        OpenAPI_list_for_each(nf_profile->snpn_list, snpn_list_node) {
+            if (OpenAPI_plmn_id_nid_writeJSON(writer, NULL, snpn_list_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [snpn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [snpn_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->s_nssais) {
+    if (OpenAPI_json_write_array_start(writer, "sNssais") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [s_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssais_node;
+    if (nf_profile->s_nssais) {
+        OpenAPI_list_for_each(nf_profile->s_nssais, s_nssais_node) {
+            if (OpenAPI_ext_snssai_writeJSON(writer, NULL, s_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [s_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [s_nssais]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->per_plmn_snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "perPlmnSnssaiList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [per_plmn_snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *per_plmn_snssai_list_node;
+    if (nf_profile->per_plmn_snssai_list) {
+        OpenAPI_list_for_each(nf_profile->per_plmn_snssai_list, per_plmn_snssai_list_node) {
+            if (OpenAPI_plmn_snssai_writeJSON(writer, NULL, per_plmn_snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [per_plmn_snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [per_plmn_snssai_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "nsiList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nsi_list_node;
+    OpenAPI_list_for_each(nf_profile->nsi_list, nsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nsi_list_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->fqdn) {
+    if (OpenAPI_json_write_string(writer, "fqdn", nf_profile->fqdn) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [fqdn]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->inter_plmn_fqdn) {
+    if (OpenAPI_json_write_string(writer, "interPlmnFqdn", nf_profile->inter_plmn_fqdn) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [inter_plmn_fqdn]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->ipv4_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4Addresses") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_addresses_node;
+    OpenAPI_list_for_each(nf_profile->ipv4_addresses, ipv4_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_addresses_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->ipv6_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6Addresses") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv6_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_addresses_node;
+    OpenAPI_list_for_each(nf_profile->ipv6_addresses, ipv6_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_addresses_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv6_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ipv6_addresses]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->allowed_plmns) {
+    if (OpenAPI_json_write_array_start(writer, "allowedPlmns") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_plmns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_plmns_node;
+    if (nf_profile->allowed_plmns) {
+        OpenAPI_list_for_each(nf_profile->allowed_plmns, allowed_plmns_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, allowed_plmns_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_plmns]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_plmns]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->allowed_snpns) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSnpns") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_snpns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_snpns_node;
+    if (nf_profile->allowed_snpns) {
+        OpenAPI_list_for_each(nf_profile->allowed_snpns, allowed_snpns_node) {
+            if (OpenAPI_plmn_id_nid_writeJSON(writer, NULL, allowed_snpns_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_snpns]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_snpns]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->allowed_nf_types) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNfTypes") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_nf_types_node;
+    OpenAPI_list_for_each(nf_profile->allowed_nf_types, allowed_nf_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_nf_type_ToString((intptr_t)allowed_nf_types_node->data)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_types]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->allowed_nf_domains) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNfDomains") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nf_domains_node;
+    OpenAPI_list_for_each(nf_profile->allowed_nf_domains, allowed_nf_domains_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)allowed_nf_domains_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->allowed_nssais) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNssais") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nssais_node;
+    if (nf_profile->allowed_nssais) {
+        OpenAPI_list_for_each(nf_profile->allowed_nssais, allowed_nssais_node) {
+            if (OpenAPI_ext_snssai_writeJSON(writer, NULL, allowed_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [allowed_nssais]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_priority) {
+    if (OpenAPI_json_write_number(writer, "priority", nf_profile->priority) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [priority]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_capacity) {
+    if (OpenAPI_json_write_number(writer, "capacity", nf_profile->capacity) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [capacity]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_load) {
+    if (OpenAPI_json_write_number(writer, "load", nf_profile->load) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [load]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->load_time_stamp) {
+    if (OpenAPI_json_write_string(writer, "loadTimeStamp", nf_profile->load_time_stamp) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [load_time_stamp]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->locality) {
+    if (OpenAPI_json_write_string(writer, "locality", nf_profile->locality) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [locality]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udr_info) {
+    if (OpenAPI_udr_info_writeJSON(writer, "udrInfo", nf_profile->udr_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udr_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udr_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "udrInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udr_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *udr_info_list_node;
+    if (nf_profile->udr_info_list) {
+        OpenAPI_list_for_each(nf_profile->udr_info_list, udr_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)udr_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udr_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [udr_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udr_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udm_info) {
+    if (OpenAPI_udm_info_writeJSON(writer, "udmInfo", nf_profile->udm_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udm_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udm_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "udmInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udm_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *udm_info_list_node;
+    if (nf_profile->udm_info_list) {
+        OpenAPI_list_for_each(nf_profile->udm_info_list, udm_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)udm_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udm_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [udm_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udm_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->ausf_info) {
+    if (OpenAPI_ausf_info_writeJSON(writer, "ausfInfo", nf_profile->ausf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ausf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->ausf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "ausfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ausf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ausf_info_list_node;
+    if (nf_profile->ausf_info_list) {
+        OpenAPI_list_for_each(nf_profile->ausf_info_list, ausf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)ausf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_ausf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [ausf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [ausf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->amf_info) {
+    if (OpenAPI_amf_info_writeJSON(writer, "amfInfo", nf_profile->amf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [amf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->amf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "amfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [amf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *amf_info_list_node;
+    if (nf_profile->amf_info_list) {
+        OpenAPI_list_for_each(nf_profile->amf_info_list, amf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)amf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_amf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [amf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [amf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->smf_info) {
+    if (OpenAPI_smf_info_writeJSON(writer, "smfInfo", nf_profile->smf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [smf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->smf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "smfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [smf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *smf_info_list_node;
+    if (nf_profile->smf_info_list) {
+        OpenAPI_list_for_each(nf_profile->smf_info_list, smf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)smf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_smf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [smf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [smf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->upf_info) {
+    if (OpenAPI_upf_info_writeJSON(writer, "upfInfo", nf_profile->upf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [upf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->upf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "upfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [upf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *upf_info_list_node;
+    if (nf_profile->upf_info_list) {
+        OpenAPI_list_for_each(nf_profile->upf_info_list, upf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)upf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_upf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [upf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [upf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->pcf_info) {
+    if (OpenAPI_pcf_info_writeJSON(writer, "pcfInfo", nf_profile->pcf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->pcf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "pcfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pcf_info_list_node;
+    if (nf_profile->pcf_info_list) {
+        OpenAPI_list_for_each(nf_profile->pcf_info_list, pcf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pcf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_pcf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->bsf_info) {
+    if (OpenAPI_bsf_info_writeJSON(writer, "bsfInfo", nf_profile->bsf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [bsf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->bsf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "bsfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [bsf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *bsf_info_list_node;
+    if (nf_profile->bsf_info_list) {
+        OpenAPI_list_for_each(nf_profile->bsf_info_list, bsf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)bsf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_bsf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [bsf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [bsf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->chf_info) {
+    if (OpenAPI_chf_info_writeJSON(writer, "chfInfo", nf_profile->chf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [chf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->chf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "chfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [chf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *chf_info_list_node;
+    if (nf_profile->chf_info_list) {
+        OpenAPI_list_for_each(nf_profile->chf_info_list, chf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)chf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_chf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [chf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [chf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nef_info) {
+    if (OpenAPI_nef_info_writeJSON(writer, "nefInfo", nf_profile->nef_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nef_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nrf_info) {
+    if (OpenAPI_nrf_info_writeJSON(writer, "nrfInfo", nf_profile->nrf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nrf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udsf_info) {
+    if (OpenAPI_udsf_info_writeJSON(writer, "udsfInfo", nf_profile->udsf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udsf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->udsf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "udsfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udsf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *udsf_info_list_node;
+    if (nf_profile->udsf_info_list) {
+        OpenAPI_list_for_each(nf_profile->udsf_info_list, udsf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)udsf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udsf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [udsf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [udsf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nwdaf_info) {
+    if (OpenAPI_nwdaf_info_writeJSON(writer, "nwdafInfo", nf_profile->nwdaf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nwdaf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->pcscf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "pcscfInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcscf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pcscf_info_list_node;
+    if (nf_profile->pcscf_info_list) {
+        OpenAPI_list_for_each(nf_profile->pcscf_info_list, pcscf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pcscf_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_pcscf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcscf_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [pcscf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->hss_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "hssInfoList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [hss_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *hss_info_list_node;
+    if (nf_profile->hss_info_list) {
+        OpenAPI_list_for_each(nf_profile->hss_info_list, hss_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)hss_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_hss_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [hss_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [hss_info_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->custom_info) {
+    if (OpenAPI_object_writeJSON(writer, "customInfo", nf_profile->custom_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [custom_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", nf_profile->recovery_time) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_nf_service_persistence) {
+    if (OpenAPI_json_write_bool(writer, "nfServicePersistence", nf_profile->nf_service_persistence) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_service_persistence]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nf_services) {
+    if (OpenAPI_json_write_array_start(writer, "nfServices") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_services]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_services_node;
+    if (nf_profile->nf_services) {
+        OpenAPI_list_for_each(nf_profile->nf_services, nf_services_node) {
+            if (OpenAPI_nf_service_writeJSON(writer, NULL, nf_services_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_services]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_services]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nf_service_list) {
+    if (OpenAPI_json_write_object_start(writer, "nfServiceList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_service_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *nf_service_list_node;
+    if (nf_profile->nf_service_list) {
+        OpenAPI_list_for_each(nf_profile->nf_service_list, nf_service_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)nf_service_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_nf_service_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_service_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_service_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_nf_profile_changes_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "nfProfileChangesSupportInd", nf_profile->nf_profile_changes_support_ind) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_profile_changes_support_ind]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_nf_profile_changes_ind) {
+    if (OpenAPI_json_write_bool(writer, "nfProfileChangesInd", nf_profile->nf_profile_changes_ind) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_profile_changes_ind]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->default_notification_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "defaultNotificationSubscriptions") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [default_notification_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *default_notification_subscriptions_node;
+    if (nf_profile->default_notification_subscriptions) {
+        OpenAPI_list_for_each(nf_profile->default_notification_subscriptions, default_notification_subscriptions_node) {
+            if (OpenAPI_default_notification_subscription_writeJSON(writer, NULL, default_notification_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_nf_profile_writeJSON() failed [default_notification_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [default_notification_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->lmf_info) {
+    if (OpenAPI_lmf_info_writeJSON(writer, "lmfInfo", nf_profile->lmf_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [lmf_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->gmlc_info) {
+    if (OpenAPI_gmlc_info_writeJSON(writer, "gmlcInfo", nf_profile->gmlc_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [gmlc_info]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nf_set_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "nfSetIdList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_set_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_set_id_list_node;
+    OpenAPI_list_for_each(nf_profile->nf_set_id_list, nf_set_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nf_set_id_list_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_set_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_set_id_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->serving_scope) {
+    if (OpenAPI_json_write_array_start(writer, "servingScope") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *serving_scope_node;
+    OpenAPI_list_for_each(nf_profile->serving_scope, serving_scope_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)serving_scope_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_lc_h_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "lcHSupportInd", nf_profile->lc_h_support_ind) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [lc_h_support_ind]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->is_olc_h_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "olcHSupportInd", nf_profile->olc_h_support_ind) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [olc_h_support_ind]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->nf_set_recovery_time_list) {
+    if (OpenAPI_json_write_object_start(writer, "nfSetRecoveryTimeList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_set_recovery_time_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *nf_set_recovery_time_list_node;
+    if (nf_profile->nf_set_recovery_time_list) {
+        OpenAPI_list_for_each(nf_profile->nf_set_recovery_time_list, nf_set_recovery_time_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)nf_set_recovery_time_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [nf_set_recovery_time_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->service_set_recovery_time_list) {
+    if (OpenAPI_json_write_object_start(writer, "serviceSetRecoveryTimeList") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [service_set_recovery_time_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *service_set_recovery_time_list_node;
+    if (nf_profile->service_set_recovery_time_list) {
+        OpenAPI_list_for_each(nf_profile->service_set_recovery_time_list, service_set_recovery_time_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)service_set_recovery_time_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [service_set_recovery_time_list]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->scp_domains) {
+    if (OpenAPI_json_write_array_start(writer, "scpDomains") == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *scp_domains_node;
+    OpenAPI_list_for_each(nf_profile->scp_domains, scp_domains_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)scp_domains_node->data) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+    }
+
+    if (nf_profile->scp_info) {
+    if (OpenAPI_scp_info_writeJSON(writer, "scpInfo", nf_profile->scp_info) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [scp_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_profile_writeJSON() failed [NFProfile]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_profile_t *OpenAPI_nf_profile_parseFromJSON(cJSON *nf_profileJSON)
 {
     OpenAPI_nf_profile_t *nf_profile_local_var = NULL;
@@ -2536,7 +3470,6 @@ end:
 OpenAPI_nf_profile_t *OpenAPI_nf_profile_copy(OpenAPI_nf_profile_t *dst, OpenAPI_nf_profile_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_profile_convertToJSON(src);
@@ -2545,21 +3478,6 @@ OpenAPI_nf_profile_t *OpenAPI_nf_profile_copy(OpenAPI_nf_profile_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_profile_free(dst);
     dst = OpenAPI_nf_profile_parseFromJSON(item);
     cJSON_Delete(item);
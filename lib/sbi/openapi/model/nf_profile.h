@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_info.h"
 #include "ausf_info.h"
 #include "bsf_info.h"
@@ -205,6 +206,7 @@ OpenAPI_nf_profile_t *OpenAPI_nf_profile_create(
 void OpenAPI_nf_profile_free(OpenAPI_nf_profile_t *nf_profile);
 OpenAPI_nf_profile_t *OpenAPI_nf_profile_parseFromJSON(cJSON *nf_profileJSON);
 cJSON *OpenAPI_nf_profile_convertToJSON(OpenAPI_nf_profile_t *nf_profile);
+bool OpenAPI_nf_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_profile_t *nf_profile);
 OpenAPI_nf_profile_t *OpenAPI_nf_profile_copy(OpenAPI_nf_profile_t *dst, OpenAPI_nf_profile_t *src);
 
 #ifdef __cplusplus
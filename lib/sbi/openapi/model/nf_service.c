@@ -521,6 +521,398 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_service_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_service_t *nf_service)
+{
+    if (nf_service == NULL) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [NFService]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [NFService]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "serviceInstanceId", nf_service->service_instance_id) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [service_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "serviceName", nf_service->service_name) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [service_name]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "versions") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [versions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *versions_node;
+    if (nf_service->versions) {
+        OpenAPI_list_for_each(nf_service->versions, versions_node) {
+            if (OpenAPI_nf_service_version_writeJSON(writer, NULL, versions_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [versions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [versions]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "scheme", OpenAPI_uri_scheme_ToString(nf_service->scheme)) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [scheme]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfServiceStatus", OpenAPI_nf_service_status_ToString(nf_service->nf_service_status)) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [nf_service_status]");
+        goto end;
+    }
+
+    if (nf_service->fqdn) {
+    if (OpenAPI_json_write_string(writer, "fqdn", nf_service->fqdn) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [fqdn]");
+        goto end;
+    }
+    }
+
+    if (nf_service->inter_plmn_fqdn) {
+    if (OpenAPI_json_write_string(writer, "interPlmnFqdn", nf_service->inter_plmn_fqdn) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [inter_plmn_fqdn]");
+        goto end;
+    }
+    }
+
+    if (nf_service->ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "ipEndPoints") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ip_end_points_node;
+    if (nf_service->ip_end_points) {
+        OpenAPI_list_for_each(nf_service->ip_end_points, ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (nf_service->api_prefix) {
+    if (OpenAPI_json_write_string(writer, "apiPrefix", nf_service->api_prefix) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [api_prefix]");
+        goto end;
+    }
+    }
+
+    if (nf_service->default_notification_subscriptions) {
+    if (OpenAPI_json_write_array_start(writer, "defaultNotificationSubscriptions") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [default_notification_subscriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *default_notification_subscriptions_node;
+    if (nf_service->default_notification_subscriptions) {
+        OpenAPI_list_for_each(nf_service->default_notification_subscriptions, default_notification_subscriptions_node) {
+            if (OpenAPI_default_notification_subscription_writeJSON(writer, NULL, default_notification_subscriptions_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [default_notification_subscriptions]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [default_notification_subscriptions]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_plmns) {
+    if (OpenAPI_json_write_array_start(writer, "allowedPlmns") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_plmns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_plmns_node;
+    if (nf_service->allowed_plmns) {
+        OpenAPI_list_for_each(nf_service->allowed_plmns, allowed_plmns_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, allowed_plmns_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_plmns]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_plmns]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_snpns) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSnpns") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_snpns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_snpns_node;
+    if (nf_service->allowed_snpns) {
+        OpenAPI_list_for_each(nf_service->allowed_snpns, allowed_snpns_node) {
+            if (OpenAPI_plmn_id_nid_writeJSON(writer, NULL, allowed_snpns_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_snpns]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_snpns]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_nf_types) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNfTypes") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_nf_types_node;
+    OpenAPI_list_for_each(nf_service->allowed_nf_types, allowed_nf_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_nf_type_ToString((intptr_t)allowed_nf_types_node->data)) == false) {
+            ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_types]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_nf_domains) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNfDomains") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nf_domains_node;
+    OpenAPI_list_for_each(nf_service->allowed_nf_domains, allowed_nf_domains_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)allowed_nf_domains_node->data) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nf_domains]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_nssais) {
+    if (OpenAPI_json_write_array_start(writer, "allowedNssais") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_nssais_node;
+    if (nf_service->allowed_nssais) {
+        OpenAPI_list_for_each(nf_service->allowed_nssais, allowed_nssais_node) {
+            if (OpenAPI_ext_snssai_writeJSON(writer, NULL, allowed_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_nssais]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_operations_per_nf_type) {
+    if (OpenAPI_json_write_object_start(writer, "allowedOperationsPerNfType") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_operations_per_nf_type]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_operations_per_nf_type_node;
+    if (nf_service->allowed_operations_per_nf_type) {
+        OpenAPI_list_for_each(nf_service->allowed_operations_per_nf_type, allowed_operations_per_nf_type_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)allowed_operations_per_nf_type_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_operations_per_nf_type]");
+        goto end;
+    }
+    }
+
+    if (nf_service->allowed_operations_per_nf_instance) {
+    if (OpenAPI_json_write_object_start(writer, "allowedOperationsPerNfInstance") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_operations_per_nf_instance]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_operations_per_nf_instance_node;
+    if (nf_service->allowed_operations_per_nf_instance) {
+        OpenAPI_list_for_each(nf_service->allowed_operations_per_nf_instance, allowed_operations_per_nf_instance_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)allowed_operations_per_nf_instance_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [allowed_operations_per_nf_instance]");
+        goto end;
+    }
+    }
+
+    if (nf_service->is_priority) {
+    if (OpenAPI_json_write_number(writer, "priority", nf_service->priority) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [priority]");
+        goto end;
+    }
+    }
+
+    if (nf_service->is_capacity) {
+    if (OpenAPI_json_write_number(writer, "capacity", nf_service->capacity) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [capacity]");
+        goto end;
+    }
+    }
+
+    if (nf_service->is_load) {
+    if (OpenAPI_json_write_number(writer, "load", nf_service->load) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [load]");
+        goto end;
+    }
+    }
+
+    if (nf_service->load_time_stamp) {
+    if (OpenAPI_json_write_string(writer, "loadTimeStamp", nf_service->load_time_stamp) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [load_time_stamp]");
+        goto end;
+    }
+    }
+
+    if (nf_service->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", nf_service->recovery_time) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (nf_service->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", nf_service->supported_features) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (nf_service->nf_service_set_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "nfServiceSetIdList") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [nf_service_set_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_service_set_id_list_node;
+    OpenAPI_list_for_each(nf_service->nf_service_set_id_list, nf_service_set_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nf_service_set_id_list_node->data) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [nf_service_set_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [nf_service_set_id_list]");
+        goto end;
+    }
+    }
+
+    if (nf_service->s_nssais) {
+    if (OpenAPI_json_write_array_start(writer, "sNssais") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [s_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssais_node;
+    if (nf_service->s_nssais) {
+        OpenAPI_list_for_each(nf_service->s_nssais, s_nssais_node) {
+            if (OpenAPI_ext_snssai_writeJSON(writer, NULL, s_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [s_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [s_nssais]");
+        goto end;
+    }
+    }
+
+    if (nf_service->per_plmn_snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "perPlmnSnssaiList") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [per_plmn_snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *per_plmn_snssai_list_node;
+    if (nf_service->per_plmn_snssai_list) {
+        OpenAPI_list_for_each(nf_service->per_plmn_snssai_list, per_plmn_snssai_list_node) {
+            if (OpenAPI_plmn_snssai_writeJSON(writer, NULL, per_plmn_snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_nf_service_writeJSON() failed [per_plmn_snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [per_plmn_snssai_list]");
+        goto end;
+    }
+    }
+
+    if (nf_service->vendor_id) {
+    if (OpenAPI_json_write_string(writer, "vendorId", nf_service->vendor_id) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [vendor_id]");
+        goto end;
+    }
+    }
+
+    if (nf_service->supported_vendor_specific_features) {
+    if (OpenAPI_json_write_object_start(writer, "supportedVendorSpecificFeatures") == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [supported_vendor_specific_features]");
+        goto end;
+    }
+    OpenAPI_lnode_t *supported_vendor_specific_features_node;
+    if (nf_service->supported_vendor_specific_features) {
+        OpenAPI_list_for_each(nf_service->supported_vendor_specific_features, supported_vendor_specific_features_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)supported_vendor_specific_features_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [supported_vendor_specific_features]");
+        goto end;
+    }
+    }
+
+    if (nf_service->is_oauth2_required) {
+    if (OpenAPI_json_write_bool(writer, "oauth2Required", nf_service->oauth2_required) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [oauth2_required]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_writeJSON() failed [NFService]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_service_t *OpenAPI_nf_service_parseFromJSON(cJSON *nf_serviceJSON)
 {
     OpenAPI_nf_service_t *nf_service_local_var = NULL;
@@ -1062,7 +1454,6 @@ end:
 OpenAPI_nf_service_t *OpenAPI_nf_service_copy(OpenAPI_nf_service_t *dst, OpenAPI_nf_service_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_service_convertToJSON(src);
@@ -1071,21 +1462,6 @@ OpenAPI_nf_service_t *OpenAPI_nf_service_copy(OpenAPI_nf_service_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_service_free(dst);
     dst = OpenAPI_nf_service_parseFromJSON(item);
     cJSON_Delete(item);
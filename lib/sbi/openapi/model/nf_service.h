@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "default_notification_subscription.h"
 #include "ext_snssai.h"
 #include "ip_end_point.h"
@@ -103,6 +104,7 @@ OpenAPI_nf_service_t *OpenAPI_nf_service_create(
 void OpenAPI_nf_service_free(OpenAPI_nf_service_t *nf_service);
 OpenAPI_nf_service_t *OpenAPI_nf_service_parseFromJSON(cJSON *nf_serviceJSON);
 cJSON *OpenAPI_nf_service_convertToJSON(OpenAPI_nf_service_t *nf_service);
+bool OpenAPI_nf_service_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_service_t *nf_service);
 OpenAPI_nf_service_t *OpenAPI_nf_service_copy(OpenAPI_nf_service_t *dst, OpenAPI_nf_service_t *src);
 
 #ifdef __cplusplus
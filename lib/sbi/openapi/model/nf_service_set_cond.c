@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_service_set_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_service_set_cond_t *nf_service_set_cond)
+{
+    if (nf_service_set_cond == NULL) {
+        ogs_error("OpenAPI_nf_service_set_cond_writeJSON() failed [NfServiceSetCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_service_set_cond_writeJSON() failed [NfServiceSetCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfServiceSetId", nf_service_set_cond->nf_service_set_id) == false) {
+        ogs_error("OpenAPI_nf_service_set_cond_writeJSON() failed [nf_service_set_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_set_cond_writeJSON() failed [NfServiceSetCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_service_set_cond_t *OpenAPI_nf_service_set_cond_parseFromJSON(cJSON *nf_service_set_condJSON)
 {
     OpenAPI_nf_service_set_cond_t *nf_service_set_cond_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_nf_service_set_cond_t *OpenAPI_nf_service_set_cond_copy(OpenAPI_nf_service_set_cond_t *dst, OpenAPI_nf_service_set_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_service_set_cond_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_nf_service_set_cond_t *OpenAPI_nf_service_set_cond_copy(OpenAPI_nf_servi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_service_set_cond_free(dst);
     dst = OpenAPI_nf_service_set_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -63,6 +63,45 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_service_version_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_service_version_t *nf_service_version)
+{
+    if (nf_service_version == NULL) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [NFServiceVersion]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [NFServiceVersion]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "apiVersionInUri", nf_service_version->api_version_in_uri) == false) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [api_version_in_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "apiFullVersion", nf_service_version->api_full_version) == false) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [api_full_version]");
+        goto end;
+    }
+
+    if (nf_service_version->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", nf_service_version->expiry) == false) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_service_version_writeJSON() failed [NFServiceVersion]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_parseFromJSON(cJSON *nf_service_versionJSON)
 {
     OpenAPI_nf_service_version_t *nf_service_version_local_var = NULL;
@@ -111,7 +150,6 @@ end:
 OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_copy(OpenAPI_nf_service_version_t *dst, OpenAPI_nf_service_version_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_service_version_convertToJSON(src);
@@ -120,21 +158,6 @@ OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_copy(OpenAPI_nf_service
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_service_version_free(dst);
     dst = OpenAPI_nf_service_version_parseFromJSON(item);
     cJSON_Delete(item);
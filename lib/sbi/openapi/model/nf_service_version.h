@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_create(
 void OpenAPI_nf_service_version_free(OpenAPI_nf_service_version_t *nf_service_version);
 OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_parseFromJSON(cJSON *nf_service_versionJSON);
 cJSON *OpenAPI_nf_service_version_convertToJSON(OpenAPI_nf_service_version_t *nf_service_version);
+bool OpenAPI_nf_service_version_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_service_version_t *nf_service_version);
 OpenAPI_nf_service_version_t *OpenAPI_nf_service_version_copy(OpenAPI_nf_service_version_t *dst, OpenAPI_nf_service_version_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_nf_set_cond_t *OpenAPI_nf_set_cond_create(
 void OpenAPI_nf_set_cond_free(OpenAPI_nf_set_cond_t *nf_set_cond);
 OpenAPI_nf_set_cond_t *OpenAPI_nf_set_cond_parseFromJSON(cJSON *nf_set_condJSON);
 cJSON *OpenAPI_nf_set_cond_convertToJSON(OpenAPI_nf_set_cond_t *nf_set_cond);
+bool OpenAPI_nf_set_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_set_cond_t *nf_set_cond);
 OpenAPI_nf_set_cond_t *OpenAPI_nf_set_cond_copy(OpenAPI_nf_set_cond_t *dst, OpenAPI_nf_set_cond_t *src);
 
 #ifdef __cplusplus
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_nf_type_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_type_cond_t *nf_type_cond)
+{
+    if (nf_type_cond == NULL) {
+        ogs_error("OpenAPI_nf_type_cond_writeJSON() failed [NfTypeCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nf_type_cond_writeJSON() failed [NfTypeCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_type_ToString(nf_type_cond->nf_type)) == false) {
+        ogs_error("OpenAPI_nf_type_cond_writeJSON() failed [nf_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nf_type_cond_writeJSON() failed [NfTypeCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_parseFromJSON(cJSON *nf_type_condJSON)
 {
     OpenAPI_nf_type_cond_t *nf_type_cond_local_var = NULL;
@@ -72,7 +99,6 @@ end:
 OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_copy(OpenAPI_nf_type_cond_t *dst, OpenAPI_nf_type_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nf_type_cond_convertToJSON(src);
@@ -81,21 +107,6 @@ OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_copy(OpenAPI_nf_type_cond_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nf_type_cond_free(dst);
     dst = OpenAPI_nf_type_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_type.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_create(
 void OpenAPI_nf_type_cond_free(OpenAPI_nf_type_cond_t *nf_type_cond);
 OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_parseFromJSON(cJSON *nf_type_condJSON);
 cJSON *OpenAPI_nf_type_cond_convertToJSON(OpenAPI_nf_type_cond_t *nf_type_cond);
+bool OpenAPI_nf_type_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nf_type_cond_t *nf_type_cond);
 OpenAPI_nf_type_cond_t *OpenAPI_nf_type_cond_copy(OpenAPI_nf_type_cond_t *dst, OpenAPI_nf_type_cond_t *src);
 
 #ifdef __cplusplus
@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ng_ap_cause_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ng_ap_cause_t *ng_ap_cause)
+{
+    if (ng_ap_cause == NULL) {
+        ogs_error("OpenAPI_ng_ap_cause_writeJSON() failed [NgApCause]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ng_ap_cause_writeJSON() failed [NgApCause]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "group", ng_ap_cause->group) == false) {
+        ogs_error("OpenAPI_ng_ap_cause_writeJSON() failed [group]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "value", ng_ap_cause->value) == false) {
+        ogs_error("OpenAPI_ng_ap_cause_writeJSON() failed [value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ng_ap_cause_writeJSON() failed [NgApCause]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ng_ap_cause_t *OpenAPI_ng_ap_cause_parseFromJSON(cJSON *ng_ap_causeJSON)
 {
     OpenAPI_ng_ap_cause_t *ng_ap_cause_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_ng_ap_cause_t *OpenAPI_ng_ap_cause_copy(OpenAPI_ng_ap_cause_t *dst, OpenAPI_ng_ap_cause_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ng_ap_cause_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_ng_ap_cause_t *OpenAPI_ng_ap_cause_copy(OpenAPI_ng_ap_cause_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ng_ap_cause_free(dst);
     dst = OpenAPI_ng_ap_cause_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ng_ksi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ng_ksi_t *ng_ksi)
+{
+    if (ng_ksi == NULL) {
+        ogs_error("OpenAPI_ng_ksi_writeJSON() failed [NgKsi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ng_ksi_writeJSON() failed [NgKsi]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "tsc", OpenAPI_sc_type_ToString(ng_ksi->tsc)) == false) {
+        ogs_error("OpenAPI_ng_ksi_writeJSON() failed [tsc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "ksi", ng_ksi->ksi) == false) {
+        ogs_error("OpenAPI_ng_ksi_writeJSON() failed [ksi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ng_ksi_writeJSON() failed [NgKsi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_parseFromJSON(cJSON *ng_ksiJSON)
 {
     OpenAPI_ng_ksi_t *ng_ksi_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_copy(OpenAPI_ng_ksi_t *dst, OpenAPI_ng_ksi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ng_ksi_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_copy(OpenAPI_ng_ksi_t *dst, OpenAPI_ng_ksi_t *s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ng_ksi_free(dst);
     dst = OpenAPI_ng_ksi_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sc_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_create(
 void OpenAPI_ng_ksi_free(OpenAPI_ng_ksi_t *ng_ksi);
 OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_parseFromJSON(cJSON *ng_ksiJSON);
 cJSON *OpenAPI_ng_ksi_convertToJSON(OpenAPI_ng_ksi_t *ng_ksi);
+bool OpenAPI_ng_ksi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ng_ksi_t *ng_ksi);
 OpenAPI_ng_ksi_t *OpenAPI_ng_ksi_copy(OpenAPI_ng_ksi_t *dst, OpenAPI_ng_ksi_t *src);
 
 #ifdef __cplusplus
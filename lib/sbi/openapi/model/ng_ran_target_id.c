@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ng_ran_target_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ng_ran_target_id_t *ng_ran_target_id)
+{
+    if (ng_ran_target_id == NULL) {
+        ogs_error("OpenAPI_ng_ran_target_id_writeJSON() failed [NgRanTargetId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ng_ran_target_id_writeJSON() failed [NgRanTargetId]");
+        return false;
+    }
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "ranNodeId", ng_ran_target_id->ran_node_id) == false) {
+        ogs_error("OpenAPI_ng_ran_target_id_writeJSON() failed [ran_node_id]");
+        goto end;
+    }
+
+    if (OpenAPI_tai_writeJSON(writer, "tai", ng_ran_target_id->tai) == false) {
+        ogs_error("OpenAPI_ng_ran_target_id_writeJSON() failed [tai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ng_ran_target_id_writeJSON() failed [NgRanTargetId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_parseFromJSON(cJSON *ng_ran_target_idJSON)
 {
     OpenAPI_ng_ran_target_id_t *ng_ran_target_id_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_copy(OpenAPI_ng_ran_target_id_t *dst, OpenAPI_ng_ran_target_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ng_ran_target_id_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_copy(OpenAPI_ng_ran_target_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ng_ran_target_id_free(dst);
     dst = OpenAPI_ng_ran_target_id_parseFromJSON(item);
     cJSON_Delete(item);
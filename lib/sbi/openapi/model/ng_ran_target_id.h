@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "global_ran_node_id.h"
 #include "tai.h"
 
@@ -32,6 +33,7 @@ OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_create(
 void OpenAPI_ng_ran_target_id_free(OpenAPI_ng_ran_target_id_t *ng_ran_target_id);
 OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_parseFromJSON(cJSON *ng_ran_target_idJSON);
 cJSON *OpenAPI_ng_ran_target_id_convertToJSON(OpenAPI_ng_ran_target_id_t *ng_ran_target_id);
+bool OpenAPI_ng_ran_target_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ng_ran_target_id_t *ng_ran_target_id);
 OpenAPI_ng_ran_target_id_t *OpenAPI_ng_ran_target_id_copy(OpenAPI_ng_ran_target_id_t *dst, OpenAPI_ng_ran_target_id_t *src);
 
 #ifdef __cplusplus
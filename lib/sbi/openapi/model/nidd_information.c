@@ -65,6 +65,47 @@ end:
     return item;
 }
 
+bool OpenAPI_nidd_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nidd_information_t *nidd_information)
+{
+    if (nidd_information == NULL) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [NiddInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [NiddInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "afId", nidd_information->af_id) == false) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [af_id]");
+        goto end;
+    }
+
+    if (nidd_information->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", nidd_information->gpsi) == false) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (nidd_information->ext_group_id) {
+    if (OpenAPI_json_write_string(writer, "extGroupId", nidd_information->ext_group_id) == false) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [ext_group_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nidd_information_writeJSON() failed [NiddInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nidd_information_t *OpenAPI_nidd_information_parseFromJSON(cJSON *nidd_informationJSON)
 {
     OpenAPI_nidd_information_t *nidd_information_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_nidd_information_t *OpenAPI_nidd_information_copy(OpenAPI_nidd_information_t *dst, OpenAPI_nidd_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nidd_information_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_nidd_information_t *OpenAPI_nidd_information_copy(OpenAPI_nidd_informati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nidd_information_free(dst);
     dst = OpenAPI_nidd_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_nidd_information_t *OpenAPI_nidd_information_create(
 void OpenAPI_nidd_information_free(OpenAPI_nidd_information_t *nidd_information);
 OpenAPI_nidd_information_t *OpenAPI_nidd_information_parseFromJSON(cJSON *nidd_informationJSON);
 cJSON *OpenAPI_nidd_information_convertToJSON(OpenAPI_nidd_information_t *nidd_information);
+bool OpenAPI_nidd_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nidd_information_t *nidd_information);
 OpenAPI_nidd_information_t *OpenAPI_nidd_information_copy(OpenAPI_nidd_information_t *dst, OpenAPI_nidd_information_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,47 @@ end:
     return item;
 }
 
+bool OpenAPI_nidd_information_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nidd_information_1_t *nidd_information_1)
+{
+    if (nidd_information_1 == NULL) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [NiddInformation_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [NiddInformation_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "afId", nidd_information_1->af_id) == false) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [af_id]");
+        goto end;
+    }
+
+    if (nidd_information_1->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", nidd_information_1->gpsi) == false) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (nidd_information_1->ext_group_id) {
+    if (OpenAPI_json_write_string(writer, "extGroupId", nidd_information_1->ext_group_id) == false) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [ext_group_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nidd_information_1_writeJSON() failed [NiddInformation_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_parseFromJSON(cJSON *nidd_information_1JSON)
 {
     OpenAPI_nidd_information_1_t *nidd_information_1_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_copy(OpenAPI_nidd_information_1_t *dst, OpenAPI_nidd_information_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nidd_information_1_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_copy(OpenAPI_nidd_infor
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nidd_information_1_free(dst);
     dst = OpenAPI_nidd_information_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_create(
 void OpenAPI_nidd_information_1_free(OpenAPI_nidd_information_1_t *nidd_information_1);
 OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_parseFromJSON(cJSON *nidd_information_1JSON);
 cJSON *OpenAPI_nidd_information_1_convertToJSON(OpenAPI_nidd_information_1_t *nidd_information_1);
+bool OpenAPI_nidd_information_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nidd_information_1_t *nidd_information_1);
 OpenAPI_nidd_information_1_t *OpenAPI_nidd_information_1_copy(OpenAPI_nidd_information_1_t *dst, OpenAPI_nidd_information_1_t *src);
 
 #ifdef __cplusplus
@@ -103,6 +103,70 @@ end:
     return item;
 }
 
+bool OpenAPI_non_dynamic5_qi_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_non_dynamic5_qi_t *non_dynamic5_qi)
+{
+    if (non_dynamic5_qi == NULL) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [NonDynamic5Qi]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [NonDynamic5Qi]");
+        return false;
+    }
+    if (non_dynamic5_qi->is_priority_level) {
+    if (OpenAPI_json_write_number(writer, "priorityLevel", non_dynamic5_qi->priority_level) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [priority_level]");
+        goto end;
+    }
+    }
+
+    if (non_dynamic5_qi->is_aver_window) {
+    if (OpenAPI_json_write_number(writer, "averWindow", non_dynamic5_qi->aver_window) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [aver_window]");
+        goto end;
+    }
+    }
+
+    if (non_dynamic5_qi->is_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "maxDataBurstVol", non_dynamic5_qi->max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (non_dynamic5_qi->is_ext_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "extMaxDataBurstVol", non_dynamic5_qi->ext_max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [ext_max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (non_dynamic5_qi->is_cn_packet_delay_budget_dl) {
+    if (OpenAPI_json_write_number(writer, "cnPacketDelayBudgetDl", non_dynamic5_qi->cn_packet_delay_budget_dl) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [cn_packet_delay_budget_dl]");
+        goto end;
+    }
+    }
+
+    if (non_dynamic5_qi->is_cn_packet_delay_budget_ul) {
+    if (OpenAPI_json_write_number(writer, "cnPacketDelayBudgetUl", non_dynamic5_qi->cn_packet_delay_budget_ul) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [cn_packet_delay_budget_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_non_dynamic5_qi_writeJSON() failed [NonDynamic5Qi]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_non_dynamic5_qi_t *OpenAPI_non_dynamic5_qi_parseFromJSON(cJSON *non_dynamic5_qiJSON)
 {
     OpenAPI_non_dynamic5_qi_t *non_dynamic5_qi_local_var = NULL;
@@ -183,7 +247,6 @@ end:
 OpenAPI_non_dynamic5_qi_t *OpenAPI_non_dynamic5_qi_copy(OpenAPI_non_dynamic5_qi_t *dst, OpenAPI_non_dynamic5_qi_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_non_dynamic5_qi_convertToJSON(src);
@@ -192,21 +255,6 @@ OpenAPI_non_dynamic5_qi_t *OpenAPI_non_dynamic5_qi_copy(OpenAPI_non_dynamic5_qi_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_non_dynamic5_qi_free(dst);
     dst = OpenAPI_non_dynamic5_qi_parseFromJSON(item);
     cJSON_Delete(item);
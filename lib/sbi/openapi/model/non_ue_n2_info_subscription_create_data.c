@@ -116,6 +116,91 @@ end:
     return item;
 }
 
+bool OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_non_ue_n2_info_subscription_create_data_t *non_ue_n2_info_subscription_create_data)
+{
+    if (non_ue_n2_info_subscription_create_data == NULL) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [NonUeN2InfoSubscriptionCreateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [NonUeN2InfoSubscriptionCreateData]");
+        return false;
+    }
+    if (non_ue_n2_info_subscription_create_data->global_ran_node_list) {
+    if (OpenAPI_json_write_array_start(writer, "globalRanNodeList") == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [global_ran_node_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *global_ran_node_list_node;
+    if (non_ue_n2_info_subscription_create_data->global_ran_node_list) {
+        OpenAPI_list_for_each(non_ue_n2_info_subscription_create_data->global_ran_node_list, global_ran_node_list_node) {
+            if (OpenAPI_global_ran_node_id_writeJSON(writer, NULL, global_ran_node_list_node->data) == false) {
+                ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [global_ran_node_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [global_ran_node_list]");
+        goto end;
+    }
+    }
+
+    if (non_ue_n2_info_subscription_create_data->an_type_list) {
+    if (OpenAPI_json_write_array_start(writer, "anTypeList") == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [an_type_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *an_type_list_node;
+    OpenAPI_list_for_each(non_ue_n2_info_subscription_create_data->an_type_list, an_type_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)an_type_list_node->data)) == false) {
+            ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [an_type_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [an_type_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "n2InformationClass", OpenAPI_n2_information_class_ToString(non_ue_n2_info_subscription_create_data->n2_information_class)) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [n2_information_class]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "n2NotifyCallbackUri", non_ue_n2_info_subscription_create_data->n2_notify_callback_uri) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [n2_notify_callback_uri]");
+        goto end;
+    }
+
+    if (non_ue_n2_info_subscription_create_data->nf_id) {
+    if (OpenAPI_json_write_string(writer, "nfId", non_ue_n2_info_subscription_create_data->nf_id) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [nf_id]");
+        goto end;
+    }
+    }
+
+    if (non_ue_n2_info_subscription_create_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", non_ue_n2_info_subscription_create_data->supported_features) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_create_data_writeJSON() failed [NonUeN2InfoSubscriptionCreateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_non_ue_n2_info_subscription_create_data_t *OpenAPI_non_ue_n2_info_subscription_create_data_parseFromJSON(cJSON *non_ue_n2_info_subscription_create_dataJSON)
 {
     OpenAPI_non_ue_n2_info_subscription_create_data_t *non_ue_n2_info_subscription_create_data_local_var = NULL;
@@ -229,7 +314,6 @@ end:
 OpenAPI_non_ue_n2_info_subscription_create_data_t *OpenAPI_non_ue_n2_info_subscription_create_data_copy(OpenAPI_non_ue_n2_info_subscription_create_data_t *dst, OpenAPI_non_ue_n2_info_subscription_create_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_non_ue_n2_info_subscription_create_data_convertToJSON(src);
@@ -238,21 +322,6 @@ OpenAPI_non_ue_n2_info_subscription_create_data_t *OpenAPI_non_ue_n2_info_subscr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_non_ue_n2_info_subscription_create_data_free(dst);
     dst = OpenAPI_non_ue_n2_info_subscription_create_data_parseFromJSON(item);
     cJSON_Delete(item);
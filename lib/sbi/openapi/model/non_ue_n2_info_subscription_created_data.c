@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_non_ue_n2_info_subscription_created_data_t *non_ue_n2_info_subscription_created_data)
+{
+    if (non_ue_n2_info_subscription_created_data == NULL) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [NonUeN2InfoSubscriptionCreatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [NonUeN2InfoSubscriptionCreatedData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n2NotifySubscriptionId", non_ue_n2_info_subscription_created_data->n2_notify_subscription_id) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [n2_notify_subscription_id]");
+        goto end;
+    }
+
+    if (non_ue_n2_info_subscription_created_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", non_ue_n2_info_subscription_created_data->supported_features) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (non_ue_n2_info_subscription_created_data->n2_information_class) {
+    if (OpenAPI_json_write_string(writer, "n2InformationClass", OpenAPI_n2_information_class_ToString(non_ue_n2_info_subscription_created_data->n2_information_class)) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [n2_information_class]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_non_ue_n2_info_subscription_created_data_writeJSON() failed [NonUeN2InfoSubscriptionCreatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_non_ue_n2_info_subscription_created_data_t *OpenAPI_non_ue_n2_info_subscription_created_data_parseFromJSON(cJSON *non_ue_n2_info_subscription_created_dataJSON)
 {
     OpenAPI_non_ue_n2_info_subscription_created_data_t *non_ue_n2_info_subscription_created_data_local_var = NULL;
@@ -112,7 +153,6 @@ end:
 OpenAPI_non_ue_n2_info_subscription_created_data_t *OpenAPI_non_ue_n2_info_subscription_created_data_copy(OpenAPI_non_ue_n2_info_subscription_created_data_t *dst, OpenAPI_non_ue_n2_info_subscription_created_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_non_ue_n2_info_subscription_created_data_convertToJSON(src);
@@ -121,21 +161,6 @@ OpenAPI_non_ue_n2_info_subscription_created_data_t *OpenAPI_non_ue_n2_info_subsc
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_non_ue_n2_info_subscription_created_data_free(dst);
     dst = OpenAPI_non_ue_n2_info_subscription_created_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -81,6 +81,66 @@ end:
     return item;
 }
 
+bool OpenAPI_notif_condition_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notif_condition_t *notif_condition)
+{
+    if (notif_condition == NULL) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [NotifCondition]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [NotifCondition]");
+        return false;
+    }
+    if (notif_condition->monitored_attributes) {
+    if (OpenAPI_json_write_array_start(writer, "monitoredAttributes") == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [monitored_attributes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_attributes_node;
+    OpenAPI_list_for_each(notif_condition->monitored_attributes, monitored_attributes_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_attributes_node->data) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [monitored_attributes]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [monitored_attributes]");
+        goto end;
+    }
+    }
+
+    if (notif_condition->unmonitored_attributes) {
+    if (OpenAPI_json_write_array_start(writer, "unmonitoredAttributes") == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [unmonitored_attributes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *unmonitored_attributes_node;
+    OpenAPI_list_for_each(notif_condition->unmonitored_attributes, unmonitored_attributes_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)unmonitored_attributes_node->data) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [unmonitored_attributes]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [unmonitored_attributes]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_notif_condition_writeJSON() failed [NotifCondition]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_notif_condition_t *OpenAPI_notif_condition_parseFromJSON(cJSON *notif_conditionJSON)
 {
     OpenAPI_notif_condition_t *notif_condition_local_var = NULL;
@@ -137,7 +197,6 @@ end:
 OpenAPI_notif_condition_t *OpenAPI_notif_condition_copy(OpenAPI_notif_condition_t *dst, OpenAPI_notif_condition_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notif_condition_convertToJSON(src);
@@ -146,21 +205,6 @@ OpenAPI_notif_condition_t *OpenAPI_notif_condition_copy(OpenAPI_notif_condition_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notif_condition_free(dst);
     dst = OpenAPI_notif_condition_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_notif_condition_t *OpenAPI_notif_condition_create(
 void OpenAPI_notif_condition_free(OpenAPI_notif_condition_t *notif_condition);
 OpenAPI_notif_condition_t *OpenAPI_notif_condition_parseFromJSON(cJSON *notif_conditionJSON);
 cJSON *OpenAPI_notif_condition_convertToJSON(OpenAPI_notif_condition_t *notif_condition);
+bool OpenAPI_notif_condition_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notif_condition_t *notif_condition);
 OpenAPI_notif_condition_t *OpenAPI_notif_condition_copy(OpenAPI_notif_condition_t *dst, OpenAPI_notif_condition_t *src);
 
 #ifdef __cplusplus
@@ -103,6 +103,73 @@ end:
     return item;
 }
 
+bool OpenAPI_notification_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notification_data_t *notification_data)
+{
+    if (notification_data == NULL) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [NotificationData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [NotificationData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "event", OpenAPI_notification_event_type_ToString(notification_data->event)) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [event]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "nfInstanceUri", notification_data->nf_instance_uri) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [nf_instance_uri]");
+        goto end;
+    }
+
+    if (notification_data->nf_profile) {
+    if (OpenAPI_nf_profile_writeJSON(writer, "nfProfile", notification_data->nf_profile) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [nf_profile]");
+        goto end;
+    }
+    }
+
+    if (notification_data->profile_changes) {
+    if (OpenAPI_json_write_array_start(writer, "profileChanges") == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [profile_changes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *profile_changes_node;
+    if (notification_data->profile_changes) {
+        OpenAPI_list_for_each(notification_data->profile_changes, profile_changes_node) {
+            if (OpenAPI_change_item_writeJSON(writer, NULL, profile_changes_node->data) == false) {
+                ogs_error("OpenAPI_notification_data_writeJSON() failed [profile_changes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [profile_changes]");
+        goto end;
+    }
+    }
+
+    if (notification_data->condition_event) {
+    if (OpenAPI_json_write_string(writer, "conditionEvent", OpenAPI_condition_event_type_ToString(notification_data->condition_event)) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [condition_event]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_notification_data_writeJSON() failed [NotificationData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_notification_data_t *OpenAPI_notification_data_parseFromJSON(cJSON *notification_dataJSON)
 {
     OpenAPI_notification_data_t *notification_data_local_var = NULL;
@@ -193,7 +260,6 @@ end:
 OpenAPI_notification_data_t *OpenAPI_notification_data_copy(OpenAPI_notification_data_t *dst, OpenAPI_notification_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notification_data_convertToJSON(src);
@@ -202,21 +268,6 @@ OpenAPI_notification_data_t *OpenAPI_notification_data_copy(OpenAPI_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notification_data_free(dst);
     dst = OpenAPI_notification_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "change_item.h"
 #include "condition_event_type.h"
 #include "nf_profile.h"
@@ -40,6 +41,7 @@ OpenAPI_notification_data_t *OpenAPI_notification_data_create(
 void OpenAPI_notification_data_free(OpenAPI_notification_data_t *notification_data);
 OpenAPI_notification_data_t *OpenAPI_notification_data_parseFromJSON(cJSON *notification_dataJSON);
 cJSON *OpenAPI_notification_data_convertToJSON(OpenAPI_notification_data_t *notification_data);
+bool OpenAPI_notification_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notification_data_t *notification_data);
 OpenAPI_notification_data_t *OpenAPI_notification_data_copy(OpenAPI_notification_data_t *dst, OpenAPI_notification_data_t *src);
 
 #ifdef __cplusplus
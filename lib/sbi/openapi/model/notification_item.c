@@ -69,6 +69,52 @@ end:
     return item;
 }
 
+bool OpenAPI_notification_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notification_item_t *notification_item)
+{
+    if (notification_item == NULL) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [NotificationItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [NotificationItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceId", notification_item->resource_id) == false) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [resource_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "notifItems") == false) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [notif_items]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *notif_items_node;
+    if (notification_item->notif_items) {
+        OpenAPI_list_for_each(notification_item->notif_items, notif_items_node) {
+            if (OpenAPI_updated_item_writeJSON(writer, NULL, notif_items_node->data) == false) {
+                ogs_error("OpenAPI_notification_item_writeJSON() failed [notif_items]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [notif_items]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_notification_item_writeJSON() failed [NotificationItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_notification_item_t *OpenAPI_notification_item_parseFromJSON(cJSON *notification_itemJSON)
 {
     OpenAPI_notification_item_t *notification_item_local_var = NULL;
@@ -127,7 +173,6 @@ end:
 OpenAPI_notification_item_t *OpenAPI_notification_item_copy(OpenAPI_notification_item_t *dst, OpenAPI_notification_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notification_item_convertToJSON(src);
@@ -136,21 +181,6 @@ OpenAPI_notification_item_t *OpenAPI_notification_item_copy(OpenAPI_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notification_item_free(dst);
     dst = OpenAPI_notification_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "updated_item.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_notification_item_t *OpenAPI_notification_item_create(
 void OpenAPI_notification_item_free(OpenAPI_notification_item_t *notification_item);
 OpenAPI_notification_item_t *OpenAPI_notification_item_parseFromJSON(cJSON *notification_itemJSON);
 cJSON *OpenAPI_notification_item_convertToJSON(OpenAPI_notification_item_t *notification_item);
+bool OpenAPI_notification_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notification_item_t *notification_item);
 OpenAPI_notification_item_t *OpenAPI_notification_item_copy(OpenAPI_notification_item_t *dst, OpenAPI_notification_item_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,52 @@ end:
     return item;
 }
 
+bool OpenAPI_notify_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notify_item_t *notify_item)
+{
+    if (notify_item == NULL) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [NotifyItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [NotifyItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceId", notify_item->resource_id) == false) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [resource_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "changes") == false) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [changes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *changes_node;
+    if (notify_item->changes) {
+        OpenAPI_list_for_each(notify_item->changes, changes_node) {
+            if (OpenAPI_change_item_writeJSON(writer, NULL, changes_node->data) == false) {
+                ogs_error("OpenAPI_notify_item_writeJSON() failed [changes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [changes]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_notify_item_writeJSON() failed [NotifyItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_notify_item_t *OpenAPI_notify_item_parseFromJSON(cJSON *notify_itemJSON)
 {
     OpenAPI_notify_item_t *notify_item_local_var = NULL;
@@ -127,7 +173,6 @@ end:
 OpenAPI_notify_item_t *OpenAPI_notify_item_copy(OpenAPI_notify_item_t *dst, OpenAPI_notify_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_notify_item_convertToJSON(src);
@@ -136,21 +181,6 @@ OpenAPI_notify_item_t *OpenAPI_notify_item_copy(OpenAPI_notify_item_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_notify_item_free(dst);
     dst = OpenAPI_notify_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "change_item.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_notify_item_t *OpenAPI_notify_item_create(
 void OpenAPI_notify_item_free(OpenAPI_notify_item_t *notify_item);
 OpenAPI_notify_item_t *OpenAPI_notify_item_parseFromJSON(cJSON *notify_itemJSON);
 cJSON *OpenAPI_notify_item_convertToJSON(OpenAPI_notify_item_t *notify_item);
+bool OpenAPI_notify_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_notify_item_t *notify_item);
 OpenAPI_notify_item_t *OpenAPI_notify_item_copy(OpenAPI_notify_item_t *dst, OpenAPI_notify_item_t *src);
 
 #ifdef __cplusplus
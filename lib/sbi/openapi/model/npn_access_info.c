@@ -59,6 +59,47 @@ end:
     return item;
 }
 
+bool OpenAPI_npn_access_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_npn_access_info_t *npn_access_info)
+{
+    if (npn_access_info == NULL) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [NpnAccessInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [NpnAccessInfo]");
+        return false;
+    }
+    if (npn_access_info->cell_cag_info) {
+    if (OpenAPI_json_write_array_start(writer, "cellCagInfo") == false) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cell_cag_info_node;
+    OpenAPI_list_for_each(npn_access_info->cell_cag_info, cell_cag_info_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)cell_cag_info_node->data) == false) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [cell_cag_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_npn_access_info_writeJSON() failed [NpnAccessInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_parseFromJSON(cJSON *npn_access_infoJSON)
 {
     OpenAPI_npn_access_info_t *npn_access_info_local_var = NULL;
@@ -94,7 +135,6 @@ end:
 OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_copy(OpenAPI_npn_access_info_t *dst, OpenAPI_npn_access_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_npn_access_info_convertToJSON(src);
@@ -103,21 +143,6 @@ OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_copy(OpenAPI_npn_access_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_npn_access_info_free(dst);
     dst = OpenAPI_npn_access_info_parseFromJSON(item);
     cJSON_Delete(item);
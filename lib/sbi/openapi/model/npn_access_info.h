@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_create(
 void OpenAPI_npn_access_info_free(OpenAPI_npn_access_info_t *npn_access_info);
 OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_parseFromJSON(cJSON *npn_access_infoJSON);
 cJSON *OpenAPI_npn_access_info_convertToJSON(OpenAPI_npn_access_info_t *npn_access_info);
+bool OpenAPI_npn_access_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_npn_access_info_t *npn_access_info);
 OpenAPI_npn_access_info_t *OpenAPI_npn_access_info_copy(OpenAPI_npn_access_info_t *dst, OpenAPI_npn_access_info_t *src);
 
 #ifdef __cplusplus
@@ -122,6 +122,73 @@ end:
     return item;
 }
 
+bool OpenAPI_nr_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nr_location_t *nr_location)
+{
+    if (nr_location == NULL) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [NrLocation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [NrLocation]");
+        return false;
+    }
+    if (OpenAPI_tai_writeJSON(writer, "tai", nr_location->tai) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [tai]");
+        goto end;
+    }
+
+    if (OpenAPI_ncgi_writeJSON(writer, "ncgi", nr_location->ncgi) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [ncgi]");
+        goto end;
+    }
+
+    if (nr_location->is_age_of_location_information) {
+    if (OpenAPI_json_write_number(writer, "ageOfLocationInformation", nr_location->age_of_location_information) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [age_of_location_information]");
+        goto end;
+    }
+    }
+
+    if (nr_location->ue_location_timestamp) {
+    if (OpenAPI_json_write_string(writer, "ueLocationTimestamp", nr_location->ue_location_timestamp) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [ue_location_timestamp]");
+        goto end;
+    }
+    }
+
+    if (nr_location->geographical_information) {
+    if (OpenAPI_json_write_string(writer, "geographicalInformation", nr_location->geographical_information) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [geographical_information]");
+        goto end;
+    }
+    }
+
+    if (nr_location->geodetic_information) {
+    if (OpenAPI_json_write_string(writer, "geodeticInformation", nr_location->geodetic_information) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [geodetic_information]");
+        goto end;
+    }
+    }
+
+    if (nr_location->global_gnb_id) {
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "globalGnbId", nr_location->global_gnb_id) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [global_gnb_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nr_location_writeJSON() failed [NrLocation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nr_location_t *OpenAPI_nr_location_parseFromJSON(cJSON *nr_locationJSON)
 {
     OpenAPI_nr_location_t *nr_location_local_var = NULL;
@@ -205,7 +272,6 @@ end:
 OpenAPI_nr_location_t *OpenAPI_nr_location_copy(OpenAPI_nr_location_t *dst, OpenAPI_nr_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nr_location_convertToJSON(src);
@@ -214,21 +280,6 @@ OpenAPI_nr_location_t *OpenAPI_nr_location_copy(OpenAPI_nr_location_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nr_location_free(dst);
     dst = OpenAPI_nr_location_parseFromJSON(item);
     cJSON_Delete(item);
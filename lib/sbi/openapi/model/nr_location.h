@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "global_ran_node_id.h"
 #include "ncgi.h"
 #include "tai.h"
@@ -45,6 +46,7 @@ OpenAPI_nr_location_t *OpenAPI_nr_location_create(
 void OpenAPI_nr_location_free(OpenAPI_nr_location_t *nr_location);
 OpenAPI_nr_location_t *OpenAPI_nr_location_parseFromJSON(cJSON *nr_locationJSON);
 cJSON *OpenAPI_nr_location_convertToJSON(OpenAPI_nr_location_t *nr_location);
+bool OpenAPI_nr_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nr_location_t *nr_location);
 OpenAPI_nr_location_t *OpenAPI_nr_location_copy(OpenAPI_nr_location_t *dst, OpenAPI_nr_location_t *src);
 
 #ifdef __cplusplus
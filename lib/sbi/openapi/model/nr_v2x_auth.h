@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_auth.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_nr_v2x_auth_t *OpenAPI_nr_v2x_auth_create(
 void OpenAPI_nr_v2x_auth_free(OpenAPI_nr_v2x_auth_t *nr_v2x_auth);
 OpenAPI_nr_v2x_auth_t *OpenAPI_nr_v2x_auth_parseFromJSON(cJSON *nr_v2x_authJSON);
 cJSON *OpenAPI_nr_v2x_auth_convertToJSON(OpenAPI_nr_v2x_auth_t *nr_v2x_auth);
+bool OpenAPI_nr_v2x_auth_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nr_v2x_auth_t *nr_v2x_auth);
 OpenAPI_nr_v2x_auth_t *OpenAPI_nr_v2x_auth_copy(OpenAPI_nr_v2x_auth_t *dst, OpenAPI_nr_v2x_auth_t *src);
 
 #ifdef __cplusplus
@@ -55,6 +55,42 @@ end:
     return item;
 }
 
+bool OpenAPI_nr_v2x_auth_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nr_v2x_auth_1_t *nr_v2x_auth_1)
+{
+    if (nr_v2x_auth_1 == NULL) {
+        ogs_error("OpenAPI_nr_v2x_auth_1_writeJSON() failed [NrV2xAuth_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nr_v2x_auth_1_writeJSON() failed [NrV2xAuth_1]");
+        return false;
+    }
+    if (nr_v2x_auth_1->vehicle_ue_auth) {
+    if (OpenAPI_json_write_string(writer, "vehicleUeAuth", OpenAPI_ue_auth_ToString(nr_v2x_auth_1->vehicle_ue_auth)) == false) {
+        ogs_error("OpenAPI_nr_v2x_auth_1_writeJSON() failed [vehicle_ue_auth]");
+        goto end;
+    }
+    }
+
+    if (nr_v2x_auth_1->pedestrian_ue_auth) {
+    if (OpenAPI_json_write_string(writer, "pedestrianUeAuth", OpenAPI_ue_auth_ToString(nr_v2x_auth_1->pedestrian_ue_auth)) == false) {
+        ogs_error("OpenAPI_nr_v2x_auth_1_writeJSON() failed [pedestrian_ue_auth]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nr_v2x_auth_1_writeJSON() failed [NrV2xAuth_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_parseFromJSON(cJSON *nr_v2x_auth_1JSON)
 {
     OpenAPI_nr_v2x_auth_1_t *nr_v2x_auth_1_local_var = NULL;
@@ -93,7 +129,6 @@ end:
 OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_copy(OpenAPI_nr_v2x_auth_1_t *dst, OpenAPI_nr_v2x_auth_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nr_v2x_auth_1_convertToJSON(src);
@@ -102,21 +137,6 @@ OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_copy(OpenAPI_nr_v2x_auth_1_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nr_v2x_auth_1_free(dst);
     dst = OpenAPI_nr_v2x_auth_1_parseFromJSON(item);
     cJSON_Delete(item);
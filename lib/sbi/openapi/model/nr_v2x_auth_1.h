@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_auth.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_create(
 void OpenAPI_nr_v2x_auth_1_free(OpenAPI_nr_v2x_auth_1_t *nr_v2x_auth_1);
 OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_parseFromJSON(cJSON *nr_v2x_auth_1JSON);
 cJSON *OpenAPI_nr_v2x_auth_1_convertToJSON(OpenAPI_nr_v2x_auth_1_t *nr_v2x_auth_1);
+bool OpenAPI_nr_v2x_auth_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nr_v2x_auth_1_t *nr_v2x_auth_1);
 OpenAPI_nr_v2x_auth_1_t *OpenAPI_nr_v2x_auth_1_copy(OpenAPI_nr_v2x_auth_1_t *dst, OpenAPI_nr_v2x_auth_1_t *src);
 
 #ifdef __cplusplus
@@ -837,6 +837,600 @@ end:
     return item;
 }
 
+bool OpenAPI_nrf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nrf_info_t *nrf_info)
+{
+    if (nrf_info == NULL) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [NrfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [NrfInfo]");
+        return false;
+    }
+    if (nrf_info->served_udr_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdrInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udr_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udr_info_node;
+    if (nrf_info->served_udr_info) {
+        OpenAPI_list_for_each(nrf_info->served_udr_info, served_udr_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udr_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udr_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udr_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udr_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_udr_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdrInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udr_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udr_info_list_node;
+    if (nrf_info->served_udr_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_udr_info_list, served_udr_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udr_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udr_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_udm_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdmInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udm_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udm_info_node;
+    if (nrf_info->served_udm_info) {
+        OpenAPI_list_for_each(nrf_info->served_udm_info, served_udm_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udm_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udm_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udm_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udm_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_udm_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdmInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udm_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udm_info_list_node;
+    if (nrf_info->served_udm_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_udm_info_list, served_udm_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udm_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udm_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_ausf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedAusfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_ausf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_ausf_info_node;
+    if (nrf_info->served_ausf_info) {
+        OpenAPI_list_for_each(nrf_info->served_ausf_info, served_ausf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_ausf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_ausf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_ausf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_ausf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_ausf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedAusfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_ausf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_ausf_info_list_node;
+    if (nrf_info->served_ausf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_ausf_info_list, served_ausf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_ausf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_ausf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_amf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedAmfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_amf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_amf_info_node;
+    if (nrf_info->served_amf_info) {
+        OpenAPI_list_for_each(nrf_info->served_amf_info, served_amf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_amf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_amf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_amf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_amf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_amf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedAmfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_amf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_amf_info_list_node;
+    if (nrf_info->served_amf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_amf_info_list, served_amf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_amf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_amf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_smf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedSmfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_smf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_smf_info_node;
+    if (nrf_info->served_smf_info) {
+        OpenAPI_list_for_each(nrf_info->served_smf_info, served_smf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_smf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_smf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_smf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_smf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_smf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedSmfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_smf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_smf_info_list_node;
+    if (nrf_info->served_smf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_smf_info_list, served_smf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_smf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_smf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_upf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedUpfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_upf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_upf_info_node;
+    if (nrf_info->served_upf_info) {
+        OpenAPI_list_for_each(nrf_info->served_upf_info, served_upf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_upf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_upf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_upf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_upf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_upf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedUpfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_upf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_upf_info_list_node;
+    if (nrf_info->served_upf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_upf_info_list, served_upf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_upf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_upf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_pcf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedPcfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_pcf_info_node;
+    if (nrf_info->served_pcf_info) {
+        OpenAPI_list_for_each(nrf_info->served_pcf_info, served_pcf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_pcf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_pcf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_pcf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedPcfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_pcf_info_list_node;
+    if (nrf_info->served_pcf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_pcf_info_list, served_pcf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_pcf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_bsf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedBsfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_bsf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_bsf_info_node;
+    if (nrf_info->served_bsf_info) {
+        OpenAPI_list_for_each(nrf_info->served_bsf_info, served_bsf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_bsf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_bsf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_bsf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_bsf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_bsf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedBsfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_bsf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_bsf_info_list_node;
+    if (nrf_info->served_bsf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_bsf_info_list, served_bsf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_bsf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_bsf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_chf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedChfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_chf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_chf_info_node;
+    if (nrf_info->served_chf_info) {
+        OpenAPI_list_for_each(nrf_info->served_chf_info, served_chf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_chf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_chf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_chf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_chf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_chf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedChfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_chf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_chf_info_list_node;
+    if (nrf_info->served_chf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_chf_info_list, served_chf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_chf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_chf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_nef_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedNefInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nef_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_nef_info_node;
+    if (nrf_info->served_nef_info) {
+        OpenAPI_list_for_each(nrf_info->served_nef_info, served_nef_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_nef_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_nef_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nef_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nef_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_nwdaf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedNwdafInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nwdaf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_nwdaf_info_node;
+    if (nrf_info->served_nwdaf_info) {
+        OpenAPI_list_for_each(nrf_info->served_nwdaf_info, served_nwdaf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_nwdaf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_nwdaf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nwdaf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nwdaf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_pcscf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedPcscfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcscf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_pcscf_info_list_node;
+    if (nrf_info->served_pcscf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_pcscf_info_list, served_pcscf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_pcscf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_pcscf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_gmlc_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedGmlcInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_gmlc_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_gmlc_info_node;
+    if (nrf_info->served_gmlc_info) {
+        OpenAPI_list_for_each(nrf_info->served_gmlc_info, served_gmlc_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_gmlc_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_gmlc_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_gmlc_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_gmlc_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_lmf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedLmfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_lmf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_lmf_info_node;
+    if (nrf_info->served_lmf_info) {
+        OpenAPI_list_for_each(nrf_info->served_lmf_info, served_lmf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_lmf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_lmf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_lmf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_lmf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_nf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedNfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_nf_info_node;
+    if (nrf_info->served_nf_info) {
+        OpenAPI_list_for_each(nrf_info->served_nf_info, served_nf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_nf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_nf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_nf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_hss_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedHssInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_hss_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_hss_info_list_node;
+    if (nrf_info->served_hss_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_hss_info_list, served_hss_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_hss_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_hss_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_udsf_info) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdsfInfo") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udsf_info]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udsf_info_node;
+    if (nrf_info->served_udsf_info) {
+        OpenAPI_list_for_each(nrf_info->served_udsf_info, served_udsf_info_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udsf_info_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_udsf_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udsf_info]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udsf_info]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_udsf_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedUdsfInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udsf_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_udsf_info_list_node;
+    if (nrf_info->served_udsf_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_udsf_info_list, served_udsf_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_udsf_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_udsf_info_list]");
+        goto end;
+    }
+    }
+
+    if (nrf_info->served_scp_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "servedScpInfoList") == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_scp_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *served_scp_info_list_node;
+    if (nrf_info->served_scp_info_list) {
+        OpenAPI_list_for_each(nrf_info->served_scp_info_list, served_scp_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)served_scp_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_scp_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_scp_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [served_scp_info_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrf_info_writeJSON() failed [NrfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nrf_info_t *OpenAPI_nrf_info_parseFromJSON(cJSON *nrf_infoJSON)
 {
     OpenAPI_nrf_info_t *nrf_info_local_var = NULL;
@@ -1499,7 +2093,6 @@ end:
 OpenAPI_nrf_info_t *OpenAPI_nrf_info_copy(OpenAPI_nrf_info_t *dst, OpenAPI_nrf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nrf_info_convertToJSON(src);
@@ -1508,21 +2101,6 @@ OpenAPI_nrf_info_t *OpenAPI_nrf_info_copy(OpenAPI_nrf_info_t *dst, OpenAPI_nrf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nrf_info_free(dst);
     dst = OpenAPI_nrf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf_info.h"
 #include "ausf_info.h"
 #include "bsf_info.h"
@@ -100,6 +101,7 @@ OpenAPI_nrf_info_t *OpenAPI_nrf_info_create(
 void OpenAPI_nrf_info_free(OpenAPI_nrf_info_t *nrf_info);
 OpenAPI_nrf_info_t *OpenAPI_nrf_info_parseFromJSON(cJSON *nrf_infoJSON);
 cJSON *OpenAPI_nrf_info_convertToJSON(OpenAPI_nrf_info_t *nrf_info);
+bool OpenAPI_nrf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nrf_info_t *nrf_info);
 OpenAPI_nrf_info_t *OpenAPI_nrf_info_copy(OpenAPI_nrf_info_t *dst, OpenAPI_nrf_info_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,45 @@ end:
     return item;
 }
 
+bool OpenAPI_nrppa_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nrppa_information_t *nrppa_information)
+{
+    if (nrppa_information == NULL) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [NrppaInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [NrppaInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfId", nrppa_information->nf_id) == false) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [nf_id]");
+        goto end;
+    }
+
+    if (OpenAPI_n2_info_content_writeJSON(writer, "nrppaPdu", nrppa_information->nrppa_pdu) == false) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [nrppa_pdu]");
+        goto end;
+    }
+
+    if (nrppa_information->service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "serviceInstanceId", nrppa_information->service_instance_id) == false) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nrppa_information_writeJSON() failed [NrppaInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_parseFromJSON(cJSON *nrppa_informationJSON)
 {
     OpenAPI_nrppa_information_t *nrppa_information_local_var = NULL;
@@ -115,7 +154,6 @@ end:
 OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_copy(OpenAPI_nrppa_information_t *dst, OpenAPI_nrppa_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nrppa_information_convertToJSON(src);
@@ -124,21 +162,6 @@ OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_copy(OpenAPI_nrppa_inform
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nrppa_information_free(dst);
     dst = OpenAPI_nrppa_information_parseFromJSON(item);
     cJSON_Delete(item);
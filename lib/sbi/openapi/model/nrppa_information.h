@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_info_content.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_create(
 void OpenAPI_nrppa_information_free(OpenAPI_nrppa_information_t *nrppa_information);
 OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_parseFromJSON(cJSON *nrppa_informationJSON);
 cJSON *OpenAPI_nrppa_information_convertToJSON(OpenAPI_nrppa_information_t *nrppa_information);
+bool OpenAPI_nrppa_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nrppa_information_t *nrppa_information);
 OpenAPI_nrppa_information_t *OpenAPI_nrppa_information_copy(OpenAPI_nrppa_information_t *dst, OpenAPI_nrppa_information_t *src);
 
 #ifdef __cplusplus
@@ -75,6 +75,54 @@ end:
     return item;
 }
 
+bool OpenAPI_nsi_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nsi_information_t *nsi_information)
+{
+    if (nsi_information == NULL) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [NsiInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [NsiInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nrfId", nsi_information->nrf_id) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [nrf_id]");
+        goto end;
+    }
+
+    if (nsi_information->nsi_id) {
+    if (OpenAPI_json_write_string(writer, "nsiId", nsi_information->nsi_id) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [nsi_id]");
+        goto end;
+    }
+    }
+
+    if (nsi_information->nrf_nf_mgt_uri) {
+    if (OpenAPI_json_write_string(writer, "nrfNfMgtUri", nsi_information->nrf_nf_mgt_uri) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [nrf_nf_mgt_uri]");
+        goto end;
+    }
+    }
+
+    if (nsi_information->nrf_access_token_uri) {
+    if (OpenAPI_json_write_string(writer, "nrfAccessTokenUri", nsi_information->nrf_access_token_uri) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [nrf_access_token_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nsi_information_writeJSON() failed [NsiInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nsi_information_t *OpenAPI_nsi_information_parseFromJSON(cJSON *nsi_informationJSON)
 {
     OpenAPI_nsi_information_t *nsi_information_local_var = NULL;
@@ -131,7 +179,6 @@ end:
 OpenAPI_nsi_information_t *OpenAPI_nsi_information_copy(OpenAPI_nsi_information_t *dst, OpenAPI_nsi_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nsi_information_convertToJSON(src);
@@ -140,21 +187,6 @@ OpenAPI_nsi_information_t *OpenAPI_nsi_information_copy(OpenAPI_nsi_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nsi_information_free(dst);
     dst = OpenAPI_nsi_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_nsi_information_t *OpenAPI_nsi_information_create(
 void OpenAPI_nsi_information_free(OpenAPI_nsi_information_t *nsi_information);
 OpenAPI_nsi_information_t *OpenAPI_nsi_information_parseFromJSON(cJSON *nsi_informationJSON);
 cJSON *OpenAPI_nsi_information_convertToJSON(OpenAPI_nsi_information_t *nsi_information);
+bool OpenAPI_nsi_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nsi_information_t *nsi_information);
 OpenAPI_nsi_information_t *OpenAPI_nsi_information_copy(OpenAPI_nsi_information_t *dst, OpenAPI_nsi_information_t *src);
 
 #ifdef __cplusplus
@@ -58,6 +58,38 @@ end:
     return item;
 }
 
+bool OpenAPI_nssaa_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssaa_status_t *nssaa_status)
+{
+    if (nssaa_status == NULL) {
+        ogs_error("OpenAPI_nssaa_status_writeJSON() failed [NssaaStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nssaa_status_writeJSON() failed [NssaaStatus]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", nssaa_status->snssai) == false) {
+        ogs_error("OpenAPI_nssaa_status_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "status", OpenAPI_auth_status_ToString(nssaa_status->status)) == false) {
+        ogs_error("OpenAPI_nssaa_status_writeJSON() failed [status]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nssaa_status_writeJSON() failed [NssaaStatus]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_parseFromJSON(cJSON *nssaa_statusJSON)
 {
     OpenAPI_nssaa_status_t *nssaa_status_local_var = NULL;
@@ -96,7 +128,6 @@ end:
 OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_copy(OpenAPI_nssaa_status_t *dst, OpenAPI_nssaa_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nssaa_status_convertToJSON(src);
@@ -105,21 +136,6 @@ OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_copy(OpenAPI_nssaa_status_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nssaa_status_free(dst);
     dst = OpenAPI_nssaa_status_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_status.h"
 #include "snssai.h"
 
@@ -32,6 +33,7 @@ OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_create(
 void OpenAPI_nssaa_status_free(OpenAPI_nssaa_status_t *nssaa_status);
 OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_parseFromJSON(cJSON *nssaa_statusJSON);
 cJSON *OpenAPI_nssaa_status_convertToJSON(OpenAPI_nssaa_status_t *nssaa_status);
+bool OpenAPI_nssaa_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssaa_status_t *nssaa_status);
 OpenAPI_nssaa_status_t *OpenAPI_nssaa_status_copy(OpenAPI_nssaa_status_t *dst, OpenAPI_nssaa_status_t *src);
 
 #ifdef __cplusplus
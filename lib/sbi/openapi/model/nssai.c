@@ -139,6 +139,105 @@ end:
     return item;
 }
 
+bool OpenAPI_nssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_t *nssai)
+{
+    if (nssai == NULL) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [Nssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [Nssai]");
+        return false;
+    }
+    if (nssai->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", nssai->supported_features) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "defaultSingleNssais") == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [default_single_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *default_single_nssais_node;
+    if (nssai->default_single_nssais) {
+        OpenAPI_list_for_each(nssai->default_single_nssais, default_single_nssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, default_single_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nssai_writeJSON() failed [default_single_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [default_single_nssais]");
+        goto end;
+    }
+
+    if (nssai->single_nssais) {
+    if (OpenAPI_json_write_array_start(writer, "singleNssais") == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [single_nssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *single_nssais_node;
+    if (nssai->single_nssais) {
+        OpenAPI_list_for_each(nssai->single_nssais, single_nssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, single_nssais_node->data) == false) {
+                ogs_error("OpenAPI_nssai_writeJSON() failed [single_nssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [single_nssais]");
+        goto end;
+    }
+    }
+
+    if (nssai->provisioning_time) {
+    if (OpenAPI_json_write_string(writer, "provisioningTime", nssai->provisioning_time) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+    }
+
+    if (nssai->additional_snssai_data) {
+    if (OpenAPI_json_write_object_start(writer, "additionalSnssaiData") == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [additional_snssai_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *additional_snssai_data_node;
+    if (nssai->additional_snssai_data) {
+        OpenAPI_list_for_each(nssai->additional_snssai_data, additional_snssai_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)additional_snssai_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_additional_snssai_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_nssai_writeJSON() failed [additional_snssai_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [additional_snssai_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nssai_writeJSON() failed [Nssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nssai_t *OpenAPI_nssai_parseFromJSON(cJSON *nssaiJSON)
 {
     OpenAPI_nssai_t *nssai_local_var = NULL;
@@ -262,7 +361,6 @@ end:
 OpenAPI_nssai_t *OpenAPI_nssai_copy(OpenAPI_nssai_t *dst, OpenAPI_nssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nssai_convertToJSON(src);
@@ -271,21 +369,6 @@ OpenAPI_nssai_t *OpenAPI_nssai_copy(OpenAPI_nssai_t *dst, OpenAPI_nssai_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nssai_free(dst);
     dst = OpenAPI_nssai_parseFromJSON(item);
     cJSON_Delete(item);
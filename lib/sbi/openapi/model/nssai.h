@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "additional_snssai_data.h"
 #include "snssai.h"
 
@@ -38,6 +39,7 @@ OpenAPI_nssai_t *OpenAPI_nssai_create(
 void OpenAPI_nssai_free(OpenAPI_nssai_t *nssai);
 OpenAPI_nssai_t *OpenAPI_nssai_parseFromJSON(cJSON *nssaiJSON);
 cJSON *OpenAPI_nssai_convertToJSON(OpenAPI_nssai_t *nssai);
+bool OpenAPI_nssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_t *nssai);
 OpenAPI_nssai_t *OpenAPI_nssai_copy(OpenAPI_nssai_t *dst, OpenAPI_nssai_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "additional_snssai_data.h"
 #include "snssai.h"
 
@@ -38,6 +39,7 @@ OpenAPI_nssai_1_t *OpenAPI_nssai_1_create(
 void OpenAPI_nssai_1_free(OpenAPI_nssai_1_t *nssai_1);
 OpenAPI_nssai_1_t *OpenAPI_nssai_1_parseFromJSON(cJSON *nssai_1JSON);
 cJSON *OpenAPI_nssai_1_convertToJSON(OpenAPI_nssai_1_t *nssai_1);
+bool OpenAPI_nssai_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_1_t *nssai_1);
 OpenAPI_nssai_1_t *OpenAPI_nssai_1_copy(OpenAPI_nssai_1_t *dst, OpenAPI_nssai_1_t *src);
 
 #ifdef __cplusplus
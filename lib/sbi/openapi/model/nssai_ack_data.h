@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_update_status.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_nssai_ack_data_t *OpenAPI_nssai_ack_data_create(
 void OpenAPI_nssai_ack_data_free(OpenAPI_nssai_ack_data_t *nssai_ack_data);
 OpenAPI_nssai_ack_data_t *OpenAPI_nssai_ack_data_parseFromJSON(cJSON *nssai_ack_dataJSON);
 cJSON *OpenAPI_nssai_ack_data_convertToJSON(OpenAPI_nssai_ack_data_t *nssai_ack_data);
+bool OpenAPI_nssai_ack_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_ack_data_t *nssai_ack_data);
 OpenAPI_nssai_ack_data_t *OpenAPI_nssai_ack_data_copy(OpenAPI_nssai_ack_data_t *dst, OpenAPI_nssai_ack_data_t *src);
 
 #ifdef __cplusplus
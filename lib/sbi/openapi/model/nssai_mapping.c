@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_nssai_mapping_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_mapping_t *nssai_mapping)
+{
+    if (nssai_mapping == NULL) {
+        ogs_error("OpenAPI_nssai_mapping_writeJSON() failed [NssaiMapping]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nssai_mapping_writeJSON() failed [NssaiMapping]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "mappedSnssai", nssai_mapping->mapped_snssai) == false) {
+        ogs_error("OpenAPI_nssai_mapping_writeJSON() failed [mapped_snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "hSnssai", nssai_mapping->h_snssai) == false) {
+        ogs_error("OpenAPI_nssai_mapping_writeJSON() failed [h_snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nssai_mapping_writeJSON() failed [NssaiMapping]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_parseFromJSON(cJSON *nssai_mappingJSON)
 {
     OpenAPI_nssai_mapping_t *nssai_mapping_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_copy(OpenAPI_nssai_mapping_t *dst, OpenAPI_nssai_mapping_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nssai_mapping_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_copy(OpenAPI_nssai_mapping_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nssai_mapping_free(dst);
     dst = OpenAPI_nssai_mapping_parseFromJSON(item);
     cJSON_Delete(item);
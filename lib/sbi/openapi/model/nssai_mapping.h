@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_create(
 void OpenAPI_nssai_mapping_free(OpenAPI_nssai_mapping_t *nssai_mapping);
 OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_parseFromJSON(cJSON *nssai_mappingJSON);
 cJSON *OpenAPI_nssai_mapping_convertToJSON(OpenAPI_nssai_mapping_t *nssai_mapping);
+bool OpenAPI_nssai_mapping_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nssai_mapping_t *nssai_mapping);
 OpenAPI_nssai_mapping_t *OpenAPI_nssai_mapping_copy(OpenAPI_nssai_mapping_t *dst, OpenAPI_nssai_mapping_t *src);
 
 #ifdef __cplusplus
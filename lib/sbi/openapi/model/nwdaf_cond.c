@@ -167,6 +167,115 @@ end:
     return item;
 }
 
+bool OpenAPI_nwdaf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_cond_t *nwdaf_cond)
+{
+    if (nwdaf_cond == NULL) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [NwdafCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [NwdafCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "conditionType", OpenAPI_condition_typenwdaf_cond_ToString(nwdaf_cond->condition_type)) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [condition_type]");
+        goto end;
+    }
+
+    if (nwdaf_cond->analytics_ids) {
+    if (OpenAPI_json_write_array_start(writer, "analyticsIds") == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [analytics_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *analytics_ids_node;
+    OpenAPI_list_for_each(nwdaf_cond->analytics_ids, analytics_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)analytics_ids_node->data) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [analytics_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [analytics_ids]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_cond->snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "snssaiList") == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssai_list_node;
+    if (nwdaf_cond->snssai_list) {
+        OpenAPI_list_for_each(nwdaf_cond->snssai_list, snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_cond->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (nwdaf_cond->tai_list) {
+        OpenAPI_list_for_each(nwdaf_cond->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_cond->tai_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiRangeList") == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_range_list_node;
+    if (nwdaf_cond->tai_range_list) {
+        OpenAPI_list_for_each(nwdaf_cond->tai_range_list, tai_range_list_node) {
+            if (OpenAPI_tai_range_writeJSON(writer, NULL, tai_range_list_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_cond_writeJSON() failed [NwdafCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_parseFromJSON(cJSON *nwdaf_condJSON)
 {
     OpenAPI_nwdaf_cond_t *nwdaf_cond_local_var = NULL;
@@ -306,7 +415,6 @@ end:
 OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_copy(OpenAPI_nwdaf_cond_t *dst, OpenAPI_nwdaf_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nwdaf_cond_convertToJSON(src);
@@ -315,21 +423,6 @@ OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_copy(OpenAPI_nwdaf_cond_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nwdaf_cond_free(dst);
     dst = OpenAPI_nwdaf_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 #include "tai.h"
 #include "tai_range.h"
@@ -44,6 +45,7 @@ OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_create(
 void OpenAPI_nwdaf_cond_free(OpenAPI_nwdaf_cond_t *nwdaf_cond);
 OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_parseFromJSON(cJSON *nwdaf_condJSON);
 cJSON *OpenAPI_nwdaf_cond_convertToJSON(OpenAPI_nwdaf_cond_t *nwdaf_cond);
+bool OpenAPI_nwdaf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_cond_t *nwdaf_cond);
 OpenAPI_nwdaf_cond_t *OpenAPI_nwdaf_cond_copy(OpenAPI_nwdaf_cond_t *dst, OpenAPI_nwdaf_cond_t *src);
 
 #ifdef __cplusplus
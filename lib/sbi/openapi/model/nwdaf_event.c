@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_nwdaf_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_event_t *nwdaf_event)
+{
+    if (nwdaf_event == NULL) {
+        ogs_error("OpenAPI_nwdaf_event_writeJSON() failed [NwdafEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nwdaf_event_writeJSON() failed [NwdafEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_event_writeJSON() failed [NwdafEvent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_parseFromJSON(cJSON *nwdaf_eventJSON)
 {
     OpenAPI_nwdaf_event_t *nwdaf_event_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_copy(OpenAPI_nwdaf_event_t *dst, OpenAPI_nwdaf_event_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nwdaf_event_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_copy(OpenAPI_nwdaf_event_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nwdaf_event_free(dst);
     dst = OpenAPI_nwdaf_event_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nwdaf_event_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_create(
 void OpenAPI_nwdaf_event_free(OpenAPI_nwdaf_event_t *nwdaf_event);
 OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_parseFromJSON(cJSON *nwdaf_eventJSON);
 cJSON *OpenAPI_nwdaf_event_convertToJSON(OpenAPI_nwdaf_event_t *nwdaf_event);
+bool OpenAPI_nwdaf_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_event_t *nwdaf_event);
 OpenAPI_nwdaf_event_t *OpenAPI_nwdaf_event_copy(OpenAPI_nwdaf_event_t *dst, OpenAPI_nwdaf_event_t *src);
 
 #ifdef __cplusplus
@@ -141,6 +141,112 @@ end:
     return item;
 }
 
+bool OpenAPI_nwdaf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_info_t *nwdaf_info)
+{
+    if (nwdaf_info == NULL) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [NwdafInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [NwdafInfo]");
+        return false;
+    }
+    if (nwdaf_info->event_ids) {
+    if (OpenAPI_json_write_array_start(writer, "eventIds") == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [event_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *event_ids_node;
+    if (nwdaf_info->event_ids) {
+        OpenAPI_list_for_each(nwdaf_info->event_ids, event_ids_node) {
+            if (OpenAPI_event_id_writeJSON(writer, NULL, event_ids_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [event_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [event_ids]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_info->nwdaf_events) {
+    if (OpenAPI_json_write_array_start(writer, "nwdafEvents") == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [nwdaf_events]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nwdaf_events_node;
+    if (nwdaf_info->nwdaf_events) {
+        OpenAPI_list_for_each(nwdaf_info->nwdaf_events, nwdaf_events_node) {
+            if (OpenAPI_nwdaf_event_writeJSON(writer, NULL, nwdaf_events_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [nwdaf_events]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [nwdaf_events]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_info->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (nwdaf_info->tai_list) {
+        OpenAPI_list_for_each(nwdaf_info->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (nwdaf_info->tai_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiRangeList") == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_range_list_node;
+    if (nwdaf_info->tai_range_list) {
+        OpenAPI_list_for_each(nwdaf_info->tai_range_list, tai_range_list_node) {
+            if (OpenAPI_tai_range_writeJSON(writer, NULL, tai_range_list_node->data) == false) {
+                ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_nwdaf_info_writeJSON() failed [NwdafInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_parseFromJSON(cJSON *nwdaf_infoJSON)
 {
     OpenAPI_nwdaf_info_t *nwdaf_info_local_var = NULL;
@@ -275,7 +381,6 @@ end:
 OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_copy(OpenAPI_nwdaf_info_t *dst, OpenAPI_nwdaf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_nwdaf_info_convertToJSON(src);
@@ -284,21 +389,6 @@ OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_copy(OpenAPI_nwdaf_info_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_nwdaf_info_free(dst);
     dst = OpenAPI_nwdaf_info_parseFromJSON(item);
     cJSON_Delete(item);
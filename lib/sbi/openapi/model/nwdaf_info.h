@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_id.h"
 #include "nwdaf_event.h"
 #include "tai.h"
@@ -38,6 +39,7 @@ OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_create(
 void OpenAPI_nwdaf_info_free(OpenAPI_nwdaf_info_t *nwdaf_info);
 OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_parseFromJSON(cJSON *nwdaf_infoJSON);
 cJSON *OpenAPI_nwdaf_info_convertToJSON(OpenAPI_nwdaf_info_t *nwdaf_info);
+bool OpenAPI_nwdaf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_nwdaf_info_t *nwdaf_info);
 OpenAPI_nwdaf_info_t *OpenAPI_nwdaf_info_copy(OpenAPI_nwdaf_info_t *dst, OpenAPI_nwdaf_info_t *src);
 
 #ifdef __cplusplus
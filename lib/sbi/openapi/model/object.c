@@ -26,6 +26,14 @@ fail:
     return NULL;
 }
 
+bool OpenAPI_object_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_object_t *object)
+{
+    if (OpenAPI_json_write_object_start(writer, key) == false)
+        return false;
+
+    return OpenAPI_json_write_object_end(writer);
+}
+
 OpenAPI_object_t *OpenAPI_object_parseFromJSON(cJSON *objectJSON)
 {
     OpenAPI_object_t *object = NULL;
@@ -6,6 +6,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,6 +23,7 @@ void OpenAPI_object_free(OpenAPI_object_t *object);
 OpenAPI_object_t *OpenAPI_object_parseFromJSON(cJSON *objectJSON);
 
 cJSON *OpenAPI_object_convertToJSON(OpenAPI_object_t *object);
+bool OpenAPI_object_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_object_t *object);
 
 #ifdef __cplusplus
 }
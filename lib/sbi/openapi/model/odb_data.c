@@ -46,6 +46,35 @@ end:
     return item;
 }
 
+bool OpenAPI_odb_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_odb_data_t *odb_data)
+{
+    if (odb_data == NULL) {
+        ogs_error("OpenAPI_odb_data_writeJSON() failed [OdbData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_odb_data_writeJSON() failed [OdbData]");
+        return false;
+    }
+    if (odb_data->roaming_odb) {
+    if (OpenAPI_json_write_string(writer, "roamingOdb", OpenAPI_roaming_odb_ToString(odb_data->roaming_odb)) == false) {
+        ogs_error("OpenAPI_odb_data_writeJSON() failed [roaming_odb]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_odb_data_writeJSON() failed [OdbData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_odb_data_t *OpenAPI_odb_data_parseFromJSON(cJSON *odb_dataJSON)
 {
     OpenAPI_odb_data_t *odb_data_local_var = NULL;
@@ -72,7 +101,6 @@ end:
 OpenAPI_odb_data_t *OpenAPI_odb_data_copy(OpenAPI_odb_data_t *dst, OpenAPI_odb_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_odb_data_convertToJSON(src);
@@ -81,21 +109,6 @@ OpenAPI_odb_data_t *OpenAPI_odb_data_copy(OpenAPI_odb_data_t *dst, OpenAPI_odb_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_odb_data_free(dst);
     dst = OpenAPI_odb_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "roaming_odb.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_odb_data_t *OpenAPI_odb_data_create(
 void OpenAPI_odb_data_free(OpenAPI_odb_data_t *odb_data);
 OpenAPI_odb_data_t *OpenAPI_odb_data_parseFromJSON(cJSON *odb_dataJSON);
 cJSON *OpenAPI_odb_data_convertToJSON(OpenAPI_odb_data_t *odb_data);
+bool OpenAPI_odb_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_odb_data_t *odb_data);
 OpenAPI_odb_data_t *OpenAPI_odb_data_copy(OpenAPI_odb_data_t *dst, OpenAPI_odb_data_t *src);
 
 #ifdef __cplusplus
@@ -73,6 +73,52 @@ end:
     return item;
 }
 
+bool OpenAPI_operator_specific_data_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_operator_specific_data_container_t *operator_specific_data_container)
+{
+    if (operator_specific_data_container == NULL) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [OperatorSpecificDataContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [OperatorSpecificDataContainer]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dataType", operator_specific_data_container->data_type) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [data_type]");
+        goto end;
+    }
+
+    if (operator_specific_data_container->data_type_definition) {
+    if (OpenAPI_json_write_string(writer, "dataTypeDefinition", operator_specific_data_container->data_type_definition) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [data_type_definition]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "value", operator_specific_data_container->value) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [value]");
+        goto end;
+    }
+
+    if (operator_specific_data_container->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", operator_specific_data_container->supported_features) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_operator_specific_data_container_writeJSON() failed [OperatorSpecificDataContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_operator_specific_data_container_t *OpenAPI_operator_specific_data_container_parseFromJSON(cJSON *operator_specific_data_containerJSON)
 {
     OpenAPI_operator_specific_data_container_t *operator_specific_data_container_local_var = NULL;
@@ -131,7 +177,6 @@ end:
 OpenAPI_operator_specific_data_container_t *OpenAPI_operator_specific_data_container_copy(OpenAPI_operator_specific_data_container_t *dst, OpenAPI_operator_specific_data_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_operator_specific_data_container_convertToJSON(src);
@@ -140,21 +185,6 @@ OpenAPI_operator_specific_data_container_t *OpenAPI_operator_specific_data_conta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_operator_specific_data_container_free(dst);
     dst = OpenAPI_operator_specific_data_container_parseFromJSON(item);
     cJSON_Delete(item);
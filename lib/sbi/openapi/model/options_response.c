@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_options_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_options_response_t *options_response)
+{
+    if (options_response == NULL) {
+        ogs_error("OpenAPI_options_response_writeJSON() failed [OptionsResponse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_options_response_writeJSON() failed [OptionsResponse]");
+        return false;
+    }
+    if (options_response->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", options_response->supported_features) == false) {
+        ogs_error("OpenAPI_options_response_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_options_response_writeJSON() failed [OptionsResponse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_options_response_t *OpenAPI_options_response_parseFromJSON(cJSON *options_responseJSON)
 {
     OpenAPI_options_response_t *options_response_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_options_response_t *OpenAPI_options_response_copy(OpenAPI_options_response_t *dst, OpenAPI_options_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_options_response_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_options_response_t *OpenAPI_options_response_copy(OpenAPI_options_respon
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_options_response_free(dst);
     dst = OpenAPI_options_response_parseFromJSON(item);
     cJSON_Delete(item);
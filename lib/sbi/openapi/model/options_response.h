@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_options_response_t *OpenAPI_options_response_create(
 void OpenAPI_options_response_free(OpenAPI_options_response_t *options_response);
 OpenAPI_options_response_t *OpenAPI_options_response_parseFromJSON(cJSON *options_responseJSON);
 cJSON *OpenAPI_options_response_convertToJSON(OpenAPI_options_response_t *options_response);
+bool OpenAPI_options_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_options_response_t *options_response);
 OpenAPI_options_response_t *OpenAPI_options_response_copy(OpenAPI_options_response_t *dst, OpenAPI_options_response_t *src);
 
 #ifdef __cplusplus
@@ -77,6 +77,54 @@ end:
     return item;
 }
 
+bool OpenAPI_out_of_credit_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_out_of_credit_information_t *out_of_credit_information)
+{
+    if (out_of_credit_information == NULL) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [OutOfCreditInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [OutOfCreditInformation]");
+        return false;
+    }
+    if (OpenAPI_final_unit_action_writeJSON(writer, "finUnitAct", out_of_credit_information->fin_unit_act) == false) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [fin_unit_act]");
+        goto end;
+    }
+
+    if (out_of_credit_information->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (out_of_credit_information->flows) {
+        OpenAPI_list_for_each(out_of_credit_information->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_out_of_credit_information_writeJSON() failed [OutOfCreditInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_parseFromJSON(cJSON *out_of_credit_informationJSON)
 {
     OpenAPI_out_of_credit_information_t *out_of_credit_information_local_var = NULL;
@@ -131,7 +179,6 @@ end:
 OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_copy(OpenAPI_out_of_credit_information_t *dst, OpenAPI_out_of_credit_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_out_of_credit_information_convertToJSON(src);
@@ -140,21 +187,6 @@ OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_out_of_credit_information_free(dst);
     dst = OpenAPI_out_of_credit_information_parseFromJSON(item);
     cJSON_Delete(item);
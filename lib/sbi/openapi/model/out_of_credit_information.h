@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "final_unit_action.h"
 #include "flows.h"
 
@@ -32,6 +33,7 @@ OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_create(
 void OpenAPI_out_of_credit_information_free(OpenAPI_out_of_credit_information_t *out_of_credit_information);
 OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_parseFromJSON(cJSON *out_of_credit_informationJSON);
 cJSON *OpenAPI_out_of_credit_information_convertToJSON(OpenAPI_out_of_credit_information_t *out_of_credit_information);
+bool OpenAPI_out_of_credit_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_out_of_credit_information_t *out_of_credit_information);
 OpenAPI_out_of_credit_information_t *OpenAPI_out_of_credit_information_copy(OpenAPI_out_of_credit_information_t *dst, OpenAPI_out_of_credit_information_t *src);
 
 #ifdef __cplusplus
@@ -96,6 +96,70 @@ end:
     return item;
 }
 
+bool OpenAPI_packet_filter_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_packet_filter_info_t *packet_filter_info)
+{
+    if (packet_filter_info == NULL) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [PacketFilterInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [PacketFilterInfo]");
+        return false;
+    }
+    if (packet_filter_info->pack_filt_id) {
+    if (OpenAPI_json_write_string(writer, "packFiltId", packet_filter_info->pack_filt_id) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [pack_filt_id]");
+        goto end;
+    }
+    }
+
+    if (packet_filter_info->pack_filt_cont) {
+    if (OpenAPI_json_write_string(writer, "packFiltCont", packet_filter_info->pack_filt_cont) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [pack_filt_cont]");
+        goto end;
+    }
+    }
+
+    if (packet_filter_info->tos_traffic_class) {
+    if (OpenAPI_json_write_string(writer, "tosTrafficClass", packet_filter_info->tos_traffic_class) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [tos_traffic_class]");
+        goto end;
+    }
+    }
+
+    if (packet_filter_info->spi) {
+    if (OpenAPI_json_write_string(writer, "spi", packet_filter_info->spi) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [spi]");
+        goto end;
+    }
+    }
+
+    if (packet_filter_info->flow_label) {
+    if (OpenAPI_json_write_string(writer, "flowLabel", packet_filter_info->flow_label) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [flow_label]");
+        goto end;
+    }
+    }
+
+    if (packet_filter_info->flow_direction) {
+    if (OpenAPI_json_write_string(writer, "flowDirection", OpenAPI_flow_direction_ToString(packet_filter_info->flow_direction)) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [flow_direction]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_packet_filter_info_writeJSON() failed [PacketFilterInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_parseFromJSON(cJSON *packet_filter_infoJSON)
 {
     OpenAPI_packet_filter_info_t *packet_filter_info_local_var = NULL;
@@ -172,7 +236,6 @@ end:
 OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_copy(OpenAPI_packet_filter_info_t *dst, OpenAPI_packet_filter_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_packet_filter_info_convertToJSON(src);
@@ -181,21 +244,6 @@ OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_copy(OpenAPI_packet_fil
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_packet_filter_info_free(dst);
     dst = OpenAPI_packet_filter_info_parseFromJSON(item);
     cJSON_Delete(item);
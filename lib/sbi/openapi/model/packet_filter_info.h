@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flow_direction.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_create(
 void OpenAPI_packet_filter_info_free(OpenAPI_packet_filter_info_t *packet_filter_info);
 OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_parseFromJSON(cJSON *packet_filter_infoJSON);
 cJSON *OpenAPI_packet_filter_info_convertToJSON(OpenAPI_packet_filter_info_t *packet_filter_info);
+bool OpenAPI_packet_filter_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_packet_filter_info_t *packet_filter_info);
 OpenAPI_packet_filter_info_t *OpenAPI_packet_filter_info_copy(OpenAPI_packet_filter_info_t *dst, OpenAPI_packet_filter_info_t *src);
 
 #ifdef __cplusplus
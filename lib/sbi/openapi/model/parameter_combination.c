@@ -73,6 +73,49 @@ end:
     return item;
 }
 
+bool OpenAPI_parameter_combination_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_parameter_combination_t *parameter_combination)
+{
+    if (parameter_combination == NULL) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [ParameterCombination]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [ParameterCombination]");
+        return false;
+    }
+    if (parameter_combination->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", parameter_combination->supi) == false) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (parameter_combination->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", parameter_combination->dnn) == false) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (parameter_combination->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", parameter_combination->snssai) == false) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_parameter_combination_writeJSON() failed [ParameterCombination]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_parseFromJSON(cJSON *parameter_combinationJSON)
 {
     OpenAPI_parameter_combination_t *parameter_combination_local_var = NULL;
@@ -115,7 +158,6 @@ end:
 OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_copy(OpenAPI_parameter_combination_t *dst, OpenAPI_parameter_combination_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_parameter_combination_convertToJSON(src);
@@ -124,21 +166,6 @@ OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_copy(OpenAPI_para
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_parameter_combination_free(dst);
     dst = OpenAPI_parameter_combination_parseFromJSON(item);
     cJSON_Delete(item);
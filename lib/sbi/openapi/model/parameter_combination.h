@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_create(
 void OpenAPI_parameter_combination_free(OpenAPI_parameter_combination_t *parameter_combination);
 OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_parseFromJSON(cJSON *parameter_combinationJSON);
 cJSON *OpenAPI_parameter_combination_convertToJSON(OpenAPI_parameter_combination_t *parameter_combination);
+bool OpenAPI_parameter_combination_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_parameter_combination_t *parameter_combination);
 OpenAPI_parameter_combination_t *OpenAPI_parameter_combination_copy(OpenAPI_parameter_combination_t *dst, OpenAPI_parameter_combination_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_partial_record_method_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_partial_record_method_t *partial_record_method)
+{
+    if (partial_record_method == NULL) {
+        ogs_error("OpenAPI_partial_record_method_writeJSON() failed [PartialRecordMethod]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_partial_record_method_writeJSON() failed [PartialRecordMethod]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_partial_record_method_writeJSON() failed [PartialRecordMethod]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_parseFromJSON(cJSON *partial_record_methodJSON)
 {
     OpenAPI_partial_record_method_t *partial_record_method_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_copy(OpenAPI_partial_record_method_t *dst, OpenAPI_partial_record_method_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_partial_record_method_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_copy(OpenAPI_part
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_partial_record_method_free(dst);
     dst = OpenAPI_partial_record_method_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "partial_record_method_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_create(
 void OpenAPI_partial_record_method_free(OpenAPI_partial_record_method_t *partial_record_method);
 OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_parseFromJSON(cJSON *partial_record_methodJSON);
 cJSON *OpenAPI_partial_record_method_convertToJSON(OpenAPI_partial_record_method_t *partial_record_method);
+bool OpenAPI_partial_record_method_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_partial_record_method_t *partial_record_method);
 OpenAPI_partial_record_method_t *OpenAPI_partial_record_method_copy(OpenAPI_partial_record_method_t *dst, OpenAPI_partial_record_method_t *src);
 
 #ifdef __cplusplus
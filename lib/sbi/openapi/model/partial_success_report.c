@@ -130,6 +130,100 @@ end:
     return item;
 }
 
+bool OpenAPI_partial_success_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_partial_success_report_t *partial_success_report)
+{
+    if (partial_success_report == NULL) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [PartialSuccessReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [PartialSuccessReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "failureCause", OpenAPI_failure_cause_ToString(partial_success_report->failure_cause)) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [failure_cause]");
+        goto end;
+    }
+
+    if (partial_success_report->rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "ruleReports") == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rule_reports_node;
+    if (partial_success_report->rule_reports) {
+        OpenAPI_list_for_each(partial_success_report->rule_reports, rule_reports_node) {
+            if (OpenAPI_rule_report_writeJSON(writer, NULL, rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_partial_success_report_writeJSON() failed [rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+    }
+
+    if (partial_success_report->sess_rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "sessRuleReports") == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sess_rule_reports_node;
+    if (partial_success_report->sess_rule_reports) {
+        OpenAPI_list_for_each(partial_success_report->sess_rule_reports, sess_rule_reports_node) {
+            if (OpenAPI_session_rule_report_writeJSON(writer, NULL, sess_rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_partial_success_report_writeJSON() failed [sess_rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+    }
+
+    if (partial_success_report->ue_camping_rep) {
+    if (OpenAPI_ue_camping_rep_writeJSON(writer, "ueCampingRep", partial_success_report->ue_camping_rep) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [ue_camping_rep]");
+        goto end;
+    }
+    }
+
+    if (partial_success_report->policy_dec_failure_reports) {
+    if (OpenAPI_json_write_array_start(writer, "policyDecFailureReports") == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *policy_dec_failure_reports_node;
+    OpenAPI_list_for_each(partial_success_report->policy_dec_failure_reports, policy_dec_failure_reports_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_decision_failure_code_ToString((intptr_t)policy_dec_failure_reports_node->data)) == false) {
+            ogs_error("OpenAPI_partial_success_report_writeJSON() failed [policy_dec_failure_reports]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_partial_success_report_writeJSON() failed [PartialSuccessReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_parseFromJSON(cJSON *partial_success_reportJSON)
 {
     OpenAPI_partial_success_report_t *partial_success_report_local_var = NULL;
@@ -249,7 +343,6 @@ end:
 OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_copy(OpenAPI_partial_success_report_t *dst, OpenAPI_partial_success_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_partial_success_report_convertToJSON(src);
@@ -258,21 +351,6 @@ OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_copy(OpenAPI_pa
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_partial_success_report_free(dst);
     dst = OpenAPI_partial_success_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "failure_cause.h"
 #include "policy_decision_failure_code.h"
 #include "rule_report.h"
@@ -41,6 +42,7 @@ OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_create(
 void OpenAPI_partial_success_report_free(OpenAPI_partial_success_report_t *partial_success_report);
 OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_parseFromJSON(cJSON *partial_success_reportJSON);
 cJSON *OpenAPI_partial_success_report_convertToJSON(OpenAPI_partial_success_report_t *partial_success_report);
+bool OpenAPI_partial_success_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_partial_success_report_t *partial_success_report);
 OpenAPI_partial_success_report_t *OpenAPI_partial_success_report_copy(OpenAPI_partial_success_report_t *dst, OpenAPI_partial_success_report_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_patch_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_patch_result_t *patch_result)
+{
+    if (patch_result == NULL) {
+        ogs_error("OpenAPI_patch_result_writeJSON() failed [PatchResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_patch_result_writeJSON() failed [PatchResult]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "report") == false) {
+        ogs_error("OpenAPI_patch_result_writeJSON() failed [report]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *report_node;
+    if (patch_result->report) {
+        OpenAPI_list_for_each(patch_result->report, report_node) {
+            if (OpenAPI_report_item_writeJSON(writer, NULL, report_node->data) == false) {
+                ogs_error("OpenAPI_patch_result_writeJSON() failed [report]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_patch_result_writeJSON() failed [report]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_patch_result_writeJSON() failed [PatchResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_patch_result_t *OpenAPI_patch_result_parseFromJSON(cJSON *patch_resultJSON)
 {
     OpenAPI_patch_result_t *patch_result_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_patch_result_t *OpenAPI_patch_result_copy(OpenAPI_patch_result_t *dst, OpenAPI_patch_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_patch_result_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_patch_result_t *OpenAPI_patch_result_copy(OpenAPI_patch_result_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_patch_result_free(dst);
     dst = OpenAPI_patch_result_parseFromJSON(item);
     cJSON_Delete(item);
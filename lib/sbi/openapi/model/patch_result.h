@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "report_item.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_patch_result_t *OpenAPI_patch_result_create(
 void OpenAPI_patch_result_free(OpenAPI_patch_result_t *patch_result);
 OpenAPI_patch_result_t *OpenAPI_patch_result_parseFromJSON(cJSON *patch_resultJSON);
 cJSON *OpenAPI_patch_result_convertToJSON(OpenAPI_patch_result_t *patch_result);
+bool OpenAPI_patch_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_patch_result_t *patch_result);
 OpenAPI_patch_result_t *OpenAPI_patch_result_copy(OpenAPI_patch_result_t *dst, OpenAPI_patch_result_t *src);
 
 #ifdef __cplusplus
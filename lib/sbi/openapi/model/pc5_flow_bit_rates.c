@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_pc5_flow_bit_rates_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pc5_flow_bit_rates_t *pc5_flow_bit_rates)
+{
+    if (pc5_flow_bit_rates == NULL) {
+        ogs_error("OpenAPI_pc5_flow_bit_rates_writeJSON() failed [Pc5FlowBitRates]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pc5_flow_bit_rates_writeJSON() failed [Pc5FlowBitRates]");
+        return false;
+    }
+    if (pc5_flow_bit_rates->gua_fbr) {
+    if (OpenAPI_json_write_string(writer, "guaFbr", pc5_flow_bit_rates->gua_fbr) == false) {
+        ogs_error("OpenAPI_pc5_flow_bit_rates_writeJSON() failed [gua_fbr]");
+        goto end;
+    }
+    }
+
+    if (pc5_flow_bit_rates->max_fbr) {
+    if (OpenAPI_json_write_string(writer, "maxFbr", pc5_flow_bit_rates->max_fbr) == false) {
+        ogs_error("OpenAPI_pc5_flow_bit_rates_writeJSON() failed [max_fbr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pc5_flow_bit_rates_writeJSON() failed [Pc5FlowBitRates]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pc5_flow_bit_rates_t *OpenAPI_pc5_flow_bit_rates_parseFromJSON(cJSON *pc5_flow_bit_ratesJSON)
 {
     OpenAPI_pc5_flow_bit_rates_t *pc5_flow_bit_rates_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_pc5_flow_bit_rates_t *OpenAPI_pc5_flow_bit_rates_copy(OpenAPI_pc5_flow_bit_rates_t *dst, OpenAPI_pc5_flow_bit_rates_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pc5_flow_bit_rates_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_pc5_flow_bit_rates_t *OpenAPI_pc5_flow_bit_rates_copy(OpenAPI_pc5_flow_b
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pc5_flow_bit_rates_free(dst);
     dst = OpenAPI_pc5_flow_bit_rates_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,6 +71,54 @@ end:
     return item;
 }
 
+bool OpenAPI_pc5_qo_s_para_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pc5_qo_s_para_t *pc5_qo_s_para)
+{
+    if (pc5_qo_s_para == NULL) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [Pc5QoSPara]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [Pc5QoSPara]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "pc5QosFlowList") == false) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [pc5_qos_flow_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pc5_qos_flow_list_node;
+    if (pc5_qo_s_para->pc5_qos_flow_list) {
+        OpenAPI_list_for_each(pc5_qo_s_para->pc5_qos_flow_list, pc5_qos_flow_list_node) {
+            if (OpenAPI_pc5_qos_flow_item_writeJSON(writer, NULL, pc5_qos_flow_list_node->data) == false) {
+                ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [pc5_qos_flow_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [pc5_qos_flow_list]");
+        goto end;
+    }
+
+    if (pc5_qo_s_para->pc5_link_ambr) {
+    if (OpenAPI_json_write_string(writer, "pc5LinkAmbr", pc5_qo_s_para->pc5_link_ambr) == false) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [pc5_link_ambr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pc5_qo_s_para_writeJSON() failed [Pc5QoSPara]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_parseFromJSON(cJSON *pc5_qo_s_paraJSON)
 {
     OpenAPI_pc5_qo_s_para_t *pc5_qo_s_para_local_var = NULL;
@@ -127,7 +175,6 @@ end:
 OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_copy(OpenAPI_pc5_qo_s_para_t *dst, OpenAPI_pc5_qo_s_para_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pc5_qo_s_para_convertToJSON(src);
@@ -136,21 +183,6 @@ OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_copy(OpenAPI_pc5_qo_s_para_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pc5_qo_s_para_free(dst);
     dst = OpenAPI_pc5_qo_s_para_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pc5_qos_flow_item.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_create(
 void OpenAPI_pc5_qo_s_para_free(OpenAPI_pc5_qo_s_para_t *pc5_qo_s_para);
 OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_parseFromJSON(cJSON *pc5_qo_s_paraJSON);
 cJSON *OpenAPI_pc5_qo_s_para_convertToJSON(OpenAPI_pc5_qo_s_para_t *pc5_qo_s_para);
+bool OpenAPI_pc5_qo_s_para_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pc5_qo_s_para_t *pc5_qo_s_para);
 OpenAPI_pc5_qo_s_para_t *OpenAPI_pc5_qo_s_para_copy(OpenAPI_pc5_qo_s_para_t *dst, OpenAPI_pc5_qo_s_para_t *src);
 
 #ifdef __cplusplus
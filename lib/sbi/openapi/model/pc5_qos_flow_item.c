@@ -71,6 +71,47 @@ end:
     return item;
 }
 
+bool OpenAPI_pc5_qos_flow_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pc5_qos_flow_item_t *pc5_qos_flow_item)
+{
+    if (pc5_qos_flow_item == NULL) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [Pc5QosFlowItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [Pc5QosFlowItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pqi", pc5_qos_flow_item->pqi) == false) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [pqi]");
+        goto end;
+    }
+
+    if (pc5_qos_flow_item->pc5_flow_bit_rates) {
+    if (OpenAPI_pc5_flow_bit_rates_writeJSON(writer, "pc5FlowBitRates", pc5_qos_flow_item->pc5_flow_bit_rates) == false) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [pc5_flow_bit_rates]");
+        goto end;
+    }
+    }
+
+    if (pc5_qos_flow_item->is_range) {
+    if (OpenAPI_json_write_number(writer, "range", pc5_qos_flow_item->range) == false) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [range]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pc5_qos_flow_item_writeJSON() failed [Pc5QosFlowItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pc5_qos_flow_item_t *OpenAPI_pc5_qos_flow_item_parseFromJSON(cJSON *pc5_qos_flow_itemJSON)
 {
     OpenAPI_pc5_qos_flow_item_t *pc5_qos_flow_item_local_var = NULL;
@@ -117,7 +158,6 @@ end:
 OpenAPI_pc5_qos_flow_item_t *OpenAPI_pc5_qos_flow_item_copy(OpenAPI_pc5_qos_flow_item_t *dst, OpenAPI_pc5_qos_flow_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pc5_qos_flow_item_convertToJSON(src);
@@ -126,21 +166,6 @@ OpenAPI_pc5_qos_flow_item_t *OpenAPI_pc5_qos_flow_item_copy(OpenAPI_pc5_qos_flow
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pc5_qos_flow_item_free(dst);
     dst = OpenAPI_pc5_qos_flow_item_parseFromJSON(item);
     cJSON_Delete(item);
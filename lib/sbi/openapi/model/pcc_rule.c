@@ -404,6 +404,297 @@ end:
     return item;
 }
 
+bool OpenAPI_pcc_rule_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcc_rule_t *pcc_rule)
+{
+    if (pcc_rule == NULL) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [PccRule]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [PccRule]");
+        return false;
+    }
+    if (pcc_rule->flow_infos) {
+    if (OpenAPI_json_write_array_start(writer, "flowInfos") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [flow_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flow_infos_node;
+    if (pcc_rule->flow_infos) {
+        OpenAPI_list_for_each(pcc_rule->flow_infos, flow_infos_node) {
+            if (OpenAPI_flow_information_writeJSON(writer, NULL, flow_infos_node->data) == false) {
+                ogs_error("OpenAPI_pcc_rule_writeJSON() failed [flow_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [flow_infos]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->app_id) {
+    if (OpenAPI_json_write_string(writer, "appId", pcc_rule->app_id) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [app_id]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->app_descriptor) {
+    if (OpenAPI_json_write_number(writer, "appDescriptor", pcc_rule->app_descriptor) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [app_descriptor]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->is_cont_ver) {
+    if (OpenAPI_json_write_number(writer, "contVer", pcc_rule->cont_ver) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [cont_ver]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "pccRuleId", pcc_rule->pcc_rule_id) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [pcc_rule_id]");
+        goto end;
+    }
+
+    if (pcc_rule->is_precedence) {
+    if (OpenAPI_json_write_number(writer, "precedence", pcc_rule->precedence) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [precedence]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->af_sig_protocol) {
+    if (OpenAPI_json_write_string(writer, "afSigProtocol", OpenAPI_af_sig_protocol_ToString(pcc_rule->af_sig_protocol)) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [af_sig_protocol]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->is_app_reloc) {
+    if (OpenAPI_json_write_bool(writer, "appReloc", pcc_rule->app_reloc) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [app_reloc]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_qos_data) {
+    if (OpenAPI_json_write_array_start(writer, "refQosData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_qos_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_qos_data, ref_qos_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_qos_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_alt_qos_params) {
+    if (OpenAPI_json_write_array_start(writer, "refAltQosParams") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_alt_qos_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_alt_qos_params_node;
+    OpenAPI_list_for_each(pcc_rule->ref_alt_qos_params, ref_alt_qos_params_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_alt_qos_params_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_alt_qos_params]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_alt_qos_params]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_tc_data) {
+    if (OpenAPI_json_write_array_start(writer, "refTcData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_tc_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_tc_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_tc_data, ref_tc_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_tc_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_tc_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_tc_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_chg_data) {
+    if (OpenAPI_json_write_array_start(writer, "refChgData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_chg_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_chg_data, ref_chg_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_chg_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_chg_n3g_data) {
+    if (OpenAPI_json_write_array_start(writer, "refChgN3gData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_n3g_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_chg_n3g_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_chg_n3g_data, ref_chg_n3g_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_chg_n3g_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_n3g_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_chg_n3g_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_um_data) {
+    if (OpenAPI_json_write_array_start(writer, "refUmData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_um_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_um_data, ref_um_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_um_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_um_n3g_data) {
+    if (OpenAPI_json_write_array_start(writer, "refUmN3gData") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_n3g_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_um_n3g_data_node;
+    OpenAPI_list_for_each(pcc_rule->ref_um_n3g_data, ref_um_n3g_data_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_um_n3g_data_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_n3g_data]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_um_n3g_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_cond_data) {
+    if (OpenAPI_json_write_string(writer, "refCondData", pcc_rule->ref_cond_data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_cond_data]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->ref_qos_mon) {
+    if (OpenAPI_json_write_array_start(writer, "refQosMon") == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_mon]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_qos_mon_node;
+    OpenAPI_list_for_each(pcc_rule->ref_qos_mon, ref_qos_mon_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_qos_mon_node->data) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_mon]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [ref_qos_mon]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->is_addr_preser_ind) {
+    if (OpenAPI_json_write_bool(writer, "addrPreserInd", pcc_rule->addr_preser_ind) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [addr_preser_ind]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->tscai_input_dl) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputDl", pcc_rule->tscai_input_dl) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [tscai_input_dl]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->tscai_input_ul) {
+    if (OpenAPI_tscai_input_container_writeJSON(writer, "tscaiInputUl", pcc_rule->tscai_input_ul) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [tscai_input_ul]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->dd_notif_ctrl) {
+    if (OpenAPI_downlink_data_notification_control_writeJSON(writer, "ddNotifCtrl", pcc_rule->dd_notif_ctrl) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [dd_notif_ctrl]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->dd_notif_ctrl2) {
+    if (OpenAPI_downlink_data_notification_control_rm_writeJSON(writer, "ddNotifCtrl2", pcc_rule->dd_notif_ctrl2) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [dd_notif_ctrl2]");
+        goto end;
+    }
+    }
+
+    if (pcc_rule->is_dis_ue_notif) {
+    if (OpenAPI_json_write_bool(writer, "disUeNotif", pcc_rule->dis_ue_notif) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [dis_ue_notif]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcc_rule_writeJSON() failed [PccRule]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_parseFromJSON(cJSON *pcc_ruleJSON)
 {
     OpenAPI_pcc_rule_t *pcc_rule_local_var = NULL;
@@ -757,7 +1048,6 @@ end:
 OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_copy(OpenAPI_pcc_rule_t *dst, OpenAPI_pcc_rule_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcc_rule_convertToJSON(src);
@@ -766,21 +1056,6 @@ OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_copy(OpenAPI_pcc_rule_t *dst, OpenAPI_pcc_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcc_rule_free(dst);
     dst = OpenAPI_pcc_rule_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "af_sig_protocol.h"
 #include "downlink_data_notification_control.h"
 #include "downlink_data_notification_control_rm.h"
@@ -87,6 +88,7 @@ OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_create(
 void OpenAPI_pcc_rule_free(OpenAPI_pcc_rule_t *pcc_rule);
 OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_parseFromJSON(cJSON *pcc_ruleJSON);
 cJSON *OpenAPI_pcc_rule_convertToJSON(OpenAPI_pcc_rule_t *pcc_rule);
+bool OpenAPI_pcc_rule_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcc_rule_t *pcc_rule);
 OpenAPI_pcc_rule_t *OpenAPI_pcc_rule_copy(OpenAPI_pcc_rule_t *dst, OpenAPI_pcc_rule_t *src);
 
 #ifdef __cplusplus
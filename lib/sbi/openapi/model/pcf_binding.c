@@ -364,6 +364,268 @@ end:
     return item;
 }
 
+bool OpenAPI_pcf_binding_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_binding_t *pcf_binding)
+{
+    if (pcf_binding == NULL) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [PcfBinding]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [PcfBinding]");
+        return false;
+    }
+    if (pcf_binding->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", pcf_binding->supi) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", pcf_binding->gpsi) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", pcf_binding->ipv4_addr) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6Prefix", pcf_binding->ipv6_prefix) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->add_ipv6_prefixes) {
+    if (OpenAPI_json_write_array_start(writer, "addIpv6Prefixes") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_ipv6_prefixes_node;
+    OpenAPI_list_for_each(pcf_binding->add_ipv6_prefixes, add_ipv6_prefixes_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)add_ipv6_prefixes_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", pcf_binding->ip_domain) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->mac_addr48) {
+    if (OpenAPI_json_write_string(writer, "macAddr48", pcf_binding->mac_addr48) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [mac_addr48]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->add_mac_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "addMacAddrs") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_mac_addrs_node;
+    OpenAPI_list_for_each(pcf_binding->add_mac_addrs, add_mac_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)add_mac_addrs_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnn", pcf_binding->dnn) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (pcf_binding->pcf_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pcfFqdn", pcf_binding->pcf_fqdn) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_fqdn]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "pcfIpEndPoints") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pcf_ip_end_points_node;
+    if (pcf_binding->pcf_ip_end_points) {
+        OpenAPI_list_for_each(pcf_binding->pcf_ip_end_points, pcf_ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, pcf_ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_diam_host) {
+    if (OpenAPI_json_write_string(writer, "pcfDiamHost", pcf_binding->pcf_diam_host) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_diam_host]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_diam_realm) {
+    if (OpenAPI_json_write_string(writer, "pcfDiamRealm", pcf_binding->pcf_diam_realm) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_diam_realm]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_sm_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pcfSmFqdn", pcf_binding->pcf_sm_fqdn) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_sm_fqdn]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_sm_ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "pcfSmIpEndPoints") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_sm_ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pcf_sm_ip_end_points_node;
+    if (pcf_binding->pcf_sm_ip_end_points) {
+        OpenAPI_list_for_each(pcf_binding->pcf_sm_ip_end_points, pcf_sm_ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, pcf_sm_ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_sm_ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_sm_ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", pcf_binding->snssai) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (pcf_binding->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", pcf_binding->supp_feat) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", pcf_binding->pcf_id) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->pcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfSetId", pcf_binding->pcf_set_id) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [pcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", pcf_binding->recovery_time) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->para_com) {
+    if (OpenAPI_parameter_combination_writeJSON(writer, "paraCom", pcf_binding->para_com) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [para_com]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->bind_level) {
+    if (OpenAPI_json_write_string(writer, "bindLevel", OpenAPI_binding_level_ToString(pcf_binding->bind_level)) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [bind_level]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->ipv4_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4FrameRouteList") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_frame_route_list_node;
+    OpenAPI_list_for_each(pcf_binding->ipv4_frame_route_list, ipv4_frame_route_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_frame_route_list_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding->ipv6_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6FrameRouteList") == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_frame_route_list_node;
+    OpenAPI_list_for_each(pcf_binding->ipv6_frame_route_list, ipv6_frame_route_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_frame_route_list_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_writeJSON() failed [PcfBinding]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_parseFromJSON(cJSON *pcf_bindingJSON)
 {
     OpenAPI_pcf_binding_t *pcf_binding_local_var = NULL;
@@ -704,7 +966,6 @@ end:
 OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_copy(OpenAPI_pcf_binding_t *dst, OpenAPI_pcf_binding_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcf_binding_convertToJSON(src);
@@ -713,21 +974,6 @@ OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_copy(OpenAPI_pcf_binding_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcf_binding_free(dst);
     dst = OpenAPI_pcf_binding_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "binding_level.h"
 #include "ip_end_point.h"
 #include "parameter_combination.h"
@@ -78,6 +79,7 @@ OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_create(
 void OpenAPI_pcf_binding_free(OpenAPI_pcf_binding_t *pcf_binding);
 OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_parseFromJSON(cJSON *pcf_bindingJSON);
 cJSON *OpenAPI_pcf_binding_convertToJSON(OpenAPI_pcf_binding_t *pcf_binding);
+bool OpenAPI_pcf_binding_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_binding_t *pcf_binding);
 OpenAPI_pcf_binding_t *OpenAPI_pcf_binding_copy(OpenAPI_pcf_binding_t *dst, OpenAPI_pcf_binding_t *src);
 
 #ifdef __cplusplus
@@ -187,6 +187,143 @@ end:
     return item;
 }
 
+bool OpenAPI_pcf_binding_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_binding_patch_t *pcf_binding_patch)
+{
+    if (pcf_binding_patch == NULL) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [PcfBindingPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [PcfBindingPatch]");
+        return false;
+    }
+    if (pcf_binding_patch->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", pcf_binding_patch->ipv4_addr) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", pcf_binding_patch->ip_domain) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6Prefix", pcf_binding_patch->ipv6_prefix) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->add_ipv6_prefixes) {
+    if (OpenAPI_json_write_array_start(writer, "addIpv6Prefixes") == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_ipv6_prefixes_node;
+    OpenAPI_list_for_each(pcf_binding_patch->add_ipv6_prefixes, add_ipv6_prefixes_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)add_ipv6_prefixes_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_ipv6_prefixes]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->mac_addr48) {
+    if (OpenAPI_json_write_string(writer, "macAddr48", pcf_binding_patch->mac_addr48) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [mac_addr48]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->add_mac_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "addMacAddrs") == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_mac_addrs_node;
+    OpenAPI_list_for_each(pcf_binding_patch->add_mac_addrs, add_mac_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)add_mac_addrs_node->data) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [add_mac_addrs]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", pcf_binding_patch->pcf_id) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->pcf_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pcfFqdn", pcf_binding_patch->pcf_fqdn) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_fqdn]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->pcf_ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "pcfIpEndPoints") == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pcf_ip_end_points_node;
+    if (pcf_binding_patch->pcf_ip_end_points) {
+        OpenAPI_list_for_each(pcf_binding_patch->pcf_ip_end_points, pcf_ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, pcf_ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->pcf_diam_host) {
+    if (OpenAPI_json_write_string(writer, "pcfDiamHost", pcf_binding_patch->pcf_diam_host) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_diam_host]");
+        goto end;
+    }
+    }
+
+    if (pcf_binding_patch->pcf_diam_realm) {
+    if (OpenAPI_json_write_string(writer, "pcfDiamRealm", pcf_binding_patch->pcf_diam_realm) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [pcf_diam_realm]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_binding_patch_writeJSON() failed [PcfBindingPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_parseFromJSON(cJSON *pcf_binding_patchJSON)
 {
     OpenAPI_pcf_binding_patch_t *pcf_binding_patch_local_var = NULL;
@@ -353,7 +490,6 @@ end:
 OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_copy(OpenAPI_pcf_binding_patch_t *dst, OpenAPI_pcf_binding_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcf_binding_patch_convertToJSON(src);
@@ -362,21 +498,6 @@ OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_copy(OpenAPI_pcf_binding_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcf_binding_patch_free(dst);
     dst = OpenAPI_pcf_binding_patch_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_end_point.h"
 
 #ifdef __cplusplus
@@ -49,6 +50,7 @@ OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_create(
 void OpenAPI_pcf_binding_patch_free(OpenAPI_pcf_binding_patch_t *pcf_binding_patch);
 OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_parseFromJSON(cJSON *pcf_binding_patchJSON);
 cJSON *OpenAPI_pcf_binding_patch_convertToJSON(OpenAPI_pcf_binding_patch_t *pcf_binding_patch);
+bool OpenAPI_pcf_binding_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_binding_patch_t *pcf_binding_patch);
 OpenAPI_pcf_binding_patch_t *OpenAPI_pcf_binding_patch_copy(OpenAPI_pcf_binding_patch_t *dst, OpenAPI_pcf_binding_patch_t *src);
 
 #ifdef __cplusplus
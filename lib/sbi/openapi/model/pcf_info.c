@@ -152,6 +152,117 @@ end:
     return item;
 }
 
+bool OpenAPI_pcf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_info_t *pcf_info)
+{
+    if (pcf_info == NULL) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [PcfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [PcfInfo]");
+        return false;
+    }
+    if (pcf_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", pcf_info->group_id) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->dnn_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnnList") == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_list_node;
+    OpenAPI_list_for_each(pcf_info->dnn_list, dnn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnn_list_node->data) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->supi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "supiRanges") == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_ranges_node;
+    if (pcf_info->supi_ranges) {
+        OpenAPI_list_for_each(pcf_info->supi_ranges, supi_ranges_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_pcf_info_writeJSON() failed [supi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->gpsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRanges") == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_ranges_node;
+    if (pcf_info->gpsi_ranges) {
+        OpenAPI_list_for_each(pcf_info->gpsi_ranges, gpsi_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_pcf_info_writeJSON() failed [gpsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->rx_diam_host) {
+    if (OpenAPI_json_write_string(writer, "rxDiamHost", pcf_info->rx_diam_host) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [rx_diam_host]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->rx_diam_realm) {
+    if (OpenAPI_json_write_string(writer, "rxDiamRealm", pcf_info->rx_diam_realm) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [rx_diam_realm]");
+        goto end;
+    }
+    }
+
+    if (pcf_info->is_v2x_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "v2xSupportInd", pcf_info->v2x_support_ind) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [v2x_support_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcf_info_writeJSON() failed [PcfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcf_info_t *OpenAPI_pcf_info_parseFromJSON(cJSON *pcf_infoJSON)
 {
     OpenAPI_pcf_info_t *pcf_info_local_var = NULL;
@@ -288,7 +399,6 @@ end:
 OpenAPI_pcf_info_t *OpenAPI_pcf_info_copy(OpenAPI_pcf_info_t *dst, OpenAPI_pcf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcf_info_convertToJSON(src);
@@ -297,21 +407,6 @@ OpenAPI_pcf_info_t *OpenAPI_pcf_info_copy(OpenAPI_pcf_info_t *dst, OpenAPI_pcf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcf_info_free(dst);
     dst = OpenAPI_pcf_info_parseFromJSON(item);
     cJSON_Delete(item);
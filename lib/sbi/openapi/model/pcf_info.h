@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "identity_range.h"
 #include "supi_range.h"
 
@@ -44,6 +45,7 @@ OpenAPI_pcf_info_t *OpenAPI_pcf_info_create(
 void OpenAPI_pcf_info_free(OpenAPI_pcf_info_t *pcf_info);
 OpenAPI_pcf_info_t *OpenAPI_pcf_info_parseFromJSON(cJSON *pcf_infoJSON);
 cJSON *OpenAPI_pcf_info_convertToJSON(OpenAPI_pcf_info_t *pcf_info);
+bool OpenAPI_pcf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcf_info_t *pcf_info);
 OpenAPI_pcf_info_t *OpenAPI_pcf_info_copy(OpenAPI_pcf_info_t *dst, OpenAPI_pcf_info_t *src);
 
 #ifdef __cplusplus
@@ -183,6 +183,152 @@ end:
     return item;
 }
 
+bool OpenAPI_pcscf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcscf_info_t *pcscf_info)
+{
+    if (pcscf_info == NULL) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [PcscfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [PcscfInfo]");
+        return false;
+    }
+    if (pcscf_info->access_type) {
+    if (OpenAPI_json_write_array_start(writer, "accessType") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+    OpenAPI_lnode_t *access_type_node;
+    OpenAPI_list_for_each(pcscf_info->access_type, access_type_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)access_type_node->data)) == false) {
+            ogs_error("OpenAPI_pcscf_info_writeJSON() failed [access_type]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->dnn_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnnList") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_list_node;
+    OpenAPI_list_for_each(pcscf_info->dnn_list, dnn_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnn_list_node->data) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [dnn_list]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->gm_fqdn) {
+    if (OpenAPI_json_write_string(writer, "gmFqdn", pcscf_info->gm_fqdn) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_fqdn]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->gm_ipv4_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "gmIpv4Addresses") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv4_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gm_ipv4_addresses_node;
+    OpenAPI_list_for_each(pcscf_info->gm_ipv4_addresses, gm_ipv4_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gm_ipv4_addresses_node->data) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv4_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv4_addresses]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->gm_ipv6_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "gmIpv6Addresses") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv6_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gm_ipv6_addresses_node;
+    OpenAPI_list_for_each(pcscf_info->gm_ipv6_addresses, gm_ipv6_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gm_ipv6_addresses_node->data) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv6_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [gm_ipv6_addresses]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->served_ipv4_address_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "servedIpv4AddressRanges") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv4_address_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *served_ipv4_address_ranges_node;
+    if (pcscf_info->served_ipv4_address_ranges) {
+        OpenAPI_list_for_each(pcscf_info->served_ipv4_address_ranges, served_ipv4_address_ranges_node) {
+            if (OpenAPI_ipv4_address_range_writeJSON(writer, NULL, served_ipv4_address_ranges_node->data) == false) {
+                ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv4_address_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv4_address_ranges]");
+        goto end;
+    }
+    }
+
+    if (pcscf_info->served_ipv6_prefix_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "servedIpv6PrefixRanges") == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv6_prefix_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *served_ipv6_prefix_ranges_node;
+    if (pcscf_info->served_ipv6_prefix_ranges) {
+        OpenAPI_list_for_each(pcscf_info->served_ipv6_prefix_ranges, served_ipv6_prefix_ranges_node) {
+            if (OpenAPI_ipv6_prefix_range_writeJSON(writer, NULL, served_ipv6_prefix_ranges_node->data) == false) {
+                ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv6_prefix_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [served_ipv6_prefix_ranges]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_info_writeJSON() failed [PcscfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_parseFromJSON(cJSON *pcscf_infoJSON)
 {
     OpenAPI_pcscf_info_t *pcscf_info_local_var = NULL;
@@ -353,7 +499,6 @@ end:
 OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_copy(OpenAPI_pcscf_info_t *dst, OpenAPI_pcscf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcscf_info_convertToJSON(src);
@@ -362,21 +507,6 @@ OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_copy(OpenAPI_pcscf_info_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcscf_info_free(dst);
     dst = OpenAPI_pcscf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "ipv4_address_range.h"
 #include "ipv6_prefix_range.h"
@@ -43,6 +44,7 @@ OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_create(
 void OpenAPI_pcscf_info_free(OpenAPI_pcscf_info_t *pcscf_info);
 OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_parseFromJSON(cJSON *pcscf_infoJSON);
 cJSON *OpenAPI_pcscf_info_convertToJSON(OpenAPI_pcscf_info_t *pcscf_info);
+bool OpenAPI_pcscf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcscf_info_t *pcscf_info);
 OpenAPI_pcscf_info_t *OpenAPI_pcscf_info_copy(OpenAPI_pcscf_info_t *dst, OpenAPI_pcscf_info_t *src);
 
 #ifdef __cplusplus
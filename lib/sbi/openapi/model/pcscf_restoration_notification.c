@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_pcscf_restoration_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcscf_restoration_notification_t *pcscf_restoration_notification)
+{
+    if (pcscf_restoration_notification == NULL) {
+        ogs_error("OpenAPI_pcscf_restoration_notification_writeJSON() failed [PcscfRestorationNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_notification_writeJSON() failed [PcscfRestorationNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supi", pcscf_restoration_notification->supi) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_notification_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_notification_writeJSON() failed [PcscfRestorationNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcscf_restoration_notification_t *OpenAPI_pcscf_restoration_notification_parseFromJSON(cJSON *pcscf_restoration_notificationJSON)
 {
     OpenAPI_pcscf_restoration_notification_t *pcscf_restoration_notification_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_pcscf_restoration_notification_t *OpenAPI_pcscf_restoration_notification_copy(OpenAPI_pcscf_restoration_notification_t *dst, OpenAPI_pcscf_restoration_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcscf_restoration_notification_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_pcscf_restoration_notification_t *OpenAPI_pcscf_restoration_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcscf_restoration_notification_free(dst);
     dst = OpenAPI_pcscf_restoration_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -103,6 +103,70 @@ end:
     return item;
 }
 
+bool OpenAPI_pcscf_restoration_request_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pcscf_restoration_request_data_t *pcscf_restoration_request_data)
+{
+    if (pcscf_restoration_request_data == NULL) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [PcscfRestorationRequestData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [PcscfRestorationRequestData]");
+        return false;
+    }
+    if (pcscf_restoration_request_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", pcscf_restoration_request_data->dnn) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (pcscf_restoration_request_data->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", pcscf_restoration_request_data->ip_domain) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (pcscf_restoration_request_data->slice_info) {
+    if (OpenAPI_snssai_writeJSON(writer, "sliceInfo", pcscf_restoration_request_data->slice_info) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [slice_info]");
+        goto end;
+    }
+    }
+
+    if (pcscf_restoration_request_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", pcscf_restoration_request_data->supi) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (pcscf_restoration_request_data->ue_ipv4) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4", pcscf_restoration_request_data->ue_ipv4) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [ue_ipv4]");
+        goto end;
+    }
+    }
+
+    if (pcscf_restoration_request_data->ue_ipv6) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6", pcscf_restoration_request_data->ue_ipv6) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [ue_ipv6]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pcscf_restoration_request_data_writeJSON() failed [PcscfRestorationRequestData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pcscf_restoration_request_data_t *OpenAPI_pcscf_restoration_request_data_parseFromJSON(cJSON *pcscf_restoration_request_dataJSON)
 {
     OpenAPI_pcscf_restoration_request_data_t *pcscf_restoration_request_data_local_var = NULL;
@@ -175,7 +239,6 @@ end:
 OpenAPI_pcscf_restoration_request_data_t *OpenAPI_pcscf_restoration_request_data_copy(OpenAPI_pcscf_restoration_request_data_t *dst, OpenAPI_pcscf_restoration_request_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pcscf_restoration_request_data_convertToJSON(src);
@@ -184,21 +247,6 @@ OpenAPI_pcscf_restoration_request_data_t *OpenAPI_pcscf_restoration_request_data
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pcscf_restoration_request_data_free(dst);
     dst = OpenAPI_pcscf_restoration_request_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -83,6 +83,50 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_t *pdu_session)
+{
+    if (pdu_session == NULL) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [PduSession]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [PduSession]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", pdu_session->smf_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", pdu_session->plmn_id) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (pdu_session->single_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", pdu_session->single_nssai) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_writeJSON() failed [PduSession]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_t *OpenAPI_pdu_session_parseFromJSON(cJSON *pdu_sessionJSON)
 {
     OpenAPI_pdu_session_t *pdu_session_local_var = NULL;
@@ -139,7 +183,6 @@ end:
 OpenAPI_pdu_session_t *OpenAPI_pdu_session_copy(OpenAPI_pdu_session_t *dst, OpenAPI_pdu_session_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_convertToJSON(src);
@@ -148,21 +191,6 @@ OpenAPI_pdu_session_t *OpenAPI_pdu_session_copy(OpenAPI_pdu_session_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_free(dst);
     dst = OpenAPI_pdu_session_parseFromJSON(item);
     cJSON_Delete(item);
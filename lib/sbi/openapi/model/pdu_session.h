@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 #include "snssai.h"
 
@@ -36,6 +37,7 @@ OpenAPI_pdu_session_t *OpenAPI_pdu_session_create(
 void OpenAPI_pdu_session_free(OpenAPI_pdu_session_t *pdu_session);
 OpenAPI_pdu_session_t *OpenAPI_pdu_session_parseFromJSON(cJSON *pdu_sessionJSON);
 cJSON *OpenAPI_pdu_session_convertToJSON(OpenAPI_pdu_session_t *pdu_session);
+bool OpenAPI_pdu_session_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_t *pdu_session);
 OpenAPI_pdu_session_t *OpenAPI_pdu_session_copy(OpenAPI_pdu_session_t *dst, OpenAPI_pdu_session_t *src);
 
 #ifdef __cplusplus
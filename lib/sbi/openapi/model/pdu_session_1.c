@@ -83,6 +83,50 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_1_t *pdu_session_1)
+{
+    if (pdu_session_1 == NULL) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [PduSession_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [PduSession_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session_1->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", pdu_session_1->smf_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", pdu_session_1->plmn_id) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (pdu_session_1->single_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", pdu_session_1->single_nssai) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_1_writeJSON() failed [PduSession_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_parseFromJSON(cJSON *pdu_session_1JSON)
 {
     OpenAPI_pdu_session_1_t *pdu_session_1_local_var = NULL;
@@ -139,7 +183,6 @@ end:
 OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_copy(OpenAPI_pdu_session_1_t *dst, OpenAPI_pdu_session_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_1_convertToJSON(src);
@@ -148,21 +191,6 @@ OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_copy(OpenAPI_pdu_session_1_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_1_free(dst);
     dst = OpenAPI_pdu_session_1_parseFromJSON(item);
     cJSON_Delete(item);
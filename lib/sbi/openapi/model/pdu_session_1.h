@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 #include "snssai.h"
 
@@ -36,6 +37,7 @@ OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_create(
 void OpenAPI_pdu_session_1_free(OpenAPI_pdu_session_1_t *pdu_session_1);
 OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_parseFromJSON(cJSON *pdu_session_1JSON);
 cJSON *OpenAPI_pdu_session_1_convertToJSON(OpenAPI_pdu_session_1_t *pdu_session_1);
+bool OpenAPI_pdu_session_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_1_t *pdu_session_1);
 OpenAPI_pdu_session_1_t *OpenAPI_pdu_session_1_copy(OpenAPI_pdu_session_1_t *dst, OpenAPI_pdu_session_1_t *src);
 
 #ifdef __cplusplus
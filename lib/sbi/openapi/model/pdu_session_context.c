@@ -290,6 +290,200 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_context_t *pdu_session_context)
+{
+    if (pdu_session_context == NULL) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [PduSessionContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [PduSessionContext]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", pdu_session_context->pdu_session_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "smContextRef", pdu_session_context->sm_context_ref) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [sm_context_ref]");
+        goto end;
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", pdu_session_context->s_nssai) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session_context->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (pdu_session_context->selected_dnn) {
+    if (OpenAPI_json_write_string(writer, "selectedDnn", pdu_session_context->selected_dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [selected_dnn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(pdu_session_context->access_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (pdu_session_context->additional_access_type) {
+    if (OpenAPI_json_write_string(writer, "additionalAccessType", OpenAPI_access_type_ToString(pdu_session_context->additional_access_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [additional_access_type]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->allocated_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "allocatedEbiList") == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allocated_ebi_list_node;
+    if (pdu_session_context->allocated_ebi_list) {
+        OpenAPI_list_for_each(pdu_session_context->allocated_ebi_list, allocated_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, allocated_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [allocated_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->hsmf_id) {
+    if (OpenAPI_json_write_string(writer, "hsmfId", pdu_session_context->hsmf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [hsmf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->hsmf_set_id) {
+    if (OpenAPI_json_write_string(writer, "hsmfSetId", pdu_session_context->hsmf_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [hsmf_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->hsmf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "hsmfServiceSetId", pdu_session_context->hsmf_service_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [hsmf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->smf_binding) {
+    if (OpenAPI_json_write_string(writer, "smfBinding", OpenAPI_sbi_binding_level_ToString(pdu_session_context->smf_binding)) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [smf_binding]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->vsmf_id) {
+    if (OpenAPI_json_write_string(writer, "vsmfId", pdu_session_context->vsmf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [vsmf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->vsmf_set_id) {
+    if (OpenAPI_json_write_string(writer, "vsmfSetId", pdu_session_context->vsmf_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [vsmf_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->vsmf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "vsmfServiceSetId", pdu_session_context->vsmf_service_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [vsmf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->vsmf_binding) {
+    if (OpenAPI_json_write_string(writer, "vsmfBinding", OpenAPI_sbi_binding_level_ToString(pdu_session_context->vsmf_binding)) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [vsmf_binding]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->ismf_id) {
+    if (OpenAPI_json_write_string(writer, "ismfId", pdu_session_context->ismf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ismf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->ismf_set_id) {
+    if (OpenAPI_json_write_string(writer, "ismfSetId", pdu_session_context->ismf_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ismf_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->ismf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "ismfServiceSetId", pdu_session_context->ismf_service_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ismf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->ismf_binding) {
+    if (OpenAPI_json_write_string(writer, "ismfBinding", OpenAPI_sbi_binding_level_ToString(pdu_session_context->ismf_binding)) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ismf_binding]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->ns_instance) {
+    if (OpenAPI_json_write_string(writer, "nsInstance", pdu_session_context->ns_instance) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ns_instance]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfServiceInstanceId", pdu_session_context->smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->is_ma_pdu_session) {
+    if (OpenAPI_json_write_bool(writer, "maPduSession", pdu_session_context->ma_pdu_session) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [ma_pdu_session]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_context->cn_assisted_ran_para) {
+    if (OpenAPI_cn_assisted_ran_para_writeJSON(writer, "cnAssistedRanPara", pdu_session_context->cn_assisted_ran_para) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [cn_assisted_ran_para]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_context_writeJSON() failed [PduSessionContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_parseFromJSON(cJSON *pdu_session_contextJSON)
 {
     OpenAPI_pdu_session_context_t *pdu_session_context_local_var = NULL;
@@ -582,7 +776,6 @@ end:
 OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_copy(OpenAPI_pdu_session_context_t *dst, OpenAPI_pdu_session_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_context_convertToJSON(src);
@@ -591,21 +784,6 @@ OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_copy(OpenAPI_pdu_sess
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_context_free(dst);
     dst = OpenAPI_pdu_session_context_parseFromJSON(item);
     cJSON_Delete(item);
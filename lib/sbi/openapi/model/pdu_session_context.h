@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "cn_assisted_ran_para.h"
 #include "ebi_arp_mapping.h"
@@ -81,6 +82,7 @@ OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_create(
 void OpenAPI_pdu_session_context_free(OpenAPI_pdu_session_context_t *pdu_session_context);
 OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_parseFromJSON(cJSON *pdu_session_contextJSON);
 cJSON *OpenAPI_pdu_session_context_convertToJSON(OpenAPI_pdu_session_context_t *pdu_session_context);
+bool OpenAPI_pdu_session_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_context_t *pdu_session_context);
 OpenAPI_pdu_session_context_t *OpenAPI_pdu_session_context_copy(OpenAPI_pdu_session_context_t *dst, OpenAPI_pdu_session_context_t *src);
 
 #ifdef __cplusplus
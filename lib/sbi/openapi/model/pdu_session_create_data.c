@@ -798,6 +798,501 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_create_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_create_data_t *pdu_session_create_data)
+{
+    if (pdu_session_create_data == NULL) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [PduSessionCreateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [PduSessionCreateData]");
+        return false;
+    }
+    if (pdu_session_create_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", pdu_session_create_data->supi) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_unauthenticated_supi) {
+    if (OpenAPI_json_write_bool(writer, "unauthenticatedSupi", pdu_session_create_data->unauthenticated_supi) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [unauthenticated_supi]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", pdu_session_create_data->pei) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", pdu_session_create_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session_create_data->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (pdu_session_create_data->selected_dnn) {
+    if (OpenAPI_json_write_string(writer, "selectedDnn", pdu_session_create_data->selected_dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [selected_dnn]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", pdu_session_create_data->s_nssai) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->vsmf_id) {
+    if (OpenAPI_json_write_string(writer, "vsmfId", pdu_session_create_data->vsmf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [vsmf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->ismf_id) {
+    if (OpenAPI_json_write_string(writer, "ismfId", pdu_session_create_data->ismf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ismf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", pdu_session_create_data->serving_network) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+
+    if (pdu_session_create_data->request_type) {
+    if (OpenAPI_json_write_string(writer, "requestType", OpenAPI_request_type_ToString(pdu_session_create_data->request_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [request_type]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->eps_bearer_id) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerId") == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_id_node;
+    OpenAPI_list_for_each(pdu_session_create_data->eps_bearer_id, eps_bearer_id_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)eps_bearer_id_node->data) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [eps_bearer_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->pgw_s8c_fteid) {
+    if (OpenAPI_json_write_number(writer, "pgwS8cFteid", pdu_session_create_data->pgw_s8c_fteid) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pgw_s8c_fteid]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->vsmf_pdu_session_uri) {
+    if (OpenAPI_json_write_string(writer, "vsmfPduSessionUri", pdu_session_create_data->vsmf_pdu_session_uri) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [vsmf_pdu_session_uri]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->ismf_pdu_session_uri) {
+    if (OpenAPI_json_write_string(writer, "ismfPduSessionUri", pdu_session_create_data->ismf_pdu_session_uri) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ismf_pdu_session_uri]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->vcn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "vcnTunnelInfo", pdu_session_create_data->vcn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [vcn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->icn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "icnTunnelInfo", pdu_session_create_data->icn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [icn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->n9_forwarding_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "n9ForwardingTunnelInfo", pdu_session_create_data->n9_forwarding_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [n9_forwarding_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->additional_cn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "additionalCnTunnelInfo", pdu_session_create_data->additional_cn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [additional_cn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(pdu_session_create_data->an_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [an_type]");
+        goto end;
+    }
+
+    if (pdu_session_create_data->additional_an_type) {
+    if (OpenAPI_json_write_string(writer, "additionalAnType", OpenAPI_access_type_ToString(pdu_session_create_data->additional_an_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [additional_an_type]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(pdu_session_create_data->rat_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", pdu_session_create_data->ue_location) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", pdu_session_create_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", pdu_session_create_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", pdu_session_create_data->gpsi) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->n1_sm_info_from_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoFromUe", pdu_session_create_data->n1_sm_info_from_ue) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [n1_sm_info_from_ue]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->unknown_n1_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "unknownN1SmInfo", pdu_session_create_data->unknown_n1_sm_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [unknown_n1_sm_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", pdu_session_create_data->supported_features) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->h_pcf_id) {
+    if (OpenAPI_json_write_string(writer, "hPcfId", pdu_session_create_data->h_pcf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [h_pcf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", pdu_session_create_data->pcf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->pcf_group_id) {
+    if (OpenAPI_json_write_string(writer, "pcfGroupId", pdu_session_create_data->pcf_group_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pcf_group_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->pcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfSetId", pdu_session_create_data->pcf_set_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [pcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_ho_preparation_indication) {
+    if (OpenAPI_json_write_bool(writer, "hoPreparationIndication", pdu_session_create_data->ho_preparation_indication) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ho_preparation_indication]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->sel_mode) {
+    if (OpenAPI_json_write_string(writer, "selMode", OpenAPI_dnn_selection_mode_ToString(pdu_session_create_data->sel_mode)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [sel_mode]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_always_on_requested) {
+    if (OpenAPI_json_write_bool(writer, "alwaysOnRequested", pdu_session_create_data->always_on_requested) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [always_on_requested]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->udm_group_id) {
+    if (OpenAPI_json_write_string(writer, "udmGroupId", pdu_session_create_data->udm_group_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [udm_group_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->routing_indicator) {
+    if (OpenAPI_json_write_string(writer, "routingIndicator", pdu_session_create_data->routing_indicator) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [routing_indicator]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->eps_interworking_ind) {
+    if (OpenAPI_json_write_string(writer, "epsInterworkingInd", OpenAPI_eps_interworking_indication_ToString(pdu_session_create_data->eps_interworking_ind)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [eps_interworking_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->v_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "vSmfServiceInstanceId", pdu_session_create_data->v_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [v_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->i_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "iSmfServiceInstanceId", pdu_session_create_data->i_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [i_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", pdu_session_create_data->recovery_time) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->roaming_charging_profile) {
+    if (OpenAPI_roaming_charging_profile_writeJSON(writer, "roamingChargingProfile", pdu_session_create_data->roaming_charging_profile) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [roaming_charging_profile]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->charging_id) {
+    if (OpenAPI_json_write_string(writer, "chargingId", pdu_session_create_data->charging_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [charging_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_old_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "oldPduSessionId", pdu_session_create_data->old_pdu_session_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [old_pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->eps_bearer_ctx_status) {
+    if (OpenAPI_json_write_string(writer, "epsBearerCtxStatus", pdu_session_create_data->eps_bearer_ctx_status) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [eps_bearer_ctx_status]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->amf_nf_id) {
+    if (OpenAPI_json_write_string(writer, "amfNfId", pdu_session_create_data->amf_nf_id) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [amf_nf_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", pdu_session_create_data->guami) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->max_integrity_protected_data_rate_ul) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateUl", OpenAPI_max_integrity_protected_data_rate_ToString(pdu_session_create_data->max_integrity_protected_data_rate_ul)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [max_integrity_protected_data_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->max_integrity_protected_data_rate_dl) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateDl", OpenAPI_max_integrity_protected_data_rate_ToString(pdu_session_create_data->max_integrity_protected_data_rate_dl)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [max_integrity_protected_data_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_cp_ciot_enabled) {
+    if (OpenAPI_json_write_bool(writer, "cpCiotEnabled", pdu_session_create_data->cp_ciot_enabled) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [cp_ciot_enabled]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_cp_only_ind) {
+    if (OpenAPI_json_write_bool(writer, "cpOnlyInd", pdu_session_create_data->cp_only_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [cp_only_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_invoke_nef) {
+    if (OpenAPI_json_write_bool(writer, "invokeNef", pdu_session_create_data->invoke_nef) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [invoke_nef]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_ma_request_ind) {
+    if (OpenAPI_json_write_bool(writer, "maRequestInd", pdu_session_create_data->ma_request_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ma_request_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_ma_nw_upgrade_ind) {
+    if (OpenAPI_json_write_bool(writer, "maNwUpgradeInd", pdu_session_create_data->ma_nw_upgrade_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [ma_nw_upgrade_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(pdu_session_create_data->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->presence_in_ladn) {
+    if (OpenAPI_json_write_string(writer, "presenceInLadn", OpenAPI_presence_state_ToString(pdu_session_create_data->presence_in_ladn)) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [presence_in_ladn]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->secondary_rat_usage_info) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageInfo") == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_info_node;
+    if (pdu_session_create_data->secondary_rat_usage_info) {
+        OpenAPI_list_for_each(pdu_session_create_data->secondary_rat_usage_info, secondary_rat_usage_info_node) {
+            if (OpenAPI_secondary_rat_usage_info_writeJSON(writer, NULL, secondary_rat_usage_info_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [secondary_rat_usage_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", pdu_session_create_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", pdu_session_create_data->apn_rate_status) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->is_dl_serving_plmn_rate_ctl) {
+    if (OpenAPI_json_write_number(writer, "dlServingPlmnRateCtl", pdu_session_create_data->dl_serving_plmn_rate_ctl) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [dl_serving_plmn_rate_ctl]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->up_security_info) {
+    if (OpenAPI_up_security_info_writeJSON(writer, "upSecurityInfo", pdu_session_create_data->up_security_info) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [up_security_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_data->vplmn_qos) {
+    if (OpenAPI_vplmn_qos_writeJSON(writer, "vplmnQos", pdu_session_create_data->vplmn_qos) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [vplmn_qos]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_data_writeJSON() failed [PduSessionCreateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_create_data_t *OpenAPI_pdu_session_create_data_parseFromJSON(cJSON *pdu_session_create_dataJSON)
 {
     OpenAPI_pdu_session_create_data_t *pdu_session_create_data_local_var = NULL;
@@ -1487,7 +1982,6 @@ end:
 OpenAPI_pdu_session_create_data_t *OpenAPI_pdu_session_create_data_copy(OpenAPI_pdu_session_create_data_t *dst, OpenAPI_pdu_session_create_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_create_data_convertToJSON(src);
@@ -1496,21 +1990,6 @@ OpenAPI_pdu_session_create_data_t *OpenAPI_pdu_session_create_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_create_data_free(dst);
     dst = OpenAPI_pdu_session_create_data_parseFromJSON(item);
     cJSON_Delete(item);
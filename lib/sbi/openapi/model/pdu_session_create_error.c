@@ -98,6 +98,61 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_create_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_create_error_t *pdu_session_create_error)
+{
+    if (pdu_session_create_error == NULL) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [PduSessionCreateError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [PduSessionCreateError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", pdu_session_create_error->error) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (pdu_session_create_error->n1sm_cause) {
+    if (OpenAPI_json_write_string(writer, "n1smCause", pdu_session_create_error->n1sm_cause) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [n1sm_cause]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_error->n1_sm_info_to_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoToUe", pdu_session_create_error->n1_sm_info_to_ue) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [n1_sm_info_to_ue]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_error->is_back_off_timer) {
+    if (OpenAPI_json_write_number(writer, "backOffTimer", pdu_session_create_error->back_off_timer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [back_off_timer]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_create_error->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", pdu_session_create_error->recovery_time) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_create_error_writeJSON() failed [PduSessionCreateError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_parseFromJSON(cJSON *pdu_session_create_errorJSON)
 {
     OpenAPI_pdu_session_create_error_t *pdu_session_create_error_local_var = NULL;
@@ -161,7 +216,6 @@ end:
 OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_copy(OpenAPI_pdu_session_create_error_t *dst, OpenAPI_pdu_session_create_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_create_error_convertToJSON(src);
@@ -170,21 +224,6 @@ OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_create_error_free(dst);
     dst = OpenAPI_pdu_session_create_error_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "problem_details.h"
 #include "ref_to_binary_data.h"
 
@@ -40,6 +41,7 @@ OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_create(
 void OpenAPI_pdu_session_create_error_free(OpenAPI_pdu_session_create_error_t *pdu_session_create_error);
 OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_parseFromJSON(cJSON *pdu_session_create_errorJSON);
 cJSON *OpenAPI_pdu_session_create_error_convertToJSON(OpenAPI_pdu_session_create_error_t *pdu_session_create_error);
+bool OpenAPI_pdu_session_create_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_create_error_t *pdu_session_create_error);
 OpenAPI_pdu_session_create_error_t *OpenAPI_pdu_session_create_error_copy(OpenAPI_pdu_session_create_error_t *dst, OpenAPI_pdu_session_create_error_t *src);
 
 #ifdef __cplusplus
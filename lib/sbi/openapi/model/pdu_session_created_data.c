@@ -518,6 +518,323 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_created_data_t *pdu_session_created_data)
+{
+    if (pdu_session_created_data == NULL) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [PduSessionCreatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [PduSessionCreatedData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "pduSessionType", OpenAPI_pdu_session_type_ToString(pdu_session_created_data->pdu_session_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [pdu_session_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "sscMode", pdu_session_created_data->ssc_mode) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ssc_mode]");
+        goto end;
+    }
+
+    if (pdu_session_created_data->hcn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "hcnTunnelInfo", pdu_session_created_data->hcn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [hcn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->cn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "cnTunnelInfo", pdu_session_created_data->cn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [cn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->additional_cn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "additionalCnTunnelInfo", pdu_session_created_data->additional_cn_tunnel_info) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [additional_cn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->session_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "sessionAmbr", pdu_session_created_data->session_ambr) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->qos_flows_setup_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsSetupList") == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [qos_flows_setup_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_setup_list_node;
+    if (pdu_session_created_data->qos_flows_setup_list) {
+        OpenAPI_list_for_each(pdu_session_created_data->qos_flows_setup_list, qos_flows_setup_list_node) {
+            if (OpenAPI_qos_flow_setup_item_writeJSON(writer, NULL, qos_flows_setup_list_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [qos_flows_setup_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [qos_flows_setup_list]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->h_smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "hSmfInstanceId", pdu_session_created_data->h_smf_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [h_smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", pdu_session_created_data->smf_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", pdu_session_created_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", pdu_session_created_data->s_nssai) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_enable_pause_charging) {
+    if (OpenAPI_json_write_bool(writer, "enablePauseCharging", pdu_session_created_data->enable_pause_charging) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [enable_pause_charging]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->ue_ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4Address", pdu_session_created_data->ue_ipv4_address) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ue_ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->ue_ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6Prefix", pdu_session_created_data->ue_ipv6_prefix) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ue_ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->n1_sm_info_to_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoToUe", pdu_session_created_data->n1_sm_info_to_ue) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [n1_sm_info_to_ue]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->eps_pdn_cnx_info) {
+    if (OpenAPI_eps_pdn_cnx_info_writeJSON(writer, "epsPdnCnxInfo", pdu_session_created_data->eps_pdn_cnx_info) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [eps_pdn_cnx_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->eps_bearer_info) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerInfo") == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_info_node;
+    if (pdu_session_created_data->eps_bearer_info) {
+        OpenAPI_list_for_each(pdu_session_created_data->eps_bearer_info, eps_bearer_info_node) {
+            if (OpenAPI_eps_bearer_info_writeJSON(writer, NULL, eps_bearer_info_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [eps_bearer_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", pdu_session_created_data->supported_features) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->max_integrity_protected_data_rate) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRate", OpenAPI_max_integrity_protected_data_rate_ToString(pdu_session_created_data->max_integrity_protected_data_rate)) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [max_integrity_protected_data_rate]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->max_integrity_protected_data_rate_dl) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateDl", OpenAPI_max_integrity_protected_data_rate_ToString(pdu_session_created_data->max_integrity_protected_data_rate_dl)) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [max_integrity_protected_data_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_always_on_granted) {
+    if (OpenAPI_json_write_bool(writer, "alwaysOnGranted", pdu_session_created_data->always_on_granted) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [always_on_granted]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", pdu_session_created_data->gpsi) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->up_security) {
+    if (OpenAPI_up_security_writeJSON(writer, "upSecurity", pdu_session_created_data->up_security) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [up_security]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->roaming_charging_profile) {
+    if (OpenAPI_roaming_charging_profile_writeJSON(writer, "roamingChargingProfile", pdu_session_created_data->roaming_charging_profile) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [roaming_charging_profile]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->h_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "hSmfServiceInstanceId", pdu_session_created_data->h_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [h_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfServiceInstanceId", pdu_session_created_data->smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", pdu_session_created_data->recovery_time) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(pdu_session_created_data->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_ipv6_multi_homing_ind) {
+    if (OpenAPI_json_write_bool(writer, "ipv6MultiHomingInd", pdu_session_created_data->ipv6_multi_homing_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ipv6_multi_homing_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_ma_accepted_ind) {
+    if (OpenAPI_json_write_bool(writer, "maAcceptedInd", pdu_session_created_data->ma_accepted_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ma_accepted_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->home_provided_charging_id) {
+    if (OpenAPI_json_write_string(writer, "homeProvidedChargingId", pdu_session_created_data->home_provided_charging_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [home_provided_charging_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_nef_ext_buf_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "nefExtBufSupportInd", pdu_session_created_data->nef_ext_buf_support_ind) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [nef_ext_buf_support_ind]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_small_data_rate_control_enabled) {
+    if (OpenAPI_json_write_bool(writer, "smallDataRateControlEnabled", pdu_session_created_data->small_data_rate_control_enabled) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [small_data_rate_control_enabled]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->ue_ipv6_interface_id) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6InterfaceId", pdu_session_created_data->ue_ipv6_interface_id) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ue_ipv6_interface_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->is_ipv6_index) {
+    if (OpenAPI_json_write_number(writer, "ipv6Index", pdu_session_created_data->ipv6_index) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [ipv6_index]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->dn_aaa_address) {
+    if (OpenAPI_ip_address_writeJSON(writer, "dnAaaAddress", pdu_session_created_data->dn_aaa_address) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [dn_aaa_address]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_created_data->redundant_pdu_session_info) {
+    if (OpenAPI_redundant_pdu_session_information_writeJSON(writer, "redundantPduSessionInfo", pdu_session_created_data->redundant_pdu_session_info) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [redundant_pdu_session_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_created_data_writeJSON() failed [PduSessionCreatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_created_data_t *OpenAPI_pdu_session_created_data_parseFromJSON(cJSON *pdu_session_created_dataJSON)
 {
     OpenAPI_pdu_session_created_data_t *pdu_session_created_data_local_var = NULL;
@@ -949,7 +1266,6 @@ end:
 OpenAPI_pdu_session_created_data_t *OpenAPI_pdu_session_created_data_copy(OpenAPI_pdu_session_created_data_t *dst, OpenAPI_pdu_session_created_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_created_data_convertToJSON(src);
@@ -958,21 +1274,6 @@ OpenAPI_pdu_session_created_data_t *OpenAPI_pdu_session_created_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_created_data_free(dst);
     dst = OpenAPI_pdu_session_created_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -223,6 +223,164 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_management_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_management_data_t *pdu_session_management_data)
+{
+    if (pdu_session_management_data == NULL) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [PduSessionManagementData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [PduSessionManagementData]");
+        return false;
+    }
+    if (pdu_session_management_data->pdu_session_status) {
+    if (OpenAPI_pdu_session_status_writeJSON(writer, "pduSessionStatus", pdu_session_management_data->pdu_session_status) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [pdu_session_status]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->pdu_session_status_ts) {
+    if (OpenAPI_json_write_string(writer, "pduSessionStatusTs", pdu_session_management_data->pdu_session_status_ts) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [pdu_session_status_ts]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->dnai) {
+    if (OpenAPI_json_write_string(writer, "dnai", pdu_session_management_data->dnai) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [dnai]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->dnai_ts) {
+    if (OpenAPI_json_write_string(writer, "dnaiTs", pdu_session_management_data->dnai_ts) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [dnai_ts]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->n6_traffic_routing_info) {
+    if (OpenAPI_json_write_array_start(writer, "n6TrafficRoutingInfo") == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [n6_traffic_routing_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n6_traffic_routing_info_node;
+    if (pdu_session_management_data->n6_traffic_routing_info) {
+        OpenAPI_list_for_each(pdu_session_management_data->n6_traffic_routing_info, n6_traffic_routing_info_node) {
+            if (OpenAPI_route_to_location_writeJSON(writer, NULL, n6_traffic_routing_info_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [n6_traffic_routing_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [n6_traffic_routing_info]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->n6_traffic_routing_info_ts) {
+    if (OpenAPI_json_write_string(writer, "n6TrafficRoutingInfoTs", pdu_session_management_data->n6_traffic_routing_info_ts) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [n6_traffic_routing_info_ts]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", pdu_session_management_data->ipv4_addr) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->ipv6_prefix) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6Prefix") == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_prefix_node;
+    OpenAPI_list_for_each(pdu_session_management_data->ipv6_prefix, ipv6_prefix_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_prefix_node->data) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->ipv6_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6Addrs") == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_addrs_node;
+    OpenAPI_list_for_each(pdu_session_management_data->ipv6_addrs, ipv6_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_addrs_node->data) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ipv6_addrs]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->pdu_sess_type) {
+    if (OpenAPI_json_write_string(writer, "pduSessType", OpenAPI_pdu_session_type_ToString(pdu_session_management_data->pdu_sess_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [pdu_sess_type]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->ip_addr_ts) {
+    if (OpenAPI_json_write_string(writer, "ipAddrTs", pdu_session_management_data->ip_addr_ts) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [ip_addr_ts]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session_management_data->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", pdu_session_management_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_management_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", pdu_session_management_data->supp_feat) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_management_data_writeJSON() failed [PduSessionManagementData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_management_data_t *OpenAPI_pdu_session_management_data_parseFromJSON(cJSON *pdu_session_management_dataJSON)
 {
     OpenAPI_pdu_session_management_data_t *pdu_session_management_data_local_var = NULL;
@@ -420,7 +578,6 @@ end:
 OpenAPI_pdu_session_management_data_t *OpenAPI_pdu_session_management_data_copy(OpenAPI_pdu_session_management_data_t *dst, OpenAPI_pdu_session_management_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_management_data_convertToJSON(src);
@@ -429,21 +586,6 @@ OpenAPI_pdu_session_management_data_t *OpenAPI_pdu_session_management_data_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_management_data_free(dst);
     dst = OpenAPI_pdu_session_management_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_notify_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_notify_item_t *pdu_session_notify_item)
+{
+    if (pdu_session_notify_item == NULL) {
+        ogs_error("OpenAPI_pdu_session_notify_item_writeJSON() failed [PduSessionNotifyItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_notify_item_writeJSON() failed [PduSessionNotifyItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationCause", OpenAPI_notification_cause_ToString(pdu_session_notify_item->notification_cause)) == false) {
+        ogs_error("OpenAPI_pdu_session_notify_item_writeJSON() failed [notification_cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_notify_item_writeJSON() failed [PduSessionNotifyItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_parseFromJSON(cJSON *pdu_session_notify_itemJSON)
 {
     OpenAPI_pdu_session_notify_item_t *pdu_session_notify_item_local_var = NULL;
@@ -72,7 +99,6 @@ end:
 OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_copy(OpenAPI_pdu_session_notify_item_t *dst, OpenAPI_pdu_session_notify_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_notify_item_convertToJSON(src);
@@ -81,21 +107,6 @@ OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_notify_item_free(dst);
     dst = OpenAPI_pdu_session_notify_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "notification_cause.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_create(
 void OpenAPI_pdu_session_notify_item_free(OpenAPI_pdu_session_notify_item_t *pdu_session_notify_item);
 OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_parseFromJSON(cJSON *pdu_session_notify_itemJSON);
 cJSON *OpenAPI_pdu_session_notify_item_convertToJSON(OpenAPI_pdu_session_notify_item_t *pdu_session_notify_item);
+bool OpenAPI_pdu_session_notify_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_notify_item_t *pdu_session_notify_item);
 OpenAPI_pdu_session_notify_item_t *OpenAPI_pdu_session_notify_item_copy(OpenAPI_pdu_session_notify_item_t *dst, OpenAPI_pdu_session_notify_item_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_status_t *pdu_session_status)
+{
+    if (pdu_session_status == NULL) {
+        ogs_error("OpenAPI_pdu_session_status_writeJSON() failed [PduSessionStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_status_writeJSON() failed [PduSessionStatus]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_status_writeJSON() failed [PduSessionStatus]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_parseFromJSON(cJSON *pdu_session_statusJSON)
 {
     OpenAPI_pdu_session_status_t *pdu_session_status_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_copy(OpenAPI_pdu_session_status_t *dst, OpenAPI_pdu_session_status_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_status_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_copy(OpenAPI_pdu_sessio
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_status_free(dst);
     dst = OpenAPI_pdu_session_status_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pdu_session_status_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_create(
 void OpenAPI_pdu_session_status_free(OpenAPI_pdu_session_status_t *pdu_session_status);
 OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_parseFromJSON(cJSON *pdu_session_statusJSON);
 cJSON *OpenAPI_pdu_session_status_convertToJSON(OpenAPI_pdu_session_status_t *pdu_session_status);
+bool OpenAPI_pdu_session_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_status_t *pdu_session_status);
 OpenAPI_pdu_session_status_t *OpenAPI_pdu_session_status_copy(OpenAPI_pdu_session_status_t *dst, OpenAPI_pdu_session_status_t *src);
 
 #ifdef __cplusplus
@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_status_cfg_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_status_cfg_t *pdu_session_status_cfg)
+{
+    if (pdu_session_status_cfg == NULL) {
+        ogs_error("OpenAPI_pdu_session_status_cfg_writeJSON() failed [PduSessionStatusCfg]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_status_cfg_writeJSON() failed [PduSessionStatusCfg]");
+        return false;
+    }
+    if (pdu_session_status_cfg->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", pdu_session_status_cfg->dnn) == false) {
+        ogs_error("OpenAPI_pdu_session_status_cfg_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_status_cfg_writeJSON() failed [PduSessionStatusCfg]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_status_cfg_t *OpenAPI_pdu_session_status_cfg_parseFromJSON(cJSON *pdu_session_status_cfgJSON)
 {
     OpenAPI_pdu_session_status_cfg_t *pdu_session_status_cfg_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_pdu_session_status_cfg_t *OpenAPI_pdu_session_status_cfg_copy(OpenAPI_pdu_session_status_cfg_t *dst, OpenAPI_pdu_session_status_cfg_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_status_cfg_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_pdu_session_status_cfg_t *OpenAPI_pdu_session_status_cfg_copy(OpenAPI_pd
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_status_cfg_free(dst);
     dst = OpenAPI_pdu_session_status_cfg_parseFromJSON(item);
     cJSON_Delete(item);
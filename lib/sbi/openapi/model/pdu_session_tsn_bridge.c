@@ -109,6 +109,68 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_tsn_bridge_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_tsn_bridge_t *pdu_session_tsn_bridge)
+{
+    if (pdu_session_tsn_bridge == NULL) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [PduSessionTsnBridge]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [PduSessionTsnBridge]");
+        return false;
+    }
+    if (OpenAPI_tsn_bridge_info_writeJSON(writer, "tsnBridgeInfo", pdu_session_tsn_bridge->tsn_bridge_info) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_bridge_info]");
+        goto end;
+    }
+
+    if (pdu_session_tsn_bridge->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", pdu_session_tsn_bridge->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_tsn_bridge->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", pdu_session_tsn_bridge->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (pdu_session_tsn_bridge->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (pdu_session_tsn_bridge->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(pdu_session_tsn_bridge->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_tsn_bridge_writeJSON() failed [PduSessionTsnBridge]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_tsn_bridge_t *OpenAPI_pdu_session_tsn_bridge_parseFromJSON(cJSON *pdu_session_tsn_bridgeJSON)
 {
     OpenAPI_pdu_session_tsn_bridge_t *pdu_session_tsn_bridge_local_var = NULL;
@@ -179,7 +241,6 @@ end:
 OpenAPI_pdu_session_tsn_bridge_t *OpenAPI_pdu_session_tsn_bridge_copy(OpenAPI_pdu_session_tsn_bridge_t *dst, OpenAPI_pdu_session_tsn_bridge_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_tsn_bridge_convertToJSON(src);
@@ -188,21 +249,6 @@ OpenAPI_pdu_session_tsn_bridge_t *OpenAPI_pdu_session_tsn_bridge_copy(OpenAPI_pd
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_tsn_bridge_free(dst);
     dst = OpenAPI_pdu_session_tsn_bridge_parseFromJSON(item);
     cJSON_Delete(item);
@@ -62,6 +62,51 @@ end:
     return item;
 }
 
+bool OpenAPI_pdu_session_types_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_types_t *pdu_session_types)
+{
+    if (pdu_session_types == NULL) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [PduSessionTypes]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [PduSessionTypes]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "defaultSessionType", OpenAPI_pdu_session_type_ToString(pdu_session_types->default_session_type)) == false) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [default_session_type]");
+        goto end;
+    }
+
+    if (pdu_session_types->allowed_session_types) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSessionTypes") == false) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [allowed_session_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_session_types_node;
+    OpenAPI_list_for_each(pdu_session_types->allowed_session_types, allowed_session_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_pdu_session_type_ToString((intptr_t)allowed_session_types_node->data)) == false) {
+            ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [allowed_session_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [allowed_session_types]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pdu_session_types_writeJSON() failed [PduSessionTypes]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_parseFromJSON(cJSON *pdu_session_typesJSON)
 {
     OpenAPI_pdu_session_types_t *pdu_session_types_local_var = NULL;
@@ -113,7 +158,6 @@ end:
 OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_copy(OpenAPI_pdu_session_types_t *dst, OpenAPI_pdu_session_types_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pdu_session_types_convertToJSON(src);
@@ -122,21 +166,6 @@ OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_copy(OpenAPI_pdu_session_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pdu_session_types_free(dst);
     dst = OpenAPI_pdu_session_types_parseFromJSON(item);
     cJSON_Delete(item);
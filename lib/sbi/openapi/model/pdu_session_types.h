@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pdu_session_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_create(
 void OpenAPI_pdu_session_types_free(OpenAPI_pdu_session_types_t *pdu_session_types);
 OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_parseFromJSON(cJSON *pdu_session_typesJSON);
 cJSON *OpenAPI_pdu_session_types_convertToJSON(OpenAPI_pdu_session_types_t *pdu_session_types);
+bool OpenAPI_pdu_session_types_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_types_t *pdu_session_types);
 OpenAPI_pdu_session_types_t *OpenAPI_pdu_session_types_copy(OpenAPI_pdu_session_types_t *dst, OpenAPI_pdu_session_types_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pdu_session_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_pdu_session_types_1_t *OpenAPI_pdu_session_types_1_create(
 void OpenAPI_pdu_session_types_1_free(OpenAPI_pdu_session_types_1_t *pdu_session_types_1);
 OpenAPI_pdu_session_types_1_t *OpenAPI_pdu_session_types_1_parseFromJSON(cJSON *pdu_session_types_1JSON);
 cJSON *OpenAPI_pdu_session_types_1_convertToJSON(OpenAPI_pdu_session_types_1_t *pdu_session_types_1);
+bool OpenAPI_pdu_session_types_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pdu_session_types_1_t *pdu_session_types_1);
 OpenAPI_pdu_session_types_1_t *OpenAPI_pdu_session_types_1_copy(OpenAPI_pdu_session_types_1_t *dst, OpenAPI_pdu_session_types_1_t *src);
 
 #ifdef __cplusplus
@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_pei_update_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pei_update_info_t *pei_update_info)
+{
+    if (pei_update_info == NULL) {
+        ogs_error("OpenAPI_pei_update_info_writeJSON() failed [PeiUpdateInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pei_update_info_writeJSON() failed [PeiUpdateInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "pei", pei_update_info->pei) == false) {
+        ogs_error("OpenAPI_pei_update_info_writeJSON() failed [pei]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pei_update_info_writeJSON() failed [PeiUpdateInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_parseFromJSON(cJSON *pei_update_infoJSON)
 {
     OpenAPI_pei_update_info_t *pei_update_info_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_copy(OpenAPI_pei_update_info_t *dst, OpenAPI_pei_update_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pei_update_info_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_copy(OpenAPI_pei_update_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pei_update_info_free(dst);
     dst = OpenAPI_pei_update_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_create(
 void OpenAPI_pei_update_info_free(OpenAPI_pei_update_info_t *pei_update_info);
 OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_parseFromJSON(cJSON *pei_update_infoJSON);
 cJSON *OpenAPI_pei_update_info_convertToJSON(OpenAPI_pei_update_info_t *pei_update_info);
+bool OpenAPI_pei_update_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pei_update_info_t *pei_update_info);
 OpenAPI_pei_update_info_t *OpenAPI_pei_update_info_copy(OpenAPI_pei_update_info_t *dst, OpenAPI_pei_update_info_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_periodicity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_periodicity_t *periodicity)
+{
+    if (periodicity == NULL) {
+        ogs_error("OpenAPI_periodicity_writeJSON() failed [Periodicity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_periodicity_writeJSON() failed [Periodicity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_periodicity_writeJSON() failed [Periodicity]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_periodicity_t *OpenAPI_periodicity_parseFromJSON(cJSON *periodicityJSON)
 {
     OpenAPI_periodicity_t *periodicity_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_periodicity_t *OpenAPI_periodicity_copy(OpenAPI_periodicity_t *dst, OpenAPI_periodicity_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_periodicity_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_periodicity_t *OpenAPI_periodicity_copy(OpenAPI_periodicity_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_periodicity_free(dst);
     dst = OpenAPI_periodicity_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "periodicity_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_periodicity_t *OpenAPI_periodicity_create(
 void OpenAPI_periodicity_free(OpenAPI_periodicity_t *periodicity);
 OpenAPI_periodicity_t *OpenAPI_periodicity_parseFromJSON(cJSON *periodicityJSON);
 cJSON *OpenAPI_periodicity_convertToJSON(OpenAPI_periodicity_t *periodicity);
+bool OpenAPI_periodicity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_periodicity_t *periodicity);
 OpenAPI_periodicity_t *OpenAPI_periodicity_copy(OpenAPI_periodicity_t *dst, OpenAPI_periodicity_t *src);
 
 #ifdef __cplusplus
@@ -93,6 +93,68 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_change_notification_t *pfd_change_notification)
+{
+    if (pfd_change_notification == NULL) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [PfdChangeNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [PfdChangeNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "applicationId", pfd_change_notification->application_id) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [application_id]");
+        goto end;
+    }
+
+    if (pfd_change_notification->is_removal_flag) {
+    if (OpenAPI_json_write_bool(writer, "removalFlag", pfd_change_notification->removal_flag) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [removal_flag]");
+        goto end;
+    }
+    }
+
+    if (pfd_change_notification->is_partial_flag) {
+    if (OpenAPI_json_write_bool(writer, "partialFlag", pfd_change_notification->partial_flag) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [partial_flag]");
+        goto end;
+    }
+    }
+
+    if (pfd_change_notification->pfds) {
+    if (OpenAPI_json_write_array_start(writer, "pfds") == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [pfds]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pfds_node;
+    if (pfd_change_notification->pfds) {
+        OpenAPI_list_for_each(pfd_change_notification->pfds, pfds_node) {
+            if (OpenAPI_pfd_content_writeJSON(writer, NULL, pfds_node->data) == false) {
+                ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [pfds]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [pfds]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_change_notification_writeJSON() failed [PfdChangeNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_parseFromJSON(cJSON *pfd_change_notificationJSON)
 {
     OpenAPI_pfd_change_notification_t *pfd_change_notification_local_var = NULL;
@@ -171,7 +233,6 @@ end:
 OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_copy(OpenAPI_pfd_change_notification_t *dst, OpenAPI_pfd_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_change_notification_convertToJSON(src);
@@ -180,21 +241,6 @@ OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_change_notification_free(dst);
     dst = OpenAPI_pfd_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pfd_content.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_create(
 void OpenAPI_pfd_change_notification_free(OpenAPI_pfd_change_notification_t *pfd_change_notification);
 OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_parseFromJSON(cJSON *pfd_change_notificationJSON);
 cJSON *OpenAPI_pfd_change_notification_convertToJSON(OpenAPI_pfd_change_notification_t *pfd_change_notification);
+bool OpenAPI_pfd_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_change_notification_t *pfd_change_notification);
 OpenAPI_pfd_change_notification_t *OpenAPI_pfd_change_notification_copy(OpenAPI_pfd_change_notification_t *dst, OpenAPI_pfd_change_notification_t *src);
 
 #ifdef __cplusplus
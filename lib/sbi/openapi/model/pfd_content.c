@@ -129,6 +129,99 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_content_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_content_t *pfd_content)
+{
+    if (pfd_content == NULL) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [PfdContent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [PfdContent]");
+        return false;
+    }
+    if (pfd_content->pfd_id) {
+    if (OpenAPI_json_write_string(writer, "pfdId", pfd_content->pfd_id) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [pfd_id]");
+        goto end;
+    }
+    }
+
+    if (pfd_content->flow_descriptions) {
+    if (OpenAPI_json_write_array_start(writer, "flowDescriptions") == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flow_descriptions_node;
+    OpenAPI_list_for_each(pfd_content->flow_descriptions, flow_descriptions_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)flow_descriptions_node->data) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [flow_descriptions]");
+        goto end;
+    }
+    }
+
+    if (pfd_content->urls) {
+    if (OpenAPI_json_write_array_start(writer, "urls") == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [urls]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *urls_node;
+    OpenAPI_list_for_each(pfd_content->urls, urls_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)urls_node->data) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [urls]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [urls]");
+        goto end;
+    }
+    }
+
+    if (pfd_content->domain_names) {
+    if (OpenAPI_json_write_array_start(writer, "domainNames") == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [domain_names]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *domain_names_node;
+    OpenAPI_list_for_each(pfd_content->domain_names, domain_names_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)domain_names_node->data) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [domain_names]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [domain_names]");
+        goto end;
+    }
+    }
+
+    if (pfd_content->dn_protocol) {
+    if (OpenAPI_domain_name_protocol_writeJSON(writer, "dnProtocol", pfd_content->dn_protocol) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [dn_protocol]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_content_writeJSON() failed [PfdContent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_content_t *OpenAPI_pfd_content_parseFromJSON(cJSON *pfd_contentJSON)
 {
     OpenAPI_pfd_content_t *pfd_content_local_var = NULL;
@@ -224,7 +317,6 @@ end:
 OpenAPI_pfd_content_t *OpenAPI_pfd_content_copy(OpenAPI_pfd_content_t *dst, OpenAPI_pfd_content_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_content_convertToJSON(src);
@@ -233,21 +325,6 @@ OpenAPI_pfd_content_t *OpenAPI_pfd_content_copy(OpenAPI_pfd_content_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_content_free(dst);
     dst = OpenAPI_pfd_content_parseFromJSON(item);
     cJSON_Delete(item);
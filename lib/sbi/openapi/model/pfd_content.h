@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "domain_name_protocol.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_pfd_content_t *OpenAPI_pfd_content_create(
 void OpenAPI_pfd_content_free(OpenAPI_pfd_content_t *pfd_content);
 OpenAPI_pfd_content_t *OpenAPI_pfd_content_parseFromJSON(cJSON *pfd_contentJSON);
 cJSON *OpenAPI_pfd_content_convertToJSON(OpenAPI_pfd_content_t *pfd_content);
+bool OpenAPI_pfd_content_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_content_t *pfd_content);
 OpenAPI_pfd_content_t *OpenAPI_pfd_content_copy(OpenAPI_pfd_content_t *dst, OpenAPI_pfd_content_t *src);
 
 #ifdef __cplusplus
@@ -81,6 +81,66 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_t *pfd_data)
+{
+    if (pfd_data == NULL) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [PfdData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [PfdData]");
+        return false;
+    }
+    if (pfd_data->app_ids) {
+    if (OpenAPI_json_write_array_start(writer, "appIds") == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_ids_node;
+    OpenAPI_list_for_each(pfd_data->app_ids, app_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)app_ids_node->data) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [app_ids]");
+        goto end;
+    }
+    }
+
+    if (pfd_data->af_ids) {
+    if (OpenAPI_json_write_array_start(writer, "afIds") == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *af_ids_node;
+    OpenAPI_list_for_each(pfd_data->af_ids, af_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)af_ids_node->data) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [af_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_writeJSON() failed [PfdData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_data_t *OpenAPI_pfd_data_parseFromJSON(cJSON *pfd_dataJSON)
 {
     OpenAPI_pfd_data_t *pfd_data_local_var = NULL;
@@ -137,7 +197,6 @@ end:
 OpenAPI_pfd_data_t *OpenAPI_pfd_data_copy(OpenAPI_pfd_data_t *dst, OpenAPI_pfd_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_data_convertToJSON(src);
@@ -146,21 +205,6 @@ OpenAPI_pfd_data_t *OpenAPI_pfd_data_copy(OpenAPI_pfd_data_t *dst, OpenAPI_pfd_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_data_free(dst);
     dst = OpenAPI_pfd_data_parseFromJSON(item);
     cJSON_Delete(item);
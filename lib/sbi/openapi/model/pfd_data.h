@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_pfd_data_t *OpenAPI_pfd_data_create(
 void OpenAPI_pfd_data_free(OpenAPI_pfd_data_t *pfd_data);
 OpenAPI_pfd_data_t *OpenAPI_pfd_data_parseFromJSON(cJSON *pfd_dataJSON);
 cJSON *OpenAPI_pfd_data_convertToJSON(OpenAPI_pfd_data_t *pfd_data);
+bool OpenAPI_pfd_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_t *pfd_data);
 OpenAPI_pfd_data_t *OpenAPI_pfd_data_copy(OpenAPI_pfd_data_t *dst, OpenAPI_pfd_data_t *src);
 
 #ifdef __cplusplus
@@ -79,6 +79,59 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_data_for_app_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_for_app_t *pfd_data_for_app)
+{
+    if (pfd_data_for_app == NULL) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [PfdDataForApp]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [PfdDataForApp]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "applicationId", pfd_data_for_app->application_id) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [application_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pfds") == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [pfds]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pfds_node;
+    if (pfd_data_for_app->pfds) {
+        OpenAPI_list_for_each(pfd_data_for_app->pfds, pfds_node) {
+            if (OpenAPI_pfd_content_writeJSON(writer, NULL, pfds_node->data) == false) {
+                ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [pfds]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [pfds]");
+        goto end;
+    }
+
+    if (pfd_data_for_app->caching_time) {
+    if (OpenAPI_json_write_string(writer, "cachingTime", pfd_data_for_app->caching_time) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [caching_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_writeJSON() failed [PfdDataForApp]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_parseFromJSON(cJSON *pfd_data_for_appJSON)
 {
     OpenAPI_pfd_data_for_app_t *pfd_data_for_app_local_var = NULL;
@@ -147,7 +200,6 @@ end:
 OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_copy(OpenAPI_pfd_data_for_app_t *dst, OpenAPI_pfd_data_for_app_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_data_for_app_convertToJSON(src);
@@ -156,21 +208,6 @@ OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_copy(OpenAPI_pfd_data_for_a
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_data_for_app_free(dst);
     dst = OpenAPI_pfd_data_for_app_parseFromJSON(item);
     cJSON_Delete(item);
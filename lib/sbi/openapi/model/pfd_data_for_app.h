@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "pfd_content.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_create(
 void OpenAPI_pfd_data_for_app_free(OpenAPI_pfd_data_for_app_t *pfd_data_for_app);
 OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_parseFromJSON(cJSON *pfd_data_for_appJSON);
 cJSON *OpenAPI_pfd_data_for_app_convertToJSON(OpenAPI_pfd_data_for_app_t *pfd_data_for_app);
+bool OpenAPI_pfd_data_for_app_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_for_app_t *pfd_data_for_app);
 OpenAPI_pfd_data_for_app_t *OpenAPI_pfd_data_for_app_copy(OpenAPI_pfd_data_for_app_t *dst, OpenAPI_pfd_data_for_app_t *src);
 
 #ifdef __cplusplus
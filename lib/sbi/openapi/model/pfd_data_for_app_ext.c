@@ -89,6 +89,66 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_data_for_app_ext_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_for_app_ext_t *pfd_data_for_app_ext)
+{
+    if (pfd_data_for_app_ext == NULL) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [PfdDataForAppExt]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [PfdDataForAppExt]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "applicationId", pfd_data_for_app_ext->application_id) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [application_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pfds") == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [pfds]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pfds_node;
+    if (pfd_data_for_app_ext->pfds) {
+        OpenAPI_list_for_each(pfd_data_for_app_ext->pfds, pfds_node) {
+            if (OpenAPI_pfd_content_writeJSON(writer, NULL, pfds_node->data) == false) {
+                ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [pfds]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [pfds]");
+        goto end;
+    }
+
+    if (pfd_data_for_app_ext->caching_time) {
+    if (OpenAPI_json_write_string(writer, "cachingTime", pfd_data_for_app_ext->caching_time) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [caching_time]");
+        goto end;
+    }
+    }
+
+    if (pfd_data_for_app_ext->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", pfd_data_for_app_ext->supp_feat) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_writeJSON() failed [PfdDataForAppExt]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_data_for_app_ext_t *OpenAPI_pfd_data_for_app_ext_parseFromJSON(cJSON *pfd_data_for_app_extJSON)
 {
     OpenAPI_pfd_data_for_app_ext_t *pfd_data_for_app_ext_local_var = NULL;
@@ -167,7 +227,6 @@ end:
 OpenAPI_pfd_data_for_app_ext_t *OpenAPI_pfd_data_for_app_ext_copy(OpenAPI_pfd_data_for_app_ext_t *dst, OpenAPI_pfd_data_for_app_ext_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_data_for_app_ext_convertToJSON(src);
@@ -176,21 +235,6 @@ OpenAPI_pfd_data_for_app_ext_t *OpenAPI_pfd_data_for_app_ext_copy(OpenAPI_pfd_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_data_for_app_ext_free(dst);
     dst = OpenAPI_pfd_data_for_app_ext_parseFromJSON(item);
     cJSON_Delete(item);
@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_pfd_data_for_app_ext_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pfd_data_for_app_ext_all_of_t *pfd_data_for_app_ext_all_of)
+{
+    if (pfd_data_for_app_ext_all_of == NULL) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_all_of_writeJSON() failed [PfdDataForAppExt_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_all_of_writeJSON() failed [PfdDataForAppExt_allOf]");
+        return false;
+    }
+    if (pfd_data_for_app_ext_all_of->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", pfd_data_for_app_ext_all_of->supp_feat) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_all_of_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pfd_data_for_app_ext_all_of_writeJSON() failed [PfdDataForAppExt_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pfd_data_for_app_ext_all_of_t *OpenAPI_pfd_data_for_app_ext_all_of_parseFromJSON(cJSON *pfd_data_for_app_ext_all_ofJSON)
 {
     OpenAPI_pfd_data_for_app_ext_all_of_t *pfd_data_for_app_ext_all_of_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_pfd_data_for_app_ext_all_of_t *OpenAPI_pfd_data_for_app_ext_all_of_copy(OpenAPI_pfd_data_for_app_ext_all_of_t *dst, OpenAPI_pfd_data_for_app_ext_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pfd_data_for_app_ext_all_of_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_pfd_data_for_app_ext_all_of_t *OpenAPI_pfd_data_for_app_ext_all_of_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pfd_data_for_app_ext_all_of_free(dst);
     dst = OpenAPI_pfd_data_for_app_ext_all_of_parseFromJSON(item);
     cJSON_Delete(item);
@@ -80,6 +80,52 @@ end:
     return item;
 }
 
+bool OpenAPI_pgw_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pgw_info_t *pgw_info)
+{
+    if (pgw_info == NULL) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [PgwInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [PgwInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", pgw_info->dnn) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", pgw_info->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+
+    if (pgw_info->plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", pgw_info->plmn_id) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (pgw_info->is_epdg_ind) {
+    if (OpenAPI_json_write_bool(writer, "epdgInd", pgw_info->epdg_ind) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [epdg_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pgw_info_writeJSON() failed [PgwInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pgw_info_t *OpenAPI_pgw_info_parseFromJSON(cJSON *pgw_infoJSON)
 {
     OpenAPI_pgw_info_t *pgw_info_local_var = NULL;
@@ -137,7 +183,6 @@ end:
 OpenAPI_pgw_info_t *OpenAPI_pgw_info_copy(OpenAPI_pgw_info_t *dst, OpenAPI_pgw_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pgw_info_convertToJSON(src);
@@ -146,21 +191,6 @@ OpenAPI_pgw_info_t *OpenAPI_pgw_info_copy(OpenAPI_pgw_info_t *dst, OpenAPI_pgw_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pgw_info_free(dst);
     dst = OpenAPI_pgw_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_pgw_info_t *OpenAPI_pgw_info_create(
 void OpenAPI_pgw_info_free(OpenAPI_pgw_info_t *pgw_info);
 OpenAPI_pgw_info_t *OpenAPI_pgw_info_parseFromJSON(cJSON *pgw_infoJSON);
 cJSON *OpenAPI_pgw_info_convertToJSON(OpenAPI_pgw_info_t *pgw_info);
+bool OpenAPI_pgw_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pgw_info_t *pgw_info);
 OpenAPI_pgw_info_t *OpenAPI_pgw_info_copy(OpenAPI_pgw_info_t *dst, OpenAPI_pgw_info_t *src);
 
 #ifdef __cplusplus
@@ -80,6 +80,52 @@ end:
     return item;
 }
 
+bool OpenAPI_pgw_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pgw_info_1_t *pgw_info_1)
+{
+    if (pgw_info_1 == NULL) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [PgwInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [PgwInfo_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", pgw_info_1->dnn) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", pgw_info_1->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+
+    if (pgw_info_1->plmn_id) {
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", pgw_info_1->plmn_id) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (pgw_info_1->is_epdg_ind) {
+    if (OpenAPI_json_write_bool(writer, "epdgInd", pgw_info_1->epdg_ind) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [epdg_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pgw_info_1_writeJSON() failed [PgwInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_parseFromJSON(cJSON *pgw_info_1JSON)
 {
     OpenAPI_pgw_info_1_t *pgw_info_1_local_var = NULL;
@@ -137,7 +183,6 @@ end:
 OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_copy(OpenAPI_pgw_info_1_t *dst, OpenAPI_pgw_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pgw_info_1_convertToJSON(src);
@@ -146,21 +191,6 @@ OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_copy(OpenAPI_pgw_info_1_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pgw_info_1_free(dst);
     dst = OpenAPI_pgw_info_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_create(
 void OpenAPI_pgw_info_1_free(OpenAPI_pgw_info_1_t *pgw_info_1);
 OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_parseFromJSON(cJSON *pgw_info_1JSON);
 cJSON *OpenAPI_pgw_info_1_convertToJSON(OpenAPI_pgw_info_1_t *pgw_info_1);
+bool OpenAPI_pgw_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pgw_info_1_t *pgw_info_1);
 OpenAPI_pgw_info_1_t *OpenAPI_pgw_info_1_copy(OpenAPI_pgw_info_1_t *dst, OpenAPI_pgw_info_1_t *src);
 
 #ifdef __cplusplus
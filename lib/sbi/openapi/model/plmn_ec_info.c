@@ -78,6 +78,47 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_ec_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_ec_info_t *plmn_ec_info)
+{
+    if (plmn_ec_info == NULL) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [PlmnEcInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [PlmnEcInfo]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", plmn_ec_info->plmn_id) == false) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (plmn_ec_info->ec_restriction_data_wb) {
+    if (OpenAPI_ec_restriction_data_wb_writeJSON(writer, "ecRestrictionDataWb", plmn_ec_info->ec_restriction_data_wb) == false) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [ec_restriction_data_wb]");
+        goto end;
+    }
+    }
+
+    if (plmn_ec_info->is_ec_restriction_data_nb) {
+    if (OpenAPI_json_write_bool(writer, "ecRestrictionDataNb", plmn_ec_info->ec_restriction_data_nb) == false) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [ec_restriction_data_nb]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_ec_info_writeJSON() failed [PlmnEcInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_parseFromJSON(cJSON *plmn_ec_infoJSON)
 {
     OpenAPI_plmn_ec_info_t *plmn_ec_info_local_var = NULL;
@@ -121,7 +162,6 @@ end:
 OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_copy(OpenAPI_plmn_ec_info_t *dst, OpenAPI_plmn_ec_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_ec_info_convertToJSON(src);
@@ -130,21 +170,6 @@ OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_copy(OpenAPI_plmn_ec_info_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_ec_info_free(dst);
     dst = OpenAPI_plmn_ec_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ec_restriction_data_wb.h"
 #include "plmn_id.h"
 
@@ -36,6 +37,7 @@ OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_create(
 void OpenAPI_plmn_ec_info_free(OpenAPI_plmn_ec_info_t *plmn_ec_info);
 OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_parseFromJSON(cJSON *plmn_ec_infoJSON);
 cJSON *OpenAPI_plmn_ec_info_convertToJSON(OpenAPI_plmn_ec_info_t *plmn_ec_info);
+bool OpenAPI_plmn_ec_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_ec_info_t *plmn_ec_info);
 OpenAPI_plmn_ec_info_t *OpenAPI_plmn_ec_info_copy(OpenAPI_plmn_ec_info_t *dst, OpenAPI_plmn_ec_info_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_id_t *plmn_id)
+{
+    if (plmn_id == NULL) {
+        ogs_error("OpenAPI_plmn_id_writeJSON() failed [PlmnId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_id_writeJSON() failed [PlmnId]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "mcc", plmn_id->mcc) == false) {
+        ogs_error("OpenAPI_plmn_id_writeJSON() failed [mcc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "mnc", plmn_id->mnc) == false) {
+        ogs_error("OpenAPI_plmn_id_writeJSON() failed [mnc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_id_writeJSON() failed [PlmnId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_id_t *OpenAPI_plmn_id_parseFromJSON(cJSON *plmn_idJSON)
 {
     OpenAPI_plmn_id_t *plmn_id_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_plmn_id_t *OpenAPI_plmn_id_copy(OpenAPI_plmn_id_t *dst, OpenAPI_plmn_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_id_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_plmn_id_t *OpenAPI_plmn_id_copy(OpenAPI_plmn_id_t *dst, OpenAPI_plmn_id_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_id_free(dst);
     dst = OpenAPI_plmn_id_parseFromJSON(item);
     cJSON_Delete(item);
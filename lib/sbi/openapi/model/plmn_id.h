@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_plmn_id_t *OpenAPI_plmn_id_create(
 void OpenAPI_plmn_id_free(OpenAPI_plmn_id_t *plmn_id);
 OpenAPI_plmn_id_t *OpenAPI_plmn_id_parseFromJSON(cJSON *plmn_idJSON);
 cJSON *OpenAPI_plmn_id_convertToJSON(OpenAPI_plmn_id_t *plmn_id);
+bool OpenAPI_plmn_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_id_t *plmn_id);
 OpenAPI_plmn_id_t *OpenAPI_plmn_id_copy(OpenAPI_plmn_id_t *dst, OpenAPI_plmn_id_t *src);
 
 #ifdef __cplusplus
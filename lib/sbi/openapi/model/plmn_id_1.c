@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_id_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_id_1_t *plmn_id_1)
+{
+    if (plmn_id_1 == NULL) {
+        ogs_error("OpenAPI_plmn_id_1_writeJSON() failed [PlmnId_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_id_1_writeJSON() failed [PlmnId_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "mcc", plmn_id_1->mcc) == false) {
+        ogs_error("OpenAPI_plmn_id_1_writeJSON() failed [mcc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "mnc", plmn_id_1->mnc) == false) {
+        ogs_error("OpenAPI_plmn_id_1_writeJSON() failed [mnc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_id_1_writeJSON() failed [PlmnId_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_parseFromJSON(cJSON *plmn_id_1JSON)
 {
     OpenAPI_plmn_id_1_t *plmn_id_1_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_copy(OpenAPI_plmn_id_1_t *dst, OpenAPI_plmn_id_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_id_1_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_copy(OpenAPI_plmn_id_1_t *dst, OpenAPI_pl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_id_1_free(dst);
     dst = OpenAPI_plmn_id_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_create(
 void OpenAPI_plmn_id_1_free(OpenAPI_plmn_id_1_t *plmn_id_1);
 OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_parseFromJSON(cJSON *plmn_id_1JSON);
 cJSON *OpenAPI_plmn_id_1_convertToJSON(OpenAPI_plmn_id_1_t *plmn_id_1);
+bool OpenAPI_plmn_id_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_id_1_t *plmn_id_1);
 OpenAPI_plmn_id_1_t *OpenAPI_plmn_id_1_copy(OpenAPI_plmn_id_1_t *dst, OpenAPI_plmn_id_1_t *src);
 
 #ifdef __cplusplus
@@ -63,6 +63,45 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_id_nid_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_id_nid_t *plmn_id_nid)
+{
+    if (plmn_id_nid == NULL) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [PlmnIdNid]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [PlmnIdNid]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "mcc", plmn_id_nid->mcc) == false) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [mcc]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "mnc", plmn_id_nid->mnc) == false) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [mnc]");
+        goto end;
+    }
+
+    if (plmn_id_nid->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", plmn_id_nid->nid) == false) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_id_nid_writeJSON() failed [PlmnIdNid]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_id_nid_t *OpenAPI_plmn_id_nid_parseFromJSON(cJSON *plmn_id_nidJSON)
 {
     OpenAPI_plmn_id_nid_t *plmn_id_nid_local_var = NULL;
@@ -111,7 +150,6 @@ end:
 OpenAPI_plmn_id_nid_t *OpenAPI_plmn_id_nid_copy(OpenAPI_plmn_id_nid_t *dst, OpenAPI_plmn_id_nid_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_id_nid_convertToJSON(src);
@@ -120,21 +158,6 @@ OpenAPI_plmn_id_nid_t *OpenAPI_plmn_id_nid_copy(OpenAPI_plmn_id_nid_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_id_nid_free(dst);
     dst = OpenAPI_plmn_id_nid_parseFromJSON(item);
     cJSON_Delete(item);
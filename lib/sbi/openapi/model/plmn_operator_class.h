@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lcs_client_class.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_plmn_operator_class_t *OpenAPI_plmn_operator_class_create(
 void OpenAPI_plmn_operator_class_free(OpenAPI_plmn_operator_class_t *plmn_operator_class);
 OpenAPI_plmn_operator_class_t *OpenAPI_plmn_operator_class_parseFromJSON(cJSON *plmn_operator_classJSON);
 cJSON *OpenAPI_plmn_operator_class_convertToJSON(OpenAPI_plmn_operator_class_t *plmn_operator_class);
+bool OpenAPI_plmn_operator_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_operator_class_t *plmn_operator_class);
 OpenAPI_plmn_operator_class_t *OpenAPI_plmn_operator_class_copy(OpenAPI_plmn_operator_class_t *dst, OpenAPI_plmn_operator_class_t *src);
 
 #ifdef __cplusplus
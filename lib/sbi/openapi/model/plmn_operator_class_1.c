@@ -64,6 +64,50 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_operator_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_operator_class_1_t *plmn_operator_class_1)
+{
+    if (plmn_operator_class_1 == NULL) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [PlmnOperatorClass_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [PlmnOperatorClass_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "lcsClientClass", OpenAPI_lcs_client_class_ToString(plmn_operator_class_1->lcs_client_class)) == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [lcs_client_class]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "lcsClientIds") == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [lcs_client_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *lcs_client_ids_node;
+    OpenAPI_list_for_each(plmn_operator_class_1->lcs_client_ids, lcs_client_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)lcs_client_ids_node->data) == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [lcs_client_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [lcs_client_ids]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_operator_class_1_writeJSON() failed [PlmnOperatorClass_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_parseFromJSON(cJSON *plmn_operator_class_1JSON)
 {
     OpenAPI_plmn_operator_class_1_t *plmn_operator_class_1_local_var = NULL;
@@ -115,7 +159,6 @@ end:
 OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_copy(OpenAPI_plmn_operator_class_1_t *dst, OpenAPI_plmn_operator_class_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_operator_class_1_convertToJSON(src);
@@ -124,21 +167,6 @@ OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_copy(OpenAPI_plmn
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_operator_class_1_free(dst);
     dst = OpenAPI_plmn_operator_class_1_parseFromJSON(item);
     cJSON_Delete(item);
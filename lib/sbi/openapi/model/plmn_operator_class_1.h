@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lcs_client_class.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_create(
 void OpenAPI_plmn_operator_class_1_free(OpenAPI_plmn_operator_class_1_t *plmn_operator_class_1);
 OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_parseFromJSON(cJSON *plmn_operator_class_1JSON);
 cJSON *OpenAPI_plmn_operator_class_1_convertToJSON(OpenAPI_plmn_operator_class_1_t *plmn_operator_class_1);
+bool OpenAPI_plmn_operator_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_operator_class_1_t *plmn_operator_class_1);
 OpenAPI_plmn_operator_class_1_t *OpenAPI_plmn_operator_class_1_copy(OpenAPI_plmn_operator_class_1_t *dst, OpenAPI_plmn_operator_class_1_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_plmn_range_t *OpenAPI_plmn_range_create(
 void OpenAPI_plmn_range_free(OpenAPI_plmn_range_t *plmn_range);
 OpenAPI_plmn_range_t *OpenAPI_plmn_range_parseFromJSON(cJSON *plmn_rangeJSON);
 cJSON *OpenAPI_plmn_range_convertToJSON(OpenAPI_plmn_range_t *plmn_range);
+bool OpenAPI_plmn_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_range_t *plmn_range);
 OpenAPI_plmn_range_t *OpenAPI_plmn_range_copy(OpenAPI_plmn_range_t *dst, OpenAPI_plmn_range_t *src);
 
 #ifdef __cplusplus
@@ -77,6 +77,54 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_route_selection_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_route_selection_descriptor_t *plmn_route_selection_descriptor)
+{
+    if (plmn_route_selection_descriptor == NULL) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [PlmnRouteSelectionDescriptor]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [PlmnRouteSelectionDescriptor]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "servingPlmn", plmn_route_selection_descriptor->serving_plmn) == false) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [serving_plmn]");
+        goto end;
+    }
+
+    if (plmn_route_selection_descriptor->snssai_route_sel_descs) {
+    if (OpenAPI_json_write_array_start(writer, "snssaiRouteSelDescs") == false) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [snssai_route_sel_descs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssai_route_sel_descs_node;
+    if (plmn_route_selection_descriptor->snssai_route_sel_descs) {
+        OpenAPI_list_for_each(plmn_route_selection_descriptor->snssai_route_sel_descs, snssai_route_sel_descs_node) {
+            if (OpenAPI_snssai_route_selection_descriptor_writeJSON(writer, NULL, snssai_route_sel_descs_node->data) == false) {
+                ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [snssai_route_sel_descs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [snssai_route_sel_descs]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_route_selection_descriptor_writeJSON() failed [PlmnRouteSelectionDescriptor]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_route_selection_descriptor_t *OpenAPI_plmn_route_selection_descriptor_parseFromJSON(cJSON *plmn_route_selection_descriptorJSON)
 {
     OpenAPI_plmn_route_selection_descriptor_t *plmn_route_selection_descriptor_local_var = NULL;
@@ -131,7 +179,6 @@ end:
 OpenAPI_plmn_route_selection_descriptor_t *OpenAPI_plmn_route_selection_descriptor_copy(OpenAPI_plmn_route_selection_descriptor_t *dst, OpenAPI_plmn_route_selection_descriptor_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_route_selection_descriptor_convertToJSON(src);
@@ -140,21 +187,6 @@ OpenAPI_plmn_route_selection_descriptor_t *OpenAPI_plmn_route_selection_descript
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_route_selection_descriptor_free(dst);
     dst = OpenAPI_plmn_route_selection_descriptor_parseFromJSON(item);
     cJSON_Delete(item);
@@ -85,6 +85,59 @@ end:
     return item;
 }
 
+bool OpenAPI_plmn_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_snssai_t *plmn_snssai)
+{
+    if (plmn_snssai == NULL) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [PlmnSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [PlmnSnssai]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", plmn_snssai->plmn_id) == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "sNssaiList") == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [s_nssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssai_list_node;
+    if (plmn_snssai->s_nssai_list) {
+        OpenAPI_list_for_each(plmn_snssai->s_nssai_list, s_nssai_list_node) {
+            if (OpenAPI_ext_snssai_writeJSON(writer, NULL, s_nssai_list_node->data) == false) {
+                ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [s_nssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [s_nssai_list]");
+        goto end;
+    }
+
+    if (plmn_snssai->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", plmn_snssai->nid) == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_plmn_snssai_writeJSON() failed [PlmnSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_parseFromJSON(cJSON *plmn_snssaiJSON)
 {
     OpenAPI_plmn_snssai_t *plmn_snssai_local_var = NULL;
@@ -151,7 +204,6 @@ end:
 OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_copy(OpenAPI_plmn_snssai_t *dst, OpenAPI_plmn_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_plmn_snssai_convertToJSON(src);
@@ -160,21 +212,6 @@ OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_copy(OpenAPI_plmn_snssai_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_plmn_snssai_free(dst);
     dst = OpenAPI_plmn_snssai_parseFromJSON(item);
     cJSON_Delete(item);
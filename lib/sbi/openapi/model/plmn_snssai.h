@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ext_snssai.h"
 #include "plmn_id.h"
 
@@ -34,6 +35,7 @@ OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_create(
 void OpenAPI_plmn_snssai_free(OpenAPI_plmn_snssai_t *plmn_snssai);
 OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_parseFromJSON(cJSON *plmn_snssaiJSON);
 cJSON *OpenAPI_plmn_snssai_convertToJSON(OpenAPI_plmn_snssai_t *plmn_snssai);
+bool OpenAPI_plmn_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_plmn_snssai_t *plmn_snssai);
 OpenAPI_plmn_snssai_t *OpenAPI_plmn_snssai_copy(OpenAPI_plmn_snssai_t *dst, OpenAPI_plmn_snssai_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_point_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_t *point)
+{
+    if (point == NULL) {
+        ogs_error("OpenAPI_point_writeJSON() failed [Point]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_writeJSON() failed [Point]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", point->shape) == false) {
+        ogs_error("OpenAPI_point_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point->point) == false) {
+        ogs_error("OpenAPI_point_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_writeJSON() failed [Point]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_t *OpenAPI_point_parseFromJSON(cJSON *pointJSON)
 {
     OpenAPI_point_t *point_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_point_t *OpenAPI_point_copy(OpenAPI_point_t *dst, OpenAPI_point_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_point_t *OpenAPI_point_copy(OpenAPI_point_t *dst, OpenAPI_point_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_free(dst);
     dst = OpenAPI_point_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "gad_shape.h"
 #include "geographical_coordinates.h"
 #include "point_all_of.h"
@@ -34,6 +35,7 @@ OpenAPI_point_t *OpenAPI_point_create(
 void OpenAPI_point_free(OpenAPI_point_t *point);
 OpenAPI_point_t *OpenAPI_point_parseFromJSON(cJSON *pointJSON);
 cJSON *OpenAPI_point_convertToJSON(OpenAPI_point_t *point);
+bool OpenAPI_point_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_t *point);
 OpenAPI_point_t *OpenAPI_point_copy(OpenAPI_point_t *dst, OpenAPI_point_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "geographical_coordinates.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_point_all_of_t *OpenAPI_point_all_of_create(
 void OpenAPI_point_all_of_free(OpenAPI_point_all_of_t *point_all_of);
 OpenAPI_point_all_of_t *OpenAPI_point_all_of_parseFromJSON(cJSON *point_all_ofJSON);
 cJSON *OpenAPI_point_all_of_convertToJSON(OpenAPI_point_all_of_t *point_all_of);
+bool OpenAPI_point_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_all_of_t *point_all_of);
 OpenAPI_point_all_of_t *OpenAPI_point_all_of_copy(OpenAPI_point_all_of_t *dst, OpenAPI_point_all_of_t *src);
 
 #ifdef __cplusplus
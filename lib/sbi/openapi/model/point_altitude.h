@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "gad_shape.h"
 #include "geographical_coordinates.h"
 #include "point_altitude_all_of.h"
@@ -36,6 +37,7 @@ OpenAPI_point_altitude_t *OpenAPI_point_altitude_create(
 void OpenAPI_point_altitude_free(OpenAPI_point_altitude_t *point_altitude);
 OpenAPI_point_altitude_t *OpenAPI_point_altitude_parseFromJSON(cJSON *point_altitudeJSON);
 cJSON *OpenAPI_point_altitude_convertToJSON(OpenAPI_point_altitude_t *point_altitude);
+bool OpenAPI_point_altitude_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_altitude_t *point_altitude);
 OpenAPI_point_altitude_t *OpenAPI_point_altitude_copy(OpenAPI_point_altitude_t *dst, OpenAPI_point_altitude_t *src);
 
 #ifdef __cplusplus
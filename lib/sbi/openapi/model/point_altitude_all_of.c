@@ -58,6 +58,38 @@ end:
     return item;
 }
 
+bool OpenAPI_point_altitude_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_altitude_all_of_t *point_altitude_all_of)
+{
+    if (point_altitude_all_of == NULL) {
+        ogs_error("OpenAPI_point_altitude_all_of_writeJSON() failed [PointAltitude_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_altitude_all_of_writeJSON() failed [PointAltitude_allOf]");
+        return false;
+    }
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_altitude_all_of->point) == false) {
+        ogs_error("OpenAPI_point_altitude_all_of_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "altitude", point_altitude_all_of->altitude) == false) {
+        ogs_error("OpenAPI_point_altitude_all_of_writeJSON() failed [altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_altitude_all_of_writeJSON() failed [PointAltitude_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_altitude_all_of_t *OpenAPI_point_altitude_all_of_parseFromJSON(cJSON *point_altitude_all_ofJSON)
 {
     OpenAPI_point_altitude_all_of_t *point_altitude_all_of_local_var = NULL;
@@ -95,7 +127,6 @@ end:
 OpenAPI_point_altitude_all_of_t *OpenAPI_point_altitude_all_of_copy(OpenAPI_point_altitude_all_of_t *dst, OpenAPI_point_altitude_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_altitude_all_of_convertToJSON(src);
@@ -104,21 +135,6 @@ OpenAPI_point_altitude_all_of_t *OpenAPI_point_altitude_all_of_copy(OpenAPI_poin
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_altitude_all_of_free(dst);
     dst = OpenAPI_point_altitude_all_of_parseFromJSON(item);
     cJSON_Delete(item);
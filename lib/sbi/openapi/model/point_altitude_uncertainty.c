@@ -100,6 +100,58 @@ end:
     return item;
 }
 
+bool OpenAPI_point_altitude_uncertainty_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_altitude_uncertainty_t *point_altitude_uncertainty)
+{
+    if (point_altitude_uncertainty == NULL) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [PointAltitudeUncertainty]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [PointAltitudeUncertainty]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", point_altitude_uncertainty->shape) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_altitude_uncertainty->point) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "altitude", point_altitude_uncertainty->altitude) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_uncertainty_ellipse_writeJSON(writer, "uncertaintyEllipse", point_altitude_uncertainty->uncertainty_ellipse) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [uncertainty_ellipse]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyAltitude", point_altitude_uncertainty->uncertainty_altitude) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [uncertainty_altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", point_altitude_uncertainty->confidence) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_writeJSON() failed [PointAltitudeUncertainty]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_altitude_uncertainty_t *OpenAPI_point_altitude_uncertainty_parseFromJSON(cJSON *point_altitude_uncertaintyJSON)
 {
     OpenAPI_point_altitude_uncertainty_t *point_altitude_uncertainty_local_var = NULL;
@@ -183,7 +235,6 @@ end:
 OpenAPI_point_altitude_uncertainty_t *OpenAPI_point_altitude_uncertainty_copy(OpenAPI_point_altitude_uncertainty_t *dst, OpenAPI_point_altitude_uncertainty_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_altitude_uncertainty_convertToJSON(src);
@@ -192,21 +243,6 @@ OpenAPI_point_altitude_uncertainty_t *OpenAPI_point_altitude_uncertainty_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_altitude_uncertainty_free(dst);
     dst = OpenAPI_point_altitude_uncertainty_parseFromJSON(item);
     cJSON_Delete(item);
@@ -86,6 +86,53 @@ end:
     return item;
 }
 
+bool OpenAPI_point_altitude_uncertainty_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_altitude_uncertainty_all_of_t *point_altitude_uncertainty_all_of)
+{
+    if (point_altitude_uncertainty_all_of == NULL) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [PointAltitudeUncertainty_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [PointAltitudeUncertainty_allOf]");
+        return false;
+    }
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_altitude_uncertainty_all_of->point) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "altitude", point_altitude_uncertainty_all_of->altitude) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_uncertainty_ellipse_writeJSON(writer, "uncertaintyEllipse", point_altitude_uncertainty_all_of->uncertainty_ellipse) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [uncertainty_ellipse]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertaintyAltitude", point_altitude_uncertainty_all_of->uncertainty_altitude) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [uncertainty_altitude]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", point_altitude_uncertainty_all_of->confidence) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_altitude_uncertainty_all_of_writeJSON() failed [PointAltitudeUncertainty_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_altitude_uncertainty_all_of_t *OpenAPI_point_altitude_uncertainty_all_of_parseFromJSON(cJSON *point_altitude_uncertainty_all_ofJSON)
 {
     OpenAPI_point_altitude_uncertainty_all_of_t *point_altitude_uncertainty_all_of_local_var = NULL;
@@ -159,7 +206,6 @@ end:
 OpenAPI_point_altitude_uncertainty_all_of_t *OpenAPI_point_altitude_uncertainty_all_of_copy(OpenAPI_point_altitude_uncertainty_all_of_t *dst, OpenAPI_point_altitude_uncertainty_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_altitude_uncertainty_all_of_convertToJSON(src);
@@ -168,21 +214,6 @@ OpenAPI_point_altitude_uncertainty_all_of_t *OpenAPI_point_altitude_uncertainty_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_altitude_uncertainty_all_of_free(dst);
     dst = OpenAPI_point_altitude_uncertainty_all_of_parseFromJSON(item);
     cJSON_Delete(item);
@@ -72,6 +72,43 @@ end:
     return item;
 }
 
+bool OpenAPI_point_uncertainty_circle_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_uncertainty_circle_t *point_uncertainty_circle)
+{
+    if (point_uncertainty_circle == NULL) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [PointUncertaintyCircle]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [PointUncertaintyCircle]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", point_uncertainty_circle->shape) == false) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_uncertainty_circle->point) == false) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uncertainty", point_uncertainty_circle->uncertainty) == false) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [uncertainty]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_uncertainty_circle_writeJSON() failed [PointUncertaintyCircle]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_uncertainty_circle_t *OpenAPI_point_uncertainty_circle_parseFromJSON(cJSON *point_uncertainty_circleJSON)
 {
     OpenAPI_point_uncertainty_circle_t *point_uncertainty_circle_local_var = NULL;
@@ -119,7 +156,6 @@ end:
 OpenAPI_point_uncertainty_circle_t *OpenAPI_point_uncertainty_circle_copy(OpenAPI_point_uncertainty_circle_t *dst, OpenAPI_point_uncertainty_circle_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_uncertainty_circle_convertToJSON(src);
@@ -128,21 +164,6 @@ OpenAPI_point_uncertainty_circle_t *OpenAPI_point_uncertainty_circle_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_uncertainty_circle_free(dst);
     dst = OpenAPI_point_uncertainty_circle_parseFromJSON(item);
     cJSON_Delete(item);
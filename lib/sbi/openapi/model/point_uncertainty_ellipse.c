@@ -86,6 +86,48 @@ end:
     return item;
 }
 
+bool OpenAPI_point_uncertainty_ellipse_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_uncertainty_ellipse_t *point_uncertainty_ellipse)
+{
+    if (point_uncertainty_ellipse == NULL) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [PointUncertaintyEllipse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [PointUncertaintyEllipse]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", point_uncertainty_ellipse->shape) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_uncertainty_ellipse->point) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_uncertainty_ellipse_writeJSON(writer, "uncertaintyEllipse", point_uncertainty_ellipse->uncertainty_ellipse) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [uncertainty_ellipse]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", point_uncertainty_ellipse->confidence) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_writeJSON() failed [PointUncertaintyEllipse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_uncertainty_ellipse_t *OpenAPI_point_uncertainty_ellipse_parseFromJSON(cJSON *point_uncertainty_ellipseJSON)
 {
     OpenAPI_point_uncertainty_ellipse_t *point_uncertainty_ellipse_local_var = NULL;
@@ -143,7 +185,6 @@ end:
 OpenAPI_point_uncertainty_ellipse_t *OpenAPI_point_uncertainty_ellipse_copy(OpenAPI_point_uncertainty_ellipse_t *dst, OpenAPI_point_uncertainty_ellipse_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_uncertainty_ellipse_convertToJSON(src);
@@ -152,21 +193,6 @@ OpenAPI_point_uncertainty_ellipse_t *OpenAPI_point_uncertainty_ellipse_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_uncertainty_ellipse_free(dst);
     dst = OpenAPI_point_uncertainty_ellipse_parseFromJSON(item);
     cJSON_Delete(item);
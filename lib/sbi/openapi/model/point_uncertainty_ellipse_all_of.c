@@ -72,6 +72,43 @@ end:
     return item;
 }
 
+bool OpenAPI_point_uncertainty_ellipse_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_point_uncertainty_ellipse_all_of_t *point_uncertainty_ellipse_all_of)
+{
+    if (point_uncertainty_ellipse_all_of == NULL) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [PointUncertaintyEllipse_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [PointUncertaintyEllipse_allOf]");
+        return false;
+    }
+    if (OpenAPI_geographical_coordinates_writeJSON(writer, "point", point_uncertainty_ellipse_all_of->point) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [point]");
+        goto end;
+    }
+
+    if (OpenAPI_uncertainty_ellipse_writeJSON(writer, "uncertaintyEllipse", point_uncertainty_ellipse_all_of->uncertainty_ellipse) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [uncertainty_ellipse]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "confidence", point_uncertainty_ellipse_all_of->confidence) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [confidence]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_point_uncertainty_ellipse_all_of_writeJSON() failed [PointUncertaintyEllipse_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_point_uncertainty_ellipse_all_of_t *OpenAPI_point_uncertainty_ellipse_all_of_parseFromJSON(cJSON *point_uncertainty_ellipse_all_ofJSON)
 {
     OpenAPI_point_uncertainty_ellipse_all_of_t *point_uncertainty_ellipse_all_of_local_var = NULL;
@@ -119,7 +156,6 @@ end:
 OpenAPI_point_uncertainty_ellipse_all_of_t *OpenAPI_point_uncertainty_ellipse_all_of_copy(OpenAPI_point_uncertainty_ellipse_all_of_t *dst, OpenAPI_point_uncertainty_ellipse_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_point_uncertainty_ellipse_all_of_convertToJSON(src);
@@ -128,21 +164,6 @@ OpenAPI_point_uncertainty_ellipse_all_of_t *OpenAPI_point_uncertainty_ellipse_al
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_point_uncertainty_ellipse_all_of_free(dst);
     dst = OpenAPI_point_uncertainty_ellipse_all_of_parseFromJSON(item);
     cJSON_Delete(item);
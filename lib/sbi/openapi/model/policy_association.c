@@ -186,6 +186,116 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_association_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_association_t *policy_association)
+{
+    if (policy_association == NULL) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [PolicyAssociation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [PolicyAssociation]");
+        return false;
+    }
+    if (policy_association->request) {
+    if (OpenAPI_policy_association_request_writeJSON(writer, "request", policy_association->request) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [request]");
+        goto end;
+    }
+    }
+
+    if (policy_association->triggers) {
+    if (OpenAPI_json_write_array_start(writer, "triggers") == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [triggers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *triggers_node;
+    OpenAPI_list_for_each(policy_association->triggers, triggers_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_request_trigger_ToString((intptr_t)triggers_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_writeJSON() failed [triggers]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [triggers]");
+        goto end;
+    }
+    }
+
+    if (policy_association->serv_area_res) {
+    if (OpenAPI_service_area_restriction_writeJSON(writer, "servAreaRes", policy_association->serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association->wl_serv_area_res) {
+    if (OpenAPI_wireline_service_area_restriction_writeJSON(writer, "wlServAreaRes", policy_association->wl_serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [wl_serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association->is_rfsp) {
+    if (OpenAPI_json_write_number(writer, "rfsp", policy_association->rfsp) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [rfsp]");
+        goto end;
+    }
+    }
+
+    if (policy_association->smf_sel_info) {
+    if (OpenAPI_smf_selection_data_writeJSON(writer, "smfSelInfo", policy_association->smf_sel_info) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [smf_sel_info]");
+        goto end;
+    }
+    }
+
+    if (policy_association->ue_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "ueAmbr", policy_association->ue_ambr) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (policy_association->pras) {
+    if (OpenAPI_json_write_object_start(writer, "pras") == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [pras]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pras_node;
+    if (policy_association->pras) {
+        OpenAPI_list_for_each(policy_association->pras, pras_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pras_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_policy_association_writeJSON() failed [pras]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [pras]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "suppFeat", policy_association->supp_feat) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_writeJSON() failed [PolicyAssociation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_association_t *OpenAPI_policy_association_parseFromJSON(cJSON *policy_associationJSON)
 {
     OpenAPI_policy_association_t *policy_association_local_var = NULL;
@@ -313,7 +423,6 @@ end:
 OpenAPI_policy_association_t *OpenAPI_policy_association_copy(OpenAPI_policy_association_t *dst, OpenAPI_policy_association_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_convertToJSON(src);
@@ -322,21 +431,6 @@ OpenAPI_policy_association_t *OpenAPI_policy_association_copy(OpenAPI_policy_ass
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_free(dst);
     dst = OpenAPI_policy_association_parseFromJSON(item);
     cJSON_Delete(item);
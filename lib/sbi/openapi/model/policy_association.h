@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "policy_association_request.h"
 #include "presence_info.h"
@@ -53,6 +54,7 @@ OpenAPI_policy_association_t *OpenAPI_policy_association_create(
 void OpenAPI_policy_association_free(OpenAPI_policy_association_t *policy_association);
 OpenAPI_policy_association_t *OpenAPI_policy_association_parseFromJSON(cJSON *policy_associationJSON);
 cJSON *OpenAPI_policy_association_convertToJSON(OpenAPI_policy_association_t *policy_association);
+bool OpenAPI_policy_association_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_association_t *policy_association);
 OpenAPI_policy_association_t *OpenAPI_policy_association_copy(OpenAPI_policy_association_t *dst, OpenAPI_policy_association_t *src);
 
 #ifdef __cplusplus
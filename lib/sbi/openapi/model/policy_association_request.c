@@ -444,6 +444,316 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_association_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_association_request_t *policy_association_request)
+{
+    if (policy_association_request == NULL) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [PolicyAssociationRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [PolicyAssociationRequest]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationUri", policy_association_request->notification_uri) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (policy_association_request->alt_notif_ipv4_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifIpv4Addrs") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_ipv4_addrs_node;
+    OpenAPI_list_for_each(policy_association_request->alt_notif_ipv4_addrs, alt_notif_ipv4_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_ipv4_addrs_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->alt_notif_ipv6_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifIpv6Addrs") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_ipv6_addrs_node;
+    OpenAPI_list_for_each(policy_association_request->alt_notif_ipv6_addrs, alt_notif_ipv6_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_ipv6_addrs_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->alt_notif_fqdns) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifFqdns") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_fqdns_node;
+    OpenAPI_list_for_each(policy_association_request->alt_notif_fqdns, alt_notif_fqdns_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_fqdns_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "supi", policy_association_request->supi) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (policy_association_request->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", policy_association_request->gpsi) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(policy_association_request->access_type)) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->access_types) {
+    if (OpenAPI_json_write_array_start(writer, "accessTypes") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [access_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *access_types_node;
+    OpenAPI_list_for_each(policy_association_request->access_types, access_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)access_types_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_request_writeJSON() failed [access_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [access_types]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", policy_association_request->pei) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->user_loc) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLoc", policy_association_request->user_loc) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [user_loc]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->time_zone) {
+    if (OpenAPI_json_write_string(writer, "timeZone", policy_association_request->time_zone) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [time_zone]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->serving_plmn) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingPlmn", policy_association_request->serving_plmn) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [serving_plmn]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(policy_association_request->rat_type)) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->rat_types) {
+    if (OpenAPI_json_write_array_start(writer, "ratTypes") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [rat_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rat_types_node;
+    OpenAPI_list_for_each(policy_association_request->rat_types, rat_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)rat_types_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_request_writeJSON() failed [rat_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [rat_types]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->group_ids) {
+    if (OpenAPI_json_write_array_start(writer, "groupIds") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [group_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *group_ids_node;
+    OpenAPI_list_for_each(policy_association_request->group_ids, group_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)group_ids_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [group_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [group_ids]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->serv_area_res) {
+    if (OpenAPI_service_area_restriction_writeJSON(writer, "servAreaRes", policy_association_request->serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->wl_serv_area_res) {
+    if (OpenAPI_wireline_service_area_restriction_writeJSON(writer, "wlServAreaRes", policy_association_request->wl_serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [wl_serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->is_rfsp) {
+    if (OpenAPI_json_write_number(writer, "rfsp", policy_association_request->rfsp) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [rfsp]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->ue_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "ueAmbr", policy_association_request->ue_ambr) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->allowed_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [allowed_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_snssais_node;
+    if (policy_association_request->allowed_snssais) {
+        OpenAPI_list_for_each(policy_association_request->allowed_snssais, allowed_snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, allowed_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_request_writeJSON() failed [allowed_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [allowed_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->mapping_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "mappingSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [mapping_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mapping_snssais_node;
+    if (policy_association_request->mapping_snssais) {
+        OpenAPI_list_for_each(policy_association_request->mapping_snssais, mapping_snssais_node) {
+            if (OpenAPI_mapping_of_snssai_writeJSON(writer, NULL, mapping_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_request_writeJSON() failed [mapping_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [mapping_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->n3g_allowed_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "n3gAllowedSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [n3g_allowed_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n3g_allowed_snssais_node;
+    if (policy_association_request->n3g_allowed_snssais) {
+        OpenAPI_list_for_each(policy_association_request->n3g_allowed_snssais, n3g_allowed_snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, n3g_allowed_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_request_writeJSON() failed [n3g_allowed_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [n3g_allowed_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", policy_association_request->guami) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->service_name) {
+    if (OpenAPI_json_write_string(writer, "serviceName", policy_association_request->service_name) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [service_name]");
+        goto end;
+    }
+    }
+
+    if (policy_association_request->trace_req) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceReq", policy_association_request->trace_req) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [trace_req]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "suppFeat", policy_association_request->supp_feat) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_request_writeJSON() failed [PolicyAssociationRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_parseFromJSON(cJSON *policy_association_requestJSON)
 {
     OpenAPI_policy_association_request_t *policy_association_request_local_var = NULL;
@@ -845,7 +1155,6 @@ end:
 OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_copy(OpenAPI_policy_association_request_t *dst, OpenAPI_policy_association_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_request_convertToJSON(src);
@@ -854,21 +1163,6 @@ OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_request_free(dst);
     dst = OpenAPI_policy_association_request_parseFromJSON(item);
     cJSON_Delete(item);
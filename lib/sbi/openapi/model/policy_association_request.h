@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "ambr.h"
 #include "guami.h"
@@ -91,6 +92,7 @@ OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_create(
 void OpenAPI_policy_association_request_free(OpenAPI_policy_association_request_t *policy_association_request);
 OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_parseFromJSON(cJSON *policy_association_requestJSON);
 cJSON *OpenAPI_policy_association_request_convertToJSON(OpenAPI_policy_association_request_t *policy_association_request);
+bool OpenAPI_policy_association_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_association_request_t *policy_association_request);
 OpenAPI_policy_association_request_t *OpenAPI_policy_association_request_copy(OpenAPI_policy_association_request_t *dst, OpenAPI_policy_association_request_t *src);
 
 #ifdef __cplusplus
@@ -400,6 +400,288 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_association_update_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_association_update_request_t *policy_association_update_request)
+{
+    if (policy_association_update_request == NULL) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [PolicyAssociationUpdateRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [PolicyAssociationUpdateRequest]");
+        return false;
+    }
+    if (policy_association_update_request->notification_uri) {
+    if (OpenAPI_json_write_string(writer, "notificationUri", policy_association_update_request->notification_uri) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->alt_notif_ipv4_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifIpv4Addrs") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_ipv4_addrs_node;
+    OpenAPI_list_for_each(policy_association_update_request->alt_notif_ipv4_addrs, alt_notif_ipv4_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_ipv4_addrs_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv4_addrs]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->alt_notif_ipv6_addrs) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifIpv6Addrs") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_ipv6_addrs_node;
+    OpenAPI_list_for_each(policy_association_update_request->alt_notif_ipv6_addrs, alt_notif_ipv6_addrs_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_ipv6_addrs_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_ipv6_addrs]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->alt_notif_fqdns) {
+    if (OpenAPI_json_write_array_start(writer, "altNotifFqdns") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *alt_notif_fqdns_node;
+    OpenAPI_list_for_each(policy_association_update_request->alt_notif_fqdns, alt_notif_fqdns_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)alt_notif_fqdns_node->data) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [alt_notif_fqdns]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->triggers) {
+    if (OpenAPI_json_write_array_start(writer, "triggers") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [triggers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *triggers_node;
+    OpenAPI_list_for_each(policy_association_update_request->triggers, triggers_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_request_trigger_ToString((intptr_t)triggers_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [triggers]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [triggers]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->serv_area_res) {
+    if (OpenAPI_service_area_restriction_writeJSON(writer, "servAreaRes", policy_association_update_request->serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->wl_serv_area_res) {
+    if (OpenAPI_wireline_service_area_restriction_writeJSON(writer, "wlServAreaRes", policy_association_update_request->wl_serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [wl_serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->is_rfsp) {
+    if (OpenAPI_json_write_number(writer, "rfsp", policy_association_update_request->rfsp) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [rfsp]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->smf_sel_info) {
+    if (OpenAPI_smf_selection_data_writeJSON(writer, "smfSelInfo", policy_association_update_request->smf_sel_info) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [smf_sel_info]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->ue_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "ueAmbr", policy_association_update_request->ue_ambr) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->pra_statuses) {
+    if (OpenAPI_json_write_object_start(writer, "praStatuses") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [pra_statuses]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pra_statuses_node;
+    if (policy_association_update_request->pra_statuses) {
+        OpenAPI_list_for_each(policy_association_update_request->pra_statuses, pra_statuses_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pra_statuses_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [pra_statuses]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [pra_statuses]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->user_loc) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLoc", policy_association_update_request->user_loc) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [user_loc]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->allowed_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [allowed_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_snssais_node;
+    if (policy_association_update_request->allowed_snssais) {
+        OpenAPI_list_for_each(policy_association_update_request->allowed_snssais, allowed_snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, allowed_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [allowed_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [allowed_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->mapping_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "mappingSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [mapping_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mapping_snssais_node;
+    if (policy_association_update_request->mapping_snssais) {
+        OpenAPI_list_for_each(policy_association_update_request->mapping_snssais, mapping_snssais_node) {
+            if (OpenAPI_mapping_of_snssai_writeJSON(writer, NULL, mapping_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [mapping_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [mapping_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->access_types) {
+    if (OpenAPI_json_write_array_start(writer, "accessTypes") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [access_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *access_types_node;
+    OpenAPI_list_for_each(policy_association_update_request->access_types, access_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)access_types_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [access_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [access_types]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->rat_types) {
+    if (OpenAPI_json_write_array_start(writer, "ratTypes") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [rat_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rat_types_node;
+    OpenAPI_list_for_each(policy_association_update_request->rat_types, rat_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)rat_types_node->data)) == false) {
+            ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [rat_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [rat_types]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->n3g_allowed_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "n3gAllowedSnssais") == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [n3g_allowed_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n3g_allowed_snssais_node;
+    if (policy_association_update_request->n3g_allowed_snssais) {
+        OpenAPI_list_for_each(policy_association_update_request->n3g_allowed_snssais, n3g_allowed_snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, n3g_allowed_snssais_node->data) == false) {
+                ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [n3g_allowed_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [n3g_allowed_snssais]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->trace_req) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceReq", policy_association_update_request->trace_req) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [trace_req]");
+        goto end;
+    }
+    }
+
+    if (policy_association_update_request->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", policy_association_update_request->guami) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_association_update_request_writeJSON() failed [PolicyAssociationUpdateRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_association_update_request_t *OpenAPI_policy_association_update_request_parseFromJSON(cJSON *policy_association_update_requestJSON)
 {
     OpenAPI_policy_association_update_request_t *policy_association_update_request_local_var = NULL;
@@ -740,7 +1022,6 @@ end:
 OpenAPI_policy_association_update_request_t *OpenAPI_policy_association_update_request_copy(OpenAPI_policy_association_update_request_t *dst, OpenAPI_policy_association_update_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_association_update_request_convertToJSON(src);
@@ -749,21 +1030,6 @@ OpenAPI_policy_association_update_request_t *OpenAPI_policy_association_update_r
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_association_update_request_free(dst);
     dst = OpenAPI_policy_association_update_request_parseFromJSON(item);
     cJSON_Delete(item);
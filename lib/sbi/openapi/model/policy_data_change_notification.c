@@ -311,6 +311,189 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_data_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_data_change_notification_t *policy_data_change_notification)
+{
+    if (policy_data_change_notification == NULL) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [PolicyDataChangeNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [PolicyDataChangeNotification]");
+        return false;
+    }
+    if (policy_data_change_notification->am_policy_data) {
+    if (OpenAPI_am_policy_data_writeJSON(writer, "amPolicyData", policy_data_change_notification->am_policy_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [am_policy_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->ue_policy_set) {
+    if (OpenAPI_ue_policy_set_writeJSON(writer, "uePolicySet", policy_data_change_notification->ue_policy_set) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [ue_policy_set]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->plmn_ue_policy_set) {
+    if (OpenAPI_ue_policy_set_writeJSON(writer, "plmnUePolicySet", policy_data_change_notification->plmn_ue_policy_set) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [plmn_ue_policy_set]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->sm_policy_data) {
+    if (OpenAPI_sm_policy_data_writeJSON(writer, "smPolicyData", policy_data_change_notification->sm_policy_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [sm_policy_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->usage_mon_data) {
+    if (OpenAPI_usage_mon_data_writeJSON(writer, "usageMonData", policy_data_change_notification->usage_mon_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [usage_mon_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->sponsor_connectivity_data) {
+    if (OpenAPI_sponsor_connectivity_data_writeJSON(writer, "SponsorConnectivityData", policy_data_change_notification->sponsor_connectivity_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [sponsor_connectivity_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->bdt_data) {
+    if (OpenAPI_bdt_data_writeJSON(writer, "bdtData", policy_data_change_notification->bdt_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [bdt_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->op_spec_data) {
+    if (OpenAPI_operator_specific_data_container_writeJSON(writer, "opSpecData", policy_data_change_notification->op_spec_data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [op_spec_data]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->op_spec_data_map) {
+    if (OpenAPI_json_write_object_start(writer, "opSpecDataMap") == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [op_spec_data_map]");
+        goto end;
+    }
+    OpenAPI_lnode_t *op_spec_data_map_node;
+    if (policy_data_change_notification->op_spec_data_map) {
+        OpenAPI_list_for_each(policy_data_change_notification->op_spec_data_map, op_spec_data_map_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)op_spec_data_map_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_operator_specific_data_container_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [op_spec_data_map]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [op_spec_data_map]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->ue_id) {
+    if (OpenAPI_json_write_string(writer, "ueId", policy_data_change_notification->ue_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [ue_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->sponsor_id) {
+    if (OpenAPI_json_write_string(writer, "sponsorId", policy_data_change_notification->sponsor_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [sponsor_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->bdt_ref_id) {
+    if (OpenAPI_json_write_string(writer, "bdtRefId", policy_data_change_notification->bdt_ref_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [bdt_ref_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->usage_mon_id) {
+    if (OpenAPI_json_write_string(writer, "usageMonId", policy_data_change_notification->usage_mon_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [usage_mon_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->plmn_id) {
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", policy_data_change_notification->plmn_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->del_resources) {
+    if (OpenAPI_json_write_array_start(writer, "delResources") == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *del_resources_node;
+    OpenAPI_list_for_each(policy_data_change_notification->del_resources, del_resources_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)del_resources_node->data) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [del_resources]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->notif_id) {
+    if (OpenAPI_json_write_string(writer, "notifId", policy_data_change_notification->notif_id) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [notif_id]");
+        goto end;
+    }
+    }
+
+    if (policy_data_change_notification->reported_fragments) {
+    if (OpenAPI_json_write_array_start(writer, "reportedFragments") == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [reported_fragments]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *reported_fragments_node;
+    if (policy_data_change_notification->reported_fragments) {
+        OpenAPI_list_for_each(policy_data_change_notification->reported_fragments, reported_fragments_node) {
+            if (OpenAPI_notification_item_writeJSON(writer, NULL, reported_fragments_node->data) == false) {
+                ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [reported_fragments]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [reported_fragments]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_change_notification_writeJSON() failed [PolicyDataChangeNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notification_parseFromJSON(cJSON *policy_data_change_notificationJSON)
 {
     OpenAPI_policy_data_change_notification_t *policy_data_change_notification_local_var = NULL;
@@ -525,7 +708,6 @@ end:
 OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notification_copy(OpenAPI_policy_data_change_notification_t *dst, OpenAPI_policy_data_change_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_data_change_notification_convertToJSON(src);
@@ -534,21 +716,6 @@ OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notificati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_data_change_notification_free(dst);
     dst = OpenAPI_policy_data_change_notification_parseFromJSON(item);
     cJSON_Delete(item);
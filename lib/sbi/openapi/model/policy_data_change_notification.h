@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "am_policy_data.h"
 #include "bdt_data.h"
 #include "notification_item.h"
@@ -69,6 +70,7 @@ OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notificati
 void OpenAPI_policy_data_change_notification_free(OpenAPI_policy_data_change_notification_t *policy_data_change_notification);
 OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notification_parseFromJSON(cJSON *policy_data_change_notificationJSON);
 cJSON *OpenAPI_policy_data_change_notification_convertToJSON(OpenAPI_policy_data_change_notification_t *policy_data_change_notification);
+bool OpenAPI_policy_data_change_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_data_change_notification_t *policy_data_change_notification);
 OpenAPI_policy_data_change_notification_t *OpenAPI_policy_data_change_notification_copy(OpenAPI_policy_data_change_notification_t *dst, OpenAPI_policy_data_change_notification_t *src);
 
 #ifdef __cplusplus
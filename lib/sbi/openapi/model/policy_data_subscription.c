@@ -121,6 +121,92 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_data_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_data_subscription_t *policy_data_subscription)
+{
+    if (policy_data_subscription == NULL) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [PolicyDataSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [PolicyDataSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationUri", policy_data_subscription->notification_uri) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (policy_data_subscription->notif_id) {
+    if (OpenAPI_json_write_string(writer, "notifId", policy_data_subscription->notif_id) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [notif_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "monitoredResourceUris") == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_resource_uris_node;
+    OpenAPI_list_for_each(policy_data_subscription->monitored_resource_uris, monitored_resource_uris_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_resource_uris_node->data) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    if (policy_data_subscription->mon_res_items) {
+    if (OpenAPI_json_write_array_start(writer, "monResItems") == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [mon_res_items]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mon_res_items_node;
+    if (policy_data_subscription->mon_res_items) {
+        OpenAPI_list_for_each(policy_data_subscription->mon_res_items, mon_res_items_node) {
+            if (OpenAPI_resource_item_writeJSON(writer, NULL, mon_res_items_node->data) == false) {
+                ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [mon_res_items]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [mon_res_items]");
+        goto end;
+    }
+    }
+
+    if (policy_data_subscription->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", policy_data_subscription->expiry) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (policy_data_subscription->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", policy_data_subscription->supported_features) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_data_subscription_writeJSON() failed [PolicyDataSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_parseFromJSON(cJSON *policy_data_subscriptionJSON)
 {
     OpenAPI_policy_data_subscription_t *policy_data_subscription_local_var = NULL;
@@ -230,7 +316,6 @@ end:
 OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_copy(OpenAPI_policy_data_subscription_t *dst, OpenAPI_policy_data_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_data_subscription_convertToJSON(src);
@@ -239,21 +324,6 @@ OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_data_subscription_free(dst);
     dst = OpenAPI_policy_data_subscription_parseFromJSON(item);
     cJSON_Delete(item);
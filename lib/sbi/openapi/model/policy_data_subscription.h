@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "resource_item.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_create(
 void OpenAPI_policy_data_subscription_free(OpenAPI_policy_data_subscription_t *policy_data_subscription);
 OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_parseFromJSON(cJSON *policy_data_subscriptionJSON);
 cJSON *OpenAPI_policy_data_subscription_convertToJSON(OpenAPI_policy_data_subscription_t *policy_data_subscription);
+bool OpenAPI_policy_data_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_data_subscription_t *policy_data_subscription);
 OpenAPI_policy_data_subscription_t *OpenAPI_policy_data_subscription_copy(OpenAPI_policy_data_subscription_t *dst, OpenAPI_policy_data_subscription_t *src);
 
 #ifdef __cplusplus
@@ -170,6 +170,109 @@ end:
     return item;
 }
 
+bool OpenAPI_policy_update_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_update_t *policy_update)
+{
+    if (policy_update == NULL) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [PolicyUpdate]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [PolicyUpdate]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceUri", policy_update->resource_uri) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [resource_uri]");
+        goto end;
+    }
+
+    if (policy_update->triggers) {
+    if (OpenAPI_json_write_array_start(writer, "triggers") == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [triggers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *triggers_node;
+    OpenAPI_list_for_each(policy_update->triggers, triggers_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_request_trigger_ToString((intptr_t)triggers_node->data)) == false) {
+            ogs_error("OpenAPI_policy_update_writeJSON() failed [triggers]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [triggers]");
+        goto end;
+    }
+    }
+
+    if (policy_update->serv_area_res) {
+    if (OpenAPI_service_area_restriction_writeJSON(writer, "servAreaRes", policy_update->serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_update->wl_serv_area_res) {
+    if (OpenAPI_wireline_service_area_restriction_writeJSON(writer, "wlServAreaRes", policy_update->wl_serv_area_res) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [wl_serv_area_res]");
+        goto end;
+    }
+    }
+
+    if (policy_update->is_rfsp) {
+    if (OpenAPI_json_write_number(writer, "rfsp", policy_update->rfsp) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [rfsp]");
+        goto end;
+    }
+    }
+
+    if (policy_update->smf_sel_info) {
+    if (OpenAPI_smf_selection_data_writeJSON(writer, "smfSelInfo", policy_update->smf_sel_info) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [smf_sel_info]");
+        goto end;
+    }
+    }
+
+    if (policy_update->ue_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "ueAmbr", policy_update->ue_ambr) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (policy_update->pras) {
+    if (OpenAPI_json_write_object_start(writer, "pras") == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [pras]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pras_node;
+    if (policy_update->pras) {
+        OpenAPI_list_for_each(policy_update->pras, pras_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pras_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_rm_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_policy_update_writeJSON() failed [pras]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [pras]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_policy_update_writeJSON() failed [PolicyUpdate]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_policy_update_t *OpenAPI_policy_update_parseFromJSON(cJSON *policy_updateJSON)
 {
     OpenAPI_policy_update_t *policy_update_local_var = NULL;
@@ -289,7 +392,6 @@ end:
 OpenAPI_policy_update_t *OpenAPI_policy_update_copy(OpenAPI_policy_update_t *dst, OpenAPI_policy_update_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_policy_update_convertToJSON(src);
@@ -298,21 +400,6 @@ OpenAPI_policy_update_t *OpenAPI_policy_update_copy(OpenAPI_policy_update_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_policy_update_free(dst);
     dst = OpenAPI_policy_update_parseFromJSON(item);
     cJSON_Delete(item);
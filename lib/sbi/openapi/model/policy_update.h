@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "presence_info_rm.h"
 #include "request_trigger.h"
@@ -50,6 +51,7 @@ OpenAPI_policy_update_t *OpenAPI_policy_update_create(
 void OpenAPI_policy_update_free(OpenAPI_policy_update_t *policy_update);
 OpenAPI_policy_update_t *OpenAPI_policy_update_parseFromJSON(cJSON *policy_updateJSON);
 cJSON *OpenAPI_policy_update_convertToJSON(OpenAPI_policy_update_t *policy_update);
+bool OpenAPI_policy_update_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_policy_update_t *policy_update);
 OpenAPI_policy_update_t *OpenAPI_policy_update_copy(OpenAPI_policy_update_t *dst, OpenAPI_policy_update_t *src);
 
 #ifdef __cplusplus
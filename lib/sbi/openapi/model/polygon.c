@@ -75,6 +75,52 @@ end:
     return item;
 }
 
+bool OpenAPI_polygon_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_polygon_t *polygon)
+{
+    if (polygon == NULL) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [Polygon]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [Polygon]");
+        return false;
+    }
+    if (OpenAPI_supported_gad_shapes_writeJSON(writer, "shape", polygon->shape) == false) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [shape]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pointList") == false) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *point_list_node;
+    if (polygon->point_list) {
+        OpenAPI_list_for_each(polygon->point_list, point_list_node) {
+            if (OpenAPI_geographical_coordinates_writeJSON(writer, NULL, point_list_node->data) == false) {
+                ogs_error("OpenAPI_polygon_writeJSON() failed [point_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_polygon_writeJSON() failed [Polygon]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_polygon_t *OpenAPI_polygon_parseFromJSON(cJSON *polygonJSON)
 {
     OpenAPI_polygon_t *polygon_local_var = NULL;
@@ -131,7 +177,6 @@ end:
 OpenAPI_polygon_t *OpenAPI_polygon_copy(OpenAPI_polygon_t *dst, OpenAPI_polygon_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_polygon_convertToJSON(src);
@@ -140,21 +185,6 @@ OpenAPI_polygon_t *OpenAPI_polygon_copy(OpenAPI_polygon_t *dst, OpenAPI_polygon_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_polygon_free(dst);
     dst = OpenAPI_polygon_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "gad_shape.h"
 #include "geographical_coordinates.h"
 #include "polygon_all_of.h"
@@ -34,6 +35,7 @@ OpenAPI_polygon_t *OpenAPI_polygon_create(
 void OpenAPI_polygon_free(OpenAPI_polygon_t *polygon);
 OpenAPI_polygon_t *OpenAPI_polygon_parseFromJSON(cJSON *polygonJSON);
 cJSON *OpenAPI_polygon_convertToJSON(OpenAPI_polygon_t *polygon);
+bool OpenAPI_polygon_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_polygon_t *polygon);
 OpenAPI_polygon_t *OpenAPI_polygon_copy(OpenAPI_polygon_t *dst, OpenAPI_polygon_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_polygon_all_of_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_polygon_all_of_t *polygon_all_of)
+{
+    if (polygon_all_of == NULL) {
+        ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [Polygon_allOf]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [Polygon_allOf]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "pointList") == false) {
+        ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *point_list_node;
+    if (polygon_all_of->point_list) {
+        OpenAPI_list_for_each(polygon_all_of->point_list, point_list_node) {
+            if (OpenAPI_geographical_coordinates_writeJSON(writer, NULL, point_list_node->data) == false) {
+                ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [point_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [point_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_polygon_all_of_writeJSON() failed [Polygon_allOf]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_polygon_all_of_t *OpenAPI_polygon_all_of_parseFromJSON(cJSON *polygon_all_ofJSON)
 {
     OpenAPI_polygon_all_of_t *polygon_all_of_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_polygon_all_of_t *OpenAPI_polygon_all_of_copy(OpenAPI_polygon_all_of_t *dst, OpenAPI_polygon_all_of_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_polygon_all_of_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_polygon_all_of_t *OpenAPI_polygon_all_of_copy(OpenAPI_polygon_all_of_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_polygon_all_of_free(dst);
     dst = OpenAPI_polygon_all_of_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_port_management_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_port_management_container_t *port_management_container)
+{
+    if (port_management_container == NULL) {
+        ogs_error("OpenAPI_port_management_container_writeJSON() failed [PortManagementContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_port_management_container_writeJSON() failed [PortManagementContainer]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "portManCont", port_management_container->port_man_cont) == false) {
+        ogs_error("OpenAPI_port_management_container_writeJSON() failed [port_man_cont]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "portNum", port_management_container->port_num) == false) {
+        ogs_error("OpenAPI_port_management_container_writeJSON() failed [port_num]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_port_management_container_writeJSON() failed [PortManagementContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_port_management_container_t *OpenAPI_port_management_container_parseFromJSON(cJSON *port_management_containerJSON)
 {
     OpenAPI_port_management_container_t *port_management_container_local_var = NULL;
@@ -90,7 +122,6 @@ end:
 OpenAPI_port_management_container_t *OpenAPI_port_management_container_copy(OpenAPI_port_management_container_t *dst, OpenAPI_port_management_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_port_management_container_convertToJSON(src);
@@ -99,21 +130,6 @@ OpenAPI_port_management_container_t *OpenAPI_port_management_container_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_port_management_container_free(dst);
     dst = OpenAPI_port_management_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_port_management_container_t *OpenAPI_port_management_container_create(
 void OpenAPI_port_management_container_free(OpenAPI_port_management_container_t *port_management_container);
 OpenAPI_port_management_container_t *OpenAPI_port_management_container_parseFromJSON(cJSON *port_management_containerJSON);
 cJSON *OpenAPI_port_management_container_convertToJSON(OpenAPI_port_management_container_t *port_management_container);
+bool OpenAPI_port_management_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_port_management_container_t *port_management_container);
 OpenAPI_port_management_container_t *OpenAPI_port_management_container_copy(OpenAPI_port_management_container_t *dst, OpenAPI_port_management_container_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "allowed_mtc_provider_info.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_pp5g_vn_group_profile_data_t *OpenAPI_pp5g_vn_group_profile_data_create(
 void OpenAPI_pp5g_vn_group_profile_data_free(OpenAPI_pp5g_vn_group_profile_data_t *pp5g_vn_group_profile_data);
 OpenAPI_pp5g_vn_group_profile_data_t *OpenAPI_pp5g_vn_group_profile_data_parseFromJSON(cJSON *pp5g_vn_group_profile_dataJSON);
 cJSON *OpenAPI_pp5g_vn_group_profile_data_convertToJSON(OpenAPI_pp5g_vn_group_profile_data_t *pp5g_vn_group_profile_data);
+bool OpenAPI_pp5g_vn_group_profile_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp5g_vn_group_profile_data_t *pp5g_vn_group_profile_data);
 OpenAPI_pp5g_vn_group_profile_data_t *OpenAPI_pp5g_vn_group_profile_data_copy(OpenAPI_pp5g_vn_group_profile_data_t *dst, OpenAPI_pp5g_vn_group_profile_data_t *src);
 
 #ifdef __cplusplus
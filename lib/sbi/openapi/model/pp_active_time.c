@@ -79,6 +79,57 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_active_time_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_active_time_t *pp_active_time)
+{
+    if (pp_active_time == NULL) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [PpActiveTime]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [PpActiveTime]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "activeTime", pp_active_time->active_time) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [active_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "afInstanceId", pp_active_time->af_instance_id) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", pp_active_time->reference_id) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (pp_active_time->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", pp_active_time->validity_time) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (pp_active_time->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", pp_active_time->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_active_time_writeJSON() failed [PpActiveTime]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_parseFromJSON(cJSON *pp_active_timeJSON)
 {
     OpenAPI_pp_active_time_t *pp_active_time_local_var = NULL;
@@ -151,7 +202,6 @@ end:
 OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_copy(OpenAPI_pp_active_time_t *dst, OpenAPI_pp_active_time_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_active_time_convertToJSON(src);
@@ -160,21 +210,6 @@ OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_copy(OpenAPI_pp_active_time_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_active_time_free(dst);
     dst = OpenAPI_pp_active_time_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +37,7 @@ OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_create(
 void OpenAPI_pp_active_time_free(OpenAPI_pp_active_time_t *pp_active_time);
 OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_parseFromJSON(cJSON *pp_active_timeJSON);
 cJSON *OpenAPI_pp_active_time_convertToJSON(OpenAPI_pp_active_time_t *pp_active_time);
+bool OpenAPI_pp_active_time_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_active_time_t *pp_active_time);
 OpenAPI_pp_active_time_t *OpenAPI_pp_active_time_copy(OpenAPI_pp_active_time_t *dst, OpenAPI_pp_active_time_t *src);
 
 #ifdef __cplusplus
@@ -153,6 +153,84 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_data_t *pp_data)
+{
+    if (pp_data == NULL) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [PpData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [PpData]");
+        return false;
+    }
+    if (pp_data->communication_characteristics) {
+    if (OpenAPI_communication_characteristics_writeJSON(writer, "communicationCharacteristics", pp_data->communication_characteristics) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [communication_characteristics]");
+        goto end;
+    }
+    }
+
+    if (pp_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", pp_data->supported_features) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (pp_data->expected_ue_behaviour_parameters) {
+    if (OpenAPI_expected_ue_behaviour_writeJSON(writer, "expectedUeBehaviourParameters", pp_data->expected_ue_behaviour_parameters) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [expected_ue_behaviour_parameters]");
+        goto end;
+    }
+    }
+
+    if (pp_data->ec_restriction) {
+    if (OpenAPI_ec_restriction_writeJSON(writer, "ecRestriction", pp_data->ec_restriction) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [ec_restriction]");
+        goto end;
+    }
+    }
+
+    if (pp_data->acs_info) {
+    if (OpenAPI_acs_info_rm_writeJSON(writer, "acsInfo", pp_data->acs_info) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [acs_info]");
+        goto end;
+    }
+    }
+
+    if (pp_data->stn_sr) {
+    if (OpenAPI_json_write_string(writer, "stnSr", pp_data->stn_sr) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [stn_sr]");
+        goto end;
+    }
+    }
+
+    if (pp_data->lcs_privacy) {
+    if (OpenAPI_lcs_privacy_writeJSON(writer, "lcsPrivacy", pp_data->lcs_privacy) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [lcs_privacy]");
+        goto end;
+    }
+    }
+
+    if (pp_data->sor_info) {
+    if (OpenAPI_sor_info_writeJSON(writer, "sorInfo", pp_data->sor_info) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [sor_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_data_writeJSON() failed [PpData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_data_t *OpenAPI_pp_data_parseFromJSON(cJSON *pp_dataJSON)
 {
     OpenAPI_pp_data_t *pp_data_local_var = NULL;
@@ -235,7 +313,6 @@ end:
 OpenAPI_pp_data_t *OpenAPI_pp_data_copy(OpenAPI_pp_data_t *dst, OpenAPI_pp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_data_convertToJSON(src);
@@ -244,21 +321,6 @@ OpenAPI_pp_data_t *OpenAPI_pp_data_copy(OpenAPI_pp_data_t *dst, OpenAPI_pp_data_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_data_free(dst);
     dst = OpenAPI_pp_data_parseFromJSON(item);
     cJSON_Delete(item);
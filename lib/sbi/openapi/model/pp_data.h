@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "acs_info_rm.h"
 #include "communication_characteristics.h"
 #include "ec_restriction.h"
@@ -48,6 +49,7 @@ OpenAPI_pp_data_t *OpenAPI_pp_data_create(
 void OpenAPI_pp_data_free(OpenAPI_pp_data_t *pp_data);
 OpenAPI_pp_data_t *OpenAPI_pp_data_parseFromJSON(cJSON *pp_dataJSON);
 cJSON *OpenAPI_pp_data_convertToJSON(OpenAPI_pp_data_t *pp_data);
+bool OpenAPI_pp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_data_t *pp_data);
 OpenAPI_pp_data_t *OpenAPI_pp_data_copy(OpenAPI_pp_data_t *dst, OpenAPI_pp_data_t *src);
 
 #ifdef __cplusplus
@@ -72,6 +72,52 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_dl_packet_count_ext_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_dl_packet_count_ext_t *pp_dl_packet_count_ext)
+{
+    if (pp_dl_packet_count_ext == NULL) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [PpDlPacketCountExt]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [PpDlPacketCountExt]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "afInstanceId", pp_dl_packet_count_ext->af_instance_id) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", pp_dl_packet_count_ext->reference_id) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (pp_dl_packet_count_ext->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", pp_dl_packet_count_ext->validity_time) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (pp_dl_packet_count_ext->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", pp_dl_packet_count_ext->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_dl_packet_count_ext_writeJSON() failed [PpDlPacketCountExt]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_dl_packet_count_ext_t *OpenAPI_pp_dl_packet_count_ext_parseFromJSON(cJSON *pp_dl_packet_count_extJSON)
 {
     OpenAPI_pp_dl_packet_count_ext_t *pp_dl_packet_count_ext_local_var = NULL;
@@ -131,7 +177,6 @@ end:
 OpenAPI_pp_dl_packet_count_ext_t *OpenAPI_pp_dl_packet_count_ext_copy(OpenAPI_pp_dl_packet_count_ext_t *dst, OpenAPI_pp_dl_packet_count_ext_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_dl_packet_count_ext_convertToJSON(src);
@@ -140,21 +185,6 @@ OpenAPI_pp_dl_packet_count_ext_t *OpenAPI_pp_dl_packet_count_ext_copy(OpenAPI_pp
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_dl_packet_count_ext_free(dst);
     dst = OpenAPI_pp_dl_packet_count_ext_parseFromJSON(item);
     cJSON_Delete(item);
@@ -79,6 +79,57 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_maximum_latency_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_maximum_latency_t *pp_maximum_latency)
+{
+    if (pp_maximum_latency == NULL) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [PpMaximumLatency]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [PpMaximumLatency]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "maximumLatency", pp_maximum_latency->maximum_latency) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [maximum_latency]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "afInstanceId", pp_maximum_latency->af_instance_id) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", pp_maximum_latency->reference_id) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (pp_maximum_latency->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", pp_maximum_latency->validity_time) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (pp_maximum_latency->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", pp_maximum_latency->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_maximum_latency_writeJSON() failed [PpMaximumLatency]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_parseFromJSON(cJSON *pp_maximum_latencyJSON)
 {
     OpenAPI_pp_maximum_latency_t *pp_maximum_latency_local_var = NULL;
@@ -151,7 +202,6 @@ end:
 OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_copy(OpenAPI_pp_maximum_latency_t *dst, OpenAPI_pp_maximum_latency_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_maximum_latency_convertToJSON(src);
@@ -160,21 +210,6 @@ OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_copy(OpenAPI_pp_maximum
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_maximum_latency_free(dst);
     dst = OpenAPI_pp_maximum_latency_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +37,7 @@ OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_create(
 void OpenAPI_pp_maximum_latency_free(OpenAPI_pp_maximum_latency_t *pp_maximum_latency);
 OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_parseFromJSON(cJSON *pp_maximum_latencyJSON);
 cJSON *OpenAPI_pp_maximum_latency_convertToJSON(OpenAPI_pp_maximum_latency_t *pp_maximum_latency);
+bool OpenAPI_pp_maximum_latency_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_maximum_latency_t *pp_maximum_latency);
 OpenAPI_pp_maximum_latency_t *OpenAPI_pp_maximum_latency_copy(OpenAPI_pp_maximum_latency_t *dst, OpenAPI_pp_maximum_latency_t *src);
 
 #ifdef __cplusplus
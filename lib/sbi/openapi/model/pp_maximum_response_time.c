@@ -79,6 +79,57 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_maximum_response_time_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_maximum_response_time_t *pp_maximum_response_time)
+{
+    if (pp_maximum_response_time == NULL) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [PpMaximumResponseTime]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [PpMaximumResponseTime]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "maximumResponseTime", pp_maximum_response_time->maximum_response_time) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [maximum_response_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "afInstanceId", pp_maximum_response_time->af_instance_id) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", pp_maximum_response_time->reference_id) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (pp_maximum_response_time->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", pp_maximum_response_time->validity_time) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (pp_maximum_response_time->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", pp_maximum_response_time->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_maximum_response_time_writeJSON() failed [PpMaximumResponseTime]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_maximum_response_time_t *OpenAPI_pp_maximum_response_time_parseFromJSON(cJSON *pp_maximum_response_timeJSON)
 {
     OpenAPI_pp_maximum_response_time_t *pp_maximum_response_time_local_var = NULL;
@@ -151,7 +202,6 @@ end:
 OpenAPI_pp_maximum_response_time_t *OpenAPI_pp_maximum_response_time_copy(OpenAPI_pp_maximum_response_time_t *dst, OpenAPI_pp_maximum_response_time_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_maximum_response_time_convertToJSON(src);
@@ -160,21 +210,6 @@ OpenAPI_pp_maximum_response_time_t *OpenAPI_pp_maximum_response_time_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_maximum_response_time_free(dst);
     dst = OpenAPI_pp_maximum_response_time_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,6 +71,52 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_profile_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_profile_data_t *pp_profile_data)
+{
+    if (pp_profile_data == NULL) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [PpProfileData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [PpProfileData]");
+        return false;
+    }
+    if (pp_profile_data->allowed_mtc_providers) {
+    if (OpenAPI_json_write_object_start(writer, "allowedMtcProviders") == false) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [allowed_mtc_providers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_mtc_providers_node;
+    if (pp_profile_data->allowed_mtc_providers) {
+        OpenAPI_list_for_each(pp_profile_data->allowed_mtc_providers, allowed_mtc_providers_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)allowed_mtc_providers_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [allowed_mtc_providers]");
+        goto end;
+    }
+    }
+
+    if (pp_profile_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", pp_profile_data->supported_features) == false) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_profile_data_writeJSON() failed [PpProfileData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_profile_data_t *OpenAPI_pp_profile_data_parseFromJSON(cJSON *pp_profile_dataJSON)
 {
     OpenAPI_pp_profile_data_t *pp_profile_data_local_var = NULL;
@@ -113,7 +159,6 @@ end:
 OpenAPI_pp_profile_data_t *OpenAPI_pp_profile_data_copy(OpenAPI_pp_profile_data_t *dst, OpenAPI_pp_profile_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_profile_data_convertToJSON(src);
@@ -122,21 +167,6 @@ OpenAPI_pp_profile_data_t *OpenAPI_pp_profile_data_copy(OpenAPI_pp_profile_data_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_profile_data_free(dst);
     dst = OpenAPI_pp_profile_data_parseFromJSON(item);
     cJSON_Delete(item);
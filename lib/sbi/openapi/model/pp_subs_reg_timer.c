@@ -79,6 +79,57 @@ end:
     return item;
 }
 
+bool OpenAPI_pp_subs_reg_timer_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pp_subs_reg_timer_t *pp_subs_reg_timer)
+{
+    if (pp_subs_reg_timer == NULL) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [PpSubsRegTimer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [PpSubsRegTimer]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "subsRegTimer", pp_subs_reg_timer->subs_reg_timer) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [subs_reg_timer]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "afInstanceId", pp_subs_reg_timer->af_instance_id) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [af_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "referenceId", pp_subs_reg_timer->reference_id) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [reference_id]");
+        goto end;
+    }
+
+    if (pp_subs_reg_timer->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", pp_subs_reg_timer->validity_time) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (pp_subs_reg_timer->mtc_provider_information) {
+    if (OpenAPI_json_write_string(writer, "mtcProviderInformation", pp_subs_reg_timer->mtc_provider_information) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [mtc_provider_information]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pp_subs_reg_timer_writeJSON() failed [PpSubsRegTimer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pp_subs_reg_timer_t *OpenAPI_pp_subs_reg_timer_parseFromJSON(cJSON *pp_subs_reg_timerJSON)
 {
     OpenAPI_pp_subs_reg_timer_t *pp_subs_reg_timer_local_var = NULL;
@@ -151,7 +202,6 @@ end:
 OpenAPI_pp_subs_reg_timer_t *OpenAPI_pp_subs_reg_timer_copy(OpenAPI_pp_subs_reg_timer_t *dst, OpenAPI_pp_subs_reg_timer_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pp_subs_reg_timer_convertToJSON(src);
@@ -160,21 +210,6 @@ OpenAPI_pp_subs_reg_timer_t *OpenAPI_pp_subs_reg_timer_copy(OpenAPI_pp_subs_reg_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pp_subs_reg_timer_free(dst);
     dst = OpenAPI_pp_subs_reg_timer_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "null_value.h"
 #include "preemption_capability.h"
 
@@ -28,6 +29,7 @@ OpenAPI_preemption_capability_rm_t *OpenAPI_preemption_capability_rm_create(
 void OpenAPI_preemption_capability_rm_free(OpenAPI_preemption_capability_rm_t *preemption_capability_rm);
 OpenAPI_preemption_capability_rm_t *OpenAPI_preemption_capability_rm_parseFromJSON(cJSON *preemption_capability_rmJSON);
 cJSON *OpenAPI_preemption_capability_rm_convertToJSON(OpenAPI_preemption_capability_rm_t *preemption_capability_rm);
+bool OpenAPI_preemption_capability_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_preemption_capability_rm_t *preemption_capability_rm);
 OpenAPI_preemption_capability_rm_t *OpenAPI_preemption_capability_rm_copy(OpenAPI_preemption_capability_rm_t *dst, OpenAPI_preemption_capability_rm_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "null_value.h"
 #include "preemption_control_information.h"
 
@@ -28,6 +29,7 @@ OpenAPI_preemption_control_information_rm_t *OpenAPI_preemption_control_informat
 void OpenAPI_preemption_control_information_rm_free(OpenAPI_preemption_control_information_rm_t *preemption_control_information_rm);
 OpenAPI_preemption_control_information_rm_t *OpenAPI_preemption_control_information_rm_parseFromJSON(cJSON *preemption_control_information_rmJSON);
 cJSON *OpenAPI_preemption_control_information_rm_convertToJSON(OpenAPI_preemption_control_information_rm_t *preemption_control_information_rm);
+bool OpenAPI_preemption_control_information_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_preemption_control_information_rm_t *preemption_control_information_rm);
 OpenAPI_preemption_control_information_rm_t *OpenAPI_preemption_control_information_rm_copy(OpenAPI_preemption_control_information_rm_t *dst, OpenAPI_preemption_control_information_rm_t *src);
 
 #ifdef __cplusplus
@@ -103,6 +103,70 @@ end:
     return item;
 }
 
+bool OpenAPI_preferred_search_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_preferred_search_t *preferred_search)
+{
+    if (preferred_search == NULL) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [PreferredSearch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [PreferredSearch]");
+        return false;
+    }
+    if (preferred_search->is_preferred_tai_match_ind) {
+    if (OpenAPI_json_write_bool(writer, "preferredTaiMatchInd", preferred_search->preferred_tai_match_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [preferred_tai_match_ind]");
+        goto end;
+    }
+    }
+
+    if (preferred_search->is_preferred_full_plmn_match_ind) {
+    if (OpenAPI_json_write_bool(writer, "preferredFullPlmnMatchInd", preferred_search->preferred_full_plmn_match_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [preferred_full_plmn_match_ind]");
+        goto end;
+    }
+    }
+
+    if (preferred_search->is_preferred_api_versions_match_ind) {
+    if (OpenAPI_json_write_bool(writer, "preferredApiVersionsMatchInd", preferred_search->preferred_api_versions_match_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [preferred_api_versions_match_ind]");
+        goto end;
+    }
+    }
+
+    if (preferred_search->is_other_api_versions_ind) {
+    if (OpenAPI_json_write_bool(writer, "otherApiVersionsInd", preferred_search->other_api_versions_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [other_api_versions_ind]");
+        goto end;
+    }
+    }
+
+    if (preferred_search->is_preferred_locality_match_ind) {
+    if (OpenAPI_json_write_bool(writer, "preferredLocalityMatchInd", preferred_search->preferred_locality_match_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [preferred_locality_match_ind]");
+        goto end;
+    }
+    }
+
+    if (preferred_search->is_other_locality_ind) {
+    if (OpenAPI_json_write_bool(writer, "otherLocalityInd", preferred_search->other_locality_ind) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [other_locality_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_preferred_search_writeJSON() failed [PreferredSearch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_preferred_search_t *OpenAPI_preferred_search_parseFromJSON(cJSON *preferred_searchJSON)
 {
     OpenAPI_preferred_search_t *preferred_search_local_var = NULL;
@@ -183,7 +247,6 @@ end:
 OpenAPI_preferred_search_t *OpenAPI_preferred_search_copy(OpenAPI_preferred_search_t *dst, OpenAPI_preferred_search_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_preferred_search_convertToJSON(src);
@@ -192,21 +255,6 @@ OpenAPI_preferred_search_t *OpenAPI_preferred_search_copy(OpenAPI_preferred_sear
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_preferred_search_free(dst);
     dst = OpenAPI_preferred_search_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,7 @@ OpenAPI_preferred_search_t *OpenAPI_preferred_search_create(
 void OpenAPI_preferred_search_free(OpenAPI_preferred_search_t *preferred_search);
 OpenAPI_preferred_search_t *OpenAPI_preferred_search_parseFromJSON(cJSON *preferred_searchJSON);
 cJSON *OpenAPI_preferred_search_convertToJSON(OpenAPI_preferred_search_t *preferred_search);
+bool OpenAPI_preferred_search_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_preferred_search_t *preferred_search);
 OpenAPI_preferred_search_t *OpenAPI_preferred_search_copy(OpenAPI_preferred_search_t *dst, OpenAPI_preferred_search_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi.h"
 #include "global_ran_node_id.h"
 #include "ncgi.h"
@@ -47,6 +48,7 @@ OpenAPI_presence_info_t *OpenAPI_presence_info_create(
 void OpenAPI_presence_info_free(OpenAPI_presence_info_t *presence_info);
 OpenAPI_presence_info_t *OpenAPI_presence_info_parseFromJSON(cJSON *presence_infoJSON);
 cJSON *OpenAPI_presence_info_convertToJSON(OpenAPI_presence_info_t *presence_info);
+bool OpenAPI_presence_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_presence_info_t *presence_info);
 OpenAPI_presence_info_t *OpenAPI_presence_info_copy(OpenAPI_presence_info_t *dst, OpenAPI_presence_info_t *src);
 
 #ifdef __cplusplus
@@ -196,6 +196,154 @@ end:
     return item;
 }
 
+bool OpenAPI_presence_info_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_presence_info_rm_t *presence_info_rm)
+{
+    if (presence_info_rm == NULL) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [PresenceInfoRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [PresenceInfoRm]");
+        return false;
+    }
+    if (presence_info_rm->pra_id) {
+    if (OpenAPI_json_write_string(writer, "praId", presence_info_rm->pra_id) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [pra_id]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->additional_pra_id) {
+    if (OpenAPI_json_write_string(writer, "additionalPraId", presence_info_rm->additional_pra_id) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [additional_pra_id]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->presence_state) {
+    if (OpenAPI_json_write_string(writer, "presenceState", OpenAPI_presence_state_ToString(presence_info_rm->presence_state)) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [presence_state]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->tracking_area_list) {
+    if (OpenAPI_json_write_array_start(writer, "trackingAreaList") == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [tracking_area_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tracking_area_list_node;
+    if (presence_info_rm->tracking_area_list) {
+        OpenAPI_list_for_each(presence_info_rm->tracking_area_list, tracking_area_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tracking_area_list_node->data) == false) {
+                ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [tracking_area_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [tracking_area_list]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->ecgi_list) {
+    if (OpenAPI_json_write_array_start(writer, "ecgiList") == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ecgi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ecgi_list_node;
+    if (presence_info_rm->ecgi_list) {
+        OpenAPI_list_for_each(presence_info_rm->ecgi_list, ecgi_list_node) {
+            if (OpenAPI_ecgi_writeJSON(writer, NULL, ecgi_list_node->data) == false) {
+                ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ecgi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ecgi_list]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->ncgi_list) {
+    if (OpenAPI_json_write_array_start(writer, "ncgiList") == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ncgi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ncgi_list_node;
+    if (presence_info_rm->ncgi_list) {
+        OpenAPI_list_for_each(presence_info_rm->ncgi_list, ncgi_list_node) {
+            if (OpenAPI_ncgi_writeJSON(writer, NULL, ncgi_list_node->data) == false) {
+                ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ncgi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [ncgi_list]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->global_ran_node_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "globalRanNodeIdList") == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [global_ran_node_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *global_ran_node_id_list_node;
+    if (presence_info_rm->global_ran_node_id_list) {
+        OpenAPI_list_for_each(presence_info_rm->global_ran_node_id_list, global_ran_node_id_list_node) {
+            if (OpenAPI_global_ran_node_id_writeJSON(writer, NULL, global_ran_node_id_list_node->data) == false) {
+                ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [global_ran_node_id_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [global_ran_node_id_list]");
+        goto end;
+    }
+    }
+
+    if (presence_info_rm->globale_nb_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "globaleNbIdList") == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [globale_nb_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *globale_nb_id_list_node;
+    if (presence_info_rm->globale_nb_id_list) {
+        OpenAPI_list_for_each(presence_info_rm->globale_nb_id_list, globale_nb_id_list_node) {
+            if (OpenAPI_global_ran_node_id_writeJSON(writer, NULL, globale_nb_id_list_node->data) == false) {
+                ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [globale_nb_id_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [globale_nb_id_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_presence_info_rm_writeJSON() failed [PresenceInfoRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_parseFromJSON(cJSON *presence_info_rmJSON)
 {
     OpenAPI_presence_info_rm_t *presence_info_rm_local_var = NULL;
@@ -392,7 +540,6 @@ end:
 OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_copy(OpenAPI_presence_info_rm_t *dst, OpenAPI_presence_info_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_presence_info_rm_convertToJSON(src);
@@ -401,21 +548,6 @@ OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_copy(OpenAPI_presence_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_presence_info_rm_free(dst);
     dst = OpenAPI_presence_info_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ecgi.h"
 #include "global_ran_node_id.h"
 #include "ncgi.h"
@@ -47,6 +48,7 @@ OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_create(
 void OpenAPI_presence_info_rm_free(OpenAPI_presence_info_rm_t *presence_info_rm);
 OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_parseFromJSON(cJSON *presence_info_rmJSON);
 cJSON *OpenAPI_presence_info_rm_convertToJSON(OpenAPI_presence_info_rm_t *presence_info_rm);
+bool OpenAPI_presence_info_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_presence_info_rm_t *presence_info_rm);
 OpenAPI_presence_info_rm_t *OpenAPI_presence_info_rm_copy(OpenAPI_presence_info_rm_t *dst, OpenAPI_presence_info_rm_t *src);
 
 #ifdef __cplusplus
@@ -176,6 +176,119 @@ end:
     return item;
 }
 
+bool OpenAPI_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_problem_details_t *problem_details)
+{
+    if (problem_details == NULL) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [ProblemDetails]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [ProblemDetails]");
+        return false;
+    }
+    if (problem_details->type) {
+    if (OpenAPI_json_write_string(writer, "type", problem_details->type) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [type]");
+        goto end;
+    }
+    }
+
+    if (problem_details->title) {
+    if (OpenAPI_json_write_string(writer, "title", problem_details->title) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [title]");
+        goto end;
+    }
+    }
+
+    if (problem_details->is_status) {
+    if (OpenAPI_json_write_number(writer, "status", problem_details->status) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [status]");
+        goto end;
+    }
+    }
+
+    if (problem_details->detail) {
+    if (OpenAPI_json_write_string(writer, "detail", problem_details->detail) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [detail]");
+        goto end;
+    }
+    }
+
+    if (problem_details->instance) {
+    if (OpenAPI_json_write_string(writer, "instance", problem_details->instance) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [instance]");
+        goto end;
+    }
+    }
+
+    if (problem_details->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", problem_details->cause) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (problem_details->invalid_params) {
+    if (OpenAPI_json_write_array_start(writer, "invalidParams") == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *invalid_params_node;
+    if (problem_details->invalid_params) {
+        OpenAPI_list_for_each(problem_details->invalid_params, invalid_params_node) {
+            if (OpenAPI_invalid_param_writeJSON(writer, NULL, invalid_params_node->data) == false) {
+                ogs_error("OpenAPI_problem_details_writeJSON() failed [invalid_params]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+    }
+
+    if (problem_details->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", problem_details->supported_features) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (problem_details->access_token_error) {
+    if (OpenAPI_access_token_err_writeJSON(writer, "accessTokenError", problem_details->access_token_error) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [access_token_error]");
+        goto end;
+    }
+    }
+
+    if (problem_details->access_token_request) {
+    if (OpenAPI_access_token_req_writeJSON(writer, "accessTokenRequest", problem_details->access_token_request) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [access_token_request]");
+        goto end;
+    }
+    }
+
+    if (problem_details->nrf_id) {
+    if (OpenAPI_json_write_string(writer, "nrfId", problem_details->nrf_id) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [nrf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_problem_details_writeJSON() failed [ProblemDetails]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_problem_details_t *OpenAPI_problem_details_parseFromJSON(cJSON *problem_detailsJSON)
 {
     OpenAPI_problem_details_t *problem_details_local_var = NULL;
@@ -317,7 +430,6 @@ end:
 OpenAPI_problem_details_t *OpenAPI_problem_details_copy(OpenAPI_problem_details_t *dst, OpenAPI_problem_details_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_problem_details_convertToJSON(src);
@@ -326,21 +438,6 @@ OpenAPI_problem_details_t *OpenAPI_problem_details_copy(OpenAPI_problem_details_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_problem_details_free(dst);
     dst = OpenAPI_problem_details_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_token_err.h"
 #include "access_token_req.h"
 #include "invalid_param.h"
@@ -53,6 +54,7 @@ OpenAPI_problem_details_t *OpenAPI_problem_details_create(
 void OpenAPI_problem_details_free(OpenAPI_problem_details_t *problem_details);
 OpenAPI_problem_details_t *OpenAPI_problem_details_parseFromJSON(cJSON *problem_detailsJSON);
 cJSON *OpenAPI_problem_details_convertToJSON(OpenAPI_problem_details_t *problem_details);
+bool OpenAPI_problem_details_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_problem_details_t *problem_details);
 OpenAPI_problem_details_t *OpenAPI_problem_details_copy(OpenAPI_problem_details_t *dst, OpenAPI_problem_details_t *src);
 
 #ifdef __cplusplus
@@ -124,6 +124,91 @@ end:
     return item;
 }
 
+bool OpenAPI_problem_details_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_problem_details_1_t *problem_details_1)
+{
+    if (problem_details_1 == NULL) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [ProblemDetails_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [ProblemDetails_1]");
+        return false;
+    }
+    if (problem_details_1->type) {
+    if (OpenAPI_json_write_string(writer, "type", problem_details_1->type) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [type]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->title) {
+    if (OpenAPI_json_write_string(writer, "title", problem_details_1->title) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [title]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->is_status) {
+    if (OpenAPI_json_write_number(writer, "status", problem_details_1->status) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [status]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->detail) {
+    if (OpenAPI_json_write_string(writer, "detail", problem_details_1->detail) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [detail]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->instance) {
+    if (OpenAPI_json_write_string(writer, "instance", problem_details_1->instance) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [instance]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", problem_details_1->cause) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (problem_details_1->invalid_params) {
+    if (OpenAPI_json_write_array_start(writer, "invalidParams") == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *invalid_params_node;
+    if (problem_details_1->invalid_params) {
+        OpenAPI_list_for_each(problem_details_1->invalid_params, invalid_params_node) {
+            if (OpenAPI_invalid_param_1_writeJSON(writer, NULL, invalid_params_node->data) == false) {
+                ogs_error("OpenAPI_problem_details_1_writeJSON() failed [invalid_params]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_problem_details_1_writeJSON() failed [ProblemDetails_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_parseFromJSON(cJSON *problem_details_1JSON)
 {
     OpenAPI_problem_details_1_t *problem_details_1_local_var = NULL;
@@ -229,7 +314,6 @@ end:
 OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_copy(OpenAPI_problem_details_1_t *dst, OpenAPI_problem_details_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_problem_details_1_convertToJSON(src);
@@ -238,21 +322,6 @@ OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_copy(OpenAPI_problem_deta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_problem_details_1_free(dst);
     dst = OpenAPI_problem_details_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "invalid_param_1.h"
 
 #ifdef __cplusplus
@@ -43,6 +44,7 @@ OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_create(
 void OpenAPI_problem_details_1_free(OpenAPI_problem_details_1_t *problem_details_1);
 OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_parseFromJSON(cJSON *problem_details_1JSON);
 cJSON *OpenAPI_problem_details_1_convertToJSON(OpenAPI_problem_details_1_t *problem_details_1);
+bool OpenAPI_problem_details_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_problem_details_1_t *problem_details_1);
 OpenAPI_problem_details_1_t *OpenAPI_problem_details_1_copy(OpenAPI_problem_details_1_t *dst, OpenAPI_problem_details_1_t *src);
 
 #ifdef __cplusplus
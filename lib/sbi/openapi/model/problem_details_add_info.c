@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_problem_details_add_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_problem_details_add_info_t *problem_details_add_info)
+{
+    if (problem_details_add_info == NULL) {
+        ogs_error("OpenAPI_problem_details_add_info_writeJSON() failed [ProblemDetailsAddInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_problem_details_add_info_writeJSON() failed [ProblemDetailsAddInfo]");
+        return false;
+    }
+    if (problem_details_add_info->is_remote_error) {
+    if (OpenAPI_json_write_bool(writer, "remoteError", problem_details_add_info->remote_error) == false) {
+        ogs_error("OpenAPI_problem_details_add_info_writeJSON() failed [remote_error]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_problem_details_add_info_writeJSON() failed [ProblemDetailsAddInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_problem_details_add_info_t *OpenAPI_problem_details_add_info_parseFromJSON(cJSON *problem_details_add_infoJSON)
 {
     OpenAPI_problem_details_add_info_t *problem_details_add_info_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_problem_details_add_info_t *OpenAPI_problem_details_add_info_copy(OpenAPI_problem_details_add_info_t *dst, OpenAPI_problem_details_add_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_problem_details_add_info_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_problem_details_add_info_t *OpenAPI_problem_details_add_info_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_problem_details_add_info_free(dst);
     dst = OpenAPI_problem_details_add_info_parseFromJSON(item);
     cJSON_Delete(item);
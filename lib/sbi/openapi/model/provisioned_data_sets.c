@@ -207,6 +207,112 @@ end:
     return item;
 }
 
+bool OpenAPI_provisioned_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_provisioned_data_sets_t *provisioned_data_sets)
+{
+    if (provisioned_data_sets == NULL) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [ProvisionedDataSets]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [ProvisionedDataSets]");
+        return false;
+    }
+    if (provisioned_data_sets->am_data) {
+    if (OpenAPI_access_and_mobility_subscription_data_writeJSON(writer, "amData", provisioned_data_sets->am_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [am_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->smf_sel_data) {
+    if (OpenAPI_smf_selection_subscription_data_writeJSON(writer, "smfSelData", provisioned_data_sets->smf_sel_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [smf_sel_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->sms_subs_data) {
+    if (OpenAPI_sms_subscription_data_writeJSON(writer, "smsSubsData", provisioned_data_sets->sms_subs_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [sms_subs_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->sm_data) {
+    if (OpenAPI_json_write_array_start(writer, "smData") == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [sm_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sm_data_node;
+    if (provisioned_data_sets->sm_data) {
+        OpenAPI_list_for_each(provisioned_data_sets->sm_data, sm_data_node) {
+            if (OpenAPI_session_management_subscription_data_writeJSON(writer, NULL, sm_data_node->data) == false) {
+                ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [sm_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [sm_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", provisioned_data_sets->trace_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->sms_mng_data) {
+    if (OpenAPI_sms_management_subscription_data_writeJSON(writer, "smsMngData", provisioned_data_sets->sms_mng_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [sms_mng_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->lcs_privacy_data) {
+    if (OpenAPI_lcs_privacy_data_writeJSON(writer, "lcsPrivacyData", provisioned_data_sets->lcs_privacy_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [lcs_privacy_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->lcs_mo_data) {
+    if (OpenAPI_lcs_mo_data_writeJSON(writer, "lcsMoData", provisioned_data_sets->lcs_mo_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [lcs_mo_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->lcs_bca_data) {
+    if (OpenAPI_lcs_broadcast_assistance_types_data_writeJSON(writer, "lcsBcaData", provisioned_data_sets->lcs_bca_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [lcs_bca_data]");
+        goto end;
+    }
+    }
+
+    if (provisioned_data_sets->v2x_data) {
+    if (OpenAPI_v2x_subscription_data_writeJSON(writer, "v2xData", provisioned_data_sets->v2x_data) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [v2x_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_provisioned_data_sets_writeJSON() failed [ProvisionedDataSets]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_provisioned_data_sets_t *OpenAPI_provisioned_data_sets_parseFromJSON(cJSON *provisioned_data_setsJSON)
 {
     OpenAPI_provisioned_data_sets_t *provisioned_data_sets_local_var = NULL;
@@ -323,7 +429,6 @@ end:
 OpenAPI_provisioned_data_sets_t *OpenAPI_provisioned_data_sets_copy(OpenAPI_provisioned_data_sets_t *dst, OpenAPI_provisioned_data_sets_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_provisioned_data_sets_convertToJSON(src);
@@ -332,21 +437,6 @@ OpenAPI_provisioned_data_sets_t *OpenAPI_provisioned_data_sets_copy(OpenAPI_prov
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_provisioned_data_sets_free(dst);
     dst = OpenAPI_provisioned_data_sets_parseFromJSON(item);
     cJSON_Delete(item);
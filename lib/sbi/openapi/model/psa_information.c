@@ -88,6 +88,68 @@ end:
     return item;
 }
 
+bool OpenAPI_psa_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_psa_information_t *psa_information)
+{
+    if (psa_information == NULL) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [PsaInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [PsaInformation]");
+        return false;
+    }
+    if (psa_information->psa_ind) {
+    if (OpenAPI_json_write_string(writer, "psaInd", OpenAPI_psa_indication_ToString(psa_information->psa_ind)) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [psa_ind]");
+        goto end;
+    }
+    }
+
+    if (psa_information->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(psa_information->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (psa_information->ue_ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6Prefix", psa_information->ue_ipv6_prefix) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [ue_ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (psa_information->psa_upf_id) {
+    if (OpenAPI_json_write_string(writer, "psaUpfId", psa_information->psa_upf_id) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [psa_upf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_psa_information_writeJSON() failed [PsaInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_psa_information_t *OpenAPI_psa_information_parseFromJSON(cJSON *psa_informationJSON)
 {
     OpenAPI_psa_information_t *psa_information_local_var = NULL;
@@ -155,7 +217,6 @@ end:
 OpenAPI_psa_information_t *OpenAPI_psa_information_copy(OpenAPI_psa_information_t *dst, OpenAPI_psa_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_psa_information_convertToJSON(src);
@@ -164,21 +225,6 @@ OpenAPI_psa_information_t *OpenAPI_psa_information_copy(OpenAPI_psa_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_psa_information_free(dst);
     dst = OpenAPI_psa_information_parseFromJSON(item);
     cJSON_Delete(item);
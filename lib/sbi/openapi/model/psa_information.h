@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "psa_indication.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_psa_information_t *OpenAPI_psa_information_create(
 void OpenAPI_psa_information_free(OpenAPI_psa_information_t *psa_information);
 OpenAPI_psa_information_t *OpenAPI_psa_information_parseFromJSON(cJSON *psa_informationJSON);
 cJSON *OpenAPI_psa_information_convertToJSON(OpenAPI_psa_information_t *psa_information);
+bool OpenAPI_psa_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_psa_information_t *psa_information);
 OpenAPI_psa_information_t *OpenAPI_psa_information_copy(OpenAPI_psa_information_t *dst, OpenAPI_psa_information_t *src);
 
 #ifdef __cplusplus
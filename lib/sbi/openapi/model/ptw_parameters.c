@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ptw_parameters_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ptw_parameters_t *ptw_parameters)
+{
+    if (ptw_parameters == NULL) {
+        ogs_error("OpenAPI_ptw_parameters_writeJSON() failed [PtwParameters]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ptw_parameters_writeJSON() failed [PtwParameters]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "operationMode", OpenAPI_operation_mode_ToString(ptw_parameters->operation_mode)) == false) {
+        ogs_error("OpenAPI_ptw_parameters_writeJSON() failed [operation_mode]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ptwValue", ptw_parameters->ptw_value) == false) {
+        ogs_error("OpenAPI_ptw_parameters_writeJSON() failed [ptw_value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ptw_parameters_writeJSON() failed [PtwParameters]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_parseFromJSON(cJSON *ptw_parametersJSON)
 {
     OpenAPI_ptw_parameters_t *ptw_parameters_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_copy(OpenAPI_ptw_parameters_t *dst, OpenAPI_ptw_parameters_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ptw_parameters_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_copy(OpenAPI_ptw_parameters_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ptw_parameters_free(dst);
     dst = OpenAPI_ptw_parameters_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "operation_mode.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_create(
 void OpenAPI_ptw_parameters_free(OpenAPI_ptw_parameters_t *ptw_parameters);
 OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_parseFromJSON(cJSON *ptw_parametersJSON);
 cJSON *OpenAPI_ptw_parameters_convertToJSON(OpenAPI_ptw_parameters_t *ptw_parameters);
+bool OpenAPI_ptw_parameters_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ptw_parameters_t *ptw_parameters);
 OpenAPI_ptw_parameters_t *OpenAPI_ptw_parameters_copy(OpenAPI_ptw_parameters_t *dst, OpenAPI_ptw_parameters_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "operation_mode.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ptw_parameters_1_t *OpenAPI_ptw_parameters_1_create(
 void OpenAPI_ptw_parameters_1_free(OpenAPI_ptw_parameters_1_t *ptw_parameters_1);
 OpenAPI_ptw_parameters_1_t *OpenAPI_ptw_parameters_1_parseFromJSON(cJSON *ptw_parameters_1JSON);
 cJSON *OpenAPI_ptw_parameters_1_convertToJSON(OpenAPI_ptw_parameters_1_t *ptw_parameters_1);
+bool OpenAPI_ptw_parameters_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ptw_parameters_1_t *ptw_parameters_1);
 OpenAPI_ptw_parameters_1_t *OpenAPI_ptw_parameters_1_copy(OpenAPI_ptw_parameters_1_t *dst, OpenAPI_ptw_parameters_1_t *src);
 
 #ifdef __cplusplus
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_pws_error_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pws_error_data_t *pws_error_data)
+{
+    if (pws_error_data == NULL) {
+        ogs_error("OpenAPI_pws_error_data_writeJSON() failed [PWSErrorData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pws_error_data_writeJSON() failed [PWSErrorData]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "namfCause", pws_error_data->namf_cause) == false) {
+        ogs_error("OpenAPI_pws_error_data_writeJSON() failed [namf_cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pws_error_data_writeJSON() failed [PWSErrorData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_parseFromJSON(cJSON *pws_error_dataJSON)
 {
     OpenAPI_pws_error_data_t *pws_error_data_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_copy(OpenAPI_pws_error_data_t *dst, OpenAPI_pws_error_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pws_error_data_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_copy(OpenAPI_pws_error_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pws_error_data_free(dst);
     dst = OpenAPI_pws_error_data_parseFromJSON(item);
     cJSON_Delete(item);
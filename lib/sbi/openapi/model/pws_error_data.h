@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_create(
 void OpenAPI_pws_error_data_free(OpenAPI_pws_error_data_t *pws_error_data);
 OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_parseFromJSON(cJSON *pws_error_dataJSON);
 cJSON *OpenAPI_pws_error_data_convertToJSON(OpenAPI_pws_error_data_t *pws_error_data);
+bool OpenAPI_pws_error_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pws_error_data_t *pws_error_data);
 OpenAPI_pws_error_data_t *OpenAPI_pws_error_data_copy(OpenAPI_pws_error_data_t *dst, OpenAPI_pws_error_data_t *src);
 
 #ifdef __cplusplus
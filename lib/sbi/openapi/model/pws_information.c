@@ -112,6 +112,78 @@ end:
     return item;
 }
 
+bool OpenAPI_pws_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pws_information_t *pws_information)
+{
+    if (pws_information == NULL) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [PwsInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [PwsInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "messageIdentifier", pws_information->message_identifier) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [message_identifier]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "serialNumber", pws_information->serial_number) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [serial_number]");
+        goto end;
+    }
+
+    if (OpenAPI_n2_info_content_writeJSON(writer, "pwsContainer", pws_information->pws_container) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [pws_container]");
+        goto end;
+    }
+
+    if (pws_information->bc_empty_area_list) {
+    if (OpenAPI_json_write_array_start(writer, "bcEmptyAreaList") == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [bc_empty_area_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *bc_empty_area_list_node;
+    if (pws_information->bc_empty_area_list) {
+        OpenAPI_list_for_each(pws_information->bc_empty_area_list, bc_empty_area_list_node) {
+            if (OpenAPI_global_ran_node_id_writeJSON(writer, NULL, bc_empty_area_list_node->data) == false) {
+                ogs_error("OpenAPI_pws_information_writeJSON() failed [bc_empty_area_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [bc_empty_area_list]");
+        goto end;
+    }
+    }
+
+    if (pws_information->is_send_ran_response) {
+    if (OpenAPI_json_write_bool(writer, "sendRanResponse", pws_information->send_ran_response) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [send_ran_response]");
+        goto end;
+    }
+    }
+
+    if (pws_information->omc_id) {
+    if (OpenAPI_json_write_string(writer, "omcId", pws_information->omc_id) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [omc_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pws_information_writeJSON() failed [PwsInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pws_information_t *OpenAPI_pws_information_parseFromJSON(cJSON *pws_informationJSON)
 {
     OpenAPI_pws_information_t *pws_information_local_var = NULL;
@@ -213,7 +285,6 @@ end:
 OpenAPI_pws_information_t *OpenAPI_pws_information_copy(OpenAPI_pws_information_t *dst, OpenAPI_pws_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pws_information_convertToJSON(src);
@@ -222,21 +293,6 @@ OpenAPI_pws_information_t *OpenAPI_pws_information_copy(OpenAPI_pws_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pws_information_free(dst);
     dst = OpenAPI_pws_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "global_ran_node_id.h"
 #include "n2_info_content.h"
 
@@ -42,6 +43,7 @@ OpenAPI_pws_information_t *OpenAPI_pws_information_create(
 void OpenAPI_pws_information_free(OpenAPI_pws_information_t *pws_information);
 OpenAPI_pws_information_t *OpenAPI_pws_information_parseFromJSON(cJSON *pws_informationJSON);
 cJSON *OpenAPI_pws_information_convertToJSON(OpenAPI_pws_information_t *pws_information);
+bool OpenAPI_pws_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pws_information_t *pws_information);
 OpenAPI_pws_information_t *OpenAPI_pws_information_copy(OpenAPI_pws_information_t *dst, OpenAPI_pws_information_t *src);
 
 #ifdef __cplusplus
@@ -84,6 +84,64 @@ end:
     return item;
 }
 
+bool OpenAPI_pws_response_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_pws_response_data_t *pws_response_data)
+{
+    if (pws_response_data == NULL) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [PWSResponseData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [PWSResponseData]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "ngapMessageType", pws_response_data->ngap_message_type) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [ngap_message_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "serialNumber", pws_response_data->serial_number) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [serial_number]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "messageIdentifier", pws_response_data->message_identifier) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [message_identifier]");
+        goto end;
+    }
+
+    if (pws_response_data->unknown_tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "unknownTaiList") == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [unknown_tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *unknown_tai_list_node;
+    if (pws_response_data->unknown_tai_list) {
+        OpenAPI_list_for_each(pws_response_data->unknown_tai_list, unknown_tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, unknown_tai_list_node->data) == false) {
+                ogs_error("OpenAPI_pws_response_data_writeJSON() failed [unknown_tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [unknown_tai_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_pws_response_data_writeJSON() failed [PWSResponseData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_pws_response_data_t *OpenAPI_pws_response_data_parseFromJSON(cJSON *pws_response_dataJSON)
 {
     OpenAPI_pws_response_data_t *pws_response_data_local_var = NULL;
@@ -167,7 +225,6 @@ end:
 OpenAPI_pws_response_data_t *OpenAPI_pws_response_data_copy(OpenAPI_pws_response_data_t *dst, OpenAPI_pws_response_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_pws_response_data_convertToJSON(src);
@@ -176,21 +233,6 @@ OpenAPI_pws_response_data_t *OpenAPI_pws_response_data_copy(OpenAPI_pws_response
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_pws_response_data_free(dst);
     dst = OpenAPI_pws_response_data_parseFromJSON(item);
     cJSON_Delete(item);
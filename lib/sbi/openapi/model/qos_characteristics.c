@@ -106,6 +106,74 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_characteristics_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_characteristics_t *qos_characteristics)
+{
+    if (qos_characteristics == NULL) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [QosCharacteristics]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [QosCharacteristics]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "5qi", qos_characteristics->_5qi) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [_5qi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "resourceType", OpenAPI_qos_resource_type_ToString(qos_characteristics->resource_type)) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [resource_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "priorityLevel", qos_characteristics->priority_level) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [priority_level]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "packetDelayBudget", qos_characteristics->packet_delay_budget) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [packet_delay_budget]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "packetErrorRate", qos_characteristics->packet_error_rate) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [packet_error_rate]");
+        goto end;
+    }
+
+    if (qos_characteristics->is_averaging_window) {
+    if (OpenAPI_json_write_number(writer, "averagingWindow", qos_characteristics->averaging_window) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [averaging_window]");
+        goto end;
+    }
+    }
+
+    if (qos_characteristics->is_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "maxDataBurstVol", qos_characteristics->max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (qos_characteristics->is_ext_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "extMaxDataBurstVol", qos_characteristics->ext_max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [ext_max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_characteristics_writeJSON() failed [QosCharacteristics]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_parseFromJSON(cJSON *qos_characteristicsJSON)
 {
     OpenAPI_qos_characteristics_t *qos_characteristics_local_var = NULL;
@@ -218,7 +286,6 @@ end:
 OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_copy(OpenAPI_qos_characteristics_t *dst, OpenAPI_qos_characteristics_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_characteristics_convertToJSON(src);
@@ -227,21 +294,6 @@ OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_copy(OpenAPI_qos_char
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_characteristics_free(dst);
     dst = OpenAPI_qos_characteristics_parseFromJSON(item);
     cJSON_Delete(item);
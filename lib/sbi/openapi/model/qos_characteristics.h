@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "qos_resource_type.h"
 
 #ifdef __cplusplus
@@ -49,6 +50,7 @@ OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_create(
 void OpenAPI_qos_characteristics_free(OpenAPI_qos_characteristics_t *qos_characteristics);
 OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_parseFromJSON(cJSON *qos_characteristicsJSON);
 cJSON *OpenAPI_qos_characteristics_convertToJSON(OpenAPI_qos_characteristics_t *qos_characteristics);
+bool OpenAPI_qos_characteristics_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_characteristics_t *qos_characteristics);
 OpenAPI_qos_characteristics_t *OpenAPI_qos_characteristics_copy(OpenAPI_qos_characteristics_t *dst, OpenAPI_qos_characteristics_t *src);
 
 #ifdef __cplusplus
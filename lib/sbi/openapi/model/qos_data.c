@@ -252,6 +252,166 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_data_t *qos_data)
+{
+    if (qos_data == NULL) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [QosData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [QosData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "qosId", qos_data->qos_id) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [qos_id]");
+        goto end;
+    }
+
+    if (qos_data->is__5qi) {
+    if (OpenAPI_json_write_number(writer, "5qi", qos_data->_5qi) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [_5qi]");
+        goto end;
+    }
+    }
+
+    if (qos_data->maxbr_ul) {
+    if (OpenAPI_json_write_string(writer, "maxbrUl", qos_data->maxbr_ul) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [maxbr_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_data->maxbr_dl) {
+    if (OpenAPI_json_write_string(writer, "maxbrDl", qos_data->maxbr_dl) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [maxbr_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_data->gbr_ul) {
+    if (OpenAPI_json_write_string(writer, "gbrUl", qos_data->gbr_ul) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [gbr_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_data->gbr_dl) {
+    if (OpenAPI_json_write_string(writer, "gbrDl", qos_data->gbr_dl) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [gbr_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_data->arp) {
+    if (OpenAPI_arp_writeJSON(writer, "arp", qos_data->arp) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [arp]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_qnc) {
+    if (OpenAPI_json_write_bool(writer, "qnc", qos_data->qnc) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [qnc]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_priority_level) {
+    if (OpenAPI_json_write_number(writer, "priorityLevel", qos_data->priority_level) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [priority_level]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_aver_window) {
+    if (OpenAPI_json_write_number(writer, "averWindow", qos_data->aver_window) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [aver_window]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "maxDataBurstVol", qos_data->max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_reflective_qos) {
+    if (OpenAPI_json_write_bool(writer, "reflectiveQos", qos_data->reflective_qos) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [reflective_qos]");
+        goto end;
+    }
+    }
+
+    if (qos_data->sharing_key_dl) {
+    if (OpenAPI_json_write_string(writer, "sharingKeyDl", qos_data->sharing_key_dl) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [sharing_key_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_data->sharing_key_ul) {
+    if (OpenAPI_json_write_string(writer, "sharingKeyUl", qos_data->sharing_key_ul) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [sharing_key_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_max_packet_loss_rate_dl) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateDl", qos_data->max_packet_loss_rate_dl) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [max_packet_loss_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_max_packet_loss_rate_ul) {
+    if (OpenAPI_json_write_number(writer, "maxPacketLossRateUl", qos_data->max_packet_loss_rate_ul) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [max_packet_loss_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_def_qos_flow_indication) {
+    if (OpenAPI_json_write_bool(writer, "defQosFlowIndication", qos_data->def_qos_flow_indication) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [def_qos_flow_indication]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_ext_max_data_burst_vol) {
+    if (OpenAPI_json_write_number(writer, "extMaxDataBurstVol", qos_data->ext_max_data_burst_vol) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [ext_max_data_burst_vol]");
+        goto end;
+    }
+    }
+
+    if (qos_data->is_packet_delay_budget) {
+    if (OpenAPI_json_write_number(writer, "packetDelayBudget", qos_data->packet_delay_budget) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [packet_delay_budget]");
+        goto end;
+    }
+    }
+
+    if (qos_data->packet_error_rate) {
+    if (OpenAPI_json_write_string(writer, "packetErrorRate", qos_data->packet_error_rate) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [packet_error_rate]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_data_writeJSON() failed [QosData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_data_t *OpenAPI_qos_data_parseFromJSON(cJSON *qos_dataJSON)
 {
     OpenAPI_qos_data_t *qos_data_local_var = NULL;
@@ -477,7 +637,6 @@ end:
 OpenAPI_qos_data_t *OpenAPI_qos_data_copy(OpenAPI_qos_data_t *dst, OpenAPI_qos_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_data_convertToJSON(src);
@@ -486,21 +645,6 @@ OpenAPI_qos_data_t *OpenAPI_qos_data_copy(OpenAPI_qos_data_t *dst, OpenAPI_qos_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_data_free(dst);
     dst = OpenAPI_qos_data_parseFromJSON(item);
     cJSON_Delete(item);
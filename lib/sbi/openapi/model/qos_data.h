@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 
 #ifdef __cplusplus
@@ -89,6 +90,7 @@ OpenAPI_qos_data_t *OpenAPI_qos_data_create(
 void OpenAPI_qos_data_free(OpenAPI_qos_data_t *qos_data);
 OpenAPI_qos_data_t *OpenAPI_qos_data_parseFromJSON(cJSON *qos_dataJSON);
 cJSON *OpenAPI_qos_data_convertToJSON(OpenAPI_qos_data_t *qos_data);
+bool OpenAPI_qos_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_data_t *qos_data);
 OpenAPI_qos_data_t *OpenAPI_qos_data_copy(OpenAPI_qos_data_t *dst, OpenAPI_qos_data_t *src);
 
 #ifdef __cplusplus
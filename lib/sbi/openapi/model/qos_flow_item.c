@@ -75,6 +75,54 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_item_t *qos_flow_item)
+{
+    if (qos_flow_item == NULL) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [QosFlowItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [QosFlowItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "qfi", qos_flow_item->qfi) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [qfi]");
+        goto end;
+    }
+
+    if (qos_flow_item->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(qos_flow_item->cause)) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_item->is_current_qos_profile_index) {
+    if (OpenAPI_json_write_number(writer, "currentQosProfileIndex", qos_flow_item->current_qos_profile_index) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [current_qos_profile_index]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_item->is_null_qo_s_profile_index) {
+    if (OpenAPI_json_write_bool(writer, "nullQoSProfileIndex", qos_flow_item->null_qo_s_profile_index) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [null_qo_s_profile_index]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_item_writeJSON() failed [QosFlowItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_parseFromJSON(cJSON *qos_flow_itemJSON)
 {
     OpenAPI_qos_flow_item_t *qos_flow_item_local_var = NULL;
@@ -136,7 +184,6 @@ end:
 OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_copy(OpenAPI_qos_flow_item_t *dst, OpenAPI_qos_flow_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_item_convertToJSON(src);
@@ -145,21 +192,6 @@ OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_copy(OpenAPI_qos_flow_item_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_item_free(dst);
     dst = OpenAPI_qos_flow_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cause.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_create(
 void OpenAPI_qos_flow_item_free(OpenAPI_qos_flow_item_t *qos_flow_item);
 OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_parseFromJSON(cJSON *qos_flow_itemJSON);
 cJSON *OpenAPI_qos_flow_item_convertToJSON(OpenAPI_qos_flow_item_t *qos_flow_item);
+bool OpenAPI_qos_flow_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_item_t *qos_flow_item);
 OpenAPI_qos_flow_item_t *OpenAPI_qos_flow_item_copy(OpenAPI_qos_flow_item_t *dst, OpenAPI_qos_flow_item_t *src);
 
 #ifdef __cplusplus
@@ -146,6 +146,89 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_profile_t *qos_flow_profile)
+{
+    if (qos_flow_profile == NULL) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [QosFlowProfile]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [QosFlowProfile]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "5qi", qos_flow_profile->_5qi) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [_5qi]");
+        goto end;
+    }
+
+    if (qos_flow_profile->non_dynamic5_qi) {
+    if (OpenAPI_non_dynamic5_qi_writeJSON(writer, "nonDynamic5Qi", qos_flow_profile->non_dynamic5_qi) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [non_dynamic5_qi]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->dynamic5_qi) {
+    if (OpenAPI_dynamic5_qi_writeJSON(writer, "dynamic5Qi", qos_flow_profile->dynamic5_qi) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [dynamic5_qi]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->arp) {
+    if (OpenAPI_arp_writeJSON(writer, "arp", qos_flow_profile->arp) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [arp]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->gbr_qos_flow_info) {
+    if (OpenAPI_gbr_qos_flow_information_writeJSON(writer, "gbrQosFlowInfo", qos_flow_profile->gbr_qos_flow_info) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [gbr_qos_flow_info]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->rqa) {
+    if (OpenAPI_json_write_string(writer, "rqa", OpenAPI_reflective_qo_s_attribute_ToString(qos_flow_profile->rqa)) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [rqa]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->additional_qos_flow_info) {
+    if (OpenAPI_json_write_string(writer, "additionalQosFlowInfo", OpenAPI_additional_qos_flow_info_ToString(qos_flow_profile->additional_qos_flow_info)) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [additional_qos_flow_info]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->qos_monitoring_req) {
+    if (OpenAPI_json_write_string(writer, "qosMonitoringReq", OpenAPI_qos_monitoring_req_ToString(qos_flow_profile->qos_monitoring_req)) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [qos_monitoring_req]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_profile->is_qos_rep_period) {
+    if (OpenAPI_json_write_number(writer, "qosRepPeriod", qos_flow_profile->qos_rep_period) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [qos_rep_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_profile_writeJSON() failed [QosFlowProfile]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_parseFromJSON(cJSON *qos_flow_profileJSON)
 {
     OpenAPI_qos_flow_profile_t *qos_flow_profile_local_var = NULL;
@@ -252,7 +335,6 @@ end:
 OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_copy(OpenAPI_qos_flow_profile_t *dst, OpenAPI_qos_flow_profile_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_profile_convertToJSON(src);
@@ -261,21 +343,6 @@ OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_copy(OpenAPI_qos_flow_profi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_profile_free(dst);
     dst = OpenAPI_qos_flow_profile_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "additional_qos_flow_info.h"
 #include "arp.h"
 #include "dynamic5_qi.h"
@@ -53,6 +54,7 @@ OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_create(
 void OpenAPI_qos_flow_profile_free(OpenAPI_qos_flow_profile_t *qos_flow_profile);
 OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_parseFromJSON(cJSON *qos_flow_profileJSON);
 cJSON *OpenAPI_qos_flow_profile_convertToJSON(OpenAPI_qos_flow_profile_t *qos_flow_profile);
+bool OpenAPI_qos_flow_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_profile_t *qos_flow_profile);
 OpenAPI_qos_flow_profile_t *OpenAPI_qos_flow_profile_copy(OpenAPI_qos_flow_profile_t *dst, OpenAPI_qos_flow_profile_t *src);
 
 #ifdef __cplusplus
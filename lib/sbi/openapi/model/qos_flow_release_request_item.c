@@ -62,6 +62,47 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_release_request_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_release_request_item_t *qos_flow_release_request_item)
+{
+    if (qos_flow_release_request_item == NULL) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [QosFlowReleaseRequestItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [QosFlowReleaseRequestItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "qfi", qos_flow_release_request_item->qfi) == false) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [qfi]");
+        goto end;
+    }
+
+    if (qos_flow_release_request_item->qos_rules) {
+    if (OpenAPI_json_write_number(writer, "qosRules", qos_flow_release_request_item->qos_rules) == false) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [qos_rules]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_release_request_item->qos_flow_description) {
+    if (OpenAPI_json_write_number(writer, "qosFlowDescription", qos_flow_release_request_item->qos_flow_description) == false) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [qos_flow_description]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_release_request_item_writeJSON() failed [QosFlowReleaseRequestItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_release_request_item_t *OpenAPI_qos_flow_release_request_item_parseFromJSON(cJSON *qos_flow_release_request_itemJSON)
 {
     OpenAPI_qos_flow_release_request_item_t *qos_flow_release_request_item_local_var = NULL;
@@ -109,7 +150,6 @@ end:
 OpenAPI_qos_flow_release_request_item_t *OpenAPI_qos_flow_release_request_item_copy(OpenAPI_qos_flow_release_request_item_t *dst, OpenAPI_qos_flow_release_request_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_release_request_item_convertToJSON(src);
@@ -118,21 +158,6 @@ OpenAPI_qos_flow_release_request_item_t *OpenAPI_qos_flow_release_request_item_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_release_request_item_free(dst);
     dst = OpenAPI_qos_flow_release_request_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -96,6 +96,66 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_setup_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_setup_item_t *qos_flow_setup_item)
+{
+    if (qos_flow_setup_item == NULL) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [QosFlowSetupItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [QosFlowSetupItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "qfi", qos_flow_setup_item->qfi) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [qfi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "qosRules", qos_flow_setup_item->qos_rules) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [qos_rules]");
+        goto end;
+    }
+
+    if (qos_flow_setup_item->is_ebi) {
+    if (OpenAPI_json_write_number(writer, "ebi", qos_flow_setup_item->ebi) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [ebi]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_setup_item->qos_flow_description) {
+    if (OpenAPI_json_write_number(writer, "qosFlowDescription", qos_flow_setup_item->qos_flow_description) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [qos_flow_description]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_setup_item->qos_flow_profile) {
+    if (OpenAPI_qos_flow_profile_writeJSON(writer, "qosFlowProfile", qos_flow_setup_item->qos_flow_profile) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [qos_flow_profile]");
+        goto end;
+    }
+    }
+
+    if (qos_flow_setup_item->associated_an_type) {
+    if (OpenAPI_json_write_string(writer, "associatedAnType", OpenAPI_qos_flow_access_type_ToString(qos_flow_setup_item->associated_an_type)) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [associated_an_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_setup_item_writeJSON() failed [QosFlowSetupItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_setup_item_t *OpenAPI_qos_flow_setup_item_parseFromJSON(cJSON *qos_flow_setup_itemJSON)
 {
     OpenAPI_qos_flow_setup_item_t *qos_flow_setup_item_local_var = NULL;
@@ -176,7 +236,6 @@ end:
 OpenAPI_qos_flow_setup_item_t *OpenAPI_qos_flow_setup_item_copy(OpenAPI_qos_flow_setup_item_t *dst, OpenAPI_qos_flow_setup_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_setup_item_convertToJSON(src);
@@ -185,21 +244,6 @@ OpenAPI_qos_flow_setup_item_t *OpenAPI_qos_flow_setup_item_copy(OpenAPI_qos_flow
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_setup_item_free(dst);
     dst = OpenAPI_qos_flow_setup_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -71,6 +71,50 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_tunnel_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_tunnel_t *qos_flow_tunnel)
+{
+    if (qos_flow_tunnel == NULL) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [QosFlowTunnel]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [QosFlowTunnel]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "qfiList") == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [qfi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qfi_list_node;
+    OpenAPI_list_for_each(qos_flow_tunnel->qfi_list, qfi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)qfi_list_node->data) == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [qfi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [qfi_list]");
+        goto end;
+    }
+
+    if (OpenAPI_tunnel_info_writeJSON(writer, "tunnelInfo", qos_flow_tunnel->tunnel_info) == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [tunnel_info]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_tunnel_writeJSON() failed [QosFlowTunnel]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_parseFromJSON(cJSON *qos_flow_tunnelJSON)
 {
     OpenAPI_qos_flow_tunnel_t *qos_flow_tunnel_local_var = NULL;
@@ -118,7 +162,6 @@ end:
 OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_copy(OpenAPI_qos_flow_tunnel_t *dst, OpenAPI_qos_flow_tunnel_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_tunnel_convertToJSON(src);
@@ -127,21 +170,6 @@ OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_copy(OpenAPI_qos_flow_tunnel_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_tunnel_free(dst);
     dst = OpenAPI_qos_flow_tunnel_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "tunnel_info.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_create(
 void OpenAPI_qos_flow_tunnel_free(OpenAPI_qos_flow_tunnel_t *qos_flow_tunnel);
 OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_parseFromJSON(cJSON *qos_flow_tunnelJSON);
 cJSON *OpenAPI_qos_flow_tunnel_convertToJSON(OpenAPI_qos_flow_tunnel_t *qos_flow_tunnel);
+bool OpenAPI_qos_flow_tunnel_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_tunnel_t *qos_flow_tunnel);
 OpenAPI_qos_flow_tunnel_t *OpenAPI_qos_flow_tunnel_copy(OpenAPI_qos_flow_tunnel_t *dst, OpenAPI_qos_flow_tunnel_t *src);
 
 #ifdef __cplusplus
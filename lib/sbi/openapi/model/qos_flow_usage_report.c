@@ -74,6 +74,53 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_flow_usage_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_flow_usage_report_t *qos_flow_usage_report)
+{
+    if (qos_flow_usage_report == NULL) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [QosFlowUsageReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [QosFlowUsageReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "qfi", qos_flow_usage_report->qfi) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [qfi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "startTimeStamp", qos_flow_usage_report->start_time_stamp) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [start_time_stamp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "endTimeStamp", qos_flow_usage_report->end_time_stamp) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [end_time_stamp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "downlinkVolume", qos_flow_usage_report->downlink_volume) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [downlink_volume]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uplinkVolume", qos_flow_usage_report->uplink_volume) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [uplink_volume]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_flow_usage_report_writeJSON() failed [QosFlowUsageReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_flow_usage_report_t *OpenAPI_qos_flow_usage_report_parseFromJSON(cJSON *qos_flow_usage_reportJSON)
 {
     OpenAPI_qos_flow_usage_report_t *qos_flow_usage_report_local_var = NULL;
@@ -151,7 +198,6 @@ end:
 OpenAPI_qos_flow_usage_report_t *OpenAPI_qos_flow_usage_report_copy(OpenAPI_qos_flow_usage_report_t *dst, OpenAPI_qos_flow_usage_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_flow_usage_report_convertToJSON(src);
@@ -160,21 +206,6 @@ OpenAPI_qos_flow_usage_report_t *OpenAPI_qos_flow_usage_report_copy(OpenAPI_qos_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_flow_usage_report_free(dst);
     dst = OpenAPI_qos_flow_usage_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -152,6 +152,114 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_monitoring_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_data_t *qos_monitoring_data)
+{
+    if (qos_monitoring_data == NULL) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [QosMonitoringData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [QosMonitoringData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "qmId", qos_monitoring_data->qm_id) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [qm_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "reqQosMonParams") == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_qos_mon_params_node;
+    OpenAPI_list_for_each(qos_monitoring_data->req_qos_mon_params, req_qos_mon_params_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_requested_qos_monitoring_parameter_ToString((intptr_t)req_qos_mon_params_node->data)) == false) {
+            ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [req_qos_mon_params]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [req_qos_mon_params]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "repFreqs") == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_freqs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rep_freqs_node;
+    OpenAPI_list_for_each(qos_monitoring_data->rep_freqs, rep_freqs_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_reporting_frequency_ToString((intptr_t)rep_freqs_node->data)) == false) {
+            ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_freqs]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_freqs]");
+        goto end;
+    }
+
+    if (qos_monitoring_data->is_rep_thresh_dl) {
+    if (OpenAPI_json_write_number(writer, "repThreshDl", qos_monitoring_data->rep_thresh_dl) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_thresh_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->is_rep_thresh_ul) {
+    if (OpenAPI_json_write_number(writer, "repThreshUl", qos_monitoring_data->rep_thresh_ul) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_thresh_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->is_rep_thresh_rp) {
+    if (OpenAPI_json_write_number(writer, "repThreshRp", qos_monitoring_data->rep_thresh_rp) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_thresh_rp]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->is_wait_time) {
+    if (OpenAPI_json_write_number(writer, "waitTime", qos_monitoring_data->wait_time) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [wait_time]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->is_rep_period) {
+    if (OpenAPI_json_write_number(writer, "repPeriod", qos_monitoring_data->rep_period) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [rep_period]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->notify_uri) {
+    if (OpenAPI_json_write_string(writer, "notifyUri", qos_monitoring_data->notify_uri) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [notify_uri]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_data->notify_corre_id) {
+    if (OpenAPI_json_write_string(writer, "notifyCorreId", qos_monitoring_data->notify_corre_id) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [notify_corre_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_data_writeJSON() failed [QosMonitoringData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_parseFromJSON(cJSON *qos_monitoring_dataJSON)
 {
     OpenAPI_qos_monitoring_data_t *qos_monitoring_data_local_var = NULL;
@@ -303,7 +411,6 @@ end:
 OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_copy(OpenAPI_qos_monitoring_data_t *dst, OpenAPI_qos_monitoring_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_monitoring_data_convertToJSON(src);
@@ -312,21 +419,6 @@ OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_copy(OpenAPI_qos_moni
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_monitoring_data_free(dst);
     dst = OpenAPI_qos_monitoring_data_parseFromJSON(item);
     cJSON_Delete(item);
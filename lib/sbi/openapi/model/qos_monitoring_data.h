@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "reporting_frequency.h"
 #include "requested_qos_monitoring_parameter.h"
 
@@ -58,6 +59,7 @@ OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_create(
 void OpenAPI_qos_monitoring_data_free(OpenAPI_qos_monitoring_data_t *qos_monitoring_data);
 OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_parseFromJSON(cJSON *qos_monitoring_dataJSON);
 cJSON *OpenAPI_qos_monitoring_data_convertToJSON(OpenAPI_qos_monitoring_data_t *qos_monitoring_data);
+bool OpenAPI_qos_monitoring_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_data_t *qos_monitoring_data);
 OpenAPI_qos_monitoring_data_t *OpenAPI_qos_monitoring_data_copy(OpenAPI_qos_monitoring_data_t *dst, OpenAPI_qos_monitoring_data_t *src);
 
 #ifdef __cplusplus
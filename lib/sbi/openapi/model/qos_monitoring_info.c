@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_monitoring_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_info_t *qos_monitoring_info)
+{
+    if (qos_monitoring_info == NULL) {
+        ogs_error("OpenAPI_qos_monitoring_info_writeJSON() failed [QosMonitoringInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_monitoring_info_writeJSON() failed [QosMonitoringInfo]");
+        return false;
+    }
+    if (qos_monitoring_info->is_qos_monitoring_ind) {
+    if (OpenAPI_json_write_bool(writer, "qosMonitoringInd", qos_monitoring_info->qos_monitoring_ind) == false) {
+        ogs_error("OpenAPI_qos_monitoring_info_writeJSON() failed [qos_monitoring_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_info_writeJSON() failed [QosMonitoringInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_monitoring_info_t *OpenAPI_qos_monitoring_info_parseFromJSON(cJSON *qos_monitoring_infoJSON)
 {
     OpenAPI_qos_monitoring_info_t *qos_monitoring_info_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_qos_monitoring_info_t *OpenAPI_qos_monitoring_info_copy(OpenAPI_qos_monitoring_info_t *dst, OpenAPI_qos_monitoring_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_monitoring_info_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_qos_monitoring_info_t *OpenAPI_qos_monitoring_info_copy(OpenAPI_qos_moni
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_monitoring_info_free(dst);
     dst = OpenAPI_qos_monitoring_info_parseFromJSON(item);
     cJSON_Delete(item);
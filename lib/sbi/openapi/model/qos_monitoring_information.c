@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_monitoring_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_information_t *qos_monitoring_information)
+{
+    if (qos_monitoring_information == NULL) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [QosMonitoringInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [QosMonitoringInformation]");
+        return false;
+    }
+    if (qos_monitoring_information->is_rep_thresh_dl) {
+    if (OpenAPI_json_write_number(writer, "repThreshDl", qos_monitoring_information->rep_thresh_dl) == false) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [rep_thresh_dl]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_information->is_rep_thresh_ul) {
+    if (OpenAPI_json_write_number(writer, "repThreshUl", qos_monitoring_information->rep_thresh_ul) == false) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [rep_thresh_ul]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_information->is_rep_thresh_rp) {
+    if (OpenAPI_json_write_number(writer, "repThreshRp", qos_monitoring_information->rep_thresh_rp) == false) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [rep_thresh_rp]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_information_writeJSON() failed [QosMonitoringInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_monitoring_information_t *OpenAPI_qos_monitoring_information_parseFromJSON(cJSON *qos_monitoring_informationJSON)
 {
     OpenAPI_qos_monitoring_information_t *qos_monitoring_information_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_qos_monitoring_information_t *OpenAPI_qos_monitoring_information_copy(OpenAPI_qos_monitoring_information_t *dst, OpenAPI_qos_monitoring_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_monitoring_information_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_qos_monitoring_information_t *OpenAPI_qos_monitoring_information_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_monitoring_information_free(dst);
     dst = OpenAPI_qos_monitoring_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -129,6 +129,106 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_monitoring_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_report_t *qos_monitoring_report)
+{
+    if (qos_monitoring_report == NULL) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [QosMonitoringReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [QosMonitoringReport]");
+        return false;
+    }
+    if (qos_monitoring_report->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (qos_monitoring_report->flows) {
+        OpenAPI_list_for_each(qos_monitoring_report->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_report->ul_delays) {
+    if (OpenAPI_json_write_array_start(writer, "ulDelays") == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [ul_delays]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ul_delays_node;
+    OpenAPI_list_for_each(qos_monitoring_report->ul_delays, ul_delays_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)ul_delays_node->data) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [ul_delays]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [ul_delays]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_report->dl_delays) {
+    if (OpenAPI_json_write_array_start(writer, "dlDelays") == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [dl_delays]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dl_delays_node;
+    OpenAPI_list_for_each(qos_monitoring_report->dl_delays, dl_delays_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)dl_delays_node->data) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [dl_delays]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [dl_delays]");
+        goto end;
+    }
+    }
+
+    if (qos_monitoring_report->rt_delays) {
+    if (OpenAPI_json_write_array_start(writer, "rtDelays") == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [rt_delays]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rt_delays_node;
+    OpenAPI_list_for_each(qos_monitoring_report->rt_delays, rt_delays_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)rt_delays_node->data) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [rt_delays]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [rt_delays]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_monitoring_report_writeJSON() failed [QosMonitoringReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_parseFromJSON(cJSON *qos_monitoring_reportJSON)
 {
     OpenAPI_qos_monitoring_report_t *qos_monitoring_report_local_var = NULL;
@@ -236,7 +336,6 @@ end:
 OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_copy(OpenAPI_qos_monitoring_report_t *dst, OpenAPI_qos_monitoring_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_monitoring_report_convertToJSON(src);
@@ -245,21 +344,6 @@ OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_copy(OpenAPI_qos_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_monitoring_report_free(dst);
     dst = OpenAPI_qos_monitoring_report_parseFromJSON(item);
     cJSON_Delete(item);
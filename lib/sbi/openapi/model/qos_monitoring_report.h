@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flows.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_create(
 void OpenAPI_qos_monitoring_report_free(OpenAPI_qos_monitoring_report_t *qos_monitoring_report);
 OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_parseFromJSON(cJSON *qos_monitoring_reportJSON);
 cJSON *OpenAPI_qos_monitoring_report_convertToJSON(OpenAPI_qos_monitoring_report_t *qos_monitoring_report);
+bool OpenAPI_qos_monitoring_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_monitoring_report_t *qos_monitoring_report);
 OpenAPI_qos_monitoring_report_t *OpenAPI_qos_monitoring_report_copy(OpenAPI_qos_monitoring_report_t *dst, OpenAPI_qos_monitoring_report_t *src);
 
 #ifdef __cplusplus
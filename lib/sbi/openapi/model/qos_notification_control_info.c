@@ -80,6 +80,61 @@ end:
     return item;
 }
 
+bool OpenAPI_qos_notification_control_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_notification_control_info_t *qos_notification_control_info)
+{
+    if (qos_notification_control_info == NULL) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [QosNotificationControlInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [QosNotificationControlInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notifType", OpenAPI_qos_notif_type_ToString(qos_notification_control_info->notif_type)) == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [notif_type]");
+        goto end;
+    }
+
+    if (qos_notification_control_info->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (qos_notification_control_info->flows) {
+        OpenAPI_list_for_each(qos_notification_control_info->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (qos_notification_control_info->alt_ser_req) {
+    if (OpenAPI_json_write_string(writer, "altSerReq", qos_notification_control_info->alt_ser_req) == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [alt_ser_req]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_qos_notification_control_info_writeJSON() failed [QosNotificationControlInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_parseFromJSON(cJSON *qos_notification_control_infoJSON)
 {
     OpenAPI_qos_notification_control_info_t *qos_notification_control_info_local_var = NULL;
@@ -148,7 +203,6 @@ end:
 OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_copy(OpenAPI_qos_notification_control_info_t *dst, OpenAPI_qos_notification_control_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_qos_notification_control_info_convertToJSON(src);
@@ -157,21 +211,6 @@ OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_qos_notification_control_info_free(dst);
     dst = OpenAPI_qos_notification_control_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flows.h"
 #include "qos_notif_type.h"
 
@@ -34,6 +35,7 @@ OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_c
 void OpenAPI_qos_notification_control_info_free(OpenAPI_qos_notification_control_info_t *qos_notification_control_info);
 OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_parseFromJSON(cJSON *qos_notification_control_infoJSON);
 cJSON *OpenAPI_qos_notification_control_info_convertToJSON(OpenAPI_qos_notification_control_info_t *qos_notification_control_info);
+bool OpenAPI_qos_notification_control_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_qos_notification_control_info_t *qos_notification_control_info);
 OpenAPI_qos_notification_control_info_t *OpenAPI_qos_notification_control_info_copy(OpenAPI_qos_notification_control_info_t *dst, OpenAPI_qos_notification_control_info_t *src);
 
 #ifdef __cplusplus
@@ -85,6 +85,56 @@ end:
     return item;
 }
 
+bool OpenAPI_ran_nas_rel_cause_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ran_nas_rel_cause_t *ran_nas_rel_cause)
+{
+    if (ran_nas_rel_cause == NULL) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [RanNasRelCause]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [RanNasRelCause]");
+        return false;
+    }
+    if (ran_nas_rel_cause->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", ran_nas_rel_cause->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (ran_nas_rel_cause->is__5g_mm_cause) {
+    if (OpenAPI_json_write_number(writer, "5gMmCause", ran_nas_rel_cause->_5g_mm_cause) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [_5g_mm_cause]");
+        goto end;
+    }
+    }
+
+    if (ran_nas_rel_cause->is__5g_sm_cause) {
+    if (OpenAPI_json_write_number(writer, "5gSmCause", ran_nas_rel_cause->_5g_sm_cause) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [_5g_sm_cause]");
+        goto end;
+    }
+    }
+
+    if (ran_nas_rel_cause->eps_cause) {
+    if (OpenAPI_json_write_string(writer, "epsCause", ran_nas_rel_cause->eps_cause) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [eps_cause]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ran_nas_rel_cause_writeJSON() failed [RanNasRelCause]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ran_nas_rel_cause_t *OpenAPI_ran_nas_rel_cause_parseFromJSON(cJSON *ran_nas_rel_causeJSON)
 {
     OpenAPI_ran_nas_rel_cause_t *ran_nas_rel_cause_local_var = NULL;
@@ -139,7 +189,6 @@ end:
 OpenAPI_ran_nas_rel_cause_t *OpenAPI_ran_nas_rel_cause_copy(OpenAPI_ran_nas_rel_cause_t *dst, OpenAPI_ran_nas_rel_cause_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ran_nas_rel_cause_convertToJSON(src);
@@ -148,21 +197,6 @@ OpenAPI_ran_nas_rel_cause_t *OpenAPI_ran_nas_rel_cause_copy(OpenAPI_ran_nas_rel_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ran_nas_rel_cause_free(dst);
     dst = OpenAPI_ran_nas_rel_cause_parseFromJSON(item);
     cJSON_Delete(item);
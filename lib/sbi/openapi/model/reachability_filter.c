@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_reachability_filter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_reachability_filter_t *reachability_filter)
+{
+    if (reachability_filter == NULL) {
+        ogs_error("OpenAPI_reachability_filter_writeJSON() failed [ReachabilityFilter]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_reachability_filter_writeJSON() failed [ReachabilityFilter]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_reachability_filter_writeJSON() failed [ReachabilityFilter]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_parseFromJSON(cJSON *reachability_filterJSON)
 {
     OpenAPI_reachability_filter_t *reachability_filter_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_copy(OpenAPI_reachability_filter_t *dst, OpenAPI_reachability_filter_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_reachability_filter_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_copy(OpenAPI_reachabi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_reachability_filter_free(dst);
     dst = OpenAPI_reachability_filter_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "reachability_filter_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_create(
 void OpenAPI_reachability_filter_free(OpenAPI_reachability_filter_t *reachability_filter);
 OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_parseFromJSON(cJSON *reachability_filterJSON);
 cJSON *OpenAPI_reachability_filter_convertToJSON(OpenAPI_reachability_filter_t *reachability_filter);
+bool OpenAPI_reachability_filter_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_reachability_filter_t *reachability_filter);
 OpenAPI_reachability_filter_t *OpenAPI_reachability_filter_copy(OpenAPI_reachability_filter_t *dst, OpenAPI_reachability_filter_t *src);
 
 #ifdef __cplusplus
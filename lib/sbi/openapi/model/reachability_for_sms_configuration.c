@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_reachability_for_sms_configuration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_reachability_for_sms_configuration_t *reachability_for_sms_configuration)
+{
+    if (reachability_for_sms_configuration == NULL) {
+        ogs_error("OpenAPI_reachability_for_sms_configuration_writeJSON() failed [ReachabilityForSmsConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_reachability_for_sms_configuration_writeJSON() failed [ReachabilityForSmsConfiguration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_reachability_for_sms_configuration_writeJSON() failed [ReachabilityForSmsConfiguration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_reachability_for_sms_configuration_t *OpenAPI_reachability_for_sms_configuration_parseFromJSON(cJSON *reachability_for_sms_configurationJSON)
 {
     OpenAPI_reachability_for_sms_configuration_t *reachability_for_sms_configuration_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_reachability_for_sms_configuration_t *OpenAPI_reachability_for_sms_configuration_copy(OpenAPI_reachability_for_sms_configuration_t *dst, OpenAPI_reachability_for_sms_configuration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_reachability_for_sms_configuration_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_reachability_for_sms_configuration_t *OpenAPI_reachability_for_sms_confi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_reachability_for_sms_configuration_free(dst);
     dst = OpenAPI_reachability_for_sms_configuration_parseFromJSON(item);
     cJSON_Delete(item);
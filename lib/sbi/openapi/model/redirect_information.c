@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_redirect_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_redirect_information_t *redirect_information)
+{
+    if (redirect_information == NULL) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [RedirectInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [RedirectInformation]");
+        return false;
+    }
+    if (redirect_information->is_redirect_enabled) {
+    if (OpenAPI_json_write_bool(writer, "redirectEnabled", redirect_information->redirect_enabled) == false) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [redirect_enabled]");
+        goto end;
+    }
+    }
+
+    if (redirect_information->redirect_address_type) {
+    if (OpenAPI_json_write_string(writer, "redirectAddressType", OpenAPI_redirect_address_type_ToString(redirect_information->redirect_address_type)) == false) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [redirect_address_type]");
+        goto end;
+    }
+    }
+
+    if (redirect_information->redirect_server_address) {
+    if (OpenAPI_json_write_string(writer, "redirectServerAddress", redirect_information->redirect_server_address) == false) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [redirect_server_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_redirect_information_writeJSON() failed [RedirectInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_redirect_information_t *OpenAPI_redirect_information_parseFromJSON(cJSON *redirect_informationJSON)
 {
     OpenAPI_redirect_information_t *redirect_information_local_var = NULL;
@@ -114,7 +157,6 @@ end:
 OpenAPI_redirect_information_t *OpenAPI_redirect_information_copy(OpenAPI_redirect_information_t *dst, OpenAPI_redirect_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_redirect_information_convertToJSON(src);
@@ -123,21 +165,6 @@ OpenAPI_redirect_information_t *OpenAPI_redirect_information_copy(OpenAPI_redire
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_redirect_information_free(dst);
     dst = OpenAPI_redirect_information_parseFromJSON(item);
     cJSON_Delete(item);
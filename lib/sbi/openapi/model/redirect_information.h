@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "redirect_address_type.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_redirect_information_t *OpenAPI_redirect_information_create(
 void OpenAPI_redirect_information_free(OpenAPI_redirect_information_t *redirect_information);
 OpenAPI_redirect_information_t *OpenAPI_redirect_information_parseFromJSON(cJSON *redirect_informationJSON);
 cJSON *OpenAPI_redirect_information_convertToJSON(OpenAPI_redirect_information_t *redirect_information);
+bool OpenAPI_redirect_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_redirect_information_t *redirect_information);
 OpenAPI_redirect_information_t *OpenAPI_redirect_information_copy(OpenAPI_redirect_information_t *dst, OpenAPI_redirect_information_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_redirect_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_redirect_response_t *redirect_response)
+{
+    if (redirect_response == NULL) {
+        ogs_error("OpenAPI_redirect_response_writeJSON() failed [RedirectResponse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_redirect_response_writeJSON() failed [RedirectResponse]");
+        return false;
+    }
+    if (redirect_response->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", redirect_response->cause) == false) {
+        ogs_error("OpenAPI_redirect_response_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (redirect_response->target_scp) {
+    if (OpenAPI_json_write_string(writer, "targetScp", redirect_response->target_scp) == false) {
+        ogs_error("OpenAPI_redirect_response_writeJSON() failed [target_scp]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_redirect_response_writeJSON() failed [RedirectResponse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_redirect_response_t *OpenAPI_redirect_response_parseFromJSON(cJSON *redirect_responseJSON)
 {
     OpenAPI_redirect_response_t *redirect_response_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_redirect_response_t *OpenAPI_redirect_response_copy(OpenAPI_redirect_response_t *dst, OpenAPI_redirect_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_redirect_response_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_redirect_response_t *OpenAPI_redirect_response_copy(OpenAPI_redirect_res
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_redirect_response_free(dst);
     dst = OpenAPI_redirect_response_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_redirect_response_t *OpenAPI_redirect_response_create(
 void OpenAPI_redirect_response_free(OpenAPI_redirect_response_t *redirect_response);
 OpenAPI_redirect_response_t *OpenAPI_redirect_response_parseFromJSON(cJSON *redirect_responseJSON);
 cJSON *OpenAPI_redirect_response_convertToJSON(OpenAPI_redirect_response_t *redirect_response);
+bool OpenAPI_redirect_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_redirect_response_t *redirect_response);
 OpenAPI_redirect_response_t *OpenAPI_redirect_response_copy(OpenAPI_redirect_response_t *dst, OpenAPI_redirect_response_t *src);
 
 #ifdef __cplusplus
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_redundant_pdu_session_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_redundant_pdu_session_information_t *redundant_pdu_session_information)
+{
+    if (redundant_pdu_session_information == NULL) {
+        ogs_error("OpenAPI_redundant_pdu_session_information_writeJSON() failed [RedundantPduSessionInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_redundant_pdu_session_information_writeJSON() failed [RedundantPduSessionInformation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "rsn", OpenAPI_rsn_ToString(redundant_pdu_session_information->rsn)) == false) {
+        ogs_error("OpenAPI_redundant_pdu_session_information_writeJSON() failed [rsn]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_redundant_pdu_session_information_writeJSON() failed [RedundantPduSessionInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_redundant_pdu_session_information_t *OpenAPI_redundant_pdu_session_information_parseFromJSON(cJSON *redundant_pdu_session_informationJSON)
 {
     OpenAPI_redundant_pdu_session_information_t *redundant_pdu_session_information_local_var = NULL;
@@ -72,7 +99,6 @@ end:
 OpenAPI_redundant_pdu_session_information_t *OpenAPI_redundant_pdu_session_information_copy(OpenAPI_redundant_pdu_session_information_t *dst, OpenAPI_redundant_pdu_session_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_redundant_pdu_session_information_convertToJSON(src);
@@ -81,21 +107,6 @@ OpenAPI_redundant_pdu_session_information_t *OpenAPI_redundant_pdu_session_infor
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_redundant_pdu_session_information_free(dst);
     dst = OpenAPI_redundant_pdu_session_information_parseFromJSON(item);
     cJSON_Delete(item);
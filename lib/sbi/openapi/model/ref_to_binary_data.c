@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_ref_to_binary_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ref_to_binary_data_t *ref_to_binary_data)
+{
+    if (ref_to_binary_data == NULL) {
+        ogs_error("OpenAPI_ref_to_binary_data_writeJSON() failed [RefToBinaryData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ref_to_binary_data_writeJSON() failed [RefToBinaryData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "contentId", ref_to_binary_data->content_id) == false) {
+        ogs_error("OpenAPI_ref_to_binary_data_writeJSON() failed [content_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ref_to_binary_data_writeJSON() failed [RefToBinaryData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ref_to_binary_data_t *OpenAPI_ref_to_binary_data_parseFromJSON(cJSON *ref_to_binary_dataJSON)
 {
     OpenAPI_ref_to_binary_data_t *ref_to_binary_data_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_ref_to_binary_data_t *OpenAPI_ref_to_binary_data_copy(OpenAPI_ref_to_binary_data_t *dst, OpenAPI_ref_to_binary_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ref_to_binary_data_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_ref_to_binary_data_t *OpenAPI_ref_to_binary_data_copy(OpenAPI_ref_to_bin
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ref_to_binary_data_free(dst);
     dst = OpenAPI_ref_to_binary_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -343,6 +343,212 @@ end:
     return item;
 }
 
+bool OpenAPI_registration_context_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_context_container_t *registration_context_container)
+{
+    if (registration_context_container == NULL) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [RegistrationContextContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [RegistrationContextContainer]");
+        return false;
+    }
+    if (OpenAPI_ue_context_writeJSON(writer, "ueContext", registration_context_container->ue_context) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [ue_context]");
+        goto end;
+    }
+
+    if (registration_context_container->local_time_zone) {
+    if (OpenAPI_json_write_string(writer, "localTimeZone", registration_context_container->local_time_zone) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [local_time_zone]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(registration_context_container->an_type)) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [an_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "anN2ApId", registration_context_container->an_n2_ap_id) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [an_n2_ap_id]");
+        goto end;
+    }
+
+    if (OpenAPI_global_ran_node_id_writeJSON(writer, "ranNodeId", registration_context_container->ran_node_id) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [ran_node_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "initialAmfName", registration_context_container->initial_amf_name) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [initial_amf_name]");
+        goto end;
+    }
+
+    if (OpenAPI_user_location_writeJSON(writer, "userLocation", registration_context_container->user_location) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [user_location]");
+        goto end;
+    }
+
+    if (registration_context_container->rrc_est_cause) {
+    if (OpenAPI_json_write_string(writer, "rrcEstCause", registration_context_container->rrc_est_cause) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rrc_est_cause]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->is_ue_context_request) {
+    if (OpenAPI_json_write_bool(writer, "ueContextRequest", registration_context_container->ue_context_request) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [ue_context_request]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->is_initial_amf_n2_ap_id) {
+    if (OpenAPI_json_write_number(writer, "initialAmfN2ApId", registration_context_container->initial_amf_n2_ap_id) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [initial_amf_n2_ap_id]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->an_n2_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "anN2IPv4Addr", registration_context_container->an_n2_ipv4_addr) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [an_n2_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->an_n2_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "anN2IPv6Addr", registration_context_container->an_n2_ipv6_addr) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [an_n2_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->allowed_nssai) {
+    if (OpenAPI_allowed_nssai_writeJSON(writer, "allowedNssai", registration_context_container->allowed_nssai) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [allowed_nssai]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->configured_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "configuredNssai") == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [configured_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *configured_nssai_node;
+    if (registration_context_container->configured_nssai) {
+        OpenAPI_list_for_each(registration_context_container->configured_nssai, configured_nssai_node) {
+            if (OpenAPI_configured_snssai_writeJSON(writer, NULL, configured_nssai_node->data) == false) {
+                ogs_error("OpenAPI_registration_context_container_writeJSON() failed [configured_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [configured_nssai]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->rejected_nssai_in_plmn) {
+    if (OpenAPI_json_write_array_start(writer, "rejectedNssaiInPlmn") == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_plmn]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rejected_nssai_in_plmn_node;
+    if (registration_context_container->rejected_nssai_in_plmn) {
+        OpenAPI_list_for_each(registration_context_container->rejected_nssai_in_plmn, rejected_nssai_in_plmn_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, rejected_nssai_in_plmn_node->data) == false) {
+                ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_plmn]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_plmn]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->rejected_nssai_in_ta) {
+    if (OpenAPI_json_write_array_start(writer, "rejectedNssaiInTa") == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_ta]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rejected_nssai_in_ta_node;
+    if (registration_context_container->rejected_nssai_in_ta) {
+        OpenAPI_list_for_each(registration_context_container->rejected_nssai_in_ta, rejected_nssai_in_ta_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, rejected_nssai_in_ta_node->data) == false) {
+                ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_ta]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [rejected_nssai_in_ta]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->selected_plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "selectedPlmnId", registration_context_container->selected_plmn_id) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [selected_plmn_id]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->is_iab_node_ind) {
+    if (OpenAPI_json_write_bool(writer, "iabNodeInd", registration_context_container->iab_node_ind) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [iab_node_ind]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->ce_mode_b_ind) {
+    if (OpenAPI_ce_mode_b_ind_writeJSON(writer, "ceModeBInd", registration_context_container->ce_mode_b_ind) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [ce_mode_b_ind]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->lte_m_ind) {
+    if (OpenAPI_lte_m_ind_writeJSON(writer, "lteMInd", registration_context_container->lte_m_ind) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [lte_m_ind]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->is_authenticated_ind) {
+    if (OpenAPI_json_write_bool(writer, "authenticatedInd", registration_context_container->authenticated_ind) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [authenticated_ind]");
+        goto end;
+    }
+    }
+
+    if (registration_context_container->npn_access_info) {
+    if (OpenAPI_npn_access_info_writeJSON(writer, "npnAccessInfo", registration_context_container->npn_access_info) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [npn_access_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_registration_context_container_writeJSON() failed [RegistrationContextContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_registration_context_container_t *OpenAPI_registration_context_container_parseFromJSON(cJSON *registration_context_containerJSON)
 {
     OpenAPI_registration_context_container_t *registration_context_container_local_var = NULL;
@@ -640,7 +846,6 @@ end:
 OpenAPI_registration_context_container_t *OpenAPI_registration_context_container_copy(OpenAPI_registration_context_container_t *dst, OpenAPI_registration_context_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_context_container_convertToJSON(src);
@@ -649,21 +854,6 @@ OpenAPI_registration_context_container_t *OpenAPI_registration_context_container
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_context_container_free(dst);
     dst = OpenAPI_registration_context_container_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "allowed_nssai.h"
 #include "ce_mode_b_ind.h"
@@ -89,6 +90,7 @@ OpenAPI_registration_context_container_t *OpenAPI_registration_context_container
 void OpenAPI_registration_context_container_free(OpenAPI_registration_context_container_t *registration_context_container);
 OpenAPI_registration_context_container_t *OpenAPI_registration_context_container_parseFromJSON(cJSON *registration_context_containerJSON);
 cJSON *OpenAPI_registration_context_container_convertToJSON(OpenAPI_registration_context_container_t *registration_context_container);
+bool OpenAPI_registration_context_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_context_container_t *registration_context_container);
 OpenAPI_registration_context_container_t *OpenAPI_registration_context_container_copy(OpenAPI_registration_context_container_t *dst, OpenAPI_registration_context_container_t *src);
 
 #ifdef __cplusplus
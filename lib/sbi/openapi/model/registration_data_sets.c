@@ -117,6 +117,63 @@ end:
     return item;
 }
 
+bool OpenAPI_registration_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_data_sets_t *registration_data_sets)
+{
+    if (registration_data_sets == NULL) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [RegistrationDataSets]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [RegistrationDataSets]");
+        return false;
+    }
+    if (registration_data_sets->amf3_gpp) {
+    if (OpenAPI_amf3_gpp_access_registration_writeJSON(writer, "amf3Gpp", registration_data_sets->amf3_gpp) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [amf3_gpp]");
+        goto end;
+    }
+    }
+
+    if (registration_data_sets->amf_non3_gpp) {
+    if (OpenAPI_amf_non3_gpp_access_registration_writeJSON(writer, "amfNon3Gpp", registration_data_sets->amf_non3_gpp) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [amf_non3_gpp]");
+        goto end;
+    }
+    }
+
+    if (registration_data_sets->smf_registration) {
+    if (OpenAPI_smf_registration_info_writeJSON(writer, "smfRegistration", registration_data_sets->smf_registration) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [smf_registration]");
+        goto end;
+    }
+    }
+
+    if (registration_data_sets->smsf3_gpp) {
+    if (OpenAPI_smsf_registration_writeJSON(writer, "smsf3Gpp", registration_data_sets->smsf3_gpp) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [smsf3_gpp]");
+        goto end;
+    }
+    }
+
+    if (registration_data_sets->smsf_non3_gpp) {
+    if (OpenAPI_smsf_registration_writeJSON(writer, "smsfNon3Gpp", registration_data_sets->smsf_non3_gpp) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [smsf_non3_gpp]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_registration_data_sets_writeJSON() failed [RegistrationDataSets]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_parseFromJSON(cJSON *registration_data_setsJSON)
 {
     OpenAPI_registration_data_sets_t *registration_data_sets_local_var = NULL;
@@ -171,7 +228,6 @@ end:
 OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_copy(OpenAPI_registration_data_sets_t *dst, OpenAPI_registration_data_sets_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_data_sets_convertToJSON(src);
@@ -180,21 +236,6 @@ OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_copy(OpenAPI_re
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_data_sets_free(dst);
     dst = OpenAPI_registration_data_sets_parseFromJSON(item);
     cJSON_Delete(item);
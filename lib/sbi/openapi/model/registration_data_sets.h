@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "amf3_gpp_access_registration.h"
 #include "amf_non3_gpp_access_registration.h"
 #include "smf_registration_info.h"
@@ -40,6 +41,7 @@ OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_create(
 void OpenAPI_registration_data_sets_free(OpenAPI_registration_data_sets_t *registration_data_sets);
 OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_parseFromJSON(cJSON *registration_data_setsJSON);
 cJSON *OpenAPI_registration_data_sets_convertToJSON(OpenAPI_registration_data_sets_t *registration_data_sets);
+bool OpenAPI_registration_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_data_sets_t *registration_data_sets);
 OpenAPI_registration_data_sets_t *OpenAPI_registration_data_sets_copy(OpenAPI_registration_data_sets_t *dst, OpenAPI_registration_data_sets_t *src);
 
 #ifdef __cplusplus
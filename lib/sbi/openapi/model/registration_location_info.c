@@ -93,6 +93,63 @@ end:
     return item;
 }
 
+bool OpenAPI_registration_location_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_location_info_t *registration_location_info)
+{
+    if (registration_location_info == NULL) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [RegistrationLocationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [RegistrationLocationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "amfInstanceId", registration_location_info->amf_instance_id) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [amf_instance_id]");
+        goto end;
+    }
+
+    if (registration_location_info->plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", registration_location_info->plmn_id) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (registration_location_info->vgmlc_address) {
+    if (OpenAPI_vgmlc_address_writeJSON(writer, "vgmlcAddress", registration_location_info->vgmlc_address) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [vgmlc_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "accessTypeList") == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [access_type_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *access_type_list_node;
+    OpenAPI_list_for_each(registration_location_info->access_type_list, access_type_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)access_type_list_node->data)) == false) {
+            ogs_error("OpenAPI_registration_location_info_writeJSON() failed [access_type_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [access_type_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_registration_location_info_writeJSON() failed [RegistrationLocationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_parseFromJSON(cJSON *registration_location_infoJSON)
 {
     OpenAPI_registration_location_info_t *registration_location_info_local_var = NULL;
@@ -160,7 +217,6 @@ end:
 OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_copy(OpenAPI_registration_location_info_t *dst, OpenAPI_registration_location_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_registration_location_info_convertToJSON(src);
@@ -169,21 +225,6 @@ OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_registration_location_info_free(dst);
     dst = OpenAPI_registration_location_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "plmn_id.h"
 #include "vgmlc_address.h"
@@ -37,6 +38,7 @@ OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_create(
 void OpenAPI_registration_location_info_free(OpenAPI_registration_location_info_t *registration_location_info);
 OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_parseFromJSON(cJSON *registration_location_infoJSON);
 cJSON *OpenAPI_registration_location_info_convertToJSON(OpenAPI_registration_location_info_t *registration_location_info);
+bool OpenAPI_registration_location_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_registration_location_info_t *registration_location_info);
 OpenAPI_registration_location_info_t *OpenAPI_registration_location_info_copy(OpenAPI_registration_location_info_t *dst, OpenAPI_registration_location_info_t *src);
 
 #ifdef __cplusplus
@@ -215,6 +215,133 @@ end:
     return item;
 }
 
+bool OpenAPI_release_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_release_data_t *release_data)
+{
+    if (release_data == NULL) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ReleaseData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ReleaseData]");
+        return false;
+    }
+    if (release_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(release_data->cause)) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (release_data->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", release_data->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (release_data->is__5g_mm_cause_value) {
+    if (OpenAPI_json_write_number(writer, "5gMmCauseValue", release_data->_5g_mm_cause_value) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [_5g_mm_cause_value]");
+        goto end;
+    }
+    }
+
+    if (release_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", release_data->ue_location) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (release_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", release_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (release_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", release_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (release_data->secondary_rat_usage_report) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageReport") == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_report_node;
+    if (release_data->secondary_rat_usage_report) {
+        OpenAPI_list_for_each(release_data->secondary_rat_usage_report, secondary_rat_usage_report_node) {
+            if (OpenAPI_secondary_rat_usage_report_writeJSON(writer, NULL, secondary_rat_usage_report_node->data) == false) {
+                ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_report]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+    }
+
+    if (release_data->secondary_rat_usage_info) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageInfo") == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_info_node;
+    if (release_data->secondary_rat_usage_info) {
+        OpenAPI_list_for_each(release_data->secondary_rat_usage_info, secondary_rat_usage_info_node) {
+            if (OpenAPI_secondary_rat_usage_info_writeJSON(writer, NULL, secondary_rat_usage_info_node->data) == false) {
+                ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+    }
+
+    if (release_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", release_data->n4_info) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (release_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", release_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (release_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", release_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_release_data_writeJSON() failed [ReleaseData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_release_data_t *OpenAPI_release_data_parseFromJSON(cJSON *release_dataJSON)
 {
     OpenAPI_release_data_t *release_data_local_var = NULL;
@@ -370,7 +497,6 @@ end:
 OpenAPI_release_data_t *OpenAPI_release_data_copy(OpenAPI_release_data_t *dst, OpenAPI_release_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_release_data_convertToJSON(src);
@@ -379,21 +505,6 @@ OpenAPI_release_data_t *OpenAPI_release_data_copy(OpenAPI_release_data_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_release_data_free(dst);
     dst = OpenAPI_release_data_parseFromJSON(item);
     cJSON_Delete(item);
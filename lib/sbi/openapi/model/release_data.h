@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cause.h"
 #include "n4_information.h"
 #include "ng_ap_cause.h"
@@ -56,6 +57,7 @@ OpenAPI_release_data_t *OpenAPI_release_data_create(
 void OpenAPI_release_data_free(OpenAPI_release_data_t *release_data);
 OpenAPI_release_data_t *OpenAPI_release_data_parseFromJSON(cJSON *release_dataJSON);
 cJSON *OpenAPI_release_data_convertToJSON(OpenAPI_release_data_t *release_data);
+bool OpenAPI_release_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_release_data_t *release_data);
 OpenAPI_release_data_t *OpenAPI_release_data_copy(OpenAPI_release_data_t *dst, OpenAPI_release_data_t *src);
 
 #ifdef __cplusplus
@@ -117,6 +117,63 @@ end:
     return item;
 }
 
+bool OpenAPI_released_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_released_data_t *released_data)
+{
+    if (released_data == NULL) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [ReleasedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [ReleasedData]");
+        return false;
+    }
+    if (released_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", released_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (released_data->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", released_data->apn_rate_status) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (released_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", released_data->n4_info) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (released_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", released_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (released_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", released_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_released_data_writeJSON() failed [ReleasedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_released_data_t *OpenAPI_released_data_parseFromJSON(cJSON *released_dataJSON)
 {
     OpenAPI_released_data_t *released_data_local_var = NULL;
@@ -171,7 +228,6 @@ end:
 OpenAPI_released_data_t *OpenAPI_released_data_copy(OpenAPI_released_data_t *dst, OpenAPI_released_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_released_data_convertToJSON(src);
@@ -180,21 +236,6 @@ OpenAPI_released_data_t *OpenAPI_released_data_copy(OpenAPI_released_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_released_data_free(dst);
     dst = OpenAPI_released_data_parseFromJSON(item);
     cJSON_Delete(item);
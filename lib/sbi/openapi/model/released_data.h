@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "apn_rate_status.h"
 #include "n4_information.h"
 #include "small_data_rate_status.h"
@@ -39,6 +40,7 @@ OpenAPI_released_data_t *OpenAPI_released_data_create(
 void OpenAPI_released_data_free(OpenAPI_released_data_t *released_data);
 OpenAPI_released_data_t *OpenAPI_released_data_parseFromJSON(cJSON *released_dataJSON);
 cJSON *OpenAPI_released_data_convertToJSON(OpenAPI_released_data_t *released_data);
+bool OpenAPI_released_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_released_data_t *released_data);
 OpenAPI_released_data_t *OpenAPI_released_data_copy(OpenAPI_released_data_t *dst, OpenAPI_released_data_t *src);
 
 #ifdef __cplusplus
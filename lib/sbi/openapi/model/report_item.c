@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_report_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_report_item_t *report_item)
+{
+    if (report_item == NULL) {
+        ogs_error("OpenAPI_report_item_writeJSON() failed [ReportItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_report_item_writeJSON() failed [ReportItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "path", report_item->path) == false) {
+        ogs_error("OpenAPI_report_item_writeJSON() failed [path]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_report_item_writeJSON() failed [ReportItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_report_item_t *OpenAPI_report_item_parseFromJSON(cJSON *report_itemJSON)
 {
     OpenAPI_report_item_t *report_item_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_report_item_t *OpenAPI_report_item_copy(OpenAPI_report_item_t *dst, OpenAPI_report_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_report_item_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_report_item_t *OpenAPI_report_item_copy(OpenAPI_report_item_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_report_item_free(dst);
     dst = OpenAPI_report_item_parseFromJSON(item);
     cJSON_Delete(item);
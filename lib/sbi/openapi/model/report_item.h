@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_report_item_t *OpenAPI_report_item_create(
 void OpenAPI_report_item_free(OpenAPI_report_item_t *report_item);
 OpenAPI_report_item_t *OpenAPI_report_item_parseFromJSON(cJSON *report_itemJSON);
 cJSON *OpenAPI_report_item_convertToJSON(OpenAPI_report_item_t *report_item);
+bool OpenAPI_report_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_report_item_t *report_item);
 OpenAPI_report_item_t *OpenAPI_report_item_copy(OpenAPI_report_item_t *dst, OpenAPI_report_item_t *src);
 
 #ifdef __cplusplus
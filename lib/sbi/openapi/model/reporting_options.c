@@ -107,6 +107,70 @@ end:
     return item;
 }
 
+bool OpenAPI_reporting_options_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_reporting_options_t *reporting_options)
+{
+    if (reporting_options == NULL) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [ReportingOptions]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [ReportingOptions]");
+        return false;
+    }
+    if (reporting_options->report_mode) {
+    if (OpenAPI_event_report_mode_writeJSON(writer, "reportMode", reporting_options->report_mode) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [report_mode]");
+        goto end;
+    }
+    }
+
+    if (reporting_options->is_max_num_of_reports) {
+    if (OpenAPI_json_write_number(writer, "maxNumOfReports", reporting_options->max_num_of_reports) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [max_num_of_reports]");
+        goto end;
+    }
+    }
+
+    if (reporting_options->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", reporting_options->expiry) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (reporting_options->is_sampling_ratio) {
+    if (OpenAPI_json_write_number(writer, "samplingRatio", reporting_options->sampling_ratio) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [sampling_ratio]");
+        goto end;
+    }
+    }
+
+    if (reporting_options->is_guard_time) {
+    if (OpenAPI_json_write_number(writer, "guardTime", reporting_options->guard_time) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [guard_time]");
+        goto end;
+    }
+    }
+
+    if (reporting_options->is_report_period) {
+    if (OpenAPI_json_write_number(writer, "reportPeriod", reporting_options->report_period) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [report_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_reporting_options_writeJSON() failed [ReportingOptions]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_reporting_options_t *OpenAPI_reporting_options_parseFromJSON(cJSON *reporting_optionsJSON)
 {
     OpenAPI_reporting_options_t *reporting_options_local_var = NULL;
@@ -183,7 +247,6 @@ end:
 OpenAPI_reporting_options_t *OpenAPI_reporting_options_copy(OpenAPI_reporting_options_t *dst, OpenAPI_reporting_options_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_reporting_options_convertToJSON(src);
@@ -192,21 +255,6 @@ OpenAPI_reporting_options_t *OpenAPI_reporting_options_copy(OpenAPI_reporting_op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_reporting_options_free(dst);
     dst = OpenAPI_reporting_options_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "event_report_mode.h"
 
 #ifdef __cplusplus
@@ -47,6 +48,7 @@ OpenAPI_reporting_options_t *OpenAPI_reporting_options_create(
 void OpenAPI_reporting_options_free(OpenAPI_reporting_options_t *reporting_options);
 OpenAPI_reporting_options_t *OpenAPI_reporting_options_parseFromJSON(cJSON *reporting_optionsJSON);
 cJSON *OpenAPI_reporting_options_convertToJSON(OpenAPI_reporting_options_t *reporting_options);
+bool OpenAPI_reporting_options_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_reporting_options_t *reporting_options);
 OpenAPI_reporting_options_t *OpenAPI_reporting_options_copy(OpenAPI_reporting_options_t *dst, OpenAPI_reporting_options_t *src);
 
 #ifdef __cplusplus
@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_requested_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_qos_t *requested_qos)
+{
+    if (requested_qos == NULL) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [RequestedQos]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [RequestedQos]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "5qi", requested_qos->_5qi) == false) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [_5qi]");
+        goto end;
+    }
+
+    if (requested_qos->gbr_ul) {
+    if (OpenAPI_json_write_string(writer, "gbrUl", requested_qos->gbr_ul) == false) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [gbr_ul]");
+        goto end;
+    }
+    }
+
+    if (requested_qos->gbr_dl) {
+    if (OpenAPI_json_write_string(writer, "gbrDl", requested_qos->gbr_dl) == false) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [gbr_dl]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_requested_qos_writeJSON() failed [RequestedQos]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_requested_qos_t *OpenAPI_requested_qos_parseFromJSON(cJSON *requested_qosJSON)
 {
     OpenAPI_requested_qos_t *requested_qos_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_requested_qos_t *OpenAPI_requested_qos_copy(OpenAPI_requested_qos_t *dst, OpenAPI_requested_qos_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_requested_qos_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_requested_qos_t *OpenAPI_requested_qos_copy(OpenAPI_requested_qos_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_requested_qos_free(dst);
     dst = OpenAPI_requested_qos_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_requested_qos_t *OpenAPI_requested_qos_create(
 void OpenAPI_requested_qos_free(OpenAPI_requested_qos_t *requested_qos);
 OpenAPI_requested_qos_t *OpenAPI_requested_qos_parseFromJSON(cJSON *requested_qosJSON);
 cJSON *OpenAPI_requested_qos_convertToJSON(OpenAPI_requested_qos_t *requested_qos);
+bool OpenAPI_requested_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_qos_t *requested_qos);
 OpenAPI_requested_qos_t *OpenAPI_requested_qos_copy(OpenAPI_requested_qos_t *dst, OpenAPI_requested_qos_t *src);
 
 #ifdef __cplusplus
@@ -73,6 +73,61 @@ end:
     return item;
 }
 
+bool OpenAPI_requested_rule_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_rule_data_t *requested_rule_data)
+{
+    if (requested_rule_data == NULL) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [RequestedRuleData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [RequestedRuleData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "refPccRuleIds") == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_pcc_rule_ids_node;
+    OpenAPI_list_for_each(requested_rule_data->ref_pcc_rule_ids, ref_pcc_rule_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_pcc_rule_ids_node->data) == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [ref_pcc_rule_ids]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "reqData") == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [req_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_data_node;
+    OpenAPI_list_for_each(requested_rule_data->req_data, req_data_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_requested_rule_data_type_ToString((intptr_t)req_data_node->data)) == false) {
+            ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [req_data]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [req_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_requested_rule_data_writeJSON() failed [RequestedRuleData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_parseFromJSON(cJSON *requested_rule_dataJSON)
 {
     OpenAPI_requested_rule_data_t *requested_rule_data_local_var = NULL;
@@ -135,7 +190,6 @@ end:
 OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_copy(OpenAPI_requested_rule_data_t *dst, OpenAPI_requested_rule_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_requested_rule_data_convertToJSON(src);
@@ -144,21 +198,6 @@ OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_copy(OpenAPI_requeste
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_requested_rule_data_free(dst);
     dst = OpenAPI_requested_rule_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "requested_rule_data_type.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_create(
 void OpenAPI_requested_rule_data_free(OpenAPI_requested_rule_data_t *requested_rule_data);
 OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_parseFromJSON(cJSON *requested_rule_dataJSON);
 cJSON *OpenAPI_requested_rule_data_convertToJSON(OpenAPI_requested_rule_data_t *requested_rule_data);
+bool OpenAPI_requested_rule_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_rule_data_t *requested_rule_data);
 OpenAPI_requested_rule_data_t *OpenAPI_requested_rule_data_copy(OpenAPI_requested_rule_data_t *dst, OpenAPI_requested_rule_data_t *src);
 
 #ifdef __cplusplus
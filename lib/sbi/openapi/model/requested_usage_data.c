@@ -70,6 +70,54 @@ end:
     return item;
 }
 
+bool OpenAPI_requested_usage_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_usage_data_t *requested_usage_data)
+{
+    if (requested_usage_data == NULL) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [RequestedUsageData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [RequestedUsageData]");
+        return false;
+    }
+    if (requested_usage_data->ref_um_ids) {
+    if (OpenAPI_json_write_array_start(writer, "refUmIds") == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [ref_um_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ref_um_ids_node;
+    OpenAPI_list_for_each(requested_usage_data->ref_um_ids, ref_um_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ref_um_ids_node->data) == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [ref_um_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [ref_um_ids]");
+        goto end;
+    }
+    }
+
+    if (requested_usage_data->is_all_um_ids) {
+    if (OpenAPI_json_write_bool(writer, "allUmIds", requested_usage_data->all_um_ids) == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [all_um_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_requested_usage_data_writeJSON() failed [RequestedUsageData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_parseFromJSON(cJSON *requested_usage_dataJSON)
 {
     OpenAPI_requested_usage_data_t *requested_usage_data_local_var = NULL;
@@ -116,7 +164,6 @@ end:
 OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_copy(OpenAPI_requested_usage_data_t *dst, OpenAPI_requested_usage_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_requested_usage_data_convertToJSON(src);
@@ -125,21 +172,6 @@ OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_copy(OpenAPI_reques
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_requested_usage_data_free(dst);
     dst = OpenAPI_requested_usage_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_create(
 void OpenAPI_requested_usage_data_free(OpenAPI_requested_usage_data_t *requested_usage_data);
 OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_parseFromJSON(cJSON *requested_usage_dataJSON);
 cJSON *OpenAPI_requested_usage_data_convertToJSON(OpenAPI_requested_usage_data_t *requested_usage_data);
+bool OpenAPI_requested_usage_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_requested_usage_data_t *requested_usage_data);
 OpenAPI_requested_usage_data_t *OpenAPI_requested_usage_data_copy(OpenAPI_requested_usage_data_t *dst, OpenAPI_requested_usage_data_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,50 @@ end:
     return item;
 }
 
+bool OpenAPI_resource_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resource_item_t *resource_item)
+{
+    if (resource_item == NULL) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [ResourceItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [ResourceItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "monResourceUri", resource_item->mon_resource_uri) == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [mon_resource_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "items") == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [items]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *items_node;
+    OpenAPI_list_for_each(resource_item->items, items_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)items_node->data) == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [items]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [items]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_resource_item_writeJSON() failed [ResourceItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_resource_item_t *OpenAPI_resource_item_parseFromJSON(cJSON *resource_itemJSON)
 {
     OpenAPI_resource_item_t *resource_item_local_var = NULL;
@@ -114,7 +158,6 @@ end:
 OpenAPI_resource_item_t *OpenAPI_resource_item_copy(OpenAPI_resource_item_t *dst, OpenAPI_resource_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_resource_item_convertToJSON(src);
@@ -123,21 +166,6 @@ OpenAPI_resource_item_t *OpenAPI_resource_item_copy(OpenAPI_resource_item_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_resource_item_free(dst);
     dst = OpenAPI_resource_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_resource_item_t *OpenAPI_resource_item_create(
 void OpenAPI_resource_item_free(OpenAPI_resource_item_t *resource_item);
 OpenAPI_resource_item_t *OpenAPI_resource_item_parseFromJSON(cJSON *resource_itemJSON);
 cJSON *OpenAPI_resource_item_convertToJSON(OpenAPI_resource_item_t *resource_item);
+bool OpenAPI_resource_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resource_item_t *resource_item);
 OpenAPI_resource_item_t *OpenAPI_resource_item_copy(OpenAPI_resource_item_t *dst, OpenAPI_resource_item_t *src);
 
 #ifdef __cplusplus
@@ -82,6 +82,63 @@ end:
     return item;
 }
 
+bool OpenAPI_resources_allocation_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resources_allocation_info_t *resources_allocation_info)
+{
+    if (resources_allocation_info == NULL) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [ResourcesAllocationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [ResourcesAllocationInfo]");
+        return false;
+    }
+    if (resources_allocation_info->mc_resourc_status) {
+    if (OpenAPI_json_write_string(writer, "mcResourcStatus", OpenAPI_media_component_resources_status_ToString(resources_allocation_info->mc_resourc_status)) == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [mc_resourc_status]");
+        goto end;
+    }
+    }
+
+    if (resources_allocation_info->flows) {
+    if (OpenAPI_json_write_array_start(writer, "flows") == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [flows]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *flows_node;
+    if (resources_allocation_info->flows) {
+        OpenAPI_list_for_each(resources_allocation_info->flows, flows_node) {
+            if (OpenAPI_flows_writeJSON(writer, NULL, flows_node->data) == false) {
+                ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [flows]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [flows]");
+        goto end;
+    }
+    }
+
+    if (resources_allocation_info->alt_ser_req) {
+    if (OpenAPI_json_write_string(writer, "altSerReq", resources_allocation_info->alt_ser_req) == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [alt_ser_req]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_resources_allocation_info_writeJSON() failed [ResourcesAllocationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_parseFromJSON(cJSON *resources_allocation_infoJSON)
 {
     OpenAPI_resources_allocation_info_t *resources_allocation_info_local_var = NULL;
@@ -148,7 +205,6 @@ end:
 OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_copy(OpenAPI_resources_allocation_info_t *dst, OpenAPI_resources_allocation_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_resources_allocation_info_convertToJSON(src);
@@ -157,21 +213,6 @@ OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_resources_allocation_info_free(dst);
     dst = OpenAPI_resources_allocation_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flows.h"
 #include "media_component_resources_status.h"
 
@@ -34,6 +35,7 @@ OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_create(
 void OpenAPI_resources_allocation_info_free(OpenAPI_resources_allocation_info_t *resources_allocation_info);
 OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_parseFromJSON(cJSON *resources_allocation_infoJSON);
 cJSON *OpenAPI_resources_allocation_info_convertToJSON(OpenAPI_resources_allocation_info_t *resources_allocation_info);
+bool OpenAPI_resources_allocation_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resources_allocation_info_t *resources_allocation_info);
 OpenAPI_resources_allocation_info_t *OpenAPI_resources_allocation_info_copy(OpenAPI_resources_allocation_info_t *dst, OpenAPI_resources_allocation_info_t *src);
 
 #ifdef __cplusplus
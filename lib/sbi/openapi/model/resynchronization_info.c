@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_resynchronization_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resynchronization_info_t *resynchronization_info)
+{
+    if (resynchronization_info == NULL) {
+        ogs_error("OpenAPI_resynchronization_info_writeJSON() failed [ResynchronizationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_resynchronization_info_writeJSON() failed [ResynchronizationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "rand", resynchronization_info->rand) == false) {
+        ogs_error("OpenAPI_resynchronization_info_writeJSON() failed [rand]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "auts", resynchronization_info->auts) == false) {
+        ogs_error("OpenAPI_resynchronization_info_writeJSON() failed [auts]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_resynchronization_info_writeJSON() failed [ResynchronizationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_parseFromJSON(cJSON *resynchronization_infoJSON)
 {
     OpenAPI_resynchronization_info_t *resynchronization_info_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_copy(OpenAPI_resynchronization_info_t *dst, OpenAPI_resynchronization_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_resynchronization_info_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_copy(OpenAPI_re
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_resynchronization_info_free(dst);
     dst = OpenAPI_resynchronization_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_create(
 void OpenAPI_resynchronization_info_free(OpenAPI_resynchronization_info_t *resynchronization_info);
 OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_parseFromJSON(cJSON *resynchronization_infoJSON);
 cJSON *OpenAPI_resynchronization_info_convertToJSON(OpenAPI_resynchronization_info_t *resynchronization_info);
+bool OpenAPI_resynchronization_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_resynchronization_info_t *resynchronization_info);
 OpenAPI_resynchronization_info_t *OpenAPI_resynchronization_info_copy(OpenAPI_resynchronization_info_t *dst, OpenAPI_resynchronization_info_t *src);
 
 #ifdef __cplusplus
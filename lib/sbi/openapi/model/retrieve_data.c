@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_retrieve_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_retrieve_data_t *retrieve_data)
+{
+    if (retrieve_data == NULL) {
+        ogs_error("OpenAPI_retrieve_data_writeJSON() failed [RetrieveData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_retrieve_data_writeJSON() failed [RetrieveData]");
+        return false;
+    }
+    if (retrieve_data->is_small_data_rate_status_req) {
+    if (OpenAPI_json_write_bool(writer, "smallDataRateStatusReq", retrieve_data->small_data_rate_status_req) == false) {
+        ogs_error("OpenAPI_retrieve_data_writeJSON() failed [small_data_rate_status_req]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_retrieve_data_writeJSON() failed [RetrieveData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_parseFromJSON(cJSON *retrieve_dataJSON)
 {
     OpenAPI_retrieve_data_t *retrieve_data_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_copy(OpenAPI_retrieve_data_t *dst, OpenAPI_retrieve_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_retrieve_data_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_copy(OpenAPI_retrieve_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_retrieve_data_free(dst);
     dst = OpenAPI_retrieve_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_create(
 void OpenAPI_retrieve_data_free(OpenAPI_retrieve_data_t *retrieve_data);
 OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_parseFromJSON(cJSON *retrieve_dataJSON);
 cJSON *OpenAPI_retrieve_data_convertToJSON(OpenAPI_retrieve_data_t *retrieve_data);
+bool OpenAPI_retrieve_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_retrieve_data_t *retrieve_data);
 OpenAPI_retrieve_data_t *OpenAPI_retrieve_data_copy(OpenAPI_retrieve_data_t *dst, OpenAPI_retrieve_data_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_retrieved_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_retrieved_data_t *retrieved_data)
+{
+    if (retrieved_data == NULL) {
+        ogs_error("OpenAPI_retrieved_data_writeJSON() failed [RetrievedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_retrieved_data_writeJSON() failed [RetrievedData]");
+        return false;
+    }
+    if (retrieved_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", retrieved_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_retrieved_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_retrieved_data_writeJSON() failed [RetrievedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_parseFromJSON(cJSON *retrieved_dataJSON)
 {
     OpenAPI_retrieved_data_t *retrieved_data_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_copy(OpenAPI_retrieved_data_t *dst, OpenAPI_retrieved_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_retrieved_data_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_copy(OpenAPI_retrieved_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_retrieved_data_free(dst);
     dst = OpenAPI_retrieved_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "small_data_rate_status.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_create(
 void OpenAPI_retrieved_data_free(OpenAPI_retrieved_data_t *retrieved_data);
 OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_parseFromJSON(cJSON *retrieved_dataJSON);
 cJSON *OpenAPI_retrieved_data_convertToJSON(OpenAPI_retrieved_data_t *retrieved_data);
+bool OpenAPI_retrieved_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_retrieved_data_t *retrieved_data);
 OpenAPI_retrieved_data_t *OpenAPI_retrieved_data_copy(OpenAPI_retrieved_data_t *dst, OpenAPI_retrieved_data_t *src);
 
 #ifdef __cplusplus
@@ -65,6 +65,47 @@ end:
     return item;
 }
 
+bool OpenAPI_rg_auth_ctx_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rg_auth_ctx_t *rg_auth_ctx)
+{
+    if (rg_auth_ctx == NULL) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [RgAuthCtx]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [RgAuthCtx]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "authResult", OpenAPI_auth_result_ToString(rg_auth_ctx->auth_result)) == false) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [auth_result]");
+        goto end;
+    }
+
+    if (rg_auth_ctx->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", rg_auth_ctx->supi) == false) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (rg_auth_ctx->is_auth_ind) {
+    if (OpenAPI_json_write_bool(writer, "authInd", rg_auth_ctx->auth_ind) == false) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [auth_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_rg_auth_ctx_writeJSON() failed [RgAuthCtx]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_parseFromJSON(cJSON *rg_auth_ctxJSON)
 {
     OpenAPI_rg_auth_ctx_t *rg_auth_ctx_local_var = NULL;
@@ -114,7 +155,6 @@ end:
 OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_copy(OpenAPI_rg_auth_ctx_t *dst, OpenAPI_rg_auth_ctx_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_rg_auth_ctx_convertToJSON(src);
@@ -123,21 +163,6 @@ OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_copy(OpenAPI_rg_auth_ctx_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_rg_auth_ctx_free(dst);
     dst = OpenAPI_rg_auth_ctx_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "auth_result.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_create(
 void OpenAPI_rg_auth_ctx_free(OpenAPI_rg_auth_ctx_t *rg_auth_ctx);
 OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_parseFromJSON(cJSON *rg_auth_ctxJSON);
 cJSON *OpenAPI_rg_auth_ctx_convertToJSON(OpenAPI_rg_auth_ctx_t *rg_auth_ctx);
+bool OpenAPI_rg_auth_ctx_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rg_auth_ctx_t *rg_auth_ctx);
 OpenAPI_rg_auth_ctx_t *OpenAPI_rg_auth_ctx_copy(OpenAPI_rg_auth_ctx_t *dst, OpenAPI_rg_auth_ctx_t *src);
 
 #ifdef __cplusplus
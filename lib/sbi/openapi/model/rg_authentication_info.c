@@ -62,6 +62,45 @@ end:
     return item;
 }
 
+bool OpenAPI_rg_authentication_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rg_authentication_info_t *rg_authentication_info)
+{
+    if (rg_authentication_info == NULL) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [RgAuthenticationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [RgAuthenticationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "suci", rg_authentication_info->suci) == false) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [suci]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_bool(writer, "authenticatedInd", rg_authentication_info->authenticated_ind) == false) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [authenticated_ind]");
+        goto end;
+    }
+
+    if (rg_authentication_info->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", rg_authentication_info->supported_features) == false) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_rg_authentication_info_writeJSON() failed [RgAuthenticationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_rg_authentication_info_t *OpenAPI_rg_authentication_info_parseFromJSON(cJSON *rg_authentication_infoJSON)
 {
     OpenAPI_rg_authentication_info_t *rg_authentication_info_local_var = NULL;
@@ -111,7 +150,6 @@ end:
 OpenAPI_rg_authentication_info_t *OpenAPI_rg_authentication_info_copy(OpenAPI_rg_authentication_info_t *dst, OpenAPI_rg_authentication_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_rg_authentication_info_convertToJSON(src);
@@ -120,21 +158,6 @@ OpenAPI_rg_authentication_info_t *OpenAPI_rg_authentication_info_copy(OpenAPI_rg
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_rg_authentication_info_free(dst);
     dst = OpenAPI_rg_authentication_info_parseFromJSON(item);
     cJSON_Delete(item);
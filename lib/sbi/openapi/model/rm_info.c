@@ -58,6 +58,38 @@ end:
     return item;
 }
 
+bool OpenAPI_rm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rm_info_t *rm_info)
+{
+    if (rm_info == NULL) {
+        ogs_error("OpenAPI_rm_info_writeJSON() failed [RmInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_rm_info_writeJSON() failed [RmInfo]");
+        return false;
+    }
+    if (OpenAPI_rm_state_writeJSON(writer, "rmState", rm_info->rm_state) == false) {
+        ogs_error("OpenAPI_rm_info_writeJSON() failed [rm_state]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(rm_info->access_type)) == false) {
+        ogs_error("OpenAPI_rm_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_rm_info_writeJSON() failed [RmInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_rm_info_t *OpenAPI_rm_info_parseFromJSON(cJSON *rm_infoJSON)
 {
     OpenAPI_rm_info_t *rm_info_local_var = NULL;
@@ -96,7 +128,6 @@ end:
 OpenAPI_rm_info_t *OpenAPI_rm_info_copy(OpenAPI_rm_info_t *dst, OpenAPI_rm_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_rm_info_convertToJSON(src);
@@ -105,21 +136,6 @@ OpenAPI_rm_info_t *OpenAPI_rm_info_copy(OpenAPI_rm_info_t *dst, OpenAPI_rm_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_rm_info_free(dst);
     dst = OpenAPI_rm_info_parseFromJSON(item);
     cJSON_Delete(item);
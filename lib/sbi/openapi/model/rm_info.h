@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "rm_state.h"
 
@@ -32,6 +33,7 @@ OpenAPI_rm_info_t *OpenAPI_rm_info_create(
 void OpenAPI_rm_info_free(OpenAPI_rm_info_t *rm_info);
 OpenAPI_rm_info_t *OpenAPI_rm_info_parseFromJSON(cJSON *rm_infoJSON);
 cJSON *OpenAPI_rm_info_convertToJSON(OpenAPI_rm_info_t *rm_info);
+bool OpenAPI_rm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rm_info_t *rm_info);
 OpenAPI_rm_info_t *OpenAPI_rm_info_copy(OpenAPI_rm_info_t *dst, OpenAPI_rm_info_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_rm_state_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rm_state_t *rm_state)
+{
+    if (rm_state == NULL) {
+        ogs_error("OpenAPI_rm_state_writeJSON() failed [RmState]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_rm_state_writeJSON() failed [RmState]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_rm_state_writeJSON() failed [RmState]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_rm_state_t *OpenAPI_rm_state_parseFromJSON(cJSON *rm_stateJSON)
 {
     OpenAPI_rm_state_t *rm_state_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_rm_state_t *OpenAPI_rm_state_copy(OpenAPI_rm_state_t *dst, OpenAPI_rm_state_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_rm_state_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_rm_state_t *OpenAPI_rm_state_copy(OpenAPI_rm_state_t *dst, OpenAPI_rm_st
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_rm_state_free(dst);
     dst = OpenAPI_rm_state_parseFromJSON(item);
     cJSON_Delete(item);
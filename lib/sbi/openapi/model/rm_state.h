@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "rm_state_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_rm_state_t *OpenAPI_rm_state_create(
 void OpenAPI_rm_state_free(OpenAPI_rm_state_t *rm_state);
 OpenAPI_rm_state_t *OpenAPI_rm_state_parseFromJSON(cJSON *rm_stateJSON);
 cJSON *OpenAPI_rm_state_convertToJSON(OpenAPI_rm_state_t *rm_state);
+bool OpenAPI_rm_state_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rm_state_t *rm_state);
 OpenAPI_rm_state_t *OpenAPI_rm_state_copy(OpenAPI_rm_state_t *dst, OpenAPI_rm_state_t *src);
 
 #ifdef __cplusplus
@@ -79,6 +79,56 @@ end:
     return item;
 }
 
+bool OpenAPI_roaming_charging_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_roaming_charging_profile_t *roaming_charging_profile)
+{
+    if (roaming_charging_profile == NULL) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [RoamingChargingProfile]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [RoamingChargingProfile]");
+        return false;
+    }
+    if (roaming_charging_profile->triggers) {
+    if (OpenAPI_json_write_array_start(writer, "triggers") == false) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [triggers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *triggers_node;
+    if (roaming_charging_profile->triggers) {
+        OpenAPI_list_for_each(roaming_charging_profile->triggers, triggers_node) {
+            if (OpenAPI_trigger_writeJSON(writer, NULL, triggers_node->data) == false) {
+                ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [triggers]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [triggers]");
+        goto end;
+    }
+    }
+
+    if (roaming_charging_profile->partial_record_method) {
+    if (OpenAPI_partial_record_method_writeJSON(writer, "partialRecordMethod", roaming_charging_profile->partial_record_method) == false) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [partial_record_method]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_roaming_charging_profile_writeJSON() failed [RoamingChargingProfile]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_parseFromJSON(cJSON *roaming_charging_profileJSON)
 {
     OpenAPI_roaming_charging_profile_t *roaming_charging_profile_local_var = NULL;
@@ -131,7 +181,6 @@ end:
 OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_copy(OpenAPI_roaming_charging_profile_t *dst, OpenAPI_roaming_charging_profile_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_roaming_charging_profile_convertToJSON(src);
@@ -140,21 +189,6 @@ OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_roaming_charging_profile_free(dst);
     dst = OpenAPI_roaming_charging_profile_parseFromJSON(item);
     cJSON_Delete(item);
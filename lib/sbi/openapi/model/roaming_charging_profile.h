@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "partial_record_method.h"
 #include "trigger.h"
 
@@ -32,6 +33,7 @@ OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_create(
 void OpenAPI_roaming_charging_profile_free(OpenAPI_roaming_charging_profile_t *roaming_charging_profile);
 OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_parseFromJSON(cJSON *roaming_charging_profileJSON);
 cJSON *OpenAPI_roaming_charging_profile_convertToJSON(OpenAPI_roaming_charging_profile_t *roaming_charging_profile);
+bool OpenAPI_roaming_charging_profile_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_roaming_charging_profile_t *roaming_charging_profile);
 OpenAPI_roaming_charging_profile_t *OpenAPI_roaming_charging_profile_copy(OpenAPI_roaming_charging_profile_t *dst, OpenAPI_roaming_charging_profile_t *src);
 
 #ifdef __cplusplus
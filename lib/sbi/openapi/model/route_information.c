@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_route_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_route_information_t *route_information)
+{
+    if (route_information == NULL) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [RouteInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [RouteInformation]");
+        return false;
+    }
+    if (route_information->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", route_information->ipv4_addr) == false) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (route_information->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", route_information->ipv6_addr) == false) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "portNumber", route_information->port_number) == false) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [port_number]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_route_information_writeJSON() failed [RouteInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_route_information_t *OpenAPI_route_information_parseFromJSON(cJSON *route_informationJSON)
 {
     OpenAPI_route_information_t *route_information_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_route_information_t *OpenAPI_route_information_copy(OpenAPI_route_information_t *dst, OpenAPI_route_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_route_information_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_route_information_t *OpenAPI_route_information_copy(OpenAPI_route_inform
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_route_information_free(dst);
     dst = OpenAPI_route_information_parseFromJSON(item);
     cJSON_Delete(item);
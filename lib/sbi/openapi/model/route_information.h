@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_route_information_t *OpenAPI_route_information_create(
 void OpenAPI_route_information_free(OpenAPI_route_information_t *route_information);
 OpenAPI_route_information_t *OpenAPI_route_information_parseFromJSON(cJSON *route_informationJSON);
 cJSON *OpenAPI_route_information_convertToJSON(OpenAPI_route_information_t *route_information);
+bool OpenAPI_route_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_route_information_t *route_information);
 OpenAPI_route_information_t *OpenAPI_route_information_copy(OpenAPI_route_information_t *dst, OpenAPI_route_information_t *src);
 
 #ifdef __cplusplus
@@ -71,6 +71,47 @@ end:
     return item;
 }
 
+bool OpenAPI_route_to_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_route_to_location_t *route_to_location)
+{
+    if (route_to_location == NULL) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [RouteToLocation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [RouteToLocation]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnai", route_to_location->dnai) == false) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [dnai]");
+        goto end;
+    }
+
+    if (route_to_location->route_info) {
+    if (OpenAPI_route_information_writeJSON(writer, "routeInfo", route_to_location->route_info) == false) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [route_info]");
+        goto end;
+    }
+    }
+
+    if (route_to_location->route_prof_id) {
+    if (OpenAPI_json_write_string(writer, "routeProfId", route_to_location->route_prof_id) == false) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [route_prof_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_route_to_location_writeJSON() failed [RouteToLocation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_route_to_location_t *OpenAPI_route_to_location_parseFromJSON(cJSON *route_to_locationJSON)
 {
     OpenAPI_route_to_location_t *route_to_location_local_var = NULL;
@@ -115,7 +156,6 @@ end:
 OpenAPI_route_to_location_t *OpenAPI_route_to_location_copy(OpenAPI_route_to_location_t *dst, OpenAPI_route_to_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_route_to_location_convertToJSON(src);
@@ -124,21 +164,6 @@ OpenAPI_route_to_location_t *OpenAPI_route_to_location_copy(OpenAPI_route_to_loc
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_route_to_location_free(dst);
     dst = OpenAPI_route_to_location_parseFromJSON(item);
     cJSON_Delete(item);
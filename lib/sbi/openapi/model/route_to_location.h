@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "route_information.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_route_to_location_t *OpenAPI_route_to_location_create(
 void OpenAPI_route_to_location_free(OpenAPI_route_to_location_t *route_to_location);
 OpenAPI_route_to_location_t *OpenAPI_route_to_location_parseFromJSON(cJSON *route_to_locationJSON);
 cJSON *OpenAPI_route_to_location_convertToJSON(OpenAPI_route_to_location_t *route_to_location);
+bool OpenAPI_route_to_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_route_to_location_t *route_to_location);
 OpenAPI_route_to_location_t *OpenAPI_route_to_location_copy(OpenAPI_route_to_location_t *dst, OpenAPI_route_to_location_t *src);
 
 #ifdef __cplusplus
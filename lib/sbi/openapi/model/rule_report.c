@@ -137,6 +137,104 @@ end:
     return item;
 }
 
+bool OpenAPI_rule_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rule_report_t *rule_report)
+{
+    if (rule_report == NULL) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [RuleReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [RuleReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "pccRuleIds") == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [pcc_rule_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pcc_rule_ids_node;
+    OpenAPI_list_for_each(rule_report->pcc_rule_ids, pcc_rule_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)pcc_rule_ids_node->data) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [pcc_rule_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [pcc_rule_ids]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ruleStatus", OpenAPI_rule_status_ToString(rule_report->rule_status)) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [rule_status]");
+        goto end;
+    }
+
+    if (rule_report->cont_vers) {
+    if (OpenAPI_json_write_array_start(writer, "contVers") == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *cont_vers_node;
+    OpenAPI_list_for_each(rule_report->cont_vers, cont_vers_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)cont_vers_node->data) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [cont_vers]");
+        goto end;
+    }
+    }
+
+    if (rule_report->failure_code) {
+    if (OpenAPI_json_write_string(writer, "failureCode", OpenAPI_failure_code_ToString(rule_report->failure_code)) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [failure_code]");
+        goto end;
+    }
+    }
+
+    if (rule_report->fin_unit_act) {
+    if (OpenAPI_final_unit_action_writeJSON(writer, "finUnitAct", rule_report->fin_unit_act) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [fin_unit_act]");
+        goto end;
+    }
+    }
+
+    if (rule_report->ran_nas_rel_causes) {
+    if (OpenAPI_json_write_array_start(writer, "ranNasRelCauses") == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ran_nas_rel_causes_node;
+    if (rule_report->ran_nas_rel_causes) {
+        OpenAPI_list_for_each(rule_report->ran_nas_rel_causes, ran_nas_rel_causes_node) {
+            if (OpenAPI_ran_nas_rel_cause_writeJSON(writer, NULL, ran_nas_rel_causes_node->data) == false) {
+                ogs_error("OpenAPI_rule_report_writeJSON() failed [ran_nas_rel_causes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_rule_report_writeJSON() failed [RuleReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_rule_report_t *OpenAPI_rule_report_parseFromJSON(cJSON *rule_reportJSON)
 {
     OpenAPI_rule_report_t *rule_report_local_var = NULL;
@@ -259,7 +357,6 @@ end:
 OpenAPI_rule_report_t *OpenAPI_rule_report_copy(OpenAPI_rule_report_t *dst, OpenAPI_rule_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_rule_report_convertToJSON(src);
@@ -268,21 +365,6 @@ OpenAPI_rule_report_t *OpenAPI_rule_report_copy(OpenAPI_rule_report_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_rule_report_free(dst);
     dst = OpenAPI_rule_report_parseFromJSON(item);
     cJSON_Delete(item);
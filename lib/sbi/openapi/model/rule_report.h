@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "failure_code.h"
 #include "final_unit_action.h"
 #include "ran_nas_rel_cause.h"
@@ -42,6 +43,7 @@ OpenAPI_rule_report_t *OpenAPI_rule_report_create(
 void OpenAPI_rule_report_free(OpenAPI_rule_report_t *rule_report);
 OpenAPI_rule_report_t *OpenAPI_rule_report_parseFromJSON(cJSON *rule_reportJSON);
 cJSON *OpenAPI_rule_report_convertToJSON(OpenAPI_rule_report_t *rule_report);
+bool OpenAPI_rule_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_rule_report_t *rule_report);
 OpenAPI_rule_report_t *OpenAPI_rule_report_copy(OpenAPI_rule_report_t *dst, OpenAPI_rule_report_t *src);
 
 #ifdef __cplusplus
@@ -79,6 +79,61 @@ end:
     return item;
 }
 
+bool OpenAPI_scheduled_communication_time_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scheduled_communication_time_1_t *scheduled_communication_time_1)
+{
+    if (scheduled_communication_time_1 == NULL) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [ScheduledCommunicationTime_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [ScheduledCommunicationTime_1]");
+        return false;
+    }
+    if (scheduled_communication_time_1->days_of_week) {
+    if (OpenAPI_json_write_array_start(writer, "daysOfWeek") == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [days_of_week]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *days_of_week_node;
+    OpenAPI_list_for_each(scheduled_communication_time_1->days_of_week, days_of_week_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)days_of_week_node->data) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [days_of_week]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [days_of_week]");
+        goto end;
+    }
+    }
+
+    if (scheduled_communication_time_1->time_of_day_start) {
+    if (OpenAPI_json_write_string(writer, "timeOfDayStart", scheduled_communication_time_1->time_of_day_start) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [time_of_day_start]");
+        goto end;
+    }
+    }
+
+    if (scheduled_communication_time_1->time_of_day_end) {
+    if (OpenAPI_json_write_string(writer, "timeOfDayEnd", scheduled_communication_time_1->time_of_day_end) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [time_of_day_end]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scheduled_communication_time_1_writeJSON() failed [ScheduledCommunicationTime_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_scheduled_communication_time_1_t *OpenAPI_scheduled_communication_time_1_parseFromJSON(cJSON *scheduled_communication_time_1JSON)
 {
     OpenAPI_scheduled_communication_time_1_t *scheduled_communication_time_1_local_var = NULL;
@@ -134,7 +189,6 @@ end:
 OpenAPI_scheduled_communication_time_1_t *OpenAPI_scheduled_communication_time_1_copy(OpenAPI_scheduled_communication_time_1_t *dst, OpenAPI_scheduled_communication_time_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scheduled_communication_time_1_convertToJSON(src);
@@ -143,21 +197,6 @@ OpenAPI_scheduled_communication_time_1_t *OpenAPI_scheduled_communication_time_1
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scheduled_communication_time_1_free(dst);
     dst = OpenAPI_scheduled_communication_time_1_parseFromJSON(item);
     cJSON_Delete(item);
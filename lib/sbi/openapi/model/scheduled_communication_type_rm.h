@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "null_value.h"
 #include "scheduled_communication_type.h"
 
@@ -28,6 +29,7 @@ OpenAPI_scheduled_communication_type_rm_t *OpenAPI_scheduled_communication_type_
 void OpenAPI_scheduled_communication_type_rm_free(OpenAPI_scheduled_communication_type_rm_t *scheduled_communication_type_rm);
 OpenAPI_scheduled_communication_type_rm_t *OpenAPI_scheduled_communication_type_rm_parseFromJSON(cJSON *scheduled_communication_type_rmJSON);
 cJSON *OpenAPI_scheduled_communication_type_rm_convertToJSON(OpenAPI_scheduled_communication_type_rm_t *scheduled_communication_type_rm);
+bool OpenAPI_scheduled_communication_type_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scheduled_communication_type_rm_t *scheduled_communication_type_rm);
 OpenAPI_scheduled_communication_type_rm_t *OpenAPI_scheduled_communication_type_rm_copy(OpenAPI_scheduled_communication_type_rm_t *dst, OpenAPI_scheduled_communication_type_rm_t *src);
 
 #ifdef __cplusplus
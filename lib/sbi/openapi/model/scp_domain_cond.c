@@ -59,6 +59,47 @@ end:
     return item;
 }
 
+bool OpenAPI_scp_domain_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scp_domain_cond_t *scp_domain_cond)
+{
+    if (scp_domain_cond == NULL) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [ScpDomainCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [ScpDomainCond]");
+        return false;
+    }
+    if (scp_domain_cond->scp_domains) {
+    if (OpenAPI_json_write_array_start(writer, "scpDomains") == false) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *scp_domains_node;
+    OpenAPI_list_for_each(scp_domain_cond->scp_domains, scp_domains_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)scp_domains_node->data) == false) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [scp_domains]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_domain_cond_writeJSON() failed [ScpDomainCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_scp_domain_cond_t *OpenAPI_scp_domain_cond_parseFromJSON(cJSON *scp_domain_condJSON)
 {
     OpenAPI_scp_domain_cond_t *scp_domain_cond_local_var = NULL;
@@ -94,7 +135,6 @@ end:
 OpenAPI_scp_domain_cond_t *OpenAPI_scp_domain_cond_copy(OpenAPI_scp_domain_cond_t *dst, OpenAPI_scp_domain_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scp_domain_cond_convertToJSON(src);
@@ -103,21 +143,6 @@ OpenAPI_scp_domain_cond_t *OpenAPI_scp_domain_cond_copy(OpenAPI_scp_domain_cond_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scp_domain_cond_free(dst);
     dst = OpenAPI_scp_domain_cond_parseFromJSON(item);
     cJSON_Delete(item);
@@ -107,6 +107,80 @@ end:
     return item;
 }
 
+bool OpenAPI_scp_domain_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scp_domain_info_t *scp_domain_info)
+{
+    if (scp_domain_info == NULL) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [ScpDomainInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [ScpDomainInfo]");
+        return false;
+    }
+    if (scp_domain_info->scp_fqdn) {
+    if (OpenAPI_json_write_string(writer, "scpFqdn", scp_domain_info->scp_fqdn) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_fqdn]");
+        goto end;
+    }
+    }
+
+    if (scp_domain_info->scp_ip_end_points) {
+    if (OpenAPI_json_write_array_start(writer, "scpIpEndPoints") == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_ip_end_points]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *scp_ip_end_points_node;
+    if (scp_domain_info->scp_ip_end_points) {
+        OpenAPI_list_for_each(scp_domain_info->scp_ip_end_points, scp_ip_end_points_node) {
+            if (OpenAPI_ip_end_point_writeJSON(writer, NULL, scp_ip_end_points_node->data) == false) {
+                ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_ip_end_points]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_ip_end_points]");
+        goto end;
+    }
+    }
+
+    if (scp_domain_info->scp_prefix) {
+    if (OpenAPI_json_write_string(writer, "scpPrefix", scp_domain_info->scp_prefix) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_prefix]");
+        goto end;
+    }
+    }
+
+    if (scp_domain_info->scp_ports) {
+    if (OpenAPI_json_write_object_start(writer, "scpPorts") == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_ports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *scp_ports_node;
+    if (scp_domain_info->scp_ports) {
+        OpenAPI_list_for_each(scp_domain_info->scp_ports, scp_ports_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)scp_ports_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [scp_ports]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_domain_info_writeJSON() failed [ScpDomainInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_parseFromJSON(cJSON *scp_domain_infoJSON)
 {
     OpenAPI_scp_domain_info_t *scp_domain_info_local_var = NULL;
@@ -189,7 +263,6 @@ end:
 OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_copy(OpenAPI_scp_domain_info_t *dst, OpenAPI_scp_domain_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scp_domain_info_convertToJSON(src);
@@ -198,21 +271,6 @@ OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_copy(OpenAPI_scp_domain_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scp_domain_info_free(dst);
     dst = OpenAPI_scp_domain_info_parseFromJSON(item);
     cJSON_Delete(item);
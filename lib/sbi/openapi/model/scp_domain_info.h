@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_end_point.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_create(
 void OpenAPI_scp_domain_info_free(OpenAPI_scp_domain_info_t *scp_domain_info);
 OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_parseFromJSON(cJSON *scp_domain_infoJSON);
 cJSON *OpenAPI_scp_domain_info_convertToJSON(OpenAPI_scp_domain_info_t *scp_domain_info);
+bool OpenAPI_scp_domain_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scp_domain_info_t *scp_domain_info);
 OpenAPI_scp_domain_info_t *OpenAPI_scp_domain_info_copy(OpenAPI_scp_domain_info_t *dst, OpenAPI_scp_domain_info_t *src);
 
 #ifdef __cplusplus
@@ -270,6 +270,215 @@ end:
     return item;
 }
 
+bool OpenAPI_scp_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scp_info_t *scp_info)
+{
+    if (scp_info == NULL) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ScpInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ScpInfo]");
+        return false;
+    }
+    if (scp_info->scp_domain_info_list) {
+    if (OpenAPI_json_write_object_start(writer, "scpDomainInfoList") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [scp_domain_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *scp_domain_info_list_node;
+    if (scp_info->scp_domain_info_list) {
+        OpenAPI_list_for_each(scp_info->scp_domain_info_list, scp_domain_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)scp_domain_info_list_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [scp_domain_info_list]");
+        goto end;
+    }
+    }
+
+    if (scp_info->scp_prefix) {
+    if (OpenAPI_json_write_string(writer, "scpPrefix", scp_info->scp_prefix) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [scp_prefix]");
+        goto end;
+    }
+    }
+
+    if (scp_info->scp_ports) {
+    if (OpenAPI_json_write_object_start(writer, "scpPorts") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [scp_ports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *scp_ports_node;
+    if (scp_info->scp_ports) {
+        OpenAPI_list_for_each(scp_info->scp_ports, scp_ports_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)scp_ports_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [scp_ports]");
+        goto end;
+    }
+    }
+
+    if (scp_info->address_domains) {
+    if (OpenAPI_json_write_array_start(writer, "addressDomains") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [address_domains]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *address_domains_node;
+    OpenAPI_list_for_each(scp_info->address_domains, address_domains_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)address_domains_node->data) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [address_domains]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [address_domains]");
+        goto end;
+    }
+    }
+
+    if (scp_info->ipv4_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4Addresses") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_addresses_node;
+    OpenAPI_list_for_each(scp_info->ipv4_addresses, ipv4_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_addresses_node->data) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addresses]");
+        goto end;
+    }
+    }
+
+    if (scp_info->ipv6_prefixes) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6Prefixes") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefixes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_prefixes_node;
+    OpenAPI_list_for_each(scp_info->ipv6_prefixes, ipv6_prefixes_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_prefixes_node->data) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefixes]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefixes]");
+        goto end;
+    }
+    }
+
+    if (scp_info->ipv4_addr_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4AddrRanges") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addr_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_addr_ranges_node;
+    if (scp_info->ipv4_addr_ranges) {
+        OpenAPI_list_for_each(scp_info->ipv4_addr_ranges, ipv4_addr_ranges_node) {
+            if (OpenAPI_ipv4_address_range_writeJSON(writer, NULL, ipv4_addr_ranges_node->data) == false) {
+                ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addr_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv4_addr_ranges]");
+        goto end;
+    }
+    }
+
+    if (scp_info->ipv6_prefix_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6PrefixRanges") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_prefix_ranges_node;
+    if (scp_info->ipv6_prefix_ranges) {
+        OpenAPI_list_for_each(scp_info->ipv6_prefix_ranges, ipv6_prefix_ranges_node) {
+            if (OpenAPI_ipv6_prefix_range_writeJSON(writer, NULL, ipv6_prefix_ranges_node->data) == false) {
+                ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefix_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ipv6_prefix_ranges]");
+        goto end;
+    }
+    }
+
+    if (scp_info->served_nf_set_id_list) {
+    if (OpenAPI_json_write_array_start(writer, "servedNfSetIdList") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [served_nf_set_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *served_nf_set_id_list_node;
+    OpenAPI_list_for_each(scp_info->served_nf_set_id_list, served_nf_set_id_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)served_nf_set_id_list_node->data) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [served_nf_set_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [served_nf_set_id_list]");
+        goto end;
+    }
+    }
+
+    if (scp_info->remote_plmn_list) {
+    if (OpenAPI_json_write_array_start(writer, "remotePlmnList") == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [remote_plmn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *remote_plmn_list_node;
+    if (scp_info->remote_plmn_list) {
+        OpenAPI_list_for_each(scp_info->remote_plmn_list, remote_plmn_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, remote_plmn_list_node->data) == false) {
+                ogs_error("OpenAPI_scp_info_writeJSON() failed [remote_plmn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [remote_plmn_list]");
+        goto end;
+    }
+    }
+
+    if (scp_info->ip_reachability) {
+    if (OpenAPI_json_write_string(writer, "ipReachability", OpenAPI_ip_reachability_ToString(scp_info->ip_reachability)) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ip_reachability]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_scp_info_writeJSON() failed [ScpInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_scp_info_t *OpenAPI_scp_info_parseFromJSON(cJSON *scp_infoJSON)
 {
     OpenAPI_scp_info_t *scp_info_local_var = NULL;
@@ -516,7 +725,6 @@ end:
 OpenAPI_scp_info_t *OpenAPI_scp_info_copy(OpenAPI_scp_info_t *dst, OpenAPI_scp_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_scp_info_convertToJSON(src);
@@ -525,21 +733,6 @@ OpenAPI_scp_info_t *OpenAPI_scp_info_copy(OpenAPI_scp_info_t *dst, OpenAPI_scp_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_scp_info_free(dst);
     dst = OpenAPI_scp_info_parseFromJSON(item);
     cJSON_Delete(item);
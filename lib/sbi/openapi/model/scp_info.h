@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ip_reachability.h"
 #include "ipv4_address_range.h"
 #include "ipv6_prefix_range.h"
@@ -53,6 +54,7 @@ OpenAPI_scp_info_t *OpenAPI_scp_info_create(
 void OpenAPI_scp_info_free(OpenAPI_scp_info_t *scp_info);
 OpenAPI_scp_info_t *OpenAPI_scp_info_parseFromJSON(cJSON *scp_infoJSON);
 cJSON *OpenAPI_scp_info_convertToJSON(OpenAPI_scp_info_t *scp_info);
+bool OpenAPI_scp_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_scp_info_t *scp_info);
 OpenAPI_scp_info_t *OpenAPI_scp_info_copy(OpenAPI_scp_info_t *dst, OpenAPI_scp_info_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_sd_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sd_range_t *sd_range)
+{
+    if (sd_range == NULL) {
+        ogs_error("OpenAPI_sd_range_writeJSON() failed [SdRange]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sd_range_writeJSON() failed [SdRange]");
+        return false;
+    }
+    if (sd_range->start) {
+    if (OpenAPI_json_write_string(writer, "start", sd_range->start) == false) {
+        ogs_error("OpenAPI_sd_range_writeJSON() failed [start]");
+        goto end;
+    }
+    }
+
+    if (sd_range->end) {
+    if (OpenAPI_json_write_string(writer, "end", sd_range->end) == false) {
+        ogs_error("OpenAPI_sd_range_writeJSON() failed [end]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sd_range_writeJSON() failed [SdRange]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sd_range_t *OpenAPI_sd_range_parseFromJSON(cJSON *sd_rangeJSON)
 {
     OpenAPI_sd_range_t *sd_range_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_sd_range_t *OpenAPI_sd_range_copy(OpenAPI_sd_range_t *dst, OpenAPI_sd_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sd_range_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_sd_range_t *OpenAPI_sd_range_copy(OpenAPI_sd_range_t *dst, OpenAPI_sd_ra
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sd_range_free(dst);
     dst = OpenAPI_sd_range_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_sd_range_t *OpenAPI_sd_range_create(
 void OpenAPI_sd_range_free(OpenAPI_sd_range_t *sd_range);
 OpenAPI_sd_range_t *OpenAPI_sd_range_parseFromJSON(cJSON *sd_rangeJSON);
 cJSON *OpenAPI_sd_range_convertToJSON(OpenAPI_sd_range_t *sd_range);
+bool OpenAPI_sd_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sd_range_t *sd_range);
 OpenAPI_sd_range_t *OpenAPI_sd_range_copy(OpenAPI_sd_range_t *dst, OpenAPI_sd_range_t *src);
 
 #ifdef __cplusplus
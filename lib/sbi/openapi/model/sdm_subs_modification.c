@@ -69,6 +69,54 @@ end:
     return item;
 }
 
+bool OpenAPI_sdm_subs_modification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sdm_subs_modification_t *sdm_subs_modification)
+{
+    if (sdm_subs_modification == NULL) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [SdmSubsModification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [SdmSubsModification]");
+        return false;
+    }
+    if (sdm_subs_modification->expires) {
+    if (OpenAPI_json_write_string(writer, "expires", sdm_subs_modification->expires) == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [expires]");
+        goto end;
+    }
+    }
+
+    if (sdm_subs_modification->monitored_resource_uris) {
+    if (OpenAPI_json_write_array_start(writer, "monitoredResourceUris") == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_resource_uris_node;
+    OpenAPI_list_for_each(sdm_subs_modification->monitored_resource_uris, monitored_resource_uris_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_resource_uris_node->data) == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sdm_subs_modification_writeJSON() failed [SdmSubsModification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sdm_subs_modification_t *OpenAPI_sdm_subs_modification_parseFromJSON(cJSON *sdm_subs_modificationJSON)
 {
     OpenAPI_sdm_subs_modification_t *sdm_subs_modification_local_var = NULL;
@@ -114,7 +162,6 @@ end:
 OpenAPI_sdm_subs_modification_t *OpenAPI_sdm_subs_modification_copy(OpenAPI_sdm_subs_modification_t *dst, OpenAPI_sdm_subs_modification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sdm_subs_modification_convertToJSON(src);
@@ -123,21 +170,6 @@ OpenAPI_sdm_subs_modification_t *OpenAPI_sdm_subs_modification_copy(OpenAPI_sdm_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sdm_subs_modification_free(dst);
     dst = OpenAPI_sdm_subs_modification_parseFromJSON(item);
     cJSON_Delete(item);
@@ -209,6 +209,132 @@ end:
     return item;
 }
 
+bool OpenAPI_sdm_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sdm_subscription_t *sdm_subscription)
+{
+    if (sdm_subscription == NULL) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [SdmSubscription]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [SdmSubscription]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfInstanceId", sdm_subscription->nf_instance_id) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [nf_instance_id]");
+        goto end;
+    }
+
+    if (sdm_subscription->is_implicit_unsubscribe) {
+    if (OpenAPI_json_write_bool(writer, "implicitUnsubscribe", sdm_subscription->implicit_unsubscribe) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [implicit_unsubscribe]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->expires) {
+    if (OpenAPI_json_write_string(writer, "expires", sdm_subscription->expires) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [expires]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "callbackReference", sdm_subscription->callback_reference) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [callback_reference]");
+        goto end;
+    }
+
+    if (sdm_subscription->amf_service_name) {
+    if (OpenAPI_json_write_string(writer, "amfServiceName", sdm_subscription->amf_service_name) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [amf_service_name]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "monitoredResourceUris") == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_resource_uris_node;
+    OpenAPI_list_for_each(sdm_subscription->monitored_resource_uris, monitored_resource_uris_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_resource_uris_node->data) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    if (sdm_subscription->single_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", sdm_subscription->single_nssai) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", sdm_subscription->dnn) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->subscription_id) {
+    if (OpenAPI_json_write_string(writer, "subscriptionId", sdm_subscription->subscription_id) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", sdm_subscription->plmn_id) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->is_immediate_report) {
+    if (OpenAPI_json_write_bool(writer, "immediateReport", sdm_subscription->immediate_report) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [immediate_report]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->report) {
+    if (OpenAPI_subscription_data_sets_writeJSON(writer, "report", sdm_subscription->report) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [report]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sdm_subscription->supported_features) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sdm_subscription->context_info) {
+    if (OpenAPI_context_info_writeJSON(writer, "contextInfo", sdm_subscription->context_info) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [context_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sdm_subscription_writeJSON() failed [SdmSubscription]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_parseFromJSON(cJSON *sdm_subscriptionJSON)
 {
     OpenAPI_sdm_subscription_t *sdm_subscription_local_var = NULL;
@@ -374,7 +500,6 @@ end:
 OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_copy(OpenAPI_sdm_subscription_t *dst, OpenAPI_sdm_subscription_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sdm_subscription_convertToJSON(src);
@@ -383,21 +508,6 @@ OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_copy(OpenAPI_sdm_subscripti
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sdm_subscription_free(dst);
     dst = OpenAPI_sdm_subscription_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "context_info.h"
 #include "plmn_id.h"
 #include "snssai.h"
@@ -62,6 +63,7 @@ OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_create(
 void OpenAPI_sdm_subscription_free(OpenAPI_sdm_subscription_t *sdm_subscription);
 OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_parseFromJSON(cJSON *sdm_subscriptionJSON);
 cJSON *OpenAPI_sdm_subscription_convertToJSON(OpenAPI_sdm_subscription_t *sdm_subscription);
+bool OpenAPI_sdm_subscription_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sdm_subscription_t *sdm_subscription);
 OpenAPI_sdm_subscription_t *OpenAPI_sdm_subscription_copy(OpenAPI_sdm_subscription_t *dst, OpenAPI_sdm_subscription_t *src);
 
 #ifdef __cplusplus
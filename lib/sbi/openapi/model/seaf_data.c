@@ -108,6 +108,66 @@ end:
     return item;
 }
 
+bool OpenAPI_seaf_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_seaf_data_t *seaf_data)
+{
+    if (seaf_data == NULL) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [SeafData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [SeafData]");
+        return false;
+    }
+    if (OpenAPI_ng_ksi_writeJSON(writer, "ngKsi", seaf_data->ng_ksi) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [ng_ksi]");
+        goto end;
+    }
+
+    if (OpenAPI_key_amf_writeJSON(writer, "keyAmf", seaf_data->key_amf) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [key_amf]");
+        goto end;
+    }
+
+    if (seaf_data->nh) {
+    if (OpenAPI_json_write_string(writer, "nh", seaf_data->nh) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [nh]");
+        goto end;
+    }
+    }
+
+    if (seaf_data->is_ncc) {
+    if (OpenAPI_json_write_number(writer, "ncc", seaf_data->ncc) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [ncc]");
+        goto end;
+    }
+    }
+
+    if (seaf_data->is_key_amf_change_ind) {
+    if (OpenAPI_json_write_bool(writer, "keyAmfChangeInd", seaf_data->key_amf_change_ind) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [key_amf_change_ind]");
+        goto end;
+    }
+    }
+
+    if (seaf_data->is_key_amf_h_derivation_ind) {
+    if (OpenAPI_json_write_bool(writer, "keyAmfHDerivationInd", seaf_data->key_amf_h_derivation_ind) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [key_amf_h_derivation_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_seaf_data_writeJSON() failed [SeafData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_seaf_data_t *OpenAPI_seaf_data_parseFromJSON(cJSON *seaf_dataJSON)
 {
     OpenAPI_seaf_data_t *seaf_data_local_var = NULL;
@@ -185,7 +245,6 @@ end:
 OpenAPI_seaf_data_t *OpenAPI_seaf_data_copy(OpenAPI_seaf_data_t *dst, OpenAPI_seaf_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_seaf_data_convertToJSON(src);
@@ -194,21 +253,6 @@ OpenAPI_seaf_data_t *OpenAPI_seaf_data_copy(OpenAPI_seaf_data_t *dst, OpenAPI_se
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_seaf_data_free(dst);
     dst = OpenAPI_seaf_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "key_amf.h"
 #include "ng_ksi.h"
 
@@ -46,6 +47,7 @@ OpenAPI_seaf_data_t *OpenAPI_seaf_data_create(
 void OpenAPI_seaf_data_free(OpenAPI_seaf_data_t *seaf_data);
 OpenAPI_seaf_data_t *OpenAPI_seaf_data_parseFromJSON(cJSON *seaf_dataJSON);
 cJSON *OpenAPI_seaf_data_convertToJSON(OpenAPI_seaf_data_t *seaf_data);
+bool OpenAPI_seaf_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_seaf_data_t *seaf_data);
 OpenAPI_seaf_data_t *OpenAPI_seaf_data_copy(OpenAPI_seaf_data_t *dst, OpenAPI_seaf_data_t *src);
 
 #ifdef __cplusplus
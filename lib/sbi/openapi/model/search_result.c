@@ -119,6 +119,82 @@ end:
     return item;
 }
 
+bool OpenAPI_search_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_search_result_t *search_result)
+{
+    if (search_result == NULL) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [SearchResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [SearchResult]");
+        return false;
+    }
+    if (search_result->is_validity_period) {
+    if (OpenAPI_json_write_number(writer, "validityPeriod", search_result->validity_period) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [validity_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "nfInstances") == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [nf_instances]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_instances_node;
+    if (search_result->nf_instances) {
+        OpenAPI_list_for_each(search_result->nf_instances, nf_instances_node) {
+            if (OpenAPI_nf_profile_writeJSON(writer, NULL, nf_instances_node->data) == false) {
+                ogs_error("OpenAPI_search_result_writeJSON() failed [nf_instances]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [nf_instances]");
+        goto end;
+    }
+
+    if (search_result->search_id) {
+    if (OpenAPI_json_write_string(writer, "searchId", search_result->search_id) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [search_id]");
+        goto end;
+    }
+    }
+
+    if (search_result->is_num_nf_inst_complete) {
+    if (OpenAPI_json_write_number(writer, "numNfInstComplete", search_result->num_nf_inst_complete) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [num_nf_inst_complete]");
+        goto end;
+    }
+    }
+
+    if (search_result->preferred_search) {
+    if (OpenAPI_preferred_search_writeJSON(writer, "preferredSearch", search_result->preferred_search) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [preferred_search]");
+        goto end;
+    }
+    }
+
+    if (search_result->nrf_supported_features) {
+    if (OpenAPI_json_write_string(writer, "nrfSupportedFeatures", search_result->nrf_supported_features) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [nrf_supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_search_result_writeJSON() failed [SearchResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_search_result_t *OpenAPI_search_result_parseFromJSON(cJSON *search_resultJSON)
 {
     OpenAPI_search_result_t *search_result_local_var = NULL;
@@ -215,7 +291,6 @@ end:
 OpenAPI_search_result_t *OpenAPI_search_result_copy(OpenAPI_search_result_t *dst, OpenAPI_search_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_search_result_convertToJSON(src);
@@ -224,21 +299,6 @@ OpenAPI_search_result_t *OpenAPI_search_result_copy(OpenAPI_search_result_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_search_result_free(dst);
     dst = OpenAPI_search_result_parseFromJSON(item);
     cJSON_Delete(item);
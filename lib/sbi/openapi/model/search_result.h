@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_profile.h"
 #include "preferred_search.h"
 
@@ -44,6 +45,7 @@ OpenAPI_search_result_t *OpenAPI_search_result_create(
 void OpenAPI_search_result_free(OpenAPI_search_result_t *search_result);
 OpenAPI_search_result_t *OpenAPI_search_result_parseFromJSON(cJSON *search_resultJSON);
 cJSON *OpenAPI_search_result_convertToJSON(OpenAPI_search_result_t *search_result);
+bool OpenAPI_search_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_search_result_t *search_result);
 OpenAPI_search_result_t *OpenAPI_search_result_copy(OpenAPI_search_result_t *dst, OpenAPI_search_result_t *src);
 
 #ifdef __cplusplus
@@ -68,6 +68,52 @@ end:
     return item;
 }
 
+bool OpenAPI_secondary_rat_usage_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_secondary_rat_usage_report_t *secondary_rat_usage_report)
+{
+    if (secondary_rat_usage_report == NULL) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [SecondaryRatUsageReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [SecondaryRatUsageReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "secondaryRatType", OpenAPI_rat_type_ToString(secondary_rat_usage_report->secondary_rat_type)) == false) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [secondary_rat_type]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsUsageData") == false) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [qos_flows_usage_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_usage_data_node;
+    if (secondary_rat_usage_report->qos_flows_usage_data) {
+        OpenAPI_list_for_each(secondary_rat_usage_report->qos_flows_usage_data, qos_flows_usage_data_node) {
+            if (OpenAPI_qos_flow_usage_report_writeJSON(writer, NULL, qos_flows_usage_data_node->data) == false) {
+                ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [qos_flows_usage_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [qos_flows_usage_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_secondary_rat_usage_report_writeJSON() failed [SecondaryRatUsageReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_parseFromJSON(cJSON *secondary_rat_usage_reportJSON)
 {
     OpenAPI_secondary_rat_usage_report_t *secondary_rat_usage_report_local_var = NULL;
@@ -128,7 +174,6 @@ end:
 OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_copy(OpenAPI_secondary_rat_usage_report_t *dst, OpenAPI_secondary_rat_usage_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_secondary_rat_usage_report_convertToJSON(src);
@@ -137,21 +182,6 @@ OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_secondary_rat_usage_report_free(dst);
     dst = OpenAPI_secondary_rat_usage_report_parseFromJSON(item);
     cJSON_Delete(item);
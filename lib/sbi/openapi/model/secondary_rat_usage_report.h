@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "qos_flow_usage_report.h"
 #include "rat_type.h"
 
@@ -32,6 +33,7 @@ OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_create(
 void OpenAPI_secondary_rat_usage_report_free(OpenAPI_secondary_rat_usage_report_t *secondary_rat_usage_report);
 OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_parseFromJSON(cJSON *secondary_rat_usage_reportJSON);
 cJSON *OpenAPI_secondary_rat_usage_report_convertToJSON(OpenAPI_secondary_rat_usage_report_t *secondary_rat_usage_report);
+bool OpenAPI_secondary_rat_usage_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_secondary_rat_usage_report_t *secondary_rat_usage_report);
 OpenAPI_secondary_rat_usage_report_t *OpenAPI_secondary_rat_usage_report_copy(OpenAPI_secondary_rat_usage_report_t *dst, OpenAPI_secondary_rat_usage_report_t *src);
 
 #ifdef __cplusplus
@@ -55,6 +55,42 @@ end:
     return item;
 }
 
+bool OpenAPI_security_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_security_result_t *security_result)
+{
+    if (security_result == NULL) {
+        ogs_error("OpenAPI_security_result_writeJSON() failed [SecurityResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_security_result_writeJSON() failed [SecurityResult]");
+        return false;
+    }
+    if (security_result->integrity_protection_result) {
+    if (OpenAPI_json_write_string(writer, "integrityProtectionResult", OpenAPI_protection_result_ToString(security_result->integrity_protection_result)) == false) {
+        ogs_error("OpenAPI_security_result_writeJSON() failed [integrity_protection_result]");
+        goto end;
+    }
+    }
+
+    if (security_result->confidentiality_protection_result) {
+    if (OpenAPI_json_write_string(writer, "confidentialityProtectionResult", OpenAPI_protection_result_ToString(security_result->confidentiality_protection_result)) == false) {
+        ogs_error("OpenAPI_security_result_writeJSON() failed [confidentiality_protection_result]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_security_result_writeJSON() failed [SecurityResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_security_result_t *OpenAPI_security_result_parseFromJSON(cJSON *security_resultJSON)
 {
     OpenAPI_security_result_t *security_result_local_var = NULL;
@@ -93,7 +129,6 @@ end:
 OpenAPI_security_result_t *OpenAPI_security_result_copy(OpenAPI_security_result_t *dst, OpenAPI_security_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_security_result_convertToJSON(src);
@@ -102,21 +137,6 @@ OpenAPI_security_result_t *OpenAPI_security_result_copy(OpenAPI_security_result_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_security_result_free(dst);
     dst = OpenAPI_security_result_parseFromJSON(item);
     cJSON_Delete(item);
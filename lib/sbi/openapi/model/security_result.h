@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "protection_result.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_security_result_t *OpenAPI_security_result_create(
 void OpenAPI_security_result_free(OpenAPI_security_result_t *security_result);
 OpenAPI_security_result_t *OpenAPI_security_result_parseFromJSON(cJSON *security_resultJSON);
 cJSON *OpenAPI_security_result_convertToJSON(OpenAPI_security_result_t *security_result);
+bool OpenAPI_security_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_security_result_t *security_result);
 OpenAPI_security_result_t *OpenAPI_security_result_copy(OpenAPI_security_result_t *dst, OpenAPI_security_result_t *src);
 
 #ifdef __cplusplus
@@ -83,6 +83,47 @@ end:
     return item;
 }
 
+bool OpenAPI_send_mo_data_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_send_mo_data_req_data_t *send_mo_data_req_data)
+{
+    if (send_mo_data_req_data == NULL) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [SendMoDataReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [SendMoDataReqData]");
+        return false;
+    }
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "moData", send_mo_data_req_data->mo_data) == false) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [mo_data]");
+        goto end;
+    }
+
+    if (send_mo_data_req_data->mo_exp_data_counter) {
+    if (OpenAPI_mo_exp_data_counter_writeJSON(writer, "moExpDataCounter", send_mo_data_req_data->mo_exp_data_counter) == false) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [mo_exp_data_counter]");
+        goto end;
+    }
+    }
+
+    if (send_mo_data_req_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", send_mo_data_req_data->ue_location) == false) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_send_mo_data_req_data_writeJSON() failed [SendMoDataReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_parseFromJSON(cJSON *send_mo_data_req_dataJSON)
 {
     OpenAPI_send_mo_data_req_data_t *send_mo_data_req_data_local_var = NULL;
@@ -123,7 +164,6 @@ end:
 OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_copy(OpenAPI_send_mo_data_req_data_t *dst, OpenAPI_send_mo_data_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_send_mo_data_req_data_convertToJSON(src);
@@ -132,21 +172,6 @@ OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_copy(OpenAPI_send
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_send_mo_data_req_data_free(dst);
     dst = OpenAPI_send_mo_data_req_data_parseFromJSON(item);
     cJSON_Delete(item);
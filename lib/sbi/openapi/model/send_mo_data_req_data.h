@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "mo_exp_data_counter.h"
 #include "ref_to_binary_data.h"
 #include "user_location.h"
@@ -35,6 +36,7 @@ OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_create(
 void OpenAPI_send_mo_data_req_data_free(OpenAPI_send_mo_data_req_data_t *send_mo_data_req_data);
 OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_parseFromJSON(cJSON *send_mo_data_req_dataJSON);
 cJSON *OpenAPI_send_mo_data_req_data_convertToJSON(OpenAPI_send_mo_data_req_data_t *send_mo_data_req_data);
+bool OpenAPI_send_mo_data_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_send_mo_data_req_data_t *send_mo_data_req_data);
 OpenAPI_send_mo_data_req_data_t *OpenAPI_send_mo_data_req_data_copy(OpenAPI_send_mo_data_req_data_t *dst, OpenAPI_send_mo_data_req_data_t *src);
 
 #ifdef __cplusplus
@@ -100,6 +100,73 @@ end:
     return item;
 }
 
+bool OpenAPI_sequence_number_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sequence_number_t *sequence_number)
+{
+    if (sequence_number == NULL) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [SequenceNumber]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [SequenceNumber]");
+        return false;
+    }
+    if (sequence_number->sqn_scheme) {
+    if (OpenAPI_json_write_string(writer, "sqnScheme", OpenAPI_sqn_scheme_ToString(sequence_number->sqn_scheme)) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [sqn_scheme]");
+        goto end;
+    }
+    }
+
+    if (sequence_number->sqn) {
+    if (OpenAPI_json_write_string(writer, "sqn", sequence_number->sqn) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [sqn]");
+        goto end;
+    }
+    }
+
+    if (sequence_number->last_indexes) {
+    if (OpenAPI_json_write_object_start(writer, "lastIndexes") == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [last_indexes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *last_indexes_node;
+    if (sequence_number->last_indexes) {
+        OpenAPI_list_for_each(sequence_number->last_indexes, last_indexes_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)last_indexes_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [last_indexes]");
+        goto end;
+    }
+    }
+
+    if (sequence_number->is_ind_length) {
+    if (OpenAPI_json_write_number(writer, "indLength", sequence_number->ind_length) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [ind_length]");
+        goto end;
+    }
+    }
+
+    if (sequence_number->dif_sign) {
+    if (OpenAPI_json_write_string(writer, "difSign", OpenAPI_sign_ToString(sequence_number->dif_sign)) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [dif_sign]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sequence_number_writeJSON() failed [SequenceNumber]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sequence_number_t *OpenAPI_sequence_number_parseFromJSON(cJSON *sequence_numberJSON)
 {
     OpenAPI_sequence_number_t *sequence_number_local_var = NULL;
@@ -177,7 +244,6 @@ end:
 OpenAPI_sequence_number_t *OpenAPI_sequence_number_copy(OpenAPI_sequence_number_t *dst, OpenAPI_sequence_number_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sequence_number_convertToJSON(src);
@@ -186,21 +252,6 @@ OpenAPI_sequence_number_t *OpenAPI_sequence_number_copy(OpenAPI_sequence_number_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sequence_number_free(dst);
     dst = OpenAPI_sequence_number_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sign.h"
 #include "sqn_scheme.h"
 
@@ -40,6 +41,7 @@ OpenAPI_sequence_number_t *OpenAPI_sequence_number_create(
 void OpenAPI_sequence_number_free(OpenAPI_sequence_number_t *sequence_number);
 OpenAPI_sequence_number_t *OpenAPI_sequence_number_parseFromJSON(cJSON *sequence_numberJSON);
 cJSON *OpenAPI_sequence_number_convertToJSON(OpenAPI_sequence_number_t *sequence_number);
+bool OpenAPI_sequence_number_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sequence_number_t *sequence_number);
 OpenAPI_sequence_number_t *OpenAPI_sequence_number_copy(OpenAPI_sequence_number_t *dst, OpenAPI_sequence_number_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "area.h"
 #include "restriction_type.h"
 
@@ -40,6 +41,7 @@ OpenAPI_service_area_restriction_t *OpenAPI_service_area_restriction_create(
 void OpenAPI_service_area_restriction_free(OpenAPI_service_area_restriction_t *service_area_restriction);
 OpenAPI_service_area_restriction_t *OpenAPI_service_area_restriction_parseFromJSON(cJSON *service_area_restrictionJSON);
 cJSON *OpenAPI_service_area_restriction_convertToJSON(OpenAPI_service_area_restriction_t *service_area_restriction);
+bool OpenAPI_service_area_restriction_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_area_restriction_t *service_area_restriction);
 OpenAPI_service_area_restriction_t *OpenAPI_service_area_restriction_copy(OpenAPI_service_area_restriction_t *dst, OpenAPI_service_area_restriction_t *src);
 
 #ifdef __cplusplus
@@ -94,6 +94,70 @@ end:
     return item;
 }
 
+bool OpenAPI_service_area_restriction_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_area_restriction_1_t *service_area_restriction_1)
+{
+    if (service_area_restriction_1 == NULL) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [ServiceAreaRestriction_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [ServiceAreaRestriction_1]");
+        return false;
+    }
+    if (service_area_restriction_1->restriction_type) {
+    if (OpenAPI_json_write_string(writer, "restrictionType", OpenAPI_restriction_type_ToString(service_area_restriction_1->restriction_type)) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [restriction_type]");
+        goto end;
+    }
+    }
+
+    if (service_area_restriction_1->areas) {
+    if (OpenAPI_json_write_array_start(writer, "areas") == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [areas]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *areas_node;
+    if (service_area_restriction_1->areas) {
+        OpenAPI_list_for_each(service_area_restriction_1->areas, areas_node) {
+            if (OpenAPI_area_1_writeJSON(writer, NULL, areas_node->data) == false) {
+                ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [areas]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [areas]");
+        goto end;
+    }
+    }
+
+    if (service_area_restriction_1->is_max_num_of_tas) {
+    if (OpenAPI_json_write_number(writer, "maxNumOfTAs", service_area_restriction_1->max_num_of_tas) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [max_num_of_tas]");
+        goto end;
+    }
+    }
+
+    if (service_area_restriction_1->is_max_num_of_tas_for_not_allowed_areas) {
+    if (OpenAPI_json_write_number(writer, "maxNumOfTAsForNotAllowedAreas", service_area_restriction_1->max_num_of_tas_for_not_allowed_areas) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [max_num_of_tas_for_not_allowed_areas]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_service_area_restriction_1_writeJSON() failed [ServiceAreaRestriction_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_parseFromJSON(cJSON *service_area_restriction_1JSON)
 {
     OpenAPI_service_area_restriction_1_t *service_area_restriction_1_local_var = NULL;
@@ -172,7 +236,6 @@ end:
 OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_copy(OpenAPI_service_area_restriction_1_t *dst, OpenAPI_service_area_restriction_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_area_restriction_1_convertToJSON(src);
@@ -181,21 +244,6 @@ OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_area_restriction_1_free(dst);
     dst = OpenAPI_service_area_restriction_1_parseFromJSON(item);
     cJSON_Delete(item);
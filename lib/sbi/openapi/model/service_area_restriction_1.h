@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "area_1.h"
 #include "restriction_type.h"
 
@@ -40,6 +41,7 @@ OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_create(
 void OpenAPI_service_area_restriction_1_free(OpenAPI_service_area_restriction_1_t *service_area_restriction_1);
 OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_parseFromJSON(cJSON *service_area_restriction_1JSON);
 cJSON *OpenAPI_service_area_restriction_1_convertToJSON(OpenAPI_service_area_restriction_1_t *service_area_restriction_1);
+bool OpenAPI_service_area_restriction_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_area_restriction_1_t *service_area_restriction_1);
 OpenAPI_service_area_restriction_1_t *OpenAPI_service_area_restriction_1_copy(OpenAPI_service_area_restriction_1_t *dst, OpenAPI_service_area_restriction_1_t *src);
 
 #ifdef __cplusplus
@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_service_name_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_name_cond_t *service_name_cond)
+{
+    if (service_name_cond == NULL) {
+        ogs_error("OpenAPI_service_name_cond_writeJSON() failed [ServiceNameCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_service_name_cond_writeJSON() failed [ServiceNameCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "serviceName", service_name_cond->service_name) == false) {
+        ogs_error("OpenAPI_service_name_cond_writeJSON() failed [service_name]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_service_name_cond_writeJSON() failed [ServiceNameCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_parseFromJSON(cJSON *service_name_condJSON)
 {
     OpenAPI_service_name_cond_t *service_name_cond_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_copy(OpenAPI_service_name_cond_t *dst, OpenAPI_service_name_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_name_cond_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_copy(OpenAPI_service_name
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_name_cond_free(dst);
     dst = OpenAPI_service_name_cond_parseFromJSON(item);
     cJSON_Delete(item);
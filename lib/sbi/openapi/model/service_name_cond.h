@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_create(
 void OpenAPI_service_name_cond_free(OpenAPI_service_name_cond_t *service_name_cond);
 OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_parseFromJSON(cJSON *service_name_condJSON);
 cJSON *OpenAPI_service_name_cond_convertToJSON(OpenAPI_service_name_cond_t *service_name_cond);
+bool OpenAPI_service_name_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_name_cond_t *service_name_cond);
 OpenAPI_service_name_cond_t *OpenAPI_service_name_cond_copy(OpenAPI_service_name_cond_t *dst, OpenAPI_service_name_cond_t *src);
 
 #ifdef __cplusplus
@@ -174,6 +174,119 @@ end:
     return item;
 }
 
+bool OpenAPI_service_parameter_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_parameter_data_t *service_parameter_data)
+{
+    if (service_parameter_data == NULL) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ServiceParameterData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ServiceParameterData]");
+        return false;
+    }
+    if (service_parameter_data->app_id) {
+    if (OpenAPI_json_write_string(writer, "appId", service_parameter_data->app_id) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [app_id]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", service_parameter_data->dnn) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", service_parameter_data->snssai) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->inter_group_id) {
+    if (OpenAPI_json_write_string(writer, "interGroupId", service_parameter_data->inter_group_id) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [inter_group_id]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", service_parameter_data->supi) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->ue_ipv4) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4", service_parameter_data->ue_ipv4) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ue_ipv4]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->ue_ipv6) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6", service_parameter_data->ue_ipv6) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ue_ipv6]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->ue_mac) {
+    if (OpenAPI_json_write_string(writer, "ueMac", service_parameter_data->ue_mac) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ue_mac]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->is_any_ue_ind) {
+    if (OpenAPI_json_write_bool(writer, "anyUeInd", service_parameter_data->any_ue_ind) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [any_ue_ind]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->param_over_pc5) {
+    if (OpenAPI_json_write_string(writer, "paramOverPc5", service_parameter_data->param_over_pc5) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [param_over_pc5]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->param_over_uu) {
+    if (OpenAPI_json_write_string(writer, "paramOverUu", service_parameter_data->param_over_uu) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [param_over_uu]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", service_parameter_data->supp_feat) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data->res_uri) {
+    if (OpenAPI_json_write_string(writer, "resUri", service_parameter_data->res_uri) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [res_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_service_parameter_data_writeJSON() failed [ServiceParameterData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_parseFromJSON(cJSON *service_parameter_dataJSON)
 {
     OpenAPI_service_parameter_data_t *service_parameter_data_local_var = NULL;
@@ -317,7 +430,6 @@ end:
 OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_copy(OpenAPI_service_parameter_data_t *dst, OpenAPI_service_parameter_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_parameter_data_convertToJSON(src);
@@ -326,21 +438,6 @@ OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_copy(OpenAPI_se
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_parameter_data_free(dst);
     dst = OpenAPI_service_parameter_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -55,6 +56,7 @@ OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_create(
 void OpenAPI_service_parameter_data_free(OpenAPI_service_parameter_data_t *service_parameter_data);
 OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_parseFromJSON(cJSON *service_parameter_dataJSON);
 cJSON *OpenAPI_service_parameter_data_convertToJSON(OpenAPI_service_parameter_data_t *service_parameter_data);
+bool OpenAPI_service_parameter_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_parameter_data_t *service_parameter_data);
 OpenAPI_service_parameter_data_t *OpenAPI_service_parameter_data_copy(OpenAPI_service_parameter_data_t *dst, OpenAPI_service_parameter_data_t *src);
 
 #ifdef __cplusplus
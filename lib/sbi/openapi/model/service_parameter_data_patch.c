@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_service_parameter_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_parameter_data_patch_t *service_parameter_data_patch)
+{
+    if (service_parameter_data_patch == NULL) {
+        ogs_error("OpenAPI_service_parameter_data_patch_writeJSON() failed [ServiceParameterDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_service_parameter_data_patch_writeJSON() failed [ServiceParameterDataPatch]");
+        return false;
+    }
+    if (service_parameter_data_patch->param_over_pc5) {
+    if (OpenAPI_json_write_string(writer, "paramOverPc5", service_parameter_data_patch->param_over_pc5) == false) {
+        ogs_error("OpenAPI_service_parameter_data_patch_writeJSON() failed [param_over_pc5]");
+        goto end;
+    }
+    }
+
+    if (service_parameter_data_patch->param_over_uu) {
+    if (OpenAPI_json_write_string(writer, "paramOverUu", service_parameter_data_patch->param_over_uu) == false) {
+        ogs_error("OpenAPI_service_parameter_data_patch_writeJSON() failed [param_over_uu]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_service_parameter_data_patch_writeJSON() failed [ServiceParameterDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_service_parameter_data_patch_t *OpenAPI_service_parameter_data_patch_parseFromJSON(cJSON *service_parameter_data_patchJSON)
 {
     OpenAPI_service_parameter_data_patch_t *service_parameter_data_patch_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_service_parameter_data_patch_t *OpenAPI_service_parameter_data_patch_copy(OpenAPI_service_parameter_data_patch_t *dst, OpenAPI_service_parameter_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_parameter_data_patch_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_service_parameter_data_patch_t *OpenAPI_service_parameter_data_patch_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_parameter_data_patch_free(dst);
     dst = OpenAPI_service_parameter_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
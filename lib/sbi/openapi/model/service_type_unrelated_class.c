@@ -126,6 +126,94 @@ end:
     return item;
 }
 
+bool OpenAPI_service_type_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_service_type_unrelated_class_t *service_type_unrelated_class)
+{
+    if (service_type_unrelated_class == NULL) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [ServiceTypeUnrelatedClass]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [ServiceTypeUnrelatedClass]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "serviceType", service_type_unrelated_class->service_type) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [service_type]");
+        goto end;
+    }
+
+    if (service_type_unrelated_class->allowed_geographic_area) {
+    if (OpenAPI_json_write_array_start(writer, "allowedGeographicArea") == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_geographic_area_node;
+    if (service_type_unrelated_class->allowed_geographic_area) {
+        OpenAPI_list_for_each(service_type_unrelated_class->allowed_geographic_area, allowed_geographic_area_node) {
+            if (OpenAPI_geographic_area_writeJSON(writer, NULL, allowed_geographic_area_node->data) == false) {
+                ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [allowed_geographic_area]");
+        goto end;
+    }
+    }
+
+    if (service_type_unrelated_class->privacy_check_related_action) {
+    if (OpenAPI_json_write_string(writer, "privacyCheckRelatedAction", OpenAPI_privacy_check_related_action_ToString(service_type_unrelated_class->privacy_check_related_action)) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [privacy_check_related_action]");
+        goto end;
+    }
+    }
+
+    if (service_type_unrelated_class->code_word_ind) {
+    if (OpenAPI_json_write_string(writer, "codeWordInd", OpenAPI_code_word_ind_ToString(service_type_unrelated_class->code_word_ind)) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [code_word_ind]");
+        goto end;
+    }
+    }
+
+    if (service_type_unrelated_class->valid_time_period) {
+    if (OpenAPI_valid_time_period_writeJSON(writer, "validTimePeriod", service_type_unrelated_class->valid_time_period) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [valid_time_period]");
+        goto end;
+    }
+    }
+
+    if (service_type_unrelated_class->code_word_list) {
+    if (OpenAPI_json_write_array_start(writer, "codeWordList") == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *code_word_list_node;
+    OpenAPI_list_for_each(service_type_unrelated_class->code_word_list, code_word_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)code_word_list_node->data) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [code_word_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_service_type_unrelated_class_writeJSON() failed [ServiceTypeUnrelatedClass]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_service_type_unrelated_class_t *OpenAPI_service_type_unrelated_class_parseFromJSON(cJSON *service_type_unrelated_classJSON)
 {
     OpenAPI_service_type_unrelated_class_t *service_type_unrelated_class_local_var = NULL;
@@ -236,7 +324,6 @@ end:
 OpenAPI_service_type_unrelated_class_t *OpenAPI_service_type_unrelated_class_copy(OpenAPI_service_type_unrelated_class_t *dst, OpenAPI_service_type_unrelated_class_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_service_type_unrelated_class_convertToJSON(src);
@@ -245,21 +332,6 @@ OpenAPI_service_type_unrelated_class_t *OpenAPI_service_type_unrelated_class_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_service_type_unrelated_class_free(dst);
     dst = OpenAPI_service_type_unrelated_class_parseFromJSON(item);
     cJSON_Delete(item);
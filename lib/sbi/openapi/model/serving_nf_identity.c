@@ -79,6 +79,49 @@ end:
     return item;
 }
 
+bool OpenAPI_serving_nf_identity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_serving_nf_identity_t *serving_nf_identity)
+{
+    if (serving_nf_identity == NULL) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [ServingNfIdentity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [ServingNfIdentity]");
+        return false;
+    }
+    if (serving_nf_identity->serv_nf_inst_id) {
+    if (OpenAPI_json_write_string(writer, "servNfInstId", serving_nf_identity->serv_nf_inst_id) == false) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [serv_nf_inst_id]");
+        goto end;
+    }
+    }
+
+    if (serving_nf_identity->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", serving_nf_identity->guami) == false) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (serving_nf_identity->an_gw_addr) {
+    if (OpenAPI_an_gw_address_writeJSON(writer, "anGwAddr", serving_nf_identity->an_gw_addr) == false) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [an_gw_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_serving_nf_identity_writeJSON() failed [ServingNfIdentity]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_parseFromJSON(cJSON *serving_nf_identityJSON)
 {
     OpenAPI_serving_nf_identity_t *serving_nf_identity_local_var = NULL;
@@ -119,7 +162,6 @@ end:
 OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_copy(OpenAPI_serving_nf_identity_t *dst, OpenAPI_serving_nf_identity_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_serving_nf_identity_convertToJSON(src);
@@ -128,21 +170,6 @@ OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_copy(OpenAPI_serving_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_serving_nf_identity_free(dst);
     dst = OpenAPI_serving_nf_identity_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "an_gw_address.h"
 #include "guami.h"
 
@@ -34,6 +35,7 @@ OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_create(
 void OpenAPI_serving_nf_identity_free(OpenAPI_serving_nf_identity_t *serving_nf_identity);
 OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_parseFromJSON(cJSON *serving_nf_identityJSON);
 cJSON *OpenAPI_serving_nf_identity_convertToJSON(OpenAPI_serving_nf_identity_t *serving_nf_identity);
+bool OpenAPI_serving_nf_identity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_serving_nf_identity_t *serving_nf_identity);
 OpenAPI_serving_nf_identity_t *OpenAPI_serving_nf_identity_copy(OpenAPI_serving_nf_identity_t *dst, OpenAPI_serving_nf_identity_t *src);
 
 #ifdef __cplusplus
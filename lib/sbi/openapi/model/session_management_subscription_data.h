@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnn_configuration.h"
 #include "expected_ue_behaviour_data.h"
 #include "odb_packet_services.h"
@@ -54,6 +55,7 @@ OpenAPI_session_management_subscription_data_t *OpenAPI_session_management_subsc
 void OpenAPI_session_management_subscription_data_free(OpenAPI_session_management_subscription_data_t *session_management_subscription_data);
 OpenAPI_session_management_subscription_data_t *OpenAPI_session_management_subscription_data_parseFromJSON(cJSON *session_management_subscription_dataJSON);
 cJSON *OpenAPI_session_management_subscription_data_convertToJSON(OpenAPI_session_management_subscription_data_t *session_management_subscription_data);
+bool OpenAPI_session_management_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_management_subscription_data_t *session_management_subscription_data);
 OpenAPI_session_management_subscription_data_t *OpenAPI_session_management_subscription_data_copy(OpenAPI_session_management_subscription_data_t *dst, OpenAPI_session_management_subscription_data_t *src);
 
 #ifdef __cplusplus
@@ -248,6 +248,173 @@ end:
     return item;
 }
 
+bool OpenAPI_session_management_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_management_subscription_data_1_t *session_management_subscription_data_1)
+{
+    if (session_management_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [SessionManagementSubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [SessionManagementSubscriptionData_1]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", session_management_subscription_data_1->single_nssai) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+
+    if (session_management_subscription_data_1->dnn_configurations) {
+    if (OpenAPI_json_write_object_start(writer, "dnnConfigurations") == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [dnn_configurations]");
+        goto end;
+    }
+    OpenAPI_lnode_t *dnn_configurations_node;
+    if (session_management_subscription_data_1->dnn_configurations) {
+        OpenAPI_list_for_each(session_management_subscription_data_1->dnn_configurations, dnn_configurations_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)dnn_configurations_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_dnn_configuration_1_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [dnn_configurations]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [dnn_configurations]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->internal_group_ids) {
+    if (OpenAPI_json_write_array_start(writer, "internalGroupIds") == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *internal_group_ids_node;
+    OpenAPI_list_for_each(session_management_subscription_data_1->internal_group_ids, internal_group_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)internal_group_ids_node->data) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->shared_vn_group_data_ids) {
+    if (OpenAPI_json_write_object_start(writer, "sharedVnGroupDataIds") == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [shared_vn_group_data_ids]");
+        goto end;
+    }
+    OpenAPI_lnode_t *shared_vn_group_data_ids_node;
+    if (session_management_subscription_data_1->shared_vn_group_data_ids) {
+        OpenAPI_list_for_each(session_management_subscription_data_1->shared_vn_group_data_ids, shared_vn_group_data_ids_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)shared_vn_group_data_ids_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [shared_vn_group_data_ids]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->shared_dnn_configurations_id) {
+    if (OpenAPI_json_write_string(writer, "sharedDnnConfigurationsId", session_management_subscription_data_1->shared_dnn_configurations_id) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [shared_dnn_configurations_id]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->odb_packet_services) {
+    if (OpenAPI_json_write_string(writer, "odbPacketServices", OpenAPI_odb_packet_services_ToString(session_management_subscription_data_1->odb_packet_services)) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [odb_packet_services]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", session_management_subscription_data_1->trace_data) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->shared_trace_data_id) {
+    if (OpenAPI_json_write_string(writer, "sharedTraceDataId", session_management_subscription_data_1->shared_trace_data_id) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [shared_trace_data_id]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->expected_ue_behaviours_list) {
+    if (OpenAPI_json_write_object_start(writer, "expectedUeBehavioursList") == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [expected_ue_behaviours_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *expected_ue_behaviours_list_node;
+    if (session_management_subscription_data_1->expected_ue_behaviours_list) {
+        OpenAPI_list_for_each(session_management_subscription_data_1->expected_ue_behaviours_list, expected_ue_behaviours_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)expected_ue_behaviours_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_expected_ue_behaviour_data_1_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [expected_ue_behaviours_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [expected_ue_behaviours_list]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->suggested_packet_num_dl_list) {
+    if (OpenAPI_json_write_object_start(writer, "suggestedPacketNumDlList") == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [suggested_packet_num_dl_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *suggested_packet_num_dl_list_node;
+    if (session_management_subscription_data_1->suggested_packet_num_dl_list) {
+        OpenAPI_list_for_each(session_management_subscription_data_1->suggested_packet_num_dl_list, suggested_packet_num_dl_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)suggested_packet_num_dl_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_suggested_packet_num_dl_1_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [suggested_packet_num_dl_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [suggested_packet_num_dl_list]");
+        goto end;
+    }
+    }
+
+    if (session_management_subscription_data_1->_3gpp_charging_characteristics) {
+    if (OpenAPI_json_write_string(writer, "3gppChargingCharacteristics", session_management_subscription_data_1->_3gpp_charging_characteristics) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [_3gpp_charging_characteristics]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_management_subscription_data_1_writeJSON() failed [SessionManagementSubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_subscription_data_1_parseFromJSON(cJSON *session_management_subscription_data_1JSON)
 {
     OpenAPI_session_management_subscription_data_1_t *session_management_subscription_data_1_local_var = NULL;
@@ -442,7 +609,6 @@ end:
 OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_subscription_data_1_copy(OpenAPI_session_management_subscription_data_1_t *dst, OpenAPI_session_management_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_session_management_subscription_data_1_convertToJSON(src);
@@ -451,21 +617,6 @@ OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_sub
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_session_management_subscription_data_1_free(dst);
     dst = OpenAPI_session_management_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnn_configuration_1.h"
 #include "expected_ue_behaviour_data_1.h"
 #include "odb_packet_services.h"
@@ -54,6 +55,7 @@ OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_sub
 void OpenAPI_session_management_subscription_data_1_free(OpenAPI_session_management_subscription_data_1_t *session_management_subscription_data_1);
 OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_subscription_data_1_parseFromJSON(cJSON *session_management_subscription_data_1JSON);
 cJSON *OpenAPI_session_management_subscription_data_1_convertToJSON(OpenAPI_session_management_subscription_data_1_t *session_management_subscription_data_1);
+bool OpenAPI_session_management_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_management_subscription_data_1_t *session_management_subscription_data_1);
 OpenAPI_session_management_subscription_data_1_t *OpenAPI_session_management_subscription_data_1_copy(OpenAPI_session_management_subscription_data_1_t *dst, OpenAPI_session_management_subscription_data_1_t *src);
 
 #ifdef __cplusplus
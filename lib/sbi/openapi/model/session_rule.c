@@ -107,6 +107,68 @@ end:
     return item;
 }
 
+bool OpenAPI_session_rule_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_rule_t *session_rule)
+{
+    if (session_rule == NULL) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [SessionRule]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [SessionRule]");
+        return false;
+    }
+    if (session_rule->auth_sess_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "authSessAmbr", session_rule->auth_sess_ambr) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [auth_sess_ambr]");
+        goto end;
+    }
+    }
+
+    if (session_rule->auth_def_qos) {
+    if (OpenAPI_authorized_default_qos_writeJSON(writer, "authDefQos", session_rule->auth_def_qos) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [auth_def_qos]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "sessRuleId", session_rule->sess_rule_id) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [sess_rule_id]");
+        goto end;
+    }
+
+    if (session_rule->ref_um_data) {
+    if (OpenAPI_json_write_string(writer, "refUmData", session_rule->ref_um_data) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [ref_um_data]");
+        goto end;
+    }
+    }
+
+    if (session_rule->ref_um_n3g_data) {
+    if (OpenAPI_json_write_string(writer, "refUmN3gData", session_rule->ref_um_n3g_data) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [ref_um_n3g_data]");
+        goto end;
+    }
+    }
+
+    if (session_rule->ref_cond_data) {
+    if (OpenAPI_json_write_string(writer, "refCondData", session_rule->ref_cond_data) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [ref_cond_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_rule_writeJSON() failed [SessionRule]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_session_rule_t *OpenAPI_session_rule_parseFromJSON(cJSON *session_ruleJSON)
 {
     OpenAPI_session_rule_t *session_rule_local_var = NULL;
@@ -179,7 +241,6 @@ end:
 OpenAPI_session_rule_t *OpenAPI_session_rule_copy(OpenAPI_session_rule_t *dst, OpenAPI_session_rule_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_session_rule_convertToJSON(src);
@@ -188,21 +249,6 @@ OpenAPI_session_rule_t *OpenAPI_session_rule_copy(OpenAPI_session_rule_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_session_rule_free(dst);
     dst = OpenAPI_session_rule_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "authorized_default_qos.h"
 
@@ -40,6 +41,7 @@ OpenAPI_session_rule_t *OpenAPI_session_rule_create(
 void OpenAPI_session_rule_free(OpenAPI_session_rule_t *session_rule);
 OpenAPI_session_rule_t *OpenAPI_session_rule_parseFromJSON(cJSON *session_ruleJSON);
 cJSON *OpenAPI_session_rule_convertToJSON(OpenAPI_session_rule_t *session_rule);
+bool OpenAPI_session_rule_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_rule_t *session_rule);
 OpenAPI_session_rule_t *OpenAPI_session_rule_copy(OpenAPI_session_rule_t *dst, OpenAPI_session_rule_t *src);
 
 #ifdef __cplusplus
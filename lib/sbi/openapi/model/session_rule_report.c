@@ -91,6 +91,75 @@ end:
     return item;
 }
 
+bool OpenAPI_session_rule_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_rule_report_t *session_rule_report)
+{
+    if (session_rule_report == NULL) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [SessionRuleReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [SessionRuleReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "ruleIds") == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [rule_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rule_ids_node;
+    OpenAPI_list_for_each(session_rule_report->rule_ids, rule_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)rule_ids_node->data) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [rule_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [rule_ids]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ruleStatus", OpenAPI_rule_status_ToString(session_rule_report->rule_status)) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [rule_status]");
+        goto end;
+    }
+
+    if (session_rule_report->sess_rule_failure_code) {
+    if (OpenAPI_json_write_string(writer, "sessRuleFailureCode", OpenAPI_session_rule_failure_code_ToString(session_rule_report->sess_rule_failure_code)) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [sess_rule_failure_code]");
+        goto end;
+    }
+    }
+
+    if (session_rule_report->policy_dec_failure_reports) {
+    if (OpenAPI_json_write_array_start(writer, "policyDecFailureReports") == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *policy_dec_failure_reports_node;
+    OpenAPI_list_for_each(session_rule_report->policy_dec_failure_reports, policy_dec_failure_reports_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_decision_failure_code_ToString((intptr_t)policy_dec_failure_reports_node->data)) == false) {
+            ogs_error("OpenAPI_session_rule_report_writeJSON() failed [policy_dec_failure_reports]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_session_rule_report_writeJSON() failed [SessionRuleReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_parseFromJSON(cJSON *session_rule_reportJSON)
 {
     OpenAPI_session_rule_report_t *session_rule_report_local_var = NULL;
@@ -177,7 +246,6 @@ end:
 OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_copy(OpenAPI_session_rule_report_t *dst, OpenAPI_session_rule_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_session_rule_report_convertToJSON(src);
@@ -186,21 +254,6 @@ OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_copy(OpenAPI_session_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_session_rule_report_free(dst);
     dst = OpenAPI_session_rule_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "policy_decision_failure_code.h"
 #include "rule_status.h"
 #include "session_rule_failure_code.h"
@@ -37,6 +38,7 @@ OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_create(
 void OpenAPI_session_rule_report_free(OpenAPI_session_rule_report_t *session_rule_report);
 OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_parseFromJSON(cJSON *session_rule_reportJSON);
 cJSON *OpenAPI_session_rule_report_convertToJSON(OpenAPI_session_rule_report_t *session_rule_report);
+bool OpenAPI_session_rule_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_session_rule_report_t *session_rule_report);
 OpenAPI_session_rule_report_t *OpenAPI_session_rule_report_copy(OpenAPI_session_rule_report_t *dst, OpenAPI_session_rule_report_t *src);
 
 #ifdef __cplusplus
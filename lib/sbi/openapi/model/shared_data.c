@@ -205,6 +205,130 @@ end:
     return item;
 }
 
+bool OpenAPI_shared_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_shared_data_t *shared_data)
+{
+    if (shared_data == NULL) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [SharedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [SharedData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "sharedDataId", shared_data->shared_data_id) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_data_id]");
+        goto end;
+    }
+
+    if (shared_data->shared_am_data) {
+    if (OpenAPI_access_and_mobility_subscription_data_1_writeJSON(writer, "sharedAmData", shared_data->shared_am_data) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_am_data]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_sms_subs_data) {
+    if (OpenAPI_sms_subscription_data_1_writeJSON(writer, "sharedSmsSubsData", shared_data->shared_sms_subs_data) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_sms_subs_data]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_sms_mng_subs_data) {
+    if (OpenAPI_sms_management_subscription_data_1_writeJSON(writer, "sharedSmsMngSubsData", shared_data->shared_sms_mng_subs_data) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_sms_mng_subs_data]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_dnn_configurations) {
+    if (OpenAPI_json_write_object_start(writer, "sharedDnnConfigurations") == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_dnn_configurations]");
+        goto end;
+    }
+    OpenAPI_lnode_t *shared_dnn_configurations_node;
+    if (shared_data->shared_dnn_configurations) {
+        OpenAPI_list_for_each(shared_data->shared_dnn_configurations, shared_dnn_configurations_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)shared_dnn_configurations_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_dnn_configuration_1_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_dnn_configurations]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_dnn_configurations]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "sharedTraceData", shared_data->shared_trace_data) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_trace_data]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_snssai_infos) {
+    if (OpenAPI_json_write_object_start(writer, "sharedSnssaiInfos") == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_snssai_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *shared_snssai_infos_node;
+    if (shared_data->shared_snssai_infos) {
+        OpenAPI_list_for_each(shared_data->shared_snssai_infos, shared_snssai_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)shared_snssai_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_snssai_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_snssai_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_snssai_infos]");
+        goto end;
+    }
+    }
+
+    if (shared_data->shared_vn_group_datas) {
+    if (OpenAPI_json_write_object_start(writer, "sharedVnGroupDatas") == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_vn_group_datas]");
+        goto end;
+    }
+    OpenAPI_lnode_t *shared_vn_group_datas_node;
+    if (shared_data->shared_vn_group_datas) {
+        OpenAPI_list_for_each(shared_data->shared_vn_group_datas, shared_vn_group_datas_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)shared_vn_group_datas_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_vn_group_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_vn_group_datas]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [shared_vn_group_datas]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_shared_data_writeJSON() failed [SharedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_shared_data_t *OpenAPI_shared_data_parseFromJSON(cJSON *shared_dataJSON)
 {
     OpenAPI_shared_data_t *shared_data_local_var = NULL;
@@ -344,7 +468,6 @@ end:
 OpenAPI_shared_data_t *OpenAPI_shared_data_copy(OpenAPI_shared_data_t *dst, OpenAPI_shared_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_shared_data_convertToJSON(src);
@@ -353,21 +476,6 @@ OpenAPI_shared_data_t *OpenAPI_shared_data_copy(OpenAPI_shared_data_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_shared_data_free(dst);
     dst = OpenAPI_shared_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_and_mobility_subscription_data_1.h"
 #include "dnn_configuration_1.h"
 #include "sms_management_subscription_data_1.h"
@@ -49,6 +50,7 @@ OpenAPI_shared_data_t *OpenAPI_shared_data_create(
 void OpenAPI_shared_data_free(OpenAPI_shared_data_t *shared_data);
 OpenAPI_shared_data_t *OpenAPI_shared_data_parseFromJSON(cJSON *shared_dataJSON);
 cJSON *OpenAPI_shared_data_convertToJSON(OpenAPI_shared_data_t *shared_data);
+bool OpenAPI_shared_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_shared_data_t *shared_data);
 OpenAPI_shared_data_t *OpenAPI_shared_data_copy(OpenAPI_shared_data_t *dst, OpenAPI_shared_data_t *src);
 
 #ifdef __cplusplus
@@ -74,6 +74,45 @@ end:
     return item;
 }
 
+bool OpenAPI_slice_info_for_pdu_session_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_slice_info_for_pdu_session_t *slice_info_for_pdu_session)
+{
+    if (slice_info_for_pdu_session == NULL) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [SliceInfoForPDUSession]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [SliceInfoForPDUSession]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", slice_info_for_pdu_session->s_nssai) == false) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "roamingIndication", OpenAPI_roaming_indication_ToString(slice_info_for_pdu_session->roaming_indication)) == false) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [roaming_indication]");
+        goto end;
+    }
+
+    if (slice_info_for_pdu_session->home_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "homeSnssai", slice_info_for_pdu_session->home_snssai) == false) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [home_snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_pdu_session_writeJSON() failed [SliceInfoForPDUSession]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_slice_info_for_pdu_session_t *OpenAPI_slice_info_for_pdu_session_parseFromJSON(cJSON *slice_info_for_pdu_sessionJSON)
 {
     OpenAPI_slice_info_for_pdu_session_t *slice_info_for_pdu_session_local_var = NULL;
@@ -120,7 +159,6 @@ end:
 OpenAPI_slice_info_for_pdu_session_t *OpenAPI_slice_info_for_pdu_session_copy(OpenAPI_slice_info_for_pdu_session_t *dst, OpenAPI_slice_info_for_pdu_session_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_slice_info_for_pdu_session_convertToJSON(src);
@@ -129,21 +167,6 @@ OpenAPI_slice_info_for_pdu_session_t *OpenAPI_slice_info_for_pdu_session_copy(Op
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_slice_info_for_pdu_session_free(dst);
     dst = OpenAPI_slice_info_for_pdu_session_parseFromJSON(item);
     cJSON_Delete(item);
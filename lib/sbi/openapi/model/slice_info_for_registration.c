@@ -195,6 +195,140 @@ end:
     return item;
 }
 
+bool OpenAPI_slice_info_for_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_slice_info_for_registration_t *slice_info_for_registration)
+{
+    if (slice_info_for_registration == NULL) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [SliceInfoForRegistration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [SliceInfoForRegistration]");
+        return false;
+    }
+    if (slice_info_for_registration->subscribed_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "subscribedNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [subscribed_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscribed_nssai_node;
+    if (slice_info_for_registration->subscribed_nssai) {
+        OpenAPI_list_for_each(slice_info_for_registration->subscribed_nssai, subscribed_nssai_node) {
+            if (OpenAPI_subscribed_snssai_writeJSON(writer, NULL, subscribed_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [subscribed_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [subscribed_nssai]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->allowed_nssai_current_access) {
+    if (OpenAPI_allowed_nssai_writeJSON(writer, "allowedNssaiCurrentAccess", slice_info_for_registration->allowed_nssai_current_access) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [allowed_nssai_current_access]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->allowed_nssai_other_access) {
+    if (OpenAPI_allowed_nssai_writeJSON(writer, "allowedNssaiOtherAccess", slice_info_for_registration->allowed_nssai_other_access) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [allowed_nssai_other_access]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->s_nssai_for_mapping) {
+    if (OpenAPI_json_write_array_start(writer, "sNssaiForMapping") == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [s_nssai_for_mapping]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssai_for_mapping_node;
+    if (slice_info_for_registration->s_nssai_for_mapping) {
+        OpenAPI_list_for_each(slice_info_for_registration->s_nssai_for_mapping, s_nssai_for_mapping_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, s_nssai_for_mapping_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [s_nssai_for_mapping]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [s_nssai_for_mapping]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->requested_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "requestedNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [requested_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *requested_nssai_node;
+    if (slice_info_for_registration->requested_nssai) {
+        OpenAPI_list_for_each(slice_info_for_registration->requested_nssai, requested_nssai_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, requested_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [requested_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [requested_nssai]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->is_default_configured_snssai_ind) {
+    if (OpenAPI_json_write_bool(writer, "defaultConfiguredSnssaiInd", slice_info_for_registration->default_configured_snssai_ind) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [default_configured_snssai_ind]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->mapping_of_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "mappingOfNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [mapping_of_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mapping_of_nssai_node;
+    if (slice_info_for_registration->mapping_of_nssai) {
+        OpenAPI_list_for_each(slice_info_for_registration->mapping_of_nssai, mapping_of_nssai_node) {
+            if (OpenAPI_mapping_of_snssai_writeJSON(writer, NULL, mapping_of_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [mapping_of_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [mapping_of_nssai]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_registration->is_request_mapping) {
+    if (OpenAPI_json_write_bool(writer, "requestMapping", slice_info_for_registration->request_mapping) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [request_mapping]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_registration_writeJSON() failed [SliceInfoForRegistration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_parseFromJSON(cJSON *slice_info_for_registrationJSON)
 {
     OpenAPI_slice_info_for_registration_t *slice_info_for_registration_local_var = NULL;
@@ -367,7 +501,6 @@ end:
 OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_copy(OpenAPI_slice_info_for_registration_t *dst, OpenAPI_slice_info_for_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_slice_info_for_registration_convertToJSON(src);
@@ -376,21 +509,6 @@ OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_slice_info_for_registration_free(dst);
     dst = OpenAPI_slice_info_for_registration_parseFromJSON(item);
     cJSON_Delete(item);
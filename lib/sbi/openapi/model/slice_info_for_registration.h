@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "allowed_nssai.h"
 #include "mapping_of_snssai.h"
 #include "snssai.h"
@@ -50,6 +51,7 @@ OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_creat
 void OpenAPI_slice_info_for_registration_free(OpenAPI_slice_info_for_registration_t *slice_info_for_registration);
 OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_parseFromJSON(cJSON *slice_info_for_registrationJSON);
 cJSON *OpenAPI_slice_info_for_registration_convertToJSON(OpenAPI_slice_info_for_registration_t *slice_info_for_registration);
+bool OpenAPI_slice_info_for_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_slice_info_for_registration_t *slice_info_for_registration);
 OpenAPI_slice_info_for_registration_t *OpenAPI_slice_info_for_registration_copy(OpenAPI_slice_info_for_registration_t *dst, OpenAPI_slice_info_for_registration_t *src);
 
 #ifdef __cplusplus
@@ -158,6 +158,112 @@ end:
     return item;
 }
 
+bool OpenAPI_slice_info_for_ue_configuration_update_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_slice_info_for_ue_configuration_update_t *slice_info_for_ue_configuration_update)
+{
+    if (slice_info_for_ue_configuration_update == NULL) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [SliceInfoForUEConfigurationUpdate]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [SliceInfoForUEConfigurationUpdate]");
+        return false;
+    }
+    if (slice_info_for_ue_configuration_update->subscribed_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "subscribedNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [subscribed_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscribed_nssai_node;
+    if (slice_info_for_ue_configuration_update->subscribed_nssai) {
+        OpenAPI_list_for_each(slice_info_for_ue_configuration_update->subscribed_nssai, subscribed_nssai_node) {
+            if (OpenAPI_subscribed_snssai_writeJSON(writer, NULL, subscribed_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [subscribed_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [subscribed_nssai]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_ue_configuration_update->allowed_nssai_current_access) {
+    if (OpenAPI_allowed_nssai_writeJSON(writer, "allowedNssaiCurrentAccess", slice_info_for_ue_configuration_update->allowed_nssai_current_access) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [allowed_nssai_current_access]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_ue_configuration_update->allowed_nssai_other_access) {
+    if (OpenAPI_allowed_nssai_writeJSON(writer, "allowedNssaiOtherAccess", slice_info_for_ue_configuration_update->allowed_nssai_other_access) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [allowed_nssai_other_access]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_ue_configuration_update->is_default_configured_snssai_ind) {
+    if (OpenAPI_json_write_bool(writer, "defaultConfiguredSnssaiInd", slice_info_for_ue_configuration_update->default_configured_snssai_ind) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [default_configured_snssai_ind]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_ue_configuration_update->requested_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "requestedNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [requested_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *requested_nssai_node;
+    if (slice_info_for_ue_configuration_update->requested_nssai) {
+        OpenAPI_list_for_each(slice_info_for_ue_configuration_update->requested_nssai, requested_nssai_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, requested_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [requested_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [requested_nssai]");
+        goto end;
+    }
+    }
+
+    if (slice_info_for_ue_configuration_update->mapping_of_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "mappingOfNssai") == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [mapping_of_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mapping_of_nssai_node;
+    if (slice_info_for_ue_configuration_update->mapping_of_nssai) {
+        OpenAPI_list_for_each(slice_info_for_ue_configuration_update->mapping_of_nssai, mapping_of_nssai_node) {
+            if (OpenAPI_mapping_of_snssai_writeJSON(writer, NULL, mapping_of_nssai_node->data) == false) {
+                ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [mapping_of_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [mapping_of_nssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_slice_info_for_ue_configuration_update_writeJSON() failed [SliceInfoForUEConfigurationUpdate]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_slice_info_for_ue_configuration_update_t *OpenAPI_slice_info_for_ue_configuration_update_parseFromJSON(cJSON *slice_info_for_ue_configuration_updateJSON)
 {
     OpenAPI_slice_info_for_ue_configuration_update_t *slice_info_for_ue_configuration_update_local_var = NULL;
@@ -289,7 +395,6 @@ end:
 OpenAPI_slice_info_for_ue_configuration_update_t *OpenAPI_slice_info_for_ue_configuration_update_copy(OpenAPI_slice_info_for_ue_configuration_update_t *dst, OpenAPI_slice_info_for_ue_configuration_update_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_slice_info_for_ue_configuration_update_convertToJSON(src);
@@ -298,21 +403,6 @@ OpenAPI_slice_info_for_ue_configuration_update_t *OpenAPI_slice_info_for_ue_conf
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_slice_info_for_ue_configuration_update_free(dst);
     dst = OpenAPI_slice_info_for_ue_configuration_update_parseFromJSON(item);
     cJSON_Delete(item);
@@ -631,6 +631,401 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_t *sm_context)
+{
+    if (sm_context == NULL) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [SmContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [SmContext]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "pduSessionId", sm_context->pdu_session_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnn", sm_context->dnn) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (sm_context->selected_dnn) {
+    if (OpenAPI_json_write_string(writer, "selectedDnn", sm_context->selected_dnn) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [selected_dnn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", sm_context->s_nssai) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (sm_context->hplmn_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "hplmnSnssai", sm_context->hplmn_snssai) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [hplmn_snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "pduSessionType", OpenAPI_pdu_session_type_ToString(sm_context->pdu_session_type)) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_type]");
+        goto end;
+    }
+
+    if (sm_context->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", sm_context->gpsi) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (sm_context->h_smf_uri) {
+    if (OpenAPI_json_write_string(writer, "hSmfUri", sm_context->h_smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [h_smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context->smf_uri) {
+    if (OpenAPI_json_write_string(writer, "smfUri", sm_context->smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pdu_session_ref) {
+    if (OpenAPI_json_write_string(writer, "pduSessionRef", sm_context->pdu_session_ref) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_ref]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", sm_context->pcf_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pcf_group_id) {
+    if (OpenAPI_json_write_string(writer, "pcfGroupId", sm_context->pcf_group_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pcf_group_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfSetId", sm_context->pcf_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->sel_mode) {
+    if (OpenAPI_json_write_string(writer, "selMode", OpenAPI_dnn_selection_mode_ToString(sm_context->sel_mode)) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [sel_mode]");
+        goto end;
+    }
+    }
+
+    if (sm_context->udm_group_id) {
+    if (OpenAPI_json_write_string(writer, "udmGroupId", sm_context->udm_group_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [udm_group_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->routing_indicator) {
+    if (OpenAPI_json_write_string(writer, "routingIndicator", sm_context->routing_indicator) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [routing_indicator]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_ambr_writeJSON(writer, "sessionAmbr", sm_context->session_ambr) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsList") == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [qos_flows_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_list_node;
+    if (sm_context->qos_flows_list) {
+        OpenAPI_list_for_each(sm_context->qos_flows_list, qos_flows_list_node) {
+            if (OpenAPI_qos_flow_setup_item_writeJSON(writer, NULL, qos_flows_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_writeJSON() failed [qos_flows_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [qos_flows_list]");
+        goto end;
+    }
+
+    if (sm_context->h_smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "hSmfInstanceId", sm_context->h_smf_instance_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [h_smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->smf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", sm_context->smf_instance_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pdu_session_smf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pduSessionSmfSetId", sm_context->pdu_session_smf_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_smf_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pdu_session_smf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "pduSessionSmfServiceSetId", sm_context->pdu_session_smf_service_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_smf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->pdu_session_smf_binding) {
+    if (OpenAPI_json_write_string(writer, "pduSessionSmfBinding", OpenAPI_sbi_binding_level_ToString(sm_context->pdu_session_smf_binding)) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [pdu_session_smf_binding]");
+        goto end;
+    }
+    }
+
+    if (sm_context->is_enable_pause_charging) {
+    if (OpenAPI_json_write_bool(writer, "enablePauseCharging", sm_context->enable_pause_charging) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [enable_pause_charging]");
+        goto end;
+    }
+    }
+
+    if (sm_context->ue_ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "ueIpv4Address", sm_context->ue_ipv4_address) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [ue_ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (sm_context->ue_ipv6_prefix) {
+    if (OpenAPI_json_write_string(writer, "ueIpv6Prefix", sm_context->ue_ipv6_prefix) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [ue_ipv6_prefix]");
+        goto end;
+    }
+    }
+
+    if (sm_context->eps_pdn_cnx_info) {
+    if (OpenAPI_eps_pdn_cnx_info_writeJSON(writer, "epsPdnCnxInfo", sm_context->eps_pdn_cnx_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [eps_pdn_cnx_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->eps_bearer_info) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerInfo") == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_info_node;
+    if (sm_context->eps_bearer_info) {
+        OpenAPI_list_for_each(sm_context->eps_bearer_info, eps_bearer_info_node) {
+            if (OpenAPI_eps_bearer_info_writeJSON(writer, NULL, eps_bearer_info_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_writeJSON() failed [eps_bearer_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->max_integrity_protected_data_rate) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRate", OpenAPI_max_integrity_protected_data_rate_ToString(sm_context->max_integrity_protected_data_rate)) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [max_integrity_protected_data_rate]");
+        goto end;
+    }
+    }
+
+    if (sm_context->is_always_on_granted) {
+    if (OpenAPI_json_write_bool(writer, "alwaysOnGranted", sm_context->always_on_granted) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [always_on_granted]");
+        goto end;
+    }
+    }
+
+    if (sm_context->up_security) {
+    if (OpenAPI_up_security_writeJSON(writer, "upSecurity", sm_context->up_security) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [up_security]");
+        goto end;
+    }
+    }
+
+    if (sm_context->h_smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "hSmfServiceInstanceId", sm_context->h_smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [h_smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfServiceInstanceId", sm_context->smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", sm_context->recovery_time) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (sm_context->is_forwarding_ind) {
+    if (OpenAPI_json_write_bool(writer, "forwardingInd", sm_context->forwarding_ind) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [forwarding_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context->psa_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "psaTunnelInfo", sm_context->psa_tunnel_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [psa_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->charging_id) {
+    if (OpenAPI_json_write_string(writer, "chargingId", sm_context->charging_id) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [charging_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context->charging_info) {
+    if (OpenAPI_charging_information_writeJSON(writer, "chargingInfo", sm_context->charging_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [charging_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->roaming_charging_profile) {
+    if (OpenAPI_roaming_charging_profile_writeJSON(writer, "roamingChargingProfile", sm_context->roaming_charging_profile) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [roaming_charging_profile]");
+        goto end;
+    }
+    }
+
+    if (sm_context->is_nef_ext_buf_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "nefExtBufSupportInd", sm_context->nef_ext_buf_support_ind) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [nef_ext_buf_support_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context->is_ipv6_index) {
+    if (OpenAPI_json_write_number(writer, "ipv6Index", sm_context->ipv6_index) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [ipv6_index]");
+        goto end;
+    }
+    }
+
+    if (sm_context->dn_aaa_address) {
+    if (OpenAPI_ip_address_writeJSON(writer, "dnAaaAddress", sm_context->dn_aaa_address) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [dn_aaa_address]");
+        goto end;
+    }
+    }
+
+    if (sm_context->redundant_pdu_session_info) {
+    if (OpenAPI_redundant_pdu_session_information_writeJSON(writer, "redundantPduSessionInfo", sm_context->redundant_pdu_session_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [redundant_pdu_session_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->ran_tunnel_info) {
+    if (OpenAPI_qos_flow_tunnel_writeJSON(writer, "ranTunnelInfo", sm_context->ran_tunnel_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [ran_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->add_ran_tunnel_info) {
+    if (OpenAPI_json_write_array_start(writer, "addRanTunnelInfo") == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [add_ran_tunnel_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_ran_tunnel_info_node;
+    if (sm_context->add_ran_tunnel_info) {
+        OpenAPI_list_for_each(sm_context->add_ran_tunnel_info, add_ran_tunnel_info_node) {
+            if (OpenAPI_qos_flow_tunnel_writeJSON(writer, NULL, add_ran_tunnel_info_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_writeJSON() failed [add_ran_tunnel_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [add_ran_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->red_ran_tunnel_info) {
+    if (OpenAPI_qos_flow_tunnel_writeJSON(writer, "redRanTunnelInfo", sm_context->red_ran_tunnel_info) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [red_ran_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context->add_red_ran_tunnel_info) {
+    if (OpenAPI_json_write_array_start(writer, "addRedRanTunnelInfo") == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [add_red_ran_tunnel_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_red_ran_tunnel_info_node;
+    if (sm_context->add_red_ran_tunnel_info) {
+        OpenAPI_list_for_each(sm_context->add_red_ran_tunnel_info, add_red_ran_tunnel_info_node) {
+            if (OpenAPI_qos_flow_tunnel_writeJSON(writer, NULL, add_red_ran_tunnel_info_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_writeJSON() failed [add_red_ran_tunnel_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [add_red_ran_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_writeJSON() failed [SmContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_t *OpenAPI_sm_context_parseFromJSON(cJSON *sm_contextJSON)
 {
     OpenAPI_sm_context_t *sm_context_local_var = NULL;
@@ -1197,7 +1592,6 @@ end:
 OpenAPI_sm_context_t *OpenAPI_sm_context_copy(OpenAPI_sm_context_t *dst, OpenAPI_sm_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_convertToJSON(src);
@@ -1206,21 +1600,6 @@ OpenAPI_sm_context_t *OpenAPI_sm_context_copy(OpenAPI_sm_context_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_free(dst);
     dst = OpenAPI_sm_context_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "charging_information.h"
 #include "dnn_selection_mode.h"
@@ -146,6 +147,7 @@ OpenAPI_sm_context_t *OpenAPI_sm_context_create(
 void OpenAPI_sm_context_free(OpenAPI_sm_context_t *sm_context);
 OpenAPI_sm_context_t *OpenAPI_sm_context_parseFromJSON(cJSON *sm_contextJSON);
 cJSON *OpenAPI_sm_context_convertToJSON(OpenAPI_sm_context_t *sm_context);
+bool OpenAPI_sm_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_t *sm_context);
 OpenAPI_sm_context_t *OpenAPI_sm_context_copy(OpenAPI_sm_context_t *dst, OpenAPI_sm_context_t *src);
 
 #ifdef __cplusplus
@@ -979,6 +979,633 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_create_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_create_data_t *sm_context_create_data)
+{
+    if (sm_context_create_data == NULL) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [SmContextCreateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [SmContextCreateData]");
+        return false;
+    }
+    if (sm_context_create_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", sm_context_create_data->supi) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_unauthenticated_supi) {
+    if (OpenAPI_json_write_bool(writer, "unauthenticatedSupi", sm_context_create_data->unauthenticated_supi) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [unauthenticated_supi]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", sm_context_create_data->pei) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", sm_context_create_data->gpsi) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", sm_context_create_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", sm_context_create_data->dnn) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->selected_dnn) {
+    if (OpenAPI_json_write_string(writer, "selectedDnn", sm_context_create_data->selected_dnn) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [selected_dnn]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", sm_context_create_data->s_nssai) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->hplmn_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "hplmnSnssai", sm_context_create_data->hplmn_snssai) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [hplmn_snssai]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "servingNfId", sm_context_create_data->serving_nf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [serving_nf_id]");
+        goto end;
+    }
+
+    if (sm_context_create_data->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", sm_context_create_data->guami) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->service_name) {
+    if (OpenAPI_json_write_string(writer, "serviceName", sm_context_create_data->service_name) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [service_name]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", sm_context_create_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+
+    if (sm_context_create_data->request_type) {
+    if (OpenAPI_json_write_string(writer, "requestType", OpenAPI_request_type_ToString(sm_context_create_data->request_type)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [request_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->n1_sm_msg) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmMsg", sm_context_create_data->n1_sm_msg) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [n1_sm_msg]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(sm_context_create_data->an_type)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [an_type]");
+        goto end;
+    }
+
+    if (sm_context_create_data->additional_an_type) {
+    if (OpenAPI_json_write_string(writer, "additionalAnType", OpenAPI_access_type_ToString(sm_context_create_data->additional_an_type)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_an_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(sm_context_create_data->rat_type)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->presence_in_ladn) {
+    if (OpenAPI_json_write_string(writer, "presenceInLadn", OpenAPI_presence_state_ToString(sm_context_create_data->presence_in_ladn)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [presence_in_ladn]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", sm_context_create_data->ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_context_create_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", sm_context_create_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "smContextStatusUri", sm_context_create_data->sm_context_status_uri) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_status_uri]");
+        goto end;
+    }
+
+    if (sm_context_create_data->h_smf_uri) {
+    if (OpenAPI_json_write_string(writer, "hSmfUri", sm_context_create_data->h_smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [h_smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->h_smf_id) {
+    if (OpenAPI_json_write_string(writer, "hSmfId", sm_context_create_data->h_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [h_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->smf_uri) {
+    if (OpenAPI_json_write_string(writer, "smfUri", sm_context_create_data->smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->smf_id) {
+    if (OpenAPI_json_write_string(writer, "smfId", sm_context_create_data->smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->additional_hsmf_uri) {
+    if (OpenAPI_json_write_array_start(writer, "additionalHsmfUri") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_uri]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *additional_hsmf_uri_node;
+    OpenAPI_list_for_each(sm_context_create_data->additional_hsmf_uri, additional_hsmf_uri_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)additional_hsmf_uri_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_uri]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->additional_hsmf_id) {
+    if (OpenAPI_json_write_array_start(writer, "additionalHsmfId") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_id]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *additional_hsmf_id_node;
+    OpenAPI_list_for_each(sm_context_create_data->additional_hsmf_id, additional_hsmf_id_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)additional_hsmf_id_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_id]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_hsmf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->additional_smf_uri) {
+    if (OpenAPI_json_write_array_start(writer, "additionalSmfUri") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_uri]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *additional_smf_uri_node;
+    OpenAPI_list_for_each(sm_context_create_data->additional_smf_uri, additional_smf_uri_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)additional_smf_uri_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_uri]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->additional_smf_id) {
+    if (OpenAPI_json_write_array_start(writer, "additionalSmfId") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_id]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *additional_smf_id_node;
+    OpenAPI_list_for_each(sm_context_create_data->additional_smf_id, additional_smf_id_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)additional_smf_id_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_id]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [additional_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_old_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "oldPduSessionId", sm_context_create_data->old_pdu_session_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [old_pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->pdu_sessions_activate_list) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionsActivateList") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pdu_sessions_activate_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_sessions_activate_list_node;
+    OpenAPI_list_for_each(sm_context_create_data->pdu_sessions_activate_list, pdu_sessions_activate_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)pdu_sessions_activate_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pdu_sessions_activate_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pdu_sessions_activate_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->ue_eps_pdn_connection) {
+    if (OpenAPI_json_write_string(writer, "ueEpsPdnConnection", sm_context_create_data->ue_eps_pdn_connection) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ue_eps_pdn_connection]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->ho_state) {
+    if (OpenAPI_json_write_string(writer, "hoState", OpenAPI_ho_state_ToString(sm_context_create_data->ho_state)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ho_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", sm_context_create_data->pcf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->pcf_group_id) {
+    if (OpenAPI_json_write_string(writer, "pcfGroupId", sm_context_create_data->pcf_group_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pcf_group_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->pcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfSetId", sm_context_create_data->pcf_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [pcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->nrf_uri) {
+    if (OpenAPI_json_write_string(writer, "nrfUri", sm_context_create_data->nrf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [nrf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sm_context_create_data->supported_features) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sel_mode) {
+    if (OpenAPI_json_write_string(writer, "selMode", OpenAPI_dnn_selection_mode_ToString(sm_context_create_data->sel_mode)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sel_mode]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->backup_amf_info) {
+    if (OpenAPI_json_write_array_start(writer, "backupAmfInfo") == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_amf_info_node;
+    if (sm_context_create_data->backup_amf_info) {
+        OpenAPI_list_for_each(sm_context_create_data->backup_amf_info, backup_amf_info_node) {
+            if (OpenAPI_backup_amf_info_writeJSON(writer, NULL, backup_amf_info_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [backup_amf_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", sm_context_create_data->trace_data) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->udm_group_id) {
+    if (OpenAPI_json_write_string(writer, "udmGroupId", sm_context_create_data->udm_group_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [udm_group_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->routing_indicator) {
+    if (OpenAPI_json_write_string(writer, "routingIndicator", sm_context_create_data->routing_indicator) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [routing_indicator]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->eps_interworking_ind) {
+    if (OpenAPI_json_write_string(writer, "epsInterworkingInd", OpenAPI_eps_interworking_indication_ToString(sm_context_create_data->eps_interworking_ind)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [eps_interworking_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_indirect_forwarding_flag) {
+    if (OpenAPI_json_write_bool(writer, "indirectForwardingFlag", sm_context_create_data->indirect_forwarding_flag) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [indirect_forwarding_flag]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_direct_forwarding_flag) {
+    if (OpenAPI_json_write_bool(writer, "directForwardingFlag", sm_context_create_data->direct_forwarding_flag) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [direct_forwarding_flag]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->target_id) {
+    if (OpenAPI_ng_ran_target_id_writeJSON(writer, "targetId", sm_context_create_data->target_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [target_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->eps_bearer_ctx_status) {
+    if (OpenAPI_json_write_string(writer, "epsBearerCtxStatus", sm_context_create_data->eps_bearer_ctx_status) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [eps_bearer_ctx_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_cp_ciot_enabled) {
+    if (OpenAPI_json_write_bool(writer, "cpCiotEnabled", sm_context_create_data->cp_ciot_enabled) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [cp_ciot_enabled]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_cp_only_ind) {
+    if (OpenAPI_json_write_bool(writer, "cpOnlyInd", sm_context_create_data->cp_only_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [cp_only_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_invoke_nef) {
+    if (OpenAPI_json_write_bool(writer, "invokeNef", sm_context_create_data->invoke_nef) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [invoke_nef]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_ma_request_ind) {
+    if (OpenAPI_json_write_bool(writer, "maRequestInd", sm_context_create_data->ma_request_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ma_request_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_ma_nw_upgrade_ind) {
+    if (OpenAPI_json_write_bool(writer, "maNwUpgradeInd", sm_context_create_data->ma_nw_upgrade_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ma_nw_upgrade_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_create_data->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_create_data->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->n2_sm_info_ext1) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfoExt1", sm_context_create_data->n2_sm_info_ext1) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [n2_sm_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->n2_sm_info_type_ext1) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoTypeExt1", OpenAPI_n2_sm_info_type_ToString(sm_context_create_data->n2_sm_info_type_ext1)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [n2_sm_info_type_ext1]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sm_context_ref) {
+    if (OpenAPI_json_write_string(writer, "smContextRef", sm_context_create_data->sm_context_ref) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_ref]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sm_context_smf_id) {
+    if (OpenAPI_json_write_string(writer, "smContextSmfId", sm_context_create_data->sm_context_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sm_context_smf_set_id) {
+    if (OpenAPI_json_write_string(writer, "smContextSmfSetId", sm_context_create_data->sm_context_smf_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_smf_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sm_context_smf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "smContextSmfServiceSetId", sm_context_create_data->sm_context_smf_service_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_smf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->sm_context_smf_binding) {
+    if (OpenAPI_json_write_string(writer, "smContextSmfBinding", OpenAPI_sbi_binding_level_ToString(sm_context_create_data->sm_context_smf_binding)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [sm_context_smf_binding]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->up_cnx_state) {
+    if (OpenAPI_json_write_string(writer, "upCnxState", OpenAPI_up_cnx_state_ToString(sm_context_create_data->up_cnx_state)) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [up_cnx_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", sm_context_create_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", sm_context_create_data->apn_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_extended_nas_sm_timer_ind) {
+    if (OpenAPI_json_write_bool(writer, "extendedNasSmTimerInd", sm_context_create_data->extended_nas_sm_timer_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [extended_nas_sm_timer_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_dl_data_waiting_ind) {
+    if (OpenAPI_json_write_bool(writer, "dlDataWaitingInd", sm_context_create_data->dl_data_waiting_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [dl_data_waiting_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->ddn_failure_subs) {
+    if (OpenAPI_ddn_failure_subs_writeJSON(writer, "ddnFailureSubs", sm_context_create_data->ddn_failure_subs) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ddn_failure_subs]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_smf_transfer_ind) {
+    if (OpenAPI_json_write_bool(writer, "smfTransferInd", sm_context_create_data->smf_transfer_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [smf_transfer_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->old_smf_id) {
+    if (OpenAPI_json_write_string(writer, "oldSmfId", sm_context_create_data->old_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [old_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->old_sm_context_ref) {
+    if (OpenAPI_json_write_string(writer, "oldSmContextRef", sm_context_create_data->old_sm_context_ref) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [old_sm_context_ref]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->w_agf_info) {
+    if (OpenAPI_w_agf_info_writeJSON(writer, "wAgfInfo", sm_context_create_data->w_agf_info) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [w_agf_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->tngf_info) {
+    if (OpenAPI_tngf_info_writeJSON(writer, "tngfInfo", sm_context_create_data->tngf_info) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [tngf_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->twif_info) {
+    if (OpenAPI_twif_info_writeJSON(writer, "twifInfo", sm_context_create_data->twif_info) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [twif_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_create_data->is_ran_unchanged_ind) {
+    if (OpenAPI_json_write_bool(writer, "ranUnchangedInd", sm_context_create_data->ran_unchanged_ind) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [ran_unchanged_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_create_data_writeJSON() failed [SmContextCreateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_create_data_t *OpenAPI_sm_context_create_data_parseFromJSON(cJSON *sm_context_create_dataJSON)
 {
     OpenAPI_sm_context_create_data_t *sm_context_create_data_local_var = NULL;
@@ -1850,7 +2477,6 @@ end:
 OpenAPI_sm_context_create_data_t *OpenAPI_sm_context_create_data_copy(OpenAPI_sm_context_create_data_t *dst, OpenAPI_sm_context_create_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_create_data_convertToJSON(src);
@@ -1859,21 +2485,6 @@ OpenAPI_sm_context_create_data_t *OpenAPI_sm_context_create_data_copy(OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_create_data_free(dst);
     dst = OpenAPI_sm_context_create_data_parseFromJSON(item);
     cJSON_Delete(item);
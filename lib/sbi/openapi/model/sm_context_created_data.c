@@ -213,6 +213,147 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_created_data_t *sm_context_created_data)
+{
+    if (sm_context_created_data == NULL) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [SmContextCreatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [SmContextCreatedData]");
+        return false;
+    }
+    if (sm_context_created_data->h_smf_uri) {
+    if (OpenAPI_json_write_string(writer, "hSmfUri", sm_context_created_data->h_smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [h_smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->smf_uri) {
+    if (OpenAPI_json_write_string(writer, "smfUri", sm_context_created_data->smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->is_pdu_session_id) {
+    if (OpenAPI_json_write_number(writer, "pduSessionId", sm_context_created_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", sm_context_created_data->s_nssai) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->up_cnx_state) {
+    if (OpenAPI_json_write_string(writer, "upCnxState", OpenAPI_up_cnx_state_ToString(sm_context_created_data->up_cnx_state)) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [up_cnx_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_created_data->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_created_data->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->allocated_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "allocatedEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allocated_ebi_list_node;
+    if (sm_context_created_data->allocated_ebi_list) {
+        OpenAPI_list_for_each(sm_context_created_data->allocated_ebi_list, allocated_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, allocated_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [allocated_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->ho_state) {
+    if (OpenAPI_json_write_string(writer, "hoState", OpenAPI_ho_state_ToString(sm_context_created_data->ho_state)) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [ho_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", sm_context_created_data->gpsi) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->smf_service_instance_id) {
+    if (OpenAPI_json_write_string(writer, "smfServiceInstanceId", sm_context_created_data->smf_service_instance_id) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [smf_service_instance_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", sm_context_created_data->recovery_time) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sm_context_created_data->supported_features) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->selected_smf_id) {
+    if (OpenAPI_json_write_string(writer, "selectedSmfId", sm_context_created_data->selected_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [selected_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_created_data->selected_old_smf_id) {
+    if (OpenAPI_json_write_string(writer, "selectedOldSmfId", sm_context_created_data->selected_old_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [selected_old_smf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_created_data_writeJSON() failed [SmContextCreatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_parseFromJSON(cJSON *sm_context_created_dataJSON)
 {
     OpenAPI_sm_context_created_data_t *sm_context_created_data_local_var = NULL;
@@ -400,7 +541,6 @@ end:
 OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_copy(OpenAPI_sm_context_created_data_t *dst, OpenAPI_sm_context_created_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_created_data_convertToJSON(src);
@@ -409,21 +549,6 @@ OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_created_data_free(dst);
     dst = OpenAPI_sm_context_created_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ebi_arp_mapping.h"
 #include "ho_state.h"
 #include "n2_sm_info_type.h"
@@ -64,6 +65,7 @@ OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_create(
 void OpenAPI_sm_context_created_data_free(OpenAPI_sm_context_created_data_t *sm_context_created_data);
 OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_parseFromJSON(cJSON *sm_context_created_dataJSON);
 cJSON *OpenAPI_sm_context_created_data_convertToJSON(OpenAPI_sm_context_created_data_t *sm_context_created_data);
+bool OpenAPI_sm_context_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_created_data_t *sm_context_created_data);
 OpenAPI_sm_context_created_data_t *OpenAPI_sm_context_created_data_copy(OpenAPI_sm_context_created_data_t *dst, OpenAPI_sm_context_created_data_t *src);
 
 #ifdef __cplusplus
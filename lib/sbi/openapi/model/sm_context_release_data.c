@@ -162,6 +162,98 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_release_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_release_data_t *sm_context_release_data)
+{
+    if (sm_context_release_data == NULL) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [SmContextReleaseData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [SmContextReleaseData]");
+        return false;
+    }
+    if (sm_context_release_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(sm_context_release_data->cause)) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", sm_context_release_data->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->is__5g_mm_cause_value) {
+    if (OpenAPI_json_write_number(writer, "5gMmCauseValue", sm_context_release_data->_5g_mm_cause_value) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [_5g_mm_cause_value]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", sm_context_release_data->ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_context_release_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", sm_context_release_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->is_vsmf_release_only) {
+    if (OpenAPI_json_write_bool(writer, "vsmfReleaseOnly", sm_context_release_data->vsmf_release_only) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [vsmf_release_only]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_release_data->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_release_data->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_release_data->is_ismf_release_only) {
+    if (OpenAPI_json_write_bool(writer, "ismfReleaseOnly", sm_context_release_data->ismf_release_only) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [ismf_release_only]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_release_data_writeJSON() failed [SmContextReleaseData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_parseFromJSON(cJSON *sm_context_release_dataJSON)
 {
     OpenAPI_sm_context_release_data_t *sm_context_release_data_local_var = NULL;
@@ -275,7 +367,6 @@ end:
 OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_copy(OpenAPI_sm_context_release_data_t *dst, OpenAPI_sm_context_release_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_release_data_convertToJSON(src);
@@ -284,21 +375,6 @@ OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_release_data_free(dst);
     dst = OpenAPI_sm_context_release_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "cause.h"
 #include "n2_sm_info_type.h"
 #include "ng_ap_cause.h"
@@ -57,6 +58,7 @@ OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_create(
 void OpenAPI_sm_context_release_data_free(OpenAPI_sm_context_release_data_t *sm_context_release_data);
 OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_parseFromJSON(cJSON *sm_context_release_dataJSON);
 cJSON *OpenAPI_sm_context_release_data_convertToJSON(OpenAPI_sm_context_release_data_t *sm_context_release_data);
+bool OpenAPI_sm_context_release_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_release_data_t *sm_context_release_data);
 OpenAPI_sm_context_release_data_t *OpenAPI_sm_context_release_data_copy(OpenAPI_sm_context_release_data_t *dst, OpenAPI_sm_context_release_data_t *src);
 
 #ifdef __cplusplus
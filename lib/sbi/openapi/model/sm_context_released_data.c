@@ -69,6 +69,42 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_released_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_released_data_t *sm_context_released_data)
+{
+    if (sm_context_released_data == NULL) {
+        ogs_error("OpenAPI_sm_context_released_data_writeJSON() failed [SmContextReleasedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_released_data_writeJSON() failed [SmContextReleasedData]");
+        return false;
+    }
+    if (sm_context_released_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", sm_context_released_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_released_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_released_data->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", sm_context_released_data->apn_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_released_data_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_released_data_writeJSON() failed [SmContextReleasedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_parseFromJSON(cJSON *sm_context_released_dataJSON)
 {
     OpenAPI_sm_context_released_data_t *sm_context_released_data_local_var = NULL;
@@ -99,7 +135,6 @@ end:
 OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_copy(OpenAPI_sm_context_released_data_t *dst, OpenAPI_sm_context_released_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_released_data_convertToJSON(src);
@@ -108,21 +143,6 @@ OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_released_data_free(dst);
     dst = OpenAPI_sm_context_released_data_parseFromJSON(item);
     cJSON_Delete(item);
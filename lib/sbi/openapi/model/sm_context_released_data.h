@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "apn_rate_status.h"
 #include "small_data_rate_status.h"
 
@@ -32,6 +33,7 @@ OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_create(
 void OpenAPI_sm_context_released_data_free(OpenAPI_sm_context_released_data_t *sm_context_released_data);
 OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_parseFromJSON(cJSON *sm_context_released_dataJSON);
 cJSON *OpenAPI_sm_context_released_data_convertToJSON(OpenAPI_sm_context_released_data_t *sm_context_released_data);
+bool OpenAPI_sm_context_released_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_released_data_t *sm_context_released_data);
 OpenAPI_sm_context_released_data_t *OpenAPI_sm_context_released_data_copy(OpenAPI_sm_context_released_data_t *dst, OpenAPI_sm_context_released_data_t *src);
 
 #ifdef __cplusplus
@@ -111,6 +111,75 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_retrieve_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_retrieve_data_t *sm_context_retrieve_data)
+{
+    if (sm_context_retrieve_data == NULL) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [SmContextRetrieveData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [SmContextRetrieveData]");
+        return false;
+    }
+    if (sm_context_retrieve_data->target_mme_cap) {
+    if (OpenAPI_mme_capabilities_writeJSON(writer, "targetMmeCap", sm_context_retrieve_data->target_mme_cap) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [target_mme_cap]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieve_data->sm_context_type) {
+    if (OpenAPI_json_write_string(writer, "smContextType", OpenAPI_sm_context_type_ToString(sm_context_retrieve_data->sm_context_type)) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [sm_context_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieve_data->serving_network) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "servingNetwork", sm_context_retrieve_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieve_data->not_to_transfer_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "notToTransferEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [not_to_transfer_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *not_to_transfer_ebi_list_node;
+    OpenAPI_list_for_each(sm_context_retrieve_data->not_to_transfer_ebi_list, not_to_transfer_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)not_to_transfer_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [not_to_transfer_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [not_to_transfer_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieve_data->is_ran_unchanged_ind) {
+    if (OpenAPI_json_write_bool(writer, "ranUnchangedInd", sm_context_retrieve_data->ran_unchanged_ind) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [ran_unchanged_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_retrieve_data_writeJSON() failed [SmContextRetrieveData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_retrieve_data_t *OpenAPI_sm_context_retrieve_data_parseFromJSON(cJSON *sm_context_retrieve_dataJSON)
 {
     OpenAPI_sm_context_retrieve_data_t *sm_context_retrieve_data_local_var = NULL;
@@ -185,7 +254,6 @@ end:
 OpenAPI_sm_context_retrieve_data_t *OpenAPI_sm_context_retrieve_data_copy(OpenAPI_sm_context_retrieve_data_t *dst, OpenAPI_sm_context_retrieve_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_retrieve_data_convertToJSON(src);
@@ -194,21 +262,6 @@ OpenAPI_sm_context_retrieve_data_t *OpenAPI_sm_context_retrieve_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_retrieve_data_free(dst);
     dst = OpenAPI_sm_context_retrieve_data_parseFromJSON(item);
     cJSON_Delete(item);
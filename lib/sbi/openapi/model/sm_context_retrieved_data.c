@@ -104,6 +104,61 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_retrieved_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_retrieved_data_t *sm_context_retrieved_data)
+{
+    if (sm_context_retrieved_data == NULL) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [SmContextRetrievedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [SmContextRetrievedData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "ueEpsPdnConnection", sm_context_retrieved_data->ue_eps_pdn_connection) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [ue_eps_pdn_connection]");
+        goto end;
+    }
+
+    if (sm_context_retrieved_data->sm_context) {
+    if (OpenAPI_sm_context_writeJSON(writer, "smContext", sm_context_retrieved_data->sm_context) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [sm_context]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieved_data->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", sm_context_retrieved_data->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieved_data->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", sm_context_retrieved_data->apn_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_retrieved_data->is_dl_data_waiting_ind) {
+    if (OpenAPI_json_write_bool(writer, "dlDataWaitingInd", sm_context_retrieved_data->dl_data_waiting_ind) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [dl_data_waiting_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_retrieved_data_writeJSON() failed [SmContextRetrievedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_retrieved_data_t *OpenAPI_sm_context_retrieved_data_parseFromJSON(cJSON *sm_context_retrieved_dataJSON)
 {
     OpenAPI_sm_context_retrieved_data_t *sm_context_retrieved_data_local_var = NULL;
@@ -165,7 +220,6 @@ end:
 OpenAPI_sm_context_retrieved_data_t *OpenAPI_sm_context_retrieved_data_copy(OpenAPI_sm_context_retrieved_data_t *dst, OpenAPI_sm_context_retrieved_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_retrieved_data_convertToJSON(src);
@@ -174,21 +228,6 @@ OpenAPI_sm_context_retrieved_data_t *OpenAPI_sm_context_retrieved_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_retrieved_data_free(dst);
     dst = OpenAPI_sm_context_retrieved_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -176,6 +176,115 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_status_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_status_notification_t *sm_context_status_notification)
+{
+    if (sm_context_status_notification == NULL) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [SmContextStatusNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [SmContextStatusNotification]");
+        return false;
+    }
+    if (OpenAPI_status_info_writeJSON(writer, "statusInfo", sm_context_status_notification->status_info) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [status_info]");
+        goto end;
+    }
+
+    if (sm_context_status_notification->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", sm_context_status_notification->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", sm_context_status_notification->apn_rate_status) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->is_ddn_failure_status) {
+    if (OpenAPI_json_write_bool(writer, "ddnFailureStatus", sm_context_status_notification->ddn_failure_status) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [ddn_failure_status]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->notify_correlation_ids_forddn_failure) {
+    if (OpenAPI_json_write_array_start(writer, "notifyCorrelationIdsForddnFailure") == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [notify_correlation_ids_forddn_failure]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *notify_correlation_ids_forddn_failure_node;
+    OpenAPI_list_for_each(sm_context_status_notification->notify_correlation_ids_forddn_failure, notify_correlation_ids_forddn_failure_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)notify_correlation_ids_forddn_failure_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [notify_correlation_ids_forddn_failure]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [notify_correlation_ids_forddn_failure]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->new_smf_id) {
+    if (OpenAPI_json_write_string(writer, "newSmfId", sm_context_status_notification->new_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [new_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->new_smf_set_id) {
+    if (OpenAPI_json_write_string(writer, "newSmfSetId", sm_context_status_notification->new_smf_set_id) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [new_smf_set_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->old_smf_id) {
+    if (OpenAPI_json_write_string(writer, "oldSmfId", sm_context_status_notification->old_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [old_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->old_sm_context_ref) {
+    if (OpenAPI_json_write_string(writer, "oldSmContextRef", sm_context_status_notification->old_sm_context_ref) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [old_sm_context_ref]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->alt_anchor_smf_uri) {
+    if (OpenAPI_json_write_string(writer, "altAnchorSmfUri", sm_context_status_notification->alt_anchor_smf_uri) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [alt_anchor_smf_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_status_notification->alt_anchor_smf_id) {
+    if (OpenAPI_json_write_string(writer, "altAnchorSmfId", sm_context_status_notification->alt_anchor_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [alt_anchor_smf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_status_notification_writeJSON() failed [SmContextStatusNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification_parseFromJSON(cJSON *sm_context_status_notificationJSON)
 {
     OpenAPI_sm_context_status_notification_t *sm_context_status_notification_local_var = NULL;
@@ -308,7 +417,6 @@ end:
 OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification_copy(OpenAPI_sm_context_status_notification_t *dst, OpenAPI_sm_context_status_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_status_notification_convertToJSON(src);
@@ -317,21 +425,6 @@ OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_status_notification_free(dst);
     dst = OpenAPI_sm_context_status_notification_parseFromJSON(item);
     cJSON_Delete(item);
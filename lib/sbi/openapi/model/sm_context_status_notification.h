@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "apn_rate_status.h"
 #include "small_data_rate_status.h"
 #include "status_info.h"
@@ -53,6 +54,7 @@ OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification
 void OpenAPI_sm_context_status_notification_free(OpenAPI_sm_context_status_notification_t *sm_context_status_notification);
 OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification_parseFromJSON(cJSON *sm_context_status_notificationJSON);
 cJSON *OpenAPI_sm_context_status_notification_convertToJSON(OpenAPI_sm_context_status_notification_t *sm_context_status_notification);
+bool OpenAPI_sm_context_status_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_status_notification_t *sm_context_status_notification);
 OpenAPI_sm_context_status_notification_t *OpenAPI_sm_context_status_notification_copy(OpenAPI_sm_context_status_notification_t *dst, OpenAPI_sm_context_status_notification_t *src);
 
 #ifdef __cplusplus
@@ -697,6 +697,449 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_update_data_t *sm_context_update_data)
+{
+    if (sm_context_update_data == NULL) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [SmContextUpdateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [SmContextUpdateData]");
+        return false;
+    }
+    if (sm_context_update_data->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", sm_context_update_data->pei) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->serving_nf_id) {
+    if (OpenAPI_json_write_string(writer, "servingNfId", sm_context_update_data->serving_nf_id) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [serving_nf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->guami) {
+    if (OpenAPI_guami_writeJSON(writer, "guami", sm_context_update_data->guami) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [guami]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", sm_context_update_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->backup_amf_info) {
+    if (OpenAPI_json_write_array_start(writer, "backupAmfInfo") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *backup_amf_info_node;
+    if (sm_context_update_data->backup_amf_info) {
+        OpenAPI_list_for_each(sm_context_update_data->backup_amf_info, backup_amf_info_node) {
+            if (OpenAPI_backup_amf_info_writeJSON(writer, NULL, backup_amf_info_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [backup_amf_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [backup_amf_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->an_type) {
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(sm_context_update_data->an_type)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [an_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->additional_an_type) {
+    if (OpenAPI_json_write_string(writer, "additionalAnType", OpenAPI_access_type_ToString(sm_context_update_data->additional_an_type)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [additional_an_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->an_type_to_reactivate) {
+    if (OpenAPI_json_write_string(writer, "anTypeToReactivate", OpenAPI_access_type_ToString(sm_context_update_data->an_type_to_reactivate)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [an_type_to_reactivate]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(sm_context_update_data->rat_type)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->presence_in_ladn) {
+    if (OpenAPI_json_write_string(writer, "presenceInLadn", OpenAPI_presence_state_ToString(sm_context_update_data->presence_in_ladn)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [presence_in_ladn]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", sm_context_update_data->ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_context_update_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", sm_context_update_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->up_cnx_state) {
+    if (OpenAPI_json_write_string(writer, "upCnxState", OpenAPI_up_cnx_state_ToString(sm_context_update_data->up_cnx_state)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [up_cnx_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ho_state) {
+    if (OpenAPI_json_write_string(writer, "hoState", OpenAPI_ho_state_ToString(sm_context_update_data->ho_state)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ho_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_to_be_switched) {
+    if (OpenAPI_json_write_bool(writer, "toBeSwitched", sm_context_update_data->to_be_switched) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [to_be_switched]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_failed_to_be_switched) {
+    if (OpenAPI_json_write_bool(writer, "failedToBeSwitched", sm_context_update_data->failed_to_be_switched) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [failed_to_be_switched]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n1_sm_msg) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmMsg", sm_context_update_data->n1_sm_msg) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n1_sm_msg]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_update_data->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_update_data->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->target_id) {
+    if (OpenAPI_ng_ran_target_id_writeJSON(writer, "targetId", sm_context_update_data->target_id) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [target_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->target_serving_nf_id) {
+    if (OpenAPI_json_write_string(writer, "targetServingNfId", sm_context_update_data->target_serving_nf_id) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [target_serving_nf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->sm_context_status_uri) {
+    if (OpenAPI_json_write_string(writer, "smContextStatusUri", sm_context_update_data->sm_context_status_uri) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [sm_context_status_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_data_forwarding) {
+    if (OpenAPI_json_write_bool(writer, "dataForwarding", sm_context_update_data->data_forwarding) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [data_forwarding]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n9_forwarding_tunnel) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "n9ForwardingTunnel", sm_context_update_data->n9_forwarding_tunnel) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_forwarding_tunnel]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n9_dl_forwarding_tnl_list) {
+    if (OpenAPI_json_write_array_start(writer, "n9DlForwardingTnlList") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_dl_forwarding_tnl_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n9_dl_forwarding_tnl_list_node;
+    if (sm_context_update_data->n9_dl_forwarding_tnl_list) {
+        OpenAPI_list_for_each(sm_context_update_data->n9_dl_forwarding_tnl_list, n9_dl_forwarding_tnl_list_node) {
+            if (OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON(writer, NULL, n9_dl_forwarding_tnl_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_dl_forwarding_tnl_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_dl_forwarding_tnl_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n9_ul_forwarding_tnl_list) {
+    if (OpenAPI_json_write_array_start(writer, "n9UlForwardingTnlList") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_ul_forwarding_tnl_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n9_ul_forwarding_tnl_list_node;
+    if (sm_context_update_data->n9_ul_forwarding_tnl_list) {
+        OpenAPI_list_for_each(sm_context_update_data->n9_ul_forwarding_tnl_list, n9_ul_forwarding_tnl_list_node) {
+            if (OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON(writer, NULL, n9_ul_forwarding_tnl_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_ul_forwarding_tnl_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n9_ul_forwarding_tnl_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->eps_bearer_setup) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerSetup") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_setup_node;
+    OpenAPI_list_for_each(sm_context_update_data->eps_bearer_setup, eps_bearer_setup_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)eps_bearer_setup_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->revoke_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "revokeEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *revoke_ebi_list_node;
+    OpenAPI_list_for_each(sm_context_update_data->revoke_ebi_list, revoke_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)revoke_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_release) {
+    if (OpenAPI_json_write_bool(writer, "release", sm_context_update_data->release) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [release]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(sm_context_update_data->cause)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", sm_context_update_data->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is__5g_mm_cause_value) {
+    if (OpenAPI_json_write_number(writer, "5gMmCauseValue", sm_context_update_data->_5g_mm_cause_value) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [_5g_mm_cause_value]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", sm_context_update_data->s_nssai) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", sm_context_update_data->trace_data) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->eps_interworking_ind) {
+    if (OpenAPI_json_write_string(writer, "epsInterworkingInd", OpenAPI_eps_interworking_indication_ToString(sm_context_update_data->eps_interworking_ind)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [eps_interworking_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_an_type_can_be_changed) {
+    if (OpenAPI_json_write_bool(writer, "anTypeCanBeChanged", sm_context_update_data->an_type_can_be_changed) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [an_type_can_be_changed]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n2_sm_info_ext1) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfoExt1", sm_context_update_data->n2_sm_info_ext1) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n2_sm_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->n2_sm_info_type_ext1) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoTypeExt1", OpenAPI_n2_sm_info_type_ToString(sm_context_update_data->n2_sm_info_type_ext1)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [n2_sm_info_type_ext1]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ma_release_ind) {
+    if (OpenAPI_json_write_string(writer, "maReleaseInd", OpenAPI_ma_release_indication_ToString(sm_context_update_data->ma_release_ind)) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ma_release_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_ma_nw_upgrade_ind) {
+    if (OpenAPI_json_write_bool(writer, "maNwUpgradeInd", sm_context_update_data->ma_nw_upgrade_ind) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ma_nw_upgrade_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_ma_request_ind) {
+    if (OpenAPI_json_write_bool(writer, "maRequestInd", sm_context_update_data->ma_request_ind) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ma_request_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->exemption_ind) {
+    if (OpenAPI_exemption_ind_writeJSON(writer, "exemptionInd", sm_context_update_data->exemption_ind) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [exemption_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sm_context_update_data->supported_features) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->mo_exp_data_counter) {
+    if (OpenAPI_mo_exp_data_counter_writeJSON(writer, "moExpDataCounter", sm_context_update_data->mo_exp_data_counter) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [mo_exp_data_counter]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->is_extended_nas_sm_timer_ind) {
+    if (OpenAPI_json_write_bool(writer, "extendedNasSmTimerInd", sm_context_update_data->extended_nas_sm_timer_ind) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [extended_nas_sm_timer_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->forwarding_f_teid) {
+    if (OpenAPI_json_write_number(writer, "forwardingFTeid", sm_context_update_data->forwarding_f_teid) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [forwarding_f_teid]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->forwarding_bearer_contexts) {
+    if (OpenAPI_json_write_array_start(writer, "forwardingBearerContexts") == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *forwarding_bearer_contexts_node;
+    OpenAPI_list_for_each(sm_context_update_data->forwarding_bearer_contexts, forwarding_bearer_contexts_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)forwarding_bearer_contexts_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_data->ddn_failure_subs) {
+    if (OpenAPI_ddn_failure_subs_writeJSON(writer, "ddnFailureSubs", sm_context_update_data->ddn_failure_subs) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [ddn_failure_subs]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_data_writeJSON() failed [SmContextUpdateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_update_data_t *OpenAPI_sm_context_update_data_parseFromJSON(cJSON *sm_context_update_dataJSON)
 {
     OpenAPI_sm_context_update_data_t *sm_context_update_data_local_var = NULL;
@@ -1297,7 +1740,6 @@ end:
 OpenAPI_sm_context_update_data_t *OpenAPI_sm_context_update_data_copy(OpenAPI_sm_context_update_data_t *dst, OpenAPI_sm_context_update_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_update_data_convertToJSON(src);
@@ -1306,21 +1748,6 @@ OpenAPI_sm_context_update_data_t *OpenAPI_sm_context_update_data_copy(OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_update_data_free(dst);
     dst = OpenAPI_sm_context_update_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,6 +111,68 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_update_error_t *sm_context_update_error)
+{
+    if (sm_context_update_error == NULL) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [SmContextUpdateError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [SmContextUpdateError]");
+        return false;
+    }
+    if (OpenAPI_ext_problem_details_writeJSON(writer, "error", sm_context_update_error->error) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (sm_context_update_error->n1_sm_msg) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmMsg", sm_context_update_error->n1_sm_msg) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [n1_sm_msg]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_error->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_update_error->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_error->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_update_error->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_error->up_cnx_state) {
+    if (OpenAPI_json_write_string(writer, "upCnxState", OpenAPI_up_cnx_state_ToString(sm_context_update_error->up_cnx_state)) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [up_cnx_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_update_error->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", sm_context_update_error->recovery_time) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_update_error_writeJSON() failed [SmContextUpdateError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_parseFromJSON(cJSON *sm_context_update_errorJSON)
 {
     OpenAPI_sm_context_update_error_t *sm_context_update_error_local_var = NULL;
@@ -185,7 +247,6 @@ end:
 OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_copy(OpenAPI_sm_context_update_error_t *dst, OpenAPI_sm_context_update_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_update_error_convertToJSON(src);
@@ -194,21 +255,6 @@ OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_update_error_free(dst);
     dst = OpenAPI_sm_context_update_error_parseFromJSON(item);
     cJSON_Delete(item);
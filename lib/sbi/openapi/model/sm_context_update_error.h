@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ext_problem_details.h"
 #include "n2_sm_info_type.h"
 #include "ref_to_binary_data.h"
@@ -42,6 +43,7 @@ OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_create(
 void OpenAPI_sm_context_update_error_free(OpenAPI_sm_context_update_error_t *sm_context_update_error);
 OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_parseFromJSON(cJSON *sm_context_update_errorJSON);
 cJSON *OpenAPI_sm_context_update_error_convertToJSON(OpenAPI_sm_context_update_error_t *sm_context_update_error);
+bool OpenAPI_sm_context_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_update_error_t *sm_context_update_error);
 OpenAPI_sm_context_update_error_t *OpenAPI_sm_context_update_error_copy(OpenAPI_sm_context_update_error_t *dst, OpenAPI_sm_context_update_error_t *src);
 
 #ifdef __cplusplus
@@ -336,6 +336,253 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_context_updated_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_context_updated_data_t *sm_context_updated_data)
+{
+    if (sm_context_updated_data == NULL) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [SmContextUpdatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [SmContextUpdatedData]");
+        return false;
+    }
+    if (sm_context_updated_data->up_cnx_state) {
+    if (OpenAPI_json_write_string(writer, "upCnxState", OpenAPI_up_cnx_state_ToString(sm_context_updated_data->up_cnx_state)) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [up_cnx_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->ho_state) {
+    if (OpenAPI_json_write_string(writer, "hoState", OpenAPI_ho_state_ToString(sm_context_updated_data->ho_state)) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [ho_state]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->release_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "releaseEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [release_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *release_ebi_list_node;
+    OpenAPI_list_for_each(sm_context_updated_data->release_ebi_list, release_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)release_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [release_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [release_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->allocated_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "allocatedEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allocated_ebi_list_node;
+    if (sm_context_updated_data->allocated_ebi_list) {
+        OpenAPI_list_for_each(sm_context_updated_data->allocated_ebi_list, allocated_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, allocated_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [allocated_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [allocated_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->modified_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "modifiedEbiList") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [modified_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *modified_ebi_list_node;
+    if (sm_context_updated_data->modified_ebi_list) {
+        OpenAPI_list_for_each(sm_context_updated_data->modified_ebi_list, modified_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, modified_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [modified_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [modified_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->n1_sm_msg) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmMsg", sm_context_updated_data->n1_sm_msg) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n1_sm_msg]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->n2_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n2SmInfo", sm_context_updated_data->n2_sm_info) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n2_sm_info]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->n2_sm_info_type) {
+    if (OpenAPI_json_write_string(writer, "n2SmInfoType", OpenAPI_n2_sm_info_type_ToString(sm_context_updated_data->n2_sm_info_type)) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n2_sm_info_type]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->eps_bearer_setup) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerSetup") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_setup_node;
+    OpenAPI_list_for_each(sm_context_updated_data->eps_bearer_setup, eps_bearer_setup_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)eps_bearer_setup_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [eps_bearer_setup]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->is_data_forwarding) {
+    if (OpenAPI_json_write_bool(writer, "dataForwarding", sm_context_updated_data->data_forwarding) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [data_forwarding]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->n3_dl_forwarding_tnl_list) {
+    if (OpenAPI_json_write_array_start(writer, "n3DlForwardingTnlList") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_dl_forwarding_tnl_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n3_dl_forwarding_tnl_list_node;
+    if (sm_context_updated_data->n3_dl_forwarding_tnl_list) {
+        OpenAPI_list_for_each(sm_context_updated_data->n3_dl_forwarding_tnl_list, n3_dl_forwarding_tnl_list_node) {
+            if (OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON(writer, NULL, n3_dl_forwarding_tnl_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_dl_forwarding_tnl_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_dl_forwarding_tnl_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->n3_ul_forwarding_tnl_list) {
+    if (OpenAPI_json_write_array_start(writer, "n3UlForwardingTnlList") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_ul_forwarding_tnl_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *n3_ul_forwarding_tnl_list_node;
+    if (sm_context_updated_data->n3_ul_forwarding_tnl_list) {
+        OpenAPI_list_for_each(sm_context_updated_data->n3_ul_forwarding_tnl_list, n3_ul_forwarding_tnl_list_node) {
+            if (OpenAPI_indirect_data_forwarding_tunnel_info_writeJSON(writer, NULL, n3_ul_forwarding_tnl_list_node->data) == false) {
+                ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_ul_forwarding_tnl_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [n3_ul_forwarding_tnl_list]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(sm_context_updated_data->cause)) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->is_ma_accepted_ind) {
+    if (OpenAPI_json_write_bool(writer, "maAcceptedInd", sm_context_updated_data->ma_accepted_ind) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [ma_accepted_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sm_context_updated_data->supported_features) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->forwarding_f_teid) {
+    if (OpenAPI_json_write_number(writer, "forwardingFTeid", sm_context_updated_data->forwarding_f_teid) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [forwarding_f_teid]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->forwarding_bearer_contexts) {
+    if (OpenAPI_json_write_array_start(writer, "forwardingBearerContexts") == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *forwarding_bearer_contexts_node;
+    OpenAPI_list_for_each(sm_context_updated_data->forwarding_bearer_contexts, forwarding_bearer_contexts_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)forwarding_bearer_contexts_node->data) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [forwarding_bearer_contexts]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->selected_smf_id) {
+    if (OpenAPI_json_write_string(writer, "selectedSmfId", sm_context_updated_data->selected_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [selected_smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_context_updated_data->selected_old_smf_id) {
+    if (OpenAPI_json_write_string(writer, "selectedOldSmfId", sm_context_updated_data->selected_old_smf_id) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [selected_old_smf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_context_updated_data_writeJSON() failed [SmContextUpdatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_context_updated_data_t *OpenAPI_sm_context_updated_data_parseFromJSON(cJSON *sm_context_updated_dataJSON)
 {
     OpenAPI_sm_context_updated_data_t *sm_context_updated_data_local_var = NULL;
@@ -659,7 +906,6 @@ end:
 OpenAPI_sm_context_updated_data_t *OpenAPI_sm_context_updated_data_copy(OpenAPI_sm_context_updated_data_t *dst, OpenAPI_sm_context_updated_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_context_updated_data_convertToJSON(src);
@@ -668,21 +914,6 @@ OpenAPI_sm_context_updated_data_t *OpenAPI_sm_context_updated_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_context_updated_data_free(dst);
     dst = OpenAPI_sm_context_updated_data_parseFromJSON(item);
     cJSON_Delete(item);
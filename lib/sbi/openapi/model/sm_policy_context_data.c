@@ -552,6 +552,346 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_context_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_context_data_t *sm_policy_context_data)
+{
+    if (sm_policy_context_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [SmPolicyContextData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [SmPolicyContextData]");
+        return false;
+    }
+    if (sm_policy_context_data->acc_net_ch_id) {
+    if (OpenAPI_acc_net_ch_id_writeJSON(writer, "accNetChId", sm_policy_context_data->acc_net_ch_id) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [acc_net_ch_id]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->charg_entity_addr) {
+    if (OpenAPI_acc_net_charging_address_writeJSON(writer, "chargEntityAddr", sm_policy_context_data->charg_entity_addr) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [charg_entity_addr]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", sm_policy_context_data->gpsi) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "supi", sm_policy_context_data->supi) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (sm_policy_context_data->is_invalid_supi) {
+    if (OpenAPI_json_write_bool(writer, "invalidSupi", sm_policy_context_data->invalid_supi) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [invalid_supi]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->inter_grp_ids) {
+    if (OpenAPI_json_write_array_start(writer, "interGrpIds") == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *inter_grp_ids_node;
+    OpenAPI_list_for_each(sm_policy_context_data->inter_grp_ids, inter_grp_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)inter_grp_ids_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "pduSessionId", sm_policy_context_data->pdu_session_id) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "pduSessionType", OpenAPI_pdu_session_type_ToString(sm_policy_context_data->pdu_session_type)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [pdu_session_type]");
+        goto end;
+    }
+
+    if (sm_policy_context_data->chargingcharacteristics) {
+    if (OpenAPI_json_write_string(writer, "chargingcharacteristics", sm_policy_context_data->chargingcharacteristics) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [chargingcharacteristics]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnn", sm_policy_context_data->dnn) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (sm_policy_context_data->dnn_sel_mode) {
+    if (OpenAPI_json_write_string(writer, "dnnSelMode", OpenAPI_dnn_selection_mode_ToString(sm_policy_context_data->dnn_sel_mode)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [dnn_sel_mode]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "notificationUri", sm_policy_context_data->notification_uri) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (sm_policy_context_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(sm_policy_context_data->access_type)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(sm_policy_context_data->rat_type)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->add_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "addAccessInfo", sm_policy_context_data->add_access_info) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [add_access_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", sm_policy_context_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->user_location_info) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLocationInfo", sm_policy_context_data->user_location_info) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [user_location_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_policy_context_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", sm_policy_context_data->pei) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "ipv4Address", sm_policy_context_data->ipv4_address) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ipv6_address_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6AddressPrefix", sm_policy_context_data->ipv6_address_prefix) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv6_address_prefix]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", sm_policy_context_data->ip_domain) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->subs_sess_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "subsSessAmbr", sm_policy_context_data->subs_sess_ambr) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [subs_sess_ambr]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->auth_prof_index) {
+    if (OpenAPI_json_write_string(writer, "authProfIndex", sm_policy_context_data->auth_prof_index) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [auth_prof_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->subs_def_qos) {
+    if (OpenAPI_subscribed_default_qos_writeJSON(writer, "subsDefQos", sm_policy_context_data->subs_def_qos) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [subs_def_qos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->vplmn_qos) {
+    if (OpenAPI_vplmn_qos_writeJSON(writer, "vplmnQos", sm_policy_context_data->vplmn_qos) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [vplmn_qos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->is_num_of_pack_filter) {
+    if (OpenAPI_json_write_number(writer, "numOfPackFilter", sm_policy_context_data->num_of_pack_filter) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [num_of_pack_filter]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->is_online) {
+    if (OpenAPI_json_write_bool(writer, "online", sm_policy_context_data->online) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [online]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->is_offline) {
+    if (OpenAPI_json_write_bool(writer, "offline", sm_policy_context_data->offline) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [offline]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->is__3gpp_ps_data_off_status) {
+    if (OpenAPI_json_write_bool(writer, "3gppPsDataOffStatus", sm_policy_context_data->_3gpp_ps_data_off_status) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [_3gpp_ps_data_off_status]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->is_ref_qos_indication) {
+    if (OpenAPI_json_write_bool(writer, "refQosIndication", sm_policy_context_data->ref_qos_indication) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ref_qos_indication]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->trace_req) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceReq", sm_policy_context_data->trace_req) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [trace_req]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "sliceInfo", sm_policy_context_data->slice_info) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [slice_info]");
+        goto end;
+    }
+
+    if (sm_policy_context_data->qos_flow_usage) {
+    if (OpenAPI_json_write_string(writer, "qosFlowUsage", OpenAPI_qos_flow_usage_ToString(sm_policy_context_data->qos_flow_usage)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [qos_flow_usage]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->serv_nf_id) {
+    if (OpenAPI_serving_nf_identity_writeJSON(writer, "servNfId", sm_policy_context_data->serv_nf_id) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [serv_nf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", sm_policy_context_data->supp_feat) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->smf_id) {
+    if (OpenAPI_json_write_string(writer, "smfId", sm_policy_context_data->smf_id) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [smf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", sm_policy_context_data->recovery_time) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ma_pdu_ind) {
+    if (OpenAPI_json_write_string(writer, "maPduInd", OpenAPI_ma_pdu_indication_ToString(sm_policy_context_data->ma_pdu_ind)) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ma_pdu_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->atsss_capab) {
+    if (OpenAPI_atsss_capability_writeJSON(writer, "atsssCapab", sm_policy_context_data->atsss_capab) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [atsss_capab]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ipv4_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4FrameRouteList") == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_frame_route_list_node;
+    OpenAPI_list_for_each(sm_policy_context_data->ipv4_frame_route_list, ipv4_frame_route_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_frame_route_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv4_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_context_data->ipv6_frame_route_list) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6FrameRouteList") == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_frame_route_list_node;
+    OpenAPI_list_for_each(sm_policy_context_data->ipv6_frame_route_list, ipv6_frame_route_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_frame_route_list_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [ipv6_frame_route_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_context_data_writeJSON() failed [SmPolicyContextData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_context_data_t *OpenAPI_sm_policy_context_data_parseFromJSON(cJSON *sm_policy_context_dataJSON)
 {
     OpenAPI_sm_policy_context_data_t *sm_policy_context_data_local_var = NULL;
@@ -1026,7 +1366,6 @@ end:
 OpenAPI_sm_policy_context_data_t *OpenAPI_sm_policy_context_data_copy(OpenAPI_sm_policy_context_data_t *dst, OpenAPI_sm_policy_context_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_context_data_convertToJSON(src);
@@ -1035,21 +1374,6 @@ OpenAPI_sm_policy_context_data_t *OpenAPI_sm_policy_context_data_copy(OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_context_data_free(dst);
     dst = OpenAPI_sm_policy_context_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -65,6 +65,38 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_control_t *sm_policy_control)
+{
+    if (sm_policy_control == NULL) {
+        ogs_error("OpenAPI_sm_policy_control_writeJSON() failed [SmPolicyControl]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_control_writeJSON() failed [SmPolicyControl]");
+        return false;
+    }
+    if (OpenAPI_sm_policy_context_data_writeJSON(writer, "context", sm_policy_control->context) == false) {
+        ogs_error("OpenAPI_sm_policy_control_writeJSON() failed [context]");
+        goto end;
+    }
+
+    if (OpenAPI_sm_policy_decision_writeJSON(writer, "policy", sm_policy_control->policy) == false) {
+        ogs_error("OpenAPI_sm_policy_control_writeJSON() failed [policy]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_control_writeJSON() failed [SmPolicyControl]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_parseFromJSON(cJSON *sm_policy_controlJSON)
 {
     OpenAPI_sm_policy_control_t *sm_policy_control_local_var = NULL;
@@ -99,7 +131,6 @@ end:
 OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_copy(OpenAPI_sm_policy_control_t *dst, OpenAPI_sm_policy_control_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_control_convertToJSON(src);
@@ -108,21 +139,6 @@ OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_copy(OpenAPI_sm_policy_co
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_control_free(dst);
     dst = OpenAPI_sm_policy_control_parseFromJSON(item);
     cJSON_Delete(item);
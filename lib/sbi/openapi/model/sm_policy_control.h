@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sm_policy_context_data.h"
 #include "sm_policy_decision.h"
 
@@ -32,6 +33,7 @@ OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_create(
 void OpenAPI_sm_policy_control_free(OpenAPI_sm_policy_control_t *sm_policy_control);
 OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_parseFromJSON(cJSON *sm_policy_controlJSON);
 cJSON *OpenAPI_sm_policy_control_convertToJSON(OpenAPI_sm_policy_control_t *sm_policy_control);
+bool OpenAPI_sm_policy_control_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_control_t *sm_policy_control);
 OpenAPI_sm_policy_control_t *OpenAPI_sm_policy_control_copy(OpenAPI_sm_policy_control_t *dst, OpenAPI_sm_policy_control_t *src);
 
 #ifdef __cplusplus
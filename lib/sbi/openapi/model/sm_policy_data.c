@@ -141,6 +141,102 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_data_t *sm_policy_data)
+{
+    if (sm_policy_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [SmPolicyData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [SmPolicyData]");
+        return false;
+    }
+    if (OpenAPI_json_write_object_start(writer, "smPolicySnssaiData") == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [sm_policy_snssai_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sm_policy_snssai_data_node;
+    if (sm_policy_data->sm_policy_snssai_data) {
+        OpenAPI_list_for_each(sm_policy_data->sm_policy_snssai_data, sm_policy_snssai_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)sm_policy_snssai_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_sm_policy_snssai_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [sm_policy_snssai_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [sm_policy_snssai_data]");
+        goto end;
+    }
+
+    if (sm_policy_data->um_data_limits) {
+    if (OpenAPI_json_write_object_start(writer, "umDataLimits") == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data_limits]");
+        goto end;
+    }
+    OpenAPI_lnode_t *um_data_limits_node;
+    if (sm_policy_data->um_data_limits) {
+        OpenAPI_list_for_each(sm_policy_data->um_data_limits, um_data_limits_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)um_data_limits_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_mon_data_limit_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data_limits]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data_limits]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_data->um_data) {
+    if (OpenAPI_json_write_object_start(writer, "umData") == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *um_data_node;
+    if (sm_policy_data->um_data) {
+        OpenAPI_list_for_each(sm_policy_data->um_data, um_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)um_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_mon_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [um_data]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", sm_policy_data->supp_feat) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_writeJSON() failed [SmPolicyData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_parseFromJSON(cJSON *sm_policy_dataJSON)
 {
     OpenAPI_sm_policy_data_t *sm_policy_data_local_var = NULL;
@@ -248,7 +344,6 @@ end:
 OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_copy(OpenAPI_sm_policy_data_t *dst, OpenAPI_sm_policy_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_data_convertToJSON(src);
@@ -257,21 +352,6 @@ OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_copy(OpenAPI_sm_policy_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_data_free(dst);
     dst = OpenAPI_sm_policy_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sm_policy_snssai_data.h"
 #include "usage_mon_data.h"
 #include "usage_mon_data_limit.h"
@@ -37,6 +38,7 @@ OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_create(
 void OpenAPI_sm_policy_data_free(OpenAPI_sm_policy_data_t *sm_policy_data);
 OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_parseFromJSON(cJSON *sm_policy_dataJSON);
 cJSON *OpenAPI_sm_policy_data_convertToJSON(OpenAPI_sm_policy_data_t *sm_policy_data);
+bool OpenAPI_sm_policy_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_data_t *sm_policy_data);
 OpenAPI_sm_policy_data_t *OpenAPI_sm_policy_data_copy(OpenAPI_sm_policy_data_t *dst, OpenAPI_sm_policy_data_t *src);
 
 #ifdef __cplusplus
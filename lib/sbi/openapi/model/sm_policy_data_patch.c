@@ -101,6 +101,74 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_data_patch_t *sm_policy_data_patch)
+{
+    if (sm_policy_data_patch == NULL) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [SmPolicyDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [SmPolicyDataPatch]");
+        return false;
+    }
+    if (sm_policy_data_patch->um_data) {
+    if (OpenAPI_json_write_object_start(writer, "umData") == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [um_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *um_data_node;
+    if (sm_policy_data_patch->um_data) {
+        OpenAPI_list_for_each(sm_policy_data_patch->um_data, um_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)um_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_mon_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [um_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [um_data]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_data_patch->sm_policy_snssai_data) {
+    if (OpenAPI_json_write_object_start(writer, "smPolicySnssaiData") == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [sm_policy_snssai_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sm_policy_snssai_data_node;
+    if (sm_policy_data_patch->sm_policy_snssai_data) {
+        OpenAPI_list_for_each(sm_policy_data_patch->sm_policy_snssai_data, sm_policy_snssai_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)sm_policy_snssai_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_sm_policy_snssai_data_patch_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [sm_policy_snssai_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [sm_policy_snssai_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_data_patch_writeJSON() failed [SmPolicyDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_parseFromJSON(cJSON *sm_policy_data_patchJSON)
 {
     OpenAPI_sm_policy_data_patch_t *sm_policy_data_patch_local_var = NULL;
@@ -169,7 +237,6 @@ end:
 OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_copy(OpenAPI_sm_policy_data_patch_t *dst, OpenAPI_sm_policy_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_data_patch_convertToJSON(src);
@@ -178,21 +245,6 @@ OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_copy(OpenAPI_sm_pol
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_data_patch_free(dst);
     dst = OpenAPI_sm_policy_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sm_policy_snssai_data_patch.h"
 #include "usage_mon_data.h"
 
@@ -32,6 +33,7 @@ OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_create(
 void OpenAPI_sm_policy_data_patch_free(OpenAPI_sm_policy_data_patch_t *sm_policy_data_patch);
 OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_parseFromJSON(cJSON *sm_policy_data_patchJSON);
 cJSON *OpenAPI_sm_policy_data_patch_convertToJSON(OpenAPI_sm_policy_data_patch_t *sm_policy_data_patch);
+bool OpenAPI_sm_policy_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_data_patch_t *sm_policy_data_patch);
 OpenAPI_sm_policy_data_patch_t *OpenAPI_sm_policy_data_patch_copy(OpenAPI_sm_policy_data_patch_t *dst, OpenAPI_sm_policy_data_patch_t *src);
 
 #ifdef __cplusplus
@@ -606,6 +606,423 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_decision_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_decision_t *sm_policy_decision)
+{
+    if (sm_policy_decision == NULL) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [SmPolicyDecision]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [SmPolicyDecision]");
+        return false;
+    }
+    if (sm_policy_decision->sess_rules) {
+    if (OpenAPI_json_write_object_start(writer, "sessRules") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [sess_rules]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sess_rules_node;
+    if (sm_policy_decision->sess_rules) {
+        OpenAPI_list_for_each(sm_policy_decision->sess_rules, sess_rules_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)sess_rules_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_session_rule_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [sess_rules]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [sess_rules]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->pcc_rules) {
+    if (OpenAPI_json_write_object_start(writer, "pccRules") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pcc_rules]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pcc_rules_node;
+    if (sm_policy_decision->pcc_rules) {
+        OpenAPI_list_for_each(sm_policy_decision->pcc_rules, pcc_rules_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pcc_rules_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_pcc_rule_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pcc_rules]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pcc_rules]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_pcscf_rest_indication) {
+    if (OpenAPI_json_write_bool(writer, "pcscfRestIndication", sm_policy_decision->pcscf_rest_indication) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pcscf_rest_indication]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->qos_decs) {
+    if (OpenAPI_json_write_object_start(writer, "qosDecs") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_decs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *qos_decs_node;
+    if (sm_policy_decision->qos_decs) {
+        OpenAPI_list_for_each(sm_policy_decision->qos_decs, qos_decs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)qos_decs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_qos_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_decs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_decs]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->chg_decs) {
+    if (OpenAPI_json_write_object_start(writer, "chgDecs") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [chg_decs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *chg_decs_node;
+    if (sm_policy_decision->chg_decs) {
+        OpenAPI_list_for_each(sm_policy_decision->chg_decs, chg_decs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)chg_decs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_charging_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [chg_decs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [chg_decs]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->charging_info) {
+    if (OpenAPI_charging_information_writeJSON(writer, "chargingInfo", sm_policy_decision->charging_info) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [charging_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->traff_cont_decs) {
+    if (OpenAPI_json_write_object_start(writer, "traffContDecs") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [traff_cont_decs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *traff_cont_decs_node;
+    if (sm_policy_decision->traff_cont_decs) {
+        OpenAPI_list_for_each(sm_policy_decision->traff_cont_decs, traff_cont_decs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)traff_cont_decs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_traffic_control_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [traff_cont_decs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [traff_cont_decs]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->um_decs) {
+    if (OpenAPI_json_write_object_start(writer, "umDecs") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [um_decs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *um_decs_node;
+    if (sm_policy_decision->um_decs) {
+        OpenAPI_list_for_each(sm_policy_decision->um_decs, um_decs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)um_decs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_monitoring_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [um_decs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [um_decs]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->qos_chars) {
+    if (OpenAPI_json_write_object_start(writer, "qosChars") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_chars]");
+        goto end;
+    }
+    OpenAPI_lnode_t *qos_chars_node;
+    if (sm_policy_decision->qos_chars) {
+        OpenAPI_list_for_each(sm_policy_decision->qos_chars, qos_chars_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)qos_chars_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_qos_characteristics_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_chars]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_chars]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->qos_mon_decs) {
+    if (OpenAPI_json_write_object_start(writer, "qosMonDecs") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_mon_decs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *qos_mon_decs_node;
+    if (sm_policy_decision->qos_mon_decs) {
+        OpenAPI_list_for_each(sm_policy_decision->qos_mon_decs, qos_mon_decs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)qos_mon_decs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_qos_monitoring_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_mon_decs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_mon_decs]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_reflective_qo_s_timer) {
+    if (OpenAPI_json_write_number(writer, "reflectiveQoSTimer", sm_policy_decision->reflective_qo_s_timer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [reflective_qo_s_timer]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->conds) {
+    if (OpenAPI_json_write_object_start(writer, "conds") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [conds]");
+        goto end;
+    }
+    OpenAPI_lnode_t *conds_node;
+    if (sm_policy_decision->conds) {
+        OpenAPI_list_for_each(sm_policy_decision->conds, conds_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)conds_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_condition_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [conds]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [conds]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->revalidation_time) {
+    if (OpenAPI_json_write_string(writer, "revalidationTime", sm_policy_decision->revalidation_time) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [revalidation_time]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_offline) {
+    if (OpenAPI_json_write_bool(writer, "offline", sm_policy_decision->offline) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [offline]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_online) {
+    if (OpenAPI_json_write_bool(writer, "online", sm_policy_decision->online) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [online]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->policy_ctrl_req_triggers) {
+    if (OpenAPI_json_write_array_start(writer, "policyCtrlReqTriggers") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [policy_ctrl_req_triggers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *policy_ctrl_req_triggers_node;
+    OpenAPI_list_for_each(sm_policy_decision->policy_ctrl_req_triggers, policy_ctrl_req_triggers_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_control_request_trigger_ToString((intptr_t)policy_ctrl_req_triggers_node->data)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [policy_ctrl_req_triggers]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [policy_ctrl_req_triggers]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->last_req_rule_data) {
+    if (OpenAPI_json_write_array_start(writer, "lastReqRuleData") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [last_req_rule_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *last_req_rule_data_node;
+    if (sm_policy_decision->last_req_rule_data) {
+        OpenAPI_list_for_each(sm_policy_decision->last_req_rule_data, last_req_rule_data_node) {
+            if (OpenAPI_requested_rule_data_writeJSON(writer, NULL, last_req_rule_data_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [last_req_rule_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [last_req_rule_data]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->last_req_usage_data) {
+    if (OpenAPI_requested_usage_data_writeJSON(writer, "lastReqUsageData", sm_policy_decision->last_req_usage_data) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [last_req_usage_data]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->pra_infos) {
+    if (OpenAPI_json_write_object_start(writer, "praInfos") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pra_infos_node;
+    if (sm_policy_decision->pra_infos) {
+        OpenAPI_list_for_each(sm_policy_decision->pra_infos, pra_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pra_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_rm_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pra_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_ipv4_index) {
+    if (OpenAPI_json_write_number(writer, "ipv4Index", sm_policy_decision->ipv4_index) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [ipv4_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_ipv6_index) {
+    if (OpenAPI_json_write_number(writer, "ipv6Index", sm_policy_decision->ipv6_index) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [ipv6_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->qos_flow_usage) {
+    if (OpenAPI_json_write_string(writer, "qosFlowUsage", OpenAPI_qos_flow_usage_ToString(sm_policy_decision->qos_flow_usage)) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [qos_flow_usage]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->rel_cause) {
+    if (OpenAPI_json_write_string(writer, "relCause", OpenAPI_sm_policy_association_release_cause_ToString(sm_policy_decision->rel_cause)) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [rel_cause]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", sm_policy_decision->supp_feat) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", sm_policy_decision->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", sm_policy_decision->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (sm_policy_decision->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(sm_policy_decision->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_decision->is_red_sess_indication) {
+    if (OpenAPI_json_write_bool(writer, "redSessIndication", sm_policy_decision->red_sess_indication) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [red_sess_indication]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_decision_writeJSON() failed [SmPolicyDecision]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_parseFromJSON(cJSON *sm_policy_decisionJSON)
 {
     OpenAPI_sm_policy_decision_t *sm_policy_decision_local_var = NULL;
@@ -1126,7 +1543,6 @@ end:
 OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_copy(OpenAPI_sm_policy_decision_t *dst, OpenAPI_sm_policy_decision_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_decision_convertToJSON(src);
@@ -1135,21 +1551,6 @@ OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_copy(OpenAPI_sm_policy_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_decision_free(dst);
     dst = OpenAPI_sm_policy_decision_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "bridge_management_container.h"
 #include "charging_data.h"
 #include "charging_information.h"
@@ -114,6 +115,7 @@ OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_create(
 void OpenAPI_sm_policy_decision_free(OpenAPI_sm_policy_decision_t *sm_policy_decision);
 OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_parseFromJSON(cJSON *sm_policy_decisionJSON);
 cJSON *OpenAPI_sm_policy_decision_convertToJSON(OpenAPI_sm_policy_decision_t *sm_policy_decision);
+bool OpenAPI_sm_policy_decision_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_decision_t *sm_policy_decision);
 OpenAPI_sm_policy_decision_t *OpenAPI_sm_policy_decision_copy(OpenAPI_sm_policy_decision_t *dst, OpenAPI_sm_policy_decision_t *src);
 
 #ifdef __cplusplus
@@ -176,6 +176,126 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_delete_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_delete_data_t *sm_policy_delete_data)
+{
+    if (sm_policy_delete_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [SmPolicyDeleteData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [SmPolicyDeleteData]");
+        return false;
+    }
+    if (sm_policy_delete_data->user_location_info) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLocationInfo", sm_policy_delete_data->user_location_info) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [user_location_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_policy_delete_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", sm_policy_delete_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->user_location_info_time) {
+    if (OpenAPI_json_write_string(writer, "userLocationInfoTime", sm_policy_delete_data->user_location_info_time) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [user_location_info_time]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->ran_nas_rel_causes) {
+    if (OpenAPI_json_write_array_start(writer, "ranNasRelCauses") == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ran_nas_rel_causes_node;
+    if (sm_policy_delete_data->ran_nas_rel_causes) {
+        OpenAPI_list_for_each(sm_policy_delete_data->ran_nas_rel_causes, ran_nas_rel_causes_node) {
+            if (OpenAPI_ran_nas_rel_cause_writeJSON(writer, NULL, ran_nas_rel_causes_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [ran_nas_rel_causes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [ran_nas_rel_causes]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->accu_usage_reports) {
+    if (OpenAPI_json_write_array_start(writer, "accuUsageReports") == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [accu_usage_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *accu_usage_reports_node;
+    if (sm_policy_delete_data->accu_usage_reports) {
+        OpenAPI_list_for_each(sm_policy_delete_data->accu_usage_reports, accu_usage_reports_node) {
+            if (OpenAPI_accu_usage_report_writeJSON(writer, NULL, accu_usage_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [accu_usage_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [accu_usage_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->pdu_sess_rel_cause) {
+    if (OpenAPI_json_write_string(writer, "pduSessRelCause", OpenAPI_pdu_session_rel_cause_ToString(sm_policy_delete_data->pdu_sess_rel_cause)) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [pdu_sess_rel_cause]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_delete_data->qos_mon_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qosMonReports") == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_mon_reports_node;
+    if (sm_policy_delete_data->qos_mon_reports) {
+        OpenAPI_list_for_each(sm_policy_delete_data->qos_mon_reports, qos_mon_reports_node) {
+            if (OpenAPI_qos_monitoring_report_writeJSON(writer, NULL, qos_mon_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [qos_mon_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_delete_data_writeJSON() failed [SmPolicyDeleteData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_delete_data_t *OpenAPI_sm_policy_delete_data_parseFromJSON(cJSON *sm_policy_delete_dataJSON)
 {
     OpenAPI_sm_policy_delete_data_t *sm_policy_delete_data_local_var = NULL;
@@ -328,7 +448,6 @@ end:
 OpenAPI_sm_policy_delete_data_t *OpenAPI_sm_policy_delete_data_copy(OpenAPI_sm_policy_delete_data_t *dst, OpenAPI_sm_policy_delete_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_delete_data_convertToJSON(src);
@@ -337,21 +456,6 @@ OpenAPI_sm_policy_delete_data_t *OpenAPI_sm_policy_delete_data_copy(OpenAPI_sm_p
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_delete_data_free(dst);
     dst = OpenAPI_sm_policy_delete_data_parseFromJSON(item);
     cJSON_Delete(item);
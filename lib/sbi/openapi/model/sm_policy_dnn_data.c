@@ -345,6 +345,239 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_dnn_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_dnn_data_t *sm_policy_dnn_data)
+{
+    if (sm_policy_dnn_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [SmPolicyDnnData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [SmPolicyDnnData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", sm_policy_dnn_data->dnn) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (sm_policy_dnn_data->allowed_services) {
+    if (OpenAPI_json_write_array_start(writer, "allowedServices") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [allowed_services]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *allowed_services_node;
+    OpenAPI_list_for_each(sm_policy_dnn_data->allowed_services, allowed_services_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)allowed_services_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [allowed_services]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [allowed_services]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->subsc_cats) {
+    if (OpenAPI_json_write_array_start(writer, "subscCats") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subsc_cats_node;
+    OpenAPI_list_for_each(sm_policy_dnn_data->subsc_cats, subsc_cats_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)subsc_cats_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->gbr_ul) {
+    if (OpenAPI_json_write_string(writer, "gbrUl", sm_policy_dnn_data->gbr_ul) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [gbr_ul]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->gbr_dl) {
+    if (OpenAPI_json_write_string(writer, "gbrDl", sm_policy_dnn_data->gbr_dl) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [gbr_dl]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_adc_support) {
+    if (OpenAPI_json_write_bool(writer, "adcSupport", sm_policy_dnn_data->adc_support) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [adc_support]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_subsc_spending_limits) {
+    if (OpenAPI_json_write_bool(writer, "subscSpendingLimits", sm_policy_dnn_data->subsc_spending_limits) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [subsc_spending_limits]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_ipv4_index) {
+    if (OpenAPI_json_write_number(writer, "ipv4Index", sm_policy_dnn_data->ipv4_index) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ipv4_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_ipv6_index) {
+    if (OpenAPI_json_write_number(writer, "ipv6Index", sm_policy_dnn_data->ipv6_index) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ipv6_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_offline) {
+    if (OpenAPI_json_write_bool(writer, "offline", sm_policy_dnn_data->offline) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [offline]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_online) {
+    if (OpenAPI_json_write_bool(writer, "online", sm_policy_dnn_data->online) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [online]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->chf_info) {
+    if (OpenAPI_charging_information_writeJSON(writer, "chfInfo", sm_policy_dnn_data->chf_info) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [chf_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->ref_um_data_limit_ids) {
+    if (OpenAPI_json_write_object_start(writer, "refUmDataLimitIds") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ref_um_data_limit_ids]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ref_um_data_limit_ids_node;
+    if (sm_policy_dnn_data->ref_um_data_limit_ids) {
+        OpenAPI_list_for_each(sm_policy_dnn_data->ref_um_data_limit_ids, ref_um_data_limit_ids_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)ref_um_data_limit_ids_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_limit_id_to_monitoring_key_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ref_um_data_limit_ids]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ref_um_data_limit_ids]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_mps_priority) {
+    if (OpenAPI_json_write_bool(writer, "mpsPriority", sm_policy_dnn_data->mps_priority) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [mps_priority]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_mcs_priority) {
+    if (OpenAPI_json_write_bool(writer, "mcsPriority", sm_policy_dnn_data->mcs_priority) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [mcs_priority]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_ims_signalling_prio) {
+    if (OpenAPI_json_write_bool(writer, "imsSignallingPrio", sm_policy_dnn_data->ims_signalling_prio) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [ims_signalling_prio]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_mps_priority_level) {
+    if (OpenAPI_json_write_number(writer, "mpsPriorityLevel", sm_policy_dnn_data->mps_priority_level) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [mps_priority_level]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_mcs_priority_level) {
+    if (OpenAPI_json_write_number(writer, "mcsPriorityLevel", sm_policy_dnn_data->mcs_priority_level) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [mcs_priority_level]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->pra_infos) {
+    if (OpenAPI_json_write_object_start(writer, "praInfos") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pra_infos_node;
+    if (sm_policy_dnn_data->pra_infos) {
+        OpenAPI_list_for_each(sm_policy_dnn_data->pra_infos, pra_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pra_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [pra_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->bdt_ref_ids) {
+    if (OpenAPI_json_write_object_start(writer, "bdtRefIds") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [bdt_ref_ids]");
+        goto end;
+    }
+    OpenAPI_lnode_t *bdt_ref_ids_node;
+    if (sm_policy_dnn_data->bdt_ref_ids) {
+        OpenAPI_list_for_each(sm_policy_dnn_data->bdt_ref_ids, bdt_ref_ids_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)bdt_ref_ids_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [bdt_ref_ids]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_dnn_data->is_loc_rout_not_allowed) {
+    if (OpenAPI_json_write_bool(writer, "locRoutNotAllowed", sm_policy_dnn_data->loc_rout_not_allowed) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [loc_rout_not_allowed]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_writeJSON() failed [SmPolicyDnnData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_dnn_data_t *OpenAPI_sm_policy_dnn_data_parseFromJSON(cJSON *sm_policy_dnn_dataJSON)
 {
     OpenAPI_sm_policy_dnn_data_t *sm_policy_dnn_data_local_var = NULL;
@@ -645,7 +878,6 @@ end:
 OpenAPI_sm_policy_dnn_data_t *OpenAPI_sm_policy_dnn_data_copy(OpenAPI_sm_policy_dnn_data_t *dst, OpenAPI_sm_policy_dnn_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_dnn_data_convertToJSON(src);
@@ -654,21 +886,6 @@ OpenAPI_sm_policy_dnn_data_t *OpenAPI_sm_policy_dnn_data_copy(OpenAPI_sm_policy_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_dnn_data_free(dst);
     dst = OpenAPI_sm_policy_dnn_data_parseFromJSON(item);
     cJSON_Delete(item);
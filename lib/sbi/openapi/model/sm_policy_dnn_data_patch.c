@@ -69,6 +69,50 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_dnn_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_dnn_data_patch_t *sm_policy_dnn_data_patch)
+{
+    if (sm_policy_dnn_data_patch == NULL) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [SmPolicyDnnDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [SmPolicyDnnDataPatch]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "dnn", sm_policy_dnn_data_patch->dnn) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (sm_policy_dnn_data_patch->bdt_ref_ids) {
+    if (OpenAPI_json_write_object_start(writer, "bdtRefIds") == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [bdt_ref_ids]");
+        goto end;
+    }
+    OpenAPI_lnode_t *bdt_ref_ids_node;
+    if (sm_policy_dnn_data_patch->bdt_ref_ids) {
+        OpenAPI_list_for_each(sm_policy_dnn_data_patch->bdt_ref_ids, bdt_ref_ids_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)bdt_ref_ids_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [bdt_ref_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_dnn_data_patch_writeJSON() failed [SmPolicyDnnDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_dnn_data_patch_t *OpenAPI_sm_policy_dnn_data_patch_parseFromJSON(cJSON *sm_policy_dnn_data_patchJSON)
 {
     OpenAPI_sm_policy_dnn_data_patch_t *sm_policy_dnn_data_patch_local_var = NULL;
@@ -113,7 +157,6 @@ end:
 OpenAPI_sm_policy_dnn_data_patch_t *OpenAPI_sm_policy_dnn_data_patch_copy(OpenAPI_sm_policy_dnn_data_patch_t *dst, OpenAPI_sm_policy_dnn_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_dnn_data_patch_convertToJSON(src);
@@ -122,21 +165,6 @@ OpenAPI_sm_policy_dnn_data_patch_t *OpenAPI_sm_policy_dnn_data_patch_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_dnn_data_patch_free(dst);
     dst = OpenAPI_sm_policy_dnn_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
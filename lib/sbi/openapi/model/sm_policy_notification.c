@@ -63,6 +63,42 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_notification_t *sm_policy_notification)
+{
+    if (sm_policy_notification == NULL) {
+        ogs_error("OpenAPI_sm_policy_notification_writeJSON() failed [SmPolicyNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_notification_writeJSON() failed [SmPolicyNotification]");
+        return false;
+    }
+    if (sm_policy_notification->resource_uri) {
+    if (OpenAPI_json_write_string(writer, "resourceUri", sm_policy_notification->resource_uri) == false) {
+        ogs_error("OpenAPI_sm_policy_notification_writeJSON() failed [resource_uri]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_notification->sm_policy_decision) {
+    if (OpenAPI_sm_policy_decision_writeJSON(writer, "smPolicyDecision", sm_policy_notification->sm_policy_decision) == false) {
+        ogs_error("OpenAPI_sm_policy_notification_writeJSON() failed [sm_policy_decision]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_notification_writeJSON() failed [SmPolicyNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_parseFromJSON(cJSON *sm_policy_notificationJSON)
 {
     OpenAPI_sm_policy_notification_t *sm_policy_notification_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_copy(OpenAPI_sm_policy_notification_t *dst, OpenAPI_sm_policy_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_notification_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_copy(OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_notification_free(dst);
     dst = OpenAPI_sm_policy_notification_parseFromJSON(item);
     cJSON_Delete(item);
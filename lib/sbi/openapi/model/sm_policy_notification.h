@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sm_policy_decision.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_create(
 void OpenAPI_sm_policy_notification_free(OpenAPI_sm_policy_notification_t *sm_policy_notification);
 OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_parseFromJSON(cJSON *sm_policy_notificationJSON);
 cJSON *OpenAPI_sm_policy_notification_convertToJSON(OpenAPI_sm_policy_notification_t *sm_policy_notification);
+bool OpenAPI_sm_policy_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_notification_t *sm_policy_notification);
 OpenAPI_sm_policy_notification_t *OpenAPI_sm_policy_notification_copy(OpenAPI_sm_policy_notification_t *dst, OpenAPI_sm_policy_notification_t *src);
 
 #ifdef __cplusplus
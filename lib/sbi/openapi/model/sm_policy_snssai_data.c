@@ -83,6 +83,56 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_snssai_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_snssai_data_t *sm_policy_snssai_data)
+{
+    if (sm_policy_snssai_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [SmPolicySnssaiData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [SmPolicySnssaiData]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", sm_policy_snssai_data->snssai) == false) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (sm_policy_snssai_data->sm_policy_dnn_data) {
+    if (OpenAPI_json_write_object_start(writer, "smPolicyDnnData") == false) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [sm_policy_dnn_data]");
+        goto end;
+    }
+    OpenAPI_lnode_t *sm_policy_dnn_data_node;
+    if (sm_policy_snssai_data->sm_policy_dnn_data) {
+        OpenAPI_list_for_each(sm_policy_snssai_data->sm_policy_dnn_data, sm_policy_dnn_data_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)sm_policy_dnn_data_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_sm_policy_dnn_data_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [sm_policy_dnn_data]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [sm_policy_dnn_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_snssai_data_writeJSON() failed [SmPolicySnssaiData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_snssai_data_t *OpenAPI_sm_policy_snssai_data_parseFromJSON(cJSON *sm_policy_snssai_dataJSON)
 {
     OpenAPI_sm_policy_snssai_data_t *sm_policy_snssai_data_local_var = NULL;
@@ -134,7 +184,6 @@ end:
 OpenAPI_sm_policy_snssai_data_t *OpenAPI_sm_policy_snssai_data_copy(OpenAPI_sm_policy_snssai_data_t *dst, OpenAPI_sm_policy_snssai_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_snssai_data_convertToJSON(src);
@@ -143,21 +192,6 @@ OpenAPI_sm_policy_snssai_data_t *OpenAPI_sm_policy_snssai_data_copy(OpenAPI_sm_p
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_snssai_data_free(dst);
     dst = OpenAPI_sm_policy_snssai_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -837,6 +837,579 @@ end:
     return item;
 }
 
+bool OpenAPI_sm_policy_update_context_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sm_policy_update_context_data_t *sm_policy_update_context_data)
+{
+    if (sm_policy_update_context_data == NULL) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [SmPolicyUpdateContextData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [SmPolicyUpdateContextData]");
+        return false;
+    }
+    if (sm_policy_update_context_data->rep_policy_ctrl_req_triggers) {
+    if (OpenAPI_json_write_array_start(writer, "repPolicyCtrlReqTriggers") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_policy_ctrl_req_triggers]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rep_policy_ctrl_req_triggers_node;
+    OpenAPI_list_for_each(sm_policy_update_context_data->rep_policy_ctrl_req_triggers, rep_policy_ctrl_req_triggers_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_control_request_trigger_ToString((intptr_t)rep_policy_ctrl_req_triggers_node->data)) == false) {
+            ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_policy_ctrl_req_triggers]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_policy_ctrl_req_triggers]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->acc_net_ch_ids) {
+    if (OpenAPI_json_write_array_start(writer, "accNetChIds") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [acc_net_ch_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *acc_net_ch_ids_node;
+    if (sm_policy_update_context_data->acc_net_ch_ids) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->acc_net_ch_ids, acc_net_ch_ids_node) {
+            if (OpenAPI_acc_net_ch_id_writeJSON(writer, NULL, acc_net_ch_ids_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [acc_net_ch_ids]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [acc_net_ch_ids]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(sm_policy_update_context_data->access_type)) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(sm_policy_update_context_data->rat_type)) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->add_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "addAccessInfo", sm_policy_update_context_data->add_access_info) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [add_access_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rel_access_info) {
+    if (OpenAPI_additional_access_info_writeJSON(writer, "relAccessInfo", sm_policy_update_context_data->rel_access_info) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rel_access_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", sm_policy_update_context_data->serving_network) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->user_location_info) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLocationInfo", sm_policy_update_context_data->user_location_info) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [user_location_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", sm_policy_update_context_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rel_ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "relIpv4Address", sm_policy_update_context_data->rel_ipv4_address) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rel_ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ipv4_address) {
+    if (OpenAPI_json_write_string(writer, "ipv4Address", sm_policy_update_context_data->ipv4_address) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ipv4_address]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ip_domain) {
+    if (OpenAPI_json_write_string(writer, "ipDomain", sm_policy_update_context_data->ip_domain) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ip_domain]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ipv6_address_prefix) {
+    if (OpenAPI_json_write_string(writer, "ipv6AddressPrefix", sm_policy_update_context_data->ipv6_address_prefix) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ipv6_address_prefix]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rel_ipv6_address_prefix) {
+    if (OpenAPI_json_write_string(writer, "relIpv6AddressPrefix", sm_policy_update_context_data->rel_ipv6_address_prefix) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rel_ipv6_address_prefix]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->add_ipv6_addr_prefixes) {
+    if (OpenAPI_json_write_string(writer, "addIpv6AddrPrefixes", sm_policy_update_context_data->add_ipv6_addr_prefixes) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [add_ipv6_addr_prefixes]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->add_rel_ipv6_addr_prefixes) {
+    if (OpenAPI_json_write_string(writer, "addRelIpv6AddrPrefixes", sm_policy_update_context_data->add_rel_ipv6_addr_prefixes) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [add_rel_ipv6_addr_prefixes]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rel_ue_mac) {
+    if (OpenAPI_json_write_string(writer, "relUeMac", sm_policy_update_context_data->rel_ue_mac) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rel_ue_mac]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ue_mac) {
+    if (OpenAPI_json_write_string(writer, "ueMac", sm_policy_update_context_data->ue_mac) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ue_mac]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->subs_sess_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "subsSessAmbr", sm_policy_update_context_data->subs_sess_ambr) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [subs_sess_ambr]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->auth_prof_index) {
+    if (OpenAPI_json_write_string(writer, "authProfIndex", sm_policy_update_context_data->auth_prof_index) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [auth_prof_index]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->subs_def_qos) {
+    if (OpenAPI_subscribed_default_qos_writeJSON(writer, "subsDefQos", sm_policy_update_context_data->subs_def_qos) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [subs_def_qos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->vplmn_qos) {
+    if (OpenAPI_vplmn_qos_writeJSON(writer, "vplmnQos", sm_policy_update_context_data->vplmn_qos) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [vplmn_qos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->is_num_of_pack_filter) {
+    if (OpenAPI_json_write_number(writer, "numOfPackFilter", sm_policy_update_context_data->num_of_pack_filter) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [num_of_pack_filter]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->accu_usage_reports) {
+    if (OpenAPI_json_write_array_start(writer, "accuUsageReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [accu_usage_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *accu_usage_reports_node;
+    if (sm_policy_update_context_data->accu_usage_reports) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->accu_usage_reports, accu_usage_reports_node) {
+            if (OpenAPI_accu_usage_report_writeJSON(writer, NULL, accu_usage_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [accu_usage_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [accu_usage_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->is__3gpp_ps_data_off_status) {
+    if (OpenAPI_json_write_bool(writer, "3gppPsDataOffStatus", sm_policy_update_context_data->_3gpp_ps_data_off_status) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [_3gpp_ps_data_off_status]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->app_detection_infos) {
+    if (OpenAPI_json_write_array_start(writer, "appDetectionInfos") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [app_detection_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_detection_infos_node;
+    if (sm_policy_update_context_data->app_detection_infos) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->app_detection_infos, app_detection_infos_node) {
+            if (OpenAPI_app_detection_info_writeJSON(writer, NULL, app_detection_infos_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [app_detection_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [app_detection_infos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "ruleReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *rule_reports_node;
+    if (sm_policy_update_context_data->rule_reports) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->rule_reports, rule_reports_node) {
+            if (OpenAPI_rule_report_writeJSON(writer, NULL, rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rule_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->sess_rule_reports) {
+    if (OpenAPI_json_write_array_start(writer, "sessRuleReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sess_rule_reports_node;
+    if (sm_policy_update_context_data->sess_rule_reports) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->sess_rule_reports, sess_rule_reports_node) {
+            if (OpenAPI_session_rule_report_writeJSON(writer, NULL, sess_rule_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [sess_rule_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [sess_rule_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->qnc_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qncReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qnc_reports_node;
+    if (sm_policy_update_context_data->qnc_reports) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->qnc_reports, qnc_reports_node) {
+            if (OpenAPI_qos_notification_control_info_writeJSON(writer, NULL, qnc_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qnc_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qnc_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->qos_mon_reports) {
+    if (OpenAPI_json_write_array_start(writer, "qosMonReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_mon_reports_node;
+    if (sm_policy_update_context_data->qos_mon_reports) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->qos_mon_reports, qos_mon_reports_node) {
+            if (OpenAPI_qos_monitoring_report_writeJSON(writer, NULL, qos_mon_reports_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qos_mon_reports]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qos_mon_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->user_location_info_time) {
+    if (OpenAPI_json_write_string(writer, "userLocationInfoTime", sm_policy_update_context_data->user_location_info_time) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [user_location_info_time]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->rep_pra_infos) {
+    if (OpenAPI_json_write_object_start(writer, "repPraInfos") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_pra_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *rep_pra_infos_node;
+    if (sm_policy_update_context_data->rep_pra_infos) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->rep_pra_infos, rep_pra_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)rep_pra_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_pra_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [rep_pra_infos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ue_init_res_req) {
+    if (OpenAPI_ue_initiated_resource_request_writeJSON(writer, "ueInitResReq", sm_policy_update_context_data->ue_init_res_req) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ue_init_res_req]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->is_ref_qos_indication) {
+    if (OpenAPI_json_write_bool(writer, "refQosIndication", sm_policy_update_context_data->ref_qos_indication) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ref_qos_indication]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->qos_flow_usage) {
+    if (OpenAPI_json_write_string(writer, "qosFlowUsage", OpenAPI_qos_flow_usage_ToString(sm_policy_update_context_data->qos_flow_usage)) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [qos_flow_usage]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->credit_manage_status) {
+    if (OpenAPI_json_write_string(writer, "creditManageStatus", OpenAPI_credit_management_status_ToString(sm_policy_update_context_data->credit_manage_status)) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [credit_manage_status]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->serv_nf_id) {
+    if (OpenAPI_serving_nf_identity_writeJSON(writer, "servNfId", sm_policy_update_context_data->serv_nf_id) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [serv_nf_id]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->trace_req) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceReq", sm_policy_update_context_data->trace_req) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [trace_req]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->ma_pdu_ind) {
+    if (OpenAPI_json_write_string(writer, "maPduInd", OpenAPI_ma_pdu_indication_ToString(sm_policy_update_context_data->ma_pdu_ind)) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [ma_pdu_ind]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->atsss_capab) {
+    if (OpenAPI_atsss_capability_writeJSON(writer, "atsssCapab", sm_policy_update_context_data->atsss_capab) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [atsss_capab]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->tsn_bridge_info) {
+    if (OpenAPI_tsn_bridge_info_writeJSON(writer, "tsnBridgeInfo", sm_policy_update_context_data->tsn_bridge_info) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_bridge_info]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->tsn_bridge_man_cont) {
+    if (OpenAPI_bridge_management_container_writeJSON(writer, "tsnBridgeManCont", sm_policy_update_context_data->tsn_bridge_man_cont) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_bridge_man_cont]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->tsn_port_man_cont_dstt) {
+    if (OpenAPI_port_management_container_writeJSON(writer, "tsnPortManContDstt", sm_policy_update_context_data->tsn_port_man_cont_dstt) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_port_man_cont_dstt]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->tsn_port_man_cont_nwtts) {
+    if (OpenAPI_json_write_array_start(writer, "tsnPortManContNwtts") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tsn_port_man_cont_nwtts_node;
+    if (sm_policy_update_context_data->tsn_port_man_cont_nwtts) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->tsn_port_man_cont_nwtts, tsn_port_man_cont_nwtts_node) {
+            if (OpenAPI_port_management_container_writeJSON(writer, NULL, tsn_port_man_cont_nwtts_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [tsn_port_man_cont_nwtts]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->mul_addr_infos) {
+    if (OpenAPI_json_write_array_start(writer, "mulAddrInfos") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [mul_addr_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mul_addr_infos_node;
+    if (sm_policy_update_context_data->mul_addr_infos) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->mul_addr_infos, mul_addr_infos_node) {
+            if (OpenAPI_ip_multicast_address_info_writeJSON(writer, NULL, mul_addr_infos_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [mul_addr_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [mul_addr_infos]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->policy_dec_failure_reports) {
+    if (OpenAPI_json_write_array_start(writer, "policyDecFailureReports") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    OpenAPI_lnode_t *policy_dec_failure_reports_node;
+    OpenAPI_list_for_each(sm_policy_update_context_data->policy_dec_failure_reports, policy_dec_failure_reports_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_decision_failure_code_ToString((intptr_t)policy_dec_failure_reports_node->data)) == false) {
+            ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [policy_dec_failure_reports]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [policy_dec_failure_reports]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->traffic_descriptors) {
+    if (OpenAPI_json_write_array_start(writer, "trafficDescriptors") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [traffic_descriptors]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_descriptors_node;
+    if (sm_policy_update_context_data->traffic_descriptors) {
+        OpenAPI_list_for_each(sm_policy_update_context_data->traffic_descriptors, traffic_descriptors_node) {
+            if (OpenAPI_ddd_traffic_descriptor_writeJSON(writer, NULL, traffic_descriptors_node->data) == false) {
+                ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [traffic_descriptors]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [traffic_descriptors]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->pcc_rule_id) {
+    if (OpenAPI_json_write_string(writer, "pccRuleId", sm_policy_update_context_data->pcc_rule_id) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [pcc_rule_id]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->inter_grp_ids) {
+    if (OpenAPI_json_write_array_start(writer, "interGrpIds") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *inter_grp_ids_node;
+    OpenAPI_list_for_each(sm_policy_update_context_data->inter_grp_ids, inter_grp_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)inter_grp_ids_node->data) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [inter_grp_ids]");
+        goto end;
+    }
+    }
+
+    if (sm_policy_update_context_data->types_of_notif) {
+    if (OpenAPI_json_write_array_start(writer, "typesOfNotif") == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [types_of_notif]");
+        goto end;
+    }
+    OpenAPI_lnode_t *types_of_notif_node;
+    OpenAPI_list_for_each(sm_policy_update_context_data->types_of_notif, types_of_notif_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_dl_data_delivery_status_ToString((intptr_t)types_of_notif_node->data)) == false) {
+            ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [types_of_notif]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [types_of_notif]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sm_policy_update_context_data_writeJSON() failed [SmPolicyUpdateContextData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sm_policy_update_context_data_t *OpenAPI_sm_policy_update_context_data_parseFromJSON(cJSON *sm_policy_update_context_dataJSON)
 {
     OpenAPI_sm_policy_update_context_data_t *sm_policy_update_context_data_local_var = NULL;
@@ -1603,7 +2176,6 @@ end:
 OpenAPI_sm_policy_update_context_data_t *OpenAPI_sm_policy_update_context_data_copy(OpenAPI_sm_policy_update_context_data_t *dst, OpenAPI_sm_policy_update_context_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sm_policy_update_context_data_convertToJSON(src);
@@ -1612,21 +2184,6 @@ OpenAPI_sm_policy_update_context_data_t *OpenAPI_sm_policy_update_context_data_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sm_policy_update_context_data_free(dst);
     dst = OpenAPI_sm_policy_update_context_data_parseFromJSON(item);
     cJSON_Delete(item);
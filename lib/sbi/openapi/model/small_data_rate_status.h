@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,6 +45,7 @@ OpenAPI_small_data_rate_status_t *OpenAPI_small_data_rate_status_create(
 void OpenAPI_small_data_rate_status_free(OpenAPI_small_data_rate_status_t *small_data_rate_status);
 OpenAPI_small_data_rate_status_t *OpenAPI_small_data_rate_status_parseFromJSON(cJSON *small_data_rate_statusJSON);
 cJSON *OpenAPI_small_data_rate_status_convertToJSON(OpenAPI_small_data_rate_status_t *small_data_rate_status);
+bool OpenAPI_small_data_rate_status_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_small_data_rate_status_t *small_data_rate_status);
 OpenAPI_small_data_rate_status_t *OpenAPI_small_data_rate_status_copy(OpenAPI_small_data_rate_status_t *dst, OpenAPI_small_data_rate_status_t *src);
 
 #ifdef __cplusplus
@@ -73,6 +73,43 @@ end:
     return item;
 }
 
+bool OpenAPI_small_data_rate_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_small_data_rate_status_info_t *small_data_rate_status_info)
+{
+    if (small_data_rate_status_info == NULL) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [SmallDataRateStatusInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [SmallDataRateStatusInfo]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "Snssai", small_data_rate_status_info->snssai) == false) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "Dnn", small_data_rate_status_info->dnn) == false) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "SmallDataRateStatus", small_data_rate_status_info->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_small_data_rate_status_info_writeJSON() failed [SmallDataRateStatusInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_parseFromJSON(cJSON *small_data_rate_status_infoJSON)
 {
     OpenAPI_small_data_rate_status_info_t *small_data_rate_status_info_local_var = NULL;
@@ -119,7 +156,6 @@ end:
 OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_copy(OpenAPI_small_data_rate_status_info_t *dst, OpenAPI_small_data_rate_status_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_small_data_rate_status_info_convertToJSON(src);
@@ -128,21 +164,6 @@ OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_copy(
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_small_data_rate_status_info_free(dst);
     dst = OpenAPI_small_data_rate_status_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "small_data_rate_status.h"
 #include "snssai.h"
 
@@ -34,6 +35,7 @@ OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_creat
 void OpenAPI_small_data_rate_status_info_free(OpenAPI_small_data_rate_status_info_t *small_data_rate_status_info);
 OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_parseFromJSON(cJSON *small_data_rate_status_infoJSON);
 cJSON *OpenAPI_small_data_rate_status_info_convertToJSON(OpenAPI_small_data_rate_status_info_t *small_data_rate_status_info);
+bool OpenAPI_small_data_rate_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_small_data_rate_status_info_t *small_data_rate_status_info);
 OpenAPI_small_data_rate_status_info_t *OpenAPI_small_data_rate_status_info_copy(OpenAPI_small_data_rate_status_info_t *dst, OpenAPI_small_data_rate_status_info_t *src);
 
 #ifdef __cplusplus
@@ -64,6 +64,50 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_change_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_change_info_t *smf_change_info)
+{
+    if (smf_change_info == NULL) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [SmfChangeInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [SmfChangeInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "pduSessionIdList") == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [pdu_session_id_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_session_id_list_node;
+    OpenAPI_list_for_each(smf_change_info->pdu_session_id_list, pdu_session_id_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)pdu_session_id_list_node->data) == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [pdu_session_id_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [pdu_session_id_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "smfChangeInd", OpenAPI_smf_change_indication_ToString(smf_change_info->smf_change_ind)) == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [smf_change_ind]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_change_info_writeJSON() failed [SmfChangeInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_change_info_t *OpenAPI_smf_change_info_parseFromJSON(cJSON *smf_change_infoJSON)
 {
     OpenAPI_smf_change_info_t *smf_change_info_local_var = NULL;
@@ -115,7 +159,6 @@ end:
 OpenAPI_smf_change_info_t *OpenAPI_smf_change_info_copy(OpenAPI_smf_change_info_t *dst, OpenAPI_smf_change_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_change_info_convertToJSON(src);
@@ -124,21 +167,6 @@ OpenAPI_smf_change_info_t *OpenAPI_smf_change_info_copy(OpenAPI_smf_change_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_change_info_free(dst);
     dst = OpenAPI_smf_change_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -163,6 +163,128 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_info_t *smf_info)
+{
+    if (smf_info == NULL) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [SmfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [SmfInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "sNssaiSmfInfoList") == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [s_nssai_smf_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssai_smf_info_list_node;
+    if (smf_info->s_nssai_smf_info_list) {
+        OpenAPI_list_for_each(smf_info->s_nssai_smf_info_list, s_nssai_smf_info_list_node) {
+            if (OpenAPI_snssai_smf_info_item_writeJSON(writer, NULL, s_nssai_smf_info_list_node->data) == false) {
+                ogs_error("OpenAPI_smf_info_writeJSON() failed [s_nssai_smf_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [s_nssai_smf_info_list]");
+        goto end;
+    }
+
+    if (smf_info->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (smf_info->tai_list) {
+        OpenAPI_list_for_each(smf_info->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (smf_info->tai_range_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiRangeList") == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_range_list_node;
+    if (smf_info->tai_range_list) {
+        OpenAPI_list_for_each(smf_info->tai_range_list, tai_range_list_node) {
+            if (OpenAPI_tai_range_writeJSON(writer, NULL, tai_range_list_node->data) == false) {
+                ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [tai_range_list]");
+        goto end;
+    }
+    }
+
+    if (smf_info->pgw_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", smf_info->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+    }
+
+    if (smf_info->access_type) {
+    if (OpenAPI_json_write_array_start(writer, "accessType") == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+    OpenAPI_lnode_t *access_type_node;
+    OpenAPI_list_for_each(smf_info->access_type, access_type_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_access_type_ToString((intptr_t)access_type_node->data)) == false) {
+            ogs_error("OpenAPI_smf_info_writeJSON() failed [access_type]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (smf_info->is_priority) {
+    if (OpenAPI_json_write_number(writer, "priority", smf_info->priority) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [priority]");
+        goto end;
+    }
+    }
+
+    if (smf_info->is_vsmf_support_ind) {
+    if (OpenAPI_json_write_bool(writer, "vsmfSupportInd", smf_info->vsmf_support_ind) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [vsmf_support_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_info_writeJSON() failed [SmfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_info_t *OpenAPI_smf_info_parseFromJSON(cJSON *smf_infoJSON)
 {
     OpenAPI_smf_info_t *smf_info_local_var = NULL;
@@ -324,7 +446,6 @@ end:
 OpenAPI_smf_info_t *OpenAPI_smf_info_copy(OpenAPI_smf_info_t *dst, OpenAPI_smf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_info_convertToJSON(src);
@@ -333,21 +454,6 @@ OpenAPI_smf_info_t *OpenAPI_smf_info_copy(OpenAPI_smf_info_t *dst, OpenAPI_smf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_info_free(dst);
     dst = OpenAPI_smf_info_parseFromJSON(item);
     cJSON_Delete(item);
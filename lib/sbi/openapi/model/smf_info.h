@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "snssai_smf_info_item.h"
 #include "tai.h"
@@ -48,6 +49,7 @@ OpenAPI_smf_info_t *OpenAPI_smf_info_create(
 void OpenAPI_smf_info_free(OpenAPI_smf_info_t *smf_info);
 OpenAPI_smf_info_t *OpenAPI_smf_info_parseFromJSON(cJSON *smf_infoJSON);
 cJSON *OpenAPI_smf_info_convertToJSON(OpenAPI_smf_info_t *smf_info);
+bool OpenAPI_smf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_info_t *smf_info);
 OpenAPI_smf_info_t *OpenAPI_smf_info_copy(OpenAPI_smf_info_t *dst, OpenAPI_smf_info_t *src);
 
 #ifdef __cplusplus
@@ -197,6 +197,125 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_registration_t *smf_registration)
+{
+    if (smf_registration == NULL) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [SmfRegistration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [SmfRegistration]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", smf_registration->smf_instance_id) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+
+    if (smf_registration->smf_set_id) {
+    if (OpenAPI_json_write_string(writer, "smfSetId", smf_registration->smf_set_id) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [smf_set_id]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", smf_registration->supported_features) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "pduSessionId", smf_registration->pdu_session_id) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [pdu_session_id]");
+        goto end;
+    }
+
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", smf_registration->single_nssai) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+
+    if (smf_registration->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", smf_registration->dnn) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->is_emergency_services) {
+    if (OpenAPI_json_write_bool(writer, "emergencyServices", smf_registration->emergency_services) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [emergency_services]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->pcscf_restoration_callback_uri) {
+    if (OpenAPI_json_write_string(writer, "pcscfRestorationCallbackUri", smf_registration->pcscf_restoration_callback_uri) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [pcscf_restoration_callback_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", smf_registration->plmn_id) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (smf_registration->pgw_fqdn) {
+    if (OpenAPI_json_write_string(writer, "pgwFqdn", smf_registration->pgw_fqdn) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [pgw_fqdn]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->is_epdg_ind) {
+    if (OpenAPI_json_write_bool(writer, "epdgInd", smf_registration->epdg_ind) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [epdg_ind]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->dereg_callback_uri) {
+    if (OpenAPI_json_write_string(writer, "deregCallbackUri", smf_registration->dereg_callback_uri) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [dereg_callback_uri]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->registration_reason) {
+    if (OpenAPI_json_write_string(writer, "registrationReason", OpenAPI_registration_reason_ToString(smf_registration->registration_reason)) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [registration_reason]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->registration_time) {
+    if (OpenAPI_json_write_string(writer, "registrationTime", smf_registration->registration_time) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [registration_time]");
+        goto end;
+    }
+    }
+
+    if (smf_registration->context_info) {
+    if (OpenAPI_context_info_writeJSON(writer, "contextInfo", smf_registration->context_info) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [context_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_registration_writeJSON() failed [SmfRegistration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_registration_t *OpenAPI_smf_registration_parseFromJSON(cJSON *smf_registrationJSON)
 {
     OpenAPI_smf_registration_t *smf_registration_local_var = NULL;
@@ -368,7 +487,6 @@ end:
 OpenAPI_smf_registration_t *OpenAPI_smf_registration_copy(OpenAPI_smf_registration_t *dst, OpenAPI_smf_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_registration_convertToJSON(src);
@@ -377,21 +495,6 @@ OpenAPI_smf_registration_t *OpenAPI_smf_registration_copy(OpenAPI_smf_registrati
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_registration_free(dst);
     dst = OpenAPI_smf_registration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "context_info.h"
 #include "plmn_id.h"
 #include "registration_reason.h"
@@ -64,6 +65,7 @@ OpenAPI_smf_registration_t *OpenAPI_smf_registration_create(
 void OpenAPI_smf_registration_free(OpenAPI_smf_registration_t *smf_registration);
 OpenAPI_smf_registration_t *OpenAPI_smf_registration_parseFromJSON(cJSON *smf_registrationJSON);
 cJSON *OpenAPI_smf_registration_convertToJSON(OpenAPI_smf_registration_t *smf_registration);
+bool OpenAPI_smf_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_registration_t *smf_registration);
 OpenAPI_smf_registration_t *OpenAPI_smf_registration_copy(OpenAPI_smf_registration_t *dst, OpenAPI_smf_registration_t *src);
 
 #ifdef __cplusplus
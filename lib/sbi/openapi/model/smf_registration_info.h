@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "smf_registration.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_smf_registration_info_t *OpenAPI_smf_registration_info_create(
 void OpenAPI_smf_registration_info_free(OpenAPI_smf_registration_info_t *smf_registration_info);
 OpenAPI_smf_registration_info_t *OpenAPI_smf_registration_info_parseFromJSON(cJSON *smf_registration_infoJSON);
 cJSON *OpenAPI_smf_registration_info_convertToJSON(OpenAPI_smf_registration_info_t *smf_registration_info);
+bool OpenAPI_smf_registration_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_registration_info_t *smf_registration_info);
 OpenAPI_smf_registration_info_t *OpenAPI_smf_registration_info_copy(OpenAPI_smf_registration_info_t *dst, OpenAPI_smf_registration_info_t *src);
 
 #ifdef __cplusplus
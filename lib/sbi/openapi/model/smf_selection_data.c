@@ -122,6 +122,79 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_selection_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_selection_data_t *smf_selection_data)
+{
+    if (smf_selection_data == NULL) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [SmfSelectionData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [SmfSelectionData]");
+        return false;
+    }
+    if (smf_selection_data->is_unsupp_dnn) {
+    if (OpenAPI_json_write_bool(writer, "unsuppDnn", smf_selection_data->unsupp_dnn) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [unsupp_dnn]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_data->candidates) {
+    if (OpenAPI_json_write_object_start(writer, "candidates") == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [candidates]");
+        goto end;
+    }
+    OpenAPI_lnode_t *candidates_node;
+    if (smf_selection_data->candidates) {
+        OpenAPI_list_for_each(smf_selection_data->candidates, candidates_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)candidates_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_candidate_for_replacement_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [candidates]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [candidates]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", smf_selection_data->snssai) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_data->mapping_snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "mappingSnssai", smf_selection_data->mapping_snssai) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [mapping_snssai]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", smf_selection_data->dnn) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_selection_data_writeJSON() failed [SmfSelectionData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_parseFromJSON(cJSON *smf_selection_dataJSON)
 {
     OpenAPI_smf_selection_data_t *smf_selection_data_local_var = NULL;
@@ -200,7 +273,6 @@ end:
 OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_copy(OpenAPI_smf_selection_data_t *dst, OpenAPI_smf_selection_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_selection_data_convertToJSON(src);
@@ -209,21 +281,6 @@ OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_copy(OpenAPI_smf_select
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_selection_data_free(dst);
     dst = OpenAPI_smf_selection_data_parseFromJSON(item);
     cJSON_Delete(item);
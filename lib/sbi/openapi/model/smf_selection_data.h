@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "candidate_for_replacement.h"
 #include "snssai.h"
 
@@ -40,6 +41,7 @@ OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_create(
 void OpenAPI_smf_selection_data_free(OpenAPI_smf_selection_data_t *smf_selection_data);
 OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_parseFromJSON(cJSON *smf_selection_dataJSON);
 cJSON *OpenAPI_smf_selection_data_convertToJSON(OpenAPI_smf_selection_data_t *smf_selection_data);
+bool OpenAPI_smf_selection_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_selection_data_t *smf_selection_data);
 OpenAPI_smf_selection_data_t *OpenAPI_smf_selection_data_copy(OpenAPI_smf_selection_data_t *dst, OpenAPI_smf_selection_data_t *src);
 
 #ifdef __cplusplus
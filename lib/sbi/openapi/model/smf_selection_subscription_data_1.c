@@ -89,6 +89,65 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_selection_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_selection_subscription_data_1_t *smf_selection_subscription_data_1)
+{
+    if (smf_selection_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [SmfSelectionSubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [SmfSelectionSubscriptionData_1]");
+        return false;
+    }
+    if (smf_selection_subscription_data_1->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", smf_selection_subscription_data_1->supported_features) == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_subscription_data_1->subscribed_snssai_infos) {
+    if (OpenAPI_json_write_object_start(writer, "subscribedSnssaiInfos") == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [subscribed_snssai_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *subscribed_snssai_infos_node;
+    if (smf_selection_subscription_data_1->subscribed_snssai_infos) {
+        OpenAPI_list_for_each(smf_selection_subscription_data_1->subscribed_snssai_infos, subscribed_snssai_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)subscribed_snssai_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_snssai_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [subscribed_snssai_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [subscribed_snssai_infos]");
+        goto end;
+    }
+    }
+
+    if (smf_selection_subscription_data_1->shared_snssai_infos_id) {
+    if (OpenAPI_json_write_string(writer, "sharedSnssaiInfosId", smf_selection_subscription_data_1->shared_snssai_infos_id) == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [shared_snssai_infos_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_selection_subscription_data_1_writeJSON() failed [SmfSelectionSubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_selection_subscription_data_1_t *OpenAPI_smf_selection_subscription_data_1_parseFromJSON(cJSON *smf_selection_subscription_data_1JSON)
 {
     OpenAPI_smf_selection_subscription_data_1_t *smf_selection_subscription_data_1_local_var = NULL;
@@ -150,7 +209,6 @@ end:
 OpenAPI_smf_selection_subscription_data_1_t *OpenAPI_smf_selection_subscription_data_1_copy(OpenAPI_smf_selection_subscription_data_1_t *dst, OpenAPI_smf_selection_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_selection_subscription_data_1_convertToJSON(src);
@@ -159,21 +217,6 @@ OpenAPI_smf_selection_subscription_data_1_t *OpenAPI_smf_selection_subscription_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_selection_subscription_data_1_free(dst);
     dst = OpenAPI_smf_selection_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
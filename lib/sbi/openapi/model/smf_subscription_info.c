@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_subscription_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_subscription_info_t *smf_subscription_info)
+{
+    if (smf_subscription_info == NULL) {
+        ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [SmfSubscriptionInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [SmfSubscriptionInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "smfSubscriptionList") == false) {
+        ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [smf_subscription_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_subscription_list_node;
+    if (smf_subscription_info->smf_subscription_list) {
+        OpenAPI_list_for_each(smf_subscription_info->smf_subscription_list, smf_subscription_list_node) {
+            if (OpenAPI_smf_subscription_item_writeJSON(writer, NULL, smf_subscription_list_node->data) == false) {
+                ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [smf_subscription_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [smf_subscription_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_subscription_info_writeJSON() failed [SmfSubscriptionInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_subscription_info_t *OpenAPI_smf_subscription_info_parseFromJSON(cJSON *smf_subscription_infoJSON)
 {
     OpenAPI_smf_subscription_info_t *smf_subscription_info_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_smf_subscription_info_t *OpenAPI_smf_subscription_info_copy(OpenAPI_smf_subscription_info_t *dst, OpenAPI_smf_subscription_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_subscription_info_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_smf_subscription_info_t *OpenAPI_smf_subscription_info_copy(OpenAPI_smf_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_subscription_info_free(dst);
     dst = OpenAPI_smf_subscription_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_smf_subscription_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smf_subscription_item_t *smf_subscription_item)
+{
+    if (smf_subscription_item == NULL) {
+        ogs_error("OpenAPI_smf_subscription_item_writeJSON() failed [SmfSubscriptionItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smf_subscription_item_writeJSON() failed [SmfSubscriptionItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "smfInstanceId", smf_subscription_item->smf_instance_id) == false) {
+        ogs_error("OpenAPI_smf_subscription_item_writeJSON() failed [smf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "subscriptionId", smf_subscription_item->subscription_id) == false) {
+        ogs_error("OpenAPI_smf_subscription_item_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smf_subscription_item_writeJSON() failed [SmfSubscriptionItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smf_subscription_item_t *OpenAPI_smf_subscription_item_parseFromJSON(cJSON *smf_subscription_itemJSON)
 {
     OpenAPI_smf_subscription_item_t *smf_subscription_item_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_smf_subscription_item_t *OpenAPI_smf_subscription_item_copy(OpenAPI_smf_subscription_item_t *dst, OpenAPI_smf_subscription_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smf_subscription_item_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_smf_subscription_item_t *OpenAPI_smf_subscription_item_copy(OpenAPI_smf_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smf_subscription_item_free(dst);
     dst = OpenAPI_smf_subscription_item_parseFromJSON(item);
     cJSON_Delete(item);
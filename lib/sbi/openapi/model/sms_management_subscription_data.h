@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trace_data_1.h"
 
 #ifdef __cplusplus
@@ -57,6 +58,7 @@ OpenAPI_sms_management_subscription_data_t *OpenAPI_sms_management_subscription_
 void OpenAPI_sms_management_subscription_data_free(OpenAPI_sms_management_subscription_data_t *sms_management_subscription_data);
 OpenAPI_sms_management_subscription_data_t *OpenAPI_sms_management_subscription_data_parseFromJSON(cJSON *sms_management_subscription_dataJSON);
 cJSON *OpenAPI_sms_management_subscription_data_convertToJSON(OpenAPI_sms_management_subscription_data_t *sms_management_subscription_data);
+bool OpenAPI_sms_management_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sms_management_subscription_data_t *sms_management_subscription_data);
 OpenAPI_sms_management_subscription_data_t *OpenAPI_sms_management_subscription_data_copy(OpenAPI_sms_management_subscription_data_t *dst, OpenAPI_sms_management_subscription_data_t *src);
 
 #ifdef __cplusplus
@@ -151,6 +151,103 @@ end:
     return item;
 }
 
+bool OpenAPI_sms_management_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sms_management_subscription_data_1_t *sms_management_subscription_data_1)
+{
+    if (sms_management_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [SmsManagementSubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [SmsManagementSubscriptionData_1]");
+        return false;
+    }
+    if (sms_management_subscription_data_1->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", sms_management_subscription_data_1->supported_features) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mt_sms_subscribed) {
+    if (OpenAPI_json_write_bool(writer, "mtSmsSubscribed", sms_management_subscription_data_1->mt_sms_subscribed) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mt_sms_subscribed]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mt_sms_barring_all) {
+    if (OpenAPI_json_write_bool(writer, "mtSmsBarringAll", sms_management_subscription_data_1->mt_sms_barring_all) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mt_sms_barring_all]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mt_sms_barring_roaming) {
+    if (OpenAPI_json_write_bool(writer, "mtSmsBarringRoaming", sms_management_subscription_data_1->mt_sms_barring_roaming) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mt_sms_barring_roaming]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mo_sms_subscribed) {
+    if (OpenAPI_json_write_bool(writer, "moSmsSubscribed", sms_management_subscription_data_1->mo_sms_subscribed) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mo_sms_subscribed]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mo_sms_barring_all) {
+    if (OpenAPI_json_write_bool(writer, "moSmsBarringAll", sms_management_subscription_data_1->mo_sms_barring_all) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mo_sms_barring_all]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->is_mo_sms_barring_roaming) {
+    if (OpenAPI_json_write_bool(writer, "moSmsBarringRoaming", sms_management_subscription_data_1->mo_sms_barring_roaming) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [mo_sms_barring_roaming]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->shared_sms_mng_data_ids) {
+    if (OpenAPI_json_write_array_start(writer, "sharedSmsMngDataIds") == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [shared_sms_mng_data_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *shared_sms_mng_data_ids_node;
+    OpenAPI_list_for_each(sms_management_subscription_data_1->shared_sms_mng_data_ids, shared_sms_mng_data_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)shared_sms_mng_data_ids_node->data) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [shared_sms_mng_data_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [shared_sms_mng_data_ids]");
+        goto end;
+    }
+    }
+
+    if (sms_management_subscription_data_1->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", sms_management_subscription_data_1->trace_data) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sms_management_subscription_data_1_writeJSON() failed [SmsManagementSubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sms_management_subscription_data_1_t *OpenAPI_sms_management_subscription_data_1_parseFromJSON(cJSON *sms_management_subscription_data_1JSON)
 {
     OpenAPI_sms_management_subscription_data_1_t *sms_management_subscription_data_1_local_var = NULL;
@@ -270,7 +367,6 @@ end:
 OpenAPI_sms_management_subscription_data_1_t *OpenAPI_sms_management_subscription_data_1_copy(OpenAPI_sms_management_subscription_data_1_t *dst, OpenAPI_sms_management_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sms_management_subscription_data_1_convertToJSON(src);
@@ -279,21 +375,6 @@ OpenAPI_sms_management_subscription_data_1_t *OpenAPI_sms_management_subscriptio
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sms_management_subscription_data_1_free(dst);
     dst = OpenAPI_sms_management_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
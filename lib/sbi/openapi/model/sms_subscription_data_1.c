@@ -58,6 +58,42 @@ end:
     return item;
 }
 
+bool OpenAPI_sms_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sms_subscription_data_1_t *sms_subscription_data_1)
+{
+    if (sms_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_sms_subscription_data_1_writeJSON() failed [SmsSubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sms_subscription_data_1_writeJSON() failed [SmsSubscriptionData_1]");
+        return false;
+    }
+    if (sms_subscription_data_1->is_sms_subscribed) {
+    if (OpenAPI_json_write_bool(writer, "smsSubscribed", sms_subscription_data_1->sms_subscribed) == false) {
+        ogs_error("OpenAPI_sms_subscription_data_1_writeJSON() failed [sms_subscribed]");
+        goto end;
+    }
+    }
+
+    if (sms_subscription_data_1->shared_sms_subs_data_id) {
+    if (OpenAPI_json_write_string(writer, "sharedSmsSubsDataId", sms_subscription_data_1->shared_sms_subs_data_id) == false) {
+        ogs_error("OpenAPI_sms_subscription_data_1_writeJSON() failed [shared_sms_subs_data_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sms_subscription_data_1_writeJSON() failed [SmsSubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sms_subscription_data_1_t *OpenAPI_sms_subscription_data_1_parseFromJSON(cJSON *sms_subscription_data_1JSON)
 {
     OpenAPI_sms_subscription_data_1_t *sms_subscription_data_1_local_var = NULL;
@@ -93,7 +129,6 @@ end:
 OpenAPI_sms_subscription_data_1_t *OpenAPI_sms_subscription_data_1_copy(OpenAPI_sms_subscription_data_1_t *dst, OpenAPI_sms_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sms_subscription_data_1_convertToJSON(src);
@@ -102,21 +137,6 @@ OpenAPI_sms_subscription_data_1_t *OpenAPI_sms_subscription_data_1_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sms_subscription_data_1_free(dst);
     dst = OpenAPI_sms_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
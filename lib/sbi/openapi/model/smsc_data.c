@@ -63,6 +63,42 @@ end:
     return item;
 }
 
+bool OpenAPI_smsc_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsc_data_t *smsc_data)
+{
+    if (smsc_data == NULL) {
+        ogs_error("OpenAPI_smsc_data_writeJSON() failed [SmscData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smsc_data_writeJSON() failed [SmscData]");
+        return false;
+    }
+    if (smsc_data->smsc_map_address) {
+    if (OpenAPI_json_write_string(writer, "smscMapAddress", smsc_data->smsc_map_address) == false) {
+        ogs_error("OpenAPI_smsc_data_writeJSON() failed [smsc_map_address]");
+        goto end;
+    }
+    }
+
+    if (smsc_data->smsc_diameter_address) {
+    if (OpenAPI_network_node_diameter_address_1_writeJSON(writer, "smscDiameterAddress", smsc_data->smsc_diameter_address) == false) {
+        ogs_error("OpenAPI_smsc_data_writeJSON() failed [smsc_diameter_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smsc_data_writeJSON() failed [SmscData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smsc_data_t *OpenAPI_smsc_data_parseFromJSON(cJSON *smsc_dataJSON)
 {
     OpenAPI_smsc_data_t *smsc_data_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_smsc_data_t *OpenAPI_smsc_data_copy(OpenAPI_smsc_data_t *dst, OpenAPI_smsc_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smsc_data_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_smsc_data_t *OpenAPI_smsc_data_copy(OpenAPI_smsc_data_t *dst, OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smsc_data_free(dst);
     dst = OpenAPI_smsc_data_parseFromJSON(item);
     cJSON_Delete(item);
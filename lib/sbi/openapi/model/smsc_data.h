@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "network_node_diameter_address_1.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_smsc_data_t *OpenAPI_smsc_data_create(
 void OpenAPI_smsc_data_free(OpenAPI_smsc_data_t *smsc_data);
 OpenAPI_smsc_data_t *OpenAPI_smsc_data_parseFromJSON(cJSON *smsc_dataJSON);
 cJSON *OpenAPI_smsc_data_convertToJSON(OpenAPI_smsc_data_t *smsc_data);
+bool OpenAPI_smsc_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsc_data_t *smsc_data);
 OpenAPI_smsc_data_t *OpenAPI_smsc_data_copy(OpenAPI_smsc_data_t *dst, OpenAPI_smsc_data_t *src);
 
 #ifdef __cplusplus
@@ -59,6 +59,38 @@ end:
     return item;
 }
 
+bool OpenAPI_smsf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsf_info_t *smsf_info)
+{
+    if (smsf_info == NULL) {
+        ogs_error("OpenAPI_smsf_info_writeJSON() failed [SmsfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smsf_info_writeJSON() failed [SmsfInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "smsfInstanceId", smsf_info->smsf_instance_id) == false) {
+        ogs_error("OpenAPI_smsf_info_writeJSON() failed [smsf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", smsf_info->plmn_id) == false) {
+        ogs_error("OpenAPI_smsf_info_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smsf_info_writeJSON() failed [SmsfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smsf_info_t *OpenAPI_smsf_info_parseFromJSON(cJSON *smsf_infoJSON)
 {
     OpenAPI_smsf_info_t *smsf_info_local_var = NULL;
@@ -95,7 +127,6 @@ end:
 OpenAPI_smsf_info_t *OpenAPI_smsf_info_copy(OpenAPI_smsf_info_t *dst, OpenAPI_smsf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smsf_info_convertToJSON(src);
@@ -104,21 +135,6 @@ OpenAPI_smsf_info_t *OpenAPI_smsf_info_copy(OpenAPI_smsf_info_t *dst, OpenAPI_sm
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smsf_info_free(dst);
     dst = OpenAPI_smsf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -59,6 +59,38 @@ end:
     return item;
 }
 
+bool OpenAPI_smsf_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsf_info_1_t *smsf_info_1)
+{
+    if (smsf_info_1 == NULL) {
+        ogs_error("OpenAPI_smsf_info_1_writeJSON() failed [SmsfInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smsf_info_1_writeJSON() failed [SmsfInfo_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "smsfInstanceId", smsf_info_1->smsf_instance_id) == false) {
+        ogs_error("OpenAPI_smsf_info_1_writeJSON() failed [smsf_instance_id]");
+        goto end;
+    }
+
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", smsf_info_1->plmn_id) == false) {
+        ogs_error("OpenAPI_smsf_info_1_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smsf_info_1_writeJSON() failed [SmsfInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_parseFromJSON(cJSON *smsf_info_1JSON)
 {
     OpenAPI_smsf_info_1_t *smsf_info_1_local_var = NULL;
@@ -95,7 +127,6 @@ end:
 OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_copy(OpenAPI_smsf_info_1_t *dst, OpenAPI_smsf_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smsf_info_1_convertToJSON(src);
@@ -104,21 +135,6 @@ OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_copy(OpenAPI_smsf_info_1_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smsf_info_1_free(dst);
     dst = OpenAPI_smsf_info_1_parseFromJSON(item);
     cJSON_Delete(item);
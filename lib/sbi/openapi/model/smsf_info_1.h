@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_create(
 void OpenAPI_smsf_info_1_free(OpenAPI_smsf_info_1_t *smsf_info_1);
 OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_parseFromJSON(cJSON *smsf_info_1JSON);
 cJSON *OpenAPI_smsf_info_1_convertToJSON(OpenAPI_smsf_info_1_t *smsf_info_1);
+bool OpenAPI_smsf_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsf_info_1_t *smsf_info_1);
 OpenAPI_smsf_info_1_t *OpenAPI_smsf_info_1_copy(OpenAPI_smsf_info_1_t *dst, OpenAPI_smsf_info_1_t *src);
 
 #ifdef __cplusplus
@@ -131,6 +131,80 @@ end:
     return item;
 }
 
+bool OpenAPI_smsf_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsf_registration_t *smsf_registration)
+{
+    if (smsf_registration == NULL) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [SmsfRegistration]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [SmsfRegistration]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "smsfInstanceId", smsf_registration->smsf_instance_id) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [smsf_instance_id]");
+        goto end;
+    }
+
+    if (smsf_registration->smsf_set_id) {
+    if (OpenAPI_json_write_string(writer, "smsfSetId", smsf_registration->smsf_set_id) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [smsf_set_id]");
+        goto end;
+    }
+    }
+
+    if (smsf_registration->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", smsf_registration->supported_features) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", smsf_registration->plmn_id) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (smsf_registration->smsf_map_address) {
+    if (OpenAPI_json_write_string(writer, "smsfMAPAddress", smsf_registration->smsf_map_address) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [smsf_map_address]");
+        goto end;
+    }
+    }
+
+    if (smsf_registration->smsf_diameter_address) {
+    if (OpenAPI_network_node_diameter_address_writeJSON(writer, "smsfDiameterAddress", smsf_registration->smsf_diameter_address) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [smsf_diameter_address]");
+        goto end;
+    }
+    }
+
+    if (smsf_registration->registration_time) {
+    if (OpenAPI_json_write_string(writer, "registrationTime", smsf_registration->registration_time) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [registration_time]");
+        goto end;
+    }
+    }
+
+    if (smsf_registration->context_info) {
+    if (OpenAPI_context_info_writeJSON(writer, "contextInfo", smsf_registration->context_info) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [context_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_smsf_registration_writeJSON() failed [SmsfRegistration]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_parseFromJSON(cJSON *smsf_registrationJSON)
 {
     OpenAPI_smsf_registration_t *smsf_registration_local_var = NULL;
@@ -223,7 +297,6 @@ end:
 OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_copy(OpenAPI_smsf_registration_t *dst, OpenAPI_smsf_registration_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_smsf_registration_convertToJSON(src);
@@ -232,21 +305,6 @@ OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_copy(OpenAPI_smsf_registr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_smsf_registration_free(dst);
     dst = OpenAPI_smsf_registration_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "context_info.h"
 #include "network_node_diameter_address.h"
 #include "plmn_id.h"
@@ -45,6 +46,7 @@ OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_create(
 void OpenAPI_smsf_registration_free(OpenAPI_smsf_registration_t *smsf_registration);
 OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_parseFromJSON(cJSON *smsf_registrationJSON);
 cJSON *OpenAPI_smsf_registration_convertToJSON(OpenAPI_smsf_registration_t *smsf_registration);
+bool OpenAPI_smsf_registration_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_smsf_registration_t *smsf_registration);
 OpenAPI_smsf_registration_t *OpenAPI_smsf_registration_copy(OpenAPI_smsf_registration_t *dst, OpenAPI_smsf_registration_t *src);
 
 #ifdef __cplusplus
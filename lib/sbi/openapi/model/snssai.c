@@ -54,6 +54,40 @@ end:
     return item;
 }
 
+bool OpenAPI_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_t *snssai)
+{
+    if (snssai == NULL) {
+        ogs_error("OpenAPI_snssai_writeJSON() failed [Snssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_snssai_writeJSON() failed [Snssai]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "sst", snssai->sst) == false) {
+        ogs_error("OpenAPI_snssai_writeJSON() failed [sst]");
+        goto end;
+    }
+
+    if (snssai->sd) {
+    if (OpenAPI_json_write_string(writer, "sd", snssai->sd) == false) {
+        ogs_error("OpenAPI_snssai_writeJSON() failed [sd]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_writeJSON() failed [Snssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_snssai_t *OpenAPI_snssai_parseFromJSON(cJSON *snssaiJSON)
 {
     OpenAPI_snssai_t *snssai_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_snssai_t *OpenAPI_snssai_copy(OpenAPI_snssai_t *dst, OpenAPI_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_snssai_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_snssai_t *OpenAPI_snssai_copy(OpenAPI_snssai_t *dst, OpenAPI_snssai_t *s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_snssai_free(dst);
     dst = OpenAPI_snssai_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_snssai_t *OpenAPI_snssai_create(
 void OpenAPI_snssai_free(OpenAPI_snssai_t *snssai);
 OpenAPI_snssai_t *OpenAPI_snssai_parseFromJSON(cJSON *snssaiJSON);
 cJSON *OpenAPI_snssai_convertToJSON(OpenAPI_snssai_t *snssai);
+bool OpenAPI_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_t *snssai);
 OpenAPI_snssai_t *OpenAPI_snssai_copy(OpenAPI_snssai_t *dst, OpenAPI_snssai_t *src);
 
 #ifdef __cplusplus
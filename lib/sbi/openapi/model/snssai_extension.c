@@ -74,6 +74,56 @@ end:
     return item;
 }
 
+bool OpenAPI_snssai_extension_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_extension_t *snssai_extension)
+{
+    if (snssai_extension == NULL) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [SnssaiExtension]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [SnssaiExtension]");
+        return false;
+    }
+    if (snssai_extension->sd_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "sdRanges") == false) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [sd_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sd_ranges_node;
+    if (snssai_extension->sd_ranges) {
+        OpenAPI_list_for_each(snssai_extension->sd_ranges, sd_ranges_node) {
+            if (OpenAPI_sd_range_writeJSON(writer, NULL, sd_ranges_node->data) == false) {
+                ogs_error("OpenAPI_snssai_extension_writeJSON() failed [sd_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [sd_ranges]");
+        goto end;
+    }
+    }
+
+    if (snssai_extension->is_wildcard_sd) {
+    if (OpenAPI_json_write_bool(writer, "wildcardSd", snssai_extension->wildcard_sd) == false) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [wildcard_sd]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_extension_writeJSON() failed [SnssaiExtension]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_parseFromJSON(cJSON *snssai_extensionJSON)
 {
     OpenAPI_snssai_extension_t *snssai_extension_local_var = NULL;
@@ -129,7 +179,6 @@ end:
 OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_copy(OpenAPI_snssai_extension_t *dst, OpenAPI_snssai_extension_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_snssai_extension_convertToJSON(src);
@@ -138,21 +187,6 @@ OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_copy(OpenAPI_snssai_extensi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_snssai_extension_free(dst);
     dst = OpenAPI_snssai_extension_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sd_range.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_create(
 void OpenAPI_snssai_extension_free(OpenAPI_snssai_extension_t *snssai_extension);
 OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_parseFromJSON(cJSON *snssai_extensionJSON);
 cJSON *OpenAPI_snssai_extension_convertToJSON(OpenAPI_snssai_extension_t *snssai_extension);
+bool OpenAPI_snssai_extension_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_extension_t *snssai_extension);
 OpenAPI_snssai_extension_t *OpenAPI_snssai_extension_copy(OpenAPI_snssai_extension_t *dst, OpenAPI_snssai_extension_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_snssai_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_info_t *snssai_info)
+{
+    if (snssai_info == NULL) {
+        ogs_error("OpenAPI_snssai_info_writeJSON() failed [SnssaiInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_snssai_info_writeJSON() failed [SnssaiInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "dnnInfos") == false) {
+        ogs_error("OpenAPI_snssai_info_writeJSON() failed [dnn_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_infos_node;
+    if (snssai_info->dnn_infos) {
+        OpenAPI_list_for_each(snssai_info->dnn_infos, dnn_infos_node) {
+            if (OpenAPI_dnn_info_writeJSON(writer, NULL, dnn_infos_node->data) == false) {
+                ogs_error("OpenAPI_snssai_info_writeJSON() failed [dnn_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_info_writeJSON() failed [dnn_infos]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_info_writeJSON() failed [SnssaiInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_snssai_info_t *OpenAPI_snssai_info_parseFromJSON(cJSON *snssai_infoJSON)
 {
     OpenAPI_snssai_info_t *snssai_info_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_snssai_info_t *OpenAPI_snssai_info_copy(OpenAPI_snssai_info_t *dst, OpenAPI_snssai_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_snssai_info_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_snssai_info_t *OpenAPI_snssai_info_copy(OpenAPI_snssai_info_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_snssai_info_free(dst);
     dst = OpenAPI_snssai_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnn_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_snssai_info_t *OpenAPI_snssai_info_create(
 void OpenAPI_snssai_info_free(OpenAPI_snssai_info_t *snssai_info);
 OpenAPI_snssai_info_t *OpenAPI_snssai_info_parseFromJSON(cJSON *snssai_infoJSON);
 cJSON *OpenAPI_snssai_info_convertToJSON(OpenAPI_snssai_info_t *snssai_info);
+bool OpenAPI_snssai_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_info_t *snssai_info);
 OpenAPI_snssai_info_t *OpenAPI_snssai_info_copy(OpenAPI_snssai_info_t *dst, OpenAPI_snssai_info_t *src);
 
 #ifdef __cplusplus
@@ -75,6 +75,52 @@ end:
     return item;
 }
 
+bool OpenAPI_snssai_smf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_smf_info_item_t *snssai_smf_info_item)
+{
+    if (snssai_smf_info_item == NULL) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [SnssaiSmfInfoItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [SnssaiSmfInfoItem]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", snssai_smf_info_item->s_nssai) == false) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "dnnSmfInfoList") == false) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [dnn_smf_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_smf_info_list_node;
+    if (snssai_smf_info_item->dnn_smf_info_list) {
+        OpenAPI_list_for_each(snssai_smf_info_item->dnn_smf_info_list, dnn_smf_info_list_node) {
+            if (OpenAPI_dnn_smf_info_item_writeJSON(writer, NULL, dnn_smf_info_list_node->data) == false) {
+                ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [dnn_smf_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [dnn_smf_info_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_smf_info_item_writeJSON() failed [SnssaiSmfInfoItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_parseFromJSON(cJSON *snssai_smf_info_itemJSON)
 {
     OpenAPI_snssai_smf_info_item_t *snssai_smf_info_item_local_var = NULL;
@@ -131,7 +177,6 @@ end:
 OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_copy(OpenAPI_snssai_smf_info_item_t *dst, OpenAPI_snssai_smf_info_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_snssai_smf_info_item_convertToJSON(src);
@@ -140,21 +185,6 @@ OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_copy(OpenAPI_snssai
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_snssai_smf_info_item_free(dst);
     dst = OpenAPI_snssai_smf_info_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnn_smf_info_item.h"
 #include "snssai.h"
 
@@ -32,6 +33,7 @@ OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_create(
 void OpenAPI_snssai_smf_info_item_free(OpenAPI_snssai_smf_info_item_t *snssai_smf_info_item);
 OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_parseFromJSON(cJSON *snssai_smf_info_itemJSON);
 cJSON *OpenAPI_snssai_smf_info_item_convertToJSON(OpenAPI_snssai_smf_info_item_t *snssai_smf_info_item);
+bool OpenAPI_snssai_smf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_smf_info_item_t *snssai_smf_info_item);
 OpenAPI_snssai_smf_info_item_t *OpenAPI_snssai_smf_info_item_copy(OpenAPI_snssai_smf_info_item_t *dst, OpenAPI_snssai_smf_info_item_t *src);
 
 #ifdef __cplusplus
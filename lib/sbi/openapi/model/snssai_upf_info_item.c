@@ -86,6 +86,59 @@ end:
     return item;
 }
 
+bool OpenAPI_snssai_upf_info_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_snssai_upf_info_item_t *snssai_upf_info_item)
+{
+    if (snssai_upf_info_item == NULL) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [SnssaiUpfInfoItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [SnssaiUpfInfoItem]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", snssai_upf_info_item->s_nssai) == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "dnnUpfInfoList") == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [dnn_upf_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_upf_info_list_node;
+    if (snssai_upf_info_item->dnn_upf_info_list) {
+        OpenAPI_list_for_each(snssai_upf_info_item->dnn_upf_info_list, dnn_upf_info_list_node) {
+            if (OpenAPI_dnn_upf_info_item_writeJSON(writer, NULL, dnn_upf_info_list_node->data) == false) {
+                ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [dnn_upf_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [dnn_upf_info_list]");
+        goto end;
+    }
+
+    if (snssai_upf_info_item->is_redundant_transport) {
+    if (OpenAPI_json_write_bool(writer, "redundantTransport", snssai_upf_info_item->redundant_transport) == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [redundant_transport]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_snssai_upf_info_item_writeJSON() failed [SnssaiUpfInfoItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_snssai_upf_info_item_t *OpenAPI_snssai_upf_info_item_parseFromJSON(cJSON *snssai_upf_info_itemJSON)
 {
     OpenAPI_snssai_upf_info_item_t *snssai_upf_info_item_local_var = NULL;
@@ -153,7 +206,6 @@ end:
 OpenAPI_snssai_upf_info_item_t *OpenAPI_snssai_upf_info_item_copy(OpenAPI_snssai_upf_info_item_t *dst, OpenAPI_snssai_upf_info_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_snssai_upf_info_item_convertToJSON(src);
@@ -162,21 +214,6 @@ OpenAPI_snssai_upf_info_item_t *OpenAPI_snssai_upf_info_item_copy(OpenAPI_snssai
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_snssai_upf_info_item_free(dst);
     dst = OpenAPI_snssai_upf_info_item_parseFromJSON(item);
     cJSON_Delete(item);
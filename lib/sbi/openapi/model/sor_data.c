@@ -72,6 +72,52 @@ end:
     return item;
 }
 
+bool OpenAPI_sor_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_data_t *sor_data)
+{
+    if (sor_data == NULL) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [SorData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [SorData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "provisioningTime", sor_data->provisioning_time) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ueUpdateStatus", OpenAPI_ue_update_status_ToString(sor_data->ue_update_status)) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [ue_update_status]");
+        goto end;
+    }
+
+    if (sor_data->sor_xmac_iue) {
+    if (OpenAPI_json_write_string(writer, "sorXmacIue", sor_data->sor_xmac_iue) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [sor_xmac_iue]");
+        goto end;
+    }
+    }
+
+    if (sor_data->sor_mac_iue) {
+    if (OpenAPI_json_write_string(writer, "sorMacIue", sor_data->sor_mac_iue) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [sor_mac_iue]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sor_data_writeJSON() failed [SorData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sor_data_t *OpenAPI_sor_data_parseFromJSON(cJSON *sor_dataJSON)
 {
     OpenAPI_sor_data_t *sor_data_local_var = NULL;
@@ -132,7 +178,6 @@ end:
 OpenAPI_sor_data_t *OpenAPI_sor_data_copy(OpenAPI_sor_data_t *dst, OpenAPI_sor_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sor_data_convertToJSON(src);
@@ -141,21 +186,6 @@ OpenAPI_sor_data_t *OpenAPI_sor_data_copy(OpenAPI_sor_data_t *dst, OpenAPI_sor_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sor_data_free(dst);
     dst = OpenAPI_sor_data_parseFromJSON(item);
     cJSON_Delete(item);
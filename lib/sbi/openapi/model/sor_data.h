@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_update_status.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_sor_data_t *OpenAPI_sor_data_create(
 void OpenAPI_sor_data_free(OpenAPI_sor_data_t *sor_data);
 OpenAPI_sor_data_t *OpenAPI_sor_data_parseFromJSON(cJSON *sor_dataJSON);
 cJSON *OpenAPI_sor_data_convertToJSON(OpenAPI_sor_data_t *sor_data);
+bool OpenAPI_sor_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_data_t *sor_data);
 OpenAPI_sor_data_t *OpenAPI_sor_data_copy(OpenAPI_sor_data_t *dst, OpenAPI_sor_data_t *src);
 
 #ifdef __cplusplus
@@ -88,6 +88,59 @@ end:
     return item;
 }
 
+bool OpenAPI_sor_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_info_t *sor_info)
+{
+    if (sor_info == NULL) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [SorInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [SorInfo]");
+        return false;
+    }
+    if (sor_info->steering_container) {
+    if (OpenAPI_steering_container_writeJSON(writer, "steeringContainer", sor_info->steering_container) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [steering_container]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_bool(writer, "ackInd", sor_info->ack_ind) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [ack_ind]");
+        goto end;
+    }
+
+    if (sor_info->sor_mac_iausf) {
+    if (OpenAPI_json_write_string(writer, "sorMacIausf", sor_info->sor_mac_iausf) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [sor_mac_iausf]");
+        goto end;
+    }
+    }
+
+    if (sor_info->countersor) {
+    if (OpenAPI_json_write_string(writer, "countersor", sor_info->countersor) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [countersor]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "provisioningTime", sor_info->provisioning_time) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sor_info_writeJSON() failed [SorInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sor_info_t *OpenAPI_sor_info_parseFromJSON(cJSON *sor_infoJSON)
 {
     OpenAPI_sor_info_t *sor_info_local_var = NULL;
@@ -155,7 +208,6 @@ end:
 OpenAPI_sor_info_t *OpenAPI_sor_info_copy(OpenAPI_sor_info_t *dst, OpenAPI_sor_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sor_info_convertToJSON(src);
@@ -164,21 +216,6 @@ OpenAPI_sor_info_t *OpenAPI_sor_info_copy(OpenAPI_sor_info_t *dst, OpenAPI_sor_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sor_info_free(dst);
     dst = OpenAPI_sor_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "steering_container.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_sor_info_t *OpenAPI_sor_info_create(
 void OpenAPI_sor_info_free(OpenAPI_sor_info_t *sor_info);
 OpenAPI_sor_info_t *OpenAPI_sor_info_parseFromJSON(cJSON *sor_infoJSON);
 cJSON *OpenAPI_sor_info_convertToJSON(OpenAPI_sor_info_t *sor_info);
+bool OpenAPI_sor_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_info_t *sor_info);
 OpenAPI_sor_info_t *OpenAPI_sor_info_copy(OpenAPI_sor_info_t *dst, OpenAPI_sor_info_t *src);
 
 #ifdef __cplusplus
@@ -88,6 +88,59 @@ end:
     return item;
 }
 
+bool OpenAPI_sor_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_info_1_t *sor_info_1)
+{
+    if (sor_info_1 == NULL) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [SorInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [SorInfo_1]");
+        return false;
+    }
+    if (sor_info_1->steering_container) {
+    if (OpenAPI_steering_container_writeJSON(writer, "steeringContainer", sor_info_1->steering_container) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [steering_container]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_bool(writer, "ackInd", sor_info_1->ack_ind) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [ack_ind]");
+        goto end;
+    }
+
+    if (sor_info_1->sor_mac_iausf) {
+    if (OpenAPI_json_write_string(writer, "sorMacIausf", sor_info_1->sor_mac_iausf) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [sor_mac_iausf]");
+        goto end;
+    }
+    }
+
+    if (sor_info_1->countersor) {
+    if (OpenAPI_json_write_string(writer, "countersor", sor_info_1->countersor) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [countersor]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "provisioningTime", sor_info_1->provisioning_time) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sor_info_1_writeJSON() failed [SorInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_parseFromJSON(cJSON *sor_info_1JSON)
 {
     OpenAPI_sor_info_1_t *sor_info_1_local_var = NULL;
@@ -155,7 +208,6 @@ end:
 OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_copy(OpenAPI_sor_info_1_t *dst, OpenAPI_sor_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sor_info_1_convertToJSON(src);
@@ -164,21 +216,6 @@ OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_copy(OpenAPI_sor_info_1_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sor_info_1_free(dst);
     dst = OpenAPI_sor_info_1_parseFromJSON(item);
     cJSON_Delete(item);
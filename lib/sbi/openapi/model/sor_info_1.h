@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "steering_container.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_create(
 void OpenAPI_sor_info_1_free(OpenAPI_sor_info_1_t *sor_info_1);
 OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_parseFromJSON(cJSON *sor_info_1JSON);
 cJSON *OpenAPI_sor_info_1_convertToJSON(OpenAPI_sor_info_1_t *sor_info_1);
+bool OpenAPI_sor_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_info_1_t *sor_info_1);
 OpenAPI_sor_info_1_t *OpenAPI_sor_info_1_copy(OpenAPI_sor_info_1_t *dst, OpenAPI_sor_info_1_t *src);
 
 #ifdef __cplusplus
@@ -51,6 +51,33 @@ end:
     return item;
 }
 
+bool OpenAPI_sor_update_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_update_info_t *sor_update_info)
+{
+    if (sor_update_info == NULL) {
+        ogs_error("OpenAPI_sor_update_info_writeJSON() failed [SorUpdateInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sor_update_info_writeJSON() failed [SorUpdateInfo]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "vplmnId", sor_update_info->vplmn_id) == false) {
+        ogs_error("OpenAPI_sor_update_info_writeJSON() failed [vplmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sor_update_info_writeJSON() failed [SorUpdateInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_parseFromJSON(cJSON *sor_update_infoJSON)
 {
     OpenAPI_sor_update_info_t *sor_update_info_local_var = NULL;
@@ -75,7 +102,6 @@ end:
 OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_copy(OpenAPI_sor_update_info_t *dst, OpenAPI_sor_update_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sor_update_info_convertToJSON(src);
@@ -84,21 +110,6 @@ OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_copy(OpenAPI_sor_update_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sor_update_info_free(dst);
     dst = OpenAPI_sor_update_info_parseFromJSON(item);
     cJSON_Delete(item);
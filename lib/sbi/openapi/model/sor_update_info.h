@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_create(
 void OpenAPI_sor_update_info_free(OpenAPI_sor_update_info_t *sor_update_info);
 OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_parseFromJSON(cJSON *sor_update_infoJSON);
 cJSON *OpenAPI_sor_update_info_convertToJSON(OpenAPI_sor_update_info_t *sor_update_info);
+bool OpenAPI_sor_update_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sor_update_info_t *sor_update_info);
 OpenAPI_sor_update_info_t *OpenAPI_sor_update_info_copy(OpenAPI_sor_update_info_t *dst, OpenAPI_sor_update_info_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "presence_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_spatial_validity_t *OpenAPI_spatial_validity_create(
 void OpenAPI_spatial_validity_free(OpenAPI_spatial_validity_t *spatial_validity);
 OpenAPI_spatial_validity_t *OpenAPI_spatial_validity_parseFromJSON(cJSON *spatial_validityJSON);
 cJSON *OpenAPI_spatial_validity_convertToJSON(OpenAPI_spatial_validity_t *spatial_validity);
+bool OpenAPI_spatial_validity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_spatial_validity_t *spatial_validity);
 OpenAPI_spatial_validity_t *OpenAPI_spatial_validity_copy(OpenAPI_spatial_validity_t *dst, OpenAPI_spatial_validity_t *src);
 
 #ifdef __cplusplus
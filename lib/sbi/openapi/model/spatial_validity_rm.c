@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_spatial_validity_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_spatial_validity_rm_t *spatial_validity_rm)
+{
+    if (spatial_validity_rm == NULL) {
+        ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [SpatialValidityRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [SpatialValidityRm]");
+        return false;
+    }
+    if (OpenAPI_json_write_object_start(writer, "presenceInfoList") == false) {
+        ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [presence_info_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *presence_info_list_node;
+    if (spatial_validity_rm->presence_info_list) {
+        OpenAPI_list_for_each(spatial_validity_rm->presence_info_list, presence_info_list_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)presence_info_list_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [presence_info_list]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [presence_info_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_spatial_validity_rm_writeJSON() failed [SpatialValidityRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_parseFromJSON(cJSON *spatial_validity_rmJSON)
 {
     OpenAPI_spatial_validity_rm_t *spatial_validity_rm_local_var = NULL;
@@ -110,7 +153,6 @@ end:
 OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_copy(OpenAPI_spatial_validity_rm_t *dst, OpenAPI_spatial_validity_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_spatial_validity_rm_convertToJSON(src);
@@ -119,21 +161,6 @@ OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_copy(OpenAPI_spatial_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_spatial_validity_rm_free(dst);
     dst = OpenAPI_spatial_validity_rm_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "presence_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_create(
 void OpenAPI_spatial_validity_rm_free(OpenAPI_spatial_validity_rm_t *spatial_validity_rm);
 OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_parseFromJSON(cJSON *spatial_validity_rmJSON);
 cJSON *OpenAPI_spatial_validity_rm_convertToJSON(OpenAPI_spatial_validity_rm_t *spatial_validity_rm);
+bool OpenAPI_spatial_validity_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_spatial_validity_rm_t *spatial_validity_rm);
 OpenAPI_spatial_validity_rm_t *OpenAPI_spatial_validity_rm_copy(OpenAPI_spatial_validity_rm_t *dst, OpenAPI_spatial_validity_rm_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,45 @@ end:
     return item;
 }
 
+bool OpenAPI_sponsor_connectivity_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_sponsor_connectivity_data_t *sponsor_connectivity_data)
+{
+    if (sponsor_connectivity_data == NULL) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [SponsorConnectivityData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [SponsorConnectivityData]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "aspIds") == false) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [asp_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *asp_ids_node;
+    OpenAPI_list_for_each(sponsor_connectivity_data->asp_ids, asp_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)asp_ids_node->data) == false) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [asp_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [asp_ids]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_sponsor_connectivity_data_writeJSON() failed [SponsorConnectivityData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_sponsor_connectivity_data_t *OpenAPI_sponsor_connectivity_data_parseFromJSON(cJSON *sponsor_connectivity_dataJSON)
 {
     OpenAPI_sponsor_connectivity_data_t *sponsor_connectivity_data_local_var = NULL;
@@ -94,7 +133,6 @@ end:
 OpenAPI_sponsor_connectivity_data_t *OpenAPI_sponsor_connectivity_data_copy(OpenAPI_sponsor_connectivity_data_t *dst, OpenAPI_sponsor_connectivity_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_sponsor_connectivity_data_convertToJSON(src);
@@ -103,21 +141,6 @@ OpenAPI_sponsor_connectivity_data_t *OpenAPI_sponsor_connectivity_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_sponsor_connectivity_data_free(dst);
     dst = OpenAPI_sponsor_connectivity_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ssc_mode.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ssc_modes_t *OpenAPI_ssc_modes_create(
 void OpenAPI_ssc_modes_free(OpenAPI_ssc_modes_t *ssc_modes);
 OpenAPI_ssc_modes_t *OpenAPI_ssc_modes_parseFromJSON(cJSON *ssc_modesJSON);
 cJSON *OpenAPI_ssc_modes_convertToJSON(OpenAPI_ssc_modes_t *ssc_modes);
+bool OpenAPI_ssc_modes_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ssc_modes_t *ssc_modes);
 OpenAPI_ssc_modes_t *OpenAPI_ssc_modes_copy(OpenAPI_ssc_modes_t *dst, OpenAPI_ssc_modes_t *src);
 
 #ifdef __cplusplus
@@ -62,6 +62,51 @@ end:
     return item;
 }
 
+bool OpenAPI_ssc_modes_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ssc_modes_1_t *ssc_modes_1)
+{
+    if (ssc_modes_1 == NULL) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [SscModes_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [SscModes_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "defaultSscMode", OpenAPI_ssc_mode_ToString(ssc_modes_1->default_ssc_mode)) == false) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [default_ssc_mode]");
+        goto end;
+    }
+
+    if (ssc_modes_1->allowed_ssc_modes) {
+    if (OpenAPI_json_write_array_start(writer, "allowedSscModes") == false) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [allowed_ssc_modes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_ssc_modes_node;
+    OpenAPI_list_for_each(ssc_modes_1->allowed_ssc_modes, allowed_ssc_modes_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_ssc_mode_ToString((intptr_t)allowed_ssc_modes_node->data)) == false) {
+            ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [allowed_ssc_modes]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [allowed_ssc_modes]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ssc_modes_1_writeJSON() failed [SscModes_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_parseFromJSON(cJSON *ssc_modes_1JSON)
 {
     OpenAPI_ssc_modes_1_t *ssc_modes_1_local_var = NULL;
@@ -113,7 +158,6 @@ end:
 OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_copy(OpenAPI_ssc_modes_1_t *dst, OpenAPI_ssc_modes_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ssc_modes_1_convertToJSON(src);
@@ -122,21 +166,6 @@ OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_copy(OpenAPI_ssc_modes_1_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ssc_modes_1_free(dst);
     dst = OpenAPI_ssc_modes_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ssc_mode.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_create(
 void OpenAPI_ssc_modes_1_free(OpenAPI_ssc_modes_1_t *ssc_modes_1);
 OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_parseFromJSON(cJSON *ssc_modes_1JSON);
 cJSON *OpenAPI_ssc_modes_1_convertToJSON(OpenAPI_ssc_modes_1_t *ssc_modes_1);
+bool OpenAPI_ssc_modes_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ssc_modes_1_t *ssc_modes_1);
 OpenAPI_ssc_modes_1_t *OpenAPI_ssc_modes_1_copy(OpenAPI_ssc_modes_1_t *dst, OpenAPI_ssc_modes_1_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_stationary_indication_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_stationary_indication_rm_t *stationary_indication_rm)
+{
+    if (stationary_indication_rm == NULL) {
+        ogs_error("OpenAPI_stationary_indication_rm_writeJSON() failed [StationaryIndicationRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_stationary_indication_rm_writeJSON() failed [StationaryIndicationRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_stationary_indication_rm_writeJSON() failed [StationaryIndicationRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_parseFromJSON(cJSON *stationary_indication_rmJSON)
 {
     OpenAPI_stationary_indication_rm_t *stationary_indication_rm_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_copy(OpenAPI_stationary_indication_rm_t *dst, OpenAPI_stationary_indication_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_stationary_indication_rm_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_stationary_indication_rm_free(dst);
     dst = OpenAPI_stationary_indication_rm_parseFromJSON(item);
     cJSON_Delete(item);
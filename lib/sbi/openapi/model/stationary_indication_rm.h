@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "null_value.h"
 #include "stationary_indication.h"
 
@@ -28,6 +29,7 @@ OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_create(
 void OpenAPI_stationary_indication_rm_free(OpenAPI_stationary_indication_rm_t *stationary_indication_rm);
 OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_parseFromJSON(cJSON *stationary_indication_rmJSON);
 cJSON *OpenAPI_stationary_indication_rm_convertToJSON(OpenAPI_stationary_indication_rm_t *stationary_indication_rm);
+bool OpenAPI_stationary_indication_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_stationary_indication_rm_t *stationary_indication_rm);
 OpenAPI_stationary_indication_rm_t *OpenAPI_stationary_indication_rm_copy(OpenAPI_stationary_indication_rm_t *dst, OpenAPI_stationary_indication_rm_t *src);
 
 #ifdef __cplusplus
@@ -78,6 +78,54 @@ end:
     return item;
 }
 
+bool OpenAPI_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_status_info_t *status_info)
+{
+    if (status_info == NULL) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [StatusInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [StatusInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceStatus", OpenAPI_resource_status_ToString(status_info->resource_status)) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [resource_status]");
+        goto end;
+    }
+
+    if (status_info->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(status_info->cause)) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (status_info->cn_assisted_ran_para) {
+    if (OpenAPI_cn_assisted_ran_para_writeJSON(writer, "cnAssistedRanPara", status_info->cn_assisted_ran_para) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [cn_assisted_ran_para]");
+        goto end;
+    }
+    }
+
+    if (status_info->an_type) {
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(status_info->an_type)) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [an_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_status_info_writeJSON() failed [StatusInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_status_info_t *OpenAPI_status_info_parseFromJSON(cJSON *status_infoJSON)
 {
     OpenAPI_status_info_t *status_info_local_var = NULL;
@@ -138,7 +186,6 @@ end:
 OpenAPI_status_info_t *OpenAPI_status_info_copy(OpenAPI_status_info_t *dst, OpenAPI_status_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_status_info_convertToJSON(src);
@@ -147,21 +194,6 @@ OpenAPI_status_info_t *OpenAPI_status_info_copy(OpenAPI_status_info_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_status_info_free(dst);
     dst = OpenAPI_status_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "cause.h"
 #include "cn_assisted_ran_para.h"
@@ -38,6 +39,7 @@ OpenAPI_status_info_t *OpenAPI_status_info_create(
 void OpenAPI_status_info_free(OpenAPI_status_info_t *status_info);
 OpenAPI_status_info_t *OpenAPI_status_info_parseFromJSON(cJSON *status_infoJSON);
 cJSON *OpenAPI_status_info_convertToJSON(OpenAPI_status_info_t *status_info);
+bool OpenAPI_status_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_status_info_t *status_info);
 OpenAPI_status_info_t *OpenAPI_status_info_copy(OpenAPI_status_info_t *dst, OpenAPI_status_info_t *src);
 
 #ifdef __cplusplus
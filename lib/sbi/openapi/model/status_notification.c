@@ -83,6 +83,47 @@ end:
     return item;
 }
 
+bool OpenAPI_status_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_status_notification_t *status_notification)
+{
+    if (status_notification == NULL) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [StatusNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [StatusNotification]");
+        return false;
+    }
+    if (OpenAPI_status_info_writeJSON(writer, "statusInfo", status_notification->status_info) == false) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [status_info]");
+        goto end;
+    }
+
+    if (status_notification->small_data_rate_status) {
+    if (OpenAPI_small_data_rate_status_writeJSON(writer, "smallDataRateStatus", status_notification->small_data_rate_status) == false) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [small_data_rate_status]");
+        goto end;
+    }
+    }
+
+    if (status_notification->apn_rate_status) {
+    if (OpenAPI_apn_rate_status_writeJSON(writer, "apnRateStatus", status_notification->apn_rate_status) == false) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [apn_rate_status]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_status_notification_writeJSON() failed [StatusNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_status_notification_t *OpenAPI_status_notification_parseFromJSON(cJSON *status_notificationJSON)
 {
     OpenAPI_status_notification_t *status_notification_local_var = NULL;
@@ -123,7 +164,6 @@ end:
 OpenAPI_status_notification_t *OpenAPI_status_notification_copy(OpenAPI_status_notification_t *dst, OpenAPI_status_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_status_notification_convertToJSON(src);
@@ -132,21 +172,6 @@ OpenAPI_status_notification_t *OpenAPI_status_notification_copy(OpenAPI_status_n
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_status_notification_free(dst);
     dst = OpenAPI_status_notification_parseFromJSON(item);
     cJSON_Delete(item);
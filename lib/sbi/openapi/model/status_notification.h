@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "apn_rate_status.h"
 #include "small_data_rate_status.h"
 #include "status_info.h"
@@ -35,6 +36,7 @@ OpenAPI_status_notification_t *OpenAPI_status_notification_create(
 void OpenAPI_status_notification_free(OpenAPI_status_notification_t *status_notification);
 OpenAPI_status_notification_t *OpenAPI_status_notification_parseFromJSON(cJSON *status_notificationJSON);
 cJSON *OpenAPI_status_notification_convertToJSON(OpenAPI_status_notification_t *status_notification);
+bool OpenAPI_status_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_status_notification_t *status_notification);
 OpenAPI_status_notification_t *OpenAPI_status_notification_copy(OpenAPI_status_notification_t *dst, OpenAPI_status_notification_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_steering_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_container_t *steering_container)
+{
+    if (steering_container == NULL) {
+        ogs_error("OpenAPI_steering_container_writeJSON() failed [SteeringContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_steering_container_writeJSON() failed [SteeringContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_steering_container_writeJSON() failed [SteeringContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_steering_container_t *OpenAPI_steering_container_parseFromJSON(cJSON *steering_containerJSON)
 {
     OpenAPI_steering_container_t *steering_container_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_steering_container_t *OpenAPI_steering_container_copy(OpenAPI_steering_container_t *dst, OpenAPI_steering_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_steering_container_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_steering_container_t *OpenAPI_steering_container_copy(OpenAPI_steering_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_steering_container_free(dst);
     dst = OpenAPI_steering_container_parseFromJSON(item);
     cJSON_Delete(item);
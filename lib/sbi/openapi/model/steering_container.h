@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "steering_info.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_steering_container_t *OpenAPI_steering_container_create(
 void OpenAPI_steering_container_free(OpenAPI_steering_container_t *steering_container);
 OpenAPI_steering_container_t *OpenAPI_steering_container_parseFromJSON(cJSON *steering_containerJSON);
 cJSON *OpenAPI_steering_container_convertToJSON(OpenAPI_steering_container_t *steering_container);
+bool OpenAPI_steering_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_container_t *steering_container);
 OpenAPI_steering_container_t *OpenAPI_steering_container_copy(OpenAPI_steering_container_t *dst, OpenAPI_steering_container_t *src);
 
 #ifdef __cplusplus
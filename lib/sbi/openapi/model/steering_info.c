@@ -77,6 +77,54 @@ end:
     return item;
 }
 
+bool OpenAPI_steering_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_info_t *steering_info)
+{
+    if (steering_info == NULL) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [SteeringInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [SteeringInfo]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", steering_info->plmn_id) == false) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (steering_info->access_tech_list) {
+    if (OpenAPI_json_write_array_start(writer, "accessTechList") == false) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [access_tech_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *access_tech_list_node;
+    if (steering_info->access_tech_list) {
+        OpenAPI_list_for_each(steering_info->access_tech_list, access_tech_list_node) {
+            if (OpenAPI_access_tech_writeJSON(writer, NULL, access_tech_list_node->data) == false) {
+                ogs_error("OpenAPI_steering_info_writeJSON() failed [access_tech_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [access_tech_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_steering_info_writeJSON() failed [SteeringInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_steering_info_t *OpenAPI_steering_info_parseFromJSON(cJSON *steering_infoJSON)
 {
     OpenAPI_steering_info_t *steering_info_local_var = NULL;
@@ -131,7 +179,6 @@ end:
 OpenAPI_steering_info_t *OpenAPI_steering_info_copy(OpenAPI_steering_info_t *dst, OpenAPI_steering_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_steering_info_convertToJSON(src);
@@ -140,21 +187,6 @@ OpenAPI_steering_info_t *OpenAPI_steering_info_copy(OpenAPI_steering_info_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_steering_info_free(dst);
     dst = OpenAPI_steering_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_tech.h"
 #include "plmn_id_1.h"
 
@@ -32,6 +33,7 @@ OpenAPI_steering_info_t *OpenAPI_steering_info_create(
 void OpenAPI_steering_info_free(OpenAPI_steering_info_t *steering_info);
 OpenAPI_steering_info_t *OpenAPI_steering_info_parseFromJSON(cJSON *steering_infoJSON);
 cJSON *OpenAPI_steering_info_convertToJSON(OpenAPI_steering_info_t *steering_info);
+bool OpenAPI_steering_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_info_t *steering_info);
 OpenAPI_steering_info_t *OpenAPI_steering_info_copy(OpenAPI_steering_info_t *dst, OpenAPI_steering_info_t *src);
 
 #ifdef __cplusplus
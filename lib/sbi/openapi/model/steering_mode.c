@@ -89,6 +89,61 @@ end:
     return item;
 }
 
+bool OpenAPI_steering_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_mode_t *steering_mode)
+{
+    if (steering_mode == NULL) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [SteeringMode]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [SteeringMode]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "steerModeValue", OpenAPI_steer_mode_value_ToString(steering_mode->steer_mode_value)) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [steer_mode_value]");
+        goto end;
+    }
+
+    if (steering_mode->active) {
+    if (OpenAPI_json_write_string(writer, "active", OpenAPI_access_type_ToString(steering_mode->active)) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [active]");
+        goto end;
+    }
+    }
+
+    if (steering_mode->standby) {
+    if (OpenAPI_access_type_rm_writeJSON(writer, "standby", steering_mode->standby) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [standby]");
+        goto end;
+    }
+    }
+
+    if (steering_mode->is__3g_load) {
+    if (OpenAPI_json_write_number(writer, "3gLoad", steering_mode->_3g_load) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [_3g_load]");
+        goto end;
+    }
+    }
+
+    if (steering_mode->prio_acc) {
+    if (OpenAPI_json_write_string(writer, "prioAcc", OpenAPI_access_type_ToString(steering_mode->prio_acc)) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [prio_acc]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_steering_mode_writeJSON() failed [SteeringMode]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_steering_mode_t *OpenAPI_steering_mode_parseFromJSON(cJSON *steering_modeJSON)
 {
     OpenAPI_steering_mode_t *steering_mode_local_var = NULL;
@@ -160,7 +215,6 @@ end:
 OpenAPI_steering_mode_t *OpenAPI_steering_mode_copy(OpenAPI_steering_mode_t *dst, OpenAPI_steering_mode_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_steering_mode_convertToJSON(src);
@@ -169,21 +223,6 @@ OpenAPI_steering_mode_t *OpenAPI_steering_mode_copy(OpenAPI_steering_mode_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_steering_mode_free(dst);
     dst = OpenAPI_steering_mode_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "access_type_rm.h"
 #include "steer_mode_value.h"
@@ -41,6 +42,7 @@ OpenAPI_steering_mode_t *OpenAPI_steering_mode_create(
 void OpenAPI_steering_mode_free(OpenAPI_steering_mode_t *steering_mode);
 OpenAPI_steering_mode_t *OpenAPI_steering_mode_parseFromJSON(cJSON *steering_modeJSON);
 cJSON *OpenAPI_steering_mode_convertToJSON(OpenAPI_steering_mode_t *steering_mode);
+bool OpenAPI_steering_mode_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_steering_mode_t *steering_mode);
 OpenAPI_steering_mode_t *OpenAPI_steering_mode_copy(OpenAPI_steering_mode_t *dst, OpenAPI_steering_mode_t *src);
 
 #ifdef __cplusplus
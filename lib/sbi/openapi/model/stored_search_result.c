@@ -61,6 +61,47 @@ end:
     return item;
 }
 
+bool OpenAPI_stored_search_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_stored_search_result_t *stored_search_result)
+{
+    if (stored_search_result == NULL) {
+        ogs_error("OpenAPI_stored_search_result_writeJSON() failed [StoredSearchResult]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_stored_search_result_writeJSON() failed [StoredSearchResult]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "nfInstances") == false) {
+        ogs_error("OpenAPI_stored_search_result_writeJSON() failed [nf_instances]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nf_instances_node;
+    if (stored_search_result->nf_instances) {
+        OpenAPI_list_for_each(stored_search_result->nf_instances, nf_instances_node) {
+            if (OpenAPI_nf_profile_writeJSON(writer, NULL, nf_instances_node->data) == false) {
+                ogs_error("OpenAPI_stored_search_result_writeJSON() failed [nf_instances]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_stored_search_result_writeJSON() failed [nf_instances]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_stored_search_result_writeJSON() failed [StoredSearchResult]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_parseFromJSON(cJSON *stored_search_resultJSON)
 {
     OpenAPI_stored_search_result_t *stored_search_result_local_var = NULL;
@@ -107,7 +148,6 @@ end:
 OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_copy(OpenAPI_stored_search_result_t *dst, OpenAPI_stored_search_result_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_stored_search_result_convertToJSON(src);
@@ -116,21 +156,6 @@ OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_copy(OpenAPI_stored
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_stored_search_result_free(dst);
     dst = OpenAPI_stored_search_result_parseFromJSON(item);
     cJSON_Delete(item);
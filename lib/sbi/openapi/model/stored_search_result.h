@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_profile.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_create(
 void OpenAPI_stored_search_result_free(OpenAPI_stored_search_result_t *stored_search_result);
 OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_parseFromJSON(cJSON *stored_search_resultJSON);
 cJSON *OpenAPI_stored_search_result_convertToJSON(OpenAPI_stored_search_result_t *stored_search_result);
+bool OpenAPI_stored_search_result_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_stored_search_result_t *stored_search_result);
 OpenAPI_stored_search_result_t *OpenAPI_stored_search_result_copy(OpenAPI_stored_search_result_t *dst, OpenAPI_stored_search_result_t *src);
 
 #ifdef __cplusplus
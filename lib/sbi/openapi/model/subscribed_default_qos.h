@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_subscribed_default_qos_t *OpenAPI_subscribed_default_qos_create(
 void OpenAPI_subscribed_default_qos_free(OpenAPI_subscribed_default_qos_t *subscribed_default_qos);
 OpenAPI_subscribed_default_qos_t *OpenAPI_subscribed_default_qos_parseFromJSON(cJSON *subscribed_default_qosJSON);
 cJSON *OpenAPI_subscribed_default_qos_convertToJSON(OpenAPI_subscribed_default_qos_t *subscribed_default_qos);
+bool OpenAPI_subscribed_default_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_default_qos_t *subscribed_default_qos);
 OpenAPI_subscribed_default_qos_t *OpenAPI_subscribed_default_qos_copy(OpenAPI_subscribed_default_qos_t *dst, OpenAPI_subscribed_default_qos_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,45 @@ end:
     return item;
 }
 
+bool OpenAPI_subscribed_default_qos_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_default_qos_1_t *subscribed_default_qos_1)
+{
+    if (subscribed_default_qos_1 == NULL) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [SubscribedDefaultQos_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [SubscribedDefaultQos_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "5qi", subscribed_default_qos_1->_5qi) == false) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [_5qi]");
+        goto end;
+    }
+
+    if (OpenAPI_arp_1_writeJSON(writer, "arp", subscribed_default_qos_1->arp) == false) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [arp]");
+        goto end;
+    }
+
+    if (subscribed_default_qos_1->is_priority_level) {
+    if (OpenAPI_json_write_number(writer, "priorityLevel", subscribed_default_qos_1->priority_level) == false) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [priority_level]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscribed_default_qos_1_writeJSON() failed [SubscribedDefaultQos_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_parseFromJSON(cJSON *subscribed_default_qos_1JSON)
 {
     OpenAPI_subscribed_default_qos_1_t *subscribed_default_qos_1_local_var = NULL;
@@ -117,7 +156,6 @@ end:
 OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_copy(OpenAPI_subscribed_default_qos_1_t *dst, OpenAPI_subscribed_default_qos_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscribed_default_qos_1_convertToJSON(src);
@@ -126,21 +164,6 @@ OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscribed_default_qos_1_free(dst);
     dst = OpenAPI_subscribed_default_qos_1_parseFromJSON(item);
     cJSON_Delete(item);
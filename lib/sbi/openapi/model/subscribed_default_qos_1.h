@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp_1.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_create(
 void OpenAPI_subscribed_default_qos_1_free(OpenAPI_subscribed_default_qos_1_t *subscribed_default_qos_1);
 OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_parseFromJSON(cJSON *subscribed_default_qos_1JSON);
 cJSON *OpenAPI_subscribed_default_qos_1_convertToJSON(OpenAPI_subscribed_default_qos_1_t *subscribed_default_qos_1);
+bool OpenAPI_subscribed_default_qos_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_default_qos_1_t *subscribed_default_qos_1);
 OpenAPI_subscribed_default_qos_1_t *OpenAPI_subscribed_default_qos_1_copy(OpenAPI_subscribed_default_qos_1_t *dst, OpenAPI_subscribed_default_qos_1_t *src);
 
 #ifdef __cplusplus
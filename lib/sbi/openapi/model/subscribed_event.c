@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_subscribed_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_event_t *subscribed_event)
+{
+    if (subscribed_event == NULL) {
+        ogs_error("OpenAPI_subscribed_event_writeJSON() failed [SubscribedEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscribed_event_writeJSON() failed [SubscribedEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscribed_event_writeJSON() failed [SubscribedEvent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_parseFromJSON(cJSON *subscribed_eventJSON)
 {
     OpenAPI_subscribed_event_t *subscribed_event_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_copy(OpenAPI_subscribed_event_t *dst, OpenAPI_subscribed_event_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscribed_event_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_copy(OpenAPI_subscribed_eve
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscribed_event_free(dst);
     dst = OpenAPI_subscribed_event_parseFromJSON(item);
     cJSON_Delete(item);
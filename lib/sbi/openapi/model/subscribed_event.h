@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "subscribed_event_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_create(
 void OpenAPI_subscribed_event_free(OpenAPI_subscribed_event_t *subscribed_event);
 OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_parseFromJSON(cJSON *subscribed_eventJSON);
 cJSON *OpenAPI_subscribed_event_convertToJSON(OpenAPI_subscribed_event_t *subscribed_event);
+bool OpenAPI_subscribed_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_event_t *subscribed_event);
 OpenAPI_subscribed_event_t *OpenAPI_subscribed_event_copy(OpenAPI_subscribed_event_t *dst, OpenAPI_subscribed_event_t *src);
 
 #ifdef __cplusplus
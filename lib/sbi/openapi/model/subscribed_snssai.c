@@ -62,6 +62,40 @@ end:
     return item;
 }
 
+bool OpenAPI_subscribed_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_snssai_t *subscribed_snssai)
+{
+    if (subscribed_snssai == NULL) {
+        ogs_error("OpenAPI_subscribed_snssai_writeJSON() failed [SubscribedSnssai]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscribed_snssai_writeJSON() failed [SubscribedSnssai]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "subscribedSnssai", subscribed_snssai->subscribed_snssai) == false) {
+        ogs_error("OpenAPI_subscribed_snssai_writeJSON() failed [subscribed_snssai]");
+        goto end;
+    }
+
+    if (subscribed_snssai->is_default_indication) {
+    if (OpenAPI_json_write_bool(writer, "defaultIndication", subscribed_snssai->default_indication) == false) {
+        ogs_error("OpenAPI_subscribed_snssai_writeJSON() failed [default_indication]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscribed_snssai_writeJSON() failed [SubscribedSnssai]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_parseFromJSON(cJSON *subscribed_snssaiJSON)
 {
     OpenAPI_subscribed_snssai_t *subscribed_snssai_local_var = NULL;
@@ -97,7 +131,6 @@ end:
 OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_copy(OpenAPI_subscribed_snssai_t *dst, OpenAPI_subscribed_snssai_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscribed_snssai_convertToJSON(src);
@@ -106,21 +139,6 @@ OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_copy(OpenAPI_subscribed_s
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscribed_snssai_free(dst);
     dst = OpenAPI_subscribed_snssai_parseFromJSON(item);
     cJSON_Delete(item);
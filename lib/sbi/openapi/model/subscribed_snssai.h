@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_create(
 void OpenAPI_subscribed_snssai_free(OpenAPI_subscribed_snssai_t *subscribed_snssai);
 OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_parseFromJSON(cJSON *subscribed_snssaiJSON);
 cJSON *OpenAPI_subscribed_snssai_convertToJSON(OpenAPI_subscribed_snssai_t *subscribed_snssai);
+bool OpenAPI_subscribed_snssai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscribed_snssai_t *subscribed_snssai);
 OpenAPI_subscribed_snssai_t *OpenAPI_subscribed_snssai_copy(OpenAPI_subscribed_snssai_t *dst, OpenAPI_subscribed_snssai_t *src);
 
 #ifdef __cplusplus
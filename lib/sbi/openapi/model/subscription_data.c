@@ -316,6 +316,231 @@ end:
     return item;
 }
 
+bool OpenAPI_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_t *subscription_data)
+{
+    if (subscription_data == NULL) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [SubscriptionData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [SubscriptionData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "nfStatusNotificationUri", subscription_data->nf_status_notification_uri) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [nf_status_notification_uri]");
+        goto end;
+    }
+
+    if (subscription_data->req_nf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "reqNfInstanceId", subscription_data->req_nf_instance_id) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_nf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->subscr_cond) {
+    if (OpenAPI_subscription_data_subscr_cond_writeJSON(writer, "subscrCond", subscription_data->subscr_cond) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [subscr_cond]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->subscription_id) {
+    if (OpenAPI_json_write_string(writer, "subscriptionId", subscription_data->subscription_id) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", subscription_data->validity_time) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_notif_events) {
+    if (OpenAPI_json_write_array_start(writer, "reqNotifEvents") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_notif_events]");
+        goto end;
+    }
+    OpenAPI_lnode_t *req_notif_events_node;
+    OpenAPI_list_for_each(subscription_data->req_notif_events, req_notif_events_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_notification_event_type_ToString((intptr_t)req_notif_events_node->data)) == false) {
+            ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_notif_events]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_notif_events]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", subscription_data->plmn_id) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", subscription_data->nid) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->notif_condition) {
+    if (OpenAPI_notif_condition_writeJSON(writer, "notifCondition", subscription_data->notif_condition) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [notif_condition]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_nf_type) {
+    if (OpenAPI_json_write_string(writer, "reqNfType", OpenAPI_nf_type_ToString(subscription_data->req_nf_type)) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_nf_type]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_nf_fqdn) {
+    if (OpenAPI_json_write_string(writer, "reqNfFqdn", subscription_data->req_nf_fqdn) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_nf_fqdn]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "reqSnssais") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *req_snssais_node;
+    if (subscription_data->req_snssais) {
+        OpenAPI_list_for_each(subscription_data->req_snssais, req_snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, req_snssais_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snssais]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_per_plmn_snssais) {
+    if (OpenAPI_json_write_array_start(writer, "reqPerPlmnSnssais") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_per_plmn_snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *req_per_plmn_snssais_node;
+    if (subscription_data->req_per_plmn_snssais) {
+        OpenAPI_list_for_each(subscription_data->req_per_plmn_snssais, req_per_plmn_snssais_node) {
+            if (OpenAPI_plmn_snssai_writeJSON(writer, NULL, req_per_plmn_snssais_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_per_plmn_snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_per_plmn_snssais]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_plmn_list) {
+    if (OpenAPI_json_write_array_start(writer, "reqPlmnList") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_plmn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *req_plmn_list_node;
+    if (subscription_data->req_plmn_list) {
+        OpenAPI_list_for_each(subscription_data->req_plmn_list, req_plmn_list_node) {
+            if (OpenAPI_plmn_id_writeJSON(writer, NULL, req_plmn_list_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_plmn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_plmn_list]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->req_snpn_list) {
+    if (OpenAPI_json_write_array_start(writer, "reqSnpnList") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snpn_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *req_snpn_list_node;
+    if (subscription_data->req_snpn_list) {
+        OpenAPI_list_for_each(subscription_data->req_snpn_list, req_snpn_list_node) {
+            if (OpenAPI_plmn_id_nid_writeJSON(writer, NULL, req_snpn_list_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snpn_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [req_snpn_list]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->serving_scope) {
+    if (OpenAPI_json_write_array_start(writer, "servingScope") == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *serving_scope_node;
+    OpenAPI_list_for_each(subscription_data->serving_scope, serving_scope_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)serving_scope_node->data) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [serving_scope]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->requester_features) {
+    if (OpenAPI_json_write_string(writer, "requesterFeatures", subscription_data->requester_features) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [requester_features]");
+        goto end;
+    }
+    }
+
+    if (subscription_data->nrf_supported_features) {
+    if (OpenAPI_json_write_string(writer, "nrfSupportedFeatures", subscription_data->nrf_supported_features) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [nrf_supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_writeJSON() failed [SubscriptionData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscription_data_t *OpenAPI_subscription_data_parseFromJSON(cJSON *subscription_dataJSON)
 {
     OpenAPI_subscription_data_t *subscription_data_local_var = NULL;
@@ -612,7 +837,6 @@ end:
 OpenAPI_subscription_data_t *OpenAPI_subscription_data_copy(OpenAPI_subscription_data_t *dst, OpenAPI_subscription_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_convertToJSON(src);
@@ -621,21 +845,6 @@ OpenAPI_subscription_data_t *OpenAPI_subscription_data_copy(OpenAPI_subscription
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_free(dst);
     dst = OpenAPI_subscription_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "nf_type.h"
 #include "notif_condition.h"
 #include "notification_event_type.h"
@@ -70,6 +71,7 @@ OpenAPI_subscription_data_t *OpenAPI_subscription_data_create(
 void OpenAPI_subscription_data_free(OpenAPI_subscription_data_t *subscription_data);
 OpenAPI_subscription_data_t *OpenAPI_subscription_data_parseFromJSON(cJSON *subscription_dataJSON);
 cJSON *OpenAPI_subscription_data_convertToJSON(OpenAPI_subscription_data_t *subscription_data);
+bool OpenAPI_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_t *subscription_data);
 OpenAPI_subscription_data_t *OpenAPI_subscription_data_copy(OpenAPI_subscription_data_t *dst, OpenAPI_subscription_data_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_and_mobility_subscription_data.h"
 #include "lcs_broadcast_assistance_types_data.h"
 #include "lcs_mo_data.h"
@@ -65,6 +66,7 @@ OpenAPI_subscription_data_sets_t *OpenAPI_subscription_data_sets_create(
 void OpenAPI_subscription_data_sets_free(OpenAPI_subscription_data_sets_t *subscription_data_sets);
 OpenAPI_subscription_data_sets_t *OpenAPI_subscription_data_sets_parseFromJSON(cJSON *subscription_data_setsJSON);
 cJSON *OpenAPI_subscription_data_sets_convertToJSON(OpenAPI_subscription_data_sets_t *subscription_data_sets);
+bool OpenAPI_subscription_data_sets_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_sets_t *subscription_data_sets);
 OpenAPI_subscription_data_sets_t *OpenAPI_subscription_data_sets_copy(OpenAPI_subscription_data_sets_t *dst, OpenAPI_subscription_data_sets_t *src);
 
 #ifdef __cplusplus
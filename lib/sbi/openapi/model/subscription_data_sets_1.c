@@ -255,6 +255,133 @@ end:
     return item;
 }
 
+bool OpenAPI_subscription_data_sets_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_sets_1_t *subscription_data_sets_1)
+{
+    if (subscription_data_sets_1 == NULL) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [SubscriptionDataSets_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [SubscriptionDataSets_1]");
+        return false;
+    }
+    if (subscription_data_sets_1->am_data) {
+    if (OpenAPI_access_and_mobility_subscription_data_1_writeJSON(writer, "amData", subscription_data_sets_1->am_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [am_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->smf_sel_data) {
+    if (OpenAPI_smf_selection_subscription_data_1_writeJSON(writer, "smfSelData", subscription_data_sets_1->smf_sel_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [smf_sel_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->uec_amf_data) {
+    if (OpenAPI_ue_context_in_amf_data_1_writeJSON(writer, "uecAmfData", subscription_data_sets_1->uec_amf_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [uec_amf_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->uec_smf_data) {
+    if (OpenAPI_ue_context_in_smf_data_1_writeJSON(writer, "uecSmfData", subscription_data_sets_1->uec_smf_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [uec_smf_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->uec_smsf_data) {
+    if (OpenAPI_ue_context_in_smsf_data_1_writeJSON(writer, "uecSmsfData", subscription_data_sets_1->uec_smsf_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [uec_smsf_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->sms_subs_data) {
+    if (OpenAPI_sms_subscription_data_1_writeJSON(writer, "smsSubsData", subscription_data_sets_1->sms_subs_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [sms_subs_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->sm_data) {
+    if (OpenAPI_json_write_array_start(writer, "smData") == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [sm_data]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *sm_data_node;
+    if (subscription_data_sets_1->sm_data) {
+        OpenAPI_list_for_each(subscription_data_sets_1->sm_data, sm_data_node) {
+            if (OpenAPI_session_management_subscription_data_1_writeJSON(writer, NULL, sm_data_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [sm_data]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [sm_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", subscription_data_sets_1->trace_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->sms_mng_data) {
+    if (OpenAPI_sms_management_subscription_data_1_writeJSON(writer, "smsMngData", subscription_data_sets_1->sms_mng_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [sms_mng_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->lcs_privacy_data) {
+    if (OpenAPI_lcs_privacy_data_1_writeJSON(writer, "lcsPrivacyData", subscription_data_sets_1->lcs_privacy_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [lcs_privacy_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->lcs_mo_data) {
+    if (OpenAPI_lcs_mo_data_writeJSON(writer, "lcsMoData", subscription_data_sets_1->lcs_mo_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [lcs_mo_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->v2x_data) {
+    if (OpenAPI_v2x_subscription_data_1_writeJSON(writer, "v2xData", subscription_data_sets_1->v2x_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [v2x_data]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_sets_1->lcs_broadcast_assistance_types_data) {
+    if (OpenAPI_lcs_broadcast_assistance_types_data_1_writeJSON(writer, "lcsBroadcastAssistanceTypesData", subscription_data_sets_1->lcs_broadcast_assistance_types_data) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [lcs_broadcast_assistance_types_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_sets_1_writeJSON() failed [SubscriptionDataSets_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_parseFromJSON(cJSON *subscription_data_sets_1JSON)
 {
     OpenAPI_subscription_data_sets_1_t *subscription_data_sets_1_local_var = NULL;
@@ -395,7 +522,6 @@ end:
 OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_copy(OpenAPI_subscription_data_sets_1_t *dst, OpenAPI_subscription_data_sets_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_sets_1_convertToJSON(src);
@@ -404,21 +530,6 @@ OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_sets_1_free(dst);
     dst = OpenAPI_subscription_data_sets_1_parseFromJSON(item);
     cJSON_Delete(item);
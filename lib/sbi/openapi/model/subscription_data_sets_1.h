@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_and_mobility_subscription_data_1.h"
 #include "lcs_broadcast_assistance_types_data_1.h"
 #include "lcs_mo_data.h"
@@ -65,6 +66,7 @@ OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_create(
 void OpenAPI_subscription_data_sets_1_free(OpenAPI_subscription_data_sets_1_t *subscription_data_sets_1);
 OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_parseFromJSON(cJSON *subscription_data_sets_1JSON);
 cJSON *OpenAPI_subscription_data_sets_1_convertToJSON(OpenAPI_subscription_data_sets_1_t *subscription_data_sets_1);
+bool OpenAPI_subscription_data_sets_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_sets_1_t *subscription_data_sets_1);
 OpenAPI_subscription_data_sets_1_t *OpenAPI_subscription_data_sets_1_copy(OpenAPI_subscription_data_sets_1_t *dst, OpenAPI_subscription_data_sets_1_t *src);
 
 #ifdef __cplusplus
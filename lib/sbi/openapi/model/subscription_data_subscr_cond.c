@@ -238,6 +238,185 @@ end:
     return item;
 }
 
+bool OpenAPI_subscription_data_subscr_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_subscr_cond_t *subscription_data_subscr_cond)
+{
+    if (subscription_data_subscr_cond == NULL) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [SubscriptionData_subscrCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [SubscriptionData_subscrCond]");
+        return false;
+    }
+    if (subscription_data_subscr_cond->nf_instance_id) {
+    if (OpenAPI_json_write_string(writer, "nfInstanceId", subscription_data_subscr_cond->nf_instance_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nf_instance_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->nf_type) {
+    if (OpenAPI_json_write_string(writer, "nfType", OpenAPI_nf_type_ToString(subscription_data_subscr_cond->nf_type)) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nf_type]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->service_name) {
+    if (OpenAPI_json_write_string(writer, "serviceName", subscription_data_subscr_cond->service_name) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [service_name]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->amf_set_id) {
+    if (OpenAPI_json_write_string(writer, "amfSetId", subscription_data_subscr_cond->amf_set_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [amf_set_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->amf_region_id) {
+    if (OpenAPI_json_write_string(writer, "amfRegionId", subscription_data_subscr_cond->amf_region_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [amf_region_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->guami_list) {
+    if (OpenAPI_json_write_array_start(writer, "guamiList") == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [guami_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *guami_list_node;
+    if (subscription_data_subscr_cond->guami_list) {
+        OpenAPI_list_for_each(subscription_data_subscr_cond->guami_list, guami_list_node) {
+            if (OpenAPI_guami_writeJSON(writer, NULL, guami_list_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [guami_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [guami_list]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->snssai_list) {
+    if (OpenAPI_json_write_array_start(writer, "snssaiList") == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssai_list_node;
+    if (subscription_data_subscr_cond->snssai_list) {
+        OpenAPI_list_for_each(subscription_data_subscr_cond->snssai_list, snssai_list_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssai_list_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [snssai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [snssai_list]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->nsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "nsiList") == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *nsi_list_node;
+    OpenAPI_list_for_each(subscription_data_subscr_cond->nsi_list, nsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)nsi_list_node->data) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nsi_list]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->nf_group_id) {
+    if (OpenAPI_json_write_string(writer, "nfGroupId", subscription_data_subscr_cond->nf_group_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nf_group_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->nf_set_id) {
+    if (OpenAPI_json_write_string(writer, "nfSetId", subscription_data_subscr_cond->nf_set_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nf_set_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->nf_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "nfServiceSetId", subscription_data_subscr_cond->nf_service_set_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [nf_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->smf_serving_area) {
+    if (OpenAPI_json_write_array_start(writer, "smfServingArea") == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_serving_area_node;
+    OpenAPI_list_for_each(subscription_data_subscr_cond->smf_serving_area, smf_serving_area_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)smf_serving_area_node->data) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscr_cond->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (subscription_data_subscr_cond->tai_list) {
+        OpenAPI_list_for_each(subscription_data_subscr_cond->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscr_cond_writeJSON() failed [SubscriptionData_subscrCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscription_data_subscr_cond_t *OpenAPI_subscription_data_subscr_cond_parseFromJSON(cJSON *subscription_data_subscr_condJSON)
 {
     OpenAPI_subscription_data_subscr_cond_t *subscription_data_subscr_cond_local_var = NULL;
@@ -466,7 +645,6 @@ end:
 OpenAPI_subscription_data_subscr_cond_t *OpenAPI_subscription_data_subscr_cond_copy(OpenAPI_subscription_data_subscr_cond_t *dst, OpenAPI_subscription_data_subscr_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_subscr_cond_convertToJSON(src);
@@ -475,21 +653,6 @@ OpenAPI_subscription_data_subscr_cond_t *OpenAPI_subscription_data_subscr_cond_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_subscr_cond_free(dst);
     dst = OpenAPI_subscription_data_subscr_cond_parseFromJSON(item);
     cJSON_Delete(item);
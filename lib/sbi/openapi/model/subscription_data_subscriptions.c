@@ -131,6 +131,92 @@ end:
     return item;
 }
 
+bool OpenAPI_subscription_data_subscriptions_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_subscription_data_subscriptions_t *subscription_data_subscriptions)
+{
+    if (subscription_data_subscriptions == NULL) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [SubscriptionDataSubscriptions]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [SubscriptionDataSubscriptions]");
+        return false;
+    }
+    if (subscription_data_subscriptions->ue_id) {
+    if (OpenAPI_json_write_string(writer, "ueId", subscription_data_subscriptions->ue_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [ue_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "callbackReference", subscription_data_subscriptions->callback_reference) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [callback_reference]");
+        goto end;
+    }
+
+    if (subscription_data_subscriptions->original_callback_reference) {
+    if (OpenAPI_json_write_string(writer, "originalCallbackReference", subscription_data_subscriptions->original_callback_reference) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [original_callback_reference]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "monitoredResourceUris") == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *monitored_resource_uris_node;
+    OpenAPI_list_for_each(subscription_data_subscriptions->monitored_resource_uris, monitored_resource_uris_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)monitored_resource_uris_node->data) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [monitored_resource_uris]");
+        goto end;
+    }
+
+    if (subscription_data_subscriptions->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", subscription_data_subscriptions->expiry) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscriptions->sdm_subscription) {
+    if (OpenAPI_sdm_subscription_1_writeJSON(writer, "sdmSubscription", subscription_data_subscriptions->sdm_subscription) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [sdm_subscription]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscriptions->subscription_id) {
+    if (OpenAPI_json_write_string(writer, "subscriptionId", subscription_data_subscriptions->subscription_id) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [subscription_id]");
+        goto end;
+    }
+    }
+
+    if (subscription_data_subscriptions->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supported-features", subscription_data_subscriptions->supported_features) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_subscription_data_subscriptions_writeJSON() failed [SubscriptionDataSubscriptions]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_subscription_data_subscriptions_t *OpenAPI_subscription_data_subscriptions_parseFromJSON(cJSON *subscription_data_subscriptionsJSON)
 {
     OpenAPI_subscription_data_subscriptions_t *subscription_data_subscriptions_local_var = NULL;
@@ -238,7 +324,6 @@ end:
 OpenAPI_subscription_data_subscriptions_t *OpenAPI_subscription_data_subscriptions_copy(OpenAPI_subscription_data_subscriptions_t *dst, OpenAPI_subscription_data_subscriptions_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_subscription_data_subscriptions_convertToJSON(src);
@@ -247,21 +332,6 @@ OpenAPI_subscription_data_subscriptions_t *OpenAPI_subscription_data_subscriptio
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_subscription_data_subscriptions_free(dst);
     dst = OpenAPI_subscription_data_subscriptions_parseFromJSON(item);
     cJSON_Delete(item);
@@ -54,6 +54,40 @@ end:
     return item;
 }
 
+bool OpenAPI_suggested_packet_num_dl_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_suggested_packet_num_dl_t *suggested_packet_num_dl)
+{
+    if (suggested_packet_num_dl == NULL) {
+        ogs_error("OpenAPI_suggested_packet_num_dl_writeJSON() failed [SuggestedPacketNumDl]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_suggested_packet_num_dl_writeJSON() failed [SuggestedPacketNumDl]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "suggestedPacketNumDl", suggested_packet_num_dl->suggested_packet_num_dl) == false) {
+        ogs_error("OpenAPI_suggested_packet_num_dl_writeJSON() failed [suggested_packet_num_dl]");
+        goto end;
+    }
+
+    if (suggested_packet_num_dl->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", suggested_packet_num_dl->validity_time) == false) {
+        ogs_error("OpenAPI_suggested_packet_num_dl_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_suggested_packet_num_dl_writeJSON() failed [SuggestedPacketNumDl]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_suggested_packet_num_dl_t *OpenAPI_suggested_packet_num_dl_parseFromJSON(cJSON *suggested_packet_num_dlJSON)
 {
     OpenAPI_suggested_packet_num_dl_t *suggested_packet_num_dl_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_suggested_packet_num_dl_t *OpenAPI_suggested_packet_num_dl_copy(OpenAPI_suggested_packet_num_dl_t *dst, OpenAPI_suggested_packet_num_dl_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_suggested_packet_num_dl_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_suggested_packet_num_dl_t *OpenAPI_suggested_packet_num_dl_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_suggested_packet_num_dl_free(dst);
     dst = OpenAPI_suggested_packet_num_dl_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_supi_range_t *OpenAPI_supi_range_create(
 void OpenAPI_supi_range_free(OpenAPI_supi_range_t *supi_range);
 OpenAPI_supi_range_t *OpenAPI_supi_range_parseFromJSON(cJSON *supi_rangeJSON);
 cJSON *OpenAPI_supi_range_convertToJSON(OpenAPI_supi_range_t *supi_range);
+bool OpenAPI_supi_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_supi_range_t *supi_range);
 OpenAPI_supi_range_t *OpenAPI_supi_range_copy(OpenAPI_supi_range_t *dst, OpenAPI_supi_range_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_supported_gad_shapes_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_supported_gad_shapes_t *supported_gad_shapes)
+{
+    if (supported_gad_shapes == NULL) {
+        ogs_error("OpenAPI_supported_gad_shapes_writeJSON() failed [SupportedGADShapes]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_supported_gad_shapes_writeJSON() failed [SupportedGADShapes]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_supported_gad_shapes_writeJSON() failed [SupportedGADShapes]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_supported_gad_shapes_t *OpenAPI_supported_gad_shapes_parseFromJSON(cJSON *supported_gad_shapesJSON)
 {
     OpenAPI_supported_gad_shapes_t *supported_gad_shapes_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_supported_gad_shapes_t *OpenAPI_supported_gad_shapes_copy(OpenAPI_supported_gad_shapes_t *dst, OpenAPI_supported_gad_shapes_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_supported_gad_shapes_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_supported_gad_shapes_t *OpenAPI_supported_gad_shapes_copy(OpenAPI_suppor
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_supported_gad_shapes_free(dst);
     dst = OpenAPI_supported_gad_shapes_parseFromJSON(item);
     cJSON_Delete(item);
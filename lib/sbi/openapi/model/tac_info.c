@@ -57,6 +57,45 @@ end:
     return item;
 }
 
+bool OpenAPI_tac_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tac_info_t *tac_info)
+{
+    if (tac_info == NULL) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [TacInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [TacInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "tacList") == false) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [tac_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tac_list_node;
+    OpenAPI_list_for_each(tac_info->tac_list, tac_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)tac_list_node->data) == false) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [tac_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [tac_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tac_info_writeJSON() failed [TacInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tac_info_t *OpenAPI_tac_info_parseFromJSON(cJSON *tac_infoJSON)
 {
     OpenAPI_tac_info_t *tac_info_local_var = NULL;
@@ -94,7 +133,6 @@ end:
 OpenAPI_tac_info_t *OpenAPI_tac_info_copy(OpenAPI_tac_info_t *dst, OpenAPI_tac_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tac_info_convertToJSON(src);
@@ -103,21 +141,6 @@ OpenAPI_tac_info_t *OpenAPI_tac_info_copy(OpenAPI_tac_info_t *dst, OpenAPI_tac_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tac_info_free(dst);
     dst = OpenAPI_tac_info_parseFromJSON(item);
     cJSON_Delete(item);
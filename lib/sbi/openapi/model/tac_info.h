@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_tac_info_t *OpenAPI_tac_info_create(
 void OpenAPI_tac_info_free(OpenAPI_tac_info_t *tac_info);
 OpenAPI_tac_info_t *OpenAPI_tac_info_parseFromJSON(cJSON *tac_infoJSON);
 cJSON *OpenAPI_tac_info_convertToJSON(OpenAPI_tac_info_t *tac_info);
+bool OpenAPI_tac_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tac_info_t *tac_info);
 OpenAPI_tac_info_t *OpenAPI_tac_info_copy(OpenAPI_tac_info_t *dst, OpenAPI_tac_info_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_tac_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tac_range_t *tac_range)
+{
+    if (tac_range == NULL) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [TacRange]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [TacRange]");
+        return false;
+    }
+    if (tac_range->start) {
+    if (OpenAPI_json_write_string(writer, "start", tac_range->start) == false) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [start]");
+        goto end;
+    }
+    }
+
+    if (tac_range->end) {
+    if (OpenAPI_json_write_string(writer, "end", tac_range->end) == false) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [end]");
+        goto end;
+    }
+    }
+
+    if (tac_range->pattern) {
+    if (OpenAPI_json_write_string(writer, "pattern", tac_range->pattern) == false) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [pattern]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tac_range_writeJSON() failed [TacRange]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tac_range_t *OpenAPI_tac_range_parseFromJSON(cJSON *tac_rangeJSON)
 {
     OpenAPI_tac_range_t *tac_range_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_tac_range_t *OpenAPI_tac_range_copy(OpenAPI_tac_range_t *dst, OpenAPI_tac_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tac_range_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_tac_range_t *OpenAPI_tac_range_copy(OpenAPI_tac_range_t *dst, OpenAPI_ta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tac_range_free(dst);
     dst = OpenAPI_tac_range_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_tac_range_t *OpenAPI_tac_range_create(
 void OpenAPI_tac_range_free(OpenAPI_tac_range_t *tac_range);
 OpenAPI_tac_range_t *OpenAPI_tac_range_parseFromJSON(cJSON *tac_rangeJSON);
 cJSON *OpenAPI_tac_range_convertToJSON(OpenAPI_tac_range_t *tac_range);
+bool OpenAPI_tac_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tac_range_t *tac_range);
 OpenAPI_tac_range_t *OpenAPI_tac_range_copy(OpenAPI_tac_range_t *dst, OpenAPI_tac_range_t *src);
 
 #ifdef __cplusplus
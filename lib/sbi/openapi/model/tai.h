@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_tai_t *OpenAPI_tai_create(
 void OpenAPI_tai_free(OpenAPI_tai_t *tai);
 OpenAPI_tai_t *OpenAPI_tai_parseFromJSON(cJSON *taiJSON);
 cJSON *OpenAPI_tai_convertToJSON(OpenAPI_tai_t *tai);
+bool OpenAPI_tai_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tai_t *tai);
 OpenAPI_tai_t *OpenAPI_tai_copy(OpenAPI_tai_t *dst, OpenAPI_tai_t *src);
 
 #ifdef __cplusplus
@@ -69,6 +69,45 @@ end:
     return item;
 }
 
+bool OpenAPI_tai_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tai_1_t *tai_1)
+{
+    if (tai_1 == NULL) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [Tai_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [Tai_1]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_1_writeJSON(writer, "plmnId", tai_1->plmn_id) == false) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "tac", tai_1->tac) == false) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [tac]");
+        goto end;
+    }
+
+    if (tai_1->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", tai_1->nid) == false) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tai_1_writeJSON() failed [Tai_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tai_1_t *OpenAPI_tai_1_parseFromJSON(cJSON *tai_1JSON)
 {
     OpenAPI_tai_1_t *tai_1_local_var = NULL;
@@ -115,7 +154,6 @@ end:
 OpenAPI_tai_1_t *OpenAPI_tai_1_copy(OpenAPI_tai_1_t *dst, OpenAPI_tai_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tai_1_convertToJSON(src);
@@ -124,21 +162,6 @@ OpenAPI_tai_1_t *OpenAPI_tai_1_copy(OpenAPI_tai_1_t *dst, OpenAPI_tai_1_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tai_1_free(dst);
     dst = OpenAPI_tai_1_parseFromJSON(item);
     cJSON_Delete(item);
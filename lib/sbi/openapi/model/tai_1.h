@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id_1.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_tai_1_t *OpenAPI_tai_1_create(
 void OpenAPI_tai_1_free(OpenAPI_tai_1_t *tai_1);
 OpenAPI_tai_1_t *OpenAPI_tai_1_parseFromJSON(cJSON *tai_1JSON);
 cJSON *OpenAPI_tai_1_convertToJSON(OpenAPI_tai_1_t *tai_1);
+bool OpenAPI_tai_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tai_1_t *tai_1);
 OpenAPI_tai_1_t *OpenAPI_tai_1_copy(OpenAPI_tai_1_t *dst, OpenAPI_tai_1_t *src);
 
 #ifdef __cplusplus
@@ -85,6 +85,59 @@ end:
     return item;
 }
 
+bool OpenAPI_tai_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tai_range_t *tai_range)
+{
+    if (tai_range == NULL) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [TaiRange]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [TaiRange]");
+        return false;
+    }
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", tai_range->plmn_id) == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "tacRangeList") == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [tac_range_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tac_range_list_node;
+    if (tai_range->tac_range_list) {
+        OpenAPI_list_for_each(tai_range->tac_range_list, tac_range_list_node) {
+            if (OpenAPI_tac_range_writeJSON(writer, NULL, tac_range_list_node->data) == false) {
+                ogs_error("OpenAPI_tai_range_writeJSON() failed [tac_range_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [tac_range_list]");
+        goto end;
+    }
+
+    if (tai_range->nid) {
+    if (OpenAPI_json_write_string(writer, "nid", tai_range->nid) == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [nid]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tai_range_writeJSON() failed [TaiRange]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tai_range_t *OpenAPI_tai_range_parseFromJSON(cJSON *tai_rangeJSON)
 {
     OpenAPI_tai_range_t *tai_range_local_var = NULL;
@@ -151,7 +204,6 @@ end:
 OpenAPI_tai_range_t *OpenAPI_tai_range_copy(OpenAPI_tai_range_t *dst, OpenAPI_tai_range_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tai_range_convertToJSON(src);
@@ -160,21 +212,6 @@ OpenAPI_tai_range_t *OpenAPI_tai_range_copy(OpenAPI_tai_range_t *dst, OpenAPI_ta
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tai_range_free(dst);
     dst = OpenAPI_tai_range_parseFromJSON(item);
     cJSON_Delete(item);
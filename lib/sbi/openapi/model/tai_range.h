@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_id.h"
 #include "tac_range.h"
 
@@ -34,6 +35,7 @@ OpenAPI_tai_range_t *OpenAPI_tai_range_create(
 void OpenAPI_tai_range_free(OpenAPI_tai_range_t *tai_range);
 OpenAPI_tai_range_t *OpenAPI_tai_range_parseFromJSON(cJSON *tai_rangeJSON);
 cJSON *OpenAPI_tai_range_convertToJSON(OpenAPI_tai_range_t *tai_range);
+bool OpenAPI_tai_range_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tai_range_t *tai_range);
 OpenAPI_tai_range_t *OpenAPI_tai_range_copy(OpenAPI_tai_range_t *dst, OpenAPI_tai_range_t *src);
 
 #ifdef __cplusplus
@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_temporal_validity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_temporal_validity_t *temporal_validity)
+{
+    if (temporal_validity == NULL) {
+        ogs_error("OpenAPI_temporal_validity_writeJSON() failed [TemporalValidity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_temporal_validity_writeJSON() failed [TemporalValidity]");
+        return false;
+    }
+    if (temporal_validity->start_time) {
+    if (OpenAPI_json_write_string(writer, "startTime", temporal_validity->start_time) == false) {
+        ogs_error("OpenAPI_temporal_validity_writeJSON() failed [start_time]");
+        goto end;
+    }
+    }
+
+    if (temporal_validity->stop_time) {
+    if (OpenAPI_json_write_string(writer, "stopTime", temporal_validity->stop_time) == false) {
+        ogs_error("OpenAPI_temporal_validity_writeJSON() failed [stop_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_temporal_validity_writeJSON() failed [TemporalValidity]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_parseFromJSON(cJSON *temporal_validityJSON)
 {
     OpenAPI_temporal_validity_t *temporal_validity_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_copy(OpenAPI_temporal_validity_t *dst, OpenAPI_temporal_validity_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_temporal_validity_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_copy(OpenAPI_temporal_val
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_temporal_validity_free(dst);
     dst = OpenAPI_temporal_validity_parseFromJSON(item);
     cJSON_Delete(item);
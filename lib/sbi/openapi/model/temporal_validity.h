@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_create(
 void OpenAPI_temporal_validity_free(OpenAPI_temporal_validity_t *temporal_validity);
 OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_parseFromJSON(cJSON *temporal_validityJSON);
 cJSON *OpenAPI_temporal_validity_convertToJSON(OpenAPI_temporal_validity_t *temporal_validity);
+bool OpenAPI_temporal_validity_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_temporal_validity_t *temporal_validity);
 OpenAPI_temporal_validity_t *OpenAPI_temporal_validity_copy(OpenAPI_temporal_validity_t *dst, OpenAPI_temporal_validity_t *src);
 
 #ifdef __cplusplus
@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_termination_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_termination_info_t *termination_info)
+{
+    if (termination_info == NULL) {
+        ogs_error("OpenAPI_termination_info_writeJSON() failed [TerminationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_termination_info_writeJSON() failed [TerminationInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "termCause", OpenAPI_termination_cause_ToString(termination_info->term_cause)) == false) {
+        ogs_error("OpenAPI_termination_info_writeJSON() failed [term_cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "resUri", termination_info->res_uri) == false) {
+        ogs_error("OpenAPI_termination_info_writeJSON() failed [res_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_termination_info_writeJSON() failed [TerminationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_termination_info_t *OpenAPI_termination_info_parseFromJSON(cJSON *termination_infoJSON)
 {
     OpenAPI_termination_info_t *termination_info_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_termination_info_t *OpenAPI_termination_info_copy(OpenAPI_termination_info_t *dst, OpenAPI_termination_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_termination_info_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_termination_info_t *OpenAPI_termination_info_copy(OpenAPI_termination_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_termination_info_free(dst);
     dst = OpenAPI_termination_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "termination_cause.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_termination_info_t *OpenAPI_termination_info_create(
 void OpenAPI_termination_info_free(OpenAPI_termination_info_t *termination_info);
 OpenAPI_termination_info_t *OpenAPI_termination_info_parseFromJSON(cJSON *termination_infoJSON);
 cJSON *OpenAPI_termination_info_convertToJSON(OpenAPI_termination_info_t *termination_info);
+bool OpenAPI_termination_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_termination_info_t *termination_info);
 OpenAPI_termination_info_t *OpenAPI_termination_info_copy(OpenAPI_termination_info_t *dst, OpenAPI_termination_info_t *src);
 
 #ifdef __cplusplus
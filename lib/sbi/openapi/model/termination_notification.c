@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_termination_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_termination_notification_t *termination_notification)
+{
+    if (termination_notification == NULL) {
+        ogs_error("OpenAPI_termination_notification_writeJSON() failed [TerminationNotification]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_termination_notification_writeJSON() failed [TerminationNotification]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resourceUri", termination_notification->resource_uri) == false) {
+        ogs_error("OpenAPI_termination_notification_writeJSON() failed [resource_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_sm_policy_association_release_cause_ToString(termination_notification->cause)) == false) {
+        ogs_error("OpenAPI_termination_notification_writeJSON() failed [cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_termination_notification_writeJSON() failed [TerminationNotification]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_termination_notification_t *OpenAPI_termination_notification_parseFromJSON(cJSON *termination_notificationJSON)
 {
     OpenAPI_termination_notification_t *termination_notification_local_var = NULL;
@@ -92,7 +124,6 @@ end:
 OpenAPI_termination_notification_t *OpenAPI_termination_notification_copy(OpenAPI_termination_notification_t *dst, OpenAPI_termination_notification_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_termination_notification_convertToJSON(src);
@@ -101,21 +132,6 @@ OpenAPI_termination_notification_t *OpenAPI_termination_notification_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_termination_notification_free(dst);
     dst = OpenAPI_termination_notification_parseFromJSON(item);
     cJSON_Delete(item);
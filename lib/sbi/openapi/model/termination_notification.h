@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "sm_policy_association_release_cause.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_termination_notification_t *OpenAPI_termination_notification_create(
 void OpenAPI_termination_notification_free(OpenAPI_termination_notification_t *termination_notification);
 OpenAPI_termination_notification_t *OpenAPI_termination_notification_parseFromJSON(cJSON *termination_notificationJSON);
 cJSON *OpenAPI_termination_notification_convertToJSON(OpenAPI_termination_notification_t *termination_notification);
+bool OpenAPI_termination_notification_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_termination_notification_t *termination_notification);
 OpenAPI_termination_notification_t *OpenAPI_termination_notification_copy(OpenAPI_termination_notification_t *dst, OpenAPI_termination_notification_t *src);
 
 #ifdef __cplusplus
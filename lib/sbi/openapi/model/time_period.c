@@ -62,6 +62,40 @@ end:
     return item;
 }
 
+bool OpenAPI_time_period_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_time_period_t *time_period)
+{
+    if (time_period == NULL) {
+        ogs_error("OpenAPI_time_period_writeJSON() failed [TimePeriod]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_time_period_writeJSON() failed [TimePeriod]");
+        return false;
+    }
+    if (OpenAPI_periodicity_writeJSON(writer, "period", time_period->period) == false) {
+        ogs_error("OpenAPI_time_period_writeJSON() failed [period]");
+        goto end;
+    }
+
+    if (time_period->is_max_num_period) {
+    if (OpenAPI_json_write_number(writer, "maxNumPeriod", time_period->max_num_period) == false) {
+        ogs_error("OpenAPI_time_period_writeJSON() failed [max_num_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_time_period_writeJSON() failed [TimePeriod]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_time_period_t *OpenAPI_time_period_parseFromJSON(cJSON *time_periodJSON)
 {
     OpenAPI_time_period_t *time_period_local_var = NULL;
@@ -97,7 +131,6 @@ end:
 OpenAPI_time_period_t *OpenAPI_time_period_copy(OpenAPI_time_period_t *dst, OpenAPI_time_period_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_time_period_convertToJSON(src);
@@ -106,21 +139,6 @@ OpenAPI_time_period_t *OpenAPI_time_period_copy(OpenAPI_time_period_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_time_period_free(dst);
     dst = OpenAPI_time_period_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "periodicity.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_time_period_t *OpenAPI_time_period_create(
 void OpenAPI_time_period_free(OpenAPI_time_period_t *time_period);
 OpenAPI_time_period_t *OpenAPI_time_period_parseFromJSON(cJSON *time_periodJSON);
 cJSON *OpenAPI_time_period_convertToJSON(OpenAPI_time_period_t *time_period);
+bool OpenAPI_time_period_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_time_period_t *time_period);
 OpenAPI_time_period_t *OpenAPI_time_period_copy(OpenAPI_time_period_t *dst, OpenAPI_time_period_t *src);
 
 #ifdef __cplusplus
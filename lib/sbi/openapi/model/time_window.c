@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_time_window_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_time_window_t *time_window)
+{
+    if (time_window == NULL) {
+        ogs_error("OpenAPI_time_window_writeJSON() failed [TimeWindow]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_time_window_writeJSON() failed [TimeWindow]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "startTime", time_window->start_time) == false) {
+        ogs_error("OpenAPI_time_window_writeJSON() failed [start_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "stopTime", time_window->stop_time) == false) {
+        ogs_error("OpenAPI_time_window_writeJSON() failed [stop_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_time_window_writeJSON() failed [TimeWindow]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_time_window_t *OpenAPI_time_window_parseFromJSON(cJSON *time_windowJSON)
 {
     OpenAPI_time_window_t *time_window_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_time_window_t *OpenAPI_time_window_copy(OpenAPI_time_window_t *dst, OpenAPI_time_window_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_time_window_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_time_window_t *OpenAPI_time_window_copy(OpenAPI_time_window_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_time_window_free(dst);
     dst = OpenAPI_time_window_parseFromJSON(item);
     cJSON_Delete(item);
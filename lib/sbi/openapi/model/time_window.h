@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_time_window_t *OpenAPI_time_window_create(
 void OpenAPI_time_window_free(OpenAPI_time_window_t *time_window);
 OpenAPI_time_window_t *OpenAPI_time_window_parseFromJSON(cJSON *time_windowJSON);
 cJSON *OpenAPI_time_window_convertToJSON(OpenAPI_time_window_t *time_window);
+bool OpenAPI_time_window_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_time_window_t *time_window);
 OpenAPI_time_window_t *OpenAPI_time_window_copy(OpenAPI_time_window_t *dst, OpenAPI_time_window_t *src);
 
 #ifdef __cplusplus
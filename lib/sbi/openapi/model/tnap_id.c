@@ -66,6 +66,49 @@ end:
     return item;
 }
 
+bool OpenAPI_tnap_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tnap_id_t *tnap_id)
+{
+    if (tnap_id == NULL) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [TnapId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [TnapId]");
+        return false;
+    }
+    if (tnap_id->ss_id) {
+    if (OpenAPI_json_write_string(writer, "ssId", tnap_id->ss_id) == false) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [ss_id]");
+        goto end;
+    }
+    }
+
+    if (tnap_id->bss_id) {
+    if (OpenAPI_json_write_string(writer, "bssId", tnap_id->bss_id) == false) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [bss_id]");
+        goto end;
+    }
+    }
+
+    if (tnap_id->civic_address) {
+    if (OpenAPI_json_write_number(writer, "civicAddress", tnap_id->civic_address) == false) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [civic_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tnap_id_writeJSON() failed [TnapId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tnap_id_t *OpenAPI_tnap_id_parseFromJSON(cJSON *tnap_idJSON)
 {
     OpenAPI_tnap_id_t *tnap_id_local_var = NULL;
@@ -110,7 +153,6 @@ end:
 OpenAPI_tnap_id_t *OpenAPI_tnap_id_copy(OpenAPI_tnap_id_t *dst, OpenAPI_tnap_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tnap_id_convertToJSON(src);
@@ -119,21 +161,6 @@ OpenAPI_tnap_id_t *OpenAPI_tnap_id_copy(OpenAPI_tnap_id_t *dst, OpenAPI_tnap_id_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tnap_id_free(dst);
     dst = OpenAPI_tnap_id_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_tnap_id_t *OpenAPI_tnap_id_create(
 void OpenAPI_tnap_id_free(OpenAPI_tnap_id_t *tnap_id);
 OpenAPI_tnap_id_t *OpenAPI_tnap_id_parseFromJSON(cJSON *tnap_idJSON);
 cJSON *OpenAPI_tnap_id_convertToJSON(OpenAPI_tnap_id_t *tnap_id);
+bool OpenAPI_tnap_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tnap_id_t *tnap_id);
 OpenAPI_tnap_id_t *OpenAPI_tnap_id_copy(OpenAPI_tnap_id_t *dst, OpenAPI_tnap_id_t *src);
 
 #ifdef __cplusplus
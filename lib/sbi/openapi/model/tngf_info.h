@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_tngf_info_t *OpenAPI_tngf_info_create(
 void OpenAPI_tngf_info_free(OpenAPI_tngf_info_t *tngf_info);
 OpenAPI_tngf_info_t *OpenAPI_tngf_info_parseFromJSON(cJSON *tngf_infoJSON);
 cJSON *OpenAPI_tngf_info_convertToJSON(OpenAPI_tngf_info_t *tngf_info);
+bool OpenAPI_tngf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tngf_info_t *tngf_info);
 OpenAPI_tngf_info_t *OpenAPI_tngf_info_copy(OpenAPI_tngf_info_t *dst, OpenAPI_tngf_info_t *src);
 
 #ifdef __cplusplus
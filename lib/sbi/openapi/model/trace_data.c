@@ -98,6 +98,69 @@ end:
     return item;
 }
 
+bool OpenAPI_trace_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trace_data_t *trace_data)
+{
+    if (trace_data == NULL) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [TraceData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [TraceData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "traceRef", trace_data->trace_ref) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [trace_ref]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "traceDepth", OpenAPI_trace_depth_ToString(trace_data->trace_depth)) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [trace_depth]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "neTypeList", trace_data->ne_type_list) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [ne_type_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "eventList", trace_data->event_list) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [event_list]");
+        goto end;
+    }
+
+    if (trace_data->collection_entity_ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "collectionEntityIpv4Addr", trace_data->collection_entity_ipv4_addr) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [collection_entity_ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (trace_data->collection_entity_ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "collectionEntityIpv6Addr", trace_data->collection_entity_ipv6_addr) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [collection_entity_ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (trace_data->interface_list) {
+    if (OpenAPI_json_write_string(writer, "interfaceList", trace_data->interface_list) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [interface_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trace_data_writeJSON() failed [TraceData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trace_data_t *OpenAPI_trace_data_parseFromJSON(cJSON *trace_dataJSON)
 {
     OpenAPI_trace_data_t *trace_data_local_var = NULL;
@@ -192,7 +255,6 @@ end:
 OpenAPI_trace_data_t *OpenAPI_trace_data_copy(OpenAPI_trace_data_t *dst, OpenAPI_trace_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trace_data_convertToJSON(src);
@@ -201,21 +263,6 @@ OpenAPI_trace_data_t *OpenAPI_trace_data_copy(OpenAPI_trace_data_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trace_data_free(dst);
     dst = OpenAPI_trace_data_parseFromJSON(item);
     cJSON_Delete(item);
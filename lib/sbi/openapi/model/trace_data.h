@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trace_depth.h"
 
 #ifdef __cplusplus
@@ -41,6 +42,7 @@ OpenAPI_trace_data_t *OpenAPI_trace_data_create(
 void OpenAPI_trace_data_free(OpenAPI_trace_data_t *trace_data);
 OpenAPI_trace_data_t *OpenAPI_trace_data_parseFromJSON(cJSON *trace_dataJSON);
 cJSON *OpenAPI_trace_data_convertToJSON(OpenAPI_trace_data_t *trace_data);
+bool OpenAPI_trace_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trace_data_t *trace_data);
 OpenAPI_trace_data_t *OpenAPI_trace_data_copy(OpenAPI_trace_data_t *dst, OpenAPI_trace_data_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trace_depth.h"
 
 #ifdef __cplusplus
@@ -41,6 +42,7 @@ OpenAPI_trace_data_1_t *OpenAPI_trace_data_1_create(
 void OpenAPI_trace_data_1_free(OpenAPI_trace_data_1_t *trace_data_1);
 OpenAPI_trace_data_1_t *OpenAPI_trace_data_1_parseFromJSON(cJSON *trace_data_1JSON);
 cJSON *OpenAPI_trace_data_1_convertToJSON(OpenAPI_trace_data_1_t *trace_data_1);
+bool OpenAPI_trace_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trace_data_1_t *trace_data_1);
 OpenAPI_trace_data_1_t *OpenAPI_trace_data_1_copy(OpenAPI_trace_data_1_t *dst, OpenAPI_trace_data_1_t *src);
 
 #ifdef __cplusplus
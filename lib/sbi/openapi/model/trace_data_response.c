@@ -63,6 +63,42 @@ end:
     return item;
 }
 
+bool OpenAPI_trace_data_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trace_data_response_t *trace_data_response)
+{
+    if (trace_data_response == NULL) {
+        ogs_error("OpenAPI_trace_data_response_writeJSON() failed [TraceDataResponse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trace_data_response_writeJSON() failed [TraceDataResponse]");
+        return false;
+    }
+    if (trace_data_response->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", trace_data_response->trace_data) == false) {
+        ogs_error("OpenAPI_trace_data_response_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (trace_data_response->shared_trace_data_id) {
+    if (OpenAPI_json_write_string(writer, "sharedTraceDataId", trace_data_response->shared_trace_data_id) == false) {
+        ogs_error("OpenAPI_trace_data_response_writeJSON() failed [shared_trace_data_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trace_data_response_writeJSON() failed [TraceDataResponse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_parseFromJSON(cJSON *trace_data_responseJSON)
 {
     OpenAPI_trace_data_response_t *trace_data_response_local_var = NULL;
@@ -95,7 +131,6 @@ end:
 OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_copy(OpenAPI_trace_data_response_t *dst, OpenAPI_trace_data_response_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trace_data_response_convertToJSON(src);
@@ -104,21 +139,6 @@ OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_copy(OpenAPI_trace_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trace_data_response_free(dst);
     dst = OpenAPI_trace_data_response_parseFromJSON(item);
     cJSON_Delete(item);
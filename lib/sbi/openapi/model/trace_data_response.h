@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trace_data.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_create(
 void OpenAPI_trace_data_response_free(OpenAPI_trace_data_response_t *trace_data_response);
 OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_parseFromJSON(cJSON *trace_data_responseJSON);
 cJSON *OpenAPI_trace_data_response_convertToJSON(OpenAPI_trace_data_response_t *trace_data_response);
+bool OpenAPI_trace_data_response_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trace_data_response_t *trace_data_response);
 OpenAPI_trace_data_response_t *OpenAPI_trace_data_response_copy(OpenAPI_trace_data_response_t *dst, OpenAPI_trace_data_response_t *src);
 
 #ifdef __cplusplus
@@ -237,6 +237,152 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_control_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_control_data_t *traffic_control_data)
+{
+    if (traffic_control_data == NULL) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [TrafficControlData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [TrafficControlData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "tcId", traffic_control_data->tc_id) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [tc_id]");
+        goto end;
+    }
+
+    if (traffic_control_data->flow_status) {
+    if (OpenAPI_json_write_string(writer, "flowStatus", OpenAPI_flow_status_ToString(traffic_control_data->flow_status)) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [flow_status]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->redirect_info) {
+    if (OpenAPI_redirect_information_writeJSON(writer, "redirectInfo", traffic_control_data->redirect_info) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [redirect_info]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->add_redirect_info) {
+    if (OpenAPI_json_write_array_start(writer, "addRedirectInfo") == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [add_redirect_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *add_redirect_info_node;
+    if (traffic_control_data->add_redirect_info) {
+        OpenAPI_list_for_each(traffic_control_data->add_redirect_info, add_redirect_info_node) {
+            if (OpenAPI_redirect_information_writeJSON(writer, NULL, add_redirect_info_node->data) == false) {
+                ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [add_redirect_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [add_redirect_info]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->is_mute_notif) {
+    if (OpenAPI_json_write_bool(writer, "muteNotif", traffic_control_data->mute_notif) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [mute_notif]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->traffic_steering_pol_id_dl) {
+    if (OpenAPI_json_write_string(writer, "trafficSteeringPolIdDl", traffic_control_data->traffic_steering_pol_id_dl) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [traffic_steering_pol_id_dl]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->traffic_steering_pol_id_ul) {
+    if (OpenAPI_json_write_string(writer, "trafficSteeringPolIdUl", traffic_control_data->traffic_steering_pol_id_ul) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [traffic_steering_pol_id_ul]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->route_to_locs) {
+    if (OpenAPI_json_write_array_start(writer, "routeToLocs") == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [route_to_locs]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *route_to_locs_node;
+    if (traffic_control_data->route_to_locs) {
+        OpenAPI_list_for_each(traffic_control_data->route_to_locs, route_to_locs_node) {
+            if (OpenAPI_route_to_location_writeJSON(writer, NULL, route_to_locs_node->data) == false) {
+                ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [route_to_locs]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [route_to_locs]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->is_traff_corre_ind) {
+    if (OpenAPI_json_write_bool(writer, "traffCorreInd", traffic_control_data->traff_corre_ind) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [traff_corre_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->up_path_chg_event) {
+    if (OpenAPI_up_path_chg_event_writeJSON(writer, "upPathChgEvent", traffic_control_data->up_path_chg_event) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [up_path_chg_event]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->steer_fun) {
+    if (OpenAPI_json_write_string(writer, "steerFun", OpenAPI_steering_functionality_ToString(traffic_control_data->steer_fun)) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [steer_fun]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->steer_mode_dl) {
+    if (OpenAPI_steering_mode_writeJSON(writer, "steerModeDl", traffic_control_data->steer_mode_dl) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [steer_mode_dl]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->steer_mode_ul) {
+    if (OpenAPI_steering_mode_writeJSON(writer, "steerModeUl", traffic_control_data->steer_mode_ul) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [steer_mode_ul]");
+        goto end;
+    }
+    }
+
+    if (traffic_control_data->mul_acc_ctrl) {
+    if (OpenAPI_multicast_access_control_writeJSON(writer, "mulAccCtrl", traffic_control_data->mul_acc_ctrl) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [mul_acc_ctrl]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_control_data_writeJSON() failed [TrafficControlData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_parseFromJSON(cJSON *traffic_control_dataJSON)
 {
     OpenAPI_traffic_control_data_t *traffic_control_data_local_var = NULL;
@@ -429,7 +575,6 @@ end:
 OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_copy(OpenAPI_traffic_control_data_t *dst, OpenAPI_traffic_control_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_control_data_convertToJSON(src);
@@ -438,21 +583,6 @@ OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_copy(OpenAPI_traffi
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_control_data_free(dst);
     dst = OpenAPI_traffic_control_data_parseFromJSON(item);
     cJSON_Delete(item);
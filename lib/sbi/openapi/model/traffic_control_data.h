@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "flow_status.h"
 #include "multicast_access_control.h"
 #include "redirect_information.h"
@@ -65,6 +66,7 @@ OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_create(
 void OpenAPI_traffic_control_data_free(OpenAPI_traffic_control_data_t *traffic_control_data);
 OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_parseFromJSON(cJSON *traffic_control_dataJSON);
 cJSON *OpenAPI_traffic_control_data_convertToJSON(OpenAPI_traffic_control_data_t *traffic_control_data);
+bool OpenAPI_traffic_control_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_control_data_t *traffic_control_data);
 OpenAPI_traffic_control_data_t *OpenAPI_traffic_control_data_copy(OpenAPI_traffic_control_data_t *dst, OpenAPI_traffic_control_data_t *src);
 
 #ifdef __cplusplus
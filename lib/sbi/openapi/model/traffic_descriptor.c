@@ -89,6 +89,63 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_descriptor_t *traffic_descriptor)
+{
+    if (traffic_descriptor == NULL) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [TrafficDescriptor]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [TrafficDescriptor]");
+        return false;
+    }
+    if (traffic_descriptor->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", traffic_descriptor->dnn) == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (traffic_descriptor->s_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "sNssai", traffic_descriptor->s_nssai) == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [s_nssai]");
+        goto end;
+    }
+    }
+
+    if (traffic_descriptor->ddd_traffic_descriptor_list) {
+    if (OpenAPI_json_write_array_start(writer, "dddTrafficDescriptorList") == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [ddd_traffic_descriptor_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ddd_traffic_descriptor_list_node;
+    if (traffic_descriptor->ddd_traffic_descriptor_list) {
+        OpenAPI_list_for_each(traffic_descriptor->ddd_traffic_descriptor_list, ddd_traffic_descriptor_list_node) {
+            if (OpenAPI_ddd_traffic_descriptor_writeJSON(writer, NULL, ddd_traffic_descriptor_list_node->data) == false) {
+                ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [ddd_traffic_descriptor_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [ddd_traffic_descriptor_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_descriptor_writeJSON() failed [TrafficDescriptor]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_parseFromJSON(cJSON *traffic_descriptorJSON)
 {
     OpenAPI_traffic_descriptor_t *traffic_descriptor_local_var = NULL;
@@ -151,7 +208,6 @@ end:
 OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_copy(OpenAPI_traffic_descriptor_t *dst, OpenAPI_traffic_descriptor_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_descriptor_convertToJSON(src);
@@ -160,21 +216,6 @@ OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_copy(OpenAPI_traffic_de
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_descriptor_free(dst);
     dst = OpenAPI_traffic_descriptor_parseFromJSON(item);
     cJSON_Delete(item);
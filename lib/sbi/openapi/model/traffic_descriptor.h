@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ddd_traffic_descriptor.h"
 #include "snssai.h"
 
@@ -34,6 +35,7 @@ OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_create(
 void OpenAPI_traffic_descriptor_free(OpenAPI_traffic_descriptor_t *traffic_descriptor);
 OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_parseFromJSON(cJSON *traffic_descriptorJSON);
 cJSON *OpenAPI_traffic_descriptor_convertToJSON(OpenAPI_traffic_descriptor_t *traffic_descriptor);
+bool OpenAPI_traffic_descriptor_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_descriptor_t *traffic_descriptor);
 OpenAPI_traffic_descriptor_t *OpenAPI_traffic_descriptor_copy(OpenAPI_traffic_descriptor_t *dst, OpenAPI_traffic_descriptor_t *src);
 
 #ifdef __cplusplus
@@ -374,6 +374,271 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_influ_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_influ_data_t *traffic_influ_data)
+{
+    if (traffic_influ_data == NULL) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [TrafficInfluData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [TrafficInfluData]");
+        return false;
+    }
+    if (traffic_influ_data->up_path_chg_notif_corre_id) {
+    if (OpenAPI_json_write_string(writer, "upPathChgNotifCorreId", traffic_influ_data->up_path_chg_notif_corre_id) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [up_path_chg_notif_corre_id]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->is_app_relo_ind) {
+    if (OpenAPI_json_write_bool(writer, "appReloInd", traffic_influ_data->app_relo_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [app_relo_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->af_app_id) {
+    if (OpenAPI_json_write_string(writer, "afAppId", traffic_influ_data->af_app_id) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [af_app_id]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", traffic_influ_data->dnn) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->eth_traffic_filters) {
+    if (OpenAPI_json_write_array_start(writer, "ethTrafficFilters") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [eth_traffic_filters]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eth_traffic_filters_node;
+    if (traffic_influ_data->eth_traffic_filters) {
+        OpenAPI_list_for_each(traffic_influ_data->eth_traffic_filters, eth_traffic_filters_node) {
+            if (OpenAPI_eth_flow_description_writeJSON(writer, NULL, eth_traffic_filters_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [eth_traffic_filters]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [eth_traffic_filters]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", traffic_influ_data->snssai) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->inter_group_id) {
+    if (OpenAPI_json_write_string(writer, "interGroupId", traffic_influ_data->inter_group_id) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [inter_group_id]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", traffic_influ_data->supi) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->traffic_filters) {
+    if (OpenAPI_json_write_array_start(writer, "trafficFilters") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_filters]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_filters_node;
+    if (traffic_influ_data->traffic_filters) {
+        OpenAPI_list_for_each(traffic_influ_data->traffic_filters, traffic_filters_node) {
+            if (OpenAPI_flow_info_writeJSON(writer, NULL, traffic_filters_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_filters]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_filters]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->traffic_routes) {
+    if (OpenAPI_json_write_array_start(writer, "trafficRoutes") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_routes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_routes_node;
+    if (traffic_influ_data->traffic_routes) {
+        OpenAPI_list_for_each(traffic_influ_data->traffic_routes, traffic_routes_node) {
+            if (OpenAPI_route_to_location_writeJSON(writer, NULL, traffic_routes_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_routes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traffic_routes]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->is_traff_corre_ind) {
+    if (OpenAPI_json_write_bool(writer, "traffCorreInd", traffic_influ_data->traff_corre_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [traff_corre_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->valid_start_time) {
+    if (OpenAPI_json_write_string(writer, "validStartTime", traffic_influ_data->valid_start_time) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [valid_start_time]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->valid_end_time) {
+    if (OpenAPI_json_write_string(writer, "validEndTime", traffic_influ_data->valid_end_time) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [valid_end_time]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->temp_validities) {
+    if (OpenAPI_json_write_array_start(writer, "tempValidities") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [temp_validities]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *temp_validities_node;
+    if (traffic_influ_data->temp_validities) {
+        OpenAPI_list_for_each(traffic_influ_data->temp_validities, temp_validities_node) {
+            if (OpenAPI_temporal_validity_writeJSON(writer, NULL, temp_validities_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [temp_validities]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [temp_validities]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->nw_area_info) {
+    if (OpenAPI_network_area_info_1_writeJSON(writer, "nwAreaInfo", traffic_influ_data->nw_area_info) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [nw_area_info]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->up_path_chg_notif_uri) {
+    if (OpenAPI_json_write_string(writer, "upPathChgNotifUri", traffic_influ_data->up_path_chg_notif_uri) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [up_path_chg_notif_uri]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->headers) {
+    if (OpenAPI_json_write_array_start(writer, "headers") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [headers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *headers_node;
+    OpenAPI_list_for_each(traffic_influ_data->headers, headers_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)headers_node->data) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [headers]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [headers]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->subscribed_events) {
+    if (OpenAPI_json_write_array_start(writer, "subscribedEvents") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [subscribed_events]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subscribed_events_node;
+    if (traffic_influ_data->subscribed_events) {
+        OpenAPI_list_for_each(traffic_influ_data->subscribed_events, subscribed_events_node) {
+            if (OpenAPI_subscribed_event_writeJSON(writer, NULL, subscribed_events_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [subscribed_events]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [subscribed_events]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->dnai_chg_type) {
+    if (OpenAPI_json_write_string(writer, "dnaiChgType", OpenAPI_dnai_change_type_ToString(traffic_influ_data->dnai_chg_type)) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [dnai_chg_type]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->is_af_ack_ind) {
+    if (OpenAPI_json_write_bool(writer, "afAckInd", traffic_influ_data->af_ack_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [af_ack_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->is_addr_preser_ind) {
+    if (OpenAPI_json_write_bool(writer, "addrPreserInd", traffic_influ_data->addr_preser_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [addr_preser_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", traffic_influ_data->supported_features) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data->res_uri) {
+    if (OpenAPI_json_write_string(writer, "resUri", traffic_influ_data->res_uri) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [res_uri]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_writeJSON() failed [TrafficInfluData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_parseFromJSON(cJSON *traffic_influ_dataJSON)
 {
     OpenAPI_traffic_influ_data_t *traffic_influ_data_local_var = NULL;
@@ -731,7 +996,6 @@ end:
 OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_copy(OpenAPI_traffic_influ_data_t *dst, OpenAPI_traffic_influ_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_influ_data_convertToJSON(src);
@@ -740,21 +1004,6 @@ OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_copy(OpenAPI_traffic_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_influ_data_free(dst);
     dst = OpenAPI_traffic_influ_data_parseFromJSON(item);
     cJSON_Delete(item);
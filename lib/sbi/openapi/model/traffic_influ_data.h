@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnai_change_type.h"
 #include "eth_flow_description.h"
 #include "flow_info.h"
@@ -88,6 +89,7 @@ OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_create(
 void OpenAPI_traffic_influ_data_free(OpenAPI_traffic_influ_data_t *traffic_influ_data);
 OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_parseFromJSON(cJSON *traffic_influ_dataJSON);
 cJSON *OpenAPI_traffic_influ_data_convertToJSON(OpenAPI_traffic_influ_data_t *traffic_influ_data);
+bool OpenAPI_traffic_influ_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_influ_data_t *traffic_influ_data);
 OpenAPI_traffic_influ_data_t *OpenAPI_traffic_influ_data_copy(OpenAPI_traffic_influ_data_t *dst, OpenAPI_traffic_influ_data_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,40 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_influ_data_notif_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_influ_data_notif_t *traffic_influ_data_notif)
+{
+    if (traffic_influ_data_notif == NULL) {
+        ogs_error("OpenAPI_traffic_influ_data_notif_writeJSON() failed [TrafficInfluDataNotif]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_notif_writeJSON() failed [TrafficInfluDataNotif]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "resUri", traffic_influ_data_notif->res_uri) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_notif_writeJSON() failed [res_uri]");
+        goto end;
+    }
+
+    if (traffic_influ_data_notif->traffic_influ_data) {
+    if (OpenAPI_traffic_influ_data_writeJSON(writer, "trafficInfluData", traffic_influ_data_notif->traffic_influ_data) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_notif_writeJSON() failed [traffic_influ_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_notif_writeJSON() failed [TrafficInfluDataNotif]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_influ_data_notif_t *OpenAPI_traffic_influ_data_notif_parseFromJSON(cJSON *traffic_influ_data_notifJSON)
 {
     OpenAPI_traffic_influ_data_notif_t *traffic_influ_data_notif_local_var = NULL;
@@ -95,7 +129,6 @@ end:
 OpenAPI_traffic_influ_data_notif_t *OpenAPI_traffic_influ_data_notif_copy(OpenAPI_traffic_influ_data_notif_t *dst, OpenAPI_traffic_influ_data_notif_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_influ_data_notif_convertToJSON(src);
@@ -104,21 +137,6 @@ OpenAPI_traffic_influ_data_notif_t *OpenAPI_traffic_influ_data_notif_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_influ_data_notif_free(dst);
     dst = OpenAPI_traffic_influ_data_notif_parseFromJSON(item);
     cJSON_Delete(item);
@@ -309,6 +309,222 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_influ_data_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_influ_data_patch_t *traffic_influ_data_patch)
+{
+    if (traffic_influ_data_patch == NULL) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [TrafficInfluDataPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [TrafficInfluDataPatch]");
+        return false;
+    }
+    if (traffic_influ_data_patch->up_path_chg_notif_corre_id) {
+    if (OpenAPI_json_write_string(writer, "upPathChgNotifCorreId", traffic_influ_data_patch->up_path_chg_notif_corre_id) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [up_path_chg_notif_corre_id]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->is_app_relo_ind) {
+    if (OpenAPI_json_write_bool(writer, "appReloInd", traffic_influ_data_patch->app_relo_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [app_relo_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", traffic_influ_data_patch->dnn) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->eth_traffic_filters) {
+    if (OpenAPI_json_write_array_start(writer, "ethTrafficFilters") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [eth_traffic_filters]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eth_traffic_filters_node;
+    if (traffic_influ_data_patch->eth_traffic_filters) {
+        OpenAPI_list_for_each(traffic_influ_data_patch->eth_traffic_filters, eth_traffic_filters_node) {
+            if (OpenAPI_eth_flow_description_writeJSON(writer, NULL, eth_traffic_filters_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [eth_traffic_filters]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [eth_traffic_filters]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->snssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", traffic_influ_data_patch->snssai) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [snssai]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->internal_group_id) {
+    if (OpenAPI_json_write_string(writer, "internalGroupId", traffic_influ_data_patch->internal_group_id) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [internal_group_id]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", traffic_influ_data_patch->supi) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->traffic_filters) {
+    if (OpenAPI_json_write_array_start(writer, "trafficFilters") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_filters]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_filters_node;
+    if (traffic_influ_data_patch->traffic_filters) {
+        OpenAPI_list_for_each(traffic_influ_data_patch->traffic_filters, traffic_filters_node) {
+            if (OpenAPI_flow_info_writeJSON(writer, NULL, traffic_filters_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_filters]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_filters]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->traffic_routes) {
+    if (OpenAPI_json_write_array_start(writer, "trafficRoutes") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_routes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *traffic_routes_node;
+    if (traffic_influ_data_patch->traffic_routes) {
+        OpenAPI_list_for_each(traffic_influ_data_patch->traffic_routes, traffic_routes_node) {
+            if (OpenAPI_route_to_location_writeJSON(writer, NULL, traffic_routes_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_routes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traffic_routes]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->is_traff_corre_ind) {
+    if (OpenAPI_json_write_bool(writer, "traffCorreInd", traffic_influ_data_patch->traff_corre_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [traff_corre_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->valid_start_time) {
+    if (OpenAPI_json_write_string(writer, "validStartTime", traffic_influ_data_patch->valid_start_time) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [valid_start_time]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->valid_end_time) {
+    if (OpenAPI_json_write_string(writer, "validEndTime", traffic_influ_data_patch->valid_end_time) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [valid_end_time]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->temp_validities) {
+    if (OpenAPI_json_write_array_start(writer, "tempValidities") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [temp_validities]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *temp_validities_node;
+    if (traffic_influ_data_patch->temp_validities) {
+        OpenAPI_list_for_each(traffic_influ_data_patch->temp_validities, temp_validities_node) {
+            if (OpenAPI_temporal_validity_writeJSON(writer, NULL, temp_validities_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [temp_validities]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [temp_validities]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->nw_area_info) {
+    if (OpenAPI_network_area_info_1_writeJSON(writer, "nwAreaInfo", traffic_influ_data_patch->nw_area_info) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [nw_area_info]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->up_path_chg_notif_uri) {
+    if (OpenAPI_json_write_string(writer, "upPathChgNotifUri", traffic_influ_data_patch->up_path_chg_notif_uri) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [up_path_chg_notif_uri]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->headers) {
+    if (OpenAPI_json_write_array_start(writer, "headers") == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [headers]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *headers_node;
+    OpenAPI_list_for_each(traffic_influ_data_patch->headers, headers_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)headers_node->data) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [headers]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [headers]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->is_af_ack_ind) {
+    if (OpenAPI_json_write_bool(writer, "afAckInd", traffic_influ_data_patch->af_ack_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [af_ack_ind]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_data_patch->is_addr_preser_ind) {
+    if (OpenAPI_json_write_bool(writer, "addrPreserInd", traffic_influ_data_patch->addr_preser_ind) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [addr_preser_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_data_patch_writeJSON() failed [TrafficInfluDataPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_influ_data_patch_t *OpenAPI_traffic_influ_data_patch_parseFromJSON(cJSON *traffic_influ_data_patchJSON)
 {
     OpenAPI_traffic_influ_data_patch_t *traffic_influ_data_patch_local_var = NULL;
@@ -594,7 +810,6 @@ end:
 OpenAPI_traffic_influ_data_patch_t *OpenAPI_traffic_influ_data_patch_copy(OpenAPI_traffic_influ_data_patch_t *dst, OpenAPI_traffic_influ_data_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_influ_data_patch_convertToJSON(src);
@@ -603,21 +818,6 @@ OpenAPI_traffic_influ_data_patch_t *OpenAPI_traffic_influ_data_patch_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_influ_data_patch_free(dst);
     dst = OpenAPI_traffic_influ_data_patch_parseFromJSON(item);
     cJSON_Delete(item);
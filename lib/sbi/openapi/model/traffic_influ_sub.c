@@ -157,6 +157,125 @@ end:
     return item;
 }
 
+bool OpenAPI_traffic_influ_sub_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_influ_sub_t *traffic_influ_sub)
+{
+    if (traffic_influ_sub == NULL) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [TrafficInfluSub]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [TrafficInfluSub]");
+        return false;
+    }
+    if (traffic_influ_sub->dnns) {
+    if (OpenAPI_json_write_array_start(writer, "dnns") == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [dnns]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnns_node;
+    OpenAPI_list_for_each(traffic_influ_sub->dnns, dnns_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnns_node->data) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [dnns]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [dnns]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_sub->snssais) {
+    if (OpenAPI_json_write_array_start(writer, "snssais") == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [snssais]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *snssais_node;
+    if (traffic_influ_sub->snssais) {
+        OpenAPI_list_for_each(traffic_influ_sub->snssais, snssais_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, snssais_node->data) == false) {
+                ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [snssais]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [snssais]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_sub->internal_group_ids) {
+    if (OpenAPI_json_write_array_start(writer, "internalGroupIds") == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *internal_group_ids_node;
+    OpenAPI_list_for_each(traffic_influ_sub->internal_group_ids, internal_group_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)internal_group_ids_node->data) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [internal_group_ids]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_sub->supis) {
+    if (OpenAPI_json_write_array_start(writer, "supis") == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [supis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supis_node;
+    OpenAPI_list_for_each(traffic_influ_sub->supis, supis_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)supis_node->data) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [supis]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [supis]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "notificationUri", traffic_influ_sub->notification_uri) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (traffic_influ_sub->expiry) {
+    if (OpenAPI_json_write_string(writer, "expiry", traffic_influ_sub->expiry) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [expiry]");
+        goto end;
+    }
+    }
+
+    if (traffic_influ_sub->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", traffic_influ_sub->supported_features) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_traffic_influ_sub_writeJSON() failed [TrafficInfluSub]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_traffic_influ_sub_t *OpenAPI_traffic_influ_sub_parseFromJSON(cJSON *traffic_influ_subJSON)
 {
     OpenAPI_traffic_influ_sub_t *traffic_influ_sub_local_var = NULL;
@@ -296,7 +415,6 @@ end:
 OpenAPI_traffic_influ_sub_t *OpenAPI_traffic_influ_sub_copy(OpenAPI_traffic_influ_sub_t *dst, OpenAPI_traffic_influ_sub_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_traffic_influ_sub_convertToJSON(src);
@@ -305,21 +423,6 @@ OpenAPI_traffic_influ_sub_t *OpenAPI_traffic_influ_sub_copy(OpenAPI_traffic_infl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_traffic_influ_sub_free(dst);
     dst = OpenAPI_traffic_influ_sub_parseFromJSON(item);
     cJSON_Delete(item);
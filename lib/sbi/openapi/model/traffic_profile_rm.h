@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "null_value.h"
 #include "traffic_profile.h"
 
@@ -28,6 +29,7 @@ OpenAPI_traffic_profile_rm_t *OpenAPI_traffic_profile_rm_create(
 void OpenAPI_traffic_profile_rm_free(OpenAPI_traffic_profile_rm_t *traffic_profile_rm);
 OpenAPI_traffic_profile_rm_t *OpenAPI_traffic_profile_rm_parseFromJSON(cJSON *traffic_profile_rmJSON);
 cJSON *OpenAPI_traffic_profile_rm_convertToJSON(OpenAPI_traffic_profile_rm_t *traffic_profile_rm);
+bool OpenAPI_traffic_profile_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_traffic_profile_rm_t *traffic_profile_rm);
 OpenAPI_traffic_profile_rm_t *OpenAPI_traffic_profile_rm_copy(OpenAPI_traffic_profile_rm_t *dst, OpenAPI_traffic_profile_rm_t *src);
 
 #ifdef __cplusplus
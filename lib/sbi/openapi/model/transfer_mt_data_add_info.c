@@ -48,6 +48,35 @@ end:
     return item;
 }
 
+bool OpenAPI_transfer_mt_data_add_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_transfer_mt_data_add_info_t *transfer_mt_data_add_info)
+{
+    if (transfer_mt_data_add_info == NULL) {
+        ogs_error("OpenAPI_transfer_mt_data_add_info_writeJSON() failed [TransferMtDataAddInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_add_info_writeJSON() failed [TransferMtDataAddInfo]");
+        return false;
+    }
+    if (transfer_mt_data_add_info->is_max_waiting_time) {
+    if (OpenAPI_json_write_number(writer, "maxWaitingTime", transfer_mt_data_add_info->max_waiting_time) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_add_info_writeJSON() failed [max_waiting_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_add_info_writeJSON() failed [TransferMtDataAddInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_transfer_mt_data_add_info_t *OpenAPI_transfer_mt_data_add_info_parseFromJSON(cJSON *transfer_mt_data_add_infoJSON)
 {
     OpenAPI_transfer_mt_data_add_info_t *transfer_mt_data_add_info_local_var = NULL;
@@ -73,7 +102,6 @@ end:
 OpenAPI_transfer_mt_data_add_info_t *OpenAPI_transfer_mt_data_add_info_copy(OpenAPI_transfer_mt_data_add_info_t *dst, OpenAPI_transfer_mt_data_add_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_transfer_mt_data_add_info_convertToJSON(src);
@@ -82,21 +110,6 @@ OpenAPI_transfer_mt_data_add_info_t *OpenAPI_transfer_mt_data_add_info_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_transfer_mt_data_add_info_free(dst);
     dst = OpenAPI_transfer_mt_data_add_info_parseFromJSON(item);
     cJSON_Delete(item);
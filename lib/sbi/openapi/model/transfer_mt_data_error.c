@@ -187,6 +187,126 @@ end:
     return item;
 }
 
+bool OpenAPI_transfer_mt_data_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_transfer_mt_data_error_t *transfer_mt_data_error)
+{
+    if (transfer_mt_data_error == NULL) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [TransferMtDataError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [TransferMtDataError]");
+        return false;
+    }
+    if (transfer_mt_data_error->type) {
+    if (OpenAPI_json_write_string(writer, "type", transfer_mt_data_error->type) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [type]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->title) {
+    if (OpenAPI_json_write_string(writer, "title", transfer_mt_data_error->title) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [title]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->is_status) {
+    if (OpenAPI_json_write_number(writer, "status", transfer_mt_data_error->status) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [status]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->detail) {
+    if (OpenAPI_json_write_string(writer, "detail", transfer_mt_data_error->detail) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [detail]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->instance) {
+    if (OpenAPI_json_write_string(writer, "instance", transfer_mt_data_error->instance) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [instance]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", transfer_mt_data_error->cause) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->invalid_params) {
+    if (OpenAPI_json_write_array_start(writer, "invalidParams") == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *invalid_params_node;
+    if (transfer_mt_data_error->invalid_params) {
+        OpenAPI_list_for_each(transfer_mt_data_error->invalid_params, invalid_params_node) {
+            if (OpenAPI_invalid_param_writeJSON(writer, NULL, invalid_params_node->data) == false) {
+                ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [invalid_params]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [invalid_params]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", transfer_mt_data_error->supported_features) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->access_token_error) {
+    if (OpenAPI_access_token_err_writeJSON(writer, "accessTokenError", transfer_mt_data_error->access_token_error) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [access_token_error]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->access_token_request) {
+    if (OpenAPI_access_token_req_writeJSON(writer, "accessTokenRequest", transfer_mt_data_error->access_token_request) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [access_token_request]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->nrf_id) {
+    if (OpenAPI_json_write_string(writer, "nrfId", transfer_mt_data_error->nrf_id) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [nrf_id]");
+        goto end;
+    }
+    }
+
+    if (transfer_mt_data_error->is_max_waiting_time) {
+    if (OpenAPI_json_write_number(writer, "maxWaitingTime", transfer_mt_data_error->max_waiting_time) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [max_waiting_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_error_writeJSON() failed [TransferMtDataError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_transfer_mt_data_error_t *OpenAPI_transfer_mt_data_error_parseFromJSON(cJSON *transfer_mt_data_errorJSON)
 {
     OpenAPI_transfer_mt_data_error_t *transfer_mt_data_error_local_var = NULL;
@@ -339,7 +459,6 @@ end:
 OpenAPI_transfer_mt_data_error_t *OpenAPI_transfer_mt_data_error_copy(OpenAPI_transfer_mt_data_error_t *dst, OpenAPI_transfer_mt_data_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_transfer_mt_data_error_convertToJSON(src);
@@ -348,21 +467,6 @@ OpenAPI_transfer_mt_data_error_t *OpenAPI_transfer_mt_data_error_copy(OpenAPI_tr
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_transfer_mt_data_error_free(dst);
     dst = OpenAPI_transfer_mt_data_error_parseFromJSON(item);
     cJSON_Delete(item);
@@ -51,6 +51,33 @@ end:
     return item;
 }
 
+bool OpenAPI_transfer_mt_data_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_transfer_mt_data_req_data_t *transfer_mt_data_req_data)
+{
+    if (transfer_mt_data_req_data == NULL) {
+        ogs_error("OpenAPI_transfer_mt_data_req_data_writeJSON() failed [TransferMtDataReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_req_data_writeJSON() failed [TransferMtDataReqData]");
+        return false;
+    }
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "mtData", transfer_mt_data_req_data->mt_data) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_req_data_writeJSON() failed [mt_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_transfer_mt_data_req_data_writeJSON() failed [TransferMtDataReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_transfer_mt_data_req_data_t *OpenAPI_transfer_mt_data_req_data_parseFromJSON(cJSON *transfer_mt_data_req_dataJSON)
 {
     OpenAPI_transfer_mt_data_req_data_t *transfer_mt_data_req_data_local_var = NULL;
@@ -75,7 +102,6 @@ end:
 OpenAPI_transfer_mt_data_req_data_t *OpenAPI_transfer_mt_data_req_data_copy(OpenAPI_transfer_mt_data_req_data_t *dst, OpenAPI_transfer_mt_data_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_transfer_mt_data_req_data_convertToJSON(src);
@@ -84,21 +110,6 @@ OpenAPI_transfer_mt_data_req_data_t *OpenAPI_transfer_mt_data_req_data_copy(Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_transfer_mt_data_req_data_free(dst);
     dst = OpenAPI_transfer_mt_data_req_data_parseFromJSON(item);
     cJSON_Delete(item);
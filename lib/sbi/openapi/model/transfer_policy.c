@@ -85,6 +85,57 @@ end:
     return item;
 }
 
+bool OpenAPI_transfer_policy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_transfer_policy_t *transfer_policy)
+{
+    if (transfer_policy == NULL) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [TransferPolicy]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [TransferPolicy]");
+        return false;
+    }
+    if (transfer_policy->max_bit_rate_dl) {
+    if (OpenAPI_json_write_string(writer, "maxBitRateDl", transfer_policy->max_bit_rate_dl) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [max_bit_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (transfer_policy->max_bit_rate_ul) {
+    if (OpenAPI_json_write_string(writer, "maxBitRateUl", transfer_policy->max_bit_rate_ul) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [max_bit_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_number(writer, "ratingGroup", transfer_policy->rating_group) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [rating_group]");
+        goto end;
+    }
+
+    if (OpenAPI_time_window_writeJSON(writer, "recTimeInt", transfer_policy->rec_time_int) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [rec_time_int]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "transPolicyId", transfer_policy->trans_policy_id) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [trans_policy_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_transfer_policy_writeJSON() failed [TransferPolicy]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_parseFromJSON(cJSON *transfer_policyJSON)
 {
     OpenAPI_transfer_policy_t *transfer_policy_local_var = NULL;
@@ -155,7 +206,6 @@ end:
 OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_copy(OpenAPI_transfer_policy_t *dst, OpenAPI_transfer_policy_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_transfer_policy_convertToJSON(src);
@@ -164,21 +214,6 @@ OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_copy(OpenAPI_transfer_policy_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_transfer_policy_free(dst);
     dst = OpenAPI_transfer_policy_parseFromJSON(item);
     cJSON_Delete(item);
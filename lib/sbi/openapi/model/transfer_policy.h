@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "time_window.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_create(
 void OpenAPI_transfer_policy_free(OpenAPI_transfer_policy_t *transfer_policy);
 OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_parseFromJSON(cJSON *transfer_policyJSON);
 cJSON *OpenAPI_transfer_policy_convertToJSON(OpenAPI_transfer_policy_t *transfer_policy);
+bool OpenAPI_transfer_policy_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_transfer_policy_t *transfer_policy);
 OpenAPI_transfer_policy_t *OpenAPI_transfer_policy_copy(OpenAPI_transfer_policy_t *dst, OpenAPI_transfer_policy_t *src);
 
 #ifdef __cplusplus
@@ -130,6 +130,80 @@ end:
     return item;
 }
 
+bool OpenAPI_trigger_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_t *trigger)
+{
+    if (trigger == NULL) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [Trigger]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [Trigger]");
+        return false;
+    }
+    if (OpenAPI_trigger_type_writeJSON(writer, "triggerType", trigger->trigger_type) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [trigger_type]");
+        goto end;
+    }
+
+    if (OpenAPI_trigger_category_writeJSON(writer, "triggerCategory", trigger->trigger_category) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [trigger_category]");
+        goto end;
+    }
+
+    if (trigger->is_time_limit) {
+    if (OpenAPI_json_write_number(writer, "timeLimit", trigger->time_limit) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [time_limit]");
+        goto end;
+    }
+    }
+
+    if (trigger->is_volume_limit) {
+    if (OpenAPI_json_write_number(writer, "volumeLimit", trigger->volume_limit) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [volume_limit]");
+        goto end;
+    }
+    }
+
+    if (trigger->is_volume_limit64) {
+    if (OpenAPI_json_write_number(writer, "volumeLimit64", trigger->volume_limit64) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [volume_limit64]");
+        goto end;
+    }
+    }
+
+    if (trigger->is_event_limit) {
+    if (OpenAPI_json_write_number(writer, "eventLimit", trigger->event_limit) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [event_limit]");
+        goto end;
+    }
+    }
+
+    if (trigger->is_max_number_ofccc) {
+    if (OpenAPI_json_write_number(writer, "maxNumberOfccc", trigger->max_number_ofccc) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [max_number_ofccc]");
+        goto end;
+    }
+    }
+
+    if (trigger->tariff_time_change) {
+    if (OpenAPI_json_write_string(writer, "tariffTimeChange", trigger->tariff_time_change) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [tariff_time_change]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trigger_writeJSON() failed [Trigger]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trigger_t *OpenAPI_trigger_parseFromJSON(cJSON *triggerJSON)
 {
     OpenAPI_trigger_t *trigger_local_var = NULL;
@@ -229,7 +303,6 @@ end:
 OpenAPI_trigger_t *OpenAPI_trigger_copy(OpenAPI_trigger_t *dst, OpenAPI_trigger_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_convertToJSON(src);
@@ -238,21 +311,6 @@ OpenAPI_trigger_t *OpenAPI_trigger_copy(OpenAPI_trigger_t *dst, OpenAPI_trigger_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_free(dst);
     dst = OpenAPI_trigger_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trigger_category.h"
 #include "trigger_type.h"
 
@@ -54,6 +55,7 @@ OpenAPI_trigger_t *OpenAPI_trigger_create(
 void OpenAPI_trigger_free(OpenAPI_trigger_t *trigger);
 OpenAPI_trigger_t *OpenAPI_trigger_parseFromJSON(cJSON *triggerJSON);
 cJSON *OpenAPI_trigger_convertToJSON(OpenAPI_trigger_t *trigger);
+bool OpenAPI_trigger_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_t *trigger);
 OpenAPI_trigger_t *OpenAPI_trigger_copy(OpenAPI_trigger_t *dst, OpenAPI_trigger_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_trigger_category_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_category_t *trigger_category)
+{
+    if (trigger_category == NULL) {
+        ogs_error("OpenAPI_trigger_category_writeJSON() failed [TriggerCategory]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trigger_category_writeJSON() failed [TriggerCategory]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trigger_category_writeJSON() failed [TriggerCategory]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trigger_category_t *OpenAPI_trigger_category_parseFromJSON(cJSON *trigger_categoryJSON)
 {
     OpenAPI_trigger_category_t *trigger_category_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_trigger_category_t *OpenAPI_trigger_category_copy(OpenAPI_trigger_category_t *dst, OpenAPI_trigger_category_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_category_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_trigger_category_t *OpenAPI_trigger_category_copy(OpenAPI_trigger_catego
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_category_free(dst);
     dst = OpenAPI_trigger_category_parseFromJSON(item);
     cJSON_Delete(item);
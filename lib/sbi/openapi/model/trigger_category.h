@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trigger_category_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_trigger_category_t *OpenAPI_trigger_category_create(
 void OpenAPI_trigger_category_free(OpenAPI_trigger_category_t *trigger_category);
 OpenAPI_trigger_category_t *OpenAPI_trigger_category_parseFromJSON(cJSON *trigger_categoryJSON);
 cJSON *OpenAPI_trigger_category_convertToJSON(OpenAPI_trigger_category_t *trigger_category);
+bool OpenAPI_trigger_category_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_category_t *trigger_category);
 OpenAPI_trigger_category_t *OpenAPI_trigger_category_copy(OpenAPI_trigger_category_t *dst, OpenAPI_trigger_category_t *src);
 
 #ifdef __cplusplus
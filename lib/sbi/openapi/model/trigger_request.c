@@ -45,6 +45,33 @@ end:
     return item;
 }
 
+bool OpenAPI_trigger_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_request_t *trigger_request)
+{
+    if (trigger_request == NULL) {
+        ogs_error("OpenAPI_trigger_request_writeJSON() failed [TriggerRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trigger_request_writeJSON() failed [TriggerRequest]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supi", trigger_request->supi) == false) {
+        ogs_error("OpenAPI_trigger_request_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trigger_request_writeJSON() failed [TriggerRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trigger_request_t *OpenAPI_trigger_request_parseFromJSON(cJSON *trigger_requestJSON)
 {
     OpenAPI_trigger_request_t *trigger_request_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_trigger_request_t *OpenAPI_trigger_request_copy(OpenAPI_trigger_request_t *dst, OpenAPI_trigger_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_request_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_trigger_request_t *OpenAPI_trigger_request_copy(OpenAPI_trigger_request_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_request_free(dst);
     dst = OpenAPI_trigger_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ OpenAPI_trigger_request_t *OpenAPI_trigger_request_create(
 void OpenAPI_trigger_request_free(OpenAPI_trigger_request_t *trigger_request);
 OpenAPI_trigger_request_t *OpenAPI_trigger_request_parseFromJSON(cJSON *trigger_requestJSON);
 cJSON *OpenAPI_trigger_request_convertToJSON(OpenAPI_trigger_request_t *trigger_request);
+bool OpenAPI_trigger_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_request_t *trigger_request);
 OpenAPI_trigger_request_t *OpenAPI_trigger_request_copy(OpenAPI_trigger_request_t *dst, OpenAPI_trigger_request_t *src);
 
 #ifdef __cplusplus
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_trigger_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_type_t *trigger_type)
+{
+    if (trigger_type == NULL) {
+        ogs_error("OpenAPI_trigger_type_writeJSON() failed [TriggerType]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_trigger_type_writeJSON() failed [TriggerType]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_trigger_type_writeJSON() failed [TriggerType]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_trigger_type_t *OpenAPI_trigger_type_parseFromJSON(cJSON *trigger_typeJSON)
 {
     OpenAPI_trigger_type_t *trigger_type_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_trigger_type_t *OpenAPI_trigger_type_copy(OpenAPI_trigger_type_t *dst, OpenAPI_trigger_type_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_trigger_type_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_trigger_type_t *OpenAPI_trigger_type_copy(OpenAPI_trigger_type_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_trigger_type_free(dst);
     dst = OpenAPI_trigger_type_parseFromJSON(item);
     cJSON_Delete(item);
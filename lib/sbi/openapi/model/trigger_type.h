@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "trigger_type_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_trigger_type_t *OpenAPI_trigger_type_create(
 void OpenAPI_trigger_type_free(OpenAPI_trigger_type_t *trigger_type);
 OpenAPI_trigger_type_t *OpenAPI_trigger_type_parseFromJSON(cJSON *trigger_typeJSON);
 cJSON *OpenAPI_trigger_type_convertToJSON(OpenAPI_trigger_type_t *trigger_type);
+bool OpenAPI_trigger_type_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_trigger_type_t *trigger_type);
 OpenAPI_trigger_type_t *OpenAPI_trigger_type_copy(OpenAPI_trigger_type_t *dst, OpenAPI_trigger_type_t *src);
 
 #ifdef __cplusplus
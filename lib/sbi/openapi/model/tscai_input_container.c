@@ -58,6 +58,42 @@ end:
     return item;
 }
 
+bool OpenAPI_tscai_input_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tscai_input_container_t *tscai_input_container)
+{
+    if (tscai_input_container == NULL) {
+        ogs_error("OpenAPI_tscai_input_container_writeJSON() failed [TscaiInputContainer]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tscai_input_container_writeJSON() failed [TscaiInputContainer]");
+        return false;
+    }
+    if (tscai_input_container->is_periodicity) {
+    if (OpenAPI_json_write_number(writer, "periodicity", tscai_input_container->periodicity) == false) {
+        ogs_error("OpenAPI_tscai_input_container_writeJSON() failed [periodicity]");
+        goto end;
+    }
+    }
+
+    if (tscai_input_container->burst_arrival_time) {
+    if (OpenAPI_json_write_string(writer, "burstArrivalTime", tscai_input_container->burst_arrival_time) == false) {
+        ogs_error("OpenAPI_tscai_input_container_writeJSON() failed [burst_arrival_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tscai_input_container_writeJSON() failed [TscaiInputContainer]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_parseFromJSON(cJSON *tscai_input_containerJSON)
 {
     OpenAPI_tscai_input_container_t *tscai_input_container_local_var = NULL;
@@ -93,7 +129,6 @@ end:
 OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_copy(OpenAPI_tscai_input_container_t *dst, OpenAPI_tscai_input_container_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tscai_input_container_convertToJSON(src);
@@ -102,21 +137,6 @@ OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_copy(OpenAPI_tsca
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tscai_input_container_free(dst);
     dst = OpenAPI_tscai_input_container_parseFromJSON(item);
     cJSON_Delete(item);
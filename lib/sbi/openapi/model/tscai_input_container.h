@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_create(
 void OpenAPI_tscai_input_container_free(OpenAPI_tscai_input_container_t *tscai_input_container);
 OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_parseFromJSON(cJSON *tscai_input_containerJSON);
 cJSON *OpenAPI_tscai_input_container_convertToJSON(OpenAPI_tscai_input_container_t *tscai_input_container);
+bool OpenAPI_tscai_input_container_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tscai_input_container_t *tscai_input_container);
 OpenAPI_tscai_input_container_t *OpenAPI_tscai_input_container_copy(OpenAPI_tscai_input_container_t *dst, OpenAPI_tscai_input_container_t *src);
 
 #ifdef __cplusplus
@@ -80,6 +80,56 @@ end:
     return item;
 }
 
+bool OpenAPI_tsn_bridge_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tsn_bridge_info_t *tsn_bridge_info)
+{
+    if (tsn_bridge_info == NULL) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [TsnBridgeInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [TsnBridgeInfo]");
+        return false;
+    }
+    if (tsn_bridge_info->is_bridge_id) {
+    if (OpenAPI_json_write_number(writer, "bridgeId", tsn_bridge_info->bridge_id) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [bridge_id]");
+        goto end;
+    }
+    }
+
+    if (tsn_bridge_info->dstt_addr) {
+    if (OpenAPI_json_write_string(writer, "dsttAddr", tsn_bridge_info->dstt_addr) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [dstt_addr]");
+        goto end;
+    }
+    }
+
+    if (tsn_bridge_info->is_dstt_port_num) {
+    if (OpenAPI_json_write_number(writer, "dsttPortNum", tsn_bridge_info->dstt_port_num) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [dstt_port_num]");
+        goto end;
+    }
+    }
+
+    if (tsn_bridge_info->is_dstt_resid_time) {
+    if (OpenAPI_json_write_number(writer, "dsttResidTime", tsn_bridge_info->dstt_resid_time) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [dstt_resid_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tsn_bridge_info_writeJSON() failed [TsnBridgeInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tsn_bridge_info_t *OpenAPI_tsn_bridge_info_parseFromJSON(cJSON *tsn_bridge_infoJSON)
 {
     OpenAPI_tsn_bridge_info_t *tsn_bridge_info_local_var = NULL;
@@ -137,7 +187,6 @@ end:
 OpenAPI_tsn_bridge_info_t *OpenAPI_tsn_bridge_info_copy(OpenAPI_tsn_bridge_info_t *dst, OpenAPI_tsn_bridge_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tsn_bridge_info_convertToJSON(src);
@@ -146,21 +195,6 @@ OpenAPI_tsn_bridge_info_t *OpenAPI_tsn_bridge_info_copy(OpenAPI_tsn_bridge_info_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tsn_bridge_info_free(dst);
     dst = OpenAPI_tsn_bridge_info_parseFromJSON(item);
     cJSON_Delete(item);
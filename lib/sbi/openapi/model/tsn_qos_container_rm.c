@@ -70,6 +70,49 @@ end:
     return item;
 }
 
+bool OpenAPI_tsn_qos_container_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tsn_qos_container_rm_t *tsn_qos_container_rm)
+{
+    if (tsn_qos_container_rm == NULL) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [TsnQosContainerRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [TsnQosContainerRm]");
+        return false;
+    }
+    if (tsn_qos_container_rm->is_max_tsc_burst_size) {
+    if (OpenAPI_json_write_number(writer, "maxTscBurstSize", tsn_qos_container_rm->max_tsc_burst_size) == false) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [max_tsc_burst_size]");
+        goto end;
+    }
+    }
+
+    if (tsn_qos_container_rm->is_tsc_pack_delay) {
+    if (OpenAPI_json_write_number(writer, "tscPackDelay", tsn_qos_container_rm->tsc_pack_delay) == false) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [tsc_pack_delay]");
+        goto end;
+    }
+    }
+
+    if (tsn_qos_container_rm->is_tsc_prio_level) {
+    if (OpenAPI_json_write_number(writer, "tscPrioLevel", tsn_qos_container_rm->tsc_prio_level) == false) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [tsc_prio_level]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tsn_qos_container_rm_writeJSON() failed [TsnQosContainerRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tsn_qos_container_rm_t *OpenAPI_tsn_qos_container_rm_parseFromJSON(cJSON *tsn_qos_container_rmJSON)
 {
     OpenAPI_tsn_qos_container_rm_t *tsn_qos_container_rm_local_var = NULL;
@@ -117,7 +160,6 @@ end:
 OpenAPI_tsn_qos_container_rm_t *OpenAPI_tsn_qos_container_rm_copy(OpenAPI_tsn_qos_container_rm_t *dst, OpenAPI_tsn_qos_container_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tsn_qos_container_rm_convertToJSON(src);
@@ -126,21 +168,6 @@ OpenAPI_tsn_qos_container_rm_t *OpenAPI_tsn_qos_container_rm_copy(OpenAPI_tsn_qo
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tsn_qos_container_rm_free(dst);
     dst = OpenAPI_tsn_qos_container_rm_parseFromJSON(item);
     cJSON_Delete(item);
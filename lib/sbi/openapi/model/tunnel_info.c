@@ -74,6 +74,54 @@ end:
     return item;
 }
 
+bool OpenAPI_tunnel_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tunnel_info_t *tunnel_info)
+{
+    if (tunnel_info == NULL) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [TunnelInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [TunnelInfo]");
+        return false;
+    }
+    if (tunnel_info->ipv4_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv4Addr", tunnel_info->ipv4_addr) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [ipv4_addr]");
+        goto end;
+    }
+    }
+
+    if (tunnel_info->ipv6_addr) {
+    if (OpenAPI_json_write_string(writer, "ipv6Addr", tunnel_info->ipv6_addr) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [ipv6_addr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "gtpTeid", tunnel_info->gtp_teid) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [gtp_teid]");
+        goto end;
+    }
+
+    if (tunnel_info->an_type) {
+    if (OpenAPI_json_write_string(writer, "anType", OpenAPI_access_type_ToString(tunnel_info->an_type)) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [an_type]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_tunnel_info_writeJSON() failed [TunnelInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_parseFromJSON(cJSON *tunnel_infoJSON)
 {
     OpenAPI_tunnel_info_t *tunnel_info_local_var = NULL;
@@ -132,7 +180,6 @@ end:
 OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_copy(OpenAPI_tunnel_info_t *dst, OpenAPI_tunnel_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_tunnel_info_convertToJSON(src);
@@ -141,21 +188,6 @@ OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_copy(OpenAPI_tunnel_info_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_tunnel_info_free(dst);
     dst = OpenAPI_tunnel_info_parseFromJSON(item);
     cJSON_Delete(item);
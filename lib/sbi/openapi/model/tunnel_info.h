@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_create(
 void OpenAPI_tunnel_info_free(OpenAPI_tunnel_info_t *tunnel_info);
 OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_parseFromJSON(cJSON *tunnel_infoJSON);
 cJSON *OpenAPI_tunnel_info_convertToJSON(OpenAPI_tunnel_info_t *tunnel_info);
+bool OpenAPI_tunnel_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_tunnel_info_t *tunnel_info);
 OpenAPI_tunnel_info_t *OpenAPI_tunnel_info_copy(OpenAPI_tunnel_info_t *dst, OpenAPI_tunnel_info_t *src);
 
 #ifdef __cplusplus
@@ -64,6 +64,47 @@ end:
     return item;
 }
 
+bool OpenAPI_twap_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_twap_id_t *twap_id)
+{
+    if (twap_id == NULL) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [TwapId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [TwapId]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "ssId", twap_id->ss_id) == false) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [ss_id]");
+        goto end;
+    }
+
+    if (twap_id->bss_id) {
+    if (OpenAPI_json_write_string(writer, "bssId", twap_id->bss_id) == false) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [bss_id]");
+        goto end;
+    }
+    }
+
+    if (twap_id->civic_address) {
+    if (OpenAPI_json_write_number(writer, "civicAddress", twap_id->civic_address) == false) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [civic_address]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_twap_id_writeJSON() failed [TwapId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_twap_id_t *OpenAPI_twap_id_parseFromJSON(cJSON *twap_idJSON)
 {
     OpenAPI_twap_id_t *twap_id_local_var = NULL;
@@ -110,7 +151,6 @@ end:
 OpenAPI_twap_id_t *OpenAPI_twap_id_copy(OpenAPI_twap_id_t *dst, OpenAPI_twap_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_twap_id_convertToJSON(src);
@@ -119,21 +159,6 @@ OpenAPI_twap_id_t *OpenAPI_twap_id_copy(OpenAPI_twap_id_t *dst, OpenAPI_twap_id_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_twap_id_free(dst);
     dst = OpenAPI_twap_id_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_twap_id_t *OpenAPI_twap_id_create(
 void OpenAPI_twap_id_free(OpenAPI_twap_id_t *twap_id);
 OpenAPI_twap_id_t *OpenAPI_twap_id_parseFromJSON(cJSON *twap_idJSON);
 cJSON *OpenAPI_twap_id_convertToJSON(OpenAPI_twap_id_t *twap_id);
+bool OpenAPI_twap_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_twap_id_t *twap_id);
 OpenAPI_twap_id_t *OpenAPI_twap_id_copy(OpenAPI_twap_id_t *dst, OpenAPI_twap_id_t *src);
 
 #ifdef __cplusplus
@@ -91,6 +91,73 @@ end:
     return item;
 }
 
+bool OpenAPI_twif_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_twif_info_t *twif_info)
+{
+    if (twif_info == NULL) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [TwifInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [TwifInfo]");
+        return false;
+    }
+    if (twif_info->ipv4_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4EndpointAddresses") == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_endpoint_addresses_node;
+    OpenAPI_list_for_each(twif_info->ipv4_endpoint_addresses, ipv4_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (twif_info->ipv6_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6EndpointAddresses") == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_endpoint_addresses_node;
+    OpenAPI_list_for_each(twif_info->ipv6_endpoint_addresses, ipv6_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (twif_info->endpoint_fqdn) {
+    if (OpenAPI_json_write_string(writer, "endpointFqdn", twif_info->endpoint_fqdn) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [endpoint_fqdn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_twif_info_writeJSON() failed [TwifInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_twif_info_t *OpenAPI_twif_info_parseFromJSON(cJSON *twif_infoJSON)
 {
     OpenAPI_twif_info_t *twif_info_local_var = NULL;
@@ -157,7 +224,6 @@ end:
 OpenAPI_twif_info_t *OpenAPI_twif_info_copy(OpenAPI_twif_info_t *dst, OpenAPI_twif_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_twif_info_convertToJSON(src);
@@ -166,21 +232,6 @@ OpenAPI_twif_info_t *OpenAPI_twif_info_copy(OpenAPI_twif_info_t *dst, OpenAPI_tw
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_twif_info_free(dst);
     dst = OpenAPI_twif_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_twif_info_t *OpenAPI_twif_info_create(
 void OpenAPI_twif_info_free(OpenAPI_twif_info_t *twif_info);
 OpenAPI_twif_info_t *OpenAPI_twif_info_parseFromJSON(cJSON *twif_infoJSON);
 cJSON *OpenAPI_twif_info_convertToJSON(OpenAPI_twif_info_t *twif_info);
+bool OpenAPI_twif_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_twif_info_t *twif_info);
 OpenAPI_twif_info_t *OpenAPI_twif_info_copy(OpenAPI_twif_info_t *dst, OpenAPI_twif_info_t *src);
 
 #ifdef __cplusplus
@@ -173,6 +173,138 @@ end:
     return item;
 }
 
+bool OpenAPI_udm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udm_info_t *udm_info)
+{
+    if (udm_info == NULL) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [UdmInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [UdmInfo]");
+        return false;
+    }
+    if (udm_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", udm_info->group_id) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (udm_info->supi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "supiRanges") == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_ranges_node;
+    if (udm_info->supi_ranges) {
+        OpenAPI_list_for_each(udm_info->supi_ranges, supi_ranges_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udm_info_writeJSON() failed [supi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+    }
+
+    if (udm_info->gpsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRanges") == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_ranges_node;
+    if (udm_info->gpsi_ranges) {
+        OpenAPI_list_for_each(udm_info->gpsi_ranges, gpsi_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udm_info_writeJSON() failed [gpsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (udm_info->external_group_identifiers_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "externalGroupIdentifiersRanges") == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *external_group_identifiers_ranges_node;
+    if (udm_info->external_group_identifiers_ranges) {
+        OpenAPI_list_for_each(udm_info->external_group_identifiers_ranges, external_group_identifiers_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, external_group_identifiers_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udm_info_writeJSON() failed [external_group_identifiers_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+    }
+
+    if (udm_info->routing_indicators) {
+    if (OpenAPI_json_write_array_start(writer, "routingIndicators") == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *routing_indicators_node;
+    OpenAPI_list_for_each(udm_info->routing_indicators, routing_indicators_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)routing_indicators_node->data) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [routing_indicators]");
+        goto end;
+    }
+    }
+
+    if (udm_info->internal_group_identifiers_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "internalGroupIdentifiersRanges") == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [internal_group_identifiers_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *internal_group_identifiers_ranges_node;
+    if (udm_info->internal_group_identifiers_ranges) {
+        OpenAPI_list_for_each(udm_info->internal_group_identifiers_ranges, internal_group_identifiers_ranges_node) {
+            if (OpenAPI_internal_group_id_range_writeJSON(writer, NULL, internal_group_identifiers_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udm_info_writeJSON() failed [internal_group_identifiers_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [internal_group_identifiers_ranges]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_udm_info_writeJSON() failed [UdmInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_udm_info_t *OpenAPI_udm_info_parseFromJSON(cJSON *udm_infoJSON)
 {
     OpenAPI_udm_info_t *udm_info_local_var = NULL;
@@ -338,7 +470,6 @@ end:
 OpenAPI_udm_info_t *OpenAPI_udm_info_copy(OpenAPI_udm_info_t *dst, OpenAPI_udm_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_udm_info_convertToJSON(src);
@@ -347,21 +478,6 @@ OpenAPI_udm_info_t *OpenAPI_udm_info_copy(OpenAPI_udm_info_t *dst, OpenAPI_udm_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_udm_info_free(dst);
     dst = OpenAPI_udm_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "identity_range.h"
 #include "internal_group_id_range.h"
 #include "supi_range.h"
@@ -41,6 +42,7 @@ OpenAPI_udm_info_t *OpenAPI_udm_info_create(
 void OpenAPI_udm_info_free(OpenAPI_udm_info_t *udm_info);
 OpenAPI_udm_info_t *OpenAPI_udm_info_parseFromJSON(cJSON *udm_infoJSON);
 cJSON *OpenAPI_udm_info_convertToJSON(OpenAPI_udm_info_t *udm_info);
+bool OpenAPI_udm_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udm_info_t *udm_info);
 OpenAPI_udm_info_t *OpenAPI_udm_info_copy(OpenAPI_udm_info_t *dst, OpenAPI_udm_info_t *src);
 
 #ifdef __cplusplus
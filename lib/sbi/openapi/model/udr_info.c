@@ -143,6 +143,116 @@ end:
     return item;
 }
 
+bool OpenAPI_udr_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udr_info_t *udr_info)
+{
+    if (udr_info == NULL) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [UdrInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [UdrInfo]");
+        return false;
+    }
+    if (udr_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", udr_info->group_id) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (udr_info->supi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "supiRanges") == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_ranges_node;
+    if (udr_info->supi_ranges) {
+        OpenAPI_list_for_each(udr_info->supi_ranges, supi_ranges_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udr_info_writeJSON() failed [supi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+    }
+
+    if (udr_info->gpsi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiRanges") == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_ranges_node;
+    if (udr_info->gpsi_ranges) {
+        OpenAPI_list_for_each(udr_info->gpsi_ranges, gpsi_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, gpsi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udr_info_writeJSON() failed [gpsi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [gpsi_ranges]");
+        goto end;
+    }
+    }
+
+    if (udr_info->external_group_identifiers_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "externalGroupIdentifiersRanges") == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *external_group_identifiers_ranges_node;
+    if (udr_info->external_group_identifiers_ranges) {
+        OpenAPI_list_for_each(udr_info->external_group_identifiers_ranges, external_group_identifiers_ranges_node) {
+            if (OpenAPI_identity_range_writeJSON(writer, NULL, external_group_identifiers_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udr_info_writeJSON() failed [external_group_identifiers_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [external_group_identifiers_ranges]");
+        goto end;
+    }
+    }
+
+    if (udr_info->supported_data_sets) {
+    if (OpenAPI_json_write_array_start(writer, "supportedDataSets") == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [supported_data_sets]");
+        goto end;
+    }
+    OpenAPI_lnode_t *supported_data_sets_node;
+    OpenAPI_list_for_each(udr_info->supported_data_sets, supported_data_sets_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_data_set_id_ToString((intptr_t)supported_data_sets_node->data)) == false) {
+            ogs_error("OpenAPI_udr_info_writeJSON() failed [supported_data_sets]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [supported_data_sets]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_udr_info_writeJSON() failed [UdrInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_udr_info_t *OpenAPI_udr_info_parseFromJSON(cJSON *udr_infoJSON)
 {
     OpenAPI_udr_info_t *udr_info_local_var = NULL;
@@ -280,7 +390,6 @@ end:
 OpenAPI_udr_info_t *OpenAPI_udr_info_copy(OpenAPI_udr_info_t *dst, OpenAPI_udr_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_udr_info_convertToJSON(src);
@@ -289,21 +398,6 @@ OpenAPI_udr_info_t *OpenAPI_udr_info_copy(OpenAPI_udr_info_t *dst, OpenAPI_udr_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_udr_info_free(dst);
     dst = OpenAPI_udr_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "data_set_id.h"
 #include "identity_range.h"
 #include "supi_range.h"
@@ -39,6 +40,7 @@ OpenAPI_udr_info_t *OpenAPI_udr_info_create(
 void OpenAPI_udr_info_free(OpenAPI_udr_info_t *udr_info);
 OpenAPI_udr_info_t *OpenAPI_udr_info_parseFromJSON(cJSON *udr_infoJSON);
 cJSON *OpenAPI_udr_info_convertToJSON(OpenAPI_udr_info_t *udr_info);
+bool OpenAPI_udr_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udr_info_t *udr_info);
 OpenAPI_udr_info_t *OpenAPI_udr_info_copy(OpenAPI_udr_info_t *dst, OpenAPI_udr_info_t *src);
 
 #ifdef __cplusplus
@@ -97,6 +97,73 @@ end:
     return item;
 }
 
+bool OpenAPI_udsf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udsf_info_t *udsf_info)
+{
+    if (udsf_info == NULL) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [UdsfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [UdsfInfo]");
+        return false;
+    }
+    if (udsf_info->group_id) {
+    if (OpenAPI_json_write_string(writer, "groupId", udsf_info->group_id) == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [group_id]");
+        goto end;
+    }
+    }
+
+    if (udsf_info->supi_ranges) {
+    if (OpenAPI_json_write_array_start(writer, "supiRanges") == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supi_ranges_node;
+    if (udsf_info->supi_ranges) {
+        OpenAPI_list_for_each(udsf_info->supi_ranges, supi_ranges_node) {
+            if (OpenAPI_supi_range_writeJSON(writer, NULL, supi_ranges_node->data) == false) {
+                ogs_error("OpenAPI_udsf_info_writeJSON() failed [supi_ranges]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [supi_ranges]");
+        goto end;
+    }
+    }
+
+    if (udsf_info->storage_id_ranges) {
+    if (OpenAPI_json_write_object_start(writer, "storageIdRanges") == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [storage_id_ranges]");
+        goto end;
+    }
+    OpenAPI_lnode_t *storage_id_ranges_node;
+    if (udsf_info->storage_id_ranges) {
+        OpenAPI_list_for_each(udsf_info->storage_id_ranges, storage_id_ranges_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)storage_id_ranges_node->data;
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [storage_id_ranges]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_udsf_info_writeJSON() failed [UdsfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_udsf_info_t *OpenAPI_udsf_info_parseFromJSON(cJSON *udsf_infoJSON)
 {
     OpenAPI_udsf_info_t *udsf_info_local_var = NULL;
@@ -169,7 +236,6 @@ end:
 OpenAPI_udsf_info_t *OpenAPI_udsf_info_copy(OpenAPI_udsf_info_t *dst, OpenAPI_udsf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_udsf_info_convertToJSON(src);
@@ -178,21 +244,6 @@ OpenAPI_udsf_info_t *OpenAPI_udsf_info_copy(OpenAPI_udsf_info_t *dst, OpenAPI_ud
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_udsf_info_free(dst);
     dst = OpenAPI_udsf_info_parseFromJSON(item);
     cJSON_Delete(item);
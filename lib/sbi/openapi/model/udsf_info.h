@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "identity_range.h"
 #include "supi_range.h"
 
@@ -34,6 +35,7 @@ OpenAPI_udsf_info_t *OpenAPI_udsf_info_create(
 void OpenAPI_udsf_info_free(OpenAPI_udsf_info_t *udsf_info);
 OpenAPI_udsf_info_t *OpenAPI_udsf_info_parseFromJSON(cJSON *udsf_infoJSON);
 cJSON *OpenAPI_udsf_info_convertToJSON(OpenAPI_udsf_info_t *udsf_info);
+bool OpenAPI_udsf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_udsf_info_t *udsf_info);
 OpenAPI_udsf_info_t *OpenAPI_udsf_info_copy(OpenAPI_udsf_info_t *dst, OpenAPI_udsf_info_t *src);
 
 #ifdef __cplusplus
@@ -122,6 +122,77 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_camping_rep_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_camping_rep_t *ue_camping_rep)
+{
+    if (ue_camping_rep == NULL) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [UeCampingRep]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [UeCampingRep]");
+        return false;
+    }
+    if (ue_camping_rep->access_type) {
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(ue_camping_rep->access_type)) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [access_type]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->rat_type) {
+    if (OpenAPI_json_write_string(writer, "ratType", OpenAPI_rat_type_ToString(ue_camping_rep->rat_type)) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [rat_type]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->serv_nf_id) {
+    if (OpenAPI_serving_nf_identity_writeJSON(writer, "servNfId", ue_camping_rep->serv_nf_id) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [serv_nf_id]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", ue_camping_rep->serving_network) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->user_location_info) {
+    if (OpenAPI_user_location_writeJSON(writer, "userLocationInfo", ue_camping_rep->user_location_info) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [user_location_info]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", ue_camping_rep->ue_time_zone) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (ue_camping_rep->net_loc_acc_supp) {
+    if (OpenAPI_json_write_string(writer, "netLocAccSupp", OpenAPI_net_loc_access_support_ToString(ue_camping_rep->net_loc_acc_supp)) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [net_loc_acc_supp]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_camping_rep_writeJSON() failed [UeCampingRep]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_parseFromJSON(cJSON *ue_camping_repJSON)
 {
     OpenAPI_ue_camping_rep_t *ue_camping_rep_local_var = NULL;
@@ -206,7 +277,6 @@ end:
 OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_copy(OpenAPI_ue_camping_rep_t *dst, OpenAPI_ue_camping_rep_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_camping_rep_convertToJSON(src);
@@ -215,21 +285,6 @@ OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_copy(OpenAPI_ue_camping_rep_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_camping_rep_free(dst);
     dst = OpenAPI_ue_camping_rep_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "access_type.h"
 #include "net_loc_access_support.h"
 #include "plmn_id_nid.h"
@@ -46,6 +47,7 @@ OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_create(
 void OpenAPI_ue_camping_rep_free(OpenAPI_ue_camping_rep_t *ue_camping_rep);
 OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_parseFromJSON(cJSON *ue_camping_repJSON);
 cJSON *OpenAPI_ue_camping_rep_convertToJSON(OpenAPI_ue_camping_rep_t *ue_camping_rep);
+bool OpenAPI_ue_camping_rep_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_camping_rep_t *ue_camping_rep);
 OpenAPI_ue_camping_rep_t *OpenAPI_ue_camping_rep_copy(OpenAPI_ue_camping_rep_t *dst, OpenAPI_ue_camping_rep_t *src);
 
 #ifdef __cplusplus
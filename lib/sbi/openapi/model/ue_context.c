@@ -774,6 +774,560 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_t *ue_context)
+{
+    if (ue_context == NULL) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [UeContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [UeContext]");
+        return false;
+    }
+    if (ue_context->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", ue_context->supi) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_supi_unauth_ind) {
+    if (OpenAPI_json_write_bool(writer, "supiUnauthInd", ue_context->supi_unauth_ind) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [supi_unauth_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_context->gpsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_list_node;
+    OpenAPI_list_for_each(ue_context->gpsi_list, gpsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gpsi_list_node->data) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", ue_context->pei) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (ue_context->udm_group_id) {
+    if (OpenAPI_json_write_string(writer, "udmGroupId", ue_context->udm_group_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [udm_group_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->ausf_group_id) {
+    if (OpenAPI_json_write_string(writer, "ausfGroupId", ue_context->ausf_group_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ausf_group_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_group_id) {
+    if (OpenAPI_json_write_string(writer, "pcfGroupId", ue_context->pcf_group_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_group_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->routing_indicator) {
+    if (OpenAPI_json_write_string(writer, "routingIndicator", ue_context->routing_indicator) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [routing_indicator]");
+        goto end;
+    }
+    }
+
+    if (ue_context->group_list) {
+    if (OpenAPI_json_write_array_start(writer, "groupList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [group_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *group_list_node;
+    OpenAPI_list_for_each(ue_context->group_list, group_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)group_list_node->data) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [group_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [group_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->drx_parameter) {
+    if (OpenAPI_json_write_number(writer, "drxParameter", ue_context->drx_parameter) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [drx_parameter]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_sub_rfsp) {
+    if (OpenAPI_json_write_number(writer, "subRfsp", ue_context->sub_rfsp) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [sub_rfsp]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_used_rfsp) {
+    if (OpenAPI_json_write_number(writer, "usedRfsp", ue_context->used_rfsp) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [used_rfsp]");
+        goto end;
+    }
+    }
+
+    if (ue_context->sub_ue_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "subUeAmbr", ue_context->sub_ue_ambr) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [sub_ue_ambr]");
+        goto end;
+    }
+    }
+
+    if (ue_context->smsf_id) {
+    if (OpenAPI_json_write_string(writer, "smsfId", ue_context->smsf_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [smsf_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->seaf_data) {
+    if (OpenAPI_seaf_data_writeJSON(writer, "seafData", ue_context->seaf_data) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [seaf_data]");
+        goto end;
+    }
+    }
+
+    if (ue_context->_5g_mm_capability) {
+    if (OpenAPI_json_write_number(writer, "5gMmCapability", ue_context->_5g_mm_capability) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [_5g_mm_capability]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_id) {
+    if (OpenAPI_json_write_string(writer, "pcfId", ue_context->pcf_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfSetId", ue_context->pcf_set_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_amp_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfAmpServiceSetId", ue_context->pcf_amp_service_set_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_amp_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_uep_service_set_id) {
+    if (OpenAPI_json_write_string(writer, "pcfUepServiceSetId", ue_context->pcf_uep_service_set_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_uep_service_set_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_binding) {
+    if (OpenAPI_json_write_string(writer, "pcfBinding", OpenAPI_sbi_binding_level_ToString(ue_context->pcf_binding)) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_binding]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_am_policy_uri) {
+    if (OpenAPI_json_write_string(writer, "pcfAmPolicyUri", ue_context->pcf_am_policy_uri) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_am_policy_uri]");
+        goto end;
+    }
+    }
+
+    if (ue_context->am_policy_req_trigger_list) {
+    if (OpenAPI_json_write_array_start(writer, "amPolicyReqTriggerList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [am_policy_req_trigger_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *am_policy_req_trigger_list_node;
+    OpenAPI_list_for_each(ue_context->am_policy_req_trigger_list, am_policy_req_trigger_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_req_trigger_ToString((intptr_t)am_policy_req_trigger_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [am_policy_req_trigger_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [am_policy_req_trigger_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->pcf_ue_policy_uri) {
+    if (OpenAPI_json_write_string(writer, "pcfUePolicyUri", ue_context->pcf_ue_policy_uri) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [pcf_ue_policy_uri]");
+        goto end;
+    }
+    }
+
+    if (ue_context->ue_policy_req_trigger_list) {
+    if (OpenAPI_json_write_array_start(writer, "uePolicyReqTriggerList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ue_policy_req_trigger_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ue_policy_req_trigger_list_node;
+    OpenAPI_list_for_each(ue_context->ue_policy_req_trigger_list, ue_policy_req_trigger_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_policy_req_trigger_ToString((intptr_t)ue_policy_req_trigger_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [ue_policy_req_trigger_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ue_policy_req_trigger_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->hpcf_id) {
+    if (OpenAPI_json_write_string(writer, "hpcfId", ue_context->hpcf_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [hpcf_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->hpcf_set_id) {
+    if (OpenAPI_json_write_string(writer, "hpcfSetId", ue_context->hpcf_set_id) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [hpcf_set_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context->restricted_rat_list) {
+    if (OpenAPI_json_write_array_start(writer, "restrictedRatList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_rat_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *restricted_rat_list_node;
+    OpenAPI_list_for_each(ue_context->restricted_rat_list, restricted_rat_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)restricted_rat_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_rat_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_rat_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->forbidden_area_list) {
+    if (OpenAPI_json_write_array_start(writer, "forbiddenAreaList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [forbidden_area_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *forbidden_area_list_node;
+    if (ue_context->forbidden_area_list) {
+        OpenAPI_list_for_each(ue_context->forbidden_area_list, forbidden_area_list_node) {
+            if (OpenAPI_area_writeJSON(writer, NULL, forbidden_area_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_writeJSON() failed [forbidden_area_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [forbidden_area_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->service_area_restriction) {
+    if (OpenAPI_service_area_restriction_writeJSON(writer, "serviceAreaRestriction", ue_context->service_area_restriction) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [service_area_restriction]");
+        goto end;
+    }
+    }
+
+    if (ue_context->restricted_core_nw_type_list) {
+    if (OpenAPI_json_write_array_start(writer, "restrictedCoreNwTypeList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_core_nw_type_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *restricted_core_nw_type_list_node;
+    OpenAPI_list_for_each(ue_context->restricted_core_nw_type_list, restricted_core_nw_type_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_core_network_type_ToString((intptr_t)restricted_core_nw_type_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_core_nw_type_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_core_nw_type_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->event_subscription_list) {
+    if (OpenAPI_json_write_array_start(writer, "eventSubscriptionList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [event_subscription_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *event_subscription_list_node;
+    if (ue_context->event_subscription_list) {
+        OpenAPI_list_for_each(ue_context->event_subscription_list, event_subscription_list_node) {
+            if (OpenAPI_ext_amf_event_subscription_writeJSON(writer, NULL, event_subscription_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_writeJSON() failed [event_subscription_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [event_subscription_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->mm_context_list) {
+    if (OpenAPI_json_write_array_start(writer, "mmContextList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [mm_context_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *mm_context_list_node;
+    if (ue_context->mm_context_list) {
+        OpenAPI_list_for_each(ue_context->mm_context_list, mm_context_list_node) {
+            if (OpenAPI_mm_context_writeJSON(writer, NULL, mm_context_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_writeJSON() failed [mm_context_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [mm_context_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->session_context_list) {
+    if (OpenAPI_json_write_array_start(writer, "sessionContextList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [session_context_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *session_context_list_node;
+    if (ue_context->session_context_list) {
+        OpenAPI_list_for_each(ue_context->session_context_list, session_context_list_node) {
+            if (OpenAPI_pdu_session_context_writeJSON(writer, NULL, session_context_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_writeJSON() failed [session_context_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [session_context_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->trace_data) {
+    if (OpenAPI_trace_data_writeJSON(writer, "traceData", ue_context->trace_data) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [trace_data]");
+        goto end;
+    }
+    }
+
+    if (ue_context->service_gap_expiry_time) {
+    if (OpenAPI_json_write_string(writer, "serviceGapExpiryTime", ue_context->service_gap_expiry_time) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [service_gap_expiry_time]");
+        goto end;
+    }
+    }
+
+    if (ue_context->stn_sr) {
+    if (OpenAPI_json_write_string(writer, "stnSr", ue_context->stn_sr) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [stn_sr]");
+        goto end;
+    }
+    }
+
+    if (ue_context->c_msisdn) {
+    if (OpenAPI_json_write_string(writer, "cMsisdn", ue_context->c_msisdn) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [c_msisdn]");
+        goto end;
+    }
+    }
+
+    if (ue_context->ms_classmark2) {
+    if (OpenAPI_json_write_number(writer, "msClassmark2", ue_context->ms_classmark2) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ms_classmark2]");
+        goto end;
+    }
+    }
+
+    if (ue_context->supported_codec_list) {
+    if (OpenAPI_json_write_array_start(writer, "supportedCodecList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [supported_codec_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *supported_codec_list_node;
+    OpenAPI_list_for_each(ue_context->supported_codec_list, supported_codec_list_node)  {
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [supported_codec_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->small_data_rate_status_infos) {
+    if (OpenAPI_json_write_array_start(writer, "smallDataRateStatusInfos") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [small_data_rate_status_infos]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *small_data_rate_status_infos_node;
+    if (ue_context->small_data_rate_status_infos) {
+        OpenAPI_list_for_each(ue_context->small_data_rate_status_infos, small_data_rate_status_infos_node) {
+            if (OpenAPI_small_data_rate_status_info_writeJSON(writer, NULL, small_data_rate_status_infos_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_writeJSON() failed [small_data_rate_status_infos]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [small_data_rate_status_infos]");
+        goto end;
+    }
+    }
+
+    if (ue_context->restricted_primary_rat_list) {
+    if (OpenAPI_json_write_array_start(writer, "restrictedPrimaryRatList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_primary_rat_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *restricted_primary_rat_list_node;
+    OpenAPI_list_for_each(ue_context->restricted_primary_rat_list, restricted_primary_rat_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)restricted_primary_rat_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_primary_rat_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_primary_rat_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->restricted_secondary_rat_list) {
+    if (OpenAPI_json_write_array_start(writer, "restrictedSecondaryRatList") == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_secondary_rat_list]");
+        goto end;
+    }
+    OpenAPI_lnode_t *restricted_secondary_rat_list_node;
+    OpenAPI_list_for_each(ue_context->restricted_secondary_rat_list, restricted_secondary_rat_list_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_rat_type_ToString((intptr_t)restricted_secondary_rat_list_node->data)) == false) {
+            ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_secondary_rat_list]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [restricted_secondary_rat_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context->v2x_context) {
+    if (OpenAPI_v2x_context_writeJSON(writer, "v2xContext", ue_context->v2x_context) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [v2x_context]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_lte_cat_m_ind) {
+    if (OpenAPI_json_write_bool(writer, "lteCatMInd", ue_context->lte_cat_m_ind) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [lte_cat_m_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_context->mo_exp_data_counter) {
+    if (OpenAPI_mo_exp_data_counter_writeJSON(writer, "moExpDataCounter", ue_context->mo_exp_data_counter) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [mo_exp_data_counter]");
+        goto end;
+    }
+    }
+
+    if (ue_context->cag_data) {
+    if (OpenAPI_cag_data_writeJSON(writer, "cagData", ue_context->cag_data) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [cag_data]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_management_mdt_ind) {
+    if (OpenAPI_json_write_bool(writer, "managementMdtInd", ue_context->management_mdt_ind) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [management_mdt_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_context->immediate_mdt_conf) {
+    if (OpenAPI_immediate_mdt_conf_writeJSON(writer, "immediateMdtConf", ue_context->immediate_mdt_conf) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [immediate_mdt_conf]");
+        goto end;
+    }
+    }
+
+    if (ue_context->ec_restriction_data_wb) {
+    if (OpenAPI_ec_restriction_data_wb_writeJSON(writer, "ecRestrictionDataWb", ue_context->ec_restriction_data_wb) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ec_restriction_data_wb]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_ec_restriction_data_nb) {
+    if (OpenAPI_json_write_bool(writer, "ecRestrictionDataNb", ue_context->ec_restriction_data_nb) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [ec_restriction_data_nb]");
+        goto end;
+    }
+    }
+
+    if (ue_context->is_iab_operation_allowed) {
+    if (OpenAPI_json_write_bool(writer, "iabOperationAllowed", ue_context->iab_operation_allowed) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [iab_operation_allowed]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_writeJSON() failed [UeContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_t *OpenAPI_ue_context_parseFromJSON(cJSON *ue_contextJSON)
 {
     OpenAPI_ue_context_t *ue_context_local_var = NULL;
@@ -1505,7 +2059,6 @@ end:
 OpenAPI_ue_context_t *OpenAPI_ue_context_copy(OpenAPI_ue_context_t *dst, OpenAPI_ue_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_convertToJSON(src);
@@ -1514,21 +2067,6 @@ OpenAPI_ue_context_t *OpenAPI_ue_context_copy(OpenAPI_ue_context_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_free(dst);
     dst = OpenAPI_ue_context_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "area.h"
 #include "cag_data.h"
@@ -162,6 +163,7 @@ OpenAPI_ue_context_t *OpenAPI_ue_context_create(
 void OpenAPI_ue_context_free(OpenAPI_ue_context_t *ue_context);
 OpenAPI_ue_context_t *OpenAPI_ue_context_parseFromJSON(cJSON *ue_contextJSON);
 cJSON *OpenAPI_ue_context_convertToJSON(OpenAPI_ue_context_t *ue_context);
+bool OpenAPI_ue_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_t *ue_context);
 OpenAPI_ue_context_t *OpenAPI_ue_context_copy(OpenAPI_ue_context_t *dst, OpenAPI_ue_context_t *src);
 
 #ifdef __cplusplus
@@ -61,6 +61,40 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_cancel_relocate_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_cancel_relocate_data_t *ue_context_cancel_relocate_data)
+{
+    if (ue_context_cancel_relocate_data == NULL) {
+        ogs_error("OpenAPI_ue_context_cancel_relocate_data_writeJSON() failed [UeContextCancelRelocateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_cancel_relocate_data_writeJSON() failed [UeContextCancelRelocateData]");
+        return false;
+    }
+    if (ue_context_cancel_relocate_data->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", ue_context_cancel_relocate_data->supi) == false) {
+        ogs_error("OpenAPI_ue_context_cancel_relocate_data_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "relocationCancelRequest", ue_context_cancel_relocate_data->relocation_cancel_request) == false) {
+        ogs_error("OpenAPI_ue_context_cancel_relocate_data_writeJSON() failed [relocation_cancel_request]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_cancel_relocate_data_writeJSON() failed [UeContextCancelRelocateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_cancel_relocate_data_t *OpenAPI_ue_context_cancel_relocate_data_parseFromJSON(cJSON *ue_context_cancel_relocate_dataJSON)
 {
     OpenAPI_ue_context_cancel_relocate_data_t *ue_context_cancel_relocate_data_local_var = NULL;
@@ -95,7 +129,6 @@ end:
 OpenAPI_ue_context_cancel_relocate_data_t *OpenAPI_ue_context_cancel_relocate_data_copy(OpenAPI_ue_context_cancel_relocate_data_t *dst, OpenAPI_ue_context_cancel_relocate_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_cancel_relocate_data_convertToJSON(src);
@@ -104,21 +137,6 @@ OpenAPI_ue_context_cancel_relocate_data_t *OpenAPI_ue_context_cancel_relocate_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_cancel_relocate_data_free(dst);
     dst = OpenAPI_ue_context_cancel_relocate_data_parseFromJSON(item);
     cJSON_Delete(item);
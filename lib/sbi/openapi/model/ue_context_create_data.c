@@ -171,6 +171,97 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_create_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_create_data_t *ue_context_create_data)
+{
+    if (ue_context_create_data == NULL) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [UeContextCreateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [UeContextCreateData]");
+        return false;
+    }
+    if (OpenAPI_ue_context_writeJSON(writer, "ueContext", ue_context_create_data->ue_context) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [ue_context]");
+        goto end;
+    }
+
+    if (OpenAPI_ng_ran_target_id_writeJSON(writer, "targetId", ue_context_create_data->target_id) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [target_id]");
+        goto end;
+    }
+
+    if (OpenAPI_n2_info_content_writeJSON(writer, "sourceToTargetData", ue_context_create_data->source_to_target_data) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [source_to_target_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pduSessionList") == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_session_list_node;
+    if (ue_context_create_data->pdu_session_list) {
+        OpenAPI_list_for_each(ue_context_create_data->pdu_session_list, pdu_session_list_node) {
+            if (OpenAPI_n2_sm_information_writeJSON(writer, NULL, pdu_session_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [pdu_session_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+
+    if (ue_context_create_data->n2_notify_uri) {
+    if (OpenAPI_json_write_string(writer, "n2NotifyUri", ue_context_create_data->n2_notify_uri) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [n2_notify_uri]");
+        goto end;
+    }
+    }
+
+    if (ue_context_create_data->ue_radio_capability) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "ueRadioCapability", ue_context_create_data->ue_radio_capability) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [ue_radio_capability]");
+        goto end;
+    }
+    }
+
+    if (ue_context_create_data->ngap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngapCause", ue_context_create_data->ngap_cause) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [ngap_cause]");
+        goto end;
+    }
+    }
+
+    if (ue_context_create_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_context_create_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (ue_context_create_data->serving_network) {
+    if (OpenAPI_plmn_id_nid_writeJSON(writer, "servingNetwork", ue_context_create_data->serving_network) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [serving_network]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_create_data_writeJSON() failed [UeContextCreateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_create_data_t *OpenAPI_ue_context_create_data_parseFromJSON(cJSON *ue_context_create_dataJSON)
 {
     OpenAPI_ue_context_create_data_t *ue_context_create_data_local_var = NULL;
@@ -291,7 +382,6 @@ end:
 OpenAPI_ue_context_create_data_t *OpenAPI_ue_context_create_data_copy(OpenAPI_ue_context_create_data_t *dst, OpenAPI_ue_context_create_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_create_data_convertToJSON(src);
@@ -300,21 +390,6 @@ OpenAPI_ue_context_create_data_t *OpenAPI_ue_context_create_data_copy(OpenAPI_ue
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_create_data_free(dst);
     dst = OpenAPI_ue_context_create_data_parseFromJSON(item);
     cJSON_Delete(item);
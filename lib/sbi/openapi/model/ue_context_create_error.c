@@ -83,6 +83,47 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_create_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_create_error_t *ue_context_create_error)
+{
+    if (ue_context_create_error == NULL) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [UeContextCreateError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [UeContextCreateError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", ue_context_create_error->error) == false) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (ue_context_create_error->ngap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngapCause", ue_context_create_error->ngap_cause) == false) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [ngap_cause]");
+        goto end;
+    }
+    }
+
+    if (ue_context_create_error->target_to_source_failure_data) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "targetToSourceFailureData", ue_context_create_error->target_to_source_failure_data) == false) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [target_to_source_failure_data]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_create_error_writeJSON() failed [UeContextCreateError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_parseFromJSON(cJSON *ue_context_create_errorJSON)
 {
     OpenAPI_ue_context_create_error_t *ue_context_create_error_local_var = NULL;
@@ -123,7 +164,6 @@ end:
 OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_copy(OpenAPI_ue_context_create_error_t *dst, OpenAPI_ue_context_create_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_create_error_convertToJSON(src);
@@ -132,21 +172,6 @@ OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_create_error_free(dst);
     dst = OpenAPI_ue_context_create_error_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_info_content.h"
 #include "ng_ap_cause.h"
 #include "problem_details.h"
@@ -35,6 +36,7 @@ OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_create(
 void OpenAPI_ue_context_create_error_free(OpenAPI_ue_context_create_error_t *ue_context_create_error);
 OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_parseFromJSON(cJSON *ue_context_create_errorJSON);
 cJSON *OpenAPI_ue_context_create_error_convertToJSON(OpenAPI_ue_context_create_error_t *ue_context_create_error);
+bool OpenAPI_ue_context_create_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_create_error_t *ue_context_create_error);
 OpenAPI_ue_context_create_error_t *OpenAPI_ue_context_create_error_copy(OpenAPI_ue_context_create_error_t *dst, OpenAPI_ue_context_create_error_t *src);
 
 #ifdef __cplusplus
@@ -136,6 +136,92 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_created_data_t *ue_context_created_data)
+{
+    if (ue_context_created_data == NULL) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [UeContextCreatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [UeContextCreatedData]");
+        return false;
+    }
+    if (OpenAPI_ue_context_writeJSON(writer, "ueContext", ue_context_created_data->ue_context) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [ue_context]");
+        goto end;
+    }
+
+    if (OpenAPI_n2_info_content_writeJSON(writer, "targetToSourceData", ue_context_created_data->target_to_source_data) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [target_to_source_data]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "pduSessionList") == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_session_list_node;
+    if (ue_context_created_data->pdu_session_list) {
+        OpenAPI_list_for_each(ue_context_created_data->pdu_session_list, pdu_session_list_node) {
+            if (OpenAPI_n2_sm_information_writeJSON(writer, NULL, pdu_session_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [pdu_session_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+
+    if (ue_context_created_data->failed_session_list) {
+    if (OpenAPI_json_write_array_start(writer, "failedSessionList") == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [failed_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_session_list_node;
+    if (ue_context_created_data->failed_session_list) {
+        OpenAPI_list_for_each(ue_context_created_data->failed_session_list, failed_session_list_node) {
+            if (OpenAPI_n2_sm_information_writeJSON(writer, NULL, failed_session_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [failed_session_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [failed_session_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context_created_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_context_created_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (ue_context_created_data->is_pcf_reselected_ind) {
+    if (OpenAPI_json_write_bool(writer, "pcfReselectedInd", ue_context_created_data->pcf_reselected_ind) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [pcf_reselected_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_created_data_writeJSON() failed [UeContextCreatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_parseFromJSON(cJSON *ue_context_created_dataJSON)
 {
     OpenAPI_ue_context_created_data_t *ue_context_created_data_local_var = NULL;
@@ -253,7 +339,6 @@ end:
 OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_copy(OpenAPI_ue_context_created_data_t *dst, OpenAPI_ue_context_created_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_created_data_convertToJSON(src);
@@ -262,21 +347,6 @@ OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_created_data_free(dst);
     dst = OpenAPI_ue_context_created_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_info_content.h"
 #include "n2_sm_information.h"
 #include "ue_context.h"
@@ -43,6 +44,7 @@ OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_create(
 void OpenAPI_ue_context_created_data_free(OpenAPI_ue_context_created_data_t *ue_context_created_data);
 OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_parseFromJSON(cJSON *ue_context_created_dataJSON);
 cJSON *OpenAPI_ue_context_created_data_convertToJSON(OpenAPI_ue_context_created_data_t *ue_context_created_data);
+bool OpenAPI_ue_context_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_created_data_t *ue_context_created_data);
 OpenAPI_ue_context_created_data_t *OpenAPI_ue_context_created_data_copy(OpenAPI_ue_context_created_data_t *dst, OpenAPI_ue_context_created_data_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "eps_interworking_info.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_ue_context_in_amf_data_t *OpenAPI_ue_context_in_amf_data_create(
 void OpenAPI_ue_context_in_amf_data_free(OpenAPI_ue_context_in_amf_data_t *ue_context_in_amf_data);
 OpenAPI_ue_context_in_amf_data_t *OpenAPI_ue_context_in_amf_data_parseFromJSON(cJSON *ue_context_in_amf_dataJSON);
 cJSON *OpenAPI_ue_context_in_amf_data_convertToJSON(OpenAPI_ue_context_in_amf_data_t *ue_context_in_amf_data);
+bool OpenAPI_ue_context_in_amf_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_in_amf_data_t *ue_context_in_amf_data);
 OpenAPI_ue_context_in_amf_data_t *OpenAPI_ue_context_in_amf_data_copy(OpenAPI_ue_context_in_amf_data_t *dst, OpenAPI_ue_context_in_amf_data_t *src);
 
 #ifdef __cplusplus
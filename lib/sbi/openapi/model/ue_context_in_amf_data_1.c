@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_in_amf_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_in_amf_data_1_t *ue_context_in_amf_data_1)
+{
+    if (ue_context_in_amf_data_1 == NULL) {
+        ogs_error("OpenAPI_ue_context_in_amf_data_1_writeJSON() failed [UeContextInAmfData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_in_amf_data_1_writeJSON() failed [UeContextInAmfData_1]");
+        return false;
+    }
+    if (ue_context_in_amf_data_1->eps_interworking_info) {
+    if (OpenAPI_eps_interworking_info_writeJSON(writer, "epsInterworkingInfo", ue_context_in_amf_data_1->eps_interworking_info) == false) {
+        ogs_error("OpenAPI_ue_context_in_amf_data_1_writeJSON() failed [eps_interworking_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_in_amf_data_1_writeJSON() failed [UeContextInAmfData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_in_amf_data_1_t *OpenAPI_ue_context_in_amf_data_1_parseFromJSON(cJSON *ue_context_in_amf_data_1JSON)
 {
     OpenAPI_ue_context_in_amf_data_1_t *ue_context_in_amf_data_1_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_ue_context_in_amf_data_1_t *OpenAPI_ue_context_in_amf_data_1_copy(OpenAPI_ue_context_in_amf_data_1_t *dst, OpenAPI_ue_context_in_amf_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_in_amf_data_1_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_ue_context_in_amf_data_1_t *OpenAPI_ue_context_in_amf_data_1_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_in_amf_data_1_free(dst);
     dst = OpenAPI_ue_context_in_amf_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,6 +111,79 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_in_smf_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_in_smf_data_1_t *ue_context_in_smf_data_1)
+{
+    if (ue_context_in_smf_data_1 == NULL) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [UeContextInSmfData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [UeContextInSmfData_1]");
+        return false;
+    }
+    if (ue_context_in_smf_data_1->pdu_sessions) {
+    if (OpenAPI_json_write_object_start(writer, "pduSessions") == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pdu_sessions]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pdu_sessions_node;
+    if (ue_context_in_smf_data_1->pdu_sessions) {
+        OpenAPI_list_for_each(ue_context_in_smf_data_1->pdu_sessions, pdu_sessions_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pdu_sessions_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_pdu_session_1_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pdu_sessions]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pdu_sessions]");
+        goto end;
+    }
+    }
+
+    if (ue_context_in_smf_data_1->pgw_info) {
+    if (OpenAPI_json_write_array_start(writer, "pgwInfo") == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pgw_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pgw_info_node;
+    if (ue_context_in_smf_data_1->pgw_info) {
+        OpenAPI_list_for_each(ue_context_in_smf_data_1->pgw_info, pgw_info_node) {
+            if (OpenAPI_pgw_info_1_writeJSON(writer, NULL, pgw_info_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pgw_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [pgw_info]");
+        goto end;
+    }
+    }
+
+    if (ue_context_in_smf_data_1->emergency_info) {
+    if (OpenAPI_emergency_info_1_writeJSON(writer, "emergencyInfo", ue_context_in_smf_data_1->emergency_info) == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [emergency_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_in_smf_data_1_writeJSON() failed [UeContextInSmfData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_in_smf_data_1_t *OpenAPI_ue_context_in_smf_data_1_parseFromJSON(cJSON *ue_context_in_smf_data_1JSON)
 {
     OpenAPI_ue_context_in_smf_data_1_t *ue_context_in_smf_data_1_local_var = NULL;
@@ -190,7 +263,6 @@ end:
 OpenAPI_ue_context_in_smf_data_1_t *OpenAPI_ue_context_in_smf_data_1_copy(OpenAPI_ue_context_in_smf_data_1_t *dst, OpenAPI_ue_context_in_smf_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_in_smf_data_1_convertToJSON(src);
@@ -199,21 +271,6 @@ OpenAPI_ue_context_in_smf_data_1_t *OpenAPI_ue_context_in_smf_data_1_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_in_smf_data_1_free(dst);
     dst = OpenAPI_ue_context_in_smf_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -69,6 +69,42 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_in_smsf_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_in_smsf_data_t *ue_context_in_smsf_data)
+{
+    if (ue_context_in_smsf_data == NULL) {
+        ogs_error("OpenAPI_ue_context_in_smsf_data_writeJSON() failed [UeContextInSmsfData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_in_smsf_data_writeJSON() failed [UeContextInSmsfData]");
+        return false;
+    }
+    if (ue_context_in_smsf_data->smsf_info3_gpp_access) {
+    if (OpenAPI_smsf_info_writeJSON(writer, "smsfInfo3GppAccess", ue_context_in_smsf_data->smsf_info3_gpp_access) == false) {
+        ogs_error("OpenAPI_ue_context_in_smsf_data_writeJSON() failed [smsf_info3_gpp_access]");
+        goto end;
+    }
+    }
+
+    if (ue_context_in_smsf_data->smsf_info_non3_gpp_access) {
+    if (OpenAPI_smsf_info_writeJSON(writer, "smsfInfoNon3GppAccess", ue_context_in_smsf_data->smsf_info_non3_gpp_access) == false) {
+        ogs_error("OpenAPI_ue_context_in_smsf_data_writeJSON() failed [smsf_info_non3_gpp_access]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_in_smsf_data_writeJSON() failed [UeContextInSmsfData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_in_smsf_data_t *OpenAPI_ue_context_in_smsf_data_parseFromJSON(cJSON *ue_context_in_smsf_dataJSON)
 {
     OpenAPI_ue_context_in_smsf_data_t *ue_context_in_smsf_data_local_var = NULL;
@@ -99,7 +135,6 @@ end:
 OpenAPI_ue_context_in_smsf_data_t *OpenAPI_ue_context_in_smsf_data_copy(OpenAPI_ue_context_in_smsf_data_t *dst, OpenAPI_ue_context_in_smsf_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_in_smsf_data_convertToJSON(src);
@@ -108,21 +143,6 @@ OpenAPI_ue_context_in_smsf_data_t *OpenAPI_ue_context_in_smsf_data_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_in_smsf_data_free(dst);
     dst = OpenAPI_ue_context_in_smsf_data_parseFromJSON(item);
     cJSON_Delete(item);
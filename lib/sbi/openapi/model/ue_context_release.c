@@ -72,6 +72,47 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_release_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_release_t *ue_context_release)
+{
+    if (ue_context_release == NULL) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [UEContextRelease]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [UEContextRelease]");
+        return false;
+    }
+    if (ue_context_release->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", ue_context_release->supi) == false) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (ue_context_release->is_unauthenticated_supi) {
+    if (OpenAPI_json_write_bool(writer, "unauthenticatedSupi", ue_context_release->unauthenticated_supi) == false) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [unauthenticated_supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngapCause", ue_context_release->ngap_cause) == false) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [ngap_cause]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_release_writeJSON() failed [UEContextRelease]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_parseFromJSON(cJSON *ue_context_releaseJSON)
 {
     OpenAPI_ue_context_release_t *ue_context_release_local_var = NULL;
@@ -117,7 +158,6 @@ end:
 OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_copy(OpenAPI_ue_context_release_t *dst, OpenAPI_ue_context_release_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_release_convertToJSON(src);
@@ -126,21 +166,6 @@ OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_copy(OpenAPI_ue_context
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_release_free(dst);
     dst = OpenAPI_ue_context_release_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ng_ap_cause.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_create(
 void OpenAPI_ue_context_release_free(OpenAPI_ue_context_release_t *ue_context_release);
 OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_parseFromJSON(cJSON *ue_context_releaseJSON);
 cJSON *OpenAPI_ue_context_release_convertToJSON(OpenAPI_ue_context_release_t *ue_context_release);
+bool OpenAPI_ue_context_release_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_release_t *ue_context_release);
 OpenAPI_ue_context_release_t *OpenAPI_ue_context_release_copy(OpenAPI_ue_context_release_t *dst, OpenAPI_ue_context_release_t *src);
 
 #ifdef __cplusplus
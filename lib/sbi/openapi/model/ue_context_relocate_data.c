@@ -161,6 +161,90 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_relocate_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_relocate_data_t *ue_context_relocate_data)
+{
+    if (ue_context_relocate_data == NULL) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [UeContextRelocateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [UeContextRelocateData]");
+        return false;
+    }
+    if (OpenAPI_ue_context_writeJSON(writer, "ueContext", ue_context_relocate_data->ue_context) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [ue_context]");
+        goto end;
+    }
+
+    if (OpenAPI_ng_ran_target_id_writeJSON(writer, "targetId", ue_context_relocate_data->target_id) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [target_id]");
+        goto end;
+    }
+
+    if (OpenAPI_n2_info_content_writeJSON(writer, "sourceToTargetData", ue_context_relocate_data->source_to_target_data) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [source_to_target_data]");
+        goto end;
+    }
+
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "forwardRelocationRequest", ue_context_relocate_data->forward_relocation_request) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [forward_relocation_request]");
+        goto end;
+    }
+
+    if (ue_context_relocate_data->pdu_session_list) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionList") == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pdu_session_list_node;
+    if (ue_context_relocate_data->pdu_session_list) {
+        OpenAPI_list_for_each(ue_context_relocate_data->pdu_session_list, pdu_session_list_node) {
+            if (OpenAPI_n2_sm_information_writeJSON(writer, NULL, pdu_session_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [pdu_session_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [pdu_session_list]");
+        goto end;
+    }
+    }
+
+    if (ue_context_relocate_data->ue_radio_capability) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "ueRadioCapability", ue_context_relocate_data->ue_radio_capability) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [ue_radio_capability]");
+        goto end;
+    }
+    }
+
+    if (ue_context_relocate_data->ngap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngapCause", ue_context_relocate_data->ngap_cause) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [ngap_cause]");
+        goto end;
+    }
+    }
+
+    if (ue_context_relocate_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_context_relocate_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_relocate_data_writeJSON() failed [UeContextRelocateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_relocate_data_t *OpenAPI_ue_context_relocate_data_parseFromJSON(cJSON *ue_context_relocate_dataJSON)
 {
     OpenAPI_ue_context_relocate_data_t *ue_context_relocate_data_local_var = NULL;
@@ -271,7 +355,6 @@ end:
 OpenAPI_ue_context_relocate_data_t *OpenAPI_ue_context_relocate_data_copy(OpenAPI_ue_context_relocate_data_t *dst, OpenAPI_ue_context_relocate_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_relocate_data_convertToJSON(src);
@@ -280,21 +363,6 @@ OpenAPI_ue_context_relocate_data_t *OpenAPI_ue_context_relocate_data_copy(OpenAP
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_relocate_data_free(dst);
     dst = OpenAPI_ue_context_relocate_data_parseFromJSON(item);
     cJSON_Delete(item);
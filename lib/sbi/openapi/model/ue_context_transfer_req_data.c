@@ -93,6 +93,59 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_transfer_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_transfer_req_data_t *ue_context_transfer_req_data)
+{
+    if (ue_context_transfer_req_data == NULL) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [UeContextTransferReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [UeContextTransferReqData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "reason", OpenAPI_transfer_reason_ToString(ue_context_transfer_req_data->reason)) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [reason]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "accessType", OpenAPI_access_type_ToString(ue_context_transfer_req_data->access_type)) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [access_type]");
+        goto end;
+    }
+
+    if (ue_context_transfer_req_data->plmn_id) {
+    if (OpenAPI_plmn_id_writeJSON(writer, "plmnId", ue_context_transfer_req_data->plmn_id) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [plmn_id]");
+        goto end;
+    }
+    }
+
+    if (ue_context_transfer_req_data->reg_request) {
+    if (OpenAPI_n1_message_container_writeJSON(writer, "regRequest", ue_context_transfer_req_data->reg_request) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [reg_request]");
+        goto end;
+    }
+    }
+
+    if (ue_context_transfer_req_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_context_transfer_req_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_req_data_writeJSON() failed [UeContextTransferReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_transfer_req_data_t *OpenAPI_ue_context_transfer_req_data_parseFromJSON(cJSON *ue_context_transfer_req_dataJSON)
 {
     OpenAPI_ue_context_transfer_req_data_t *ue_context_transfer_req_data_local_var = NULL;
@@ -161,7 +214,6 @@ end:
 OpenAPI_ue_context_transfer_req_data_t *OpenAPI_ue_context_transfer_req_data_copy(OpenAPI_ue_context_transfer_req_data_t *dst, OpenAPI_ue_context_transfer_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_transfer_req_data_convertToJSON(src);
@@ -170,21 +222,6 @@ OpenAPI_ue_context_transfer_req_data_t *OpenAPI_ue_context_transfer_req_data_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_transfer_req_data_free(dst);
     dst = OpenAPI_ue_context_transfer_req_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -93,6 +93,54 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_context_transfer_rsp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_context_transfer_rsp_data_t *ue_context_transfer_rsp_data)
+{
+    if (ue_context_transfer_rsp_data == NULL) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [UeContextTransferRspData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [UeContextTransferRspData]");
+        return false;
+    }
+    if (OpenAPI_ue_context_writeJSON(writer, "ueContext", ue_context_transfer_rsp_data->ue_context) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [ue_context]");
+        goto end;
+    }
+
+    if (ue_context_transfer_rsp_data->ue_radio_capability) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "ueRadioCapability", ue_context_transfer_rsp_data->ue_radio_capability) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [ue_radio_capability]");
+        goto end;
+    }
+    }
+
+    if (ue_context_transfer_rsp_data->ue_nbiot_radio_capability) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "ueNbiotRadioCapability", ue_context_transfer_rsp_data->ue_nbiot_radio_capability) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [ue_nbiot_radio_capability]");
+        goto end;
+    }
+    }
+
+    if (ue_context_transfer_rsp_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_context_transfer_rsp_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_context_transfer_rsp_data_writeJSON() failed [UeContextTransferRspData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_context_transfer_rsp_data_t *OpenAPI_ue_context_transfer_rsp_data_parseFromJSON(cJSON *ue_context_transfer_rsp_dataJSON)
 {
     OpenAPI_ue_context_transfer_rsp_data_t *ue_context_transfer_rsp_data_local_var = NULL;
@@ -143,7 +191,6 @@ end:
 OpenAPI_ue_context_transfer_rsp_data_t *OpenAPI_ue_context_transfer_rsp_data_copy(OpenAPI_ue_context_transfer_rsp_data_t *dst, OpenAPI_ue_context_transfer_rsp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_context_transfer_rsp_data_convertToJSON(src);
@@ -152,21 +199,6 @@ OpenAPI_ue_context_transfer_rsp_data_t *OpenAPI_ue_context_transfer_rsp_data_cop
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_context_transfer_rsp_data_free(dst);
     dst = OpenAPI_ue_context_transfer_rsp_data_parseFromJSON(item);
     cJSON_Delete(item);
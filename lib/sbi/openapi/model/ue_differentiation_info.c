@@ -117,6 +117,77 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_differentiation_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_differentiation_info_t *ue_differentiation_info)
+{
+    if (ue_differentiation_info == NULL) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [UeDifferentiationInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [UeDifferentiationInfo]");
+        return false;
+    }
+    if (ue_differentiation_info->periodic_com_ind) {
+    if (OpenAPI_json_write_string(writer, "periodicComInd", OpenAPI_periodic_communication_indicator_ToString(ue_differentiation_info->periodic_com_ind)) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [periodic_com_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->is_periodic_time) {
+    if (OpenAPI_json_write_number(writer, "periodicTime", ue_differentiation_info->periodic_time) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [periodic_time]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->scheduled_com_time) {
+    if (OpenAPI_scheduled_communication_time_writeJSON(writer, "scheduledComTime", ue_differentiation_info->scheduled_com_time) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [scheduled_com_time]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->stationary_ind) {
+    if (OpenAPI_json_write_string(writer, "stationaryInd", OpenAPI_stationary_indication_ToString(ue_differentiation_info->stationary_ind)) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [stationary_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->traffic_profile) {
+    if (OpenAPI_json_write_string(writer, "trafficProfile", OpenAPI_traffic_profile_ToString(ue_differentiation_info->traffic_profile)) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [traffic_profile]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->battery_ind) {
+    if (OpenAPI_battery_indication_writeJSON(writer, "batteryInd", ue_differentiation_info->battery_ind) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [battery_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_differentiation_info->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", ue_differentiation_info->validity_time) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_differentiation_info_writeJSON() failed [UeDifferentiationInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_parseFromJSON(cJSON *ue_differentiation_infoJSON)
 {
     OpenAPI_ue_differentiation_info_t *ue_differentiation_info_local_var = NULL;
@@ -204,7 +275,6 @@ end:
 OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_copy(OpenAPI_ue_differentiation_info_t *dst, OpenAPI_ue_differentiation_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_differentiation_info_convertToJSON(src);
@@ -213,21 +283,6 @@ OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_differentiation_info_free(dst);
     dst = OpenAPI_ue_differentiation_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "battery_indication.h"
 #include "periodic_communication_indicator.h"
 #include "scheduled_communication_time.h"
@@ -47,6 +48,7 @@ OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_create(
 void OpenAPI_ue_differentiation_info_free(OpenAPI_ue_differentiation_info_t *ue_differentiation_info);
 OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_parseFromJSON(cJSON *ue_differentiation_infoJSON);
 cJSON *OpenAPI_ue_differentiation_info_convertToJSON(OpenAPI_ue_differentiation_info_t *ue_differentiation_info);
+bool OpenAPI_ue_differentiation_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_differentiation_info_t *ue_differentiation_info);
 OpenAPI_ue_differentiation_info_t *OpenAPI_ue_differentiation_info_copy(OpenAPI_ue_differentiation_info_t *dst, OpenAPI_ue_differentiation_info_t *src);
 
 #ifdef __cplusplus
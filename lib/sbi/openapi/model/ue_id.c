@@ -67,6 +67,52 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_id_t *ue_id)
+{
+    if (ue_id == NULL) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [UeId]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [UeId]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supi", ue_id->supi) == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (ue_id->gpsi_list) {
+    if (OpenAPI_json_write_array_start(writer, "gpsiList") == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *gpsi_list_node;
+    OpenAPI_list_for_each(ue_id->gpsi_list, gpsi_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)gpsi_list_node->data) == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [gpsi_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_id_writeJSON() failed [UeId]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_id_t *OpenAPI_ue_id_parseFromJSON(cJSON *ue_idJSON)
 {
     OpenAPI_ue_id_t *ue_id_local_var = NULL;
@@ -114,7 +160,6 @@ end:
 OpenAPI_ue_id_t *OpenAPI_ue_id_copy(OpenAPI_ue_id_t *dst, OpenAPI_ue_id_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_id_convertToJSON(src);
@@ -123,21 +168,6 @@ OpenAPI_ue_id_t *OpenAPI_ue_id_copy(OpenAPI_ue_id_t *dst, OpenAPI_ue_id_t *src)
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_id_free(dst);
     dst = OpenAPI_ue_id_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_ue_id_t *OpenAPI_ue_id_create(
 void OpenAPI_ue_id_free(OpenAPI_ue_id_t *ue_id);
 OpenAPI_ue_id_t *OpenAPI_ue_id_parseFromJSON(cJSON *ue_idJSON);
 cJSON *OpenAPI_ue_id_convertToJSON(OpenAPI_ue_id_t *ue_id);
+bool OpenAPI_ue_id_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_id_t *ue_id);
 OpenAPI_ue_id_t *OpenAPI_ue_id_copy(OpenAPI_ue_id_t *dst, OpenAPI_ue_id_t *src);
 
 #ifdef __cplusplus
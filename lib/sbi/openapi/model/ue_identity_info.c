@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_identity_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_identity_info_t *ue_identity_info)
+{
+    if (ue_identity_info == NULL) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [UeIdentityInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [UeIdentityInfo]");
+        return false;
+    }
+    if (ue_identity_info->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", ue_identity_info->gpsi) == false) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (ue_identity_info->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", ue_identity_info->pei) == false) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (ue_identity_info->supi) {
+    if (OpenAPI_json_write_string(writer, "supi", ue_identity_info->supi) == false) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [supi]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_identity_info_writeJSON() failed [UeIdentityInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_parseFromJSON(cJSON *ue_identity_infoJSON)
 {
     OpenAPI_ue_identity_info_t *ue_identity_info_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_copy(OpenAPI_ue_identity_info_t *dst, OpenAPI_ue_identity_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_identity_info_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_copy(OpenAPI_ue_identity_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_identity_info_free(dst);
     dst = OpenAPI_ue_identity_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_create(
 void OpenAPI_ue_identity_info_free(OpenAPI_ue_identity_info_t *ue_identity_info);
 OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_parseFromJSON(cJSON *ue_identity_infoJSON);
 cJSON *OpenAPI_ue_identity_info_convertToJSON(OpenAPI_ue_identity_info_t *ue_identity_info);
+bool OpenAPI_ue_identity_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_identity_info_t *ue_identity_info);
 OpenAPI_ue_identity_info_t *OpenAPI_ue_identity_info_copy(OpenAPI_ue_identity_info_t *dst, OpenAPI_ue_identity_info_t *src);
 
 #ifdef __cplusplus
@@ -105,6 +105,73 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_initiated_resource_request_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_initiated_resource_request_t *ue_initiated_resource_request)
+{
+    if (ue_initiated_resource_request == NULL) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [UeInitiatedResourceRequest]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [UeInitiatedResourceRequest]");
+        return false;
+    }
+    if (ue_initiated_resource_request->pcc_rule_id) {
+    if (OpenAPI_json_write_string(writer, "pccRuleId", ue_initiated_resource_request->pcc_rule_id) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [pcc_rule_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "ruleOp", OpenAPI_rule_operation_ToString(ue_initiated_resource_request->rule_op)) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [rule_op]");
+        goto end;
+    }
+
+    if (ue_initiated_resource_request->is_precedence) {
+    if (OpenAPI_json_write_number(writer, "precedence", ue_initiated_resource_request->precedence) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [precedence]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_array_start(writer, "packFiltInfo") == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [pack_filt_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *pack_filt_info_node;
+    if (ue_initiated_resource_request->pack_filt_info) {
+        OpenAPI_list_for_each(ue_initiated_resource_request->pack_filt_info, pack_filt_info_node) {
+            if (OpenAPI_packet_filter_info_writeJSON(writer, NULL, pack_filt_info_node->data) == false) {
+                ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [pack_filt_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [pack_filt_info]");
+        goto end;
+    }
+
+    if (ue_initiated_resource_request->req_qos) {
+    if (OpenAPI_requested_qos_writeJSON(writer, "reqQos", ue_initiated_resource_request->req_qos) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [req_qos]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_initiated_resource_request_writeJSON() failed [UeInitiatedResourceRequest]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_initiated_resource_request_t *OpenAPI_ue_initiated_resource_request_parseFromJSON(cJSON *ue_initiated_resource_requestJSON)
 {
     OpenAPI_ue_initiated_resource_request_t *ue_initiated_resource_request_local_var = NULL;
@@ -194,7 +261,6 @@ end:
 OpenAPI_ue_initiated_resource_request_t *OpenAPI_ue_initiated_resource_request_copy(OpenAPI_ue_initiated_resource_request_t *dst, OpenAPI_ue_initiated_resource_request_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_initiated_resource_request_convertToJSON(src);
@@ -203,21 +269,6 @@ OpenAPI_ue_initiated_resource_request_t *OpenAPI_ue_initiated_resource_request_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_initiated_resource_request_free(dst);
     dst = OpenAPI_ue_initiated_resource_request_parseFromJSON(item);
     cJSON_Delete(item);
@@ -111,6 +111,77 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_n1_n2_info_subscription_create_data_t *ue_n1_n2_info_subscription_create_data)
+{
+    if (ue_n1_n2_info_subscription_create_data == NULL) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [UeN1N2InfoSubscriptionCreateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [UeN1N2InfoSubscriptionCreateData]");
+        return false;
+    }
+    if (ue_n1_n2_info_subscription_create_data->n2_information_class) {
+    if (OpenAPI_json_write_string(writer, "n2InformationClass", OpenAPI_n2_information_class_ToString(ue_n1_n2_info_subscription_create_data->n2_information_class)) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [n2_information_class]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->n2_notify_callback_uri) {
+    if (OpenAPI_json_write_string(writer, "n2NotifyCallbackUri", ue_n1_n2_info_subscription_create_data->n2_notify_callback_uri) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [n2_notify_callback_uri]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->n1_message_class) {
+    if (OpenAPI_json_write_string(writer, "n1MessageClass", OpenAPI_n1_message_class_ToString(ue_n1_n2_info_subscription_create_data->n1_message_class)) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [n1_message_class]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->n1_notify_callback_uri) {
+    if (OpenAPI_json_write_string(writer, "n1NotifyCallbackUri", ue_n1_n2_info_subscription_create_data->n1_notify_callback_uri) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [n1_notify_callback_uri]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->nf_id) {
+    if (OpenAPI_json_write_string(writer, "nfId", ue_n1_n2_info_subscription_create_data->nf_id) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [nf_id]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_n1_n2_info_subscription_create_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (ue_n1_n2_info_subscription_create_data->old_guami) {
+    if (OpenAPI_guami_writeJSON(writer, "oldGuami", ue_n1_n2_info_subscription_create_data->old_guami) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [old_guami]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_create_data_writeJSON() failed [UeN1N2InfoSubscriptionCreateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_n1_n2_info_subscription_create_data_t *OpenAPI_ue_n1_n2_info_subscription_create_data_parseFromJSON(cJSON *ue_n1_n2_info_subscription_create_dataJSON)
 {
     OpenAPI_ue_n1_n2_info_subscription_create_data_t *ue_n1_n2_info_subscription_create_data_local_var = NULL;
@@ -197,7 +268,6 @@ end:
 OpenAPI_ue_n1_n2_info_subscription_create_data_t *OpenAPI_ue_n1_n2_info_subscription_create_data_copy(OpenAPI_ue_n1_n2_info_subscription_create_data_t *dst, OpenAPI_ue_n1_n2_info_subscription_create_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_n1_n2_info_subscription_create_data_convertToJSON(src);
@@ -206,21 +276,6 @@ OpenAPI_ue_n1_n2_info_subscription_create_data_t *OpenAPI_ue_n1_n2_info_subscrip
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_n1_n2_info_subscription_create_data_free(dst);
     dst = OpenAPI_ue_n1_n2_info_subscription_create_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -55,6 +55,40 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_n1_n2_info_subscription_created_data_t *ue_n1_n2_info_subscription_created_data)
+{
+    if (ue_n1_n2_info_subscription_created_data == NULL) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON() failed [UeN1N2InfoSubscriptionCreatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON() failed [UeN1N2InfoSubscriptionCreatedData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "n1n2NotifySubscriptionId", ue_n1_n2_info_subscription_created_data->n1n2_notify_subscription_id) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON() failed [n1n2_notify_subscription_id]");
+        goto end;
+    }
+
+    if (ue_n1_n2_info_subscription_created_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", ue_n1_n2_info_subscription_created_data->supported_features) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_n1_n2_info_subscription_created_data_writeJSON() failed [UeN1N2InfoSubscriptionCreatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_n1_n2_info_subscription_created_data_t *OpenAPI_ue_n1_n2_info_subscription_created_data_parseFromJSON(cJSON *ue_n1_n2_info_subscription_created_dataJSON)
 {
     OpenAPI_ue_n1_n2_info_subscription_created_data_t *ue_n1_n2_info_subscription_created_data_local_var = NULL;
@@ -91,7 +125,6 @@ end:
 OpenAPI_ue_n1_n2_info_subscription_created_data_t *OpenAPI_ue_n1_n2_info_subscription_created_data_copy(OpenAPI_ue_n1_n2_info_subscription_created_data_t *dst, OpenAPI_ue_n1_n2_info_subscription_created_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_n1_n2_info_subscription_created_data_convertToJSON(src);
@@ -100,21 +133,6 @@ OpenAPI_ue_n1_n2_info_subscription_created_data_t *OpenAPI_ue_n1_n2_info_subscri
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_n1_n2_info_subscription_created_data_free(dst);
     dst = OpenAPI_ue_n1_n2_info_subscription_created_data_parseFromJSON(item);
     cJSON_Delete(item);
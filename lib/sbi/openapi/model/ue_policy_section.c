@@ -52,6 +52,38 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_policy_section_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_policy_section_t *ue_policy_section)
+{
+    if (ue_policy_section == NULL) {
+        ogs_error("OpenAPI_ue_policy_section_writeJSON() failed [UePolicySection]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_policy_section_writeJSON() failed [UePolicySection]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "uePolicySectionInfo", ue_policy_section->ue_policy_section_info) == false) {
+        ogs_error("OpenAPI_ue_policy_section_writeJSON() failed [ue_policy_section_info]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "upsi", ue_policy_section->upsi) == false) {
+        ogs_error("OpenAPI_ue_policy_section_writeJSON() failed [upsi]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_section_writeJSON() failed [UePolicySection]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_parseFromJSON(cJSON *ue_policy_sectionJSON)
 {
     OpenAPI_ue_policy_section_t *ue_policy_section_local_var = NULL;
@@ -90,7 +122,6 @@ end:
 OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_copy(OpenAPI_ue_policy_section_t *dst, OpenAPI_ue_policy_section_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_policy_section_convertToJSON(src);
@@ -99,21 +130,6 @@ OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_copy(OpenAPI_ue_policy_se
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_policy_section_free(dst);
     dst = OpenAPI_ue_policy_section_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_create(
 void OpenAPI_ue_policy_section_free(OpenAPI_ue_policy_section_t *ue_policy_section);
 OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_parseFromJSON(cJSON *ue_policy_sectionJSON);
 cJSON *OpenAPI_ue_policy_section_convertToJSON(OpenAPI_ue_policy_section_t *ue_policy_section);
+bool OpenAPI_ue_policy_section_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_policy_section_t *ue_policy_section);
 OpenAPI_ue_policy_section_t *OpenAPI_ue_policy_section_copy(OpenAPI_ue_policy_section_t *dst, OpenAPI_ue_policy_section_t *src);
 
 #ifdef __cplusplus
@@ -230,6 +230,175 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_policy_set_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_policy_set_t *ue_policy_set)
+{
+    if (ue_policy_set == NULL) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [UePolicySet]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [UePolicySet]");
+        return false;
+    }
+    if (ue_policy_set->pra_infos) {
+    if (OpenAPI_json_write_object_start(writer, "praInfos") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pra_infos_node;
+    if (ue_policy_set->pra_infos) {
+        OpenAPI_list_for_each(ue_policy_set->pra_infos, pra_infos_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)pra_infos_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_presence_info_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [pra_infos]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [pra_infos]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->subsc_cats) {
+    if (OpenAPI_json_write_array_start(writer, "subscCats") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *subsc_cats_node;
+    OpenAPI_list_for_each(ue_policy_set->subsc_cats, subsc_cats_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)subsc_cats_node->data) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [subsc_cats]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->ue_policy_sections) {
+    if (OpenAPI_json_write_object_start(writer, "uePolicySections") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [ue_policy_sections]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ue_policy_sections_node;
+    if (ue_policy_set->ue_policy_sections) {
+        OpenAPI_list_for_each(ue_policy_set->ue_policy_sections, ue_policy_sections_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)ue_policy_sections_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_ue_policy_section_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [ue_policy_sections]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [ue_policy_sections]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->upsis) {
+    if (OpenAPI_json_write_array_start(writer, "upsis") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [upsis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *upsis_node;
+    OpenAPI_list_for_each(ue_policy_set->upsis, upsis_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)upsis_node->data) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [upsis]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [upsis]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->allowed_route_sel_descs) {
+    if (OpenAPI_json_write_object_start(writer, "allowedRouteSelDescs") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [allowed_route_sel_descs]");
+        goto end;
+    }
+    OpenAPI_lnode_t *allowed_route_sel_descs_node;
+    if (ue_policy_set->allowed_route_sel_descs) {
+        OpenAPI_list_for_each(ue_policy_set->allowed_route_sel_descs, allowed_route_sel_descs_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)allowed_route_sel_descs_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_plmn_route_selection_descriptor_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [allowed_route_sel_descs]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [allowed_route_sel_descs]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->is_andsp_ind) {
+    if (OpenAPI_json_write_bool(writer, "andspInd", ue_policy_set->andsp_ind) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [andsp_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", ue_policy_set->pei) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->os_ids) {
+    if (OpenAPI_json_write_array_start(writer, "osIds") == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [os_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *os_ids_node;
+    OpenAPI_list_for_each(ue_policy_set->os_ids, os_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)os_ids_node->data) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [os_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [os_ids]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", ue_policy_set->supp_feat) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_writeJSON() failed [UePolicySet]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_parseFromJSON(cJSON *ue_policy_setJSON)
 {
     OpenAPI_ue_policy_set_t *ue_policy_set_local_var = NULL;
@@ -419,7 +588,6 @@ end:
 OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_copy(OpenAPI_ue_policy_set_t *dst, OpenAPI_ue_policy_set_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_policy_set_convertToJSON(src);
@@ -428,21 +596,6 @@ OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_copy(OpenAPI_ue_policy_set_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_policy_set_free(dst);
     dst = OpenAPI_ue_policy_set_parseFromJSON(item);
     cJSON_Delete(item);
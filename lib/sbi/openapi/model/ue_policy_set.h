@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "plmn_route_selection_descriptor.h"
 #include "presence_info.h"
 #include "ue_policy_section.h"
@@ -49,6 +50,7 @@ OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_create(
 void OpenAPI_ue_policy_set_free(OpenAPI_ue_policy_set_t *ue_policy_set);
 OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_parseFromJSON(cJSON *ue_policy_setJSON);
 cJSON *OpenAPI_ue_policy_set_convertToJSON(OpenAPI_ue_policy_set_t *ue_policy_set);
+bool OpenAPI_ue_policy_set_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_policy_set_t *ue_policy_set);
 OpenAPI_ue_policy_set_t *OpenAPI_ue_policy_set_copy(OpenAPI_ue_policy_set_t *dst, OpenAPI_ue_policy_set_t *src);
 
 #ifdef __cplusplus
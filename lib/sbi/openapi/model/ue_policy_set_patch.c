@@ -134,6 +134,103 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_policy_set_patch_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_policy_set_patch_t *ue_policy_set_patch)
+{
+    if (ue_policy_set_patch == NULL) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [UePolicySetPatch]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [UePolicySetPatch]");
+        return false;
+    }
+    if (ue_policy_set_patch->ue_policy_sections) {
+    if (OpenAPI_json_write_object_start(writer, "uePolicySections") == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [ue_policy_sections]");
+        goto end;
+    }
+    OpenAPI_lnode_t *ue_policy_sections_node;
+    if (ue_policy_set_patch->ue_policy_sections) {
+        OpenAPI_list_for_each(ue_policy_set_patch->ue_policy_sections, ue_policy_sections_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)ue_policy_sections_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_ue_policy_section_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [ue_policy_sections]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [ue_policy_sections]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set_patch->upsis) {
+    if (OpenAPI_json_write_array_start(writer, "upsis") == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [upsis]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *upsis_node;
+    OpenAPI_list_for_each(ue_policy_set_patch->upsis, upsis_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)upsis_node->data) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [upsis]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [upsis]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set_patch->is_andsp_ind) {
+    if (OpenAPI_json_write_bool(writer, "andspInd", ue_policy_set_patch->andsp_ind) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [andsp_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set_patch->pei) {
+    if (OpenAPI_json_write_string(writer, "pei", ue_policy_set_patch->pei) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [pei]");
+        goto end;
+    }
+    }
+
+    if (ue_policy_set_patch->os_ids) {
+    if (OpenAPI_json_write_array_start(writer, "osIds") == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [os_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *os_ids_node;
+    OpenAPI_list_for_each(ue_policy_set_patch->os_ids, os_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)os_ids_node->data) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [os_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [os_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_policy_set_patch_writeJSON() failed [UePolicySetPatch]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_policy_set_patch_t *OpenAPI_ue_policy_set_patch_parseFromJSON(cJSON *ue_policy_set_patchJSON)
 {
     OpenAPI_ue_policy_set_patch_t *ue_policy_set_patch_local_var = NULL;
@@ -238,7 +335,6 @@ end:
 OpenAPI_ue_policy_set_patch_t *OpenAPI_ue_policy_set_patch_copy(OpenAPI_ue_policy_set_patch_t *dst, OpenAPI_ue_policy_set_patch_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_policy_set_patch_convertToJSON(src);
@@ -247,21 +343,6 @@ OpenAPI_ue_policy_set_patch_t *OpenAPI_ue_policy_set_patch_copy(OpenAPI_ue_polic
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_policy_set_patch_free(dst);
     dst = OpenAPI_ue_policy_set_patch_parseFromJSON(item);
     cJSON_Delete(item);
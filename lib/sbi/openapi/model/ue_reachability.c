@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_reachability_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_reachability_t *ue_reachability)
+{
+    if (ue_reachability == NULL) {
+        ogs_error("OpenAPI_ue_reachability_writeJSON() failed [UeReachability]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_reachability_writeJSON() failed [UeReachability]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_reachability_writeJSON() failed [UeReachability]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_parseFromJSON(cJSON *ue_reachabilityJSON)
 {
     OpenAPI_ue_reachability_t *ue_reachability_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_copy(OpenAPI_ue_reachability_t *dst, OpenAPI_ue_reachability_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_reachability_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_copy(OpenAPI_ue_reachability_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_reachability_free(dst);
     dst = OpenAPI_ue_reachability_parseFromJSON(item);
     cJSON_Delete(item);
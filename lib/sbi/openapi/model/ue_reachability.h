@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_reachability_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_create(
 void OpenAPI_ue_reachability_free(OpenAPI_ue_reachability_t *ue_reachability);
 OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_parseFromJSON(cJSON *ue_reachabilityJSON);
 cJSON *OpenAPI_ue_reachability_convertToJSON(OpenAPI_ue_reachability_t *ue_reachability);
+bool OpenAPI_ue_reachability_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_reachability_t *ue_reachability);
 OpenAPI_ue_reachability_t *OpenAPI_ue_reachability_copy(OpenAPI_ue_reachability_t *dst, OpenAPI_ue_reachability_t *src);
 
 #ifdef __cplusplus
@@ -103,6 +103,80 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_reg_status_update_req_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_reg_status_update_req_data_t *ue_reg_status_update_req_data)
+{
+    if (ue_reg_status_update_req_data == NULL) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [UeRegStatusUpdateReqData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [UeRegStatusUpdateReqData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "transferStatus", OpenAPI_ue_context_transfer_status_ToString(ue_reg_status_update_req_data->transfer_status)) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [transfer_status]");
+        goto end;
+    }
+
+    if (ue_reg_status_update_req_data->to_release_session_list) {
+    if (OpenAPI_json_write_array_start(writer, "toReleaseSessionList") == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *to_release_session_list_node;
+    OpenAPI_list_for_each(ue_reg_status_update_req_data->to_release_session_list, to_release_session_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)to_release_session_list_node->data) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [to_release_session_list]");
+        goto end;
+    }
+    }
+
+    if (ue_reg_status_update_req_data->is_pcf_reselected_ind) {
+    if (OpenAPI_json_write_bool(writer, "pcfReselectedInd", ue_reg_status_update_req_data->pcf_reselected_ind) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [pcf_reselected_ind]");
+        goto end;
+    }
+    }
+
+    if (ue_reg_status_update_req_data->smf_change_info_list) {
+    if (OpenAPI_json_write_array_start(writer, "smfChangeInfoList") == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [smf_change_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_change_info_list_node;
+    if (ue_reg_status_update_req_data->smf_change_info_list) {
+        OpenAPI_list_for_each(ue_reg_status_update_req_data->smf_change_info_list, smf_change_info_list_node) {
+            if (OpenAPI_smf_change_info_writeJSON(writer, NULL, smf_change_info_list_node->data) == false) {
+                ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [smf_change_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [smf_change_info_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_req_data_writeJSON() failed [UeRegStatusUpdateReqData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_reg_status_update_req_data_t *OpenAPI_ue_reg_status_update_req_data_parseFromJSON(cJSON *ue_reg_status_update_req_dataJSON)
 {
     OpenAPI_ue_reg_status_update_req_data_t *ue_reg_status_update_req_data_local_var = NULL;
@@ -193,7 +267,6 @@ end:
 OpenAPI_ue_reg_status_update_req_data_t *OpenAPI_ue_reg_status_update_req_data_copy(OpenAPI_ue_reg_status_update_req_data_t *dst, OpenAPI_ue_reg_status_update_req_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_reg_status_update_req_data_convertToJSON(src);
@@ -202,21 +275,6 @@ OpenAPI_ue_reg_status_update_req_data_t *OpenAPI_ue_reg_status_update_req_data_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_reg_status_update_req_data_free(dst);
     dst = OpenAPI_ue_reg_status_update_req_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -44,6 +44,33 @@ end:
     return item;
 }
 
+bool OpenAPI_ue_reg_status_update_rsp_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ue_reg_status_update_rsp_data_t *ue_reg_status_update_rsp_data)
+{
+    if (ue_reg_status_update_rsp_data == NULL) {
+        ogs_error("OpenAPI_ue_reg_status_update_rsp_data_writeJSON() failed [UeRegStatusUpdateRspData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_rsp_data_writeJSON() failed [UeRegStatusUpdateRspData]");
+        return false;
+    }
+    if (OpenAPI_json_write_bool(writer, "regStatusTransferComplete", ue_reg_status_update_rsp_data->reg_status_transfer_complete) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_rsp_data_writeJSON() failed [reg_status_transfer_complete]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ue_reg_status_update_rsp_data_writeJSON() failed [UeRegStatusUpdateRspData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ue_reg_status_update_rsp_data_t *OpenAPI_ue_reg_status_update_rsp_data_parseFromJSON(cJSON *ue_reg_status_update_rsp_dataJSON)
 {
     OpenAPI_ue_reg_status_update_rsp_data_t *ue_reg_status_update_rsp_data_local_var = NULL;
@@ -71,7 +98,6 @@ end:
 OpenAPI_ue_reg_status_update_rsp_data_t *OpenAPI_ue_reg_status_update_rsp_data_copy(OpenAPI_ue_reg_status_update_rsp_data_t *dst, OpenAPI_ue_reg_status_update_rsp_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ue_reg_status_update_rsp_data_convertToJSON(src);
@@ -80,21 +106,6 @@ OpenAPI_ue_reg_status_update_rsp_data_t *OpenAPI_ue_reg_status_update_rsp_data_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ue_reg_status_update_rsp_data_free(dst);
     dst = OpenAPI_ue_reg_status_update_rsp_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -47,6 +47,35 @@ end:
     return item;
 }
 
+bool OpenAPI_ulcl_bp_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_ulcl_bp_information_t *ulcl_bp_information)
+{
+    if (ulcl_bp_information == NULL) {
+        ogs_error("OpenAPI_ulcl_bp_information_writeJSON() failed [UlclBpInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_ulcl_bp_information_writeJSON() failed [UlclBpInformation]");
+        return false;
+    }
+    if (ulcl_bp_information->ulcl_bp_upf_id) {
+    if (OpenAPI_json_write_string(writer, "ulclBpUpfId", ulcl_bp_information->ulcl_bp_upf_id) == false) {
+        ogs_error("OpenAPI_ulcl_bp_information_writeJSON() failed [ulcl_bp_upf_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_ulcl_bp_information_writeJSON() failed [UlclBpInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_ulcl_bp_information_t *OpenAPI_ulcl_bp_information_parseFromJSON(cJSON *ulcl_bp_informationJSON)
 {
     OpenAPI_ulcl_bp_information_t *ulcl_bp_information_local_var = NULL;
@@ -71,7 +100,6 @@ end:
 OpenAPI_ulcl_bp_information_t *OpenAPI_ulcl_bp_information_copy(OpenAPI_ulcl_bp_information_t *dst, OpenAPI_ulcl_bp_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_ulcl_bp_information_convertToJSON(src);
@@ -80,21 +108,6 @@ OpenAPI_ulcl_bp_information_t *OpenAPI_ulcl_bp_information_copy(OpenAPI_ulcl_bp_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_ulcl_bp_information_free(dst);
     dst = OpenAPI_ulcl_bp_information_parseFromJSON(item);
     cJSON_Delete(item);
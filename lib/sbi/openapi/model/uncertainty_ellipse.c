@@ -58,6 +58,43 @@ end:
     return item;
 }
 
+bool OpenAPI_uncertainty_ellipse_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_uncertainty_ellipse_t *uncertainty_ellipse)
+{
+    if (uncertainty_ellipse == NULL) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [UncertaintyEllipse]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [UncertaintyEllipse]");
+        return false;
+    }
+    if (OpenAPI_json_write_number(writer, "semiMajor", uncertainty_ellipse->semi_major) == false) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [semi_major]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "semiMinor", uncertainty_ellipse->semi_minor) == false) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [semi_minor]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "orientationMajor", uncertainty_ellipse->orientation_major) == false) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [orientation_major]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_uncertainty_ellipse_writeJSON() failed [UncertaintyEllipse]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_uncertainty_ellipse_t *OpenAPI_uncertainty_ellipse_parseFromJSON(cJSON *uncertainty_ellipseJSON)
 {
     OpenAPI_uncertainty_ellipse_t *uncertainty_ellipse_local_var = NULL;
@@ -111,7 +148,6 @@ end:
 OpenAPI_uncertainty_ellipse_t *OpenAPI_uncertainty_ellipse_copy(OpenAPI_uncertainty_ellipse_t *dst, OpenAPI_uncertainty_ellipse_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_uncertainty_ellipse_convertToJSON(src);
@@ -120,21 +156,6 @@ OpenAPI_uncertainty_ellipse_t *OpenAPI_uncertainty_ellipse_copy(OpenAPI_uncertai
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_uncertainty_ellipse_free(dst);
     dst = OpenAPI_uncertainty_ellipse_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "default_unrelated_class.h"
 #include "external_unrelated_class.h"
 #include "service_type_unrelated_class.h"
@@ -35,6 +36,7 @@ OpenAPI_unrelated_class_t *OpenAPI_unrelated_class_create(
 void OpenAPI_unrelated_class_free(OpenAPI_unrelated_class_t *unrelated_class);
 OpenAPI_unrelated_class_t *OpenAPI_unrelated_class_parseFromJSON(cJSON *unrelated_classJSON);
 cJSON *OpenAPI_unrelated_class_convertToJSON(OpenAPI_unrelated_class_t *unrelated_class);
+bool OpenAPI_unrelated_class_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_unrelated_class_t *unrelated_class);
 OpenAPI_unrelated_class_t *OpenAPI_unrelated_class_copy(OpenAPI_unrelated_class_t *dst, OpenAPI_unrelated_class_t *src);
 
 #ifdef __cplusplus
@@ -93,6 +93,61 @@ end:
     return item;
 }
 
+bool OpenAPI_unrelated_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_unrelated_class_1_t *unrelated_class_1)
+{
+    if (unrelated_class_1 == NULL) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [UnrelatedClass_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [UnrelatedClass_1]");
+        return false;
+    }
+    if (OpenAPI_default_unrelated_class_1_writeJSON(writer, "defaultUnrelatedClass", unrelated_class_1->default_unrelated_class) == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [default_unrelated_class]");
+        goto end;
+    }
+
+    if (unrelated_class_1->external_unrelated_class) {
+    if (OpenAPI_external_unrelated_class_writeJSON(writer, "externalUnrelatedClass", unrelated_class_1->external_unrelated_class) == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [external_unrelated_class]");
+        goto end;
+    }
+    }
+
+    if (unrelated_class_1->service_type_unrelated_classes) {
+    if (OpenAPI_json_write_array_start(writer, "serviceTypeUnrelatedClasses") == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [service_type_unrelated_classes]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *service_type_unrelated_classes_node;
+    if (unrelated_class_1->service_type_unrelated_classes) {
+        OpenAPI_list_for_each(unrelated_class_1->service_type_unrelated_classes, service_type_unrelated_classes_node) {
+            if (OpenAPI_service_type_unrelated_class_1_writeJSON(writer, NULL, service_type_unrelated_classes_node->data) == false) {
+                ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [service_type_unrelated_classes]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [service_type_unrelated_classes]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_unrelated_class_1_writeJSON() failed [UnrelatedClass_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_parseFromJSON(cJSON *unrelated_class_1JSON)
 {
     OpenAPI_unrelated_class_1_t *unrelated_class_1_local_var = NULL;
@@ -155,7 +210,6 @@ end:
 OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_copy(OpenAPI_unrelated_class_1_t *dst, OpenAPI_unrelated_class_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_unrelated_class_1_convertToJSON(src);
@@ -164,21 +218,6 @@ OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_copy(OpenAPI_unrelated_cl
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_unrelated_class_1_free(dst);
     dst = OpenAPI_unrelated_class_1_parseFromJSON(item);
     cJSON_Delete(item);
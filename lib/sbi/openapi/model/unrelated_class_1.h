@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "default_unrelated_class_1.h"
 #include "external_unrelated_class.h"
 #include "service_type_unrelated_class_1.h"
@@ -35,6 +36,7 @@ OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_create(
 void OpenAPI_unrelated_class_1_free(OpenAPI_unrelated_class_1_t *unrelated_class_1);
 OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_parseFromJSON(cJSON *unrelated_class_1JSON);
 cJSON *OpenAPI_unrelated_class_1_convertToJSON(OpenAPI_unrelated_class_1_t *unrelated_class_1);
+bool OpenAPI_unrelated_class_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_unrelated_class_1_t *unrelated_class_1);
 OpenAPI_unrelated_class_1_t *OpenAPI_unrelated_class_1_copy(OpenAPI_unrelated_class_1_t *dst, OpenAPI_unrelated_class_1_t *src);
 
 #ifdef __cplusplus
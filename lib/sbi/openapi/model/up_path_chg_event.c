@@ -71,6 +71,50 @@ end:
     return item;
 }
 
+bool OpenAPI_up_path_chg_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_path_chg_event_t *up_path_chg_event)
+{
+    if (up_path_chg_event == NULL) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [UpPathChgEvent]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [UpPathChgEvent]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "notificationUri", up_path_chg_event->notification_uri) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [notification_uri]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "notifCorreId", up_path_chg_event->notif_corre_id) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [notif_corre_id]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "dnaiChgType", OpenAPI_dnai_change_type_ToString(up_path_chg_event->dnai_chg_type)) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [dnai_chg_type]");
+        goto end;
+    }
+
+    if (up_path_chg_event->is_af_ack_ind) {
+    if (OpenAPI_json_write_bool(writer, "afAckInd", up_path_chg_event->af_ack_ind) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [af_ack_ind]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_up_path_chg_event_writeJSON() failed [UpPathChgEvent]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_parseFromJSON(cJSON *up_path_chg_eventJSON)
 {
     OpenAPI_up_path_chg_event_t *up_path_chg_event_local_var = NULL;
@@ -134,7 +178,6 @@ end:
 OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_copy(OpenAPI_up_path_chg_event_t *dst, OpenAPI_up_path_chg_event_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_up_path_chg_event_convertToJSON(src);
@@ -143,21 +186,6 @@ OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_copy(OpenAPI_up_path_chg_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_up_path_chg_event_free(dst);
     dst = OpenAPI_up_path_chg_event_parseFromJSON(item);
     cJSON_Delete(item);
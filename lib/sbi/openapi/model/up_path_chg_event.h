@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "dnai_change_type.h"
 
 #ifdef __cplusplus
@@ -37,6 +38,7 @@ OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_create(
 void OpenAPI_up_path_chg_event_free(OpenAPI_up_path_chg_event_t *up_path_chg_event);
 OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_parseFromJSON(cJSON *up_path_chg_eventJSON);
 cJSON *OpenAPI_up_path_chg_event_convertToJSON(OpenAPI_up_path_chg_event_t *up_path_chg_event);
+bool OpenAPI_up_path_chg_event_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_path_chg_event_t *up_path_chg_event);
 OpenAPI_up_path_chg_event_t *OpenAPI_up_path_chg_event_copy(OpenAPI_up_path_chg_event_t *dst, OpenAPI_up_path_chg_event_t *src);
 
 #ifdef __cplusplus
@@ -51,6 +51,38 @@ end:
     return item;
 }
 
+bool OpenAPI_up_security_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_security_t *up_security)
+{
+    if (up_security == NULL) {
+        ogs_error("OpenAPI_up_security_writeJSON() failed [UpSecurity]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_up_security_writeJSON() failed [UpSecurity]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "upIntegr", OpenAPI_up_integrity_ToString(up_security->up_integr)) == false) {
+        ogs_error("OpenAPI_up_security_writeJSON() failed [up_integr]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "upConfid", OpenAPI_up_confidentiality_ToString(up_security->up_confid)) == false) {
+        ogs_error("OpenAPI_up_security_writeJSON() failed [up_confid]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_up_security_writeJSON() failed [UpSecurity]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_up_security_t *OpenAPI_up_security_parseFromJSON(cJSON *up_securityJSON)
 {
     OpenAPI_up_security_t *up_security_local_var = NULL;
@@ -93,7 +125,6 @@ end:
 OpenAPI_up_security_t *OpenAPI_up_security_copy(OpenAPI_up_security_t *dst, OpenAPI_up_security_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_up_security_convertToJSON(src);
@@ -102,21 +133,6 @@ OpenAPI_up_security_t *OpenAPI_up_security_copy(OpenAPI_up_security_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_up_security_free(dst);
     dst = OpenAPI_up_security_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "up_confidentiality.h"
 #include "up_integrity.h"
 
@@ -32,6 +33,7 @@ OpenAPI_up_security_t *OpenAPI_up_security_create(
 void OpenAPI_up_security_free(OpenAPI_up_security_t *up_security);
 OpenAPI_up_security_t *OpenAPI_up_security_parseFromJSON(cJSON *up_securityJSON);
 cJSON *OpenAPI_up_security_convertToJSON(OpenAPI_up_security_t *up_security);
+bool OpenAPI_up_security_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_security_t *up_security);
 OpenAPI_up_security_t *OpenAPI_up_security_copy(OpenAPI_up_security_t *dst, OpenAPI_up_security_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "up_confidentiality.h"
 #include "up_integrity.h"
 
@@ -32,6 +33,7 @@ OpenAPI_up_security_1_t *OpenAPI_up_security_1_create(
 void OpenAPI_up_security_1_free(OpenAPI_up_security_1_t *up_security_1);
 OpenAPI_up_security_1_t *OpenAPI_up_security_1_parseFromJSON(cJSON *up_security_1JSON);
 cJSON *OpenAPI_up_security_1_convertToJSON(OpenAPI_up_security_1_t *up_security_1);
+bool OpenAPI_up_security_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_security_1_t *up_security_1);
 OpenAPI_up_security_1_t *OpenAPI_up_security_1_copy(OpenAPI_up_security_1_t *dst, OpenAPI_up_security_1_t *src);
 
 #ifdef __cplusplus
@@ -85,6 +85,54 @@ end:
     return item;
 }
 
+bool OpenAPI_up_security_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_security_info_t *up_security_info)
+{
+    if (up_security_info == NULL) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [UpSecurityInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [UpSecurityInfo]");
+        return false;
+    }
+    if (OpenAPI_up_security_writeJSON(writer, "upSecurity", up_security_info->up_security) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [up_security]");
+        goto end;
+    }
+
+    if (up_security_info->max_integrity_protected_data_rate_ul) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateUl", OpenAPI_max_integrity_protected_data_rate_ToString(up_security_info->max_integrity_protected_data_rate_ul)) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [max_integrity_protected_data_rate_ul]");
+        goto end;
+    }
+    }
+
+    if (up_security_info->max_integrity_protected_data_rate_dl) {
+    if (OpenAPI_json_write_string(writer, "maxIntegrityProtectedDataRateDl", OpenAPI_max_integrity_protected_data_rate_ToString(up_security_info->max_integrity_protected_data_rate_dl)) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [max_integrity_protected_data_rate_dl]");
+        goto end;
+    }
+    }
+
+    if (up_security_info->security_result) {
+    if (OpenAPI_security_result_writeJSON(writer, "securityResult", up_security_info->security_result) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [security_result]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_up_security_info_writeJSON() failed [UpSecurityInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_up_security_info_t *OpenAPI_up_security_info_parseFromJSON(cJSON *up_security_infoJSON)
 {
     OpenAPI_up_security_info_t *up_security_info_local_var = NULL;
@@ -141,7 +189,6 @@ end:
 OpenAPI_up_security_info_t *OpenAPI_up_security_info_copy(OpenAPI_up_security_info_t *dst, OpenAPI_up_security_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_up_security_info_convertToJSON(src);
@@ -150,21 +197,6 @@ OpenAPI_up_security_info_t *OpenAPI_up_security_info_copy(OpenAPI_up_security_in
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_up_security_info_free(dst);
     dst = OpenAPI_up_security_info_parseFromJSON(item);
     cJSON_Delete(item);
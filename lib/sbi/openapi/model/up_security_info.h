@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "max_integrity_protected_data_rate.h"
 #include "security_result.h"
 #include "up_security.h"
@@ -37,6 +38,7 @@ OpenAPI_up_security_info_t *OpenAPI_up_security_info_create(
 void OpenAPI_up_security_info_free(OpenAPI_up_security_info_t *up_security_info);
 OpenAPI_up_security_info_t *OpenAPI_up_security_info_parseFromJSON(cJSON *up_security_infoJSON);
 cJSON *OpenAPI_up_security_info_convertToJSON(OpenAPI_up_security_info_t *up_security_info);
+bool OpenAPI_up_security_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_up_security_info_t *up_security_info);
 OpenAPI_up_security_info_t *OpenAPI_up_security_info_copy(OpenAPI_up_security_info_t *dst, OpenAPI_up_security_info_t *src);
 
 #ifdef __cplusplus
@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_updated_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_updated_item_t *updated_item)
+{
+    if (updated_item == NULL) {
+        ogs_error("OpenAPI_updated_item_writeJSON() failed [UpdatedItem]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_updated_item_writeJSON() failed [UpdatedItem]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "item", updated_item->item) == false) {
+        ogs_error("OpenAPI_updated_item_writeJSON() failed [item]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "value", updated_item->value) == false) {
+        ogs_error("OpenAPI_updated_item_writeJSON() failed [value]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_updated_item_writeJSON() failed [UpdatedItem]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_updated_item_t *OpenAPI_updated_item_parseFromJSON(cJSON *updated_itemJSON)
 {
     OpenAPI_updated_item_t *updated_item_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_updated_item_t *OpenAPI_updated_item_copy(OpenAPI_updated_item_t *dst, OpenAPI_updated_item_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_updated_item_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_updated_item_t *OpenAPI_updated_item_copy(OpenAPI_updated_item_t *dst, O
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_updated_item_free(dst);
     dst = OpenAPI_updated_item_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_updated_item_t *OpenAPI_updated_item_create(
 void OpenAPI_updated_item_free(OpenAPI_updated_item_t *updated_item);
 OpenAPI_updated_item_t *OpenAPI_updated_item_parseFromJSON(cJSON *updated_itemJSON);
 cJSON *OpenAPI_updated_item_convertToJSON(OpenAPI_updated_item_t *updated_item);
+bool OpenAPI_updated_item_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_updated_item_t *updated_item);
 OpenAPI_updated_item_t *OpenAPI_updated_item_copy(OpenAPI_updated_item_t *dst, OpenAPI_updated_item_t *src);
 
 #ifdef __cplusplus
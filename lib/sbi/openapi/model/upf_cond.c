@@ -115,6 +115,73 @@ end:
     return item;
 }
 
+bool OpenAPI_upf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upf_cond_t *upf_cond)
+{
+    if (upf_cond == NULL) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [UpfCond]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [UpfCond]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "conditionType", OpenAPI_condition_typeupf_cond_ToString(upf_cond->condition_type)) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [condition_type]");
+        goto end;
+    }
+
+    if (upf_cond->smf_serving_area) {
+    if (OpenAPI_json_write_array_start(writer, "smfServingArea") == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_serving_area_node;
+    OpenAPI_list_for_each(upf_cond->smf_serving_area, smf_serving_area_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)smf_serving_area_node->data) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+    }
+
+    if (upf_cond->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (upf_cond->tai_list) {
+        OpenAPI_list_for_each(upf_cond->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_upf_cond_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_upf_cond_writeJSON() failed [UpfCond]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_upf_cond_t *OpenAPI_upf_cond_parseFromJSON(cJSON *upf_condJSON)
 {
     OpenAPI_upf_cond_t *upf_cond_local_var = NULL;
@@ -194,7 +261,6 @@ end:
 OpenAPI_upf_cond_t *OpenAPI_upf_cond_copy(OpenAPI_upf_cond_t *dst, OpenAPI_upf_cond_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_upf_cond_convertToJSON(src);
@@ -203,21 +269,6 @@ OpenAPI_upf_cond_t *OpenAPI_upf_cond_copy(OpenAPI_upf_cond_t *dst, OpenAPI_upf_c
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_upf_cond_free(dst);
     dst = OpenAPI_upf_cond_parseFromJSON(item);
     cJSON_Delete(item);
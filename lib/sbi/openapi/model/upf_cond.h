@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "tai.h"
 
 #ifdef __cplusplus
@@ -38,6 +39,7 @@ OpenAPI_upf_cond_t *OpenAPI_upf_cond_create(
 void OpenAPI_upf_cond_free(OpenAPI_upf_cond_t *upf_cond);
 OpenAPI_upf_cond_t *OpenAPI_upf_cond_parseFromJSON(cJSON *upf_condJSON);
 cJSON *OpenAPI_upf_cond_convertToJSON(OpenAPI_upf_cond_t *upf_cond);
+bool OpenAPI_upf_cond_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upf_cond_t *upf_cond);
 OpenAPI_upf_cond_t *OpenAPI_upf_cond_copy(OpenAPI_upf_cond_t *dst, OpenAPI_upf_cond_t *src);
 
 #ifdef __cplusplus
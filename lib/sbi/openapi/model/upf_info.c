@@ -283,6 +283,196 @@ end:
     return item;
 }
 
+bool OpenAPI_upf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upf_info_t *upf_info)
+{
+    if (upf_info == NULL) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [UpfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [UpfInfo]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "sNssaiUpfInfoList") == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [s_nssai_upf_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *s_nssai_upf_info_list_node;
+    if (upf_info->s_nssai_upf_info_list) {
+        OpenAPI_list_for_each(upf_info->s_nssai_upf_info_list, s_nssai_upf_info_list_node) {
+            if (OpenAPI_snssai_upf_info_item_writeJSON(writer, NULL, s_nssai_upf_info_list_node->data) == false) {
+                ogs_error("OpenAPI_upf_info_writeJSON() failed [s_nssai_upf_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [s_nssai_upf_info_list]");
+        goto end;
+    }
+
+    if (upf_info->smf_serving_area) {
+    if (OpenAPI_json_write_array_start(writer, "smfServingArea") == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *smf_serving_area_node;
+    OpenAPI_list_for_each(upf_info->smf_serving_area, smf_serving_area_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)smf_serving_area_node->data) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [smf_serving_area]");
+        goto end;
+    }
+    }
+
+    if (upf_info->interface_upf_info_list) {
+    if (OpenAPI_json_write_array_start(writer, "interfaceUpfInfoList") == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [interface_upf_info_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *interface_upf_info_list_node;
+    if (upf_info->interface_upf_info_list) {
+        OpenAPI_list_for_each(upf_info->interface_upf_info_list, interface_upf_info_list_node) {
+            if (OpenAPI_interface_upf_info_item_writeJSON(writer, NULL, interface_upf_info_list_node->data) == false) {
+                ogs_error("OpenAPI_upf_info_writeJSON() failed [interface_upf_info_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [interface_upf_info_list]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_iwk_eps_ind) {
+    if (OpenAPI_json_write_bool(writer, "iwkEpsInd", upf_info->iwk_eps_ind) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [iwk_eps_ind]");
+        goto end;
+    }
+    }
+
+    if (upf_info->pdu_session_types) {
+    if (OpenAPI_json_write_array_start(writer, "pduSessionTypes") == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    OpenAPI_lnode_t *pdu_session_types_node;
+    OpenAPI_list_for_each(upf_info->pdu_session_types, pdu_session_types_node) {
+        if (OpenAPI_json_write_string(writer, NULL, OpenAPI_pdu_session_type_ToString((intptr_t)pdu_session_types_node->data)) == false) {
+            ogs_error("OpenAPI_upf_info_writeJSON() failed [pdu_session_types]");
+            goto end;
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    }
+
+    if (upf_info->atsss_capability) {
+    if (OpenAPI_atsss_capability_writeJSON(writer, "atsssCapability", upf_info->atsss_capability) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [atsss_capability]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_ue_ip_addr_ind) {
+    if (OpenAPI_json_write_bool(writer, "ueIpAddrInd", upf_info->ue_ip_addr_ind) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [ue_ip_addr_ind]");
+        goto end;
+    }
+    }
+
+    if (upf_info->tai_list) {
+    if (OpenAPI_json_write_array_start(writer, "taiList") == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *tai_list_node;
+    if (upf_info->tai_list) {
+        OpenAPI_list_for_each(upf_info->tai_list, tai_list_node) {
+            if (OpenAPI_tai_writeJSON(writer, NULL, tai_list_node->data) == false) {
+                ogs_error("OpenAPI_upf_info_writeJSON() failed [tai_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [tai_list]");
+        goto end;
+    }
+    }
+
+    if (upf_info->w_agf_info) {
+    if (OpenAPI_w_agf_info_writeJSON(writer, "wAgfInfo", upf_info->w_agf_info) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [w_agf_info]");
+        goto end;
+    }
+    }
+
+    if (upf_info->tngf_info) {
+    if (OpenAPI_tngf_info_writeJSON(writer, "tngfInfo", upf_info->tngf_info) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [tngf_info]");
+        goto end;
+    }
+    }
+
+    if (upf_info->twif_info) {
+    if (OpenAPI_twif_info_writeJSON(writer, "twifInfo", upf_info->twif_info) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [twif_info]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_priority) {
+    if (OpenAPI_json_write_number(writer, "priority", upf_info->priority) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [priority]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_redundant_gtpu) {
+    if (OpenAPI_json_write_bool(writer, "redundantGtpu", upf_info->redundant_gtpu) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [redundant_gtpu]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_ipups) {
+    if (OpenAPI_json_write_bool(writer, "ipups", upf_info->ipups) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [ipups]");
+        goto end;
+    }
+    }
+
+    if (upf_info->is_data_forwarding) {
+    if (OpenAPI_json_write_bool(writer, "dataForwarding", upf_info->data_forwarding) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [data_forwarding]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_upf_info_writeJSON() failed [UpfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_upf_info_t *OpenAPI_upf_info_parseFromJSON(cJSON *upf_infoJSON)
 {
     OpenAPI_upf_info_t *upf_info_local_var = NULL;
@@ -531,7 +721,6 @@ end:
 OpenAPI_upf_info_t *OpenAPI_upf_info_copy(OpenAPI_upf_info_t *dst, OpenAPI_upf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_upf_info_convertToJSON(src);
@@ -540,21 +729,6 @@ OpenAPI_upf_info_t *OpenAPI_upf_info_copy(OpenAPI_upf_info_t *dst, OpenAPI_upf_i
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_upf_info_free(dst);
     dst = OpenAPI_upf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "atsss_capability.h"
 #include "interface_upf_info_item.h"
 #include "pdu_session_type.h"
@@ -76,6 +77,7 @@ OpenAPI_upf_info_t *OpenAPI_upf_info_create(
 void OpenAPI_upf_info_free(OpenAPI_upf_info_t *upf_info);
 OpenAPI_upf_info_t *OpenAPI_upf_info_parseFromJSON(cJSON *upf_infoJSON);
 cJSON *OpenAPI_upf_info_convertToJSON(OpenAPI_upf_info_t *upf_info);
+bool OpenAPI_upf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upf_info_t *upf_info);
 OpenAPI_upf_info_t *OpenAPI_upf_info_copy(OpenAPI_upf_info_t *dst, OpenAPI_upf_info_t *src);
 
 #ifdef __cplusplus
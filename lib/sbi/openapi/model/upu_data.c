@@ -72,6 +72,52 @@ end:
     return item;
 }
 
+bool OpenAPI_upu_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_data_t *upu_data)
+{
+    if (upu_data == NULL) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [UpuData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [UpuData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "provisioningTime", upu_data->provisioning_time) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "ueUpdateStatus", OpenAPI_ue_update_status_ToString(upu_data->ue_update_status)) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [ue_update_status]");
+        goto end;
+    }
+
+    if (upu_data->upu_xmac_iue) {
+    if (OpenAPI_json_write_string(writer, "upuXmacIue", upu_data->upu_xmac_iue) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [upu_xmac_iue]");
+        goto end;
+    }
+    }
+
+    if (upu_data->upu_mac_iue) {
+    if (OpenAPI_json_write_string(writer, "upuMacIue", upu_data->upu_mac_iue) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [upu_mac_iue]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_upu_data_writeJSON() failed [UpuData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_upu_data_t *OpenAPI_upu_data_parseFromJSON(cJSON *upu_dataJSON)
 {
     OpenAPI_upu_data_t *upu_data_local_var = NULL;
@@ -132,7 +178,6 @@ end:
 OpenAPI_upu_data_t *OpenAPI_upu_data_copy(OpenAPI_upu_data_t *dst, OpenAPI_upu_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_upu_data_convertToJSON(src);
@@ -141,21 +186,6 @@ OpenAPI_upu_data_t *OpenAPI_upu_data_copy(OpenAPI_upu_data_t *dst, OpenAPI_upu_d
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_upu_data_free(dst);
     dst = OpenAPI_upu_data_parseFromJSON(item);
     cJSON_Delete(item);
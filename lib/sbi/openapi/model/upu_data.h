@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ue_update_status.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,7 @@ OpenAPI_upu_data_t *OpenAPI_upu_data_create(
 void OpenAPI_upu_data_free(OpenAPI_upu_data_t *upu_data);
 OpenAPI_upu_data_t *OpenAPI_upu_data_parseFromJSON(cJSON *upu_dataJSON);
 cJSON *OpenAPI_upu_data_convertToJSON(OpenAPI_upu_data_t *upu_data);
+bool OpenAPI_upu_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_data_t *upu_data);
 OpenAPI_upu_data_t *OpenAPI_upu_data_copy(OpenAPI_upu_data_t *dst, OpenAPI_upu_data_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_upu_data_1_t *OpenAPI_upu_data_1_create(
 void OpenAPI_upu_data_1_free(OpenAPI_upu_data_1_t *upu_data_1);
 OpenAPI_upu_data_1_t *OpenAPI_upu_data_1_parseFromJSON(cJSON *upu_data_1JSON);
 cJSON *OpenAPI_upu_data_1_convertToJSON(OpenAPI_upu_data_1_t *upu_data_1);
+bool OpenAPI_upu_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_data_1_t *upu_data_1);
 OpenAPI_upu_data_1_t *OpenAPI_upu_data_1_copy(OpenAPI_upu_data_1_t *dst, OpenAPI_upu_data_1_t *src);
 
 #ifdef __cplusplus
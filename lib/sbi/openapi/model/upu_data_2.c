@@ -83,6 +83,63 @@ end:
     return item;
 }
 
+bool OpenAPI_upu_data_2_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_data_2_t *upu_data_2)
+{
+    if (upu_data_2 == NULL) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [UpuData_2]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [UpuData_2]");
+        return false;
+    }
+    if (upu_data_2->sec_packet) {
+    if (OpenAPI_json_write_string(writer, "secPacket", upu_data_2->sec_packet) == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [sec_packet]");
+        goto end;
+    }
+    }
+
+    if (upu_data_2->default_conf_nssai) {
+    if (OpenAPI_json_write_array_start(writer, "defaultConfNssai") == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [default_conf_nssai]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *default_conf_nssai_node;
+    if (upu_data_2->default_conf_nssai) {
+        OpenAPI_list_for_each(upu_data_2->default_conf_nssai, default_conf_nssai_node) {
+            if (OpenAPI_snssai_writeJSON(writer, NULL, default_conf_nssai_node->data) == false) {
+                ogs_error("OpenAPI_upu_data_2_writeJSON() failed [default_conf_nssai]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [default_conf_nssai]");
+        goto end;
+    }
+    }
+
+    if (upu_data_2->routing_id) {
+    if (OpenAPI_json_write_string(writer, "routingId", upu_data_2->routing_id) == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [routing_id]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_upu_data_2_writeJSON() failed [UpuData_2]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_parseFromJSON(cJSON *upu_data_2JSON)
 {
     OpenAPI_upu_data_2_t *upu_data_2_local_var = NULL;
@@ -147,7 +204,6 @@ end:
 OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_copy(OpenAPI_upu_data_2_t *dst, OpenAPI_upu_data_2_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_upu_data_2_convertToJSON(src);
@@ -156,21 +212,6 @@ OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_copy(OpenAPI_upu_data_2_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_upu_data_2_free(dst);
     dst = OpenAPI_upu_data_2_parseFromJSON(item);
     cJSON_Delete(item);
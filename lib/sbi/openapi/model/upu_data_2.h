@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "snssai.h"
 
 #ifdef __cplusplus
@@ -33,6 +34,7 @@ OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_create(
 void OpenAPI_upu_data_2_free(OpenAPI_upu_data_2_t *upu_data_2);
 OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_parseFromJSON(cJSON *upu_data_2JSON);
 cJSON *OpenAPI_upu_data_2_convertToJSON(OpenAPI_upu_data_2_t *upu_data_2);
+bool OpenAPI_upu_data_2_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_data_2_t *upu_data_2);
 OpenAPI_upu_data_2_t *OpenAPI_upu_data_2_copy(OpenAPI_upu_data_2_t *dst, OpenAPI_upu_data_2_t *src);
 
 #ifdef __cplusplus
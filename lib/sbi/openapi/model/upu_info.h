@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "upu_data_1.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_upu_info_t *OpenAPI_upu_info_create(
 void OpenAPI_upu_info_free(OpenAPI_upu_info_t *upu_info);
 OpenAPI_upu_info_t *OpenAPI_upu_info_parseFromJSON(cJSON *upu_infoJSON);
 cJSON *OpenAPI_upu_info_convertToJSON(OpenAPI_upu_info_t *upu_info);
+bool OpenAPI_upu_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_info_t *upu_info);
 OpenAPI_upu_info_t *OpenAPI_upu_info_copy(OpenAPI_upu_info_t *dst, OpenAPI_upu_info_t *src);
 
 #ifdef __cplusplus
@@ -103,6 +103,76 @@ end:
     return item;
 }
 
+bool OpenAPI_upu_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_info_1_t *upu_info_1)
+{
+    if (upu_info_1 == NULL) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [UpuInfo_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [UpuInfo_1]");
+        return false;
+    }
+    if (OpenAPI_json_write_array_start(writer, "upuDataList") == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_data_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *upu_data_list_node;
+    if (upu_info_1->upu_data_list) {
+        OpenAPI_list_for_each(upu_info_1->upu_data_list, upu_data_list_node) {
+            if (OpenAPI_upu_data_2_writeJSON(writer, NULL, upu_data_list_node->data) == false) {
+                ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_data_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_data_list]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_bool(writer, "upuRegInd", upu_info_1->upu_reg_ind) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_reg_ind]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_bool(writer, "upuAckInd", upu_info_1->upu_ack_ind) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_ack_ind]");
+        goto end;
+    }
+
+    if (upu_info_1->upu_mac_iausf) {
+    if (OpenAPI_json_write_string(writer, "upuMacIausf", upu_info_1->upu_mac_iausf) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [upu_mac_iausf]");
+        goto end;
+    }
+    }
+
+    if (upu_info_1->counter_upu) {
+    if (OpenAPI_json_write_string(writer, "counterUpu", upu_info_1->counter_upu) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [counter_upu]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_string(writer, "provisioningTime", upu_info_1->provisioning_time) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [provisioning_time]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_upu_info_1_writeJSON() failed [UpuInfo_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_parseFromJSON(cJSON *upu_info_1JSON)
 {
     OpenAPI_upu_info_1_t *upu_info_1_local_var = NULL;
@@ -207,7 +277,6 @@ end:
 OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_copy(OpenAPI_upu_info_1_t *dst, OpenAPI_upu_info_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_upu_info_1_convertToJSON(src);
@@ -216,21 +285,6 @@ OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_copy(OpenAPI_upu_info_1_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_upu_info_1_free(dst);
     dst = OpenAPI_upu_info_1_parseFromJSON(item);
     cJSON_Delete(item);
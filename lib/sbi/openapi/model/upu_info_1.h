@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "upu_data_2.h"
 
 #ifdef __cplusplus
@@ -39,6 +40,7 @@ OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_create(
 void OpenAPI_upu_info_1_free(OpenAPI_upu_info_1_t *upu_info_1);
 OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_parseFromJSON(cJSON *upu_info_1JSON);
 cJSON *OpenAPI_upu_info_1_convertToJSON(OpenAPI_upu_info_1_t *upu_info_1);
+bool OpenAPI_upu_info_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_upu_info_1_t *upu_info_1);
 OpenAPI_upu_info_1_t *OpenAPI_upu_info_1_copy(OpenAPI_upu_info_1_t *dst, OpenAPI_upu_info_1_t *src);
 
 #ifdef __cplusplus
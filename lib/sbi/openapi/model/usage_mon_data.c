@@ -135,6 +135,84 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_mon_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_data_t *usage_mon_data)
+{
+    if (usage_mon_data == NULL) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [UsageMonData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [UsageMonData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "limitId", usage_mon_data->limit_id) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [limit_id]");
+        goto end;
+    }
+
+    if (usage_mon_data->scopes) {
+    if (OpenAPI_json_write_object_start(writer, "scopes") == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [scopes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *scopes_node;
+    if (usage_mon_data->scopes) {
+        OpenAPI_list_for_each(usage_mon_data->scopes, scopes_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)scopes_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_mon_data_scope_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [scopes]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [scopes]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data->um_level) {
+    if (OpenAPI_usage_mon_level_writeJSON(writer, "umLevel", usage_mon_data->um_level) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [um_level]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data->allowed_usage) {
+    if (OpenAPI_usage_threshold_writeJSON(writer, "allowedUsage", usage_mon_data->allowed_usage) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [allowed_usage]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data->reset_time) {
+    if (OpenAPI_time_period_writeJSON(writer, "resetTime", usage_mon_data->reset_time) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [reset_time]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data->supp_feat) {
+    if (OpenAPI_json_write_string(writer, "suppFeat", usage_mon_data->supp_feat) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [supp_feat]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_writeJSON() failed [UsageMonData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_parseFromJSON(cJSON *usage_mon_dataJSON)
 {
     OpenAPI_usage_mon_data_t *usage_mon_data_local_var = NULL;
@@ -222,7 +300,6 @@ end:
 OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_copy(OpenAPI_usage_mon_data_t *dst, OpenAPI_usage_mon_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_mon_data_convertToJSON(src);
@@ -231,21 +308,6 @@ OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_copy(OpenAPI_usage_mon_data_t *
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_mon_data_free(dst);
     dst = OpenAPI_usage_mon_data_parseFromJSON(item);
     cJSON_Delete(item);
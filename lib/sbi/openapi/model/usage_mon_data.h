@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "time_period.h"
 #include "usage_mon_data_scope.h"
 #include "usage_mon_level.h"
@@ -42,6 +43,7 @@ OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_create(
 void OpenAPI_usage_mon_data_free(OpenAPI_usage_mon_data_t *usage_mon_data);
 OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_parseFromJSON(cJSON *usage_mon_dataJSON);
 cJSON *OpenAPI_usage_mon_data_convertToJSON(OpenAPI_usage_mon_data_t *usage_mon_data);
+bool OpenAPI_usage_mon_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_data_t *usage_mon_data);
 OpenAPI_usage_mon_data_t *OpenAPI_usage_mon_data_copy(OpenAPI_usage_mon_data_t *dst, OpenAPI_usage_mon_data_t *src);
 
 #ifdef __cplusplus
@@ -139,6 +139,91 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_mon_data_limit_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_data_limit_t *usage_mon_data_limit)
+{
+    if (usage_mon_data_limit == NULL) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [UsageMonDataLimit]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [UsageMonDataLimit]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "limitId", usage_mon_data_limit->limit_id) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [limit_id]");
+        goto end;
+    }
+
+    if (usage_mon_data_limit->scopes) {
+    if (OpenAPI_json_write_object_start(writer, "scopes") == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [scopes]");
+        goto end;
+    }
+    OpenAPI_lnode_t *scopes_node;
+    if (usage_mon_data_limit->scopes) {
+        OpenAPI_list_for_each(usage_mon_data_limit->scopes, scopes_node) {
+            OpenAPI_map_t *localKeyValue = (OpenAPI_map_t*)scopes_node->data;
+        if ((localKeyValue->value ?
+            OpenAPI_usage_mon_data_scope_writeJSON(writer, localKeyValue->key, localKeyValue->value) :
+            OpenAPI_json_write_null(writer, localKeyValue->key)) == false) {
+            ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [scopes]");
+            goto end;
+        }
+            }
+        }
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [scopes]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data_limit->um_level) {
+    if (OpenAPI_usage_mon_level_writeJSON(writer, "umLevel", usage_mon_data_limit->um_level) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [um_level]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data_limit->start_date) {
+    if (OpenAPI_json_write_string(writer, "startDate", usage_mon_data_limit->start_date) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [start_date]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data_limit->end_date) {
+    if (OpenAPI_json_write_string(writer, "endDate", usage_mon_data_limit->end_date) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [end_date]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data_limit->usage_limit) {
+    if (OpenAPI_usage_threshold_writeJSON(writer, "usageLimit", usage_mon_data_limit->usage_limit) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [usage_limit]");
+        goto end;
+    }
+    }
+
+    if (usage_mon_data_limit->reset_period) {
+    if (OpenAPI_json_write_string(writer, "resetPeriod", usage_mon_data_limit->reset_period) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [reset_period]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_limit_writeJSON() failed [UsageMonDataLimit]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_mon_data_limit_t *OpenAPI_usage_mon_data_limit_parseFromJSON(cJSON *usage_mon_data_limitJSON)
 {
     OpenAPI_usage_mon_data_limit_t *usage_mon_data_limit_local_var = NULL;
@@ -238,7 +323,6 @@ end:
 OpenAPI_usage_mon_data_limit_t *OpenAPI_usage_mon_data_limit_copy(OpenAPI_usage_mon_data_limit_t *dst, OpenAPI_usage_mon_data_limit_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_mon_data_limit_convertToJSON(src);
@@ -247,21 +331,6 @@ OpenAPI_usage_mon_data_limit_t *OpenAPI_usage_mon_data_limit_copy(OpenAPI_usage_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_mon_data_limit_free(dst);
     dst = OpenAPI_usage_mon_data_limit_parseFromJSON(item);
     cJSON_Delete(item);
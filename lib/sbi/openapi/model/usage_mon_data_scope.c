@@ -73,6 +73,52 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_mon_data_scope_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_data_scope_t *usage_mon_data_scope)
+{
+    if (usage_mon_data_scope == NULL) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [UsageMonDataScope]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [UsageMonDataScope]");
+        return false;
+    }
+    if (OpenAPI_snssai_writeJSON(writer, "snssai", usage_mon_data_scope->snssai) == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [snssai]");
+        goto end;
+    }
+
+    if (usage_mon_data_scope->dnn) {
+    if (OpenAPI_json_write_array_start(writer, "dnn") == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [dnn]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnn_node;
+    OpenAPI_list_for_each(usage_mon_data_scope->dnn, dnn_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnn_node->data) == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [dnn]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_data_scope_writeJSON() failed [UsageMonDataScope]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_mon_data_scope_t *OpenAPI_usage_mon_data_scope_parseFromJSON(cJSON *usage_mon_data_scopeJSON)
 {
     OpenAPI_usage_mon_data_scope_t *usage_mon_data_scope_local_var = NULL;
@@ -118,7 +164,6 @@ end:
 OpenAPI_usage_mon_data_scope_t *OpenAPI_usage_mon_data_scope_copy(OpenAPI_usage_mon_data_scope_t *dst, OpenAPI_usage_mon_data_scope_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_mon_data_scope_convertToJSON(src);
@@ -127,21 +172,6 @@ OpenAPI_usage_mon_data_scope_t *OpenAPI_usage_mon_data_scope_copy(OpenAPI_usage_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_mon_data_scope_free(dst);
     dst = OpenAPI_usage_mon_data_scope_parseFromJSON(item);
     cJSON_Delete(item);
@@ -37,6 +37,29 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_mon_level_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_level_t *usage_mon_level)
+{
+    if (usage_mon_level == NULL) {
+        ogs_error("OpenAPI_usage_mon_level_writeJSON() failed [UsageMonLevel]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_mon_level_writeJSON() failed [UsageMonLevel]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_mon_level_writeJSON() failed [UsageMonLevel]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_parseFromJSON(cJSON *usage_mon_levelJSON)
 {
     OpenAPI_usage_mon_level_t *usage_mon_level_local_var = NULL;
@@ -51,7 +74,6 @@ end:
 OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_copy(OpenAPI_usage_mon_level_t *dst, OpenAPI_usage_mon_level_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_mon_level_convertToJSON(src);
@@ -60,21 +82,6 @@ OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_copy(OpenAPI_usage_mon_level_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_mon_level_free(dst);
     dst = OpenAPI_usage_mon_level_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "usage_mon_level_any_of.h"
 
 #ifdef __cplusplus
@@ -27,6 +28,7 @@ OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_create(
 void OpenAPI_usage_mon_level_free(OpenAPI_usage_mon_level_t *usage_mon_level);
 OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_parseFromJSON(cJSON *usage_mon_levelJSON);
 cJSON *OpenAPI_usage_mon_level_convertToJSON(OpenAPI_usage_mon_level_t *usage_mon_level);
+bool OpenAPI_usage_mon_level_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_mon_level_t *usage_mon_level);
 OpenAPI_usage_mon_level_t *OpenAPI_usage_mon_level_copy(OpenAPI_usage_mon_level_t *dst, OpenAPI_usage_mon_level_t *src);
 
 #ifdef __cplusplus
@@ -176,6 +176,122 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_monitoring_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_monitoring_data_t *usage_monitoring_data)
+{
+    if (usage_monitoring_data == NULL) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [UsageMonitoringData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [UsageMonitoringData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "umId", usage_monitoring_data->um_id) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [um_id]");
+        goto end;
+    }
+
+    if (usage_monitoring_data->is_volume_threshold) {
+    if (OpenAPI_json_write_number(writer, "volumeThreshold", usage_monitoring_data->volume_threshold) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [volume_threshold]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_volume_threshold_uplink) {
+    if (OpenAPI_json_write_number(writer, "volumeThresholdUplink", usage_monitoring_data->volume_threshold_uplink) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [volume_threshold_uplink]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_volume_threshold_downlink) {
+    if (OpenAPI_json_write_number(writer, "volumeThresholdDownlink", usage_monitoring_data->volume_threshold_downlink) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [volume_threshold_downlink]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_time_threshold) {
+    if (OpenAPI_json_write_number(writer, "timeThreshold", usage_monitoring_data->time_threshold) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [time_threshold]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->monitoring_time) {
+    if (OpenAPI_json_write_string(writer, "monitoringTime", usage_monitoring_data->monitoring_time) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [monitoring_time]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_next_vol_threshold) {
+    if (OpenAPI_json_write_number(writer, "nextVolThreshold", usage_monitoring_data->next_vol_threshold) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [next_vol_threshold]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_next_vol_threshold_uplink) {
+    if (OpenAPI_json_write_number(writer, "nextVolThresholdUplink", usage_monitoring_data->next_vol_threshold_uplink) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [next_vol_threshold_uplink]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_next_vol_threshold_downlink) {
+    if (OpenAPI_json_write_number(writer, "nextVolThresholdDownlink", usage_monitoring_data->next_vol_threshold_downlink) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [next_vol_threshold_downlink]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_next_time_threshold) {
+    if (OpenAPI_json_write_number(writer, "nextTimeThreshold", usage_monitoring_data->next_time_threshold) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [next_time_threshold]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->is_inactivity_time) {
+    if (OpenAPI_json_write_number(writer, "inactivityTime", usage_monitoring_data->inactivity_time) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [inactivity_time]");
+        goto end;
+    }
+    }
+
+    if (usage_monitoring_data->ex_usage_pcc_rule_ids) {
+    if (OpenAPI_json_write_array_start(writer, "exUsagePccRuleIds") == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [ex_usage_pcc_rule_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ex_usage_pcc_rule_ids_node;
+    OpenAPI_list_for_each(usage_monitoring_data->ex_usage_pcc_rule_ids, ex_usage_pcc_rule_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ex_usage_pcc_rule_ids_node->data) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [ex_usage_pcc_rule_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [ex_usage_pcc_rule_ids]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_monitoring_data_writeJSON() failed [UsageMonitoringData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_monitoring_data_t *OpenAPI_usage_monitoring_data_parseFromJSON(cJSON *usage_monitoring_dataJSON)
 {
     OpenAPI_usage_monitoring_data_t *usage_monitoring_data_local_var = NULL;
@@ -332,7 +448,6 @@ end:
 OpenAPI_usage_monitoring_data_t *OpenAPI_usage_monitoring_data_copy(OpenAPI_usage_monitoring_data_t *dst, OpenAPI_usage_monitoring_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_monitoring_data_convertToJSON(src);
@@ -341,21 +456,6 @@ OpenAPI_usage_monitoring_data_t *OpenAPI_usage_monitoring_data_copy(OpenAPI_usag
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_monitoring_data_free(dst);
     dst = OpenAPI_usage_monitoring_data_parseFromJSON(item);
     cJSON_Delete(item);
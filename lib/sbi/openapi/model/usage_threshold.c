@@ -81,6 +81,56 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_threshold_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_threshold_t *usage_threshold)
+{
+    if (usage_threshold == NULL) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [UsageThreshold]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [UsageThreshold]");
+        return false;
+    }
+    if (usage_threshold->is_duration) {
+    if (OpenAPI_json_write_number(writer, "duration", usage_threshold->duration) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [duration]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold->is_total_volume) {
+    if (OpenAPI_json_write_number(writer, "totalVolume", usage_threshold->total_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [total_volume]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold->is_downlink_volume) {
+    if (OpenAPI_json_write_number(writer, "downlinkVolume", usage_threshold->downlink_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [downlink_volume]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold->is_uplink_volume) {
+    if (OpenAPI_json_write_number(writer, "uplinkVolume", usage_threshold->uplink_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [uplink_volume]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_threshold_writeJSON() failed [UsageThreshold]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_parseFromJSON(cJSON *usage_thresholdJSON)
 {
     OpenAPI_usage_threshold_t *usage_threshold_local_var = NULL;
@@ -139,7 +189,6 @@ end:
 OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_copy(OpenAPI_usage_threshold_t *dst, OpenAPI_usage_threshold_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_threshold_convertToJSON(src);
@@ -148,21 +197,6 @@ OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_copy(OpenAPI_usage_threshold_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_threshold_free(dst);
     dst = OpenAPI_usage_threshold_parseFromJSON(item);
     cJSON_Delete(item);
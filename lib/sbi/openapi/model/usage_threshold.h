@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,7 @@ OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_create(
 void OpenAPI_usage_threshold_free(OpenAPI_usage_threshold_t *usage_threshold);
 OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_parseFromJSON(cJSON *usage_thresholdJSON);
 cJSON *OpenAPI_usage_threshold_convertToJSON(OpenAPI_usage_threshold_t *usage_threshold);
+bool OpenAPI_usage_threshold_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_threshold_t *usage_threshold);
 OpenAPI_usage_threshold_t *OpenAPI_usage_threshold_copy(OpenAPI_usage_threshold_t *dst, OpenAPI_usage_threshold_t *src);
 
 #ifdef __cplusplus
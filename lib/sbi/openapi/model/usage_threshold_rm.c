@@ -81,6 +81,56 @@ end:
     return item;
 }
 
+bool OpenAPI_usage_threshold_rm_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_usage_threshold_rm_t *usage_threshold_rm)
+{
+    if (usage_threshold_rm == NULL) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [UsageThresholdRm]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [UsageThresholdRm]");
+        return false;
+    }
+    if (usage_threshold_rm->is_duration) {
+    if (OpenAPI_json_write_number(writer, "duration", usage_threshold_rm->duration) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [duration]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold_rm->is_total_volume) {
+    if (OpenAPI_json_write_number(writer, "totalVolume", usage_threshold_rm->total_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [total_volume]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold_rm->is_downlink_volume) {
+    if (OpenAPI_json_write_number(writer, "downlinkVolume", usage_threshold_rm->downlink_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [downlink_volume]");
+        goto end;
+    }
+    }
+
+    if (usage_threshold_rm->is_uplink_volume) {
+    if (OpenAPI_json_write_number(writer, "uplinkVolume", usage_threshold_rm->uplink_volume) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [uplink_volume]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_usage_threshold_rm_writeJSON() failed [UsageThresholdRm]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_usage_threshold_rm_t *OpenAPI_usage_threshold_rm_parseFromJSON(cJSON *usage_threshold_rmJSON)
 {
     OpenAPI_usage_threshold_rm_t *usage_threshold_rm_local_var = NULL;
@@ -139,7 +189,6 @@ end:
 OpenAPI_usage_threshold_rm_t *OpenAPI_usage_threshold_rm_copy(OpenAPI_usage_threshold_rm_t *dst, OpenAPI_usage_threshold_rm_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_usage_threshold_rm_convertToJSON(src);
@@ -148,21 +197,6 @@ OpenAPI_usage_threshold_rm_t *OpenAPI_usage_threshold_rm_copy(OpenAPI_usage_thre
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_usage_threshold_rm_free(dst);
     dst = OpenAPI_usage_threshold_rm_parseFromJSON(item);
     cJSON_Delete(item);
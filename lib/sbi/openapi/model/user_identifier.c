@@ -65,6 +65,47 @@ end:
     return item;
 }
 
+bool OpenAPI_user_identifier_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_user_identifier_t *user_identifier)
+{
+    if (user_identifier == NULL) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [UserIdentifier]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [UserIdentifier]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "supi", user_identifier->supi) == false) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [supi]");
+        goto end;
+    }
+
+    if (user_identifier->gpsi) {
+    if (OpenAPI_json_write_string(writer, "gpsi", user_identifier->gpsi) == false) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [gpsi]");
+        goto end;
+    }
+    }
+
+    if (user_identifier->validity_time) {
+    if (OpenAPI_json_write_string(writer, "validityTime", user_identifier->validity_time) == false) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [validity_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_user_identifier_writeJSON() failed [UserIdentifier]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_user_identifier_t *OpenAPI_user_identifier_parseFromJSON(cJSON *user_identifierJSON)
 {
     OpenAPI_user_identifier_t *user_identifier_local_var = NULL;
@@ -111,7 +152,6 @@ end:
 OpenAPI_user_identifier_t *OpenAPI_user_identifier_copy(OpenAPI_user_identifier_t *dst, OpenAPI_user_identifier_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_user_identifier_convertToJSON(src);
@@ -120,21 +160,6 @@ OpenAPI_user_identifier_t *OpenAPI_user_identifier_copy(OpenAPI_user_identifier_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_user_identifier_free(dst);
     dst = OpenAPI_user_identifier_parseFromJSON(item);
     cJSON_Delete(item);
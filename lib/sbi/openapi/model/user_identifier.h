@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_user_identifier_t *OpenAPI_user_identifier_create(
 void OpenAPI_user_identifier_free(OpenAPI_user_identifier_t *user_identifier);
 OpenAPI_user_identifier_t *OpenAPI_user_identifier_parseFromJSON(cJSON *user_identifierJSON);
 cJSON *OpenAPI_user_identifier_convertToJSON(OpenAPI_user_identifier_t *user_identifier);
+bool OpenAPI_user_identifier_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_user_identifier_t *user_identifier);
 OpenAPI_user_identifier_t *OpenAPI_user_identifier_copy(OpenAPI_user_identifier_t *dst, OpenAPI_user_identifier_t *src);
 
 #ifdef __cplusplus
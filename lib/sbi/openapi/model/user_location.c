@@ -85,6 +85,49 @@ end:
     return item;
 }
 
+bool OpenAPI_user_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_user_location_t *user_location)
+{
+    if (user_location == NULL) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [UserLocation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [UserLocation]");
+        return false;
+    }
+    if (user_location->eutra_location) {
+    if (OpenAPI_eutra_location_writeJSON(writer, "eutraLocation", user_location->eutra_location) == false) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [eutra_location]");
+        goto end;
+    }
+    }
+
+    if (user_location->nr_location) {
+    if (OpenAPI_nr_location_writeJSON(writer, "nrLocation", user_location->nr_location) == false) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [nr_location]");
+        goto end;
+    }
+    }
+
+    if (user_location->n3ga_location) {
+    if (OpenAPI_n3ga_location_writeJSON(writer, "n3gaLocation", user_location->n3ga_location) == false) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [n3ga_location]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_user_location_writeJSON() failed [UserLocation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_user_location_t *OpenAPI_user_location_parseFromJSON(cJSON *user_locationJSON)
 {
     OpenAPI_user_location_t *user_location_local_var = NULL;
@@ -123,7 +166,6 @@ end:
 OpenAPI_user_location_t *OpenAPI_user_location_copy(OpenAPI_user_location_t *dst, OpenAPI_user_location_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_user_location_convertToJSON(src);
@@ -132,21 +174,6 @@ OpenAPI_user_location_t *OpenAPI_user_location_copy(OpenAPI_user_location_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_user_location_free(dst);
     dst = OpenAPI_user_location_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "eutra_location.h"
 #include "n3ga_location.h"
 #include "nr_location.h"
@@ -35,6 +36,7 @@ OpenAPI_user_location_t *OpenAPI_user_location_create(
 void OpenAPI_user_location_free(OpenAPI_user_location_t *user_location);
 OpenAPI_user_location_t *OpenAPI_user_location_parseFromJSON(cJSON *user_locationJSON);
 cJSON *OpenAPI_user_location_convertToJSON(OpenAPI_user_location_t *user_location);
+bool OpenAPI_user_location_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_user_location_t *user_location);
 OpenAPI_user_location_t *OpenAPI_user_location_copy(OpenAPI_user_location_t *dst, OpenAPI_user_location_t *src);
 
 #ifdef __cplusplus
@@ -105,6 +105,63 @@ end:
     return item;
 }
 
+bool OpenAPI_v2x_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_context_t *v2x_context)
+{
+    if (v2x_context == NULL) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [V2xContext]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [V2xContext]");
+        return false;
+    }
+    if (v2x_context->nr_v2x_services_auth) {
+    if (OpenAPI_nr_v2x_auth_writeJSON(writer, "nrV2xServicesAuth", v2x_context->nr_v2x_services_auth) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [nr_v2x_services_auth]");
+        goto end;
+    }
+    }
+
+    if (v2x_context->lte_v2x_services_auth) {
+    if (OpenAPI_lte_v2x_auth_writeJSON(writer, "lteV2xServicesAuth", v2x_context->lte_v2x_services_auth) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [lte_v2x_services_auth]");
+        goto end;
+    }
+    }
+
+    if (v2x_context->nr_ue_sidelink_ambr) {
+    if (OpenAPI_json_write_string(writer, "nrUeSidelinkAmbr", v2x_context->nr_ue_sidelink_ambr) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [nr_ue_sidelink_ambr]");
+        goto end;
+    }
+    }
+
+    if (v2x_context->lte_ue_sidelink_ambr) {
+    if (OpenAPI_json_write_string(writer, "lteUeSidelinkAmbr", v2x_context->lte_ue_sidelink_ambr) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [lte_ue_sidelink_ambr]");
+        goto end;
+    }
+    }
+
+    if (v2x_context->pc5_qo_s_para) {
+    if (OpenAPI_pc5_qo_s_para_writeJSON(writer, "Pc5QoSPara", v2x_context->pc5_qo_s_para) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [pc5_qo_s_para]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_v2x_context_writeJSON() failed [V2xContext]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_v2x_context_t *OpenAPI_v2x_context_parseFromJSON(cJSON *v2x_contextJSON)
 {
     OpenAPI_v2x_context_t *v2x_context_local_var = NULL;
@@ -163,7 +220,6 @@ end:
 OpenAPI_v2x_context_t *OpenAPI_v2x_context_copy(OpenAPI_v2x_context_t *dst, OpenAPI_v2x_context_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_v2x_context_convertToJSON(src);
@@ -172,21 +228,6 @@ OpenAPI_v2x_context_t *OpenAPI_v2x_context_copy(OpenAPI_v2x_context_t *dst, Open
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_v2x_context_free(dst);
     dst = OpenAPI_v2x_context_parseFromJSON(item);
     cJSON_Delete(item);
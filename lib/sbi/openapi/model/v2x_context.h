@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lte_v2x_auth.h"
 #include "nr_v2x_auth.h"
 #include "pc5_qo_s_para.h"
@@ -39,6 +40,7 @@ OpenAPI_v2x_context_t *OpenAPI_v2x_context_create(
 void OpenAPI_v2x_context_free(OpenAPI_v2x_context_t *v2x_context);
 OpenAPI_v2x_context_t *OpenAPI_v2x_context_parseFromJSON(cJSON *v2x_contextJSON);
 cJSON *OpenAPI_v2x_context_convertToJSON(OpenAPI_v2x_context_t *v2x_context);
+bool OpenAPI_v2x_context_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_context_t *v2x_context);
 OpenAPI_v2x_context_t *OpenAPI_v2x_context_copy(OpenAPI_v2x_context_t *dst, OpenAPI_v2x_context_t *src);
 
 #ifdef __cplusplus
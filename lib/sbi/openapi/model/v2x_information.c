@@ -53,6 +53,35 @@ end:
     return item;
 }
 
+bool OpenAPI_v2x_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_information_t *v2x_information)
+{
+    if (v2x_information == NULL) {
+        ogs_error("OpenAPI_v2x_information_writeJSON() failed [V2xInformation]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_v2x_information_writeJSON() failed [V2xInformation]");
+        return false;
+    }
+    if (v2x_information->n2_pc5_pol) {
+    if (OpenAPI_n2_info_content_writeJSON(writer, "n2Pc5Pol", v2x_information->n2_pc5_pol) == false) {
+        ogs_error("OpenAPI_v2x_information_writeJSON() failed [n2_pc5_pol]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_v2x_information_writeJSON() failed [V2xInformation]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_v2x_information_t *OpenAPI_v2x_information_parseFromJSON(cJSON *v2x_informationJSON)
 {
     OpenAPI_v2x_information_t *v2x_information_local_var = NULL;
@@ -75,7 +104,6 @@ end:
 OpenAPI_v2x_information_t *OpenAPI_v2x_information_copy(OpenAPI_v2x_information_t *dst, OpenAPI_v2x_information_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_v2x_information_convertToJSON(src);
@@ -84,21 +112,6 @@ OpenAPI_v2x_information_t *OpenAPI_v2x_information_copy(OpenAPI_v2x_information_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_v2x_information_free(dst);
     dst = OpenAPI_v2x_information_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "n2_info_content.h"
 
 #ifdef __cplusplus
@@ -29,6 +30,7 @@ OpenAPI_v2x_information_t *OpenAPI_v2x_information_create(
 void OpenAPI_v2x_information_free(OpenAPI_v2x_information_t *v2x_information);
 OpenAPI_v2x_information_t *OpenAPI_v2x_information_parseFromJSON(cJSON *v2x_informationJSON);
 cJSON *OpenAPI_v2x_information_convertToJSON(OpenAPI_v2x_information_t *v2x_information);
+bool OpenAPI_v2x_information_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_information_t *v2x_information);
 OpenAPI_v2x_information_t *OpenAPI_v2x_information_copy(OpenAPI_v2x_information_t *dst, OpenAPI_v2x_information_t *src);
 
 #ifdef __cplusplus
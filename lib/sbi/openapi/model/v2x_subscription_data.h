@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lte_v2x_auth.h"
 #include "nr_v2x_auth.h"
 
@@ -36,6 +37,7 @@ OpenAPI_v2x_subscription_data_t *OpenAPI_v2x_subscription_data_create(
 void OpenAPI_v2x_subscription_data_free(OpenAPI_v2x_subscription_data_t *v2x_subscription_data);
 OpenAPI_v2x_subscription_data_t *OpenAPI_v2x_subscription_data_parseFromJSON(cJSON *v2x_subscription_dataJSON);
 cJSON *OpenAPI_v2x_subscription_data_convertToJSON(OpenAPI_v2x_subscription_data_t *v2x_subscription_data);
+bool OpenAPI_v2x_subscription_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_subscription_data_t *v2x_subscription_data);
 OpenAPI_v2x_subscription_data_t *OpenAPI_v2x_subscription_data_copy(OpenAPI_v2x_subscription_data_t *dst, OpenAPI_v2x_subscription_data_t *src);
 
 #ifdef __cplusplus
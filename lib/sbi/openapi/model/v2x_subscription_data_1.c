@@ -89,6 +89,56 @@ end:
     return item;
 }
 
+bool OpenAPI_v2x_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_subscription_data_1_t *v2x_subscription_data_1)
+{
+    if (v2x_subscription_data_1 == NULL) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [V2xSubscriptionData_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [V2xSubscriptionData_1]");
+        return false;
+    }
+    if (v2x_subscription_data_1->nr_v2x_services_auth) {
+    if (OpenAPI_nr_v2x_auth_1_writeJSON(writer, "nrV2xServicesAuth", v2x_subscription_data_1->nr_v2x_services_auth) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [nr_v2x_services_auth]");
+        goto end;
+    }
+    }
+
+    if (v2x_subscription_data_1->lte_v2x_services_auth) {
+    if (OpenAPI_lte_v2x_auth_1_writeJSON(writer, "lteV2xServicesAuth", v2x_subscription_data_1->lte_v2x_services_auth) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [lte_v2x_services_auth]");
+        goto end;
+    }
+    }
+
+    if (v2x_subscription_data_1->nr_ue_pc5_ambr) {
+    if (OpenAPI_json_write_string(writer, "nrUePc5Ambr", v2x_subscription_data_1->nr_ue_pc5_ambr) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [nr_ue_pc5_ambr]");
+        goto end;
+    }
+    }
+
+    if (v2x_subscription_data_1->lte_pc5_ambr) {
+    if (OpenAPI_json_write_string(writer, "ltePc5Ambr", v2x_subscription_data_1->lte_pc5_ambr) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [lte_pc5_ambr]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_v2x_subscription_data_1_writeJSON() failed [V2xSubscriptionData_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_parseFromJSON(cJSON *v2x_subscription_data_1JSON)
 {
     OpenAPI_v2x_subscription_data_1_t *v2x_subscription_data_1_local_var = NULL;
@@ -139,7 +189,6 @@ end:
 OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_copy(OpenAPI_v2x_subscription_data_1_t *dst, OpenAPI_v2x_subscription_data_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_v2x_subscription_data_1_convertToJSON(src);
@@ -148,21 +197,6 @@ OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_v2x_subscription_data_1_free(dst);
     dst = OpenAPI_v2x_subscription_data_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "lte_v2x_auth_1.h"
 #include "nr_v2x_auth_1.h"
 
@@ -36,6 +37,7 @@ OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_create(
 void OpenAPI_v2x_subscription_data_1_free(OpenAPI_v2x_subscription_data_1_t *v2x_subscription_data_1);
 OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_parseFromJSON(cJSON *v2x_subscription_data_1JSON);
 cJSON *OpenAPI_v2x_subscription_data_1_convertToJSON(OpenAPI_v2x_subscription_data_1_t *v2x_subscription_data_1);
+bool OpenAPI_v2x_subscription_data_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_v2x_subscription_data_1_t *v2x_subscription_data_1);
 OpenAPI_v2x_subscription_data_1_t *OpenAPI_v2x_subscription_data_1_copy(OpenAPI_v2x_subscription_data_1_t *dst, OpenAPI_v2x_subscription_data_1_t *src);
 
 #ifdef __cplusplus
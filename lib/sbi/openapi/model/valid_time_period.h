@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ OpenAPI_valid_time_period_t *OpenAPI_valid_time_period_create(
 void OpenAPI_valid_time_period_free(OpenAPI_valid_time_period_t *valid_time_period);
 OpenAPI_valid_time_period_t *OpenAPI_valid_time_period_parseFromJSON(cJSON *valid_time_periodJSON);
 cJSON *OpenAPI_valid_time_period_convertToJSON(OpenAPI_valid_time_period_t *valid_time_period);
+bool OpenAPI_valid_time_period_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_valid_time_period_t *valid_time_period);
 OpenAPI_valid_time_period_t *OpenAPI_valid_time_period_copy(OpenAPI_valid_time_period_t *dst, OpenAPI_valid_time_period_t *src);
 
 #ifdef __cplusplus
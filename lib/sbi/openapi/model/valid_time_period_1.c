@@ -57,6 +57,42 @@ end:
     return item;
 }
 
+bool OpenAPI_valid_time_period_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_valid_time_period_1_t *valid_time_period_1)
+{
+    if (valid_time_period_1 == NULL) {
+        ogs_error("OpenAPI_valid_time_period_1_writeJSON() failed [ValidTimePeriod_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_valid_time_period_1_writeJSON() failed [ValidTimePeriod_1]");
+        return false;
+    }
+    if (valid_time_period_1->start_time) {
+    if (OpenAPI_json_write_string(writer, "startTime", valid_time_period_1->start_time) == false) {
+        ogs_error("OpenAPI_valid_time_period_1_writeJSON() failed [start_time]");
+        goto end;
+    }
+    }
+
+    if (valid_time_period_1->end_time) {
+    if (OpenAPI_json_write_string(writer, "endTime", valid_time_period_1->end_time) == false) {
+        ogs_error("OpenAPI_valid_time_period_1_writeJSON() failed [end_time]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_valid_time_period_1_writeJSON() failed [ValidTimePeriod_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_valid_time_period_1_t *OpenAPI_valid_time_period_1_parseFromJSON(cJSON *valid_time_period_1JSON)
 {
     OpenAPI_valid_time_period_1_t *valid_time_period_1_local_var = NULL;
@@ -91,7 +127,6 @@ end:
 OpenAPI_valid_time_period_1_t *OpenAPI_valid_time_period_1_copy(OpenAPI_valid_time_period_1_t *dst, OpenAPI_valid_time_period_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_valid_time_period_1_convertToJSON(src);
@@ -100,21 +135,6 @@ OpenAPI_valid_time_period_1_t *OpenAPI_valid_time_period_1_copy(OpenAPI_valid_ti
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_valid_time_period_1_free(dst);
     dst = OpenAPI_valid_time_period_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -53,6 +53,38 @@ end:
     return item;
 }
 
+bool OpenAPI_vendor_specific_feature_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vendor_specific_feature_t *vendor_specific_feature)
+{
+    if (vendor_specific_feature == NULL) {
+        ogs_error("OpenAPI_vendor_specific_feature_writeJSON() failed [VendorSpecificFeature]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vendor_specific_feature_writeJSON() failed [VendorSpecificFeature]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "featureName", vendor_specific_feature->feature_name) == false) {
+        ogs_error("OpenAPI_vendor_specific_feature_writeJSON() failed [feature_name]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "featureVersion", vendor_specific_feature->feature_version) == false) {
+        ogs_error("OpenAPI_vendor_specific_feature_writeJSON() failed [feature_version]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vendor_specific_feature_writeJSON() failed [VendorSpecificFeature]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vendor_specific_feature_t *OpenAPI_vendor_specific_feature_parseFromJSON(cJSON *vendor_specific_featureJSON)
 {
     OpenAPI_vendor_specific_feature_t *vendor_specific_feature_local_var = NULL;
@@ -91,7 +123,6 @@ end:
 OpenAPI_vendor_specific_feature_t *OpenAPI_vendor_specific_feature_copy(OpenAPI_vendor_specific_feature_t *dst, OpenAPI_vendor_specific_feature_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vendor_specific_feature_convertToJSON(src);
@@ -100,21 +131,6 @@ OpenAPI_vendor_specific_feature_t *OpenAPI_vendor_specific_feature_copy(OpenAPI_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vendor_specific_feature_free(dst);
     dst = OpenAPI_vendor_specific_feature_parseFromJSON(item);
     cJSON_Delete(item);
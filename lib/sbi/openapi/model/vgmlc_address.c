@@ -67,6 +67,49 @@ end:
     return item;
 }
 
+bool OpenAPI_vgmlc_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vgmlc_address_t *vgmlc_address)
+{
+    if (vgmlc_address == NULL) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [VgmlcAddress]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [VgmlcAddress]");
+        return false;
+    }
+    if (vgmlc_address->vgmlc_address_ipv4) {
+    if (OpenAPI_json_write_string(writer, "vgmlcAddressIpv4", vgmlc_address->vgmlc_address_ipv4) == false) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [vgmlc_address_ipv4]");
+        goto end;
+    }
+    }
+
+    if (vgmlc_address->vgmlc_address_ipv6) {
+    if (OpenAPI_json_write_string(writer, "vgmlcAddressIpv6", vgmlc_address->vgmlc_address_ipv6) == false) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [vgmlc_address_ipv6]");
+        goto end;
+    }
+    }
+
+    if (vgmlc_address->vgmlc_fqdn) {
+    if (OpenAPI_json_write_string(writer, "vgmlcFqdn", vgmlc_address->vgmlc_fqdn) == false) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [vgmlc_fqdn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vgmlc_address_writeJSON() failed [VgmlcAddress]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_parseFromJSON(cJSON *vgmlc_addressJSON)
 {
     OpenAPI_vgmlc_address_t *vgmlc_address_local_var = NULL;
@@ -111,7 +154,6 @@ end:
 OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_copy(OpenAPI_vgmlc_address_t *dst, OpenAPI_vgmlc_address_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vgmlc_address_convertToJSON(src);
@@ -120,21 +162,6 @@ OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_copy(OpenAPI_vgmlc_address_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vgmlc_address_free(dst);
     dst = OpenAPI_vgmlc_address_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_create(
 void OpenAPI_vgmlc_address_free(OpenAPI_vgmlc_address_t *vgmlc_address);
 OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_parseFromJSON(cJSON *vgmlc_addressJSON);
 cJSON *OpenAPI_vgmlc_address_convertToJSON(OpenAPI_vgmlc_address_t *vgmlc_address);
+bool OpenAPI_vgmlc_address_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vgmlc_address_t *vgmlc_address);
 OpenAPI_vgmlc_address_t *OpenAPI_vgmlc_address_copy(OpenAPI_vgmlc_address_t *dst, OpenAPI_vgmlc_address_t *src);
 
 #ifdef __cplusplus
@@ -105,6 +105,70 @@ end:
     return item;
 }
 
+bool OpenAPI_vn_group_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vn_group_data_t *vn_group_data)
+{
+    if (vn_group_data == NULL) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [VnGroupData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [VnGroupData]");
+        return false;
+    }
+    if (vn_group_data->pdu_session_types) {
+    if (OpenAPI_pdu_session_types_1_writeJSON(writer, "pduSessionTypes", vn_group_data->pdu_session_types) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [pdu_session_types]");
+        goto end;
+    }
+    }
+
+    if (vn_group_data->dnn) {
+    if (OpenAPI_json_write_string(writer, "dnn", vn_group_data->dnn) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [dnn]");
+        goto end;
+    }
+    }
+
+    if (vn_group_data->single_nssai) {
+    if (OpenAPI_snssai_writeJSON(writer, "singleNssai", vn_group_data->single_nssai) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [single_nssai]");
+        goto end;
+    }
+    }
+
+    if (vn_group_data->app_descriptors) {
+    if (OpenAPI_json_write_array_start(writer, "appDescriptors") == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [app_descriptors]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *app_descriptors_node;
+    if (vn_group_data->app_descriptors) {
+        OpenAPI_list_for_each(vn_group_data->app_descriptors, app_descriptors_node) {
+            if (OpenAPI_app_descriptor_writeJSON(writer, NULL, app_descriptors_node->data) == false) {
+                ogs_error("OpenAPI_vn_group_data_writeJSON() failed [app_descriptors]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [app_descriptors]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vn_group_data_writeJSON() failed [VnGroupData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_parseFromJSON(cJSON *vn_group_dataJSON)
 {
     OpenAPI_vn_group_data_t *vn_group_data_local_var = NULL;
@@ -175,7 +239,6 @@ end:
 OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_copy(OpenAPI_vn_group_data_t *dst, OpenAPI_vn_group_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vn_group_data_convertToJSON(src);
@@ -184,21 +247,6 @@ OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_copy(OpenAPI_vn_group_data_t *dst
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vn_group_data_free(dst);
     dst = OpenAPI_vn_group_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "app_descriptor.h"
 #include "pdu_session_types_1.h"
 #include "snssai.h"
@@ -37,6 +38,7 @@ OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_create(
 void OpenAPI_vn_group_data_free(OpenAPI_vn_group_data_t *vn_group_data);
 OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_parseFromJSON(cJSON *vn_group_dataJSON);
 cJSON *OpenAPI_vn_group_data_convertToJSON(OpenAPI_vn_group_data_t *vn_group_data);
+bool OpenAPI_vn_group_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vn_group_data_t *vn_group_data);
 OpenAPI_vn_group_data_t *OpenAPI_vn_group_data_copy(OpenAPI_vn_group_data_t *dst, OpenAPI_vn_group_data_t *src);
 
 #ifdef __cplusplus
@@ -67,6 +67,48 @@ end:
     return item;
 }
 
+bool OpenAPI_volume_timed_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_volume_timed_report_t *volume_timed_report)
+{
+    if (volume_timed_report == NULL) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [VolumeTimedReport]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [VolumeTimedReport]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "startTimeStamp", volume_timed_report->start_time_stamp) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [start_time_stamp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_string(writer, "endTimeStamp", volume_timed_report->end_time_stamp) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [end_time_stamp]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "downlinkVolume", volume_timed_report->downlink_volume) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [downlink_volume]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_number(writer, "uplinkVolume", volume_timed_report->uplink_volume) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [uplink_volume]");
+        goto end;
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_volume_timed_report_writeJSON() failed [VolumeTimedReport]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_parseFromJSON(cJSON *volume_timed_reportJSON)
 {
     OpenAPI_volume_timed_report_t *volume_timed_report_local_var = NULL;
@@ -131,7 +173,6 @@ end:
 OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_copy(OpenAPI_volume_timed_report_t *dst, OpenAPI_volume_timed_report_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_volume_timed_report_convertToJSON(src);
@@ -140,21 +181,6 @@ OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_copy(OpenAPI_volume_t
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_volume_timed_report_free(dst);
     dst = OpenAPI_volume_timed_report_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_create(
 void OpenAPI_volume_timed_report_free(OpenAPI_volume_timed_report_t *volume_timed_report);
 OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_parseFromJSON(cJSON *volume_timed_reportJSON);
 cJSON *OpenAPI_volume_timed_report_convertToJSON(OpenAPI_volume_timed_report_t *volume_timed_report);
+bool OpenAPI_volume_timed_report_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_volume_timed_report_t *volume_timed_report);
 OpenAPI_volume_timed_report_t *OpenAPI_volume_timed_report_copy(OpenAPI_volume_timed_report_t *dst, OpenAPI_volume_timed_report_t *src);
 
 #ifdef __cplusplus
@@ -120,6 +120,77 @@ end:
     return item;
 }
 
+bool OpenAPI_vplmn_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vplmn_qos_t *vplmn_qos)
+{
+    if (vplmn_qos == NULL) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [VplmnQos]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [VplmnQos]");
+        return false;
+    }
+    if (vplmn_qos->is__5qi) {
+    if (OpenAPI_json_write_number(writer, "5qi", vplmn_qos->_5qi) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [_5qi]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->arp) {
+    if (OpenAPI_arp_writeJSON(writer, "arp", vplmn_qos->arp) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [arp]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->session_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "sessionAmbr", vplmn_qos->session_ambr) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->max_fbr_dl) {
+    if (OpenAPI_json_write_string(writer, "maxFbrDl", vplmn_qos->max_fbr_dl) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [max_fbr_dl]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->max_fbr_ul) {
+    if (OpenAPI_json_write_string(writer, "maxFbrUl", vplmn_qos->max_fbr_ul) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [max_fbr_ul]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->gua_fbr_dl) {
+    if (OpenAPI_json_write_string(writer, "guaFbrDl", vplmn_qos->gua_fbr_dl) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [gua_fbr_dl]");
+        goto end;
+    }
+    }
+
+    if (vplmn_qos->gua_fbr_ul) {
+    if (OpenAPI_json_write_string(writer, "guaFbrUl", vplmn_qos->gua_fbr_ul) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [gua_fbr_ul]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vplmn_qos_writeJSON() failed [VplmnQos]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_parseFromJSON(cJSON *vplmn_qosJSON)
 {
     OpenAPI_vplmn_qos_t *vplmn_qos_local_var = NULL;
@@ -201,7 +272,6 @@ end:
 OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_copy(OpenAPI_vplmn_qos_t *dst, OpenAPI_vplmn_qos_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vplmn_qos_convertToJSON(src);
@@ -210,21 +280,6 @@ OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_copy(OpenAPI_vplmn_qos_t *dst, OpenAPI_vp
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vplmn_qos_free(dst);
     dst = OpenAPI_vplmn_qos_parseFromJSON(item);
     cJSON_Delete(item);
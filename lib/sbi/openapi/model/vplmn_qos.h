@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "arp.h"
 
@@ -44,6 +45,7 @@ OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_create(
 void OpenAPI_vplmn_qos_free(OpenAPI_vplmn_qos_t *vplmn_qos);
 OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_parseFromJSON(cJSON *vplmn_qosJSON);
 cJSON *OpenAPI_vplmn_qos_convertToJSON(OpenAPI_vplmn_qos_t *vplmn_qos);
+bool OpenAPI_vplmn_qos_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vplmn_qos_t *vplmn_qos);
 OpenAPI_vplmn_qos_t *OpenAPI_vplmn_qos_copy(OpenAPI_vplmn_qos_t *dst, OpenAPI_vplmn_qos_t *src);
 
 #ifdef __cplusplus
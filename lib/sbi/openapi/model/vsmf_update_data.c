@@ -433,6 +433,295 @@ end:
     return item;
 }
 
+bool OpenAPI_vsmf_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_update_data_t *vsmf_update_data)
+{
+    if (vsmf_update_data == NULL) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [VsmfUpdateData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [VsmfUpdateData]");
+        return false;
+    }
+    if (OpenAPI_json_write_string(writer, "requestIndication", OpenAPI_request_indication_ToString(vsmf_update_data->request_indication)) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [request_indication]");
+        goto end;
+    }
+
+    if (vsmf_update_data->session_ambr) {
+    if (OpenAPI_ambr_writeJSON(writer, "sessionAmbr", vsmf_update_data->session_ambr) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [session_ambr]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->qos_flows_add_mod_request_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsAddModRequestList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_add_mod_request_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_add_mod_request_list_node;
+    if (vsmf_update_data->qos_flows_add_mod_request_list) {
+        OpenAPI_list_for_each(vsmf_update_data->qos_flows_add_mod_request_list, qos_flows_add_mod_request_list_node) {
+            if (OpenAPI_qos_flow_add_modify_request_item_writeJSON(writer, NULL, qos_flows_add_mod_request_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_add_mod_request_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_add_mod_request_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->qos_flows_rel_request_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsRelRequestList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_rel_request_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_rel_request_list_node;
+    if (vsmf_update_data->qos_flows_rel_request_list) {
+        OpenAPI_list_for_each(vsmf_update_data->qos_flows_rel_request_list, qos_flows_rel_request_list_node) {
+            if (OpenAPI_qos_flow_release_request_item_writeJSON(writer, NULL, qos_flows_rel_request_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_rel_request_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_flows_rel_request_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->eps_bearer_info) {
+    if (OpenAPI_json_write_array_start(writer, "epsBearerInfo") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *eps_bearer_info_node;
+    if (vsmf_update_data->eps_bearer_info) {
+        OpenAPI_list_for_each(vsmf_update_data->eps_bearer_info, eps_bearer_info_node) {
+            if (OpenAPI_eps_bearer_info_writeJSON(writer, NULL, eps_bearer_info_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [eps_bearer_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [eps_bearer_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->assign_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "assignEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [assign_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *assign_ebi_list_node;
+    if (vsmf_update_data->assign_ebi_list) {
+        OpenAPI_list_for_each(vsmf_update_data->assign_ebi_list, assign_ebi_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, assign_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [assign_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [assign_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->revoke_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "revokeEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *revoke_ebi_list_node;
+    OpenAPI_list_for_each(vsmf_update_data->revoke_ebi_list, revoke_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)revoke_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [revoke_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->modified_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "modifiedEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [modified_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *modified_ebi_list_node;
+    if (vsmf_update_data->modified_ebi_list) {
+        OpenAPI_list_for_each(vsmf_update_data->modified_ebi_list, modified_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, modified_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [modified_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [modified_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->is_pti) {
+    if (OpenAPI_json_write_number(writer, "pti", vsmf_update_data->pti) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [pti]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->n1_sm_info_to_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoToUe", vsmf_update_data->n1_sm_info_to_ue) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [n1_sm_info_to_ue]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->is_always_on_granted) {
+    if (OpenAPI_json_write_bool(writer, "alwaysOnGranted", vsmf_update_data->always_on_granted) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [always_on_granted]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->hsmf_pdu_session_uri) {
+    if (OpenAPI_json_write_string(writer, "hsmfPduSessionUri", vsmf_update_data->hsmf_pdu_session_uri) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [hsmf_pdu_session_uri]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->supported_features) {
+    if (OpenAPI_json_write_string(writer, "supportedFeatures", vsmf_update_data->supported_features) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [supported_features]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->cause) {
+    if (OpenAPI_json_write_string(writer, "cause", OpenAPI_cause_ToString(vsmf_update_data->cause)) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [cause]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->n1sm_cause) {
+    if (OpenAPI_json_write_string(writer, "n1smCause", vsmf_update_data->n1sm_cause) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [n1sm_cause]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->is_back_off_timer) {
+    if (OpenAPI_json_write_number(writer, "backOffTimer", vsmf_update_data->back_off_timer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [back_off_timer]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->ma_release_ind) {
+    if (OpenAPI_json_write_string(writer, "maReleaseInd", OpenAPI_ma_release_indication_ToString(vsmf_update_data->ma_release_ind)) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [ma_release_ind]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->is_ma_accepted_ind) {
+    if (OpenAPI_json_write_bool(writer, "maAcceptedInd", vsmf_update_data->ma_accepted_ind) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [ma_accepted_ind]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->additional_cn_tunnel_info) {
+    if (OpenAPI_tunnel_info_writeJSON(writer, "additionalCnTunnelInfo", vsmf_update_data->additional_cn_tunnel_info) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [additional_cn_tunnel_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->dnai_list) {
+    if (OpenAPI_json_write_array_start(writer, "dnaiList") == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *dnai_list_node;
+    OpenAPI_list_for_each(vsmf_update_data->dnai_list, dnai_list_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)dnai_list_node->data) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [dnai_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", vsmf_update_data->n4_info) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", vsmf_update_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", vsmf_update_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->is_small_data_rate_control_enabled) {
+    if (OpenAPI_json_write_bool(writer, "smallDataRateControlEnabled", vsmf_update_data->small_data_rate_control_enabled) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [small_data_rate_control_enabled]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_data->qos_monitoring_info) {
+    if (OpenAPI_qos_monitoring_info_writeJSON(writer, "qosMonitoringInfo", vsmf_update_data->qos_monitoring_info) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [qos_monitoring_info]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_data_writeJSON() failed [VsmfUpdateData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_parseFromJSON(cJSON *vsmf_update_dataJSON)
 {
     OpenAPI_vsmf_update_data_t *vsmf_update_data_local_var = NULL;
@@ -818,7 +1107,6 @@ end:
 OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_copy(OpenAPI_vsmf_update_data_t *dst, OpenAPI_vsmf_update_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vsmf_update_data_convertToJSON(src);
@@ -827,21 +1115,6 @@ OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_copy(OpenAPI_vsmf_update_da
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vsmf_update_data_free(dst);
     dst = OpenAPI_vsmf_update_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "ambr.h"
 #include "arp.h"
 #include "cause.h"
@@ -99,6 +100,7 @@ OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_create(
 void OpenAPI_vsmf_update_data_free(OpenAPI_vsmf_update_data_t *vsmf_update_data);
 OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_parseFromJSON(cJSON *vsmf_update_dataJSON);
 cJSON *OpenAPI_vsmf_update_data_convertToJSON(OpenAPI_vsmf_update_data_t *vsmf_update_data);
+bool OpenAPI_vsmf_update_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_update_data_t *vsmf_update_data);
 OpenAPI_vsmf_update_data_t *OpenAPI_vsmf_update_data_copy(OpenAPI_vsmf_update_data_t *dst, OpenAPI_vsmf_update_data_t *src);
 
 #ifdef __cplusplus
@@ -215,6 +215,124 @@ end:
     return item;
 }
 
+bool OpenAPI_vsmf_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_update_error_t *vsmf_update_error)
+{
+    if (vsmf_update_error == NULL) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [VsmfUpdateError]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [VsmfUpdateError]");
+        return false;
+    }
+    if (OpenAPI_problem_details_writeJSON(writer, "error", vsmf_update_error->error) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [error]");
+        goto end;
+    }
+
+    if (vsmf_update_error->is_pti) {
+    if (OpenAPI_json_write_number(writer, "pti", vsmf_update_error->pti) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [pti]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->n1sm_cause) {
+    if (OpenAPI_json_write_string(writer, "n1smCause", vsmf_update_error->n1sm_cause) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [n1sm_cause]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->n1_sm_info_from_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoFromUe", vsmf_update_error->n1_sm_info_from_ue) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [n1_sm_info_from_ue]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->unknown_n1_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "unknownN1SmInfo", vsmf_update_error->unknown_n1_sm_info) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [unknown_n1_sm_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->failed_to_assign_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "failedToAssignEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [failed_to_assign_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_to_assign_ebi_list_node;
+    if (vsmf_update_error->failed_to_assign_ebi_list) {
+        OpenAPI_list_for_each(vsmf_update_error->failed_to_assign_ebi_list, failed_to_assign_ebi_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, failed_to_assign_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [failed_to_assign_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [failed_to_assign_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->ng_ap_cause) {
+    if (OpenAPI_ng_ap_cause_writeJSON(writer, "ngApCause", vsmf_update_error->ng_ap_cause) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [ng_ap_cause]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->is__5g_mm_cause_value) {
+    if (OpenAPI_json_write_number(writer, "5gMmCauseValue", vsmf_update_error->_5g_mm_cause_value) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [_5g_mm_cause_value]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->recovery_time) {
+    if (OpenAPI_json_write_string(writer, "recoveryTime", vsmf_update_error->recovery_time) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [recovery_time]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", vsmf_update_error->n4_info) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", vsmf_update_error->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (vsmf_update_error->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", vsmf_update_error->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_update_error_writeJSON() failed [VsmfUpdateError]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_parseFromJSON(cJSON *vsmf_update_errorJSON)
 {
     OpenAPI_vsmf_update_error_t *vsmf_update_error_local_var = NULL;
@@ -359,7 +477,6 @@ end:
 OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_copy(OpenAPI_vsmf_update_error_t *dst, OpenAPI_vsmf_update_error_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vsmf_update_error_convertToJSON(src);
@@ -368,21 +485,6 @@ OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_copy(OpenAPI_vsmf_update_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vsmf_update_error_free(dst);
     dst = OpenAPI_vsmf_update_error_parseFromJSON(item);
     cJSON_Delete(item);
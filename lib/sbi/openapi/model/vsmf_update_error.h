@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 #include "n4_information.h"
 #include "ng_ap_cause.h"
@@ -59,6 +60,7 @@ OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_create(
 void OpenAPI_vsmf_update_error_free(OpenAPI_vsmf_update_error_t *vsmf_update_error);
 OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_parseFromJSON(cJSON *vsmf_update_errorJSON);
 cJSON *OpenAPI_vsmf_update_error_convertToJSON(OpenAPI_vsmf_update_error_t *vsmf_update_error);
+bool OpenAPI_vsmf_update_error_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_update_error_t *vsmf_update_error);
 OpenAPI_vsmf_update_error_t *OpenAPI_vsmf_update_error_copy(OpenAPI_vsmf_update_error_t *dst, OpenAPI_vsmf_update_error_t *src);
 
 #ifdef __cplusplus
@@ -389,6 +389,271 @@ end:
     return item;
 }
 
+bool OpenAPI_vsmf_updated_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_updated_data_t *vsmf_updated_data)
+{
+    if (vsmf_updated_data == NULL) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [VsmfUpdatedData]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [VsmfUpdatedData]");
+        return false;
+    }
+    if (vsmf_updated_data->qos_flows_add_mod_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsAddModList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_add_mod_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_add_mod_list_node;
+    if (vsmf_updated_data->qos_flows_add_mod_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->qos_flows_add_mod_list, qos_flows_add_mod_list_node) {
+            if (OpenAPI_qos_flow_item_writeJSON(writer, NULL, qos_flows_add_mod_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_add_mod_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_add_mod_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->qos_flows_rel_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsRelList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_rel_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_rel_list_node;
+    if (vsmf_updated_data->qos_flows_rel_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->qos_flows_rel_list, qos_flows_rel_list_node) {
+            if (OpenAPI_qos_flow_item_writeJSON(writer, NULL, qos_flows_rel_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_rel_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_rel_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->qos_flows_failedto_add_mod_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsFailedtoAddModList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_add_mod_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_failedto_add_mod_list_node;
+    if (vsmf_updated_data->qos_flows_failedto_add_mod_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->qos_flows_failedto_add_mod_list, qos_flows_failedto_add_mod_list_node) {
+            if (OpenAPI_qos_flow_item_writeJSON(writer, NULL, qos_flows_failedto_add_mod_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_add_mod_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_add_mod_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->qos_flows_failedto_rel_list) {
+    if (OpenAPI_json_write_array_start(writer, "qosFlowsFailedtoRelList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_rel_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *qos_flows_failedto_rel_list_node;
+    if (vsmf_updated_data->qos_flows_failedto_rel_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->qos_flows_failedto_rel_list, qos_flows_failedto_rel_list_node) {
+            if (OpenAPI_qos_flow_item_writeJSON(writer, NULL, qos_flows_failedto_rel_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_rel_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [qos_flows_failedto_rel_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->n1_sm_info_from_ue) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "n1SmInfoFromUe", vsmf_updated_data->n1_sm_info_from_ue) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [n1_sm_info_from_ue]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->unknown_n1_sm_info) {
+    if (OpenAPI_ref_to_binary_data_writeJSON(writer, "unknownN1SmInfo", vsmf_updated_data->unknown_n1_sm_info) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [unknown_n1_sm_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "ueLocation", vsmf_updated_data->ue_location) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [ue_location]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->ue_time_zone) {
+    if (OpenAPI_json_write_string(writer, "ueTimeZone", vsmf_updated_data->ue_time_zone) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [ue_time_zone]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->add_ue_location) {
+    if (OpenAPI_user_location_writeJSON(writer, "addUeLocation", vsmf_updated_data->add_ue_location) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [add_ue_location]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->assigned_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "assignedEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [assigned_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *assigned_ebi_list_node;
+    if (vsmf_updated_data->assigned_ebi_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->assigned_ebi_list, assigned_ebi_list_node) {
+            if (OpenAPI_ebi_arp_mapping_writeJSON(writer, NULL, assigned_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [assigned_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [assigned_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->failed_to_assign_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "failedToAssignEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [failed_to_assign_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *failed_to_assign_ebi_list_node;
+    if (vsmf_updated_data->failed_to_assign_ebi_list) {
+        OpenAPI_list_for_each(vsmf_updated_data->failed_to_assign_ebi_list, failed_to_assign_ebi_list_node) {
+            if (OpenAPI_arp_writeJSON(writer, NULL, failed_to_assign_ebi_list_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [failed_to_assign_ebi_list]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [failed_to_assign_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->released_ebi_list) {
+    if (OpenAPI_json_write_array_start(writer, "releasedEbiList") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *released_ebi_list_node;
+    OpenAPI_list_for_each(vsmf_updated_data->released_ebi_list, released_ebi_list_node)  {
+    if (OpenAPI_json_write_number(writer, NULL, *(double *)released_ebi_list_node->data) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [released_ebi_list]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->secondary_rat_usage_report) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageReport") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_report_node;
+    if (vsmf_updated_data->secondary_rat_usage_report) {
+        OpenAPI_list_for_each(vsmf_updated_data->secondary_rat_usage_report, secondary_rat_usage_report_node) {
+            if (OpenAPI_secondary_rat_usage_report_writeJSON(writer, NULL, secondary_rat_usage_report_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_report]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_report]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->secondary_rat_usage_info) {
+    if (OpenAPI_json_write_array_start(writer, "secondaryRatUsageInfo") == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *secondary_rat_usage_info_node;
+    if (vsmf_updated_data->secondary_rat_usage_info) {
+        OpenAPI_list_for_each(vsmf_updated_data->secondary_rat_usage_info, secondary_rat_usage_info_node) {
+            if (OpenAPI_secondary_rat_usage_info_writeJSON(writer, NULL, secondary_rat_usage_info_node->data) == false) {
+                ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_info]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [secondary_rat_usage_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->n4_info) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4Info", vsmf_updated_data->n4_info) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [n4_info]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->n4_info_ext1) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt1", vsmf_updated_data->n4_info_ext1) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [n4_info_ext1]");
+        goto end;
+    }
+    }
+
+    if (vsmf_updated_data->n4_info_ext2) {
+    if (OpenAPI_n4_information_writeJSON(writer, "n4InfoExt2", vsmf_updated_data->n4_info_ext2) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [n4_info_ext2]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_vsmf_updated_data_writeJSON() failed [VsmfUpdatedData]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_parseFromJSON(cJSON *vsmf_updated_dataJSON)
 {
     OpenAPI_vsmf_updated_data_t *vsmf_updated_data_local_var = NULL;
@@ -730,7 +995,6 @@ end:
 OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_copy(OpenAPI_vsmf_updated_data_t *dst, OpenAPI_vsmf_updated_data_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_vsmf_updated_data_convertToJSON(src);
@@ -739,21 +1003,6 @@ OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_copy(OpenAPI_vsmf_updated
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_vsmf_updated_data_free(dst);
     dst = OpenAPI_vsmf_updated_data_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "arp.h"
 #include "ebi_arp_mapping.h"
 #include "n4_information.h"
@@ -68,6 +69,7 @@ OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_create(
 void OpenAPI_vsmf_updated_data_free(OpenAPI_vsmf_updated_data_t *vsmf_updated_data);
 OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_parseFromJSON(cJSON *vsmf_updated_dataJSON);
 cJSON *OpenAPI_vsmf_updated_data_convertToJSON(OpenAPI_vsmf_updated_data_t *vsmf_updated_data);
+bool OpenAPI_vsmf_updated_data_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_vsmf_updated_data_t *vsmf_updated_data);
 OpenAPI_vsmf_updated_data_t *OpenAPI_vsmf_updated_data_copy(OpenAPI_vsmf_updated_data_t *dst, OpenAPI_vsmf_updated_data_t *src);
 
 #ifdef __cplusplus
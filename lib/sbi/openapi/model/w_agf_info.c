@@ -91,6 +91,73 @@ end:
     return item;
 }
 
+bool OpenAPI_w_agf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_w_agf_info_t *w_agf_info)
+{
+    if (w_agf_info == NULL) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [WAgfInfo]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [WAgfInfo]");
+        return false;
+    }
+    if (w_agf_info->ipv4_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv4EndpointAddresses") == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv4_endpoint_addresses_node;
+    OpenAPI_list_for_each(w_agf_info->ipv4_endpoint_addresses, ipv4_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv4_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv4_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (w_agf_info->ipv6_endpoint_addresses) {
+    if (OpenAPI_json_write_array_start(writer, "ipv6EndpointAddresses") == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *ipv6_endpoint_addresses_node;
+    OpenAPI_list_for_each(w_agf_info->ipv6_endpoint_addresses, ipv6_endpoint_addresses_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)ipv6_endpoint_addresses_node->data) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [ipv6_endpoint_addresses]");
+        goto end;
+    }
+    }
+
+    if (w_agf_info->endpoint_fqdn) {
+    if (OpenAPI_json_write_string(writer, "endpointFqdn", w_agf_info->endpoint_fqdn) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [endpoint_fqdn]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_w_agf_info_writeJSON() failed [WAgfInfo]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_parseFromJSON(cJSON *w_agf_infoJSON)
 {
     OpenAPI_w_agf_info_t *w_agf_info_local_var = NULL;
@@ -157,7 +224,6 @@ end:
 OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_copy(OpenAPI_w_agf_info_t *dst, OpenAPI_w_agf_info_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_w_agf_info_convertToJSON(src);
@@ -166,21 +232,6 @@ OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_copy(OpenAPI_w_agf_info_t *dst, OpenAPI
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_w_agf_info_free(dst);
     dst = OpenAPI_w_agf_info_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_create(
 void OpenAPI_w_agf_info_free(OpenAPI_w_agf_info_t *w_agf_info);
 OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_parseFromJSON(cJSON *w_agf_infoJSON);
 cJSON *OpenAPI_w_agf_info_convertToJSON(OpenAPI_w_agf_info_t *w_agf_info);
+bool OpenAPI_w_agf_info_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_w_agf_info_t *w_agf_info);
 OpenAPI_w_agf_info_t *OpenAPI_w_agf_info_copy(OpenAPI_w_agf_info_t *dst, OpenAPI_w_agf_info_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_wireline_area_t *OpenAPI_wireline_area_create(
 void OpenAPI_wireline_area_free(OpenAPI_wireline_area_t *wireline_area);
 OpenAPI_wireline_area_t *OpenAPI_wireline_area_parseFromJSON(cJSON *wireline_areaJSON);
 cJSON *OpenAPI_wireline_area_convertToJSON(OpenAPI_wireline_area_t *wireline_area);
+bool OpenAPI_wireline_area_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_area_t *wireline_area);
 OpenAPI_wireline_area_t *OpenAPI_wireline_area_copy(OpenAPI_wireline_area_t *dst, OpenAPI_wireline_area_t *src);
 
 #ifdef __cplusplus
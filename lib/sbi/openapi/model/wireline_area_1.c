@@ -101,6 +101,80 @@ end:
     return item;
 }
 
+bool OpenAPI_wireline_area_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_area_1_t *wireline_area_1)
+{
+    if (wireline_area_1 == NULL) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [WirelineArea_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [WirelineArea_1]");
+        return false;
+    }
+    if (wireline_area_1->global_line_ids) {
+    if (OpenAPI_json_write_array_start(writer, "globalLineIds") == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [global_line_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *global_line_ids_node;
+    OpenAPI_list_for_each(wireline_area_1->global_line_ids, global_line_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)global_line_ids_node->data) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [global_line_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [global_line_ids]");
+        goto end;
+    }
+    }
+
+    if (wireline_area_1->hfc_n_ids) {
+    if (OpenAPI_json_write_array_start(writer, "hfcNIds") == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [hfc_n_ids]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *hfc_n_ids_node;
+    OpenAPI_list_for_each(wireline_area_1->hfc_n_ids, hfc_n_ids_node)  {
+    if (OpenAPI_json_write_string(writer, NULL, (char*)hfc_n_ids_node->data) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [hfc_n_ids]");
+        goto end;
+    }
+                    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [hfc_n_ids]");
+        goto end;
+    }
+    }
+
+    if (wireline_area_1->area_code_b) {
+    if (OpenAPI_json_write_string(writer, "areaCodeB", wireline_area_1->area_code_b) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [area_code_b]");
+        goto end;
+    }
+    }
+
+    if (wireline_area_1->area_code_c) {
+    if (OpenAPI_json_write_string(writer, "areaCodeC", wireline_area_1->area_code_c) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [area_code_c]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_wireline_area_1_writeJSON() failed [WirelineArea_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_parseFromJSON(cJSON *wireline_area_1JSON)
 {
     OpenAPI_wireline_area_1_t *wireline_area_1_local_var = NULL;
@@ -177,7 +251,6 @@ end:
 OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_copy(OpenAPI_wireline_area_1_t *dst, OpenAPI_wireline_area_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_wireline_area_1_convertToJSON(src);
@@ -186,21 +259,6 @@ OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_copy(OpenAPI_wireline_area_1_
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_wireline_area_1_free(dst);
     dst = OpenAPI_wireline_area_1_parseFromJSON(item);
     cJSON_Delete(item);
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,7 @@ OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_create(
 void OpenAPI_wireline_area_1_free(OpenAPI_wireline_area_1_t *wireline_area_1);
 OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_parseFromJSON(cJSON *wireline_area_1JSON);
 cJSON *OpenAPI_wireline_area_1_convertToJSON(OpenAPI_wireline_area_1_t *wireline_area_1);
+bool OpenAPI_wireline_area_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_area_1_t *wireline_area_1);
 OpenAPI_wireline_area_1_t *OpenAPI_wireline_area_1_copy(OpenAPI_wireline_area_1_t *dst, OpenAPI_wireline_area_1_t *src);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "restriction_type.h"
 #include "wireline_area.h"
 
@@ -32,6 +33,7 @@ OpenAPI_wireline_service_area_restriction_t *OpenAPI_wireline_service_area_restr
 void OpenAPI_wireline_service_area_restriction_free(OpenAPI_wireline_service_area_restriction_t *wireline_service_area_restriction);
 OpenAPI_wireline_service_area_restriction_t *OpenAPI_wireline_service_area_restriction_parseFromJSON(cJSON *wireline_service_area_restrictionJSON);
 cJSON *OpenAPI_wireline_service_area_restriction_convertToJSON(OpenAPI_wireline_service_area_restriction_t *wireline_service_area_restriction);
+bool OpenAPI_wireline_service_area_restriction_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_service_area_restriction_t *wireline_service_area_restriction);
 OpenAPI_wireline_service_area_restriction_t *OpenAPI_wireline_service_area_restriction_copy(OpenAPI_wireline_service_area_restriction_t *dst, OpenAPI_wireline_service_area_restriction_t *src);
 
 #ifdef __cplusplus
@@ -72,6 +72,56 @@ end:
     return item;
 }
 
+bool OpenAPI_wireline_service_area_restriction_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_service_area_restriction_1_t *wireline_service_area_restriction_1)
+{
+    if (wireline_service_area_restriction_1 == NULL) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [WirelineServiceAreaRestriction_1]");
+        return false;
+    }
+
+    if (OpenAPI_json_write_object_start(writer, key) == false) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [WirelineServiceAreaRestriction_1]");
+        return false;
+    }
+    if (wireline_service_area_restriction_1->restriction_type) {
+    if (OpenAPI_json_write_string(writer, "restrictionType", OpenAPI_restriction_type_ToString(wireline_service_area_restriction_1->restriction_type)) == false) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [restriction_type]");
+        goto end;
+    }
+    }
+
+    if (wireline_service_area_restriction_1->areas) {
+    if (OpenAPI_json_write_array_start(writer, "areas") == false) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [areas]");
+        goto end;
+    }
+
+    OpenAPI_lnode_t *areas_node;
+    if (wireline_service_area_restriction_1->areas) {
+        OpenAPI_list_for_each(wireline_service_area_restriction_1->areas, areas_node) {
+            if (OpenAPI_wireline_area_1_writeJSON(writer, NULL, areas_node->data) == false) {
+                ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [areas]");
+                goto end;
+            }
+        }
+    }
+    if (OpenAPI_json_write_array_end(writer) == false) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [areas]");
+        goto end;
+    }
+    }
+
+    if (OpenAPI_json_write_object_end(writer) == false) {
+        ogs_error("OpenAPI_wireline_service_area_restriction_1_writeJSON() failed [WirelineServiceAreaRestriction_1]");
+        return false;
+    }
+
+    return true;
+
+end:
+    return false;
+}
+
 OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_restriction_1_parseFromJSON(cJSON *wireline_service_area_restriction_1JSON)
 {
     OpenAPI_wireline_service_area_restriction_1_t *wireline_service_area_restriction_1_local_var = NULL;
@@ -128,7 +178,6 @@ end:
 OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_restriction_1_copy(OpenAPI_wireline_service_area_restriction_1_t *dst, OpenAPI_wireline_service_area_restriction_1_t *src)
 {
     cJSON *item = NULL;
-    char *content = NULL;
 
     ogs_assert(src);
     item = OpenAPI_wireline_service_area_restriction_1_convertToJSON(src);
@@ -137,21 +186,6 @@ OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_res
         return NULL;
     }
 
-    content = cJSON_Print(item);
-    cJSON_Delete(item);
-
-    if (!content) {
-        ogs_error("cJSON_Print() failed");
-        return NULL;
-    }
-
-    item = cJSON_Parse(content);
-    ogs_free(content);
-    if (!item) {
-        ogs_error("cJSON_Parse() failed");
-        return NULL;
-    }
-
     OpenAPI_wireline_service_area_restriction_1_free(dst);
     dst = OpenAPI_wireline_service_area_restriction_1_parseFromJSON(item);
     cJSON_Delete(item);
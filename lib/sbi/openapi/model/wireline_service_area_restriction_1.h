@@ -12,6 +12,7 @@
 #include "../include/list.h"
 #include "../include/keyValuePair.h"
 #include "../include/binary.h"
+#include "../include/json_writer.h"
 #include "restriction_type.h"
 #include "wireline_area_1.h"
 
@@ -32,6 +33,7 @@ OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_res
 void OpenAPI_wireline_service_area_restriction_1_free(OpenAPI_wireline_service_area_restriction_1_t *wireline_service_area_restriction_1);
 OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_restriction_1_parseFromJSON(cJSON *wireline_service_area_restriction_1JSON);
 cJSON *OpenAPI_wireline_service_area_restriction_1_convertToJSON(OpenAPI_wireline_service_area_restriction_1_t *wireline_service_area_restriction_1);
+bool OpenAPI_wireline_service_area_restriction_1_writeJSON(OpenAPI_json_writer_t *writer, const char *key, OpenAPI_wireline_service_area_restriction_1_t *wireline_service_area_restriction_1);
 OpenAPI_wireline_service_area_restriction_1_t *OpenAPI_wireline_service_area_restriction_1_copy(OpenAPI_wireline_service_area_restriction_1_t *dst, OpenAPI_wireline_service_area_restriction_1_t *src);
 
 #ifdef __cplusplus
@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+#include "../include/json_writer.h"
+
+#define JSON_WRITER_INITIAL_SIZE 512
+
+void OpenAPI_json_writer_init(OpenAPI_json_writer_t *writer)
+{
+    ogs_assert(writer);
+    memset(writer, 0, sizeof(*writer));
+}
+
+char *OpenAPI_json_writer_finish(OpenAPI_json_writer_t *writer)
+{
+    char *buf = NULL;
+
+    ogs_assert(writer);
+
+    buf = writer->buf;
+    memset(writer, 0, sizeof(*writer));
+
+    return buf;
+}
+
+void OpenAPI_json_writer_clear(OpenAPI_json_writer_t *writer)
+{
+    ogs_assert(writer);
+
+    if (writer->buf)
+        ogs_free(writer->buf);
+    memset(writer, 0, sizeof(*writer));
+}
+
+/* Keeps room for `needed` more bytes and the terminating NUL */
+static char *ensure(OpenAPI_json_writer_t *writer, size_t needed)
+{
+    size_t size;
+    char *buf = NULL;
+
+    if (writer->len + needed + 1 <= writer->size)
+        return writer->buf + writer->len;
+
+    size = writer->size ? writer->size : JSON_WRITER_INITIAL_SIZE;
+    while (writer->len + needed + 1 > size)
+        size *= 2;
+
+    buf = ogs_realloc(writer->buf, size);
+    if (!buf) {
+        ogs_error("ogs_realloc() failed [%d]", (int)size);
+        return NULL;
+    }
+    writer->buf = buf;
+    writer->size = size;
+
+    return writer->buf + writer->len;
+}
+
+static bool append(OpenAPI_json_writer_t *writer, const char *data, size_t len)
+{
+    char *p = ensure(writer, len);
+    if (!p)
+        return false;
+
+    memcpy(p, data, len);
+    writer->len += len;
+    writer->buf[writer->len] = '\0';
+
+    return true;
+}
+
+/* Same escaping as print_string_ptr() in cJSON */
+static bool append_string(OpenAPI_json_writer_t *writer, const char *input)
+{
+    const unsigned char *s = NULL;
+    size_t escape = 0, len;
+    char *p = NULL;
+
+    for (s = (const unsigned char *)input; *s; s++) {
+        switch (*s) {
+        case '\"':
+        case '\\':
+        case '\b':
+        case '\f':
+        case '\n':
+        case '\r':
+        case '\t':
+            escape++;
+            break;
+        default:
+            if (*s < 32)
+                escape += 5;
+            break;
+        }
+    }
+    len = (size_t)((const char *)s - input);
+
+    p = ensure(writer, len + escape + 2);
+    if (!p)
+        return false;
+
+    *p++ = '\"';
+    if (escape == 0) {
+        memcpy(p, input, len);
+        p += len;
+    } else {
+        for (s = (const unsigned char *)input; *s; s++) {
+            if (*s > 31 && *s != '\"' && *s != '\\') {
+                *p++ = *s;
+                continue;
+            }
+
+            *p++ = '\\';
+            switch (*s) {
+            case '\\':
+                *p++ = '\\';
+                break;
+            case '\"':
+                *p++ = '\"';
+                break;
+            case '\b':
+                *p++ = 'b';
+                break;
+            case '\f':
+                *p++ = 'f';
+                break;
+            case '\n':
+                *p++ = 'n';
+                break;
+            case '\r':
+                *p++ = 'r';
+                break;
+            case '\t':
+                *p++ = 't';
+                break;
+            default:
+                sprintf(p, "u%04x", *s);
+                p += 5;
+                break;
+            }
+        }
+    }
+    *p++ = '\"';
+    *p = '\0';
+
+    writer->len = p - writer->buf;
+
+    return true;
+}
+
+/* Writes the separator and the key before a value */
+static bool begin_value(OpenAPI_json_writer_t *writer, const char *key)
+{
+    if (writer->comma && append(writer, ",", 1) == false)
+        return false;
+
+    if (key) {
+        if (append_string(writer, key) == false)
+            return false;
+        if (append(writer, ":", 1) == false)
+            return false;
+    }
+
+    writer->comma = true;
+
+    return true;
+}
+
+bool OpenAPI_json_write_object_start(
+        OpenAPI_json_writer_t *writer, const char *key)
+{
+    ogs_assert(writer);
+
+    if (begin_value(writer, key) == false || append(writer, "{", 1) == false)
+        return false;
+    writer->comma = false;
+
+    return true;
+}
+
+bool OpenAPI_json_write_object_end(OpenAPI_json_writer_t *writer)
+{
+    ogs_assert(writer);
+
+    if (append(writer, "}", 1) == false)
+        return false;
+    writer->comma = true;
+
+    return true;
+}
+
+bool OpenAPI_json_write_array_start(
+        OpenAPI_json_writer_t *writer, const char *key)
+{
+    ogs_assert(writer);
+
+    if (begin_value(writer, key) == false || append(writer, "[", 1) == false)
+        return false;
+    writer->comma = false;
+
+    return true;
+}
+
+bool OpenAPI_json_write_array_end(OpenAPI_json_writer_t *writer)
+{
+    ogs_assert(writer);
+
+    if (append(writer, "]", 1) == false)
+        return false;
+    writer->comma = true;
+
+    return true;
+}
+
+bool OpenAPI_json_write_string(
+        OpenAPI_json_writer_t *writer, const char *key, const char *value)
+{
+    ogs_assert(writer);
+
+    if (!value)
+        return false;
+
+    return begin_value(writer, key) && append_string(writer, value);
+}
+
+/* Same format as print_number() in cJSON */
+bool OpenAPI_json_write_number(
+        OpenAPI_json_writer_t *writer, const char *key, double value)
+{
+    char number[26];
+    double test = 0.0;
+    int length, valueint;
+
+    ogs_assert(writer);
+
+    if (value >= INT_MAX)
+        valueint = INT_MAX;
+    else if (value <= (double)INT_MIN)
+        valueint = INT_MIN;
+    else
+        valueint = (int)value;
+
+    if (isnan(value) || isinf(value)) {
+        length = sprintf(number, "null");
+    } else if (value == (double)valueint) {
+        length = sprintf(number, "%d", valueint);
+    } else {
+        length = sprintf(number, "%1.15g", value);
+        if (sscanf(number, "%lg", &test) != 1 ||
+            fabs(test - value) >
+                (fabs(test) > fabs(value) ? fabs(test) : fabs(value)) *
+                    DBL_EPSILON)
+            length = sprintf(number, "%1.17g", value);
+    }
+
+    if (length < 0 || length > (int)(sizeof(number) - 1))
+        return false;
+
+    return begin_value(writer, key) && append(writer, number, length);
+}
+
+bool OpenAPI_json_write_bool(
+        OpenAPI_json_writer_t *writer, const char *key, bool value)
+{
+    ogs_assert(writer);
+
+    if (begin_value(writer, key) == false)
+        return false;
+
+    return value ? append(writer, "true", 4) : append(writer, "false", 5);
+}
+
+bool OpenAPI_json_write_null(OpenAPI_json_writer_t *writer, const char *key)
+{
+    ogs_assert(writer);
+
+    return begin_value(writer, key) && append(writer, "null", 4);
+}
+
+bool OpenAPI_json_write_item(
+        OpenAPI_json_writer_t *writer, const char *key, const cJSON *item)
+{
+    char *content = NULL;
+    bool rc;
+
+    ogs_assert(writer);
+
+    if (!item)
+        return false;
+
+    content = cJSON_PrintUnformatted(item);
+    if (!content)
+        return false;
+
+    rc = begin_value(writer, key) && append(writer, content, strlen(content));
+    cJSON_free(content);
+
+    return rc;
+}
@@ -42,6 +42,14 @@ typedef struct ogs_sbi_server_s {
     int (*cb)(ogs_sbi_request_t *request, void *data);
     ogs_list_t      session_list;
 
+    /*
+     * 0 : Sessions are served on the NF thread.
+     * N : N I/O threads each accept on their own SO_REUSEPORT listener.
+     *     Only the request callback and the response stay on the NF thread.
+     */
+    int             num_of_io_thread;
+    void            *loop; /* Used by I/O threads */
+
     void            *mhd; /* Used by MHD */
 } ogs_sbi_server_t;
 
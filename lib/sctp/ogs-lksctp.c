@@ -246,13 +246,18 @@ int ogs_sctp_recvmsg(ogs_sock_t *sock, void *msg, size_t len,
 
     ogs_assert(sock);
 
+    /* sctp_recvmsg() passes *msg_flags on to recvmsg() */
+    if (msg_flags)
+        flags = *msg_flags & MSG_DONTWAIT;
+
     memset(&sndrcvinfo, 0, sizeof sndrcvinfo);
     memset(&addr, 0, sizeof addr);
     size = sctp_recvmsg(sock->fd, msg, len, &addr.sa, &addrlen,
                 &sndrcvinfo, &flags);
     if (size < 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "sctp_recvmsg(%d) failed", size);
+        if (ogs_socket_errno != OGS_EAGAIN)
+            ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                    "sctp_recvmsg(%d) failed", size);
         return size;
     }
 
@@ -123,6 +123,11 @@ int ogs_sctp_so_linger(ogs_sock_t *sock, int l_linger);
 
 int ogs_sctp_sendmsg(ogs_sock_t *sock, const void *msg, size_t len,
         ogs_sockaddr_t *to, uint32_t ppid, uint16_t stream_no);
+/*
+ * On input, MSG_DONTWAIT in *msg_flags makes a single read non-blocking
+ * (usrsctp sockets are always non-blocking). On output, *msg_flags has
+ * the MSG_NOTIFICATION/MSG_EOR flags of the message.
+ */
 int ogs_sctp_recvmsg(ogs_sock_t *sock, void *msg, size_t len,
         ogs_sockaddr_t *from, ogs_sctp_info_t *sinfo, int *msg_flags);
 int ogs_sctp_recvdata(ogs_sock_t *sock, void *msg, size_t len,
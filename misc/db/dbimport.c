@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Copies the MongoDB 'subscribers' collection to an embedded subscriber
+ * store, which NFs can then use with 'db_uri: file:///path/to/file'
+ */
+
+#include "ogs-dbi.h"
+
+extern int __ogs_dbi_domain;
+
+static void show_help(const char *name)
+{
+    printf("Usage: %s [options] -o filename\n"
+        "Options:\n"
+       "   -d db_uri      : MongoDB to import "
+                            "(default:mongodb://localhost/open5gs)\n"
+       "   -o filename    : subscriber store to create\n"
+       "   -e level       : set global log-level (default:info)\n"
+       "   -h             : show this message and exit\n"
+       "\n", name);
+}
+
+int main(int argc, const char *const argv[])
+{
+    int rv, opt;
+    ogs_getopt_t options;
+    struct {
+        const char *db_uri;
+        const char *output;
+        const char *log_level;
+    } optarg;
+
+    memset(&optarg, 0, sizeof(optarg));
+    optarg.db_uri = "mongodb://localhost/open5gs";
+
+    ogs_getopt_init(&options, (char**)argv);
+    while ((opt = ogs_getopt(&options, "hd:o:e:")) != -1) {
+        switch (opt) {
+        case 'h':
+            show_help(argv[0]);
+            return OGS_OK;
+        case 'd':
+            optarg.db_uri = options.optarg;
+            break;
+        case 'o':
+            optarg.output = options.optarg;
+            break;
+        case 'e':
+            optarg.log_level = options.optarg;
+            break;
+        case '?':
+            fprintf(stderr, "%s: %s\n", argv[0], options.errmsg);
+            show_help(argv[0]);
+            return EXIT_FAILURE;
+        default:
+            fprintf(stderr, "unknown option = %c\n", opt);
+            ogs_assert_if_reached();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!optarg.output) {
+        show_help(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!strncmp(optarg.db_uri, OGS_DBI_STORE_URI_PREFIX,
+                strlen(OGS_DBI_STORE_URI_PREFIX))) {
+        fprintf(stderr, "%s: db_uri must be MongoDB\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ogs_core_initialize();
+    ogs_log_install_domain(&__ogs_dbi_domain, "dbi", OGS_LOG_INFO);
+
+    rv = ogs_log_config_domain(NULL, optarg.log_level);
+    if (rv != OGS_OK) goto out;
+
+    rv = ogs_dbi_init(optarg.db_uri);
+    if (rv != OGS_OK) {
+        ogs_error("Cannot connect to MongoDB [%s]", optarg.db_uri);
+        goto out;
+    }
+
+    rv = ogs_dbi_store_import(optarg.output);
+
+    ogs_dbi_final();
+
+out:
+    ogs_core_terminate();
+
+    return rv == OGS_OK ? EXIT_SUCCESS : EXIT_FAILURE;
+}
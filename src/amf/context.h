@@ -253,6 +253,12 @@ struct amf_ue_s {
     ogs_plmn_id_t   last_visited_plmn_id;
     ogs_nas_ue_usage_setting_t ue_usage_setting;
 
+    struct {
+        ogs_time_t registration;
+        ogs_time_t service_request;
+        ogs_time_t handover;
+    } procedure;                    /* Start time for the latency metrics */
+
     struct {
         int num_of_s_nssai;
         ogs_nas_s_nssai_ie_t s_nssai[OGS_MAX_NUM_OF_SLICE];
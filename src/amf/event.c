@@ -79,12 +79,11 @@ const char *amf_event_get_name(amf_event_t *e)
     return "UNKNOWN_EVENT";
 }
 
-void amf_sctp_event_push(int id,
+amf_event_t *amf_sctp_event_new(int id,
         void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
         uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams)
 {
     amf_event_t *e = NULL;
-    int rv;
 
     ogs_assert(id);
     ogs_assert(sock);
@@ -100,13 +99,32 @@ void amf_sctp_event_push(int id,
     e->ngap.max_num_of_istreams = max_num_of_istreams;
     e->ngap.max_num_of_ostreams = max_num_of_ostreams;
 
+    return e;
+}
+
+static void sctp_event_discard(amf_event_t *e)
+{
+    ogs_free(e->ngap.addr);
+    if (e->pkbuf)
+        ogs_pkbuf_free(e->pkbuf);
+    ogs_event_free(e);
+}
+
+void amf_sctp_event_push(int id,
+        void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
+        uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams)
+{
+    amf_event_t *e = NULL;
+    int rv;
+
+    e = amf_sctp_event_new(id, sock, addr, pkbuf,
+            max_num_of_istreams, max_num_of_ostreams);
+    ogs_assert(e);
+
     rv = ogs_queue_push(ogs_app()->queue, e);
     if (rv != OGS_OK) {
         ogs_error("ogs_queue_push() failed:%d", (int)rv);
-        ogs_free(e->ngap.addr);
-        if (e->pkbuf)
-            ogs_pkbuf_free(e->pkbuf);
-        ogs_event_free(e);
+        sctp_event_discard(e);
     }
 #if HAVE_USRSCTP
     else {
@@ -114,3 +132,33 @@ void amf_sctp_event_push(int id,
     }
 #endif
 }
+
+/*
+ * Pushes the events read in one wakeup with a single queue operation.
+ * If the queue is full, the rest go through ogs_queue_push() one by
+ * one and block like amf_sctp_event_push(), so no message is dropped
+ * unless the queue has been terminated.
+ */
+void amf_sctp_event_push_bulk(amf_event_t **e, unsigned int n)
+{
+    unsigned int i, pushed;
+    int rv;
+
+    if (!n)
+        return;
+
+    pushed = ogs_queue_trypush_bulk(ogs_app()->queue, (void **)e, n);
+    for (i = pushed; i < n; i++) {
+        rv = ogs_queue_push(ogs_app()->queue, e[i]);
+        if (rv != OGS_OK) {
+            ogs_error("ogs_queue_push() failed:%d", (int)rv);
+            sctp_event_discard(e[i]);
+        } else {
+            pushed++;
+        }
+    }
+#if HAVE_USRSCTP
+    if (pushed)
+        ogs_pollset_notify(ogs_app()->pollset);
+#endif
+}
@@ -87,9 +87,13 @@ amf_event_t *amf_event_new(int id);
 
 const char *amf_event_get_name(amf_event_t *e);
 
+amf_event_t *amf_sctp_event_new(int id,
+        void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
+        uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams);
 void amf_sctp_event_push(int id,
         void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
         uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams);
+void amf_sctp_event_push_bulk(amf_event_t **e, unsigned int n);
 
 #ifdef __cplusplus
 }
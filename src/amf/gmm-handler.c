@@ -51,6 +51,8 @@ ogs_nas_5gmm_cause_t gmm_handle_registration_request(amf_ue_t *amf_ue,
     ran_ue = ran_ue_cycle(amf_ue->ran_ue);
     ogs_assert(ran_ue);
 
+    amf_ue->procedure.registration = ogs_get_monotonic_time();
+
     ogs_assert(registration_request);
     registration_type = &registration_request->registration_type;
     ogs_assert(registration_type);
@@ -438,6 +440,8 @@ ogs_nas_5gmm_cause_t gmm_handle_service_request(amf_ue_t *amf_ue,
     ran_ue = ran_ue_cycle(amf_ue->ran_ue);
     ogs_assert(ran_ue);
 
+    amf_ue->procedure.service_request = ogs_get_monotonic_time();
+
     ngksi = &service_request->ngksi;
     ogs_assert(ngksi);
 
@@ -64,6 +64,22 @@ amf_metrics_spec_def_t amf_metrics_spec_def_global[_AMF_METR_GLOB_MAX] = {
     .name = "gnb",
     .description = "gNodeBs",
 },
+/* Global Histograms: */
+[AMF_METR_GLOB_HIST_REGISTRATION] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "registration_duration_microseconds",
+    .description = "Registration Request to Registration Accept",
+},
+[AMF_METR_GLOB_HIST_SERVICE_REQUEST] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "service_request_duration_microseconds",
+    .description = "Service Request to Service Accept",
+},
+[AMF_METR_GLOB_HIST_HANDOVER] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "handover_duration_microseconds",
+    .description = "Handover Required to Handover Notify",
+},
 };
 static int amf_metrics_init_inst_global(void)
 {
@@ -75,6 +91,18 @@ static int amf_metrics_free_inst_global(void)
     return amf_metrics_free_inst(amf_metrics_inst_global, _AMF_METR_GLOB_MAX);
 }
 
+void amf_metrics_procedure_done(
+        amf_metric_type_global_t t, ogs_time_t *started)
+{
+    ogs_assert(started);
+
+    if (*started) {
+        amf_metrics_inst_global_observe(t,
+                ogs_get_monotonic_time() - *started);
+        *started = 0;
+    }
+}
+
 int amf_metrics_open(void)
 {
     ogs_metrics_context_t *ctx = ogs_metrics_self();
@@ -84,6 +112,8 @@ int amf_metrics_open(void)
             _AMF_METR_GLOB_MAX);
 
     amf_metrics_init_inst_global();
+
+    ogs_sbi_client_metrics_open();
     return 0;
 }
 
@@ -11,6 +11,9 @@ typedef enum amf_metric_type_global_s {
     AMF_METR_GLOB_GAUGE_RAN_UE,
     AMF_METR_GLOB_GAUGE_AMF_SESS,
     AMF_METR_GLOB_GAUGE_GNB,
+    AMF_METR_GLOB_HIST_REGISTRATION,
+    AMF_METR_GLOB_HIST_SERVICE_REQUEST,
+    AMF_METR_GLOB_HIST_HANDOVER,
     _AMF_METR_GLOB_MAX,
 } amf_metric_type_global_t;
 extern ogs_metrics_inst_t *amf_metrics_inst_global[_AMF_METR_GLOB_MAX];
@@ -23,6 +26,13 @@ static inline void amf_metrics_inst_global_inc(amf_metric_type_global_t t)
 { ogs_metrics_inst_inc(amf_metrics_inst_global[t]); }
 static inline void amf_metrics_inst_global_dec(amf_metric_type_global_t t)
 { ogs_metrics_inst_dec(amf_metrics_inst_global[t]); }
+static inline void amf_metrics_inst_global_observe(
+        amf_metric_type_global_t t, uint64_t val)
+{ ogs_metrics_inst_observe(amf_metrics_inst_global[t], val); }
+
+/* Observes the time since *started, if set, and clears it */
+void amf_metrics_procedure_done(
+        amf_metric_type_global_t t, ogs_time_t *started);
 
 int amf_metrics_open(void);
 int amf_metrics_close(void);
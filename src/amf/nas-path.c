@@ -149,6 +149,9 @@ int nas_5gs_send_registration_accept(amf_ue_t *amf_ue)
         }
     }
 
+    amf_metrics_procedure_done(AMF_METR_GLOB_HIST_REGISTRATION,
+            &amf_ue->procedure.registration);
+
     return OGS_OK;
 }
 
@@ -232,6 +235,9 @@ int nas_5gs_send_service_accept(amf_ue_t *amf_ue)
         }
     }
 
+    amf_metrics_procedure_done(AMF_METR_GLOB_HIST_SERVICE_REQUEST,
+            &amf_ue->procedure.service_request);
+
     return OGS_OK;
 }
 
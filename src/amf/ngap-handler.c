@@ -2675,6 +2675,8 @@ void ngap_handle_handover_required(
         return;
     }
 
+    amf_ue->procedure.handover = ogs_get_monotonic_time();
+
     if (!HandoverType) {
         ogs_error("No HandoverType");
         ogs_assert(OGS_OK ==
@@ -3596,6 +3598,9 @@ void ngap_handle_handover_notification(
         target_ue->saved.nr_tai.tac.v,
         (long long)target_ue->saved.nr_cgi.cell_id);
 
+    amf_metrics_procedure_done(
+            AMF_METR_GLOB_HIST_HANDOVER, &amf_ue->procedure.handover);
+
     /* Copy Stream-No/TAI/ECGI from ran_ue */
     amf_ue->gnb_ostream_id = target_ue->gnb_ostream_id;
     memcpy(&amf_ue->nr_tai, &target_ue->saved.nr_tai, sizeof(ogs_5gs_tai_t));
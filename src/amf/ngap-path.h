@@ -29,6 +29,8 @@ extern "C" {
 #define NGAP_NON_UE_SIGNALLING   0
 
 #define ngap_event_push  amf_sctp_event_push
+#define ngap_event_new   amf_sctp_event_new
+#define ngap_event_push_bulk amf_sctp_event_push_bulk
 
 int ngap_open(void);
 void ngap_close(void);
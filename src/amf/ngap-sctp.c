@@ -120,33 +120,52 @@ void ngap_accept_handler(ogs_sock_t *sock)
     }
 }
 
-void ngap_recv_handler(ogs_sock_t *sock)
+/*
+ * Each message is read into a scratch buffer on the stack and copied into
+ * a pkbuf of its own size class, so that a NGAP PDU of a few hundred bytes
+ * does not hold an OGS_MAX_SDU_LEN cluster while it waits in the queue.
+ */
+typedef union ngap_recv_buf_u {
+    union sctp_notification not;
+    uint8_t data[OGS_MAX_SDU_LEN];
+} ngap_recv_buf_t;
+
+/* Messages read per wakeup and queued with a single queue operation */
+#define NGAP_RECV_BATCH 16
+
+/*
+ * Returns OGS_OK when a message was read, OGS_DONE for a notification,
+ * which ends the batch, and OGS_RETRY when there is nothing left to read.
+ * *e is the event to queue, if any.
+ */
+static int ngap_recv(ogs_sock_t *sock,
+        ngap_recv_buf_t *buf, int flags, amf_event_t **e)
 {
     ogs_pkbuf_t *pkbuf;
     int size;
     ogs_sockaddr_t *addr = NULL;
     ogs_sockaddr_t from;
     ogs_sctp_info_t sinfo;
-    int flags = 0;
+    union sctp_notification *not = &buf->not;
+    bool dontwait = (flags & MSG_DONTWAIT);
 
     ogs_assert(sock);
+    ogs_assert(e);
+
+    *e = NULL;
 
-    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_put(pkbuf, OGS_MAX_SDU_LEN);
     size = ogs_sctp_recvmsg(
-            sock, pkbuf->data, pkbuf->len, &from, &sinfo, &flags);
+            sock, buf->data, sizeof(buf->data), &from, &sinfo, &flags);
+    if (dontwait && (size == 0 ||
+                (size < 0 && ogs_socket_errno == OGS_EAGAIN)))
+        return OGS_RETRY;
     if (size < 0 || size >= OGS_MAX_SDU_LEN) {
         ogs_error("ogs_sctp_recvmsg(%d) failed(%d:%s)",
                 size, errno, strerror(errno));
-        ogs_pkbuf_free(pkbuf);
-        return;
+        return OGS_ERROR;
     }
 
     if (flags & MSG_NOTIFICATION) {
-        union sctp_notification *not =
-            (union sctp_notification *)pkbuf->data;
-
         switch(not->sn_header.sn_type) {
         case SCTP_ASSOC_CHANGE :
             ogs_debug("SCTP_ASSOC_CHANGE:"
@@ -164,7 +183,7 @@ void ngap_recv_handler(ogs_sock_t *sock)
                 ogs_assert(addr);
                 memcpy(addr, &from, sizeof(ogs_sockaddr_t));
 
-                ngap_event_push(AMF_EVENT_NGAP_LO_SCTP_COMM_UP,
+                *e = ngap_event_new(AMF_EVENT_NGAP_LO_SCTP_COMM_UP,
                         sock, addr, NULL,
                         not->sn_assoc_change.sac_inbound_streams,
                         not->sn_assoc_change.sac_outbound_streams);
@@ -180,7 +199,7 @@ void ngap_recv_handler(ogs_sock_t *sock)
                 ogs_assert(addr);
                 memcpy(addr, &from, sizeof(ogs_sockaddr_t));
 
-                ngap_event_push(AMF_EVENT_NGAP_LO_CONNREFUSED,
+                *e = ngap_event_new(AMF_EVENT_NGAP_LO_CONNREFUSED,
                         sock, addr, NULL, 0, 0);
             }
             break;
@@ -193,7 +212,7 @@ void ngap_recv_handler(ogs_sock_t *sock)
             ogs_assert(addr);
             memcpy(addr, &from, sizeof(ogs_sockaddr_t));
 
-            ngap_event_push(AMF_EVENT_NGAP_LO_CONNREFUSED,
+            *e = ngap_event_new(AMF_EVENT_NGAP_LO_CONNREFUSED,
                     sock, addr, NULL, 0, 0);
             break;
 
@@ -228,15 +247,19 @@ void ngap_recv_handler(ogs_sock_t *sock)
                     flags, not->sn_header.sn_type);
             break;
         }
+
+        return OGS_DONE;
     } else if (flags & MSG_EOR) {
-        ogs_pkbuf_trim(pkbuf, size);
+        pkbuf = ogs_pkbuf_alloc(NULL, size);
+        ogs_assert(pkbuf);
+        ogs_pkbuf_put_data(pkbuf, buf->data, size);
 
         addr = ogs_calloc(1, sizeof(ogs_sockaddr_t));
         ogs_assert(addr);
         memcpy(addr, &from, sizeof(ogs_sockaddr_t));
 
-        ngap_event_push(AMF_EVENT_NGAP_MESSAGE, sock, addr, pkbuf, 0, 0);
-        return;
+        *e = ngap_event_new(AMF_EVENT_NGAP_MESSAGE, sock, addr, pkbuf, 0, 0);
+        return OGS_OK;
     } else {
         if (ogs_socket_errno != OGS_EAGAIN) {
             ogs_fatal("ogs_sctp_recvmsg(%d) failed(%d:%s-0x%x)",
@@ -248,5 +271,26 @@ void ngap_recv_handler(ogs_sock_t *sock)
         }
     }
 
-    ogs_pkbuf_free(pkbuf);
+    return OGS_ERROR;
+}
+
+void ngap_recv_handler(ogs_sock_t *sock)
+{
+    ngap_recv_buf_t buf;
+    amf_event_t *batch[NGAP_RECV_BATCH];
+    unsigned int i, n = 0;
+    int rv;
+
+    ogs_assert(sock);
+
+    /* The first read is the one the poller woke us up for */
+    for (i = 0; i < NGAP_RECV_BATCH; i++) {
+        rv = ngap_recv(sock, &buf, i ? MSG_DONTWAIT : 0, &batch[n]);
+        if (batch[n])
+            n++;
+        if (rv != OGS_OK)
+            break;
+    }
+
+    ngap_event_push_bulk(batch, n);
 }
@@ -358,7 +358,7 @@ int hss_db_auth_info(char *imsi_bcd, ogs_dbi_auth_info_t *auth_info)
     return rv;
 }
 
-int hss_db_update_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn)
+int hss_db_advance_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn)
 {
     int rv;
     char *supi = NULL;
@@ -369,7 +369,7 @@ int hss_db_update_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn)
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
-    rv = ogs_dbi_update_sqn(supi, sqn);
+    rv = ogs_dbi_advance_sqn(supi, sqn);
 
     ogs_free(supi);
     ogs_thread_mutex_unlock(&self.db_lock);
@@ -396,39 +396,19 @@ int hss_db_update_imeisv(char *imsi_bcd, char *imeisv)
     return rv;
 }
 
-int hss_db_increment_sqn(char *imsi_bcd)
+int hss_db_subscription_record(char *imsi_bcd, ogs_dbi_record_t *record)
 {
     int rv;
     char *supi = NULL;
 
     ogs_assert(imsi_bcd);
+    ogs_assert(record);
 
     ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
-    rv = ogs_dbi_increment_sqn(supi);
-
-    ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
-
-    return rv;
-}
-
-int hss_db_subscription_data(
-    char *imsi_bcd, ogs_subscription_data_t *subscription_data)
-{
-    int rv;
-    char *supi = NULL;
-
-    ogs_assert(imsi_bcd);
-    ogs_assert(subscription_data);
-
-    ogs_thread_mutex_lock(&self.db_lock);
-    supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
-    ogs_assert(supi);
-
-    rv = ogs_dbi_subscription_data(supi, subscription_data);
+    rv = ogs_dbi_subscription_record(supi, record);
 
     ogs_free(supi);
     ogs_thread_mutex_unlock(&self.db_lock);
@@ -60,12 +60,10 @@ hss_context_t *hss_self(void);
 int hss_context_parse_config(void);
 
 int hss_db_auth_info(char *imsi_bcd, ogs_dbi_auth_info_t *auth_info);
-int hss_db_update_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn);
-int hss_db_increment_sqn(char *imsi_bcd);
+int hss_db_advance_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn);
 int hss_db_update_imeisv(char *imsi_bcd, char *imeisv);
 
-int hss_db_subscription_data(
-    char *imsi_bcd, ogs_subscription_data_t *subscription_data);
+int hss_db_subscription_record(char *imsi_bcd, ogs_dbi_record_t *record);
 
 int hss_db_msisdn_data(
         char *imsi_or_msisdn_bcd, ogs_msisdn_data_t *msisdn_data);
@@ -159,16 +159,13 @@ static int hss_ogs_diam_cx_uar_cb( struct msg **msg, struct avp *avp,
         ogs_assert(ret == 0);
     }
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("User-Authorization-Answer");
-	
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
 
     ogs_free(user_name);
     ogs_free(public_identity);
@@ -392,20 +389,13 @@ static int hss_ogs_diam_cx_mar_cb( struct msg **msg, struct avp *avp,
         }
     }
 
-    rv = hss_db_update_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
+    rv = hss_db_advance_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
     if (rv != OGS_OK) {
         ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
         result_code = OGS_DIAM_CX_ERROR_IN_ASSIGNMENT_TYPE;
         goto out;
     }
 
-    rv = hss_db_increment_sqn(imsi_bcd);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot increment sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_CX_ERROR_IN_ASSIGNMENT_TYPE;
-        goto out;
-    }
-
     milenage_generate(opc, auth_info.amf, auth_info.k,
         ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn), auth_info.rand,
         autn, ik, ck, ak, xres, &xres_len);
@@ -548,17 +538,14 @@ static int hss_ogs_diam_cx_mar_cb( struct msg **msg, struct avp *avp,
     ret = fd_msg_avp_add(ans, MSG_BRW_LAST_CHILD, avp);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Multimedia-Auth-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     if (authentication_scheme)
         ogs_free(authentication_scheme);
 
@@ -808,17 +795,14 @@ static int hss_ogs_diam_cx_sar_cb( struct msg **msg, struct avp *avp,
         }
     }
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Server-Assignment-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     if (user_data)
         ogs_free(user_data);
     ogs_free(user_name);
@@ -929,17 +913,14 @@ static int hss_ogs_diam_cx_lir_cb( struct msg **msg, struct avp *avp,
     ret = fd_msg_avp_add(ans, MSG_BRW_LAST_CHILD, avp);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Location-Info-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     ogs_free(public_identity);
 
 	return 0;
@@ -38,6 +38,13 @@ int hss_initialize(void)
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db.cache.max,
+            ogs_app()->db.cache.ttl, !ogs_app()->db.cache.no_watch);
+    if (rv != OGS_OK) return rv;
+
+    rv = ogs_dbi_sqn_init(ogs_app()->db.sqn.flush_interval);
+    if (rv != OGS_OK) return rv;
+
     rv = hss_fd_init();
     if (rv != OGS_OK) return OGS_ERROR;
 
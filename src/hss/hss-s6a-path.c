@@ -139,20 +139,13 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
         }
     }
 
-    rv = hss_db_update_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
+    rv = hss_db_advance_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
     if (rv != OGS_OK) {
         ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
         result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
         goto out;
     }
 
-    rv = hss_db_increment_sqn(imsi_bcd);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot increment sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-        goto out;
-    }
-
     ret = fd_msg_search_avp(qry, ogs_diam_visited_plmn_id, &avp);
     ogs_assert(ret == 0);
     ret = fd_msg_avp_hdr(avp, &hdr);
@@ -229,17 +222,14 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
             ans, OGS_DIAM_S6A_APPLICATION_ID);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Authentication-Information-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
 	return 0;
 
 out:
@@ -282,7 +272,8 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
 
     int rv;
     uint32_t result_code = 0;
-    ogs_subscription_data_t subscription_data;
+    ogs_dbi_record_t record;
+    ogs_subscription_data_t *subscription_data = &record.subscription_data;
     ogs_slice_data_t *slice_data = NULL;
     struct sockaddr_in sin;
     struct sockaddr_in6 sin6;
@@ -293,8 +284,6 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
 
     ogs_debug("Update-Location-Request");
 
-    memset(&subscription_data, 0, sizeof(ogs_subscription_data_t));
-
     /* Create answer header */
     qry = *msg;
     ret = fd_msg_new_answer_from_req(fd_g_config->cnf_dict, msg, 0);
@@ -308,7 +297,7 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
     ogs_cpystrn(imsi_bcd, (char*)hdr->avp_value->os.data,
         ogs_min(hdr->avp_value->os.len, OGS_MAX_IMSI_BCD_LEN)+1);
 
-    rv = hss_db_subscription_data(imsi_bcd, &subscription_data);
+    rv = hss_db_subscription_record(imsi_bcd, &record);
     if (rv != OGS_OK) {
         ogs_error("Cannot get Subscription-Data for IMSI:'%s'", imsi_bcd);
         result_code = OGS_DIAM_S6A_ERROR_USER_UNKNOWN;
@@ -405,33 +394,33 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
          * bits 8 to 5 of octet n encode digit 2n;
          * bits 4 to 1 of octet n encode digit 2(n-1)+1.
          */
-        if (subscription_data.num_of_msisdn >= 1)  {
+        if (subscription_data->num_of_msisdn >= 1)  {
             ret = fd_msg_avp_new(ogs_diam_s6a_msisdn, 0, &avp_msisdn);
             ogs_assert(ret == 0);
-            val.os.data = subscription_data.msisdn[0].buf;
-            val.os.len = subscription_data.msisdn[0].len;
+            val.os.data = subscription_data->msisdn[0].buf;
+            val.os.len = subscription_data->msisdn[0].len;
             ret = fd_msg_avp_setvalue(avp_msisdn, &val);
             ogs_assert(ret == 0);
             ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_msisdn);
             ogs_assert(ret == 0);
         }
 
-        if (subscription_data.num_of_msisdn >= 2)  {
+        if (subscription_data->num_of_msisdn >= 2)  {
             ret = fd_msg_avp_new(ogs_diam_s6a_a_msisdn, 0, &avp_a_msisdn);
             ogs_assert(ret == 0);
-            val.os.data = subscription_data.msisdn[1].buf;
-            val.os.len = subscription_data.msisdn[1].len;
+            val.os.data = subscription_data->msisdn[1].buf;
+            val.os.len = subscription_data->msisdn[1].len;
             ret = fd_msg_avp_setvalue(avp_a_msisdn, &val);
             ogs_assert(ret == 0);
             ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_a_msisdn);
             ogs_assert(ret == 0);
         }
 
-        if (subscription_data.access_restriction_data) {
+        if (subscription_data->access_restriction_data) {
             ret = fd_msg_avp_new(ogs_diam_s6a_access_restriction_data, 0,
                     &avp_access_restriction_data);
             ogs_assert(ret == 0);
-            val.i32 = subscription_data.access_restriction_data;
+            val.i32 = subscription_data->access_restriction_data;
             ret = fd_msg_avp_setvalue( avp_access_restriction_data, &val);
             ogs_assert(ret == 0);
             ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD,
@@ -442,7 +431,7 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_subscriber_status, 0, &avp_subscriber_status);
         ogs_assert(ret == 0);
-        val.i32 = subscription_data.subscriber_status;
+        val.i32 = subscription_data->subscriber_status;
         ret = fd_msg_avp_setvalue(avp_subscriber_status, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_subscriber_status);
@@ -451,7 +440,7 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(ogs_diam_s6a_network_access_mode, 0,
                     &avp_network_access_mode);
         ogs_assert(ret == 0);
-        val.i32 = subscription_data.network_access_mode;
+        val.i32 = subscription_data->network_access_mode;
         ret = fd_msg_avp_setvalue(avp_network_access_mode, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_network_access_mode);
@@ -463,7 +452,7 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_max_bandwidth_ul, 0, &avp_max_bandwidth_ul);
         ogs_assert(ret == 0);
-        val.u32 = ogs_uint64_to_uint32(subscription_data.ambr.uplink);
+        val.u32 = ogs_uint64_to_uint32(subscription_data->ambr.uplink);
         ret = fd_msg_avp_setvalue(avp_max_bandwidth_ul, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(
@@ -472,7 +461,7 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_max_bandwidth_dl, 0, &avp_max_bandwidth_dl);
         ogs_assert(ret == 0);
-        val.u32 = ogs_uint64_to_uint32(subscription_data.ambr.downlink);
+        val.u32 = ogs_uint64_to_uint32(subscription_data->ambr.downlink);
         ret = fd_msg_avp_setvalue(avp_max_bandwidth_dl, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(
@@ -485,15 +474,15 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_subscribed_rau_tau_timer, 0, &avp_rau_tau_timer);
         ogs_assert(ret == 0);
-        val.i32 = subscription_data.subscribed_rau_tau_timer * 60; /* seconds */
+        val.i32 = subscription_data->subscribed_rau_tau_timer * 60; /* sec */
         ret = fd_msg_avp_setvalue(avp_rau_tau_timer, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_rau_tau_timer);
         ogs_assert(ret == 0);
 
         /* For EPC, we'll use first Slice in Subscription */
-        if (subscription_data.num_of_slice)
-            slice_data = &subscription_data.slice[0];
+        if (subscription_data->num_of_slice)
+            slice_data = &subscription_data->slice[0];
 
         if (!slice_data) {
             ogs_error("[%s] Cannot find S-NSSAI", imsi_bcd);
@@ -822,19 +811,14 @@ static int hss_ogs_diam_s6a_ulr_cb( struct msg **msg, struct avp *avp,
             ans, OGS_DIAM_S6A_APPLICATION_ID);
     ogs_assert(ret == 0);
 
+    ogs_diam_logger_stats_answered(*msg);
+
     /* Send the answer */
     ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Update-Location-Answer");
 
-    /* Add this value to the stats */
-    ogs_assert( pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-    ogs_diam_logger_self()->stats.nb_echoed++;
-    ogs_assert( pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
-    ogs_subscription_data_free(&subscription_data);
-
     return 0;
 
 out:
@@ -858,8 +842,6 @@ out:
     ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
-    ogs_subscription_data_free(&subscription_data);
-
     return 0;
 }
 
@@ -181,20 +181,13 @@ static int hss_ogs_diam_swx_mar_cb( struct msg **msg, struct avp *avp,
         }
     }
 
-    rv = hss_db_update_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
+    rv = hss_db_advance_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
     if (rv != OGS_OK) {
         ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
         result_code = OGS_DIAM_CX_ERROR_IN_ASSIGNMENT_TYPE;
         goto out;
     }
 
-    rv = hss_db_increment_sqn(imsi_bcd);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot increment sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_CX_ERROR_IN_ASSIGNMENT_TYPE;
-        goto out;
-    }
-
     milenage_generate(opc, auth_info.amf, auth_info.k,
         ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn), auth_info.rand,
         autn, ik, ck, ak, xres, &xres_len);
@@ -327,17 +320,14 @@ static int hss_ogs_diam_swx_mar_cb( struct msg **msg, struct avp *avp,
     ret = fd_msg_avp_add(ans, MSG_BRW_LAST_CHILD, avp);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Multimedia-Auth-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     if (authentication_scheme)
         ogs_free(authentication_scheme);
 
@@ -391,7 +381,8 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
 
     char imsi_bcd[OGS_MAX_IMSI_BCD_LEN+1];
 
-    ogs_subscription_data_t subscription_data;
+    ogs_dbi_record_t record;
+    ogs_subscription_data_t *subscription_data = &record.subscription_data;
     ogs_slice_data_t *slice_data = NULL;
     struct sockaddr_in sin;
     struct sockaddr_in6 sin6;
@@ -400,8 +391,6 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
 
     ogs_debug("Server-Assignment-Request");
 
-    memset(&subscription_data, 0, sizeof(ogs_subscription_data_t));
-
 	/* Create answer header */
 	qry = *msg;
 	ret = fd_msg_new_answer_from_req(fd_g_config->cnf_dict, msg, 0);
@@ -421,7 +410,7 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
     ogs_extract_digit_from_string(imsi_bcd, user_name);
 
     /* DB : HSS Subscription Data */
-    rv = hss_db_subscription_data(imsi_bcd, &subscription_data);
+    rv = hss_db_subscription_record(imsi_bcd, &record);
     if (rv != OGS_OK) {
         ogs_error("Cannot get Subscription-Data for IMSI:'%s'", imsi_bcd);
         result_code = OGS_DIAM_S6A_ERROR_USER_UNKNOWN;
@@ -453,7 +442,7 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
         ogs_assert(ret == 0);
 
         /* Set Subscription-Id */
-        if (subscription_data.num_of_msisdn >= 1)  {
+        if (subscription_data->num_of_msisdn >= 1)  {
             ret = fd_msg_avp_new(ogs_diam_subscription_id, 0,
                     &avp_subscription_id);
             ogs_assert(ret == 0);
@@ -471,8 +460,8 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
             ret = fd_msg_avp_new(ogs_diam_subscription_id_data, 0,
                     &avp_subscription_id_data);
             ogs_assert(ret == 0);
-            val.os.data = (uint8_t *)subscription_data.msisdn[0].bcd;
-            val.os.len = strlen(subscription_data.msisdn[0].bcd);
+            val.os.data = (uint8_t *)subscription_data->msisdn[0].bcd;
+            val.os.len = strlen(subscription_data->msisdn[0].bcd);
             ret = fd_msg_avp_setvalue (avp_subscription_id_data, &val);
             ogs_assert(ret == 0);
             ret = fd_msg_avp_add (avp_subscription_id, MSG_BRW_LAST_CHILD,
@@ -510,7 +499,7 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_max_bandwidth_ul, 0, &avp_max_bandwidth_ul);
         ogs_assert(ret == 0);
-        val.u32 = ogs_uint64_to_uint32(subscription_data.ambr.uplink);
+        val.u32 = ogs_uint64_to_uint32(subscription_data->ambr.uplink);
         ret = fd_msg_avp_setvalue(avp_max_bandwidth_ul, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(
@@ -519,7 +508,7 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
         ret = fd_msg_avp_new(
                 ogs_diam_s6a_max_bandwidth_dl, 0, &avp_max_bandwidth_dl);
         ogs_assert(ret == 0);
-        val.u32 = ogs_uint64_to_uint32(subscription_data.ambr.downlink);
+        val.u32 = ogs_uint64_to_uint32(subscription_data->ambr.downlink);
         ret = fd_msg_avp_setvalue(avp_max_bandwidth_dl, &val);
         ogs_assert(ret == 0);
         ret = fd_msg_avp_add(
@@ -529,8 +518,8 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
         ogs_assert(ret == 0);
 
         /* For EPC, we'll use first Slice in Subscription */
-        if (subscription_data.num_of_slice)
-            slice_data = &subscription_data.slice[0];
+        if (subscription_data->num_of_slice)
+            slice_data = &subscription_data->slice[0];
 
         if (!slice_data) {
             ogs_error("[%s] Cannot find S-NSSAI", imsi_bcd);
@@ -840,18 +829,14 @@ static int hss_ogs_diam_swx_sar_cb( struct msg **msg, struct avp *avp,
     ret = fd_msg_avp_add(ans, MSG_BRW_LAST_CHILD, avp);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("Server-Assignment-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
-    ogs_subscription_data_free(&subscription_data);
     ogs_free(user_name);
 
 	return 0;
@@ -878,7 +863,6 @@ out:
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
-    ogs_subscription_data_free(&subscription_data);
     ogs_free(user_name);
 
     return 0;
@@ -54,6 +54,8 @@ int emm_handle_attach_request(mme_ue_t *mme_ue,
     enb_ue = enb_ue_cycle(mme_ue->enb_ue);
     ogs_assert(enb_ue);
 
+    mme_ue->procedure.attach = ogs_get_monotonic_time();
+
     ogs_assert(esm_message_container);
     ogs_assert(esm_message_container->length);
 
@@ -239,6 +241,9 @@ int emm_handle_attach_complete(
 
     ogs_assert(mme_ue);
 
+    mme_metrics_procedure_done(
+            MME_METR_GLOB_HIST_ATTACH, &mme_ue->procedure.attach);
+
     ogs_info("    IMSI[%s]", mme_ue->imsi_bcd);
 
     ogs_gettimeofday(&tv);
@@ -437,6 +442,8 @@ int emm_handle_service_request(
 
     ogs_assert(mme_ue);
 
+    mme_ue->procedure.service_request = ogs_get_monotonic_time();
+
     /* Set EPS Service */
     mme_ue->nas_eps.type = MME_EPS_TYPE_SERVICE_REQUEST;
     mme_ue->nas_eps.ksi = ksi_and_sequence_number->ksi;
@@ -489,6 +496,8 @@ int emm_handle_tau_request(mme_ue_t *mme_ue,
     enb_ue = enb_ue_cycle(mme_ue->enb_ue);
     ogs_assert(enb_ue);
 
+    mme_ue->procedure.tau = ogs_get_monotonic_time();
+
     ogs_assert(pkbuf);
     ogs_assert(pkbuf->data);
     ogs_assert(pkbuf->len);
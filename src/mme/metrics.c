@@ -64,6 +64,27 @@ mme_metrics_spec_def_t mme_metrics_spec_def_global[_MME_METR_GLOB_MAX] = {
     .name = "enb",
     .description = "eNodeBs",
 },
+/* Global Histograms: */
+[MME_METR_GLOB_HIST_ATTACH] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "attach_duration_microseconds",
+    .description = "Attach Request to Attach Complete",
+},
+[MME_METR_GLOB_HIST_TAU] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "tau_duration_microseconds",
+    .description = "Tracking Area Update Request to TAU Accept",
+},
+[MME_METR_GLOB_HIST_SERVICE_REQUEST] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "service_request_duration_microseconds",
+    .description = "Service Request to Initial Context Setup Response",
+},
+[MME_METR_GLOB_HIST_HANDOVER] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "handover_duration_microseconds",
+    .description = "Handover Required to Handover Notify",
+},
 };
 static int mme_metrics_init_inst_global(void)
 {
@@ -75,6 +96,18 @@ static int mme_metrics_free_inst_global(void)
     return mme_metrics_free_inst(mme_metrics_inst_global, _MME_METR_GLOB_MAX);
 }
 
+void mme_metrics_procedure_done(
+        mme_metric_type_global_t t, ogs_time_t *started)
+{
+    ogs_assert(started);
+
+    if (*started) {
+        mme_metrics_inst_global_observe(t,
+                ogs_get_monotonic_time() - *started);
+        *started = 0;
+    }
+}
+
 int mme_metrics_open(void)
 {
     ogs_metrics_context_t *ctx = ogs_metrics_self();
@@ -84,6 +117,9 @@ int mme_metrics_open(void)
             _MME_METR_GLOB_MAX);
 
     mme_metrics_init_inst_global();
+
+    ogs_gtp_xact_metrics_open();
+    ogs_diam_logger_metrics_open();
     return 0;
 }
 
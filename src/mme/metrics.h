@@ -12,6 +12,10 @@ typedef enum mme_metric_type_global_s {
     MME_METR_GLOB_GAUGE_ENB_UE,
     MME_METR_GLOB_GAUGE_MME_SESS,
     MME_METR_GLOB_GAUGE_ENB,
+    MME_METR_GLOB_HIST_ATTACH,
+    MME_METR_GLOB_HIST_TAU,
+    MME_METR_GLOB_HIST_SERVICE_REQUEST,
+    MME_METR_GLOB_HIST_HANDOVER,
     _MME_METR_GLOB_MAX,
 } mme_metric_type_global_t;
 extern ogs_metrics_inst_t *mme_metrics_inst_global[_MME_METR_GLOB_MAX];
@@ -24,6 +28,13 @@ static inline void mme_metrics_inst_global_inc(mme_metric_type_global_t t)
 { ogs_metrics_inst_inc(mme_metrics_inst_global[t]); }
 static inline void mme_metrics_inst_global_dec(mme_metric_type_global_t t)
 { ogs_metrics_inst_dec(mme_metrics_inst_global[t]); }
+static inline void mme_metrics_inst_global_observe(
+        mme_metric_type_global_t t, uint64_t val)
+{ ogs_metrics_inst_observe(mme_metrics_inst_global[t], val); }
+
+/* Observes the time since *started, if set, and clears it */
+void mme_metrics_procedure_done(
+        mme_metric_type_global_t t, ogs_time_t *started);
 
 int mme_metrics_open(void);
 int mme_metrics_close(void);
@@ -371,6 +371,13 @@ struct mme_ue_s {
     ogs_time_t      ue_location_timestamp;
     ogs_plmn_id_t   last_visited_plmn_id;
 
+    struct {
+        ogs_time_t attach;
+        ogs_time_t tau;
+        ogs_time_t service_request;
+        ogs_time_t handover;
+    } procedure;                    /* Start time for the latency metrics */
+
 #define SECURITY_CONTEXT_IS_VALID(__mME) \
     ((__mME) && \
     ((__mME)->security_context_available == 1) && \
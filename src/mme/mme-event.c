@@ -104,12 +104,11 @@ const char *mme_event_get_name(mme_event_t *e)
     return "UNKNOWN_EVENT";
 }
 
-void mme_sctp_event_push(mme_event_e id,
+mme_event_t *mme_sctp_event_new(mme_event_e id,
         void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
         uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams)
 {
     mme_event_t *e = NULL;
-    int rv;
 
     ogs_assert(id);
     ogs_assert(sock);
@@ -123,13 +122,32 @@ void mme_sctp_event_push(mme_event_e id,
     e->max_num_of_istreams = max_num_of_istreams;
     e->max_num_of_ostreams = max_num_of_ostreams;
 
+    return e;
+}
+
+static void sctp_event_discard(mme_event_t *e)
+{
+    ogs_free(e->addr);
+    if (e->pkbuf)
+        ogs_pkbuf_free(e->pkbuf);
+    mme_event_free(e);
+}
+
+void mme_sctp_event_push(mme_event_e id,
+        void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
+        uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams)
+{
+    mme_event_t *e = NULL;
+    int rv;
+
+    e = mme_sctp_event_new(id, sock, addr, pkbuf,
+            max_num_of_istreams, max_num_of_ostreams);
+    ogs_assert(e);
+
     rv = ogs_queue_push(ogs_app()->queue, e);
     if (rv != OGS_OK) {
         ogs_error("ogs_queue_push() failed:%d", (int)rv);
-        ogs_free(e->addr);
-        if (e->pkbuf)
-            ogs_pkbuf_free(e->pkbuf);
-        mme_event_free(e);
+        sctp_event_discard(e);
     }
 #if HAVE_USRSCTP
     else {
@@ -137,3 +155,33 @@ void mme_sctp_event_push(mme_event_e id,
     }
 #endif
 }
+
+/*
+ * Pushes the events read in one wakeup with a single queue operation.
+ * If the queue is full, the rest go through ogs_queue_push() one by
+ * one and block like mme_sctp_event_push(), so no message is dropped
+ * unless the queue has been terminated.
+ */
+void mme_sctp_event_push_bulk(mme_event_t **e, unsigned int n)
+{
+    unsigned int i, pushed;
+    int rv;
+
+    if (!n)
+        return;
+
+    pushed = ogs_queue_trypush_bulk(ogs_app()->queue, (void **)e, n);
+    for (i = pushed; i < n; i++) {
+        rv = ogs_queue_push(ogs_app()->queue, e[i]);
+        if (rv != OGS_OK) {
+            ogs_error("ogs_queue_push() failed:%d", (int)rv);
+            sctp_event_discard(e[i]);
+        } else {
+            pushed++;
+        }
+    }
+#if HAVE_USRSCTP
+    if (pushed)
+        ogs_pollset_notify(ogs_app()->pollset);
+#endif
+}
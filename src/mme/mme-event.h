@@ -110,9 +110,13 @@ void mme_event_timeout(void *data);
 
 const char *mme_event_get_name(mme_event_t *e);
 
+mme_event_t *mme_sctp_event_new(mme_event_e id,
+        void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
+        uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams);
 void mme_sctp_event_push(mme_event_e id,
         void *sock, ogs_sockaddr_t *addr, ogs_pkbuf_t *pkbuf,
         uint16_t max_num_of_istreams, uint16_t max_num_of_ostreams);
+void mme_sctp_event_push_bulk(mme_event_t **e, unsigned int n);
 
 #ifdef __cplusplus
 }
@@ -570,6 +570,8 @@ int nas_eps_send_tau_accept(
     } else
         ogs_assert_if_reached();
 
+    mme_metrics_procedure_done(MME_METR_GLOB_HIST_TAU, &mme_ue->procedure.tau);
+
     return rv;
 }
 
@@ -690,6 +690,9 @@ void s1ap_handle_initial_context_setup_response(
     mme_ue = enb_ue->mme_ue;
     ogs_expect_or_return(mme_ue);
 
+    mme_metrics_procedure_done(MME_METR_GLOB_HIST_SERVICE_REQUEST,
+            &mme_ue->procedure.service_request);
+
     if (E_RABSetupListCtxtSURes) {
         int uli_presence = 0;
 
@@ -2243,6 +2246,8 @@ void s1ap_handle_handover_required(mme_enb_t *enb, ogs_s1ap_message_t *message)
     mme_ue = source_ue->mme_ue;
     ogs_expect_or_return(mme_ue);
 
+    mme_ue->procedure.handover = ogs_get_monotonic_time();
+
     if (!SECURITY_CONTEXT_IS_VALID(mme_ue)) {
         ogs_error("No Security Context");
         ogs_assert(OGS_OK ==
@@ -2937,6 +2942,9 @@ void s1ap_handle_handover_notification(
             ogs_plmn_id_hexdump(&target_ue->saved.e_cgi.plmn_id),
             target_ue->saved.e_cgi.cell_id);
 
+    mme_metrics_procedure_done(
+            MME_METR_GLOB_HIST_HANDOVER, &mme_ue->procedure.handover);
+
     /* Copy Stream-No/TAI/ECGI from enb_ue */
     mme_ue->enb_ostream_id = target_ue->enb_ostream_id;
     memcpy(&mme_ue->tai, &target_ue->saved.tai, sizeof(ogs_eps_tai_t));
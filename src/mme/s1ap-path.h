@@ -30,6 +30,8 @@ extern "C" {
 #define S1AP_NON_UE_SIGNALLING   0
 
 #define s1ap_event_push  mme_sctp_event_push
+#define s1ap_event_new   mme_sctp_event_new
+#define s1ap_event_push_bulk mme_sctp_event_push_bulk
 
 int s1ap_open(void);
 void s1ap_close(void);
@@ -26,6 +26,7 @@ int __pcf_log_domain;
 static OGS_POOL(pcf_ue_pool, pcf_ue_t);
 static OGS_POOL(pcf_sess_pool, pcf_sess_t);
 static OGS_POOL(pcf_app_pool, pcf_app_t);
+static OGS_POOL(pcf_dbi_xact_pool, pcf_dbi_xact_t);
 
 static int context_initialized = 0;
 
@@ -45,8 +46,10 @@ void pcf_context_init(void)
     ogs_pool_init(&pcf_ue_pool, ogs_app()->max.ue);
     ogs_pool_init(&pcf_sess_pool, ogs_app()->pool.sess);
     ogs_pool_init(&pcf_app_pool, ogs_app()->pool.sess);
+    ogs_pool_init(&pcf_dbi_xact_pool, ogs_app()->db.worker.max);
 
     ogs_list_init(&self.pcf_ue_list);
+    ogs_list_init(&self.dbi_xact_list);
 
     self.supi_hash = ogs_hash_make();
     ogs_assert(self.supi_hash);
@@ -62,6 +65,7 @@ void pcf_context_final(void)
 {
     ogs_assert(context_initialized == 1);
 
+    pcf_dbi_xact_remove_all();
     pcf_ue_remove_all();
 
     ogs_assert(self.supi_hash);
@@ -71,6 +75,7 @@ void pcf_context_final(void)
     ogs_assert(self.ipv6prefix_hash);
     ogs_hash_destroy(self.ipv6prefix_hash);
 
+    ogs_pool_final(&pcf_dbi_xact_pool);
     ogs_pool_final(&pcf_app_pool);
     ogs_pool_final(&pcf_sess_pool);
     ogs_pool_final(&pcf_ue_pool);
@@ -565,3 +570,57 @@ pcf_app_t *pcf_app_find_by_app_session_id(char *app_session_id)
     ogs_assert(app_session_id);
     return pcf_app_find(atoll(app_session_id));
 }
+
+pcf_dbi_xact_t *pcf_dbi_xact_add(pcf_ue_t *pcf_ue, ogs_sbi_stream_t *stream)
+{
+    pcf_dbi_xact_t *xact = NULL;
+
+    ogs_assert(pcf_ue);
+    ogs_assert(pcf_ue->supi);
+    ogs_assert(stream);
+
+    ogs_pool_alloc(&pcf_dbi_xact_pool, &xact);
+    if (!xact) {
+        ogs_error("[%s] Maximum number of DB requests [%d] reached",
+                pcf_ue->supi, ogs_app()->db.worker.max);
+        return NULL;
+    }
+    memset(xact, 0, sizeof *xact);
+
+    xact->job.data = xact;
+
+    xact->stream = stream;
+    xact->server = ogs_sbi_server_from_stream(stream);
+    ogs_assert(xact->server);
+
+    /* The UE context may be removed before the DB worker completes */
+    xact->supi = ogs_strdup(pcf_ue->supi);
+    ogs_assert(xact->supi);
+
+    xact->pcf_ue = pcf_ue;
+
+    ogs_list_add(&self.dbi_xact_list, xact);
+
+    return xact;
+}
+
+void pcf_dbi_xact_remove(pcf_dbi_xact_t *xact)
+{
+    ogs_assert(xact);
+
+    ogs_list_remove(&self.dbi_xact_list, xact);
+
+    ogs_subscription_data_free(&xact->subscription_data);
+
+    ogs_free(xact->supi);
+
+    ogs_pool_free(&pcf_dbi_xact_pool, xact);
+}
+
+void pcf_dbi_xact_remove_all(void)
+{
+    pcf_dbi_xact_t *xact = NULL, *next_xact = NULL;
+
+    ogs_list_for_each_safe(&self.dbi_xact_list, next_xact, xact)
+        pcf_dbi_xact_remove(xact);
+}
@@ -44,6 +44,8 @@ typedef struct pcf_context_s {
 
     ogs_hash_t      *ipv4addr_hash;
     ogs_hash_t      *ipv6prefix_hash;
+
+    ogs_list_t      dbi_xact_list;
 } pcf_context_t;
 
 struct pcf_ue_s {
@@ -135,6 +137,26 @@ typedef struct pcf_app_s {
     pcf_sess_t *sess;
 } pcf_app_t;
 
+typedef bool (*pcf_dbi_xact_handler_t)(pcf_dbi_xact_t *xact);
+
+/* DB request running in a DB worker thread */
+struct pcf_dbi_xact_s {
+    ogs_lnode_t lnode;
+
+    ogs_dbi_job_t job;
+
+    ogs_sbi_stream_t *stream;
+    ogs_sbi_server_t *server;
+
+    char *supi;
+    ogs_subscription_data_t subscription_data;
+
+    pcf_dbi_xact_handler_t done;
+
+    /* Related Context */
+    pcf_ue_t *pcf_ue;
+};
+
 void pcf_context_init(void);
 void pcf_context_final(void);
 pcf_context_t *pcf_self(void);
@@ -173,6 +195,10 @@ void pcf_app_remove_all(pcf_sess_t *sess);
 pcf_app_t *pcf_app_find(uint32_t index);
 pcf_app_t *pcf_app_find_by_app_session_id(char *app_session_id);
 
+pcf_dbi_xact_t *pcf_dbi_xact_add(pcf_ue_t *pcf_ue, ogs_sbi_stream_t *stream);
+void pcf_dbi_xact_remove(pcf_dbi_xact_t *xact);
+void pcf_dbi_xact_remove_all(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PCF_DBI_PATH_H
+#define PCF_DBI_PATH_H
+
+#include "context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int pcf_dbi_open(void);
+void pcf_dbi_close(void);
+
+bool pcf_dbi_submit(pcf_dbi_xact_t *xact,
+        ogs_dbi_job_handler_t run, pcf_dbi_xact_handler_t done);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PCF_DBI_PATH_H */
@@ -50,6 +50,9 @@ const char *pcf_event_get_name(pcf_event_t *e)
     case OGS_EVENT_SBI_TIMER:
         return OGS_EVENT_NAME_SBI_TIMER;
 
+    case PCF_EVENT_DBI_COMPLETE:
+        return "PCF_EVENT_DBI_COMPLETE";
+
     default:
         break;
     }
@@ -29,6 +29,16 @@ extern "C" {
 typedef struct pcf_ue_s pcf_ue_t;
 typedef struct pcf_sess_s pcf_sess_t;
 typedef struct pcf_app_s pcf_app_t;
+typedef struct pcf_dbi_xact_s pcf_dbi_xact_t;
+
+typedef enum {
+    PCF_EVENT_BASE = OGS_MAX_NUM_OF_PROTO_EVENT,
+
+    PCF_EVENT_DBI_COMPLETE,
+
+    MAX_NUM_OF_PCF_EVENT,
+
+} pcf_event_e;
 
 typedef struct pcf_event_s {
     ogs_event_t h;
@@ -36,6 +46,8 @@ typedef struct pcf_event_s {
     pcf_ue_t *pcf_ue;
     pcf_sess_t *sess;
     pcf_app_t *app;
+
+    pcf_dbi_xact_t *dbi_xact;
 } pcf_event_t;
 
 pcf_event_t *pcf_event_new(int id);
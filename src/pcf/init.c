@@ -18,6 +18,7 @@
  */
 
 #include "sbi-path.h"
+#include "dbi-path.h"
 
 static ogs_thread_t *thread;
 static void pcf_main(void *data);
@@ -44,6 +45,13 @@ int pcf_initialize()
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db.cache.max,
+            ogs_app()->db.cache.ttl, !ogs_app()->db.cache.no_watch);
+    if (rv != OGS_OK) return rv;
+
+    rv = pcf_dbi_open();
+    if (rv != OGS_OK) return rv;
+
     rv = pcf_sbi_open();
     if (rv != OGS_OK) return rv;
 
@@ -86,6 +94,7 @@ void pcf_terminate(void)
     ogs_timer_delete(t_termination_holding);
 
     pcf_sbi_close();
+    pcf_dbi_close();
 
     ogs_dbi_final();
 
@@ -18,37 +18,192 @@
  */
 
 #include "sbi-path.h"
+#include "dbi-path.h"
 
 #include "nudr-handler.h"
 
-bool pcf_nudr_dr_handle_query_am_data(
-    pcf_ue_t *pcf_ue, ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+/* Called in a DB worker thread */
+static void subscription_data_run(ogs_dbi_job_t *job)
 {
-    int rv, status = 0;
+    pcf_dbi_xact_t *xact = NULL;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    job->rv = ogs_dbi_subscription_data(xact->supi, &xact->subscription_data);
+}
+
+bool pcf_nudr_dr_handle_dbi_complete(pcf_dbi_xact_t *xact)
+{
+    ogs_assert(xact);
+    ogs_assert(xact->stream);
+    ogs_assert(xact->done);
+
+    if (!pcf_ue_cycle(xact->pcf_ue)) {
+        ogs_error("[%s] UE Context has already been removed", xact->supi);
+        return false;
+    }
+
+    if (xact->job.rv == OGS_TIMEUP) {
+        ogs_error("[%s] DB request timed out", xact->supi);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(xact->stream,
+                OGS_SBI_HTTP_STATUS_GATEWAY_TIMEOUT,
+                NULL, "DB request timed out", xact->supi));
+        return false;
+    }
+
+    if (xact->job.rv != OGS_OK) {
+        ogs_error("[%s] Cannot find SUPI in DB", xact->supi);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(xact->stream,
+                OGS_SBI_HTTP_STATUS_NOT_FOUND,
+                NULL, "Cannot find SUPI in DB", xact->supi));
+        return false;
+    }
+
+    return xact->done(xact);
+}
+
+static bool query_am_data_done(pcf_dbi_xact_t *xact)
+{
+    int status = 0;
     char *strerror = NULL;
+
+    pcf_ue_t *pcf_ue = NULL;
+    ogs_sbi_stream_t *stream = NULL;
     ogs_sbi_server_t *server = NULL;
 
     ogs_sbi_message_t sendmsg;
     ogs_sbi_header_t header;
     ogs_sbi_response_t *response = NULL;
 
-    ogs_subscription_data_t subscription_data;
+    ogs_subscription_data_t *subscription_data = NULL;
+
+    OpenAPI_policy_association_t PolicyAssociation;
+    OpenAPI_ambr_t UeAmbr;
+    OpenAPI_list_t *TriggerList = NULL;
 
+    ogs_assert(xact);
+    pcf_ue = xact->pcf_ue;
     ogs_assert(pcf_ue);
+    stream = xact->stream;
     ogs_assert(stream);
-    server = ogs_sbi_server_from_stream(stream);
+    server = xact->server;
     ogs_assert(server);
 
-    ogs_assert(recvmsg);
+    subscription_data = &xact->subscription_data;
+
+    if (!pcf_ue->policy_association_request) {
+        strerror = ogs_msprintf("[%s] No PolicyAssociationRequest",
+                pcf_ue->supi);
+        status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
+        goto cleanup;
+    }
+
+    if (!subscription_data->ambr.uplink &&
+            !subscription_data->ambr.downlink) {
+        strerror = ogs_msprintf("[%s] No UE-AMBR", pcf_ue->supi);
+        status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        goto cleanup;
+    }
+
+    memset(&PolicyAssociation, 0, sizeof(PolicyAssociation));
+    PolicyAssociation.request = pcf_ue->policy_association_request;
+    PolicyAssociation.supp_feat =
+        ogs_uint64_to_string(pcf_ue->am_policy_control_features);
+    ogs_assert(PolicyAssociation.supp_feat);
+
+    TriggerList = OpenAPI_list_create();
+    ogs_assert(TriggerList);
+
+    memset(&UeAmbr, 0, sizeof(UeAmbr));
+    if (OGS_SBI_FEATURES_IS_SET(pcf_ue->am_policy_control_features,
+                OGS_SBI_NPCF_AM_POLICY_CONTROL_UE_AMBR_AUTHORIZATION)) {
+        if (pcf_ue->subscribed_ue_ambr) {
+            ogs_bitrate_t subscribed_ue_ambr;
+
+            subscribed_ue_ambr.uplink = ogs_sbi_bitrate_from_string(
+                    pcf_ue->subscribed_ue_ambr->uplink);
+            subscribed_ue_ambr.downlink = ogs_sbi_bitrate_from_string(
+                    pcf_ue->subscribed_ue_ambr->downlink);
+
+            if (((subscribed_ue_ambr.uplink / 1024) !=
+                 (subscription_data->ambr.uplink / 1024)) ||
+                ((subscribed_ue_ambr.downlink / 1024) !=
+                 (subscription_data->ambr.downlink / 1024))) {
+
+                OpenAPI_list_add(TriggerList,
+                        (void *)OpenAPI_request_trigger_UE_AMBR_CH);
+            }
+
+            UeAmbr.uplink = ogs_sbi_bitrate_to_string(
+                    subscription_data->ambr.uplink, OGS_SBI_BITRATE_KBPS);
+            UeAmbr.downlink = ogs_sbi_bitrate_to_string(
+                    subscription_data->ambr.downlink, OGS_SBI_BITRATE_KBPS);
+            PolicyAssociation.ue_ambr = &UeAmbr;
+        }
+    }
+
+    if (TriggerList->count)
+        PolicyAssociation.triggers = TriggerList;
+
+    memset(&header, 0, sizeof(header));
+    header.service.name =
+        (char *)OGS_SBI_SERVICE_NAME_NPCF_AM_POLICY_CONTROL;
+    header.api.version = (char *)OGS_SBI_API_V1;
+    header.resource.component[0] =
+        (char *)OGS_SBI_RESOURCE_NAME_POLICIES;
+    header.resource.component[1] = pcf_ue->association_id;
+
+    memset(&sendmsg, 0, sizeof(sendmsg));
+    sendmsg.PolicyAssociation = &PolicyAssociation;
+    sendmsg.http.location = ogs_sbi_server_uri(server, &header);
+
+    response = ogs_sbi_build_response(
+            &sendmsg, OGS_SBI_HTTP_STATUS_CREATED);
+    ogs_assert(response);
+    ogs_assert(true == ogs_sbi_server_send_response(stream, response));
+
+    ogs_free(sendmsg.http.location);
+
+    ogs_free(PolicyAssociation.supp_feat);
+
+    OpenAPI_list_free(TriggerList);
+
+    if (UeAmbr.uplink)
+        ogs_free(UeAmbr.uplink);
+    if (UeAmbr.downlink)
+        ogs_free(UeAmbr.downlink);
+
+    return true;
+
+cleanup:
+    ogs_assert(strerror);
+    ogs_assert(status);
+    ogs_error("%s", strerror);
+    ogs_assert(true ==
+        ogs_sbi_server_send_error(stream, status, NULL, strerror, NULL));
+    ogs_free(strerror);
+
+    return false;
+}
 
-    memset(&subscription_data, 0, sizeof(ogs_subscription_data_t));
+bool pcf_nudr_dr_handle_query_am_data(
+    pcf_ue_t *pcf_ue, ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+{
+    int status = 0;
+    char *strerror = NULL;
+
+    pcf_dbi_xact_t *xact = NULL;
+
+    ogs_assert(pcf_ue);
+    ogs_assert(stream);
+    ogs_assert(recvmsg);
 
     SWITCH(recvmsg->h.resource.component[3])
     CASE(OGS_SBI_RESOURCE_NAME_AM_DATA)
-        OpenAPI_policy_association_t PolicyAssociation;
-        OpenAPI_ambr_t UeAmbr;
-        OpenAPI_list_t *TriggerList = NULL;
-
         if (!recvmsg->AmPolicyData) {
             strerror = ogs_msprintf("[%s] No AmPolicyData", pcf_ue->supi);
             status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
@@ -62,96 +217,29 @@ bool pcf_nudr_dr_handle_query_am_data(
             goto cleanup;
         }
 
-        rv = ogs_dbi_subscription_data(pcf_ue->supi, &subscription_data);
-        if (rv != OGS_OK) {
-            strerror = ogs_msprintf("[%s] Cannot find SUPI in DB",
+        xact = pcf_dbi_xact_add(pcf_ue, stream);
+        if (!xact) {
+            strerror = ogs_msprintf("[%s] Too many DB requests",
                     pcf_ue->supi);
-            status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+            status = OGS_SBI_HTTP_STATUS_SERVICE_UNAVAILABLE;
             goto cleanup;
         }
 
-        if (!subscription_data.ambr.uplink &&
-                !subscription_data.ambr.downlink) {
-            ogs_error("[%s] No UE-AMBR", pcf_ue->supi);
-            status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        if (pcf_dbi_submit(xact,
+                    subscription_data_run, query_am_data_done) == false) {
+            pcf_dbi_xact_remove(xact);
+            strerror = ogs_msprintf("[%s] Cannot submit DB request",
+                    pcf_ue->supi);
+            status = OGS_SBI_HTTP_STATUS_SERVICE_UNAVAILABLE;
             goto cleanup;
         }
 
-        memset(&PolicyAssociation, 0, sizeof(PolicyAssociation));
-        PolicyAssociation.request = pcf_ue->policy_association_request;
-        PolicyAssociation.supp_feat =
-            ogs_uint64_to_string(pcf_ue->am_policy_control_features);
-        ogs_assert(PolicyAssociation.supp_feat);
-
-        TriggerList = OpenAPI_list_create();
-        ogs_assert(TriggerList);
-
-        memset(&UeAmbr, 0, sizeof(UeAmbr));
-        if (OGS_SBI_FEATURES_IS_SET(pcf_ue->am_policy_control_features,
-                    OGS_SBI_NPCF_AM_POLICY_CONTROL_UE_AMBR_AUTHORIZATION)) {
-            if (pcf_ue->subscribed_ue_ambr) {
-                ogs_bitrate_t subscribed_ue_ambr;
-
-                subscribed_ue_ambr.uplink = ogs_sbi_bitrate_from_string(
-                        pcf_ue->subscribed_ue_ambr->uplink);
-                subscribed_ue_ambr.downlink = ogs_sbi_bitrate_from_string(
-                        pcf_ue->subscribed_ue_ambr->downlink);
-
-                if (((subscribed_ue_ambr.uplink / 1024) !=
-                     (subscription_data.ambr.uplink / 1024)) ||
-                    ((subscribed_ue_ambr.downlink / 1024) !=
-                     (subscription_data.ambr.downlink / 1024))) {
-
-                    OpenAPI_list_add(TriggerList,
-                            (void *)OpenAPI_request_trigger_UE_AMBR_CH);
-                }
-
-                UeAmbr.uplink = ogs_sbi_bitrate_to_string(
-                        subscription_data.ambr.uplink, OGS_SBI_BITRATE_KBPS);
-                UeAmbr.downlink = ogs_sbi_bitrate_to_string(
-                        subscription_data.ambr.downlink, OGS_SBI_BITRATE_KBPS);
-                PolicyAssociation.ue_ambr = &UeAmbr;
-            }
-        }
-
-        if (TriggerList->count)
-            PolicyAssociation.triggers = TriggerList;
-
-        memset(&header, 0, sizeof(header));
-        header.service.name =
-            (char *)OGS_SBI_SERVICE_NAME_NPCF_AM_POLICY_CONTROL;
-        header.api.version = (char *)OGS_SBI_API_V1;
-        header.resource.component[0] =
-            (char *)OGS_SBI_RESOURCE_NAME_POLICIES;
-        header.resource.component[1] = pcf_ue->association_id;
-
-        memset(&sendmsg, 0, sizeof(sendmsg));
-        sendmsg.PolicyAssociation = &PolicyAssociation;
-        sendmsg.http.location = ogs_sbi_server_uri(server, &header);
-
-        response = ogs_sbi_build_response(
-                &sendmsg, OGS_SBI_HTTP_STATUS_CREATED);
-        ogs_assert(response);
-        ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-        ogs_free(sendmsg.http.location);
-
-        ogs_free(PolicyAssociation.supp_feat);
-
-        OpenAPI_list_free(TriggerList);
-
-        if (UeAmbr.uplink)
-            ogs_free(UeAmbr.uplink);
-        if (UeAmbr.downlink)
-            ogs_free(UeAmbr.downlink);
-
-        ogs_subscription_data_free(&subscription_data);
-
         return true;
 
     DEFAULT
-        strerror = ogs_msprintf("[%s] Invalid resource name [%s]", 
+        strerror = ogs_msprintf("[%s] Invalid resource name [%s]",
                         pcf_ue->supi, recvmsg->h.resource.component[3]);
+        status = OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED;
     END
 
 cleanup:
@@ -162,8 +250,6 @@ cleanup:
         ogs_sbi_server_send_error(stream, status, recvmsg, strerror, NULL));
     ogs_free(strerror);
 
-    ogs_subscription_data_free(&subscription_data);
-
     return false;
 }
 
@@ -32,6 +32,8 @@ bool pcf_nudr_dr_handle_query_am_data(
 bool pcf_nudr_dr_handle_query_sm_data(
     pcf_sess_t *sess, ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg);
 
+bool pcf_nudr_dr_handle_dbi_complete(pcf_dbi_xact_t *xact);
+
 #ifdef __cplusplus
 }
 #endif
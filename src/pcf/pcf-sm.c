@@ -19,6 +19,7 @@
 
 #include "sbi-path.h"
 #include "nnrf-handler.h"
+#include "nudr-handler.h"
 
 void pcf_state_initial(ogs_fsm_t *s, pcf_event_t *e)
 {
@@ -55,6 +56,8 @@ void pcf_state_operational(ogs_fsm_t *s, pcf_event_t *e)
     pcf_sess_t *sess = NULL;
     pcf_app_t *app_session = NULL;
 
+    pcf_dbi_xact_t *dbi_xact = NULL;
+
     pcf_sm_debug(e);
 
     ogs_assert(s);
@@ -644,6 +647,14 @@ void pcf_state_operational(ogs_fsm_t *s, pcf_event_t *e)
         }
         break;
 
+    case PCF_EVENT_DBI_COMPLETE:
+        dbi_xact = e->dbi_xact;
+        ogs_assert(dbi_xact);
+
+        pcf_nudr_dr_handle_dbi_complete(dbi_xact);
+        pcf_dbi_xact_remove(dbi_xact);
+        break;
+
     default:
         ogs_error("No handler for event %s", pcf_event_get_name(e));
         break;
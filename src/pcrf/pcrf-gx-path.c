@@ -591,17 +591,14 @@ static int pcrf_gx_ccr_cb( struct msg **msg, struct avp *avp,
         state_cleanup(sess_data, NULL, NULL);
     }
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("[Credit-Control-Answer]");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) ==0);
-
     ogs_session_data_free(&gx_message.session_data);
 
     return 0;
@@ -985,15 +982,12 @@ int pcrf_gx_send_rar(
     ogs_assert(ret == 0);
     ogs_assert(sess_data == NULL);
     
+    ogs_diam_logger_stats_sent(req);
+
     /* Send the request */
     ret = fd_msg_send(&req, pcrf_gx_raa_cb, svg);
     ogs_assert(ret == 0);
 
-    /* Increment the counter */
-    ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-    ogs_diam_logger_self()->stats.nb_sent++;
-    ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     /* Set no error */
     rx_message->result_code = ER_DIAMETER_SUCCESS;
 
@@ -1095,30 +1089,9 @@ static void pcrf_gx_raa_cb(void *data, struct msg **msg)
     }
 
     /* Free the message */
-    ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
     dur = ((ts.tv_sec - sess_data->ts.tv_sec) * 1000000) + 
         ((ts.tv_nsec - sess_data->ts.tv_nsec) / 1000);
-    if (ogs_diam_logger_self()->stats.nb_recv) {
-        /* Ponderate in the avg */
-        ogs_diam_logger_self()->stats.avg = (ogs_diam_logger_self()->stats.avg * 
-            ogs_diam_logger_self()->stats.nb_recv + dur) /
-            (ogs_diam_logger_self()->stats.nb_recv + 1);
-        /* Min, max */
-        if (dur < ogs_diam_logger_self()->stats.shortest)
-            ogs_diam_logger_self()->stats.shortest = dur;
-        if (dur > ogs_diam_logger_self()->stats.longest)
-            ogs_diam_logger_self()->stats.longest = dur;
-    } else {
-        ogs_diam_logger_self()->stats.shortest = dur;
-        ogs_diam_logger_self()->stats.longest = dur;
-        ogs_diam_logger_self()->stats.avg = dur;
-    }
-    if (error)
-        ogs_diam_logger_self()->stats.nb_errs++;
-    else 
-        ogs_diam_logger_self()->stats.nb_recv++;
-
-    ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
+    ogs_diam_logger_stats_received(*msg, dur, error);
     
     /* Display how long it took */
     if (ts.tv_nsec > sess_data->ts.tv_nsec)
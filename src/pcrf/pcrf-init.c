@@ -38,6 +38,10 @@ int pcrf_initialize(void)
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db.cache.max,
+            ogs_app()->db.cache.ttl, !ogs_app()->db.cache.no_watch);
+    if (rv != OGS_OK) return rv;
+
     rv = pcrf_fd_init();
     if (rv != OGS_OK) return OGS_ERROR;
 
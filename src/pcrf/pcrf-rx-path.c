@@ -368,17 +368,14 @@ static int pcrf_rx_aar_cb( struct msg **msg, struct avp *avp,
     ogs_assert(ret == 0);
     ogs_assert(sess_data == NULL);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("[PCRF] AA-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     ogs_ims_data_free(&rx_message.ims_data);
     
     return 0;
@@ -508,15 +505,12 @@ int pcrf_rx_send_asr(uint8_t *rx_sid, uint32_t abort_cause)
     ogs_assert(ret == 0);
     ogs_assert(sess_data == NULL);
     
+    ogs_diam_logger_stats_sent(req);
+
     /* Send the request */
     ret = fd_msg_send(&req, pcrf_rx_asa_cb, svg);
     ogs_assert(ret == 0);
 
-    /* Increment the counter */
-    ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-    ogs_diam_logger_self()->stats.nb_sent++;
-    ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     return OGS_OK;
 }
 
@@ -688,17 +682,14 @@ static int pcrf_rx_str_cb( struct msg **msg, struct avp *avp,
 	ret = fd_msg_rescode_set(ans, (char *)"DIAMETER_SUCCESS", NULL, NULL, 1);
     ogs_assert(ret == 0);
 
+	ogs_diam_logger_stats_answered(*msg);
+
 	/* Send the answer */
 	ret = fd_msg_send(msg, NULL, NULL);
     ogs_assert(ret == 0);
 
     ogs_debug("[PCRF] Session-Termination-Answer");
 
-	/* Add this value to the stats */
-	ogs_assert(pthread_mutex_lock(&ogs_diam_logger_self()->stats_lock) == 0);
-	ogs_diam_logger_self()->stats.nb_echoed++;
-	ogs_assert(pthread_mutex_unlock(&ogs_diam_logger_self()->stats_lock) == 0);
-
     state_cleanup(sess_data, NULL, NULL);
     ogs_ims_data_free(&rx_message.ims_data);
     
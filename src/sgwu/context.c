@@ -42,7 +42,7 @@ void sgwu_context_init(void)
     ogs_pfcp_self()->up_function_features_len = 2;
 
     ogs_list_init(&self.sess_list);
-    ogs_pool_init(&sgwu_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_init_growable(&sgwu_sess_pool, ogs_app()->pool.sess);
 
     self.seid_hash = ogs_hash_make();
     ogs_assert(self.seid_hash);
@@ -19,6 +19,7 @@
 
 #include "gtp-path.h"
 #include "pfcp-path.h"
+#include "metrics.h"
 
 #define SGWU_GTP_HANDLED     1
 
@@ -63,6 +64,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (gtp_h->version != OGS_GTP2_VERSION_1) {
         ogs_error("[DROP] Invalid GTPU version [%d]", gtp_h->version);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
 
@@ -122,12 +124,14 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (len < 0) {
         ogs_error("[DROP] Cannot decode GTPU packet");
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
     if (gtp_h->type != OGS_GTPU_MSGTYPE_END_MARKER &&
         pkbuf->len <= len) {
         ogs_error("[DROP] Small GTPU packet(type:%d len:%d)", gtp_h->type, len);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
     ogs_assert(ogs_pkbuf_pull(pkbuf, len));
@@ -164,6 +168,8 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     } else if (gtp_h->type == OGS_GTPU_MSGTYPE_ERR_IND) {
         ogs_pfcp_far_t *far = NULL;
 
+        sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_RX_ERROR_INDICATION);
+
         far = ogs_pfcp_far_find_by_error_indication(pkbuf);
         if (far) {
             ogs_assert(true ==
@@ -194,6 +200,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         pfcp_object = ogs_pfcp_object_find_by_teid(teid);
         if (!pfcp_object) {
             /* TODO : Send Error Indication */
+            sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_NO_SESSION);
             goto cleanup;
         }
 
@@ -225,6 +232,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
             if (!pdr) {
                 /* TODO : Send Error Indication */
+                sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_NO_PDR);
                 goto cleanup;
             }
 
@@ -235,6 +243,14 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         }
 
         ogs_assert(pdr);
+
+        if (pdr->src_if == OGS_PFCP_INTERFACE_ACCESS)
+            sgwu_metrics_inst_global_packet(
+                    SGWU_METR_GLOB_CTR_S1U_RX_PACKETS, pkbuf->len);
+        else if (pdr->src_if == OGS_PFCP_INTERFACE_CORE)
+            sgwu_metrics_inst_global_packet(
+                    SGWU_METR_GLOB_CTR_S5U_RX_PACKETS, pkbuf->len);
+
         ogs_assert(true == ogs_pfcp_up_handle_pdr(
                                 pdr, gtp_h->type, pkbuf, &report));
 
@@ -253,6 +269,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     } else {
         ogs_error("[DROP] Invalid GTPU Type [%d]", gtp_h->type);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        sgwu_metrics_inst_global_inc(SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU);
     }
 
 cleanup:
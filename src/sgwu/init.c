@@ -20,6 +20,7 @@
 #include "context.h"
 #include "gtp-path.h"
 #include "pfcp-path.h"
+#include "metrics.h"
 
 static ogs_thread_t *thread;
 static void sgwu_main(void *data);
@@ -30,6 +31,7 @@ int sgwu_initialize()
 {
     int rv;
 
+    ogs_metrics_context_init();
     ogs_gtp_context_init(OGS_MAX_NUM_OF_GTPU_RESOURCE);
     ogs_pfcp_context_init();
 
@@ -46,6 +48,9 @@ int sgwu_initialize()
     rv = ogs_pfcp_context_parse_config("sgwu", "sgwc");
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_metrics_context_parse_config();
+    if (rv != OGS_OK) return rv;
+
     rv = sgwu_context_parse_config();
     if (rv != OGS_OK) return rv;
 
@@ -53,6 +58,9 @@ int sgwu_initialize()
             ogs_app()->logger.domain, ogs_app()->logger.level);
     if (rv != OGS_OK) return rv;
 
+    rv = sgwu_metrics_open();
+    if (rv != 0) return OGS_ERROR;
+
     rv = sgwu_pfcp_open();
     if (rv != OGS_OK) return rv;
 
@@ -77,11 +85,13 @@ void sgwu_terminate(void)
 
     sgwu_pfcp_close();
     sgwu_gtp_close();
+    sgwu_metrics_close();
 
     sgwu_context_final();
 
     ogs_pfcp_context_final();
     ogs_gtp_context_final();
+    ogs_metrics_context_final();
 
     ogs_pfcp_xact_final();
 
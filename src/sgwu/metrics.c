@@ -0,0 +1,185 @@
+#include "ogs-app.h"
+#include "context.h"
+
+#include "metrics.h"
+
+typedef struct sgwu_metrics_spec_def_s {
+    unsigned int type;
+    const char *name;
+    const char *description;
+    int initial_val;
+    unsigned int num_labels;
+    const char **labels;
+} sgwu_metrics_spec_def_t;
+
+/* Helper generic functions: */
+static int sgwu_metrics_init_inst(ogs_metrics_inst_t **inst, ogs_metrics_spec_t **specs,
+        unsigned int len, unsigned int num_labels, const char **labels)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        inst[i] = ogs_metrics_inst_new(specs[i], num_labels, labels);
+    return OGS_OK;
+}
+
+static int sgwu_metrics_free_inst(ogs_metrics_inst_t **inst,
+        unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        ogs_metrics_inst_free(inst[i]);
+    memset(inst, 0, sizeof(inst[0]) * len);
+    return OGS_OK;
+}
+
+static int sgwu_metrics_init_spec(ogs_metrics_context_t *ctx,
+        ogs_metrics_spec_t **dst, sgwu_metrics_spec_def_t *src, unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++) {
+        dst[i] = ogs_metrics_spec_new(ctx, src[i].type,
+                src[i].name, src[i].description,
+                src[i].initial_val, src[i].num_labels, src[i].labels);
+    }
+    return OGS_OK;
+}
+
+/* GLOBAL */
+ogs_metrics_spec_t *sgwu_metrics_spec_global[_SGWU_METR_GLOB_MAX];
+ogs_metrics_inst_t *sgwu_metrics_inst_global[_SGWU_METR_GLOB_MAX];
+sgwu_metrics_spec_def_t sgwu_metrics_spec_def_global[_SGWU_METR_GLOB_MAX] = {
+/* Global Counters: */
+[SGWU_METR_GLOB_CTR_S1U_RX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s1u_rx_packets",
+    .description = "GTP-U packets received on S1-U",
+},
+[SGWU_METR_GLOB_CTR_S1U_RX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s1u_rx_bytes",
+    .description = "Payload bytes received on S1-U",
+},
+[SGWU_METR_GLOB_CTR_S1U_TX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s1u_tx_packets",
+    .description = "GTP-U packets sent on S1-U",
+},
+[SGWU_METR_GLOB_CTR_S1U_TX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s1u_tx_bytes",
+    .description = "Payload bytes sent on S1-U",
+},
+[SGWU_METR_GLOB_CTR_S5U_RX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s5u_rx_packets",
+    .description = "GTP-U packets received on S5/S8-U",
+},
+[SGWU_METR_GLOB_CTR_S5U_RX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s5u_rx_bytes",
+    .description = "Payload bytes received on S5/S8-U",
+},
+[SGWU_METR_GLOB_CTR_S5U_TX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s5u_tx_packets",
+    .description = "GTP-U packets sent on S5/S8-U",
+},
+[SGWU_METR_GLOB_CTR_S5U_TX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "s5u_tx_bytes",
+    .description = "Payload bytes sent on S5/S8-U",
+},
+[SGWU_METR_GLOB_CTR_DROP_NO_SESSION] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_no_session",
+    .description = "Packets dropped with no matching session or TEID",
+},
+[SGWU_METR_GLOB_CTR_DROP_NO_PDR] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_no_pdr",
+    .description = "Packets dropped with no matching PDR",
+},
+[SGWU_METR_GLOB_CTR_DROP_BUFFER_FULL] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_buffer_full",
+    .description = "Downlink packets dropped on a full buffer",
+},
+[SGWU_METR_GLOB_CTR_DROP_BUFFER_EXPIRED] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_buffer_expired",
+    .description = "Downlink packets dropped on buffering timeout",
+},
+[SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_invalid_gtpu",
+    .description = "GTP-U packets dropped due to an invalid header",
+},
+[SGWU_METR_GLOB_CTR_RX_ERROR_INDICATION] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "rx_error_indication",
+    .description = "Received GTP-U Error Indication messages",
+},
+/* Global Gauges: */
+[SGWU_METR_GLOB_GAUGE_BUFFERED_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_GAUGE,
+    .name = "buffered_packets",
+    .description = "Downlink packets held in buffers",
+},
+[SGWU_METR_GLOB_GAUGE_BUFFERED_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_GAUGE,
+    .name = "buffered_bytes",
+    .description = "Memory held by buffered downlink packets",
+},
+};
+static int sgwu_metrics_init_inst_global(void)
+{
+    return sgwu_metrics_init_inst(sgwu_metrics_inst_global, sgwu_metrics_spec_global,
+                _SGWU_METR_GLOB_MAX, 0, NULL);
+}
+static int sgwu_metrics_free_inst_global(void)
+{
+    return sgwu_metrics_free_inst(sgwu_metrics_inst_global, _SGWU_METR_GLOB_MAX);
+}
+
+int sgwu_metrics_open(void)
+{
+    ogs_metrics_context_t *ctx = ogs_metrics_self();
+    ogs_metrics_context_open(ctx);
+
+    sgwu_metrics_init_spec(ctx, sgwu_metrics_spec_global, sgwu_metrics_spec_def_global,
+            _SGWU_METR_GLOB_MAX);
+
+    sgwu_metrics_init_inst_global();
+
+    /* Counted by lib/pfcp when forwarding and buffering */
+    ogs_pfcp_self()->metrics.access_tx_packets =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_S1U_TX_PACKETS];
+    ogs_pfcp_self()->metrics.access_tx_bytes =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_S1U_TX_BYTES];
+    ogs_pfcp_self()->metrics.core_tx_packets =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_S5U_TX_PACKETS];
+    ogs_pfcp_self()->metrics.core_tx_bytes =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_S5U_TX_BYTES];
+    ogs_pfcp_self()->metrics.buffered_packets =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_GAUGE_BUFFERED_PACKETS];
+    ogs_pfcp_self()->metrics.buffer_full =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_DROP_BUFFER_FULL];
+    ogs_pfcp_self()->metrics.buffered_bytes =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_GAUGE_BUFFERED_BYTES];
+    ogs_pfcp_self()->metrics.buffer_expired =
+        sgwu_metrics_inst_global[SGWU_METR_GLOB_CTR_DROP_BUFFER_EXPIRED];
+
+    ogs_pfcp_xact_metrics_open();
+    return 0;
+}
+
+int sgwu_metrics_close(void)
+{
+    ogs_metrics_context_t *ctx = ogs_metrics_self();
+
+    memset(&ogs_pfcp_self()->metrics, 0, sizeof(ogs_pfcp_self()->metrics));
+
+    sgwu_metrics_free_inst_global();
+    ogs_metrics_context_close(ctx);
+    return OGS_OK;
+}
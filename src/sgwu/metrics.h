@@ -0,0 +1,56 @@
+#ifndef SGWU_METRICS_H
+#define SGWU_METRICS_H
+
+#include "ogs-metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* GLOBAL */
+typedef enum sgwu_metric_type_global_s {
+    SGWU_METR_GLOB_CTR_S1U_RX_PACKETS = 0,
+    SGWU_METR_GLOB_CTR_S1U_RX_BYTES,
+    SGWU_METR_GLOB_CTR_S1U_TX_PACKETS,
+    SGWU_METR_GLOB_CTR_S1U_TX_BYTES,
+    SGWU_METR_GLOB_CTR_S5U_RX_PACKETS,
+    SGWU_METR_GLOB_CTR_S5U_RX_BYTES,
+    SGWU_METR_GLOB_CTR_S5U_TX_PACKETS,
+    SGWU_METR_GLOB_CTR_S5U_TX_BYTES,
+    SGWU_METR_GLOB_CTR_DROP_NO_SESSION,
+    SGWU_METR_GLOB_CTR_DROP_NO_PDR,
+    SGWU_METR_GLOB_CTR_DROP_BUFFER_FULL,
+    SGWU_METR_GLOB_CTR_DROP_BUFFER_EXPIRED,
+    SGWU_METR_GLOB_CTR_DROP_INVALID_GTPU,
+    SGWU_METR_GLOB_CTR_RX_ERROR_INDICATION,
+    SGWU_METR_GLOB_GAUGE_BUFFERED_PACKETS,
+    SGWU_METR_GLOB_GAUGE_BUFFERED_BYTES,
+    _SGWU_METR_GLOB_MAX,
+} sgwu_metric_type_global_t;
+extern ogs_metrics_inst_t *sgwu_metrics_inst_global[_SGWU_METR_GLOB_MAX];
+
+static inline void sgwu_metrics_inst_global_set(sgwu_metric_type_global_t t, int val)
+{ ogs_metrics_inst_set(sgwu_metrics_inst_global[t], val); }
+static inline void sgwu_metrics_inst_global_add(sgwu_metric_type_global_t t, int val)
+{ ogs_metrics_inst_add(sgwu_metrics_inst_global[t], val); }
+static inline void sgwu_metrics_inst_global_inc(sgwu_metric_type_global_t t)
+{ ogs_metrics_inst_inc(sgwu_metrics_inst_global[t]); }
+static inline void sgwu_metrics_inst_global_dec(sgwu_metric_type_global_t t)
+{ ogs_metrics_inst_dec(sgwu_metrics_inst_global[t]); }
+
+/* Counts a packet of len bytes, the _BYTES entry follows _PACKETS */
+static inline void sgwu_metrics_inst_global_packet(
+        sgwu_metric_type_global_t packets, int len)
+{
+    ogs_metrics_inst_inc(sgwu_metrics_inst_global[packets]);
+    ogs_metrics_inst_add(sgwu_metrics_inst_global[packets+1], len);
+}
+
+int sgwu_metrics_open(void);
+int sgwu_metrics_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SGWU_METRICS_H */
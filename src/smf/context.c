@@ -81,11 +81,11 @@ void smf_context_init(void)
     ogs_log_install_domain(&__gsm_log_domain, "gsm", ogs_core()->log.level);
 
     ogs_pool_init(&smf_gtp_node_pool, ogs_app()->pool.nf);
-    ogs_pool_init(&smf_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&smf_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&smf_bearer_pool, ogs_app()->pool.bearer);
+    ogs_pool_init_growable(&smf_ue_pool, ogs_app()->max.ue);
+    ogs_pool_init_growable(&smf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_init_growable(&smf_bearer_pool, ogs_app()->pool.bearer);
 
-    ogs_pool_init(&smf_pf_pool,
+    ogs_pool_init_growable(&smf_pf_pool,
             ogs_app()->pool.bearer * OGS_MAX_NUM_OF_FLOW_IN_BEARER);
 
     self.supi_hash = ogs_hash_make();
@@ -1003,40 +1003,61 @@ static bool compare_ue_info(ogs_pfcp_node_t *node, smf_sess_t *sess)
     return false;
 }
 
-static ogs_pfcp_node_t *selected_upf_node(
-        ogs_pfcp_node_t *current, smf_sess_t *sess)
+/*
+ * Smooth weighted round-robin over the associated UPFs. The weight comes
+ * from the configured capacity and the load and overload reported by
+ * the UPF. With equal weights, this is plain round-robin.
+ */
+static ogs_pfcp_node_t *weighted_upf_node(smf_sess_t *sess, bool ue_info)
 {
-    ogs_pfcp_node_t *next, *node;
+    ogs_pfcp_node_t *node = NULL, *selected = NULL;
+    bool weighted = false;
+    int64_t total = 0;
+    int weight;
 
-    ogs_assert(current);
-    ogs_assert(sess);
+    ogs_list_for_each(&ogs_pfcp_self()->pfcp_peer_list, node) {
+        if (!OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated)) continue;
+        if (ue_info && compare_ue_info(node, sess) == false) continue;
 
-    /* continue search from current position */
-    next = ogs_list_next(current);
-    for (node = next; node; node = ogs_list_next(node)) {
-        if (OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated) &&
-            compare_ue_info(node, sess) == true) return node;
+        if (ogs_pfcp_node_weight(node) > 0) {
+            weighted = true;
+            break;
+        }
     }
-    /* cyclic search from top to current position */
-    for (node = ogs_list_first(&ogs_pfcp_self()->pfcp_peer_list);
-            node != next; node = ogs_list_next(node)) {
-        if (OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated) &&
-            compare_ue_info(node, sess) == true) return node;
+
+    ogs_list_for_each(&ogs_pfcp_self()->pfcp_peer_list, node) {
+        if (!OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated)) continue;
+        if (ue_info && compare_ue_info(node, sess) == false) continue;
+
+        /* If all UPFs are saturated, they are used evenly */
+        weight = weighted ? ogs_pfcp_node_weight(node) : 1;
+        if (weight == 0) continue;
+
+        node->current_weight += weight;
+        total += weight;
+
+        if (!selected || node->current_weight > selected->current_weight)
+            selected = node;
     }
 
+    if (selected)
+        selected->current_weight -= total;
+
+    return selected;
+}
+
+static ogs_pfcp_node_t *selected_upf_node(smf_sess_t *sess)
+{
+    ogs_pfcp_node_t *node = NULL;
+
+    ogs_assert(sess);
+
+    node = weighted_upf_node(sess, true);
+    if (node) return node;
+
     if (ogs_app()->parameter.no_pfcp_rr_select == 0) {
-        /* continue search from current position */
-        next = ogs_list_next(current);
-        for (node = next; node; node = ogs_list_next(node)) {
-            if (OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated))
-                return node;
-        }
-        /* cyclic search from top to current position */
-        for (node = ogs_list_first(&ogs_pfcp_self()->pfcp_peer_list);
-                node != next; node = ogs_list_next(node)) {
-            if (OGS_FSM_CHECK(&node->sm, smf_pfcp_state_associated))
-                return node;
-        }
+        node = weighted_upf_node(sess, false);
+        if (node) return node;
     }
 
     ogs_error("No UPFs are PFCP associated that are suited to RR");
@@ -1049,21 +1070,17 @@ void smf_sess_select_upf(smf_sess_t *sess)
 
     ogs_assert(sess);
 
-    /*
-     * When used for the first time, if last node is set,
-     * the search is performed from the first UPF in a round-robin manner.
-     */
-    if (ogs_pfcp_self()->pfcp_node == NULL)
-        ogs_pfcp_self()->pfcp_node =
-            ogs_list_last(&ogs_pfcp_self()->pfcp_peer_list);
+    if (sess->pfcp_node)
+        ogs_pfcp_node_sess_dec(sess->pfcp_node);
 
     /* setup GTP session with selected UPF */
-    ogs_pfcp_self()->pfcp_node =
-        selected_upf_node(ogs_pfcp_self()->pfcp_node, sess);
+    ogs_pfcp_self()->pfcp_node = selected_upf_node(sess);
     ogs_assert(ogs_pfcp_self()->pfcp_node);
     OGS_SETUP_PFCP_NODE(sess, ogs_pfcp_self()->pfcp_node);
-    ogs_debug("UE using UPF on IP[%s]",
-            OGS_ADDR(&ogs_pfcp_self()->pfcp_node->addr, buf));
+    ogs_pfcp_node_sess_inc(sess->pfcp_node);
+    ogs_debug("UE using UPF on IP[%s] (%d sessions)",
+            OGS_ADDR(&ogs_pfcp_self()->pfcp_node->addr, buf),
+            sess->pfcp_node->num_of_sess);
 }
 
 smf_sess_t *smf_sess_add_by_apn(smf_ue_t *smf_ue, char *apn, uint8_t rat_type)
@@ -1615,6 +1632,9 @@ void smf_sess_remove(smf_sess_t *sess)
         OGS_PCC_RULE_FREE(&sess->policy.pcc_rule[i]);
     sess->policy.num_of_pcc_rule = 0;
 
+    if (sess->pfcp_node)
+        ogs_pfcp_node_sess_dec(sess->pfcp_node);
+
     if (sess->ipv4) {
         ogs_hash_set(self.ipv4_hash, sess->ipv4->addr, OGS_IPV4_LEN, NULL);
         ogs_pfcp_ue_ip_free(sess->ipv4);
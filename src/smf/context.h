@@ -222,6 +222,12 @@ typedef struct smf_sess_s {
         uint32_t s6b_sta_err; /* S6B CCA RXed error code */
     } sm_data;
 
+    struct {
+        ogs_time_t establishment;
+        ogs_time_t modification;
+        ogs_time_t release;
+    } procedure;                    /* Start time for the latency metrics */
+
     bool            epc;            /**< EPC or 5GC */
 
     ogs_pfcp_sess_t pfcp;           /* PFCP session context */
@@ -242,6 +242,9 @@ void smf_gsm_state_initial(ogs_fsm_t *s, smf_event_t *e)
         sess->sm_data.gy_ccr_init_in_flight = false;
         sess->sm_data.gx_cca_init_err = ER_DIAMETER_SUCCESS;
         sess->sm_data.gy_cca_init_err = ER_DIAMETER_SUCCESS;
+
+        /* The session is created by its first request */
+        sess->procedure.establishment = ogs_get_monotonic_time();
         break;
 
     case OGS_FSM_EXIT_SIG:
@@ -721,6 +724,9 @@ void smf_gsm_state_wait_pfcp_establishment(ogs_fsm_t *s, smf_event_t *e)
                 smf_namf_comm_send_n1_n2_message_transfer(sess, &param);
             }
 
+            smf_metrics_procedure_done(
+                    SMF_METR_GLOB_HIST_PDU_SESSION_ESTABLISHMENT,
+                    &sess->procedure.establishment);
             OGS_FSM_TRAN(s, &smf_gsm_state_operational);
             break;
 
@@ -970,6 +976,7 @@ void smf_gsm_state_operational(ogs_fsm_t *s, smf_event_t *e)
 
         switch (nas_message->gsm.h.message_type) {
         case OGS_NAS_5GS_PDU_SESSION_MODIFICATION_REQUEST:
+            sess->procedure.modification = ogs_get_monotonic_time();
             rv = gsm_handle_pdu_session_modification_request(sess, stream,
                     &nas_message->gsm.pdu_session_modification_request);
             if (rv != OGS_OK) {
@@ -980,10 +987,14 @@ void smf_gsm_state_operational(ogs_fsm_t *s, smf_event_t *e)
             break;
 
         case OGS_NAS_5GS_PDU_SESSION_MODIFICATION_COMPLETE:
+            smf_metrics_procedure_done(
+                    SMF_METR_GLOB_HIST_PDU_SESSION_MODIFICATION,
+                    &sess->procedure.modification);
             ogs_assert(true == ogs_sbi_send_http_status_no_content(stream));
             break;
 
         case OGS_NAS_5GS_PDU_SESSION_RELEASE_REQUEST:
+            sess->procedure.release = ogs_get_monotonic_time();
             if (sess->policy_association_id) {
                 smf_npcf_smpolicycontrol_param_t param;
 
@@ -1543,6 +1554,9 @@ void smf_gsm_state_wait_5gc_n1_n2_release(ogs_fsm_t *s, smf_event_t *e)
 
         switch (nas_message->gsm.h.message_type) {
         case OGS_NAS_5GS_PDU_SESSION_RELEASE_COMPLETE:
+            smf_metrics_procedure_done(
+                    SMF_METR_GLOB_HIST_PDU_SESSION_RELEASE,
+                    &sess->procedure.release);
             ogs_assert(true == ogs_sbi_send_http_status_no_content(stream));
             ogs_assert(true == smf_sbi_send_sm_context_status_notify(sess));
             OGS_FSM_TRAN(s, &smf_gsm_state_session_will_release);
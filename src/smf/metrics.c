@@ -115,6 +115,22 @@ smf_metrics_spec_def_t smf_metrics_spec_def_global[_SMF_METR_GLOB_MAX] = {
     .name = "gtp_peers_active",
     .description = "Active GTP peers",
 },
+/* Global Histograms: */
+[SMF_METR_GLOB_HIST_PDU_SESSION_ESTABLISHMENT] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "pdu_session_establishment_duration_microseconds",
+    .description = "PDU Session establishment latency",
+},
+[SMF_METR_GLOB_HIST_PDU_SESSION_MODIFICATION] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "pdu_session_modification_duration_microseconds",
+    .description = "UE requested PDU Session modification latency",
+},
+[SMF_METR_GLOB_HIST_PDU_SESSION_RELEASE] = {
+    .type = OGS_METRICS_METRIC_TYPE_HISTOGRAM,
+    .name = "pdu_session_release_duration_microseconds",
+    .description = "UE requested PDU Session release latency",
+},
 };
 static int smf_metrics_init_inst_global(void)
 {
@@ -177,6 +193,18 @@ int smf_metrics_free_inst_gtp_node(ogs_metrics_inst_t **inst)
     return smf_metrics_free_inst(inst, _SMF_METR_GTP_NODE_MAX);
 }
 
+void smf_metrics_procedure_done(
+        smf_metric_type_global_t t, ogs_time_t *started)
+{
+    ogs_assert(started);
+
+    if (*started) {
+        smf_metrics_inst_global_observe(t,
+                ogs_get_monotonic_time() - *started);
+        *started = 0;
+    }
+}
+
 int smf_metrics_open(void)
 {
     ogs_metrics_context_t *ctx = ogs_metrics_self();
@@ -189,6 +217,12 @@ int smf_metrics_open(void)
             _SMF_METR_GTP_NODE_MAX);
 
     smf_metrics_init_inst_global();
+
+    ogs_gtp_xact_metrics_open();
+    ogs_pfcp_xact_metrics_open();
+    ogs_pfcp_node_metrics_open();
+    ogs_sbi_client_metrics_open();
+    ogs_diam_logger_metrics_open();
     return 0;
 }
 
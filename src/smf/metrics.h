@@ -22,6 +22,9 @@ typedef enum smf_metric_type_global_s {
     SMF_METR_GLOB_GAUGE_GTP1_PDPCTXS_ACTIVE,
     SMF_METR_GLOB_GAUGE_GTP2_SESSIONS_ACTIVE,
     SMF_METR_GLOB_GAUGE_GTP_PEERS_ACTIVE,
+    SMF_METR_GLOB_HIST_PDU_SESSION_ESTABLISHMENT,
+    SMF_METR_GLOB_HIST_PDU_SESSION_MODIFICATION,
+    SMF_METR_GLOB_HIST_PDU_SESSION_RELEASE,
     _SMF_METR_GLOB_MAX,
 } smf_metric_type_global_t;
 extern ogs_metrics_inst_t *smf_metrics_inst_global[_SMF_METR_GLOB_MAX];
@@ -34,6 +37,13 @@ static inline void smf_metrics_inst_global_inc(smf_metric_type_global_t t)
 { ogs_metrics_inst_inc(smf_metrics_inst_global[t]); }
 static inline void smf_metrics_inst_global_dec(smf_metric_type_global_t t)
 { ogs_metrics_inst_dec(smf_metrics_inst_global[t]); }
+static inline void smf_metrics_inst_global_observe(
+        smf_metric_type_global_t t, uint64_t val)
+{ ogs_metrics_inst_observe(smf_metrics_inst_global[t], val); }
+
+/* Observes the time since *started, if set, and clears it */
+void smf_metrics_procedure_done(
+        smf_metric_type_global_t t, ogs_time_t *started);
 
 /* GTP NODE */
 typedef enum smf_metric_type_gtp_node_s {
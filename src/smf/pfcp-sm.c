@@ -222,6 +222,13 @@ void smf_pfcp_state_associated(ogs_fsm_t *s, smf_event_t *e)
         case OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE:
             if (!message->h.seid_presence) ogs_error("No SEID");
 
+            ogs_pfcp_cp_handle_load_control_information(node,
+                &message->pfcp_session_establishment_response.
+                    load_control_information);
+            ogs_pfcp_cp_handle_overload_control_information(node,
+                &message->pfcp_session_establishment_response.
+                    overload_control_information);
+
             if (!sess) {
                 ogs_gtp_xact_t *gtp_xact = xact->assoc_xact;
                 if (!gtp_xact) {
@@ -244,6 +251,13 @@ void smf_pfcp_state_associated(ogs_fsm_t *s, smf_event_t *e)
         case OGS_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE:
             if (!message->h.seid_presence) ogs_error("No SEID");
 
+            ogs_pfcp_cp_handle_load_control_information(node,
+                &message->pfcp_session_modification_response.
+                    load_control_information);
+            ogs_pfcp_cp_handle_overload_control_information(node,
+                &message->pfcp_session_modification_response.
+                    overload_control_information);
+
             if (xact->epc)
                 smf_epc_n4_handle_session_modification_response(
                     sess, xact, e->gtp2_message,
@@ -256,6 +270,13 @@ void smf_pfcp_state_associated(ogs_fsm_t *s, smf_event_t *e)
         case OGS_PFCP_SESSION_DELETION_RESPONSE_TYPE:
             if (!message->h.seid_presence) ogs_error("No SEID");
 
+            ogs_pfcp_cp_handle_load_control_information(node,
+                &message->pfcp_session_deletion_response.
+                    load_control_information);
+            ogs_pfcp_cp_handle_overload_control_information(node,
+                &message->pfcp_session_deletion_response.
+                    overload_control_information);
+
             if (!sess) {
                 ogs_gtp_xact_t *gtp_xact = xact->assoc_xact;
                 if (!gtp_xact) {
@@ -278,6 +299,13 @@ void smf_pfcp_state_associated(ogs_fsm_t *s, smf_event_t *e)
         case OGS_PFCP_SESSION_REPORT_REQUEST_TYPE:
             if (!message->h.seid_presence) ogs_error("No SEID");
 
+            ogs_pfcp_cp_handle_load_control_information(node,
+                &message->pfcp_session_report_request.
+                    load_control_information);
+            ogs_pfcp_cp_handle_overload_control_information(node,
+                &message->pfcp_session_report_request.
+                    overload_control_information);
+
             smf_n4_handle_session_report_request(
                 sess, xact, &message->pfcp_session_report_request);
             break;
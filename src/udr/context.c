@@ -23,8 +23,13 @@ static udr_context_t self;
 
 int __udr_log_domain;
 
+static OGS_POOL(udr_dbi_xact_pool, udr_dbi_xact_t);
+
 static int context_initialized = 0;
 
+static void message_copy(ogs_sbi_message_t *dst, ogs_sbi_message_t *src);
+static void message_free(ogs_sbi_message_t *message);
+
 void udr_context_init(void)
 {
     ogs_assert(context_initialized == 0);
@@ -35,6 +40,9 @@ void udr_context_init(void)
     ogs_log_install_domain(&__ogs_dbi_domain, "dbi", ogs_core()->log.level);
     ogs_log_install_domain(&__udr_log_domain, "udr", ogs_core()->log.level);
 
+    ogs_pool_init(&udr_dbi_xact_pool, ogs_app()->db.worker.max);
+    ogs_list_init(&self.dbi_xact_list);
+
     context_initialized = 1;
 }
 
@@ -42,6 +50,10 @@ void udr_context_final(void)
 {
     ogs_assert(context_initialized == 1);
 
+    udr_dbi_xact_remove_all();
+
+    ogs_pool_final(&udr_dbi_xact_pool);
+
     context_initialized = 0;
 }
 
@@ -99,3 +111,111 @@ int udr_context_parse_config(void)
 
     return OGS_OK;
 }
+
+udr_dbi_xact_t *udr_dbi_xact_add(
+        ogs_sbi_stream_t *stream, ogs_sbi_message_t *message, char *supi)
+{
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(stream);
+    ogs_assert(message);
+    ogs_assert(supi);
+
+    ogs_pool_alloc(&udr_dbi_xact_pool, &xact);
+    if (!xact) {
+        ogs_error("[%s] Maximum number of DB requests [%d] reached",
+                supi, ogs_app()->db.worker.max);
+        return NULL;
+    }
+    memset(xact, 0, sizeof *xact);
+
+    xact->job.data = xact;
+    xact->stream = stream;
+
+    message_copy(&xact->message, message);
+
+    xact->supi = ogs_strdup(supi);
+    ogs_assert(xact->supi);
+
+    ogs_list_add(&self.dbi_xact_list, xact);
+
+    return xact;
+}
+
+void udr_dbi_xact_remove(udr_dbi_xact_t *xact)
+{
+    ogs_assert(xact);
+
+    ogs_list_remove(&self.dbi_xact_list, xact);
+
+    ogs_subscription_data_free(&xact->subscription_data);
+
+    ogs_free(xact->supi);
+    message_free(&xact->message);
+
+    ogs_pool_free(&udr_dbi_xact_pool, xact);
+}
+
+void udr_dbi_xact_remove_all(void)
+{
+    udr_dbi_xact_t *xact = NULL, *next_xact = NULL;
+
+    ogs_list_for_each_safe(&self.dbi_xact_list, next_xact, xact)
+        udr_dbi_xact_remove(xact);
+}
+
+/*
+ * Only the header and URL query parameters are copied.
+ * The JSON body must be handled before the DB request is submitted.
+ */
+static void message_copy(ogs_sbi_message_t *dst, ogs_sbi_message_t *src)
+{
+    int i;
+
+    ogs_assert(dst);
+    ogs_assert(src);
+
+    memset(dst, 0, sizeof(*dst));
+
+    if (src->h.method)
+        dst->h.method = ogs_strdup(src->h.method);
+    if (src->h.uri)
+        dst->h.uri = ogs_strdup(src->h.uri);
+    if (src->h.service.name)
+        dst->h.service.name = ogs_strdup(src->h.service.name);
+    if (src->h.api.version)
+        dst->h.api.version = ogs_strdup(src->h.api.version);
+    for (i = 0; i < OGS_SBI_MAX_NUM_OF_RESOURCE_COMPONENT &&
+                src->h.resource.component[i]; i++)
+        dst->h.resource.component[i] =
+            ogs_strdup(src->h.resource.component[i]);
+
+    if (src->param.dnn)
+        dst->param.dnn = ogs_strdup(src->param.dnn);
+    memcpy(&dst->param.s_nssai, &src->param.s_nssai,
+            sizeof(dst->param.s_nssai));
+    dst->param.single_nssai_presence = src->param.single_nssai_presence;
+    dst->param.snssai_presence = src->param.snssai_presence;
+}
+
+static void message_free(ogs_sbi_message_t *message)
+{
+    int i;
+
+    ogs_assert(message);
+
+    if (message->h.method)
+        ogs_free(message->h.method);
+    if (message->h.uri)
+        ogs_free(message->h.uri);
+    if (message->h.service.name)
+        ogs_free(message->h.service.name);
+    if (message->h.api.version)
+        ogs_free(message->h.api.version);
+    for (i = 0; i < OGS_SBI_MAX_NUM_OF_RESOURCE_COMPONENT &&
+                message->h.resource.component[i]; i++)
+        ogs_free(message->h.resource.component[i]);
+
+    if (message->param.dnn)
+        ogs_free(message->param.dnn);
+}
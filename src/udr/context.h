@@ -38,14 +38,54 @@ extern int __udr_log_domain;
 #define OGS_LOG_DOMAIN __udr_log_domain
 
 typedef struct udr_context_s {
+    ogs_list_t dbi_xact_list;
 } udr_context_t;
 
+typedef bool (*udr_dbi_xact_handler_t)(udr_dbi_xact_t *xact);
+
+/*
+ * DB request running in a DB worker thread.
+ *
+ * The SBI request is released when its stream is closed. The transaction
+ * keeps its own copy of the message header and parameters, so that the
+ * response can still be built after the DB worker completes.
+ *
+ * `stream` stays valid until the response is sent : if the peer resets
+ * it in the meantime, the server keeps it as an orphan and drops the
+ * response.
+ */
+struct udr_dbi_xact_s {
+    ogs_lnode_t lnode;
+
+    ogs_dbi_job_t job;
+
+    ogs_sbi_stream_t *stream;
+    ogs_sbi_message_t message;
+
+    char *supi;
+    uint64_t sqn;
+
+    /* Set by job.run() if the DB request fails */
+    int status;
+    const char *title;
+
+    ogs_dbi_auth_info_t auth_info;
+    ogs_subscription_data_t subscription_data;
+
+    udr_dbi_xact_handler_t done;
+};
+
 void udr_context_init(void);
 void udr_context_final(void);
 udr_context_t *udr_self(void);
 
 int udr_context_parse_config(void);
 
+udr_dbi_xact_t *udr_dbi_xact_add(
+        ogs_sbi_stream_t *stream, ogs_sbi_message_t *message, char *supi);
+void udr_dbi_xact_remove(udr_dbi_xact_t *xact);
+void udr_dbi_xact_remove_all(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dbi-path.h"
+
+static void complete_cb(ogs_dbi_job_t *job)
+{
+    udr_dbi_xact_t *xact = NULL;
+    udr_event_t *e = NULL;
+    int rv;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    e = udr_event_new(UDR_EVENT_DBI_COMPLETE);
+    ogs_assert(e);
+    e->dbi_xact = xact;
+
+    rv = ogs_queue_push(ogs_app()->queue, e);
+    if (rv != OGS_OK) {
+        /* 'xact' is released in udr_context_final() */
+        ogs_error("ogs_queue_push() failed:%d", (int)rv);
+        ogs_event_free(e);
+    } else {
+        ogs_pollset_notify(ogs_app()->pollset);
+    }
+}
+
+int udr_dbi_open(void)
+{
+    return ogs_dbi_worker_init(
+            ogs_app()->db.worker.num, ogs_app()->db.worker.max,
+            ogs_app()->db.worker.timeout, complete_cb);
+}
+
+void udr_dbi_close(void)
+{
+    ogs_dbi_worker_final();
+}
+
+bool udr_dbi_submit(udr_dbi_xact_t *xact,
+        ogs_dbi_job_handler_t run, udr_dbi_xact_handler_t done)
+{
+    int rv;
+
+    ogs_assert(xact);
+    ogs_assert(run);
+    ogs_assert(done);
+
+    xact->job.run = run;
+    xact->done = done;
+
+    rv = ogs_dbi_worker_submit(&xact->job);
+    if (rv != OGS_OK) {
+        ogs_error("[%s] ogs_dbi_worker_submit() failed [%d]", xact->supi, rv);
+        return false;
+    }
+
+    return true;
+}
@@ -50,6 +50,9 @@ const char *udr_event_get_name(udr_event_t *e)
     case OGS_EVENT_SBI_TIMER:
         return OGS_EVENT_NAME_SBI_TIMER;
 
+    case UDR_EVENT_DBI_COMPLETE:
+        return "UDR_EVENT_DBI_COMPLETE";
+
     default:
         break;
     }
@@ -26,8 +26,21 @@
 extern "C" {
 #endif
 
+typedef struct udr_dbi_xact_s udr_dbi_xact_t;
+
+typedef enum {
+    UDR_EVENT_BASE = OGS_MAX_NUM_OF_PROTO_EVENT,
+
+    UDR_EVENT_DBI_COMPLETE,
+
+    MAX_NUM_OF_UDR_EVENT,
+
+} udr_event_e;
+
 typedef struct udr_event_s {
     ogs_event_t h;
+
+    udr_dbi_xact_t *dbi_xact;
 } udr_event_t;
 
 udr_event_t *udr_event_new(int id);
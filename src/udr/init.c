@@ -18,6 +18,7 @@
  */
 
 #include "sbi-path.h"
+#include "dbi-path.h"
 
 static ogs_thread_t *thread;
 static void udr_main(void *data);
@@ -44,6 +45,16 @@ int udr_initialize()
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db.cache.max,
+            ogs_app()->db.cache.ttl, !ogs_app()->db.cache.no_watch);
+    if (rv != OGS_OK) return rv;
+
+    rv = ogs_dbi_sqn_init(ogs_app()->db.sqn.flush_interval);
+    if (rv != OGS_OK) return rv;
+
+    rv = udr_dbi_open();
+    if (rv != OGS_OK) return rv;
+
     rv = udr_sbi_open();
     if (rv != OGS_OK) return rv;
 
@@ -86,6 +97,7 @@ void udr_terminate(void)
     ogs_timer_delete(t_termination_holding);
 
     udr_sbi_close();
+    udr_dbi_close();
 
     ogs_dbi_final();
 
@@ -18,16 +18,151 @@
  */
 
 #include "sbi-path.h"
+#include "dbi-path.h"
 #include "nudr-handler.h"
 
-bool udr_nudr_dr_handle_subscription_authentication(
-        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+static bool dbi_submit(ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg,
+        char *supi, uint64_t sqn,
+        ogs_dbi_job_handler_t run, udr_dbi_xact_handler_t done)
+{
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(stream);
+    ogs_assert(recvmsg);
+    ogs_assert(supi);
+
+    xact = udr_dbi_xact_add(stream, recvmsg, supi);
+    if (!xact) {
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(stream,
+                OGS_SBI_HTTP_STATUS_SERVICE_UNAVAILABLE,
+                recvmsg, "Too many DB requests", supi));
+        return false;
+    }
+
+    xact->sqn = sqn;
+
+    if (udr_dbi_submit(xact, run, done) == false) {
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(stream,
+                OGS_SBI_HTTP_STATUS_SERVICE_UNAVAILABLE,
+                recvmsg, "Cannot submit DB request", supi));
+        udr_dbi_xact_remove(xact);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * The following *_run() functions are called in a DB worker thread.
+ * They must not touch anything but the DB and 'xact'.
+ */
+static void auth_info_run(ogs_dbi_job_t *job)
+{
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    job->rv = ogs_dbi_auth_info(xact->supi, &xact->auth_info);
+    if (job->rv != OGS_OK) {
+        xact->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        xact->title = "Cannot find SUPI in DB";
+    }
+}
+
+static void update_sqn_run(ogs_dbi_job_t *job)
+{
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    auth_info_run(job);
+    if (job->rv != OGS_OK)
+        return;
+
+    job->rv = ogs_dbi_advance_sqn(xact->supi, xact->sqn);
+    if (job->rv != OGS_OK) {
+        xact->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+        xact->title = "Cannot update SQN";
+    }
+}
+
+static void increment_sqn_run(ogs_dbi_job_t *job)
 {
-    int rv;
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    auth_info_run(job);
+    if (job->rv != OGS_OK)
+        return;
 
+    job->rv = ogs_dbi_increment_sqn(xact->supi);
+    if (job->rv != OGS_OK) {
+        xact->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+        xact->title = "Cannot increment SQN";
+    }
+}
+
+static void subscription_data_run(ogs_dbi_job_t *job)
+{
+    udr_dbi_xact_t *xact = NULL;
+
+    ogs_assert(job);
+    xact = job->data;
+    ogs_assert(xact);
+
+    job->rv = ogs_dbi_subscription_data(xact->supi, &xact->subscription_data);
+    if (job->rv != OGS_OK) {
+        xact->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        xact->title = "Cannot find SUPI in DB";
+    }
+}
+
+bool udr_nudr_dr_handle_dbi_complete(udr_dbi_xact_t *xact)
+{
+    ogs_assert(xact);
+    ogs_assert(xact->stream);
+    ogs_assert(xact->done);
+
+    if (xact->job.rv == OGS_TIMEUP) {
+        ogs_error("[%s] DB request timed out", xact->supi);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(xact->stream,
+                OGS_SBI_HTTP_STATUS_GATEWAY_TIMEOUT,
+                &xact->message, "DB request timed out", xact->supi));
+        return false;
+    }
+
+    if (xact->job.rv != OGS_OK) {
+        ogs_assert(xact->status);
+        ogs_assert(xact->title);
+
+        if (xact->status == OGS_SBI_HTTP_STATUS_NOT_FOUND)
+            ogs_warn("[%s] %s", xact->supi, xact->title);
+        else
+            ogs_fatal("[%s] %s", xact->supi, xact->title);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(xact->stream, xact->status,
+                &xact->message, xact->title, xact->supi));
+        return false;
+    }
+
+    return xact->done(xact);
+}
+
+static bool authentication_subscription_done(udr_dbi_xact_t *xact)
+{
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_dbi_auth_info_t auth_info;
+    ogs_dbi_auth_info_t *auth_info = NULL;
 
     char k_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
     char opc_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
@@ -35,10 +170,70 @@ bool udr_nudr_dr_handle_subscription_authentication(
     char sqn_string[OGS_KEYSTRLEN(OGS_SQN_LEN)];
 
     char sqn[OGS_SQN_LEN];
-    char *supi = NULL;
 
     OpenAPI_authentication_subscription_t AuthenticationSubscription;
     OpenAPI_sequence_number_t SequenceNumber;
+
+    ogs_assert(xact);
+    auth_info = &xact->auth_info;
+
+    memset(&AuthenticationSubscription, 0,
+            sizeof(AuthenticationSubscription));
+
+    AuthenticationSubscription.authentication_method =
+        OpenAPI_auth_method_5G_AKA;
+
+    ogs_hex_to_ascii(auth_info->k, sizeof(auth_info->k),
+            k_string, sizeof(k_string));
+    AuthenticationSubscription.enc_permanent_key = k_string;
+
+    ogs_hex_to_ascii(auth_info->amf, sizeof(auth_info->amf),
+            amf_string, sizeof(amf_string));
+    AuthenticationSubscription.authentication_management_field =
+            amf_string;
+
+    if (!auth_info->use_opc)
+        milenage_opc(auth_info->k, auth_info->op, auth_info->opc);
+
+    ogs_hex_to_ascii(auth_info->opc, sizeof(auth_info->opc),
+            opc_string, sizeof(opc_string));
+    AuthenticationSubscription.enc_opc_key = opc_string;
+
+    ogs_uint64_to_buffer(auth_info->sqn, OGS_SQN_LEN, sqn);
+    ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
+
+    memset(&SequenceNumber, 0, sizeof(SequenceNumber));
+    SequenceNumber.sqn = sqn_string;
+    AuthenticationSubscription.sequence_number = &SequenceNumber;
+
+    memset(&sendmsg, 0, sizeof(sendmsg));
+
+    ogs_assert(AuthenticationSubscription.authentication_method);
+    sendmsg.AuthenticationSubscription =
+        &AuthenticationSubscription;
+
+    response = ogs_sbi_build_response(
+            &sendmsg, OGS_SBI_HTTP_STATUS_OK);
+    ogs_assert(response);
+    ogs_assert(true == ogs_sbi_server_send_response(xact->stream, response));
+
+    return true;
+}
+
+static bool no_content_done(udr_dbi_xact_t *xact)
+{
+    ogs_assert(xact);
+
+    ogs_assert(true == ogs_sbi_send_http_status_no_content(xact->stream));
+
+    return true;
+}
+
+bool udr_nudr_dr_handle_subscription_authentication(
+        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+{
+    char *supi = NULL;
+
     OpenAPI_list_t *PatchItemList = NULL;
     OpenAPI_lnode_t *node = NULL;
 
@@ -63,60 +258,12 @@ bool udr_nudr_dr_handle_subscription_authentication(
         return false;
     }
 
-    rv = ogs_dbi_auth_info(supi, &auth_info);
-    if (rv != OGS_OK) {
-        ogs_warn("[%s] Cannot find SUPI in DB", supi);
-        ogs_assert(true ==
-            ogs_sbi_server_send_error(stream, OGS_SBI_HTTP_STATUS_NOT_FOUND,
-                recvmsg, "Cannot find SUPI Type", supi));
-        return false;
-    }
-
     SWITCH(recvmsg->h.resource.component[3])
     CASE(OGS_SBI_RESOURCE_NAME_AUTHENTICATION_SUBSCRIPTION)
         SWITCH(recvmsg->h.method)
         CASE(OGS_SBI_HTTP_METHOD_GET)
-            memset(&AuthenticationSubscription, 0,
-                    sizeof(AuthenticationSubscription));
-
-            AuthenticationSubscription.authentication_method =
-                OpenAPI_auth_method_5G_AKA;
-
-            ogs_hex_to_ascii(auth_info.k, sizeof(auth_info.k),
-                    k_string, sizeof(k_string));
-            AuthenticationSubscription.enc_permanent_key = k_string;
-
-            ogs_hex_to_ascii(auth_info.amf, sizeof(auth_info.amf),
-                    amf_string, sizeof(amf_string));
-            AuthenticationSubscription.authentication_management_field =
-                    amf_string;
-
-            if (!auth_info.use_opc)
-                milenage_opc(auth_info.k, auth_info.op, auth_info.opc);
-
-            ogs_hex_to_ascii(auth_info.opc, sizeof(auth_info.opc),
-                    opc_string, sizeof(opc_string));
-            AuthenticationSubscription.enc_opc_key = opc_string;
-
-            ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn);
-            ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
-
-            memset(&SequenceNumber, 0, sizeof(SequenceNumber));
-            SequenceNumber.sqn = sqn_string;
-            AuthenticationSubscription.sequence_number = &SequenceNumber;
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            ogs_assert(AuthenticationSubscription.authentication_method);
-            sendmsg.AuthenticationSubscription =
-                &AuthenticationSubscription;
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_OK);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            return dbi_submit(stream, recvmsg, supi, 0,
+                    auth_info_run, authentication_subscription_done);
 
         CASE(OGS_SBI_HTTP_METHOD_PATCH)
             char *sqn_string = NULL;
@@ -155,34 +302,8 @@ bool udr_nudr_dr_handle_subscription_authentication(
                     sqn_ms, sizeof(sqn_ms));
             sqn = ogs_buffer_to_uint64(sqn_ms, OGS_SQN_LEN);
 
-            rv = ogs_dbi_update_sqn(supi, sqn);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot update SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot update SQN", supi));
-                return false;
-            }
-
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi));
-                return false;
-            }
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            return dbi_submit(stream, recvmsg, supi, sqn,
+                    update_sqn_run, no_content_done);
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -208,23 +329,8 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 return false;
             }
 
-            memset(&sendmsg, 0, sizeof(sendmsg));
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_assert(true ==
-                    ogs_sbi_server_send_error(stream,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi));
-                return false;
-            }
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_assert(true == ogs_sbi_server_send_response(stream, response));
-
-            return true;
+            return dbi_submit(stream, recvmsg, supi, 0,
+                    increment_sqn_run, no_content_done);
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -348,46 +454,30 @@ bool udr_nudr_dr_handle_subscription_context(
     return false;
 }
 
-bool udr_nudr_dr_handle_subscription_provisioned(
-        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+static bool subscription_provisioned_done(udr_dbi_xact_t *xact)
 {
-    int rv, status = 0;
+    int status = 0;
     char *strerror = NULL;
 
+    ogs_sbi_stream_t *stream = NULL;
+    ogs_sbi_message_t *recvmsg = NULL;
+
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_subscription_data_t subscription_data;
+    ogs_subscription_data_t *subscription_data = NULL;
     ogs_slice_data_t *slice_data = NULL;
 
     char *supi = NULL;
 
+    ogs_assert(xact);
+    stream = xact->stream;
     ogs_assert(stream);
-    ogs_assert(recvmsg);
-
-    memset(&subscription_data, 0, sizeof(ogs_subscription_data_t));
-
-    supi = recvmsg->h.resource.component[1];
-    if (!supi) {
-        strerror = ogs_msprintf("No SUPI");
-        status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
-        goto cleanup;
-    }
-
-    if (strncmp(supi,
-            OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
-        strerror = ogs_msprintf("[%s] Unknown SUPI Type", supi);
-        status = OGS_SBI_HTTP_STATUS_FORBIDDEN;
-        goto cleanup;
-    }
-
-    rv = ogs_dbi_subscription_data(supi, &subscription_data);
-    if (rv != OGS_OK) {
-        strerror = ogs_msprintf("[%s] Cannot find SUPI in DB", supi);
-        status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
-        goto cleanup;
-    }
+    recvmsg = &xact->message;
+    supi = xact->supi;
+    ogs_assert(supi);
+    subscription_data = &xact->subscription_data;
 
-    if (!subscription_data.ambr.uplink && !subscription_data.ambr.downlink) {
+    if (!subscription_data->ambr.uplink && !subscription_data->ambr.downlink) {
         strerror = ogs_msprintf("[%s] No UE-AMBR", supi);
         status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
         goto cleanup;
@@ -410,22 +500,22 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         OpenAPI_lnode_t *node = NULL;
 
         GpsiList = OpenAPI_list_create();
-        for (i = 0; i < subscription_data.num_of_msisdn; i++) {
+        for (i = 0; i < subscription_data->num_of_msisdn; i++) {
             char *gpsi = ogs_msprintf("%s-%s",
-                    OGS_ID_GPSI_TYPE_MSISDN, subscription_data.msisdn[i].bcd);
+                    OGS_ID_GPSI_TYPE_MSISDN, subscription_data->msisdn[i].bcd);
             ogs_assert(gpsi);
             OpenAPI_list_add(GpsiList, gpsi);
         }
 
         SubscribedUeAmbr.uplink = ogs_sbi_bitrate_to_string(
-                subscription_data.ambr.uplink, OGS_SBI_BITRATE_KBPS);
+                subscription_data->ambr.uplink, OGS_SBI_BITRATE_KBPS);
         SubscribedUeAmbr.downlink = ogs_sbi_bitrate_to_string(
-                subscription_data.ambr.downlink, OGS_SBI_BITRATE_KBPS);
+                subscription_data->ambr.downlink, OGS_SBI_BITRATE_KBPS);
 
         memset(&NSSAI, 0, sizeof(NSSAI));
         DefaultSingleNssaiList = OpenAPI_list_create();
-        for (i = 0; i < subscription_data.num_of_slice; i++) {
-            slice_data = &subscription_data.slice[i];
+        for (i = 0; i < subscription_data->num_of_slice; i++) {
+            slice_data = &subscription_data->slice[i];
 
             if (slice_data->default_indicator == false)
                 continue;
@@ -443,8 +533,8 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         }
 
         SingleNssaiList = OpenAPI_list_create();
-        for (i = 0; i < subscription_data.num_of_slice; i++) {
-            slice_data = &subscription_data.slice[i];
+        for (i = 0; i < subscription_data->num_of_slice; i++) {
+            slice_data = &subscription_data->slice[i];
 
             if (slice_data->default_indicator == true)
                 continue;
@@ -537,13 +627,13 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         SubscribedSnssaiInfoList = OpenAPI_list_create();
         ogs_assert(SubscribedSnssaiInfoList);
 
-        for (i = 0; i < subscription_data.num_of_slice; i++) {
+        for (i = 0; i < subscription_data->num_of_slice; i++) {
             if (i >= OGS_MAX_NUM_OF_SLICE) {
                 ogs_warn("Ignore max slice count overflow [%d>=%d]",
-                    subscription_data.num_of_slice, OGS_MAX_NUM_OF_SLICE);
+                    subscription_data->num_of_slice, OGS_MAX_NUM_OF_SLICE);
                 break;
             }
-            slice_data = &subscription_data.slice[i];
+            slice_data = &subscription_data->slice[i];
 
             DnnInfoList = OpenAPI_list_create();
             ogs_assert(DnnInfoList);
@@ -656,7 +746,7 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         };
 
         slice_data = ogs_slice_find_by_s_nssai(
-                subscription_data.slice, subscription_data.num_of_slice,
+                subscription_data->slice, subscription_data->num_of_slice,
                 &recvmsg->param.s_nssai);
 
         if (!slice_data) {
@@ -921,8 +1011,6 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         goto cleanup;
     END
 
-    ogs_subscription_data_free(&subscription_data);
-
     return true;
 
 cleanup:
@@ -933,229 +1021,280 @@ cleanup:
         ogs_sbi_server_send_error(stream, status, recvmsg, strerror, NULL));
     ogs_free(strerror);
 
-    ogs_subscription_data_free(&subscription_data);
-
     return false;
 }
 
-bool udr_nudr_dr_handle_policy_data(
+bool udr_nudr_dr_handle_subscription_provisioned(
         ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
 {
-    int rv, i, status = 0;
+    char *supi = NULL;
+
+    ogs_assert(stream);
+    ogs_assert(recvmsg);
+
+    supi = recvmsg->h.resource.component[1];
+    if (!supi) {
+        ogs_error("No SUPI");
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(stream, OGS_SBI_HTTP_STATUS_BAD_REQUEST,
+                recvmsg, "No SUPI", NULL));
+        return false;
+    }
+
+    if (strncmp(supi,
+            OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
+        ogs_error("[%s] Unknown SUPI Type", supi);
+        ogs_assert(true ==
+            ogs_sbi_server_send_error(stream, OGS_SBI_HTTP_STATUS_FORBIDDEN,
+                recvmsg, "Unknwon SUPI Type", supi));
+        return false;
+    }
+
+    return dbi_submit(stream, recvmsg, supi, 0,
+            subscription_data_run, subscription_provisioned_done);
+}
+
+static bool policy_data_done(udr_dbi_xact_t *xact)
+{
+    int i, status = 0;
     char *strerror = NULL;
 
+    ogs_sbi_stream_t *stream = NULL;
+    ogs_sbi_message_t *recvmsg = NULL;
+
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
 
-    ogs_subscription_data_t subscription_data;
+    ogs_subscription_data_t *subscription_data = NULL;
     ogs_slice_data_t *slice_data = NULL;
 
+    OpenAPI_lnode_t *node = NULL, *node2 = NULL;
+
+    char *supi = NULL;
+
+    ogs_assert(xact);
+    stream = xact->stream;
     ogs_assert(stream);
-    ogs_assert(recvmsg);
+    recvmsg = &xact->message;
+    supi = xact->supi;
+    ogs_assert(supi);
+    subscription_data = &xact->subscription_data;
 
-    memset(&subscription_data, 0, sizeof(ogs_subscription_data_t));
+    SWITCH(recvmsg->h.resource.component[3])
+    CASE(OGS_SBI_RESOURCE_NAME_AM_DATA)
+        OpenAPI_am_policy_data_t AmPolicyData;
 
-    SWITCH(recvmsg->h.resource.component[1])
-    CASE(OGS_SBI_RESOURCE_NAME_UES)
-        char *supi = recvmsg->h.resource.component[2];
+        memset(&AmPolicyData, 0, sizeof(AmPolicyData));
 
-        if (!supi) {
-            strerror = ogs_msprintf("No SUPI");
+        memset(&sendmsg, 0, sizeof(sendmsg));
+        sendmsg.AmPolicyData = &AmPolicyData;
+
+        response = ogs_sbi_build_response(
+                &sendmsg, OGS_SBI_HTTP_STATUS_OK);
+        ogs_assert(response);
+        ogs_assert(true ==
+                ogs_sbi_server_send_response(stream, response));
+
+        break;
+
+    CASE(OGS_SBI_RESOURCE_NAME_SM_DATA)
+        OpenAPI_sm_policy_data_t SmPolicyData;
+
+        OpenAPI_list_t *SmPolicySnssaiDataList = NULL;
+        OpenAPI_map_t *SmPolicySnssaiDataMap = NULL;
+        OpenAPI_sm_policy_snssai_data_t *SmPolicySnssaiData = NULL;
+
+        OpenAPI_snssai_t *sNSSAI = NULL;
+
+        OpenAPI_list_t *SmPolicyDnnDataList = NULL;
+        OpenAPI_map_t *SmPolicyDnnDataMap = NULL;
+        OpenAPI_sm_policy_dnn_data_t *SmPolicyDnnData = NULL;
+
+        if (!recvmsg->param.snssai_presence) {
+            strerror = ogs_msprintf("[%s] No S_NSSAI", supi);
             status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
             goto cleanup;
         }
 
-        if (strncmp(supi,
-                OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
-            strerror = ogs_msprintf("[%s] Unknown SUPI Type", supi);
-            status = OGS_SBI_HTTP_STATUS_FORBIDDEN;
+        slice_data = ogs_slice_find_by_s_nssai(
+                subscription_data->slice, subscription_data->num_of_slice,
+                &recvmsg->param.s_nssai);
+
+        if (!slice_data) {
+            strerror = ogs_msprintf(
+                    "[%s] Cannot find S_NSSAI[SST:%d SD:0x%x]",
+                    supi,
+                    recvmsg->param.s_nssai.sst,
+                    recvmsg->param.s_nssai.sd.v);
+            status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
             goto cleanup;
         }
 
-        SWITCH(recvmsg->h.method)
-        CASE(OGS_SBI_HTTP_METHOD_GET)
-            OpenAPI_lnode_t *node = NULL, *node2 = NULL;
+        sNSSAI = ogs_calloc(1, sizeof(*sNSSAI));
+        ogs_assert(sNSSAI);
+        sNSSAI->sst = slice_data->s_nssai.sst;
+        sNSSAI->sd = ogs_s_nssai_sd_to_string(slice_data->s_nssai.sd);
 
-            rv = ogs_dbi_subscription_data(supi, &subscription_data);
-            if (rv != OGS_OK) {
-                strerror = ogs_msprintf("[%s] Cannot find SUPI in DB", supi);
-                status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
-                goto cleanup;
-            }
-
-            SWITCH(recvmsg->h.resource.component[3])
-            CASE(OGS_SBI_RESOURCE_NAME_AM_DATA)
-                OpenAPI_am_policy_data_t AmPolicyData;
-
-                memset(&AmPolicyData, 0, sizeof(AmPolicyData));
+        SmPolicyDnnDataList = OpenAPI_list_create();
+        ogs_assert(SmPolicyDnnDataList);
 
-                memset(&sendmsg, 0, sizeof(sendmsg));
-                sendmsg.AmPolicyData = &AmPolicyData;
+        slice_data = &subscription_data->slice[0];
 
-                response = ogs_sbi_build_response(
-                        &sendmsg, OGS_SBI_HTTP_STATUS_OK);
-                ogs_assert(response);
-                ogs_assert(true ==
-                        ogs_sbi_server_send_response(stream, response));
+        for (i = 0; i < slice_data->num_of_session; i++) {
+            ogs_session_t *session = NULL;
 
+            if (i >= OGS_MAX_NUM_OF_SESS) {
+                ogs_warn("Ignore max session count overflow [%d>=%d]",
+                    slice_data->num_of_session, OGS_MAX_NUM_OF_SESS);
                 break;
+            }
 
-            CASE(OGS_SBI_RESOURCE_NAME_SM_DATA)
-                OpenAPI_sm_policy_data_t SmPolicyData;
-
-                OpenAPI_list_t *SmPolicySnssaiDataList = NULL;
-                OpenAPI_map_t *SmPolicySnssaiDataMap = NULL;
-                OpenAPI_sm_policy_snssai_data_t *SmPolicySnssaiData = NULL;
-
-                OpenAPI_snssai_t *sNSSAI = NULL;
+            session = &slice_data->session[i];
+            ogs_assert(session);
+            ogs_assert(session->name);
 
-                OpenAPI_list_t *SmPolicyDnnDataList = NULL;
-                OpenAPI_map_t *SmPolicyDnnDataMap = NULL;
-                OpenAPI_sm_policy_dnn_data_t *SmPolicyDnnData = NULL;
+            if (recvmsg->param.dnn &&
+                ogs_strcasecmp(recvmsg->param.dnn, session->name) != 0)
+                continue;
 
-                if (!recvmsg->param.snssai_presence) {
-                    strerror = ogs_msprintf("[%s] No S_NSSAI", supi);
-                    status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
-                    goto cleanup;
-                }
+            SmPolicyDnnData = ogs_calloc(1, sizeof(*SmPolicyDnnData));
+            ogs_assert(SmPolicyDnnData);
 
-                slice_data = ogs_slice_find_by_s_nssai(
-                        subscription_data.slice, subscription_data.num_of_slice,
-                        &recvmsg->param.s_nssai);
-
-                if (!slice_data) {
-                    strerror = ogs_msprintf(
-                            "[%s] Cannot find S_NSSAI[SST:%d SD:0x%x]",
-                            supi,
-                            recvmsg->param.s_nssai.sst,
-                            recvmsg->param.s_nssai.sd.v);
-                    status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
-                    goto cleanup;
-                }
+            SmPolicyDnnData->dnn = session->name;
 
-                sNSSAI = ogs_calloc(1, sizeof(*sNSSAI));
-                ogs_assert(sNSSAI);
-                sNSSAI->sst = slice_data->s_nssai.sst;
-                sNSSAI->sd = ogs_s_nssai_sd_to_string(slice_data->s_nssai.sd);
+            SmPolicyDnnDataMap = OpenAPI_map_create(
+                    session->name, SmPolicyDnnData);
+            ogs_assert(SmPolicyDnnDataMap);
 
-                SmPolicyDnnDataList = OpenAPI_list_create();
-                ogs_assert(SmPolicyDnnDataList);
+            OpenAPI_list_add(SmPolicyDnnDataList, SmPolicyDnnDataMap);
+        }
 
-                slice_data = &subscription_data.slice[0];
+        SmPolicySnssaiData = ogs_calloc(1, sizeof(*SmPolicySnssaiData));
+        ogs_assert(SmPolicySnssaiData);
 
-                for (i = 0; i < slice_data->num_of_session; i++) {
-                    ogs_session_t *session = NULL;
+        SmPolicySnssaiData->snssai = sNSSAI;
+        if (SmPolicyDnnDataList->count)
+            SmPolicySnssaiData->sm_policy_dnn_data =
+                SmPolicyDnnDataList;
+        else
+            OpenAPI_list_free(SmPolicyDnnDataList);
 
-                    if (i >= OGS_MAX_NUM_OF_SESS) {
-                        ogs_warn("Ignore max session count overflow [%d>=%d]",
-                            slice_data->num_of_session, OGS_MAX_NUM_OF_SESS);
-                        break;
-                    }
+        SmPolicySnssaiDataMap = OpenAPI_map_create(
+                ogs_sbi_s_nssai_to_string(&recvmsg->param.s_nssai),
+                SmPolicySnssaiData);
+        ogs_assert(SmPolicySnssaiDataMap);
+        ogs_assert(SmPolicySnssaiDataMap->key);
 
-                    session = &slice_data->session[i];
-                    ogs_assert(session);
-                    ogs_assert(session->name);
+        SmPolicySnssaiDataList = OpenAPI_list_create();
+        ogs_assert(SmPolicySnssaiDataList);
 
-                    if (recvmsg->param.dnn &&
-                        ogs_strcasecmp(recvmsg->param.dnn, session->name) != 0)
-                        continue;
+        OpenAPI_list_add(SmPolicySnssaiDataList, SmPolicySnssaiDataMap);
 
-                    SmPolicyDnnData = ogs_calloc(1, sizeof(*SmPolicyDnnData));
-                    ogs_assert(SmPolicyDnnData);
+        memset(&SmPolicyData, 0, sizeof(SmPolicyData));
 
-                    SmPolicyDnnData->dnn = session->name;
+        if (SmPolicySnssaiDataList->count)
+            SmPolicyData.sm_policy_snssai_data = SmPolicySnssaiDataList;
+        else
+            OpenAPI_list_free(SmPolicySnssaiDataList);
 
-                    SmPolicyDnnDataMap = OpenAPI_map_create(
-                            session->name, SmPolicyDnnData);
-                    ogs_assert(SmPolicyDnnDataMap);
+        memset(&sendmsg, 0, sizeof(sendmsg));
+        sendmsg.SmPolicyData = &SmPolicyData;
 
-                    OpenAPI_list_add(SmPolicyDnnDataList, SmPolicyDnnDataMap);
+        response = ogs_sbi_build_response(
+                &sendmsg, OGS_SBI_HTTP_STATUS_OK);
+        ogs_assert(response);
+        ogs_assert(true ==
+                ogs_sbi_server_send_response(stream, response));
+
+        SmPolicySnssaiDataList = SmPolicyData.sm_policy_snssai_data;
+        OpenAPI_list_for_each(SmPolicySnssaiDataList, node) {
+            SmPolicySnssaiDataMap = node->data;
+            if (SmPolicySnssaiDataMap) {
+                SmPolicySnssaiData = SmPolicySnssaiDataMap->value;
+                if (SmPolicySnssaiData) {
+                    sNSSAI = SmPolicySnssaiData->snssai;
+                    if (sNSSAI) {
+                        if (sNSSAI->sd) ogs_free(sNSSAI->sd);
+                        ogs_free(sNSSAI);
+                    }
+                    SmPolicyDnnDataList =
+                        SmPolicySnssaiData->sm_policy_dnn_data;
+                    if (SmPolicyDnnDataList) {
+                        OpenAPI_list_for_each(
+                                SmPolicyDnnDataList, node2) {
+                            SmPolicyDnnDataMap = node2->data;
+                            if (SmPolicyDnnDataMap) {
+                                SmPolicyDnnData =
+                                    SmPolicyDnnDataMap->value;
+                                if (SmPolicyDnnData) {
+                                    ogs_free(SmPolicyDnnData);
+                                }
+                                ogs_free(SmPolicyDnnDataMap);
+                            }
+                        }
+                        OpenAPI_list_free(SmPolicyDnnDataList);
+                    }
+                    ogs_free(SmPolicySnssaiData);
                 }
+                if (SmPolicySnssaiDataMap->key)
+                    ogs_free(SmPolicySnssaiDataMap->key);
+                ogs_free(SmPolicySnssaiDataMap);
+            }
+        }
+        OpenAPI_list_free(SmPolicySnssaiDataList);
 
-                SmPolicySnssaiData = ogs_calloc(1, sizeof(*SmPolicySnssaiData));
-                ogs_assert(SmPolicySnssaiData);
-
-                SmPolicySnssaiData->snssai = sNSSAI;
-                if (SmPolicyDnnDataList->count)
-                    SmPolicySnssaiData->sm_policy_dnn_data =
-                        SmPolicyDnnDataList;
-                else
-                    OpenAPI_list_free(SmPolicyDnnDataList);
+        break;
 
-                SmPolicySnssaiDataMap = OpenAPI_map_create(
-                        ogs_sbi_s_nssai_to_string(&recvmsg->param.s_nssai),
-                        SmPolicySnssaiData);
-                ogs_assert(SmPolicySnssaiDataMap);
-                ogs_assert(SmPolicySnssaiDataMap->key);
+    DEFAULT
+        strerror = ogs_msprintf("Invalid resource name [%s]",
+                recvmsg->h.resource.component[3]);
+        status = OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED;
+        goto cleanup;
+    END
 
-                SmPolicySnssaiDataList = OpenAPI_list_create();
-                ogs_assert(SmPolicySnssaiDataList);
+    return true;
 
-                OpenAPI_list_add(SmPolicySnssaiDataList, SmPolicySnssaiDataMap);
+cleanup:
+    ogs_assert(strerror);
+    ogs_assert(status);
+    ogs_error("%s", strerror);
+    ogs_assert(true ==
+        ogs_sbi_server_send_error(stream, status, recvmsg, strerror, NULL));
+    ogs_free(strerror);
 
-                memset(&SmPolicyData, 0, sizeof(SmPolicyData));
+    return false;
+}
 
-                if (SmPolicySnssaiDataList->count)
-                    SmPolicyData.sm_policy_snssai_data = SmPolicySnssaiDataList;
-                else
-                    OpenAPI_list_free(SmPolicySnssaiDataList);
+bool udr_nudr_dr_handle_policy_data(
+        ogs_sbi_stream_t *stream, ogs_sbi_message_t *recvmsg)
+{
+    int status = 0;
+    char *strerror = NULL;
 
-                memset(&sendmsg, 0, sizeof(sendmsg));
-                sendmsg.SmPolicyData = &SmPolicyData;
+    ogs_assert(stream);
+    ogs_assert(recvmsg);
 
-                response = ogs_sbi_build_response(
-                        &sendmsg, OGS_SBI_HTTP_STATUS_OK);
-                ogs_assert(response);
-                ogs_assert(true ==
-                        ogs_sbi_server_send_response(stream, response));
-
-                SmPolicySnssaiDataList = SmPolicyData.sm_policy_snssai_data;
-                OpenAPI_list_for_each(SmPolicySnssaiDataList, node) {
-                    SmPolicySnssaiDataMap = node->data;
-                    if (SmPolicySnssaiDataMap) {
-                        SmPolicySnssaiData = SmPolicySnssaiDataMap->value;
-                        if (SmPolicySnssaiData) {
-                            sNSSAI = SmPolicySnssaiData->snssai;
-                            if (sNSSAI) {
-                                if (sNSSAI->sd) ogs_free(sNSSAI->sd);
-                                ogs_free(sNSSAI);
-                            }
-                            SmPolicyDnnDataList =
-                                SmPolicySnssaiData->sm_policy_dnn_data;
-                            if (SmPolicyDnnDataList) {
-                                OpenAPI_list_for_each(
-                                        SmPolicyDnnDataList, node2) {
-                                    SmPolicyDnnDataMap = node2->data;
-                                    if (SmPolicyDnnDataMap) {
-                                        SmPolicyDnnData =
-                                            SmPolicyDnnDataMap->value;
-                                        if (SmPolicyDnnData) {
-                                            ogs_free(SmPolicyDnnData);
-                                        }
-                                        ogs_free(SmPolicyDnnDataMap);
-                                    }
-                                }
-                                OpenAPI_list_free(SmPolicyDnnDataList);
-                            }
-                            ogs_free(SmPolicySnssaiData);
-                        }
-                        if (SmPolicySnssaiDataMap->key)
-                            ogs_free(SmPolicySnssaiDataMap->key);
-                        ogs_free(SmPolicySnssaiDataMap);
-                    }
-                }
-                OpenAPI_list_free(SmPolicySnssaiDataList);
+    SWITCH(recvmsg->h.resource.component[1])
+    CASE(OGS_SBI_RESOURCE_NAME_UES)
+        char *supi = recvmsg->h.resource.component[2];
 
-                break;
+        if (!supi) {
+            strerror = ogs_msprintf("No SUPI");
+            status = OGS_SBI_HTTP_STATUS_BAD_REQUEST;
+            goto cleanup;
+        }
 
-            DEFAULT
-                strerror = ogs_msprintf("Invalid resource name [%s]",
-                        recvmsg->h.resource.component[3]);
-                status = OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED;
-                goto cleanup;
-            END
+        if (strncmp(supi,
+                OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
+            strerror = ogs_msprintf("[%s] Unknown SUPI Type", supi);
+            status = OGS_SBI_HTTP_STATUS_FORBIDDEN;
+            goto cleanup;
+        }
 
-            break;
+        SWITCH(recvmsg->h.method)
+        CASE(OGS_SBI_HTTP_METHOD_GET)
+            return dbi_submit(stream, recvmsg, supi, 0,
+                    subscription_data_run, policy_data_done);
 
         DEFAULT
             strerror = ogs_msprintf("Invalid HTTP method [%s]",
@@ -1173,9 +1312,7 @@ bool udr_nudr_dr_handle_policy_data(
         goto cleanup;
     END
 
-    ogs_subscription_data_free(&subscription_data);
-
-    return true;
+    return false;
 
 cleanup:
     ogs_assert(strerror);
@@ -1185,7 +1322,5 @@ cleanup:
         ogs_sbi_server_send_error(stream, status, recvmsg, strerror, NULL));
     ogs_free(strerror);
 
-    ogs_subscription_data_free(&subscription_data);
-
     return false;
 }
@@ -36,6 +36,8 @@ bool udr_nudr_dr_handle_subscription_provisioned(
 bool udr_nudr_dr_handle_policy_data(
         ogs_sbi_stream_t *stream, ogs_sbi_message_t *message);
 
+bool udr_nudr_dr_handle_dbi_complete(udr_dbi_xact_t *xact);
+
 #ifdef __cplusplus
 }
 #endif
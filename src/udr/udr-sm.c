@@ -48,6 +48,8 @@ void udr_state_operational(ogs_fsm_t *s, udr_event_t *e)
     ogs_sbi_response_t *response = NULL;
     ogs_sbi_message_t message;
 
+    udr_dbi_xact_t *dbi_xact = NULL;
+
     udr_sm_debug(e);
 
     ogs_assert(s);
@@ -308,6 +310,14 @@ void udr_state_operational(ogs_fsm_t *s, udr_event_t *e)
         }
         break;
 
+    case UDR_EVENT_DBI_COMPLETE:
+        dbi_xact = e->dbi_xact;
+        ogs_assert(dbi_xact);
+
+        udr_nudr_dr_handle_dbi_complete(dbi_xact);
+        udr_dbi_xact_remove(dbi_xact);
+        break;
+
     default:
         ogs_error("No handler for event %s", udr_event_get_name(e));
         break;
@@ -47,7 +47,7 @@ void upf_context_init(void)
     ogs_pfcp_self()->up_function_features_len = 4;
 
     ogs_list_init(&self.sess_list);
-    ogs_pool_init(&upf_sess_pool, ogs_app()->pool.sess);
+    ogs_pool_init_growable(&upf_sess_pool, ogs_app()->pool.sess);
 
     self.seid_hash = ogs_hash_make();
     ogs_assert(self.seid_hash);
@@ -420,7 +420,7 @@ void upf_sess_urr_acc_add(upf_sess_t *sess, ogs_pfcp_urr_t *urr, size_t size, bo
         urr_acc->ul_pkts++;
     }
 
-    urr_acc->time_of_last_packet = ogs_time_now();
+    urr_acc->time_of_last_packet = ogs_loop_time_now();
     if (urr_acc->time_of_first_packet == 0)
         urr_acc->time_of_first_packet = urr_acc->time_of_last_packet;
 
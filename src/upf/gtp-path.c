@@ -52,6 +52,7 @@
 #include "gtp-path.h"
 #include "pfcp-path.h"
 #include "rule-match.h"
+#include "metrics.h"
 
 #define UPF_GTP_HANDLED     1
 
@@ -129,9 +130,14 @@ static void _gtpv1_tun_recv_common_cb(
         ogs_pkbuf_pull(recvbuf, ETHER_HDR_LEN);
     }
 
+    upf_metrics_inst_global_packet(
+            UPF_METR_GLOB_CTR_N6_RX_PACKETS, recvbuf->len);
+
     sess = upf_sess_find_by_ue_ip_address(recvbuf);
-    if (!sess)
+    if (!sess) {
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_NO_SESSION);
         goto cleanup;
+    }
 
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         far = pdr->far;
@@ -171,6 +177,8 @@ static void _gtpv1_tun_recv_common_cb(
     if (!pdr) {
         if (ogs_app()->parameter.multicast) {
             upf_gtp_handle_multicast(recvbuf);
+        } else {
+            upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_NO_PDR);
         }
         goto cleanup;
     }
@@ -179,6 +187,10 @@ static void _gtpv1_tun_recv_common_cb(
     for (i = 0; i < pdr->num_of_urr; i++)
         upf_sess_urr_acc_add(sess, pdr->urr[i], recvbuf->len, false);
 
+    upf_metrics_dnn_add(pdr, false, recvbuf->len);
+    if (pdr->qer)
+        upf_metrics_qfi_add(pdr->qer->qfi, false, recvbuf->len);
+
     ogs_assert(true == ogs_pfcp_up_handle_pdr(
                 pdr, OGS_GTPU_MSGTYPE_GPDU, recvbuf, &report));
 
@@ -249,6 +261,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (gtp_h->version != OGS_GTP2_VERSION_1) {
         ogs_error("[DROP] Invalid GTPU version [%d]", gtp_h->version);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
 
@@ -308,12 +321,14 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (len < 0) {
         ogs_error("[DROP] Cannot decode GTPU packet");
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
     if (gtp_h->type != OGS_GTPU_MSGTYPE_END_MARKER &&
         pkbuf->len <= len) {
         ogs_error("[DROP] Small GTPU packet(type:%d len:%d)", gtp_h->type, len);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_INVALID_GTPU);
         goto cleanup;
     }
     ogs_assert(ogs_pkbuf_pull(pkbuf, len));
@@ -324,6 +339,8 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     } else if (gtp_h->type == OGS_GTPU_MSGTYPE_ERR_IND) {
         ogs_pfcp_far_t *far = NULL;
 
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_RX_ERROR_INDICATION);
+
         far = ogs_pfcp_far_find_by_error_indication(pkbuf);
         if (far) {
             ogs_assert(true ==
@@ -362,6 +379,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         pfcp_object = ogs_pfcp_object_find_by_teid(teid);
         if (!pfcp_object) {
             /* TODO : Send Error Indication */
+            upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_NO_SESSION);
             goto cleanup;
         }
 
@@ -399,6 +417,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
             if (!pdr) {
                 /* TODO : Send Error Indication */
+                upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_NO_PDR);
                 goto cleanup;
             }
 
@@ -418,6 +437,13 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         far = pdr->far;
         ogs_assert(far);
 
+        if (pdr->src_if == OGS_PFCP_INTERFACE_ACCESS)
+            upf_metrics_inst_global_packet(
+                    UPF_METR_GLOB_CTR_N3_RX_PACKETS, pkbuf->len);
+        else if (pdr->src_if == OGS_PFCP_INTERFACE_CORE)
+            upf_metrics_inst_global_packet(
+                    UPF_METR_GLOB_CTR_N9_RX_PACKETS, pkbuf->len);
+
         if (ip_h->ip_v == 4 && sess->ipv4) {
             src_addr = &ip_h->ip_src.s_addr;
             ogs_assert(src_addr);
@@ -524,6 +550,11 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
             for (i = 0; i < pdr->num_of_urr; i++)
                 upf_sess_urr_acc_add(sess, pdr->urr[i], pkbuf->len, true);
 
+            upf_metrics_dnn_add(pdr, true, pkbuf->len);
+            upf_metrics_qfi_add(qfi ? qfi : pdr->qfi, true, pkbuf->len);
+            upf_metrics_inst_global_packet(
+                    UPF_METR_GLOB_CTR_N6_TX_PACKETS, pkbuf->len);
+
             if (dev->is_tap) {
                 ogs_assert(eth_type);
                 eth_type = htobe16(eth_type);
@@ -579,6 +610,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     } else {
         ogs_error("[DROP] Invalid GTPU Type [%d]", gtp_h->type);
         ogs_log_hexdump(OGS_LOG_ERROR, pkbuf->data, pkbuf->len);
+        upf_metrics_inst_global_inc(UPF_METR_GLOB_CTR_DROP_INVALID_GTPU);
     }
 
 cleanup:
@@ -0,0 +1,346 @@
+#include "ogs-app.h"
+#include "context.h"
+
+#include "metrics.h"
+
+typedef struct upf_metrics_spec_def_s {
+    unsigned int type;
+    const char *name;
+    const char *description;
+    int initial_val;
+    unsigned int num_labels;
+    const char **labels;
+} upf_metrics_spec_def_t;
+
+/* Helper generic functions: */
+static int upf_metrics_init_inst(ogs_metrics_inst_t **inst, ogs_metrics_spec_t **specs,
+        unsigned int len, unsigned int num_labels, const char **labels)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        inst[i] = ogs_metrics_inst_new(specs[i], num_labels, labels);
+    return OGS_OK;
+}
+
+static int upf_metrics_free_inst(ogs_metrics_inst_t **inst,
+        unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++)
+        ogs_metrics_inst_free(inst[i]);
+    memset(inst, 0, sizeof(inst[0]) * len);
+    return OGS_OK;
+}
+
+static int upf_metrics_init_spec(ogs_metrics_context_t *ctx,
+        ogs_metrics_spec_t **dst, upf_metrics_spec_def_t *src, unsigned int len)
+{
+    unsigned int i;
+    for (i = 0; i < len; i++) {
+        dst[i] = ogs_metrics_spec_new(ctx, src[i].type,
+                src[i].name, src[i].description,
+                src[i].initial_val, src[i].num_labels, src[i].labels);
+    }
+    return OGS_OK;
+}
+
+/* GLOBAL */
+ogs_metrics_spec_t *upf_metrics_spec_global[_UPF_METR_GLOB_MAX];
+ogs_metrics_inst_t *upf_metrics_inst_global[_UPF_METR_GLOB_MAX];
+upf_metrics_spec_def_t upf_metrics_spec_def_global[_UPF_METR_GLOB_MAX] = {
+/* Global Counters: */
+[UPF_METR_GLOB_CTR_N3_RX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n3_rx_packets",
+    .description = "GTP-U packets received on N3",
+},
+[UPF_METR_GLOB_CTR_N3_RX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n3_rx_bytes",
+    .description = "Payload bytes received on N3",
+},
+[UPF_METR_GLOB_CTR_N3_TX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n3_tx_packets",
+    .description = "GTP-U packets sent on N3",
+},
+[UPF_METR_GLOB_CTR_N3_TX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n3_tx_bytes",
+    .description = "Payload bytes sent on N3",
+},
+[UPF_METR_GLOB_CTR_N6_RX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n6_rx_packets",
+    .description = "Packets received on N6",
+},
+[UPF_METR_GLOB_CTR_N6_RX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n6_rx_bytes",
+    .description = "Bytes received on N6",
+},
+[UPF_METR_GLOB_CTR_N6_TX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n6_tx_packets",
+    .description = "Packets sent on N6",
+},
+[UPF_METR_GLOB_CTR_N6_TX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n6_tx_bytes",
+    .description = "Bytes sent on N6",
+},
+[UPF_METR_GLOB_CTR_N9_RX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n9_rx_packets",
+    .description = "GTP-U packets received on N9",
+},
+[UPF_METR_GLOB_CTR_N9_RX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n9_rx_bytes",
+    .description = "Payload bytes received on N9",
+},
+[UPF_METR_GLOB_CTR_N9_TX_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n9_tx_packets",
+    .description = "GTP-U packets sent on N9",
+},
+[UPF_METR_GLOB_CTR_N9_TX_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "n9_tx_bytes",
+    .description = "Payload bytes sent on N9",
+},
+[UPF_METR_GLOB_CTR_DROP_NO_SESSION] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_no_session",
+    .description = "Packets dropped with no matching session or TEID",
+},
+[UPF_METR_GLOB_CTR_DROP_NO_PDR] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_no_pdr",
+    .description = "Packets dropped with no matching PDR",
+},
+[UPF_METR_GLOB_CTR_DROP_BUFFER_FULL] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_buffer_full",
+    .description = "Downlink packets dropped on a full buffer",
+},
+[UPF_METR_GLOB_CTR_DROP_BUFFER_EXPIRED] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_buffer_expired",
+    .description = "Downlink packets dropped on buffering timeout",
+},
+[UPF_METR_GLOB_CTR_DROP_INVALID_GTPU] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "dropped_invalid_gtpu",
+    .description = "GTP-U packets dropped due to an invalid header",
+},
+[UPF_METR_GLOB_CTR_RX_ERROR_INDICATION] = {
+    .type = OGS_METRICS_METRIC_TYPE_COUNTER,
+    .name = "rx_error_indication",
+    .description = "Received GTP-U Error Indication messages",
+},
+/* Global Gauges: */
+[UPF_METR_GLOB_GAUGE_BUFFERED_PACKETS] = {
+    .type = OGS_METRICS_METRIC_TYPE_GAUGE,
+    .name = "buffered_packets",
+    .description = "Downlink packets held in buffers",
+},
+[UPF_METR_GLOB_GAUGE_BUFFERED_BYTES] = {
+    .type = OGS_METRICS_METRIC_TYPE_GAUGE,
+    .name = "buffered_bytes",
+    .description = "Memory held by buffered downlink packets",
+},
+};
+static int upf_metrics_init_inst_global(void)
+{
+    return upf_metrics_init_inst(upf_metrics_inst_global, upf_metrics_spec_global,
+                _UPF_METR_GLOB_MAX, 0, NULL);
+}
+static int upf_metrics_free_inst_global(void)
+{
+    return upf_metrics_free_inst(upf_metrics_inst_global, _UPF_METR_GLOB_MAX);
+}
+
+/* DNN and QFI: */
+typedef enum upf_metric_type_flow_s {
+    UPF_METR_FLOW_CTR_UL_BYTES = 0,
+    UPF_METR_FLOW_CTR_DL_BYTES,
+    _UPF_METR_FLOW_MAX,
+} upf_metric_type_flow_t;
+
+static const char *labels_dnn[] = {
+    "dnn"
+};
+static const char *labels_qfi[] = {
+    "qfi"
+};
+#define UPF_METR_FLOW_CTR_ENTRY(_id, _name, _desc, _labels) \
+    [_id] = { \
+        .type = OGS_METRICS_METRIC_TYPE_COUNTER, \
+        .name = _name, \
+        .description = _desc, \
+        .num_labels = OGS_ARRAY_SIZE(_labels), \
+        .labels = _labels, \
+    },
+ogs_metrics_spec_t *upf_metrics_spec_dnn[_UPF_METR_FLOW_MAX];
+upf_metrics_spec_def_t upf_metrics_spec_def_dnn[_UPF_METR_FLOW_MAX] = {
+UPF_METR_FLOW_CTR_ENTRY(
+    UPF_METR_FLOW_CTR_UL_BYTES,
+    "dnn_ul_bytes",
+    "Uplink bytes forwarded per DNN", labels_dnn)
+UPF_METR_FLOW_CTR_ENTRY(
+    UPF_METR_FLOW_CTR_DL_BYTES,
+    "dnn_dl_bytes",
+    "Downlink bytes forwarded per DNN", labels_dnn)
+};
+ogs_metrics_spec_t *upf_metrics_spec_qfi[_UPF_METR_FLOW_MAX];
+upf_metrics_spec_def_t upf_metrics_spec_def_qfi[_UPF_METR_FLOW_MAX] = {
+UPF_METR_FLOW_CTR_ENTRY(
+    UPF_METR_FLOW_CTR_UL_BYTES,
+    "qfi_ul_bytes",
+    "Uplink bytes forwarded per QoS Flow Identifier", labels_qfi)
+UPF_METR_FLOW_CTR_ENTRY(
+    UPF_METR_FLOW_CTR_DL_BYTES,
+    "qfi_dl_bytes",
+    "Downlink bytes forwarded per QoS Flow Identifier", labels_qfi)
+};
+
+typedef struct upf_metrics_flow_s {
+    char *label;
+    ogs_metrics_inst_t *inst[_UPF_METR_FLOW_MAX];
+} upf_metrics_flow_t;
+
+/*
+ * The label sets are only known once traffic flows, so instances
+ * are created from the forwarding path. The /metrics server is
+ * polled by the same thread, so this does not race with a scrape.
+ */
+static ogs_hash_t *dnn_hash;
+static upf_metrics_flow_t *qfi_flow[OGS_MAX_QOS_FLOW_ID+1];
+
+static upf_metrics_flow_t *upf_metrics_flow_new(
+        ogs_metrics_spec_t **specs, const char *label)
+{
+    upf_metrics_flow_t *flow = NULL;
+
+    flow = ogs_calloc(1, sizeof(*flow));
+    ogs_assert(flow);
+    flow->label = ogs_strdup(label);
+    ogs_assert(flow->label);
+
+    upf_metrics_init_inst(flow->inst, specs, _UPF_METR_FLOW_MAX,
+            1, (const char *[]){ label });
+
+    return flow;
+}
+
+static void upf_metrics_flow_free(upf_metrics_flow_t *flow)
+{
+    upf_metrics_free_inst(flow->inst, _UPF_METR_FLOW_MAX);
+    ogs_free(flow->label);
+    ogs_free(flow);
+}
+
+void upf_metrics_pdr_set_dnn(ogs_pfcp_pdr_t *pdr)
+{
+    upf_metrics_flow_t *flow = NULL;
+
+    ogs_assert(pdr);
+
+    pdr->metrics.dnn_ul_bytes = NULL;
+    pdr->metrics.dnn_dl_bytes = NULL;
+
+    if (!pdr->dnn || !dnn_hash)
+        return;
+
+    flow = ogs_hash_get(dnn_hash, pdr->dnn, OGS_HASH_KEY_STRING);
+    if (!flow) {
+        flow = upf_metrics_flow_new(upf_metrics_spec_dnn, pdr->dnn);
+        /* Keyed by our copy, the PDR may go away before the flow */
+        ogs_hash_set(dnn_hash, flow->label, OGS_HASH_KEY_STRING, flow);
+    }
+
+    pdr->metrics.dnn_ul_bytes = flow->inst[UPF_METR_FLOW_CTR_UL_BYTES];
+    pdr->metrics.dnn_dl_bytes = flow->inst[UPF_METR_FLOW_CTR_DL_BYTES];
+}
+
+void upf_metrics_qfi_add(uint8_t qfi, bool is_uplink, int len)
+{
+    char buf[4];
+
+    if (!qfi || qfi > OGS_MAX_QOS_FLOW_ID || !dnn_hash)
+        return;
+
+    if (!qfi_flow[qfi]) {
+        ogs_snprintf(buf, sizeof(buf), "%d", qfi);
+        qfi_flow[qfi] = upf_metrics_flow_new(upf_metrics_spec_qfi, buf);
+    }
+
+    ogs_metrics_inst_add(qfi_flow[qfi]->inst[is_uplink ?
+            UPF_METR_FLOW_CTR_UL_BYTES : UPF_METR_FLOW_CTR_DL_BYTES], len);
+}
+
+int upf_metrics_open(void)
+{
+    ogs_metrics_context_t *ctx = ogs_metrics_self();
+    ogs_metrics_context_open(ctx);
+
+    upf_metrics_init_spec(ctx, upf_metrics_spec_global, upf_metrics_spec_def_global,
+            _UPF_METR_GLOB_MAX);
+
+    upf_metrics_init_spec(ctx, upf_metrics_spec_dnn, upf_metrics_spec_def_dnn,
+            _UPF_METR_FLOW_MAX);
+    upf_metrics_init_spec(ctx, upf_metrics_spec_qfi, upf_metrics_spec_def_qfi,
+            _UPF_METR_FLOW_MAX);
+
+    upf_metrics_init_inst_global();
+
+    dnn_hash = ogs_hash_make();
+    ogs_assert(dnn_hash);
+
+    /* Counted by lib/pfcp when forwarding and buffering */
+    ogs_pfcp_self()->metrics.access_tx_packets =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_N3_TX_PACKETS];
+    ogs_pfcp_self()->metrics.access_tx_bytes =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_N3_TX_BYTES];
+    ogs_pfcp_self()->metrics.core_tx_packets =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_N9_TX_PACKETS];
+    ogs_pfcp_self()->metrics.core_tx_bytes =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_N9_TX_BYTES];
+    ogs_pfcp_self()->metrics.buffered_packets =
+        upf_metrics_inst_global[UPF_METR_GLOB_GAUGE_BUFFERED_PACKETS];
+    ogs_pfcp_self()->metrics.buffer_full =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_DROP_BUFFER_FULL];
+    ogs_pfcp_self()->metrics.buffered_bytes =
+        upf_metrics_inst_global[UPF_METR_GLOB_GAUGE_BUFFERED_BYTES];
+    ogs_pfcp_self()->metrics.buffer_expired =
+        upf_metrics_inst_global[UPF_METR_GLOB_CTR_DROP_BUFFER_EXPIRED];
+
+    ogs_pfcp_xact_metrics_open();
+    return 0;
+}
+
+int upf_metrics_close(void)
+{
+    ogs_metrics_context_t *ctx = ogs_metrics_self();
+    ogs_hash_index_t *hi = NULL;
+    int i;
+
+    memset(&ogs_pfcp_self()->metrics, 0, sizeof(ogs_pfcp_self()->metrics));
+
+    if (dnn_hash) {
+        for (hi = ogs_hash_first(dnn_hash); hi; hi = ogs_hash_next(hi))
+            upf_metrics_flow_free(ogs_hash_this_val(hi));
+        ogs_hash_destroy(dnn_hash);
+        dnn_hash = NULL;
+    }
+    for (i = 0; i <= OGS_MAX_QOS_FLOW_ID; i++) {
+        if (qfi_flow[i])
+            upf_metrics_flow_free(qfi_flow[i]);
+        qfi_flow[i] = NULL;
+    }
+
+    upf_metrics_free_inst_global();
+    ogs_metrics_context_close(ctx);
+    return OGS_OK;
+}
@@ -0,0 +1,77 @@
+#ifndef UPF_METRICS_H
+#define UPF_METRICS_H
+
+#include "ogs-metrics.h"
+#include "ogs-pfcp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* GLOBAL */
+typedef enum upf_metric_type_global_s {
+    UPF_METR_GLOB_CTR_N3_RX_PACKETS = 0,
+    UPF_METR_GLOB_CTR_N3_RX_BYTES,
+    UPF_METR_GLOB_CTR_N3_TX_PACKETS,
+    UPF_METR_GLOB_CTR_N3_TX_BYTES,
+    UPF_METR_GLOB_CTR_N6_RX_PACKETS,
+    UPF_METR_GLOB_CTR_N6_RX_BYTES,
+    UPF_METR_GLOB_CTR_N6_TX_PACKETS,
+    UPF_METR_GLOB_CTR_N6_TX_BYTES,
+    UPF_METR_GLOB_CTR_N9_RX_PACKETS,
+    UPF_METR_GLOB_CTR_N9_RX_BYTES,
+    UPF_METR_GLOB_CTR_N9_TX_PACKETS,
+    UPF_METR_GLOB_CTR_N9_TX_BYTES,
+    UPF_METR_GLOB_CTR_DROP_NO_SESSION,
+    UPF_METR_GLOB_CTR_DROP_NO_PDR,
+    UPF_METR_GLOB_CTR_DROP_BUFFER_FULL,
+    UPF_METR_GLOB_CTR_DROP_BUFFER_EXPIRED,
+    UPF_METR_GLOB_CTR_DROP_INVALID_GTPU,
+    UPF_METR_GLOB_CTR_RX_ERROR_INDICATION,
+    UPF_METR_GLOB_GAUGE_BUFFERED_PACKETS,
+    UPF_METR_GLOB_GAUGE_BUFFERED_BYTES,
+    _UPF_METR_GLOB_MAX,
+} upf_metric_type_global_t;
+extern ogs_metrics_inst_t *upf_metrics_inst_global[_UPF_METR_GLOB_MAX];
+
+static inline void upf_metrics_inst_global_set(upf_metric_type_global_t t, int val)
+{ ogs_metrics_inst_set(upf_metrics_inst_global[t], val); }
+static inline void upf_metrics_inst_global_add(upf_metric_type_global_t t, int val)
+{ ogs_metrics_inst_add(upf_metrics_inst_global[t], val); }
+static inline void upf_metrics_inst_global_inc(upf_metric_type_global_t t)
+{ ogs_metrics_inst_inc(upf_metrics_inst_global[t]); }
+static inline void upf_metrics_inst_global_dec(upf_metric_type_global_t t)
+{ ogs_metrics_inst_dec(upf_metrics_inst_global[t]); }
+
+/* Counts a packet of len bytes, the _BYTES entry follows _PACKETS */
+static inline void upf_metrics_inst_global_packet(
+        upf_metric_type_global_t packets, int len)
+{
+    ogs_metrics_inst_inc(upf_metrics_inst_global[packets]);
+    ogs_metrics_inst_add(upf_metrics_inst_global[packets+1], len);
+}
+
+/*
+ * Throughput per DNN and per QFI. The DNN counters are resolved once
+ * when a PDR is created or its DNN changes, QFI ones on first use.
+ */
+void upf_metrics_pdr_set_dnn(ogs_pfcp_pdr_t *pdr);
+void upf_metrics_qfi_add(uint8_t qfi, bool is_uplink, int len);
+
+static inline void upf_metrics_dnn_add(
+        ogs_pfcp_pdr_t *pdr, bool is_uplink, int len)
+{
+    ogs_metrics_inst_t *inst = is_uplink ?
+        pdr->metrics.dnn_ul_bytes : pdr->metrics.dnn_dl_bytes;
+    if (inst)
+        ogs_metrics_inst_add(inst, len);
+}
+
+int upf_metrics_open(void);
+int upf_metrics_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UPF_METRICS_H */
@@ -21,6 +21,7 @@
 #include "pfcp-path.h"
 #include "gtp-path.h"
 #include "n4-handler.h"
+#include "metrics.h"
 
 static void upf_n4_handle_create_urr(upf_sess_t *sess, ogs_pfcp_tlv_create_urr_t *create_urr_arr,
                               uint8_t *cause_value, uint8_t *offending_ie_value)
@@ -116,6 +117,8 @@ void upf_n4_handle_session_establishment_request(
         pdr = created_pdr[i];
         ogs_assert(pdr);
 
+        upf_metrics_pdr_set_dnn(pdr);
+
         /* Setup UE IP address */
         if (pdr->ue_ip_addr_len) {
             if (req->pdn_type.presence == 1) {
@@ -246,9 +249,13 @@ void upf_n4_handle_session_modification_request(
         goto cleanup;
 
     for (i = 0; i < OGS_MAX_NUM_OF_PDR; i++) {
-        if (ogs_pfcp_handle_update_pdr(&sess->pfcp, &req->update_pdr[i],
-                    &cause_value, &offending_ie_value) == NULL)
+        pdr = ogs_pfcp_handle_update_pdr(&sess->pfcp, &req->update_pdr[i],
+                    &cause_value, &offending_ie_value);
+        if (pdr == NULL)
             break;
+
+        /* The Network Instance may have changed */
+        upf_metrics_pdr_set_dnn(pdr);
     }
     if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
         goto cleanup;
@@ -371,6 +378,8 @@ void upf_n4_handle_session_modification_request(
         pdr = created_pdr[i];
         ogs_assert(pdr);
 
+        upf_metrics_pdr_set_dnn(pdr);
+
         if (pdr->f_teid_len) {
             ogs_pfcp_object_type_e type = OGS_PFCP_OBJ_SESS_TYPE;
 
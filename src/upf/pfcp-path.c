@@ -124,6 +124,19 @@ static void pfcp_recv_cb(short when, ogs_socket_t fd, void *data)
     }
 }
 
+/* Downlink Data Report held back by the buffer report_rate */
+static int send_buffer_report(
+        ogs_pfcp_sess_t *pfcp_sess, ogs_pfcp_user_plane_report_t *report)
+{
+    upf_sess_t *sess = NULL;
+
+    ogs_assert(pfcp_sess);
+    sess = UPF_SESS(pfcp_sess);
+    ogs_assert(sess);
+
+    return upf_pfcp_send_session_report_request(sess, report);
+}
+
 int upf_pfcp_open(void)
 {
     ogs_socknode_t *node = NULL;
@@ -149,6 +162,8 @@ int upf_pfcp_open(void)
 
     OGS_SETUP_PFCP_SERVER;
 
+    ogs_pfcp_self()->buffer.send_report = send_buffer_report;
+
     return OGS_OK;
 }
 
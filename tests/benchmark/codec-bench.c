@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-pfcp.h"
+#include "ogs-gtp.h"
+#include "core/abts.h"
+
+/*
+ * Compares the generated single-pass decoders of ogs_pfcp_parse_msg()
+ * and ogs_gtp2_parse_msg() against the descriptor-driven
+ * ogs_tlv_parse_msg() on the same message.
+ *
+ * Both have to produce the same structure.
+ */
+#define NUM_OF_PARSE            200000
+
+#define NUM_OF_PDR              4
+#define NUM_OF_FAR              4
+
+/* Create Session Request from tests/unit/gtp-message-test.c */
+static const char *s11_create_session_request =
+    "0100080055153011 340010f44c000600 9471527600414b00 0800536120009178"
+    "840056000d001855 f501102255f50100 019d015300030055 f501520001000657"
+    "0009008a80000084 0a32360a57000901 87000000000a3236 254700220005766f"
+    "6c7465036e673204 6d6e6574066d6e63 303130066d636335 3535046770727380"
+    "000100fc63000100 014f000500010000 00007f0001000048 000800000003e800"
+    "0007d04e001a0080 8021100100001081 0600000000830600 000000000d00000a"
+    "005d001f00490001 0005500016004505 0000000000000000 0000000000000000"
+    "0000000072000200 40005f0002005400";
+
+static ogs_pkbuf_t *n4_session_establishment_request(void)
+{
+    ogs_pfcp_message_t pfcp_message;
+    ogs_pfcp_session_establishment_request_t *req = NULL;
+    ogs_pfcp_header_t *h = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    int i;
+
+    static uint8_t node_id[] = { 0x00, 0x7f, 0x00, 0x00, 0x04 };
+    static uint8_t f_seid[] = {
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x7f, 0x00, 0x00, 0x04 };
+    static uint8_t f_teid[] = { 0x0d, 0x05 };
+    static uint8_t ue_ip_address[] = { 0x06, 0x0a, 0x2d, 0x00, 0x02 };
+    static uint8_t network_instance[] = {
+        0x08, 'i', 'n', 't', 'e', 'r', 'n', 'e', 't' };
+    static uint8_t sdf_filter[] = {
+        0x01, 0x00, 0x00, 0x15, 'p', 'e', 'r', 'm', 'i', 't', ' ',
+        'o', 'u', 't', ' ', 'i', 'p', ' ', 'f', 'r', 'o', 'm', ' ',
+        'a', 'n', 'y' };
+    static uint8_t outer_header_removal[] = { 0x00 };
+    static uint8_t outer_header_creation[] = {
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0x00, 0x00, 0x05 };
+    static uint8_t mbr[] = {
+        0x00, 0x00, 0x0f, 0x42, 0x40, 0x00, 0x00, 0x0f, 0x42, 0x40 };
+
+    memset(&pfcp_message, 0, sizeof(pfcp_message));
+    pfcp_message.h.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+    req = &pfcp_message.pfcp_session_establishment_request;
+
+    req->node_id.presence = 1;
+    req->node_id.data = node_id;
+    req->node_id.len = sizeof(node_id);
+    req->cp_f_seid.presence = 1;
+    req->cp_f_seid.data = f_seid;
+    req->cp_f_seid.len = sizeof(f_seid);
+
+    for (i = 0; i < NUM_OF_PDR; i++) {
+        ogs_pfcp_tlv_create_pdr_t *pdr = &req->create_pdr[i];
+
+        pdr->presence = 1;
+        pdr->pdr_id.presence = 1;
+        pdr->pdr_id.u16 = i + 1;
+        pdr->precedence.presence = 1;
+        pdr->precedence.u32 = 255;
+        pdr->pdi.presence = 1;
+        pdr->pdi.source_interface.presence = 1;
+        pdr->pdi.source_interface.u8 = i % 2 ?
+            OGS_PFCP_INTERFACE_CORE : OGS_PFCP_INTERFACE_ACCESS;
+        pdr->pdi.network_instance.presence = 1;
+        pdr->pdi.network_instance.data = network_instance;
+        pdr->pdi.network_instance.len = sizeof(network_instance);
+        if (i % 2 == 0) {
+            pdr->pdi.local_f_teid.presence = 1;
+            pdr->pdi.local_f_teid.data = f_teid;
+            pdr->pdi.local_f_teid.len = sizeof(f_teid);
+            pdr->outer_header_removal.presence = 1;
+            pdr->outer_header_removal.data = outer_header_removal;
+            pdr->outer_header_removal.len = sizeof(outer_header_removal);
+        }
+        pdr->pdi.ue_ip_address.presence = 1;
+        pdr->pdi.ue_ip_address.data = ue_ip_address;
+        pdr->pdi.ue_ip_address.len = sizeof(ue_ip_address);
+        pdr->pdi.sdf_filter[0].presence = 1;
+        pdr->pdi.sdf_filter[0].data = sdf_filter;
+        pdr->pdi.sdf_filter[0].len = sizeof(sdf_filter);
+        pdr->pdi.qfi.presence = 1;
+        pdr->pdi.qfi.u8 = 1;
+        pdr->far_id.presence = 1;
+        pdr->far_id.u32 = i + 1;
+        pdr->qer_id.presence = 1;
+        pdr->qer_id.u32 = 1;
+    }
+
+    for (i = 0; i < NUM_OF_FAR; i++) {
+        ogs_pfcp_tlv_create_far_t *far = &req->create_far[i];
+
+        far->presence = 1;
+        far->far_id.presence = 1;
+        far->far_id.u32 = i + 1;
+        far->apply_action.presence = 1;
+        far->apply_action.u16 = OGS_PFCP_APPLY_ACTION_FORW;
+        far->forwarding_parameters.presence = 1;
+        far->forwarding_parameters.destination_interface.presence = 1;
+        far->forwarding_parameters.destination_interface.u8 = i % 2 ?
+            OGS_PFCP_INTERFACE_ACCESS : OGS_PFCP_INTERFACE_CORE;
+        if (i % 2) {
+            far->forwarding_parameters.outer_header_creation.presence = 1;
+            far->forwarding_parameters.outer_header_creation.data =
+                outer_header_creation;
+            far->forwarding_parameters.outer_header_creation.len =
+                sizeof(outer_header_creation);
+        }
+    }
+
+    req->create_qer[0].presence = 1;
+    req->create_qer[0].qer_id.presence = 1;
+    req->create_qer[0].qer_id.u32 = 1;
+    req->create_qer[0].gate_status.presence = 1;
+    req->create_qer[0].gate_status.u8 = 0;
+    req->create_qer[0].maximum_bitrate.presence = 1;
+    req->create_qer[0].maximum_bitrate.data = mbr;
+    req->create_qer[0].maximum_bitrate.len = sizeof(mbr);
+    req->create_qer[0].qos_flow_identifier.presence = 1;
+    req->create_qer[0].qos_flow_identifier.u8 = 1;
+
+    req->pdn_type.presence = 1;
+    req->pdn_type.u8 = OGS_PDU_SESSION_TYPE_IPV4;
+
+    pkbuf = ogs_pfcp_build_msg(&pfcp_message);
+    ogs_assert(pkbuf);
+
+    ogs_assert(ogs_pkbuf_push(pkbuf, OGS_PFCP_HEADER_LEN));
+    h = (ogs_pfcp_header_t *)pkbuf->data;
+    memset(h, 0, OGS_PFCP_HEADER_LEN);
+    h->version = OGS_PFCP_VERSION;
+    h->seid_presence = 1;
+    h->type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+    h->length = htobe16(pkbuf->len - 4);
+    h->sqn = OGS_PFCP_XID_TO_SQN(1);
+
+    return pkbuf;
+}
+
+static ogs_pkbuf_t *s11_message(const char *hex, uint8_t type)
+{
+    ogs_gtp2_header_t *h = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    char buf[OGS_MAX_SDU_LEN];
+    int i, len = 0;
+
+    OGS_HEX(hex, strlen(hex), buf);
+    for (i = 0; hex[i]; i++)
+        if (hex[i] != ' ')
+            len++;
+    len /= 2;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_TLV_MAX_HEADROOM + OGS_MAX_SDU_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_reserve(pkbuf, OGS_TLV_MAX_HEADROOM);
+    ogs_pkbuf_put_data(pkbuf, buf, len);
+
+    ogs_assert(ogs_pkbuf_push(pkbuf, OGS_GTPV2C_HEADER_LEN));
+    h = (ogs_gtp2_header_t *)pkbuf->data;
+    memset(h, 0, OGS_GTPV2C_HEADER_LEN);
+    h->version = 2;
+    h->teid_presence = 1;
+    h->type = type;
+    h->length = htobe16(pkbuf->len - 4);
+    h->sqn = OGS_GTP2_XID_TO_SQN(1);
+
+    return pkbuf;
+}
+
+static void bench_print(const char *name, int n, ogs_time_t duration)
+{
+    printf("\n    %-32s %7d msgs %8.3f usec/msg %10.0f msg/sec",
+            name, n, (double)duration / n,
+            (double)n * OGS_USEC_PER_SEC / duration);
+}
+
+static void codec_bench_pfcp(abts_case *tc, void *data)
+{
+    static ogs_pfcp_message_t generated, descriptor;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_time_t start;
+    int i, rv;
+
+    pkbuf = n4_session_establishment_request();
+
+    rv = ogs_pfcp_parse_msg(&generated, pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    memset(&descriptor, 0, sizeof(descriptor));
+    rv = ogs_tlv_parse_msg(&descriptor.pfcp_session_establishment_request,
+            &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+            pkbuf, OGS_TLV_MODE_T2_L2);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, memcmp(&generated.pfcp_session_establishment_request,
+                &descriptor.pfcp_session_establishment_request,
+                sizeof(generated.pfcp_session_establishment_request)) == 0);
+    ABTS_INT_EQUAL(tc, 1,
+            generated.pfcp_session_establishment_request.
+                create_pdr[NUM_OF_PDR-1].pdi.sdf_filter[0].presence);
+    ABTS_INT_EQUAL(tc, 0,
+            generated.pfcp_session_establishment_request.
+                create_pdr[NUM_OF_PDR].presence);
+    ogs_assert(ogs_pkbuf_push(pkbuf, OGS_PFCP_HEADER_LEN));
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_PARSE; i++) {
+        ogs_pfcp_parse_msg(&generated, pkbuf);
+        ogs_assert(ogs_pkbuf_push(pkbuf, OGS_PFCP_HEADER_LEN));
+    }
+    bench_print("N4 Establishment generated",
+            NUM_OF_PARSE, ogs_get_monotonic_time() - start);
+
+    ogs_assert(ogs_pkbuf_pull(pkbuf, OGS_PFCP_HEADER_LEN));
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_PARSE; i++) {
+        memset(&descriptor, 0, sizeof(descriptor));
+        ogs_tlv_parse_msg(
+                &descriptor.pfcp_session_establishment_request,
+                &ogs_pfcp_msg_desc_pfcp_session_establishment_request,
+                pkbuf, OGS_TLV_MODE_T2_L2);
+    }
+    bench_print("N4 Establishment descriptor",
+            NUM_OF_PARSE, ogs_get_monotonic_time() - start);
+
+    ogs_pkbuf_free(pkbuf);
+}
+
+static void codec_bench_gtp2(abts_case *tc, void *data)
+{
+    static ogs_gtp2_message_t generated, descriptor;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_time_t start;
+    int i, rv;
+
+    pkbuf = s11_message(s11_create_session_request,
+            OGS_GTP2_CREATE_SESSION_REQUEST_TYPE);
+
+    rv = ogs_gtp2_parse_msg(&generated, pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    ogs_assert(ogs_pkbuf_pull(pkbuf, OGS_GTPV2C_HEADER_LEN));
+    memset(&descriptor, 0, sizeof(descriptor));
+    rv = ogs_tlv_parse_msg(&descriptor.create_session_request,
+            &ogs_gtp2_tlv_desc_create_session_request,
+            pkbuf, OGS_TLV_MODE_T1_L2_I1);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, memcmp(&generated.create_session_request,
+                &descriptor.create_session_request,
+                sizeof(generated.create_session_request)) == 0);
+    ABTS_INT_EQUAL(tc, 1, generated.create_session_request.
+            bearer_contexts_to_be_created[0].eps_bearer_id.presence);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_PARSE; i++) {
+        memset(&descriptor, 0, sizeof(descriptor));
+        ogs_tlv_parse_msg(&descriptor.create_session_request,
+                &ogs_gtp2_tlv_desc_create_session_request,
+                pkbuf, OGS_TLV_MODE_T1_L2_I1);
+    }
+    ogs_assert(ogs_pkbuf_push(pkbuf, OGS_GTPV2C_HEADER_LEN));
+    bench_print("S11 Create Session descriptor",
+            NUM_OF_PARSE, ogs_get_monotonic_time() - start);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_PARSE; i++)
+        ogs_gtp2_parse_msg(&generated, pkbuf);
+    bench_print("S11 Create Session generated",
+            NUM_OF_PARSE, ogs_get_monotonic_time() - start);
+    printf("\n");
+
+    ogs_pkbuf_free(pkbuf);
+}
+
+abts_suite *test_codec_bench(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, codec_bench_pfcp, NULL);
+    abts_run_test(suite, codec_bench_gtp2, NULL);
+
+    return suite;
+}
@@ -0,0 +1,390 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+#include "core/abts.h"
+
+/*
+ * Compares the lookups of the ogs_dbi_*() backends
+ *
+ * MongoDB is measured only if it is reachable at $DB_URI
+ * (default: mongodb://localhost/open5gs-benchmark).
+ * The 'subscribers' collection of that database is dropped afterwards.
+ */
+#define NUM_OF_SUBSCRIBER       10000
+#define NUM_OF_LOOKUP           100000
+
+#define BENCH_IMSI_BASE         1010000000000ULL
+
+static char *bench_supi(int i)
+{
+    char *supi = ogs_msprintf("%s-%015llu", OGS_ID_SUPI_TYPE_IMSI,
+            (unsigned long long)(BENCH_IMSI_BASE + i));
+    ogs_assert(supi);
+
+    return supi;
+}
+
+static bson_t *bench_subscriber(int i)
+{
+    char imsi[OGS_MAX_IMSI_BCD_LEN+1];
+    char msisdn[OGS_MAX_MSISDN_BCD_LEN+1];
+    bson_t *doc = NULL;
+
+    ogs_snprintf(imsi, sizeof(imsi), "%015llu",
+            (unsigned long long)(BENCH_IMSI_BASE + i));
+    ogs_snprintf(msisdn, sizeof(msisdn), "8210%08d", i);
+
+    doc = BCON_NEW(
+            "imsi", BCON_UTF8(imsi),
+            "msisdn", "[", BCON_UTF8(msisdn), "]",
+            "ambr", "{",
+                "downlink", "{",
+                    "value", BCON_INT32(1),
+                    "unit", BCON_INT32(3),
+                "}",
+                "uplink", "{",
+                    "value", BCON_INT32(1),
+                    "unit", BCON_INT32(3),
+                "}",
+            "}",
+            "slice", "[", "{",
+                "sst", BCON_INT32(1),
+                "default_indicator", BCON_BOOL(true),
+                "session", "[", "{",
+                    "name", BCON_UTF8("internet"),
+                    "type", BCON_INT32(3),
+                    "ambr", "{",
+                        "downlink", "{",
+                            "value", BCON_INT32(1),
+                            "unit", BCON_INT32(3),
+                        "}",
+                        "uplink", "{",
+                            "value", BCON_INT32(1),
+                            "unit", BCON_INT32(3),
+                        "}",
+                    "}",
+                    "qos", "{",
+                        "index", BCON_INT32(9),
+                        "arp", "{",
+                            "priority_level", BCON_INT32(8),
+                            "pre_emption_vulnerability", BCON_INT32(1),
+                            "pre_emption_capability", BCON_INT32(1),
+                        "}",
+                    "}",
+                "}", "]",
+            "}", "]",
+            "security", "{",
+                "k", BCON_UTF8("465B5CE8 B199B49F AA5F0A2E E238A6BC"),
+                "opc", BCON_UTF8("E8ED289D EBA952E4 283B54E8 8E6183CA"),
+                "amf", BCON_UTF8("8000"),
+                "sqn", BCON_INT64(64),
+            "}",
+            "subscribed_rau_tau_timer", BCON_INT32(12),
+            "network_access_mode", BCON_INT32(0),
+            "subscriber_status", BCON_INT32(0),
+            "access_restriction_data", BCON_INT32(32)
+          );
+    ogs_assert(doc);
+
+    return doc;
+}
+
+static void bench_report(const char *backend, const char *operation,
+        int count, ogs_time_t elapsed)
+{
+    printf("\n    %-8s %-20s %7d ops %10.2f usec/op", backend, operation,
+            count, (double)elapsed / count);
+}
+
+static void bench_record(abts_case *tc, const char *backend)
+{
+    int i, rv;
+    char *supi = NULL;
+    ogs_time_t start;
+    ogs_dbi_record_t record;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_LOOKUP; i++) {
+        supi = bench_supi(i % NUM_OF_SUBSCRIBER);
+        rv = ogs_dbi_subscription_record(supi, &record);
+        ogs_free(supi);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report(backend, "subscription_record", i,
+            ogs_get_monotonic_time() - start);
+}
+
+/* Lookups of the subscribers in the backend selected by db_uri */
+static void bench_lookup(abts_case *tc, const char *backend)
+{
+    int i, rv;
+    char *supi = NULL;
+    ogs_time_t start;
+    ogs_dbi_auth_info_t auth_info;
+    ogs_subscription_data_t subscription_data;
+    ogs_msisdn_data_t msisdn_data;
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_LOOKUP; i++) {
+        supi = bench_supi(i % NUM_OF_SUBSCRIBER);
+        rv = ogs_dbi_auth_info(supi, &auth_info);
+        ogs_free(supi);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report(backend, "auth_info", i, ogs_get_monotonic_time() - start);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_LOOKUP; i++) {
+        supi = bench_supi(i % NUM_OF_SUBSCRIBER);
+        memset(&subscription_data, 0, sizeof(subscription_data));
+        rv = ogs_dbi_subscription_data(supi, &subscription_data);
+        ogs_subscription_data_free(&subscription_data);
+        ogs_free(supi);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report(backend, "subscription_data", i,
+            ogs_get_monotonic_time() - start);
+
+    bench_record(tc, backend);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_LOOKUP; i++) {
+        char msisdn[OGS_MAX_MSISDN_BCD_LEN+1];
+
+        ogs_snprintf(msisdn, sizeof(msisdn),
+                "8210%08d", i % NUM_OF_SUBSCRIBER);
+        memset(&msisdn_data, 0, sizeof(msisdn_data));
+        rv = ogs_dbi_msisdn_data(msisdn, &msisdn_data);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report(backend, "msisdn_data", i, ogs_get_monotonic_time() - start);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_SUBSCRIBER; i++) {
+        supi = bench_supi(i);
+        rv = ogs_dbi_advance_sqn(supi, 64 + i);
+        ogs_free(supi);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report(backend, "advance_sqn", i, ogs_get_monotonic_time() - start);
+
+    supi = bench_supi(7);
+    rv = ogs_dbi_auth_info(supi, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == 64 + 7 + 32);
+    rv = ogs_dbi_increment_sqn(supi);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_dbi_auth_info(supi, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == 64 + 7 + 64);
+    ogs_free(supi);
+
+    printf("\n");
+}
+
+static void dbi_bench_record(abts_case *tc, void *data)
+{
+    int i, rv;
+    bson_t *doc = NULL;
+    char dnn[OGS_MAX_DNN_LEN+2];
+    ogs_dbi_record_t record;
+    ogs_subscription_data_t *subscription_data = &record.subscription_data;
+    ogs_session_t *session = NULL;
+    ogs_time_t start;
+
+    doc = bench_subscriber(7);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_LOOKUP; i++) {
+        rv = ogs_dbi_record_build(&record, bson_get_data(doc), doc->len);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report("record", "build", i, ogs_get_monotonic_time() - start);
+    printf("\n");
+
+    ABTS_TRUE(tc, ogs_dbi_record_valid(&record, record.length));
+    ABTS_TRUE(tc, !ogs_dbi_record_valid(&record, record.length + 1));
+    ogs_dbi_record_bind(&record);
+
+    ABTS_INT_EQUAL(tc, 1, subscription_data->num_of_msisdn);
+    ABTS_STR_EQUAL(tc, "821000000007", subscription_data->msisdn[0].bcd);
+    ABTS_INT_EQUAL(tc, 32, subscription_data->access_restriction_data);
+    ABTS_TRUE(tc, subscription_data->ambr.downlink == 1024*1024*1024);
+    ABTS_TRUE(tc, subscription_data->ambr.uplink == 1024*1024*1024);
+    ABTS_INT_EQUAL(tc, 12, subscription_data->subscribed_rau_tau_timer);
+    ABTS_INT_EQUAL(tc, 1, subscription_data->num_of_slice);
+    ABTS_INT_EQUAL(tc, 1, subscription_data->slice[0].s_nssai.sst);
+    ABTS_TRUE(tc, subscription_data->slice[0].default_indicator);
+    ABTS_INT_EQUAL(tc, 1, subscription_data->slice[0].num_of_session);
+
+    session = &subscription_data->slice[0].session[0];
+    ABTS_STR_EQUAL(tc, "internet", session->name);
+    ABTS_INT_EQUAL(tc, OGS_PDU_SESSION_TYPE_IPV4V6, session->session_type);
+    ABTS_INT_EQUAL(tc, 9, session->qos.index);
+    ABTS_INT_EQUAL(tc, 8, session->qos.arp.priority_level);
+
+    /* Documents are not trusted */
+    rv = ogs_dbi_record_build(&record, bson_get_data(doc), doc->len - 1);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    bson_destroy(doc);
+
+    doc = BCON_NEW("msisdn", "[",
+            BCON_UTF8("1"), BCON_UTF8("2"), BCON_UTF8("3"), "]");
+    ogs_assert(doc);
+    rv = ogs_dbi_record_build(&record, bson_get_data(doc), doc->len);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    bson_destroy(doc);
+
+    memset(dnn, 'a', sizeof(dnn));
+    dnn[sizeof(dnn)-1] = 0;
+    doc = BCON_NEW("slice", "[", "{", "session", "[", "{",
+            "name", BCON_UTF8(dnn), "}", "]", "}", "]");
+    ogs_assert(doc);
+    rv = ogs_dbi_record_build(&record, bson_get_data(doc), doc->len);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    bson_destroy(doc);
+}
+
+static void dbi_bench_store(abts_case *tc, void *data)
+{
+    int i, rv;
+    char *path = NULL, *db_uri = NULL;
+    bson_t *doc = NULL;
+    ogs_time_t start;
+
+    path = ogs_msprintf("/tmp/open5gs-benchmark-%d.db", (int)getpid());
+    ogs_assert(path);
+
+    rv = ogs_dbi_store_create(path, NUM_OF_SUBSCRIBER);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_SUBSCRIBER; i++) {
+        doc = bench_subscriber(i);
+        rv = ogs_dbi_store_put(doc);
+        bson_destroy(doc);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, NUM_OF_SUBSCRIBER, ogs_dbi_store_count());
+    bench_report("store", "put", i, ogs_get_monotonic_time() - start);
+
+    ogs_dbi_store_close();
+
+    db_uri = ogs_msprintf("%s%s", OGS_DBI_STORE_URI_PREFIX, path);
+    ogs_assert(db_uri);
+
+    rv = ogs_dbi_init(db_uri);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    if (rv == OGS_OK) {
+        /* Records are decoded by ogs_dbi_store_put() and copied as is */
+        bench_lookup(tc, "store");
+        ogs_dbi_final();
+    }
+
+    unlink(path);
+    ogs_free(db_uri);
+    ogs_free(path);
+}
+
+static void dbi_bench_mongoc(abts_case *tc, void *data)
+{
+    int i, rv;
+    const char *db_uri = NULL;
+    bson_t *doc = NULL, *cmd = NULL;
+    bson_error_t error;
+    ogs_time_t start;
+
+    db_uri = getenv("DB_URI");
+    if (!db_uri)
+        db_uri = "mongodb://localhost/open5gs-benchmark";
+
+    rv = ogs_dbi_init(db_uri);
+    if (rv != OGS_OK) {
+        printf("\n    mongodb  skipped (cannot connect to %s)\n", db_uri);
+        ogs_dbi_final();
+        return;
+    }
+
+    mongoc_collection_drop(ogs_mongoc()->collection.subscriber, NULL);
+
+    /* Same indexes as the SUPI/MSISDN hash of the store */
+    cmd = BCON_NEW("createIndexes", BCON_UTF8("subscribers"),
+            "indexes", "[",
+                "{",
+                    "key", "{", "imsi", BCON_INT32(1), "}",
+                    "name", BCON_UTF8("imsi_1"),
+                "}",
+                "{",
+                    "key", "{", "msisdn", BCON_INT32(1), "}",
+                    "name", BCON_UTF8("msisdn_1"),
+                "}",
+            "]");
+    ogs_assert(cmd);
+    if (!mongoc_collection_command_simple(
+            ogs_mongoc()->collection.subscriber, cmd, NULL, NULL, &error))
+        ogs_warn("createIndexes failure: %s", error.message);
+    bson_destroy(cmd);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_SUBSCRIBER; i++) {
+        doc = bench_subscriber(i);
+        rv = mongoc_collection_insert(ogs_mongoc()->collection.subscriber,
+                MONGOC_INSERT_NONE, doc, NULL, &error) ? OGS_OK : OGS_ERROR;
+        bson_destroy(doc);
+        if (rv != OGS_OK) break;
+    }
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    bench_report("mongodb", "insert", i, ogs_get_monotonic_time() - start);
+
+    bench_lookup(tc, "mongodb");
+
+    /* Every record is decoded once, then copied from the cache */
+    ogs_dbi_cache_init(NUM_OF_SUBSCRIBER, 0, false);
+    for (i = 0; i < NUM_OF_SUBSCRIBER; i++) {
+        ogs_dbi_record_t record;
+        char *supi = bench_supi(i);
+
+        ogs_dbi_subscription_record(supi, &record);
+        ogs_free(supi);
+    }
+    bench_record(tc, "cached");
+    printf("\n");
+
+    mongoc_collection_drop(ogs_mongoc()->collection.subscriber, NULL);
+    ogs_dbi_final();
+}
+
+abts_suite *test_dbi_bench(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, dbi_bench_record, NULL);
+    abts_run_test(suite, dbi_bench_store, NULL);
+    abts_run_test(suite, dbi_bench_mongoc, NULL);
+
+    return suite;
+}
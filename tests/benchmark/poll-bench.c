@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+#include "core/abts.h"
+
+/*
+ * Microbenchmark : the cost of toggling write interest on an fd which is
+ * polled for reading, as the SBI sessions do around a short write, and of
+ * dispatching events when all the fds are readable.
+ */
+#define BENCH_NUM_OF_FD     256
+#define BENCH_LOOP          100
+
+static int bench_called;
+
+static void bench_handler(short when, ogs_socket_t fd, void *data)
+{
+    char buf[16];
+
+    if (when & OGS_POLLIN)
+        while (ogs_recv(fd, buf, sizeof(buf), 0) > 0);
+
+    bench_called++;
+}
+
+static void bench_print(const char *name, int n, ogs_time_t duration)
+{
+    printf("\n    %-28s %8d ops %8.1f nsec/op",
+            name, n, (double)duration * 1000 / n);
+}
+
+static void bench_run(abts_case *tc, ogs_pollset_t *pollset,
+        ogs_socket_t (*fd)[2], short et)
+{
+    ogs_poll_t *read[BENCH_NUM_OF_FD], *write = NULL;
+    ogs_time_t start, duration;
+    int i, j, rv;
+
+    for (i = 0; i < BENCH_NUM_OF_FD; i++) {
+        read[i] = ogs_pollset_add(pollset, OGS_POLLIN|et,
+                fd[i][1], bench_handler, NULL);
+        ABTS_PTR_NOTNULL(tc, read[i]);
+    }
+
+    start = ogs_get_monotonic_time();
+    for (j = 0; j < BENCH_LOOP; j++) {
+        for (i = 0; i < BENCH_NUM_OF_FD; i++) {
+            write = ogs_pollset_add(pollset, OGS_POLLOUT|et,
+                    fd[i][1], bench_handler, NULL);
+            ogs_assert(write);
+            ogs_pollset_remove(write);
+        }
+    }
+    bench_print(et ? "add/remove POLLOUT (ET)" : "add/remove POLLOUT",
+            BENCH_NUM_OF_FD * BENCH_LOOP, ogs_get_monotonic_time() - start);
+
+    duration = 0;
+    for (j = 0; j < BENCH_LOOP; j++) {
+        for (i = 0; i < BENCH_NUM_OF_FD; i++)
+            ogs_send(fd[i][0], "x", 1, 0);
+
+        bench_called = 0;
+        start = ogs_get_monotonic_time();
+        while (bench_called < BENCH_NUM_OF_FD) {
+            rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+            ogs_assert(rv == OGS_OK);
+        }
+        duration += ogs_get_monotonic_time() - start;
+        ABTS_INT_EQUAL(tc, BENCH_NUM_OF_FD, bench_called);
+    }
+    bench_print(et ? "dispatch POLLIN (ET)" : "dispatch POLLIN",
+            BENCH_NUM_OF_FD * BENCH_LOOP, duration);
+
+    for (i = 0; i < BENCH_NUM_OF_FD; i++)
+        ogs_pollset_remove(read[i]);
+}
+
+static void poll_bench_func(abts_case *tc, void *data)
+{
+    ogs_socket_t fd[BENCH_NUM_OF_FD][2];
+    ogs_pollset_t *pollset = NULL;
+    int i, rv;
+
+    pollset = ogs_pollset_create(BENCH_NUM_OF_FD * 2);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    for (i = 0; i < BENCH_NUM_OF_FD; i++) {
+        rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, fd[i]);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    }
+
+    bench_run(tc, pollset, fd, 0);
+    bench_run(tc, pollset, fd, OGS_POLLET);
+    printf("\n");
+
+    for (i = 0; i < BENCH_NUM_OF_FD; i++) {
+        ogs_closesocket(fd[i][0]);
+        ogs_closesocket(fd[i][1]);
+    }
+
+    ogs_pollset_destroy(pollset);
+}
+
+abts_suite *test_poll_bench(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, poll_bench_func, NULL);
+
+    return suite;
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-sbi.h"
+#include "core/abts.h"
+
+#include <sys/resource.h>
+
+/*
+ * Compares the SBI client transports against the nghttp2 server
+ * in the same process.
+ *
+ * Depth is the number of requests kept in flight. Depth 1 gives
+ * the round-trip latency and a larger depth the throughput.
+ * CPU time includes the server side.
+ */
+#define NUM_OF_REQUEST          20000
+#define BENCH_PORT              17777
+#define BENCH_URI               "http://127.0.0.1:17777/nbench/v1/ping"
+#define BENCH_CONTENT           "{\"nfInstanceId\":\"bench\",\"status\":\"OK\"}"
+
+extern const ogs_sbi_client_actions_t ogs_curl_client_actions;
+extern const ogs_sbi_client_actions_t ogs_nghttp2_client_actions;
+
+static struct {
+    ogs_sbi_client_t *client;
+
+    int total;
+    int sent;
+    int received;
+    int ok;
+} bench;
+
+static int bench_server_cb(ogs_sbi_request_t *request, void *data)
+{
+    ogs_sbi_stream_t *stream = data;
+    ogs_sbi_response_t *response = NULL;
+
+    ogs_assert(request);
+    ogs_assert(stream);
+
+    response = ogs_sbi_response_new();
+    ogs_assert(response);
+
+    response->status = OGS_SBI_HTTP_STATUS_OK;
+    response->http.content = ogs_strdup(BENCH_CONTENT);
+    ogs_assert(response->http.content);
+    response->http.content_length = strlen(BENCH_CONTENT);
+    ogs_sbi_header_set(response->http.headers,
+            OGS_SBI_CONTENT_TYPE, OGS_SBI_CONTENT_JSON_TYPE);
+
+    ogs_assert(true == ogs_sbi_server_send_response(stream, response));
+
+    return OGS_OK;
+}
+
+static int bench_client_cb(
+        int status, ogs_sbi_response_t *response, void *data);
+
+static void bench_send(void)
+{
+    ogs_sbi_request_t *request = NULL;
+
+    request = ogs_sbi_request_new();
+    ogs_assert(request);
+
+    request->h.method = ogs_strdup(OGS_SBI_HTTP_METHOD_GET);
+    ogs_assert(request->h.method);
+    request->h.uri = ogs_strdup(BENCH_URI);
+    ogs_assert(request->h.uri);
+    ogs_sbi_header_set(request->http.headers,
+            OGS_SBI_ACCEPT, OGS_SBI_CONTENT_JSON_TYPE);
+
+    bench.sent++;
+    ogs_assert(true == ogs_sbi_client_send_request(
+                bench.client, bench_client_cb, request, NULL));
+}
+
+static int bench_client_cb(
+        int status, ogs_sbi_response_t *response, void *data)
+{
+    if (status == OGS_OK && response &&
+        response->status == OGS_SBI_HTTP_STATUS_OK &&
+        response->http.content_length == strlen(BENCH_CONTENT))
+        bench.ok++;
+
+    if (response)
+        ogs_sbi_response_free(response);
+
+    bench.received++;
+    if (bench.sent < bench.total)
+        bench_send();
+
+    return OGS_OK;
+}
+
+static ogs_time_t cpu_time(void)
+{
+    struct rusage usage;
+
+    ogs_assert(getrusage(RUSAGE_SELF, &usage) == 0);
+
+    return ogs_time_from_sec(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+        usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+static void bench_run(abts_case *tc, const char *transport, int depth)
+{
+    int i, rv = OGS_OK;
+    ogs_time_t start, cpu;
+
+    bench.total = NUM_OF_REQUEST;
+    bench.sent = bench.received = bench.ok = 0;
+
+    cpu = cpu_time();
+    start = ogs_get_monotonic_time();
+
+    for (i = 0; i < depth; i++)
+        bench_send();
+
+    while (bench.received < bench.total) {
+        rv = ogs_pollset_poll(ogs_app()->pollset,
+                ogs_timer_mgr_next(ogs_app()->timer_mgr));
+        if (rv == OGS_ERROR) break;
+
+        ogs_timer_mgr_expire(ogs_app()->timer_mgr);
+    }
+
+    start = ogs_get_monotonic_time() - start;
+    cpu = cpu_time() - cpu;
+
+    ABTS_TRUE(tc, rv != OGS_ERROR);
+    ABTS_INT_EQUAL(tc, bench.total, bench.ok);
+
+    printf("\n    %-8s depth %-3d %7d reqs %10.2f usec/req "
+            "%10.2f cpu-usec/req %10.0f req/sec",
+            transport, depth, bench.received,
+            (double)start / bench.received, (double)cpu / bench.received,
+            (double)bench.received * OGS_USEC_PER_SEC / start);
+}
+
+static void bench_transport(abts_case *tc, const char *transport,
+        const ogs_sbi_client_actions_t *actions, ogs_sockaddr_t *addr)
+{
+    ogs_sbi_client_actions.cleanup();
+    ogs_sbi_client_actions = *actions;
+    ogs_sbi_client_actions.init(ogs_app()->pool.event, ogs_app()->pool.event);
+
+    bench.client = ogs_sbi_client_add(addr);
+    ogs_assert(bench.client);
+
+    bench_run(tc, transport, 1);
+    bench_run(tc, transport, 64);
+
+    ogs_sbi_client_remove(bench.client);
+    bench.client = NULL;
+}
+
+static void sbi_bench_client(abts_case *tc, void *data)
+{
+    int rv;
+    ogs_sockaddr_t *addr = NULL;
+
+    rv = ogs_app_context_init();
+    ogs_assert(rv == OGS_OK);
+
+    ogs_app()->timer_mgr = ogs_timer_mgr_create(ogs_app()->pool.timer);
+    ogs_assert(ogs_app()->timer_mgr);
+    ogs_app()->pollset = ogs_pollset_create(ogs_app()->pool.socket);
+    ogs_assert(ogs_app()->pollset);
+
+    ogs_sbi_context_init();
+
+    rv = ogs_getaddrinfo(&addr, AF_INET, "127.0.0.1", BENCH_PORT, 0);
+    ogs_assert(rv == OGS_OK);
+
+    ogs_assert(ogs_sbi_server_add(addr, NULL));
+    rv = ogs_sbi_server_start_all(bench_server_cb);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    if (rv == OGS_OK) {
+        bench_transport(tc, "curl", &ogs_curl_client_actions, addr);
+        bench_transport(tc, "nghttp2", &ogs_nghttp2_client_actions, addr);
+        printf("\n");
+    }
+
+    ogs_sbi_server_stop_all();
+    ogs_freeaddrinfo(addr);
+
+    ogs_sbi_context_final();
+    ogs_app_context_final();
+}
+
+abts_suite *test_sbi_bench(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, sbi_bench_client, NULL);
+
+    return suite;
+}
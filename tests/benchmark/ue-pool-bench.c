@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-pfcp.h"
+#include "core/abts.h"
+
+/*
+ * Allocation throughput and memory of the UE IP pool.
+ *
+ * A /10 subnet has 2^22 addresses, which used to need one
+ * ogs_pfcp_ue_ip_t per address before the first session.
+ */
+#define NUM_OF_ADDRESS          (1 << 22)
+
+static void bench_print(const char *name, int n, ogs_time_t duration,
+        ogs_bitmap_t *bitmap)
+{
+    printf("\n    %-24s %8d ops %8.1f nsec/op %10.0f KB",
+            name, n, (double)duration * 1000 / n,
+            (double)ogs_bitmap_memory(bitmap) / 1024);
+}
+
+static void ue_pool_bench_bitmap(abts_case *tc, void *data)
+{
+    ogs_bitmap_t *bitmap = NULL;
+    ogs_time_t start;
+    uint32_t index;
+    int i, rv;
+
+    bitmap = ogs_bitmap_create(NUM_OF_ADDRESS);
+    ABTS_PTR_NOTNULL(tc, bitmap);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_ADDRESS / 16; i++) {
+        rv = ogs_bitmap_alloc(bitmap, &index);
+        ogs_assert(rv == OGS_OK);
+    }
+    bench_print("alloc 1/16", NUM_OF_ADDRESS / 16,
+            ogs_get_monotonic_time() - start, bitmap);
+
+    start = ogs_get_monotonic_time();
+    for (; i < NUM_OF_ADDRESS; i++) {
+        rv = ogs_bitmap_alloc(bitmap, &index);
+        ogs_assert(rv == OGS_OK);
+    }
+    bench_print("alloc full", NUM_OF_ADDRESS - NUM_OF_ADDRESS / 16,
+            ogs_get_monotonic_time() - start, bitmap);
+
+    rv = ogs_bitmap_alloc(bitmap, &index);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+
+    /* Churn : free and allocate again with the pool almost full */
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_ADDRESS; i += 7) {
+        ogs_bitmap_clear(bitmap, i);
+        rv = ogs_bitmap_alloc(bitmap, &index);
+        ogs_assert(rv == OGS_OK && index == i);
+    }
+    bench_print("free/alloc full", NUM_OF_ADDRESS / 7,
+            ogs_get_monotonic_time() - start, bitmap);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < NUM_OF_ADDRESS; i++)
+        ogs_bitmap_clear(bitmap, i);
+    bench_print("free all", NUM_OF_ADDRESS,
+            ogs_get_monotonic_time() - start, bitmap);
+    ABTS_INT_EQUAL(tc, 0, ogs_bitmap_used(bitmap));
+
+    ogs_bitmap_destroy(bitmap);
+}
+
+static void ue_pool_bench_subnet(abts_case *tc, void *data)
+{
+    ogs_pfcp_subnet_t *subnet = NULL;
+    ogs_pfcp_ue_ip_t **ue_ip = NULL;
+    uint8_t cause_value = 0, addr[OGS_IPV6_LEN];
+    ogs_time_t start;
+    int i, n, rv;
+
+    rv = ogs_app_context_init();
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ogs_pfcp_context_init();
+
+    subnet = ogs_pfcp_subnet_add("10.64.0.1", "10", NULL, "ogstun");
+    ABTS_PTR_NOTNULL(tc, subnet);
+    subnet->num_of_reserved = 1;
+    subnet->reserved[0].low = "10.64.0.2";
+    subnet->reserved[0].high = "10.64.0.255";
+
+    start = ogs_get_monotonic_time();
+    rv = ogs_pfcp_ue_pool_generate();
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 1, subnet->num_of_pool);
+    bench_print("generate /10", 1,
+            ogs_get_monotonic_time() - start, subnet->pool[0].bitmap);
+
+    n = ogs_app()->pool.sess * 2;
+    ue_ip = ogs_calloc(n, sizeof(*ue_ip));
+    ogs_assert(ue_ip);
+    memset(addr, 0, sizeof(addr));
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < n; i++) {
+        ue_ip[i] = ogs_pfcp_ue_ip_alloc(&cause_value, AF_INET, NULL, addr);
+        ogs_assert(ue_ip[i]);
+    }
+    bench_print("ue_ip_alloc", n,
+            ogs_get_monotonic_time() - start, subnet->pool[0].bitmap);
+
+    /* The network, the gateway and the reserved range are skipped */
+    ABTS_INT_EQUAL(tc, htobe32(0x0a400100), ue_ip[0]->addr[0]);
+
+    start = ogs_get_monotonic_time();
+    for (i = 0; i < n; i++)
+        ogs_pfcp_ue_ip_free(ue_ip[i]);
+    bench_print("ue_ip_free", n,
+            ogs_get_monotonic_time() - start, subnet->pool[0].bitmap);
+    printf("\n");
+
+    ogs_free(ue_ip);
+
+    ogs_pfcp_context_final();
+    ogs_app_context_final();
+}
+
+abts_suite *test_ue_pool_bench(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, ue_pool_bench_bitmap, NULL);
+    abts_run_test(suite, ue_pool_bench_subnet, NULL);
+
+    return suite;
+}
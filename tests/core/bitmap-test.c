@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+#include "core/abts.h"
+
+static void bitmap_test1(abts_case *tc, void *data)
+{
+    ogs_bitmap_t *bitmap = NULL;
+    uint32_t i, index;
+    int rv;
+
+    /* Not a multiple of the word or the page size */
+    bitmap = ogs_bitmap_create(5000);
+    ABTS_PTR_NOTNULL(tc, bitmap);
+    ABTS_INT_EQUAL(tc, 5000, ogs_bitmap_size(bitmap));
+    ABTS_INT_EQUAL(tc, 0, ogs_bitmap_used(bitmap));
+
+    for (i = 0; i < 5000; i++) {
+        rv = ogs_bitmap_alloc(bitmap, &index);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_INT_EQUAL(tc, i, index);
+    }
+    ABTS_INT_EQUAL(tc, 5000, ogs_bitmap_used(bitmap));
+
+    rv = ogs_bitmap_alloc(bitmap, &index);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+
+    /* The lowest free index is taken first */
+    ogs_bitmap_clear(bitmap, 4097);
+    ogs_bitmap_clear(bitmap, 63);
+    ABTS_TRUE(tc, !ogs_bitmap_test(bitmap, 63));
+    ABTS_TRUE(tc, ogs_bitmap_test(bitmap, 64));
+
+    rv = ogs_bitmap_alloc(bitmap, &index);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 63, index);
+    rv = ogs_bitmap_alloc(bitmap, &index);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 4097, index);
+
+    for (i = 0; i < 5000; i++)
+        ogs_bitmap_clear(bitmap, i);
+    ABTS_INT_EQUAL(tc, 0, ogs_bitmap_used(bitmap));
+
+    ogs_bitmap_destroy(bitmap);
+}
+
+static void bitmap_test2(abts_case *tc, void *data)
+{
+    ogs_bitmap_t *bitmap = NULL;
+    size_t empty;
+    uint32_t index;
+    int rv;
+
+    bitmap = ogs_bitmap_create(OGS_BITMAP_MAX_SIZE);
+    ABTS_PTR_NOTNULL(tc, bitmap);
+    empty = ogs_bitmap_memory(bitmap);
+
+    /* Reserved indexes are skipped by the allocation */
+    ABTS_TRUE(tc, ogs_bitmap_set(bitmap, 0));
+    ABTS_TRUE(tc, ogs_bitmap_set(bitmap, 1));
+    ABTS_TRUE(tc, !ogs_bitmap_set(bitmap, 1));
+    ABTS_TRUE(tc, ogs_bitmap_set(bitmap, OGS_BITMAP_MAX_SIZE-1));
+
+    rv = ogs_bitmap_alloc(bitmap, &index);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 2, index);
+    ABTS_INT_EQUAL(tc, 4, ogs_bitmap_used(bitmap));
+
+    /* Only the pages in use are allocated */
+    ABTS_TRUE(tc, ogs_bitmap_memory(bitmap) > empty);
+    ogs_bitmap_clear(bitmap, 0);
+    ogs_bitmap_clear(bitmap, 1);
+    ogs_bitmap_clear(bitmap, 2);
+    ogs_bitmap_clear(bitmap, OGS_BITMAP_MAX_SIZE-1);
+    ABTS_INT_EQUAL(tc, empty, ogs_bitmap_memory(bitmap));
+
+    ogs_bitmap_destroy(bitmap);
+}
+
+abts_suite *test_bitmap(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, bitmap_test1, NULL);
+    abts_run_test(suite, bitmap_test2, NULL);
+
+    return suite;
+}
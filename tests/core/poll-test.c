@@ -657,6 +657,73 @@ static void test8_func(abts_case *tc, void *data)
     ogs_pollset_destroy(pollset);
 }
 
+static int test9_read;
+static int test9_write;
+
+static void test9_handler(short when, ogs_socket_t fd, void *data)
+{
+    char buf[STRLEN];
+
+    if (when & OGS_POLLIN) {
+        while (ogs_recv(fd, buf, sizeof(buf), 0) > 0);
+        test9_read++;
+    }
+    if (when & OGS_POLLOUT)
+        test9_write++;
+}
+
+static void test9_func(abts_case *tc, void *data)
+{
+    int rv;
+    ogs_socket_t fd[2];
+    ogs_poll_t *read = NULL, *write = NULL;
+    char buf[STRLEN];
+    ogs_pollset_t *pollset = ogs_pollset_create(512);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    rv = ogs_socketpair(AF_SOCKPAIR, SOCK_STREAM, 0, fd);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_nonblocking(fd[0]);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    read = ogs_pollset_add(pollset, OGS_POLLIN|OGS_POLLET,
+            fd[1], test9_handler, tc);
+    ABTS_PTR_NOTNULL(tc, read);
+
+    /* The handler drains the socket, so it is called once */
+    ogs_send(fd[0], DATASTR, strlen(DATASTR), 0);
+    ogs_send(fd[0], DATASTR, strlen(DATASTR), 0);
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 1, test9_read);
+    rv = ogs_pollset_poll(pollset, 0);
+    ABTS_INT_EQUAL(tc, OGS_TIMEUP, rv);
+
+    /* Write poll added after the socket is full, reported once drained */
+    memset(buf, 0, sizeof(buf));
+    while (ogs_send(fd[1], buf, sizeof(buf), 0) > 0);
+    write = ogs_pollset_add(pollset, OGS_POLLOUT|OGS_POLLET,
+            fd[1], test9_handler, tc);
+    ABTS_PTR_NOTNULL(tc, write);
+    rv = ogs_pollset_poll(pollset, 0);
+    ABTS_INT_EQUAL(tc, OGS_TIMEUP, rv);
+    ABTS_INT_EQUAL(tc, 0, test9_write);
+
+    while (ogs_recv(fd[0], buf, sizeof(buf), 0) > 0);
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(100));
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_INT_EQUAL(tc, 1, test9_write);
+    ABTS_INT_EQUAL(tc, 1, test9_read);
+
+    ogs_pollset_remove(write);
+    ogs_pollset_remove(read);
+
+    ogs_closesocket(fd[0]);
+    ogs_closesocket(fd[1]);
+
+    ogs_pollset_destroy(pollset);
+}
+
 abts_suite *test_poll(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -672,6 +739,7 @@ abts_suite *test_poll(abts_suite *suite)
     abts_run_test(suite, test6_func, NULL);
     abts_run_test(suite, test7_func, NULL);
     abts_run_test(suite, test8_func, NULL);
+    abts_run_test(suite, test9_func, NULL);
 
     return suite;
 }
@@ -228,6 +228,78 @@ static void test3_func(abts_case *tc, void *data)
     ogs_pool_final(&testpool);
 }
 
+typedef struct {
+    uint64_t id;
+    char data[1000];
+} growable_node_t;
+
+#define SIZE_OF_GROWABLE_POOL   1000
+
+static OGS_POOL(growable_pool, growable_node_t);
+
+static void test4_func(abts_case *tc, void *data)
+{
+    growable_node_t *node[SIZE_OF_GROWABLE_POOL+1];
+    growable_node_t *first = NULL, *last = NULL;
+    int i, index;
+
+    ogs_pool_init_growable(&growable_pool, SIZE_OF_GROWABLE_POOL);
+    ABTS_INT_EQUAL(tc, SIZE_OF_GROWABLE_POOL, ogs_pool_size(&growable_pool));
+    ABTS_INT_EQUAL(tc, SIZE_OF_GROWABLE_POOL, ogs_pool_avail(&growable_pool));
+
+    /* Nothing is allocated before the first node */
+    ABTS_INT_EQUAL(tc, 0, ogs_pool_slab_memory(growable_pool.slab));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_find(&growable_pool, 1));
+
+    ogs_pool_alloc(&growable_pool, &node[0]);
+    ABTS_PTR_NOTNULL(tc, node[0]);
+    ABTS_INT_EQUAL(tc, 1, ogs_pool_index(&growable_pool, node[0]));
+    ABTS_TRUE(tc, ogs_pool_slab_memory(growable_pool.slab) <
+            SIZE_OF_GROWABLE_POOL * sizeof(growable_node_t));
+
+    for (i = 1; i < SIZE_OF_GROWABLE_POOL; i++) {
+        ogs_pool_alloc(&growable_pool, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+        node[i]->id = i;
+    }
+    ABTS_INT_EQUAL(tc, 0, ogs_pool_avail(&growable_pool));
+
+    ogs_pool_alloc(&growable_pool, &node[SIZE_OF_GROWABLE_POOL]);
+    ABTS_PTR_EQUAL(tc, NULL, node[SIZE_OF_GROWABLE_POOL]);
+
+    for (i = 0; i < SIZE_OF_GROWABLE_POOL; i++) {
+        index = ogs_pool_index(&growable_pool, node[i]);
+        ABTS_INT_EQUAL(tc, i + 1, index);
+        ABTS_PTR_EQUAL(tc, node[i], ogs_pool_find(&growable_pool, index));
+        ABTS_PTR_EQUAL(tc, node[i], ogs_pool_cycle(&growable_pool, node[i]));
+    }
+    ABTS_PTR_EQUAL(tc, NULL,
+            ogs_pool_find(&growable_pool, SIZE_OF_GROWABLE_POOL + 1));
+
+    /* A freed node is no longer found, and is not freed twice */
+    first = node[10];
+    last = node[20];
+    ogs_pool_free(&growable_pool, first);
+    ogs_pool_free(&growable_pool, last);
+    ogs_pool_free(&growable_pool, last);
+    ABTS_INT_EQUAL(tc, 2, ogs_pool_avail(&growable_pool));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_find(&growable_pool, 11));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_pool_cycle(&growable_pool, last));
+
+    /* The first freed is the first reused */
+    ogs_pool_alloc(&growable_pool, &node[10]);
+    ABTS_PTR_EQUAL(tc, first, node[10]);
+    ogs_pool_alloc(&growable_pool, &node[20]);
+    ABTS_PTR_EQUAL(tc, last, node[20]);
+    ABTS_INT_EQUAL(tc, 21, ogs_pool_index(&growable_pool, node[20]));
+
+    for (i = 0; i < SIZE_OF_GROWABLE_POOL; i++)
+        ogs_pool_free(&growable_pool, node[i]);
+    ABTS_INT_EQUAL(tc, SIZE_OF_GROWABLE_POOL, ogs_pool_avail(&growable_pool));
+
+    ogs_pool_final(&growable_pool);
+}
+
 abts_suite *test_pool(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -235,6 +307,7 @@ abts_suite *test_pool(abts_suite *suite)
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
     abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test4_func, NULL);
 
     return suite;
 }
@@ -166,12 +166,58 @@ static void test_queue_timeout(abts_case *tc, void *data)
     ogs_queue_destroy(q);
 }
 
+static void test_queue_bulk(abts_case *tc, void *data)
+{
+    ogs_queue_t *q;
+    int rv;
+    unsigned int i, n;
+    long in[4] = { 1, 2, 3, 4 };
+    void *values[4];
+    void *value;
+
+    q = ogs_queue_create(3);
+    ABTS_PTR_NOTNULL(tc, q);
+
+    for (i = 0; i < 4; i++)
+        values[i] = (void *)in[i];
+
+    rv = ogs_queue_trypush(q, NULL);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    n = ogs_queue_trypush_bulk(q, values, 4);
+    ABTS_INT_EQUAL(tc, 2, n);
+    n = ogs_queue_trypush_bulk(q, values + 2, 2);
+    ABTS_INT_EQUAL(tc, 0, n);
+
+    rv = ogs_queue_trypop(q, &value);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_PTR_EQUAL(tc, NULL, value);
+    n = ogs_queue_trypush_bulk(q, values + 2, 2);
+    ABTS_INT_EQUAL(tc, 1, n);
+
+    for (i = 0; i < 3; i++) {
+        rv = ogs_queue_trypop(q, &value);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_PTR_EQUAL(tc, values[i], value);
+    }
+    rv = ogs_queue_trypop(q, &value);
+    ABTS_INT_EQUAL(tc, OGS_RETRY, rv);
+
+    rv = ogs_queue_term(q);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    n = ogs_queue_trypush_bulk(q, values, 4);
+    ABTS_INT_EQUAL(tc, 0, n);
+
+    ogs_queue_destroy(q);
+}
+
 abts_suite *test_queue(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test_queue_producer_consumer, NULL);
     abts_run_test(suite, test_queue_timeout, NULL);
+    abts_run_test(suite, test_queue_bulk, NULL);
 
     return suite;
 }
@@ -100,6 +100,43 @@ static void test_imp_gmt(abts_case *tc, void *data)
     ABTS_TRUE(tc, now == imp);
 }
 
+static void test_loop_time(abts_case *tc, void *data)
+{
+    ogs_pollset_t *pollset = NULL;
+    ogs_time_t t, gmt;
+    int rv;
+
+    /* Before the thread polls, it is the real clock */
+    t = ogs_loop_monotonic_time();
+    ogs_msleep(2);
+    ABTS_TRUE(tc, ogs_loop_monotonic_time() > t);
+
+    pollset = ogs_pollset_create(8);
+    ABTS_PTR_NOTNULL(tc, pollset);
+
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(1));
+    ABTS_INT_EQUAL(tc, OGS_TIMEUP, rv);
+    t = ogs_loop_monotonic_time();
+    gmt = ogs_loop_time_now();
+
+    /* It only moves when the loop wakes up */
+    ogs_msleep(2);
+    ABTS_TRUE(tc, ogs_loop_monotonic_time() == t);
+    ABTS_TRUE(tc, ogs_loop_time_now() == gmt);
+    ABTS_TRUE(tc, ogs_get_monotonic_time() > t);
+
+    rv = ogs_pollset_poll(pollset, ogs_time_from_msec(1));
+    ABTS_INT_EQUAL(tc, OGS_TIMEUP, rv);
+    ABTS_TRUE(tc, ogs_loop_monotonic_time() >= t + ogs_time_from_msec(3));
+    ABTS_TRUE(tc, ogs_loop_time_now() >= gmt + ogs_time_from_msec(3));
+
+    /* And is the real clock again once the pollset is gone */
+    ogs_pollset_destroy(pollset);
+    t = ogs_loop_monotonic_time();
+    ogs_msleep(2);
+    ABTS_TRUE(tc, ogs_loop_monotonic_time() > t);
+}
+
 abts_suite *test_time(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -109,6 +146,7 @@ abts_suite *test_time(abts_suite *suite)
     abts_run_test(suite, test_get_gmt, NULL);
     abts_run_test(suite, test_get_lt, NULL);
     abts_run_test(suite, test_imp_gmt, NULL);
+    abts_run_test(suite, test_loop_time, NULL);
 
     return suite;
 }
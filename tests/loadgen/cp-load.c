@@ -0,0 +1,980 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Control-plane load generator
+ *
+ * Drives simulated gNBs and UEs built on tests/common against a running
+ * 5GC. Each UE repeatedly runs a cycle of
+ *
+ *   Registration -> PDU Session Establishment -> AN Release ->
+ *   Service Request -> Deregistration
+ *
+ * and new cycles are started at a fixed rate. Every UE-associated
+ * message is routed back to its UE with the RAN-UE-NGAP-ID, so all UEs
+ * run concurrently over one SCTP association per gNB.
+ *
+ * The AMF address, PLMN and TAI come from the configuration file. UE n
+ * uses the MSIN given with -i plus n, and is added to the database for
+ * the run unless -p is given.
+ */
+
+#include <signal.h>
+
+#include "test-config-private.h"
+#include "test-common.h"
+
+#include "histogram.h"
+
+#define DEFAULT_CONFIG_FILENAME \
+    MESON_BUILD_ROOT OGS_DIR_SEPARATOR_S "configs" OGS_DIR_SEPARATOR_S \
+    "sample.yaml"
+
+#define GNB_ID_BASE                 0x4000
+#define TICK_INTERVAL               ogs_time_from_msec(10)
+
+typedef enum {
+    PROCEDURE_NONE = -1,
+    PROCEDURE_REGISTRATION = 0,
+    PROCEDURE_PDU_SESSION,
+    PROCEDURE_AN_RELEASE,
+    PROCEDURE_SERVICE_REQUEST,
+    PROCEDURE_DEREGISTRATION,
+    MAX_NUM_OF_PROCEDURE,
+} procedure_e;
+
+static const char *procedure_name[MAX_NUM_OF_PROCEDURE] = {
+    "registration",
+    "pdu-session",
+    "an-release",
+    "service-request",
+    "deregistration",
+};
+
+typedef struct ue_s ue_t;
+
+typedef struct gnb_s {
+    uint32_t gnb_id;
+    ogs_socknode_t *node;
+    ogs_poll_t *poll;
+    bool ready;
+
+    int num_of_ue;
+    ue_t **ue;
+} gnb_t;
+
+struct ue_s {
+    ogs_lnode_t lnode;          /* A node of the idle list */
+
+    test_ue_t *test_ue;
+    test_sess_t *sess;
+
+    gnb_t *gnb;
+    uint32_t slot;              /* Position in gnb->ue */
+    uint32_t generation;
+    uint32_t ran_ue_ngap_id;
+
+    procedure_e procedure;
+    ogs_time_t started;
+    bool thinking;              /* The timer is the delay between procedures */
+    ogs_timer_t *timer;
+    ogs_pkbuf_t *nasbuf;
+
+    int cycle;
+};
+
+static struct {
+    int num_of_gnb;
+    int num_of_ue;
+    int cycles;
+    double rate;
+    ogs_time_t timeout;
+    ogs_time_t think;
+    uint64_t msin;
+    const char *k;
+    const char *opc;
+    bool provision;
+} config;
+
+static struct {
+    loadgen_histogram_t latency[MAX_NUM_OF_PROCEDURE];
+    uint64_t failed[MAX_NUM_OF_PROCEDURE];
+    uint64_t timeout[MAX_NUM_OF_PROCEDURE];
+    uint64_t unexpected;
+
+    uint64_t started;
+    uint64_t completed;
+    uint64_t aborted;
+} stats;
+
+static gnb_t *gnb_array;
+static ue_t *ue_array;
+static OGS_LIST(idle_list);
+static int num_of_idle;
+static int num_of_finished;
+
+static ogs_timer_t *t_tick;
+static ogs_time_t start_time;
+static int last_report;
+static volatile bool stopped;
+
+static void ue_begin(ue_t *ue, procedure_e procedure);
+
+static void gnb_send(gnb_t *gnb, ogs_pkbuf_t *pkbuf)
+{
+    ogs_assert(pkbuf);
+
+    if (testgnb_ngap_send(gnb->node, pkbuf) != OGS_OK) {
+        ogs_fatal("gNB[0x%x] cannot send", gnb->gnb_id);
+        ogs_pkbuf_free(pkbuf);
+        stopped = true;
+    }
+}
+
+static void ue_send_nas(ue_t *ue, ogs_pkbuf_t *gmmbuf)
+{
+    ogs_assert(gmmbuf);
+    gnb_send(ue->gnb, testngap_build_uplink_nas_transport(ue->test_ue, gmmbuf));
+}
+
+/*
+ * A new RAN-UE-NGAP-ID for each InitialUEMessage. The slot in the gNB is
+ * the ID modulo the number of UEs, and messages for an older ID are
+ * ignored instead of being taken for the current procedure.
+ */
+static void ue_new_ran_ue_ngap_id(ue_t *ue)
+{
+    gnb_t *gnb = ue->gnb;
+
+    ue->generation = (ue->generation + 1) % (UINT32_MAX / gnb->num_of_ue);
+    ue->ran_ue_ngap_id = ue->generation * gnb->num_of_ue + ue->slot;
+
+    /* testngap_build_initial_ue_message() increments it */
+    ue->test_ue->ran_ue_ngap_id = ue->ran_ue_ngap_id - 1;
+}
+
+static void cycle_end(ue_t *ue)
+{
+    ue->procedure = PROCEDURE_NONE;
+    ue->cycle++;
+
+    if (ue->nasbuf) {
+        ogs_pkbuf_free(ue->nasbuf);
+        ue->nasbuf = NULL;
+    }
+
+    if (ue->cycle < config.cycles) {
+        ogs_list_add(&idle_list, ue);
+        num_of_idle++;
+    } else {
+        num_of_finished++;
+    }
+}
+
+static void procedure_done(ue_t *ue)
+{
+    procedure_e next = ue->procedure + 1;
+
+    ogs_assert(ue->procedure != PROCEDURE_NONE);
+
+    loadgen_histogram_add(&stats.latency[ue->procedure],
+            ogs_get_monotonic_time() - ue->started);
+    ogs_timer_stop(ue->timer);
+
+    if (next == MAX_NUM_OF_PROCEDURE) {
+        stats.completed++;
+        cycle_end(ue);
+    } else if (config.think) {
+        ue->procedure = next;
+        ue->thinking = true;
+        ogs_timer_start(ue->timer, config.think);
+    } else {
+        ue_begin(ue, next);
+    }
+}
+
+static void procedure_failed(ue_t *ue)
+{
+    ogs_assert(ue->procedure != PROCEDURE_NONE);
+
+    stats.failed[ue->procedure]++;
+    stats.aborted++;
+    ogs_timer_stop(ue->timer);
+
+    cycle_end(ue);
+}
+
+static void ue_timeout(void *data)
+{
+    ue_t *ue = data;
+
+    ogs_assert(ue);
+
+    if (ue->thinking) {
+        ue->thinking = false;
+        ue_begin(ue, ue->procedure);
+        return;
+    }
+
+    ogs_warn("[%s] %s timed out", ue->test_ue->imsi,
+            procedure_name[ue->procedure]);
+    stats.timeout[ue->procedure]++;
+    procedure_failed(ue);
+}
+
+static void ue_begin(ue_t *ue, procedure_e procedure)
+{
+    test_ue_t *test_ue = ue->test_ue;
+    test_sess_t *sess = ue->sess;
+    ogs_pkbuf_t *gmmbuf = NULL, *gsmbuf = NULL, *nasbuf = NULL;
+
+    ue->procedure = procedure;
+    ue->started = ogs_get_monotonic_time();
+    ogs_timer_start(ue->timer, config.timeout);
+
+    switch (procedure) {
+    case PROCEDURE_REGISTRATION:
+        TEST_CLEAR_SECURITY_CONTEXT(test_ue);
+        test_ue->nas.registration.tsc = 0;
+        test_ue->nas.registration.ksi = OGS_NAS_KSI_NO_KEY_IS_AVAILABLE;
+        test_ue->nas.registration.follow_on_request = 1;
+        test_ue->nas.registration.value = OGS_NAS_5GS_REGISTRATION_TYPE_INITIAL;
+
+        memset(&test_ue->registration_request_param, 0,
+                sizeof(test_ue->registration_request_param));
+        gmmbuf = testgmm_build_registration_request(
+                test_ue, NULL, false, false);
+        ogs_assert(gmmbuf);
+
+        /* Sent again in the Security Mode Complete */
+        test_ue->registration_request_param.gmm_capability = 1;
+        test_ue->registration_request_param.s1_ue_network_capability = 1;
+        test_ue->registration_request_param.requested_nssai = 1;
+        test_ue->registration_request_param.last_visited_registered_tai = 1;
+        test_ue->registration_request_param.ue_usage_setting = 1;
+        ogs_assert(!ue->nasbuf);
+        ue->nasbuf = testgmm_build_registration_request(
+                test_ue, NULL, false, false);
+        ogs_assert(ue->nasbuf);
+
+        ue_new_ran_ue_ngap_id(ue);
+        gnb_send(ue->gnb, testngap_build_initial_ue_message(test_ue, gmmbuf,
+                    NGAP_RRCEstablishmentCause_mo_Signalling, false, true));
+        break;
+
+    case PROCEDURE_PDU_SESSION:
+        gsmbuf = testgsm_build_pdu_session_establishment_request(sess);
+        ogs_assert(gsmbuf);
+        ue_send_nas(ue, testgmm_build_ul_nas_transport(sess,
+                    OGS_NAS_PAYLOAD_CONTAINER_N1_SM_INFORMATION, gsmbuf));
+        break;
+
+    case PROCEDURE_AN_RELEASE:
+        gnb_send(ue->gnb, testngap_build_ue_context_release_request(test_ue,
+                    NGAP_Cause_PR_radioNetwork,
+                    NGAP_CauseRadioNetwork_user_inactivity, true));
+        break;
+
+    case PROCEDURE_SERVICE_REQUEST:
+        test_ue->service_request_param.pdu_session_status = 1;
+        test_ue->service_request_param.psimask.pdu_session_status =
+            1 << sess->psi;
+        nasbuf = testgmm_build_service_request(
+                test_ue, OGS_NAS_SERVICE_TYPE_SIGNALLING, NULL, false, false);
+        ogs_assert(nasbuf);
+
+        test_ue->service_request_param.pdu_session_status = 0;
+        gmmbuf = testgmm_build_service_request(
+                test_ue, OGS_NAS_SERVICE_TYPE_SIGNALLING, nasbuf, true, false);
+        ogs_assert(gmmbuf);
+
+        ue_new_ran_ue_ngap_id(ue);
+        gnb_send(ue->gnb, testngap_build_initial_ue_message(test_ue, gmmbuf,
+                    NGAP_RRCEstablishmentCause_mo_Signalling, true, true));
+        break;
+
+    case PROCEDURE_DEREGISTRATION:
+        ue_send_nas(ue,
+                testgmm_build_de_registration_request(test_ue, 1, true, true));
+        break;
+
+    default:
+        ogs_assert_if_reached();
+    }
+}
+
+static void ue_handle(ue_t *ue)
+{
+    test_ue_t *test_ue = ue->test_ue;
+
+    if (test_ue->ngap_procedure_code ==
+            NGAP_ProcedureCode_id_UEContextRelease) {
+        gnb_send(ue->gnb,
+                testngap_build_ue_context_release_complete(test_ue));
+
+        if (ue->procedure == PROCEDURE_NONE || ue->thinking)
+            return;
+
+        if (ue->procedure == PROCEDURE_AN_RELEASE ||
+            ue->procedure == PROCEDURE_DEREGISTRATION)
+            procedure_done(ue);
+        else
+            procedure_failed(ue);
+        return;
+    }
+
+    if (ue->thinking)
+        return;
+
+    switch (ue->procedure) {
+    case PROCEDURE_REGISTRATION:
+        switch (test_ue->gmm_message_type) {
+        case OGS_NAS_5GS_AUTHENTICATION_REQUEST:
+            ue_send_nas(ue, testgmm_build_authentication_response(test_ue));
+            break;
+        case OGS_NAS_5GS_SECURITY_MODE_COMMAND:
+            ue_send_nas(ue,
+                    testgmm_build_security_mode_complete(test_ue, ue->nasbuf));
+            ue->nasbuf = NULL;
+            break;
+        case OGS_NAS_5GS_REGISTRATION_ACCEPT:
+            if (test_ue->ngap_procedure_code ==
+                    NGAP_ProcedureCode_id_InitialContextSetup)
+                gnb_send(ue->gnb,
+                        testngap_build_initial_context_setup_response(
+                            test_ue, false));
+            ue_send_nas(ue, testgmm_build_registration_complete(test_ue));
+            procedure_done(ue);
+            break;
+        case OGS_NAS_5GS_AUTHENTICATION_REJECT:
+        case OGS_NAS_5GS_REGISTRATION_REJECT:
+            procedure_failed(ue);
+            break;
+        default:
+            break;
+        }
+        break;
+
+    case PROCEDURE_PDU_SESSION:
+        if (test_ue->ngap_procedure_code ==
+                NGAP_ProcedureCode_id_PDUSessionResourceSetup) {
+            gnb_send(ue->gnb,
+                    testngap_sess_build_pdu_session_resource_setup_response(
+                        ue->sess));
+            procedure_done(ue);
+        } else if (test_ue->gsm_message_type ==
+                OGS_NAS_5GS_PDU_SESSION_ESTABLISHMENT_REJECT) {
+            procedure_failed(ue);
+        }
+        break;
+
+    case PROCEDURE_SERVICE_REQUEST:
+        if (test_ue->gmm_message_type == OGS_NAS_5GS_SERVICE_ACCEPT) {
+            if (test_ue->ngap_procedure_code ==
+                    NGAP_ProcedureCode_id_InitialContextSetup)
+                gnb_send(ue->gnb,
+                        testngap_build_initial_context_setup_response(
+                            test_ue, true));
+            procedure_done(ue);
+        } else if (test_ue->gmm_message_type == OGS_NAS_5GS_SERVICE_REJECT) {
+            procedure_failed(ue);
+        }
+        break;
+
+    default:
+        /* e.g. Configuration Update Command */
+        break;
+    }
+}
+
+#define FIND_RAN_UE_NGAP_ID(__iE_tYPE, __mESSAGE, __iD, __fOUND) \
+    do { \
+        int __i; \
+        for (__i = 0; __i < (__mESSAGE)->protocolIEs.list.count; __i++) { \
+            __iE_tYPE *__iE = (__mESSAGE)->protocolIEs.list.array[__i]; \
+            if (__iE->id == NGAP_ProtocolIE_ID_id_RAN_UE_NGAP_ID) { \
+                (__iD) = __iE->value.choice.RAN_UE_NGAP_ID; \
+                (__fOUND) = true; \
+            } \
+        } \
+    } while (0)
+
+static ue_t *gnb_find_ue(gnb_t *gnb, ogs_ngap_message_t *message)
+{
+    NGAP_InitiatingMessage_t *initiatingMessage = NULL;
+    NGAP_UEContextReleaseCommand_t *UEContextReleaseCommand = NULL;
+    NGAP_UE_NGAP_IDs_t *UE_NGAP_IDs = NULL;
+    uint32_t ran_ue_ngap_id = 0;
+    uint64_t amf_ue_ngap_id = 0;
+    bool found = false;
+    ue_t *ue = NULL;
+    int i;
+
+    if (message->present != NGAP_NGAP_PDU_PR_initiatingMessage)
+        return NULL;
+
+    initiatingMessage = message->choice.initiatingMessage;
+    ogs_assert(initiatingMessage);
+
+    switch (initiatingMessage->procedureCode) {
+    case NGAP_ProcedureCode_id_DownlinkNASTransport:
+        FIND_RAN_UE_NGAP_ID(NGAP_DownlinkNASTransport_IEs_t,
+                &initiatingMessage->value.choice.DownlinkNASTransport,
+                ran_ue_ngap_id, found);
+        break;
+    case NGAP_ProcedureCode_id_InitialContextSetup:
+        FIND_RAN_UE_NGAP_ID(NGAP_InitialContextSetupRequestIEs_t,
+                &initiatingMessage->value.choice.InitialContextSetupRequest,
+                ran_ue_ngap_id, found);
+        break;
+    case NGAP_ProcedureCode_id_PDUSessionResourceSetup:
+        FIND_RAN_UE_NGAP_ID(NGAP_PDUSessionResourceSetupRequestIEs_t,
+                &initiatingMessage->value.choice.
+                    PDUSessionResourceSetupRequest,
+                ran_ue_ngap_id, found);
+        break;
+    case NGAP_ProcedureCode_id_PDUSessionResourceRelease:
+        FIND_RAN_UE_NGAP_ID(NGAP_PDUSessionResourceReleaseCommandIEs_t,
+                &initiatingMessage->value.choice.
+                    PDUSessionResourceReleaseCommand,
+                ran_ue_ngap_id, found);
+        break;
+    case NGAP_ProcedureCode_id_UEContextRelease:
+        UEContextReleaseCommand =
+            &initiatingMessage->value.choice.UEContextReleaseCommand;
+        for (i = 0; i < UEContextReleaseCommand->protocolIEs.list.count; i++) {
+            NGAP_UEContextReleaseCommand_IEs_t *ie =
+                UEContextReleaseCommand->protocolIEs.list.array[i];
+            if (ie->id == NGAP_ProtocolIE_ID_id_UE_NGAP_IDs)
+                UE_NGAP_IDs = &ie->value.choice.UE_NGAP_IDs;
+        }
+        if (!UE_NGAP_IDs)
+            break;
+
+        if (UE_NGAP_IDs->present == NGAP_UE_NGAP_IDs_PR_uE_NGAP_ID_pair) {
+            ran_ue_ngap_id =
+                UE_NGAP_IDs->choice.uE_NGAP_ID_pair->rAN_UE_NGAP_ID;
+            found = true;
+        } else if (UE_NGAP_IDs->present ==
+                NGAP_UE_NGAP_IDs_PR_aMF_UE_NGAP_ID) {
+            asn_INTEGER2ulong(&UE_NGAP_IDs->choice.aMF_UE_NGAP_ID,
+                    (unsigned long *)&amf_ue_ngap_id);
+            for (i = 0; i < gnb->num_of_ue; i++) {
+                if (gnb->ue[i]->test_ue->amf_ue_ngap_id == amf_ue_ngap_id)
+                    return gnb->ue[i];
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (!found)
+        return NULL;
+
+    ue = gnb->ue[ran_ue_ngap_id % gnb->num_of_ue];
+    if (ue->ran_ue_ngap_id != ran_ue_ngap_id)
+        return NULL;
+
+    return ue;
+}
+
+static void gnb_handle(gnb_t *gnb, ogs_ngap_message_t *message)
+{
+    ue_t *ue = NULL;
+
+    if (message->present == NGAP_NGAP_PDU_PR_successfulOutcome &&
+        message->choice.successfulOutcome->procedureCode ==
+            NGAP_ProcedureCode_id_NGSetup) {
+        gnb->ready = true;
+        return;
+    }
+    if (message->present == NGAP_NGAP_PDU_PR_unsuccessfulOutcome &&
+        message->choice.unsuccessfulOutcome->procedureCode ==
+            NGAP_ProcedureCode_id_NGSetup) {
+        ogs_fatal("gNB[0x%x] NG Setup failed", gnb->gnb_id);
+        stopped = true;
+        return;
+    }
+
+    ue = gnb_find_ue(gnb, message);
+    if (!ue) {
+        stats.unexpected++;
+        return;
+    }
+
+    ue->test_ue->gmm_message_type = 0;
+    ue->test_ue->gsm_message_type = 0;
+    testngap_dispatch(ue->test_ue, message);
+
+    ue_handle(ue);
+}
+
+static void gnb_recv(short when, ogs_socket_t fd, void *data)
+{
+    gnb_t *gnb = data;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_ngap_message_t message;
+    int size, flags = 0;
+
+    ogs_assert(gnb);
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, OGS_MAX_SDU_LEN);
+
+    size = ogs_sctp_recvmsg(gnb->node->sock,
+            pkbuf->data, pkbuf->len, NULL, NULL, &flags);
+    if (size <= 0) {
+        ogs_fatal("gNB[0x%x] connection lost", gnb->gnb_id);
+        ogs_pkbuf_free(pkbuf);
+        stopped = true;
+        return;
+    }
+    if (flags & MSG_NOTIFICATION) {
+        ogs_pkbuf_free(pkbuf);
+        return;
+    }
+    ogs_pkbuf_trim(pkbuf, size);
+
+    if (ogs_ngap_decode(&message, pkbuf) != OGS_OK) {
+        stats.unexpected++;
+        ogs_pkbuf_free(pkbuf);
+        return;
+    }
+
+    gnb_handle(gnb, &message);
+
+    ogs_ngap_free(&message);
+    ogs_pkbuf_free(pkbuf);
+}
+
+static void print_progress(void)
+{
+    int running = config.num_of_ue - num_of_idle - num_of_finished;
+
+    printf("[%4ds] started %llu completed %llu aborted %llu running %d\n",
+            last_report,
+            (unsigned long long)stats.started,
+            (unsigned long long)stats.completed,
+            (unsigned long long)stats.aborted, running);
+    fflush(stdout);
+}
+
+/* Starts the cycles that are due at the configured rate */
+static void tick(void *data)
+{
+    ogs_time_t elapsed = ogs_get_monotonic_time() - start_time;
+    uint64_t due;
+    ue_t *ue = NULL;
+
+    if (config.rate > 0)
+        due = (uint64_t)(config.rate * elapsed / OGS_USEC_PER_SEC) + 1;
+    else
+        due = UINT64_MAX;
+
+    while (stats.started < due && (ue = ogs_list_first(&idle_list))) {
+        ogs_list_remove(&idle_list, ue);
+        num_of_idle--;
+
+        stats.started++;
+        ue_begin(ue, PROCEDURE_REGISTRATION);
+    }
+
+    if (ogs_time_sec(elapsed) > last_report) {
+        last_report = ogs_time_sec(elapsed);
+        print_progress();
+    }
+
+    if (num_of_finished == config.num_of_ue)
+        stopped = true;
+    else
+        ogs_timer_start(t_tick, TICK_INTERVAL);
+}
+
+static void print_report(void)
+{
+    ogs_time_t elapsed = ogs_get_monotonic_time() - start_time;
+    double seconds = (double)elapsed / OGS_USEC_PER_SEC;
+    int i;
+
+    printf("\n%d gNBs, %d UEs, %d cycles in %.1f seconds\n\n",
+            config.num_of_gnb, config.num_of_ue, config.cycles, seconds);
+    printf("%-16s %8s %8s %8s %9s %9s %9s %9s %9s\n",
+            "procedure", "ok", "failed", "timeout",
+            "per-sec", "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)");
+
+    for (i = 0; i < MAX_NUM_OF_PROCEDURE; i++) {
+        loadgen_histogram_t *latency = &stats.latency[i];
+
+        printf("%-16s %8llu %8llu %8llu %9.1f %9.2f %9.2f %9.2f %9.2f\n",
+            procedure_name[i],
+            (unsigned long long)latency->count,
+            (unsigned long long)stats.failed[i],
+            (unsigned long long)stats.timeout[i],
+            latency->count / seconds,
+            loadgen_histogram_percentile(latency, 50) / 1000.0,
+            loadgen_histogram_percentile(latency, 90) / 1000.0,
+            loadgen_histogram_percentile(latency, 99) / 1000.0,
+            latency->max / 1000.0);
+    }
+
+    printf("\ncycles: %llu started, %llu completed, %llu aborted\n",
+            (unsigned long long)stats.started,
+            (unsigned long long)stats.completed,
+            (unsigned long long)stats.aborted);
+    if (stats.unexpected)
+        printf("unexpected messages: %llu\n",
+                (unsigned long long)stats.unexpected);
+}
+
+static void setup_ue(ue_t *ue, int index)
+{
+    ogs_nas_5gs_mobile_identity_suci_t mobile_identity_suci;
+    char msin[11];
+    int i;
+
+    memset(&mobile_identity_suci, 0, sizeof(mobile_identity_suci));
+
+    mobile_identity_suci.h.supi_format = OGS_NAS_5GS_SUPI_FORMAT_IMSI;
+    mobile_identity_suci.h.type = OGS_NAS_5GS_MOBILE_IDENTITY_SUCI;
+    mobile_identity_suci.routing_indicator1 = 0;
+    mobile_identity_suci.routing_indicator2 = 0xf;
+    mobile_identity_suci.routing_indicator3 = 0xf;
+    mobile_identity_suci.routing_indicator4 = 0xf;
+    mobile_identity_suci.protection_scheme_id = OGS_NAS_5GS_NULL_SCHEME;
+    mobile_identity_suci.home_network_pki_value = 0;
+
+    /* 10-digit MSIN in BCD */
+    ogs_snprintf(msin, sizeof(msin), "%010llu",
+            (unsigned long long)(config.msin + index));
+    for (i = 0; i < 5; i++)
+        mobile_identity_suci.scheme_output[i] =
+            ((msin[i*2+1] - '0') << 4) | (msin[i*2] - '0');
+
+    ue->test_ue = test_ue_add_by_suci(&mobile_identity_suci, 13);
+    ogs_assert(ue->test_ue);
+
+    ue->test_ue->k_string = config.k;
+    ue->test_ue->opc_string = config.opc;
+    OGS_HEX(config.k, strlen(config.k), ue->test_ue->k);
+    OGS_HEX(config.opc, strlen(config.opc), ue->test_ue->opc);
+
+    ue->sess = test_sess_add_by_dnn_and_psi(ue->test_ue, "internet", 5);
+    ogs_assert(ue->sess);
+
+    ue->sess->ul_nas_transport_param.request_type =
+        OGS_NAS_5GS_REQUEST_TYPE_INITIAL;
+    ue->sess->ul_nas_transport_param.dnn = 1;
+    ue->sess->ul_nas_transport_param.s_nssai = 1;
+    ue->sess->pdu_session_establishment_param.ssc_mode = 1;
+    ue->sess->pdu_session_establishment_param.epco = 1;
+
+    ue->procedure = PROCEDURE_NONE;
+    ue->timer = ogs_timer_add(ogs_app()->timer_mgr, ue_timeout, ue);
+    ogs_assert(ue->timer);
+}
+
+static int setup(void)
+{
+    ogs_time_t deadline;
+    int i, num_of_ready;
+
+    gnb_array = ogs_calloc(config.num_of_gnb, sizeof(gnb_t));
+    ogs_assert(gnb_array);
+    ue_array = ogs_calloc(config.num_of_ue, sizeof(ue_t));
+    ogs_assert(ue_array);
+
+    for (i = 0; i < config.num_of_gnb; i++) {
+        gnb_t *gnb = &gnb_array[i];
+
+        gnb->gnb_id = GNB_ID_BASE + i;
+        gnb->ue = ogs_calloc(
+                config.num_of_ue / config.num_of_gnb + 1, sizeof(ue_t *));
+        ogs_assert(gnb->ue);
+    }
+
+    for (i = 0; i < config.num_of_ue; i++) {
+        ue_t *ue = &ue_array[i];
+        gnb_t *gnb = &gnb_array[i % config.num_of_gnb];
+
+        setup_ue(ue, i);
+        ue->test_ue->nr_cgi.cell_id = ((uint64_t)gnb->gnb_id << 4) | 1;
+
+        ue->gnb = gnb;
+        ue->slot = gnb->num_of_ue;
+        gnb->ue[gnb->num_of_ue++] = ue;
+
+        if (config.provision &&
+            test_db_insert_ue(ue->test_ue,
+                test_db_new_simple(ue->test_ue)) != OGS_OK) {
+            ogs_fatal("Cannot provision %s", ue->test_ue->imsi);
+            return OGS_ERROR;
+        }
+
+        ogs_list_add(&idle_list, ue);
+        num_of_idle++;
+    }
+
+    for (i = 0; i < config.num_of_gnb; i++) {
+        gnb_t *gnb = &gnb_array[i];
+
+        gnb->node = testngap_client(AF_INET);
+        if (!gnb->node) {
+            ogs_fatal("gNB[0x%x] cannot connect to the AMF", gnb->gnb_id);
+            return OGS_ERROR;
+        }
+        gnb->poll = ogs_pollset_add(ogs_app()->pollset,
+                OGS_POLLIN, gnb->node->sock->fd, gnb_recv, gnb);
+        ogs_assert(gnb->poll);
+
+        gnb_send(gnb, testngap_build_ng_setup_request(gnb->gnb_id, 32));
+    }
+
+    deadline = ogs_get_monotonic_time() + config.timeout;
+    do {
+        ogs_pollset_poll(ogs_app()->pollset, ogs_time_from_msec(100));
+
+        num_of_ready = 0;
+        for (i = 0; i < config.num_of_gnb; i++)
+            if (gnb_array[i].ready) num_of_ready++;
+    } while (num_of_ready < config.num_of_gnb && !stopped &&
+            ogs_get_monotonic_time() < deadline);
+
+    if (num_of_ready < config.num_of_gnb) {
+        ogs_fatal("Only %d of %d gNBs are set up",
+                num_of_ready, config.num_of_gnb);
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+static void cleanup(void)
+{
+    int i;
+
+    for (i = 0; i < config.num_of_ue && ue_array; i++) {
+        ue_t *ue = &ue_array[i];
+
+        if (!ue->test_ue)
+            continue;
+        if (config.provision)
+            test_db_remove_ue(ue->test_ue);
+        if (ue->nasbuf)
+            ogs_pkbuf_free(ue->nasbuf);
+        ogs_timer_delete(ue->timer);
+    }
+    test_ue_remove_all();
+
+    for (i = 0; i < config.num_of_gnb && gnb_array; i++) {
+        gnb_t *gnb = &gnb_array[i];
+
+        if (gnb->poll)
+            ogs_pollset_remove(gnb->poll);
+        if (gnb->node)
+            testgnb_ngap_close(gnb->node);
+        ogs_free(gnb->ue);
+    }
+
+    if (ue_array)
+        ogs_free(ue_array);
+    if (gnb_array)
+        ogs_free(gnb_array);
+}
+
+static void stop(int signum)
+{
+    stopped = true;
+}
+
+static void show_help(const char *name)
+{
+    printf("Usage: %s [options]\n"
+        "Options:\n"
+       "   -c filename    : set configuration file\n"
+       "   -l filename    : set logging file\n"
+       "   -e level       : set global log-level (default:info)\n"
+       "   -m domain      : set log-domain (e.g. mme:sgw:gtp)\n"
+       "   -g num         : number of gNBs (default:1)\n"
+       "   -u num         : number of UEs (default:1)\n"
+       "   -n num         : cycles per UE (default:1)\n"
+       "   -r rate        : cycles started per second, 0 for all at once"
+                            " (default:100)\n"
+       "   -w msec        : delay between procedures (default:0)\n"
+       "   -t msec        : procedure timeout (default:5000)\n"
+       "   -i msin        : MSIN of the first UE (default:0000000001)\n"
+       "   -k key         : subscriber K\n"
+       "   -o opc         : subscriber OPc\n"
+       "   -p             : subscribers are already provisioned\n"
+       "   -h             : show this message and exit\n"
+       "\n", name);
+}
+
+int main(int argc, const char *const argv[])
+{
+    int rv, opt, argc_out = 0;
+    ogs_getopt_t options;
+    const char *argv_out[argc*2+1];
+    bool user_config = false;
+
+    config.num_of_gnb = 1;
+    config.num_of_ue = 1;
+    config.cycles = 1;
+    config.rate = 100;
+    config.timeout = ogs_time_from_msec(5000);
+    config.msin = 1;
+    config.k = "465b5ce8b199b49faa5f0a2ee238a6bc";
+    config.opc = "e8ed289deba952e4283b54e88e6183ca";
+    config.provision = true;
+
+    argv_out[argc_out++] = argv[0];
+
+    ogs_getopt_init(&options, (char**)argv);
+    while ((opt = ogs_getopt(&options, "c:l:e:m:g:u:n:r:w:t:i:k:o:ph")) != -1) {
+        switch (opt) {
+        case 'c':
+            user_config = true;
+            argv_out[argc_out++] = "-c";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'l':
+            argv_out[argc_out++] = "-l";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'e':
+            argv_out[argc_out++] = "-e";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'm':
+            argv_out[argc_out++] = "-m";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'g':
+            config.num_of_gnb = atoi(options.optarg);
+            break;
+        case 'u':
+            config.num_of_ue = atoi(options.optarg);
+            break;
+        case 'n':
+            config.cycles = atoi(options.optarg);
+            break;
+        case 'r':
+            config.rate = atof(options.optarg);
+            break;
+        case 'w':
+            config.think = ogs_time_from_msec(atoll(options.optarg));
+            break;
+        case 't':
+            config.timeout = ogs_time_from_msec(atoll(options.optarg));
+            break;
+        case 'i':
+            config.msin = strtoull(options.optarg, NULL, 10);
+            break;
+        case 'k':
+            config.k = options.optarg;
+            break;
+        case 'o':
+            config.opc = options.optarg;
+            break;
+        case 'p':
+            config.provision = false;
+            break;
+        case 'h':
+            show_help(argv[0]);
+            return OGS_OK;
+        case '?':
+        default:
+            fprintf(stderr, "%s: %s\n", argv[0], options.errmsg);
+            show_help(argv[0]);
+            return OGS_ERROR;
+        }
+    }
+    argv_out[argc_out] = NULL;
+
+    if (config.num_of_gnb < 1 || config.num_of_ue < config.num_of_gnb ||
+        config.cycles < 1 || config.timeout <= 0) {
+        fprintf(stderr, "%s: need at least one UE per gNB\n", argv[0]);
+        return OGS_ERROR;
+    }
+
+    rv = ogs_app_initialize(NULL,
+            user_config ? NULL : DEFAULT_CONFIG_FILENAME, argv_out);
+    if (rv != OGS_OK) {
+        fprintf(stderr, "%s: cannot initialize\n", argv[0]);
+        return rv;
+    }
+
+    if (config.num_of_ue > ogs_app()->max.ue) {
+        ogs_fatal("%d UEs exceed max.ue(%llu) in '%s'", config.num_of_ue,
+                (unsigned long long)ogs_app()->max.ue, ogs_app()->file);
+        ogs_app_terminate();
+        return OGS_ERROR;
+    }
+
+    ogs_log_install_domain(&__ogs_sctp_domain, "sctp", OGS_LOG_ERROR);
+    ogs_log_install_domain(&__ogs_ngap_domain, "ngap", OGS_LOG_ERROR);
+    ogs_log_install_domain(&__ogs_dbi_domain, "dbi", OGS_LOG_ERROR);
+    ogs_log_install_domain(&__ogs_nas_domain, "nas", OGS_LOG_ERROR);
+
+    ogs_sctp_init(ogs_app()->usrsctp.udp_port);
+    if (config.provision)
+        ogs_assert(ogs_dbi_init(ogs_app()->db_uri) == OGS_OK);
+
+    test_context_init();
+    rv = test_context_parse_config();
+    ogs_assert(rv == OGS_OK);
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    rv = setup();
+    if (rv == OGS_OK) {
+        int i;
+
+        for (i = 0; i < MAX_NUM_OF_PROCEDURE; i++)
+            loadgen_histogram_init(&stats.latency[i]);
+
+        t_tick = ogs_timer_add(ogs_app()->timer_mgr, tick, NULL);
+        ogs_assert(t_tick);
+
+        start_time = ogs_get_monotonic_time();
+        tick(NULL);
+
+        while (!stopped) {
+            ogs_pollset_poll(ogs_app()->pollset,
+                    ogs_timer_mgr_next(ogs_app()->timer_mgr));
+            ogs_timer_mgr_expire(ogs_app()->timer_mgr);
+        }
+
+        print_report();
+        ogs_timer_delete(t_tick);
+    }
+
+    cleanup();
+
+    test_context_final();
+    if (config.provision)
+        ogs_dbi_final();
+    ogs_sctp_final();
+
+    ogs_app_terminate();
+
+    return rv;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "histogram.h"
+
+#define SUB_BUCKETS     (1 << LOADGEN_HISTOGRAM_SUB_BITS)
+
+static int bucket_index(uint64_t value)
+{
+    int exponent;
+
+    if (value < SUB_BUCKETS)
+        return value;
+
+    exponent = 63 - __builtin_clzll(value);
+    return ((exponent - LOADGEN_HISTOGRAM_SUB_BITS + 1) <<
+                LOADGEN_HISTOGRAM_SUB_BITS) +
+        ((value >> (exponent - LOADGEN_HISTOGRAM_SUB_BITS)) &
+                (SUB_BUCKETS - 1));
+}
+
+/* Middle of the values that fall into the bucket */
+static uint64_t bucket_value(int index)
+{
+    int shift;
+
+    if (index < SUB_BUCKETS)
+        return index;
+
+    shift = (index >> LOADGEN_HISTOGRAM_SUB_BITS) - 1;
+    return ((uint64_t)(SUB_BUCKETS + (index & (SUB_BUCKETS - 1))) << shift) +
+        (((uint64_t)1 << shift) >> 1);
+}
+
+void loadgen_histogram_init(loadgen_histogram_t *histogram)
+{
+    ogs_assert(histogram);
+
+    memset(histogram, 0, sizeof(*histogram));
+    histogram->min = UINT64_MAX;
+}
+
+void loadgen_histogram_add(loadgen_histogram_t *histogram, uint64_t value)
+{
+    ogs_assert(histogram);
+
+    histogram->bucket[bucket_index(value)]++;
+    histogram->count++;
+    histogram->sum += value;
+    if (value < histogram->min)
+        histogram->min = value;
+    if (value > histogram->max)
+        histogram->max = value;
+}
+
+void loadgen_histogram_merge(
+        loadgen_histogram_t *histogram, loadgen_histogram_t *from)
+{
+    int i;
+
+    ogs_assert(histogram);
+    ogs_assert(from);
+
+    for (i = 0; i < LOADGEN_HISTOGRAM_SIZE; i++)
+        histogram->bucket[i] += from->bucket[i];
+    histogram->count += from->count;
+    histogram->sum += from->sum;
+    if (from->min < histogram->min)
+        histogram->min = from->min;
+    if (from->max > histogram->max)
+        histogram->max = from->max;
+}
+
+uint64_t loadgen_histogram_percentile(
+        loadgen_histogram_t *histogram, double percentile)
+{
+    uint64_t rank, seen = 0, value;
+    int i;
+
+    ogs_assert(histogram);
+
+    if (histogram->count == 0)
+        return 0;
+
+    rank = (uint64_t)(percentile * histogram->count / 100 + 0.5);
+    if (rank == 0)
+        rank = 1;
+    if (rank >= histogram->count)
+        return histogram->max;
+
+    for (i = 0; i < LOADGEN_HISTOGRAM_SIZE; i++) {
+        seen += histogram->bucket[i];
+        if (seen >= rank)
+            break;
+    }
+
+    value = bucket_value(i);
+    if (value < histogram->min)
+        value = histogram->min;
+    if (value > histogram->max)
+        value = histogram->max;
+
+    return value;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADGEN_HISTOGRAM_H
+#define LOADGEN_HISTOGRAM_H
+
+#include "ogs-core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Log-linear histogram of latencies.
+ *
+ * Each power of two is split into 32 buckets, so a percentile is
+ * reported within about 3% of the exact value whatever the range,
+ * and the histogram has a fixed size.
+ */
+#define LOADGEN_HISTOGRAM_SUB_BITS  5
+#define LOADGEN_HISTOGRAM_SIZE \
+    ((64 - LOADGEN_HISTOGRAM_SUB_BITS + 1) << LOADGEN_HISTOGRAM_SUB_BITS)
+
+typedef struct loadgen_histogram_s {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    uint64_t bucket[LOADGEN_HISTOGRAM_SIZE];
+} loadgen_histogram_t;
+
+void loadgen_histogram_init(loadgen_histogram_t *histogram);
+void loadgen_histogram_add(loadgen_histogram_t *histogram, uint64_t value);
+void loadgen_histogram_merge(
+        loadgen_histogram_t *histogram, loadgen_histogram_t *from);
+
+/* Value at the given percentile (0-100). Returns 0 if empty */
+uint64_t loadgen_histogram_percentile(
+        loadgen_histogram_t *histogram, double percentile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADGEN_HISTOGRAM_H */
@@ -0,0 +1,1132 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * User-plane load generator
+ *
+ * Stands in for the SMF and the gNB in front of a running UPF, on the
+ * same host. The sessions are set up over N4 with the PDRs, FARs and
+ * QER the SMF would create for a default QoS flow, then for the given
+ * duration
+ *
+ *   Uplink   : G-PDUs are sent to the UPF N3 address from the gNB
+ *              address and come out of the TUN device to a local
+ *              UDP socket bound to the gateway address.
+ *   Downlink : UDP datagrams are sent to the UE addresses, which the
+ *              kernel routes into the TUN device, and come back from
+ *              the UPF as G-PDUs on the gNB address.
+ *
+ * Every packet carries a sequence number and its send time, so loss
+ * and one-way latency are measured per direction. The traffic of a
+ * session is spread over several flows (UE ports), and extra PDRs with
+ * SDF filters that never match can be added in front of the default
+ * ones, which every packet then has to be checked against.
+ *
+ * The PFCP address is the 'smf' one of the configuration file and the
+ * UPF is the 'upf' one, so the SMF must not be running. Sending and
+ * receiving are done in one busy loop; run the generator on a CPU of
+ * its own (e.g. with taskset) so that the UPF is the bottleneck.
+ */
+
+#include <poll.h>
+#include <signal.h>
+
+#include "test-config-private.h"
+#include "test-common.h"
+#include "ogs-pfcp.h"
+
+#include "histogram.h"
+
+#if HAVE_NETINET_IP_H
+#include <netinet/ip.h>
+#endif
+
+#if HAVE_NETINET_UDP_H
+#include <netinet/udp.h>
+#endif
+
+#define DEFAULT_CONFIG_FILENAME \
+    MESON_BUILD_ROOT OGS_DIR_SEPARATOR_S "configs" OGS_DIR_SEPARATOR_S \
+    "sample.yaml"
+
+#define PAYLOAD_MAGIC               0x75706c64  /* "upld" */
+#define DN_PORT                     9000
+#define UE_PORT_BASE                10000
+#define DL_TEID_BASE                0x10000
+#define QFI                         1
+
+#define MAX_NUM_OF_SDF \
+    ((OGS_MAX_NUM_OF_PDR - 2) / 2)
+
+#define SEND_BATCH                  32
+#define RECV_BATCH                  256
+#define PFCP_WINDOW                 128
+#define PFCP_RETRANSMIT             ogs_time_from_sec(1)
+#define PFCP_MAX_XID                0x800000
+#define LINGER                      ogs_time_from_msec(500)
+
+typedef enum {
+    DIRECTION_UPLINK = 0,
+    DIRECTION_DOWNLINK,
+    MAX_NUM_OF_DIRECTION,
+} direction_e;
+
+static const char *direction_name[MAX_NUM_OF_DIRECTION] = {
+    "uplink",
+    "downlink",
+};
+
+typedef struct payload_s {
+    uint32_t magic;
+    uint32_t session;
+    uint64_t sequence;
+    ogs_time_t sent;
+} payload_t;
+
+#define MIN_PACKET_SIZE \
+    (sizeof(struct ip) + sizeof(struct udphdr) + sizeof(payload_t))
+
+typedef struct session_s {
+    uint32_t index;
+    uint32_t ue_addr;           /* Network byte order */
+
+    uint64_t smf_n4_seid;
+    uint64_t upf_n4_seid;
+    uint32_t upf_n3_teid;
+    ogs_sockaddr_t upf_n3_addr;
+
+    uint8_t hdr[OGS_GTPV1U_5GC_HEADER_LEN];
+    uint8_t hlen;
+
+    uint32_t xid;               /* Of the request waiting for an answer */
+    ogs_time_t requested;
+    bool pending;
+
+    bool established;
+    bool failed;
+} session_t;
+
+static struct {
+    int num_of_sess;
+    int size;
+    int num_of_flow;
+    int num_of_sdf;
+    double rate;
+    ogs_time_t duration;
+    ogs_time_t timeout;
+    const char *ue_addr;
+    const char *gw_addr;
+    const char *dnn;
+    bool direction[MAX_NUM_OF_DIRECTION];
+} config;
+
+static struct {
+    uint64_t sent;
+    uint64_t received;
+    uint64_t invalid;
+    loadgen_histogram_t latency;
+} stats[MAX_NUM_OF_DIRECTION];
+
+static session_t *session_array;
+static int num_of_established;
+static int num_of_failed;
+static int num_of_answered;     /* Established or failed */
+static int num_of_deleted;
+static bool associated;
+
+static ogs_pfcp_node_t *upf;
+static uint32_t pfcp_xid;       /* Starts at random so as not to be taken
+                                   for a retransmission of a previous run */
+
+/* The PDRs, FARs and QER of every session, rebuilt per session */
+static ogs_pfcp_sess_t pfcp_template;
+static ogs_pfcp_pdr_t *ul_pdr;
+static ogs_pfcp_far_t *dl_far;
+static char *sdf_filter[MAX_NUM_OF_DIRECTION][MAX_NUM_OF_SDF];
+
+static ogs_socknode_t *gnb_node;
+static ogs_sock_t *dn_sock;
+static ogs_sockaddr_t *dn_addr;
+static ogs_pkbuf_t *recvbuf;
+
+static volatile bool stopped;
+
+static bool wait_readable(ogs_socket_t fd, ogs_time_t timeout)
+{
+    struct pollfd pfd;
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    return poll(&pfd, 1, ogs_time_to_msec(timeout)) > 0;
+}
+
+static uint32_t pfcp_next_xid(void)
+{
+    return OGS_NEXT_ID(pfcp_xid, 1, PFCP_MAX_XID);
+}
+
+static void pfcp_send(ogs_pkbuf_t *pkbuf, uint8_t type, uint64_t seid,
+        uint32_t xid)
+{
+    ogs_pfcp_header_t *h = NULL;
+    int hlen;
+
+    ogs_assert(pkbuf);
+
+    if (type >= OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE)
+        hlen = OGS_PFCP_HEADER_LEN;
+    else
+        hlen = OGS_PFCP_HEADER_LEN - OGS_PFCP_SEID_LEN;
+
+    h = ogs_pkbuf_push(pkbuf, hlen);
+    ogs_assert(h);
+    memset(h, 0, hlen);
+
+    h->version = OGS_PFCP_VERSION;
+    h->type = type;
+    if (type >= OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE) {
+        h->seid_presence = 1;
+        h->seid = htobe64(seid);
+        h->sqn = OGS_PFCP_XID_TO_SQN(xid);
+    } else {
+        h->sqn_only = OGS_PFCP_XID_TO_SQN(xid);
+    }
+    h->length = htobe16(pkbuf->len - 4);
+
+    if (ogs_pfcp_sendto(upf, pkbuf) != OGS_OK)
+        ogs_error("Cannot send PFCP message [type:%d]", type);
+    ogs_pkbuf_free(pkbuf);
+}
+
+static ogs_pkbuf_t *build_session_establishment_request(session_t *session)
+{
+    ogs_pfcp_message_t pfcp_message;
+    ogs_pfcp_session_establishment_request_t *req = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_qer_t *qer = NULL;
+    int i, rv;
+
+    ogs_pfcp_node_id_t node_id;
+    ogs_pfcp_f_seid_t f_seid;
+    int len;
+
+    req = &pfcp_message.pfcp_session_establishment_request;
+    memset(&pfcp_message, 0, sizeof(ogs_pfcp_message_t));
+
+    rv = ogs_pfcp_sockaddr_to_node_id(
+            ogs_pfcp_self()->pfcp_addr, NULL,
+            ogs_app()->parameter.prefer_ipv4, &node_id, &len);
+    ogs_assert(rv == OGS_OK);
+    req->node_id.presence = 1;
+    req->node_id.data = &node_id;
+    req->node_id.len = len;
+
+    rv = ogs_pfcp_sockaddr_to_f_seid(
+            ogs_pfcp_self()->pfcp_addr, NULL, &f_seid, &len);
+    ogs_assert(rv == OGS_OK);
+    f_seid.seid = htobe64(session->smf_n4_seid);
+    req->cp_f_seid.presence = 1;
+    req->cp_f_seid.data = &f_seid;
+    req->cp_f_seid.len = len;
+
+    /* Only the UE address and the gNB TEID differ between sessions */
+    ogs_list_for_each(&pfcp_template.pdr_list, pdr) {
+        if (pdr->ue_ip_addr_len)
+            pdr->ue_ip_addr.addr = session->ue_addr;
+    }
+    dl_far->outer_header_creation.teid = DL_TEID_BASE + session->index;
+
+    ogs_pfcp_pdrbuf_init();
+
+    i = 0;
+    ogs_list_for_each(&pfcp_template.pdr_list, pdr) {
+        ogs_pfcp_build_create_pdr(&req->create_pdr[i], i, pdr);
+        i++;
+    }
+
+    i = 0;
+    ogs_list_for_each(&pfcp_template.far_list, far) {
+        ogs_pfcp_build_create_far(&req->create_far[i], i, far);
+        i++;
+    }
+
+    i = 0;
+    ogs_list_for_each(&pfcp_template.qer_list, qer) {
+        ogs_pfcp_build_create_qer(&req->create_qer[i], i, qer);
+        i++;
+    }
+
+    req->pdn_type.presence = 1;
+    req->pdn_type.u8 = OGS_PDU_SESSION_TYPE_IPV4;
+
+    pfcp_message.h.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+    pkbuf = ogs_pfcp_build_msg(&pfcp_message);
+    ogs_assert(pkbuf);
+
+    ogs_pfcp_pdrbuf_clear();
+
+    return pkbuf;
+}
+
+static void session_establish(session_t *session)
+{
+    pfcp_send(build_session_establishment_request(session),
+            OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE,
+            0, session->xid);
+}
+
+static void session_delete(session_t *session)
+{
+    ogs_pfcp_message_t pfcp_message;
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    memset(&pfcp_message, 0, sizeof(ogs_pfcp_message_t));
+    pfcp_message.h.type = OGS_PFCP_SESSION_DELETION_REQUEST_TYPE;
+    pkbuf = ogs_pfcp_build_msg(&pfcp_message);
+    ogs_assert(pkbuf);
+
+    pfcp_send(pkbuf, OGS_PFCP_SESSION_DELETION_REQUEST_TYPE,
+            session->upf_n4_seid, session->xid);
+}
+
+static session_t *session_find(uint64_t seid)
+{
+    if (seid == 0 || seid > config.num_of_sess)
+        return NULL;
+
+    return &session_array[seid - 1];
+}
+
+static void handle_session_establishment_response(session_t *session,
+        ogs_pfcp_session_establishment_response_t *rsp)
+{
+    ogs_pfcp_f_seid_t *up_f_seid = NULL;
+    ogs_pfcp_f_teid_t *f_teid = NULL;
+    ogs_gtp2_header_t gtp_hdesc;
+    ogs_gtp2_extension_header_t ext_hdesc;
+    ogs_ip_t ip;
+    int i;
+
+    if (!session || session->established || session->failed)
+        return;
+    session->pending = false;
+
+    if (rsp->cause.presence == 0 ||
+        rsp->cause.u8 != OGS_PFCP_CAUSE_REQUEST_ACCEPTED ||
+        rsp->up_f_seid.presence == 0) {
+        ogs_error("Session[%d] is rejected [cause:%d]", session->index,
+                rsp->cause.presence ? rsp->cause.u8 : 0);
+        goto failed;
+    }
+
+    up_f_seid = rsp->up_f_seid.data;
+    ogs_assert(up_f_seid);
+    session->upf_n4_seid = be64toh(up_f_seid->seid);
+
+    for (i = 0; i < OGS_ARRAY_SIZE(rsp->created_pdr); i++) {
+        if (rsp->created_pdr[i].presence == 0)
+            break;
+        if (rsp->created_pdr[i].pdr_id.u16 != ul_pdr->id)
+            continue;
+        if (rsp->created_pdr[i].local_f_teid.presence)
+            f_teid = rsp->created_pdr[i].local_f_teid.data;
+        break;
+    }
+    if (!f_teid || ogs_pfcp_f_teid_to_ip(f_teid, &ip) != OGS_OK ||
+        !ip.ipv4) {
+        ogs_error("Session[%d] has no UPF N3 IPv4 F-TEID", session->index);
+        goto failed;
+    }
+
+    session->upf_n3_teid = be32toh(f_teid->teid);
+    memset(&session->upf_n3_addr, 0, sizeof(session->upf_n3_addr));
+    session->upf_n3_addr.ogs_sa_family = AF_INET;
+    session->upf_n3_addr.ogs_sin_port = htobe16(OGS_GTPV1_U_UDP_PORT);
+    session->upf_n3_addr.sin.sin_addr.s_addr = ip.addr;
+
+    memset(&gtp_hdesc, 0, sizeof(gtp_hdesc));
+    gtp_hdesc.type = OGS_GTPU_MSGTYPE_GPDU;
+    gtp_hdesc.teid = session->upf_n3_teid;
+
+    memset(&ext_hdesc, 0, sizeof(ext_hdesc));
+    ext_hdesc.pdu_type =
+        OGS_GTP2_EXTENSION_HEADER_PDU_TYPE_UL_PDU_SESSION_INFORMATION;
+    ext_hdesc.qos_flow_identifier = QFI;
+
+    session->hlen = ogs_gtp2_build_user_plane_header(
+            session->hdr, &gtp_hdesc, &ext_hdesc);
+
+    session->established = true;
+    num_of_established++;
+    num_of_answered++;
+    return;
+
+failed:
+    session->failed = true;
+    num_of_failed++;
+    num_of_answered++;
+}
+
+static void pfcp_handle(ogs_pfcp_message_t *message)
+{
+    session_t *session = NULL;
+
+    switch (message->h.type) {
+    case OGS_PFCP_HEARTBEAT_REQUEST_TYPE:
+        pfcp_send(ogs_pfcp_build_heartbeat_response(
+                    OGS_PFCP_HEARTBEAT_RESPONSE_TYPE),
+                OGS_PFCP_HEARTBEAT_RESPONSE_TYPE,
+                0, OGS_PFCP_SQN_TO_XID(message->h.sqn));
+        break;
+
+    case OGS_PFCP_ASSOCIATION_SETUP_RESPONSE_TYPE:
+        if (message->pfcp_association_setup_response.cause.presence &&
+            message->pfcp_association_setup_response.cause.u8 ==
+                OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
+            associated = true;
+        else
+            ogs_error("Association is rejected");
+        break;
+
+    case OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE:
+        handle_session_establishment_response(
+                session_find(message->h.seid),
+                &message->pfcp_session_establishment_response);
+        break;
+
+    case OGS_PFCP_SESSION_DELETION_RESPONSE_TYPE:
+        session = session_find(message->h.seid);
+        if (session && session->established) {
+            session->pending = false;
+            session->established = false;
+            num_of_deleted++;
+        }
+        break;
+
+    case OGS_PFCP_SESSION_REPORT_REQUEST_TYPE:
+        /* Nothing is buffered or measured, so nothing is reported */
+        break;
+
+    default:
+        ogs_debug("Ignore PFCP message [type:%d]", message->h.type);
+        break;
+    }
+}
+
+/* Handles the PFCP messages waiting on the socket. Returns how many */
+static int pfcp_recv(void)
+{
+    ogs_pfcp_message_t *message = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    ssize_t size;
+    int n = 0;
+
+    message = ogs_calloc(1, sizeof(*message));
+    ogs_assert(message);
+
+    while (1) {
+        pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+        ogs_assert(pkbuf);
+        ogs_pkbuf_put(pkbuf, OGS_MAX_SDU_LEN);
+
+        size = recv(upf->sock->fd, pkbuf->data, pkbuf->len, MSG_DONTWAIT);
+        if (size <= 0) {
+            ogs_pkbuf_free(pkbuf);
+            break;
+        }
+        ogs_pkbuf_trim(pkbuf, size);
+
+        if (ogs_pfcp_parse_msg(message, pkbuf) == OGS_OK)
+            pfcp_handle(message);
+        else
+            ogs_error("Cannot parse PFCP message");
+
+        ogs_pkbuf_free(pkbuf);
+        n++;
+    }
+
+    ogs_free(message);
+
+    return n;
+}
+
+/*
+ * Sends the requests of count sessions keeping at most PFCP_WINDOW of
+ * them unanswered, and waits until *done reaches count. A request left
+ * unanswered for PFCP_RETRANSMIT is sent again with the same sequence
+ * number, so the UPF answers it from its transaction if it got it.
+ */
+static int pfcp_run(void (*send)(session_t *session), int *done, int count)
+{
+    session_t *session = NULL;
+    ogs_time_t now, deadline;
+    int i = 0, j;
+
+    now = ogs_get_monotonic_time();
+    deadline = now + config.timeout;
+    while (*done < count && !stopped) {
+        for (; i < config.num_of_sess && i - *done < PFCP_WINDOW; i++) {
+            session = &session_array[i];
+            if (send == session_delete && !session->established)
+                continue;
+            session->xid = pfcp_next_xid();
+            session->requested = now;
+            session->pending = true;
+            send(session);
+        }
+
+        if (wait_readable(upf->sock->fd, ogs_time_from_msec(100)) &&
+            pfcp_recv())
+            deadline = ogs_get_monotonic_time() + config.timeout;
+
+        now = ogs_get_monotonic_time();
+        if (now > deadline)
+            return OGS_ERROR;
+
+        for (j = 0; j < i; j++) {
+            session = &session_array[j];
+            if (session->pending &&
+                now - session->requested > PFCP_RETRANSMIT) {
+                session->requested = now;
+                send(session);
+            }
+        }
+    }
+
+    return *done < count ? OGS_ERROR : OGS_OK;
+}
+
+static int sessions_add(void)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *ul_far = NULL;
+    ogs_pfcp_qer_t *qer = NULL;
+    ogs_paa_t paa;
+    ogs_ip_t ip;
+    uint32_t ue_addr;
+    int i;
+
+    ogs_pfcp_pool_init(&pfcp_template);
+
+    dl_far = ogs_pfcp_far_add(&pfcp_template);
+    ogs_assert(dl_far);
+    dl_far->dst_if = OGS_PFCP_INTERFACE_ACCESS;
+    dl_far->apply_action = OGS_PFCP_APPLY_ACTION_FORW;
+    ogs_assert(OGS_OK ==
+        ogs_sockaddr_to_ip(test_self()->gnb1_addr, NULL, &ip));
+    ogs_assert(OGS_OK ==
+        ogs_pfcp_ip_to_outer_header_creation(&ip,
+            &dl_far->outer_header_creation,
+            &dl_far->outer_header_creation_len));
+
+    ul_far = ogs_pfcp_far_add(&pfcp_template);
+    ogs_assert(ul_far);
+    ul_far->dst_if = OGS_PFCP_INTERFACE_CORE;
+    ul_far->apply_action = OGS_PFCP_APPLY_ACTION_FORW;
+
+    qer = ogs_pfcp_qer_add(&pfcp_template);
+    ogs_assert(qer);
+    qer->qfi = QFI;
+
+    memset(&paa, 0, sizeof(paa));
+    paa.session_type = OGS_PDU_SESSION_TYPE_IPV4;
+
+    /*
+     * The SDF filters come first (a lower precedence value) and match
+     * a remote address no packet is sent from, so each packet is
+     * checked against all of them before the default PDR forwards it.
+     */
+    for (i = 0; i < config.num_of_sdf * 2 + 2; i++) {
+        direction_e direction = i % MAX_NUM_OF_DIRECTION;
+        bool is_default = i >= config.num_of_sdf * 2;
+
+        pdr = ogs_pfcp_pdr_add(&pfcp_template);
+        ogs_assert(pdr);
+        if (config.dnn) {
+            pdr->dnn = ogs_strdup(config.dnn);
+            ogs_assert(pdr->dnn);
+        }
+
+        if (direction == DIRECTION_UPLINK) {
+            pdr->src_if = OGS_PFCP_INTERFACE_ACCESS;
+
+            /* Every uplink PDR shares the TEID chosen by the UPF */
+            pdr->f_teid.ipv4 = 1;
+            pdr->f_teid.ch = 1;
+            pdr->f_teid.chid = 1;
+            pdr->f_teid.choose_id = OGS_PFCP_DEFAULT_CHOOSE_ID;
+            pdr->f_teid_len = 2;
+            pdr->qfi = QFI;
+
+            pdr->outer_header_removal_len = 2;
+            pdr->outer_header_removal.description =
+                OGS_PFCP_OUTER_HEADER_REMOVAL_GTPU_UDP_IPV4;
+            pdr->outer_header_removal.gtpu_extheader_deletion =
+                OGS_PFCP_PDU_SESSION_CONTAINER_TO_BE_DELETED;
+
+            ogs_pfcp_pdr_associate_far(pdr, ul_far);
+        } else {
+            pdr->src_if = OGS_PFCP_INTERFACE_CORE;
+            ogs_pfcp_pdr_associate_far(pdr, dl_far);
+        }
+        ogs_pfcp_pdr_associate_qer(pdr, qer);
+
+        if (is_default) {
+            pdr->precedence = OGS_PFCP_DEFAULT_PDR_PRECEDENCE;
+
+            ogs_assert(OGS_OK ==
+                ogs_pfcp_paa_to_ue_ip_addr(&paa,
+                    &pdr->ue_ip_addr, &pdr->ue_ip_addr_len));
+            if (direction == DIRECTION_DOWNLINK)
+                pdr->ue_ip_addr.sd = OGS_PFCP_UE_IP_DST;
+
+            if (direction == DIRECTION_UPLINK)
+                ul_pdr = pdr;
+        } else {
+            int k = i / MAX_NUM_OF_DIRECTION;
+
+            pdr->precedence = OGS_PFCP_DEFAULT_PDR_PRECEDENCE -
+                config.num_of_sdf + k;
+
+            sdf_filter[direction][k] = ogs_msprintf(
+                    "permit out 17 from 192.0.2.%d to assigned", k + 1);
+            ogs_assert(sdf_filter[direction][k]);
+            pdr->flow_description[pdr->num_of_flow++] =
+                sdf_filter[direction][k];
+        }
+    }
+    ogs_assert(ul_pdr);
+
+    ogs_assert(OGS_OK ==
+        ogs_ipv4_from_string(&ue_addr, (char *)config.ue_addr));
+
+    session_array = ogs_calloc(config.num_of_sess, sizeof(session_t));
+    ogs_assert(session_array);
+
+    for (i = 0; i < config.num_of_sess; i++) {
+        session_t *session = &session_array[i];
+
+        session->index = i;
+        session->ue_addr = htobe32(be32toh(ue_addr) + i);
+        session->smf_n4_seid = i + 1;
+    }
+
+    return pfcp_run(session_establish, &num_of_answered, config.num_of_sess);
+}
+
+static void send_uplink(uint64_t sequence)
+{
+    static uint8_t buf[OGS_GTPV1U_5GC_HEADER_LEN + OGS_MAX_SDU_LEN];
+
+    session_t *session = &session_array[sequence % config.num_of_sess];
+    int flow = (sequence / config.num_of_sess) % config.num_of_flow;
+    ogs_gtp2_header_t *gtp_h = (ogs_gtp2_header_t *)buf;
+    struct ip *ip_h = NULL;
+    struct udphdr *udp_h = NULL;
+    payload_t payload;
+
+    if (!session->established)
+        return;
+
+    memcpy(buf, session->hdr, session->hlen);
+    gtp_h->length = htobe16(session->hlen + config.size -
+            OGS_GTPV1U_HEADER_LEN);
+
+    ip_h = (struct ip *)(buf + session->hlen);
+    memset(ip_h, 0, sizeof(*ip_h));
+    ip_h->ip_v = 4;
+    ip_h->ip_hl = 5;
+    ip_h->ip_ttl = 64;
+    ip_h->ip_p = IPPROTO_UDP;
+    ip_h->ip_len = htobe16(config.size);
+    ip_h->ip_id = htobe16(sequence);
+    ip_h->ip_src.s_addr = session->ue_addr;
+    ip_h->ip_dst.s_addr = dn_addr->sin.sin_addr.s_addr;
+    ip_h->ip_sum = ogs_in_cksum((uint16_t *)ip_h, sizeof(*ip_h));
+
+    udp_h = (struct udphdr *)(ip_h + 1);
+    udp_h->uh_sport = htobe16(UE_PORT_BASE + flow);
+    udp_h->uh_dport = htobe16(DN_PORT);
+    udp_h->uh_ulen = htobe16(config.size - sizeof(*ip_h));
+    udp_h->uh_sum = 0;
+
+    payload.magic = PAYLOAD_MAGIC;
+    payload.session = session->index;
+    payload.sequence = sequence;
+    payload.sent = ogs_get_monotonic_time();
+    memcpy(udp_h + 1, &payload, sizeof(payload));
+
+    if (ogs_sendto(gnb_node->sock->fd, buf, session->hlen + config.size, 0,
+                &session->upf_n3_addr) < 0)
+        return;
+    stats[DIRECTION_UPLINK].sent++;
+}
+
+static void send_downlink(uint64_t sequence)
+{
+    static uint8_t buf[OGS_MAX_SDU_LEN];
+
+    session_t *session = &session_array[sequence % config.num_of_sess];
+    int flow = (sequence / config.num_of_sess) % config.num_of_flow;
+    ogs_sockaddr_t addr;
+    payload_t payload;
+
+    if (!session->established)
+        return;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.ogs_sa_family = AF_INET;
+    addr.ogs_sin_port = htobe16(UE_PORT_BASE + flow);
+    addr.sin.sin_addr.s_addr = session->ue_addr;
+
+    payload.magic = PAYLOAD_MAGIC;
+    payload.session = session->index;
+    payload.sequence = sequence;
+    payload.sent = ogs_get_monotonic_time();
+    memcpy(buf, &payload, sizeof(payload));
+
+    if (ogs_sendto(dn_sock->fd, buf,
+                config.size - sizeof(struct ip) - sizeof(struct udphdr), 0,
+                &addr) < 0)
+        return;
+    stats[DIRECTION_DOWNLINK].sent++;
+}
+
+static void payload_received(direction_e direction, void *data, size_t len)
+{
+    payload_t payload;
+
+    if (len < sizeof(payload)) {
+        stats[direction].invalid++;
+        return;
+    }
+    memcpy(&payload, data, sizeof(payload));
+    if (payload.magic != PAYLOAD_MAGIC ||
+        payload.session >= config.num_of_sess) {
+        stats[direction].invalid++;
+        return;
+    }
+
+    stats[direction].received++;
+    loadgen_histogram_add(&stats[direction].latency,
+            ogs_get_monotonic_time() - payload.sent);
+}
+
+static void recv_uplink(void)
+{
+    static uint8_t buf[OGS_MAX_SDU_LEN];
+    ssize_t size;
+    int i;
+
+    for (i = 0; i < RECV_BATCH; i++) {
+        size = recv(dn_sock->fd, buf, sizeof(buf), MSG_DONTWAIT);
+        if (size <= 0)
+            break;
+        payload_received(DIRECTION_UPLINK, buf, size);
+    }
+}
+
+static void recv_downlink(void)
+{
+    size_t hlen = sizeof(struct ip) + sizeof(struct udphdr);
+    ssize_t size;
+    int i, len;
+
+    for (i = 0; i < RECV_BATCH; i++) {
+        size = recv(gnb_node->sock->fd,
+                recvbuf->data, OGS_MAX_SDU_LEN, MSG_DONTWAIT);
+        if (size <= 0)
+            break;
+        recvbuf->len = size;
+
+        len = ogs_gtpu_header_len(recvbuf);
+        if (len < 0 || size < len + hlen) {
+            stats[DIRECTION_DOWNLINK].invalid++;
+            continue;
+        }
+        payload_received(DIRECTION_DOWNLINK,
+                recvbuf->data + len + hlen, size - len - hlen);
+    }
+}
+
+static ogs_time_t run(void)
+{
+    ogs_time_t start, now, elapsed, deadline;
+    uint64_t due;
+    int i, d;
+
+    start = ogs_get_monotonic_time();
+    while (!stopped) {
+        now = ogs_get_monotonic_time();
+        elapsed = now - start;
+        if (elapsed >= config.duration)
+            break;
+
+        for (d = 0; d < MAX_NUM_OF_DIRECTION; d++) {
+            if (!config.direction[d])
+                continue;
+
+            due = config.rate ?
+                (uint64_t)(config.rate * elapsed / OGS_USEC_PER_SEC) :
+                UINT64_MAX;
+            for (i = 0; i < SEND_BATCH && stats[d].sent < due; i++) {
+                uint64_t sequence = stats[d].sent;
+
+                if (d == DIRECTION_UPLINK)
+                    send_uplink(sequence);
+                else
+                    send_downlink(sequence);
+
+                /* The socket buffer is full : try again later */
+                if (stats[d].sent == sequence)
+                    break;
+            }
+        }
+
+        recv_uplink();
+        recv_downlink();
+        pfcp_recv();
+    }
+    elapsed = ogs_get_monotonic_time() - start;
+
+    /* Packets still in flight are counted, not lost */
+    deadline = ogs_get_monotonic_time() + LINGER;
+    while (ogs_get_monotonic_time() < deadline) {
+        recv_uplink();
+        recv_downlink();
+    }
+
+    return elapsed;
+}
+
+static void print_report(ogs_time_t elapsed)
+{
+    double seconds = (double)elapsed / OGS_USEC_PER_SEC;
+    int i;
+
+    printf("\n%d sessions, %d flows, %d SDF filters, %d bytes "
+            "in %.1f seconds\n\n",
+            num_of_established, config.num_of_flow, config.num_of_sdf,
+            config.size, seconds);
+    printf("%-10s %12s %12s %8s %8s %8s %9s %9s %9s %9s\n",
+            "direction", "sent", "received", "loss(%)", "Mpps", "Gbit/s",
+            "p50(us)", "p90(us)", "p99(us)", "max(us)");
+
+    for (i = 0; i < MAX_NUM_OF_DIRECTION; i++) {
+        loadgen_histogram_t *latency = &stats[i].latency;
+        double pps = stats[i].received / seconds;
+
+        if (!config.direction[i])
+            continue;
+
+        printf("%-10s %12llu %12llu %8.3f %8.3f %8.3f "
+                "%9llu %9llu %9llu %9llu\n",
+            direction_name[i],
+            (unsigned long long)stats[i].sent,
+            (unsigned long long)stats[i].received,
+            stats[i].sent ? 100.0 * (stats[i].sent - stats[i].received) /
+                stats[i].sent : 0.0,
+            pps / 1e6,
+            pps * config.size * 8 / 1e9,
+            (unsigned long long)loadgen_histogram_percentile(latency, 50),
+            (unsigned long long)loadgen_histogram_percentile(latency, 90),
+            (unsigned long long)loadgen_histogram_percentile(latency, 99),
+            (unsigned long long)latency->max);
+        if (stats[i].invalid)
+            printf("%-10s %llu invalid packets\n", "",
+                    (unsigned long long)stats[i].invalid);
+    }
+    printf("\nGbit/s counts the inner IP packets\n");
+}
+
+static int setup(void)
+{
+    ogs_socknode_t *node = NULL;
+    ogs_sock_t *sock = NULL;
+    ogs_time_t deadline;
+    int rv;
+
+    ogs_list_for_each(&ogs_pfcp_self()->pfcp_list, node) {
+        sock = ogs_pfcp_server(node);
+        if (!sock) return OGS_ERROR;
+    }
+    ogs_pfcp_self()->pfcp_sock =
+        ogs_socknode_sock_first(&ogs_pfcp_self()->pfcp_list);
+    if (!ogs_pfcp_self()->pfcp_sock) {
+        ogs_fatal("No IPv4 PFCP address for the 'smf' in '%s'",
+                ogs_app()->file);
+        return OGS_ERROR;
+    }
+    ogs_pfcp_self()->pfcp_addr = &ogs_pfcp_self()->pfcp_sock->local_addr;
+
+    upf = ogs_list_first(&ogs_pfcp_self()->pfcp_peer_list);
+    if (!upf) {
+        ogs_fatal("No 'upf' in '%s'", ogs_app()->file);
+        return OGS_ERROR;
+    }
+    rv = ogs_pfcp_connect(ogs_pfcp_self()->pfcp_sock, NULL, upf);
+    if (rv != OGS_OK) return rv;
+
+    gnb_node = test_gtpu_server(1, AF_INET);
+    ogs_assert(gnb_node);
+
+    rv = ogs_getaddrinfo(&dn_addr, AF_INET, config.gw_addr, DN_PORT, 0);
+    ogs_assert(rv == OGS_OK);
+    dn_sock = ogs_udp_server(dn_addr, NULL);
+    if (!dn_sock) {
+        ogs_fatal("Cannot bind to %s:%d. Is the UPF running?",
+                config.gw_addr, DN_PORT);
+        return OGS_ERROR;
+    }
+
+    recvbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_SDU_LEN);
+    ogs_assert(recvbuf);
+    ogs_pkbuf_put(recvbuf, OGS_MAX_SDU_LEN);
+
+    pfcp_xid = ogs_random32() % PFCP_MAX_XID;
+
+    pfcp_send(ogs_pfcp_cp_build_association_setup_request(
+                OGS_PFCP_ASSOCIATION_SETUP_REQUEST_TYPE),
+            OGS_PFCP_ASSOCIATION_SETUP_REQUEST_TYPE, 0, pfcp_next_xid());
+    deadline = ogs_get_monotonic_time() + config.timeout;
+    while (!associated && !stopped && ogs_get_monotonic_time() < deadline) {
+        if (wait_readable(upf->sock->fd, ogs_time_from_msec(100)))
+            pfcp_recv();
+    }
+    if (!associated) {
+        ogs_fatal("No PFCP association with the UPF");
+        return OGS_ERROR;
+    }
+
+    rv = sessions_add();
+    if (num_of_failed || rv != OGS_OK) {
+        ogs_fatal("Only %d of %d sessions are established",
+                num_of_established, config.num_of_sess);
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+}
+
+static void cleanup(void)
+{
+    int i;
+
+    if (session_array) {
+        if (num_of_established &&
+            pfcp_run(session_delete,
+                &num_of_deleted, num_of_established) != OGS_OK)
+            ogs_error("Only %d of %d sessions are deleted",
+                    num_of_deleted, num_of_established);
+        ogs_free(session_array);
+    }
+
+    ogs_pfcp_sess_clear(&pfcp_template);
+    ogs_pfcp_pool_final(&pfcp_template);
+    for (i = 0; i < MAX_NUM_OF_SDF; i++) {
+        if (sdf_filter[DIRECTION_UPLINK][i])
+            ogs_free(sdf_filter[DIRECTION_UPLINK][i]);
+        if (sdf_filter[DIRECTION_DOWNLINK][i])
+            ogs_free(sdf_filter[DIRECTION_DOWNLINK][i]);
+    }
+
+    if (recvbuf)
+        ogs_pkbuf_free(recvbuf);
+    if (dn_sock)
+        ogs_sock_destroy(dn_sock);
+    if (dn_addr)
+        ogs_freeaddrinfo(dn_addr);
+    if (gnb_node)
+        test_gtpu_close(gnb_node);
+
+    ogs_socknode_remove_all(&ogs_pfcp_self()->pfcp_list);
+}
+
+static void stop(int signum)
+{
+    stopped = true;
+}
+
+static void show_help(const char *name)
+{
+    printf("Usage: %s [options]\n"
+        "Options:\n"
+       "   -c filename    : set configuration file\n"
+       "   -l filename    : set logging file\n"
+       "   -e level       : set global log-level (default:info)\n"
+       "   -m domain      : set log-domain (e.g. mme:sgw:gtp)\n"
+       "   -n num         : number of sessions (default:1)\n"
+       "   -s bytes       : inner IP packet size (default:128)\n"
+       "   -f num         : flows per session (default:1)\n"
+       "   -x num         : SDF filters per direction, up to %d"
+                            " (default:0)\n"
+       "   -r rate        : packets per second per direction,"
+                            " 0 for as fast as possible (default:0)\n"
+       "   -d seconds     : duration (default:10)\n"
+       "   -t msec        : PFCP timeout (default:3000)\n"
+       "   -a address     : first UE address (default:10.45.0.2)\n"
+       "   -g address     : TUN gateway address (default:10.45.0.1)\n"
+       "   -i dnn         : DNN of the UPF subnet\n"
+       "   -U             : uplink only\n"
+       "   -D             : downlink only\n"
+       "   -h             : show this message and exit\n"
+       "\n", name, MAX_NUM_OF_SDF);
+}
+
+int main(int argc, const char *const argv[])
+{
+    int rv, opt, argc_out = 0;
+    ogs_getopt_t options;
+    const char *argv_out[argc*2+1];
+    bool user_config = false;
+    ogs_time_t elapsed;
+    int i;
+
+    config.num_of_sess = 1;
+    config.size = 128;
+    config.num_of_flow = 1;
+    config.duration = ogs_time_from_sec(10);
+    config.timeout = ogs_time_from_msec(3000);
+    config.ue_addr = "10.45.0.2";
+    config.gw_addr = "10.45.0.1";
+    config.direction[DIRECTION_UPLINK] = true;
+    config.direction[DIRECTION_DOWNLINK] = true;
+
+    argv_out[argc_out++] = argv[0];
+
+    ogs_getopt_init(&options, (char**)argv);
+    while ((opt = ogs_getopt(&options, "c:l:e:m:n:s:f:x:r:d:t:a:g:i:UDh")) !=
+            -1) {
+        switch (opt) {
+        case 'c':
+            user_config = true;
+            argv_out[argc_out++] = "-c";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'l':
+            argv_out[argc_out++] = "-l";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'e':
+            argv_out[argc_out++] = "-e";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'm':
+            argv_out[argc_out++] = "-m";
+            argv_out[argc_out++] = options.optarg;
+            break;
+        case 'n':
+            config.num_of_sess = atoi(options.optarg);
+            break;
+        case 's':
+            config.size = atoi(options.optarg);
+            break;
+        case 'f':
+            config.num_of_flow = atoi(options.optarg);
+            break;
+        case 'x':
+            config.num_of_sdf = atoi(options.optarg);
+            break;
+        case 'r':
+            config.rate = atof(options.optarg);
+            break;
+        case 'd':
+            config.duration = ogs_time_from_sec(atoll(options.optarg));
+            break;
+        case 't':
+            config.timeout = ogs_time_from_msec(atoll(options.optarg));
+            break;
+        case 'a':
+            config.ue_addr = options.optarg;
+            break;
+        case 'g':
+            config.gw_addr = options.optarg;
+            break;
+        case 'i':
+            config.dnn = options.optarg;
+            break;
+        case 'U':
+            config.direction[DIRECTION_DOWNLINK] = false;
+            break;
+        case 'D':
+            config.direction[DIRECTION_UPLINK] = false;
+            break;
+        case 'h':
+            show_help(argv[0]);
+            return OGS_OK;
+        case '?':
+        default:
+            fprintf(stderr, "%s: %s\n", argv[0], options.errmsg);
+            show_help(argv[0]);
+            return OGS_ERROR;
+        }
+    }
+    argv_out[argc_out] = NULL;
+
+    if (config.num_of_sess < 1 || config.num_of_flow < 1 ||
+        config.num_of_sdf < 0 || config.num_of_sdf > MAX_NUM_OF_SDF ||
+        config.size < (int)MIN_PACKET_SIZE || config.size > OGS_MAX_SDU_LEN ||
+        config.rate < 0 || config.duration <= 0 || config.timeout <= 0 ||
+        (!config.direction[DIRECTION_UPLINK] &&
+         !config.direction[DIRECTION_DOWNLINK])) {
+        fprintf(stderr, "%s: invalid options\n", argv[0]);
+        show_help(argv[0]);
+        return OGS_ERROR;
+    }
+
+    rv = ogs_app_initialize(NULL,
+            user_config ? NULL : DEFAULT_CONFIG_FILENAME, argv_out);
+    if (rv != OGS_OK) {
+        fprintf(stderr, "%s: cannot initialize\n", argv[0]);
+        return rv;
+    }
+
+    ogs_log_install_domain(&__ogs_gtp_domain, "gtp", OGS_LOG_ERROR);
+
+    ogs_pfcp_context_init();
+    rv = ogs_pfcp_context_parse_config("smf", "upf");
+    ogs_assert(rv == OGS_OK);
+    test_context_init();
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    rv = setup();
+    if (rv == OGS_OK) {
+        for (i = 0; i < MAX_NUM_OF_DIRECTION; i++)
+            loadgen_histogram_init(&stats[i].latency);
+
+        elapsed = run();
+        print_report(elapsed);
+    }
+
+    cleanup();
+
+    test_context_final();
+    ogs_pfcp_context_final();
+
+    ogs_app_terminate();
+
+    return rv;
+}
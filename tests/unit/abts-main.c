@@ -25,6 +25,7 @@ extern int __ogs_ngap_domain;
 extern int __ogs_nas_domain;
 extern int __ogs_gtp_domain;
 extern int __ogs_sbi_domain;
+extern int __ogs_dbi_domain;
 
 void ogs_sbi_message_init(int num_of_request_pool, int num_of_response_pool);
 void ogs_sbi_message_final(void);
@@ -35,6 +36,7 @@ abts_suite *test_gtp_message(abts_suite *suite);
 abts_suite *test_ngap_message(abts_suite *suite);
 abts_suite *test_sbi_message(abts_suite *suite);
 abts_suite *test_security(abts_suite *suite);
+abts_suite *test_dbi(abts_suite *suite);
 abts_suite *test_crash(abts_suite *suite);
 
 const struct testlist {
@@ -46,6 +48,7 @@ const struct testlist {
     {test_ngap_message},
     {test_sbi_message},
     {test_security},
+    {test_dbi},
     {test_crash},
     {NULL},
 };
@@ -105,6 +108,7 @@ int main(int argc, const char *const argv[])
     ogs_log_install_domain(&__ogs_nas_domain, "nas", OGS_LOG_ERROR);
     ogs_log_install_domain(&__ogs_gtp_domain, "gtp", OGS_LOG_ERROR);
     ogs_log_install_domain(&__ogs_sbi_domain, "sbi", OGS_LOG_ERROR);
+    ogs_log_install_domain(&__ogs_dbi_domain, "dbi", OGS_LOG_ERROR);
 
     atexit(terminate);
 
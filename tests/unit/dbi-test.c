@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2022 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <sys/wait.h>
+#include <fcntl.h>
+
+#include "ogs-dbi.h"
+#include "core/abts.h"
+
+#define DBI_TEST_SUPI           "imsi-001010000000001"
+#define DBI_TEST_SQN            64
+
+static bson_t *test_subscriber(const char *dnn)
+{
+    bson_t *doc = BCON_NEW(
+            "imsi", BCON_UTF8("001010000000001"),
+            "msisdn", "[", BCON_UTF8("821012345678"), "]",
+            "slice", "[", "{",
+                "sst", BCON_INT32(1),
+                "session", "[", "{",
+                    "name", BCON_UTF8(dnn),
+                    "type", BCON_INT32(3),
+                "}", "]",
+            "}", "]",
+            "security", "{",
+                "k", BCON_UTF8("465B5CE8 B199B49F AA5F0A2E E238A6BC"),
+                "opc", BCON_UTF8("E8ED289D EBA952E4 283B54E8 8E6183CA"),
+                "amf", BCON_UTF8("8000"),
+                "sqn", BCON_INT64(DBI_TEST_SQN),
+            "}");
+    ogs_assert(doc);
+
+    return doc;
+}
+
+static char *test_store(void)
+{
+    char *path = NULL;
+    bson_t *doc = NULL;
+    int rv;
+
+    path = ogs_msprintf("/tmp/open5gs-unit-%d.db", (int)getpid());
+    ogs_assert(path);
+
+    rv = ogs_dbi_store_create(path, 1);
+    ogs_assert(rv == OGS_OK);
+
+    doc = test_subscriber("internet");
+    rv = ogs_dbi_store_put(doc);
+    ogs_assert(rv == OGS_OK);
+    bson_destroy(doc);
+
+    ogs_dbi_store_close();
+
+    return path;
+}
+
+static int test_dbi_init(const char *path)
+{
+    char *db_uri = NULL;
+    int rv;
+
+    db_uri = ogs_msprintf("%s%s", OGS_DBI_STORE_URI_PREFIX, path);
+    ogs_assert(db_uri);
+    rv = ogs_dbi_init(db_uri);
+    ogs_free(db_uri);
+
+    return rv;
+}
+
+static void test_overwrite(
+        const char *path, off_t offset, const void *data, size_t size)
+{
+    int fd = open(path, O_RDWR);
+    ogs_assert(fd >= 0);
+    ogs_assert(pwrite(fd, data, size, offset) == size);
+    close(fd);
+}
+
+static void dbi_test1(abts_case *tc, void *data)
+{
+    char *path = NULL;
+    ogs_dbi_record_t record;
+    ogs_dbi_auth_info_t auth_info;
+    ogs_msisdn_data_t msisdn_data;
+    ogs_slice_data_t *slice_data = NULL;
+    pid_t pid;
+    int i, rv, status;
+
+    path = test_store();
+
+    rv = test_dbi_init(path);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    /* The record is stored decoded */
+    rv = ogs_dbi_subscription_record(DBI_TEST_SUPI, &record);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    slice_data = &record.subscription_data.slice[0];
+    ABTS_INT_EQUAL(tc, 1, record.subscription_data.num_of_slice);
+    ABTS_INT_EQUAL(tc, 1, slice_data->num_of_session);
+    ABTS_STR_EQUAL(tc, "internet", slice_data->session[0].name);
+
+    rv = ogs_dbi_subscription_record("imsi-001010000000002", &record);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+
+    memset(&msisdn_data, 0, sizeof(msisdn_data));
+    rv = ogs_dbi_msisdn_data("821012345678", &msisdn_data);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_STR_EQUAL(tc, "001010000000001", msisdn_data.imsi.bcd);
+
+    rv = ogs_dbi_auth_info(DBI_TEST_SUPI, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == DBI_TEST_SQN);
+
+    /* Another process sharing the file advances the same SQN */
+    pid = fork();
+    ogs_assert(pid >= 0);
+    if (pid == 0) {
+        for (i = 0; i < 1000; i++)
+            ogs_dbi_increment_sqn(DBI_TEST_SUPI);
+        _exit(0);
+    }
+    for (i = 0; i < 1000; i++) {
+        rv = ogs_dbi_increment_sqn(DBI_TEST_SUPI);
+        ogs_assert(rv == OGS_OK);
+    }
+    ABTS_INT_EQUAL(tc, pid, waitpid(pid, &status, 0));
+
+    rv = ogs_dbi_auth_info(DBI_TEST_SUPI, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == DBI_TEST_SQN + 2000 * 32);
+
+    rv = ogs_dbi_update_sqn(DBI_TEST_SUPI, 96);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_dbi_auth_info(DBI_TEST_SUPI, &auth_info);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_TRUE(tc, auth_info.sqn == 96);
+
+    ogs_dbi_final();
+
+    unlink(path);
+    ogs_free(path);
+}
+
+static void dbi_test2(abts_case *tc, void *data)
+{
+    char *path = NULL;
+    uint32_t num_of_bucket = 1000;
+    uint64_t offset = (uint64_t)1 << 40;
+    int rv;
+
+    /* num_of_bucket is at 12. It must be a power of two */
+    path = test_store();
+    test_overwrite(path, 12, &num_of_bucket, sizeof(num_of_bucket));
+    rv = ogs_dbi_store_open(path);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    unlink(path);
+    ogs_free(path);
+
+    /* The bucket table starts at 4096 */
+    path = test_store();
+    test_overwrite(path, 4096, &offset, sizeof(offset));
+    rv = ogs_dbi_store_open(path);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    unlink(path);
+    ogs_free(path);
+
+    path = test_store();
+    ogs_assert(truncate(path, 8192) == 0);
+    rv = ogs_dbi_store_open(path);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    unlink(path);
+    ogs_free(path);
+}
+
+static void dbi_test3(abts_case *tc, void *data)
+{
+    char *path = NULL;
+    bson_t *doc = NULL;
+    ogs_dbi_record_t record;
+    int rv;
+
+    path = test_store();
+
+    rv = test_dbi_init(path);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    rv = ogs_dbi_cache_init(16, 0, false);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    /* The record is built and kept with the cached document */
+    rv = ogs_dbi_cache_lookup_record(DBI_TEST_SUPI, &record);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_STR_EQUAL(tc, "internet",
+            record.subscription_data.slice[0].session[0].name);
+
+    /* Changed from the WebUI, as seen by the change stream */
+    doc = test_subscriber("ims");
+    ogs_dbi_cache_update(DBI_TEST_SUPI, doc);
+    bson_destroy(doc);
+
+    rv = ogs_dbi_cache_lookup_record(DBI_TEST_SUPI, &record);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ABTS_STR_EQUAL(tc, "ims",
+            record.subscription_data.slice[0].session[0].name);
+
+    ogs_dbi_final();
+
+    unlink(path);
+    ogs_free(path);
+}
+
+abts_suite *test_dbi(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, dbi_test1, NULL);
+    abts_run_test(suite, dbi_test2, NULL);
+    abts_run_test(suite, dbi_test3, NULL);
+
+    return suite;
+}
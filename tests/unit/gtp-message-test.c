@@ -312,11 +312,45 @@ static void gtp_message_test1(abts_case *tc, void *data)
     ABTS_INT_EQUAL(tc, 0, req.ue_tcp_port.presence);
 }
 
+static void gtp_message_test2(abts_case *tc, void *data)
+{
+    /* G-PDU with a PDU Session Container, QFI 5 */
+    const char *_header = "34ff000000001234 0000008501000500";
+    const char *_short = "30ff000000001234";
+    char hexbuf[OGS_GTPV1U_5GC_HEADER_LEN];
+    uint8_t hdr[OGS_GTPV1U_5GC_HEADER_LEN];
+    uint8_t hlen;
+
+    ogs_gtp2_header_t gtp_hdesc;
+    ogs_gtp2_extension_header_t ext_hdesc;
+
+    memset(&gtp_hdesc, 0, sizeof(gtp_hdesc));
+    memset(&ext_hdesc, 0, sizeof(ext_hdesc));
+
+    gtp_hdesc.type = OGS_GTPU_MSGTYPE_GPDU;
+    gtp_hdesc.teid = 0x1234;
+    ext_hdesc.qos_flow_identifier = 5;
+
+    hlen = ogs_gtp2_build_user_plane_header(hdr, &gtp_hdesc, &ext_hdesc);
+    ABTS_INT_EQUAL(tc, OGS_GTPV1U_5GC_HEADER_LEN, hlen);
+    ABTS_TRUE(tc, memcmp(hdr,
+        OGS_HEX(_header, strlen(_header), hexbuf), hlen) == 0);
+
+    /* Without QFI, only the mandatory part */
+    ext_hdesc.qos_flow_identifier = 0;
+
+    hlen = ogs_gtp2_build_user_plane_header(hdr, &gtp_hdesc, &ext_hdesc);
+    ABTS_INT_EQUAL(tc, OGS_GTPV1U_HEADER_LEN, hlen);
+    ABTS_TRUE(tc, memcmp(hdr,
+        OGS_HEX(_short, strlen(_short), hexbuf), hlen) == 0);
+}
+
 abts_suite *test_gtp_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, gtp_message_test1, NULL);
+    abts_run_test(suite, gtp_message_test2, NULL);
 
     return suite;
 }
@@ -621,7 +621,7 @@ static void sbi_message_test6(abts_case *tc, void *data)
     content = cJSON_Print(item);
     cJSON_Delete(item);
     ogs_assert(content);
-    ABTS_INT_EQUAL(tc, 148, (int)strlen(content));
+    ABTS_INT_EQUAL(tc, 140, (int)strlen(content));
     ogs_free(content);
 }
 
@@ -784,6 +784,70 @@ static void sbi_message_test7(abts_case *tc, void *data)
         ogs_sbi_service_type_from_name(OGS_SBI_SERVICE_NAME_NNSSAAF_NSSAA));
 }
 
+static void sbi_message_test8(abts_case *tc, void *data)
+{
+    const char *json =
+        "{\"nfInstanceId\":\"NF_INSTANCE_ID\","
+        "\"nfType\":\"SMF\","
+        "\"nfStatus\":\"REGISTERED\","
+        "\"plmnList\":[{\"mcc\":\"111\",\"mnc\":\"222\"}],"
+        "\"fqdn\":\"smf.\\\"open5gs\\\"\\n.org\","
+        "\"priority\":30,"
+        "\"nfServiceList\":{\"id1\":{"
+            "\"serviceInstanceId\":\"id1\","
+            "\"serviceName\":\"nsmf-pdusession\","
+            "\"versions\":[{\"apiVersionInUri\":\"v1\","
+                "\"apiFullVersion\":\"1.0.0\"}],"
+            "\"scheme\":\"http\","
+            "\"nfServiceStatus\":\"REGISTERED\","
+            "\"load\":80}}}";
+
+    cJSON *item = NULL;
+    char *str1 = NULL, *str2 = NULL;
+    OpenAPI_nf_profile_t *nf_profile = NULL;
+    OpenAPI_json_writer_t writer;
+    ogs_sbi_message_t message;
+    ogs_sbi_response_t *response = NULL;
+
+    item = cJSON_Parse(json);
+    ABTS_PTR_NOTNULL(tc, item);
+    nf_profile = OpenAPI_nf_profile_parseFromJSON(item);
+    ABTS_PTR_NOTNULL(tc, nf_profile);
+    cJSON_Delete(item);
+
+    /* Same text as the cJSON tree, without building it */
+    OpenAPI_json_writer_init(&writer);
+    ABTS_TRUE(tc, OpenAPI_nf_profile_writeJSON(&writer, NULL, nf_profile));
+    str1 = OpenAPI_json_writer_finish(&writer);
+    ABTS_STR_EQUAL(tc, json, str1);
+
+    item = OpenAPI_nf_profile_convertToJSON(nf_profile);
+    ABTS_PTR_NOTNULL(tc, item);
+    str2 = cJSON_PrintUnformatted(item);
+    ABTS_STR_EQUAL(tc, str2, str1);
+    cJSON_Delete(item);
+
+    ogs_free(str1);
+    ogs_free(str2);
+
+    /* A missing mandatory field fails the whole body */
+    ogs_free(nf_profile->nf_instance_id);
+    nf_profile->nf_instance_id = NULL;
+
+    OpenAPI_json_writer_init(&writer);
+    ABTS_TRUE(tc,
+        OpenAPI_nf_profile_writeJSON(&writer, NULL, nf_profile) == false);
+    OpenAPI_json_writer_clear(&writer);
+
+    /* and no response is built without its body */
+    memset(&message, 0, sizeof(message));
+    message.NFProfile = nf_profile;
+    response = ogs_sbi_build_response(&message, OGS_SBI_HTTP_STATUS_OK);
+    ABTS_PTR_EQUAL(tc, NULL, response);
+
+    OpenAPI_nf_profile_free(nf_profile);
+}
+
 abts_suite *test_sbi_message(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -795,6 +859,7 @@ abts_suite *test_sbi_message(abts_suite *suite)
     abts_run_test(suite, sbi_message_test5, NULL);
     abts_run_test(suite, sbi_message_test6, NULL);
     abts_run_test(suite, sbi_message_test7, NULL);
+    abts_run_test(suite, sbi_message_test8, NULL);
 
     return suite;
 }